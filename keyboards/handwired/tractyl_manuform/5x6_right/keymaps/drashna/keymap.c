@@ -66,8 +66,7 @@ const uint8_t led_mapping[RGBLIGHT_LED_COUNT] = {0,  1,  2,  3,  32, 31, 12, 13,
 #    include "qp.h"
 #    include "display/painter/graphics/assets.h"
 
-static painter_device_t       display;
-static painter_image_handle_t my_image;
+static painter_device_t display;
 
 void keyboard_post_init_keymap(void) {
     display =
@@ -76,16 +75,13 @@ void keyboard_post_init_keymap(void) {
     qp_clear(display);
     qp_power(display, true);
     if (is_keyboard_master()) {
-        my_image = qp_load_image_mem(gfx_anime_girl_jacket_240x320);
-        qp_drawimage_recolor(display, 0, 0, my_image, true ? 213 : 0, 0, 255, 0, 0, 0);
+        painter_rle565_draw(display, 0, 0, &gfx_anime_girl_jacket_240x320_rle565);
     } else {
-        my_image = qp_load_image_mem(gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320);
-        qp_drawimage(display, 0, 0, my_image);
+        painter_rle565_draw(display, 0, 0, &gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_rle565);
     }
     qp_flush(display);
-    // my_image = qp_load_image_mem(gfx_neon_genesis_evangelion_initial_machine_02_240x320);
-    // my_image = qp_load_image_mem(gfx_asuka_240x320);
-    qp_close_image(my_image);
+    // painter_rle565_draw(display, 0, 0, &gfx_neon_genesis_evangelion_initial_machine_02_240x320_rle565);
+    // painter_rle565_draw(display, 0, 0, &gfx_asuka_240x320_rle565);
 }
 #endif // QUANTUM_PAINTER_ENABLE &&  !CUSTOM_QUANTUM_PAINTER_ENABLE
 
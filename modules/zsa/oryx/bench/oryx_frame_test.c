@@ -0,0 +1,504 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * @brief Host test for the Oryx RGB frame commands and the key event queue.
+ *
+ * Feeds packet sequences into raw_hid_receive(), renders the webhid effect into a stubbed LED driver a pass at a
+ * time, and checks that every frame comes out intact, that frames only change between passes, that broken
+ * sequences are rejected, and how many packets a frame takes against one ORYX_SET_RGB_LED per LED. Also checks that
+ * ORYX_GET_CAPABILITIES advertises the frame commands, which sit past the upstream command range.
+ *
+ * Then it pairs, and drives random key presses and layer changes through pre_process_record_oryx() and
+ * layer_state_set_oryx(), with housekeeping_task_oryx() run in between on a stubbed timer. The reports are decoded
+ * the way a host would, and checked against the events that were made: same order, same key timing, no gaps in the
+ * batch sequence, no key held past ORYX_KEY_EVENT_FLUSH_MS and no layer change held past the next housekeeping. Both
+ * with and without batching, and with the queue overflowing.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o oryx_frame_test -Imodules/zsa/oryx/bench -Iusers/drashna/bench/qmk -Imodules/zsa/oryx \
+ *         -DQMK_KEYBOARD_H='"quantum.h"' -DPROTOCOL_CHIBIOS -DRGB_MATRIX_ENABLE -DRGB_MATRIX_CUSTOM_KB \
+ *         -DRGB_MATRIX_LED_COUNT=72 -DRGB_MATRIX_LED_PROCESS_LIMIT=18 -DSERIAL_NUMBER='"test"' \
+ *         modules/zsa/oryx/bench/oryx_frame_test.c modules/zsa/oryx/oryx.c
+ *     ./oryx_frame_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "quantum.h"
+#include "oryx.h"
+#include "usb_endpoints.h"
+
+#define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#include "rgb_matrix_module.inc"
+
+#define TEST_FRAMES     200
+#define TEST_KEY_STEPS  20000
+#define SENT_LOG_SIZE   64
+#define TEST_MAX_EVENTS (TEST_KEY_STEPS + 64)
+
+/*
+ * Stubs: the LED driver keeps what the effect sets, and the host keeps what the keyboard sends.
+ */
+
+layer_state_t layer_state, default_layer_state;
+rgb_config_t  rgb_matrix_config = {.hsv = {0, 0, UINT8_MAX}};
+
+static RGB      leds[RGB_MATRIX_LED_COUNT];
+static uint8_t  sent[RAW_EPSIZE], sent_log[SENT_LOG_SIZE][RAW_EPSIZE];
+static uint32_t sent_count, received_count;
+static uint16_t timer;
+
+uint8_t get_highest_layer(layer_state_t state) {
+    return state ? 31 - __builtin_clz(state) : 0;
+}
+void layer_off(uint8_t layer) {}
+void layer_move(uint8_t layer) {}
+void wait_ms(uint32_t ms) {}
+uint16_t timer_read(void) {
+    return timer;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return timer - last;
+}
+void rgb_matrix_mode_noeeprom(uint8_t mode) {}
+void rgb_matrix_reload_from_eeprom(void) {}
+void rgb_matrix_increase_val_noeeprom(void) {}
+void rgb_matrix_decrease_val_noeeprom(void) {}
+
+void rgb_matrix_set_color(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (RGB){.r = red, .g = green, .b = blue};
+}
+
+bool rgb_matrix_check_finished_leds(uint8_t led_max) {
+    return led_max < RGB_MATRIX_LED_COUNT;
+}
+
+bool pre_process_record_oryx_kb(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+layer_state_t layer_state_set_oryx_kb(layer_state_t state) {
+    return state;
+}
+layer_state_t default_layer_state_set_oryx_kb(layer_state_t state) {
+    return state;
+}
+
+bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
+    memcpy(sent, report, size);
+    memcpy(sent_log[sent_count++ % SENT_LOG_SIZE], report, size);
+    return true;
+}
+
+/*
+ * Host side of the protocol
+ */
+
+static void send_packet(uint8_t *packet) {
+    received_count++;
+    raw_hid_receive(packet, RAW_EPSIZE);
+}
+
+static void send_start(uint8_t id, uint8_t format, uint8_t led_count, uint8_t palette_size) {
+    uint8_t packet[RAW_EPSIZE] = {ORYX_RGB_FRAME_START, id, format, led_count, palette_size};
+    send_packet(packet);
+}
+
+static void send_chunk(uint8_t id, uint16_t offset, const uint8_t *payload, uint8_t length) {
+    uint8_t packet[RAW_EPSIZE] = {ORYX_RGB_FRAME_DATA, id, offset & 0xFF, offset >> 8, length};
+    memcpy(&packet[5], payload, length);
+    send_packet(packet);
+}
+
+static void send_commit(uint8_t id) {
+    uint8_t packet[RAW_EPSIZE] = {ORYX_RGB_FRAME_COMMIT, id};
+    send_packet(packet);
+}
+
+/**
+ * @brief Sends a frame's payload in chunks, skipping one of them if skip_chunk isn't -1.
+ *
+ * @return uint32_t number of packets sent, with the start and the commit
+ */
+static uint32_t send_frame(uint8_t id, uint8_t format, uint8_t led_count, uint8_t palette_size,
+                           const uint8_t *payload, uint16_t size, int skip_chunk) {
+    uint32_t before = received_count;
+    send_start(id, format, led_count, palette_size);
+    for (uint16_t offset = 0, chunk = 0; offset < size; offset += ORYX_RGB_FRAME_CHUNK_SIZE, chunk++) {
+        uint8_t length = size - offset < ORYX_RGB_FRAME_CHUNK_SIZE ? size - offset : ORYX_RGB_FRAME_CHUNK_SIZE;
+        if (chunk != skip_chunk) {
+            send_chunk(id, offset, &payload[offset], length);
+        }
+    }
+    send_commit(id);
+    return received_count - before;
+}
+
+static void render_pass(uint8_t iter) {
+    effect_params_t params = {.iter = iter};
+    oryx_webhid_effect(&params);
+}
+
+static void render(void) {
+    for (uint8_t iter = 0; iter * RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT; iter++) {
+        render_pass(iter);
+    }
+}
+
+static RGB expand_rgb565(uint16_t colour) {
+    uint8_t r = colour >> 11, g = colour >> 5 & 0x3F, b = colour & 0x1F;
+    return (RGB){.r = r * 255 / 31, .g = g * 255 / 63, .b = b * 255 / 31};
+}
+
+/*
+ * Tests
+ */
+
+static int failures = 0;
+
+#define CHECK(condition, ...)              \
+    do {                                   \
+        if (!(condition)) {                \
+            printf("FAIL %s: ", __func__); \
+            printf(__VA_ARGS__);           \
+            printf("\n");                  \
+            failures++;                    \
+        }                                  \
+    } while (0)
+
+static bool leds_equal(const RGB *expected, uint8_t count, int *tolerance_used) {
+    for (uint8_t i = 0; i < count; i++) {
+        int dr = abs(leds[i].r - expected[i].r), dg = abs(leds[i].g - expected[i].g),
+            db = abs(leds[i].b - expected[i].b);
+        int worst = dr > dg ? (dr > db ? dr : db) : (dg > db ? dg : db);
+        if (worst > 1) {
+            return false;
+        }
+        if (tolerance_used && worst > *tolerance_used) {
+            *tolerance_used = worst;
+        }
+    }
+    return true;
+}
+
+static void test_capabilities(void) {
+    uint8_t packet[RAW_EPSIZE] = {ORYX_GET_CAPABILITIES};
+
+    CHECK(ORYX_RGB_FRAME_START >= ORYX_VENDOR_COMMAND_BASE && ORYX_RGB_FRAME_COMMIT < ORYX_GET_PROTOCOL_VERSION &&
+              ORYX_EVT_RGB_FRAME_COMMITTED >= ORYX_VENDOR_COMMAND_BASE &&
+              ORYX_ERR_RGB_FRAME_INCOMPLETE >= ORYX_VENDOR_COMMAND_BASE,
+          "the frame commands, events or errors overlap the upstream range");
+    send_packet(packet);
+    CHECK(sent[0] == ORYX_EVT_CAPABILITIES && (sent[1] & ORYX_CAPABILITY_RGB_FRAME) &&
+              sent[2] == RGB_MATRIX_LED_COUNT && sent[3] == ORYX_RGB_FRAME_MAX_PALETTE &&
+              sent[4] == ORYX_RGB_FRAME_CHUNK_SIZE,
+          "capabilities came back as %02X %02X %02X %02X %02X", sent[0], sent[1], sent[2], sent[3], sent[4]);
+}
+
+static void test_rgb565_frames(void) {
+    uint8_t  payload[RGB_MATRIX_LED_COUNT * 2];
+    RGB      expected[RGB_MATRIX_LED_COUNT];
+    uint32_t packets = 0;
+    int      rounding = 0;
+
+    for (uint16_t frame = 0; frame < TEST_FRAMES; frame++) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            uint16_t colour = (frame == 0 && i == 0) ? 0xFFFF : (uint16_t)rand();
+            payload[i * 2]     = colour >> 8;
+            payload[i * 2 + 1] = colour & 0xFF;
+            expected[i]        = expand_rgb565(colour);
+        }
+        uint32_t events = sent_count;
+        packets += send_frame(frame, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0, payload, sizeof(payload), -1);
+        CHECK(sent_count == events + 1 && sent[0] == ORYX_EVT_RGB_FRAME_COMMITTED && sent[1] == (uint8_t)frame,
+              "frame %u wasn't acknowledged once", frame);
+        render();
+        CHECK(leds_equal(expected, RGB_MATRIX_LED_COUNT, &rounding), "frame %u came out wrong", frame);
+    }
+    printf("RGB565:  %lu packets per frame, against %u with ORYX_SET_RGB_LED (%u frames, rounding within %d)\n",
+           (unsigned long)(packets / TEST_FRAMES), RGB_MATRIX_LED_COUNT, TEST_FRAMES, rounding);
+}
+
+static void test_palette_frames(void) {
+    const uint8_t palette_size = 8;
+    uint8_t       payload[ORYX_RGB_FRAME_MAX_PALETTE * 3 + RGB_MATRIX_LED_COUNT];
+    RGB           palette[ORYX_RGB_FRAME_MAX_PALETTE], expected[RGB_MATRIX_LED_COUNT];
+    uint32_t      packets = 0;
+
+    for (uint16_t frame = 0; frame < TEST_FRAMES; frame++) {
+        for (uint8_t i = 0; i < palette_size; i++) {
+            palette[i]         = (RGB){.r = rand(), .g = rand(), .b = rand()};
+            payload[i * 3]     = palette[i].r;
+            payload[i * 3 + 1] = palette[i].g;
+            payload[i * 3 + 2] = palette[i].b;
+        }
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            uint8_t index                 = rand() % palette_size;
+            payload[palette_size * 3 + i] = index;
+            expected[i]                   = palette[index];
+        }
+        packets += send_frame(frame, ORYX_RGB_FRAME_PALETTE, RGB_MATRIX_LED_COUNT, palette_size, payload,
+                              palette_size * 3 + RGB_MATRIX_LED_COUNT, -1);
+        render();
+        CHECK(memcmp(leds, expected, sizeof(leds)) == 0, "frame %u came out wrong", frame);
+    }
+    printf("palette: %lu packets per frame with %u colours\n", (unsigned long)(packets / TEST_FRAMES), palette_size);
+}
+
+static void test_frame_changes_between_passes(void) {
+    uint8_t payload[RGB_MATRIX_LED_COUNT * 2];
+    RGB     first[RGB_MATRIX_LED_COUNT], second[RGB_MATRIX_LED_COUNT];
+
+    memset(payload, 0x00, sizeof(payload));
+    send_frame(1, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0, payload, sizeof(payload), -1);
+    render();
+    memcpy(first, leds, sizeof(leds));
+
+    // commit a white frame in the middle of a pass, which has to finish with the black one
+    memset(payload, 0xFF, sizeof(payload));
+    render_pass(0);
+    send_frame(2, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0, payload, sizeof(payload), -1);
+    for (uint8_t iter = 1; iter * RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT; iter++) {
+        render_pass(iter);
+    }
+    CHECK(memcmp(leds, first, sizeof(leds)) == 0, "the frame changed part way through a pass");
+    render();
+    memcpy(second, leds, sizeof(leds));
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        CHECK(second[i].r == 255 && second[i].g == 255 && second[i].b == 255, "LED %u isn't white", i);
+    }
+}
+
+static void test_broken_sequences(void) {
+    uint8_t payload[RGB_MATRIX_LED_COUNT * 2];
+    RGB     shown[RGB_MATRIX_LED_COUNT];
+
+    memset(payload, 0x00, sizeof(payload));
+    send_frame(3, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0, payload, sizeof(payload), -1);
+    render();
+    memcpy(shown, leds, sizeof(leds));
+    memset(payload, 0x55, sizeof(payload));
+
+    // a lost chunk
+    send_frame(4, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0, payload, sizeof(payload), 2);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE, "lost chunk not reported");
+    render();
+    CHECK(memcmp(leds, shown, sizeof(leds)) == 0, "a frame with a lost chunk was shown");
+
+    // a lost last chunk, so the commit comes early
+    send_start(5, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0);
+    send_chunk(5, 0, payload, ORYX_RGB_FRAME_CHUNK_SIZE);
+    send_commit(5);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_INCOMPLETE, "early commit not reported");
+
+    // a repeated chunk
+    send_start(6, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0);
+    send_chunk(6, 0, payload, ORYX_RGB_FRAME_CHUNK_SIZE);
+    send_chunk(6, 0, payload, ORYX_RGB_FRAME_CHUNK_SIZE);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE, "repeated chunk not reported");
+
+    // a chunk or commit for another frame
+    send_start(7, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT, 0);
+    send_chunk(8, 0, payload, ORYX_RGB_FRAME_CHUNK_SIZE);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE, "stray chunk not reported");
+
+    // too many LEDs, an unknown format, and a palette index out of range
+    send_start(9, ORYX_RGB_FRAME_RGB565, RGB_MATRIX_LED_COUNT + 1, 0);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_INVALID, "too many LEDs not reported");
+    send_start(10, 7, RGB_MATRIX_LED_COUNT, 0);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_INVALID, "unknown format not reported");
+    uint8_t palette_payload[3 + RGB_MATRIX_LED_COUNT] = {0};
+    palette_payload[3 + 10]                           = 1;
+    send_frame(11, ORYX_RGB_FRAME_PALETTE, RGB_MATRIX_LED_COUNT, 1, palette_payload, sizeof(palette_payload), -1);
+    CHECK(sent[0] == ORYX_EVT_ERROR && sent[1] == ORYX_ERR_RGB_FRAME_INVALID, "bad palette index not reported");
+
+    render();
+    CHECK(memcmp(leds, shown, sizeof(leds)) == 0, "a broken frame was shown");
+}
+
+static void test_short_frame(void) {
+    uint8_t payload[4] = {0xF8, 0x00, 0x07, 0xE0};
+
+    send_frame(12, ORYX_RGB_FRAME_RGB565, 2, 0, payload, sizeof(payload), -1);
+    render();
+    CHECK(leds[0].r == 255 && leds[0].g == 0 && leds[1].g == 255 && leds[1].r == 0, "short frame came out wrong");
+    for (uint8_t i = 2; i < RGB_MATRIX_LED_COUNT; i++) {
+        CHECK(leds[i].r == 0 && leds[i].g == 0 && leds[i].b == 0, "LED %u past the frame isn't off", i);
+    }
+}
+
+/*
+ * Key event queue. The host decodes every report into the events it stands for, and they are checked in order
+ * against the events that were made.
+ */
+
+bool          pre_process_record_oryx(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_oryx(layer_state_t state);
+void          housekeeping_task_oryx(void);
+
+typedef struct {
+    bool     layer;
+    uint8_t  col; // or the layer
+    uint8_t  row;
+    bool     pressed;
+    uint16_t time;
+} test_event_t;
+
+static test_event_t made[TEST_MAX_EVENTS], got[TEST_MAX_EVENTS];
+static uint32_t     made_count, got_count, checked_count, host_read, host_dropped;
+static uint16_t     host_time;
+static uint8_t      host_sequence, made_layer;
+static bool         host_sequence_known;
+
+static void make_key(uint8_t col, uint8_t row, bool pressed) {
+    keyrecord_t record = {.event = {.key = {.col = col, .row = row}, .pressed = pressed, .time = timer}};
+    made[made_count++] = (test_event_t){.col = col, .row = row, .pressed = pressed, .time = timer};
+    pre_process_record_oryx(0, &record);
+}
+
+static void make_layer(uint8_t layer) {
+    if (layer != made_layer) {
+        made[made_count++] = (test_event_t){.layer = true, .col = layer};
+        made_layer         = layer;
+    }
+    layer_state_set_oryx(1u << layer);
+}
+
+/**
+ * @brief Decodes the reports sent since the last call into got[].
+ */
+static void host_receive(void) {
+    CHECK(sent_count - host_read <= SENT_LOG_SIZE, "the report log overflowed");
+    for (; host_read < sent_count; host_read++) {
+        uint8_t *report = sent_log[host_read % SENT_LOG_SIZE];
+        switch (report[0]) {
+            case ORYX_EVT_KEYDOWN:
+            case ORYX_EVT_KEYUP:
+                got[got_count++] = (test_event_t){
+                    .col = report[1], .row = report[2], .pressed = report[0] == ORYX_EVT_KEYDOWN, .time = timer};
+                break;
+            case ORYX_EVT_LAYER:
+                got[got_count++] = (test_event_t){.layer = true, .col = report[1]};
+                break;
+            case ORYX_EVT_KEY_BATCH:
+                CHECK(!host_sequence_known || report[1] == (uint8_t)(host_sequence + 1), "batch %u followed %u",
+                      report[1], host_sequence);
+                CHECK(report[2] > 0 && report[2] <= ORYX_KEY_BATCH_SIZE, "a batch of %u events", report[2]);
+                host_sequence       = report[1];
+                host_sequence_known = true;
+                host_dropped += report[3];
+                for (uint8_t i = 0; i < report[2]; i++) {
+                    uint8_t *packed = &report[4 + i * 4];
+                    host_time += packed[2] | packed[3] << 8;
+                    got[got_count++] = (test_event_t){
+                        .col = packed[0], .row = packed[1] & 0x7F, .pressed = packed[1] >> 7, .time = host_time};
+                }
+                break;
+            default:
+                CHECK(false, "unexpected report %02X", report[0]);
+        }
+    }
+}
+
+/**
+ * @brief Checks the events received since the last call against the ones made, up to the ones that are due.
+ *
+ * @param batching whether the key times came in the reports
+ */
+static void host_check(bool batching) {
+    uint32_t due = checked_count;
+
+    for (uint32_t i = checked_count; i < made_count; i++) {
+        if (made[i].layer || (uint16_t)(timer - made[i].time) >= ORYX_KEY_EVENT_FLUSH_MS || !batching) {
+            due = i + 1; // and everything before it, to keep the order
+        }
+    }
+    host_receive();
+    CHECK(got_count >= due, "%u of %u events are due, only %u sent", due, made_count, got_count);
+    CHECK(got_count <= made_count, "%u events sent, but only %u made", got_count, made_count);
+    for (; checked_count < got_count && checked_count < made_count; checked_count++) {
+        test_event_t *m = &made[checked_count], *g = &got[checked_count];
+        if (m->layer != g->layer || m->col != g->col || m->row != g->row || m->pressed != g->pressed ||
+            (batching && !m->layer && m->time != g->time)) {
+            CHECK(false, "event %u: got %s %u,%u %u at %u, made %s %u,%u %u at %u", checked_count,
+                  g->layer ? "layer" : "key", g->col, g->row, g->pressed, g->time, m->layer ? "layer" : "key", m->col,
+                  m->row, m->pressed, m->time);
+            checked_count = got_count;
+            break;
+        }
+    }
+}
+
+static void host_pair(bool batching) {
+    uint8_t pair[RAW_EPSIZE] = {ORYX_CMD_PAIRING_INIT}, batch[RAW_EPSIZE] = {ORYX_KEY_EVENT_BATCHING, batching};
+
+    send_packet(pair);
+    host_read = sent_count; // the pairing answer and the current layer
+    send_packet(batch);
+    CHECK(sent[0] == ORYX_EVT_KEY_EVENT_BATCHING && sent[1] == batching, "batching wasn't turned %s",
+          batching ? "on" : "off");
+    host_read           = sent_count;
+    host_time           = timer;
+    host_sequence_known = false;
+    made_count = got_count = checked_count = 0;
+}
+
+static void test_key_events(bool batching) {
+    host_pair(batching);
+    uint32_t reports = sent_count;
+    for (uint32_t step = 0; step < TEST_KEY_STEPS; step++) {
+        timer += rand() % 4;
+        uint8_t action = rand() % 10;
+        // keep the queue from overflowing, which test_key_overflow() covers
+        if (made_count - got_count >= ORYX_KEY_EVENT_QUEUE_SIZE - 1 || action < 4) {
+            housekeeping_task_oryx();
+            host_check(batching);
+        } else if (action < 9) {
+            make_key(rand() % 16, rand() % 8, rand() % 2);
+        } else {
+            make_layer(rand() % 4);
+        }
+    }
+    timer += ORYX_KEY_EVENT_FLUSH_MS;
+    housekeeping_task_oryx();
+    host_check(batching);
+    CHECK(got_count == made_count && host_dropped == 0, "%u of %u events sent, %u dropped", got_count, made_count,
+          host_dropped);
+    printf("%s: %u events in %lu reports, in order\n", batching ? "batched" : "one by one", made_count,
+           (unsigned long)(sent_count - reports));
+}
+
+static void test_key_overflow(void) {
+    host_pair(true);
+    host_dropped = 0;
+    for (uint8_t i = 0; i < ORYX_KEY_EVENT_QUEUE_SIZE + 3; i++) {
+        make_key(i, 0, true);
+    }
+    made_count = ORYX_KEY_EVENT_QUEUE_SIZE; // the last three don't fit
+    make_layer(made_layer + 1);              // nor does the layer change, which goes out last
+    housekeeping_task_oryx();
+    host_receive();
+    CHECK(got_count == made_count && host_dropped == 3, "%u of %u events sent, %u dropped", got_count, made_count,
+          host_dropped);
+    CHECK(got_count && got[got_count - 1].layer && got[got_count - 1].col == made_layer, "the layer change was lost");
+    for (uint32_t i = 0; i + 1 < got_count; i++) {
+        CHECK(!got[i].layer && got[i].col == i, "event %u is out of order", i);
+    }
+}
+
+int main(void) {
+    srand(1);
+    test_capabilities();
+    test_rgb565_frames();
+    test_palette_frames();
+    test_frame_changes_between_passes();
+    test_broken_sequences();
+    test_short_frame();
+    test_key_events(false);
+    test_key_events(true);
+    test_key_overflow();
+    printf("%s\n", failures ? "FAILED" : "all frame and key event tests passed");
+    return failures != 0;
+}
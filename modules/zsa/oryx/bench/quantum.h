@@ -0,0 +1,71 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host stand in for quantum.h, for the Oryx RGB frame test. Only what oryx.c and rgb_matrix_module.inc use.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ASSERT_COMMUNITY_MODULES_MIN_API_VERSION(major, minor, patch)
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} RGB;
+
+typedef struct {
+    struct {
+        struct {
+            uint8_t col;
+            uint8_t row;
+        } key;
+        bool     pressed;
+        uint16_t time;
+    } event;
+} keyrecord_t;
+
+typedef uint32_t layer_state_t;
+
+typedef struct {
+    uint8_t iter;
+    bool    init;
+} effect_params_t;
+
+typedef struct {
+    struct {
+        uint8_t h, s, v;
+    } hsv;
+} rgb_config_t;
+
+#define RGB_MATRIX_USE_LIMITS(min, max)                                \
+    uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter;         \
+    uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;                  \
+    if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
+#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_CUSTOM_oryx_webhid_effect 1
+
+extern layer_state_t layer_state, default_layer_state;
+extern rgb_config_t  rgb_matrix_config;
+
+uint8_t get_highest_layer(layer_state_t state);
+void    layer_off(uint8_t layer);
+void    layer_move(uint8_t layer);
+void    wait_ms(uint32_t ms);
+
+uint16_t timer_read(void);
+uint16_t timer_elapsed(uint16_t last);
+
+void rgb_matrix_mode_noeeprom(uint8_t mode);
+void rgb_matrix_reload_from_eeprom(void);
+void rgb_matrix_increase_val_noeeprom(void);
+void rgb_matrix_decrease_val_noeeprom(void);
+void rgb_matrix_set_color(uint8_t index, uint8_t red, uint8_t green, uint8_t blue);
+bool rgb_matrix_check_finished_leds(uint8_t led_max);
+
+bool          pre_process_record_oryx_kb(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_oryx_kb(layer_state_t state);
+layer_state_t default_layer_state_set_oryx_kb(layer_state_t state);
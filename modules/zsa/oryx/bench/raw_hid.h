@@ -0,0 +1,10 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host stand in for raw_hid.h, for the Oryx RGB frame test.
+
+#pragma once
+
+#include <stdint.h>
+
+void raw_hid_receive(uint8_t *data, uint8_t length);
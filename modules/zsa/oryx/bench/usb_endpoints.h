@@ -0,0 +1,10 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host stand in for usb_endpoints.h, for the Oryx RGB frame test.
+
+#pragma once
+
+typedef int usb_endpoint_in_lut_t;
+
+#define USB_ENDPOINT_IN_RAW 0
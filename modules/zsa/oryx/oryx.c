@@ -14,8 +14,26 @@ rawhid_state_t rawhid_state = {
     .paired             = false,
     .rgb_control        = false,
     .status_led_control = false,
+    .key_event_batching = false,
 };
 
+typedef struct {
+    uint8_t  col;
+    uint8_t  row;   // or the layer, for a layer change
+    bool     pressed;
+    bool     layer; // a layer change, queued with the key events so that it is sent in its place among them
+    uint16_t time;
+} oryx_key_event_t;
+
+static oryx_key_event_t key_events[ORYX_KEY_EVENT_QUEUE_SIZE];
+static uint8_t          key_events_head     = 0; // oldest queued event
+static uint8_t          key_events_count    = 0;
+static uint8_t          key_events_dropped  = 0; // events there was no room for, since the last report
+static uint8_t          layer_events_queued = 0;
+static uint8_t          key_batch_sequence  = 0;
+static uint16_t         key_events_sent     = 0; // time of the last event sent, for the deltas
+static bool             layer_event_pending = false; // a layer change the queue had no room for
+
 #if defined(PROTOCOL_LUFA)
 bool send_report(uint8_t endpoint, void *report, size_t size);
 #    include "usb_descriptor.h"
@@ -27,7 +45,29 @@ bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 #endif
 
 #ifdef RGB_MATRIX_ENABLE
-RGB webhid_leds[RGB_MATRIX_LED_COUNT];
+#    if !defined(PROTOCOL_LUFA)
+static RGB webhid_frame_buffers[2][RGB_MATRIX_LED_COUNT];
+// the frame the effect shows, and the one the next ORYX_RGB_FRAME_* sequence is written to
+RGB        *webhid_leds  = webhid_frame_buffers[0];
+static RGB *webhid_frame = webhid_frame_buffers[1];
+
+static struct {
+    uint8_t  id;
+    uint8_t  format;
+    uint8_t  led_count;
+    uint8_t  palette_size;
+    uint16_t size;     // bytes of payload the frame takes
+    uint16_t received; // bytes of payload received so far
+    uint8_t  high;     // first byte of the RGB565 colour being received
+    bool     active;
+    bool     valid;
+    RGB      palette[ORYX_RGB_FRAME_MAX_PALETTE];
+} rgb_frame;
+static volatile bool rgb_frame_pending = false;
+#    else
+static RGB webhid_frame_buffer[RGB_MATRIX_LED_COUNT];
+RGB       *webhid_leds = webhid_frame_buffer;
+#    endif
 #endif
 
 void raw_hid_send_oryx(uint8_t *data, uint8_t length) {
@@ -60,6 +100,9 @@ void oryx_layer_event(void) {
 
 void pairing_failed_event(void) {
     rawhid_state.paired = false;
+    key_events_count    = 0;
+    layer_events_queued = 0;
+    layer_event_pending = false;
     uint8_t event[RAW_EPSIZE];
     event[0] = ORYX_EVT_PAIRING_FAILED;
     event[1] = ORYX_STOP_BIT;
@@ -67,7 +110,13 @@ void pairing_failed_event(void) {
 }
 
 void pairing_success_event(void) {
-    rawhid_state.paired = true;
+    rawhid_state.paired             = true;
+    rawhid_state.key_event_batching = false; // until the host asks for it
+    key_events_count                = 0;
+    key_events_dropped              = 0;
+    layer_events_queued             = 0;
+    layer_event_pending             = false;
+    key_events_sent                 = timer_read();
     uint8_t event[RAW_EPSIZE];
     event[0] = ORYX_EVT_PAIRING_SUCCESS;
     event[1] = ORYX_STOP_BIT;
@@ -98,6 +147,8 @@ void set_webhid_effect(void) {
 
 void clear_webhid_effect(void) {
 #if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+    rgb_frame.active  = false;
+    rgb_frame_pending = false;
     // Clear the pattern
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
         webhid_leds[i] = (RGB){.r = 0, .g = 0, .b = 0};
@@ -107,6 +158,159 @@ void clear_webhid_effect(void) {
 #endif
 }
 
+#if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+/**
+ * @brief Decodes the next byte of a frame's payload into the frame being received.
+ *
+ * @param value byte of payload
+ */
+static void oryx_rgb_frame_put(uint8_t value) {
+    uint16_t position = rgb_frame.received++;
+
+    if (rgb_frame.format == ORYX_RGB_FRAME_PALETTE) {
+        uint16_t palette_bytes = rgb_frame.palette_size * 3;
+        if (position < palette_bytes) {
+            RGB *colour = &rgb_frame.palette[position / 3];
+            switch (position % 3) {
+                case 0:
+                    colour->r = value;
+                    break;
+                case 1:
+                    colour->g = value;
+                    break;
+                default:
+                    colour->b = value;
+                    break;
+            }
+        } else if (value < rgb_frame.palette_size) {
+            webhid_frame[position - palette_bytes] = rgb_frame.palette[value];
+        } else {
+            rgb_frame.valid = false;
+        }
+    } else if (position & 1) {
+        uint16_t colour = rgb_frame.high << 8 | value;
+        // scale each channel up to 8 bits by repeating its top bits, so that full scale stays full scale
+        webhid_frame[position / 2] = (RGB){
+            .r = (colour >> 8 & 0xF8) | (colour >> 13),
+            .g = (colour >> 3 & 0xFC) | (colour >> 9 & 0x03),
+            .b = (colour << 3 & 0xF8) | (colour >> 2 & 0x07),
+        };
+    } else {
+        rgb_frame.high = value;
+    }
+}
+
+/**
+ * @brief Starts receiving a frame, dropping any frame that was being received or waiting to be shown.
+ *
+ * @param param frame id, format, LED count and palette size
+ */
+static void oryx_rgb_frame_start(uint8_t *param) {
+    rgb_frame.active  = false;
+    rgb_frame_pending = false;
+
+    uint8_t led_count = param[2], palette_size = param[3];
+    if (led_count == 0 || led_count > RGB_MATRIX_LED_COUNT) {
+        oryx_error(ORYX_ERR_RGB_FRAME_INVALID);
+        return;
+    }
+    switch (param[1]) {
+        case ORYX_RGB_FRAME_RGB565:
+            rgb_frame.size = led_count * 2;
+            break;
+        case ORYX_RGB_FRAME_PALETTE:
+            if (palette_size == 0 || palette_size > ORYX_RGB_FRAME_MAX_PALETTE) {
+                oryx_error(ORYX_ERR_RGB_FRAME_INVALID);
+                return;
+            }
+            rgb_frame.size = palette_size * 3 + led_count;
+            break;
+        default:
+            oryx_error(ORYX_ERR_RGB_FRAME_INVALID);
+            return;
+    }
+
+    rgb_frame.id           = param[0];
+    rgb_frame.format       = param[1];
+    rgb_frame.led_count    = led_count;
+    rgb_frame.palette_size = palette_size;
+    rgb_frame.received     = 0;
+    rgb_frame.valid        = true;
+    rgb_frame.active       = true;
+    memset(webhid_frame, 0, sizeof(webhid_frame_buffers[0]));
+}
+
+/**
+ * @brief Adds a chunk of payload to the frame being received. Chunks have to arrive in order, so a lost or repeated
+ * packet drops the frame rather than showing it with the wrong colours.
+ *
+ * @param param frame id, offset, length and payload
+ */
+static void oryx_rgb_frame_data(uint8_t *param) {
+    uint16_t offset = param[1] | param[2] << 8;
+    uint8_t  length = param[3];
+
+    if (!rgb_frame.active || param[0] != rgb_frame.id || offset != rgb_frame.received ||
+        length > ORYX_RGB_FRAME_CHUNK_SIZE || rgb_frame.size - rgb_frame.received < length) {
+        rgb_frame.active = false;
+        oryx_error(ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE);
+        return;
+    }
+    for (uint8_t i = 0; i < length; i++) {
+        oryx_rgb_frame_put(param[4 + i]);
+    }
+}
+
+/**
+ * @brief Hands a complete frame to the effect, to be shown from its next pass.
+ *
+ * @param param frame id
+ */
+static void oryx_rgb_frame_commit(uint8_t *param) {
+    if (!rgb_frame.active || param[0] != rgb_frame.id) {
+        rgb_frame.active = false;
+        oryx_error(ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE);
+        return;
+    }
+    rgb_frame.active = false;
+    if (rgb_frame.received != rgb_frame.size) {
+        oryx_error(ORYX_ERR_RGB_FRAME_INCOMPLETE);
+        return;
+    }
+    if (!rgb_frame.valid) {
+        oryx_error(ORYX_ERR_RGB_FRAME_INVALID);
+        return;
+    }
+
+    rgb_frame_pending = true;
+    if (rawhid_state.rgb_control == false) {
+        set_webhid_effect();
+    }
+    uint8_t event[RAW_EPSIZE];
+    event[0] = ORYX_EVT_RGB_FRAME_COMMITTED;
+    event[1] = rgb_frame.id;
+    event[2] = ORYX_STOP_BIT;
+    raw_hid_send_oryx(event, RAW_EPSIZE);
+}
+#endif
+
+#ifdef RGB_MATRIX_ENABLE
+/**
+ * @brief Swaps in the last committed frame, if there is one. Called by the effect before each pass over the LEDs,
+ * so that every pass shows a single frame. Like raw_hid_receive(), it expects to run from the main loop.
+ */
+void oryx_rgb_frame_apply(void) {
+#    if !defined(PROTOCOL_LUFA)
+    if (rgb_frame_pending) {
+        RGB *shown        = webhid_leds;
+        webhid_leds       = webhid_frame;
+        webhid_frame      = shown;
+        rgb_frame_pending = false;
+    }
+#    endif
+}
+#endif
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t  command = data[0];
     uint8_t *param   = &data[1];
@@ -139,6 +343,25 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
                 break;
             }
 
+        case ORYX_GET_CAPABILITIES:
+            {
+                uint8_t event[RAW_EPSIZE];
+                event[0] = ORYX_EVT_CAPABILITIES;
+#if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+                event[1] = ORYX_CAPABILITY_RGB_FRAME | ORYX_CAPABILITY_KEY_EVENT_BATCHING;
+                event[2] = RGB_MATRIX_LED_COUNT;
+#else
+                event[1] = ORYX_CAPABILITY_KEY_EVENT_BATCHING;
+                event[2] = 0;
+#endif
+                event[3] = ORYX_RGB_FRAME_MAX_PALETTE;
+                event[4] = ORYX_RGB_FRAME_CHUNK_SIZE;
+                event[5] = ORYX_STOP_BIT;
+
+                raw_hid_send_oryx(event, RAW_EPSIZE);
+                break;
+            }
+
         case ORYX_CMD_PAIRING_INIT:
             pairing_success_event();
 
@@ -288,23 +511,180 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
                 raw_hid_send_oryx(event, RAW_EPSIZE);
                 break;
             }
+        case ORYX_RGB_FRAME_START:
+#if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+            oryx_rgb_frame_start(param);
+#else
+            oryx_error(ORYX_ERR_RGB_MATRIX_NOT_ENABLED);
+#endif
+            break;
+        case ORYX_RGB_FRAME_DATA:
+#if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+            oryx_rgb_frame_data(param);
+#else
+            oryx_error(ORYX_ERR_RGB_MATRIX_NOT_ENABLED);
+#endif
+            break;
+        case ORYX_RGB_FRAME_COMMIT:
+#if defined(RGB_MATRIX_ENABLE) && !defined(PROTOCOL_LUFA)
+            oryx_rgb_frame_commit(param);
+#else
+            oryx_error(ORYX_ERR_RGB_MATRIX_NOT_ENABLED);
+#endif
+            break;
+        case ORYX_KEY_EVENT_BATCHING:
+            {
+                rawhid_state.key_event_batching = param[0];
+                uint8_t event[RAW_EPSIZE];
+                event[0] = ORYX_EVT_KEY_EVENT_BATCHING;
+                event[1] = rawhid_state.key_event_batching;
+                event[2] = ORYX_STOP_BIT;
+                raw_hid_send_oryx(event, RAW_EPSIZE);
+                break;
+            }
         default:
             oryx_error(ORYX_ERR_UNKNOWN_COMMAND);
     }
 }
 
+/**
+ * @brief Sends the oldest queued key event on its own, as an ORYX_EVT_KEYDOWN or ORYX_EVT_KEYUP.
+ */
+static void oryx_send_key_event(void) {
+    oryx_key_event_t *key_event = &key_events[key_events_head];
+    uint8_t           event[RAW_EPSIZE];
+
+    event[0] = key_event->pressed ? ORYX_EVT_KEYDOWN : ORYX_EVT_KEYUP;
+    event[1] = key_event->col;
+    event[2] = key_event->row;
+    event[3] = ORYX_STOP_BIT;
+
+    key_events_sent = key_event->time; // so the deltas are right if the host turns batching on later
+    key_events_head = (key_events_head + 1) % ORYX_KEY_EVENT_QUEUE_SIZE;
+    key_events_count--;
+    raw_hid_send_oryx(event, sizeof(event));
+}
+
+/**
+ * @brief Sends up to ORYX_KEY_BATCH_SIZE of the oldest queued key events in one ORYX_EVT_KEY_BATCH report, stopping
+ * at the first queued layer change.
+ */
+static void oryx_send_key_batch(void) {
+    uint8_t event[RAW_EPSIZE] = {0};
+    uint8_t count             = 0;
+
+    event[0]           = ORYX_EVT_KEY_BATCH;
+    event[1]           = key_batch_sequence++;
+    event[3]           = key_events_dropped;
+    key_events_dropped = 0;
+    while (count < ORYX_KEY_BATCH_SIZE && key_events_count && !key_events[key_events_head].layer) {
+        oryx_key_event_t *key_event = &key_events[key_events_head];
+        uint8_t          *packed    = &event[4 + count++ * 4];
+        uint16_t          delta     = key_event->time - key_events_sent;
+
+        packed[0]       = key_event->col;
+        packed[1]       = key_event->row | (key_event->pressed ? 0x80 : 0);
+        packed[2]       = delta & 0xFF;
+        packed[3]       = delta >> 8;
+        key_events_sent = key_event->time;
+        key_events_head = (key_events_head + 1) % ORYX_KEY_EVENT_QUEUE_SIZE;
+        key_events_count--;
+    }
+    event[2] = count;
+    raw_hid_send_oryx(event, sizeof(event));
+}
+
+/**
+ * @brief Sends a layer change as an ORYX_EVT_LAYER.
+ *
+ * @param layer the highest active layer
+ */
+static void oryx_send_layer_event(uint8_t layer) {
+#if defined(PROTOCOL_LUFA)
+    // Required for Atmel Boards
+    wait_ms(10);
+#endif
+    uint8_t event[RAW_EPSIZE];
+    event[0] = ORYX_EVT_LAYER;
+    event[1] = layer;
+    event[2] = ORYX_STOP_BIT;
+    raw_hid_send_oryx(event, sizeof(event));
+}
+
+/**
+ * @brief Whether the queued key events should go out in batches now, rather than wait for more to fill them. A
+ * layer change flushes the key events before it straight away, so that it isn't held back either.
+ */
+static bool oryx_key_batch_due(void) {
+    return key_events_count >= ORYX_KEY_BATCH_SIZE || key_events_dropped || layer_events_queued ||
+           layer_event_pending ||
+           (key_events_count && timer_elapsed(key_events[key_events_head].time) >= ORYX_KEY_EVENT_FLUSH_MS);
+}
+
+/**
+ * @brief Sends the queued key and layer events in the order they happened, so that the USB writes stay out of the
+ * key processing path.
+ */
+void housekeeping_task_oryx(void) {
+    if (!rawhid_state.paired) {
+        key_events_count    = 0;
+        layer_events_queued = 0;
+        layer_event_pending = false;
+        return;
+    }
+
+    while (key_events_count && rawhid_state.paired) {
+        if (key_events[key_events_head].layer) {
+            uint8_t layer   = key_events[key_events_head].row;
+            key_events_head = (key_events_head + 1) % ORYX_KEY_EVENT_QUEUE_SIZE;
+            key_events_count--;
+            layer_events_queued--;
+            oryx_send_layer_event(layer);
+        } else if (!rawhid_state.key_event_batching) {
+            oryx_send_key_event();
+        } else if (oryx_key_batch_due()) {
+            oryx_send_key_batch();
+        } else {
+            break;
+        }
+    }
+
+    // a layer change the queue had no room for goes out once the events before it have
+    if (layer_event_pending && !key_events_count && rawhid_state.paired) {
+        layer_event_pending = false;
+        oryx_send_layer_event(current_layer);
+    }
+}
+
+/**
+ * @brief Adds an event to the queue, if there is room for it.
+ *
+ * @return true if it was queued
+ */
+static bool oryx_queue_event(oryx_key_event_t event) {
+    if (key_events_count == ORYX_KEY_EVENT_QUEUE_SIZE) {
+        return false;
+    }
+    key_events[(key_events_head + key_events_count) % ORYX_KEY_EVENT_QUEUE_SIZE] = event;
+    key_events_count++;
+    return true;
+}
+
 bool pre_process_record_oryx(uint16_t keycode, keyrecord_t *record) {
     if (!pre_process_record_oryx_kb(keycode, record)) {
         return true;
     }
-    // While paired, the keyboard sends keystrokes positions to the host
+    // While paired, the keyboard sends keystrokes positions to the host, from housekeeping_task_oryx()
     if (rawhid_state.paired == true) {
-        uint8_t event[RAW_EPSIZE];
-        event[0] = record->event.pressed ? ORYX_EVT_KEYDOWN : ORYX_EVT_KEYUP;
-        event[1] = record->event.key.col;
-        event[2] = record->event.key.row;
-        event[3] = ORYX_STOP_BIT;
-        raw_hid_send_oryx(event, sizeof(event));
+        bool queued = oryx_queue_event((oryx_key_event_t){
+            .col     = record->event.key.col,
+            .row     = record->event.key.row,
+            .pressed = record->event.pressed,
+            .time    = record->event.time,
+        });
+        if (!queued && key_events_dropped < UINT8_MAX) {
+            key_events_dropped++;
+        }
     }
     return true;
 }
@@ -319,15 +699,11 @@ layer_state_t layer_state_set_oryx(layer_state_t state) {
             return state;
         }
         current_layer = layer;
-#if defined(PROTOCOL_LUFA)
-        // Required for Atmel Boards
-        wait_ms(10);
-#endif
-        uint8_t event[RAW_EPSIZE];
-        event[0] = ORYX_EVT_LAYER;
-        event[1] = current_layer;
-        event[2] = ORYX_STOP_BIT;
-        raw_hid_send_oryx(event, sizeof(event));
+        if (!layer_event_pending && oryx_queue_event((oryx_key_event_t){.row = layer, .layer = true})) {
+            layer_events_queued++;
+        } else {
+            layer_event_pending = true;
+        }
     }
     return state;
 }
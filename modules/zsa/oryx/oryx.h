@@ -15,6 +15,41 @@ define.
 
 Once the host has paired, it can freely use the commands define in the Oryx_Command_Code enum for which the board will
 always respond with a Oryx_Event_Code or a Oryx_Error_Code.
+
+Commands from ORYX_VENDOR_COMMAND_BASE up to ORYX_GET_PROTOCOL_VERSION are extensions of this userspace, and aren't
+part of the protocol version. A host finds out which ones the board has with ORYX_GET_CAPABILITIES, which older
+firmware answers with ORYX_ERR_UNKNOWN_COMMAND:
+
+    ORYX_EVT_CAPABILITIES  flags led_count max_palette chunk_size
+
+where flags is a set of Oryx_Capability bits, led_count the number of RGB matrix LEDs, max_palette
+ORYX_RGB_FRAME_MAX_PALETTE and chunk_size ORYX_RGB_FRAME_CHUNK_SIZE.
+
+With ORYX_CAPABILITY_RGB_FRAME, a whole RGB frame can be sent in a few packets rather than one ORYX_SET_RGB_LED per
+LED:
+
+    ORYX_RGB_FRAME_START   frame_id format led_count palette_size
+    ORYX_RGB_FRAME_DATA    frame_id offset_lo offset_hi length payload...   (any number of these, in order)
+    ORYX_RGB_FRAME_COMMIT  frame_id
+
+The payload is a stream of bytes, split across the data packets with up to ORYX_RGB_FRAME_CHUNK_SIZE bytes each, at
+consecutive offsets. For ORYX_RGB_FRAME_RGB565 it holds a big endian RGB565 colour per LED. For ORYX_RGB_FRAME_PALETTE
+it holds palette_size RGB888 colours, followed by a palette index per LED. LEDs past led_count are turned off.
+
+Only the commit is answered, with ORYX_EVT_RGB_FRAME_COMMITTED, or with an error if a packet was missing or out of
+order, in which case the frame is dropped. A committed frame is shown from the next pass of the effect, so a frame is
+never shown half updated. Starting a new frame before a committed one is shown replaces it.
+
+Key and layer events are queued as they happen, in one queue, and sent in that order from the housekeeping task rather
+than from the key processing path. With ORYX_CAPABILITY_KEY_EVENT_BATCHING, the host can send ORYX_KEY_EVENT_BATCHING 1
+to have the key events packed into ORYX_EVT_KEY_BATCH reports instead of one ORYX_EVT_KEYDOWN/ORYX_EVT_KEYUP each:
+
+    ORYX_EVT_KEY_BATCH  sequence count dropped (col row|pressed<<7 delta_lo delta_hi)...
+
+The sequence number goes up by one with each report, so the host can tell if a report went missing, and dropped is
+the number of events the queue had no room for since the last report. Each event's delta is the time in ms since
+the one before it. A report is sent once it is full, or ORYX_KEY_EVENT_FLUSH_MS after the oldest event in it. A layer
+change ends the report it falls in, which is sent straight away, ahead of the ORYX_EVT_LAYER.
 */
 
 #include "quantum.h"
@@ -24,8 +59,21 @@ always respond with a Oryx_Event_Code or a Oryx_Error_Code.
 #    define RAW_EPSIZE 32
 #endif
 
-#define ORYX_PROTOCOL_VERSION 0x04
-#define ORYX_STOP_BIT         -2
+#define ORYX_PROTOCOL_VERSION     0x04
+#define ORYX_STOP_BIT             -2
+#define ORYX_VENDOR_COMMAND_BASE  0xF0
+
+#ifndef ORYX_RGB_FRAME_MAX_PALETTE
+#    define ORYX_RGB_FRAME_MAX_PALETTE 16
+#endif // ORYX_RGB_FRAME_MAX_PALETTE
+#define ORYX_RGB_FRAME_CHUNK_SIZE (RAW_EPSIZE - 5)
+#ifndef ORYX_KEY_EVENT_QUEUE_SIZE
+#    define ORYX_KEY_EVENT_QUEUE_SIZE 16
+#endif // ORYX_KEY_EVENT_QUEUE_SIZE
+#ifndef ORYX_KEY_EVENT_FLUSH_MS
+#    define ORYX_KEY_EVENT_FLUSH_MS 8
+#endif // ORYX_KEY_EVENT_FLUSH_MS
+#define ORYX_KEY_BATCH_SIZE ((RAW_EPSIZE - 4) / 4)
 
 enum Oryx_Command_Code {
     ORYX_CMD_GET_FW_VERSION,
@@ -39,6 +87,11 @@ enum Oryx_Command_Code {
     ORYX_UPDATE_BRIGHTNESS,
     ORYX_SET_RGB_LED_ALL,
     ORYX_STATUS_LED_CONTROL,
+    ORYX_GET_CAPABILITIES = ORYX_VENDOR_COMMAND_BASE,
+    ORYX_RGB_FRAME_START,
+    ORYX_RGB_FRAME_DATA,
+    ORYX_RGB_FRAME_COMMIT,
+    ORYX_KEY_EVENT_BATCHING,
     ORYX_GET_PROTOCOL_VERSION = 0xFE,
 };
 
@@ -55,6 +108,10 @@ enum Oryx_Event_Code {
     ORYX_EVT_TOGGLE_SMART_LAYER,
     ORYX_EVT_TRIGGER_SMART_LAYER,
     ORYX_EVT_STATUS_LED_CONTROL,
+    ORYX_EVT_CAPABILITIES = ORYX_VENDOR_COMMAND_BASE,
+    ORYX_EVT_RGB_FRAME_COMMITTED,
+    ORYX_EVT_KEY_EVENT_BATCHING,
+    ORYX_EVT_KEY_BATCH,
     ORYX_EVT_GET_PROTOCOL_VERSION = 0XFE,
     ORYX_EVT_ERROR                = 0xFF,
 };
@@ -66,15 +123,29 @@ enum Oryx_Error_Code {
     ORYX_ERR_PAIRING_FAILED,
     ORYX_ERR_RGB_MATRIX_NOT_ENABLED,
     ORYX_ERR_STATUS_LED_OUT_OF_RANGE,
+    ORYX_ERR_RGB_FRAME_INVALID = ORYX_VENDOR_COMMAND_BASE,
+    ORYX_ERR_RGB_FRAME_OUT_OF_SEQUENCE,
+    ORYX_ERR_RGB_FRAME_INCOMPLETE,
     ORYX_ERR_UNKNOWN_COMMAND = 0xFF,
 };
 
+enum Oryx_Capability {
+    ORYX_CAPABILITY_RGB_FRAME          = 1 << 0,
+    ORYX_CAPABILITY_KEY_EVENT_BATCHING = 1 << 1,
+};
+
+enum Oryx_Rgb_Frame_Format {
+    ORYX_RGB_FRAME_RGB565,
+    ORYX_RGB_FRAME_PALETTE,
+};
+
 extern bool oryx_state_live_training_enabled;
 
 typedef struct {
     bool paired;
     bool rgb_control;
     bool status_led_control;
+    bool key_event_batching;
 } rawhid_state_t;
 
 extern rawhid_state_t rawhid_state;
@@ -89,5 +160,7 @@ void set_webhid_effect(void);
 void oryx_layer_event(void);
 
 #if defined(RGB_MATRIX_ENABLE) && !defined(KEYBOARD_ergodox_ez_glow)
-extern RGB webhid_leds[RGB_MATRIX_LED_COUNT];
+extern RGB *webhid_leds;
+
+void oryx_rgb_frame_apply(void);
 #endif
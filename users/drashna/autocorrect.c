@@ -132,3 +132,103 @@ bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *co
 
     return true;
 }
+
+#ifdef AUTOCORRECT_DAWG_ENABLE
+#    include "autocorrect/autocorrect_dawg.h"
+
+/**
+ * @brief Stops the core engine from walking its own trie, as process_record_autocorrect_dawg() already handled
+ * the key. The core still handles the autocorrect keycodes and the enabled state.
+ */
+bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods) {
+    return false;
+}
+
+void keyboard_post_init_autocorrect_dawg(void) {
+    autocorrect_dawg_init();
+}
+
+/**
+ * @brief Autocorrect backend using the DAWG from autocorrect_dawg_data.h. Keys are filtered the same way the core
+ * filters them, so the same typos are corrected, but each key only advances the match in progress.
+ *
+ * @param keycode Keycode from matrix
+ * @param record keyrecord_t data structure
+ * @return true Continue processing keycode and send to host
+ * @return false Stop process keycode and do not send to host
+ */
+bool process_record_autocorrect_dawg(uint16_t keycode, keyrecord_t *record) {
+    uint8_t mods = get_mods();
+#    ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#    endif // NO_ACTION_ONESHOT
+
+    if (keycode >= QK_AUTOCORRECT_ON && keycode <= QK_AUTOCORRECT_TOGGLE) {
+        return true;
+    }
+    if (!autocorrect_is_enabled()) {
+        autocorrect_dawg_clear();
+        return true;
+    }
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    // the default handler only ever clears the buffer size, so a stand in is enough to see if it did
+    uint8_t buffer_size = 1;
+    if (!process_autocorrect_default_handler(&keycode, record, &buffer_size, &mods)) {
+        if (!buffer_size) {
+            autocorrect_dawg_clear();
+        }
+        return true;
+    }
+
+    uint8_t symbol;
+    if (keycode >= KC_A && keycode <= KC_Z) {
+        symbol = keycode - KC_A;
+    } else if (keycode == KC_QUOT && !(mods & MOD_MASK_SHIFT)) {
+        symbol = AUTOCORRECT_DAWG_SYMBOL_QUOTE;
+    } else if (keycode == KC_BSPC) {
+        autocorrect_dawg_backspace();
+        return true;
+    } else if (keycode >= KC_1 && keycode <= KC_SLSH && keycode != KC_ESC) {
+        // a word boundary, but enter (and underscore) can't end a typo, so start over
+        if (keycode == KC_ENT || (keycode == KC_MINUS && (mods & MOD_MASK_SHIFT))) {
+            autocorrect_dawg_clear();
+        }
+        keycode = KC_SPC;
+        symbol  = AUTOCORRECT_DAWG_SYMBOL_BOUNDARY;
+    } else {
+        autocorrect_dawg_clear();
+        return true;
+    }
+
+    if (!autocorrect_dawg_add(symbol)) {
+        return true;
+    }
+
+    char    changes[AUTOCORRECT_DAWG_CORRECTION_SIZE];
+    char    typo[AUTOCORRECT_DAWG_TYPO_SIZE];
+    char    correct[AUTOCORRECT_DAWG_TYPO_SIZE + AUTOCORRECT_DAWG_CORRECTION_SIZE];
+    uint8_t backspaces = autocorrect_dawg_get_correction(changes, sizeof(changes));
+    // the key that completed the typo hasn't been sent, unless it's the word boundary that ended it
+    uint8_t typed = autocorrect_dawg_get_typo(typo, sizeof(typo)) - (keycode != KC_SPC);
+    uint8_t kept  = typed > backspaces ? typed - backspaces : 0;
+
+    memcpy(correct, typo, kept);
+    strcpy(&correct[kept], changes);
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string(changes);
+    }
+
+    autocorrect_dawg_clear();
+    if (keycode == KC_SPC) {
+        autocorrect_dawg_add(AUTOCORRECT_DAWG_SYMBOL_BOUNDARY);
+        return true;
+    }
+    return false;
+}
+#endif // AUTOCORRECT_DAWG_ENABLE
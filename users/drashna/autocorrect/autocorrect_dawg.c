@@ -0,0 +1,241 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "autocorrect_dawg.h"
+#include "progmem.h"
+#include "autocorrect_dawg_data.h"
+#include <string.h>
+
+/**
+ * @brief Typo matching against the DAWG built by generate_autocorrect_dawg.py.
+ *
+ * The core engine walks its trie backwards over the whole typing buffer on every key. Here, the nodes reached by
+ * each suffix of the buffer that could still become a typo are kept instead, so every key just advances those by
+ * one edge, and starts a new match from the last two keys with a table lookup. Starting from the root instead
+ * would keep a match one key long active after every key, and those nodes have the most edges to search. The
+ * generator works out how many can be active at once.
+ *
+ * The typing buffer is still kept the same way the core keeps it, for backspace and to report the typo.
+ */
+
+#define AUTOCORRECT_DAWG_SYMBOL_BITS    5
+#define AUTOCORRECT_DAWG_BACKSPACE_BITS 6
+#define AUTOCORRECT_DAWG_CHAR_ESCAPE    31
+#define AUTOCORRECT_DAWG_KIND_LEAF      0x01
+#define AUTOCORRECT_DAWG_KIND_BRANCH    0x03
+#define AUTOCORRECT_DAWG_BRANCH_BITS    8
+#define AUTOCORRECT_DAWG_EDGE_BITS      (AUTOCORRECT_DAWG_SYMBOL_BITS + AUTOCORRECT_DAWG_TARGET_BITS)
+
+static uint8_t  typo_buffer[AUTOCORRECT_DAWG_MAX_LENGTH];
+static uint8_t  typo_buffer_size = 0;
+static uint32_t active_nodes[AUTOCORRECT_DAWG_MAX_ACTIVE];
+static uint8_t  active_count = 0;
+static uint32_t match_node   = AUTOCORRECT_DAWG_NO_NODE;
+static bool     active_stale = false;
+
+_Static_assert(AUTOCORRECT_DAWG_TARGET_BITS <= 24, "Autocorrect DAWG too large to address");
+_Static_assert(AUTOCORRECT_DAWG_MAX_LENGTH < AUTOCORRECT_DAWG_TYPO_SIZE, "AUTOCORRECT_DAWG_TYPO_SIZE too small");
+_Static_assert(AUTOCORRECT_DAWG_MAX_CORRECTION < AUTOCORRECT_DAWG_CORRECTION_SIZE,
+               "AUTOCORRECT_DAWG_CORRECTION_SIZE too small");
+
+/**
+ * @brief Reads bits from the packed DAWG, least significant bit first.
+ *
+ * The data is padded by the generator, so four bytes can always be read, which covers any offset into the first.
+ *
+ * @param position bit offset to read from
+ * @param count number of bits to read, up to 24
+ * @return uint32_t bits read
+ */
+static uint32_t autocorrect_dawg_read_bits(uint32_t position, uint8_t count) {
+    const uint8_t *data  = &autocorrect_dawg_data[position >> 3];
+    uint32_t       value = pgm_read_byte(data) | (uint16_t)pgm_read_byte(data + 1) << 8 |
+                     (uint32_t)pgm_read_byte(data + 2) << 16 | (uint32_t)pgm_read_byte(data + 3) << 24;
+
+    return (value >> (position & 7)) & (((uint32_t)1 << count) - 1);
+}
+
+/**
+ * @brief Follows the edge for a symbol out of a node.
+ *
+ * @param node node to follow the edge from
+ * @param symbol symbol to follow
+ * @return uint32_t child node, or AUTOCORRECT_DAWG_NO_NODE if there is no such edge
+ */
+static uint32_t autocorrect_dawg_step(uint32_t node, uint8_t symbol) {
+    uint8_t header = autocorrect_dawg_read_bits(node, AUTOCORRECT_DAWG_BRANCH_BITS);
+
+    if (!(header & 0x01)) {
+        // single edge, with the child directly after it
+        return ((header >> 1) & 0x1F) == symbol ? node + 1 + AUTOCORRECT_DAWG_SYMBOL_BITS : AUTOCORRECT_DAWG_NO_NODE;
+    }
+    if ((header & 0x03) != AUTOCORRECT_DAWG_KIND_BRANCH) {
+        return AUTOCORRECT_DAWG_NO_NODE;
+    }
+
+    uint8_t  edges    = (header >> 2) & 0x1F;
+    uint32_t position = node + AUTOCORRECT_DAWG_BRANCH_BITS;
+    for (; edges; --edges, position += AUTOCORRECT_DAWG_EDGE_BITS) {
+        uint8_t edge = autocorrect_dawg_read_bits(position, AUTOCORRECT_DAWG_SYMBOL_BITS);
+        if (edge == symbol) {
+            return autocorrect_dawg_read_bits(position + AUTOCORRECT_DAWG_SYMBOL_BITS, AUTOCORRECT_DAWG_TARGET_BITS);
+        }
+        if (edge > symbol) {
+            // edges are sorted, so skip straight to the one that follows them
+            position += (uint32_t)edges * AUTOCORRECT_DAWG_EDGE_BITS;
+            break;
+        }
+    }
+    if ((header & 0x80) && autocorrect_dawg_read_bits(position, AUTOCORRECT_DAWG_SYMBOL_BITS) == symbol) {
+        return position + AUTOCORRECT_DAWG_SYMBOL_BITS;
+    }
+    return AUTOCORRECT_DAWG_NO_NODE;
+}
+
+/**
+ * @brief Advances every active node by the symbol at a position in the buffer, and starts a new match from it and
+ * the symbol before it.
+ *
+ * @param index position of the symbol typed
+ * @return true if a typo was completed
+ */
+static bool autocorrect_dawg_advance(uint8_t index) {
+    uint8_t symbol = typo_buffer[index], count = 0;
+
+    match_node = AUTOCORRECT_DAWG_NO_NODE;
+    for (uint8_t i = 0; i <= active_count; ++i) {
+        uint32_t node;
+        if (i < active_count) {
+            node = autocorrect_dawg_step(active_nodes[i], symbol);
+        } else if (index) {
+            node = pgm_read_dword(&autocorrect_dawg_root[typo_buffer[index - 1]][symbol]);
+        } else {
+            break;
+        }
+        if (node == AUTOCORRECT_DAWG_NO_NODE) {
+            continue;
+        }
+        if (autocorrect_dawg_read_bits(node, 2) == AUTOCORRECT_DAWG_KIND_LEAF) {
+            match_node = node;
+        } else if (count < AUTOCORRECT_DAWG_MAX_ACTIVE) {
+            active_nodes[count++] = node;
+        }
+    }
+    active_count = count;
+    return match_node != AUTOCORRECT_DAWG_NO_NODE;
+}
+
+/**
+ * @brief Resets to the state the core starts in, at a word boundary.
+ */
+void autocorrect_dawg_init(void) {
+    autocorrect_dawg_clear();
+    autocorrect_dawg_add(AUTOCORRECT_DAWG_SYMBOL_BOUNDARY);
+}
+
+/**
+ * @brief Forgets everything typed so far.
+ */
+void autocorrect_dawg_clear(void) {
+    typo_buffer_size = 0;
+    active_count     = 0;
+    match_node       = AUTOCORRECT_DAWG_NO_NODE;
+    active_stale     = false;
+}
+
+/**
+ * @brief Removes the last symbol typed. The active nodes can't be stepped back, so they're rebuilt from what is
+ * left in the buffer, which is no longer than the longest typo. That waits for the next symbol, so a run of
+ * backspaces only rebuilds them once.
+ */
+void autocorrect_dawg_backspace(void) {
+    if (typo_buffer_size > 0) {
+        --typo_buffer_size;
+    }
+    active_stale = true;
+    match_node   = AUTOCORRECT_DAWG_NO_NODE;
+}
+
+/**
+ * @brief Adds a symbol to the buffer, and checks if it completes a typo.
+ *
+ * @param symbol a-z as 0-25, or one of the AUTOCORRECT_DAWG_SYMBOL_* values
+ * @return true if a typo was completed, and its correction can be read with autocorrect_dawg_get_correction()
+ */
+bool autocorrect_dawg_add(uint8_t symbol) {
+    if (typo_buffer_size >= AUTOCORRECT_DAWG_MAX_LENGTH) {
+        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_DAWG_MAX_LENGTH - 1);
+        typo_buffer_size = AUTOCORRECT_DAWG_MAX_LENGTH - 1;
+    }
+    if (active_stale) {
+        active_stale = false;
+        active_count = 0;
+        for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+            autocorrect_dawg_advance(i);
+        }
+    }
+    typo_buffer[typo_buffer_size++] = symbol;
+    return autocorrect_dawg_advance(typo_buffer_size - 1);
+}
+
+/**
+ * @brief Reads the correction for the typo that was just completed.
+ *
+ * @param changes set to the text to send, null terminated
+ * @param size size of the changes buffer, AUTOCORRECT_DAWG_CORRECTION_SIZE fits every correction
+ * @return uint8_t number of backspaces to send first
+ */
+uint8_t autocorrect_dawg_get_correction(char *changes, uint8_t size) {
+    uint8_t length = 0;
+
+    if (match_node == AUTOCORRECT_DAWG_NO_NODE) {
+        changes[0] = '\0';
+        return 0;
+    }
+
+    uint32_t position   = match_node + 2;
+    uint8_t  backspaces = autocorrect_dawg_read_bits(position, AUTOCORRECT_DAWG_BACKSPACE_BITS);
+    position += AUTOCORRECT_DAWG_BACKSPACE_BITS;
+    for (;;) {
+        uint8_t code = autocorrect_dawg_read_bits(position, AUTOCORRECT_DAWG_SYMBOL_BITS);
+        position += AUTOCORRECT_DAWG_SYMBOL_BITS;
+        if (!code) {
+            break;
+        }
+
+        char c;
+        if (code == AUTOCORRECT_DAWG_CHAR_ESCAPE) {
+            c = autocorrect_dawg_read_bits(position, 8);
+            position += 8;
+        } else {
+            c = pgm_read_byte(&autocorrect_dawg_charset[code - 1]);
+        }
+        if (length + 1 < size) {
+            changes[length++] = c;
+        }
+    }
+    changes[length] = '\0';
+    return backspaces;
+}
+
+/**
+ * @brief Gets the word being typed, from the last word boundary in the buffer, as the core reports it.
+ *
+ * @param typo set to the word, null terminated
+ * @param size size of the typo buffer, AUTOCORRECT_DAWG_TYPO_SIZE fits every typo
+ * @return uint8_t length of the word
+ */
+uint8_t autocorrect_dawg_get_typo(char *typo, uint8_t size) {
+    uint8_t end = typo_buffer_size, start, length = 0;
+
+    if (end && typo_buffer[end - 1] == AUTOCORRECT_DAWG_SYMBOL_BOUNDARY) {
+        --end;
+    }
+    for (start = end; start && typo_buffer[start - 1] != AUTOCORRECT_DAWG_SYMBOL_BOUNDARY; --start) {
+    }
+    for (uint8_t i = start; i < end && length + 1 < size; ++i) {
+        typo[length++] = typo_buffer[i] == AUTOCORRECT_DAWG_SYMBOL_QUOTE ? '\'' : 'a' + typo_buffer[i];
+    }
+    typo[length] = '\0';
+    return length;
+}
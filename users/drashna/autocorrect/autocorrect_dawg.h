@@ -0,0 +1,27 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AUTOCORRECT_DAWG_SYMBOL_BOUNDARY 26
+#define AUTOCORRECT_DAWG_SYMBOL_QUOTE    27
+#define AUTOCORRECT_DAWG_SYMBOL_COUNT    28
+#define AUTOCORRECT_DAWG_NO_NODE         UINT32_MAX
+
+// buffer sizes for autocorrect_dawg_get_typo() and autocorrect_dawg_get_correction(), checked against the dictionary
+#ifndef AUTOCORRECT_DAWG_TYPO_SIZE
+#    define AUTOCORRECT_DAWG_TYPO_SIZE 24
+#endif // AUTOCORRECT_DAWG_TYPO_SIZE
+#ifndef AUTOCORRECT_DAWG_CORRECTION_SIZE
+#    define AUTOCORRECT_DAWG_CORRECTION_SIZE 32
+#endif // AUTOCORRECT_DAWG_CORRECTION_SIZE
+
+void    autocorrect_dawg_init(void);
+void    autocorrect_dawg_clear(void);
+void    autocorrect_dawg_backspace(void);
+bool    autocorrect_dawg_add(uint8_t symbol);
+uint8_t autocorrect_dawg_get_correction(char *changes, uint8_t size);
+uint8_t autocorrect_dawg_get_typo(char *typo, uint8_t size);
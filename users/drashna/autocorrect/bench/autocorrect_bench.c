@@ -0,0 +1,415 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host benchmark for the autocorrect backends.
+ *
+ * Replays text through the core trie walk (from autocorrect_data.h) and through autocorrect_dawg.c (from
+ * autocorrect_dawg_data.h), reports the time each takes per key, and diffs the corrections they make. Both should
+ * be generated from the same dictionary. Text is turned into keys the way the keyboard would send it: letters,
+ * word boundaries for space, digits and punctuation, a reset for enter, and backspaces only in the random mode.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o autocorrect_bench -Iusers/drashna/bench/qmk -Iusers/drashna/autocorrect -Iusers/drashna \
+ *         users/drashna/autocorrect/bench/autocorrect_bench.c users/drashna/autocorrect/autocorrect_dawg.c
+ *     ./autocorrect_bench [-r random_keys] corpus.txt...
+ *
+ * Put a directory holding another pair of headers first on the include path to benchmark another dictionary.
+ *
+ * On typed text the two take about the same time per key. The random mode is slower for the DAWG (about 1.3x the
+ * core), as 6% of its keys are backspaces and each run of them means rebuilding the active nodes from the buffer
+ * on the next key, where the core just drops the last key from its buffer.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "progmem.h"
+#include "autocorrect_data.h"
+#include "autocorrect_dawg.h"
+
+#define KC_A    0x04
+#define KC_SPC  0x2C
+#define KC_QUOT 0x34
+
+#define MIN_BENCH_SECONDS 0.25
+
+typedef enum bench_key_type_t {
+    BENCH_KEY_LETTER = 0,
+    BENCH_KEY_BOUNDARY,
+    BENCH_KEY_ENTER,
+    BENCH_KEY_BACKSPACE,
+    BENCH_KEY_CLEAR,
+} bench_key_type_t;
+
+typedef struct bench_key_t {
+    uint8_t type;
+    uint8_t symbol; // a-z as 0-25, or AUTOCORRECT_DAWG_SYMBOL_QUOTE
+} bench_key_t;
+
+typedef struct bench_correction_t {
+    size_t  index;
+    uint8_t backspaces;
+    char    typo[AUTOCORRECT_DAWG_TYPO_SIZE];
+    char    changes[AUTOCORRECT_DAWG_CORRECTION_SIZE];
+} bench_correction_t;
+
+typedef struct bench_result_t {
+    bench_correction_t *corrections;
+    size_t              count;
+    size_t              capacity;
+    double              ns_per_key;
+} bench_result_t;
+
+typedef bool (*bench_engine_t)(const bench_key_t *key, bench_correction_t *correction);
+
+/*
+ * Core engine, following process_autocorrect() in quantum/process_keycode/process_autocorrect.c: the buffer is
+ * walked backwards from the newest key through the trie on every key.
+ */
+
+static uint8_t core_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+static uint8_t core_buffer_size                   = 1;
+
+static void core_reset(void) {
+    core_buffer[0]   = KC_SPC;
+    core_buffer_size = 1;
+}
+
+static bool core_find_typo(uint8_t *backspaces, const char **changes) {
+    if (core_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+        return false;
+    }
+
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = core_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = core_buffer[i];
+
+        if (code & 64) {
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) {
+                    return false;
+                }
+            }
+            state = pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8;
+        } else if (code != key_i) {
+            return false;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+        if (state >= DICTIONARY_SIZE) {
+            return false;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+        if (code & 128) {
+            *backspaces = code & 63;
+            *changes    = (const char *)(autocorrect_data + state + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool core_process(const bench_key_t *key, bench_correction_t *correction) {
+    uint8_t keycode = KC_SPC;
+
+    switch (key->type) {
+        case BENCH_KEY_BACKSPACE:
+            if (core_buffer_size > 0) {
+                --core_buffer_size;
+            }
+            return false;
+        case BENCH_KEY_CLEAR:
+            core_buffer_size = 0;
+            return false;
+        case BENCH_KEY_ENTER:
+            core_buffer_size = 0;
+            break;
+        case BENCH_KEY_LETTER:
+            keycode = key->symbol == AUTOCORRECT_DAWG_SYMBOL_QUOTE ? KC_QUOT : KC_A + key->symbol;
+            break;
+    }
+
+    if (core_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(core_buffer, core_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        core_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    core_buffer[core_buffer_size++] = keycode;
+
+    const char *changes;
+    if (!core_find_typo(&correction->backspaces, &changes)) {
+        return false;
+    }
+    snprintf(correction->changes, sizeof(correction->changes), "%s", changes);
+
+    uint8_t end = core_buffer_size - (keycode == KC_SPC), start = end, length = 0;
+    while (start && core_buffer[start - 1] != KC_SPC) {
+        --start;
+    }
+    for (uint8_t i = start; i < end && (size_t)length + 1 < sizeof(correction->typo); ++i) {
+        correction->typo[length++] = core_buffer[i] == KC_QUOT ? '\'' : 'a' + core_buffer[i] - KC_A;
+    }
+    correction->typo[length] = '\0';
+
+    if (keycode == KC_SPC) {
+        core_reset();
+    } else {
+        core_buffer_size = 0;
+    }
+    return true;
+}
+
+/*
+ * DAWG engine, with the key handling from process_record_autocorrect_dawg() in autocorrect.c.
+ */
+
+static void dawg_reset(void) {
+    autocorrect_dawg_init();
+}
+
+static bool dawg_process(const bench_key_t *key, bench_correction_t *correction) {
+    uint8_t symbol = AUTOCORRECT_DAWG_SYMBOL_BOUNDARY;
+
+    switch (key->type) {
+        case BENCH_KEY_BACKSPACE:
+            autocorrect_dawg_backspace();
+            return false;
+        case BENCH_KEY_CLEAR:
+            autocorrect_dawg_clear();
+            return false;
+        case BENCH_KEY_ENTER:
+            autocorrect_dawg_clear();
+            break;
+        case BENCH_KEY_LETTER:
+            symbol = key->symbol;
+            break;
+    }
+
+    if (!autocorrect_dawg_add(symbol)) {
+        return false;
+    }
+    correction->backspaces = autocorrect_dawg_get_correction(correction->changes, sizeof(correction->changes));
+    autocorrect_dawg_get_typo(correction->typo, sizeof(correction->typo));
+
+    autocorrect_dawg_clear();
+    if (symbol == AUTOCORRECT_DAWG_SYMBOL_BOUNDARY) {
+        autocorrect_dawg_add(AUTOCORRECT_DAWG_SYMBOL_BOUNDARY);
+    }
+    return true;
+}
+
+/*
+ * Benchmark
+ */
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static bench_key_t to_key(char c) {
+    if (isalpha((unsigned char)c)) {
+        return (bench_key_t){BENCH_KEY_LETTER, tolower((unsigned char)c) - 'a'};
+    }
+    if (c == '\'') {
+        return (bench_key_t){BENCH_KEY_LETTER, AUTOCORRECT_DAWG_SYMBOL_QUOTE};
+    }
+    if (c == '\n' || c == '_') {
+        return (bench_key_t){BENCH_KEY_ENTER, 0};
+    }
+    if (c == '\t' || (c >= ' ' && c <= '~')) {
+        return (bench_key_t){BENCH_KEY_BOUNDARY, 0};
+    }
+    return (bench_key_t){BENCH_KEY_CLEAR, 0};
+}
+
+static void add_correction(bench_result_t *result, const bench_correction_t *correction) {
+    if (result->count == result->capacity) {
+        result->capacity    = result->capacity ? result->capacity * 2 : 64;
+        result->corrections = realloc(result->corrections, result->capacity * sizeof(bench_correction_t));
+    }
+    result->corrections[result->count++] = *correction;
+}
+
+static bench_result_t run(bench_engine_t process, void (*reset)(void), const bench_key_t *keys, size_t count) {
+    bench_result_t     result = {0};
+    bench_correction_t correction;
+
+    reset();
+    for (size_t i = 0; i < count; ++i) {
+        if (process(&keys[i], &correction)) {
+            correction.index = i;
+            add_correction(&result, &correction);
+        }
+    }
+
+    // timed separately, so collecting the corrections isn't part of it
+    size_t passes = 0;
+    double start = now(), elapsed;
+    do {
+        reset();
+        for (size_t i = 0; i < count; ++i) {
+            process(&keys[i], &correction);
+        }
+        passes++;
+    } while ((elapsed = now() - start) < MIN_BENCH_SECONDS);
+    result.ns_per_key = elapsed * 1e9 / ((double)passes * count);
+    return result;
+}
+
+static int compare_corrections(const void *a, const void *b) {
+    const bench_correction_t *x = a, *y = b;
+    int                       diff = strcmp(x->typo, y->typo);
+    if (!diff) {
+        diff = strcmp(x->changes, y->changes);
+    }
+    return diff ? diff : x->backspaces - y->backspaces;
+}
+
+static bool same_correction(const bench_correction_t *x, const bench_correction_t *y) {
+    return x->index == y->index && !compare_corrections(x, y);
+}
+
+/**
+ * @brief Prints every distinct correction with how often each engine made it, marking the ones they disagree on.
+ *
+ * @return number of corrections that differ
+ */
+static size_t report(const bench_result_t *core, const bench_result_t *dawg) {
+    size_t mismatches = 0, i = 0, j = 0;
+
+    for (; i < core->count && j < dawg->count; ++i, ++j) {
+        if (!same_correction(&core->corrections[i], &dawg->corrections[j])) {
+            printf("  first difference at key %zu (core) / %zu (dawg)\n", core->corrections[i].index,
+                   dawg->corrections[j].index);
+            mismatches++;
+            break;
+        }
+    }
+    if (!mismatches && core->count != dawg->count) {
+        mismatches++;
+    }
+
+    bench_correction_t *sorted[2] = {malloc((core->count + 1) * sizeof(bench_correction_t)),
+                                     malloc((dawg->count + 1) * sizeof(bench_correction_t))};
+    memcpy(sorted[0], core->corrections, core->count * sizeof(bench_correction_t));
+    memcpy(sorted[1], dawg->corrections, dawg->count * sizeof(bench_correction_t));
+    qsort(sorted[0], core->count, sizeof(bench_correction_t), compare_corrections);
+    qsort(sorted[1], dawg->count, sizeof(bench_correction_t), compare_corrections);
+
+    printf("  correction set (core count, dawg count):\n");
+    for (i = 0, j = 0; i < core->count || j < dawg->count;) {
+        const bench_correction_t *entry;
+        int                       order = i == core->count ? 1 : j == dawg->count ? -1 : 0;
+        if (!order) {
+            order = compare_corrections(&sorted[0][i], &sorted[1][j]);
+        }
+        entry = order <= 0 ? &sorted[0][i] : &sorted[1][j];
+
+        size_t core_count = 0, dawg_count = 0;
+        while (i < core->count && !compare_corrections(&sorted[0][i], entry)) {
+            core_count++, i++;
+        }
+        while (j < dawg->count && !compare_corrections(&sorted[1][j], entry)) {
+            dawg_count++, j++;
+        }
+        printf("  %c %-20s -> %d x BSPC, \"%s\" (%zu, %zu)\n", core_count == dawg_count ? ' ' : '!', entry->typo,
+               entry->backspaces, entry->changes, core_count, dawg_count);
+    }
+    free(sorted[0]);
+    free(sorted[1]);
+    return mismatches;
+}
+
+static size_t bench(const char *name, const bench_key_t *keys, size_t count) {
+    bench_result_t core = run(core_process, core_reset, keys, count);
+    bench_result_t dawg = run(dawg_process, dawg_reset, keys, count);
+
+    printf("%s: %zu keys\n", name, count);
+    printf("  core: %7.1f ns/key, %zu corrections\n", core.ns_per_key, core.count);
+    printf("  dawg: %7.1f ns/key, %zu corrections\n", dawg.ns_per_key, dawg.count);
+    size_t mismatches = report(&core, &dawg);
+    printf("  %s\n", mismatches ? "MISMATCH" : "identical corrections");
+
+    free(core.corrections);
+    free(dawg.corrections);
+    return mismatches;
+}
+
+static bench_key_t *read_corpus(const char *path, size_t *count) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+
+    size_t       capacity = 1 << 16;
+    bench_key_t *keys     = malloc(capacity * sizeof(bench_key_t));
+    int          c;
+    *count = 0;
+    while ((c = fgetc(file)) != EOF) {
+        if (*count == capacity) {
+            capacity *= 2;
+            keys = realloc(keys, capacity * sizeof(bench_key_t));
+        }
+        keys[(*count)++] = to_key(c);
+    }
+    fclose(file);
+    return keys;
+}
+
+/**
+ * @brief Makes a stream of random keys, weighted towards letters, with backspaces mixed in so that rebuilding the
+ * match after a backspace is compared too.
+ */
+static bench_key_t *random_keys(size_t count) {
+    bench_key_t *keys = malloc(count * sizeof(bench_key_t));
+
+    srand(1);
+    for (size_t i = 0; i < count; ++i) {
+        int roll = rand() % 100;
+        if (roll < 80) {
+            keys[i] = (bench_key_t){BENCH_KEY_LETTER, "etaoinshrdlucmfwypvbgkjqxz"[rand() % (1 + rand() % 26)] - 'a'};
+        } else if (roll < 92) {
+            keys[i] = (bench_key_t){BENCH_KEY_BOUNDARY, 0};
+        } else if (roll < 98) {
+            keys[i] = (bench_key_t){BENCH_KEY_BACKSPACE, 0};
+        } else if (roll < 99) {
+            keys[i] = (bench_key_t){BENCH_KEY_ENTER, 0};
+        } else {
+            keys[i] = (bench_key_t){BENCH_KEY_CLEAR, 0};
+        }
+    }
+    return keys;
+}
+
+int main(int argc, char **argv) {
+    size_t mismatches = 0, count;
+
+    for (int i = 1; i < argc; ++i) {
+        bench_key_t *keys;
+        if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+            count = strtoul(argv[++i], NULL, 0);
+            keys  = random_keys(count);
+            mismatches += bench("random", keys, count);
+        } else {
+            keys = read_corpus(argv[i], &count);
+            mismatches += bench(argv[i], keys, count);
+        }
+        free(keys);
+    }
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s [-r random_keys] corpus.txt...\n", argv[0]);
+        return 2;
+    }
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+# Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Generates autocorrect_dawg_data.h, the dictionary used by autocorrect_dawg.c.
+
+The input is an autocorrect dictionary in the same format as `qmk generate-autocorrect-data` takes, one
+`typo -> correction` entry per line, with `:` marking a word boundary. A generated autocorrect_data.h works too,
+as the entries are read back from the listing in its header comment.
+
+The typos are stored as a forward trie, minimized into a DAWG by merging every node that has the same edges and
+correction as another, so the shared tails of the typos are only stored once. Nodes are bit packed:
+
+    0 sym:5                                   single edge, the child follows directly
+    1 0 backspaces:6 char:5... 0:5            leaf, holding the correction
+    1 1 edges:5 inline:1 (sym:5 target:N)...  edges to children placed elsewhere, sorted by symbol,
+        [sym:5]                               followed by the edge to the child that follows directly
+
+Symbols are a-z as 0-25, the word boundary as 26 and ' as 27. Correction characters are indices into a charset
+table, with 0 ending the correction and 31 escaping a raw 8 bit character. The nodes two edges from the root are a
+table indexed by both symbols instead, as every key has to look one up, so the root and its children are never
+walked (and typos have to be at least two symbols long).
+
+Like autocorrect_data.h, the header is looked up on the include path, so a keymap can carry its own dictionary.
+
+Usage: generate_autocorrect_dawg.py dictionary.txt [-o autocorrect_dawg_data.h]
+"""
+
+import argparse
+import re
+import sys
+from collections import Counter
+from pathlib import Path
+
+BOUNDARY = ':'
+SYMBOLS = 'abcdefghijklmnopqrstuvwxyz' + BOUNDARY + "'"
+CHARSET_ESCAPE = 31
+ENTRY_RE = re.compile(r"^(?://)?\s*(\S+)\s+->\s+(.+?)\s*$")
+CORE_SIZE_RE = re.compile(r"^#define DICTIONARY_SIZE\s+(\d+)")
+
+
+def parse_dictionary(path):
+    """Reads the typo -> correction entries, and the core trie size if the file is a generated header."""
+    entries, seen, core_size = [], set(), None
+    for line_number, line in enumerate(Path(path).read_text(encoding='utf-8').splitlines(), 1):
+        match = CORE_SIZE_RE.match(line)
+        if match:
+            core_size = int(match.group(1))
+            continue
+        if line.lstrip().startswith('#'):
+            continue
+        match = ENTRY_RE.match(line)
+        if not match:
+            continue
+        typo, correction = match.group(1).lower(), match.group(2)
+        if len(typo) < 2 or any(c not in SYMBOLS for c in typo):
+            sys.exit(f'{path}:{line_number}: invalid typo "{typo}"')
+        if typo in seen:
+            sys.exit(f'{path}:{line_number}: duplicate typo "{typo}"')
+        seen.add(typo)
+        entries.append((typo, correction))
+    if not entries:
+        sys.exit(f'{path}: no autocorrect entries found')
+    return entries, core_size
+
+
+def make_correction(typo, correction):
+    """Works out the backspaces and text to send, the same way the core generator does."""
+    boundary_ending = typo.endswith(BOUNDARY)
+    typo = typo.strip(BOUNDARY)
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + boundary_ending
+    if not 0 <= backspaces <= 63:
+        sys.exit(f'too many backspaces for "{typo}"')
+    return backspaces, correction[i:]
+
+
+def build_trie(entries):
+    """Builds the forward trie, and checks that no typo is a substring of another, as it could never trigger."""
+    children, leaf = [{}], [None]
+    for typo, correction in entries:
+        node = 0
+        for c in typo:
+            if c not in children[node]:
+                children.append({})
+                leaf.append(None)
+                children[node][c] = len(children) - 1
+            node = children[node][c]
+        leaf[node] = (typo, make_correction(typo, correction))
+
+    # Aho-Corasick failure links: the longest proper suffix of each node that is also a node
+    fail, depth, order = [0] * len(children), [0] * len(children), [0]
+    for node in order:
+        for c, child in children[node].items():
+            depth[child] = depth[node] + 1
+            if node:
+                link = fail[node]
+                while link and c not in children[link]:
+                    link = fail[link]
+                fail[child] = children[link].get(c, 0)
+            order.append(child)
+
+    # nodes that are suffixes of the current input are tracked at the same time, so the longest failure chain is
+    # how many can be live at once, not counting the root's children, as they're only ever reached through the table
+    chain = [0] * len(children)
+    for node in order[1:]:
+        if leaf[node] and children[node]:
+            sys.exit(f'typo "{leaf[node][0]}" is the start of another typo')
+        link = fail[node]
+        while link:
+            if leaf[link]:
+                sys.exit(f'typo "{leaf[link][0]}" is part of another typo')
+            link = fail[link]
+        chain[node] = chain[fail[node]] + (depth[node] > 1)
+    max_active = max((chain[node] for node in order[1:] if not leaf[node]), default=0)
+    return children, leaf, max_active
+
+
+def minimize(children, leaf):
+    """Merges every trie node with the same correction and edges as another, giving the DAWG."""
+    registry, nodes, canonical = {}, [], [None] * len(children)
+    stack = [(0, False)]
+    while stack:
+        node, expanded = stack.pop()
+        if not expanded:
+            stack.append((node, True))
+            stack.extend((child, False) for child in children[node].values())
+            continue
+        edges = tuple(sorted((SYMBOLS.index(c), canonical[child]) for c, child in children[node].items()))
+        key = (leaf[node][1] if leaf[node] else None, edges)
+        if key not in registry:
+            registry[key] = len(nodes)
+            nodes.append(key)
+        canonical[node] = registry[key]
+    return nodes, canonical[0]
+
+
+def make_charset(nodes):
+    counts = Counter(c for correction, _ in nodes if correction for c in correction[1])
+    return [c for c, _ in counts.most_common(CHARSET_ESCAPE - 1)]
+
+
+def layout(nodes, root):
+    """Orders the nodes depth first, so that most nodes directly follow their parent and need no target."""
+    inline, order, placed = {}, [], set()
+    # the root's children are looked up through a table instead, as every key starts a match from them, so they're
+    # only placed if another node leads to them
+    stack = [grandchild for _, child in nodes[root][1] for _, grandchild in nodes[child][1]][::-1]
+    while stack:
+        node = stack.pop()
+        if node in placed:
+            continue
+        # follow the chain of first unplaced children, which all end up directly after each other
+        while node is not None:
+            placed.add(node)
+            order.append(node)
+            pending = [(sym, child) for sym, child in nodes[node][1] if child not in placed]
+            if not pending:
+                break
+            inline[node] = pending[0]
+            stack.extend(child for _, child in reversed(pending[1:]))
+            node = pending[0][1]
+    return order, inline
+
+
+def node_bits(node, nodes, inline, charset, target_bits):
+    correction, edges = nodes[node]
+    if correction:
+        chars = sum(5 if c in charset else 13 for c in correction[1])
+        return 2 + 6 + chars + 5
+    if len(edges) == 1 and node in inline:
+        return 6
+    explicit = len(edges) - (node in inline)
+    return 2 + 5 + 1 + explicit * (5 + target_bits) + (5 if node in inline else 0)
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def write(self, value, count):
+        self.bits.extend((value >> i) & 1 for i in range(count))
+
+    def to_bytes(self):
+        data = bytearray((len(self.bits) + 7) // 8)
+        for i, bit in enumerate(self.bits):
+            data[i >> 3] |= bit << (i & 7)
+        return bytes(data)
+
+
+def encode(nodes, root):
+    order, inline = layout(nodes, root)
+    charset = make_charset(nodes)
+
+    # targets are a fixed width, so size the stream until the width fits it
+    target_bits = 1
+    while True:
+        positions, position = {}, 0
+        for node in order:
+            positions[node] = position
+            position += node_bits(node, nodes, inline, charset, target_bits)
+        if position < (1 << target_bits):
+            break
+        target_bits = position.bit_length()
+
+    root_table = [None] * len(SYMBOLS) ** 2
+    for first, child in nodes[root][1]:
+        for second, grandchild in nodes[child][1]:
+            root_table[first * len(SYMBOLS) + second] = positions[grandchild]
+
+    writer = BitWriter()
+    for node in order:
+        assert len(writer.bits) == positions[node]
+        correction, edges = nodes[node]
+        if correction:
+            backspaces, text = correction
+            writer.write(0b01, 2)
+            writer.write(backspaces, 6)
+            for c in text:
+                if c in charset:
+                    writer.write(charset.index(c) + 1, 5)
+                else:
+                    writer.write(CHARSET_ESCAPE, 5)
+                    writer.write(ord(c), 8)
+            writer.write(0, 5)
+            continue
+        next_edge = inline.get(node)
+        if len(edges) == 1 and next_edge is not None:
+            writer.write(0, 1)
+            writer.write(next_edge[0], 5)
+            continue
+        explicit = [edge for edge in edges if edge != next_edge]
+        writer.write(0b11, 2)
+        writer.write(len(explicit), 5)
+        writer.write(next_edge is not None, 1)
+        for sym, child in explicit:
+            writer.write(sym, 5)
+            writer.write(positions[child], target_bits)
+        if next_edge is not None:
+            writer.write(next_edge[0], 5)
+    # padded, so that up to four bytes can always be read at once
+    return writer.to_bytes() + bytes(3), root_table, charset, target_bits
+
+
+def c_char(c):
+    return f"'\\''" if c == "'" else f"'{c}'"
+
+
+def generate(entries, output, core_size):
+    children, leaf, max_active = build_trie(entries)
+    nodes, root = minimize(children, leaf)
+    data, root_table, charset, target_bits = encode(nodes, root)
+
+    max_length = max(len(typo) for typo, _ in entries)
+    max_correction = max(len(correction[1]) for correction, _ in nodes if correction)
+    edges = sum(len(node_edges) for _, node_edges in nodes)
+    flash = len(data) + len(root_table) * 4 + len(charset)
+    width = max(len(typo) for typo, _ in entries) + 1
+
+    lines = [
+        "// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>",
+        '// SPDX-License-Identifier: GPL-3.0-or-later',
+        '',
+        '// Generated by generate_autocorrect_dawg.py, do not edit by hand.',
+        '',
+        '#pragma once',
+        '',
+        f'// Autocorrection dictionary ({len(entries)} entries):',
+    ]
+    lines += [f'//   {typo:<{width}} -> {correction}' for typo, correction in entries]
+    lines += [
+        '//',
+        f'// {len(children)} trie nodes, {len(nodes)} DAWG nodes, {edges} edges, {flash} bytes of flash.',
+        f'// At most {max_active + 1} nodes are visited per key.',
+        '',
+        f'#define AUTOCORRECT_DAWG_MAX_LENGTH     {max_length}',
+        f'#define AUTOCORRECT_DAWG_MAX_CORRECTION {max_correction}',
+        f'#define AUTOCORRECT_DAWG_MAX_ACTIVE     {max(max_active, 1)}',
+        f'#define AUTOCORRECT_DAWG_TARGET_BITS    {target_bits}',
+        f'#define AUTOCORRECT_DAWG_CHARSET_SIZE   {len(charset)}',
+        f'#define AUTOCORRECT_DAWG_DATA_SIZE      {len(data)}',
+        '',
+        '// indexed by the first two symbols of a match',
+        'static const uint32_t autocorrect_dawg_root[AUTOCORRECT_DAWG_SYMBOL_COUNT][AUTOCORRECT_DAWG_SYMBOL_COUNT] '
+        'PROGMEM = {',
+    ]
+    root_entries = [
+        f'0x{position:08X}' if position is not None else 'AUTOCORRECT_DAWG_NO_NODE' for position in root_table
+    ]
+    for row in range(0, len(root_entries), len(SYMBOLS)):
+        lines += ['    {']
+        lines += ['        ' + ', '.join(root_entries[i:i + 4]) + ',' for i in range(row, row + len(SYMBOLS), 4)]
+        lines += ['    },']
+    lines += ['};', '', 'static const char autocorrect_dawg_charset[AUTOCORRECT_DAWG_CHARSET_SIZE] PROGMEM = {']
+    lines += ['    ' + ', '.join(c_char(c) for c in charset[i:i + 16]) + ',' for i in range(0, len(charset), 16)]
+    lines += ['};', '', 'static const uint8_t autocorrect_dawg_data[AUTOCORRECT_DAWG_DATA_SIZE] PROGMEM = {']
+    lines += ['    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',' for i in range(0, len(data), 16)]
+    lines += ['};', '']
+    Path(output).write_text('\n'.join(lines), encoding='utf-8')
+
+    print(f'{len(entries)} entries, {len(children)} trie nodes, {len(nodes)} DAWG nodes, {edges} edges')
+    print(f'flash: {flash} bytes ({len(data)} data, {len(root_table) * 4} root, {len(charset)} charset)', end='')
+    print(f', core trie: {core_size} bytes' if core_size else '')
+    print(f'worst case: {max_active + 1} nodes visited per key, {max_active} active nodes '
+          f'({max(max_active, 1) * 4} bytes of RAM)')
+    print(f'wrote {output}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('dictionary', help='autocorrect dictionary, or a generated autocorrect_data.h')
+    parser.add_argument('-o', '--output', default='autocorrect_dawg_data.h')
+    args = parser.parse_args()
+
+    entries, core_size = parse_dictionary(args.dictionary)
+    generate(entries, args.output, core_size)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,6861 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated by generate_autocorrect_dawg.py, do not edit by hand.
+
+#pragma once
+
+// Autocorrection dictionary (4117 entries):
+//   :abe:                -> able
+//   :acheiv              -> achiev
+//   :acn:                -> can
+//   :addin:              -> adding
+//   :adn:                -> and
+//   :aganist             -> against
+//   :agian               -> again
+//   :agin:               -> again
+//   :agre:               -> agree
+//   :ajust               -> adjust
+//   :albe:               -> able
+//   :alege               -> allege
+//   :alot:               -> a lot
+//   :alse                -> else
+//   :andone:             -> and one
+//   :andteh              -> and the
+//   :andthe              -> and the
+//   :anual               -> annual
+//   :apon                -> apron
+//   :arent:              -> aren't
+//   :arnt:               -> aren't
+//   :asign               -> assign
+//   :aslo:               -> also
+//   :asthe               -> as the
+//   :atp:                -> tap
+//   :atthe               -> at the
+//   :avation             -> aviation
+//   :awya:               -> away
+//   :aywa:               -> away
+//   :boyant              -> buoyant
+//   :bve:                -> be
+//   :casion              -> caisson
+//   :choses              -> chooses
+//   :clera               -> clear
+//   :cna:                -> can
+//   :comptete            -> complete
+//   :dont                -> don't
+//   :doub:               -> doubt
+//   :dum:                -> dumb
+//   :earnt               -> earned
+//   :eather              -> either
+//   :eb:                 -> be
+//   :ect:                -> etc
+//   :efel                -> feel
+//   :ehr                 -> her
+//   :eigth               -> eighth, eight
+//   :eiter               -> either
+//   :eles                -> else
+//   :eminate             -> emanate
+//   :emnity              -> enmity
+//   :ened                -> need
+//   :erally              -> orally, really
+//   :eratic              -> erratic
+//   :ergard              -> Regard
+//   :errupted            -> erupted
+//   :esle                -> else
+//   :eyar                -> year
+//   :eyt:                -> yet
+//   :fir:                -> for
+//   :florescent          -> fluorescent
+//   :flourescent         -> fluorescent
+//   :ganes               -> games
+//   :geting              -> getting
+//   :grammer             -> grammar
+//   :grat                -> great
+//   :gt:                 -> git
+//   :guage               -> gauge
+//   :haer                -> hear
+//   :haev                -> have
+//   :halp                -> help
+//   :hapen               -> happen
+//   :hier:               -> heir
+//   :hsi                 -> his
+//   :hte:                -> the
+//   :hten:               -> then
+//   :htere               -> there
+//   :htign               -> thing
+//   :hting               -> thing
+//   :idae                -> idea
+//   :ihs                 -> his
+//   :illess              -> illness
+//   :ilogical            -> illogical
+//   :inot:               -> into
+//   :ioin                -> ion
+//   :isnt                -> isn't
+//   :itis                -> it is
+//   :iwll                -> will
+//   :iwth                -> with
+//   :knwo                -> know
+//   :konw                -> know
+//   :kwno                -> know
+//   :lastr:              -> last
+//   :layed               -> laid
+//   :leage               -> league
+//   :lefted              -> left
+//   :leran               -> learn
+//   :liad                -> laid
+//   :lieved              -> lived
+//   :lisense             -> license
+//   :loev                -> love
+//   :lsat                -> last
+//   :lveo                -> love
+//   :lvoe                -> love
+//   :manouver            -> maneuver
+//   :menally             -> mentally
+//   :milion              -> million
+//   :nad:                -> and
+//   :nid:                -> ID
+//   :nto:                -> not
+//   :obediance           -> obedience
+//   :obediant            -> obedient
+//   :ocuntry             -> country
+//   :ocur                -> occur
+//   :olther              -> other
+//   :ommision            -> omission
+//   :ommited             -> omitted
+//   :ommiting            -> omitting
+//   :ommitted            -> omitted
+//   :ommitting           -> omitting
+//   :omst                -> most
+//   :onot                -> note, not
+//   :onyl:               -> only
+//   :oponent             -> opponent
+//   :opose               -> oppose
+//   :oposition           -> opposition
+//   :orded               -> order
+//   :oru:                -> our
+//   :ot:                 -> to
+//   :otehr               -> other
+//   :ous:                -> our
+//   :owrk                -> work
+//   :pased               -> passed
+//   :peice               -> piece
+//   :peom:               -> poem
+//   :persan:             -> person
+//   :pich:               -> pitch
+//   :poulation           -> population
+//   :puting              -> putting
+//   :quitted             -> quit
+//   :reards              -> Regards
+//   :recide              -> reside
+//   :repid               -> rapid
+//   :republis:           -> republics
+//   :resistable          -> resistible
+//   :retun               -> return
+//   :rference            -> reference
+//   :rised               -> raised, rose
+//   :runing              -> running
+//   :scoll:              -> scroll
+//   :seing               -> seeing
+//   :sence               -> sense, since
+//   :shaddow             -> shadow
+//   :sheat:              -> sheath, sheet, cheat
+//   :shiped              -> shipped
+//   :shiping             -> shipping
+//   :si:                 -> so
+//   :sieze               -> seize
+//   :smae:               -> same
+//   :smoe:               -> some
+//   :socre               -> score
+//   :soem:               -> some
+//   :sohw:               -> show
+//   :somene              -> someone
+//   :sourth:             -> south
+//   :soverign:           -> sovereign
+//   :stpo:               -> stop
+//   :strat:              -> start
+//   :stroy:              -> story
+//   :sttaus:             -> status
+//   :suop:               -> soup
+//   :syas:               -> says
+//   :symetric            -> symmetric
+//   :szie                -> size
+//   :tast:               -> taste
+//   :tath:               -> that
+//   :teh:                -> the
+//   :tehy:               -> they
+//   :tghe:               -> the
+//   :the:the:            -> the
+//   :ther:               -> there
+//   :theri               -> their
+//   :thier               -> their
+//   :thn:                -> then
+//   :thna:               -> than
+//   :thne:               -> then
+//   :thrid               -> third
+//   :thru:               -> through
+//   :thsi:               -> this
+//   :thta:               -> that
+//   :tiem:               -> time
+//   :tihs:               -> this
+//   :ting:               -> thing
+//   :tje:                -> the
+//   :tjhe:               -> the
+//   :tkae:               -> take
+//   :tomatos             -> tomatoes
+//   :tothe               -> to the
+//   :tthe:               -> the
+//   :ture                -> true
+//   :turth               -> truth
+//   :tust:               -> trust
+//   :tution:             -> tuition
+//   :twon:               -> town
+//   :twpo                -> two
+//   :tyhe                -> they
+//   :ublisher            -> publisher
+//   :ues:                -> use
+//   :uesd:               -> used
+//   :uise                -> use
+//   :undre:              -> under
+//   :usally              -> usually
+//   :ushould             -> should
+//   :vell                -> well
+//   :veyr:               -> very
+//   :villian             -> villain
+//   :villin:             -> villain
+//   :viola:              -> voila
+//   :visably             -> visibly
+//   :vrey:               -> very
+//   :vyer:               -> very
+//   :vyre:               -> very
+//   :waht:               -> what
+//   :wich:               -> which
+//   :wih:                -> with
+//   :wrok                -> work
+//   :wtih:               -> with
+//   :yaer                -> year
+//   :yeasr               -> years
+//   :yera                -> year
+//   :yrea                -> year
+//   :ytou:               -> you
+//   :yu:                 -> you
+//   :yuo:                -> you
+//   abandonned           -> abandoned
+//   abbout               -> about
+//   aberation            -> aberration
+//   abilityes            -> abilities
+//   abilties             -> abilities
+//   abilty               -> ability
+//   abondon              -> abandon
+//   aborigene            -> aborigine
+//   abortificant         -> abortifacient
+//   abotu                -> about
+//   abouta               -> about a
+//   aboutit              -> about it
+//   aboutthe             -> about the
+//   abreviate:           -> abbreviate
+//   abreviation          -> abbreviation
+//   abritrary            -> arbitrary
+//   absail               -> abseil
+//   abscence             -> absence
+//   absense              -> absence
+//   absolutly            -> absolutely
+//   absorbsion           -> absorption
+//   absorbtion           -> absorption
+//   absoultely           -> absolutely
+//   absoultly            -> absolutely
+//   abstration           -> abstraction
+//   abudance             -> abundance
+//   abundacies           -> abundances
+//   abundancies          -> abundances
+//   abundunt             -> abundant
+//   abutts               -> abuts
+//   abvove               -> above
+//   acadamy              -> academy
+//   acadmic              -> academic
+//   accademic            -> academic
+//   accademy             -> academy
+//   acccused             -> accused
+//   accelleration        -> acceleration
+//   accension            -> accession, ascension
+//   acceptence           -> acceptance
+//   acceptible           -> acceptable
+//   accesories           -> accessories
+//   accessable           -> accessible
+//   accidant:            -> accident
+//   accidentaly          -> accidentally
+//   accidently           -> accidentally
+//   acclimitization      -> acclimatization
+//   accomadate           -> accommodate
+//   accomadating         -> accommodating
+//   accomadation         -> accommodation
+//   accomdate            -> accommodate
+//   accomodate           -> accommodate
+//   accomodating         -> accommodating
+//   accomodation         -> accommodation
+//   accompanyed          -> accompanied
+//   accordeon            -> accordion
+//   accordian            -> accordion
+//   accordingto          -> according to
+//   accoring             -> according
+//   accoustic            -> acoustic
+//   accquainted          -> acquainted
+//   accrediation         -> accreditation
+//   accredidation        -> accreditation
+//   accross              -> across
+//   accussed             -> accused
+//   acedemic             -> academic
+//   acheiv:              -> achieve
+//   acheive              -> achieve
+//   acheiving            -> achieving
+//   acheivment           -> achievement
+//   achievment           -> achievement
+//   achivement           -> achievement
+//   acident              -> accident
+//   acknowldeged         -> acknowledged
+//   acknowledgeing       -> acknowledging
+//   ackward              -> awkward, backward
+//   acommodate           -> accommodate
+//   acomodate            -> accommodate
+//   acompanied           -> accompanied
+//   acomplish            -> accomplish
+//   acording             -> according
+//   acquaintence         -> acquaintance
+//   acquiantence         -> acquaintance
+//   acquited             -> acquitted
+//   activatio:           -> activation
+//   activites            -> activities
+//   activly              -> actively
+//   actoin               -> action
+//   actualy:             -> actually
+//   actualyl             -> actually
+//   actviate             -> activate
+//   acuracy              -> accuracy
+//   acurate              -> accurate
+//   acused               -> accused
+//   acustom:             -> accustom
+//   acustommed           -> accustomed
+//   acutally             -> actually
+//   adavanced            -> advanced
+//   adbandon             -> abandon
+//   addictional          -> additional
+//   addional             -> additional
+//   additinal:           -> additional
+//   additinally          -> additionally
+//   additionaly          -> additionally
+//   additonal            -> additional
+//   addmission           -> admission
+//   addopt               -> adopt
+//   addres:              -> address
+//   addresed             -> addressed
+//   addresing            -> addressing
+//   addressess           -> addresses
+//   addtion              -> addition
+//   adecuate             -> adequate
+//   adequit:             -> adequate
+//   adequite             -> adequate
+//   adhearing            -> adhering
+//   adherance            -> adherence
+//   admendment           -> amendment
+//   admininistrative     -> administrative
+//   adminstered          -> administered
+//   adminstrate          -> administrate
+//   adminstration        -> administration
+//   adminstrative        -> administrative
+//   adminstrator         -> administrator
+//   admissability        -> admissibility
+//   admissable           -> admissible
+//   admited              -> admitted
+//   adolecent            -> adolescent
+//   adquire              -> acquire
+//   adquiring            -> acquiring
+//   adres:               -> address
+//   adresable            -> addressable
+//   adresing             -> addressing
+//   adress:              -> address
+//   adressable           -> addressable
+//   adressed             -> addressed
+//   adressing            -> addressing
+//   advanage             -> advantage
+//   adventrous           -> adventurous
+//   advertisment         -> advertisement
+//   advesary             -> adversary
+//   adviced              -> advised
+//   aeriel               -> aerial
+//   afair                -> affair
+//   afficianados         -> aficionados
+//   afficionado          -> aficionado
+//   affilate             -> affiliate
+//   affilliate           -> affiliate
+//   affraid              -> afraid
+//   aforememtioned       -> aforementioned
+//   afterthe             -> after the
+//   againnst             -> against
+//   agains:              -> against
+//   agaisnt              -> against
+//   aggaravates          -> aggravates
+//   aggreed              -> agreed
+//   aggreement           -> agreement
+//   aggregious           -> egregious
+//   aggregrator          -> aggregator
+//   aggresive            -> aggressive
+//   agianst              -> against
+//   agina                -> again
+//   aginst               -> against
+//   agravate             -> aggravate
+//   agreeement           -> agreement
+//   agreemeent           -> agreement
+//   agreemnet            -> agreement
+//   agreemnt             -> agreement
+//   agregate             -> aggregate
+//   agreing              -> agreeing
+//   agression            -> aggression
+//   agressive            -> aggressive
+//   agressor             -> aggressor
+//   agricultue           -> agriculture
+//   agriculure           -> agriculture
+//   agricuture           -> agriculture
+//   agrieved             -> aggrieved
+//   ahev                 -> have
+//   ahppen               -> happen
+//   ahppn                -> happen
+//   ahve                 -> have
+//   aicraft              -> aircraft
+//   aiport               -> airport
+//   airbourne            -> airborne
+//   aircaft              -> aircraft
+//   aircrafts:           -> aircraft
+//   airporta             -> airports
+//   airrcraft            -> aircraft
+//   aisian               -> asian
+//   aknowledge           -> acknowledge
+//   albiet               -> albeit
+//   alchohol             -> alcohol
+//   alchol               -> alcohol
+//   alcohal              -> alcohol
+//   alcoholical          -> alcoholic
+//   aledge               -> allege
+//   alegience            -> allegiance
+//   algebraical          -> algebraic
+//   algorhitms           -> algorithms
+//   algoritm             -> algorithm
+//   alientating          -> alienating
+//   alledge              -> allege
+//   allegedely           -> allegedly
+//   allegedy             -> allegedly
+//   allegely             -> allegedly
+//   allegence            -> allegiance
+//   allegience           -> allegiance
+//   allign               -> align
+//   alliviate            -> alleviate
+//   allopone             -> allophone
+//   allready             -> already
+//   allthough            -> although
+//   alltime              -> all-time
+//   alltogether          -> altogether
+//   allwasy              -> always
+//   allwats              -> always
+//   allwyas              -> always
+//   almsot               -> almost
+//   alochol              -> alcohol
+//   alomst               -> almost
+//   alos                 -> also
+//   alotted              -> allotted
+//   alowed               -> allowed
+//   alowing              -> allowing
+//   alsot                -> also
+//   alternitives         -> alternatives
+//   altho:               -> although
+//   althought            -> although
+//   altough              -> although
+//   alusion              -> allusion
+//   alwasy               -> always
+//   alwats               -> always
+//   alway:               -> always
+//   alwyas               -> always
+//   amalgomated          -> amalgamated
+//   amatuer              -> amateur
+//   amature              -> amateur
+//   amde                 -> made
+//   amendmant            -> amendment
+//   amercia              -> America
+//   amerliorate          -> ameliorate
+//   amke                 -> make
+//   amking               -> making
+//   ammend               -> amend
+//   ammount              -> amount
+//   ammused              -> amused
+//   amoung               -> among
+//   amung                -> among
+//   amunition            -> ammunition
+//   analagous            -> analogous
+//   analitic             -> analytic
+//   analogeous           -> analogous
+//   anarchim             -> anarchism
+//   anarchistm           -> anarchism
+//   anbd                 -> and
+//   ancestory            -> ancestry
+//   ancilliary           -> ancillary
+//   andb:                -> and
+//   andd:                -> and
+//   androgenous          -> androgynous
+//   androgeny            -> androgyny
+//   anihilation          -> annihilation
+//   aniversary           -> anniversary
+//   annoint              -> anoint
+//   annouced             -> announced
+//   annualy              -> annually
+//   annuled              -> annulled
+//   anohter              -> another
+//   anomolies            -> anomalies
+//   anomolous            -> anomalous
+//   anomoly              -> anomaly
+//   anonimity            -> anonymity
+//   anounced             -> announced
+//   anouncement          -> announcement
+//   ansalisation         -> nasalisation
+//   ansalization         -> nasalization
+//   ansestors            -> ancestors
+//   antartic             -> antarctic
+//   anthromorphization   -> anthropomorphization
+//   anthropolgist        -> anthropologist
+//   anthropolgy          -> anthropology
+//   antiapartheid        -> anti-apartheid
+//   anulled              -> annulled
+//   anwser               -> answer
+//   anyhwere             -> anywhere
+//   anyother             -> any other
+//   anytying             -> anything
+//   aparent              -> apparent
+//   aparment             -> apartment
+//   aparrent             -> apparent
+//   apenines             -> apennines, Apennines
+//   aplication           -> application
+//   aplied               -> applied
+//   apolegetics          -> apologetics
+//   apparant             -> apparent
+//   apparrent            -> apparent
+//   appart               -> apart
+//   appealling           -> appealing
+//   appeareance          -> appearance
+//   appearence           -> appearance
+//   apperance            -> appearance
+//   appereance           -> appearance
+//   applicaiton          -> application
+//   appologies           -> apologies
+//   appology             -> apology
+//   apprearance          -> appearance
+//   apprieciate          -> appreciate
+//   approachs            -> approaches
+//   appropiate           -> appropriate
+//   appropraite          -> appropriate
+//   appropropiate        -> appropriate
+//   approproximate       -> approximate
+//   approxamately        -> approximately
+//   approxiately         -> approximately
+//   approximitely        -> approximately
+//   aprehensive          -> apprehensive
+//   aproblem             -> a problem
+//   apropriate           -> appropriate
+//   aproval              -> approval
+//   aproximate           -> approximate
+//   aquaduct             -> aqueduct
+//   aquaintance          -> acquaintance
+//   aquainted            -> acquainted
+//   aquiantance          -> acquaintance
+//   aquire               -> acquire
+//   aquiring             -> acquiring
+//   aquisition           -> acquisition
+//   aquitted             -> acquitted
+//   aranged              -> arranged
+//   arangement           -> arrangement
+//   arbirtary            -> arbitrary
+//   arbitarily           -> arbitrarily
+//   arbitary             -> arbitrary
+//   archaelogical        -> archaeological
+//   archaelogists        -> archaeologists
+//   archaelogy           -> archaeology
+//   archaoelogy          -> archeology
+//   archaology           -> archeology
+//   archeaologist        -> archeologist
+//   archetect            -> architect
+//   archiac              -> archaic
+//   archictect           -> architect
+//   archimedian          -> archimedean
+//   architecht           -> architect
+//   architectual         -> architectural
+//   archtype             -> archetype
+//   aready               -> already
+//   areodynamics         -> aerodynamics
+//   argubly              -> arguably
+//   arguement            -> argument
+//   arised               -> arose
+//   arival               -> arrival
+//   armamant             -> armament
+//   armistace            -> armistice
+//   arogant              -> arrogant
+//   arogent              -> arrogant
+//   arond                -> around
+//   aroud                -> around
+//   arrangment           -> arrangement
+//   arrengement          -> arrangement
+//   arround              -> around
+//   artcile              -> article
+//   artical              -> article
+//   artice:              -> article
+//   articel              -> article
+//   artifical            -> artificial
+//   artillary            -> artillery
+//   arund                -> around
+//   asetic               -> ascetic
+//   asfar                -> as far
+//   asociated            -> associated
+//   asorbed              -> absorbed
+//   asphyxation          -> asphyxiation
+//   assasin              -> assassin
+//   assassintation       -> assassination
+//   assemple             -> assemble
+//   assertation          -> assertion
+//   asside               -> aside
+//   assisnate            -> assassinate
+//   assistence           -> assistance
+//   assistent            -> assistant
+//   assit:               -> assist
+//   assitant             -> assistant
+//   assocation           -> association
+//   assoicate            -> associate
+//   assosication         -> assassination
+//   asssassans           -> assassins
+//   assualt              -> assault
+//   assymetric           -> asymmetric
+//   asteriod             -> asteroid
+//   asthetic             -> aesthetic
+//   asume                -> assume
+//   aswell               -> as well
+//   atain                -> attain
+//   atempting            -> attempting
+//   atheistical          -> atheistic
+//   athenean             -> athenian
+//   athiesm              -> atheism
+//   athiest              -> atheist
+//   athorised            -> authorised
+//   atorney              -> attorney
+//   atribute             -> attribute
+//   attemp:              -> attempt
+//   attemt               -> attempt
+//   attendence           -> attendance
+//   attendent            -> attendant
+//   attened              -> attended
+//   attension            -> attention
+//   attitide             -> attitude
+//   attributred          -> attributed
+//   attrocities          -> atrocities
+//   audeince             -> audience
+//   audiance             -> audience
+//   auromated            -> automated
+//   austrailia           -> Australia
+//   authenciate          -> authenticate
+//   auther               -> author
+//   authetication        -> authentication
+//   authobiographic      -> autobiographic
+//   authobiography       -> autobiography
+//   authorative          -> authoritative
+//   authorites           -> authorities
+//   authorithy           -> authority
+//   authoritiers         -> authorities
+//   authoritive          -> authoritative
+//   authrorities         -> authorities
+//   autochtonous         -> autochthonous
+//   autoctonous          -> autochthonous
+//   automaticly          -> automatically
+//   automibile           -> automobile
+//   automonomous         -> autonomous
+//   autor:               -> author
+//   autority             -> authority
+//   auxilary             -> auxiliary
+//   auxillaries          -> auxiliaries
+//   auxillary            -> auxiliary
+//   auxilliaries         -> auxiliaries
+//   auxilliary           -> auxiliary
+//   availabe             -> available
+//   availablity          -> availability
+//   availaible           -> available
+//   availalbe            -> available
+//   availble             -> available
+//   availiable           -> available
+//   availible            -> available
+//   avalable             -> available
+//   avalance             -> avalanche
+//   avaliable            -> available
+//   averageed            -> averaged
+//   avialable            -> available
+//   avilable             -> available
+//   awared               -> awarded
+//   aweful               -> awful
+//   bacame               -> became
+//   baceause             -> because
+//   backgorund           -> background
+//   backrounds           -> backgrounds
+//   bakc                 -> back
+//   balence              -> balance
+//   ballance             -> balance
+//   banannas             -> bananas
+//   bandwith             -> bandwidth
+//   bankrupcy            -> bankruptcy
+//   banruptcy            -> bankruptcy
+//   baout                -> about
+//   basicaly             -> basically
+//   basicly              -> basically
+//   bcak                 -> back
+//   beacause             -> because
+//   beachead             -> beachhead
+//   beacuse              -> because
+//   beastiality          -> bestiality
+//   beatiful             -> beautiful
+//   beaurocracy          -> bureaucracy
+//   beaurocratic         -> bureaucratic
+//   beautyfull:          -> beautiful
+//   becamae              -> became
+//   becames              -> becomes
+//   becaus:              -> because
+//   becausea             -> because a
+//   becauseof            -> because of
+//   becausethe           -> because the
+//   becauseyou           -> because you
+//   beccause             -> because
+//   becomeing            -> becoming
+//   becomming            -> becoming
+//   becouse              -> because
+//   becuase              -> because
+//   becuse               -> because
+//   bedore               -> before
+//   beeing               -> being
+//   befoer               -> before
+//   beggin:              -> begin
+//   begginer             -> beginner
+//   beggining            -> beginning
+//   beggins              -> begins
+//   begining             -> beginning
+//   beginining           -> beginning
+//   beginnig             -> beginning
+//   behabviour           -> behavior
+//   behaivior            -> behavior
+//   behaviour            -> behavior
+//   behavour             -> behavior
+//   beleagured           -> beleaguered
+//   beleiev              -> believe
+//   beleif               -> belief
+//   beleive              -> believe
+//   beleiving            -> believing
+//   beliefe              -> belief
+//   beligum              -> belgium
+//   belive               -> believe
+//   belligerant          -> belligerent
+//   bellweather          -> bellwether
+//   bemusemnt            -> bemusement
+//   beneficary           -> beneficiary
+//   beng:                -> being
+//   benificial           -> beneficial
+//   benifit              -> benefit
+//   bergamont            -> bergamot
+//   beseiging            -> besieging
+//   beteen               -> between
+//   betwen               -> between
+//   beutiful             -> beautiful
+//   beween               -> between
+//   bewteen              -> between
+//   bigining             -> beginning
+//   biginning            -> beginning
+//   bilateraly           -> bilaterally
+//   billingualism        -> bilingualism
+//   binominal            -> binomial
+//   bizzare              -> bizarre
+//   blaim:               -> blame
+//   blaimed              -> blamed
+//   blessure             -> blessing
+//   blitzkreig           -> Blitzkrieg
+//   boaut                -> about
+//   bodydbuilder         -> bodybuilder
+//   bombardement         -> bombardment
+//   bombarment           -> bombardment
+//   bondary              -> boundary
+//   boook                -> book
+//   borke:               -> broke
+//   boundry              -> boundary
+//   bouyancy             -> buoyancy
+//   bouyant              -> buoyant
+//   boxs                 -> boxes
+//   bradcast             -> broadcast
+//   brasillian           -> Brazilian
+//   breakthough          -> breakthrough
+//   breif                -> brief
+//   brethen              -> brethren
+//   bretheren            -> brethren
+//   briliant             -> brilliant
+//   brillant             -> brilliant
+//   brimestone           -> brimstone
+//   britian              -> Britain
+//   brittish             -> British
+//   broacasted           -> broadcast
+//   broadacasting        -> broadcasting
+//   broady               -> broadly
+//   brodcast             -> broadcast
+//   buddah               -> Buddha
+//   buddist              -> Buddhist
+//   buisness             -> business
+//   buoancy              -> buoyancy
+//   burried              -> buried
+//   busines:             -> business
+//   busness              -> business
+//   bussiness            -> business
+//   butthe               -> but the
+//   cacheing             -> caching
+//   caculater            -> calculator
+//   cacuses              -> caucuses
+//   caharcter            -> character
+//   cahracter            -> character
+//   calaber              -> caliber
+//   calander             -> calendar
+//   calculater           -> calculator
+//   calcullate           -> calculate
+//   calculs              -> calculus
+//   calender             -> calandar
+//   caligraphy           -> calligraphy
+//   caluclate            -> calculate
+//   caluculate           -> calculate
+//   calulate             -> calculate
+//   cambrige             -> Cambridge
+//   camoflage            -> camouflage
+//   campagin             -> campaign
+//   campain              -> campaign
+//   candadate            -> candidate
+//   candiate             -> candidate
+//   candidiate           -> candidate
+//   candidtae            -> candidate
+//   cannister            -> canister
+//   cannnot              -> cannot
+//   cannonical           -> canonical
+//   cannotation          -> connotation
+//   caost                -> coast
+//   caperbility          -> capability
+//   capible              -> capable
+//   captial              -> capital
+//   captued              -> captured
+//   capturd              -> captured
+//   carachter            -> character
+//   caracterized         -> characterized
+//   carcas:              -> carcass
+//   carefull:            -> careful
+//   careing              -> caring
+//   carismatic           -> charismatic
+//   carnagie             -> Carnegie
+//   carnege              -> carnage
+//   carnige              -> carnage
+//   carnigie             -> Carnegie
+//   carreer              -> career
+//   carrers              -> careers
+//   carribbean           -> Caribbean
+//   carribean            -> Caribbean
+//   carryng              -> carrying
+//   cartdridge           -> cartridge
+//   carthographer        -> cartographer
+//   cartilege            -> cartilage
+//   cartilidge           -> cartilage
+//   cartrige             -> cartridge
+//   casette              -> cassette
+//   cassawory            -> cassowary
+//   cassowarry           -> cassowary
+//   casue                -> cause
+//   casuing              -> causing
+//   casulaties           -> casualties
+//   casulaty             -> casualty
+//   catagories           -> categories
+//   catagorized          -> categorized
+//   catagory             -> category
+//   catapillar           -> caterpillar
+//   catapiller           -> caterpillar
+//   catepillar           -> caterpillar
+//   catergorize          -> categorize
+//   caterpilar           -> caterpillar
+//   caterpiller          -> caterpillar
+//   cathlic              -> catholic
+//   catholocism          -> catholicism
+//   catterpilar          -> caterpillar
+//   catterpillar         -> caterpillar
+//   cattleship           -> battleship
+//   cauhgt               -> caught
+//   causalities          -> casualties
+//   ceasar               -> Caesar
+//   celcius              -> Celsius
+//   cellpading           -> cellpadding
+//   cementary            -> cemetery
+//   cemetarey            -> cemetery
+//   cemetaries           -> cemeteries
+//   cemetary             -> cemetery
+//   cencus               -> census
+//   censur               -> censor, censure
+//   cententenial         -> centennial
+//   centruies            -> centuries
+//   centruy              -> century
+//   centuties            -> centuries
+//   centuty              -> century
+//   ceratin              -> certain
+//   cerimonial           -> ceremonial
+//   cerimonies           -> ceremonies
+//   cerimonious          -> ceremonious
+//   cerimony             -> ceremony
+//   ceromony             -> ceremony
+//   certainity           -> certainty
+//   certaintly           -> certainly
+//   certian              -> certain
+//   cervial              -> cervical, servile, serval
+//   chagne               -> change
+//   chalenging           -> challenging
+//   challange            -> challenge
+//   challege             -> challenge
+//   chanching            -> changing
+//   changable            -> changeable
+//   changeing            -> changing
+//   changng              -> changing
+//   charachter           -> character
+//   charactersistic      -> characteristic
+//   charactor            -> character
+//   charasmatic          -> charismatic
+//   charaterized         -> characterized
+//   charecter            -> character
+//   charector            -> character
+//   chariman             -> chairman
+//   charistics           -> characteristics
+//   chasr                -> chaser, chase
+//   checkotu             -> checkout
+//   cheif                -> chief
+//   chekc                -> check
+//   chemcial             -> chemical
+//   chemestry            -> chemistry
+//   chemicaly            -> chemically
+//   childbird            -> childbirth
+//   childen              -> children
+//   chnage               -> change
+//   choclate             -> chocolate
+//   choosen              -> chosen
+//   chracter             -> character
+//   chuch                -> church
+//   churchs              -> churches
+//   cieling              -> ceiling
+//   circulaton           -> circulation
+//   circumsicion         -> circumcision
+//   circut               -> circuit
+//   ciricuit             -> circuit
+//   ciriculum            -> curriculum
+//   civillian            -> civilian
+//   claer                -> clear
+//   claimes              -> claims
+//   clas:                -> class
+//   clasic               -> classic
+//   cleareance           -> clearance
+//   cliant               -> client
+//   clincial:            -> clinical
+//   clinicaly            -> clinically
+//   clsoe                -> close
+//   cmo:                 -> com
+//   cmoputer             -> computer
+//   coctail              -> cocktail
+//   coform               -> conform
+//   cognizent            -> cognizant
+//   coincedentally       -> coincidentally
+//   colaborations        -> collaborations
+//   colateral            -> collateral
+//   colection            -> collection
+//   colelctive           -> collective
+//   collaberative        -> collaborative
+//   collecton            -> collection
+//   collegue             -> colleague
+//   collonade            -> colonnade
+//   collonies            -> colonies
+//   collony              -> colony
+//   collosal             -> colossal
+//   colonizators         -> colonizers
+//   colum:               -> column
+//   comander             -> commander
+//   comando              -> commando
+//   comany               -> company
+//   comapany             -> company
+//   comapnies            -> companies
+//   comapny              -> company
+//   comback              -> comeback
+//   combanation          -> combination
+//   combinatin           -> combination
+//   combintation         -> combination
+//   combusion            -> combustion
+//   comdemnation         -> condemnation
+//   comemmorates         -> commemorates
+//   comemoretion         -> commemoration
+//   comitted             -> committed
+//   comittee             -> committee
+//   comitting            -> committing
+//   commadn              -> command
+//   commandoes           -> commandos
+//   commedic             -> comedic
+//   commemerative        -> commemorative
+//   commemmorate         -> commemorate
+//   commemmorating       -> commemorating
+//   commerical           -> commercial
+//   commericial          -> commercial
+//   commerorative        -> commemorative
+//   comming:             -> coming
+//   comminication        -> communication
+//   commision            -> commission
+//   commited             -> committed
+//   commitee             -> committee
+//   commiting            -> committing
+//   committe:            -> committee
+//   committment          -> commitment
+//   committy             -> committee
+//   commmemorated        -> commemorated
+//   commongly            -> commonly
+//   commonweath          -> commonwealth
+//   commuications        -> communications
+//   commuinications      -> communications
+//   communciation        -> communication
+//   communiation         -> communication
+//   communites           -> communities
+//   comntain             -> contain
+//   compability          -> compatibility
+//   compair              -> compare
+//   comparible           -> comparable
+//   comparision          -> comparison
+//   comparitive          -> comparative
+//   compatabilities      -> compatibilities
+//   compatability        -> compatibility
+//   compatable           -> compatible
+//   compatablities       -> compatibilities
+//   compatablity         -> compatibility
+//   compatiable          -> compatible
+//   compatibitly         -> compatibility
+//   compatiblities       -> compatibilities
+//   compatiblity         -> compatibility
+//   compeitions          -> competitions
+//   compensantion        -> compensation
+//   competance           -> competence
+//   competant            -> competent
+//   competative          -> competitive
+//   competion            -> competition, completion
+//   competitiion         -> competition
+//   competive            -> competitive
+//   comphrehensive       -> comprehensive
+//   compitent            -> competent
+//   compleate            -> complete
+//   compleatly           -> completely
+//   compleatness         -> completeness
+//   completedthe         -> completed the
+//   completelyl          -> completely
+//   completetion         -> completion
+//   completly            -> completely
+//   completness          -> completeness
+//   compliation          -> compilation
+//   complier             -> compiler
+//   compltete            -> complete
+//   componant            -> component
+//   composate            -> composite
+//   comprable            -> comparable
+//   comprimise           -> compromise
+//   compulsary           -> compulsory
+//   compulsery           -> compulsory
+//   computarized         -> computerized
+//   comtain              -> contain
+//   comunicate           -> communicate
+//   comunity             -> community
+//   concensus            -> consensus
+//   concider             -> consider
+//   concieted            -> conceited
+//   concieved            -> conceived
+//   concious             -> conscious
+//   condamned            -> condemned
+//   condemmed            -> condemned
+//   condidtion           -> condition
+//   conditionsof         -> conditions of
+//   condolance           -> condolence
+//   conect               -> connect
+//   conesencus           -> consensus
+//   conferance           -> conference
+//   confidental          -> confidential
+//   confids              -> confides
+//   configration         -> configuration
+//   configureable        -> configurable
+//   confirmmation        -> confirmation
+//   confortable          -> comfortable
+//   confuseion           -> confusion
+//   congradulations      -> congratulations
+//   congresional         -> congressional
+//   conived              -> connived
+//   conjecutre           -> conjecture
+//   conjuction           -> conjunction
+//   conjuntion           -> conjunction
+//   conotations          -> connotations
+//   conquerd             -> conquered
+//   conquerer            -> conqueror
+//   conqured             -> conquered
+//   conscent             -> consent
+//   consciouness         -> consciousness
+//   consdider            -> consider
+//   consdiered           -> considered
+//   consectutive         -> consecutive
+//   consenquently        -> consequently
+//   consentrate          -> concentrate
+//   consept              -> concept
+//   consequentually      -> consequently
+//   consequeseces        -> consequences
+//   consern              -> concern
+//   conservitive         -> conservative
+//   consiciousness       -> consciousness
+//   consicousness        -> consciousness
+//   considerd            -> considered
+//   consideres           -> considered
+//   considerit:          -> considerate
+//   considerite          -> considerate
+//   consious             -> conscious
+//   consistant           -> consistent
+//   consituencies        -> constituencies
+//   consituency          -> constituency
+//   consituted           -> constituted
+//   consitution          -> constitution
+//   consolodate          -> consolidate
+//   consonent            -> consonant
+//   consorcium           -> consortium
+//   conspiracy:          -> conspiracy
+//   conspiracys          -> conspiracies
+//   conspiriator         -> conspirator
+//   conspiricy:          -> conspiracy
+//   conspiricys          -> conspiracies
+//   constaints           -> constraints
+//   constanly            -> constantly
+//   constarnation        -> consternation
+//   constatn             -> constant
+//   constinually         -> continually
+//   constituant          -> constituent
+//   constituion          -> constitution
+//   consttruction        -> construction
+//   constuction          -> construction
+//   consulant            -> consultant
+//   consultent           -> consultant
+//   consumate            -> consummate
+//   consumeable          -> consumable
+//   contaiminate         -> contaminate
+//   containes            -> contains
+//   contamporaries       -> contemporaries
+//   contamporary         -> contemporary
+//   contempoary          -> contemporary
+//   contemporaneus       -> contemporaneous
+//   contempory           -> contemporary
+//   contendor            -> contender
+//   contian              -> contain
+//   contibute            -> contribute
+//   contigent            -> contingent
+//   contined             -> continued
+//   continential         -> continental
+//   continous            -> continuous
+//   continueing          -> continuing
+//   contition            -> condition
+//   contravercial        -> controversial
+//   contraversy          -> controversy
+//   contributer          -> contributor
+//   contritutions        -> contributions
+//   controlable          -> controllable
+//   controled            -> controlled
+//   controll:            -> control
+//   controlls:           -> controls
+//   controvercial        -> controversial
+//   controvercy          -> controversy
+//   controveries         -> controversies
+//   controversal         -> controversial
+//   controversey         -> controversy
+//   controvertial        -> controversial
+//   controvery           -> controversy
+//   contruction          -> construction
+//   contstruction        -> construction
+//   conveinent           -> convenient
+//   convenant            -> covenant
+//   convential           -> conventional
+//   convertable          -> convertible
+//   convertion           -> conversion
+//   conviced             -> convinced
+//   convienient          -> convenient
+//   cooparate            -> cooperate
+//   cooporate            -> cooperate
+//   coordiantion         -> coordination
+//   coorperation:        -> cooperation, corporation
+//   coorperations        -> corporations
+//   copmetitors          -> competitors
+//   coputer              -> computer
+//   copywrite:           -> copyright
+//   coridal              -> cordial
+//   cornmitted           -> committed
+//   corosion             -> corrosion
+//   corparate            -> corporate
+//   corperation          -> corporation
+//   corproation          -> corporation
+//   correcters           -> correctors
+//   correponding         -> corresponding
+//   correposding         -> corresponding
+//   correspondant        -> correspondent
+//   corridoors           -> corridors
+//   corrispond           -> correspond
+//   corrospond           -> correspond
+//   corruptable          -> corruptible
+//   cosnt                -> const
+//   costitution          -> constitution
+//   cotten               -> cotton
+//   coucil               -> council
+//   coudl                -> could
+//   couldth              -> could the
+//   councellor           -> counselor
+//   counries             -> countries
+//   countain             -> contain
+//   countires            -> countries
+//   cpoy                 -> copy
+//   creaeted             -> created
+//   creedence            -> credence
+//   critereon            -> criterion
+//   criterias            -> criteria
+//   criticists           -> critics
+//   critising            -> criticising
+//   critisising          -> criticising
+//   critisism            -> criticism
+//   critisize            -> criticise
+//   critisizing          -> criticising
+//   critized             -> criticized
+//   critizing            -> criticizing
+//   crockodiles          -> crocodiles
+//   crowm                -> crown
+//   crtical              -> critical
+//   crticised            -> criticised
+//   crucifiction         -> crucifixion
+//   crusies              -> cruises
+//   crutial              -> crucial
+//   crystalisation       -> crystallisation
+//   ctaegory             -> category
+//   culiminating         -> culminating
+//   cumulatative         -> cumulative
+//   curch                -> church
+//   curcuit              -> circuit
+//   currenly             -> currently
+//   curriculem           -> curriculum
+//   cusotmer             -> customer
+//   cutsomer             -> customer
+//   cxan                 -> cyan
+//   cyclinder            -> cylinder
+//   dacquiri             -> daiquiri
+//   daectivate           -> deactivate
+//   daed:                -> dead
+//   dael                 -> deal
+//   dalmation            -> dalmatian
+//   damenor              -> demeanor
+//   dammage              -> damage
+//   danceing             -> dancing
+//   daugher:             -> daughter
+//   dcument              -> document
+//   deatil               -> detail
+//   debateable           -> debatable
+//   decendant            -> descendant
+//   decendent            -> descendant
+//   decideable           -> decidable
+//   decidely             -> decidedly
+//   decied               -> decide
+//   decieve              -> deceive
+//   decison              -> decision
+//   decomposit:          -> decompose
+//   decomposited         -> decomposed
+//   decompositing        -> decomposing
+//   decomposits          -> decomposes
+//   decress              -> decrees
+//   decribe              -> describe
+//   decribing            -> describing
+//   dectect              -> detect
+//   defendent            -> defendant
+//   defered              -> deferred
+//   deffensively         -> defensively
+//   deffine              -> define
+//   definance            -> defiance
+//   definate             -> definite
+//   definatly            -> definitely
+//   definded             -> defined
+//   definetly            -> definitely
+//   definining           -> defining
+//   definitly            -> definitely
+//   definiton            -> definition
+//   defintion            -> definition
+//   degrate              -> degrade
+//   delagates            -> delegates
+//   delapidated          -> dilapidated
+//   delerious            -> delirious
+//   delevopment          -> development
+//   deliberatly          -> deliberately
+//   delusionally         -> delusively
+//   demenor              -> demeanor
+//   demographical        -> demographic
+//   demolision           -> demolition
+//   demorcracy           -> democracy
+//   demostration         -> demonstration
+//   denegrating          -> denigrating
+//   denpendence          -> dependence
+//   denpendent           -> dependent
+//   densly               -> densely
+//   deparment            -> department
+//   depedence            -> dependence
+//   depedent             -> dependent
+//   dependance           -> dependence
+//   dependancy           -> dependency
+//   dependant            -> dependent
+//   dependece            -> dependence
+//   dependendet          -> dependent
+//   depreciate           -> deprecate
+//   depricate            -> deprecate
+//   deptartment          -> department
+//   deram                -> dram, dream
+//   deriviated           -> derived
+//   derivitive           -> derivative
+//   derogitory           -> derogatory
+//   dervied              -> derived
+//   descendands          -> descendants
+//   descibed             -> described
+//   descision            -> decision
+//   descriiben           -> describe
+//   descriibes           -> describes
+//   descripter           -> descriptor
+//   descripton           -> description
+//   desctruction         -> destruction
+//   descuss              -> discuss
+//   desgin               -> design
+//   desicion             -> decision
+//   deside               -> decide
+//   desigining           -> designing
+//   desinations          -> destinations
+//   desintegrated        -> disintegrated
+//   desintegration       -> disintegration
+//   desireable           -> desirable
+//   desision             -> decision
+//   desitned             -> destined
+//   desktiop             -> desktop
+//   desorder             -> disorder
+//   desoriented          -> disoriented
+//   desparate            -> desperate, disparate
+//   despict              -> depict
+//   despiration          -> desperation
+//   dessicated           -> desiccated
+//   dessigned            -> designed
+//   destablized          -> destabilized
+//   destory              -> destroy
+//   detailled            -> detailed
+//   detatched            -> detached
+//   deteoriated          -> deteriorated
+//   deteriate            -> deteriorate
+//   deterioriating       -> deteriorating
+//   determin:            -> determine
+//   determinining        -> determining
+//   detial               -> detail
+//   detremental          -> detrimental
+//   devasted             -> devastated
+//   develeopr            -> developer
+//   devellop             -> develop
+//   develope:            -> develop
+//   developement         -> development
+//   developor            -> developer
+//   developped           -> developed
+//   develpment           -> development
+//   devels               -> delves
+//   devestated           -> devastated
+//   devestating          -> devastating
+//   devide               -> divide
+//   devistating          -> devastating
+//   devolopement         -> development
+//   diablical            -> diabolical
+//   diamons              -> diamonds
+//   diaplay              -> display
+//   diaster              -> disaster
+//   dichtomy             -> dichotomy
+//   diconnect            -> disconnect
+//   dicover              -> discover
+//   dictionarys          -> dictionaries
+//   dicussed             -> discussed
+//   didnot               -> did not
+//   didnt                -> didn't
+//   diea                 -> idea
+//   dieing               -> dying, dyeing
+//   dieties              -> deities
+//   diety                -> deity
+//   difefrent            -> different
+//   diference            -> difference
+//   diferent             -> different
+//   diferrent            -> different
+//   differance           -> difference
+//   differant            -> different
+//   differemt            -> different
+//   differentiatiations  -> differentiations
+//   differetn            -> different
+//   differnt             -> different
+//   difficulity          -> difficulty
+//   diffrent             -> different
+//   dificult             -> difficult
+//   dimenions            -> dimensions
+//   dimention            -> dimension
+//   diminuitive          -> diminutive
+//   dimunitive           -> diminutive
+//   diosese              -> diocese
+//   diphtong             -> diphthong
+//   diplomancy           -> diplomacy
+//   dipthong             -> diphthong
+//   directer             -> director
+//   directiosn           -> direction
+//   directot             -> director
+//   dirived              -> derived
+//   disagreeed           -> disagreed
+//   disapeared           -> disappeared
+//   disapointing         -> disappointing
+//   disappearred         -> disappeared
+//   disasterous          -> disastrous
+//   disatisfaction       -> dissatisfaction
+//   disatisfied          -> dissatisfied
+//   disatrous            -> disastrous
+//   discontentment       -> discontent
+//   discoverd            -> discovered
+//   discribe             -> describe
+//   discribing           -> describing
+//   disctinction         -> distinction
+//   disctinctive         -> distinctive
+//   disemination         -> dissemination
+//   disenchanged         -> disenchanted
+//   disign               -> design
+//   disiplined           -> disciplined
+//   disolved             -> dissolved
+//   disover              -> discover
+//   dispair              -> despair
+//   dispaly              -> display
+//   disparingly          -> disparagingly
+//   dispence             -> dispense
+//   dispencing           -> dispensing
+//   dispicable           -> despicable
+//   dispite              -> despite
+//   disproportiate       -> disproportionate
+//   disputandem          -> disputandum
+//   disricts             -> districts
+//   dissagreement        -> disagreement
+//   dissapear            -> disappear
+//   dissappear           -> disappear
+//   dissappointed        -> disappointed
+//   dissarray            -> disarray
+//   dissobediance        -> disobedience
+//   dissobediant         -> disobedient
+//   dissobedience        -> disobedience
+//   dissobedient         -> disobedient
+//   dissonent            -> dissonant
+//   distiction           -> distinction
+//   distingish           -> distinguish
+//   distingquished       -> distinguished
+//   distribusion         -> distribution
+//   distrubution         -> distribution
+//   distruction          -> destruction
+//   distructive          -> destructive
+//   ditributed           -> distributed
+//   diversed             -> diverse, diverged
+//   divice               -> device
+//   divinition           -> divination
+//   divison              -> division
+//   divsion              -> division
+//   doccument            -> document
+//   docrines             -> doctrines
+//   doctines             -> doctrines
+//   docuement            -> document
+//   docuemnt             -> document
+//   documenatry          -> documentary
+//   documetn             -> document
+//   documnet             -> document
+//   doens                -> does
+//   doese                -> does
+//   doesnt               -> doesn't
+//   doign                -> doing
+//   doimg                -> doing
+//   doind                -> doing
+//   doller               -> dollar
+//   dollor               -> dollar
+//   dominaton            -> domination
+//   dominent             -> dominant
+//   dominiant            -> dominant
+//   donig                -> doing
+//   dosen:               -> doesn't
+//   dosent               -> doesn't
+//   dosnt                -> doesn't
+//   doulbe               -> double
+//   dowload              -> download
+//   dramtic              -> dramatic
+//   draughtman           -> draughtsman
+//   dreasm               -> dreams
+//   driectly             -> directly
+//   driveing             -> driving
+//   drnik                -> drink
+//   druming              -> drumming
+//   drummless            -> drumless
+//   dupicate             -> duplicate
+//   durig                -> during
+//   durring              -> during
+//   duting               -> during
+//   dyanmic              -> dynamic
+//   dyas                 -> dryas
+//   eahc                 -> each
+//   ealier               -> earlier
+//   earlies:             -> earliest
+//   ecclectic            -> eclectic
+//   eceonomy             -> economy
+//   ecidious             -> deciduous
+//   eclispe              -> eclipse
+//   ecomonic             -> economic
+//   econoimic            -> economic
+//   eearly               -> early
+//   effeciency           -> efficiency
+//   effecient            -> efficient
+//   efficency            -> efficiency
+//   efficent             -> efficient
+//   efford               -> effort, afford
+//   effulence            -> effluence
+//   efort                -> effort
+//   elasped              -> elapsed
+//   elction              -> election
+//   electic              -> eclectic, electric
+//   electon              -> election, electron
+//   electrial            -> electrical
+//   electricly           -> electrically
+//   electricty           -> electricity
+//   elementay            -> elementary
+//   eleminated           -> eliminated
+//   eleminating          -> eliminating
+//   eletricity           -> electricity
+//   elicided             -> elicited
+//   eligable             -> eligible
+//   elimentary           -> elementary
+//   ellected             -> elected
+//   elpased              -> elapsed
+//   elphant              -> elephant
+//   embarass             -> embarrass
+//   embargos             -> embargoes
+//   embarras:            -> embarrass
+//   embeded              -> embedded
+//   embezelled           -> embezzled
+//   emblamatic           -> emblematic
+//   emision              -> emission
+//   emited               -> emitted
+//   emiting              -> emitting
+//   emition              -> emission, emotion
+//   emmediately          -> immediately
+//   emmigrated           -> emigrated, immigrated
+//   emminent:            -> eminent, imminent
+//   emminently           -> eminently
+//   emmisaries           -> emissaries
+//   emmisarries          -> emissaries
+//   emmisarry            -> emissary
+//   emmisary             -> emissary
+//   emmision             -> emission
+//   emmited              -> emitted
+//   emmiting             -> emitting
+//   emmitted             -> emitted
+//   emmitting            -> emitting
+//   emperical            -> empirical
+//   emphaised            -> emphasised
+//   emphsis              -> emphasis
+//   emphysyma            -> emphysema
+//   empirial             -> empirical, imperial
+//   emporer              -> emperor
+//   emprisoned           -> imprisoned
+//   enahance             -> enhance
+//   enameld              -> enameled
+//   enchance             -> enhance
+//   encouraing           -> encouraging
+//   encryptiion          -> encryption
+//   encylopedia          -> encyclopedia
+//   encypt               -> encrypt
+//   endevors             -> endeavors
+//   endevour             -> endeavour
+//   endig                -> ending
+//   endolithes           -> endoliths
+//   enduce               -> induce
+//   enforceing           -> enforcing
+//   engagment            -> engagement
+//   engeneer             -> engineer
+//   engieneer            -> engineer
+//   enlargment           -> enlargement
+//   enlish               -> English, enlist
+//   ennoy                -> annoy
+//   enought              -> enough
+//   enourmous            -> enormous
+//   enoy                 -> annoy
+//   ensconsed            -> ensconced
+//   entaglements         -> entanglements
+//   enteratinment        -> entertainment
+//   enthusiatic          -> enthusiastic
+//   entitity             -> entity
+//   entitlied            -> entitled
+//   entrepeneur          -> entrepreneur
+//   enviorment           -> environment
+//   enviornment          -> environment
+//   enviroment           -> environment
+//   envolutionary        -> evolutionary
+//   envrionments         -> environments
+//   enxt:                -> next
+//   epidsode             -> episode
+//   epsiode              -> episode
+//   equalibrium          -> equilibrium
+//   equelibrium          -> equilibrium
+//   equialent            -> equivalent
+//   equilibium           -> equilibrium
+//   equilibrum           -> equilibrium
+//   equiped              -> equipped
+//   equippment           -> equipment
+//   equitorial           -> equatorial
+//   equivalant           -> equivalent
+//   equivelant           -> equivalent
+//   equivelent           -> equivalent
+//   equivilant           -> equivalent
+//   equivilent           -> equivalent
+//   equivlalent          -> equivalent
+//   eratic:              -> erratic
+//   eratically           -> erratically
+//   eraticly             -> erratically
+//   erested              -> arrested, erected
+//   esential             -> essential
+//   esitmated            -> estimated
+//   especally            -> especially
+//   especialy:           -> especially
+//   especialyl           -> especially
+//   espesially           -> especially
+//   essencial            -> essential
+//   essense              -> essence
+//   essentail            -> essential
+//   essentialy           -> essentially
+//   essentual            -> essential
+//   essesital            -> essential
+//   estabishes           -> establishes
+//   establising          -> establishing
+//   ethnocentricm        -> ethnocentrism
+//   ethose               -> those, ethos
+//   europian             -> European
+//   eurpean              -> European
+//   eurpoean             -> European
+//   evenhtually          -> eventually
+//   eventally            -> eventually
+//   eventhough           -> even though
+//   eventially           -> eventually
+//   eventualy            -> eventually
+//   everthing            -> everything
+//   everytime            -> every time
+//   everyting            -> everything
+//   eveyr                -> every
+//   evidentally          -> evidently
+//   exagerate            -> exaggerate
+//   exagerating          -> exaggerating
+//   exagerrate           -> exaggerate
+//   exagerrating         -> exaggerating
+//   examinated           -> examined
+//   exampt               -> exempt
+//   exapansion           -> expansion
+//   excact               -> exact
+//   excange              -> exchange
+//   excecut              -> execut
+//   excedded             -> exceeded
+//   excelent             -> excellent
+//   excell:              -> excel
+//   excellance           -> excellence
+//   excellant            -> excellent
+//   excells              -> excels
+//   excercise            -> exercise
+//   excisted             -> existed
+//   excitment            -> excitement
+//   exculsivly           -> exclusively
+//   execising            -> exercising
+//   exection             -> execution
+//   exectued             -> executed
+//   exeedingly           -> exceedingly
+//   exelent              -> excellent
+//   exellent             -> excellent
+//   exemple              -> example
+//   exeprience           -> experience
+//   exept                -> except
+//   exerbate             -> exacerbate
+//   exerciese            -> exercises
+//   exerpt               -> excerpt
+//   exersize             -> exercise
+//   exerternal           -> external
+//   exhalted             -> exalted
+//   exhibtion            -> exhibition
+//   exibition            -> exhibition
+//   exicting             -> exciting
+//   exinct               -> extinct
+//   existance            -> existence
+//   existant             -> existent
+//   existince            -> existence
+//   exliled              -> exiled
+//   exludes              -> excludes
+//   exmaple              -> example
+//   exonorate            -> exonerate
+//   exoskelaton          -> exoskeleton
+//   expalin              -> explain
+//   expatriot            -> expatriate
+//   expeced              -> expected
+//   expecially           -> especially
+//   expeditonary         -> expeditionary
+//   expeiments           -> experiments
+//   expell:              -> expel
+//   expells              -> expels
+//   experiance           -> experience
+//   experienc:           -> experience
+//   expiditions          -> expeditions
+//   expierence           -> experience
+//   expirence            -> experience
+//   explaination         -> explanation
+//   explaning            -> explaining
+//   explicitely          -> explicitly
+//   explictly            -> explicitly
+//   exploititive         -> exploitative
+//   explotation          -> exploitation
+//   exprience            -> experience
+//   expropiated          -> expropriated
+//   expropiation         -> expropriation
+//   exressed             -> expressed
+//   exsit                -> exist
+//   extemely             -> extremely
+//   extention            -> extension
+//   extered              -> exerted
+//   extermist            -> extremist
+//   extint               -> extinct, extant
+//   extradiction         -> extradition
+//   extravagent          -> extravagant
+//   extrememly           -> extremely
+//   extremeophile        -> extremophile
+//   extremly             -> extremely
+//   extrordinarily       -> extraordinarily
+//   extrordinary         -> extraordinary
+//   faciliate            -> facilitate
+//   facilites            -> facilities
+//   facillitate          -> facilitate
+//   facinated            -> fascinated
+//   facist               -> fascist
+//   faeture              -> feature
+//   failse               -> false
+//   fales                -> false
+//   familair             -> familiar
+//   familar              -> familiar
+//   familes              -> families
+//   familliar            -> familiar
+//   fammiliar            -> familiar
+//   famoust              -> famous
+//   fanatism             -> fanaticism
+//   farenheit            -> Fahrenheit
+//   fasle                -> false
+//   fatc                 -> fact
+//   faught               -> fought
+//   favoutrable          -> favourable
+//   feasable             -> feasible
+//   febuary              -> February
+//   feburary             -> February
+//   fecth                -> fetch
+//   fedreally            -> federally
+//   feild                -> field
+//   femminist            -> feminist
+//   feromone             -> pheromone
+//   fertily              -> fertility
+//   fianite              -> finite
+//   fianl                -> final
+//   ficticious           -> fictitious
+//   fictious             -> fictitious
+//   fidn                 -> find
+//   fiel                 -> feel, field, file, phial
+//   fiercly              -> fiercely
+//   fifith               -> fifth
+//   fightings            -> fighting
+//   filiament            -> filament
+//   fimilies             -> families
+//   finacial             -> financial
+//   finaly:              -> finally
+//   finalyl              -> finally
+//   financialy           -> financially
+//   finit:               -> finite
+//   finnish              -> finish
+//   firend               -> friend
+//   firts                -> first
+//   fisionable           -> fissionable
+//   fitler               -> filter
+//   flamable             -> flammable
+//   flase                -> false
+//   flawess              -> flawless
+//   fleed                -> fled, freed
+//   flourine             -> fluorine
+//   flourishment         -> flourishing
+//   fluorish             -> flourish
+//   follwo               -> follow
+//   foloow               -> follow
+//   folow                -> follow
+//   fomed                -> formed
+//   fomr                 -> from, form
+//   fonetic              -> phonetic
+//   fontrier             -> fontier
+//   foootball            -> football
+//   fora:                -> for a
+//   forbad:              -> forbade
+//   forbiden             -> forbidden
+//   foreward             -> foreword
+//   forfiet              -> forfeit
+//   forhead              -> forehead
+//   foriegn              -> foreign
+//   formallize           -> formalize
+//   formaly              -> formally, formerly
+//   formelly             -> formerly
+//   formidible           -> formidable
+//   formost              -> foremost
+//   forsaw               -> foresaw
+//   forseeable           -> foreseeable
+//   fortelling           -> foretelling
+//   forthe               -> for the
+//   forunner             -> forerunner
+//   forwrd               -> forward
+//   foucs                -> focus
+//   foudn                -> found
+//   fougth               -> fought
+//   foundaries           -> foundries
+//   foundary             -> foundry
+//   fourties             -> forties
+//   fourty               -> forty
+//   fouth                -> fourth
+//   foward               -> forward
+//   fraciton             -> fraction
+//   freind               -> friend
+//   frequecy             -> frequency
+//   frequentily          -> frequently
+//   frmo                 -> from
+//   frome:               -> from
+//   fromed               -> formed
+//   fromt:               -> from
+//   fromthe              -> from the
+//   froniter             -> frontier
+//   fucntion             -> function
+//   fufill               -> fulfill
+//   fulfiled             -> fulfilled
+//   fullfill             -> fulfill
+//   functionial          -> functional
+//   fundametal           -> fundamental
+//   funguses             -> fungi
+//   funtion              -> function
+//   furneral             -> funeral
+//   furuther             -> further
+//   futher               -> further
+//   futhroc              -> futhark, futhorc
+//   fwe                  -> few
+//   gae                  -> game, Gael, gale
+//   galatic              -> galactic
+//   gallaxies            -> galaxies
+//   galvinized           -> galvanized
+//   ganerate             -> generate
+//   ganster              -> gangster
+//   garantee             -> guarantee
+//   garnison             -> garrison
+//   gaurantee            -> guarantee
+//   gaurd                -> guard
+//   gaurentee            -> guarantee
+//   gemeral              -> general
+//   geneological         -> genealogical
+//   geneologies          -> genealogies
+//   geneology            -> genealogy
+//   generaly             -> generally
+//   generatting          -> generating
+//   genialia             -> genitalia
+//   geographicial        -> geographical
+//   geometrician         -> geometer
+//   gerat:               -> great
+//   gerneral             -> general
+//   gievn                -> given
+//   giit:                -> git
+//   giti:                -> git
+//   giveing              -> giving
+//   glamourous           -> glamorous
+//   glight               -> flight
+//   gloabl               -> global
+//   gnawwed              -> gnawed
+//   godess               -> goddess
+//   goign                -> going
+//   gonig                -> going
+//   gouvener             -> governor
+//   govement             -> government
+//   govenment            -> government
+//   govenrment           -> government
+//   goverance            -> governance
+//   goverment            -> government
+//   governer             -> governor
+//   governmnet           -> government
+//   govorment            -> government
+//   govornment           -> government
+//   gracefull:           -> graceful
+//   graet                -> great
+//   grafitti             -> graffiti
+//   gramatically         -> grammatically
+//   grammaticaly         -> grammatically
+//   gratuitious          -> gratuitous
+//   greatful             -> grateful
+//   gred                 -> greed
+//   greif                -> grief
+//   gridles              -> griddles
+//   gropu                -> group
+//   gruop                -> group
+//   grwo                 -> grow
+//   guaratee             -> guarantee
+//   guarentee            -> guarantee
+//   guerrila             -> guerrilla
+//   guidence             -> guidance
+//   guidline             -> guideline
+//   guiness              -> Guinness
+//   gunanine             -> guanine
+//   gurantee             -> guarantee
+//   guttaral             -> guttural
+//   gutteral             -> guttural
+//   gya:                 -> gay
+//   habaeus              -> habeas
+//   habeus               -> habeas
+//   hadbeen              -> had been
+//   hadnt                -> hadn't
+//   haemorrage           -> haemorrhage
+//   halarious            -> hilarious
+//   hallowean            -> Halloween
+//   happend:             -> happened
+//   happended            -> happened
+//   happenned            -> happened
+//   harased              -> harassed
+//   harases              -> harasses
+//   harasment            -> harassment
+//   harassement          -> harassment
+//   harras:              -> harass
+//   harrased             -> harassed
+//   harrases             -> harasses
+//   harrasing            -> harassing
+//   harrasment           -> harassment
+//   harrassed            -> harassed
+//   harrasses            -> harassed
+//   harrassing           -> harassing
+//   harrassment          -> harassment
+//   hasbeen              -> has been
+//   hasnt                -> hasn't
+//   haveing              -> having
+//   haviest              -> heaviest
+//   hcance               -> chance
+//   hcange               -> change
+//   hda                  -> had
+//   healthercare         -> healthcare
+//   heared               -> heard
+//   heathy               -> healthy
+//   heigher              -> higher
+//   heigth               -> height
+//   heirarch             -> hierarch
+//   heiroglyphics        -> hieroglyphics
+//   helment              -> helmet
+//   helpfull:            -> helpful
+//   helpped              -> helped
+//   hemmorhage           -> hemorrhage
+//   herad                -> heard
+//   herat                -> heart
+//   heridity             -> heredity
+//   heroe:               -> hero
+//   heros:               -> heroes
+//   hertiage             -> heritage
+//   hertzs               -> hertz
+//   hesaid               -> he said
+//   hesistant            -> hesitant
+//   hesitaet             -> hesitate
+//   heterogenous         -> heterogeneous
+//   hewas                -> he was
+//   hieght               -> height
+//   hierachical          -> hierarchical
+//   hierachies           -> hierarchies
+//   hierachy             -> hierarchy
+//   hierarcical          -> hierarchical
+//   hierarcy             -> hierarchy
+//   hieroglph            -> hieroglyph
+//   higeine              -> hygiene
+//   higer                -> higher
+//   higest               -> highest
+//   higway               -> highway
+//   hillarious           -> hilarious
+//   himselv              -> himself
+//   hinderance           -> hindrance
+//   hinderence           -> hindrance
+//   hindrence            -> hindrance
+//   hipopotamus          -> hippopotamus
+//   hismelf              -> himself
+//   historicians         -> historians
+//   hitsingles           -> hit singles
+//   hiygeine             -> hygiene
+//   hlep                 -> help
+//   holf                 -> hold
+//   holliday             -> holiday
+//   homestate            -> home state
+//   homogeneize          -> homogenize
+//   honory               -> honorary
+//   horrifing            -> horrifying
+//   hosited              -> hoisted
+//   hospitible           -> hospitable
+//   hounour              -> honour
+//   housr                -> hours, house
+//   howerver             -> however
+//   howver               -> however
+//   hsa                  -> has
+//   hsitorians           -> historians
+//   hstory               -> history
+//   htere:               -> there
+//   htey:                -> they
+//   htikn                -> think
+//   htink                -> think
+//   htis:                -> this
+//   htp                  -> http
+//   httpl                -> http:
+//   httpsl               -> https:
+//   humer                -> humor
+//   huminoid             -> humanoid
+//   humoural             -> humoral
+//   humurous             -> humorous
+//   husban:              -> husband
+//   hvae:                -> have
+//   hvaing               -> having
+//   hvea:                -> have
+//   hwihc                -> which
+//   hwile                -> while
+//   hwole                -> whole
+//   hydogen              -> hydrogen
+//   hydropile            -> hydrophile
+//   hydropilic           -> hydrophilic
+//   hydropobe            -> hydrophobe
+//   hydropobic           -> hydrophobic
+//   hygeine              -> hygiene
+//   hygene               -> hygiene
+//   hygine               -> hygiene
+//   hyjack               -> hijack
+//   hypocracy            -> hypocrisy
+//   hypocrasy            -> hypocrisy
+//   hypocricy            -> hypocrisy
+//   hypocrit:            -> hypocrite
+//   hypocrits            -> hypocrites
+//   iamge                -> image
+//   iconclastic          -> iconoclastic
+//   idaeidae             -> idea
+//   idaes                -> ideas
+//   idealogies           -> ideologies
+//   idealogy             -> ideology
+//   identicial           -> identical
+//   identifers           -> identifiers
+//   identifiy            -> identify
+//   identofy             -> identify
+//   ideosyncratic        -> idiosyncratic
+//   idesa                -> ideas, ides
+//   idiosyncracy         -> idiosyncrasy
+//   ignorence            -> ignorance
+//   illution             -> illusion
+//   ilness               -> illness
+//   imagenary            -> imaginary
+//   imagin:              -> imagine
+//   imaginery            -> imaginary
+//   imanent              -> eminent, imminent
+//   imcomplete           -> incomplete
+//   imediate             -> immediate
+//   imediatly            -> immediately
+//   imense               -> immense
+//   imigrant             -> emigrant, immigrant
+//   imigrated            -> emigrated, immigrated
+//   imigration           -> emigration, immigration
+//   iminent              -> eminent, imminent, immanent
+//   immediatley          -> immediately
+//   immediatly           -> immediately
+//   immidately           -> immediately
+//   immidiately          -> immediately
+//   immitate             -> imitate
+//   immitating           -> imitating
+//   immitator            -> imitator
+//   impecabbly           -> impeccably
+//   impedence            -> impedance
+//   impilies             -> implies
+//   implamenting         -> implementing
+//   implemenation        -> implementation
+//   impliment            -> implement
+//   imploys              -> employs
+//   importamt            -> important
+//   importent            -> important
+//   importnat            -> important
+//   impressario          -> impresario
+//   imprioned            -> imprisoned
+//   imprisonned          -> imprisoned
+//   improvemnt           -> improvement
+//   improvision          -> improvisation
+//   improvment           -> improvement
+//   inablility           -> inability
+//   inadiquate           -> inadequate
+//   inadquate            -> inadequate
+//   inadvertant          -> inadvertent
+//   inagurated           -> inaugurated
+//   inaguration          -> inauguration
+//   inaugures            -> inaugurates
+//   inbalance            -> imbalance
+//   inbetween            -> between
+//   incarcirated         -> incarcerated
+//   incidentially        -> incidentally
+//   incidently           -> incidentally
+//   inclreased           -> increased
+//   includ:              -> include
+//   includng             -> including
+//   inclued              -> include
+//   incomptable          -> incompatible
+//   incomptetent         -> incompetent
+//   incoroporated        -> incorporated
+//   incorportaed         -> incorporated
+//   incorprates          -> incorporates
+//   incramentally        -> incrementally
+//   increadible          -> incredible
+//   incredable           -> incredible
+//   inctroduce           -> introduce
+//   incuding             -> including
+//   incunabla            -> incunabula
+//   indecate             -> indicate
+//   indeces              -> indices
+//   indecies             -> indices
+//   indefineable         -> undefinable
+//   indentical           -> identical
+//   indepedantly         -> independently
+//   indespensable        -> indispensable
+//   indespensible        -> indispensable
+//   indicies             -> indices
+//   indictement          -> indictment
+//   indigineous          -> indigenous
+//   indipendence         -> independence
+//   indipendent          -> independent
+//   indispensible        -> indispensable
+//   indisputible         -> indisputable
+//   indisputibly         -> indisputably
+//   indite               -> indict
+//   individualy          -> individually
+//   indpendent           -> independent
+//   indulgue             -> indulge
+//   indutrial            -> industrial
+//   indviduals           -> individuals
+//   inefficienty         -> inefficiently
+//   inevatible           -> inevitable
+//   inevitible           -> inevitable
+//   inevititably         -> inevitably
+//   infalability         -> infallibility
+//   infallable           -> infallible
+//   infectuous           -> infectious
+//   infered              -> inferred
+//   infilitrate          -> infiltrate
+//   infilitration        -> infiltration
+//   inflamation          -> inflammation
+//   influance            -> influence
+//   influencial          -> influential
+//   influented           -> influenced
+//   infomation           -> information
+//   informatoin          -> information
+//   informtion           -> information
+//   infrantryman         -> infantryman
+//   infrigement          -> infringement
+//   infront              -> in front
+//   ingenius             -> ingenious
+//   ingreediants         -> ingredients
+//   inhabitans           -> inhabitants
+//   inherantly           -> inherently
+//   inheritage           -> inheritance
+//   inheritence          -> inheritance
+//   inital               -> initial
+//   initation            -> initiation
+//   initiaitive          -> initiative
+//   inlcuding            -> including
+//   inmigrant            -> immigrant
+//   innoculated          -> inoculated
+//   inocence             -> innocence
+//   inofficial           -> unofficial
+//   inpeach              -> impeach
+//   inpending            -> impending
+//   inpenetrable         -> impenetrable
+//   inpolite             -> impolite
+//   inprisonment         -> imprisonment
+//   inproving            -> improving
+//   insectiverous        -> insectivorous
+//   insensative          -> insensitive
+//   inseperable          -> inseparable
+//   insistance           -> insistence
+//   insitution           -> institution
+//   inspite              -> in spite
+//   instade              -> instead
+//   instaleld            -> installed
+//   instatance           -> instance
+//   insted               -> instead
+//   institue             -> institute
+//   instuction           -> instruction
+//   instuments           -> instruments
+//   instutionalized      -> institutionalized
+//   instutions           -> institutions
+//   insurence            -> insurance
+//   intelectual          -> intellectual
+//   inteligence          -> intelligence
+//   inteligent           -> intelligent
+//   intelligance         -> intelligence
+//   intenational         -> international
+//   intented             -> intended, indented
+//   intepretation        -> interpretation
+//   intepretator         -> interpretor
+//   interational         -> international
+//   interator            -> iterator
+//   interbread           -> interbreed, interbred
+//   interchangably       -> interchangeably
+//   intercontinetal      -> intercontinental
+//   intered              -> interred, interned
+//   interelated          -> interrelated
+//   interferance         -> interference
+//   interfereing         -> interfering
+//   intergrated          -> integrated
+//   intergration         -> integration
+//   interm:              -> interim
+//   internation:         -> international
+//   interpet             -> interpret
+//   interrim             -> interim
+//   interrugum           -> interregnum
+//   intertaining         -> entertaining
+//   interum              -> interim
+//   interupt             -> interrupt
+//   intervines           -> intervenes
+//   intevene             -> intervene
+//   inthe                -> in the
+//   intial               -> initial
+//   intput               -> input
+//   intrduced            -> introduced
+//   intrest              -> interest
+//   introdued            -> introduced
+//   intruduced           -> introduced
+//   intrument            -> instrument
+//   intrusted            -> entrusted
+//   inturn               -> in turn
+//   intutive             -> intuitive
+//   inudstry             -> industry
+//   inumerable           -> innumerable
+//   inventer             -> inventor
+//   invertibrates        -> invertebrates
+//   investingate         -> investigate
+//   invitaion            -> invitation
+//   invliad              -> invalid
+//   involvment           -> involvement
+//   invstigate           -> investigate
+//   inwhich              -> in which
+//   iresistable          -> irresistible
+//   iresistably          -> irresistibly
+//   iresistible          -> irresistible
+//   iresistibly          -> irresistibly
+//   iritable             -> irritable
+//   iritated             -> irritated
+//   ironicly             -> ironically
+//   irregardless         -> regardless
+//   irreplacable         -> irreplaceable
+//   irresistable         -> irresistible
+//   irresistably         -> irresistibly
+//   issueing             -> issuing
+//   isthe                -> is the
+//   ititial              -> initial
+//   itnerest             -> interest
+//   itnroduced           -> introduced
+//   iunior               -> junior
+//   ivestigate           -> investigate
+//   ivestigative         -> investigative
+//   janurary             -> January
+//   januray              -> January
+//   japanes:             -> Japanese
+//   jeapardy             -> jeopardy
+//   jewllery             -> jewellery
+//   jorunal              -> journal
+//   jospeh               -> Joseph
+//   jouney               -> journey
+//   journied             -> journeyed
+//   journies             -> journeys
+//   jstu                 -> just
+//   jsut                 -> just
+//   judical              -> judicial
+//   judisuary            -> judiciary
+//   juducial             -> judicial
+//   jugment              -> judgement
+//   juristiction         -> jurisdiction
+//   kindergarden         -> kindergarten
+//   klenex               -> kleenex
+//   knifes:              -> knives
+//   knive:               -> knife
+//   knowldge             -> knowledge
+//   knowlege             -> knowledge
+//   knwo:                -> know
+//   knwon:               -> known
+//   knwos                -> knows
+//   konw:                -> know
+//   konwn:               -> known
+//   konws                -> knows
+//   kwno:                -> know
+//   kwnon:               -> known
+//   labatory             -> laboratory
+//   labled               -> labeled
+//   labratory            -> laboratory
+//   laeve                -> leave
+//   laguage              -> language
+//   languange            -> language
+//   laparascopic         -> laparoscopic
+//   larg:                -> large
+//   largst               -> largest
+//   larrry               -> larry
+//   lastyear             -> last year
+//   lattitude            -> latitude
+//   launchs              -> launches
+//   launhed              -> launched
+//   lavae                -> larvae
+//   lazyness             -> laziness
+//   lciense              -> license
+//   leanr                -> learn
+//   learnign             -> learning
+//   leathal              -> lethal
+//   lebsian              -> lesbian
+//   legimacy             -> legitimacy
+//   legitamate           -> legitimate
+//   legitmate            -> legitimate
+//   leibnitz             -> leibniz
+//   lenght               -> length
+//   lerans               -> learns
+//   lesbain              -> lesbian
+//   lesban               -> lesbian
+//   lesbina              -> lesbian
+//   leutenant            -> lieutenant
+//   leval                -> level
+//   levetate             -> levitate
+//   levetating           -> levitating
+//   levle                -> level
+//   liasion              -> liaison
+//   liason               -> liaison
+//   libary               -> library
+//   libell               -> libel
+//   libguistic           -> linguistic
+//   libitarianisn        -> libertarianism
+//   librarry             -> library
+//   librery              -> library
+//   liegal               -> legal
+//   lieing               -> lying
+//   liek                 -> like
+//   liesure              -> leisure
+//   lieuenant            -> lieutenant
+//   lieutenent           -> lieutenant
+//   liftime              -> lifetime
+//   lightyear            -> light year
+//   likelyhood           -> likelihood
+//   likly                -> likely
+//   linnaena             -> linnaean
+//   lippizaner           -> lipizzaner
+//   liquify              -> liquefy
+//   liscense             -> license
+//   lisence              -> license
+//   listner              -> listener
+//   litature             -> literature
+//   literaly             -> literally
+//   literture            -> literature
+//   littel               -> little
+//   litterally           -> literally
+//   liuke                -> like
+//   livley               -> lively
+//   lmits                -> limits
+//   lonelyness           -> loneliness
+//   longitudonal         -> longitudinal
+//   lonley               -> lonely
+//   lonly                -> lonely
+//   loonig               -> looking
+//   looses:              -> loses
+//   loosing              -> losing
+//   looup                -> lookup
+//   lotharingen          -> lothringen
+//   lukid                -> likud
+//   maching              -> machine, marching, matching
+//   mackeral             -> mackerel
+//   macthing             -> matching
+//   magasine             -> magazine
+//   magincian            -> magician
+//   magisine             -> magazine
+//   magizine             -> magazine
+//   magnificient         -> magnificent
+//   magolia              -> magnolia
+//   mailny               -> mainly
+//   maintainance         -> maintenance
+//   maintainence         -> maintenance
+//   maintance            -> maintenance
+//   maintence            -> maintenance
+//   maintenence          -> maintenance
+//   maintinaing          -> maintaining
+//   maintioned           -> mentioned
+//   maintnance           -> maintenance
+//   majoroty             -> majority
+//   maked                -> marked, made
+//   makeing              -> making
+//   makse                -> makes
+//   mamal                -> mammal
+//   managable            -> manageable
+//   managment            -> management
+//   manefist             -> manifest
+//   maneouvre            -> manoeuvre
+//   maneouvring          -> manoeuvring
+//   manisfestations      -> manifestations
+//   manoeuverability     -> maneuverability
+//   mantain              -> maintain
+//   manuever             -> maneuver
+//   manufacturedd        -> manufactured
+//   manufature           -> manufacture
+//   manufaturing         -> manufacturing
+//   manuver              -> maneuver
+//   mariage              -> marriage
+//   marjority            -> majority
+//   markes               -> marks
+//   marketting           -> marketing
+//   marmelade            -> marmalade
+//   marrage              -> marriage
+//   marraige             -> marriage
+//   marrtyred            -> martyred
+//   marryied             -> married
+//   massmedia            -> mass media
+//   masterbation         -> masturbation
+//   mataphysical         -> metaphysical
+//   materalists          -> materialist
+//   mathamatics          -> mathematics
+//   mathematican         -> mathematician
+//   mathematicas         -> mathematics
+//   matheticians         -> mathematicians
+//   mathmatically        -> mathematically
+//   mathmatician         -> mathematician
+//   mccarthyst           -> mccarthyist
+//   mchanics             -> mechanics
+//   mcuh                 -> much
+//   meaing               -> meaning
+//   meaninng             -> meaning
+//   mear                 -> wear, mere, mare
+//   mechandise           -> merchandise
+//   medacine             -> medicine
+//   medeival             -> medieval
+//   medevial             -> medieval
+//   mediciney            -> mediciny
+//   medievel             -> medieval
+//   meerkrat             -> meerkat
+//   melieux              -> milieux
+//   membranaphone        -> membranophone
+//   memeber              -> member
+//   meranda              -> veranda, Miranda
+//   mercentile           -> mercantile
+//   merchent             -> merchant
+//   mereg                -> merge
+//   mesage               -> message
+//   messanger            -> messenger
+//   messenging           -> messaging
+//   metalic              -> metallic
+//   metalurgic           -> metallurgic
+//   metalurgy            -> metallurgy
+//   metamorphysis        -> metamorphosis
+//   metaphoricial        -> metaphorical
+//   meterologist         -> meteorologist
+//   meterology           -> meteorology
+//   methaphor            -> metaphor
+//   micoscopy            -> microscopy
+//   midwifes             -> midwives
+//   mileau               -> milieu
+//   milennia             -> millennia
+//   milennium            -> millennium
+//   mileu                -> milieu
+//   miliary              -> military
+//   miligram             -> milligram
+//   miliraty             -> military
+//   millenia             -> millennia
+//   millenium            -> millennium
+//   millepede            -> millipede
+//   millioniare          -> millionaire
+//   millitant            -> militant
+//   millitary            -> military
+//   millon               -> million
+//   miltary              -> military
+//   minature             -> miniature
+//   minerial             -> mineral
+//   ministery            -> ministry
+//   minsitry             -> ministry
+//   minstries            -> ministries
+//   minstry              -> ministry
+//   minumum              -> minimum
+//   mirrorred            -> mirrored
+//   miscelaneous         -> miscellaneous
+//   miscellanious        -> miscellaneous
+//   miscellanous         -> miscellaneous
+//   mischeivous          -> mischievous
+//   mischevious          -> mischievous
+//   mischievious         -> mischievous
+//   misdameanor          -> misdemeanor
+//   misfourtunes         -> misfortunes
+//   misile               -> missile
+//   mispell              -> misspell
+//   missen               -> mizzen
+//   missle               -> missile
+//   missonary            -> missionary
+//   misterious           -> mysterious
+//   mistery:             -> mystery
+//   misteryous           -> mysterious
+//   misterys:            -> mysteries
+//   mkae                 -> make
+//   mkaing               -> making
+//   mkea                 -> make
+//   moderm               -> modem
+//   modle                -> model
+//   moent                -> moment
+//   moeny                -> money
+//   mohammedans          -> muslims
+//   moleclues            -> molecules
+//   momento:             -> memento
+//   momentraily          -> momentarily
+//   monestaries          -> monasteries
+//   monestary            -> monastery, monetary
+//   monickers            -> monikers
+//   monolite             -> monolithic
+//   montains             -> mountains
+//   montanous            -> mountainous
+//   monts                -> months
+//   montypic             -> monotypic
+//   moreso               -> more, more so
+//   morgage              -> mortgage
+//   morroccan            -> moroccan
+//   morrocco             -> morocco
+//   morroco              -> morocco
+//   mortage              -> mortgage
+//   mosture              -> moisture
+//   motiviated           -> motivated
+//   mots                 -> most
+//   mounth               -> month
+//   movei                -> movie
+//   movment              -> movement
+//   mroe                 -> more
+//   mucuous              -> mucous
+//   muder                -> murder
+//   muhammadan           -> muslim
+//   multicultralism      -> multiculturalism
+//   multipled            -> multiplied
+//   multiplers           -> multipliers
+//   munber               -> number
+//   muncipalities        -> municipalities
+//   muncipality          -> municipality
+//   munnicipality        -> municipality
+//   muscels              -> mussels, muscles
+//   muscial              -> musical
+//   muscician            -> musician
+//   mutiliated           -> mutilated
+//   myraid               -> myriad
+//   mysef                -> myself
+//   mysogynist           -> misogynist
+//   mysogyny             -> misogyny
+//   mysterous            -> mysterious
+//   naieve               -> naive
+//   namesapce            -> namespace
+//   namespcae            -> namespace
+//   naturaly             -> naturally
+//   naturely             -> naturally
+//   naturual             -> natural
+//   necassarily          -> necessarily
+//   necassary            -> necessary
+//   neccesarily          -> necessarily
+//   neccesary            -> necessary
+//   neccessarily         -> necessarily
+//   neccessary           -> necessary
+//   neccessities         -> necessities
+//   necesarily           -> necessarily
+//   necesary             -> necessary
+//   necessery            -> necessary
+//   necessiate           -> necessitate
+//   neglible             -> negligible
+//   negligable           -> negligible
+//   negociate            -> negotiate
+//   negociation          -> negotiation
+//   negotation           -> negotiation
+//   negotiaing           -> negotiating
+//   neice                -> niece
+//   neigborhood          -> neighborhood
+//   neigbour             -> neighbor
+//   neolitic             -> neolithic
+//   nessasarily          -> necessarily
+//   nessecary            -> necessary
+//   nestin:              -> nesting
+//   neverthless          -> nevertheless
+//   newletters           -> newsletters
+//   ngiht                -> night
+//   niave                -> naive
+//   nickle               -> nickel
+//   nieghbor             -> neighour
+//   nieve                -> naive
+//   nightime             -> nighttime
+//   nihgt                -> night
+//   nineth               -> ninth
+//   ninteenth            -> nineteenth
+//   ninties              -> 1990s
+//   ninty                -> ninety
+//   nkow                 -> know
+//   nkwo                 -> know
+//   nmae                 -> name
+//   noncombatents        -> noncombatants
+//   nonsence             -> nonsense
+//   nontheless           -> nonetheless
+//   noone                -> no one
+//   norhern              -> northern
+//   northen              -> northern
+//   northereastern       -> northeastern
+//   notabley             -> notably
+//   noteable             -> notable
+//   noteably             -> notably
+//   noteriety            -> notoriety
+//   noth:                -> north
+//   noticable            -> noticeable
+//   noticably            -> noticeably
+//   noticeing            -> noticing
+//   noticible            -> noticeable
+//   noveau               -> nouveau
+//   novermber            -> November
+//   nowdays              -> nowadays
+//   nowe                 -> now
+//   nucular              -> nuclear
+//   nuculear             -> nuclear
+//   nuisanse             -> nuisance
+//   nulltpr              -> nullptr
+//   numberous            -> numerous
+//   nuremburg            -> Nuremberg
+//   nusance              -> nuisance
+//   nutritent            -> nutrient
+//   nuturing             -> nurturing
+//   oaky                 -> okay
+//   obession             -> obsession
+//   obssessed            -> obsessed
+//   obstacal             -> obstacle
+//   obstancles           -> obstacles
+//   obstruced            -> obstructed
+//   ocasion:             -> occasion
+//   ocasional:           -> occasional
+//   ocasionally          -> occasionally
+//   ocasionaly           -> occasionally
+//   ocasioned            -> occasioned
+//   ocasions             -> occasions
+//   ocassion:            -> occasion
+//   ocassional:          -> occasional
+//   ocassionally         -> occasionally
+//   ocassionaly          -> occasionally
+//   ocassioned           -> occasioned
+//   ocassions            -> occasions
+//   occaison             -> occasion
+//   occassion:           -> occasion
+//   occassional:         -> occasional
+//   occassionally        -> occasionally
+//   occassionaly         -> occasionally
+//   occassioned          -> occasioned
+//   occassions           -> occasions
+//   occationally         -> occasionally
+//   occour               -> occur
+//   occurance            -> occurrence
+//   occured              -> occurred
+//   occurence            -> occurrence
+//   occuring             -> occurring
+//   occurr:              -> occur
+//   occurrance           -> occurrence
+//   octohedra            -> octahedra
+//   octohedron           -> octahedron
+//   ocuntries            -> countries
+//   ocurr:               -> occur
+//   ocurrance            -> occurrence
+//   ocurred              -> occurred
+//   ocurrence            -> occurrence
+//   offcer               -> officer
+//   offcially            -> officially
+//   offereing            -> offering
+//   offical:             -> official
+//   offically            -> officially
+//   officals             -> officials
+//   officaly             -> officially
+//   officialy            -> officially
+//   offred               -> offered
+//   oftenly              -> often
+//   oging                -> going
+//   omision              -> omission
+//   omited               -> omitted
+//   omiting              -> omitting
+//   omlette              -> omelette
+//   omniverous           -> omnivorous
+//   omre                 -> more
+//   openess              -> openness
+//   operaotr             -> operator
+//   operaror             -> operator
+//   oportunity           -> opportunity
+//   oposite              -> opposite
+//   oppasite             -> opposite
+//   oppenly              -> openly
+//   opperation           -> operation
+//   oppertunity          -> opertunity
+//   oppinion             -> opinion
+//   opponant             -> opponent
+//   oppononent           -> opponent
+//   opposate             -> opposite
+//   opposit:             -> opposite
+//   oppositition         -> opposition
+//   oppossed             -> opposed
+//   oppotunities         -> opportunities
+//   oppotunity           -> opportunity
+//   opprotunity          -> opportunity
+//   opression            -> oppression
+//   opressive            -> oppressive
+//   opthalmic            -> ophthalmic
+//   opthalmologist       -> ophthalmologist
+//   opthalmology         -> ophthalmology
+//   opthamologist        -> ophthalmologist
+//   optmizations         -> optimizations
+//   optomism             -> optimism
+//   orgainization        -> organization
+//   organim              -> organism
+//   organistion          -> organisation
+//   organiztion          -> organization
+//   orgin:               -> origin, organ
+//   orginal              -> original
+//   orginization         -> organization
+//   orginize             -> organise
+//   oridinarily          -> ordinarily
+//   origanaly            -> originally
+//   originall:           -> originally
+//   originaly            -> originally
+//   originial            -> original
+//   originnally          -> originally
+//   origional            -> original
+//   orignal              -> original
+//   orignially           -> originally
+//   otherwordly          -> otherworldly
+//   oublisher            -> publisher
+//   ouevre               -> oeuvre
+//   ouptut               -> output
+//   ouput                -> output
+//   oustanding           -> outstanding
+//   outragous            -> outrageous
+//   overide              -> override
+//   overshaddowed        -> overshadowed
+//   overthe              -> over the
+//   overwelming          -> overwhelming
+//   overwheliming        -> overwhelming
+//   ovveride             -> override
+//   owudl                -> would
+//   owuld                -> would
+//   oxident              -> oxidant
+//   oxigen               -> oxygen
+//   oximoron             -> oxymoron
+//   paide                -> paid
+//   paitience            -> patience
+//   palce                -> place, palace
+//   paleolitic           -> paleolithic
+//   paliamentarian       -> parliamentarian
+//   palistian            -> Palestinian
+//   palistinian          -> Palestinian
+//   pallete              -> palette
+//   pamflet              -> pamphlet
+//   pamplet              -> pamphlet
+//   pantomine            -> pantomime
+//   papaer               -> paper
+//   paralel:             -> parallel
+//   paralell:            -> parallel
+//   paralelly            -> parallelly
+//   paralely             -> parallelly
+//   parallely            -> parallelly
+//   paranthesis          -> parenthesis
+//   paraphenalia         -> paraphernalia
+//   parellels            -> parallels
+//   parisitic            -> parasitic
+//   parituclar           -> particular
+//   parliment            -> parliament
+//   parrakeets           -> parakeets
+//   parralel             -> parallel
+//   parrallel:           -> parallel
+//   parrallell:          -> parallel
+//   parrallelly          -> parallelly
+//   parrallely           -> parallelly
+//   partialy             -> partially
+//   particually          -> particularly
+//   particualr           -> particular
+//   particuarly          -> particularly
+//   particularily        -> particularly
+//   particulary          -> particularly
+//   partof               -> part of
+//   pary                 -> party
+//   pasenger             -> passenger
+//   passerbys            -> passersby
+//   pasttime             -> pastime
+//   pastural             -> pastoral
+//   paticular            -> particular
+//   pattented            -> patented
+//   patturn              -> pattern
+//   paturn               -> pattern
+//   pavillion            -> pavilion
+//   payed                -> paid
+//   paymetn              -> payment
+//   pblisher             -> publisher
+//   pbulisher            -> publisher
+//   pciture              -> picture
+//   peacefuland          -> peaceful and
+//   peageant             -> pageant
+//   peaple               -> people
+//   peculure             -> peculiar
+//   pedestrain           -> pedestrian
+//   peformed             -> performed
+//   penatly              -> penalty
+//   penerator            -> penetrator
+//   penisula             -> peninsula
+//   penninsula           -> peninsula
+//   pennisula            -> peninsula
+//   pensinula            -> peninsula
+//   pensle               -> pencil
+//   peolpe               -> people
+//   peopel               -> people
+//   peotry               -> poetry
+//   perade               -> parade
+//   percentof            -> percent of
+//   percentto            -> percent to
+//   percepted            -> perceived
+//   percieve             -> perceive
+//   pereguine            -> peregrine
+//   perenially           -> perennially
+//   peretrator           -> perpetrator
+//   perfomance           -> performance
+//   perfomer             -> performer
+//   performence          -> performance
+//   performes            -> performed, performs
+//   perhasp              -> perhaps
+//   perheaps             -> perhaps
+//   perhpas              -> perhaps
+//   peripathetic         -> peripatetic
+//   peristent            -> persistent
+//   perjery              -> perjury
+//   perjorative          -> pejorative
+//   permanant            -> permanent
+//   permenant            -> permanent
+//   perminent            -> permanent
+//   permissable          -> permissible
+//   perogative           -> prerogative
+//   peronal              -> personal
+//   perosnality          -> personality
+//   perpertrate          -> perpetrate
+//   perphas              -> perhaps
+//   perpindicular        -> perpendicular
+//   perscription         -> prescription
+//   perseverence         -> perseverance
+//   persistance          -> persistence
+//   persistant           -> persistent
+//   personalyl           -> personally
+//   personel:            -> personnel
+//   personell            -> personnel
+//   personnell           -> personnel
+//   persuded             -> persuaded
+//   persue               -> pursue
+//   persuing             -> pursuing
+//   persuit              -> pursuit
+//   pertubation          -> perturbation
+//   pessiary             -> pessary
+//   petetion             -> petition
+//   pharoah              -> Pharaoh
+//   phenomenom           -> phenomenon
+//   phenomenonal         -> phenomenal
+//   phenomenonly         -> phenomenally
+//   phenomonenon         -> phenomenon
+//   phenomonon           -> phenomenon
+//   phenonmena           -> phenomena
+//   philisopher          -> philosopher
+//   philisophical        -> philosophical
+//   philisophy           -> philosophy
+//   phillosophically     -> philosophically
+//   philospher           -> philosopher
+//   philosphies          -> philosophies
+//   philosphy            -> philosophy
+//   phonecian            -> Phoenecian
+//   phongraph            -> phonograph
+//   phylosophical        -> philosophical
+//   physicaly            -> physically
+//   piblisher            -> publisher
+//   pilgrimmage          -> pilgrimage
+//   pinapple             -> pineapple
+//   pinnaple             -> pineapple
+//   pinoneer             -> pioneer
+//   plaesant             -> pleasant
+//   plagarism            -> plagiarism
+//   plagerize            -> plagiarize
+//   planation            -> plantation
+//   planed               -> planned
+//   plantiff             -> plaintiff
+//   plateu               -> plateau
+//   plausable            -> plausible
+//   playright            -> playwright
+//   playwrite            -> playwright
+//   pleasent             -> pleasant
+//   plebicite            -> plebiscite
+//   plesant              -> pleasant
+//   poenis               -> penis
+//   poeople              -> people
+//   poeple               -> people
+//   poety                -> poetry
+//   poisin               -> poison
+//   poitner              -> pointer
+//   polical              -> political
+//   polinator            -> pollinator
+//   politican            -> politician
+//   poltical             -> political
+//   polute               -> pollute
+//   poluting             -> polluting
+//   polution             -> pollution
+//   polyphonyic          -> polyphonic
+//   polysaccaride        -> polysaccharide
+//   polysaccharid:       -> polysaccharide
+//   pomegranite          -> pomegranate
+//   pomotion             -> promotion
+//   poportional          -> proportional
+//   popoulation          -> population
+//   popularaty           -> popularity
+//   populare             -> popular
+//   populer              -> popular
+//   porblem              -> problem
+//   porshan              -> portion
+//   porshon              -> portion
+//   portait              -> portrait
+//   portayed             -> portrayed
+//   portraing            -> portraying
+//   portugese            -> Portuguese
+//   portuguease          -> portuguese
+//   portugues            -> Portuguese
+//   porvide              -> provide
+//   posess               -> possess
+//   posion               -> poison
+//   positon              -> position
+//   possable             -> possible
+//   possably             -> possibly
+//   posseses             -> possesses
+//   possesing            -> possessing
+//   possesion            -> possession
+//   possessess           -> possesses
+//   possibile            -> possible
+//   possibilty           -> possibility
+//   possiblility         -> possibility
+//   possiblilty          -> possibility
+//   possiblities         -> possibilities
+//   possiblity           -> possibility
+//   possition            -> position
+//   posthomous           -> posthumous
+//   postion              -> position
+//   postition            -> position
+//   postive              -> positive
+//   potatos              -> potatoes
+//   potentialy           -> potentially
+//   potrait              -> portrait
+//   potray               -> portray
+//   poulations           -> populations
+//   poverful             -> powerful
+//   poweful              -> powerful
+//   powerfull            -> powerful
+//   ppublisher           -> publisher
+//   practial             -> practical
+//   practicaly           -> practically
+//   practicioner         -> practitioner
+//   practicly            -> practically
+//   practioner           -> practitioner
+//   prairy               -> prairie
+//   pramga:              -> pragma
+//   prarie               -> prairie
+//   pratice              -> practice
+//   preample             -> preamble
+//   precedessor          -> predecessor
+//   preceed:             -> precede
+//   preceeds             -> precedes
+//   precentage           -> percentage
+//   precice              -> precise
+//   precisly             -> precisely
+//   precurser            -> precursor
+//   predecesor           -> predecessor
+//   predicatble          -> predictable
+//   predicitons          -> predictions
+//   predomiantly         -> predominately
+//   preferrably          -> preferably
+//   prefure              -> prefer
+//   pregancies           -> pregnancies
+//   pregnent             -> pregnant
+//   preiod               -> period
+//   prelease             -> release
+//   preliferation        -> proliferation
+//   premeire             -> premiere
+//   preminence           -> preeminence
+//   premission           -> permission
+//   preocupation         -> preoccupation
+//   prepair              -> prepare
+//   prepartion           -> preparation
+//   prepatory            -> preparatory
+//   preperation          -> preparation
+//   preriod              -> period
+//   presance             -> presence
+//   presedential         -> presidential
+//   presense             -> presence
+//   presidenital         -> presidential
+//   presitgious          -> prestigious
+//   prespective          -> perspective
+//   prestigeous          -> prestigious
+//   prestigous           -> prestigious
+//   prestine             -> pristine
+//   presumabely          -> presumably
+//   presumibly           -> presumably
+//   pretection           -> protection
+//   prevelant            -> prevalent
+//   preverse             -> perverse
+//   previos              -> previous
+//   previus              -> previous
+//   previvous            -> previous
+//   pricipal             -> principal
+//   priciple             -> principle
+//   priestood            -> priesthood
+//   primarly             -> primarily
+//   primative            -> primitive
+//   primordal            -> primordial
+//   principaly           -> principality
+//   principial           -> principal
+//   principlaity         -> principality
+//   principly            -> principally
+//   prinicipal           -> principal
+//   privalege            -> privilege
+//   priveledges          -> privileges
+//   privelege            -> privilege
+//   privelige            -> privilege
+//   privelleges          -> privileges
+//   privilage            -> privilege
+//   priviledge           -> privilege
+//   privledge            -> privilege
+//   privlege             -> privilege
+//   privte               -> private
+//   probabilaty          -> probability
+//   probablistic         -> probabilistic
+//   probablly            -> probably
+//   probalibity          -> probability
+//   probaly              -> probably
+//   probelm              -> problem
+//   problesm             -> problems
+//   proccess             -> process
+//   procede              -> proceed, precede
+//   procedger            -> procedure
+//   proceding            -> proceeding
+//   proceedure           -> procedure
+//   proces:              -> process
+//   processer            -> processor
+//   proclaimation        -> proclamation
+//   proclamed            -> proclaimed
+//   proclaming           -> proclaiming
+//   proclomation         -> proclamation
+//   proctetion           -> protection
+//   proeprty             -> property
+//   profesion            -> profusion, profession
+//   profesor             -> professor
+//   professer            -> professor
+//   profet               -> profit
+//   proffesed            -> professed
+//   proffesion           -> profession
+//   proffesor            -> professor
+//   proffession          -> profession
+//   proffessor           -> professor
+//   profilic             -> prolific
+//   progessed            -> progressed
+//   progidy              -> prodigy
+//   programable          -> programmable
+//   progrom              -> pogrom, program
+//   prohabition          -> prohibition
+//   prologomena          -> prolegomena
+//   prominance           -> prominence
+//   prominant            -> prominent
+//   prominately          -> prominently
+//   promiscous           -> promiscuous
+//   promotted            -> promoted
+//   pronomial            -> pronominal
+//   pronouced            -> pronounced
+//   pronounched          -> pronounced
+//   pronounciation       -> pronunciation
+//   proove               -> prove
+//   propery              -> property
+//   prophacy             -> prophecy
+//   propietary           -> proprietary
+//   propmted             -> prompted
+//   propoganda           -> propaganda
+//   propogate            -> propagate
+//   propogation          -> propagation
+//   propotions           -> proportions
+//   propper              -> proper
+//   proprietory          -> proprietary
+//   proseletyzing        -> proselytizing
+//   protaganist          -> protagonist
+//   protction            -> protection
+//   protocal             -> protocol
+//   protoganist          -> protagonist
+//   protoge              -> protege
+//   protrayed            -> portrayed
+//   protruberance        -> protuberance
+//   prouncements         -> pronouncements
+//   provacative          -> provocative
+//   provded              -> provided
+//   provicial            -> provincial
+//   provinicial          -> provincial
+//   provisiosn           -> provision
+//   provisonal           -> provisional
+//   proximty             -> proximity
+//   pseudononymous       -> pseudonymous
+//   pseudonyn            -> pseudonym
+//   psoition             -> position
+//   psuedo               -> pseudo
+//   psycology            -> psychology
+//   psyhic               -> psychic
+//   ptogress             -> progress
+//   pubilsher            -> publisher
+//   pubisher             -> publisher
+//   publiaher            -> publisher
+//   publically           -> publicly
+//   publicaly            -> publicly
+//   publicher            -> publisher
+//   publihser            -> publisher
+//   publisehr            -> publisher
+//   publiser             -> publisher
+//   publisger            -> publisher
+//   publisheed           -> published
+//   publisherr           -> publisher
+//   publishher           -> publisher
+//   publishor            -> publisher
+//   publishre            -> publisher
+//   publissher           -> publisher
+//   publlisher           -> publisher
+//   publsiher            -> publisher
+//   publusher            -> publisher
+//   puchasing            -> purchasing
+//   pulisher             -> publisher
+//   pumkin               -> pumpkin
+//   puplisher            -> publisher
+//   puritannical         -> puritanical
+//   purposedly           -> purposely
+//   purpotedly           -> purportedly
+//   pursuade             -> persuade
+//   pususading           -> persuading
+//   pwoer                -> power
+//   pyscic               -> psychic
+//   qtuie                -> quite, quiet
+//   quantaty             -> quantity
+//   quantitiy            -> quantity
+//   quarantaine          -> quarantine
+//   quarentine           -> quarantine
+//   quarer               -> quarter
+//   quater               -> quarter
+//   quesion              -> question
+//   questin:             -> question
+//   questino             -> question
+//   questiom             -> question
+//   questiosn            -> questions
+//   questoin             -> question
+//   queston              -> question
+//   quetion              -> question
+//   quicklyu             -> quickly
+//   quinessential        -> quintessential
+//   quizes               -> quizzes
+//   qutie                -> quite, quiet
+//   rabinnical           -> rabbinical
+//   racaus               -> raucous
+//   radiactive           -> radioactive
+//   radify               -> ratify
+//   raedy                -> ready
+//   raelly               -> really
+//   raidus               -> radius
+//   rarified             -> rarefied
+//   reaccurring          -> recurring
+//   reacing              -> reaching
+//   reacll               -> recall
+//   readmition           -> readmission
+//   realitvely           -> relatively
+//   realsitic            -> realistic
+//   realtion             -> relation
+//   realy:               -> really
+//   realyl               -> really
+//   reasearch            -> research
+//   reayd                -> ready
+//   rebiulding           -> rebuilding
+//   rebllions            -> rebellions
+//   rebounce             -> rebound
+//   reccomend            -> recommend
+//   reccommend           -> recommend
+//   reccuring            -> recurring
+//   receeded             -> receded
+//   receeding            -> receding
+//   receiev              -> receiv
+//   receivedfrom         -> received from
+//   recepient            -> recipient
+//   receving             -> receiving
+//   rechargable          -> rechargeable
+//   reched               -> reached
+//   reciding             -> residing
+//   reciepents           -> recipients
+//   reciept              -> receipt
+//   reciev               -> receiv
+//   recipiant            -> recipient
+//   recived              -> received
+//   recivership          -> receivership
+//   recogise             -> recognise
+//   recogize             -> recognize
+//   recomend             -> recommend
+//   recompence           -> recompense
+//   reconaissance        -> reconnaissance
+//   reconcilation        -> reconciliation
+//   reconize             -> recognize
+//   reconnaisance        -> reconnaissance
+//   reconnaissence       -> reconnaissance
+//   recontructed         -> reconstructed
+//   recordproducer       -> record producer
+//   recquired            -> required
+//   recrational          -> recreational
+//   recrod               -> record
+//   recuiting            -> recruiting
+//   recuring             -> recurring
+//   recurrance           -> recurrence
+//   reday                -> ready
+//   rediculous           -> ridiculous
+//   reedeming            -> redeeming
+//   reenforced           -> reinforced
+//   refect               -> reflect
+//   refedendum           -> referendum
+//   referal              -> referral
+//   referece             -> reference
+//   refered              -> referred
+//   referemce            -> reference
+//   referencs            -> references
+//   referenece           -> reference
+//   referiang            -> referring
+//   refering             -> referring
+//   refernce             -> reference
+//   referrence           -> reference
+//   referrs              -> refers
+//   reffered             -> referred
+//   refference           -> reference
+//   reffering            -> referring
+//   refrence             -> reference
+//   refrers              -> refers
+//   refridgeration       -> refrigeration
+//   refridgerator        -> refrigerator
+//   refromist            -> reformist
+//   refusla              -> refusal
+//   regads               -> Regards
+//   regardes             -> regards
+//   regardsless          -> regardless
+//   regars               -> Regards
+//   regession            -> regression
+//   registared           -> registerednn
+//   regluar              -> regular
+//   regrads              -> Regards
+//   regrds               -> Regards
+//   regresion            -> regression
+//   reguarly             -> regularly
+//   regulaion            -> regulation
+//   regulaotrs           -> regulators
+//   regularily           -> regularly
+//   rehersal             -> rehearsal
+//   reicarnation         -> reincarnation
+//   reigining            -> reigning
+//   reknown              -> renown
+//   rela:                -> real
+//   relaly               -> really
+//   relatiopnship        -> relationship
+//   relativly            -> relatively
+//   releate              -> relate
+//   relecte              -> reelecte
+//   releive              -> relieve
+//   releses              -> releases
+//   relevence            -> relevance
+//   relevent             -> relevant
+//   reliablity           -> reliability
+//   relient              -> reliant
+//   religeous            -> religious
+//   religous             -> religious
+//   relinqush            -> relinquish
+//   relitavely           -> relatively
+//   relize               -> realise
+//   reloacte             -> relocate
+//   relpacement          -> replacement
+//   reltae               -> relate
+//   reluctent            -> reluctant
+//   remaing              -> remaining
+//   remeber              -> remember
+//   rememberable         -> memorable
+//   rememberance         -> remembrance
+//   remembrence          -> remembrance
+//   remenant             -> remnant
+//   remenicent           -> reminiscent
+//   reminent             -> remnant
+//   reminescent          -> reminiscent
+//   reminscent           -> reminiscent
+//   reminsicent          -> reminiscent
+//   rendevous            -> rendezvous
+//   rendezous            -> rendezvous
+//   renedered            -> rende
+//   renewl               -> renewal
+//   rennovate            -> renovate
+//   rennovating          -> renovating
+//   rennovation          -> renovation
+//   rentors              -> renters
+//   reoccurrence         -> recurrence
+//   reommend             -> recommend
+//   reorganision         -> reorganisation
+//   repatition           -> repetition, repartition
+//   repblic:             -> republic
+//   repblican            -> republican
+//   repblics             -> republics
+//   repectively          -> respectively
+//   repeition            -> repetition
+//   repentence           -> repentance
+//   repentent            -> repentant
+//   repeteadly           -> repeatedly
+//   repetion             -> repetition
+//   repitition           -> repetition
+//   reponse              -> response
+//   reponsible           -> responsible
+//   reportadly           -> reportedly
+//   represantative       -> representative
+//   representativs       -> representatives
+//   representive         -> representative
+//   represetn            -> represent
+//   represnt             -> represent
+//   reproducable         -> reproducible
+//   reprot               -> report
+//   reprtoire            -> repertoire
+//   repsectively         -> respectively
+//   reptition            -> repetition
+//   repubic:             -> republic
+//   repubican            -> republican
+//   repubics             -> republics
+//   republi:             -> republic
+//   republian:           -> republican
+//   republians           -> republicans
+//   repulic:             -> republic
+//   repulican            -> republican
+//   repulics             -> republics
+//   requirment           -> requirement
+//   requred              -> required
+//   resaurant            -> restaurant
+//   resembelance         -> resemblance
+//   resembes             -> resembles
+//   resemblence          -> resemblance
+//   reserach             -> research
+//   resevoir             -> reservoir
+//   residental           -> residential
+//   resignement          -> resignment
+//   resistence           -> resistance
+//   resistent            -> resistant
+//   resollution          -> resolution
+//   resorce              -> resource
+//   respectivly          -> respectively
+//   respomce             -> response
+//   respomd              -> respond
+//   respomse             -> response
+//   responce             -> response
+//   responibilities      -> responsibilities
+//   responisble          -> responsible
+//   responnsibilty       -> responsibility
+//   responsability       -> responsibility
+//   responsable          -> responsible
+//   responsibile         -> responsible
+//   responsibilites      -> responsibilities
+//   responsiblities      -> responsibilities
+//   responsiblity        -> responsibility
+//   ressemblance         -> resemblance
+//   ressemble:           -> resemble
+//   ressembled           -> resembled
+//   ressemblence         -> resemblance
+//   ressembling          -> resembling
+//   resssurecting        -> resurrecting
+//   ressurect            -> resurrect
+//   ressurrection        -> resurrection
+//   restarant            -> restaurant
+//   restaraunt           -> restaurant
+//   restauration         -> restoration
+//   restauraunt          -> restaurant
+//   resteraunt           -> restaurant
+//   resticted            -> restricted
+//   restraunt            -> restaurant
+//   restuarant           -> restaurant
+//   resturant            -> restaurant
+//   resturaunt           -> restaurant
+//   resurecting          -> resurrecting
+//   resutl               -> result
+//   retalitated          -> retaliated
+//   retalitation         -> retaliation
+//   retreive             -> retrieve
+//   retrun               -> return
+//   returnd              -> returned
+//   reult                -> result
+//   reuslt               -> result
+//   reutrn               -> return
+//   revaluated           -> reevaluated
+//   reveiw               -> review
+//   reveral              -> reversal
+//   reversable           -> reversible
+//   revolutionar:        -> revolutionary
+//   rewitten             -> rewritten
+//   rgeards              -> Regards
+//   rhymme               -> rhyme
+//   rhythem              -> rhythm
+//   rhythim              -> rhythm
+//   rhytmic              -> rhythmic
+//   rigeur               -> rigour
+//   rigourous            -> rigorous
+//   rininging            -> ringing
+//   rococco              -> rococo
+//   rocord               -> record
+//   roomate              -> roommate
+//   rougly               -> roughly
+//   rucuperate           -> recuperate
+//   rudimentatry         -> rudimentary
+//   rulle                -> rule
+//   rumer                -> rumor
+//   runnning             -> running
+//   runnung              -> running
+//   russina              -> russian
+//   russion              -> russian
+//   rwite                -> write
+//   rythem               -> rhythm
+//   rythim               -> rhythm
+//   rythm                -> rhythm
+//   rythyms              -> rhythms
+//   sacrafice            -> sacrifice
+//   sacreligious         -> sacrilegious
+//   sacrifical           -> sacrificial
+//   saftey               -> safety
+//   safty                -> safety
+//   salery               -> salary
+//   sanctionning         -> sanctioning
+//   sandwhich            -> sandwich
+//   santioned            -> sanctioned
+//   sargant              -> sergeant
+//   sargeant             -> sergeant
+//   sasy                 -> says, sassy
+//   satelite             -> satellite
+//   saterday             -> Saturday
+//   satisfactority       -> satisfactorily
+//   satisifed            -> satisfied
+//   satric               -> satiric
+//   sattelite            -> satellite
+//   saught               -> sought
+//   saveing              -> saving
+//   saxaphone            -> saxophone
+//   scaleable            -> scalable
+//   scandanavia          -> Scandinavia
+//   scaricity            -> scarcity
+//   scavanged            -> scavenged
+//   scedule              -> schedule
+//   scen:                -> scene
+//   schedual             -> schedule
+//   scheduel             -> schedule
+//   scholarhip           -> scholarship
+//   scholarstic          -> scholastic
+//   scientfic            -> scientific
+//   scientifc            -> scientific
+//   scientis:            -> scientist
+//   scince               -> science
+//   scinece              -> science
+//   scirpt               -> script
+//   scol:                -> scowl
+//   screenwrighter       -> screenwriter
+//   scrutinity           -> scrutiny
+//   scuptures            -> sculptures
+//   seach                -> search
+//   secceeded            -> seceded, succeeded
+//   seceed               -> succeed, secede
+//   secratary            -> secretary
+//   secretery            -> secretary
+//   sectino              -> section
+//   securtiy             -> security
+//   sedereal             -> sidereal
+//   seeked               -> sought
+//   segementation        -> segmentation
+//   seguoys              -> segues
+//   seige                -> siege
+//   seinor               -> senior
+//   seldomly             -> seldom
+//   selectoin            -> selection
+//   senarios             -> scenarios
+//   senstive             -> sensitive
+//   sensure              -> censure
+//   sentance             -> sentence
+//   separeate            -> separate
+//   seperat:             -> separate
+//   seperate             -> separate
+//   seperating           -> separating
+//   seperation           -> separation
+//   seperatism           -> separatism
+//   seperatist           -> separatist
+//   sepina               -> subpoena
+//   sequnce              -> sequence
+//   sercumstance         -> circumstance
+//   serendipiyt          -> serendipity
+//   sergent              -> sergeant
+//   sernedipity          -> serendipity
+//   serveral             -> several
+//   settelement          -> settlement
+//   settlment            -> settlement
+//   severeal             -> several
+//   severley             -> severely
+//   severly              -> severely
+//   sevice               -> service
+//   sevral               -> several
+//   sevreal              -> several
+//   sexaul               -> sexual
+//   shadasloo            -> shadaloo
+//   shadoloo             -> shadaloo
+//   shamen               -> shaman, shamans
+//   shcool               -> school
+//   sheild               -> shield
+//   sherif:              -> sheriff
+//   shineing             -> shining
+//   sholud               -> should
+//   shopkeeepers         -> shopkeepers
+//   shorly               -> shortly
+//   shortwhile           -> short while
+//   shoudl:              -> should
+//   shoudln              -> shouldn't
+//   shouldent            -> shouldn't
+//   shouldnt             -> shouldn't
+//   showinf              -> showing
+//   shreak               -> shriek
+//   shrinked             -> shrunk
+//   shure                -> sure
+//   shutdonw             -> shutdown
+//   shutodwn             -> shutdown
+//   sicne                -> since
+//   sideral              -> sidereal
+//   siezed               -> seized
+//   siezing              -> seizing
+//   siezure              -> seizure
+//   siginificant         -> significant
+//   signficant           -> significant
+//   signficiant          -> significant
+//   signfies             -> signifies
+//   signifacnt           -> significant
+//   significently        -> significantly
+//   signifigant          -> significant
+//   signitories          -> signatories
+//   signitory            -> signatory
+//   simalar              -> similar
+//   similarily           -> similarly
+//   similiar             -> similar
+//   simmilar             -> similar
+//   simpilified          -> simplified
+//   simpley              -> simply
+//   simplier             -> simpler
+//   simpyl               -> simply
+//   simultanous          -> simultaneous
+//   sincerley            -> sincerely
+//   sincerly             -> sincerely
+//   singed               -> signed
+//   singel               -> single
+//   singsog              -> singsong
+//   sinse                -> sines, since
+//   sionist              -> zionist
+//   sitll                -> still
+//   skateing             -> skating
+//   slaugterhouse        -> slaughterhouse
+//   slighly              -> slightly
+//   slippy               -> slippery
+//   slowy                -> slowly
+//   smealting            -> smelting
+//   sneek:               -> sneak
+//   sneeks               -> sneaks
+//   snese                -> sneeze
+//   socalism             -> socialism
+//   socities             -> societies
+//   sofware              -> software
+//   soical               -> social
+//   soilders             -> soldiers
+//   solatary             -> solitary
+//   soley                -> solely
+//   solice               -> solace
+//   soliders             -> soldiers
+//   soliliquy            -> soliloquy
+//   soluable             -> soluble
+//   somehwat             -> somewhat
+//   somtimes             -> sometimes
+//   somwhere             -> somewhere
+//   sophicated           -> sophisticated
+//   sophmore             -> sophomore
+//   sorceror             -> sorcerer
+//   sorrounding          -> surrounding
+//   sotry                -> story
+//   sotyr                -> story
+//   soudn                -> sound
+//   sould                -> should
+//   sountrack            -> soundtrack
+//   sourthern            -> southern
+//   souvenier            -> souvenir
+//   soveits              -> soviets
+//   sovereignity         -> sovereignty
+//   soverignity          -> sovereignty
+//   soverignty           -> sovereignty
+//   spaec                -> space
+//   spainish             -> spanish
+//   speach               -> speech
+//   specfic              -> specific
+//   speciallized         -> specialised, specialized
+//   specif:              -> specific, specify
+//   specificaly:         -> specifically
+//   specificalyl         -> specifically
+//   specifiying          -> specifying
+//   speciman             -> specimen
+//   spectauclar          -> spectacular
+//   spectaulars          -> spectaculars
+//   spectogram           -> spectrogram
+//   spects               -> aspects, expects
+//   spectum              -> spectrum
+//   speices              -> species
+//   spendour             -> splendour
+//   spermatozoan         -> spermatozoon
+//   spoace               -> space
+//   sponser              -> sponsor
+//   spontanous           -> spontaneous
+//   sponzor              -> sponsor
+//   spoonfulls           -> spoonfuls
+//   sppeches             -> speeches
+//   spreaded             -> spread
+//   sprech               -> speech
+//   spred                -> spread
+//   spriritual           -> spiritual
+//   spritual             -> spiritual
+//   sqaure               -> square
+//   stablility           -> stability
+//   stainlees            -> stainless
+//   staion               -> station
+//   standars             -> standards
+//   stange               -> strange
+//   startegic            -> strategic
+//   startegies           -> strategies
+//   startegy             -> strategy
+//   stateman             -> statesman
+//   statememts           -> statements
+//   statment             -> statement
+//   steriods             -> steroids
+//   sterotypes           -> stereotypes
+//   stilus               -> stylus
+//   stingent             -> stringent
+//   stiring              -> stirring
+//   stirng               -> string
+//   stirrs               -> stirs
+//   stlye                -> style
+//   stnad                -> stand
+//   stomache             -> stomach
+//   stong                -> strong
+//   stopry               -> story
+//   storeis              -> stories
+//   storise              -> stories
+//   stornegst            -> strongest
+//   stoyr                -> story
+//   stradegies           -> strategies
+//   stradegy             -> strategy
+//   straght              -> straight
+//   stragiht             -> straight
+//   stratagically        -> strategically
+//   streemlining         -> streamlining
+//   stregth              -> strength
+//   strengh:             -> strength
+//   strenght             -> strength
+//   strengtened          -> strengthened
+//   strenous             -> strenuous
+//   strentgh             -> strength
+//   strenuos             -> strenuous
+//   strictist            -> strictest
+//   strign               -> string
+//   strikely             -> strikingly
+//   strnad               -> strand
+//   structual            -> structural
+//   structuer            -> structure
+//   struggel             -> struggle
+//   strugle              -> struggle
+//   ststion              -> station
+//   stubborness          -> stubbornness
+//   stucture             -> structure
+//   studdy               -> study
+//   studing              -> studying
+//   studnet              -> student
+//   stuggling            -> struggling
+//   sturctural           -> structural
+//   sturcture            -> structure
+//   subdivisio:          -> subdivision
+//   subjudgation         -> subjugation
+//   submachne            -> submachine
+//   subpecies            -> subspecies
+//   subsidary            -> subsidiary
+//   subsiduary           -> subsidiary
+//   subsquent            -> subsequent
+//   substace             -> substance
+//   substancial          -> substantial
+//   substatial           -> substantial
+//   substituded          -> substituted
+//   substitued           -> substituted
+//   substract            -> subtract
+//   subtances            -> substances
+//   subterranian         -> subterranean
+//   suburburban          -> suburban
+//   succceeded           -> succeeded
+//   succcesses           -> successes
+//   succedded            -> succeeded
+//   succeded             -> succeeded
+//   succeds              -> succeeds
+//   succesful:           -> successful
+//   succesfully          -> successfully
+//   succesfuly           -> successfully
+//   succesion            -> succession
+//   succesive            -> successive
+//   successfull:         -> successful
+//   successfuly:         -> successfully
+//   successfulyl         -> successfully
+//   successully          -> successfully
+//   succsess             -> success
+//   suceed:              -> succeed
+//   suceeded             -> succeeded
+//   suceeding            -> succeeding
+//   suceeds              -> succeeds
+//   sucesful:            -> successful
+//   sucesfully           -> successfully
+//   sucesfuly            -> successfully
+//   sucesion             -> succession
+//   sucess:              -> success
+//   sucesses             -> successes
+//   sucessful:           -> successful
+//   sucessfull:          -> successful
+//   sucessfully          -> successfully
+//   sucessfuly           -> successfully
+//   sucession            -> succession
+//   sucessive            -> successive
+//   sucessor             -> successor
+//   sucessot             -> successor
+//   sucide               -> suicide
+//   sucidial             -> suicidal
+//   sudent               -> student
+//   sufferage            -> suffrage
+//   sufferred            -> suffered
+//   sufferring           -> suffering
+//   sufficent            -> sufficient
+//   sufficiant           -> sufficient
+//   sugest               -> suggest
+//   sumary               -> summary
+//   sunglases            -> sunglasses
+//   supercede            -> supersede
+//   superceeded          -> superseded
+//   superintendant       -> superintendent
+//   suphisticated        -> sophisticated
+//   suplimented          -> supplemented
+//   supose               -> suppose
+//   suposing             -> supposing
+//   supplamented         -> supplemented
+//   suppliementing       -> supplementing
+//   suppoed              -> supposed
+//   supposingly          -> supposedly
+//   supposse             -> suppose
+//   suppy                -> supply
+//   suprassing           -> surpassing
+//   supress              -> suppress
+//   suprise              -> surprise
+//   suprising            -> surprising
+//   suprize              -> surprise
+//   suprizing            -> surprising
+//   surfce               -> surface
+//   surley               -> surely
+//   suround              -> surround
+//   surplanted           -> supplanted
+//   surpress             -> suppress
+//   surprize             -> surprise
+//   surprizing           -> surprising
+//   surrended            -> surrounded, surrendered
+//   surrepetitious       -> surreptitious
+//   surreptious          -> surreptitious
+//   surronded            -> surrounded
+//   surrouded            -> surrounded
+//   surrouding           -> surrounding
+//   surrundering         -> surrendering
+//   surveilence          -> surveillance
+//   surveill             -> surveil
+//   surveyer             -> surveyor
+//   surviver             -> survivor
+//   survivied            -> survived
+//   suseptable           -> susceptible
+//   suseptible           -> susceptible
+//   suspention           -> suspension
+//   swaer                -> swear
+//   swepth               -> swept
+//   swiming              -> swimming
+//   swithc               -> switch
+//   swtich               -> switch
+//   symetrical           -> symmetrical
+//   symetry              -> symmetry
+//   symettric            -> symmetric
+//   symmetral            -> symmetric
+//   symmetricaly         -> symmetrically
+//   synagouge            -> synagogue
+//   syncronization       -> synchronization
+//   synonomous           -> synonymous
+//   synonymns            -> synonyms
+//   synphony             -> symphony
+//   syphyllis            -> syphilis
+//   sypmtoms             -> symptoms
+//   syrap                -> syrup
+//   sysmatically         -> systematically
+//   sytem                -> system
+//   sytle                -> style
+//   tabacco              -> tobacco
+//   tahn:                -> than
+//   taht:                -> that
+//   talekd               -> talked
+//   talior               -> tailor
+//   talkign              -> talking
+//   targetted            -> targeted
+//   targetting           -> targeting
+//   tatoo                -> tattoo
+//   tattooes             -> tattoos
+//   taxanomic            -> taxonomic
+//   taxanomy             -> taxonomy
+//   teached              -> taught
+//   teamplate            -> template
+//   techician            -> technician
+//   techiniques          -> techniques
+//   technitian           -> technician
+//   technnology          -> technology
+//   technolgy            -> technology
+//   tecnical             -> technical
+//   telelevision         -> television
+//   televsion            -> television
+//   telphony             -> telephony
+//   temerature           -> temperature
+//   tempalte             -> template
+//   temparate            -> temperate
+//   temperarily          -> temporarily
+//   temperment           -> temperament
+//   tempertaure          -> temperature
+//   temperture           -> temperature
+//   temprary             -> temporary
+//   tenacle              -> tentacle
+//   tendacy              -> tendency
+//   tendancies           -> tendencies
+//   tendancy             -> tendency
+//   tennisplayer         -> tennis player
+//   tepmorarily          -> temporarily
+//   terminiate           -> terminate
+//   termoil              -> turmoil
+//   terrestial           -> terrestrial
+//   terriories           -> territories
+//   terriory             -> territory
+//   territorist          -> terrorist
+//   territoy             -> territory
+//   terroist             -> terrorist
+//   testiclular          -> testicular
+//   testomony            -> testimony
+//   thansk               -> thanks
+//   thast                -> that, that's
+//   theather             -> theater
+//   theese               -> these
+//   thegn                -> thing
+//   theif                -> thief
+//   theives              -> thieves
+//   themselfs            -> themselves
+//   themslves            -> themselves
+//   theng                -> thing
+//   therafter            -> thereafter
+//   therby               -> thereby
+//   therfore             -> therefore
+//   theyre               -> they're
+//   thgat                -> that
+//   thge                 -> the
+//   thign                -> thing
+//   thigsn               -> things
+//   thikn                -> think
+//   thiunk               -> think
+//   thnig                -> thing
+//   thoughout            -> throughout
+//   threatend            -> threatened
+//   threatning           -> threatening
+//   threee               -> three
+//   threshhold           -> threshold
+//   thresold             -> threshold
+//   throrough            -> thorough
+//   throughly            -> thoroughly
+//   throught             -> through
+//   througout            -> throughout
+//   thsoe                -> those
+//   tht:                 -> that
+//   thyat                -> that
+//   tihkn                -> think
+//   timeschedule         -> time schedule
+//   timne                -> time
+//   tiogether            -> together
+//   tiome                -> time, tome
+//   tkaes                -> takes
+//   tkaing               -> taking
+//   tlaking              -> talking
+//   tobbaco              -> tobacco
+//   todays               -> today's
+//   todya                -> today
+//   togehter             -> together
+//   toghether            -> together
+//   tolerence            -> tolerance
+//   tommorow             -> tomorrow
+//   tommorrow            -> tomorrow
+//   tomorow              -> tomorrow
+//   tormenter            -> tormentor
+//   tornadoe             -> tornado
+//   torpeados            -> torpedoes
+//   torpedos             -> torpedoes
+//   tortise              -> tortoise
+//   totaly:              -> totally
+//   totalyl              -> totally
+//   toubles              -> troubles
+//   tounge               -> tongue
+//   towords              -> towards
+//   towrad               -> toward
+//   tradionally          -> traditionally
+//   traditionaly:        -> traditionally
+//   traditionalyl        -> traditionally
+//   traditionnal         -> traditional
+//   traditition          -> tradition
+//   tradtionally         -> traditionally
+//   trafficed            -> trafficked
+//   trafficing           -> trafficking
+//   trafic               -> traffic
+//   trancendent          -> transcendent
+//   trancending          -> transcending
+//   tranform             -> transform
+//   tranpose             -> transpose
+//   transcendance        -> transcendence
+//   transcendant         -> transcendent
+//   transfered           -> transferred
+//   transmissable        -> transmissible
+//   triology             -> trilogy
+//   troling              -> trolling
+//   troup:               -> troupe
+//   truely               -> truly
+//   truley               -> truly
+//   tryed                -> tried
+//   twelth               -> twelfth
+//   tyhat                -> that
+//   typcial              -> typical
+//   typicaly             -> typically
+//   tyrany               -> tyranny
+//   tyrrany              -> tyranny
+//   udner                -> under
+//   udpate               -> update
+//   ultimely             -> ultimately
+//   ahppy                -> happy
+//   unanymous            -> unanimous
+//   unbeknowst           -> unbeknownst
+//   beleivable           -> believable
+//   unchallengable       -> unchallengeable
+//   unconfortability     -> discomfort
+//   uncontitutional      -> unconstitutional
+//   understoon           -> understood
+//   undetecable          -> undetectable
+//   undoubtely           -> undoubtedly
+//   undreground          -> underground
+//   unecessary           -> unnecessary
+//   unequalities         -> inequalities
+//   foretunately         -> fortunately
+//   forgetable           -> forgettable
+//   forgiveable          -> forgivable
+//   forseen              -> foreseen
+//   fortunatley          -> fortunately
+//   fortunatly           -> fortunately
+//   fourtunately         -> fortunately
+//   interruped           -> interrupted
+//   univeral             -> universal
+//   unlest               -> unless
+//   unlikey              -> unlikely
+//   unmanouverable       -> unmaneuverable
+//   unmistakeably        -> unmistakably
+//   unoperational        -> nonoperational
+//   unoticeable          -> unnoticeable
+//   unplease             -> displease
+//   unprecendented       -> unprecedented
+//   unprecidented        -> unprecedented
+//   unqiue               -> unique
+//   unrepetant           -> unrepentant
+//   unrepetent           -> unrepentant
+//   unsed                -> unused
+//   unsubstanciated      -> unsubstantiated
+//   untill:              -> until
+//   untilll:             -> until
+//   untranslateable      -> untranslatable
+//   unuseable            -> unusable
+//   unusuable            -> unusable
+//   unviersity           -> university
+//   unwieldly            -> unwieldy
+//   upcomming            -> upcoming
+//   upgradded            -> upgraded
+//   upto                 -> up to
+//   useage               -> usage
+//   usefull              -> useful
+//   usefuly              -> usefully
+//   useing               -> using
+//   usualy:              -> usually
+//   usualyl              -> usually
+//   ususally             -> usually
+//   vaccum:              -> vacuum
+//   vaccume              -> vacuum
+//   vaccuum              -> vacuum
+//   vacinity             -> vicinity
+//   vaguaries            -> vagaries
+//   vaieties             -> varieties
+//   vailidty             -> validity
+//   valuble              -> valuable
+//   valueable            -> valuable
+//   varation             -> variation
+//   varient              -> variant
+//   variey               -> variety
+//   varing               -> varying
+//   varities             -> varieties
+//   varity:              -> variety
+//   vasall               -> vassal
+//   vegatarian           -> vegetarian
+//   vegitable            -> vegetable
+//   vegtable             -> vegetable
+//   vehicule             -> vehicle
+//   venemous             -> venomous
+//   vengance             -> vengeance
+//   vengence             -> vengeance
+//   verfication          -> verification
+//   verison              -> version
+//   versitilaty          -> versatility
+//   versitlity           -> versatility
+//   verticies            -> vertices
+//   vetween              -> between
+//   vigilence            -> vigilance
+//   vigourous            -> vigorous
+//   villification        -> vilification
+//   villify              -> vilify
+//   vincinity            -> vicinity
+//   violentce            -> violence
+//   virtualy:            -> virtually
+//   virtualyl            -> virtually
+//   virutal:             -> virtual
+//   virutally            -> virtually
+//   virutaly             -> virtually
+//   visable              -> visible
+//   visious              -> vicious
+//   visting              -> visiting
+//   vistors              -> visitors
+//   vitories             -> victories
+//   vitual               -> virtual
+//   volcanoe             -> volcano
+//   voley                -> volley
+//   volontary            -> voluntary
+//   volonteer            -> volunteer
+//   volounteer           -> volunteer
+//   volumne              -> volume
+//   vreity               -> variety
+//   vriety               -> variety
+//   vulnerablility       -> vulnerability
+//   vulnerible           -> vulnerable
+//   warantee             -> warranty
+//   wardobe              -> wardrobe
+//   warrent              -> warrant
+//   warrrior             -> warrior
+//   wasnt                -> wasn't
+//   wass                 -> was
+//   watn                 -> want
+//   wayword              -> wayward
+//   weaponary            -> weaponry
+//   weas                 -> was
+//   wehn                 -> when
+//   weild                -> wield
+//   wendsay              -> Wednesday
+//   wensday              -> Wednesday
+//   wereabouts           -> whereabouts
+//   whant                -> want
+//   whcih                -> which
+//   wheras               -> whereas
+//   wherease             -> whereas
+//   whereever            -> wherever
+//   wherre               -> where
+//   whic:                -> which
+//   whihc                -> which
+//   whith                -> with
+//   whlch                -> which
+//   whn                  -> when
+//   wholey               -> wholly
+//   wholy                -> wholly
+//   whould               -> would
+//   whta                 -> what
+//   whther               -> whether
+//   widesread            -> widespread
+//   widht                -> width
+//   wief                 -> wife
+//   wierd                -> weird
+//   wiew                 -> view
+//   wihch                -> which
+//   wiht                 -> with
+//   wille:               -> will
+//   willingless          -> willingness
+//   willk                -> will
+//   wirting              -> writing
+//   withdrawl            -> withdrawal
+//   witheld              -> withheld
+//   withh                -> with
+//   withing              -> within
+//   withold              -> withhold
+//   witht                -> with
+//   witn                 -> with
+//   wiull                -> will
+//   wnat                 -> want
+//   wohle                -> whole
+//   wokr                 -> work
+//   wolud                -> would
+//   wonderfull:          -> wonderful
+//   wordl:               -> world
+//   wordlwide            -> worldwide
+//   worls                -> world
+//   worstened            -> worsened
+//   woudl                -> would
+//   wresters             -> wrestlers
+//   wriet                -> write
+//   writen               -> written
+//   wroet                -> wrote
+//   wupport              -> support
+//   xenophoby            -> xenophobia
+//   yaching              -> yachting
+//   yaeh                 -> yeah
+//   yeild                -> yield
+//   yersa                -> years
+//   yotube               -> youtube
+//   youseff              -> yousef
+//   youself              -> yourself
+//   zeebra               -> zebra
+//
+// 19504 trie nodes, 15931 DAWG nodes, 17170 edges, 42550 bytes of flash.
+// At most 7 nodes are visited per key.
+
+#define AUTOCORRECT_DAWG_MAX_LENGTH     19
+#define AUTOCORRECT_DAWG_MAX_CORRECTION 27
+#define AUTOCORRECT_DAWG_MAX_ACTIVE     6
+#define AUTOCORRECT_DAWG_TARGET_BITS    19
+#define AUTOCORRECT_DAWG_CHARSET_SIZE   30
+#define AUTOCORRECT_DAWG_DATA_SIZE      39384
+
+// indexed by the first two symbols of a match
+static const uint32_t autocorrect_dawg_root[AUTOCORRECT_DAWG_SYMBOL_COUNT][AUTOCORRECT_DAWG_SYMBOL_COUNT] PROGMEM = {
+    {
+        AUTOCORRECT_DAWG_NO_NODE, 0x00000000, 0x000009ED, 0x00001FDB,
+        0x00002EFF, 0x00002F2E, 0x00003226, 0x00003AB2,
+        0x00003BFB, AUTOCORRECT_DAWG_NO_NODE, 0x00003E80, 0x00003EEF,
+        0x00004C21, 0x000050B2, AUTOCORRECT_DAWG_NO_NODE, 0x00005E07,
+        0x00006A2E, 0x00006D33, 0x000079C0, 0x00008209,
+        0x00008727, 0x000090B1, 0x000094B4, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0000952D, AUTOCORRECT_DAWG_NO_NODE, 0x00009915, AUTOCORRECT_DAWG_NO_NODE,
+        0x0000993D, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0000A9FD, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0000AC40,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0000AD88, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0000B0AB, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0000B5F7, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0000B8B9, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0000D194, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0000D938,
+        0x0000E2A8, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0000E508,
+        0x0000E700, AUTOCORRECT_DAWG_NO_NODE, 0x0000E78A, 0x00013640,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00013668, AUTOCORRECT_DAWG_NO_NODE, 0x00013CC7,
+        0x00013D1B, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00013FF3,
+        0x0001401B, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00014070, AUTOCORRECT_DAWG_NO_NODE, 0x00014333, AUTOCORRECT_DAWG_NO_NODE,
+        0x00014381, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00016548, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00018452, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00018A2A, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00018C83, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00018D74, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00018DF8, AUTOCORRECT_DAWG_NO_NODE, 0x00018EBC, AUTOCORRECT_DAWG_NO_NODE,
+        0x000190E5, 0x0001911E, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00019376,
+        0x00019944, 0x0001A36A, AUTOCORRECT_DAWG_NO_NODE, 0x0001AF22,
+        0x0001AFC4, 0x0001B347, 0x0001B4E7, 0x0001B8D8,
+        0x0001B9A5, 0x0001BAB3, AUTOCORRECT_DAWG_NO_NODE, 0x0001BDC8,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0001D7A7, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0001DDAA, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0001E0BD, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0001E6D4,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0001E928, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0001F562, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0001F7C5, AUTOCORRECT_DAWG_NO_NODE, 0x0001FB54, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0001FB71, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0001FF0F, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002026A, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0002032D,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00020401, 0x0002042D, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x000207E9, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00020B47, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00020E5E, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00020E81, AUTOCORRECT_DAWG_NO_NODE, 0x00021567, 0x000215FA,
+        0x00021617, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00021CAE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00022379,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000223A1, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0002274E, 0x0002282C,
+        0x00022A2B, 0x00022B87, 0x00022C45, AUTOCORRECT_DAWG_NO_NODE,
+        0x00022D19, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x000230ED, AUTOCORRECT_DAWG_NO_NODE, 0x00023120, 0x0002318B,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000234EF, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0002351B,
+        0x00023598, 0x000241AC, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x000276BF, 0x00027A11, 0x00027A56,
+        0x00027B89, 0x00027BD4, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00027CB7, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00027DE4, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00027E9B, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00028021, AUTOCORRECT_DAWG_NO_NODE,
+        0x00028088, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00028239, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00028291,
+        AUTOCORRECT_DAWG_NO_NODE, 0x000282CA, 0x00028473, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00028520, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00028564, AUTOCORRECT_DAWG_NO_NODE, 0x00028A2C, AUTOCORRECT_DAWG_NO_NODE,
+        0x00028A75, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00028FC5, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x000298BE, AUTOCORRECT_DAWG_NO_NODE, 0x000298F6, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00029B42, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00029B75, AUTOCORRECT_DAWG_NO_NODE, 0x0002AE2D, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002AF25, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002B8D0, AUTOCORRECT_DAWG_NO_NODE, 0x0002C572, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0002C62A, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0002CEE2, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002CF0A, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002D3E2, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0002D57B, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002D6E9, AUTOCORRECT_DAWG_NO_NODE, 0x0002DF20, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002DF53, AUTOCORRECT_DAWG_NO_NODE, 0x0002E1EF, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002E25B, AUTOCORRECT_DAWG_NO_NODE, 0x0002E283, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002E835, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0002EB37, 0x0002EB5F, 0x0002ED04, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0002F71D, 0x0002F94A, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0002F982, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0002FA9E,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00030403, AUTOCORRECT_DAWG_NO_NODE, 0x000308FB,
+        0x00030952, 0x00030B5E, 0x00030D63, 0x00030DDA,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00030E8D, 0x00031DC8, 0x00031E99, AUTOCORRECT_DAWG_NO_NODE,
+        0x00031EE2, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000331AE,
+        0x00033823, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00033976,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00033D42, 0x00034D74,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00034DD9, 0x000378FF, 0x00037B0F,
+        0x00037B63, AUTOCORRECT_DAWG_NO_NODE, 0x00038365, AUTOCORRECT_DAWG_NO_NODE,
+        0x00038398, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000383DB,
+        0x00038431, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x000388F1, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00038B9D, AUTOCORRECT_DAWG_NO_NODE, 0x0003CE63, 0x0003CE8F,
+        0x0003CF64, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0003D01B, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0003D121, AUTOCORRECT_DAWG_NO_NODE, 0x0003D2FD, AUTOCORRECT_DAWG_NO_NODE,
+        0x0003D335, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x0003D41F, AUTOCORRECT_DAWG_NO_NODE, 0x0003DA71, AUTOCORRECT_DAWG_NO_NODE,
+        0x0003E026, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x0003EC9E,
+        0x0003F28E, AUTOCORRECT_DAWG_NO_NODE, 0x0003FB82, 0x0003FBA8,
+        0x0003FCE8, 0x0003FD38, 0x0003FDE3, 0x000406E1,
+        0x00040F5D, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00040F96,
+        0x00041DFE, AUTOCORRECT_DAWG_NO_NODE, 0x00043B15, AUTOCORRECT_DAWG_NO_NODE,
+        0x00043C4E, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x000441E1, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x000444D1, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00045069,
+        0x00045898, AUTOCORRECT_DAWG_NO_NODE, 0x00045A3F, 0x00045A91,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00045ADA, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00045FFA, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000465EA, AUTOCORRECT_DAWG_NO_NODE,
+        0x0004661E, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00046734,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000467BE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x00046808, AUTOCORRECT_DAWG_NO_NODE, 0x0004749E,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00047539, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00047617, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x000479DA, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00047E6B, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x000482FC, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x000484CC, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x0004854E, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x000485AB, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00048765, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00048947,
+        0x00048C46, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0002402C, 0x0004904B, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, 0x0004924A, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00049313, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00049361, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x000493A2, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00049409, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, 0x00049456, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        0x00049530, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        0x00049564, 0x00049C56, 0x00049CE4, 0x00049E5C,
+        0x00049EE4, 0x0004A431, 0x0004A566, 0x0004A6DB,
+        0x0004A95E, AUTOCORRECT_DAWG_NO_NODE, 0x0004ABCF, 0x0004AC5A,
+        0x0004AF60, 0x0004B046, 0x0004B104, 0x0004B576,
+        0x0004B74B, 0x0004B789, 0x0004BA46, 0x0004C15D,
+        0x0004C83C, 0x0004C9EE, 0x0004CC0E, AUTOCORRECT_DAWG_NO_NODE,
+        0x0004CD48, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+    {
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+        AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE, AUTOCORRECT_DAWG_NO_NODE,
+    },
+};
+
+static const char autocorrect_dawg_charset[AUTOCORRECT_DAWG_CHARSET_SIZE] PROGMEM = {
+    'e', 'i', 't', 'n', 'a', 'r', 's', 'o', 'l', 'c', 'd', 'u', 'y', 'g', 'm', 'h',
+    'p', 'b', 'v', ' ', 'f', ',', 'w', 'k', 'z', 'q', '\'', 'x', 'C', 'B',
+};
+
+static const uint8_t autocorrect_dawg_data[AUTOCORRECT_DAWG_DATA_SIZE] PROGMEM = {
+    0xA3, 0xC1, 0x21, 0x00, 0x84, 0x27, 0x00, 0x68, 0x31, 0x00, 0xAE, 0x4B, 0x00, 0xD1, 0x8B, 0x00,
+    0x32, 0xB3, 0x00, 0xF4, 0x08, 0x01, 0xF5, 0x37, 0x01, 0x40, 0x33, 0x38, 0x4D, 0x43, 0x8C, 0x84,
+    0xB0, 0x00, 0x87, 0x9A, 0x0D, 0x88, 0x0D, 0x20, 0x02, 0x26, 0xC4, 0x69, 0x11, 0xA6, 0x0C, 0x81,
+    0x08, 0xB0, 0x0E, 0xA7, 0x7A, 0x00, 0x90, 0x09, 0x23, 0x64, 0x82, 0x08, 0x07, 0x1C, 0xE2, 0x20,
+    0x01, 0x20, 0x84, 0x6C, 0x10, 0x43, 0x84, 0x03, 0x0A, 0xC4, 0x68, 0xE0, 0x31, 0xAA, 0x0B, 0x60,
+    0x62, 0x0E, 0x80, 0xD6, 0x0E, 0xA0, 0x19, 0x9C, 0x16, 0x51, 0xC8, 0x42, 0x04, 0x1C, 0xCE, 0xA1,
+    0x01, 0x20, 0x06, 0xD1, 0x90, 0x04, 0x41, 0x02, 0x80, 0x14, 0x88, 0x00, 0x34, 0x33, 0xA2, 0x28,
+    0x11, 0xC8, 0x00, 0x68, 0x01, 0x1B, 0xC0, 0x5C, 0x44, 0x0F, 0x04, 0x98, 0x31, 0x04, 0x00, 0x01,
+    0xB4, 0x00, 0xB3, 0x80, 0x8A, 0x01, 0x1C, 0x24, 0x81, 0x0E, 0x18, 0xC0, 0x21, 0x32, 0x2A, 0x00,
+    0x51, 0x21, 0xC0, 0x3C, 0x44, 0xFB, 0x04, 0x20, 0x74, 0x87, 0x34, 0x61, 0x8A, 0x32, 0x02, 0xE0,
+    0xB4, 0x10, 0x69, 0xC2, 0x14, 0x65, 0x08, 0x44, 0x80, 0x29, 0x02, 0x22, 0xDC, 0x61, 0xA4, 0x18,
+    0xA6, 0x98, 0x06, 0x26, 0x85, 0x8B, 0x01, 0xC8, 0x99, 0x01, 0x1C, 0xA4, 0x01, 0x66, 0xFF, 0x01,
+    0x00, 0x64, 0x25, 0x04, 0x91, 0x00, 0xA2, 0x11, 0x48, 0x44, 0x20, 0x2A, 0x00, 0x8D, 0x44, 0x0A,
+    0x54, 0x00, 0x8B, 0x31, 0xE0, 0x00, 0x94, 0xEC, 0x00, 0x0B, 0x35, 0x2D, 0xB8, 0x20, 0xA4, 0x06,
+    0x84, 0xC3, 0xC9, 0x72, 0x00, 0x09, 0x71, 0x5A, 0x44, 0x1C, 0x02, 0x11, 0x60, 0x99, 0x87, 0x8B,
+    0xF9, 0x00, 0xC4, 0x82, 0x2B, 0x12, 0x1B, 0x21, 0x35, 0x00, 0x47, 0x24, 0x36, 0x42, 0x6A, 0x40,
+    0x04, 0x4C, 0x88, 0xD3, 0x1A, 0xD4, 0x10, 0x88, 0x80, 0xC5, 0x76, 0x8C, 0x80, 0x19, 0x9A, 0x80,
+    0x01, 0x68, 0x04, 0x12, 0x41, 0x56, 0x21, 0x2A, 0x00, 0xE3, 0x90, 0xE6, 0x25, 0x00, 0x1C, 0x36,
+    0xA5, 0x04, 0x08, 0x08, 0x21, 0x1B, 0x88, 0x0A, 0x07, 0x10, 0x10, 0x42, 0x26, 0x84, 0x03, 0x34,
+    0x33, 0xA1, 0x90, 0x01, 0x4C, 0xB2, 0xE0, 0x00, 0x4E, 0x45, 0x1A, 0xD0, 0x0C, 0xE0, 0x54, 0x48,
+    0x2D, 0x80, 0xF8, 0x55, 0xE0, 0x1C, 0x57, 0x00, 0x8D, 0x5E, 0x40, 0x99, 0x5F, 0xC0, 0xBD, 0x64,
+    0x00, 0x06, 0x6D, 0x60, 0x12, 0x71, 0x80, 0x82, 0x77, 0x00, 0x18, 0x87, 0xAC, 0x64, 0x01, 0x00,
+    0x83, 0x13, 0xC2, 0x6B, 0x00, 0x22, 0x12, 0xC2, 0x13, 0x0A, 0x8C, 0x8A, 0x56, 0x06, 0x10, 0x73,
+    0x06, 0x20, 0xA1, 0x07, 0x2C, 0x0B, 0x08, 0x38, 0x49, 0x08, 0x40, 0xF5, 0x09, 0xC4, 0x24, 0x0A,
+    0x50, 0xAC, 0x0A, 0x00, 0x03, 0xC1, 0x0E, 0xF1, 0x21, 0x03, 0x10, 0x91, 0x51, 0x56, 0x78, 0x42,
+    0x81, 0x8A, 0xB2, 0xC2, 0x6B, 0x00, 0x25, 0x11, 0x23, 0x82, 0x9D, 0xB0, 0xC0, 0x63, 0xDB, 0x6C,
+    0xC0, 0x83, 0x70, 0x80, 0x0C, 0x75, 0xC0, 0xB2, 0x10, 0x11, 0x30, 0x21, 0x4E, 0xEB, 0x08, 0xA6,
+    0x0C, 0x81, 0x08, 0x20, 0x21, 0x4E, 0x8B, 0x38, 0x47, 0x20, 0x62, 0x69, 0x39, 0x2A, 0x90, 0x23,
+    0x10, 0x01, 0xE6, 0x21, 0x72, 0x73, 0x00, 0xD1, 0x08, 0xA4, 0xA1, 0x10, 0x15, 0x80, 0x60, 0x21,
+    0x0D, 0x45, 0xA6, 0x00, 0x0E, 0x65, 0xC2, 0x03, 0x9C, 0x08, 0x21, 0x64, 0xC4, 0x41, 0x46, 0x84,
+    0x03, 0x00, 0xC1, 0x42, 0x1A, 0x84, 0x4C, 0x01, 0x18, 0x87, 0x64, 0xF3, 0x01, 0x40, 0x33, 0xE9,
+    0x86, 0x40, 0x06, 0xD0, 0xCC, 0xC3, 0xF5, 0xFE, 0x00, 0x60, 0xC1, 0x01, 0xA9, 0x01, 0xB8, 0xA0,
+    0xA4, 0xD4, 0x00, 0x84, 0x41, 0x26, 0x24, 0x03, 0x26, 0xC4, 0x69, 0x21, 0x65, 0x88, 0x5C, 0x86,
+    0x40, 0x04, 0x2C, 0x46, 0x4C, 0x09, 0xD0, 0xD3, 0x09, 0xB0, 0xC7, 0x11, 0x22, 0x01, 0x47, 0x12,
+    0x81, 0xE7, 0x25, 0x01, 0x60, 0x00, 0xE6, 0x21, 0x32, 0x8C, 0x00, 0x89, 0x78, 0x68, 0x95, 0x11,
+    0xC0, 0xA1, 0x33, 0x8F, 0x40, 0x63, 0x32, 0x1E, 0x5A, 0x65, 0x08, 0xE2, 0x80, 0x96, 0xF1, 0xD0,
+    0x2A, 0x43, 0x20, 0x02, 0x00, 0x13, 0x69, 0x78, 0x68, 0x95, 0x11, 0x00, 0xA0, 0xC1, 0x88, 0x91,
+    0x20, 0xC2, 0x02, 0x87, 0x48, 0x6F, 0x02, 0xE3, 0x10, 0x29, 0x4C, 0x80, 0x70, 0x5A, 0x82, 0x40,
+    0x04, 0x1C, 0x36, 0xA6, 0x09, 0x00, 0xAD, 0x00, 0x11, 0xC0, 0x98, 0x5C, 0x01, 0x1D, 0x08, 0x68,
+    0x4C, 0xC2, 0x12, 0xC4, 0x01, 0xD2, 0x84, 0x88, 0x0C, 0xC4, 0xCE, 0x10, 0x0A, 0xA0, 0x00, 0xA4,
+    0x99, 0x88, 0x11, 0xA2, 0x59, 0x11, 0x64, 0x84, 0x05, 0x0E, 0xDD, 0x4A, 0x05, 0x88, 0x01, 0x1D,
+    0x0E, 0x71, 0x0A, 0x00, 0x13, 0xE2, 0xB4, 0x88, 0x51, 0x86, 0x40, 0x04, 0x00, 0x26, 0xC4, 0x69,
+    0x15, 0xA3, 0x0C, 0x81, 0x08, 0x20, 0xC9, 0x08, 0x83, 0xCE, 0x01, 0xE4, 0x81, 0x5C, 0x07, 0x80,
+    0x81, 0x60, 0x10, 0x51, 0x51, 0x56, 0x78, 0x42, 0x81, 0x43, 0xC4, 0x6E, 0x01, 0x02, 0xA9, 0x8F,
+    0xC8, 0xCD, 0x02, 0xAC, 0xD4, 0x02, 0xBA, 0xC9, 0x02, 0xA4, 0x41, 0x84, 0x19, 0x80, 0xC6, 0x54,
+    0x88, 0x30, 0x05, 0x71, 0x00, 0xD1, 0xCC, 0x0C, 0x11, 0x66, 0x78, 0x81, 0x0C, 0x70, 0x58, 0xAB,
+    0x2E, 0x40, 0x54, 0x0C, 0xD1, 0xCC, 0x86, 0xF0, 0x02, 0x19, 0x00, 0xC1, 0x10, 0xCD, 0xAC, 0x08,
+    0x33, 0xBC, 0x40, 0x06, 0x30, 0x10, 0xCD, 0x8C, 0x50, 0x62, 0x05, 0x32, 0xC0, 0xA1, 0x05, 0xC6,
+    0x40, 0xE3, 0x58, 0xEB, 0x90, 0x00, 0x62, 0x60, 0x20, 0x0C, 0x62, 0x44, 0x84, 0xE5, 0xC2, 0x02,
+    0x06, 0x83, 0x40, 0x1A, 0xD3, 0x20, 0x88, 0x03, 0x80, 0x68, 0x54, 0x5C, 0x7C, 0x8B, 0x59, 0x96,
+    0xCA, 0xA2, 0xF0, 0x2D, 0x66, 0x81, 0xC3, 0x98, 0xAF, 0x01, 0xB6, 0xE8, 0xD2, 0x33, 0xF0, 0x76,
+    0x34, 0xC0, 0x38, 0x03, 0x30, 0x91, 0x0E, 0x85, 0xDE, 0x43, 0xAB, 0x8C, 0x00, 0x0C, 0xC0, 0x44,
+    0x32, 0x14, 0x7A, 0x0F, 0xAD, 0x32, 0x02, 0x38, 0x5C, 0xB2, 0x1A, 0x00, 0x1A, 0x84, 0x18, 0x1D,
+    0x0A, 0xBD, 0x58, 0x88, 0x08, 0x0B, 0x40, 0xA4, 0x93, 0xA1, 0xD0, 0x8B, 0x49, 0x1C, 0x08, 0x0C,
+    0x48, 0x63, 0x2A, 0x14, 0x32, 0x4B, 0x10, 0x07, 0xD0, 0x43, 0xE4, 0xB9, 0x01, 0x00, 0x69, 0xE6,
+    0x01, 0xD9, 0x71, 0xC0, 0xE1, 0xE4, 0xE0, 0x00, 0xD0, 0x4C, 0x44, 0x23, 0x90, 0x8E, 0x22, 0xC8,
+    0x28, 0x44, 0x05, 0x80, 0x18, 0x05, 0x23, 0x2C, 0xF0, 0xE8, 0x68, 0x3A, 0x40, 0xA9, 0x3A, 0x50,
+    0x45, 0x3B, 0x80, 0xD4, 0x45, 0x64, 0xD0, 0x81, 0xF5, 0x6D, 0x00, 0x60, 0x42, 0x1C, 0x1D, 0x40,
+    0x80, 0x89, 0x90, 0x05, 0x22, 0x1C, 0x70, 0x80, 0xD0, 0x25, 0x00, 0x58, 0xF0, 0xA1, 0x5E, 0xEC,
+    0xC0, 0x2A, 0x48, 0x0D, 0x40, 0x80, 0x89, 0x44, 0x88, 0x59, 0x46, 0x00, 0x8B, 0x52, 0xD5, 0x03,
+    0x13, 0xF3, 0x03, 0x11, 0x38, 0x9C, 0x79, 0x1E, 0x10, 0x70, 0x84, 0x62, 0xA6, 0xA8, 0x06, 0x90,
+    0x08, 0xC5, 0x4C, 0x19, 0x01, 0x1C, 0xCE, 0x7D, 0x0F, 0x10, 0xA3, 0x41, 0xB1, 0x13, 0x16, 0xE0,
+    0xB0, 0x43, 0xDD, 0xF6, 0x01, 0x86, 0x18, 0x1D, 0x8A, 0x9D, 0x81, 0x5E, 0x58, 0xA0, 0x42, 0xB1,
+    0x33, 0xD0, 0x03, 0x80, 0x65, 0xC1, 0x15, 0x83, 0x95, 0x94, 0x1A, 0x38, 0x0D, 0x0F, 0x21, 0x18,
+    0x58, 0x21, 0x20, 0x4E, 0x25, 0x38, 0x04, 0x26, 0x60, 0xA1, 0x26, 0x70, 0x37, 0x2A, 0x80, 0x81,
+    0x2A, 0x88, 0x24, 0x2B, 0xA8, 0x76, 0x2D, 0x00, 0x2A, 0xA0, 0x11, 0x88, 0x91, 0x31, 0x0B, 0x51,
+    0x61, 0x01, 0x40, 0x33, 0x38, 0x2D, 0x43, 0x16, 0xB2, 0x10, 0x01, 0x93, 0x2C, 0x77, 0x04, 0xAE,
+    0x81, 0x04, 0xB1, 0x86, 0x04, 0xD3, 0xA2, 0x04, 0x68, 0xD1, 0x45, 0x89, 0x60, 0x3A, 0x8A, 0x40,
+    0x98, 0x10, 0xA7, 0x01, 0x56, 0xC6, 0x10, 0x88, 0x94, 0x04, 0x34, 0xC0, 0x6A, 0x18, 0x02, 0x91,
+    0x92, 0xC0, 0xA1, 0x0B, 0x1C, 0x01, 0x3A, 0x74, 0x5B, 0x23, 0x68, 0x80, 0x75, 0xA8, 0x75, 0x46,
+    0xB0, 0xE0, 0x08, 0x44, 0x4A, 0x4A, 0x0D, 0x34, 0x20, 0x52, 0x12, 0xD0, 0x0E, 0x00, 0xF3, 0x03,
+    0x34, 0xC0, 0x6A, 0x10, 0x88, 0x94, 0x04, 0x20, 0x92, 0x84, 0x38, 0xAD, 0xE3, 0x89, 0x73, 0x04,
+    0x22, 0xC0, 0x33, 0x1B, 0x50, 0x1C, 0x00, 0x21, 0x1F, 0x11, 0x2E, 0x09, 0x64, 0x39, 0x09, 0x34,
+    0x41, 0x09, 0x88, 0x51, 0x70, 0xC2, 0x02, 0x1A, 0x93, 0x70, 0x04, 0x71, 0x00, 0x21, 0xC9, 0x00,
+    0x10, 0x70, 0x00, 0xC4, 0x69, 0x0D, 0x62, 0x08, 0x44, 0xC0, 0x21, 0x8C, 0x2D, 0x81, 0x40, 0x01,
+    0x13, 0x89, 0xD0, 0xAC, 0x8C, 0x00, 0x50, 0xC8, 0x3C, 0xD4, 0xE8, 0x25, 0x20, 0x09, 0x65, 0x04,
+    0x80, 0x1C, 0x46, 0x34, 0x13, 0x00, 0x11, 0xD2, 0x98, 0x08, 0x23, 0x88, 0x03, 0x80, 0x46, 0x20,
+    0x0D, 0x81, 0xA8, 0x00, 0x0E, 0xD1, 0xC7, 0x09, 0x88, 0x66, 0x60, 0x88, 0x66, 0x86, 0xBC, 0x40,
+    0xD6, 0x0B, 0x64, 0x80, 0x45, 0x89, 0x9B, 0x82, 0xC9, 0xC1, 0x81, 0x76, 0x28, 0xE5, 0x4F, 0x80,
+    0x34, 0x88, 0x34, 0x45, 0xC0, 0x84, 0x54, 0xA4, 0xE4, 0x0C, 0x53, 0x86, 0x98, 0x01, 0x98, 0x87,
+    0xF1, 0x0B, 0x05, 0x44, 0x44, 0x8C, 0x0A, 0x71, 0x46, 0x30, 0x61, 0x01, 0xC0, 0x5C, 0x44, 0xD8,
+    0x28, 0x70, 0x7D, 0x29, 0x20, 0x15, 0xE2, 0x0C, 0x53, 0x46, 0x00, 0x87, 0xB5, 0x27, 0x05, 0x4E,
+    0xEB, 0x10, 0x67, 0x98, 0x32, 0x04, 0x22, 0x00, 0xE9, 0x10, 0x67, 0x98, 0x32, 0xC4, 0x0C, 0x40,
+    0xCC, 0x10, 0x67, 0x98, 0x32, 0x90, 0x01, 0x24, 0x20, 0x1C, 0xAE, 0x8D, 0x07, 0x20, 0x0B, 0x32,
+    0xE1, 0x0C, 0x21, 0x45, 0x12, 0xA3, 0x01, 0x0B, 0x21, 0x10, 0xCD, 0x6C, 0x38, 0x2A, 0x90, 0x01,
+    0x50, 0x48, 0x3C, 0x44, 0xE3, 0x2A, 0x20, 0x15, 0x4A, 0x33, 0x61, 0x02, 0xD0, 0x98, 0x0E, 0xA5,
+    0x99, 0x30, 0x82, 0x38, 0x80, 0x90, 0x8F, 0x28, 0x7A, 0x05, 0x52, 0x82, 0x05, 0x1A, 0xAA, 0x05,
+    0x40, 0xB0, 0x90, 0x8C, 0x65, 0xC2, 0x39, 0x45, 0xA6, 0x00, 0x34, 0xA6, 0x62, 0x99, 0x70, 0x8E,
+    0x20, 0x0E, 0x3C, 0x92, 0x59, 0x16, 0xA0, 0x74, 0x16, 0x68, 0x95, 0x16, 0x00, 0xC1, 0x42, 0x3A,
+    0x96, 0x09, 0xE7, 0x14, 0x99, 0x02, 0x30, 0x2A, 0x96, 0x09, 0xE7, 0x84, 0x05, 0x34, 0x26, 0x63,
+    0x99, 0x70, 0x8E, 0x20, 0x0E, 0x44, 0x2C, 0x13, 0xCE, 0x01, 0x0D, 0xCB, 0x84, 0x73, 0xC0, 0x22,
+    0x61, 0x6F, 0x01, 0x8A, 0x76, 0x01, 0xD0, 0x00, 0x06, 0x49, 0x18, 0xC5, 0x05, 0xB0, 0x18, 0xDB,
+    0x5C, 0x20, 0x33, 0x5D, 0xD0, 0x4C, 0x91, 0x43, 0xC9, 0x06, 0x66, 0x10, 0x3B, 0xC0, 0x84, 0x0E,
+    0xE4, 0xC5, 0x05, 0x00, 0x11, 0x6E, 0x30, 0xA7, 0x98, 0x06, 0x08, 0xC4, 0x48, 0x38, 0x61, 0x01,
+    0x11, 0x42, 0xAC, 0x82, 0x92, 0xC0, 0x63, 0x81, 0x7D, 0x81, 0x43, 0x8C, 0xC1, 0xD4, 0x8F, 0x01,
+    0x80, 0xC4, 0x84, 0x5A, 0x84, 0x01, 0x87, 0xB1, 0x2A, 0x06, 0xE8, 0x70, 0x29, 0xC3, 0x40, 0x40,
+    0x87, 0xAE, 0x0F, 0x06, 0x40, 0x03, 0x0C, 0x8E, 0x2C, 0x11, 0x4A, 0x20, 0x52, 0x16, 0x3A, 0x40,
+    0x03, 0x0C, 0x2E, 0x44, 0x28, 0x81, 0x48, 0x59, 0x08, 0x1C, 0x2E, 0x8E, 0x18, 0x00, 0x13, 0x49,
+    0x10, 0x65, 0x04, 0x00, 0x01, 0x26, 0x12, 0x21, 0xCA, 0x08, 0x00, 0x80, 0x8C, 0x08, 0x53, 0xC4,
+    0x02, 0x22, 0x82, 0x21, 0x98, 0x09, 0x71, 0x1A, 0x62, 0x64, 0x90, 0x21, 0x10, 0x09, 0x0B, 0x20,
+    0xE2, 0xC1, 0x8C, 0x21, 0xC0, 0xA3, 0x71, 0x99, 0x01, 0xAA, 0xAA, 0x41, 0xFC, 0xB0, 0x01, 0x80,
+    0x0E, 0xA5, 0xC1, 0x0C, 0xDA, 0xA1, 0x74, 0x97, 0x41, 0x23, 0xCD, 0x84, 0x33, 0x00, 0x1D, 0x30,
+    0x80, 0x66, 0x26, 0x90, 0x33, 0xC0, 0x61, 0x6C, 0x9D, 0x01, 0x10, 0x01, 0x15, 0x30, 0x11, 0xB2,
+    0xC3, 0x94, 0x59, 0x46, 0x38, 0x00, 0x59, 0x34, 0x78, 0x34, 0x90, 0x22, 0x35, 0x20, 0x87, 0xCC,
+    0x86, 0x06, 0x23, 0xC2, 0x84, 0xB0, 0x00, 0xA2, 0x99, 0x1D, 0x26, 0x84, 0x17, 0xC8, 0x00, 0x87,
+    0x31, 0x9D, 0x06, 0x88, 0x43, 0xC9, 0x92, 0xE0, 0x4C, 0x70, 0x02, 0xB1, 0x03, 0x00, 0x93, 0x13,
+    0x23, 0xCA, 0x40, 0x06, 0x40, 0x2A, 0x92, 0x70, 0xC4, 0x0C, 0xE0, 0xB0, 0xC9, 0xD6, 0x00, 0x68,
+    0xA4, 0x19, 0x51, 0x04, 0x39, 0x03, 0x1C, 0xCA, 0xF9, 0x1A, 0x80, 0x84, 0x22, 0x08, 0x30, 0x1B,
+    0x8A, 0x20, 0x67, 0x80, 0x45, 0x42, 0x6A, 0x03, 0x34, 0x97, 0x03, 0xA0, 0x02, 0x26, 0x52, 0xE1,
+    0x4C, 0x99, 0x65, 0x04, 0xF0, 0x68, 0x10, 0x70, 0x80, 0x94, 0x70, 0x20, 0xEF, 0x70, 0x40, 0x0E,
+    0xD9, 0xD5, 0x0D, 0x08, 0x86, 0x68, 0x66, 0xC4, 0x0B, 0x64, 0x80, 0xC3, 0x56, 0x7A, 0x03, 0x82,
+    0x68, 0x66, 0x02, 0x19, 0xE0, 0x70, 0xB2, 0xDF, 0x80, 0x98, 0x09, 0x81, 0x0C, 0x50, 0x10, 0xC8,
+    0x00, 0x80, 0x89, 0x54, 0x38, 0x13, 0x5C, 0x19, 0x01, 0x68, 0x4C, 0x42, 0x10, 0xC4, 0x01, 0xF2,
+    0xD0, 0xF5, 0xE4, 0x00, 0x1D, 0x56, 0x81, 0x1C, 0x38, 0x2D, 0xC3, 0x99, 0x70, 0x8E, 0x40, 0x04,
+    0x20, 0x19, 0xCE, 0x84, 0x73, 0xC4, 0x0C, 0x40, 0xAC, 0x70, 0x26, 0x9C, 0x83, 0x0C, 0x38, 0x24,
+    0x70, 0x3A, 0x10, 0xE8, 0xE1, 0xC4, 0xD1, 0xC1, 0x3A, 0xA4, 0x0B, 0x3A, 0x98, 0x28, 0x12, 0x60,
+    0x02, 0x10, 0x91, 0x84, 0xC1, 0x4C, 0x00, 0xA8, 0x88, 0x34, 0xA4, 0xC1, 0x4C, 0x00, 0x2A, 0x62,
+    0x54, 0x38, 0x23, 0xC2, 0x0C, 0x0B, 0x2C, 0x3E, 0x8B, 0x1D, 0xD4, 0xED, 0x1D, 0x10, 0xB5, 0x01,
+    0x96, 0x19, 0x80, 0xB7, 0xD8, 0x14, 0x77, 0x80, 0x6B, 0x77, 0x40, 0xB4, 0x0A, 0x58, 0x62, 0x0C,
+    0x04, 0x44, 0xC0, 0x12, 0x63, 0x20, 0x20, 0x02, 0x96, 0x18, 0x1B, 0x38, 0x20, 0xF5, 0x3A, 0x78,
+    0x7C, 0x93, 0x3C, 0x88, 0xCB, 0x3C, 0x90, 0x4D, 0x3E, 0x10, 0x22, 0xA0, 0x98, 0x11, 0x46, 0x99,
+    0x52, 0x07, 0xE0, 0x44, 0xB3, 0xC1, 0x44, 0x64, 0x06, 0x78, 0x14, 0x5A, 0x3D, 0x78, 0xD7, 0x3D,
+    0x88, 0x09, 0x3E, 0x08, 0x1C, 0x2A, 0x6A, 0x48, 0x83, 0x21, 0x01, 0x1C, 0x46, 0xD6, 0x1E, 0x00,
+    0xC5, 0x4C, 0x30, 0xA5, 0x0E, 0x00, 0x28, 0x26, 0x49, 0x17, 0x00, 0x4E, 0x34, 0x0F, 0x00, 0x41,
+    0x09, 0x08, 0x11, 0x50, 0xCC, 0x0A, 0x65, 0x4A, 0x1D, 0x00, 0x02, 0xB4, 0x88, 0x23, 0x0A, 0x01,
+    0x1A, 0xC7, 0x5A, 0x88, 0xC1, 0x20, 0x21, 0x0A, 0x13, 0x74, 0x53, 0x58, 0x2E, 0x80, 0x57, 0x21,
+    0x03, 0x04, 0x02, 0x15, 0x04, 0x53, 0x1F, 0x04, 0x24, 0x2D, 0x84, 0x85, 0x32, 0x04, 0x86, 0x7B,
+    0x04, 0x67, 0x7E, 0x04, 0x49, 0x99, 0x84, 0xA9, 0x9B, 0x04, 0x7A, 0xAF, 0x04, 0xAB, 0xB3, 0x84,
+    0x00, 0x21, 0x66, 0x42, 0x10, 0x03, 0x1C, 0x3A, 0x68, 0x20, 0x1C, 0xEE, 0x70, 0xBD, 0x02, 0xE1,
+    0x70, 0x56, 0x04, 0x82, 0x28, 0x81, 0x04, 0x04, 0x51, 0x02, 0xCE, 0xA1, 0xC3, 0x08, 0x02, 0xB0,
+    0x0A, 0x50, 0x02, 0x16, 0x44, 0x00, 0x07, 0x4B, 0xB9, 0x07, 0x87, 0x46, 0x34, 0x08, 0x83, 0x41,
+    0x1A, 0x52, 0x70, 0x01, 0x40, 0x88, 0x46, 0x20, 0x19, 0x29, 0x38, 0x51, 0x88, 0x0A, 0xE0, 0xD0,
+    0x19, 0x09, 0x81, 0x08, 0xE2, 0x01, 0xF0, 0x08, 0x82, 0x78, 0x88, 0x5E, 0x85, 0x70, 0x20, 0x13,
+    0x23, 0x23, 0xC4, 0x80, 0xEF, 0x00, 0x13, 0x0B, 0x80, 0x0F, 0x20, 0x9A, 0x09, 0x98, 0x90, 0xC6,
+    0x54, 0x94, 0x21, 0x88, 0x03, 0x97, 0x68, 0x9E, 0x08, 0xAE, 0xAF, 0x08, 0xD1, 0xB6, 0x08, 0x93,
+    0xBE, 0x08, 0xF6, 0xE0, 0x08, 0xE4, 0xD0, 0xD4, 0x0F, 0x61, 0x30, 0x48, 0x82, 0x0B, 0xE0, 0x10,
+    0xF9, 0x6D, 0x80, 0x2C, 0xAE, 0x4F, 0x22, 0xB4, 0x60, 0x22, 0x8C, 0x43, 0x8C, 0xFD, 0x00, 0x62,
+    0xC1, 0x09, 0xA9, 0x01, 0xB8, 0x60, 0xA5, 0x06, 0x08, 0xA4, 0x41, 0x14, 0xA2, 0x02, 0x38, 0xAC,
+    0x3A, 0x45, 0x30, 0x5A, 0x83, 0x70, 0x04, 0x40, 0x80, 0x89, 0x54, 0x84, 0x29, 0xCA, 0x08, 0xC0,
+    0xE3, 0x34, 0x24, 0x01, 0x22, 0x12, 0x00, 0x02, 0x18, 0x70, 0x85, 0x09, 0x65, 0x35, 0xB0, 0x88,
+    0xE8, 0x8C, 0xE0, 0x5C, 0x8D, 0x70, 0x38, 0x94, 0x71, 0x32, 0x06, 0x44, 0xCC, 0x41, 0x80, 0x21,
+    0x0D, 0xBF, 0x65, 0x88, 0x17, 0x00, 0x83, 0x98, 0x0E, 0x22, 0x86, 0x0C, 0xE4, 0xC2, 0x80, 0xC1,
+    0x80, 0x43, 0x8C, 0x79, 0x04, 0x70, 0x38, 0xF1, 0x8E, 0x20, 0xE1, 0x88, 0x5B, 0xDA, 0x01, 0x07,
+    0xF2, 0xEA, 0x08, 0x07, 0x00, 0xEF, 0x08, 0x24, 0x67, 0x26, 0xA0, 0x33, 0xC0, 0x24, 0x5B, 0x44,
+    0x82, 0xC4, 0x45, 0xC2, 0x7C, 0x46, 0x82, 0x65, 0x48, 0x82, 0x70, 0x38, 0x2B, 0x42, 0x21, 0x88,
+    0x12, 0x20, 0xCD, 0x86, 0x87, 0xCE, 0x00, 0x05, 0x07, 0x01, 0x13, 0x31, 0x22, 0x12, 0x1A, 0x23,
+    0x2C, 0x70, 0x88, 0xBA, 0x92, 0x40, 0x8C, 0x86, 0x84, 0x6E, 0x58, 0x40, 0x63, 0x22, 0x12, 0xBA,
+    0x82, 0x38, 0xC0, 0x1D, 0xCC, 0x7B, 0x12, 0x2C, 0x1E, 0x29, 0x25, 0xB8, 0x5F, 0x25, 0x10, 0x51,
+    0x83, 0x4C, 0x48, 0x45, 0xC8, 0x8A, 0x32, 0xC4, 0x0C, 0x07, 0x70, 0x87, 0x7A, 0x54, 0x09, 0x94,
+    0x39, 0x38, 0x9A, 0x49, 0x08, 0x60, 0x0E, 0x02, 0x94, 0x71, 0x1A, 0x20, 0x62, 0x0E, 0x02, 0x12,
+    0xE2, 0xB4, 0x88, 0xC4, 0x8E, 0x40, 0x04, 0x1C, 0xE2, 0xFC, 0x25, 0x80, 0xC5, 0x99, 0xBB, 0x04,
+    0x9C, 0xBD, 0x04, 0x09, 0x17, 0xB4, 0x03, 0x0E, 0xA4, 0xE8, 0x12, 0x0E, 0x34, 0x41, 0x09, 0x00,
+    0x32, 0xA1, 0xB4, 0x03, 0x36, 0x47, 0x69, 0x13, 0x08, 0x73, 0x13, 0x14, 0xB8, 0x13, 0x58, 0xD7,
+    0x13, 0x5C, 0xFD, 0x13, 0xA8, 0x07, 0x14, 0xC0, 0xE1, 0xC4, 0x69, 0xC2, 0x62, 0x38, 0x0C, 0x30,
+    0x11, 0xA3, 0xA2, 0xBC, 0x32, 0xC2, 0x02, 0xE8, 0x61, 0x2C, 0x6C, 0x02, 0x11, 0x13, 0x02, 0x33,
+    0xE0, 0x80, 0xA4, 0x35, 0x01, 0x69, 0x78, 0x65, 0x05, 0x70, 0x18, 0x47, 0x9C, 0xD0, 0x0C, 0x0C,
+    0x38, 0x68, 0xCA, 0x37, 0x38, 0x5C, 0x8C, 0x4E, 0x10, 0x10, 0x90, 0xF1, 0x83, 0x5E, 0x30, 0x42,
+    0x15, 0x00, 0x71, 0x22, 0x60, 0x22, 0x1D, 0x49, 0x20, 0x53, 0x46, 0x00, 0x87, 0xC8, 0xE4, 0x09,
+    0xA4, 0xE1, 0x15, 0x1C, 0x80, 0xC6, 0x54, 0xBC, 0x82, 0x05, 0x71, 0x60, 0xD1, 0x09, 0x3F, 0x81,
+    0xCE, 0x32, 0x80, 0x68, 0x46, 0x43, 0x20, 0x0B, 0xA0, 0x9A, 0x19, 0x81, 0x18, 0x19, 0x00, 0xD5,
+    0x98, 0x04, 0xE2, 0x80, 0x76, 0x88, 0xCA, 0xA0, 0x60, 0x12, 0x10, 0x71, 0xC0, 0x84, 0x38, 0x2D,
+    0xE3, 0x31, 0x22, 0x86, 0x40, 0x04, 0xBC, 0x06, 0xA0, 0x29, 0x08, 0xAC, 0x29, 0x0C, 0xF9, 0x29,
+    0x20, 0x5D, 0x2A, 0x34, 0xD3, 0x2A, 0xB8, 0x4E, 0x2B, 0x48, 0x75, 0x2C, 0x4C, 0x2E, 0x2D, 0x50,
+    0x4D, 0x2E, 0xD8, 0x6E, 0x2E, 0x60, 0x88, 0x2E, 0x80, 0xC3, 0x48, 0x2D, 0x85, 0xB5, 0x88, 0xCE,
+    0xA4, 0xE0, 0x34, 0xA5, 0x00, 0x18, 0x0E, 0x25, 0x23, 0x90, 0x43, 0xEC, 0x00, 0x13, 0x22, 0x1A,
+    0xDA, 0x10, 0x0A, 0x30, 0x08, 0x87, 0x92, 0x0D, 0x88, 0x1D, 0x40, 0x38, 0xD0, 0xA1, 0x14, 0x99,
+    0x02, 0x0B, 0x38, 0x0F, 0x98, 0x58, 0xC1, 0x03, 0x46, 0xC1, 0x02, 0x87, 0x48, 0x76, 0x0A, 0x84,
+    0x34, 0x39, 0x11, 0x4E, 0x30, 0x0D, 0x58, 0x16, 0x04, 0x88, 0x70, 0x43, 0x31, 0x0D, 0x2C, 0x06,
+    0xE2, 0x1E, 0x0C, 0xE2, 0x1E, 0x44, 0x8E, 0x41, 0xB4, 0x43, 0xEC, 0x49, 0x05, 0x87, 0x92, 0x11,
+    0x8D, 0x20, 0x76, 0x40, 0x42, 0x23, 0x0D, 0x1C, 0x56, 0xA4, 0x2A, 0x1C, 0xC8, 0x02, 0x4C, 0x88,
+    0xD3, 0x42, 0x88, 0x80, 0x22, 0x95, 0x21, 0x10, 0x01, 0x88, 0x48, 0x02, 0x22, 0xDC, 0x41, 0xC4,
+    0x0C, 0xE6, 0x14, 0xD3, 0xC0, 0x21, 0x85, 0xB2, 0x82, 0x3B, 0xA4, 0x1D, 0x56, 0x40, 0x9A, 0x19,
+    0x81, 0x04, 0x19, 0x80, 0x40, 0x8C, 0x04, 0xA2, 0xC2, 0x02, 0x87, 0x80, 0xF9, 0x01, 0x0B, 0x31,
+    0x0A, 0x52, 0x58, 0xE0, 0x91, 0x95, 0x5C, 0xA1, 0xB9, 0x5F, 0x81, 0xCA, 0x60, 0xE1, 0x98, 0x88,
+    0xD8, 0x30, 0x60, 0x30, 0x80, 0xB3, 0x16, 0x1D, 0xE8, 0x15, 0xB0, 0xF4, 0x15, 0x10, 0x42, 0x46,
+    0x94, 0x24, 0xC2, 0x01, 0x28, 0x19, 0x51, 0x12, 0x62, 0x07, 0x24, 0x94, 0xD4, 0x00, 0x84, 0x41,
+    0x26, 0x1C, 0xD1, 0x9E, 0x18, 0x0D, 0x68, 0x04, 0x72, 0xC8, 0x32, 0xB1, 0x30, 0x2A, 0x08, 0x62,
+    0x44, 0x85, 0x05, 0x10, 0xCD, 0x0C, 0x21, 0x88, 0x11, 0x15, 0x5E, 0x20, 0x03, 0x1C, 0x12, 0x07,
+    0x2D, 0x00, 0x0B, 0x3A, 0xCC, 0xA7, 0x59, 0x90, 0x80, 0x09, 0x71, 0x5A, 0x0B, 0x29, 0xA7, 0x24,
+    0x71, 0xCA, 0x10, 0x88, 0x00, 0xC0, 0x84, 0x38, 0xAD, 0x85, 0x94, 0x53, 0x92, 0xC8, 0x65, 0x08,
+    0x44, 0x00, 0x69, 0x72, 0x22, 0x99, 0xA1, 0xC2, 0x19, 0xC8, 0x1C, 0xB0, 0x78, 0xA4, 0xB5, 0x80,
+    0x3A, 0xB8, 0x00, 0x44, 0x13, 0x22, 0x12, 0xD4, 0x10, 0x0A, 0x88, 0xDC, 0xE1, 0xC3, 0xDC, 0x02,
+    0xE3, 0x44, 0xCF, 0x81, 0x64, 0xC0, 0x84, 0x38, 0xAD, 0x25, 0xA2, 0x87, 0x4C, 0x84, 0x22, 0x97,
+    0x21, 0x10, 0x01, 0x9C, 0xC5, 0x1C, 0xE2, 0x00, 0x2E, 0x20, 0xD2, 0x6C, 0x40, 0x4E, 0x9C, 0x01,
+    0x0A, 0x90, 0x6B, 0x00, 0xF0, 0x00, 0xD1, 0x74, 0x10, 0xC8, 0x08, 0xF9, 0x2D, 0x25, 0x16, 0x33,
+    0x60, 0x10, 0x0B, 0x58, 0x16, 0x62, 0x44, 0x10, 0x96, 0x52, 0x58, 0x80, 0x44, 0xC4, 0x86, 0x73,
+    0x83, 0x01, 0x8B, 0x6E, 0xB1, 0x0B, 0xD3, 0xB9, 0x0B, 0x87, 0x45, 0x44, 0x24, 0xE2, 0xC2, 0x60,
+    0x02, 0x30, 0x1D, 0x44, 0x8C, 0xA0, 0x68, 0xC0, 0x60, 0x00, 0x0C, 0x69, 0x4C, 0x03, 0x14, 0xC4,
+    0x81, 0x4B, 0xB2, 0xF7, 0x85, 0xE5, 0xFF, 0x05, 0xD7, 0x0A, 0x86, 0xD7, 0x10, 0x86, 0xD8, 0x81,
+    0x06, 0x20, 0x2E, 0x32, 0x83, 0x2F, 0x44, 0x9F, 0x2F, 0x10, 0xCD, 0x8C, 0x88, 0xC5, 0x04, 0x32,
+    0x00, 0xA2, 0x99, 0x0D, 0xE3, 0x05, 0x32, 0x00, 0xA2, 0x99, 0x15, 0xB1, 0x98, 0x40, 0x06, 0xD0,
+    0x20, 0x0D, 0x21, 0x1B, 0x88, 0x20, 0xE1, 0x58, 0xFA, 0x83, 0x62, 0x20, 0x44, 0x90, 0x70, 0x00,
+    0x74, 0x48, 0x02, 0xC1, 0x20, 0x00, 0x13, 0xE2, 0xB4, 0x8E, 0x98, 0x84, 0x2A, 0x43, 0x20, 0x02,
+    0x8C, 0x86, 0x98, 0x44, 0x58, 0xC0, 0x42, 0x18, 0xC4, 0x84, 0x08, 0x32, 0x03, 0xB9, 0x30, 0x84,
+    0x3A, 0x60, 0x92, 0x14, 0x88, 0x61, 0xC9, 0x8D, 0xC1, 0xF5, 0x8E, 0x21, 0x5A, 0x91, 0x01, 0x88,
+    0x8B, 0x60, 0xC0, 0x09, 0x33, 0x3D, 0x0C, 0x11, 0xD1, 0x0E, 0xE6, 0xDF, 0x03, 0x1A, 0x8A, 0x19,
+    0xE0, 0x30, 0x36, 0x8B, 0x01, 0x1C, 0xC6, 0x37, 0x31, 0xAC, 0x83, 0x25, 0x89, 0x01, 0xE4, 0xB0,
+    0x05, 0x39, 0x00, 0x68, 0x04, 0x12, 0x51, 0x88, 0x0A, 0xE0, 0x90, 0xBC, 0x8C, 0x01, 0x68, 0x04,
+    0x12, 0x51, 0x4C, 0x21, 0x2A, 0x00, 0x40, 0x23, 0x90, 0x8A, 0x62, 0x0A, 0x51, 0x01, 0x40, 0x04,
+    0x00, 0x99, 0x9C, 0xD6, 0x30, 0x04, 0x22, 0xC0, 0xE2, 0x98, 0x43, 0x0C, 0x43, 0x06, 0x84, 0x90,
+    0x1D, 0x28, 0x21, 0x27, 0xC2, 0x01, 0x15, 0x28, 0x21, 0xD7, 0xC0, 0x22, 0x3A, 0x27, 0x83, 0xB3,
+    0x29, 0x03, 0x01, 0x44, 0x40, 0x23, 0x90, 0x8E, 0x50, 0x4C, 0x21, 0x2A, 0x00, 0x84, 0x80, 0x00,
+    0x13, 0xC9, 0x08, 0x4A, 0x94, 0x11, 0xC0, 0xE2, 0xE3, 0x2C, 0xC3, 0xC5, 0x37, 0x03, 0x20, 0x1C,
+    0x32, 0x20, 0x1C, 0x70, 0x18, 0xF3, 0xCB, 0x80, 0x00, 0x13, 0x69, 0x30, 0xA2, 0x8C, 0x00, 0x0E,
+    0x5D, 0x94, 0x19, 0x00, 0x64, 0x22, 0x0D, 0xA2, 0x8C, 0x00, 0x0E, 0xEF, 0xAB, 0x19, 0x1E, 0x04,
+    0x98, 0x48, 0x85, 0x28, 0x23, 0x00, 0x08, 0x03, 0x4C, 0x24, 0x84, 0x8B, 0x57, 0x46, 0x00, 0x87,
+    0x28, 0xEE, 0x0C, 0x00, 0x03, 0x4C, 0xC4, 0x82, 0x33, 0xC4, 0x2B, 0x23, 0xA4, 0x06, 0x0E, 0x59,
+    0xF6, 0x19, 0x80, 0x89, 0x58, 0x70, 0xC4, 0x2B, 0x23, 0xA4, 0x06, 0x20, 0x13, 0xB1, 0xE0, 0x88,
+    0x32, 0x42, 0x6A, 0xE0, 0xD0, 0xAD, 0xA2, 0x81, 0x38, 0x88, 0x46, 0x42, 0x2A, 0x12, 0x12, 0x4D,
+    0x80, 0x81, 0x1C, 0x31, 0x03, 0x78, 0x7C, 0x47, 0x69, 0xA8, 0x9F, 0x69, 0xB8, 0xD6, 0x69, 0x08,
+    0x16, 0x82, 0x65, 0xD0, 0x68, 0x90, 0x4C, 0xE1, 0x01, 0x11, 0x02, 0x4C, 0xA4, 0x23, 0x1A, 0x14,
+    0x8D, 0x28, 0x23, 0x00, 0xC0, 0x8A, 0x88, 0x06, 0xCD, 0x92, 0x00, 0x84, 0x01, 0x26, 0xD2, 0x11,
+    0x0D, 0xE2, 0xE2, 0x95, 0x11, 0x00, 0x7A, 0x88, 0xFA, 0xD6, 0x00, 0x0E, 0x91, 0xAD, 0x1A, 0x06,
+    0x4A, 0x98, 0x11, 0x61, 0x31, 0x35, 0x80, 0x66, 0x1E, 0x92, 0x9E, 0x35, 0x00, 0x8D, 0x40, 0x4A,
+    0x94, 0x66, 0x45, 0x90, 0x51, 0x88, 0x0A, 0xC0, 0xE8, 0x50, 0x9A, 0x15, 0x41, 0x46, 0x58, 0xE0,
+    0x31, 0xFA, 0xAF, 0x41, 0x3E, 0xB2, 0x61, 0xB2, 0xB3, 0x01, 0x68, 0xE6, 0x01, 0x38, 0x57, 0xC3,
+    0x21, 0x72, 0x62, 0x03, 0x89, 0x50, 0x9A, 0x09, 0x13, 0x80, 0xC6, 0x64, 0x28, 0xCD, 0x84, 0x11,
+    0xC4, 0x01, 0xC8, 0x84, 0x38, 0x2D, 0x44, 0x69, 0x26, 0x8E, 0x18, 0x02, 0x11, 0x60, 0x22, 0x46,
+    0x86, 0xD2, 0x4C, 0x8C, 0x11, 0x16, 0x58, 0x0D, 0xDE, 0x6E, 0x10, 0xD0, 0x6F, 0x20, 0x49, 0x74,
+    0x30, 0x19, 0x75, 0x40, 0x71, 0x75, 0x60, 0xF0, 0x75, 0x70, 0x4F, 0x76, 0x88, 0x27, 0x77, 0x98,
+    0x1C, 0x78, 0xA0, 0x93, 0x79, 0x00, 0x1A, 0x83, 0x1C, 0x32, 0x49, 0x37, 0x8C, 0x08, 0x53, 0x88,
+    0x0B, 0x0B, 0x20, 0x9A, 0xD9, 0x61, 0x0A, 0x71, 0xE1, 0x05, 0x32, 0x00, 0x74, 0x38, 0x8F, 0xDE,
+    0x10, 0x4D, 0x40, 0x84, 0x23, 0x86, 0x29, 0xA6, 0x01, 0x40, 0x3C, 0xC4, 0xAF, 0x6F, 0x40, 0x16,
+    0x1C, 0x61, 0x8A, 0x11, 0xA9, 0x81, 0x04, 0x53, 0x4C, 0x03, 0xCE, 0x23, 0xC9, 0x8F, 0x03, 0x82,
+    0x95, 0xC3, 0x8C, 0xA0, 0x03, 0x38, 0x74, 0x54, 0x71, 0x20, 0x16, 0xC7, 0x1C, 0x62, 0x97, 0x38,
+    0xA0, 0x43, 0xD9, 0x0E, 0x07, 0x01, 0x58, 0x19, 0x28, 0x21, 0x27, 0x54, 0x49, 0xC0, 0x24, 0x33,
+    0x50, 0x42, 0x4E, 0x9C, 0x71, 0x40, 0x03, 0x4A, 0xC8, 0x35, 0x70, 0xB8, 0x78, 0xE3, 0x40, 0x2C,
+    0x8E, 0x81, 0x33, 0x02, 0x4A, 0xC8, 0x35, 0xC0, 0x31, 0x70, 0x45, 0x40, 0x09, 0xB9, 0x06, 0x0E,
+    0x27, 0x9E, 0x1C, 0x00, 0x67, 0x71, 0x0C, 0x44, 0x9A, 0x1D, 0x28, 0x21, 0x27, 0xCE, 0x00, 0x08,
+    0x61, 0x46, 0x88, 0x11, 0xD4, 0x00, 0x8F, 0xE2, 0x64, 0x0E, 0x0C, 0x6C, 0x0E, 0x53, 0x73, 0x0E,
+    0x80, 0x48, 0x28, 0x42, 0x01, 0x13, 0x21, 0xCC, 0x88, 0x11, 0xD4, 0x00, 0x88, 0x01, 0x01, 0x5A,
+    0x42, 0x28, 0x04, 0x20, 0xC4, 0xE1, 0x1C, 0x9F, 0xC3, 0x31, 0x0B, 0x06, 0x40, 0x01, 0xAB, 0xC0,
+    0x94, 0x04, 0x60, 0x0F, 0x69, 0x08, 0xA3, 0xC5, 0x00, 0x0E, 0x5D, 0x29, 0x1D, 0x80, 0x01, 0x47,
+    0x24, 0x13, 0xCA, 0x6A, 0xC0, 0x80, 0x35, 0x00, 0x83, 0x08, 0x32, 0x25, 0x18, 0xB4, 0x1A, 0x29,
+    0x4F, 0xA8, 0x03, 0xD0, 0x43, 0xE2, 0x71, 0x83, 0x60, 0xC1, 0x09, 0x45, 0xA6, 0x06, 0x0E, 0xAB,
+    0x6F, 0x1D, 0x24, 0x62, 0x34, 0xA0, 0x13, 0x00, 0x60, 0x35, 0x18, 0x31, 0x4B, 0x02, 0x87, 0xE0,
+    0xBE, 0x09, 0x88, 0x34, 0x01, 0x02, 0x49, 0x10, 0x2A, 0x80, 0xC5, 0x86, 0x6E, 0x07, 0xAA, 0x70,
+    0x07, 0x73, 0x48, 0x62, 0xED, 0x00, 0x34, 0x33, 0xC2, 0x20, 0x57, 0xC8, 0x00, 0x46, 0x01, 0x23,
+    0x0B, 0x18, 0x01, 0x64, 0x81, 0x45, 0xA2, 0x78, 0x07, 0x97, 0x7E, 0x07, 0xA0, 0x1D, 0x98, 0x8B,
+    0x0B, 0x68, 0x0C, 0x82, 0x21, 0x9A, 0xD9, 0x51, 0x88, 0x0B, 0x2F, 0x90, 0x01, 0x50, 0xCD, 0x88,
+    0x40, 0x8C, 0x2C, 0x70, 0x88, 0xE8, 0xF0, 0x20, 0x20, 0x0B, 0x69, 0x10, 0x2A, 0x05, 0xB0, 0x58,
+    0x56, 0xF2, 0xB0, 0xBE, 0xF2, 0x20, 0x0E, 0xC9, 0x3C, 0x1E, 0x80, 0x55, 0x90, 0x02, 0x58, 0x58,
+    0xDC, 0x78, 0xD0, 0xDC, 0x78, 0x80, 0x08, 0xC0, 0x2A, 0x10, 0x25, 0x01, 0x0B, 0x10, 0xE1, 0x84,
+    0x60, 0x1A, 0xD0, 0x8C, 0x04, 0xC4, 0xC8, 0x02, 0x9F, 0xA5, 0x55, 0x0F, 0x4E, 0x5B, 0x0F, 0x8F,
+    0x72, 0x0F, 0xF2, 0x7D, 0x0F, 0xD3, 0x1F, 0x10, 0x94, 0x34, 0x10, 0x36, 0x3A, 0x10, 0xC4, 0x84,
+    0x88, 0x06, 0x15, 0x86, 0x50, 0x00, 0x10, 0x13, 0x68, 0x2D, 0x06, 0x1C, 0x46, 0xA9, 0x3D, 0x08,
+    0x08, 0x30, 0x11, 0x23, 0xE3, 0x20, 0x25, 0xCA, 0x08, 0x0B, 0x08, 0x88, 0x51, 0x21, 0x0F, 0x32,
+    0x32, 0x2C, 0xE0, 0xC0, 0x2E, 0x60, 0x42, 0x9C, 0x16, 0x21, 0xCA, 0x10, 0x88, 0x80, 0x4D, 0xF2,
+    0xD2, 0x07, 0x24, 0xDC, 0x07, 0xF7, 0xF3, 0x07, 0x39, 0x02, 0x08, 0x2A, 0x07, 0x08, 0x5C, 0x0A,
+    0x08, 0x40, 0x1E, 0xCA, 0x6C, 0x3E, 0x20, 0xAD, 0xE0, 0x08, 0x02, 0x20, 0xCD, 0x04, 0x4C, 0x88,
+    0xD3, 0x2A, 0xCA, 0x10, 0x88, 0x80, 0xC3, 0x28, 0xD8, 0x07, 0xE6, 0x59, 0x48, 0x82, 0x4C, 0x01,
+    0x98, 0x80, 0x09, 0x71, 0x5A, 0x84, 0x40, 0x04, 0x2C, 0xCA, 0x10, 0x3F, 0xCC, 0x68, 0x3F, 0x0C,
+    0xA4, 0x41, 0xAC, 0x00, 0x0E, 0x67, 0xA3, 0x1F, 0x1A, 0x60, 0x22, 0x15, 0xE5, 0x1C, 0x41, 0xCA,
+    0x08, 0x00, 0xD1, 0x16, 0xC4, 0x91, 0x03, 0x66, 0x61, 0x02, 0x0E, 0x35, 0xCA, 0x1F, 0x80, 0x66,
+    0x36, 0x9C, 0x51, 0xC8, 0x00, 0x05, 0x67, 0x80, 0x45, 0x61, 0xBA, 0x07, 0xA9, 0xFB, 0x07, 0x44,
+    0x00, 0x26, 0x12, 0xA1, 0x44, 0x19, 0x01, 0x40, 0x04, 0x60, 0x42, 0x9C, 0x16, 0x52, 0xCE, 0x11,
+    0xA4, 0x0C, 0x81, 0x08, 0x00, 0x48, 0x12, 0xD0, 0xC8, 0x8C, 0x72, 0x8E, 0x20, 0x07, 0x00, 0x96,
+    0xD9, 0x50, 0x58, 0x1A, 0x00, 0x43, 0x4C, 0x11, 0x22, 0x3A, 0xDA, 0x7B, 0x61, 0x18, 0xA1, 0xC0,
+    0xE1, 0xB9, 0x0A, 0x04, 0x11, 0x21, 0xCE, 0x48, 0x40, 0x62, 0x01, 0xC4, 0x84, 0x88, 0x8C, 0x70,
+    0x06, 0x0C, 0x43, 0x28, 0x80, 0x21, 0x09, 0x87, 0xBD, 0x00, 0x10, 0xCB, 0x6A, 0xA0, 0x37, 0xA4,
+    0x04, 0x2E, 0xC9, 0xAE, 0x20, 0x0E, 0xC5, 0x20, 0x5C, 0x25, 0x21, 0x22, 0x36, 0x21, 0xA6, 0x49,
+    0x21, 0x00, 0xA4, 0x25, 0x8C, 0x22, 0x08, 0xC0, 0x3C, 0x13, 0xD2, 0x98, 0x8C, 0x11, 0x5E, 0x1C,
+    0x82, 0x38, 0xB0, 0x88, 0x94, 0x07, 0xE1, 0x7A, 0x08, 0x41, 0x0E, 0x1B, 0xE7, 0x20, 0x10, 0x79,
+    0x30, 0x3D, 0x82, 0x80, 0x00, 0x5A, 0x82, 0x28, 0x04, 0x20, 0xE4, 0xE1, 0xE4, 0x20, 0x04, 0x6B,
+    0x08, 0xE2, 0x3C, 0xD0, 0x10, 0xC4, 0x19, 0x40, 0x84, 0x48, 0xC4, 0xE8, 0x60, 0x03, 0x22, 0x23,
+    0x4E, 0x58, 0x40, 0xD4, 0x10, 0x38, 0x62, 0x20, 0x43, 0x42, 0x03, 0x90, 0x80, 0x9A, 0x48, 0xC5,
+    0x30, 0x42, 0xB2, 0x11, 0xC0, 0x22, 0x1A, 0x32, 0x44, 0xBC, 0x33, 0x04, 0x39, 0x6C, 0xC4, 0x85,
+    0x60, 0x87, 0xCF, 0x5D, 0x06, 0x33, 0x20, 0x0E, 0xB0, 0x38, 0x1A, 0xFD, 0x20, 0x47, 0x0C, 0x41,
+    0x8C, 0x82, 0x15, 0x16, 0x38, 0x40, 0x90, 0x63, 0x30, 0x21, 0x03, 0x49, 0x60, 0x2B, 0x80, 0x43,
+    0xE7, 0x6C, 0x08, 0x24, 0xA0, 0xE6, 0x41, 0x5C, 0x07, 0x00, 0x01, 0x99, 0x10, 0x42, 0x86, 0x18,
+    0xA4, 0xC4, 0x10, 0xE1, 0x80, 0xC9, 0x78, 0x7F, 0x08, 0xB9, 0x84, 0x88, 0x79, 0x8B, 0x88, 0x2B,
+    0xF2, 0x88, 0x71, 0x88, 0xD0, 0x4C, 0x40, 0x20, 0x8D, 0x40, 0x22, 0x44, 0x20, 0x2A, 0x00, 0x0E,
+    0x03, 0x4C, 0xC4, 0xC8, 0x18, 0xE8, 0x95, 0x11, 0x16, 0x30, 0x45, 0x00, 0xB2, 0x20, 0xA0, 0xE4,
+    0x07, 0xB1, 0x33, 0x4C, 0x49, 0xA2, 0x80, 0x43, 0xA7, 0xCA, 0x88, 0xB3, 0xE8, 0x34, 0x14, 0x11,
+    0xA1, 0x18, 0x41, 0x16, 0xE3, 0x67, 0x22, 0xA6, 0x6D, 0x22, 0x1A, 0x01, 0x01, 0x26, 0x12, 0x31,
+    0x84, 0x2A, 0x23, 0x80, 0x02, 0x64, 0x00, 0x44, 0x00, 0x26, 0xC4, 0x69, 0x1D, 0x64, 0x08, 0x55,
+    0x86, 0x40, 0x04, 0x1C, 0xC6, 0x8B, 0x45, 0x04, 0x88, 0x63, 0x44, 0xC0, 0x73, 0x0E, 0x31, 0xB6,
+    0x22, 0x10, 0xD1, 0x82, 0xA4, 0x40, 0xCE, 0x94, 0x08, 0x85, 0x02, 0x29, 0x48, 0x0A, 0xE4, 0x4C,
+    0x89, 0xB0, 0x81, 0x43, 0x44, 0xB8, 0x08, 0x60, 0x42, 0x2A, 0x12, 0x21, 0x46, 0x19, 0x62, 0x06,
+    0x60, 0x2E, 0x12, 0x89, 0x0E, 0xA0, 0xEF, 0x45, 0x1C, 0xB8, 0xA0, 0x81, 0xC3, 0x4A, 0xC2, 0x08,
+    0x72, 0x10, 0x4F, 0x13, 0x80, 0x24, 0x94, 0x21, 0x66, 0x00, 0x9C, 0x08, 0x99, 0x10, 0x42, 0x76,
+    0x20, 0x23, 0x86, 0x08, 0x07, 0x2C, 0x32, 0xD7, 0x46, 0x44, 0x55, 0x47, 0x88, 0xC3, 0xB9, 0xD5,
+    0x88, 0x63, 0x72, 0x1A, 0x87, 0x92, 0x11, 0x10, 0x11, 0xC4, 0x0E, 0xE0, 0x34, 0x0E, 0x25, 0x2B,
+    0xE0, 0x80, 0x88, 0x20, 0x76, 0xC0, 0x22, 0xEA, 0x70, 0x84, 0xDB, 0x72, 0x04, 0x30, 0x21, 0xE2,
+    0x60, 0xBD, 0x3F, 0x40, 0x80, 0x2C, 0x24, 0x02, 0x49, 0x91, 0x02, 0xD0, 0x38, 0x8C, 0x43, 0xC9,
+    0x0E, 0x82, 0x1E, 0x62, 0x07, 0x1C, 0x6A, 0x83, 0x47, 0x20, 0x13, 0x8E, 0x80, 0xC8, 0x88, 0xD1,
+    0x40, 0x02, 0x44, 0x06, 0x40, 0xD6, 0xE1, 0x02, 0x7C, 0x04, 0x10, 0xE1, 0x04, 0x51, 0x4C, 0x03,
+    0x87, 0x08, 0x05, 0x12, 0x40, 0x3C, 0xC4, 0x07, 0x90, 0x40, 0x08, 0x59, 0x21, 0x8A, 0x11, 0xE1,
+    0x80, 0x06, 0x51, 0x4C, 0x03, 0x80, 0x78, 0x88, 0x21, 0x21, 0x81, 0x10, 0x32, 0x43, 0x14, 0x23,
+    0xC2, 0x01, 0x11, 0xA2, 0x98, 0x06, 0x16, 0x49, 0xF0, 0x24, 0x50, 0xFE, 0x24, 0xC0, 0xE1, 0xD2,
+    0x96, 0x04, 0xB2, 0x16, 0x43, 0x95, 0x24, 0x90, 0xA0, 0x24, 0xC0, 0x22, 0x3A, 0x90, 0xC4, 0xAA,
+    0x91, 0x44, 0x38, 0x5C, 0xCF, 0x91, 0x20, 0x01, 0x29, 0x00, 0xC8, 0x84, 0x1B, 0x44, 0x12, 0xA3,
+    0x01, 0xC1, 0x42, 0x1A, 0x64, 0x0A, 0xE0, 0x20, 0x80, 0xF5, 0xC1, 0x42, 0x12, 0x8A, 0x4C, 0x01,
+    0x1C, 0x06, 0x3A, 0x07, 0x00, 0xC1, 0x42, 0x22, 0x8A, 0x4C, 0x01, 0x1C, 0x22, 0xBF, 0x49, 0x80,
+    0xC3, 0xB6, 0x35, 0x89, 0x60, 0x21, 0x11, 0x22, 0x15, 0x99, 0x02, 0x20, 0x90, 0x00, 0x18, 0x00,
+    0x20, 0x58, 0x48, 0x85, 0x48, 0x45, 0xA6, 0x00, 0x44, 0x80, 0x41, 0x0E, 0x08, 0xD0, 0x14, 0x0E,
+    0x17, 0x1B, 0x25, 0x80, 0x05, 0x08, 0x16, 0x92, 0x51, 0x44, 0x2A, 0x32, 0x05, 0x00, 0x08, 0x16,
+    0x52, 0x51, 0x44, 0x2A, 0x32, 0x05, 0x70, 0x48, 0xFE, 0x29, 0x01, 0xC4, 0x03, 0x12, 0x60, 0x08,
+    0x05, 0xB5, 0x1A, 0x2A, 0x4B, 0xE0, 0x52, 0x6D, 0x5C, 0x62, 0xE1, 0x5C, 0xA2, 0xF5, 0x5D, 0xC2,
+    0xF5, 0x62, 0x42, 0xBE, 0x63, 0x42, 0x2C, 0x92, 0x10, 0x4B, 0x28, 0x32, 0x4B, 0x00, 0x0C, 0x89,
+    0x08, 0xAA, 0xBC, 0x00, 0x00, 0x94, 0x44, 0x32, 0x82, 0x2A, 0xEC, 0x04, 0x70, 0x18, 0x9B, 0x2D,
+    0x61, 0x38, 0x11, 0xD5, 0x8C, 0x08, 0x83, 0x18, 0x59, 0x80, 0x43, 0x35, 0x83, 0xAC, 0x70, 0x06,
+    0x31, 0xB2, 0x0E, 0x20, 0x0A, 0x14, 0x06, 0x87, 0x64, 0xC7, 0x01, 0xEB, 0x00, 0x68, 0x8A, 0xE1,
+    0x71, 0x04, 0x60, 0x42, 0xD5, 0x60, 0x22, 0xBE, 0x61, 0x02, 0x68, 0x1A, 0x40, 0x26, 0x94, 0x03,
+    0x58, 0xC8, 0x74, 0x0A, 0xD6, 0x80, 0x40, 0x44, 0x3D, 0x02, 0x2E, 0x18, 0xAA, 0x01, 0xD4, 0x33,
+    0x09, 0xB8, 0x02, 0x1B, 0x16, 0x87, 0x6A, 0x00, 0x35, 0x23, 0x8A, 0x44, 0x6C, 0x00, 0xE8, 0x40,
+    0x9C, 0x3E, 0x00, 0xA0, 0x12, 0x8A, 0xC2, 0x60, 0x57, 0x9C, 0x76, 0x62, 0xD4, 0x81, 0x82, 0x48,
+    0x62, 0xA0, 0xA0, 0x82, 0xC2, 0x44, 0x83, 0xE2, 0xD0, 0x8A, 0x62, 0x81, 0x8F, 0x82, 0x05, 0x9B,
+    0xA2, 0xFD, 0x9B, 0x22, 0x92, 0xA0, 0x42, 0x72, 0xA1, 0x62, 0xAE, 0xA2, 0x82, 0x82, 0xA4, 0xC2,
+    0xBA, 0xA5, 0x02, 0x3C, 0xCA, 0xE4, 0x4D, 0x4C, 0x14, 0x4E, 0xD0, 0x35, 0x4E, 0x88, 0xC5, 0x43,
+    0xB6, 0x09, 0x7A, 0xB9, 0x09, 0x80, 0x92, 0x48, 0x85, 0x2A, 0xEC, 0x04, 0x80, 0x00, 0x46, 0x02,
+    0x0C, 0x65, 0x01, 0x12, 0x89, 0x50, 0x85, 0x9D, 0x00, 0x4C, 0x08, 0xB0, 0x20, 0x13, 0x0E, 0x39,
+    0x43, 0x94, 0x24, 0x46, 0x03, 0x90, 0x82, 0x5A, 0x11, 0x6C, 0x88, 0xCA, 0x12, 0x38, 0x9C, 0x62,
+    0x9D, 0x88, 0x1C, 0x21, 0x02, 0x87, 0x53, 0xA2, 0x13, 0x02, 0x2E, 0x61, 0x26, 0x14, 0xA6, 0x4C,
+    0x51, 0x0D, 0x40, 0x44, 0x0A, 0x33, 0xA1, 0x30, 0x65, 0xCA, 0x10, 0x0A, 0xC0, 0x0A, 0x6A, 0x59,
+    0x74, 0x85, 0xA8, 0x2C, 0x81, 0x47, 0x61, 0xF6, 0x09, 0xF7, 0xF9, 0x09, 0x9A, 0x02, 0x0A, 0x70,
+    0x48, 0x0B, 0x3D, 0xC1, 0x0E, 0x89, 0x97, 0x27, 0x00, 0x52, 0x10, 0x00, 0xD9, 0x80, 0x5E, 0x38,
+    0x80, 0x3C, 0xD4, 0x54, 0x9F, 0x20, 0x8F, 0x00, 0x7F, 0x00, 0x33, 0x86, 0x00, 0xF8, 0xE4, 0x13,
+    0x4E, 0x29, 0xA0, 0xA8, 0x02, 0x0E, 0x4D, 0xA0, 0x0D, 0x31, 0x10, 0x10, 0x00, 0x80, 0x92, 0x48,
+    0x44, 0x61, 0x27, 0x80, 0x43, 0xCA, 0xFF, 0x09, 0xB6, 0x40, 0x24, 0x31, 0xC0, 0x24, 0x31, 0x40,
+    0x22, 0x0D, 0x85, 0x9D, 0x00, 0x0E, 0x01, 0xFF, 0x27, 0x24, 0x92, 0x50, 0xD8, 0x09, 0x80, 0x13,
+    0x91, 0x86, 0x8A, 0x4C, 0x00, 0x1C, 0x22, 0x16, 0x98, 0x00, 0x0E, 0x51, 0x7B, 0x28, 0x0C, 0xA4,
+    0x3D, 0xA2, 0xC1, 0x50, 0x48, 0xDD, 0x50, 0x68, 0xEB, 0x50, 0x10, 0x31, 0x42, 0x10, 0x12, 0x0C,
+    0xD0, 0x98, 0x0A, 0x41, 0x88, 0x20, 0x0E, 0x34, 0x08, 0x72, 0x40, 0x83, 0x20, 0x40, 0x3B, 0x6C,
+    0x91, 0xA2, 0x40, 0xDA, 0x21, 0x22, 0x13, 0x85, 0x49, 0x20, 0x82, 0x38, 0xA0, 0x31, 0x11, 0x44,
+    0x10, 0x07, 0x20, 0x26, 0x80, 0x38, 0x00, 0x2C, 0x22, 0x9B, 0x51, 0xD4, 0xB7, 0x51, 0x04, 0x15,
+    0xE2, 0x50, 0xB1, 0x62, 0x0A, 0x64, 0x80, 0x0A, 0x71, 0x62, 0xC4, 0x14, 0xC8, 0x80, 0x43, 0x87,
+    0x3B, 0x0A, 0xC4, 0xA1, 0x62, 0x81, 0x01, 0xA8, 0x98, 0x20, 0x90, 0x01, 0x8B, 0x28, 0xAF, 0x14,
+    0x6B, 0xC5, 0x14, 0xE4, 0x10, 0x05, 0x92, 0x02, 0x30, 0xA8, 0x88, 0x18, 0x09, 0xC1, 0x84, 0x05,
+    0x16, 0x8B, 0x37, 0x29, 0xAA, 0x3E, 0x29, 0xC8, 0x41, 0x6D, 0xB2, 0x40, 0x82, 0x08, 0x15, 0x2C,
+    0x92, 0x26, 0x0B, 0x20, 0x37, 0x0B, 0x00, 0xC1, 0x42, 0x32, 0x44, 0x98, 0x45, 0xA6, 0x00, 0x16,
+    0x0D, 0x77, 0x29, 0x6A, 0x82, 0x29, 0x88, 0x72, 0x40, 0xEE, 0x49, 0x80, 0x62, 0x0D, 0x4E, 0xB0,
+    0x07, 0x90, 0x82, 0x30, 0x03, 0x38, 0xB4, 0x7C, 0xA6, 0x40, 0x0C, 0x72, 0x10, 0xFB, 0x9B, 0x80,
+    0x00, 0xA6, 0x83, 0x88, 0x11, 0x03, 0x06, 0x03, 0x50, 0x12, 0xC1, 0xB4, 0x83, 0xC9, 0x7E, 0x83,
+    0x45, 0xE3, 0x76, 0x0A, 0x04, 0x79, 0x0A, 0xA2, 0x40, 0xC4, 0x01, 0x98, 0x7A, 0x04, 0x9D, 0x20,
+    0x88, 0x03, 0x0A, 0x74, 0x38, 0x07, 0x50, 0x21, 0x20, 0xC0, 0xCA, 0x08, 0x55, 0x28, 0x51, 0x12,
+    0x68, 0x08, 0x55, 0x0C, 0xC0, 0x00, 0x18, 0x77, 0xD0, 0x96, 0xE7, 0x80, 0x40, 0x0C, 0xA4, 0x31,
+    0x15, 0x22, 0x38, 0x41, 0x1C, 0x38, 0xB4, 0xFD, 0xA8, 0x20, 0x88, 0x96, 0x70, 0x43, 0x20, 0x00,
+    0xD1, 0x02, 0x02, 0x01, 0x26, 0xA4, 0xA0, 0x56, 0x45, 0x61, 0x43, 0x54, 0x96, 0xC0, 0xE1, 0x2C,
+    0x4E, 0x05, 0x41, 0xB4, 0x86, 0x71, 0x43, 0x20, 0x00, 0x41, 0xB4, 0x88, 0x71, 0x43, 0x20, 0xE0,
+    0x71, 0x2D, 0xAC, 0xA2, 0x31, 0xAF, 0x22, 0x1F, 0xB0, 0xC2, 0x40, 0xDA, 0x61, 0x23, 0x56, 0x05,
+    0xD2, 0x98, 0x8C, 0xE0, 0x04, 0x21, 0x82, 0x38, 0x00, 0x69, 0x4C, 0x47, 0x70, 0x82, 0x10, 0x41,
+    0x1C, 0x38, 0x5C, 0x5C, 0xAB, 0x00, 0x26, 0x72, 0x10, 0xC3, 0x46, 0x00, 0x69, 0x0C, 0x0A, 0x58,
+    0x10, 0x89, 0x95, 0x08, 0xE2, 0x58, 0x49, 0xE2, 0x3C, 0xC0, 0x61, 0x90, 0x06, 0x58, 0x09, 0x25,
+    0x01, 0x19, 0x10, 0x91, 0x86, 0x62, 0x4C, 0x00, 0x8B, 0xE4, 0x9C, 0x15, 0xE8, 0xA3, 0x15, 0x00,
+    0xC2, 0x0E, 0x35, 0x34, 0x2B, 0x88, 0xD1, 0xF0, 0xC2, 0x02, 0x09, 0x2F, 0x00, 0x92, 0x44, 0xC5,
+    0x03, 0x42, 0x77, 0x0A, 0x53, 0xA6, 0x44, 0x04, 0x62, 0x4A, 0x7C, 0x12, 0x23, 0x63, 0x23, 0x82,
+    0x03, 0x9F, 0xA0, 0x17, 0x13, 0x6C, 0xD4, 0x15, 0x4D, 0xE6, 0x15, 0xAE, 0xEE, 0x15, 0x71, 0xF2,
+    0x15, 0xD4, 0xF8, 0x15, 0xF7, 0xAF, 0x0C, 0x03, 0x36, 0x04, 0x14, 0xB2, 0x0C, 0x44, 0xEC, 0x90,
+    0x4C, 0xA4, 0x15, 0x0C, 0x10, 0x00, 0xF1, 0x90, 0xE9, 0xBB, 0x62, 0x1C, 0x10, 0x8F, 0x1B, 0x20,
+    0x9A, 0xD9, 0xB0, 0x5E, 0x20, 0x03, 0x18, 0x80, 0x08, 0x47, 0x30, 0xB2, 0x8A, 0x69, 0x80, 0xA3,
+    0x0A, 0x30, 0xA0, 0x10, 0x3A, 0xC2, 0x20, 0x1C, 0xC0, 0x21, 0xCE, 0x80, 0x45, 0x33, 0x44, 0xB8,
+    0xA0, 0x98, 0x06, 0x00, 0xED, 0x70, 0x02, 0xC2, 0x42, 0xC0, 0x19, 0x0C, 0xB5, 0x42, 0x54, 0x03,
+    0x15, 0x0C, 0xB5, 0x42, 0x06, 0x78, 0x24, 0xCB, 0xB1, 0x40, 0xED, 0xB2, 0x70, 0xA7, 0xB4, 0x00,
+    0x87, 0xB2, 0x2D, 0x16, 0x83, 0x00, 0x48, 0xB3, 0x02, 0x95, 0xA5, 0xCA, 0x19, 0x00, 0xB2, 0x2C,
+    0x08, 0xD0, 0x4A, 0xBC, 0x29, 0x59, 0x24, 0x51, 0x08, 0x58, 0x44, 0x58, 0xB2, 0x98, 0x78, 0xB2,
+    0x00, 0x94, 0xE9, 0x70, 0x28, 0xE3, 0x34, 0x18, 0xC4, 0x1C, 0x04, 0x07, 0xC5, 0x9B, 0x14, 0x0E,
+    0x72, 0x18, 0x8B, 0x65, 0xD1, 0x0A, 0x4C, 0x20, 0x00, 0xD1, 0x1A, 0x4C, 0x20, 0x60, 0x91, 0xE9,
+    0xCE, 0x62, 0x12, 0xD0, 0x62, 0x1D, 0xAE, 0xC3, 0x59, 0x20, 0x40, 0x33, 0x1B, 0x92, 0x28, 0x64,
+    0x00, 0x40, 0x33, 0x13, 0x44, 0x21, 0x03, 0x20, 0xA4, 0xC9, 0x69, 0x48, 0xC5, 0x19, 0x88, 0x04,
+    0x70, 0x38, 0xCB, 0x68, 0x81, 0x00, 0x2D, 0xC3, 0x1B, 0x31, 0x8A, 0x20, 0x00, 0x22, 0x9D, 0x0E,
+    0x6F, 0xC4, 0x10, 0x07, 0x82, 0xC3, 0x41, 0x5B, 0x0B, 0x70, 0x38, 0x6A, 0x6A, 0x21, 0x00, 0xD2,
+    0x44, 0x8C, 0x8A, 0xA5, 0xCA, 0x19, 0xE0, 0x10, 0x63, 0x3F, 0x00, 0x10, 0x00, 0x69, 0x42, 0x1A,
+    0xD3, 0xA1, 0xCA, 0x19, 0x82, 0x38, 0x40, 0x00, 0xA4, 0x19, 0x51, 0x96, 0x2A, 0x67, 0x80, 0x4B,
+    0x94, 0x71, 0x0B, 0x27, 0x76, 0x8B, 0x08, 0x7A, 0x0B, 0x49, 0x7D, 0x8B, 0x69, 0x20, 0x83, 0x61,
+    0x1C, 0x22, 0x6C, 0x5B, 0x00, 0xA7, 0xC2, 0xB3, 0xB5, 0x60, 0x01, 0xA4, 0x99, 0xE1, 0xD9, 0x5A,
+    0x50, 0x9C, 0x01, 0x48, 0x0D, 0x21, 0xC9, 0x8A, 0x23, 0x48, 0x38, 0x07, 0x00, 0x1A, 0x01, 0x37,
+    0xB4, 0x42, 0x54, 0x03, 0x22, 0x84, 0x18, 0x0D, 0x22, 0x2C, 0xB0, 0xD8, 0x7A, 0x70, 0x21, 0xEB,
+    0x70, 0x81, 0x34, 0xE4, 0x40, 0x66, 0x2F, 0x01, 0x21, 0xC9, 0x06, 0x41, 0xC2, 0x39, 0x00, 0xD2,
+    0x10, 0x92, 0xAC, 0x10, 0x24, 0x9C, 0x03, 0x56, 0x0F, 0xA1, 0x2E, 0x16, 0xC7, 0x2E, 0xD8, 0x9A,
+    0x2F, 0xDA, 0xEC, 0x2F, 0xDC, 0x8E, 0x30, 0x1E, 0x9A, 0x30, 0x62, 0xED, 0x30, 0x64, 0x6F, 0x32,
+    0xE6, 0xF6, 0x32, 0x28, 0x3A, 0x34, 0xC4, 0xE1, 0x61, 0xC4, 0x00, 0x3D, 0x94, 0x4D, 0xBA, 0x58,
+    0x80, 0x89, 0x88, 0x19, 0x49, 0xB1, 0x54, 0x06, 0x32, 0x00, 0x21, 0x23, 0x98, 0x62, 0x27, 0x1C,
+    0x70, 0x18, 0xF9, 0x75, 0x01, 0x44, 0xC2, 0x44, 0xC4, 0x0E, 0x58, 0x4C, 0x51, 0x23, 0x18, 0x70,
+    0x00, 0x5E, 0x75, 0x31, 0x29, 0x26, 0x78, 0x41, 0x9A, 0x79, 0x81, 0x16, 0x7A, 0x41, 0xC9, 0x7A,
+    0x01, 0x0E, 0xDB, 0xF6, 0x2E, 0x02, 0x22, 0x36, 0x08, 0x19, 0x0C, 0x30, 0x10, 0x31, 0x22, 0x90,
+    0x55, 0x0C, 0x40, 0xAD, 0xC5, 0x85, 0xC8, 0x0B, 0x69, 0xCB, 0x0B, 0x60, 0x22, 0x07, 0xF1, 0x33,
+    0x11, 0x80, 0x89, 0x34, 0x94, 0x11, 0x40, 0x00, 0x3B, 0x40, 0x33, 0x10, 0x31, 0xA2, 0x90, 0x55,
+    0x0C, 0x60, 0x44, 0xC0, 0x73, 0xE0, 0x8C, 0x24, 0x9C, 0x29, 0x11, 0x36, 0x70, 0xB8, 0x5C, 0x7C,
+    0x21, 0x0E, 0xE9, 0x7A, 0x2F, 0x16, 0x60, 0x22, 0x15, 0x8A, 0xA5, 0x32, 0x02, 0xB0, 0x00, 0x13,
+    0xC9, 0x50, 0x2C, 0x95, 0x11, 0x00, 0x60, 0x22, 0x11, 0x8A, 0xA5, 0x32, 0x02, 0x58, 0x74, 0xFA,
+    0xBE, 0x78, 0x43, 0xBF, 0x08, 0x22, 0xC4, 0x20, 0x1D, 0xBD, 0x3C, 0x69, 0xC4, 0x72, 0x01, 0x28,
+    0x16, 0xC0, 0x20, 0x11, 0xAC, 0xA6, 0xE2, 0x02, 0x00, 0x0E, 0x91, 0xE5, 0x2F, 0x0C, 0xA4, 0x25,
+    0x08, 0x47, 0x80, 0x16, 0xE0, 0x08, 0x38, 0x6C, 0xD8, 0xC0, 0x18, 0x87, 0x68, 0x07, 0x18, 0xC0,
+    0x00, 0x4C, 0x24, 0x42, 0xAC, 0x32, 0x02, 0x38, 0x1C, 0x8D, 0xC0, 0x00, 0x26, 0x92, 0xB0, 0xCA,
+    0x08, 0xE0, 0x10, 0x21, 0xF2, 0x62, 0x02, 0x07, 0x04, 0xBD, 0x04, 0x8B, 0x6D, 0x2A, 0x18, 0xCE,
+    0x2E, 0x18, 0x88, 0x34, 0x11, 0xB1, 0x42, 0x9C, 0x11, 0x0C, 0xE0, 0xCC, 0x04, 0x34, 0xC0, 0xE1,
+    0xF4, 0x0E, 0x46, 0x83, 0x08, 0xC0, 0xCA, 0x40, 0x44, 0xA8, 0x92, 0x00, 0x60, 0x42, 0x9C, 0x56,
+    0x82, 0x08, 0x41, 0xA3, 0x0C, 0x81, 0x08, 0x20, 0xCD, 0x06, 0x54, 0xCE, 0x00, 0x8B, 0xC8, 0xCD,
+    0x01, 0xF3, 0x5F, 0x18, 0x44, 0x14, 0x20, 0x0B, 0x32, 0xE1, 0x8E, 0x22, 0x45, 0x12, 0xA3, 0x81,
+    0x43, 0x1A, 0x35, 0x0C, 0x04, 0x58, 0x0D, 0x62, 0x94, 0x04, 0x0E, 0x23, 0xE6, 0x30, 0x88, 0x51,
+    0x60, 0xC2, 0x02, 0x46, 0x40, 0x58, 0x60, 0x53, 0xA8, 0x13, 0x83, 0x28, 0x14, 0x03, 0x6D, 0x15,
+    0xA3, 0xF9, 0x16, 0x23, 0xA2, 0x1A, 0x63, 0xE2, 0x20, 0x03, 0x10, 0x87, 0xA7, 0x56, 0x17, 0x13,
+    0x11, 0x21, 0x19, 0x31, 0x52, 0x60, 0x31, 0x45, 0x8D, 0x60, 0x44, 0x0E, 0x0B, 0x1C, 0x80, 0x0E,
+    0x5C, 0x1C, 0x22, 0x4C, 0x0C, 0x14, 0xD4, 0x3A, 0x58, 0xC4, 0x3D, 0x20, 0x31, 0xC0, 0x84, 0x88,
+    0x10, 0x58, 0x8C, 0x38, 0xAF, 0x0C, 0xA1, 0xC0, 0x22, 0x11, 0x32, 0x06, 0x52, 0x33, 0x06, 0x60,
+    0x20, 0xA4, 0xA3, 0x17, 0x43, 0x82, 0x13, 0x01, 0x30, 0x48, 0x42, 0x71, 0x01, 0x30, 0x0B, 0xC4,
+    0xC9, 0x18, 0xE8, 0xC0, 0x18, 0x8B, 0x68, 0xEA, 0x18, 0x18, 0x02, 0x19, 0xE4, 0x30, 0xB2, 0x1C,
+    0x83, 0x88, 0x0D, 0x21, 0x18, 0x40, 0x36, 0x84, 0x60, 0x0E, 0x10, 0x0E, 0x89, 0xF2, 0x31, 0x02,
+    0x02, 0x68, 0x25, 0xBD, 0x18, 0x21, 0x65, 0x28, 0x04, 0x00, 0x5A, 0x48, 0x2F, 0x46, 0x48, 0x19,
+    0x0A, 0x01, 0x1A, 0x53, 0x20, 0x88, 0x03, 0x8F, 0x27, 0x1A, 0x19, 0xC8, 0x26, 0x19, 0xF1, 0x31,
+    0x19, 0x43, 0x84, 0x0C, 0x06, 0xA9, 0x30, 0x62, 0xB9, 0x00, 0x38, 0x46, 0x04, 0x3C, 0x07, 0x11,
+    0x43, 0x90, 0x33, 0x25, 0xC2, 0x60, 0x80, 0x75, 0x48, 0x84, 0x8C, 0x81, 0x0C, 0x06, 0x69, 0x28,
+    0x2E, 0x00, 0x88, 0x41, 0x0A, 0x96, 0x0B, 0x60, 0x51, 0xCA, 0x28, 0x83, 0x1E, 0x2B, 0x83, 0x98,
+    0x26, 0xD2, 0x70, 0xC2, 0x18, 0x01, 0x1C, 0xBA, 0x4A, 0x65, 0x00, 0x96, 0x13, 0xE1, 0x08, 0x74,
+    0x8B, 0x69, 0x80, 0x05, 0xC4, 0x83, 0x78, 0xBC, 0x88, 0x45, 0x04, 0xB2, 0x8C, 0x25, 0xB5, 0x0C,
+    0x92, 0xC0, 0x4E, 0x00, 0x1A, 0x13, 0xC1, 0x8E, 0x20, 0x0E, 0x00, 0xE6, 0x21, 0xD6, 0x5D, 0x06,
+    0x42, 0xC8, 0x8A, 0x92, 0x86, 0x08, 0x07, 0x34, 0x94, 0x34, 0x1A, 0x78, 0x24, 0xBA, 0xCD, 0x38,
+    0x11, 0xCF, 0x98, 0xAD, 0xCF, 0x00, 0x87, 0x0F, 0xA9, 0x19, 0x86, 0x13, 0x0F, 0xB1, 0x48, 0x33,
+    0xD0, 0x61, 0x0E, 0x67, 0x06, 0x21, 0x33, 0x82, 0x43, 0x46, 0x84, 0x03, 0x10, 0xA3, 0x23, 0x38,
+    0x64, 0x44, 0x0E, 0x0B, 0x44, 0x04, 0x87, 0x4C, 0x03, 0x90, 0x65, 0x1D, 0x92, 0xBF, 0x66, 0x00,
+    0x31, 0x23, 0x98, 0x28, 0x52, 0x2A, 0x06, 0x1C, 0xC6, 0x16, 0x67, 0x3C, 0xC8, 0xB2, 0x00, 0xB1,
+    0xC2, 0x44, 0x91, 0x52, 0x31, 0xE0, 0xF0, 0x6D, 0x3A, 0xC3, 0x70, 0x22, 0x24, 0x23, 0x19, 0x0E,
+    0x19, 0x91, 0x03, 0x80, 0xAC, 0xC3, 0xE5, 0xEE, 0x0C, 0x20, 0x16, 0xA4, 0x62, 0x00, 0x22, 0x16,
+    0x14, 0x03, 0x0E, 0xDD, 0xD8, 0x33, 0x16, 0x44, 0x24, 0xA0, 0x24, 0x14, 0xB0, 0x38, 0x02, 0x22,
+    0xB1, 0x08, 0xA1, 0xC4, 0x79, 0xE0, 0x70, 0x2D, 0x42, 0x83, 0x88, 0x1E, 0x64, 0x1D, 0x2E, 0x25,
+    0x68, 0x00, 0xB1, 0x23, 0x98, 0x28, 0x52, 0x2A, 0x06, 0x00, 0x62, 0x48, 0x30, 0x51, 0xA4, 0x54,
+    0x0C, 0x40, 0x48, 0x07, 0xF2, 0x4A, 0x64, 0x19, 0x23, 0x85, 0x03, 0x45, 0x04, 0x87, 0xB2, 0x26,
+    0x1A, 0x87, 0x31, 0x13, 0x1C, 0x1C, 0x00, 0xB0, 0x20, 0x13, 0x42, 0xC8, 0x90, 0xC3, 0x4A, 0x1A,
+    0x22, 0x1C, 0x30, 0xB9, 0x7C, 0xA4, 0xC1, 0xAE, 0xA5, 0xD1, 0xB0, 0xA7, 0x11, 0xFB, 0xAB, 0x01,
+    0x48, 0x40, 0xAC, 0xE8, 0x25, 0x9C, 0x62, 0xC0, 0xE1, 0x2A, 0x95, 0x86, 0x80, 0x50, 0x32, 0xA3,
+    0x87, 0x74, 0x04, 0x3B, 0xC0, 0x03, 0x8C, 0x03, 0xA4, 0x37, 0x01, 0xE4, 0x70, 0xEE, 0x4C, 0xA3,
+    0x99, 0x80, 0x08, 0x47, 0x8C, 0x60, 0x1A, 0x00, 0xC4, 0x45, 0x64, 0x3A, 0x0D, 0x7C, 0x97, 0x07,
+    0x02, 0x37, 0x04, 0xD3, 0x00, 0x42, 0x46, 0x04, 0x23, 0xC2, 0x01, 0x8B, 0xB2, 0x87, 0x1A, 0xB3,
+    0x91, 0x1A, 0x02, 0x25, 0x13, 0x0E, 0x3B, 0x00, 0x15, 0x0B, 0x90, 0xB1, 0x54, 0x05, 0x72, 0x98,
+    0x09, 0x60, 0x31, 0x56, 0x54, 0x83, 0x3A, 0x56, 0x83, 0x68, 0x26, 0xA2, 0x41, 0x80, 0x55, 0x41,
+    0x44, 0x49, 0x00, 0x3D, 0xC4, 0x72, 0xD5, 0x40, 0x08, 0x19, 0xC1, 0x8C, 0x08, 0x07, 0x24, 0x30,
+    0xD3, 0x80, 0x79, 0x88, 0xCD, 0xAB, 0x81, 0x10, 0xB2, 0xC1, 0x88, 0x70, 0x40, 0x81, 0x69, 0x60,
+    0x12, 0x75, 0x5A, 0xC3, 0x91, 0x5F, 0x63, 0x5A, 0x60, 0xA3, 0xD6, 0x62, 0x03, 0x98, 0x90, 0xD6,
+    0x30, 0x8A, 0x20, 0x00, 0xE3, 0xB4, 0x43, 0xEC, 0x7B, 0x0D, 0xB4, 0x48, 0x8E, 0xAE, 0xE1, 0xFA,
+    0xAE, 0x01, 0xAC, 0x8C, 0xF0, 0x10, 0x11, 0x25, 0x01, 0x32, 0x23, 0x3C, 0x44, 0x44, 0x38, 0x00,
+    0x25, 0x3B, 0xC2, 0x43, 0x44, 0x20, 0x76, 0x40, 0x44, 0x78, 0x88, 0x34, 0x80, 0x71, 0xDA, 0x01,
+    0xF6, 0xBD, 0xC6, 0x21, 0x7A, 0xC4, 0x06, 0x80, 0xB4, 0xC3, 0xC9, 0x47, 0x04, 0x64, 0xC2, 0x09,
+    0xA3, 0x01, 0xE0, 0xA0, 0x5D, 0xD7, 0x00, 0x02, 0xAC, 0x02, 0x55, 0x92, 0xA5, 0x27, 0x98, 0x29,
+    0x52, 0xB0, 0xF4, 0x04, 0x33, 0x4B, 0x02, 0x9B, 0xC4, 0xF0, 0x1B, 0xA8, 0x1A, 0x1C, 0xED, 0x29,
+    0x1C, 0x4E, 0x30, 0x1C, 0x71, 0x42, 0x1C, 0x34, 0x4C, 0x1C, 0x60, 0x72, 0xA9, 0x69, 0xA3, 0x75,
+    0x6D, 0x23, 0xC2, 0x70, 0x43, 0x1A, 0x7D, 0xC3, 0x68, 0x48, 0x02, 0x71, 0x01, 0x1C, 0xAE, 0x6E,
+    0x6D, 0x10, 0x8D, 0x81, 0x34, 0xA6, 0x22, 0x05, 0xE2, 0x04, 0x71, 0xE0, 0x90, 0xD4, 0x6C, 0x03,
+    0x68, 0x0C, 0xD2, 0x10, 0x88, 0x0B, 0x80, 0x41, 0x0A, 0x88, 0x0B, 0xE0, 0xD0, 0xEC, 0x6E, 0x43,
+    0x38, 0x90, 0xC6, 0x44, 0x38, 0x41, 0x1C, 0x58, 0x24, 0x92, 0x18, 0x68, 0x16, 0xC8, 0x00, 0x82,
+    0x85, 0x34, 0x84, 0x22, 0x53, 0x00, 0x8B, 0xC4, 0xC6, 0x1B, 0x68, 0xD2, 0x1B, 0x60, 0x51, 0x3E,
+    0x76, 0x63, 0x76, 0x77, 0x43, 0x1C, 0xCE, 0x7E, 0x6E, 0x1C, 0x13, 0x11, 0x1B, 0x46, 0x30, 0xE0,
+    0xD0, 0xC9, 0x75, 0x83, 0x88, 0x24, 0x44, 0x9A, 0x10, 0x51, 0x21, 0xCE, 0x10, 0x0A, 0x88, 0x05,
+    0xC1, 0x00, 0x0C, 0x30, 0x21, 0x22, 0x43, 0x9C, 0x57, 0x86, 0x50, 0x00, 0x11, 0x21, 0x19, 0x31,
+    0x32, 0xD4, 0x08, 0x46, 0xE4, 0xB0, 0x00, 0x61, 0x1E, 0xBA, 0x33, 0x6F, 0x10, 0x31, 0xA2, 0xA8,
+    0x11, 0x0C, 0x38, 0x94, 0xEA, 0xDE, 0x60, 0x80, 0x16, 0x21, 0xCC, 0x2B, 0x04, 0x98, 0x10, 0x41,
+    0x56, 0x14, 0x35, 0x82, 0x11, 0x67, 0x08, 0x75, 0x80, 0x18, 0x10, 0x8C, 0xA5, 0x0A, 0x96, 0x13,
+    0xC0, 0x23, 0xC2, 0x92, 0x85, 0xDA, 0xB8, 0x04, 0x3B, 0x00, 0x87, 0xA0, 0xB8, 0x83, 0x89, 0x39,
+    0x80, 0x45, 0x72, 0x07, 0x0E, 0x54, 0x0B, 0x0E, 0x01, 0x01, 0x56, 0x83, 0x50, 0x25, 0x01, 0xD2,
+    0x14, 0xE1, 0x08, 0x71, 0x86, 0x69, 0xE0, 0x40, 0x84, 0x8D, 0xC0, 0x32, 0x0E, 0xC9, 0x4B, 0x38,
+    0x02, 0x24, 0x1A, 0x01, 0x03, 0x82, 0x83, 0x96, 0x2A, 0x0B, 0x80, 0x41, 0x1A, 0x0A, 0x71, 0x01,
+    0x1C, 0xBA, 0xF2, 0x70, 0x08, 0x0B, 0x30, 0x91, 0x06, 0x94, 0xCA, 0x08, 0x80, 0x44, 0xB4, 0x86,
+    0x13, 0x08, 0x00, 0x08, 0x13, 0x11, 0x2B, 0x8A, 0x29, 0x6A, 0x04, 0x03, 0x0E, 0xE3, 0x5C, 0x19,
+    0x84, 0x53, 0x60, 0x14, 0x04, 0x8B, 0x11, 0x65, 0x1C, 0x15, 0x99, 0x1C, 0xC4, 0x82, 0x34, 0xA6,
+    0x22, 0x88, 0x24, 0x88, 0x03, 0x87, 0x48, 0x85, 0x1C, 0x02, 0x5D, 0x64, 0xC4, 0xE3, 0x98, 0x13,
+    0xE4, 0x58, 0x80, 0xC9, 0x69, 0x05, 0x02, 0x11, 0x40, 0x42, 0x04, 0xC4, 0x69, 0x15, 0x4A, 0x1C,
+    0x81, 0x08, 0x08, 0x10, 0x03, 0x10, 0xE8, 0xE1, 0x12, 0x24, 0x07, 0x32, 0x23, 0x14, 0x13, 0x03,
+    0xA0, 0x58, 0x07, 0x33, 0x46, 0x28, 0x96, 0xD8, 0x03, 0x90, 0x65, 0x41, 0x80, 0xD6, 0x20, 0x0A,
+    0x01, 0x8F, 0x24, 0xC5, 0x1C, 0xA8, 0xCA, 0x1C, 0x12, 0xDB, 0x1C, 0x60, 0x11, 0xF1, 0x96, 0x43,
+    0x8A, 0x97, 0x83, 0x88, 0x09, 0xA1, 0x18, 0x80, 0x1D, 0x90, 0xD3, 0x04, 0x1C, 0x6A, 0x82, 0x12,
+    0x20, 0xA2, 0xE0, 0x08, 0x05, 0x00, 0xF1, 0x80, 0x74, 0x5D, 0xE2, 0x10, 0x0C, 0x38, 0xA1, 0x1D,
+    0xA2, 0x5A, 0x70, 0x08, 0x08, 0xB0, 0xE8, 0x08, 0xA1, 0x4A, 0x02, 0x1C, 0x92, 0x80, 0x4E, 0x00,
+    0xDC, 0xA1, 0x9E, 0x3B, 0xC7, 0x43, 0x4D, 0x44, 0xCC, 0x40, 0x2F, 0xB2, 0x11, 0x0C, 0x48, 0x40,
+    0x0F, 0xCC, 0x96, 0x7A, 0x74, 0x98, 0x96, 0x74, 0xA0, 0xAF, 0x74, 0xAC, 0xED, 0x74, 0x30, 0x2C,
+    0x77, 0x34, 0xEC, 0x84, 0xB8, 0x0D, 0x96, 0xBC, 0x10, 0x97, 0xC4, 0xA4, 0x97, 0x48, 0xDE, 0x99,
+    0x4C, 0x25, 0x9A, 0x50, 0x38, 0x9A, 0x08, 0x13, 0x80, 0xAC, 0x06, 0x3C, 0x8A, 0x48, 0x80, 0x13,
+    0xB1, 0x06, 0x52, 0x91, 0x79, 0x40, 0x83, 0xE4, 0x03, 0x92, 0x97, 0x00, 0x8D, 0x40, 0x0C, 0x44,
+    0x33, 0x01, 0xCB, 0x82, 0x43, 0xC4, 0x0A, 0x64, 0x94, 0x94, 0x1A, 0x98, 0x24, 0x29, 0xEB, 0x58,
+    0xE4, 0xEB, 0x70, 0xEC, 0xED, 0xA0, 0x38, 0xEE, 0x00, 0x87, 0x33, 0x5C, 0x1D, 0x81, 0x13, 0x01,
+    0x13, 0xE2, 0x34, 0xB2, 0x24, 0x15, 0x89, 0x4C, 0x19, 0x02, 0x91, 0x03, 0x10, 0x11, 0xB0, 0x2A,
+    0x52, 0x19, 0xC1, 0x94, 0x04, 0x0E, 0x97, 0xE5, 0x3A, 0x84, 0x09, 0x71, 0x5A, 0x45, 0x0A, 0x6A,
+    0x08, 0x44, 0x00, 0x61, 0x42, 0x2A, 0x92, 0x91, 0x82, 0x1A, 0x62, 0x06, 0xB0, 0x48, 0x02, 0xD9,
+    0xE1, 0xA6, 0xD9, 0x01, 0x04, 0x44, 0x04, 0x4C, 0x48, 0x45, 0x32, 0x90, 0x29, 0x43, 0xCC, 0x00,
+    0x0E, 0x85, 0xE5, 0x38, 0x0C, 0x8A, 0x24, 0x14, 0xC7, 0x02, 0x38, 0x94, 0xBA, 0xED, 0x68, 0x8B,
+    0x88, 0xAD, 0x1D, 0xD8, 0xB3, 0x1D, 0xC0, 0x40, 0x2A, 0x10, 0x21, 0x65, 0x05, 0x80, 0x90, 0x15,
+    0x88, 0x88, 0x70, 0x40, 0x03, 0x22, 0x0D, 0x00, 0x56, 0x04, 0x3A, 0xA7, 0x24, 0xA0, 0x41, 0x32,
+    0x60, 0x72, 0x22, 0x19, 0x11, 0xCC, 0x01, 0x07, 0xCC, 0x9D, 0x03, 0xA7, 0x61, 0x1E, 0x1E, 0x83,
+    0x4B, 0x1E, 0x64, 0x59, 0x1E, 0xE8, 0x76, 0x1E, 0xEC, 0x93, 0x1E, 0x4D, 0x94, 0x1F, 0x0F, 0x9C,
+    0x1F, 0xF3, 0x1E, 0x21, 0xF4, 0x25, 0x21, 0xE0, 0xF0, 0x91, 0xC0, 0xA3, 0x1D, 0xE2, 0x01, 0x78,
+    0x8C, 0x43, 0xD7, 0xFD, 0x0E, 0x22, 0x46, 0xBC, 0x42, 0x56, 0x30, 0xA0, 0xE1, 0x15, 0xB2, 0x10,
+    0x48, 0x88, 0x85, 0x34, 0x70, 0xD8, 0xEC, 0xE0, 0x01, 0x34, 0x38, 0x22, 0x16, 0xD2, 0xC0, 0x21,
+    0x96, 0x86, 0x07, 0x42, 0xC8, 0x8A, 0x58, 0x88, 0x08, 0x07, 0x34, 0xC4, 0x42, 0x1A, 0x58, 0x44,
+    0xCF, 0xF1, 0xA0, 0x23, 0xF2, 0x00, 0x87, 0x2D, 0x30, 0x1E, 0x82, 0x6A, 0x08, 0xB2, 0x28, 0x0C,
+    0x00, 0x13, 0xE2, 0xB4, 0x0C, 0x41, 0xCA, 0x10, 0x88, 0x00, 0xED, 0x70, 0xAE, 0xF3, 0x01, 0x98,
+    0x90, 0x16, 0x80, 0x08, 0x20, 0x21, 0x4E, 0x4B, 0x18, 0x02, 0x11, 0x80, 0x60, 0x1A, 0x60, 0x42,
+    0x9C, 0x56, 0x42, 0x56, 0x78, 0xA4, 0x0C, 0x81, 0x08, 0xC0, 0x0E, 0x1D, 0xD5, 0x3C, 0x18, 0x27,
+    0x02, 0x26, 0x42, 0x86, 0xBC, 0xF0, 0x90, 0x29, 0x23, 0x1C, 0x20, 0x22, 0x26, 0xC4, 0x69, 0x21,
+    0x2F, 0x3C, 0x64, 0xCA, 0x10, 0x88, 0x00, 0xD3, 0x3C, 0x44, 0x63, 0xF4, 0x20, 0x87, 0x04, 0x87,
+    0x1E, 0x23, 0xE2, 0x89, 0x31, 0xC2, 0x02, 0x11, 0x4F, 0x8C, 0x11, 0x02, 0xD0, 0x98, 0x8A, 0x27,
+    0xC6, 0x10, 0xC4, 0x81, 0x4B, 0xC2, 0x58, 0x0F, 0x74, 0x7B, 0x0F, 0xB6, 0x9E, 0x0F, 0x07, 0xA5,
+    0x0F, 0xFA, 0xAA, 0x0F, 0x70, 0xD8, 0xCC, 0xEA, 0x31, 0xB4, 0x02, 0xB2, 0x80, 0x71, 0xE0, 0x84,
+    0xCB, 0xB1, 0xC8, 0xEC, 0xEB, 0x11, 0x75, 0xED, 0x31, 0x20, 0x22, 0x22, 0x2C, 0xA1, 0xC0, 0x21,
+    0x69, 0x61, 0x07, 0xE3, 0x44, 0xC0, 0x3C, 0x44, 0x7E, 0xF6, 0x20, 0x15, 0xC8, 0x94, 0x11, 0x80,
+    0xC6, 0x74, 0x20, 0x53, 0x86, 0x20, 0x0E, 0x1C, 0x3A, 0xAF, 0x7B, 0x20, 0xE2, 0x10, 0xC5, 0xDC,
+    0x03, 0x58, 0x0D, 0x4A, 0x94, 0x04, 0x00, 0x2B, 0x42, 0x89, 0x92, 0x80, 0x08, 0x98, 0x90, 0x8A,
+    0x74, 0x3C, 0x64, 0xCA, 0x10, 0x33, 0x80, 0x45, 0x99, 0x89, 0x8F, 0xC9, 0x8C, 0x8F, 0x76, 0x88,
+    0x76, 0xF0, 0x61, 0xE8, 0x08, 0x41, 0x1C, 0x20, 0x00, 0x13, 0xE2, 0xB4, 0x10, 0x46, 0x84, 0x2A,
+    0x43, 0x20, 0x02, 0x20, 0x4E, 0x4B, 0x38, 0x02, 0x11, 0xB0, 0x88, 0x94, 0xF2, 0x31, 0xEF, 0xF2,
+    0x41, 0x0E, 0x07, 0x0A, 0x07, 0x48, 0xC1, 0x08, 0x01, 0x68, 0x4C, 0xC2, 0x10, 0xC4, 0x81, 0x45,
+    0x46, 0x72, 0x03, 0x4C, 0x9D, 0x0F, 0x72, 0xA0, 0xA9, 0x3E, 0x11, 0x10, 0x02, 0x40, 0x30, 0x4E,
+    0x04, 0x4C, 0xC4, 0x08, 0x09, 0x0F, 0x99, 0x32, 0xC2, 0x02, 0xDA, 0xA1, 0xE1, 0x23, 0x82, 0x45,
+    0x00, 0xD3, 0x29, 0x48, 0x03, 0x82, 0xC3, 0x16, 0xBC, 0x0F, 0x74, 0xD8, 0xAE, 0xF6, 0x21, 0x00,
+    0x13, 0xE2, 0x34, 0xB2, 0x83, 0x08, 0x55, 0x86, 0x40, 0xE4, 0x00, 0x88, 0x00, 0x4C, 0x88, 0xD3,
+    0xC8, 0x12, 0x22, 0x54, 0x19, 0x02, 0x91, 0x03, 0x0E, 0x91, 0x0E, 0x3F, 0x04, 0x04, 0x98, 0x10,
+    0xA7, 0x65, 0x08, 0x55, 0x86, 0x40, 0x04, 0x1C, 0x4E, 0x86, 0x0E, 0x00, 0x13, 0xE2, 0xB4, 0x08,
+    0x55, 0x86, 0x40, 0x04, 0x98, 0x00, 0xA4, 0x55, 0x90, 0x51, 0x04, 0x01, 0x9F, 0xC4, 0x2B, 0x20,
+    0xA7, 0x7A, 0x20, 0xA8, 0x88, 0x20, 0x6B, 0x90, 0x20, 0xAE, 0xE7, 0x20, 0x11, 0xF2, 0x20, 0x14,
+    0x06, 0x21, 0xE0, 0x11, 0xD1, 0x82, 0x22, 0xF6, 0xF8, 0x63, 0x86, 0xFB, 0x23, 0x40, 0x16, 0x64,
+    0xC2, 0x15, 0x43, 0x48, 0x91, 0xC4, 0x68, 0x00, 0x5A, 0x0C, 0x74, 0x0E, 0x98, 0xA9, 0xFE, 0x90,
+    0x10, 0xA7, 0x25, 0x20, 0x02, 0x20, 0x15, 0x89, 0x28, 0x43, 0xCC, 0x00, 0x0E, 0x11, 0x1D, 0x40,
+    0x80, 0x70, 0xB8, 0x5C, 0xFF, 0x81, 0x2C, 0xC8, 0x3C, 0xC4, 0x07, 0x2A, 0x40, 0x08, 0x19, 0x22,
+    0xA4, 0x48, 0x62, 0x88, 0x70, 0xC0, 0x21, 0x09, 0x79, 0x00, 0x32, 0x0F, 0x31, 0x11, 0x40, 0x10,
+    0x42, 0x76, 0x08, 0x29, 0x92, 0x18, 0x22, 0x1C, 0x50, 0x21, 0xA4, 0x48, 0x62, 0x34, 0x70, 0x08,
+    0x0E, 0x24, 0x11, 0x0E, 0x57, 0x3C, 0x40, 0x90, 0x69, 0xC1, 0x09, 0x49, 0x8C, 0x06, 0x20, 0xF3,
+    0x10, 0x87, 0x47, 0x02, 0x21, 0x64, 0x85, 0x48, 0x62, 0x88, 0x70, 0xC0, 0x62, 0x4B, 0x0F, 0xC8,
+    0xA4, 0x11, 0x08, 0x32, 0x21, 0x4E, 0x23, 0x2B, 0x86, 0x18, 0x02, 0x91, 0x03, 0x48, 0x40, 0x33,
+    0x21, 0x4E, 0x8B, 0x18, 0x02, 0x11, 0x70, 0x88, 0xDC, 0x05, 0x02, 0x0E, 0xA7, 0xAD, 0x40, 0xDA,
+    0x82, 0xD0, 0x33, 0xC1, 0x84, 0xBE, 0x01, 0xA4, 0x22, 0x11, 0x62, 0x88, 0x19, 0xC0, 0xE2, 0x74,
+    0x1C, 0x48, 0x75, 0x1D, 0x88, 0xD3, 0x0A, 0x86, 0x40, 0xC4, 0x52, 0x85, 0x5E, 0x4C, 0x61, 0x08,
+    0x44, 0xC0, 0x01, 0x02, 0xF4, 0x07, 0x52, 0x30, 0xC4, 0x0C, 0x40, 0x44, 0x1C, 0x44, 0x23, 0x21,
+    0x15, 0x29, 0x31, 0x01, 0x06, 0x72, 0xC4, 0x0C, 0xC0, 0x44, 0x34, 0x33, 0x22, 0x8C, 0x40, 0x06,
+    0x58, 0x44, 0x7B, 0x06, 0x99, 0x0F, 0x07, 0x21, 0x87, 0x73, 0xB4, 0x20, 0xC0, 0x5C, 0x5C, 0x3F,
+    0x05, 0x69, 0x66, 0x05, 0x21, 0x09, 0x23, 0x00, 0xB8, 0x61, 0x84, 0xD4, 0x00, 0x42, 0x92, 0x15,
+    0x23, 0x90, 0x70, 0x0E, 0x58, 0x5C, 0xDF, 0x06, 0x68, 0x43, 0x06, 0x21, 0x8B, 0xC3, 0x40, 0x06,
+    0x93, 0xB2, 0x0F, 0x0B, 0x3E, 0x58, 0xF7, 0x24, 0x40, 0x48, 0xB2, 0x21, 0x90, 0x70, 0x0E, 0x38,
+    0x24, 0xE8, 0x06, 0x01, 0x26, 0xC4, 0x69, 0x19, 0x22, 0x95, 0x21, 0x10, 0x01, 0x62, 0x83, 0x48,
+    0xC1, 0x00, 0xC4, 0x44, 0x1A, 0xC2, 0x08, 0xE0, 0xB0, 0xF5, 0x37, 0x41, 0x02, 0x26, 0x92, 0x20,
+    0x46, 0x00, 0x87, 0x48, 0xFE, 0x20, 0x40, 0xB0, 0x90, 0x88, 0x62, 0x8A, 0x4C, 0x01, 0x60, 0x10,
+    0x89, 0x44, 0xA0, 0x27, 0x4E, 0x00, 0x87, 0x13, 0x15, 0x21, 0x8B, 0x3C, 0x24, 0x80, 0x08, 0x01,
+    0x22, 0x9C, 0x80, 0x4C, 0x03, 0x80, 0x08, 0xC9, 0x88, 0x51, 0x11, 0x8C, 0xC8, 0x61, 0x01, 0x00,
+    0xD2, 0x22, 0xC8, 0x28, 0x82, 0x00, 0x0D, 0x3A, 0x9C, 0xA7, 0x09, 0x11, 0x80, 0x89, 0x64, 0x3C,
+    0x46, 0x84, 0x2A, 0x23, 0x00, 0x38, 0xE2, 0x31, 0x22, 0x46, 0x03, 0xAF, 0x83, 0x90, 0x21, 0x04,
+    0xB9, 0x21, 0xA5, 0xCB, 0x21, 0xE6, 0x16, 0x22, 0x28, 0x34, 0x22, 0x29, 0x3B, 0x22, 0xAE, 0x54,
+    0x22, 0x30, 0x61, 0x22, 0x52, 0x6E, 0x22, 0x13, 0x15, 0x24, 0xD5, 0x44, 0x25, 0xE2, 0x10, 0x55,
+    0x2D, 0x84, 0x68, 0x24, 0x4A, 0x56, 0x9C, 0x40, 0x0E, 0x3B, 0x60, 0x91, 0x10, 0x2F, 0xC4, 0x35,
+    0x31, 0x64, 0x20, 0x62, 0xC4, 0x11, 0x2B, 0x18, 0x70, 0x58, 0x37, 0x18, 0x32, 0x11, 0x23, 0x22,
+    0x88, 0x11, 0x16, 0x40, 0x8C, 0x88, 0x20, 0x66, 0x58, 0x00, 0x25, 0x23, 0x8E, 0x12, 0x88, 0x1D,
+    0xF0, 0x48, 0x2E, 0x1A, 0x82, 0x96, 0x1A, 0xE2, 0x50, 0x1B, 0x02, 0x30, 0x0D, 0x31, 0x22, 0xC2,
+    0x23, 0x61, 0x01, 0x0C, 0x43, 0x8C, 0x04, 0x12, 0x16, 0x38, 0x1C, 0xFB, 0x01, 0x99, 0x10, 0xA7,
+    0x91, 0x07, 0xAE, 0xE0, 0x13, 0x07, 0x0B, 0xCD, 0x04, 0x87, 0x92, 0xC2, 0x21, 0xC2, 0x4C, 0x20,
+    0x41, 0x0D, 0x80, 0x68, 0x04, 0x4A, 0x66, 0x9C, 0x40, 0x0E, 0x3B, 0xE0, 0x11, 0x49, 0x3B, 0xC4,
+    0x7D, 0x40, 0x84, 0xF6, 0x41, 0x84, 0x1C, 0x44, 0x34, 0x13, 0x2C, 0x1A, 0xAD, 0x87, 0xC4, 0xFC,
+    0x87, 0x8C, 0x43, 0x59, 0x58, 0x06, 0xA2, 0x1D, 0xCC, 0x9B, 0x3C, 0x1C, 0xD2, 0xE6, 0x87, 0x44,
+    0xC0, 0x84, 0x38, 0xAD, 0x82, 0x99, 0x32, 0x04, 0x22, 0x40, 0x44, 0x0E, 0xC0, 0xA9, 0x24, 0xB0,
+    0x03, 0xB6, 0xCE, 0x07, 0xD1, 0x04, 0x04, 0x0B, 0x09, 0x79, 0x15, 0x99, 0x51, 0x64, 0x0A, 0x80,
+    0x44, 0x20, 0x4E, 0x6B, 0x10, 0x88, 0x00, 0xF1, 0x90, 0x48, 0x45, 0x04, 0x18, 0xA8, 0x05, 0x98,
+    0x10, 0xA7, 0x91, 0x21, 0x83, 0xA5, 0x32, 0x04, 0x22, 0x07, 0x90, 0x10, 0xA7, 0x01, 0x56, 0xC4,
+    0x11, 0x88, 0x94, 0x04, 0x54, 0xC4, 0x68, 0x20, 0x62, 0x86, 0x05, 0x0E, 0x69, 0x8F, 0x44, 0x08,
+    0x81, 0x9A, 0x22, 0xD2, 0x30, 0x98, 0x09, 0xE0, 0xB0, 0x25, 0x20, 0x40, 0x98, 0x10, 0xA7, 0x45,
+    0x10, 0x35, 0x04, 0x22, 0xC0, 0x04, 0x4C, 0x88, 0xD3, 0xC8, 0x0E, 0x82, 0x46, 0x19, 0x02, 0x91,
+    0x03, 0xD0, 0xC3, 0x48, 0x45, 0x0A, 0x22, 0x2E, 0x0C, 0xCF, 0x61, 0x10, 0x34, 0x5E, 0x7C, 0x0E,
+    0x4B, 0x8A, 0x90, 0x95, 0x8A, 0x20, 0xF0, 0x8B, 0xB8, 0xAF, 0x8D, 0xBC, 0xFA, 0x8D, 0x4C, 0x7E,
+    0x8E, 0xD0, 0xEF, 0x8F, 0x88, 0x43, 0x32, 0x1C, 0x06, 0xC4, 0xA1, 0x1A, 0x42, 0x92, 0x0D, 0x87,
+    0x84, 0x73, 0x00, 0x74, 0x48, 0xDC, 0x29, 0x32, 0x10, 0x31, 0x42, 0xAC, 0x60, 0x80, 0x88, 0x18,
+    0x15, 0x62, 0x05, 0x13, 0x16, 0x98, 0x6C, 0xE2, 0x15, 0x79, 0xA8, 0x16, 0x81, 0xCF, 0x16, 0x89,
+    0x74, 0x17, 0x11, 0x26, 0x6A, 0x42, 0x2A, 0x52, 0xC1, 0x86, 0x98, 0x01, 0x1C, 0xCE, 0x2D, 0x8B,
+    0x40, 0x14, 0xD1, 0x4C, 0x0B, 0xEE, 0xD0, 0x2C, 0x90, 0x91, 0x1A, 0x10, 0x01, 0x13, 0xE9, 0x50,
+    0x81, 0x0C, 0x53, 0x46, 0x00, 0x66, 0x83, 0x0A, 0x71, 0x00, 0x14, 0x39, 0x94, 0x3B, 0x17, 0x69,
+    0x26, 0x0A, 0x58, 0x16, 0x1C, 0x91, 0x1A, 0x40, 0x08, 0x84, 0x8C, 0x20, 0x2A, 0x1C, 0x70, 0x58,
+    0x75, 0x2F, 0xD2, 0x1A, 0x54, 0x30, 0x04, 0x40, 0x07, 0x33, 0xD5, 0x1F, 0x93, 0x83, 0x26, 0x23,
+    0xAE, 0x32, 0x23, 0xF2, 0x38, 0x23, 0xF3, 0x3C, 0x23, 0xE2, 0xD0, 0x59, 0x63, 0x04, 0x71, 0x28,
+    0xA9, 0x21, 0x24, 0x59, 0xA2, 0x04, 0x62, 0x87, 0x84, 0x73, 0x00, 0x4A, 0x6A, 0x08, 0x49, 0x86,
+    0x28, 0x81, 0xD8, 0x21, 0xE1, 0x1C, 0x80, 0x88, 0x8B, 0xC3, 0x73, 0x18, 0xA8, 0xB7, 0x04, 0x84,
+    0x0C, 0x58, 0x00, 0x25, 0x1B, 0x94, 0x40, 0xEC, 0x80, 0x83, 0xD9, 0xDF, 0x04, 0xF4, 0x70, 0x0E,
+    0x6B, 0x84, 0x68, 0xC4, 0x21, 0x76, 0xD4, 0x08, 0x42, 0xC8, 0x90, 0x21, 0x06, 0x0B, 0x44, 0x89,
+    0x70, 0x40, 0xC6, 0x10, 0x83, 0x05, 0xA2, 0x1A, 0x38, 0x44, 0x1E, 0x1B, 0x21, 0x46, 0xC5, 0x10,
+    0x83, 0x8D, 0xB0, 0x00, 0xA7, 0x65, 0x0C, 0x31, 0xD8, 0x10, 0x88, 0x80, 0xC5, 0xF6, 0x93, 0x8E,
+    0xC8, 0xBB, 0x91, 0x75, 0xE0, 0xFA, 0x7F, 0x41, 0x40, 0x28, 0xD6, 0x30, 0x04, 0x7B, 0x00, 0x12,
+    0x0F, 0x91, 0x1A, 0x47, 0x00, 0x01, 0x2F, 0x48, 0x8C, 0x0E, 0xE8, 0x7B, 0x12, 0x1C, 0x82, 0x77,
+    0x1A, 0x08, 0xF8, 0x50, 0x83, 0x73, 0x44, 0x36, 0x14, 0x25, 0xC2, 0x01, 0x0D, 0x45, 0x35, 0xF0,
+    0x88, 0x02, 0x3D, 0x32, 0x6F, 0x3E, 0x42, 0x23, 0x3F, 0x02, 0x1E, 0xDB, 0x78, 0x47, 0xE2, 0x82,
+    0x47, 0x26, 0x99, 0x47, 0x90, 0x66, 0x92, 0x11, 0xA6, 0x08, 0x32, 0x0E, 0xB0, 0xE0, 0x82, 0x91,
+    0x1A, 0xD0, 0x00, 0x13, 0xE2, 0xB4, 0x8E, 0x60, 0x48, 0x19, 0x02, 0x11, 0xA0, 0x15, 0x90, 0x01,
+    0x0E, 0x67, 0xBE, 0x47, 0x1A, 0x0A, 0x58, 0x16, 0x1C, 0x32, 0x04, 0x61, 0x25, 0xA5, 0x06, 0xD0,
+    0x05, 0x30, 0xE0, 0x04, 0xF4, 0x22, 0x0F, 0x11, 0x25, 0x4C, 0x88, 0xD3, 0x3A, 0x0C, 0x53, 0x43,
+    0x20, 0x02, 0x08, 0x13, 0xE2, 0xB4, 0x0A, 0xC3, 0xD4, 0x10, 0x88, 0x80, 0x43, 0x66, 0x05, 0x92,
+    0x75, 0x38, 0x7F, 0xD2, 0x01, 0x34, 0x33, 0x61, 0x14, 0x32, 0xC0, 0x21, 0xC9, 0x7E, 0x08, 0x30,
+    0x91, 0x84, 0x57, 0x46, 0x00, 0x93, 0x64, 0x4D, 0x24, 0x48, 0x70, 0x24, 0x51, 0xAE, 0x24, 0x92,
+    0x37, 0x25, 0xE0, 0x90, 0xA1, 0x86, 0x04, 0x1D, 0x36, 0xE1, 0x72, 0x30, 0x48, 0x03, 0x4C, 0x24,
+    0xE3, 0x09, 0x52, 0x46, 0x00, 0x1E, 0x27, 0x02, 0xE2, 0x21, 0xB6, 0x11, 0x09, 0x42, 0xC8, 0x92,
+    0xF0, 0x22, 0x32, 0xC5, 0x88, 0x70, 0x40, 0x47, 0x78, 0x11, 0x99, 0x62, 0x1A, 0x38, 0x6C, 0x5C,
+    0x23, 0x61, 0x1E, 0x77, 0x18, 0xCF, 0x45, 0x02, 0xC4, 0x03, 0xFC, 0xFA, 0x86, 0x43, 0x0C, 0x34,
+    0x12, 0xA0, 0x21, 0x28, 0x59, 0x80, 0xD8, 0x01, 0x01, 0xC5, 0x34, 0x60, 0x1C, 0x38, 0xB9, 0x6E,
+    0x4C, 0x82, 0x4A, 0x6C, 0x18, 0x16, 0x92, 0x34, 0x32, 0x92, 0xCC, 0x9A, 0x92, 0x04, 0xD4, 0x44,
+    0x22, 0x8C, 0x90, 0x6C, 0x04, 0x80, 0x68, 0x66, 0x03, 0x71, 0x81, 0x0C, 0xB0, 0xE8, 0x10, 0x4A,
+    0x42, 0x19, 0x31, 0x40, 0x0E, 0x9B, 0x38, 0x49, 0x46, 0x01, 0x0B, 0x0B, 0x98, 0x07, 0x88, 0x7C,
+    0x15, 0x28, 0x99, 0xC0, 0x10, 0x3B, 0x00, 0xE2, 0xB4, 0x8A, 0x25, 0x86, 0x40, 0x04, 0x3C, 0x22,
+    0x3B, 0x93, 0xB8, 0x87, 0x93, 0x50, 0xB2, 0x94, 0x00, 0x15, 0x11, 0x0F, 0x65, 0x91, 0x49, 0x04,
+    0x04, 0x58, 0x1D, 0x68, 0x06, 0x73, 0x44, 0x49, 0x00, 0xAE, 0x40, 0x33, 0x98, 0xD3, 0xC0, 0xE1,
+    0xDC, 0x35, 0x49, 0x38, 0xA0, 0x5C, 0xBC, 0x40, 0x4D, 0x88, 0xD3, 0xC8, 0x0C, 0xC9, 0x86, 0x40,
+    0xE4, 0x80, 0xC3, 0x6A, 0x7E, 0x92, 0xB5, 0x48, 0xF6, 0xAC, 0xB0, 0x52, 0x4F, 0x02, 0x04, 0x0B,
+    0x69, 0x48, 0x45, 0xA6, 0x00, 0x0E, 0xB5, 0x72, 0x0F, 0x24, 0x9D, 0x70, 0x00, 0x22, 0x4E, 0x22,
+    0x64, 0x94, 0xC8, 0x7A, 0x94, 0xCC, 0x96, 0x94, 0xE0, 0xA6, 0x94, 0x88, 0x43, 0x1C, 0x8B, 0x12,
+    0x04, 0x58, 0x0D, 0x47, 0x94, 0x04, 0x0A, 0x4E, 0x03, 0x08, 0x99, 0x70, 0x44, 0x38, 0x60, 0x01,
+    0xF4, 0xE4, 0x81, 0x1C, 0x2F, 0xE2, 0x00, 0x11, 0xA2, 0x24, 0xE0, 0x34, 0x40, 0x98, 0x10, 0xA7,
+    0x75, 0x9C, 0x61, 0x98, 0x1A, 0x02, 0x11, 0x60, 0x8A, 0x28, 0x61, 0x42, 0x9C, 0x56, 0x72, 0x86,
+    0x61, 0x6A, 0x08, 0x44, 0xC0, 0x21, 0x6A, 0x5D, 0x09, 0x59, 0x6C, 0xC6, 0x2A, 0x89, 0x55, 0x2B,
+    0x41, 0x1A, 0xA2, 0x99, 0x11, 0x44, 0x04, 0x32, 0xC0, 0xE1, 0x14, 0x59, 0x09, 0xD0, 0xCC, 0x8C,
+    0x19, 0x48, 0x21, 0x03, 0x40, 0x80, 0x55, 0x80, 0x48, 0x49, 0xC0, 0x3C, 0x04, 0x0F, 0x0F, 0x40,
+    0x9C, 0xD6, 0x70, 0x04, 0x22, 0xE0, 0x50, 0x8C, 0x58, 0x81, 0x68, 0x10, 0xA2, 0x99, 0x19, 0x81,
+    0x88, 0x40, 0x06, 0x38, 0x8C, 0xA3, 0x2C, 0x79, 0x87, 0xAE, 0x8C, 0x25, 0x40, 0x04, 0x4C, 0x24,
+    0x22, 0x98, 0x32, 0x02, 0x38, 0x7C, 0x1D, 0x2D, 0x19, 0x10, 0xA0, 0x99, 0x10, 0xA7, 0x55, 0x90,
+    0x32, 0x04, 0x22, 0x00, 0x11, 0x01, 0x13, 0xE2, 0xB4, 0x43, 0xBD, 0xDA, 0x12, 0x99, 0x62, 0x22,
+    0x32, 0x65, 0x08, 0x44, 0x0E, 0x28, 0x89, 0xC1, 0x94, 0x21, 0x10, 0xB1, 0x54, 0x21, 0x13, 0x91,
+    0x29, 0x43, 0x20, 0x02, 0x16, 0xA9, 0xB0, 0x4B, 0xF0, 0xBF, 0x4B, 0x18, 0x62, 0x42, 0x26, 0x27,
+    0x92, 0x21, 0x2F, 0x86, 0x21, 0x06, 0x32, 0x07, 0x98, 0x88, 0x18, 0xF1, 0x22, 0x1B, 0xC1, 0x00,
+    0x56, 0x84, 0x4C, 0x84, 0xAE, 0x30, 0xC2, 0xC1, 0x01, 0x26, 0x5B, 0xFA, 0x4B, 0x5C, 0x0F, 0x4C,
+    0x1E, 0x20, 0x4C, 0xE2, 0x5B, 0x4C, 0x90, 0x01, 0x58, 0x0D, 0x4B, 0x94, 0x04, 0x30, 0xC8, 0x34,
+    0x11, 0xA3, 0xE3, 0x3D, 0x31, 0x46, 0x58, 0x80, 0x84, 0x38, 0x2D, 0xC2, 0xA0, 0x23, 0x10, 0x01,
+    0x8B, 0x64, 0x1F, 0x26, 0xF1, 0x29, 0x26, 0x40, 0x04, 0x4C, 0x24, 0x02, 0x99, 0x32, 0x02, 0x10,
+    0x01, 0x13, 0xE2, 0xB4, 0x0C, 0x64, 0xCA, 0x10, 0x88, 0x80, 0x03, 0x17, 0x10, 0x93, 0x47, 0xF4,
+    0x2D, 0x13, 0x67, 0x37, 0x13, 0x6A, 0x39, 0x13, 0xB2, 0xF8, 0x6A, 0x64, 0x22, 0x5B, 0x65, 0x22,
+    0x4C, 0x44, 0x24, 0x13, 0x90, 0x39, 0x80, 0x3B, 0x94, 0x60, 0x32, 0x69, 0x06, 0xA4, 0x31, 0x19,
+    0x27, 0x22, 0xB2, 0x04, 0x71, 0xC0, 0xE3, 0xB4, 0x83, 0xD1, 0xDF, 0x84, 0x43, 0x39, 0x33, 0x93,
+    0xC1, 0x71, 0x22, 0x99, 0x60, 0x0E, 0xF0, 0x38, 0xCD, 0xA8, 0x08, 0x27, 0x22, 0xB2, 0xC0, 0x81,
+    0x9C, 0x99, 0x89, 0x77, 0x30, 0x13, 0x1E, 0x70, 0xD8, 0x18, 0x66, 0x30, 0x21, 0x13, 0x35, 0x21,
+    0x4E, 0x0B, 0x21, 0x67, 0x88, 0xC1, 0x86, 0x40, 0x04, 0x98, 0x07, 0xE4, 0x65, 0x02, 0x8F, 0x43,
+    0x9E, 0x26, 0xEB, 0xA1, 0x26, 0x4D, 0xA8, 0x26, 0x02, 0xB2, 0x12, 0x88, 0x12, 0x09, 0x58, 0x05,
+    0x69, 0x01, 0xC3, 0x74, 0x0A, 0xE8, 0x80, 0x01, 0x2C, 0xC6, 0xE1, 0x9A, 0xCC, 0xFD, 0x9A, 0x08,
+    0xC4, 0xB2, 0x38, 0xB1, 0xE2, 0x84, 0x84, 0x0C, 0x80, 0x10, 0xB2, 0x61, 0x18, 0x11, 0x0E, 0x38,
+    0x04, 0xAE, 0xFC, 0x40, 0x07, 0x31, 0xB7, 0x1A, 0x1C, 0x9C, 0x80, 0x62, 0x03, 0x97, 0x48, 0xF1,
+    0x26, 0xCE, 0x44, 0x27, 0x13, 0x58, 0x27, 0x34, 0x6D, 0x27, 0x18, 0x8A, 0x27, 0xE4, 0x90, 0x18,
+    0xDD, 0x04, 0x20, 0x26, 0x62, 0x34, 0x8C, 0xB0, 0x80, 0x81, 0x68, 0x04, 0x52, 0xB1, 0x02, 0x51,
+    0x01, 0x98, 0x87, 0x08, 0x00, 0x27, 0x44, 0x3C, 0x24, 0xE2, 0x12, 0x40, 0x07, 0x20, 0x9E, 0x04,
+    0x8B, 0xF2, 0x0C, 0x27, 0xD9, 0x33, 0x27, 0x02, 0x22, 0x4D, 0xB2, 0xE1, 0x00, 0x68, 0x51, 0x6E,
+    0xE3, 0x24, 0x63, 0xE5, 0xA4, 0x31, 0x0D, 0x4A, 0x1C, 0x41, 0x1C, 0x38, 0x64, 0x37, 0x39, 0x41,
+    0x1A, 0x53, 0xA1, 0xC4, 0x11, 0xC4, 0x81, 0x06, 0x25, 0xCE, 0x03, 0x87, 0x08, 0x20, 0x27, 0xA4,
+    0x41, 0x89, 0x13, 0xC0, 0x21, 0x7A, 0xCF, 0x09, 0x31, 0x12, 0x94, 0xC8, 0x61, 0x01, 0x8D, 0x69,
+    0x50, 0x22, 0x0B, 0xE2, 0xC0, 0xA1, 0x05, 0xD5, 0x89, 0xA0, 0x38, 0x03, 0xB2, 0x10, 0x32, 0x03,
+    0x2D, 0x91, 0xC2, 0x01, 0x07, 0x8C, 0x9E, 0x03, 0x10, 0x71, 0x88, 0x44, 0x76, 0x02, 0xAC, 0x08,
+    0x31, 0x84, 0x2A, 0x09, 0x90, 0x88, 0x91, 0x21, 0x86, 0x50, 0xE2, 0x84, 0x05, 0x16, 0xE5, 0xFD,
+    0x4E, 0xA6, 0x0A, 0x4F, 0x04, 0xA4, 0x40, 0x84, 0x09, 0x71, 0x5A, 0x04, 0x17, 0x88, 0x00, 0x08,
+    0x21, 0x1B, 0xC4, 0x09, 0x07, 0x40, 0x07, 0x40, 0xE1, 0x1E, 0xA4, 0x09, 0x58, 0x10, 0x09, 0x98,
+    0x10, 0xA7, 0x65, 0x24, 0x71, 0xCA, 0x10, 0x88, 0x00, 0x00, 0x61, 0x38, 0x11, 0xCE, 0x28, 0x23,
+    0x38, 0x64, 0x1A, 0x98, 0x64, 0xF3, 0x3D, 0x89, 0x45, 0x3E, 0x91, 0x66, 0x3F, 0x99, 0xAA, 0x3F,
+    0x59, 0x10, 0x06, 0x69, 0x80, 0x09, 0x69, 0x4C, 0xC8, 0x13, 0xA4, 0x0C, 0x41, 0x1C, 0x40, 0x2D,
+    0xC0, 0x04, 0x4C, 0x48, 0x45, 0x22, 0xC4, 0x0C, 0xE0, 0x30, 0xB2, 0xFB, 0x44, 0x1C, 0xD2, 0x5A,
+    0x9F, 0x9C, 0x06, 0xC8, 0x8C, 0x82, 0x00, 0x32, 0x2B, 0x84, 0x51, 0x4C, 0x0C, 0x70, 0x88, 0x62,
+    0x7E, 0x42, 0x0E, 0xDA, 0x78, 0x47, 0x08, 0xD4, 0x42, 0xB0, 0x02, 0xF6, 0x00, 0x67, 0x62, 0x88,
+    0x18, 0x31, 0xD0, 0x0B, 0x06, 0x90, 0x1C, 0x86, 0x88, 0x15, 0x67, 0xA0, 0x17, 0x0C, 0x00, 0xB4,
+    0x84, 0x56, 0x08, 0x20, 0x2C, 0x48, 0x33, 0x10, 0x31, 0x23, 0x09, 0xB2, 0x82, 0x01, 0x97, 0xC4,
+    0x27, 0x28, 0xEB, 0x42, 0x28, 0x4C, 0x4A, 0x28, 0x2D, 0x5B, 0x28, 0x34, 0x5F, 0x28, 0x02, 0x44,
+    0x21, 0x11, 0xAA, 0x10, 0x9A, 0x09, 0x23, 0xC0, 0xE2, 0xC8, 0x0E, 0xCA, 0xDA, 0x0F, 0x8A, 0x30,
+    0x21, 0x15, 0x30, 0x91, 0x90, 0x50, 0xD4, 0x10, 0xB3, 0x8C, 0x00, 0xE8, 0x86, 0x50, 0x16, 0x48,
+    0x08, 0x25, 0x01, 0x0C, 0x30, 0x21, 0x4E, 0x2B, 0x28, 0x04, 0x1C, 0xB2, 0x5C, 0xA1, 0x10, 0x8D,
+    0x13, 0x2B, 0xC2, 0x0B, 0x85, 0x20, 0x03, 0x0E, 0xC0, 0x59, 0x32, 0x0E, 0x04, 0x23, 0x06, 0x18,
+    0x07, 0x11, 0xE9, 0x84, 0x11, 0x0C, 0x40, 0x31, 0x44, 0x33, 0x2B, 0x90, 0x62, 0x2F, 0x90, 0x01,
+    0x66, 0x43, 0x38, 0x51, 0xC4, 0x41, 0x51, 0x8A, 0x1B, 0x52, 0x0C, 0xD3, 0x52, 0x96, 0xDF, 0x52,
+    0xD8, 0x79, 0x53, 0x1A, 0xE5, 0x53, 0x9E, 0x37, 0x54, 0x22, 0xFC, 0x54, 0x64, 0x58, 0x55, 0x26,
+    0xAD, 0x57, 0x2A, 0x60, 0x58, 0x80, 0x09, 0x59, 0x0D, 0xA3, 0x88, 0x04, 0x80, 0x83, 0x39, 0xFD,
+    0x90, 0x49, 0x64, 0x5E, 0x14, 0x47, 0x6C, 0x94, 0xF8, 0x78, 0x94, 0xD9, 0x32, 0x07, 0xA2, 0x19,
+    0x87, 0xA4, 0xB4, 0x28, 0x40, 0x33, 0x33, 0x8E, 0x0A, 0x64, 0x15, 0x32, 0xC0, 0x22, 0x09, 0x33,
+    0x8A, 0xE4, 0x1C, 0xC7, 0x40, 0x16, 0xC0, 0xA9, 0x24, 0xD6, 0x27, 0x11, 0x0E, 0x6B, 0xA7, 0x51,
+    0x46, 0xC1, 0x0A, 0x00, 0x69, 0x08, 0x62, 0x06, 0x80, 0x79, 0x1C, 0x09, 0x99, 0x8F, 0x48, 0xEB,
+    0x28, 0x52, 0x2C, 0x01, 0xBA, 0xEF, 0x28, 0xC4, 0x68, 0x08, 0x0B, 0x68, 0x4C, 0x03, 0x71, 0x20,
+    0x21, 0x80, 0x43, 0x74, 0x7D, 0x14, 0x42, 0x92, 0x05, 0xE1, 0x00, 0xE1, 0x10, 0xB5, 0x20, 0x85,
+    0x44, 0x1C, 0x65, 0x84, 0x0C, 0x40, 0x63, 0x32, 0x8E, 0x32, 0x42, 0x0A, 0xE2, 0xC0, 0x62, 0x81,
+    0x48, 0x0A, 0xE2, 0x4D, 0x0A, 0x39, 0x8C, 0xF0, 0x48, 0x69, 0x07, 0xE3, 0x27, 0x1D, 0x07, 0xC4,
+    0x6E, 0x18, 0x87, 0x88, 0x32, 0x29, 0x44, 0x23, 0x21, 0x15, 0xB1, 0xE0, 0x90, 0x40, 0x8E, 0x98,
+    0x21, 0x35, 0xA0, 0x21, 0x0D, 0x82, 0x04, 0xA0, 0x4D, 0x8E, 0x75, 0x00, 0x90, 0x52, 0xA5, 0xA0,
+    0x65, 0xA5, 0x4C, 0x8B, 0x12, 0x80, 0xC3, 0x06, 0x2A, 0x86, 0x79, 0x48, 0xE8, 0x0E, 0xB2, 0xE0,
+    0x06, 0x31, 0x42, 0x6A, 0xC0, 0x3C, 0x58, 0x79, 0x4A, 0x39, 0x9C, 0x14, 0x4B, 0x69, 0x90, 0xC6,
+    0x24, 0x38, 0xB0, 0xB0, 0xBE, 0x0D, 0xE0, 0x44, 0xC7, 0x21, 0x02, 0xE6, 0x01, 0x31, 0x34, 0xCA,
+    0x23, 0xF1, 0x64, 0x0A, 0x22, 0x6B, 0x0A, 0xB5, 0x6C, 0x0A, 0x38, 0x7C, 0x3B, 0x4C, 0x31, 0x80,
+    0x89, 0x90, 0x15, 0xC1, 0x95, 0x11, 0x0E, 0x80, 0x0C, 0xC0, 0x44, 0x8C, 0x12, 0x91, 0x4A, 0x14,
+    0xAB, 0x8C, 0xB0, 0xC0, 0x61, 0x35, 0x68, 0x4A, 0x84, 0x38, 0x94, 0xAC, 0x10, 0x46, 0x20, 0x76,
+    0x00, 0xE7, 0x61, 0x88, 0x66, 0x86, 0xCC, 0x90, 0x50, 0x7C, 0x81, 0x0C, 0x20, 0x20, 0xE2, 0x01,
+    0x98, 0x36, 0x00, 0x09, 0x71, 0x1A, 0x60, 0x59, 0x70, 0xC5, 0x0C, 0xA9, 0x81, 0x43, 0xF7, 0xE3,
+    0x14, 0xA2, 0x71, 0x62, 0x42, 0x21, 0xC8, 0x80, 0xC7, 0x65, 0xEC, 0x94, 0xC8, 0xEE, 0x14, 0x09,
+    0xF3, 0x14, 0x23, 0x02, 0xDE, 0xC1, 0xF1, 0x08, 0x02, 0x74, 0x20, 0x47, 0x0C, 0x41, 0x88, 0x00,
+    0x01, 0x57, 0x28, 0x53, 0x54, 0x03, 0xA6, 0x08, 0x98, 0x10, 0xA7, 0x75, 0x90, 0x33, 0x4C, 0x19,
+    0x02, 0x11, 0xB0, 0xF8, 0x60, 0xA0, 0x22, 0xB3, 0x0D, 0x40, 0x18, 0x11, 0x30, 0x21, 0x8D, 0xE9,
+    0x10, 0xCE, 0x94, 0x21, 0x88, 0x03, 0x88, 0x66, 0x20, 0xDA, 0xE1, 0x74, 0x85, 0x8A, 0x40, 0x42,
+    0x62, 0x20, 0x2B, 0x10, 0x15, 0x40, 0x47, 0x0C, 0x64, 0x05, 0x32, 0xC0, 0x23, 0xC9, 0x8A, 0x4A,
+    0x6C, 0x98, 0xCA, 0xB4, 0x9C, 0x0A, 0x10, 0x0F, 0x98, 0xC1, 0x17, 0x0E, 0x9B, 0x81, 0x54, 0x06,
+    0xA2, 0x1D, 0x4E, 0xF0, 0xA8, 0x08, 0x24, 0x82, 0xAC, 0x40, 0x54, 0x00, 0x0D, 0x64, 0x05, 0x32,
+    0x80, 0x71, 0x48, 0x44, 0xA5, 0x02, 0xB4, 0xC3, 0x09, 0x7D, 0x03, 0x71, 0x48, 0x00, 0x4D, 0x80,
+    0x1B, 0x02, 0x51, 0x0D, 0x1C, 0xB6, 0x74, 0xA9, 0x08, 0xA4, 0x80, 0xA8, 0x00, 0x0C, 0xC4, 0x4C,
+    0x18, 0xE0, 0x10, 0x61, 0x4D, 0x85, 0x10, 0x07, 0x08, 0x91, 0x17, 0x04, 0x60, 0x22, 0x11, 0x41,
+    0x95, 0x11, 0x00, 0x20, 0x9A, 0x18, 0xA2, 0x99, 0x1D, 0xC5, 0x8C, 0x17, 0xC8, 0x00, 0x8F, 0x48,
+    0x91, 0x2A, 0x8E, 0x9C, 0x2A, 0xD5, 0xA5, 0x2A, 0x00, 0x6B, 0x30, 0xE5, 0x59, 0xBA, 0x4C, 0x28,
+    0x0F, 0xA8, 0xD0, 0xE1, 0x4C, 0xF5, 0x07, 0x30, 0x11, 0x23, 0x22, 0x2C, 0xC0, 0x40, 0x26, 0x27,
+    0xC2, 0x11, 0x65, 0x20, 0xD3, 0x00, 0x84, 0x18, 0x0D, 0x62, 0x86, 0x05, 0x3E, 0x8D, 0xDB, 0x2F,
+    0x50, 0x2D, 0x56, 0x94, 0xD1, 0x56, 0x5C, 0xDD, 0x56, 0x5E, 0x0E, 0x57, 0x64, 0x5B, 0x57, 0x26,
+    0x86, 0x57, 0xC4, 0x24, 0xF2, 0xB5, 0x4A, 0x94, 0xBA, 0xCA, 0xFC, 0xC0, 0x0A, 0xF5, 0xC3, 0x0A,
+    0xD1, 0x0C, 0x40, 0x33, 0xC8, 0x82, 0x71, 0xC0, 0xA1, 0xAC, 0xB8, 0x4A, 0x40, 0x8C, 0x06, 0x23,
+    0x64, 0x58, 0x00, 0xE2, 0xB4, 0x0C, 0x25, 0x8E, 0x40, 0x04, 0x40, 0x87, 0x2F, 0xFC, 0x2A, 0x48,
+    0x40, 0x0E, 0x65, 0xF1, 0x55, 0x5A, 0x83, 0x0C, 0xA0, 0x41, 0x86, 0x03, 0xCC, 0x05, 0x82, 0xC6,
+    0x0B, 0x27, 0x3A, 0x0E, 0x11, 0x25, 0x4C, 0x88, 0xD3, 0x42, 0x86, 0x61, 0x6A, 0x08, 0x44, 0x00,
+    0x49, 0x56, 0x88, 0xA3, 0xD8, 0x39, 0x60, 0x53, 0x58, 0x8F, 0xC3, 0xE4, 0x65, 0xA5, 0x95, 0x66,
+    0x25, 0x4E, 0x3F, 0x44, 0x5A, 0x8F, 0x63, 0x3A, 0x6C, 0x65, 0x20, 0x0D, 0x4A, 0xAC, 0x00, 0x20,
+    0xED, 0x00, 0x91, 0x89, 0xE2, 0x70, 0x8A, 0x68, 0x05, 0x98, 0x10, 0xA7, 0x91, 0x1D, 0x43, 0x90,
+    0x32, 0x04, 0x22, 0x07, 0x20, 0x8C, 0x08, 0x98, 0x87, 0x88, 0x56, 0x2B, 0xC4, 0x68, 0x11, 0x47,
+    0x90, 0x11, 0x9C, 0x29, 0x23, 0x2C, 0xC0, 0x69, 0x31, 0xE2, 0x08, 0x32, 0x82, 0x33, 0x65, 0x08,
+    0x44, 0x80, 0x86, 0x18, 0x11, 0x43, 0x90, 0xB0, 0x80, 0x09, 0x71, 0x5E, 0x02, 0x8A, 0x40, 0x3C,
+    0x44, 0xDC, 0x5B, 0x19, 0x88, 0x98, 0x21, 0x0E, 0x32, 0x2B, 0x18, 0x80, 0x68, 0x26, 0x62, 0x94,
+    0x88, 0x83, 0x8C, 0x08, 0x64, 0x84, 0x05, 0x0E, 0xD1, 0x34, 0x57, 0x80, 0x08, 0x98, 0x48, 0x44,
+    0x30, 0x65, 0x04, 0x4B, 0x97, 0x38, 0xB1, 0x98, 0x32, 0x02, 0x38, 0x8C, 0x1F, 0x5D, 0x11, 0x66,
+    0x44, 0x14, 0x6A, 0x00, 0xC0, 0x84, 0x38, 0x2D, 0x23, 0x98, 0x32, 0x04, 0x22, 0x00, 0x3A, 0x34,
+    0xE0, 0x5D, 0x11, 0x80, 0x89, 0x18, 0x19, 0x42, 0xA9, 0x32, 0xC2, 0x02, 0x1A, 0x62, 0x54, 0x08,
+    0x47, 0xC2, 0x02, 0x87, 0x8E, 0xD1, 0x2B, 0x40, 0xB0, 0x20, 0x19, 0x31, 0x22, 0x44, 0x12, 0x39,
+    0x2C, 0x20, 0xC2, 0x09, 0x06, 0x35, 0xF0, 0x48, 0x1A, 0xBF, 0x82, 0xFC, 0xC1, 0x12, 0x4D, 0xC2,
+    0x02, 0x0E, 0x27, 0xD5, 0x57, 0x90, 0x75, 0xB0, 0xD6, 0x01, 0x40, 0x38, 0x88, 0x11, 0xA1, 0x60,
+    0x58, 0xE0, 0x30, 0x2E, 0x80, 0xC5, 0x89, 0x10, 0x60, 0x22, 0x46, 0x86, 0x11, 0xC8, 0x94, 0x11,
+    0x16, 0x38, 0x64, 0xAD, 0x60, 0x41, 0x87, 0xEE, 0x10, 0x2C, 0xC0, 0x44, 0x12, 0x90, 0x29, 0x23,
+    0x00, 0xF1, 0x00, 0x91, 0x0B, 0x01, 0xD2, 0x0E, 0x35, 0xD5, 0x27, 0xD0, 0x41, 0x83, 0x57, 0x0A,
+    0x60, 0x25, 0x14, 0x91, 0x00, 0x82, 0x21, 0x9A, 0x09, 0x58, 0x19, 0xE2, 0x05, 0x32, 0x4A, 0x02,
+    0x8F, 0xC4, 0x41, 0x2C, 0x08, 0x8C, 0x2C, 0x6E, 0x9C, 0x2C, 0x80, 0x34, 0x11, 0xA3, 0xA0, 0x8C,
+    0xB0, 0xC0, 0xA1, 0x94, 0x1D, 0xCB, 0x9A, 0x5C, 0x52, 0x5B, 0x71, 0xD3, 0x62, 0x79, 0x4E, 0x63,
+    0x91, 0x91, 0x63, 0x21, 0x9C, 0x27, 0x36, 0xA0, 0x18, 0x0C, 0xF0, 0x16, 0x9D, 0x5C, 0x37, 0xDE,
+    0x3A, 0x00, 0xC8, 0x02, 0x23, 0xB9, 0x81, 0x56, 0xEE, 0x01, 0x86, 0x68, 0x66, 0x04, 0x8A, 0x2F,
+    0x90, 0x01, 0x1A, 0xD2, 0x0C, 0x07, 0x98, 0x80, 0x79, 0x88, 0x3E, 0xC8, 0x42, 0x8C, 0x8C, 0x72,
+    0x46, 0x19, 0x61, 0x01, 0x8D, 0xE9, 0x28, 0x67, 0x94, 0x21, 0x88, 0x03, 0x87, 0x32, 0x96, 0x2C,
+    0x03, 0x89, 0x10, 0x53, 0xAC, 0x00, 0x4C, 0xC0, 0x3C, 0x40, 0x1F, 0x64, 0xB1, 0x38, 0x0F, 0xC1,
+    0x10, 0xCD, 0x0C, 0x09, 0x09, 0xC5, 0x17, 0xC8, 0x00, 0xAF, 0x22, 0xF3, 0x2C, 0x63, 0x2B, 0x2D,
+    0x84, 0x38, 0x2D, 0x85, 0x5E, 0x2D, 0x4C, 0xCA, 0x2D, 0x2E, 0xF6, 0x2D, 0x4F, 0xFD, 0x2D, 0xD1,
+    0x1B, 0x2E, 0xB2, 0x38, 0x2E, 0xB3, 0x4E, 0x30, 0x35, 0x5B, 0x30, 0xE0, 0x91, 0xED, 0x9B, 0xE5,
+    0x91, 0x9C, 0x45, 0x72, 0x9D, 0x25, 0x58, 0x10, 0x01, 0x58, 0x11, 0x28, 0x09, 0x55, 0x12, 0xE0,
+    0x34, 0x32, 0x60, 0x1D, 0x60, 0x01, 0x70, 0xC4, 0x89, 0xA9, 0x34, 0x60, 0x22, 0x62, 0xC4, 0x29,
+    0x67, 0x04, 0x03, 0x1E, 0x1D, 0x0B, 0x5A, 0x66, 0x35, 0x5A, 0xE8, 0x44, 0x5A, 0x8E, 0xC9, 0x61,
+    0x70, 0x03, 0x1A, 0xE8, 0x35, 0x70, 0x58, 0x3D, 0xD1, 0xD2, 0x34, 0x84, 0x30, 0x33, 0x8E, 0x42,
+    0x84, 0x04, 0x35, 0x00, 0x22, 0x46, 0x1C, 0x85, 0x66, 0x30, 0x00, 0xE2, 0x34, 0x40, 0x3C, 0xC0,
+    0x12, 0x1D, 0x20, 0x49, 0xC4, 0xA8, 0x38, 0x8A, 0x9D, 0x13, 0x16, 0xD0, 0x0E, 0x67, 0x6B, 0x5A,
+    0x9C, 0x99, 0x40, 0x09, 0x1A, 0x20, 0x60, 0x0F, 0xB0, 0x88, 0x44, 0xD4, 0x32, 0xEF, 0xD4, 0x02,
+    0x1A, 0xC4, 0x0A, 0x05, 0x68, 0x4C, 0x44, 0x13, 0xC4, 0x59, 0xBA, 0x5A, 0x10, 0xC4, 0x81, 0x43,
+    0x3C, 0xAD, 0x16, 0x84, 0x90, 0x15, 0x41, 0x0C, 0x11, 0x0E, 0x68, 0x08, 0x62, 0x34, 0xB0, 0x58,
+    0x94, 0xD8, 0x82, 0x1E, 0xDC, 0x42, 0x0E, 0x63, 0xE6, 0x5A, 0x8A, 0x88, 0x68, 0x66, 0x45, 0x0D,
+    0x26, 0x90, 0x01, 0x0E, 0x23, 0xD7, 0x5A, 0x88, 0x76, 0x38, 0x3F, 0xD8, 0x22, 0x90, 0x8A, 0x1A,
+    0x4C, 0x20, 0x2A, 0x80, 0x88, 0x1A, 0x4C, 0x20, 0x03, 0x2C, 0xA2, 0xD2, 0xB6, 0xC4, 0xEB, 0xB6,
+    0x10, 0x71, 0x91, 0xA8, 0xB3, 0xA5, 0x7D, 0x9B, 0x02, 0x1C, 0x34, 0x3F, 0x81, 0x2C, 0xB6, 0xA3,
+    0xB6, 0x4C, 0x32, 0x8F, 0xB0, 0x83, 0xA9, 0xE6, 0x11, 0x13, 0x02, 0x4C, 0x08, 0x30, 0x21, 0x4E,
+    0x23, 0x2B, 0x10, 0x39, 0x80, 0x40, 0xAD, 0x03, 0xC4, 0x86, 0x0D, 0x44, 0x33, 0x1B, 0x82, 0x09,
+    0x64, 0x00, 0x02, 0xB5, 0xCC, 0x88, 0x2A, 0x14, 0x4B, 0x03, 0x2C, 0x22, 0x89, 0xB7, 0xD0, 0xAE,
+    0xB7, 0x10, 0xED, 0x70, 0xCA, 0xBB, 0x05, 0x71, 0x1A, 0xD9, 0x70, 0x04, 0x22, 0x07, 0x1C, 0x20,
+    0xC0, 0x95, 0x68, 0x28, 0x64, 0x42, 0x2A, 0x12, 0x31, 0xC4, 0x0C, 0x40, 0x83, 0x4C, 0x48, 0x45,
+    0x32, 0x04, 0x61, 0x43, 0xCC, 0x00, 0x48, 0x84, 0x44, 0x1A, 0x54, 0x38, 0x01, 0x2C, 0x2E, 0x30,
+    0xB8, 0xCC, 0x4D, 0xB8, 0x1C, 0x93, 0xD3, 0x98, 0x04, 0x88, 0x88, 0x03, 0x1C, 0x06, 0x68, 0x04,
+    0x9C, 0xA0, 0x1A, 0x70, 0x38, 0x8D, 0x89, 0x80, 0x03, 0x22, 0xE2, 0xC0, 0x21, 0x42, 0x8C, 0x0B,
+    0x21, 0xCC, 0x45, 0x82, 0xC6, 0x0B, 0x07, 0x17, 0x17, 0xC4, 0x91, 0x5A, 0x01, 0x01, 0x66, 0x80,
+    0x01, 0x2A, 0x62, 0x54, 0x04, 0x23, 0x66, 0x58, 0x60, 0x54, 0x5C, 0xD6, 0x85, 0xF0, 0xDE, 0x05,
+    0x41, 0xE2, 0xC5, 0xD1, 0xE4, 0xE5, 0x21, 0xE7, 0x25, 0xFA, 0xF2, 0x45, 0x06, 0xF4, 0x65, 0x2E,
+    0x00, 0x06, 0x3C, 0xBE, 0x86, 0xB9, 0x48, 0x09, 0xBA, 0xCC, 0x2B, 0xBA, 0x18, 0xF1, 0x80, 0x4C,
+    0x4F, 0x62, 0xD1, 0x35, 0xCE, 0xE5, 0x99, 0xCF, 0x85, 0x00, 0x22, 0x62, 0x44, 0xC4, 0x50, 0x4C,
+    0x58, 0x00, 0xD2, 0x4C, 0x48, 0x63, 0x32, 0x22, 0x12, 0x64, 0x08, 0xE2, 0x00, 0x02, 0x1C, 0x44,
+    0x57, 0x43, 0x98, 0x88, 0xC8, 0xA1, 0x64, 0x84, 0x41, 0xEC, 0x80, 0xC3, 0xA8, 0x55, 0x17, 0x44,
+    0x2A, 0x87, 0x88, 0xA2, 0x2E, 0x80, 0x30, 0x21, 0x4E, 0x4B, 0x39, 0x65, 0x88, 0x53, 0x8B, 0x1A,
+    0x02, 0x11, 0x80, 0x18, 0x1D, 0xA7, 0x0C, 0x71, 0xAA, 0x08, 0x0B, 0x70, 0x28, 0x19, 0x71, 0x86,
+    0x41, 0xEC, 0x80, 0xC5, 0xC8, 0x65, 0x97, 0x39, 0x70, 0x17, 0x77, 0x58, 0x6D, 0xEC, 0xD2, 0x4C,
+    0x44, 0x33, 0x31, 0x44, 0x33, 0x1B, 0x00, 0x72, 0x10, 0x31, 0x87, 0x01, 0x09, 0x87, 0xA8, 0xD7,
+    0x2E, 0x24, 0x23, 0x1C, 0x65, 0x84, 0x0C, 0x40, 0x63, 0x42, 0xC2, 0x51, 0x46, 0x48, 0x41, 0x1C,
+    0x80, 0x34, 0xC2, 0x84, 0x0E, 0x6B, 0xE0, 0x5D, 0x9C, 0x16, 0x32, 0x04, 0x51, 0x43, 0x20, 0x02,
+    0x90, 0x90, 0x21, 0x88, 0x1A, 0x62, 0x06, 0x70, 0xD8, 0x94, 0xF0, 0xC2, 0x20, 0x0D, 0x30, 0x21,
+    0x4E, 0x0B, 0x39, 0xE1, 0x09, 0x52, 0x86, 0x40, 0x04, 0x10, 0x0E, 0xA0, 0x31, 0x88, 0x91, 0x30,
+    0xC2, 0x02, 0x87, 0x2F, 0x1C, 0x2F, 0x46, 0x8B, 0x08, 0x47, 0x38, 0x02, 0x2C, 0x48, 0x43, 0x8C,
+    0x0C, 0x25, 0x62, 0x12, 0x24, 0x2C, 0x70, 0x58, 0x2D, 0xF3, 0xB2, 0x54, 0xC4, 0x88, 0x38, 0x28,
+    0xCD, 0xB0, 0x00, 0x22, 0x36, 0x28, 0x34, 0x83, 0x01, 0x93, 0x64, 0x62, 0x2F, 0x08, 0x71, 0x2F,
+    0x11, 0x86, 0x2F, 0x94, 0x91, 0x2F, 0x60, 0x71, 0x8D, 0xEA, 0x25, 0x16, 0xEB, 0x05, 0x89, 0x15,
+    0xE1, 0xC4, 0x22, 0x0C, 0x80, 0x13, 0x52, 0x69, 0x00, 0xD2, 0x18, 0x0B, 0x8E, 0x28, 0x4E, 0x10,
+    0x97, 0x1A, 0xD0, 0x88, 0x43, 0xB4, 0xB5, 0x17, 0x52, 0x70, 0x02, 0xD0, 0x98, 0x86, 0x23, 0x88,
+    0x03, 0x87, 0xF3, 0x7F, 0x2F, 0x02, 0x10, 0x2C, 0x24, 0x24, 0x9C, 0x28, 0x54, 0x91, 0x29, 0x00,
+    0xA4, 0x22, 0x9C, 0x28, 0x46, 0x00, 0x9C, 0xC7, 0x89, 0x26, 0x04, 0x98, 0x48, 0x02, 0x22, 0x65,
+    0x04, 0x60, 0x02, 0xDA, 0xC1, 0x18, 0xFA, 0x09, 0x44, 0x98, 0x64, 0xC4, 0x30, 0x42, 0x8D, 0x03,
+    0x0E, 0xDD, 0xC3, 0x5F, 0xC0, 0xE2, 0x3B, 0xEE, 0x4B, 0xBC, 0xF6, 0x8B, 0x11, 0x11, 0x04, 0x43,
+    0x34, 0xB3, 0xA4, 0x38, 0x13, 0xC2, 0x0B, 0x64, 0x80, 0xC3, 0x37, 0xE2, 0x17, 0x02, 0x88, 0x15,
+    0x25, 0xC6, 0x50, 0x0C, 0x38, 0x74, 0x7F, 0x7E, 0x21, 0x80, 0x98, 0x51, 0x62, 0x0C, 0xC5, 0x00,
+    0x48, 0x33, 0x11, 0xA3, 0xA4, 0xC4, 0x88, 0x04, 0x19, 0x61, 0x01, 0x11, 0x80, 0x2B, 0x8A, 0x31,
+    0xA5, 0x81, 0xC3, 0xF6, 0x93, 0x8E, 0x80, 0x18, 0xD0, 0x21, 0x59, 0xFB, 0x0B, 0xD0, 0x0E, 0xA7,
+    0xF5, 0x5F, 0x04, 0x52, 0x82, 0x64, 0x58, 0x22, 0x10, 0x15, 0x40, 0x08, 0x92, 0x61, 0x89, 0x40,
+    0x06, 0x38, 0x8C, 0xFC, 0x80, 0x41, 0x87, 0x42, 0x4C, 0x22, 0x8D, 0x39, 0x84, 0xAD, 0x80, 0x41,
+    0xA4, 0x93, 0xC0, 0xC4, 0x81, 0x00, 0x85, 0x48, 0x07, 0x31, 0x32, 0x98, 0x38, 0x30, 0x2C, 0x70,
+    0x48, 0x8F, 0x02, 0x83, 0x84, 0x03, 0xCA, 0xEC, 0x94, 0x43, 0xA1, 0x1B, 0x98, 0x80, 0x9A, 0x10,
+    0xA7, 0x65, 0x08, 0xC9, 0x86, 0x40, 0x04, 0x98, 0xD0, 0x61, 0x85, 0x11, 0x8C, 0xD3, 0x4A, 0xC2,
+    0x19, 0x86, 0xA9, 0x21, 0x10, 0x01, 0x48, 0x49, 0x38, 0xC3, 0x30, 0x35, 0xC4, 0x0C, 0x40, 0x84,
+    0x04, 0xD4, 0x44, 0x8C, 0x8E, 0x33, 0x8C, 0x90, 0x6C, 0x84, 0x05, 0x16, 0x51, 0xDB, 0x60, 0xA4,
+    0x06, 0x61, 0x88, 0x48, 0x22, 0x46, 0x80, 0xA5, 0x4B, 0xCC, 0x60, 0x5C, 0x58, 0x60, 0xB1, 0x59,
+    0x0F, 0x46, 0x72, 0x8E, 0x43, 0x20, 0x11, 0x61, 0x0A, 0x15, 0x00, 0x64, 0x42, 0x9C, 0x16, 0x51,
+    0x86, 0x40, 0x04, 0x40, 0x9C, 0xD6, 0x20, 0x8E, 0x40, 0x04, 0x8C, 0x92, 0xA9, 0xC3, 0xA0, 0xDE,
+    0xC3, 0xAC, 0x27, 0xC4, 0xB0, 0x46, 0xC4, 0x34, 0x82, 0xC4, 0x48, 0x95, 0xC4, 0x50, 0xE6, 0xC4,
+    0x58, 0xF6, 0xC4, 0x88, 0xC7, 0x88, 0x5B, 0x98, 0xB9, 0x5F, 0x18, 0x9A, 0x63, 0x18, 0x81, 0x62,
+    0x88, 0x66, 0x56, 0xB0, 0x17, 0xC8, 0x00, 0x90, 0x86, 0x90, 0x11, 0xC3, 0x08, 0x12, 0x0E, 0x80,
+    0x34, 0x84, 0x6C, 0x30, 0x82, 0x84, 0x03, 0x0E, 0x19, 0xAC, 0x61, 0x08, 0x76, 0x48, 0x54, 0x6E,
+    0xD0, 0xCC, 0x86, 0x17, 0xC8, 0x00, 0x87, 0x6D, 0xE6, 0x30, 0xE4, 0x70, 0x92, 0x79, 0xA4, 0x01,
+    0xA6, 0x08, 0x37, 0x8C, 0x62, 0x1A, 0x38, 0x20, 0xCA, 0x37, 0x38, 0x6C, 0xA7, 0x09, 0x90, 0x87,
+    0xE4, 0x9E, 0x04, 0xED, 0x60, 0xB6, 0xA6, 0x65, 0x91, 0x5D, 0x20, 0xA6, 0xDD, 0x20, 0xC6, 0x68,
+    0x05, 0xC4, 0x81, 0x03, 0x03, 0x80, 0x18, 0x23, 0xC0, 0x01, 0x6B, 0x81, 0xD0, 0x3B, 0xC3, 0xD1,
+    0x3B, 0x03, 0xD2, 0x16, 0x81, 0xE5, 0x38, 0x48, 0x5E, 0x02, 0x10, 0xA0, 0x99, 0x0D, 0x85, 0x0C,
+    0x00, 0x1D, 0x18, 0xBA, 0x53, 0x1C, 0x36, 0xD0, 0xC4, 0x10, 0xED, 0x50, 0xEB, 0x25, 0x66, 0x36,
+    0x84, 0x43, 0xF6, 0x00, 0x66, 0x42, 0x38, 0x64, 0x0F, 0x70, 0xB0, 0x6A, 0x24, 0x61, 0x71, 0x80,
+    0xD1, 0x40, 0x12, 0x2A, 0x0B, 0x4C, 0x12, 0x9A, 0xC5, 0xA0, 0xAE, 0xC5, 0x34, 0xE5, 0xC5, 0x50,
+    0xF9, 0xC5, 0x80, 0x43, 0xFA, 0xAE, 0x18, 0x66, 0x42, 0x44, 0x42, 0x19, 0x42, 0x01, 0xC6, 0x31,
+    0x31, 0x40, 0x4B, 0x38, 0xAF, 0x10, 0x00, 0x90, 0x58, 0xC1, 0x3B, 0xE0, 0xB0, 0x32, 0x62, 0x80,
+    0x10, 0xA6, 0x05, 0x67, 0x08, 0x13, 0xD4, 0x48, 0x0D, 0x40, 0x54, 0x82, 0x20, 0x18, 0x60, 0x87,
+    0x4C, 0x89, 0x31, 0x48, 0x63, 0x12, 0x9E, 0x20, 0x0E, 0x58, 0x08, 0x49, 0x46, 0xA4, 0x70, 0x0E,
+    0x58, 0x8C, 0x09, 0x8D, 0x99, 0x41, 0x8D, 0x79, 0x10, 0x01, 0x98, 0x48, 0x44, 0x12, 0xAA, 0x8C,
+    0x00, 0x16, 0xD0, 0xA5, 0x28, 0xA2, 0x24, 0x06, 0x20, 0x8D, 0x69, 0x30, 0x82, 0x38, 0x00, 0x1C,
+    0xCA, 0xEB, 0xC6, 0x34, 0x0C, 0x22, 0x22, 0x48, 0x79, 0x42, 0x81, 0x04, 0xD3, 0xCA, 0x01, 0x8B,
+    0x4B, 0xCA, 0x31, 0x51, 0xD1, 0x31, 0x87, 0x28, 0x50, 0x10, 0x40, 0x88, 0xD8, 0x60, 0x92, 0x08,
+    0x06, 0x58, 0x10, 0x72, 0x20, 0xDD, 0x65, 0x30, 0x49, 0xF0, 0x1E, 0x83, 0x78, 0x1F, 0xB3, 0x28,
+    0x20, 0xE3, 0x90, 0x20, 0x23, 0x2C, 0x84, 0x30, 0x21, 0x22, 0x23, 0x05, 0x35, 0x84, 0x02, 0x9C,
+    0xC6, 0x61, 0x70, 0x05, 0x22, 0xE8, 0x35, 0x60, 0x40, 0x1C, 0x4A, 0x76, 0xAC, 0xA0, 0xC4, 0x62,
+    0x88, 0x1D, 0x00, 0x91, 0x1E, 0x92, 0x10, 0x4F, 0x00, 0x87, 0x6D, 0x15, 0x32, 0x8C, 0xD3, 0x20,
+    0x22, 0x82, 0xA0, 0x27, 0x14, 0xE0, 0x20, 0x0C, 0x22, 0x1A, 0x9E, 0x50, 0x00, 0x10, 0x2D, 0x38,
+    0xA2, 0x98, 0xD4, 0xC0, 0xA1, 0x4B, 0x9A, 0x4C, 0x79, 0x44, 0x36, 0x92, 0x71, 0xBA, 0x92, 0xA1,
+    0x00, 0x93, 0x21, 0x04, 0x84, 0x68, 0x87, 0x73, 0x41, 0x32, 0x02, 0xCE, 0x10, 0x4A, 0x04, 0xA2,
+    0x1A, 0xA8, 0x10, 0x4A, 0x04, 0x32, 0x00, 0x81, 0x68, 0x87, 0x33, 0x53, 0x32, 0x02, 0x6E, 0x10,
+    0x81, 0xA8, 0x06, 0x12, 0x44, 0x20, 0x03, 0x88, 0x46, 0xC0, 0xB0, 0xB4, 0xD4, 0x8A, 0xCC, 0x02,
+    0x16, 0xA2, 0x11, 0x48, 0x45, 0x62, 0x81, 0xA8, 0x00, 0x44, 0x33, 0xA1, 0x22, 0x33, 0xC0, 0xA5,
+    0xA0, 0xA1, 0x0C, 0xB9, 0xA3, 0x0C, 0x52, 0xBD, 0xCC, 0x32, 0xC3, 0xCC, 0x53, 0xC5, 0x0C, 0x20,
+    0x3D, 0xC4, 0x68, 0x88, 0x27, 0x2C, 0x60, 0x42, 0x9C, 0x16, 0x11, 0xD4, 0x10, 0x88, 0x80, 0x45,
+    0x56, 0x64, 0x99, 0x19, 0x75, 0x19, 0x61, 0x2E, 0xBA, 0xAF, 0xCA, 0xC4, 0xD9, 0xCA, 0x20, 0xA2,
+    0x42, 0xA5, 0xA0, 0x86, 0x50, 0x96, 0x86, 0x14, 0xD4, 0x30, 0x42, 0x01, 0xAD, 0x40, 0x20, 0x62,
+    0x69, 0x48, 0x41, 0x0D, 0x83, 0x08, 0x80, 0x0E, 0x05, 0x80, 0x65, 0x80, 0x55, 0xA0, 0x4A, 0x02,
+    0x87, 0xEB, 0xFD, 0x01, 0xF3, 0x00, 0x07, 0x09, 0xE0, 0x10, 0x65, 0x5A, 0x86, 0x68, 0x26, 0x00,
+    0x07, 0x98, 0x06, 0x34, 0xC0, 0x3C, 0x44, 0x0B, 0x97, 0x21, 0x46, 0x87, 0x78, 0x82, 0x94, 0x11,
+    0x16, 0xD0, 0x98, 0x10, 0xF1, 0x04, 0x29, 0x43, 0x10, 0x07, 0x44, 0x88, 0x80, 0x4C, 0x38, 0x43,
+    0x0D, 0x23, 0x94, 0x18, 0x0D, 0x2C, 0x9A, 0x84, 0x07, 0xB0, 0x06, 0xCC, 0x08, 0xE8, 0x60, 0xA0,
+    0xE1, 0x05, 0xD1, 0x4C, 0x40, 0x84, 0x3B, 0xC2, 0x0B, 0x64, 0x14, 0xD3, 0x00, 0x42, 0x98, 0x88,
+    0x51, 0x11, 0xD4, 0x08, 0x0B, 0x1C, 0x9E, 0x83, 0xCC, 0x00, 0x12, 0x31, 0x22, 0x4A, 0x3C, 0x61,
+    0x01, 0x40, 0x33, 0x23, 0x42, 0x84, 0x85, 0x0C, 0xF0, 0x88, 0x32, 0x36, 0xC3, 0xC2, 0x37, 0xF3,
+    0xB8, 0x41, 0x13, 0x16, 0x89, 0x99, 0x66, 0x96, 0xB2, 0x66, 0x80, 0xB8, 0x68, 0x8C, 0x34, 0x13,
+    0xD5, 0x89, 0x01, 0x48, 0x32, 0xC1, 0x94, 0x73, 0xC0, 0x81, 0xFB, 0x2B, 0xC3, 0xE1, 0xF8, 0xA6,
+    0x44, 0x46, 0x2C, 0x0B, 0x31, 0x22, 0x72, 0x0A, 0x0B, 0x00, 0x18, 0x60, 0x42, 0x44, 0x45, 0x78,
+    0x65, 0x08, 0x05, 0x0E, 0x65, 0x26, 0x3E, 0xE6, 0x21, 0x11, 0xE1, 0x00, 0x3A, 0x6C, 0x50, 0xF9,
+    0x70, 0x5A, 0xC3, 0x39, 0x02, 0x11, 0x4B, 0xC3, 0x43, 0x43, 0x20, 0x02, 0x0E, 0x11, 0x1D, 0x67,
+    0x88, 0x01, 0x01, 0x26, 0x62, 0xC1, 0x29, 0xE2, 0xBD, 0xB0, 0x44, 0x19, 0x21, 0x35, 0xF0, 0xD8,
+    0xA6, 0x3A, 0x23, 0x31, 0x3C, 0x33, 0x69, 0x3F, 0x63, 0x44, 0xC0, 0x44, 0x8C, 0x0E, 0xE1, 0x4C,
+    0x19, 0x61, 0x59, 0x2A, 0xDE, 0x13, 0xCE, 0x94, 0x11, 0x16, 0x40, 0x34, 0xF3, 0x50, 0x03, 0x77,
+    0x66, 0xC1, 0x1D, 0x82, 0x04, 0x32, 0x52, 0x03, 0x19, 0x82, 0x04, 0x32, 0x2C, 0x15, 0xEF, 0x09,
+    0x12, 0xC8, 0x00, 0x87, 0xA8, 0xEF, 0x33, 0x40, 0x5C, 0x8C, 0xC1, 0x9E, 0xC1, 0x52, 0x9F, 0x41,
+    0x08, 0xD9, 0x21, 0xCE, 0x29, 0x46, 0x84, 0x03, 0x0E, 0xF1, 0xC9, 0x67, 0x10, 0x42, 0x86, 0x88,
+    0x73, 0x8A, 0x11, 0xE1, 0x80, 0x0C, 0x71, 0x4E, 0x31, 0x0D, 0x54, 0x88, 0x73, 0x8A, 0x69, 0x80,
+    0xD3, 0x2A, 0xC4, 0x39, 0x02, 0x11, 0xB0, 0x88, 0x3A, 0x40, 0x33, 0xA9, 0x40, 0x43, 0x8C, 0x08,
+    0x31, 0x46, 0x58, 0x40, 0x63, 0x2A, 0xC4, 0x18, 0x82, 0x38, 0x70, 0x88, 0x4A, 0x41, 0x43, 0x8C,
+    0x0A, 0x31, 0x46, 0x58, 0x40, 0x63, 0x32, 0xC4, 0x18, 0x82, 0x38, 0x30, 0x79, 0x24, 0x43, 0x83,
+    0xDC, 0x44, 0xE3, 0xA8, 0x45, 0x13, 0x0F, 0x46, 0x43, 0x44, 0x88, 0x00, 0xAC, 0x0A, 0x61, 0x84,
+    0x2A, 0x09, 0x2C, 0xCA, 0x06, 0xD1, 0x60, 0x1D, 0xD1, 0x00, 0x88, 0x44, 0x8C, 0x86, 0x23, 0x4E,
+    0x58, 0x00, 0x22, 0x13, 0xCA, 0x11, 0x07, 0x90, 0x30, 0x06, 0x24, 0x84, 0x57, 0x80, 0x08, 0x01,
+    0x56, 0x81, 0x2A, 0xC9, 0x52, 0xF1, 0x62, 0x30, 0xA2, 0x24, 0x20, 0x22, 0x62, 0x43, 0x30, 0xC8,
+    0x00, 0x88, 0xE4, 0x34, 0xC4, 0x28, 0x11, 0x2F, 0x1A, 0x71, 0x10, 0x09, 0x0B, 0xBC, 0x0A, 0x84,
+    0xD2, 0x8C, 0x39, 0xD3, 0x14, 0xDD, 0xD3, 0x18, 0xF0, 0xD3, 0x2C, 0x4D, 0xD4, 0xB4, 0xA5, 0xD4,
+    0xB8, 0xBE, 0xD4, 0xC8, 0x15, 0xD5, 0xCC, 0x35, 0xD5, 0x54, 0x5B, 0xD6, 0xDC, 0x7A, 0xD7, 0x80,
+    0x43, 0x26, 0x4E, 0x9A, 0x03, 0x68, 0x04, 0x52, 0x01, 0x0B, 0x51, 0x01, 0x20, 0x07, 0x0B, 0x73,
+    0x18, 0x8F, 0x87, 0x94, 0x34, 0x51, 0xB4, 0x34, 0xD8, 0xB9, 0x34, 0x0E, 0x15, 0x01, 0x48, 0x63,
+    0x12, 0x9C, 0x20, 0x0E, 0xC0, 0xDE, 0xC1, 0x74, 0x1C, 0xC8, 0xE1, 0x63, 0x32, 0xCD, 0xE2, 0x3C,
+    0xC4, 0x80, 0x80, 0x0C, 0x95, 0x50, 0x0C, 0x4B, 0x14, 0x60, 0x26, 0x98, 0x16, 0x07, 0x78, 0x44,
+    0x97, 0xA2, 0x70, 0x51, 0xA7, 0xA1, 0x83, 0xA7, 0x21, 0x2A, 0x77, 0x48, 0x4B, 0x4E, 0x13, 0xC9,
+    0x86, 0x32, 0x91, 0x39, 0x40, 0x6C, 0x28, 0x13, 0x31, 0x03, 0x2C, 0xC8, 0x3C, 0x38, 0xC2, 0xE5,
+    0x20, 0x90, 0x0A, 0x41, 0x16, 0x53, 0x01, 0x70, 0x07, 0x31, 0x5B, 0x28, 0x8B, 0x40, 0xED, 0x0E,
+    0x68, 0x0B, 0x35, 0x44, 0x43, 0x10, 0x31, 0x42, 0x90, 0x10, 0x0C, 0x40, 0x34, 0x04, 0x11, 0x23,
+    0x48, 0x08, 0x06, 0x1C, 0xA2, 0x6F, 0xD4, 0x80, 0x83, 0xA8, 0x76, 0x07, 0xD2, 0xA9, 0xF8, 0x45,
+    0xC4, 0x25, 0x71, 0xA0, 0xA5, 0x81, 0x24, 0x71, 0x06, 0xE0, 0xE0, 0x88, 0x42, 0x08, 0x6A, 0xE0,
+    0x10, 0x17, 0xA8, 0x86, 0x1E, 0x9A, 0x41, 0x25, 0x44, 0x8C, 0x43, 0xC9, 0x0A, 0xF3, 0x10, 0x3B,
+    0xA0, 0xA1, 0x10, 0x82, 0x1A, 0x20, 0x38, 0x8D, 0x44, 0x8C, 0x04, 0x15, 0x16, 0x98, 0x24, 0x42,
+    0xAB, 0x39, 0xAD, 0xAB, 0x41, 0xF8, 0xAB, 0x89, 0x61, 0xAC, 0x01, 0x8C, 0x85, 0x60, 0x88, 0x66,
+    0x92, 0x1D, 0xC4, 0xA5, 0xF0, 0x02, 0x19, 0x07, 0x88, 0x80, 0x09, 0x69, 0x18, 0xA2, 0x99, 0x1D,
+    0xA3, 0x08, 0xF2, 0x02, 0x19, 0x00, 0x25, 0x21, 0xC0, 0x84, 0x88, 0x84, 0x33, 0x84, 0x02, 0xE6,
+    0xE1, 0x0A, 0x62, 0x0D, 0x32, 0xE1, 0x84, 0x06, 0x0E, 0xD0, 0x3A, 0x00, 0x10, 0x0F, 0xD1, 0x10,
+    0x54, 0x8C, 0x30, 0x81, 0x04, 0x66, 0xC0, 0xA2, 0x8B, 0x70, 0x4D, 0x5C, 0x74, 0x0D, 0x3A, 0x8C,
+    0xCD, 0xAD, 0x71, 0xE2, 0x61, 0x2B, 0x6C, 0x0D, 0x43, 0x34, 0xB3, 0xC2, 0x20, 0xF2, 0x02, 0x19,
+    0x00, 0x43, 0x34, 0x33, 0xC3, 0x20, 0xF2, 0x02, 0x19, 0x80, 0xC3, 0x10, 0xCD, 0x6C, 0x20, 0x2F,
+    0x90, 0x01, 0x2C, 0xD4, 0x84, 0x38, 0x0D, 0x10, 0xE1, 0x96, 0x89, 0x12, 0x1B, 0x02, 0x91, 0x62,
+    0x1A, 0x80, 0x38, 0x0D, 0x43, 0x34, 0x93, 0x0C, 0x11, 0x06, 0x91, 0x17, 0xC8, 0x38, 0xC0, 0xA4,
+    0x23, 0x48, 0xE0, 0x03, 0x1C, 0x4A, 0xC3, 0xD7, 0x20, 0x83, 0xE4, 0x0C, 0x24, 0xE2, 0xA0, 0x15,
+    0x00, 0xC4, 0x19, 0x48, 0x84, 0x38, 0x68, 0x05, 0x80, 0x2E, 0x92, 0x03, 0xD8, 0x20, 0x33, 0xD8,
+    0x00, 0x0B, 0x12, 0x44, 0x08, 0xC5, 0x3A, 0x44, 0x12, 0xD2, 0x08, 0xF6, 0xC0, 0xE4, 0xB2, 0x88,
+    0xCD, 0xE3, 0x8C, 0xCD, 0x1C, 0x8F, 0x4D, 0x8D, 0x91, 0x0D, 0xB0, 0x10, 0xCD, 0x8C, 0x98, 0x25,
+    0x05, 0x32, 0x00, 0x24, 0x1C, 0x46, 0xBA, 0xD8, 0x20, 0x14, 0x4B, 0x30, 0x82, 0x3D, 0x80, 0x62,
+    0x05, 0x82, 0x3D, 0x70, 0xF8, 0x3C, 0x6E, 0x40, 0x8C, 0x82, 0x18, 0x16, 0xE0, 0x44, 0x08, 0xB0,
+    0x32, 0xCA, 0x40, 0x46, 0x94, 0x04, 0x1E, 0x89, 0xA9, 0x6C, 0x90, 0xA9, 0x6C, 0xD6, 0xC0, 0x6C,
+    0xC0, 0xC1, 0xEA, 0x6F, 0x82, 0x75, 0x48, 0xA2, 0x65, 0x03, 0x34, 0x33, 0xA2, 0xA4, 0x40, 0x06,
+    0x00, 0x2C, 0x44, 0x33, 0x2B, 0x4A, 0x0A, 0x64, 0x80, 0x43, 0xD2, 0x46, 0x1B, 0x60, 0x42, 0xC4,
+    0xE2, 0x3A, 0xA0, 0x8D, 0x3E, 0xA2, 0x0D, 0xB0, 0x2C, 0xB8, 0xC3, 0x94, 0x21, 0x54, 0x49, 0xA9,
+    0x01, 0xB8, 0xC2, 0x94, 0x21, 0x54, 0x49, 0xA9, 0x81, 0x08, 0x53, 0x86, 0x50, 0x80, 0x34, 0x11,
+    0x23, 0xA3, 0x18, 0x13, 0xCE, 0x08, 0xCB, 0xD2, 0x60, 0x82, 0x1A, 0x61, 0x81, 0x49, 0x24, 0x5A,
+    0x9B, 0x67, 0x5F, 0x1B, 0x79, 0x6C, 0x9B, 0x59, 0x82, 0x1B, 0xA2, 0x99, 0x10, 0x60, 0x55, 0x9C,
+    0x40, 0x86, 0x28, 0x09, 0x98, 0x18, 0x60, 0x22, 0x46, 0xC6, 0x10, 0xAF, 0x8C, 0xB0, 0x00, 0x72,
+    0x28, 0xFD, 0x6C, 0x23, 0x0E, 0x11, 0x55, 0x07, 0x80, 0x65, 0xC1, 0x0D, 0xA2, 0xA4, 0xD4, 0x00,
+    0x04, 0x58, 0x16, 0x5C, 0xA1, 0x44, 0x49, 0xA9, 0x01, 0xE4, 0x50, 0x9E, 0xDF, 0xA6, 0x2D, 0xCA,
+    0x39, 0x03, 0x4C, 0xB1, 0xDB, 0x08, 0x08, 0xB0, 0x1A, 0x86, 0x28, 0x09, 0x2C, 0xA2, 0xB0, 0x11,
+    0xD0, 0xE3, 0xDB, 0x00, 0xC8, 0x4A, 0x10, 0x25, 0x81, 0x03, 0x50, 0x7A, 0x1B, 0xC8, 0x04, 0xAC,
+    0x08, 0x32, 0x44, 0x49, 0x00, 0x10, 0x0E, 0x57, 0x26, 0x6E, 0x10, 0xE9, 0x20, 0x64, 0x44, 0x12,
+    0x07, 0x86, 0x03, 0x20, 0x12, 0xD2, 0x98, 0x04, 0x28, 0x88, 0x03, 0xCE, 0xA1, 0x83, 0xCA, 0x4D,
+    0xE3, 0x08, 0x44, 0x33, 0x45, 0x88, 0xC0, 0x0A, 0xCE, 0x03, 0x24, 0x52, 0x31, 0x20, 0x3A, 0xC1,
+    0xD2, 0x30, 0x20, 0x3A, 0x40, 0x3C, 0x7C, 0x25, 0xBA, 0x71, 0x1E, 0x04, 0x68, 0x1D, 0xBF, 0x88,
+    0x19, 0x14, 0x43, 0x21, 0xE0, 0xD0, 0x4D, 0xEA, 0x86, 0x00, 0x5A, 0xC6, 0x2F, 0x62, 0x06, 0xC5,
+    0x50, 0x08, 0x38, 0x20, 0xDC, 0xB9, 0x39, 0x44, 0x81, 0xBD, 0x21, 0x8B, 0x91, 0x93, 0x37, 0x38,
+    0xAC, 0x37, 0xED, 0x70, 0x26, 0xEE, 0xE6, 0x98, 0x28, 0x60, 0x59, 0x70, 0xC6, 0x60, 0x25, 0xA5,
+    0x06, 0x1E, 0x8F, 0x05, 0x6F, 0x90, 0x17, 0x6F, 0x68, 0xD8, 0x08, 0x80, 0x65, 0xC1, 0x0D, 0xAC,
+    0xA4, 0xD4, 0x00, 0x87, 0x32, 0x4E, 0x05, 0x1D, 0x10, 0x31, 0x07, 0x01, 0x60, 0x59, 0x70, 0x04,
+    0x2B, 0x29, 0x35, 0x70, 0x88, 0x09, 0x7A, 0x33, 0x1D, 0x48, 0x63, 0x22, 0xDA, 0x80, 0x82, 0x38,
+    0x60, 0x42, 0x87, 0x2D, 0x16, 0x37, 0x0C, 0x69, 0xA0, 0x43, 0xBC, 0x00, 0x0E, 0xA2, 0x79, 0x35,
+    0x0C, 0x44, 0x33, 0x01, 0xCB, 0x82, 0x1B, 0x52, 0x03, 0xAF, 0x22, 0x2A, 0x38, 0xE4, 0x8D, 0x38,
+    0x07, 0x28, 0x39, 0x28, 0x39, 0x39, 0x8B, 0x64, 0x39, 0x2C, 0x77, 0x39, 0x2E, 0x7B, 0x39, 0x2F,
+    0x8D, 0x39, 0xF1, 0x6C, 0x3A, 0xB2, 0x76, 0x3A, 0xB3, 0x7B, 0x3A, 0x60, 0x91, 0xFD, 0x01, 0xE7,
+    0xF5, 0x03, 0xC7, 0x20, 0xE2, 0x61, 0x14, 0xFF, 0x0D, 0x30, 0x0F, 0x51, 0xE8, 0x6F, 0x48, 0x84,
+    0x0B, 0xA6, 0x8C, 0x00, 0x34, 0x26, 0xC3, 0x05, 0x53, 0x86, 0x20, 0x0E, 0x00, 0xE6, 0x21, 0xF2,
+    0x01, 0x0E, 0xA9, 0x70, 0xC1, 0x94, 0x11, 0x80, 0xC6, 0x74, 0xB8, 0x60, 0xCA, 0x10, 0xC4, 0x81,
+    0xC3, 0x67, 0x0D, 0x1C, 0xA4, 0x01, 0xE6, 0x01, 0xE9, 0x39, 0x8A, 0xD9, 0x10, 0x5E, 0x1C, 0x00,
+    0xD0, 0x48, 0x88, 0xD3, 0x3A, 0x62, 0x21, 0x47, 0x20, 0x02, 0x1E, 0xC9, 0x87, 0x70, 0x50, 0xEE,
+    0x70, 0xA8, 0x05, 0x71, 0xC0, 0x61, 0x6B, 0x0F, 0x8E, 0x30, 0x1B, 0x8A, 0x1A, 0x80, 0x41, 0x1A,
+    0x60, 0x21, 0x2E, 0x80, 0xC7, 0x11, 0x2A, 0x9C, 0x45, 0x2D, 0x9C, 0x68, 0x37, 0x1C, 0x81, 0x9A,
+    0x11, 0x41, 0xB1, 0x01, 0x0C, 0xC4, 0x68, 0x08, 0x2B, 0x2C, 0x70, 0xB8, 0x4C, 0x86, 0x43, 0x34,
+    0x33, 0x21, 0x05, 0x32, 0xC0, 0x03, 0x50, 0x66, 0x8B, 0x6C, 0x4D, 0x80, 0x56, 0xEE, 0x01, 0x01,
+    0x91, 0x48, 0x46, 0x30, 0x4A, 0x9C, 0x00, 0x0E, 0xE7, 0xC5, 0x05, 0xA4, 0x89, 0x18, 0x15, 0xE2,
+    0x8C, 0xB0, 0x80, 0x45, 0x42, 0xAA, 0x05, 0x67, 0x24, 0x76, 0xC4, 0x0C, 0xA9, 0x81, 0x4B, 0x52,
+    0x5E, 0x9C, 0x35, 0x64, 0x1C, 0x66, 0x6E, 0x9C, 0xE7, 0x71, 0x9C, 0x78, 0x7B, 0x1C, 0x71, 0x38,
+    0xC3, 0x8A, 0x83, 0x48, 0x48, 0x63, 0x2A, 0x8C, 0x12, 0x47, 0x10, 0x07, 0x0E, 0x29, 0x6E, 0x71,
+    0x10, 0xA7, 0x35, 0xB0, 0x21, 0x10, 0x01, 0x88, 0xD1, 0xC0, 0x46, 0x58, 0xC0, 0x80, 0x34, 0xC6,
+    0x82, 0x3B, 0x54, 0x08, 0x4B, 0x10, 0x97, 0x1A, 0x38, 0x5C, 0xA4, 0xC6, 0x21, 0x9A, 0x19, 0xA1,
+    0x42, 0x4A, 0x81, 0x0C, 0x80, 0x68, 0x66, 0x85, 0x0A, 0x29, 0x05, 0x32, 0x80, 0x67, 0x21, 0x11,
+    0xE5, 0xC5, 0x14, 0xC0, 0xE1, 0xB4, 0x3C, 0x4E, 0x84, 0x10, 0x8D, 0x40, 0x3A, 0x62, 0x30, 0x22,
+    0x10, 0x15, 0x40, 0x82, 0x0A, 0x71, 0x80, 0x49, 0xB1, 0x86, 0x9C, 0xF7, 0x89, 0x1C, 0xB9, 0x8C,
+    0x9C, 0x79, 0x8F, 0x9C, 0x00, 0x98, 0x48, 0x45, 0x51, 0xC1, 0xC8, 0x32, 0x02, 0x80, 0x10, 0x12,
+    0x49, 0x38, 0xE1, 0x00, 0xB3, 0x41, 0x05, 0x13, 0x07, 0x80, 0xE4, 0x03, 0xD2, 0x97, 0x13, 0x44,
+    0xD4, 0x00, 0xAB, 0x63, 0x04, 0x43, 0x4A, 0x02, 0x87, 0x68, 0x34, 0x39, 0xC0, 0x32, 0x11, 0xA3,
+    0xA2, 0xA4, 0x11, 0x16, 0x10, 0x0E, 0xA6, 0x45, 0x09, 0x1E, 0x45, 0x9C, 0x72, 0x1A, 0xAD, 0x72,
+    0xA4, 0xB9, 0x72, 0x02, 0x64, 0x42, 0x9C, 0x96, 0x01, 0x85, 0x14, 0x43, 0x20, 0x02, 0x4C, 0x48,
+    0x63, 0x2A, 0x94, 0x18, 0x82, 0x38, 0x40, 0x98, 0x0D, 0x43, 0x10, 0x35, 0x80, 0xB9, 0x00, 0x94,
+    0xD9, 0x82, 0xDC, 0x4C, 0x70, 0x48, 0xF9, 0x96, 0x83, 0x2C, 0xC4, 0x88, 0x10, 0x29, 0x2C, 0x60,
+    0x20, 0x64, 0x84, 0x4A, 0x6C, 0x85, 0x03, 0x0E, 0x80, 0xB9, 0x71, 0x0E, 0xA5, 0x07, 0x73, 0xDA,
+    0x81, 0x2B, 0x63, 0x09, 0x85, 0x58, 0x80, 0xC9, 0x69, 0x0D, 0x61, 0x20, 0x02, 0x26, 0x09, 0x57,
+    0x73, 0x90, 0xDC, 0x73, 0x96, 0x27, 0x74, 0x22, 0xA6, 0x74, 0xC0, 0xE1, 0x44, 0x69, 0xCE, 0x82,
+    0xB4, 0x86, 0x54, 0x04, 0x01, 0x22, 0xC4, 0x99, 0x05, 0x65, 0x04, 0x30, 0x39, 0x80, 0x9C, 0x83,
+    0x2A, 0x9D, 0xB3, 0xC6, 0x9D, 0x13, 0x43, 0x9E, 0x23, 0x0E, 0x89, 0x08, 0x07, 0x10, 0x60, 0x59,
+    0x70, 0xC8, 0x89, 0x41, 0x89, 0x92, 0x52, 0x03, 0x90, 0xC9, 0x69, 0x80, 0x08, 0x47, 0x08, 0x44,
+    0x8A, 0x69, 0x00, 0x43, 0x34, 0x93, 0xAC, 0x30, 0xE2, 0x05, 0x32, 0x0E, 0xB0, 0x16, 0x64, 0x6B,
+    0x02, 0xB4, 0x72, 0x0F, 0xA0, 0x43, 0xE0, 0x66, 0x02, 0xA2, 0x1D, 0x08, 0xDA, 0x7C, 0x2C, 0x12,
+    0x04, 0xE8, 0x44, 0x2B, 0xE8, 0x0C, 0xC8, 0x84, 0x38, 0x8D, 0xEC, 0x08, 0x4B, 0x0C, 0x81, 0xC8,
+    0x01, 0x22, 0xA2, 0x11, 0x48, 0x46, 0x30, 0x22, 0x10, 0x15, 0x00, 0xA2, 0x11, 0x48, 0x45, 0x30,
+    0x22, 0x10, 0x15, 0xC0, 0x22, 0x3A, 0x8C, 0x8E, 0x2B, 0x90, 0x0E, 0x38, 0x6C, 0x4F, 0xD1, 0x41,
+    0x1A, 0x60, 0x42, 0x9C, 0x96, 0x41, 0xCA, 0x10, 0x88, 0x00, 0x48, 0x63, 0x1A, 0x04, 0x11, 0xC4,
+    0x01, 0xE2, 0x70, 0x62, 0x47, 0x07, 0x99, 0x07, 0x84, 0x8F, 0x08, 0x16, 0x9C, 0x20, 0x46, 0x6A,
+    0xE0, 0x70, 0x2A, 0x49, 0x07, 0x1D, 0x4C, 0xDD, 0x8B, 0x00, 0x26, 0xC4, 0x69, 0x15, 0x62, 0x94,
+    0x21, 0x10, 0x01, 0x87, 0xC8, 0x0A, 0x3A, 0xCE, 0x83, 0x00, 0xF3, 0x10, 0xAD, 0x4C, 0x87, 0x18,
+    0x11, 0x46, 0x94, 0x11, 0x16, 0xE0, 0xB4, 0x0A, 0x23, 0xCA, 0x10, 0x88, 0x00, 0x84, 0x24, 0x11,
+    0xA3, 0x22, 0x9A, 0x70, 0x4E, 0x58, 0x00, 0x32, 0x13, 0xC4, 0x19, 0x60, 0x11, 0x09, 0x55, 0x27,
+    0x36, 0x56, 0x87, 0x2C, 0x36, 0x4A, 0xEA, 0x44, 0x5A, 0xEA, 0x30, 0xC4, 0x82, 0x23, 0x4C, 0x78,
+    0x21, 0x35, 0x70, 0x30, 0xE5, 0xDD, 0x72, 0xC8, 0x0A, 0xAA, 0x43, 0x8C, 0x88, 0x60, 0x46, 0x58,
+    0x00, 0x22, 0xCD, 0x0A, 0x13, 0x9E, 0x38, 0x03, 0x68, 0x66, 0x80, 0x1A, 0x96, 0x06, 0x3E, 0x0A,
+    0x19, 0x60, 0x91, 0xEC, 0x58, 0xC7, 0x51, 0x5B, 0x07, 0x1C, 0xD6, 0x0A, 0xEB, 0x0C, 0xE8, 0x40,
+    0xEC, 0x07, 0x04, 0x38, 0x30, 0x3F, 0xE9, 0xC0, 0x0E, 0xD7, 0xB7, 0x01, 0xC8, 0x21, 0xE3, 0x23,
+    0x82, 0xF3, 0x1C, 0xC8, 0x42, 0x32, 0x50, 0x84, 0x22, 0x05, 0x20, 0x1A, 0x90, 0x06, 0x88, 0x87,
+    0xB8, 0xED, 0x3A, 0xC8, 0x82, 0x4B, 0x0A, 0x32, 0x4B, 0x90, 0x62, 0x44, 0x6A, 0xA0, 0xA3, 0x20,
+    0xB3, 0x04, 0x29, 0xA6, 0x81, 0x55, 0xB2, 0xA1, 0x1D, 0xE4, 0xA5, 0x9D, 0xC5, 0xA8, 0x1D, 0x26,
+    0xAB, 0x9D, 0xD6, 0xC2, 0x9D, 0xC8, 0xC6, 0x1D, 0x79, 0xCD, 0x9D, 0xF9, 0xCF, 0x1D, 0xCA, 0xD1,
+    0x9D, 0x4A, 0xD5, 0x1D, 0x01, 0x2D, 0x36, 0xD1, 0xEC, 0xC8, 0xF7, 0xEC, 0xAC, 0xC3, 0xE5, 0x95,
+    0x1D, 0x74, 0x38, 0x19, 0x3A, 0x00, 0x4C, 0x24, 0x61, 0x94, 0x11, 0x00, 0x64, 0x02, 0x26, 0x52,
+    0x21, 0x46, 0x19, 0x01, 0x00, 0x26, 0x62, 0x64, 0x1C, 0x25, 0x48, 0x19, 0x61, 0x01, 0xB3, 0xE1,
+    0x28, 0x71, 0x06, 0x30, 0x51, 0x11, 0xA9, 0x08, 0x65, 0x30, 0x13, 0x80, 0x45, 0x22, 0x0D, 0xE9,
+    0x04, 0x80, 0x1C, 0x48, 0xA2, 0xBD, 0x2C, 0xB2, 0xE1, 0xED, 0xB8, 0x03, 0xEE, 0x20, 0x6B, 0x91,
+    0x48, 0x74, 0x60, 0x55, 0x6E, 0x07, 0x1C, 0xC6, 0xBC, 0xED, 0x20, 0x31, 0x41, 0x14, 0x03, 0x0A,
+    0x44, 0x31, 0x00, 0x02, 0xC4, 0x06, 0x51, 0x0C, 0x80, 0x2C, 0x08, 0x10, 0x2B, 0x44, 0x12, 0xC5,
+    0x00, 0xF4, 0x40, 0x6A, 0x26, 0x01, 0x30, 0x21, 0x12, 0x2B, 0x50, 0xE2, 0x3C, 0x80, 0x68, 0x0E,
+    0x02, 0x99, 0x21, 0xDF, 0xA8, 0x40, 0x13, 0x08, 0x0C, 0x62, 0x00, 0x0B, 0x49, 0x48, 0x27, 0x00,
+    0xA2, 0x40, 0x0D, 0xC0, 0x38, 0x66, 0x04, 0x62, 0x0E, 0x0E, 0xC0, 0xA1, 0xA6, 0x08, 0x08, 0x16,
+    0x52, 0x61, 0x8A, 0x4C, 0x01, 0x6C, 0x86, 0x33, 0xEF, 0x08, 0x95, 0xEF, 0x0C, 0xA9, 0xEF, 0xA0,
+    0xD0, 0xEF, 0x30, 0xE7, 0xEF, 0x44, 0x0C, 0xF0, 0x80, 0x03, 0x99, 0xF0, 0x00, 0xF4, 0x30, 0x6E,
+    0x7B, 0x07, 0x88, 0x70, 0xC6, 0x37, 0x0A, 0xD2, 0xB0, 0x62, 0x1A, 0x00, 0x44, 0xB8, 0xE3, 0x1B,
+    0x05, 0x69, 0x58, 0x31, 0x0D, 0x98, 0x4E, 0xC2, 0x50, 0x10, 0x88, 0x08, 0x60, 0x59, 0x70, 0x45,
+    0x30, 0x25, 0xA5, 0x06, 0x2C, 0xA3, 0x41, 0x84, 0xB4, 0x00, 0x06, 0x69, 0x10, 0x69, 0x56, 0x08,
+    0x22, 0xCE, 0x00, 0x87, 0xF3, 0x11, 0x3C, 0x0E, 0xE3, 0x34, 0xA4, 0x23, 0xC2, 0x60, 0xD0, 0x43,
+    0x24, 0x00, 0xC8, 0x82, 0x03, 0xC4, 0x68, 0xE0, 0x55, 0x18, 0x89, 0x67, 0x24, 0xD5, 0x83, 0x9C,
+    0x8B, 0xA7, 0xB0, 0x8E, 0xC7, 0x54, 0x8F, 0x67, 0x35, 0x90, 0x87, 0x5D, 0x91, 0xA7, 0x95, 0x92,
+    0x27, 0x2E, 0x97, 0x47, 0x0A, 0x99, 0x67, 0x86, 0x9A, 0x07, 0x68, 0x87, 0x4B, 0x45, 0x3C, 0xC8,
+    0x44, 0x22, 0x88, 0x18, 0x01, 0x24, 0x90, 0x92, 0x80, 0x09, 0x1D, 0xBA, 0x5A, 0xF1, 0x08, 0x88,
+    0x43, 0xC9, 0x88, 0x21, 0x10, 0x3B, 0x00, 0x25, 0x13, 0x86, 0x40, 0xEC, 0x80, 0xC3, 0xC8, 0x38,
+    0x9E, 0x95, 0x10, 0x42, 0xB2, 0xB4, 0x8A, 0x90, 0x96, 0xA5, 0x55, 0xA4, 0x60, 0x69, 0x84, 0xA2,
+    0x24, 0x70, 0x20, 0xB2, 0x0D, 0x00, 0x99, 0x4E, 0xC2, 0x80, 0xC0, 0x31, 0x21, 0xED, 0xC0, 0xC4,
+    0x93, 0x00, 0x02, 0x30, 0x44, 0x33, 0x2B, 0xCA, 0x0B, 0x64, 0x00, 0xC8, 0x82, 0x10, 0x32, 0xA3,
+    0x3C, 0x91, 0x44, 0x38, 0x60, 0x11, 0xF5, 0x95, 0xA7, 0x75, 0x96, 0x07, 0x2C, 0x2E, 0xB0, 0x0E,
+    0xB4, 0xAB, 0xF2, 0x08, 0x08, 0xB0, 0x1A, 0x88, 0x12, 0x25, 0x01, 0xE2, 0x00, 0x85, 0x8D, 0xE0,
+    0x60, 0xD2, 0xE6, 0x03, 0x22, 0x9D, 0x06, 0x71, 0x20, 0x38, 0x9C, 0x22, 0xE6, 0x21, 0x9A, 0x11,
+    0x61, 0x44, 0x20, 0x0B, 0x1C, 0x48, 0x94, 0x3F, 0x40, 0x9C, 0x06, 0x08, 0x16, 0x92, 0x71, 0x04,
+    0x22, 0x45, 0xA6, 0x00, 0x2C, 0x44, 0x6C, 0x48, 0x23, 0x18, 0xF0, 0x48, 0xFC, 0xCF, 0xE3, 0x7E,
+    0xD0, 0x43, 0xBF, 0xD1, 0x03, 0x16, 0x25, 0xE9, 0x79, 0xEC, 0xF2, 0x79, 0x18, 0x20, 0x58, 0x48,
+    0xC3, 0x2B, 0x32, 0x05, 0x80, 0x34, 0x94, 0x74, 0x02, 0x40, 0x48, 0x32, 0x21, 0x85, 0x73, 0x00,
+    0x62, 0x14, 0x2C, 0x4B, 0xAB, 0x09, 0x61, 0x01, 0x54, 0x84, 0x0E, 0xE5, 0x29, 0x7A, 0x1A, 0x52,
+    0xC1, 0x90, 0x11, 0x24, 0x00, 0x07, 0x43, 0xB4, 0x83, 0x49, 0x8A, 0x01, 0x4E, 0x84, 0x48, 0xA7,
+    0x02, 0x31, 0x23, 0x0E, 0x04, 0x9B, 0x0C, 0x4E, 0x3D, 0xCD, 0x5E, 0x3D, 0xCE, 0x72, 0x3D, 0x11,
+    0x7C, 0x3D, 0x74, 0x5D, 0x3E, 0x56, 0xA5, 0x3E, 0xEB, 0xD0, 0x35, 0xA8, 0x67, 0xB1, 0x5C, 0x01,
+    0xBA, 0xE0, 0xD0, 0x52, 0xA9, 0xC7, 0xB1, 0x09, 0x09, 0x5D, 0x50, 0x90, 0xD0, 0x05, 0x87, 0x91,
+    0x57, 0x3D, 0xC4, 0x48, 0x30, 0x2F, 0x2C, 0x90, 0x60, 0xD0, 0xB3, 0xB4, 0x22, 0xF3, 0xC0, 0xE1,
+    0x14, 0x5B, 0x0F, 0x31, 0x21, 0x22, 0x23, 0x42, 0x44, 0xC2, 0x10, 0x0A, 0x88, 0x10, 0x22, 0x36,
+    0x88, 0x60, 0x00, 0x67, 0x0A, 0x80, 0x65, 0x55, 0x0C, 0x59, 0x52, 0x02, 0xAF, 0x41, 0xA2, 0x3D,
+    0xA4, 0xB0, 0x3D, 0x85, 0x00, 0x08, 0xE6, 0xC6, 0x3D, 0x07, 0xD8, 0x3D, 0x08, 0xDF, 0x3D, 0x6C,
+    0xE5, 0x3D, 0x12, 0x15, 0x3E, 0x93, 0x31, 0x3E, 0x74, 0x4F, 0x3E, 0x76, 0x58, 0x3E, 0x80, 0x2E,
+    0xA0, 0x05, 0x1C, 0xA2, 0xAB, 0xF6, 0x80, 0x83, 0x41, 0x9B, 0x0F, 0x03, 0xD1, 0x0A, 0x56, 0x20,
+    0xE0, 0xD0, 0x26, 0xB8, 0x67, 0xA2, 0x1A, 0x60, 0x22, 0x16, 0x1C, 0x32, 0x18, 0x29, 0x23, 0xA4,
+    0x06, 0x00, 0xD1, 0x48, 0x40, 0x66, 0x81, 0x43, 0x04, 0xEA, 0x1E, 0x62, 0x02, 0x82, 0x85, 0x34,
+    0x8C, 0x22, 0x53, 0x00, 0x07, 0x75, 0xFA, 0x21, 0x08, 0x60, 0x34, 0x04, 0x18, 0xCA, 0x02, 0x08,
+    0xA3, 0x35, 0x04, 0xE1, 0x08, 0x78, 0x24, 0x22, 0xF0, 0x41, 0x50, 0xF0, 0x71, 0x76, 0xF0, 0x01,
+    0xD6, 0x21, 0xCE, 0x7E, 0xCF, 0x82, 0x64, 0xA4, 0x41, 0xE4, 0x00, 0x02, 0x52, 0xB3, 0xB4, 0x22,
+    0xF3, 0x82, 0x49, 0x0D, 0x58, 0x16, 0x9C, 0x60, 0x52, 0x03, 0xC6, 0x01, 0x72, 0x73, 0x00, 0x69,
+    0x36, 0x84, 0x87, 0xCE, 0x00, 0x87, 0x84, 0x1E, 0x3E, 0x80, 0x4D, 0x08, 0xA7, 0x5C, 0x80, 0x1C,
+    0x36, 0xB3, 0xF8, 0x00, 0xC1, 0x42, 0x32, 0xC2, 0x09, 0xA1, 0xC8, 0x14, 0x40, 0x43, 0x38, 0x21,
+    0x10, 0xB0, 0x78, 0x6E, 0x08, 0x40, 0x39, 0xE4, 0x43, 0x2C, 0x0B, 0xD2, 0x98, 0x8C, 0x30, 0x42,
+    0x4A, 0x82, 0x38, 0xA0, 0x01, 0xA6, 0x75, 0x88, 0xCB, 0x0D, 0x40, 0xE0, 0x84, 0x90, 0x1A, 0xD0,
+    0x34, 0x44, 0x8C, 0x08, 0x86, 0x11, 0x12, 0x0C, 0x10, 0x8D, 0x82, 0x62, 0x16, 0xB8, 0x1C, 0x49,
+    0xF5, 0x30, 0x92, 0xF3, 0x69, 0xB5, 0xF3, 0x89, 0x19, 0xF4, 0x99, 0x08, 0xF5, 0x11, 0x64, 0x82,
+    0x62, 0x07, 0x98, 0x4E, 0x01, 0x1C, 0xC0, 0x00, 0xC4, 0x43, 0xBC, 0x39, 0x05, 0x84, 0x90, 0x11,
+    0x46, 0x84, 0x03, 0xCC, 0x45, 0xEA, 0x48, 0x1F, 0xCC, 0x4E, 0x1F, 0x84, 0x90, 0x15, 0x66, 0x88,
+    0x70, 0x80, 0x06, 0x98, 0x88, 0x05, 0x97, 0x98, 0xC1, 0x48, 0x19, 0x21, 0x35, 0xD0, 0x60, 0x46,
+    0x03, 0x4E, 0x81, 0x19, 0x10, 0x00, 0xA2, 0xD1, 0x60, 0x6E, 0x31, 0x0B, 0x3C, 0x92, 0xEB, 0xFA,
+    0x30, 0x51, 0xFB, 0xB8, 0x5F, 0xFB, 0x80, 0x03, 0x41, 0x38, 0x86, 0x43, 0x98, 0x62, 0x1F, 0xA4,
+    0x19, 0x0D, 0x22, 0x90, 0x05, 0x50, 0xE4, 0xB0, 0xF1, 0xD9, 0x47, 0xC0, 0x05, 0x44, 0x35, 0x60,
+    0x1E, 0x20, 0x3E, 0x22, 0x70, 0x05, 0xE8, 0x81, 0xC3, 0xC6, 0x78, 0x1F, 0x76, 0x38, 0xA9, 0xEE,
+    0x43, 0x0E, 0xB5, 0x72, 0x0F, 0x46, 0x04, 0x32, 0x2F, 0x2C, 0xB0, 0x70, 0x6E, 0x08, 0xA0, 0x95,
+    0x7B, 0x00, 0x99, 0x88, 0xD8, 0x30, 0x44, 0x30, 0xE0, 0xB2, 0x4C, 0xE2, 0x67, 0x2D, 0xE3, 0xA7,
+    0x3D, 0xE5, 0x27, 0x16, 0xE9, 0x67, 0xA2, 0xEA, 0x47, 0x68, 0x26, 0xC4, 0x69, 0x15, 0x44, 0x0D,
+    0x81, 0x08, 0x80, 0x2C, 0xAB, 0x21, 0x55, 0x91, 0x12, 0x38, 0x5C, 0x16, 0xF9, 0x29, 0xD0, 0xC1,
+    0xAA, 0xB3, 0x82, 0x02, 0x59, 0x56, 0x44, 0x15, 0x29, 0x81, 0xC7, 0x61, 0x9D, 0x1F, 0xB3, 0xA1,
+    0x9F, 0xF9, 0x80, 0x00, 0x61, 0x42, 0xDC, 0x41, 0x43, 0x27, 0x09, 0x80, 0x21, 0x26, 0x60, 0x25,
+    0x90, 0x51, 0x12, 0x40, 0x49, 0x84, 0x6C, 0x10, 0xE0, 0x90, 0x22, 0x9A, 0xA2, 0x21, 0x22, 0x60,
+    0x55, 0x90, 0x60, 0x4A, 0x02, 0xCE, 0x61, 0xFC, 0xD7, 0x0F, 0x11, 0x1B, 0xCC, 0x80, 0xC1, 0x00,
+    0x8E, 0x48, 0x28, 0x06, 0x5B, 0x5A, 0xD9, 0x80, 0xC8, 0x28, 0x80, 0x14, 0x84, 0x0B, 0x26, 0x57,
+    0x0E, 0x7F, 0x5A, 0x42, 0x7F, 0xA2, 0x6B, 0x7F, 0xA8, 0x97, 0x7F, 0x48, 0xC0, 0x0B, 0x96, 0xFE,
+    0xA3, 0x12, 0x92, 0xA5, 0xAE, 0xA4, 0x00, 0x16, 0xC1, 0xA7, 0x16, 0xAA, 0x2E, 0x7F, 0x16, 0xE0,
+    0x42, 0x08, 0x59, 0x51, 0xB8, 0x08, 0x07, 0x40, 0x1A, 0x24, 0x23, 0x46, 0x45, 0x21, 0x22, 0x87,
+    0x05, 0x0E, 0xA5, 0x5D, 0x7F, 0x88, 0x08, 0x98, 0x48, 0x46, 0x20, 0xC1, 0x94, 0x11, 0x80, 0x89,
+    0x88, 0x0D, 0xEE, 0x8C, 0x60, 0xC0, 0x61, 0x03, 0xF1, 0x0F, 0xD0, 0x4C, 0x04, 0xC9, 0x60, 0xC5,
+    0x14, 0x32, 0x42, 0x00, 0x10, 0xC9, 0x69, 0x11, 0x46, 0x1C, 0x44, 0x80, 0xB8, 0x38, 0xDC, 0xFD,
+    0x43, 0x42, 0xFD, 0x03, 0x34, 0x13, 0x41, 0x3A, 0x58, 0x31, 0x85, 0x8C, 0x10, 0x40, 0x03, 0x2B,
+    0x66, 0x81, 0xC7, 0x26, 0xFA, 0x1F, 0xE7, 0x16, 0xA0, 0x88, 0x21, 0x20, 0x86, 0x88, 0x80, 0x15,
+    0x41, 0x82, 0x29, 0x09, 0x1C, 0x22, 0x98, 0x00, 0x91, 0xC3, 0x58, 0x0E, 0x20, 0x67, 0x71, 0xCC,
+    0x21, 0xFE, 0x05, 0x10, 0x3A, 0x24, 0x89, 0x00, 0x12, 0x80, 0xD5, 0x51, 0x12, 0x72, 0x42, 0x95,
+    0x04, 0xC8, 0x8C, 0x92, 0x90, 0x13, 0xE1, 0x80, 0x88, 0x92, 0x90, 0x6B, 0x00, 0x38, 0x5C, 0xD2,
+    0x0F, 0x98, 0x07, 0x53, 0x12, 0x03, 0x80, 0x05, 0x01, 0x0D, 0xA3, 0x24, 0x51, 0xC0, 0x21, 0x8B,
+    0x0E, 0x90, 0x11, 0x01, 0xCF, 0x81, 0x0E, 0x04, 0x3A, 0x49, 0x10, 0x53, 0x84, 0x08, 0x08, 0xD0,
+    0x2A, 0x82, 0x01, 0x87, 0x4D, 0x4D, 0x3F, 0xC0, 0xA4, 0x23, 0x4C, 0x28, 0x03, 0x3C, 0xA2, 0x73,
+    0x01, 0xCD, 0x86, 0x01, 0x55, 0x46, 0x0C, 0x10, 0x55, 0x4B, 0x98, 0x81, 0x00, 0xF3, 0x40, 0xEF,
+    0x4B, 0xE5, 0x00, 0x11, 0xF7, 0x60, 0x11, 0x59, 0x0E, 0xC8, 0x4D, 0x0F, 0x08, 0x60, 0xDC, 0x01,
+    0xF5, 0xA0, 0x0B, 0xE3, 0x98, 0x15, 0x35, 0x09, 0x07, 0x07, 0x00, 0x04, 0x2B, 0x41, 0x96, 0x04,
+    0x00, 0xF6, 0xC0, 0xAE, 0x03, 0x60, 0x12, 0x35, 0x13, 0xA8, 0x11, 0x24, 0x86, 0xB6, 0x13, 0xA8,
+    0xDA, 0x14, 0x68, 0x20, 0x24, 0x99, 0xB0, 0xC2, 0x39, 0xE0, 0xC0, 0xE8, 0x1F, 0x46, 0x45, 0x34,
+    0x44, 0xAC, 0x98, 0xC1, 0x10, 0x64, 0xC0, 0xA1, 0xA3, 0x39, 0x10, 0x59, 0x6C, 0xD5, 0x05, 0x8A,
+    0x7A, 0x06, 0x62, 0x88, 0x66, 0x36, 0x18, 0xF2, 0x02, 0x19, 0xE0, 0x30, 0xDE, 0x18, 0x88, 0x21,
+    0x9A, 0x19, 0x61, 0xC8, 0x0B, 0x64, 0x00, 0x0C, 0xD1, 0xCC, 0x0A, 0x43, 0x5E, 0x20, 0x03, 0x2C,
+    0xB2, 0xEC, 0xD6, 0xB4, 0x77, 0x03, 0x01, 0x8D, 0x40, 0x1A, 0x48, 0x21, 0x2A, 0x80, 0x43, 0x82,
+    0xC6, 0x0B, 0x76, 0xD0, 0x66, 0x0E, 0x23, 0x1E, 0xB6, 0xD0, 0x03, 0x31, 0x44, 0x33, 0x2B, 0x82,
+    0x21, 0x2F, 0x90, 0x01, 0x30, 0x44, 0x33, 0x33, 0x82, 0x21, 0x2F, 0x90, 0x01, 0x2E, 0xC9, 0x90,
+    0x82, 0xD0, 0xB0, 0x82, 0x1C, 0xBF, 0x82, 0xE8, 0xC7, 0x82, 0x2C, 0x7C, 0x7A, 0xC0, 0x24, 0x09,
+    0x48, 0x50, 0x19, 0x49, 0x10, 0xE3, 0x4A, 0xD0, 0x8C, 0x50, 0x90, 0x40, 0x0E, 0xCA, 0x4B, 0x31,
+    0xCC, 0x84, 0x50, 0x06, 0x80, 0x4C, 0x13, 0x6A, 0xA8, 0x62, 0x08, 0x70, 0xC8, 0xCA, 0x13, 0x04,
+    0x4C, 0x88, 0x00, 0x2C, 0x0B, 0xEE, 0x78, 0x65, 0x08, 0x55, 0x52, 0x6A, 0x00, 0x30, 0x0F, 0x50,
+    0x2D, 0x38, 0x50, 0xC8, 0x3C, 0x40, 0xA6, 0x52, 0x58, 0x1C, 0x9E, 0xC3, 0x40, 0x58, 0xB2, 0x00,
+    0xA6, 0x82, 0x5A, 0x15, 0x65, 0x84, 0xCA, 0x12, 0x30, 0x2C, 0x84, 0x4C, 0x58, 0x29, 0x1C, 0xE0,
+    0xA1, 0x05, 0x2C, 0x02, 0xCE, 0x4B, 0x40, 0x2C, 0x82, 0x4B, 0x82, 0xC6, 0x20, 0xD4, 0xC9, 0xA0,
+    0xE6, 0xD6, 0xA0, 0x28, 0xDB, 0xA0, 0x09, 0xE0, 0x20, 0x20, 0x1E, 0x12, 0x15, 0x06, 0x01, 0x13,
+    0x41, 0x12, 0xC8, 0x08, 0x01, 0x68, 0x26, 0x82, 0x44, 0x14, 0x32, 0x42, 0x00, 0xA2, 0x08, 0x59,
+    0x40, 0x40, 0x2A, 0xE0, 0xB0, 0x7D, 0x34, 0x68, 0x1C, 0x92, 0x1D, 0x07, 0x2C, 0x48, 0x43, 0x1A,
+    0x42, 0x12, 0x24, 0x00, 0x84, 0x24, 0x33, 0xFE, 0x11, 0x13, 0x84, 0x84, 0x73, 0x00, 0xA0, 0x41,
+    0x1A, 0x52, 0x51, 0x88, 0x20, 0x01, 0x00, 0x9A, 0x89, 0x20, 0x15, 0xC5, 0x14, 0x32, 0x42, 0x00,
+    0xE6, 0x21, 0x59, 0x71, 0x10, 0x10, 0x01, 0xAB, 0x81, 0x99, 0x92, 0x00, 0x40, 0x27, 0x94, 0x06,
+    0x3E, 0x07, 0xEB, 0x83, 0x48, 0x02, 0x84, 0x16, 0x15, 0x84, 0x1E, 0x4B, 0x84, 0xE2, 0x67, 0x84,
+    0x24, 0xEB, 0x83, 0x2A, 0x40, 0x85, 0xC2, 0x21, 0x49, 0x7C, 0x10, 0x40, 0x50, 0xB2, 0x21, 0x94,
+    0x03, 0x50, 0xB2, 0xA0, 0x1C, 0x70, 0xD8, 0x3A, 0x0F, 0x13, 0x10, 0x44, 0x6B, 0xA0, 0x32, 0x04,
+    0x02, 0x30, 0x4E, 0x14, 0x01, 0x06, 0x49, 0x80, 0xC5, 0x05, 0x70, 0xB8, 0x98, 0x21, 0x04, 0x44,
+    0x88, 0x43, 0xC9, 0x0E, 0x91, 0x8A, 0x11, 0x88, 0x1D, 0xC0, 0xB1, 0x08, 0xA0, 0x85, 0x7C, 0xA4,
+    0x92, 0x12, 0xBA, 0x21, 0x10, 0xE0, 0x21, 0xDA, 0x61, 0x5B, 0x07, 0xC0, 0x38, 0x24, 0xF1, 0x00,
+    0xD0, 0x05, 0x61, 0x81, 0xC3, 0x08, 0x28, 0x21, 0x40, 0x2E, 0x32, 0x24, 0x09, 0x49, 0x6D, 0x57,
+    0x90, 0xC3, 0xC1, 0x49, 0x02, 0x59, 0x70, 0xC2, 0x01, 0x88, 0x66, 0x36, 0x9C, 0x17, 0xC8, 0x00,
+    0x00, 0x39, 0x89, 0xD4, 0x26, 0xC4, 0x42, 0x27, 0x24, 0xC7, 0x27, 0xA4, 0xC9, 0x29, 0x44, 0x0E,
+    0x25, 0xD1, 0x84, 0x46, 0x44, 0x39, 0x27, 0x2C, 0x10, 0x51, 0xCE, 0x09, 0x07, 0x68, 0x4C, 0x45,
+    0x39, 0x47, 0x10, 0x07, 0x10, 0xCD, 0xCC, 0x28, 0xE7, 0xBC, 0x40, 0x06, 0x58, 0x44, 0x6B, 0x14,
+    0x62, 0xA2, 0x14, 0x22, 0x87, 0xB2, 0x88, 0x42, 0xA3, 0xA2, 0x9C, 0x13, 0x16, 0xD0, 0x98, 0x8C,
+    0x72, 0x8E, 0x20, 0x0E, 0x20, 0x9A, 0xD9, 0x51, 0xCE, 0x79, 0x81, 0x0C, 0xD0, 0x50, 0xCE, 0x01,
+    0x87, 0x44, 0x12, 0x03, 0x08, 0x21, 0xCD, 0x8A, 0x50, 0xA6, 0x08, 0x67, 0x00, 0x40, 0x3B, 0x34,
+    0xC9, 0x15, 0x12, 0x48, 0x85, 0x82, 0x85, 0xA8, 0x00, 0x90, 0x0A, 0x05, 0x0B, 0x71, 0x01, 0x00,
+    0x05, 0x65, 0x81, 0x4F, 0x74, 0x78, 0xA1, 0x35, 0x8E, 0x21, 0x06, 0x96, 0xA1, 0xA8, 0x9B, 0x21,
+    0xC9, 0xB4, 0xA1, 0xA9, 0xC2, 0x21, 0x1B, 0xC8, 0x21, 0xB0, 0x18, 0xB3, 0x27, 0x31, 0xB5, 0x2E,
+    0xB4, 0x4C, 0x07, 0x11, 0x09, 0x40, 0x44, 0x2A, 0x54, 0x31, 0x01, 0x38, 0x70, 0x42, 0x1A, 0xB0,
+    0x81, 0xC3, 0x38, 0x80, 0x21, 0x73, 0x38, 0x31, 0xE7, 0x73, 0x10, 0xB1, 0x42, 0x38, 0x18, 0x0C,
+    0x38, 0x74, 0x6A, 0x18, 0x02, 0x22, 0xE1, 0x64, 0x88, 0x60, 0x8A, 0x51, 0x10, 0x30, 0x16, 0xEC,
+    0x39, 0x10, 0x41, 0xB6, 0x88, 0x60, 0x90, 0x4B, 0x2D, 0x42, 0xA1, 0x0E, 0x38, 0x7C, 0x28, 0x19,
+    0x62, 0x07, 0x84, 0x07, 0x15, 0x0B, 0xE5, 0xA5, 0x18, 0x6F, 0x1D, 0x00, 0x18, 0x27, 0x3A, 0x00,
+    0x83, 0x64, 0x20, 0x63, 0x60, 0x71, 0x01, 0x3C, 0x22, 0x36, 0x0D, 0x39, 0x55, 0x0D, 0xCD, 0x77,
+    0x0D, 0x81, 0xC3, 0x09, 0xA5, 0xA1, 0x91, 0x50, 0xCC, 0x02, 0x09, 0xC5, 0x0C, 0x60, 0x40, 0x26,
+    0x1C, 0x11, 0x96, 0x18, 0x0D, 0x1C, 0x12, 0xE2, 0x1E, 0xC8, 0x03, 0x0D, 0x7C, 0x94, 0xC3, 0x1C,
+    0x4F, 0x02, 0x04, 0x30, 0x48, 0x84, 0x18, 0xC5, 0x05, 0x70, 0x88, 0x46, 0x37, 0x04, 0x20, 0xA3,
+    0x81, 0x9E, 0x22, 0x16, 0x38, 0x9C, 0x01, 0x1C, 0x92, 0x26, 0xA0, 0x99, 0x11, 0xA3, 0x90, 0x01,
+    0x00, 0xC4, 0x2C, 0x18, 0x01, 0x20, 0x22, 0xC7, 0x20, 0x1A, 0x87, 0x92, 0x09, 0x01, 0xB1, 0x03,
+    0x00, 0x32, 0x81, 0xDE, 0x72, 0xC0, 0xA8, 0x41, 0xFD, 0xD0, 0x8A, 0x05, 0x11, 0x33, 0x08, 0x51,
+    0x83, 0x09, 0xD1, 0xF3, 0x0D, 0x91, 0x44, 0x11, 0xD1, 0x8C, 0x16, 0x11, 0x86, 0x19, 0x11, 0x39,
+    0x8C, 0xD2, 0x1D, 0x32, 0x8E, 0x19, 0x11, 0x84, 0x83, 0x03, 0x1C, 0x3A, 0xBA, 0x0F, 0x81, 0xC3,
+    0xA8, 0xEF, 0x21, 0xE1, 0x1C, 0xE2, 0x6C, 0x0F, 0xA1, 0x43, 0x82, 0xEA, 0x21, 0x01, 0x58, 0x15,
+    0x46, 0x41, 0xA1, 0x4A, 0x02, 0x64, 0x84, 0x51, 0x50, 0x84, 0x03, 0x12, 0x8C, 0x82, 0x0D, 0x10,
+    0x87, 0xB8, 0xEB, 0x43, 0x88, 0x00, 0xAC, 0x06, 0x28, 0x54, 0x49, 0x20, 0x00, 0x36, 0xC0, 0x58,
+    0x9E, 0x53, 0xD0, 0x22, 0x04, 0x87, 0x96, 0x10, 0x44, 0x64, 0x31, 0x06, 0x81, 0x48, 0x76, 0x81,
+    0x08, 0x69, 0x48, 0x45, 0x73, 0x22, 0x90, 0x00, 0x0A, 0x60, 0x30, 0xC0, 0x4C, 0x80, 0xE1, 0x0C,
+    0x00, 0xC0, 0x09, 0xF0, 0x96, 0x06, 0x2C, 0x40, 0x84, 0x38, 0x94, 0xCC, 0x28, 0x46, 0x20, 0x76,
+    0x00, 0x89, 0x58, 0x6A, 0x40, 0x05, 0xC6, 0x61, 0xF4, 0xDB, 0x00, 0x11, 0x0F, 0x89, 0x61, 0x88,
+    0x80, 0x46, 0x20, 0x15, 0xA6, 0x10, 0x15, 0x00, 0xE7, 0x71, 0x26, 0x80, 0xA1, 0x64, 0x47, 0x44,
+    0x11, 0x8D, 0xF2, 0xD8, 0x01, 0x87, 0xB3, 0x50, 0x44, 0x0C, 0xB1, 0x94, 0x88, 0x77, 0x42, 0xAA,
+    0x80, 0x13, 0x21, 0x02, 0x02, 0x34, 0x32, 0xA2, 0x90, 0x03, 0x48, 0x48, 0x63, 0x2C, 0x84, 0xCC,
+    0xA0, 0x47, 0x10, 0x97, 0xC2, 0x01, 0x0C, 0x02, 0x69, 0x48, 0x46, 0x73, 0x22, 0x90, 0x00, 0x10,
+    0x2F, 0x21, 0xA4, 0x08, 0x36, 0x19, 0x27, 0x89, 0x1A, 0x4F, 0x89, 0x22, 0x5A, 0x89, 0x64, 0x6B,
+    0x89, 0x28, 0x8C, 0x89, 0x2C, 0xB2, 0x89, 0xD6, 0x61, 0x19, 0xCC, 0xC8, 0x82, 0x0C, 0x00, 0x8E,
+    0x10, 0xAB, 0x34, 0x70, 0xE8, 0x14, 0x4A, 0x44, 0x48, 0x13, 0x30, 0x91, 0x08, 0x7A, 0x46, 0x19,
+    0x01, 0x30, 0x88, 0x76, 0x40, 0x56, 0xDF, 0xC3, 0x89, 0x07, 0x18, 0x68, 0x24, 0x22, 0xA4, 0x40,
+    0x1A, 0x93, 0xD0, 0x04, 0x71, 0xE0, 0xF0, 0x29, 0x98, 0x08, 0x99, 0x88, 0x11, 0x21, 0xCE, 0x08,
+    0x0B, 0x40, 0x07, 0xD3, 0x0A, 0x3E, 0x87, 0x12, 0xD1, 0x44, 0x8D, 0x43, 0xC5, 0x08, 0x82, 0x98,
+    0x01, 0x62, 0x81, 0x39, 0x96, 0x42, 0xC4, 0x4E, 0x00, 0x87, 0x35, 0xE4, 0x44, 0x44, 0x54, 0x11,
+    0xB1, 0x61, 0x06, 0x03, 0x10, 0x31, 0x21, 0xCC, 0x60, 0xC0, 0x22, 0xA8, 0x7C, 0xD0, 0x7C, 0x3F,
+    0x11, 0x32, 0x39, 0x11, 0x02, 0x34, 0x32, 0x44, 0x9C, 0x81, 0x8C, 0x28, 0xE4, 0x00, 0x4E, 0x84,
+    0x23, 0xC4, 0x19, 0xC8, 0x34, 0xF0, 0x88, 0xFE, 0x51, 0xF4, 0x5E, 0x53, 0x34, 0x8D, 0x53, 0x44,
+    0x0E, 0x31, 0x36, 0x8A, 0x22, 0x42, 0x57, 0x0C, 0x18, 0x4C, 0x00, 0x74, 0xC4, 0x80, 0xA1, 0x81,
+    0xC5, 0x86, 0x96, 0x22, 0x89, 0x98, 0x22, 0xA5, 0x45, 0x0C, 0x28, 0x08, 0x06, 0x07, 0x4A, 0x28,
+    0x45, 0x74, 0xC4, 0x80, 0xE2, 0x80, 0x80, 0x11, 0x81, 0x77, 0x28, 0x17, 0x54, 0xB4, 0x02, 0xBE,
+    0x0E, 0x38, 0x58, 0xF1, 0x29, 0x3A, 0x94, 0x55, 0x2B, 0x62, 0x8F, 0x04, 0x8D, 0x17, 0x6E, 0x5C,
+    0x45, 0xF4, 0x62, 0x45, 0x48, 0xE3, 0x20, 0x23, 0xA2, 0x10, 0x24, 0x16, 0x40, 0x45, 0xC0, 0x6A,
+    0x30, 0x25, 0x01, 0x91, 0x43, 0xC9, 0x08, 0x64, 0x10, 0x3B, 0x40, 0x00, 0xB4, 0x03, 0x3D, 0x98,
+    0x91, 0x43, 0x52, 0xC2, 0x22, 0x70, 0x88, 0xE6, 0x57, 0x44, 0xE8, 0x86, 0x32, 0x03, 0xD0, 0x98,
+    0x88, 0x32, 0x05, 0x71, 0xE0, 0x00, 0x44, 0xAF, 0xE8, 0xD0, 0x9D, 0xB3, 0x08, 0x1D, 0xAE, 0x5D,
+    0x16, 0x1D, 0x22, 0xE2, 0x42, 0xA1, 0x20, 0x40, 0x22, 0x2E, 0x14, 0x29, 0x00, 0x0B, 0x89, 0xB8,
+    0x10, 0xA5, 0x00, 0x1E, 0x0D, 0xBB, 0x8B, 0x92, 0xEC, 0x8B, 0x9E, 0xFC, 0x8B, 0xC6, 0x61, 0x5C,
+    0x6E, 0x91, 0x63, 0x10, 0xAD, 0xC1, 0x20, 0x17, 0x08, 0xE0, 0xBC, 0x43, 0x47, 0xE7, 0x22, 0x64,
+    0x1D, 0x22, 0x24, 0x17, 0x91, 0x04, 0x28, 0x52, 0x00, 0x44, 0x03, 0x14, 0x49, 0x28, 0x20, 0x1C,
+    0x22, 0x60, 0x17, 0x91, 0x04, 0x88, 0x64, 0x00, 0x44, 0x03, 0x44, 0x52, 0x28, 0x70, 0x88, 0x14,
+    0x5F, 0x44, 0x0E, 0xDB, 0xD8, 0x8B, 0x90, 0x86, 0x34, 0x88, 0x40, 0x02, 0x40, 0x12, 0x44, 0x20,
+    0x01, 0x68, 0x48, 0x41, 0x20, 0x01, 0x00, 0x04, 0x15, 0x21, 0xBE, 0x5A, 0x51, 0x18, 0x70, 0x84,
+    0x78, 0x88, 0xE0, 0x60, 0x04, 0x0E, 0xA5, 0x13, 0x8C, 0x04, 0x9C, 0x20, 0x4E, 0x03, 0x87, 0xB3,
+    0x16, 0x46, 0xE2, 0x00, 0xC7, 0xA2, 0x64, 0x41, 0x16, 0x96, 0x41, 0x53, 0x7D, 0x02, 0x63, 0x90,
+    0x86, 0x57, 0x5C, 0x00, 0x9C, 0x46, 0x58, 0x00, 0x69, 0x42, 0x44, 0x06, 0x52, 0xA9, 0x9C, 0x21,
+    0x14, 0x58, 0x24, 0x38, 0x32, 0x42, 0xA5, 0x34, 0x02, 0xC8, 0xA1, 0xE4, 0x90, 0x11, 0x32, 0x00,
+    0xA4, 0x22, 0x14, 0x90, 0x10, 0xCA, 0x01, 0x8F, 0xCD, 0x64, 0x46, 0x0E, 0x7E, 0x46, 0x52, 0x8D,
+    0x46, 0xC0, 0xE2, 0x98, 0x43, 0x0C, 0x30, 0x23, 0x84, 0x90, 0x19, 0x28, 0x21, 0x27, 0xC2, 0x01,
+    0x11, 0x28, 0x21, 0xD7, 0x80, 0x79, 0xE8, 0x90, 0x67, 0x84, 0x0E, 0x05, 0x3A, 0x49, 0xCA, 0x21,
+    0x3A, 0x5E, 0x04, 0x11, 0xC9, 0x04, 0x11, 0xCC, 0x01, 0x0A, 0x9C, 0x20, 0x6A, 0x03, 0x24, 0xAC,
+    0x11, 0x22, 0x60, 0x42, 0x44, 0x8A, 0x40, 0xA7, 0x11, 0x65, 0xCA, 0x10, 0x0A, 0x00, 0x05, 0xE5,
+    0x58, 0x2A, 0x56, 0x38, 0x80, 0x23, 0x61, 0x8D, 0x10, 0x81, 0x03, 0x51, 0x09, 0x23, 0x8D, 0x3B,
+    0x88, 0x7E, 0x1B, 0x38, 0x6C, 0x60, 0x35, 0x5A, 0x07, 0x94, 0x92, 0x3A, 0x08, 0x49, 0x36, 0x24,
+    0x12, 0xCE, 0x01, 0x97, 0x82, 0xED, 0x46, 0x04, 0xFA, 0x46, 0xC8, 0x19, 0x47, 0x2C, 0x6D, 0x47,
+    0x8F, 0xAA, 0x47, 0xE0, 0xB0, 0xE1, 0xDB, 0xC8, 0x1C, 0xA2, 0x52, 0x1B, 0x11, 0x0D, 0x10, 0xE1,
+    0x08, 0x41, 0x8A, 0x69, 0x40, 0x3B, 0xD4, 0x54, 0x9F, 0x20, 0x22, 0x9C, 0x50, 0x4C, 0x03, 0x88,
+    0x66, 0x66, 0x84, 0x27, 0x48, 0x20, 0xC3, 0x52, 0xF1, 0x9E, 0x20, 0x81, 0x0C, 0xC0, 0x61, 0x9E,
+    0x85, 0x98, 0x48, 0x08, 0x51, 0xE8, 0xC5, 0x14, 0x46, 0x00, 0x87, 0x8D, 0x13, 0x47, 0x03, 0x02,
+    0xCC, 0xC3, 0xC5, 0x85, 0x23, 0x52, 0xF1, 0xC2, 0x12, 0x65, 0x04, 0x00, 0x67, 0xBC, 0xB0, 0x44,
+    0x19, 0x21, 0x35, 0x40, 0x22, 0x0D, 0x2F, 0x90, 0x13, 0xC0, 0x61, 0x1B, 0xD6, 0x91, 0x11, 0x81,
+    0xC3, 0x69, 0x99, 0xA3, 0x66, 0x76, 0x84, 0x27, 0x9C, 0x29, 0x64, 0x58, 0x2A, 0xDE, 0x13, 0xCE,
+    0x14, 0x32, 0xC0, 0x21, 0xBA, 0xD1, 0x11, 0x31, 0x42, 0xC2, 0x13, 0xCE, 0x94, 0x11, 0x96, 0xA5,
+    0xE2, 0x3D, 0xE1, 0x4C, 0x19, 0x61, 0x01, 0x4E, 0x2B, 0x09, 0x4F, 0x38, 0x53, 0x86, 0x40, 0xC4,
+    0x52, 0xF1, 0x9E, 0x70, 0xA6, 0x0C, 0x81, 0x08, 0x40, 0x34, 0x33, 0x23, 0x3C, 0x41, 0x02, 0x19,
+    0x96, 0x8A, 0xF7, 0x04, 0x09, 0x64, 0x58, 0x2A, 0xDE, 0x2B, 0x24, 0x90, 0x01, 0x0E, 0x11, 0xED,
+    0x8E, 0x88, 0x71, 0x80, 0x44, 0xE4, 0x73, 0x38, 0x3D, 0x79, 0x34, 0x0E, 0xD1, 0x12, 0x8F, 0x80,
+    0x89, 0x58, 0x70, 0x46, 0x58, 0xA2, 0x8C, 0x90, 0x1A, 0x00, 0x4C, 0xC4, 0x82, 0x3B, 0xC2, 0x12,
+    0x65, 0x84, 0xD4, 0x00, 0x60, 0x2E, 0x12, 0xBE, 0xEC, 0xB8, 0x91, 0x1E, 0x21, 0x8D, 0xE9, 0x10,
+    0xA3, 0x0C, 0x41, 0x1C, 0x10, 0x33, 0xC4, 0x28, 0x03, 0x19, 0x30, 0x89, 0x54, 0x7C, 0xB4, 0xC6,
+    0x7C, 0xE4, 0x86, 0x7F, 0x14, 0x99, 0x80, 0x44, 0x0E, 0x87, 0xDF, 0x06, 0x04, 0x20, 0x08, 0x16,
+    0x1C, 0xA1, 0x8A, 0x4C, 0x0D, 0x58, 0x10, 0x42, 0x46, 0x24, 0x11, 0x0E, 0x78, 0x24, 0x17, 0x3F,
+    0x42, 0x49, 0x3F, 0x72, 0x87, 0x3F, 0x02, 0x18, 0xA2, 0x99, 0x90, 0xC6, 0x74, 0x84, 0x17, 0xC8,
+    0x10, 0xC4, 0x01, 0x0C, 0xD1, 0x0E, 0xC0, 0x27, 0x05, 0x30, 0x44, 0x33, 0x23, 0xC2, 0x0B, 0x64,
+    0x00, 0x98, 0xCC, 0x08, 0x2F, 0x26, 0xD4, 0x0E, 0x10, 0xCD, 0x45, 0x92, 0x97, 0x80, 0xC6, 0x02,
+    0x24, 0x70, 0xC0, 0x4E, 0xDA, 0x72, 0x00, 0xFE, 0x12, 0xB0, 0x88, 0x9C, 0x81, 0xE4, 0x56, 0x82,
+    0x44, 0x48, 0x12, 0x10, 0x21, 0x2E, 0xA2, 0x18, 0x81, 0xC0, 0xA1, 0xCC, 0x06, 0x80, 0xD3, 0x10,
+    0xA3, 0xE1, 0x20, 0x12, 0x16, 0x50, 0x17, 0xC9, 0xB4, 0x29, 0x58, 0xC7, 0x05, 0x10, 0x09, 0x71,
+    0x5A, 0x42, 0x19, 0x02, 0x11, 0xB0, 0x1C, 0xE8, 0x8B, 0x24, 0x74, 0x8D, 0x34, 0xD8, 0x99, 0x44,
+    0x58, 0xA8, 0x54, 0xDA, 0xAA, 0x64, 0xFE, 0xB4, 0x74, 0x4A, 0xB6, 0x84, 0x72, 0xB8, 0xB4, 0x78,
+    0xB9, 0xC4, 0x20, 0xBA, 0xD4, 0xD2, 0xBA, 0xE4, 0x9C, 0xBB, 0xF4, 0x3C, 0xBD, 0x24, 0x67, 0xC2,
+    0x34, 0xE3, 0xCB, 0x44, 0x1F, 0xE7, 0x54, 0xAB, 0xE8, 0x64, 0xF9, 0xEC, 0x04, 0x1E, 0x07, 0x02,
+    0x91, 0xCC, 0x3D, 0x91, 0x68, 0x6D, 0x91, 0x82, 0x05, 0x59, 0x90, 0x09, 0x57, 0x88, 0x24, 0x46,
+    0x03, 0x8B, 0xD0, 0x91, 0x48, 0x35, 0x9A, 0x48, 0x08, 0x44, 0x01, 0x13, 0xA9, 0x08, 0x9A, 0x95,
+    0x11, 0x00, 0x0A, 0x98, 0x48, 0x44, 0xD0, 0xAC, 0x8C, 0x00, 0x90, 0x83, 0x78, 0x9C, 0x11, 0x54,
+    0x04, 0xCC, 0x43, 0xF4, 0x56, 0x24, 0x62, 0x64, 0x30, 0xC7, 0x4C, 0x19, 0x61, 0x01, 0x4E, 0xEB,
+    0x60, 0x8E, 0x99, 0x32, 0x04, 0x22, 0x80, 0x41, 0x45, 0x84, 0x2C, 0x28, 0x23, 0x1C, 0x70, 0x48,
+    0xD8, 0x8C, 0x04, 0x2C, 0x40, 0x23, 0x90, 0x8E, 0x27, 0x4B, 0x2A, 0x44, 0x05, 0x60, 0xB2, 0x08,
+    0xA2, 0x85, 0xC8, 0x30, 0x6E, 0x08, 0x04, 0x6C, 0x22, 0xD9, 0x23, 0x2D, 0x14, 0x24, 0xB9, 0x89,
+    0x24, 0x45, 0x85, 0x25, 0x4D, 0x01, 0x26, 0x51, 0x2B, 0x26, 0x01, 0x91, 0x80, 0x44, 0xC0, 0x44,
+    0x8C, 0x8A, 0x60, 0xCA, 0x08, 0x0B, 0x18, 0x88, 0x66, 0x1E, 0xAE, 0xF7, 0x07, 0x20, 0xC0, 0xB2,
+    0xE0, 0x88, 0x92, 0x52, 0x03, 0x87, 0xD4, 0x12, 0x49, 0x11, 0x01, 0x48, 0xC4, 0xC8, 0x30, 0xA1,
+    0x9C, 0xB0, 0xC0, 0x21, 0x99, 0x47, 0xD2, 0x58, 0x68, 0x16, 0xC8, 0xD0, 0x54, 0x9F, 0x38, 0x18,
+    0x86, 0x46, 0x39, 0x8C, 0xE4, 0x49, 0x62, 0x9E, 0x79, 0x48, 0x4C, 0x93, 0x04, 0x04, 0x0B, 0x89,
+    0x28, 0x43, 0xC8, 0x14, 0x80, 0x89, 0x68, 0x66, 0x45, 0x18, 0x81, 0x0C, 0x70, 0xF8, 0xC6, 0x94,
+    0xE4, 0x3C, 0x4E, 0x04, 0x4C, 0xC4, 0xE8, 0x88, 0xC8, 0x94, 0x11, 0x16, 0x38, 0x8C, 0xC7, 0x4A,
+    0x72, 0xA2, 0x09, 0x20, 0x46, 0x43, 0x19, 0x61, 0x01, 0xC0, 0x44, 0xC8, 0x08, 0x64, 0xCA, 0x08,
+    0x07, 0x1C, 0x92, 0xCC, 0x25, 0x01, 0x0C, 0xD1, 0x4C, 0xC0, 0xB2, 0xE0, 0x90, 0xF0, 0x02, 0x19,
+    0x25, 0xA5, 0x06, 0x0E, 0x47, 0xC2, 0x03, 0x80, 0x01, 0x09, 0x16, 0x52, 0xB1, 0x84, 0x4C, 0x01,
+    0x88, 0x9C, 0x81, 0x12, 0x48, 0xC7, 0x30, 0x68, 0x31, 0x15, 0xC0, 0x61, 0xC3, 0x65, 0xD2, 0x80,
+    0x34, 0x26, 0x22, 0xB1, 0x25, 0x88, 0x03, 0x80, 0x60, 0x01, 0x05, 0x2C, 0x15, 0x30, 0x89, 0x64,
+    0xA0, 0xF4, 0xD8, 0xA5, 0x44, 0x8B, 0xA6, 0x54, 0xA7, 0xA7, 0x44, 0x26, 0x4B, 0xA2, 0x93, 0xDA,
+    0xBD, 0x93, 0x9E, 0xD2, 0x93, 0x24, 0xE9, 0x93, 0xC4, 0x22, 0xA9, 0x71, 0x12, 0xE2, 0x72, 0x12,
+    0x30, 0x91, 0x08, 0xA1, 0xCA, 0x08, 0x80, 0x6C, 0x10, 0x2A, 0x1C, 0x80, 0x90, 0x11, 0x42, 0x85,
+    0x03, 0x20, 0x0D, 0x01, 0x04, 0x0B, 0x69, 0x61, 0x64, 0x85, 0x2A, 0x48, 0x91, 0x29, 0x00, 0x13,
+    0x22, 0x00, 0x2B, 0x64, 0x05, 0x32, 0x84, 0x2A, 0x09, 0x20, 0x06, 0xA0, 0x99, 0x16, 0x5C, 0x41,
+    0x56, 0x20, 0x23, 0x35, 0xE0, 0x21, 0x1A, 0x79, 0x88, 0xC2, 0x9F, 0x04, 0x04, 0x0B, 0x29, 0x11,
+    0x27, 0x06, 0x72, 0x8A, 0x4C, 0x01, 0x5C, 0x9A, 0x77, 0x28, 0xBD, 0x9C, 0x28, 0xC9, 0xF8, 0x28,
+    0x4D, 0x50, 0x29, 0x55, 0x60, 0x29, 0x89, 0x05, 0x64, 0x95, 0x80, 0xA9, 0xED, 0x0A, 0x48, 0x43,
+    0x38, 0x94, 0xAC, 0x08, 0x04, 0xB1, 0x03, 0x10, 0xCD, 0x40, 0xB4, 0xC3, 0xC9, 0x1B, 0x25, 0x81,
+    0x84, 0x84, 0x18, 0xC8, 0x0A, 0x44, 0x05, 0xD0, 0x11, 0x62, 0x20, 0x2B, 0x90, 0x01, 0xBC, 0x43,
+    0x2A, 0x24, 0x25, 0xA2, 0x1D, 0x48, 0x2B, 0xF8, 0x98, 0x90, 0x60, 0x1D, 0x12, 0x40, 0x07, 0xE0,
+    0x86, 0x22, 0x53, 0x03, 0x07, 0xA4, 0xA0, 0x3B, 0x90, 0x71, 0x40, 0xC3, 0x46, 0x80, 0x68, 0x06,
+    0xA2, 0x99, 0x19, 0x21, 0x06, 0xB2, 0x02, 0x19, 0xE0, 0x70, 0x42, 0x4E, 0x69, 0x31, 0x07, 0xD4,
+    0xC8, 0x13, 0x22, 0x04, 0x58, 0x11, 0x67, 0x18, 0x51, 0x12, 0x80, 0x0C, 0x14, 0xB0, 0xC8, 0x0C,
+    0x31, 0xC5, 0x62, 0x25, 0x1D, 0x70, 0x58, 0x2B, 0xA9, 0x54, 0x14, 0x88, 0x80, 0x10, 0xED, 0x60,
+    0x4A, 0x3F, 0xE0, 0x10, 0x0D, 0x54, 0x09, 0x98, 0x90, 0x60, 0x21, 0x15, 0x62, 0x14, 0x99, 0x02,
+    0x30, 0xA1, 0xC3, 0x40, 0xE7, 0x80, 0x09, 0x08, 0x16, 0x5C, 0x51, 0x64, 0x6A, 0xE0, 0x92, 0xD8,
+    0x59, 0x09, 0x69, 0x5B, 0x69, 0x15, 0x5E, 0xC9, 0x71, 0x61, 0x29, 0x62, 0x65, 0x09, 0x58, 0x87,
+    0x2B, 0xE1, 0x01, 0x40, 0x80, 0x2C, 0xC8, 0x84, 0x33, 0x92, 0x90, 0x22, 0x89, 0xD1, 0xC0, 0x61,
+    0x84, 0x47, 0x8A, 0x30, 0x51, 0x0E, 0x25, 0x1B, 0x04, 0x62, 0x07, 0x58, 0x90, 0x29, 0x02, 0xE6,
+    0x21, 0x4A, 0xBA, 0x12, 0xA9, 0x18, 0xA6, 0x8C, 0x00, 0x38, 0xAD, 0x63, 0x98, 0x32, 0x04, 0x22,
+    0xE0, 0x90, 0xE6, 0x5F, 0x09, 0x60, 0x80, 0x09, 0x71, 0x5A, 0xC4, 0x2B, 0x43, 0x20, 0x02, 0x0E,
+    0x81, 0x9B, 0x09, 0x88, 0xB6, 0x20, 0x5E, 0x6E, 0x33, 0x87, 0x54, 0x73, 0x18, 0x9F, 0xB1, 0xC4,
+    0x00, 0x13, 0xE2, 0xB4, 0x0A, 0xF3, 0xCA, 0x10, 0x88, 0x00, 0xEC, 0x70, 0x82, 0x64, 0x09, 0x98,
+    0x07, 0x8E, 0xA6, 0x03, 0x10, 0xA7, 0x35, 0x94, 0x21, 0x10, 0x01, 0x8B, 0x88, 0x3E, 0x4B, 0x0E,
+    0x49, 0x4B, 0x40, 0x33, 0x45, 0x18, 0x03, 0xB4, 0x90, 0x42, 0x86, 0x69, 0xAF, 0x10, 0xC0, 0x20,
+    0x18, 0xA2, 0x99, 0x15, 0xC4, 0x85, 0x17, 0xC8, 0x00, 0x9A, 0x19, 0x41, 0xAB, 0x41, 0x64, 0x80,
+    0xC3, 0xA8, 0xAC, 0x25, 0xA2, 0x1D, 0x20, 0x8C, 0x91, 0x20, 0x88, 0x01, 0x01, 0x9A, 0x49, 0x66,
+    0x2C, 0x11, 0xC8, 0x38, 0xE0, 0x90, 0x14, 0x6E, 0x09, 0x08, 0x90, 0x09, 0x68, 0x64, 0xC0, 0x38,
+    0x40, 0x3C, 0x44, 0xEE, 0x5B, 0x02, 0x9A, 0x69, 0xC1, 0x11, 0x81, 0x8C, 0xD4, 0x80, 0x79, 0x48,
+    0x76, 0x1C, 0x00, 0x0E, 0xCC, 0xB1, 0x54, 0xCC, 0x43, 0xC4, 0xC9, 0x25, 0xB0, 0xB0, 0x86, 0xF2,
+    0x30, 0x65, 0xF7, 0x70, 0x00, 0x3C, 0xDE, 0x42, 0xA0, 0x06, 0xA4, 0x31, 0x19, 0x2A, 0xB1, 0x25,
+    0x88, 0x03, 0x10, 0x23, 0x02, 0x9A, 0xD9, 0xF1, 0x9E, 0x70, 0xA6, 0x90, 0x01, 0x38, 0x02, 0xB5,
+    0x00, 0x13, 0x31, 0x42, 0x90, 0x62, 0xA9, 0x8C, 0xB0, 0xC0, 0x61, 0xD9, 0xF1, 0x92, 0x40, 0x34,
+    0x02, 0xA9, 0x20, 0x48, 0x05, 0xA2, 0x02, 0x50, 0x20, 0x02, 0x02, 0xAC, 0x12, 0x46, 0x50, 0xAD,
+    0x42, 0x89, 0x92, 0xC0, 0xA2, 0x5B, 0x00, 0x53, 0x9C, 0x02, 0x13, 0x39, 0x6C, 0x37, 0x5F, 0x02,
+    0x84, 0x53, 0xF1, 0x62, 0x28, 0x0A, 0x82, 0x43, 0x32, 0xFA, 0xA5, 0x01, 0x69, 0x4C, 0xC7, 0x8B,
+    0x81, 0x2C, 0x41, 0x1C, 0x30, 0x45, 0x40, 0xB0, 0x90, 0x94, 0x17, 0x03, 0x09, 0xC3, 0x14, 0x99,
+    0x02, 0xB0, 0x20, 0x13, 0xC9, 0x78, 0x11, 0x25, 0x31, 0x02, 0x38, 0x74, 0xE6, 0x60, 0x42, 0x24,
+    0xA7, 0x61, 0x88, 0x66, 0xA6, 0xBC, 0x68, 0xC4, 0x41, 0xE4, 0x05, 0x32, 0x80, 0x0A, 0x69, 0x4C,
+    0xC7, 0x8B, 0x06, 0x4D, 0x41, 0x1C, 0x98, 0x44, 0x8A, 0x62, 0x7A, 0xFB, 0x62, 0x9A, 0x38, 0x63,
+    0xA2, 0xFB, 0x34, 0x22, 0x8B, 0xED, 0x41, 0x4C, 0x6F, 0x47, 0x4C, 0xC2, 0x84, 0xD4, 0x03, 0x72,
+    0xB1, 0x22, 0x12, 0x38, 0x98, 0xB6, 0x02, 0x41, 0x44, 0x40, 0xB0, 0x90, 0x8A, 0x62, 0x8A, 0x4C,
+    0x01, 0x1C, 0xCE, 0x67, 0x31, 0xC9, 0x83, 0x89, 0x66, 0x02, 0xD4, 0x3C, 0x40, 0x1E, 0x1B, 0x81,
+    0x4C, 0x24, 0x82, 0x9E, 0x28, 0x46, 0x00, 0x8F, 0xC4, 0x89, 0x4C, 0x68, 0x8D, 0x4C, 0x94, 0x92,
+    0x4C, 0x60, 0x71, 0xB1, 0x8F, 0x69, 0x6A, 0x90, 0x69, 0x20, 0x09, 0xA1, 0x2C, 0x80, 0x58, 0x46,
+    0x42, 0x0A, 0x0B, 0x00, 0x1A, 0x81, 0x44, 0x10, 0x15, 0x80, 0x11, 0x50, 0x16, 0x30, 0x51, 0x24,
+    0x60, 0x04, 0xB0, 0x28, 0x2E, 0x3F, 0x32, 0x33, 0xCA, 0xC4, 0x10, 0xCD, 0x24, 0x2B, 0x0C, 0x7B,
+    0x81, 0x8C, 0x03, 0x20, 0x4E, 0x3B, 0x94, 0xBC, 0x65, 0x02, 0x16, 0x24, 0x23, 0x46, 0x8A, 0x18,
+    0x6C, 0x08, 0x44, 0x4A, 0x12, 0x39, 0x2C, 0x50, 0x21, 0x06, 0x1B, 0x02, 0x91, 0x03, 0x2E, 0xCF,
+    0x0D, 0x01, 0xD0, 0x26, 0x9C, 0x5E, 0x33, 0x9C, 0x62, 0x3D, 0x9C, 0xA8, 0xC1, 0x9C, 0xC8, 0x64,
+    0x63, 0x41, 0xD3, 0x4B, 0x48, 0x53, 0x6C, 0x4E, 0x53, 0x1D, 0x83, 0xD3, 0x5A, 0x44, 0x6E, 0x67,
+    0x5A, 0x06, 0x68, 0x22, 0x84, 0x89, 0x02, 0x56, 0x45, 0x0A, 0x6A, 0xB0, 0x92, 0x00, 0x83, 0x68,
+    0x87, 0x73, 0xFB, 0x4C, 0x02, 0xA9, 0x48, 0xC2, 0x05, 0xA2, 0x02, 0x88, 0x48, 0xC2, 0x05, 0x32,
+    0x00, 0x74, 0x60, 0xD0, 0x4C, 0x70, 0x38, 0x5F, 0xD1, 0x04, 0x4C, 0x88, 0xD3, 0x00, 0xAB, 0xC3,
+    0x90, 0x32, 0x04, 0x22, 0x25, 0x01, 0xC4, 0x48, 0x58, 0x61, 0x59, 0x2A, 0xC8, 0x0A, 0x64, 0x84,
+    0x05, 0x44, 0xC4, 0x04, 0xCC, 0x43, 0x77, 0x99, 0x26, 0xC4, 0x69, 0x21, 0x26, 0x9A, 0x30, 0xCA,
+    0x10, 0x88, 0x00, 0xB1, 0xC3, 0x44, 0x13, 0x06, 0x32, 0x60, 0x36, 0xA0, 0xAE, 0x49, 0x38, 0xB0,
+    0x89, 0xD4, 0xB2, 0xA9, 0xC0, 0xB5, 0xC9, 0xD0, 0xB6, 0x89, 0x61, 0xB9, 0xA9, 0xD5, 0xB9, 0xE9,
+    0xC1, 0xBA, 0x29, 0x62, 0xBB, 0x69, 0xC6, 0xBD, 0x89, 0x7A, 0xBF, 0xA9, 0xAA, 0xC0, 0x09, 0x98,
+    0x87, 0x4E, 0x6E, 0x4D, 0x88, 0xD3, 0x00, 0x2B, 0x83, 0x94, 0x21, 0x10, 0x29, 0x09, 0x88, 0x1D,
+    0x23, 0x98, 0x32, 0x90, 0x01, 0x22, 0x02, 0x18, 0x05, 0x61, 0x59, 0x2A, 0xC8, 0x08, 0x46, 0x9A,
+    0xB0, 0xC0, 0xA1, 0x1B, 0x64, 0xD3, 0x01, 0x34, 0x06, 0x10, 0x2C, 0xB8, 0x21, 0x14, 0x99, 0x1A,
+    0xD0, 0x4C, 0xE8, 0xA0, 0x89, 0xE7, 0xE7, 0x70, 0xA1, 0xB4, 0x69, 0x14, 0x98, 0xB0, 0x2C, 0x15,
+    0x64, 0x04, 0x43, 0xC2, 0x02, 0x80, 0x89, 0x18, 0x15, 0x26, 0xA4, 0x32, 0xC2, 0x02, 0x88, 0xB8,
+    0x00, 0xDC, 0x4C, 0x40, 0x24, 0x31, 0x20, 0x02, 0xE6, 0x21, 0xE2, 0x70, 0x13, 0x31, 0x32, 0x9C,
+    0x29, 0x23, 0x2C, 0xC0, 0x69, 0x1D, 0xCE, 0x94, 0x21, 0x10, 0x01, 0x74, 0x81, 0x78, 0x00, 0x30,
+    0x21, 0x4E, 0xA3, 0x03, 0x4A, 0x02, 0x88, 0x59, 0x60, 0xC2, 0x00, 0x87, 0x54, 0xE3, 0x4D, 0x08,
+    0x4B, 0x10, 0x0F, 0x1C, 0x3E, 0x0E, 0x0E, 0x18, 0x14, 0x6B, 0x08, 0x8E, 0xB0, 0x07, 0x00, 0x48,
+    0x83, 0x34, 0xA6, 0x25, 0x90, 0x11, 0xCC, 0x28, 0x82, 0x08, 0xE2, 0xC0, 0x21, 0xF3, 0x72, 0xD3,
+    0x33, 0x13, 0x0C, 0x8B, 0x03, 0x40, 0x1A, 0x42, 0x36, 0x04, 0x12, 0x0E, 0x40, 0x34, 0xA4, 0xC1,
+    0xCC, 0x40, 0x02, 0x00, 0xAC, 0x06, 0x31, 0x44, 0x49, 0x00, 0x35, 0x1B, 0x22, 0x1B, 0xE0, 0x91,
+    0x34, 0xC6, 0xC9, 0xFD, 0xC6, 0x89, 0xCE, 0xC7, 0x69, 0xA0, 0x04, 0x62, 0x44, 0xA0, 0xC5, 0x54,
+    0x58, 0x80, 0x34, 0x1B, 0x82, 0x09, 0x67, 0x00, 0x03, 0x45, 0x8C, 0x02, 0x15, 0x16, 0x58, 0x64,
+    0x73, 0x72, 0x92, 0xBA, 0x72, 0x1A, 0x28, 0x81, 0x18, 0x15, 0x68, 0x31, 0x15, 0x16, 0x40, 0x34,
+    0x33, 0xE3, 0x0C, 0xC3, 0x5E, 0x20, 0x03, 0x98, 0x88, 0x11, 0x12, 0xC8, 0x30, 0xEC, 0x8C, 0xB0,
+    0xC0, 0xE1, 0xBC, 0x9A, 0x53, 0xD4, 0x1A, 0xE8, 0x60, 0x86, 0x00, 0x48, 0x45, 0x1A, 0xC4, 0x10,
+    0x33, 0x80, 0x43, 0x76, 0x3F, 0xA7, 0x41, 0x9A, 0x22, 0x5C, 0xB1, 0xD8, 0x19, 0xA6, 0x01, 0x44,
+    0x04, 0x04, 0x0B, 0xE9, 0x20, 0xEC, 0x05, 0x53, 0x64, 0x0A, 0x60, 0x12, 0xA9, 0xD6, 0x69, 0x41,
+    0xD7, 0xC9, 0x0D, 0xD8, 0x49, 0x8E, 0xD8, 0x89, 0x2C, 0x36, 0x2E, 0x5E, 0xC8, 0xAF, 0x3A, 0x45,
+    0x13, 0x12, 0x44, 0xC0, 0x44, 0xC8, 0x8C, 0x20, 0x4D, 0x19, 0xE1, 0x00, 0x13, 0xD2, 0x18, 0xC0,
+    0x44, 0x22, 0x5C, 0x19, 0x01, 0x98, 0x07, 0x20, 0x45, 0x1E, 0x10, 0x60, 0x34, 0x94, 0x24, 0x16,
+    0x38, 0x58, 0x11, 0x17, 0x30, 0x21, 0x06, 0x30, 0x91, 0x8C, 0x70, 0x86, 0x70, 0x65, 0x04, 0xE0,
+    0x40, 0x84, 0x13, 0x41, 0x2F, 0x14, 0x0A, 0x82, 0x47, 0x04, 0x80, 0x27, 0x97, 0x8A, 0xA7, 0x98,
+    0x8C, 0x27, 0x42, 0x42, 0xA4, 0x79, 0x88, 0xA2, 0xEE, 0x04, 0x04, 0xEB, 0x10, 0x07, 0xDF, 0x89,
+    0x84, 0x98, 0x70, 0xC4, 0x19, 0x42, 0xA6, 0x00, 0x42, 0x4C, 0x38, 0xE2, 0x0C, 0x21, 0x53, 0x03,
+    0x26, 0x70, 0x38, 0xDB, 0xF0, 0x14, 0x2C, 0xA4, 0xC2, 0x88, 0x51, 0x64, 0x0A, 0x00, 0x31, 0x2A,
+    0x8C, 0x18, 0x65, 0x84, 0x05, 0x0E, 0x5A, 0x7C, 0x23, 0x90, 0xC5, 0x57, 0x97, 0x27, 0x79, 0x9A,
+    0x27, 0x03, 0x88, 0x86, 0x85, 0x90, 0x64, 0x8B, 0x09, 0xAE, 0x98, 0x95, 0xC2, 0x39, 0xC0, 0x02,
+    0x88, 0x03, 0x80, 0xBF, 0x0D, 0x88, 0x34, 0x01, 0xC1, 0x3A, 0x24, 0x21, 0x0F, 0xC0, 0x0D, 0x42,
+    0xA6, 0x06, 0x0E, 0x67, 0x0C, 0x01, 0xE4, 0x01, 0x65, 0xC4, 0xC0, 0x61, 0xF3, 0xD5, 0x13, 0x32,
+    0x21, 0xC0, 0xAA, 0x20, 0x62, 0x88, 0x92, 0xC0, 0x61, 0x5C, 0xD9, 0x13, 0x11, 0x11, 0xD2, 0xCC,
+    0x20, 0x23, 0x98, 0x70, 0x06, 0xE0, 0x0C, 0x94, 0x40, 0x8C, 0x10, 0x32, 0x0C, 0x5A, 0x4C, 0x85,
+    0x05, 0x34, 0x88, 0x13, 0x2B, 0xBE, 0x1A, 0x23, 0x02, 0x19, 0x80, 0x90, 0x26, 0xC4, 0x00, 0xE6,
+    0x21, 0x12, 0xE3, 0x13, 0x09, 0x21, 0x33, 0x9C, 0x21, 0x5C, 0x19, 0x01, 0xA8, 0x48, 0x0A, 0x99,
+    0xE1, 0x0C, 0xE1, 0xCA, 0x10, 0x33, 0x80, 0xC3, 0x97, 0xD8, 0xA7, 0x86, 0x8A, 0xC0, 0x21, 0x8E,
+    0xEA, 0x53, 0x84, 0x3B, 0xBE, 0x52, 0x21, 0xAC, 0x98, 0x06, 0x32, 0xBE, 0x52, 0x21, 0xAC, 0x98,
+    0x06, 0x00, 0x0D, 0x21, 0xE9, 0x8E, 0xAF, 0x54, 0x62, 0x21, 0xE1, 0x04, 0x70, 0x68, 0xA5, 0xFC,
+    0x04, 0x3C, 0x40, 0x34, 0xE0, 0x0A, 0x14, 0x8B, 0x59, 0x0D, 0x58, 0x16, 0x22, 0xC2, 0x11, 0x21,
+    0xA5, 0x60, 0x1A, 0x58, 0x94, 0x16, 0x7F, 0xA2, 0x5B, 0x7F, 0x8A, 0xA8, 0x06, 0x58, 0x11, 0xCC,
+    0x90, 0x92, 0x80, 0x87, 0x38, 0x15, 0x5F, 0x09, 0x9D, 0x10, 0x21, 0x38, 0x8C, 0xAD, 0x7F, 0x6A,
+    0x08, 0x9C, 0x60, 0x48, 0x68, 0x40, 0x83, 0x90, 0x43, 0x59, 0x00, 0xA8, 0x91, 0x10, 0x5A, 0x58,
+    0x20, 0x21, 0xB4, 0x03, 0x0E, 0x29, 0x1A, 0xA0, 0x26, 0x9A, 0xC0, 0xCE, 0x00, 0x07, 0x93, 0x09,
+    0x50, 0x8B, 0x66, 0x31, 0x50, 0x71, 0x3A, 0x50, 0xE3, 0x90, 0x36, 0x05, 0x0A, 0x1D, 0x8A, 0x9B,
+    0x3C, 0x48, 0x14, 0x10, 0xE1, 0x08, 0x25, 0x8A, 0x69, 0x80, 0x80, 0x00, 0x2B, 0x42, 0x28, 0x51,
+    0x12, 0xC0, 0x10, 0xCD, 0x8C, 0x58, 0x2E, 0xBC, 0x40, 0x06, 0x80, 0x48, 0x13, 0x22, 0x4C, 0x88,
+    0xD3, 0x32, 0x96, 0x50, 0x43, 0x20, 0x02, 0x34, 0x03, 0x11, 0x19, 0x40, 0x34, 0x10, 0x2D, 0x61,
+    0x04, 0x02, 0x10, 0x0D, 0x71, 0x13, 0x02, 0x09, 0x1C, 0x2C, 0xBA, 0xBE, 0x41, 0xD9, 0xED, 0x41,
+    0xA1, 0xC3, 0xAA, 0x35, 0xA8, 0x82, 0x90, 0x74, 0xC3, 0x0C, 0x07, 0x20, 0x74, 0x42, 0x0D, 0x80,
+    0xB5, 0x0E, 0x49, 0x65, 0x32, 0x06, 0x83, 0x24, 0x84, 0xE5, 0x02, 0xE0, 0x16, 0x25, 0x10, 0xA1,
+    0x34, 0x17, 0xA1, 0x1A, 0xDD, 0x80, 0x2E, 0x01, 0x09, 0xE8, 0x1E, 0x90, 0x80, 0x2E, 0xD0, 0xD8,
+    0x45, 0x39, 0x4E, 0x28, 0x4D, 0x50, 0xA8, 0x46, 0x47, 0x10, 0x74, 0x09, 0x68, 0x20, 0xE8, 0x1E,
+    0xD0, 0x40, 0xD0, 0x05, 0x1A, 0xB7, 0xD0, 0x78, 0x09, 0xA5, 0x09, 0x0A, 0xB5, 0x4A, 0xC2, 0x0E,
+    0x65, 0x1C, 0x0F, 0xD5, 0xA2, 0x0F, 0xF5, 0x06, 0x10, 0x15, 0xD3, 0x10, 0x25, 0xAB, 0x11, 0x35,
+    0x33, 0x12, 0x45, 0xC7, 0x12, 0x55, 0x77, 0x13, 0x95, 0xD1, 0x13, 0x15, 0x16, 0x97, 0xB9, 0xA1,
+    0xE2, 0xC4, 0xA1, 0x80, 0xC9, 0x89, 0x70, 0x04, 0x32, 0x65, 0x20, 0xD3, 0x00, 0x62, 0x24, 0x84,
+    0x14, 0x16, 0x00, 0x4C, 0x4E, 0x84, 0x2B, 0x90, 0x29, 0x03, 0x99, 0x06, 0x54, 0xA4, 0x21, 0x94,
+    0x19, 0x00, 0x0A, 0x30, 0x48, 0x04, 0x71, 0xAC, 0xB8, 0x00, 0x18, 0x14, 0x38, 0x68, 0xD2, 0x43,
+    0x00, 0x44, 0x80, 0x24, 0x38, 0x0F, 0x22, 0x32, 0xD0, 0x51, 0x28, 0x0A, 0x05, 0x0E, 0xE3, 0xA9,
+    0x32, 0xCC, 0xA1, 0xA6, 0xFA, 0x84, 0x34, 0x0B, 0xC2, 0x19, 0xC0, 0x84, 0x11, 0x40, 0x6C, 0xA0,
+    0x2D, 0x14, 0x03, 0x4C, 0xC8, 0x44, 0x0D, 0xA4, 0x42, 0x0C, 0xB6, 0x02, 0xD0, 0x0E, 0x45, 0x5E,
+    0x19, 0x0E, 0x62, 0x24, 0x28, 0x18, 0x16, 0x00, 0x90, 0x04, 0x33, 0x4B, 0x00, 0xB0, 0x86, 0x90,
+    0x64, 0x84, 0x20, 0xE1, 0x1C, 0x00, 0x21, 0x1A, 0x89, 0x54, 0x08, 0x15, 0xC8, 0x09, 0x60, 0x34,
+    0xD4, 0x2F, 0xCA, 0xCC, 0x30, 0x0A, 0xD9, 0x34, 0xAA, 0x99, 0x35, 0x2A, 0x3E, 0x36, 0x4A, 0x0A,
+    0x37, 0x8A, 0x52, 0x39, 0xAA, 0xCA, 0x3A, 0x0A, 0x2C, 0x46, 0xCE, 0x45, 0x4D, 0xE1, 0x45, 0x35,
+    0xB1, 0xC0, 0x10, 0xA0, 0x1D, 0xA0, 0x66, 0x02, 0x39, 0x80, 0x15, 0x31, 0x60, 0x49, 0x80, 0x84,
+    0x00, 0x2D, 0xE2, 0x48, 0x51, 0x08, 0x80, 0x0E, 0xE7, 0x26, 0xA3, 0x18, 0x40, 0xC0, 0x0D, 0x43,
+    0xBC, 0xA2, 0x1A, 0x38, 0x64, 0xFE, 0x8C, 0x02, 0x18, 0x60, 0x22, 0x11, 0xE2, 0x95, 0x11, 0x00,
+    0x60, 0x22, 0x0D, 0xE2, 0x95, 0x11, 0x80, 0xA0, 0x41, 0xA6, 0x5C, 0x90, 0x01, 0xE3, 0x98, 0x05,
+    0x03, 0x02, 0x40, 0x23, 0x1B, 0x8A, 0x21, 0x07, 0x08, 0x87, 0xC8, 0xC5, 0x51, 0xE0, 0x10, 0xA1,
+    0x0E, 0xA2, 0x15, 0x88, 0x42, 0x80, 0x76, 0x00, 0x76, 0x84, 0x62, 0x22, 0x1A, 0xA0, 0x99, 0x1D,
+    0x22, 0xB0, 0x11, 0x48, 0x21, 0x03, 0x2C, 0x12, 0x86, 0x47, 0xAD, 0xD2, 0x47, 0x01, 0xAB, 0x20,
+    0x24, 0x60, 0x02, 0xE6, 0x21, 0x4A, 0x7B, 0x14, 0x89, 0x10, 0xA3, 0x8C, 0x00, 0x34, 0x26, 0x43,
+    0x8C, 0x32, 0x04, 0x71, 0xE0, 0x80, 0xD4, 0x3B, 0x6A, 0x36, 0xC4, 0x45, 0x8A, 0x24, 0x4C, 0xAA,
+    0xC8, 0x52, 0xCA, 0xC0, 0x53, 0x4A, 0x41, 0x54, 0xAA, 0xFD, 0x55, 0xEA, 0xAD, 0x56, 0x0A, 0x16,
+    0x58, 0x4A, 0xE6, 0x58, 0x6A, 0x7E, 0x5C, 0x8A, 0xD6, 0x61, 0xAA, 0x62, 0x62, 0x0A, 0x90, 0x87,
+    0x4E, 0x29, 0x52, 0x88, 0xD3, 0x1A, 0xC4, 0x41, 0x04, 0x68, 0x09, 0xE2, 0x20, 0x02, 0x26, 0x41,
+    0xB0, 0x48, 0x8C, 0x7F, 0xA4, 0xD0, 0x95, 0xA4, 0x62, 0xB4, 0xA4, 0xC8, 0xC1, 0x1A, 0x31, 0x08,
+    0x0A, 0x91, 0x26, 0x44, 0x74, 0x10, 0xC7, 0xC4, 0x19, 0x42, 0x01, 0x13, 0x10, 0x21, 0x40, 0x83,
+    0x48, 0xAD, 0x24, 0x98, 0x51, 0x8C, 0x28, 0x44, 0x9C, 0x07, 0x16, 0x40, 0xA8, 0x32, 0x08, 0xB4,
+    0x8D, 0x26, 0xD1, 0xE8, 0xA4, 0x14, 0xF4, 0xA4, 0xE4, 0xF9, 0xA4, 0x28, 0x09, 0xA5, 0x0C, 0x60,
+    0x45, 0x04, 0x57, 0x12, 0xD0, 0x98, 0x88, 0x26, 0x88, 0x03, 0x05, 0x38, 0x00, 0x54, 0x44, 0x2A,
+    0x82, 0x38, 0xCC, 0x04, 0x70, 0x38, 0x19, 0x29, 0x45, 0x34, 0x40, 0x33, 0x23, 0x46, 0x20, 0x85,
+    0x0C, 0x80, 0x1C, 0xB4, 0x9F, 0x74, 0x98, 0x10, 0x86, 0x34, 0x84, 0x21, 0x5E, 0x00, 0x07, 0xA7,
+    0x1A, 0x51, 0x87, 0xEB, 0xDB, 0x00, 0xC4, 0x82, 0x1D, 0x8E, 0x33, 0x22, 0x04, 0x44, 0x68, 0x01,
+    0x0D, 0x38, 0x20, 0x2E, 0x8E, 0xF2, 0x20, 0x19, 0xD0, 0x10, 0x31, 0x43, 0xE4, 0x5C, 0x48, 0x30,
+    0x00, 0x85, 0x14, 0x38, 0x21, 0xD4, 0x06, 0x16, 0x09, 0xAD, 0xA5, 0x26, 0xBB, 0xA5, 0x04, 0xA2,
+    0x91, 0x48, 0x85, 0x0A, 0xE4, 0x04, 0xA0, 0x11, 0x48, 0x84, 0x0A, 0xE4, 0x04, 0xA0, 0x21, 0x62,
+    0x42, 0x20, 0xC1, 0x80, 0x45, 0x42, 0x7A, 0xA9, 0x79, 0x80, 0x29, 0x60, 0xA2, 0x22, 0x12, 0x11,
+    0x4C, 0x19, 0xCC, 0x04, 0x20, 0x1E, 0x02, 0xE6, 0x07, 0x4C, 0x54, 0x44, 0x1A, 0xCA, 0x60, 0x26,
+    0x00, 0xE4, 0x70, 0x71, 0xE3, 0x21, 0x02, 0x96, 0x05, 0x67, 0x04, 0x53, 0x52, 0x6A, 0x80, 0x42,
+    0x12, 0x70, 0x00, 0xD6, 0x01, 0xC9, 0x92, 0x0F, 0x64, 0x92, 0x0D, 0xE2, 0x89, 0x71, 0xC0, 0xA2,
+    0x0B, 0xCF, 0xD4, 0x3C, 0xD7, 0x54, 0x5B, 0x34, 0x90, 0x99, 0x5A, 0x34, 0xF2, 0x21, 0x07, 0x0B,
+    0x3D, 0x51, 0x90, 0x89, 0x1A, 0x9C, 0x06, 0x58, 0x0D, 0x82, 0x94, 0x04, 0x16, 0xE5, 0x92, 0xA6,
+    0x68, 0xB1, 0xA6, 0x1A, 0xC4, 0x24, 0x60, 0x41, 0x1C, 0x38, 0x44, 0x98, 0x9A, 0x22, 0x24, 0x1D,
+    0x71, 0xC2, 0x01, 0x1A, 0x13, 0x71, 0x04, 0x71, 0xC0, 0x2B, 0xC0, 0x2C, 0x02, 0x07, 0x10, 0x21,
+    0x8D, 0x41, 0xB4, 0x0C, 0x23, 0x88, 0x0B, 0x04, 0x50, 0x90, 0xD1, 0x20, 0x30, 0x5B, 0xE0, 0xD4,
+    0x38, 0x76, 0x0A, 0xE9, 0x7C, 0x2A, 0xA9, 0x87, 0x4A, 0x91, 0x88, 0x8A, 0x35, 0x8B, 0xAA, 0xD5,
+    0x8B, 0x2A, 0xAA, 0x9E, 0x4A, 0x5A, 0xA8, 0x6A, 0xA6, 0xAB, 0x4A, 0x2C, 0xAA, 0x8F, 0x4E, 0xCD,
+    0xA5, 0x4E, 0x1D, 0x48, 0x63, 0x02, 0x82, 0xA5, 0xAF, 0x18, 0x05, 0x05, 0x71, 0x96, 0xBE, 0x32,
+    0x14, 0x14, 0xC4, 0x01, 0x44, 0x3C, 0x00, 0xEF, 0x8E, 0x72, 0x20, 0x8D, 0xA9, 0x18, 0x0A, 0x0A,
+    0xE2, 0xC0, 0x23, 0xE2, 0xF0, 0x54, 0x53, 0xF6, 0x94, 0x13, 0xF8, 0x14, 0x20, 0x21, 0x0D, 0x69,
+    0xC8, 0x82, 0x04, 0xB0, 0x28, 0x25, 0x3D, 0x95, 0x25, 0x3D, 0xD5, 0x08, 0x08, 0xD0, 0x22, 0x94,
+    0x28, 0x04, 0x40, 0x1A, 0x12, 0x51, 0xB2, 0x20, 0x01, 0x40, 0x0A, 0x44, 0x1C, 0xA0, 0xDE, 0x30,
+    0x58, 0x10, 0xD0, 0x40, 0x50, 0x12, 0x05, 0x1C, 0xB6, 0xC3, 0x4F, 0x2D, 0x0D, 0x4E, 0x20, 0xA9,
+    0x01, 0xF3, 0x91, 0x98, 0x82, 0x0A, 0xE1, 0x83, 0xAA, 0x9D, 0x86, 0x0A, 0x1C, 0xB6, 0x37, 0x50,
+    0x21, 0xED, 0x90, 0xC8, 0x80, 0x0A, 0x68, 0x04, 0x92, 0x11, 0x48, 0x21, 0x2A, 0x00, 0x02, 0x69,
+    0x08, 0xA4, 0x10, 0x15, 0x80, 0x76, 0x48, 0x76, 0x1C, 0x20, 0x90, 0x82, 0x42, 0x54, 0x00, 0x87,
+    0x0E, 0x2C, 0x54, 0x0D, 0x80, 0x34, 0xA6, 0xA2, 0x08, 0x22, 0x88, 0x03, 0x1A, 0x62, 0x84, 0x04,
+    0x32, 0x04, 0x22, 0x61, 0x01, 0x40, 0x23, 0x90, 0x88, 0x40, 0x0A, 0x51, 0x01, 0x70, 0x22, 0x67,
+    0xC2, 0x09, 0x62, 0x34, 0x70, 0x28, 0x5B, 0x45, 0x45, 0x0E, 0x11, 0x26, 0x06, 0x46, 0x82, 0xC1,
+    0x61, 0x59, 0xFA, 0xCA, 0x0A, 0xE0, 0x80, 0x00, 0x1F, 0x05, 0xB0, 0x0A, 0x5E, 0x49, 0xE0, 0x92,
+    0xE0, 0x8E, 0x0A, 0xE1, 0x92, 0xCA, 0xE5, 0x94, 0x6A, 0x2A, 0x97, 0x8A, 0x1E, 0x98, 0x0A, 0x30,
+    0x0B, 0x00, 0x7F, 0x1B, 0xAC, 0xE3, 0x02, 0x87, 0xAE, 0x82, 0x54, 0x05, 0x22, 0xCD, 0x08, 0x51,
+    0xC3, 0x19, 0x00, 0x55, 0xC5, 0x43, 0x74, 0x47, 0x2A, 0x52, 0x81, 0x02, 0x9B, 0x26, 0x00, 0x8D,
+    0xE9, 0x40, 0x81, 0x4D, 0x23, 0x88, 0x03, 0xA4, 0x82, 0x90, 0x26, 0x60, 0x42, 0x9C, 0x46, 0xA6,
+    0xD4, 0x70, 0x46, 0x19, 0x02, 0x91, 0x03, 0x10, 0x54, 0x45, 0x44, 0x40, 0x80, 0x2C, 0xC8, 0x84,
+    0x63, 0x02, 0x9B, 0xC1, 0x14, 0x29, 0x92, 0x18, 0x0D, 0x00, 0x90, 0x16, 0x21, 0xC8, 0x28, 0x82,
+    0x80, 0xC5, 0xC2, 0x67, 0xAA, 0x8A, 0x77, 0x2A, 0xA2, 0x22, 0x62, 0x44, 0x60, 0x33, 0x18, 0x00,
+    0x1C, 0xCE, 0x72, 0x53, 0x09, 0x13, 0x15, 0x11, 0xE3, 0x60, 0xDC, 0x93, 0x00, 0x15, 0x0F, 0x11,
+    0xCF, 0xA9, 0x48, 0x83, 0x1A, 0xCC, 0x04, 0xA0, 0x31, 0x15, 0x6A, 0x30, 0x23, 0x88, 0x03, 0x88,
+    0xD8, 0x10, 0xD8, 0x0C, 0x06, 0x4C, 0xA6, 0x27, 0x54, 0x29, 0x50, 0x54, 0x31, 0x6F, 0x54, 0x45,
+    0x91, 0x54, 0x21, 0x80, 0x41, 0x1A, 0x8C, 0x28, 0x2E, 0x00, 0x4E, 0x84, 0x4C, 0x38, 0xE3, 0xAB,
+    0x21, 0x23, 0x46, 0x03, 0xC8, 0x82, 0x6C, 0x4D, 0xC0, 0x84, 0x08, 0x10, 0x62, 0x01, 0x06, 0x12,
+    0x51, 0x52, 0x59, 0x01, 0x2C, 0x4E, 0xEC, 0x54, 0x61, 0xD3, 0x5B, 0x80, 0x43, 0xB4, 0x9A, 0x2A,
+    0x83, 0x24, 0x88, 0xE2, 0x02, 0x60, 0x90, 0x06, 0x51, 0x5C, 0x00, 0xB0, 0x88, 0x18, 0x15, 0xA3,
+    0x99, 0xB0, 0xC0, 0xE1, 0x24, 0x54, 0x95, 0xC4, 0x10, 0x03, 0x02, 0x22, 0xE8, 0x0B, 0x4B, 0x14,
+    0x80, 0x88, 0x02, 0x60, 0x42, 0x9C, 0xD6, 0xC1, 0x8C, 0x2C, 0x43, 0x20, 0x02, 0x16, 0x89, 0xE6,
+    0xAA, 0xCE, 0xFB, 0xAA, 0x80, 0xE7, 0xC0, 0x24, 0x44, 0x00, 0x56, 0x4A, 0x18, 0x25, 0xC2, 0x76,
+    0x84, 0x2A, 0x09, 0x88, 0x80, 0x05, 0x91, 0x26, 0x59, 0x21, 0x4A, 0x12, 0x67, 0x80, 0x45, 0x02,
+    0xC8, 0x2A, 0x96, 0xD5, 0x2A, 0x80, 0x01, 0x26, 0x44, 0x90, 0x19, 0xE1, 0x95, 0x21, 0xD4, 0x01,
+    0x87, 0x73, 0x9F, 0x55, 0x0C, 0x30, 0x21, 0x02, 0x58, 0x68, 0x12, 0x8E, 0x92, 0xAD, 0x09, 0x80,
+    0x08, 0x08, 0xD0, 0xC8, 0x8C, 0x57, 0x86, 0x50, 0xA2, 0x90, 0x03, 0x00, 0x13, 0x22, 0x0E, 0xD1,
+    0x79, 0xAB, 0x80, 0x65, 0xC1, 0x21, 0xE1, 0x95, 0x21, 0x54, 0x49, 0xA9, 0x01, 0x40, 0xEB, 0x08,
+    0xAF, 0x0C, 0xA1, 0x44, 0x21, 0x60, 0xF1, 0xC0, 0xBA, 0x8A, 0x0E, 0xBC, 0x4A, 0x00, 0xA2, 0xE9,
+    0xC0, 0xA4, 0x59, 0x20, 0xCE, 0x00, 0x80, 0x06, 0x11, 0x64, 0x46, 0x50, 0xB0, 0x10, 0xA1, 0x0E,
+    0x70, 0x12, 0x98, 0x82, 0x60, 0x54, 0x70, 0xC3, 0x6A, 0x00, 0xC5, 0x8A, 0xA4, 0xCA, 0x6A, 0x79,
+    0xCB, 0x8A, 0x85, 0xCC, 0x2A, 0x56, 0xCF, 0x4A, 0x52, 0xD4, 0x6A, 0x36, 0xD8, 0x0A, 0x2C, 0xB6,
+    0x2A, 0x58, 0xC5, 0x3F, 0x58, 0x21, 0xED, 0xC0, 0x0C, 0x89, 0x02, 0xD2, 0x34, 0xA6, 0xC0, 0x81,
+    0x86, 0x1B, 0x8A, 0xB1, 0xF4, 0x05, 0x13, 0x2C, 0x7D, 0xC5, 0x04, 0xE0, 0x00, 0x9A, 0x01, 0x91,
+    0x48, 0x87, 0x51, 0xB0, 0x90, 0x25, 0x4E, 0x00, 0x8B, 0x64, 0x37, 0x56, 0x08, 0x47, 0x56, 0x80,
+    0x80, 0x34, 0x24, 0x42, 0x28, 0x41, 0x02, 0x38, 0xAC, 0x18, 0xB2, 0x42, 0x2A, 0x60, 0x45, 0x88,
+    0x30, 0x4B, 0x02, 0x07, 0xC8, 0x3C, 0x56, 0x87, 0x24, 0x51, 0x56, 0x02, 0xD2, 0x0E, 0xC8, 0xF1,
+    0x22, 0x0E, 0xEA, 0xC2, 0x0B, 0x44, 0x4A, 0x04, 0xCC, 0x84, 0x32, 0x00, 0x84, 0xA0, 0x6E, 0x85,
+    0x48, 0x22, 0x30, 0x0E, 0x0E, 0xC9, 0xE9, 0xAC, 0x82, 0x08, 0x68, 0x80, 0xE7, 0x70, 0x1A, 0x52,
+    0x81, 0x22, 0x44, 0x24, 0x00, 0x01, 0x11, 0x1B, 0x64, 0x30, 0x60, 0x51, 0x24, 0xD2, 0x8A, 0xDC,
+    0xD3, 0x0A, 0x68, 0x06, 0x90, 0x31, 0x83, 0x29, 0x64, 0x15, 0x4B, 0x7F, 0x93, 0x30, 0x85, 0xAC,
+    0x02, 0x0E, 0xCF, 0x4F, 0x3A, 0x88, 0x66, 0x42, 0x16, 0x52, 0x51, 0xC8, 0x10, 0x29, 0x00, 0xA6,
+    0xC0, 0x05, 0x70, 0x28, 0xCD, 0x6A, 0x05, 0x18, 0x24, 0xE1, 0x14, 0x17, 0xC0, 0x21, 0x49, 0xAE,
+    0x15, 0xD0, 0x18, 0x44, 0x8C, 0x08, 0xC4, 0x05, 0x03, 0x34, 0x06, 0xD2, 0x98, 0x8A, 0xE2, 0x04,
+    0x71, 0x60, 0x91, 0x4C, 0xDF, 0xEA, 0x30, 0xE2, 0x0A, 0x2C, 0x32, 0xAB, 0x5B, 0xBD, 0xD3, 0x5B,
+    0xAD, 0x43, 0xEA, 0x6C, 0x2B, 0x44, 0x14, 0x24, 0xA1, 0x80, 0xC8, 0x1C, 0x62, 0x98, 0x5B, 0x21,
+    0x22, 0x22, 0x31, 0xE3, 0x84, 0x02, 0x0D, 0x89, 0x19, 0xD7, 0x00, 0x27, 0x7A, 0x0E, 0x4C, 0x42,
+    0x64, 0x03, 0x3A, 0xE2, 0x00, 0x87, 0x3B, 0x88, 0xAB, 0x01, 0x12, 0x39, 0x8B, 0x63, 0x0E, 0x31,
+    0x17, 0xAE, 0x10, 0x69, 0x76, 0x20, 0x83, 0x12, 0x72, 0xE2, 0x0C, 0x50, 0x81, 0x0C, 0x4A, 0xC8,
+    0x35, 0x00, 0x78, 0x0E, 0x27, 0x56, 0x94, 0x08, 0x91, 0x01, 0x97, 0x23, 0x35, 0x57, 0x6B, 0x3C,
+    0x57, 0x2D, 0xC7, 0x57, 0x51, 0x03, 0x58, 0x12, 0x08, 0x58, 0x82, 0x23, 0x09, 0xCE, 0x83, 0x2B,
+    0x0C, 0x3A, 0x0A, 0xC5, 0x06, 0x58, 0x48, 0x41, 0xC8, 0x84, 0x19, 0x0E, 0x78, 0x44, 0x45, 0xBB,
+    0x5A, 0x12, 0xBC, 0x9A, 0x01, 0xBE, 0x22, 0x8B, 0xED, 0x52, 0x57, 0x34, 0x65, 0x57, 0x00, 0x4D,
+    0x10, 0x81, 0x01, 0x0D, 0x3A, 0xA4, 0xF3, 0xBA, 0x02, 0x11, 0x29, 0x10, 0x22, 0x0A, 0xC0, 0x2A,
+    0x52, 0x20, 0x44, 0xB0, 0x07, 0x0A, 0x44, 0x60, 0x60, 0xD1, 0xBC, 0xEE, 0x2A, 0xB2, 0xEF, 0x0A,
+    0x88, 0x70, 0xC2, 0x28, 0xA6, 0x01, 0x11, 0xC0, 0x22, 0x92, 0x70, 0xA6, 0x3C, 0x00, 0x1C, 0x4C,
+    0x86, 0xC3, 0x2C, 0x22, 0x8D, 0x5E, 0x39, 0xD1, 0x71, 0x90, 0xC3, 0x27, 0xCE, 0xAB, 0x06, 0x1D,
+    0xD2, 0x5D, 0x5E, 0x81, 0x02, 0x22, 0x0A, 0xC0, 0x12, 0x88, 0x60, 0x0F, 0x20, 0x06, 0x12, 0x21,
+    0x62, 0x58, 0x01, 0x1C, 0x4E, 0xBF, 0x5E, 0x39, 0x0D, 0x02, 0x44, 0xA4, 0xA1, 0x08, 0x13, 0x00,
+    0x70, 0x18, 0xAB, 0x7B, 0xD5, 0xCC, 0x0A, 0x31, 0x0A, 0x19, 0x00, 0xAE, 0x10, 0xA3, 0x98, 0x06,
+    0x00, 0x11, 0x6E, 0x10, 0xA3, 0x98, 0x06, 0x26, 0x49, 0xBA, 0xAF, 0x50, 0xC2, 0xAF, 0x64, 0xCD,
+    0xAF, 0xE8, 0xF9, 0xAF, 0x80, 0x89, 0x8A, 0x48, 0x84, 0x28, 0x83, 0x99, 0x00, 0x0E, 0x22, 0x3A,
+    0x49, 0x48, 0xF3, 0x80, 0x3C, 0x4E, 0xE1, 0x10, 0xF5, 0x81, 0x63, 0x8A, 0x87, 0x38, 0xF8, 0x57,
+    0x08, 0x21, 0x2B, 0xC4, 0x19, 0x46, 0x84, 0x03, 0x1A, 0xC4, 0x19, 0xA6, 0x01, 0x0C, 0xC5, 0x1A,
+    0xC4, 0x63, 0x0F, 0x88, 0x07, 0x4E, 0x7E, 0x2E, 0x9B, 0x43, 0x56, 0x58, 0x85, 0x61, 0x58, 0xE8,
+    0x6C, 0x58, 0x8F, 0x72, 0x58, 0x92, 0x79, 0x58, 0x53, 0x8A, 0x58, 0xE2, 0xF0, 0x7C, 0x07, 0x8B,
+    0x58, 0x87, 0x6B, 0x2F, 0x58, 0x40, 0x43, 0x38, 0x94, 0xAC, 0x48, 0x85, 0x04, 0xC4, 0x0E, 0x00,
+    0xB4, 0x43, 0x47, 0xC5, 0x21, 0xC4, 0xA1, 0x64, 0x43, 0x40, 0xEC, 0x80, 0x43, 0xC4, 0x28, 0x2C,
+    0x72, 0x58, 0xD9, 0x84, 0x85, 0x54, 0x0E, 0x25, 0x2B, 0x44, 0x98, 0x88, 0x1D, 0x70, 0x80, 0x5E,
+    0x84, 0x85, 0x1C, 0xD4, 0x11, 0x05, 0x01, 0x18, 0x02, 0x68, 0x9C, 0x98, 0x11, 0x5E, 0x28, 0x04,
+    0x19, 0xC0, 0xA1, 0xA2, 0x89, 0x6A, 0x08, 0x99, 0x61, 0x06, 0x23, 0xE1, 0x00, 0x0B, 0x49, 0x38,
+    0x22, 0x05, 0x80, 0x58, 0x56, 0xC3, 0x89, 0x21, 0x25, 0xB0, 0xB8, 0x60, 0x88, 0xE5, 0xA4, 0x9C,
+    0x43, 0xB4, 0x86, 0x9C, 0x03, 0x01, 0x48, 0x81, 0x48, 0x01, 0x20, 0xE2, 0x21, 0x7E, 0x26, 0x16,
+    0xE2, 0x50, 0x32, 0xA4, 0x9D, 0x11, 0x8C, 0x40, 0xEC, 0x80, 0x45, 0x97, 0x48, 0x2C, 0x7D, 0x54,
+    0x2C, 0x49, 0x77, 0xB4, 0x33, 0x82, 0x11, 0xE1, 0x80, 0x8C, 0x76, 0x46, 0x30, 0x0D, 0x1C, 0x12,
+    0x05, 0x63, 0x81, 0x43, 0x84, 0x5D, 0x2C, 0x92, 0x50, 0x70, 0x00, 0x1A, 0x13, 0x51, 0xB0, 0x20,
+    0x0E, 0x1C, 0x00, 0xDE, 0x62, 0xAD, 0x12, 0xB6, 0x63, 0x1D, 0xEA, 0x63, 0xAD, 0x17, 0x64, 0x31,
+    0x3A, 0x64, 0x35, 0x8D, 0x64, 0xC5, 0xFD, 0x65, 0xC9, 0xE2, 0x66, 0x4D, 0x04, 0x67, 0x51, 0x39,
+    0x67, 0x55, 0x50, 0x67, 0x8D, 0xC3, 0x55, 0xFA, 0x28, 0x72, 0x10, 0x51, 0xA6, 0xA0, 0x1D, 0x62,
+    0xDC, 0x63, 0xCD, 0x84, 0x17, 0xC8, 0x00, 0x09, 0x24, 0x34, 0x00, 0x60, 0x18, 0x62, 0x00, 0x1A,
+    0x59, 0xC2, 0x4E, 0x12, 0xEF, 0x00, 0x84, 0xB0, 0x50, 0x84, 0x6C, 0x60, 0x29, 0x1C, 0x80, 0x68,
+    0xE6, 0x61, 0xE4, 0x46, 0x96, 0xA3, 0x33, 0xC2, 0x0B, 0x64, 0x20, 0x00, 0x40, 0x16, 0x1C, 0x51,
+    0x8C, 0x48, 0x0D, 0x3C, 0x22, 0x25, 0x65, 0xB9, 0x44, 0x65, 0xCD, 0x5E, 0x65, 0x11, 0xD2, 0x04,
+    0xC4, 0x43, 0xDC, 0x9E, 0x2C, 0x84, 0x90, 0x1D, 0xE5, 0x8C, 0x60, 0x44, 0x38, 0xA0, 0xA2, 0x9C,
+    0x11, 0x4C, 0xB3, 0xF4, 0x21, 0x12, 0x46, 0x31, 0x0D, 0x10, 0x14, 0x22, 0x92, 0x11, 0x38, 0x98,
+    0x03, 0x2C, 0xC8, 0x44, 0x02, 0xA0, 0x50, 0x60, 0x51, 0x9E, 0x2E, 0x0B, 0xFB, 0x2E, 0x0B, 0x1C,
+    0xB6, 0xAD, 0x65, 0x21, 0x8D, 0xAC, 0x60, 0x64, 0x14, 0x41, 0x0E, 0xE0, 0x50, 0x32, 0x83, 0x91,
+    0x51, 0x04, 0x41, 0xEC, 0x80, 0x00, 0x78, 0x80, 0x07, 0x11, 0x11, 0x68, 0xB4, 0x28, 0x14, 0x78,
+    0x34, 0x96, 0xCC, 0x8A, 0xCE, 0xCC, 0x9A, 0x92, 0xCD, 0x22, 0x24, 0x57, 0x60, 0xE9, 0x43, 0x26,
+    0xD0, 0x83, 0x00, 0xC0, 0x20, 0x0D, 0xC3, 0x15, 0x17, 0x00, 0x47, 0x1C, 0xBA, 0xB8, 0x66, 0x89,
+    0x43, 0x07, 0xD5, 0x2C, 0xA0, 0x55, 0x20, 0xA5, 0x0A, 0x01, 0x11, 0x48, 0x29, 0x04, 0x1A, 0x90,
+    0x52, 0x08, 0x00, 0x0C, 0x92, 0xE0, 0x8A, 0x0B, 0xC0, 0x44, 0x45, 0x24, 0x42, 0x9C, 0xC1, 0x4C,
+    0x00, 0x87, 0x12, 0xE5, 0x0F, 0x48, 0x85, 0x00, 0x13, 0x31, 0x22, 0xCA, 0x08, 0x0B, 0x68, 0xA6,
+    0xD3, 0x40, 0x06, 0x04, 0x87, 0xAC, 0xE3, 0x02, 0x04, 0x2A, 0x10, 0x01, 0x70, 0x48, 0x02, 0x32,
+    0x01, 0x6C, 0x8E, 0xE3, 0x67, 0x1D, 0xFA, 0x67, 0xAD, 0x1F, 0x68, 0xB5, 0x91, 0x68, 0x49, 0x6D,
+    0x69, 0x4D, 0xDE, 0x69, 0x89, 0x03, 0x6A, 0x2A, 0x05, 0x44, 0x4C, 0x30, 0x2B, 0x18, 0x00, 0x60,
+    0x18, 0x60, 0x00, 0x5A, 0xC7, 0x49, 0xE2, 0x01, 0x13, 0x3A, 0x7C, 0xD6, 0xD0, 0x12, 0xA8, 0x65,
+    0x8A, 0x80, 0x05, 0x91, 0x58, 0x05, 0x33, 0x25, 0x89, 0xF3, 0x80, 0x85, 0x1C, 0xC6, 0xD0, 0x19,
+    0x8D, 0x02, 0x11, 0x16, 0x58, 0x14, 0x97, 0xD1, 0x6A, 0x6A, 0xD2, 0x0A, 0x88, 0x58, 0x41, 0xD8,
+    0x93, 0xC1, 0x00, 0xC8, 0x03, 0x2C, 0xC8, 0x3C, 0xC4, 0x30, 0xD2, 0x42, 0x08, 0x59, 0x22, 0x94,
+    0x88, 0x25, 0x89, 0x21, 0xC2, 0x01, 0x1D, 0x42, 0x89, 0x58, 0x92, 0x18, 0x0D, 0x40, 0x04, 0xE4,
+    0x01, 0x16, 0x64, 0xC2, 0x25, 0x42, 0x89, 0x58, 0x92, 0x18, 0x0D, 0x10, 0x87, 0xE8, 0x6B, 0x5A,
+    0xC4, 0x22, 0x1B, 0x4E, 0x48, 0xC7, 0xD2, 0xC7, 0x8E, 0x4A, 0xE1, 0x80, 0x43, 0x00, 0x05, 0x0E,
+    0x01, 0x01, 0x5A, 0x85, 0x50, 0xA2, 0x10, 0x00, 0x1D, 0xAC, 0x19, 0x67, 0x1D, 0xCA, 0x1A, 0x6A,
+    0x45, 0x00, 0x32, 0x12, 0x44, 0x59, 0x60, 0xD1, 0x3D, 0x52, 0x6B, 0xF2, 0x54, 0x8B, 0x28, 0x01,
+    0xA9, 0x02, 0x06, 0xD6, 0x0E, 0x31, 0x43, 0xB5, 0x10, 0x69, 0x86, 0x88, 0x83, 0x5C, 0x23, 0xE2,
+    0x0C, 0x90, 0x21, 0x0E, 0x72, 0x8D, 0x34, 0x80, 0x88, 0x1C, 0x4A, 0x26, 0x08, 0xC4, 0x0E, 0x58,
+    0x64, 0xE1, 0xD5, 0x9A, 0x73, 0xD6, 0x42, 0x88, 0x8A, 0x24, 0xCC, 0x00, 0x10, 0xF2, 0xF0, 0x15,
+    0x59, 0x0B, 0x78, 0x04, 0xD2, 0x10, 0x8B, 0x0A, 0x80, 0x00, 0x90, 0x84, 0xA2, 0x02, 0x40, 0xC5,
+    0x45, 0xC0, 0xFC, 0x00, 0x4A, 0xBE, 0x0A, 0x62, 0xC1, 0x09, 0x25, 0xA5, 0x06, 0x36, 0x4D, 0xA6,
+    0xB6, 0x10, 0x09, 0xB7, 0x5C, 0x45, 0xB7, 0xE4, 0x53, 0xB7, 0xEA, 0x9A, 0xB7, 0x6C, 0xB0, 0xB7,
+    0xC4, 0xA2, 0x60, 0xC3, 0x16, 0x31, 0xCD, 0x16, 0x20, 0x49, 0x40, 0x3C, 0xC4, 0x41, 0xD8, 0x42,
+    0x16, 0xDC, 0x11, 0xCE, 0x29, 0x46, 0xA4, 0x06, 0x2A, 0xC2, 0x39, 0xC5, 0x34, 0x80, 0x90, 0x87,
+    0xA0, 0xFA, 0x5A, 0xF2, 0x10, 0x65, 0x65, 0x0B, 0x88, 0x87, 0xD8, 0x25, 0x5B, 0xC8, 0x82, 0x43,
+    0xC2, 0x39, 0xC5, 0x88, 0xD4, 0x40, 0x46, 0x38, 0xA7, 0x98, 0x06, 0x4C, 0x08, 0x21, 0x43, 0xC2,
+    0x39, 0x62, 0x88, 0x70, 0x00, 0x79, 0x28, 0xA9, 0xB4, 0x05, 0xC4, 0x43, 0x3C, 0xA3, 0x2D, 0x64,
+    0xC1, 0x11, 0xA7, 0x18, 0x91, 0x1A, 0x48, 0x38, 0xC5, 0x34, 0x70, 0x48, 0xA0, 0x6D, 0x84, 0x0E,
+    0x40, 0x4C, 0x76, 0x0E, 0xDD, 0xC6, 0xB6, 0x16, 0x74, 0x68, 0x12, 0x1E, 0x10, 0x2C, 0x24, 0xC1,
+    0x09, 0x99, 0x02, 0x38, 0x9C, 0xD9, 0xDB, 0x12, 0x10, 0x60, 0x1E, 0xA2, 0xCE, 0x6D, 0x91, 0x88,
+    0x21, 0xCA, 0x08, 0x80, 0xD3, 0x32, 0x86, 0x28, 0x43, 0x20, 0x02, 0x0E, 0x01, 0xEB, 0x1E, 0x10,
+    0x70, 0x80, 0x94, 0xF2, 0x71, 0x68, 0xE0, 0xB8, 0x25, 0x90, 0x06, 0x11, 0x54, 0x00, 0x02, 0x77,
+    0x48, 0xDD, 0xB9, 0x15, 0x1D, 0x8E, 0x33, 0x32, 0xA0, 0x44, 0x06, 0x22, 0xB4, 0x80, 0xD8, 0x00,
+    0x25, 0x32, 0xC0, 0x82, 0x4C, 0x88, 0x28, 0x80, 0x42, 0x81, 0xC3, 0xF9, 0xE3, 0x2D, 0x79, 0x48,
+    0xEE, 0xBB, 0x05, 0x48, 0x40, 0x84, 0x2C, 0x38, 0x44, 0x85, 0x73, 0x8A, 0x11, 0xA9, 0x01, 0x02,
+    0x10, 0xE1, 0x0C, 0x15, 0xCE, 0x29, 0xA6, 0x01, 0x48, 0x3B, 0xD0, 0x3D, 0x88, 0x41, 0x44, 0xD3,
+    0xB1, 0x10, 0x92, 0x6C, 0x08, 0x29, 0x9C, 0x03, 0x2C, 0xC4, 0x34, 0x11, 0x91, 0xCC, 0x38, 0x29,
+    0x8C, 0x11, 0xCC, 0x01, 0x90, 0x63, 0x36, 0x08, 0x07, 0x07, 0xB8, 0x14, 0x05, 0xE0, 0x22, 0x2B,
+    0xE0, 0x32, 0x98, 0xE0, 0x3A, 0x0D, 0xD1, 0x68, 0xD7, 0xE0, 0x02, 0x2A, 0xD2, 0x50, 0xC4, 0x0C,
+    0x80, 0x3A, 0x58, 0xA5, 0x8F, 0x3A, 0xAC, 0xDE, 0xDF, 0x32, 0x8E, 0xC0, 0x89, 0x19, 0x41, 0x38,
+    0x88, 0x98, 0x01, 0x8E, 0x09, 0x61, 0x48, 0xC2, 0x10, 0x2F, 0x80, 0x43, 0x22, 0x3B, 0x9E, 0xB9,
+    0x88, 0x02, 0xC3, 0x85, 0xA7, 0xC3, 0x45, 0x10, 0xCD, 0x74, 0x2A, 0xC2, 0x08, 0x81, 0x0C, 0x08,
+    0x10, 0x32, 0xE3, 0xC7, 0xFC, 0x9C, 0x9F, 0xF3, 0x61, 0x0E, 0x28, 0x08, 0xA3, 0x81, 0x43, 0xBB,
+    0x23, 0x2E, 0xC7, 0x36, 0x60, 0x82, 0x2E, 0x38, 0x70, 0x1A, 0xE2, 0x02, 0x90, 0x84, 0xF2, 0x02,
+    0xB8, 0x74, 0x27, 0xE4, 0x8A, 0x54, 0xE4, 0x9A, 0x4E, 0xE5, 0xAA, 0x2C, 0xE7, 0xB2, 0xD8, 0xE7,
+    0x6A, 0x8B, 0x92, 0x73, 0x5C, 0xD3, 0x79, 0x5C, 0x82, 0xC3, 0x04, 0xC0, 0x44, 0x34, 0x93, 0x6C,
+    0x28, 0x64, 0x1C, 0x80, 0x68, 0xC4, 0x01, 0x21, 0xDA, 0x8B, 0x83, 0x58, 0x08, 0x49, 0x66, 0x84,
+    0x01, 0x43, 0x0A, 0xE7, 0x00, 0x0D, 0x49, 0xA0, 0x88, 0x04, 0x70, 0x38, 0x63, 0xC9, 0x75, 0x10,
+    0x51, 0x6B, 0x18, 0x30, 0x18, 0x02, 0x1C, 0xE4, 0x30, 0xE6, 0x93, 0xAB, 0x05, 0x18, 0x02, 0x10,
+    0x80, 0x34, 0x11, 0x51, 0xEB, 0x28, 0x67, 0x04, 0x43, 0xC0, 0x23, 0x49, 0x2E, 0xD7, 0x19, 0x34,
+    0x17, 0x2A, 0x35, 0x17, 0x10, 0x0E, 0x56, 0x9A, 0xAC, 0x0E, 0x23, 0x90, 0xB9, 0x80, 0x60, 0x1D,
+    0x92, 0x5C, 0x49, 0xE0, 0x88, 0x22, 0x53, 0x03, 0x10, 0x62, 0xC2, 0x15, 0xC8, 0x88, 0x30, 0x1A,
+    0xA0, 0x13, 0xCC, 0x80, 0x80, 0x58, 0x24, 0x92, 0x18, 0x40, 0xF8, 0xDB, 0x00, 0x82, 0xB5, 0x40,
+    0x14, 0xB8, 0x81, 0xBB, 0xD8, 0x84, 0x1C, 0xC6, 0xC1, 0x73, 0x01, 0xB4, 0x81, 0xCD, 0x50, 0x18,
+    0xC0, 0x04, 0x44, 0x0C, 0xF9, 0x4E, 0x68, 0x86, 0x27, 0x83, 0x01, 0x87, 0xE4, 0x9E, 0x04, 0x03,
+    0x80, 0xC9, 0x86, 0xB2, 0x4A, 0x3B, 0x60, 0x13, 0x5D, 0xA5, 0x6B, 0xF5, 0xA5, 0x8B, 0xC5, 0xA6,
+    0x2B, 0xEE, 0xA7, 0x4B, 0x86, 0xA9, 0x6B, 0x92, 0xAA, 0x4B, 0xA0, 0xD6, 0x21, 0x51, 0x49, 0x17,
+    0x10, 0x1B, 0x52, 0x28, 0x06, 0x00, 0x62, 0x44, 0x0A, 0xC5, 0x00, 0xF2, 0x00, 0x9C, 0x19, 0xC0,
+    0x32, 0x3D, 0x31, 0x21, 0x0E, 0x03, 0x04, 0x44, 0xE4, 0x50, 0xB2, 0x22, 0x18, 0xC4, 0x0E, 0x40,
+    0x30, 0x01, 0x15, 0x99, 0x90, 0xEF, 0xC4, 0x4C, 0x78, 0x32, 0x18, 0x07, 0x00, 0x8D, 0x40, 0x22,
+    0xC4, 0x29, 0x44, 0x05, 0x70, 0x48, 0xDF, 0xD5, 0x15, 0xA1, 0x83, 0xD9, 0x1B, 0x06, 0x11, 0xD2,
+    0x98, 0x0A, 0x33, 0x98, 0x11, 0xC4, 0x01, 0x0A, 0x4E, 0xC0, 0xA5, 0x81, 0x43, 0x29, 0xBD, 0x2E,
+    0x42, 0x92, 0x10, 0xA7, 0x55, 0x9C, 0x70, 0x8E, 0x40, 0x04, 0x1C, 0xCE, 0x1D, 0x76, 0x49, 0x84,
+    0x24, 0x11, 0xA3, 0x22, 0x9C, 0x13, 0x16, 0x38, 0x8C, 0xDE, 0xEC, 0x02, 0x87, 0xAD, 0x94, 0x5D,
+    0xE2, 0x00, 0x58, 0xE3, 0x81, 0xB0, 0x10, 0x32, 0x42, 0xA5, 0x70, 0x00, 0x7A, 0x20, 0x38, 0x38,
+    0xF0, 0x28, 0x62, 0xE2, 0x35, 0x0D, 0xEA, 0x45, 0x55, 0xEB, 0x05, 0xC8, 0x43, 0x79, 0xF7, 0x2E,
+    0xC4, 0x69, 0x8F, 0x24, 0xDC, 0x5D, 0x92, 0xE3, 0x5D, 0x9A, 0xE9, 0x5D, 0xC0, 0x5A, 0xC4, 0x6D,
+    0xEE, 0xD2, 0xAC, 0xEE, 0x5A, 0x70, 0x88, 0x2A, 0x47, 0x20, 0x52, 0x52, 0x6A, 0xA0, 0x43, 0x95,
+    0x23, 0x10, 0x29, 0x29, 0x35, 0xD0, 0xA1, 0xCA, 0x11, 0x88, 0x94, 0x04, 0x8C, 0x0C, 0x55, 0x8E,
+    0x40, 0x24, 0x2C, 0x50, 0xA1, 0xCA, 0x11, 0x88, 0x1C, 0x50, 0xA1, 0xCA, 0x11, 0x88, 0x00, 0x88,
+    0xD3, 0x1E, 0xC9, 0x26, 0xBC, 0xA4, 0x35, 0xBC, 0xB4, 0x41, 0xBC, 0x80, 0xB5, 0x88, 0x5D, 0xDC,
+    0xA5, 0xCD, 0xE0, 0xB5, 0xE0, 0x12, 0x55, 0x8E, 0x40, 0xA4, 0xA4, 0xD4, 0x40, 0x88, 0x2A, 0x47,
+    0x20, 0x52, 0x12, 0x30, 0x3A, 0x54, 0x39, 0x02, 0x91, 0xB0, 0x40, 0x86, 0x2A, 0x47, 0x20, 0x72,
+    0x40, 0x86, 0x2A, 0x47, 0x20, 0x02, 0x16, 0xDD, 0xEC, 0xBC, 0xA8, 0xF5, 0xBC, 0xC0, 0xA2, 0x5C,
+    0x8E, 0xD7, 0xA4, 0x9A, 0x17, 0x3A, 0x90, 0x80, 0x2B, 0x21, 0x21, 0x4E, 0x7B, 0x24, 0x07, 0xF3,
+    0x92, 0x33, 0xF3, 0xD2, 0xA6, 0x7D, 0x00, 0xD6, 0x22, 0x8E, 0x95, 0x97, 0x0E, 0x97, 0xD7, 0x82,
+    0x3B, 0x04, 0x22, 0x25, 0xA5, 0x06, 0x32, 0x04, 0x22, 0x25, 0xA5, 0x06, 0x32, 0x04, 0x22, 0x25,
+    0x01, 0xA3, 0x42, 0x20, 0x12, 0x16, 0x88, 0x10, 0x88, 0x1C, 0x00, 0x71, 0x1A, 0x60, 0x59, 0x70,
+    0xC7, 0x11, 0x88, 0x94, 0x94, 0x1A, 0x40, 0xC5, 0x04, 0x66, 0x80, 0xF8, 0x48, 0xD2, 0xE8, 0x85,
+    0x42, 0xE9, 0x15, 0x9D, 0xE9, 0x05, 0x34, 0x02, 0x69, 0x30, 0x81, 0xA8, 0x00, 0x16, 0x06, 0xDF,
+    0x30, 0xDA, 0x0D, 0xBD, 0x34, 0x26, 0xC1, 0x08, 0xE2, 0xC0, 0x02, 0x70, 0x33, 0x81, 0x56, 0xEE,
+    0x01, 0xE7, 0x20, 0x86, 0x78, 0xE8, 0xE8, 0xEA, 0x05, 0x2A, 0x0A, 0x0C, 0xCB, 0x14, 0xA0, 0x65,
+    0x14, 0x18, 0x96, 0x41, 0x04, 0x1C, 0xC6, 0x13, 0x7B, 0x35, 0x53, 0x84, 0x10, 0x32, 0x44, 0x21,
+    0x46, 0x86, 0x11, 0xE1, 0x00, 0x71, 0x91, 0xC4, 0xDA, 0x4B, 0x07, 0xDC, 0x0B, 0x68, 0x04, 0x92,
+    0xA1, 0x98, 0x31, 0x81, 0xA8, 0x00, 0x0E, 0x1B, 0x9C, 0xBD, 0x46, 0x84, 0x62, 0xC6, 0x84, 0x05,
+    0x1A, 0x14, 0x33, 0xE0, 0x70, 0x62, 0xE4, 0xAB, 0x3C, 0x92, 0x15, 0x7C, 0xA1, 0x25, 0x7C, 0x45,
+    0x2A, 0x52, 0x88, 0x43, 0x34, 0x7E, 0x2F, 0x22, 0x26, 0x08, 0x15, 0x0C, 0x00, 0x2C, 0x0B, 0xAE,
+    0x10, 0x4A, 0x94, 0x94, 0x1A, 0x38, 0x88, 0x8C, 0x18, 0x20, 0x0E, 0x51, 0xD8, 0x08, 0x80, 0xF5,
+    0xB8, 0xA4, 0x6C, 0x83, 0xE5, 0xF1, 0xA5, 0x57, 0x6F, 0x23, 0x13, 0x44, 0x49, 0x07, 0x24, 0x88,
+    0x92, 0x52, 0x03, 0x88, 0x66, 0x1D, 0x60, 0xE5, 0x1E, 0x40, 0x1A, 0x13, 0xE1, 0x90, 0x20, 0x0E,
+    0x3C, 0x2E, 0x1A, 0x7D, 0xB5, 0xF1, 0x30, 0xC5, 0x3B, 0x7D, 0xA1, 0x43, 0x99, 0x89, 0x8F, 0xB9,
+    0x40, 0x44, 0x38, 0x80, 0x94, 0xF2, 0x81, 0x98, 0x26, 0x12, 0x11, 0x52, 0x18, 0x23, 0x00, 0xA4,
+    0xE1, 0x21, 0x13, 0xC0, 0xA4, 0xB3, 0xDE, 0xD7, 0xB3, 0xE4, 0x57, 0x44, 0x04, 0xD8, 0xDC, 0x09,
+    0x18, 0x39, 0x8C, 0x63, 0xFB, 0x6A, 0x08, 0x49, 0x26, 0x90, 0x70, 0x0E, 0x00, 0x0E, 0xA3, 0xED,
+    0xBE, 0x9C, 0x29, 0x26, 0x0C, 0x64, 0xC0, 0x81, 0xA3, 0xDC, 0xD7, 0xA1, 0xCC, 0xE2, 0x57, 0x34,
+    0x51, 0x0D, 0x32, 0xE1, 0x8E, 0x88, 0xCC, 0x60, 0x44, 0x8C, 0x06, 0x20, 0x13, 0x89, 0x88, 0xE8,
+    0x88, 0x11, 0xC0, 0x24, 0x09, 0xEA, 0x17, 0x5A, 0xF0, 0x97, 0x4B, 0xF2, 0x57, 0x4C, 0x01, 0x18,
+    0x20, 0x21, 0x13, 0x89, 0x40, 0x47, 0x8C, 0x00, 0x0E, 0xE3, 0x64, 0xBF, 0x9A, 0x05, 0x47, 0x04,
+    0x92, 0x1A, 0x38, 0x04, 0x53, 0x0D, 0x98, 0xA8, 0x06, 0x99, 0x70, 0x48, 0x30, 0x83, 0x11, 0x31,
+    0x1A, 0xD0, 0x20, 0x4E, 0xAB, 0x10, 0x44, 0x20, 0x02, 0x16, 0xE5, 0xB7, 0xBF, 0xA6, 0xDD, 0xBF,
+    0xDA, 0x21, 0x18, 0x70, 0x82, 0xD3, 0x10, 0xCD, 0x8C, 0x08, 0x64, 0x80, 0x45, 0x80, 0x76, 0x10,
+    0xB9, 0x0E, 0x00, 0x64, 0x1E, 0x6A, 0xAA, 0x4F, 0x20, 0x13, 0xE2, 0xB4, 0x06, 0x44, 0x00, 0xAA,
+    0x41, 0xE6, 0x21, 0xCE, 0xFF, 0x17, 0x42, 0xC8, 0x0E, 0x33, 0x18, 0x11, 0x43, 0x84, 0x03, 0x2A,
+    0xCC, 0x60, 0x44, 0x8C, 0x06, 0x38, 0x13, 0xD5, 0x20, 0x13, 0xEE, 0x40, 0x66, 0x30, 0x22, 0x46,
+    0x03, 0x08, 0x49, 0x42, 0x87, 0x15, 0x20, 0x60, 0x4E, 0xCB, 0x88, 0x26, 0x9C, 0x23, 0x10, 0x01,
+    0x48, 0x46, 0x34, 0xE1, 0x1C, 0x31, 0x03, 0x58, 0x64, 0x56, 0x03, 0x73, 0xC5, 0x03, 0x3B, 0xC0,
+    0x21, 0xF3, 0x16, 0xD8, 0xC2, 0x0E, 0x5D, 0x82, 0xC0, 0x10, 0x91, 0x01, 0x07, 0x2C, 0xE9, 0x09,
+    0x05, 0x2C, 0x8E, 0x39, 0xC4, 0x9A, 0x02, 0x43, 0xA4, 0xD9, 0x02, 0x07, 0x2C, 0xE9, 0xA1, 0x84,
+    0x9C, 0x38, 0x03, 0x94, 0xC0, 0x01, 0x4B, 0x7A, 0x28, 0x21, 0xD7, 0x00, 0x67, 0x71, 0x0C, 0x44,
+    0x9A, 0x29, 0x70, 0xC0, 0x92, 0x1E, 0x4A, 0xC8, 0x89, 0x33, 0x00, 0x24, 0x03, 0x26, 0xC4, 0x69,
+    0x64, 0x88, 0x78, 0x22, 0x97, 0x21, 0x10, 0x39, 0x00, 0x83, 0x48, 0x2C, 0x42, 0x3C, 0x71, 0x1E,
+    0x38, 0x44, 0x95, 0x06, 0x33, 0x87, 0x48, 0xA7, 0x60, 0xE0, 0xB0, 0x5D, 0x13, 0x0C, 0x69, 0x90,
+    0x0C, 0x98, 0x10, 0xA7, 0x85, 0x10, 0x91, 0xCB, 0x10, 0x88, 0x00, 0x68, 0x91, 0x2D, 0x4C, 0x21,
+    0x6B, 0x14, 0x4C, 0x1E, 0x4C, 0x90, 0x2C, 0x69, 0x8B, 0xC8, 0xB5, 0x60, 0x3A, 0xCA, 0x60, 0xC0,
+    0x8A, 0x10, 0x4E, 0x90, 0x92, 0x80, 0x7C, 0x48, 0x56, 0x0C, 0x06, 0x4C, 0x88, 0xD3, 0x42, 0x0A,
+    0x11, 0xB9, 0x0C, 0x81, 0x08, 0x88, 0x28, 0x44, 0x9C, 0x00, 0x1A, 0x84, 0x13, 0xC4, 0x52, 0x64,
+    0x5C, 0x21, 0xE0, 0xD0, 0x64, 0x1C, 0x6C, 0x40, 0x1A, 0x20, 0x42, 0x16, 0x1C, 0xB2, 0x04, 0x29,
+    0x46, 0xA4, 0x06, 0x16, 0x51, 0xE6, 0xC1, 0x1A, 0x1B, 0xC2, 0x80, 0x06, 0x58, 0x70, 0x84, 0x20,
+    0x25, 0xA5, 0x06, 0x0E, 0x9D, 0x0F, 0xC2, 0xDA, 0x22, 0x22, 0x5F, 0x45, 0x7B, 0x3F, 0x12, 0xB0,
+    0x0E, 0x31, 0xF6, 0x03, 0x16, 0x1D, 0xD0, 0x80, 0x06, 0x58, 0x0D, 0xA4, 0x24, 0x70, 0x88, 0x70,
+    0x11, 0x06, 0xAC, 0x04, 0x41, 0x4A, 0x02, 0x80, 0x65, 0xC1, 0x15, 0x82, 0x94, 0x94, 0x1A, 0x70,
+    0x10, 0x91, 0xE5, 0x44, 0xC3, 0x82, 0x13, 0xD2, 0x4A, 0x0D, 0x4C, 0x92, 0x0E, 0x85, 0xBD, 0x2A,
+    0x85, 0x49, 0x67, 0x85, 0x4D, 0x99, 0x85, 0x05, 0x0B, 0x22, 0x1D, 0x44, 0x0C, 0x89, 0x4C, 0x26,
+    0x71, 0x60, 0x30, 0x40, 0x15, 0x91, 0x88, 0xC0, 0xA6, 0x09, 0xE0, 0x90, 0x9E, 0x2A, 0x6C, 0xA2,
+    0x66, 0xC3, 0x88, 0x6C, 0x00, 0x33, 0x61, 0x44, 0x36, 0x80, 0x09, 0x68, 0x06, 0xA4, 0x31, 0x1D,
+    0xE3, 0x8C, 0x42, 0x96, 0x20, 0x0E, 0x88, 0xC0, 0x81, 0x71, 0xE2, 0xD0, 0x61, 0xD5, 0x68, 0x18,
+    0x11, 0x1F, 0xE5, 0x02, 0xC3, 0x66, 0x0C, 0x01, 0x2C, 0x17, 0xC3, 0x90, 0x81, 0x24, 0x18, 0xB1,
+    0x02, 0x70, 0x00, 0xC3, 0xE0, 0x58, 0xC4, 0x88, 0x40, 0x37, 0x2C, 0x70, 0x78, 0x9E, 0x19, 0x46,
+    0x2C, 0x0C, 0xD2, 0x98, 0x0A, 0x18, 0xD2, 0x13, 0xC4, 0x01, 0xC4, 0x82, 0x30, 0x48, 0x63, 0x22,
+    0x9E, 0x20, 0x0E, 0x20, 0x22, 0x64, 0x20, 0x15, 0xC1, 0x18, 0xB1, 0x02, 0x40, 0x0F, 0x97, 0x6E,
+    0xC3, 0x86, 0x15, 0x71, 0x11, 0x4B, 0x0B, 0x1C, 0x0C, 0xCA, 0x86, 0x41, 0x8B, 0xE3, 0x27, 0x1D,
+    0x4C, 0xC9, 0x61, 0x06, 0xD1, 0x1A, 0x9A, 0x0B, 0x04, 0x70, 0x22, 0xA7, 0x55, 0xB4, 0x87, 0x0C,
+    0x22, 0xE0, 0x74, 0x81, 0x3F, 0x8C, 0x85, 0x49, 0xAC, 0xC5, 0x4B, 0xEC, 0xB1, 0x4C, 0x2C, 0x56,
+    0x4D, 0x4C, 0xB2, 0x6A, 0x6C, 0xB2, 0x6F, 0xAC, 0xD2, 0x74, 0x0C, 0x83, 0x75, 0x0C, 0x1D, 0x0E,
+    0xDE, 0x52, 0x4C, 0x08, 0xD1, 0x08, 0x24, 0x63, 0x88, 0x40, 0x54, 0x00, 0x8F, 0x84, 0x10, 0x62,
+    0x88, 0x14, 0x62, 0xCB, 0x45, 0x62, 0x02, 0x69, 0x48, 0x45, 0x05, 0x4B, 0x63, 0x49, 0x45, 0x05,
+    0x70, 0xE0, 0x2A, 0xBA, 0x75, 0x28, 0x9B, 0x22, 0x06, 0x30, 0x44, 0x33, 0x01, 0x11, 0x02, 0xB4,
+    0x16, 0x93, 0x44, 0x79, 0x81, 0x8C, 0x62, 0x44, 0x21, 0xC0, 0x84, 0x0E, 0x1B, 0x74, 0xC4, 0x80,
+    0x16, 0xF2, 0xA1, 0x4A, 0x0A, 0x67, 0x08, 0x22, 0x0A, 0x01, 0x10, 0xA0, 0xA5, 0x7C, 0xA8, 0x92,
+    0xC2, 0x19, 0x82, 0x88, 0x42, 0x00, 0x62, 0x22, 0x0D, 0x61, 0x8C, 0x00, 0x0E, 0x9F, 0xAF, 0xC4,
+    0x8A, 0x85, 0x98, 0x0D, 0x11, 0xA6, 0x30, 0x80, 0x85, 0x98, 0x09, 0x30, 0x85, 0x01, 0x4C, 0x0E,
+    0x83, 0x34, 0xA4, 0xE0, 0x05, 0x00, 0x20, 0x62, 0x42, 0x30, 0x60, 0x93, 0x38, 0x58, 0x0C, 0x5D,
+    0x59, 0x6C, 0x35, 0x5C, 0x2C, 0x46, 0x5D, 0x6C, 0xAA, 0x64, 0x0C, 0x57, 0x6A, 0x0C, 0x2C, 0x36,
+    0xB0, 0x8A, 0xBD, 0xDC, 0x8A, 0xAD, 0xC3, 0x05, 0x54, 0x31, 0x62, 0x2D, 0x62, 0x7F, 0x8A, 0x69,
+    0x92, 0x8A, 0xAD, 0x43, 0x2D, 0x4E, 0x31, 0xDC, 0x90, 0x42, 0x4A, 0x0D, 0x34, 0xA4, 0x90, 0x40,
+    0x42, 0x0A, 0x29, 0x35, 0x90, 0x90, 0x42, 0x02, 0x07, 0x84, 0xF9, 0x01, 0xA6, 0x83, 0x90, 0x10,
+    0xD9, 0x11, 0xC8, 0x80, 0xE1, 0x88, 0x03, 0x1C, 0x44, 0x03, 0x2C, 0x08, 0x88, 0x30, 0xA4, 0x24,
+    0x51, 0x80, 0x65, 0x21, 0x16, 0x59, 0x51, 0x52, 0x0A, 0xE9, 0x80, 0xC3, 0xF9, 0x6B, 0x31, 0x09,
+    0x99, 0x10, 0x51, 0x51, 0x8E, 0x18, 0x42, 0x01, 0x94, 0xB0, 0x00, 0x31, 0x63, 0x08, 0xC5, 0x52,
+    0x31, 0x00, 0xC2, 0x10, 0xCD, 0x6C, 0x28, 0x2F, 0x90, 0x01, 0x80, 0xC3, 0xF5, 0x7B, 0x31, 0x85,
+    0x20, 0x26, 0x99, 0x51, 0x70, 0x08, 0xE3, 0x80, 0xC3, 0x05, 0x81, 0x31, 0x62, 0x45, 0x94, 0x94,
+    0x42, 0x02, 0x88, 0xB5, 0x88, 0xA9, 0x31, 0xA6, 0x09, 0x32, 0xB6, 0x0E, 0xB5, 0x2B, 0xC6, 0x70,
+    0x47, 0x49, 0x29, 0xA4, 0xD4, 0x40, 0x47, 0x49, 0x29, 0x24, 0x90, 0x51, 0x52, 0x0A, 0x29, 0x35,
+    0x90, 0x51, 0x52, 0x0A, 0x09, 0x1C, 0xBA, 0x82, 0x4F, 0xA0, 0x43, 0xC0, 0xFC, 0x00, 0x81, 0x1E,
+    0xAE, 0x28, 0x8D, 0x81, 0xC3, 0x18, 0xA3, 0xB1, 0x75, 0x18, 0x2B, 0x34, 0xB6, 0xE0, 0x86, 0x54,
+    0x4C, 0x6A, 0x20, 0x21, 0x15, 0x03, 0x0E, 0x56, 0x7A, 0xC6, 0x00, 0x71, 0x01, 0xF1, 0x11, 0x01,
+    0x63, 0x3F, 0x20, 0x60, 0x34, 0xB0, 0x28, 0x59, 0x36, 0x36, 0xCD, 0x36, 0x46, 0x34, 0x06, 0x11,
+    0x23, 0x4E, 0x20, 0x2E, 0x18, 0x80, 0x88, 0x02, 0x4C, 0x26, 0x1C, 0xD9, 0xC0, 0x21, 0xCD, 0xDD,
+    0xD8, 0x84, 0x30, 0xA4, 0x41, 0xBC, 0x00, 0x44, 0xC0, 0x6A, 0x40, 0xA6, 0x24, 0xB0, 0x38, 0xF9,
+    0x38, 0x46, 0x0F, 0x3A, 0x86, 0x08, 0xD4, 0x02, 0xC4, 0x0C, 0x33, 0x84, 0x62, 0xA9, 0x18, 0x70,
+    0x48, 0xBF, 0x39, 0x46, 0x34, 0x13, 0x31, 0x2A, 0x02, 0x19, 0x61, 0x01, 0x51, 0x4B, 0x08, 0x86,
+    0x00, 0x51, 0x4B, 0x18, 0xC1, 0x10, 0x00, 0x59, 0x07, 0x2B, 0x11, 0x22, 0x87, 0x4C, 0xB4, 0x63,
+    0xC4, 0x48, 0x10, 0x0B, 0x20, 0x07, 0x93, 0xCC, 0x23, 0x87, 0x14, 0xC8, 0x63, 0x0B, 0x22, 0x1D,
+    0x44, 0xCC, 0x60, 0x32, 0x89, 0x03, 0x83, 0x01, 0x16, 0x44, 0x3A, 0x88, 0xD8, 0xC1, 0x64, 0x12,
+    0x07, 0x06, 0x03, 0x20, 0x13, 0x15, 0x91, 0x0A, 0xA1, 0x06, 0x33, 0x01, 0x8C, 0x8A, 0x53, 0x90,
+    0x8D, 0x6F, 0x90, 0x95, 0x8E, 0x90, 0xB5, 0xB5, 0x90, 0xB9, 0xCF, 0x91, 0x45, 0x2B, 0x92, 0x49,
+    0xA5, 0x98, 0x4D, 0xB5, 0x98, 0x81, 0x45, 0x73, 0x03, 0xB2, 0xA7, 0x07, 0x32, 0x81, 0x28, 0xA8,
+    0x05, 0x68, 0x46, 0x02, 0x2D, 0x64, 0x01, 0x04, 0xD0, 0xCC, 0x8C, 0xE2, 0x42, 0x21, 0x03, 0x58,
+    0x48, 0x03, 0x8A, 0x29, 0x00, 0xD4, 0x42, 0xC5, 0x03, 0xD2, 0xB5, 0x1D, 0x84, 0x34, 0x45, 0xE0,
+    0x00, 0xA1, 0x0E, 0x82, 0x13, 0x31, 0xC4, 0xA8, 0x30, 0x15, 0x99, 0x17, 0x16, 0x98, 0x24, 0x06,
+    0x22, 0x43, 0x4F, 0x22, 0x6B, 0x8D, 0x22, 0x93, 0x38, 0x23, 0x03, 0xA6, 0x05, 0x27, 0xA4, 0xD1,
+    0x80, 0x08, 0x98, 0x9C, 0x18, 0x31, 0x4C, 0x19, 0xC8, 0x00, 0x12, 0xB5, 0x80, 0x06, 0x72, 0x58,
+    0x2A, 0x00, 0x3A, 0x94, 0xFB, 0x22, 0x6B, 0x24, 0x6A, 0x01, 0x19, 0x82, 0x1C, 0x96, 0x0A, 0x40,
+    0x2D, 0xA0, 0x42, 0x90, 0xC3, 0x52, 0x01, 0x87, 0xAB, 0x6F, 0x64, 0xE8, 0xA0, 0xED, 0x8B, 0x0C,
+    0x49, 0x50, 0x22, 0x81, 0xC5, 0x47, 0x40, 0xB2, 0x49, 0x42, 0xB2, 0xE5, 0x21, 0x09, 0x31, 0x05,
+    0x70, 0x40, 0xAC, 0xF1, 0x20, 0xC2, 0x11, 0x28, 0x0C, 0xD3, 0xC0, 0xAB, 0xE8, 0x2C, 0x19, 0x59,
+    0x33, 0x59, 0xE9, 0x3B, 0xD9, 0x31, 0x45, 0x19, 0xE2, 0x4A, 0x59, 0xA2, 0x50, 0x19, 0x03, 0x56,
+    0x99, 0x03, 0x5D, 0xD9, 0x2B, 0x66, 0x99, 0xBC, 0x6E, 0xD9, 0x84, 0x87, 0x19, 0x30, 0x90, 0x88,
+    0x62, 0xCA, 0x0A, 0xE0, 0x10, 0x15, 0x99, 0x8C, 0x1C, 0xBE, 0x12, 0x93, 0x35, 0x73, 0xC1, 0x15,
+    0x7C, 0x62, 0x62, 0x4D, 0xE0, 0x60, 0xD2, 0x54, 0x05, 0x39, 0xA8, 0x9D, 0x46, 0x59, 0x6C, 0xE1,
+    0x26, 0x9B, 0x2A, 0x27, 0x33, 0x28, 0xA4, 0x21, 0x0D, 0x46, 0x90, 0x00, 0x20, 0xC0, 0xB2, 0xE0,
+    0x08, 0x22, 0x4A, 0x4A, 0x0D, 0x88, 0x80, 0xC9, 0x89, 0x19, 0x31, 0x0C, 0x53, 0x06, 0x32, 0x80,
+    0x3B, 0x8C, 0x31, 0x28, 0x63, 0x87, 0x44, 0x01, 0x65, 0x40, 0x23, 0x90, 0x08, 0xF3, 0x0A, 0x51,
+    0x01, 0x88, 0x09, 0xE6, 0x05, 0x03, 0x30, 0xE4, 0xB0, 0x05, 0x39, 0x40, 0x06, 0x2C, 0x4B, 0x63,
+    0x30, 0x15, 0x99, 0x77, 0xC0, 0x22, 0x31, 0x48, 0xD9, 0xA3, 0x49, 0x19, 0x20, 0xBD, 0x82, 0x78,
+    0x00, 0xE0, 0x91, 0x0D, 0x25, 0x1E, 0x00, 0x90, 0x09, 0x25, 0x1E, 0x70, 0x28, 0x99, 0x53, 0xF6,
+    0x00, 0xD3, 0x41, 0x4C, 0x88, 0x88, 0x08, 0x43, 0x28, 0x60, 0x22, 0x9A, 0x59, 0x71, 0xC4, 0x19,
+    0x81, 0x0C, 0x70, 0xE8, 0xBE, 0x54, 0x46, 0xC4, 0x03, 0x2C, 0x57, 0x0D, 0x11, 0x30, 0x21, 0x15,
+    0x09, 0xF9, 0x6A, 0xC8, 0x94, 0x21, 0x66, 0x00, 0x8B, 0xA4, 0x63, 0x65, 0x68, 0x6B, 0x65, 0xE0,
+    0xA0, 0xF5, 0x37, 0x41, 0x03, 0x34, 0x33, 0xA2, 0x90, 0x40, 0x06, 0x38, 0x94, 0x47, 0xDE, 0x69,
+    0x07, 0x24, 0x65, 0x65, 0x8B, 0x4D, 0x87, 0x65, 0x92, 0x8D, 0x65, 0x06, 0x30, 0x21, 0x15, 0x09,
+    0x31, 0xC1, 0x20, 0x57, 0x86, 0x98, 0x01, 0x00, 0x56, 0xC3, 0x41, 0xA4, 0x24, 0xA0, 0x01, 0x16,
+    0x64, 0xC2, 0x1D, 0x07, 0x91, 0x92, 0xC4, 0x68, 0x60, 0xF1, 0x00, 0xB5, 0x0C, 0xB5, 0xB5, 0x8C,
+    0x88, 0xA6, 0x08, 0x98, 0x07, 0x64, 0xE4, 0x4A, 0x00, 0xD9, 0x00, 0x4B, 0x3C, 0x40, 0x33, 0x20,
+    0x02, 0xB5, 0x00, 0x31, 0x24, 0x90, 0x25, 0x14, 0x4B, 0xC5, 0x80, 0x49, 0x22, 0xEB, 0x32, 0x84,
+    0xED, 0x32, 0x47, 0xF0, 0x32, 0xAA, 0xFD, 0x32, 0x21, 0x42, 0x9E, 0x09, 0x71, 0x5A, 0x8A, 0x09,
+    0x47, 0x19, 0x11, 0x87, 0x40, 0x04, 0xA8, 0x07, 0x64, 0x9F, 0x46, 0xA4, 0x79, 0x00, 0x94, 0xD9,
+    0xA2, 0x2D, 0x92, 0xB9, 0x97, 0x35, 0xDD, 0x97, 0x01, 0x0B, 0x3E, 0x58, 0x8B, 0x1D, 0xB0, 0x0E,
+    0xB5, 0xE7, 0xCB, 0x56, 0x02, 0x09, 0x09, 0x1C, 0x10, 0xEF, 0x48, 0x2D, 0x12, 0x22, 0x98, 0x21,
+    0x35, 0x98, 0x0D, 0xC4, 0x48, 0x28, 0x2B, 0x2C, 0x10, 0xC1, 0xCC, 0x61, 0x01, 0x1C, 0xCE, 0x62,
+    0x98, 0x35, 0x26, 0x83, 0x99, 0xC3, 0x04, 0x71, 0xA0, 0x82, 0x99, 0xC3, 0xC4, 0x00, 0xA8, 0x00,
+    0x98, 0x10, 0xA7, 0x55, 0x18, 0x59, 0x86, 0x40, 0x04, 0x1C, 0x48, 0xDF, 0x29, 0x20, 0x26, 0xC4,
+    0x69, 0x11, 0x62, 0x08, 0x44, 0xC0, 0x24, 0x59, 0x93, 0x19, 0xCA, 0xA0, 0x99, 0xBB, 0xB5, 0x19,
+    0x26, 0xBC, 0x19, 0x10, 0x39, 0xC0, 0xC9, 0xF8, 0x50, 0xB0, 0x98, 0x82, 0x20, 0xD0, 0xB8, 0xC3,
+    0x06, 0x3E, 0x33, 0x76, 0xE8, 0xB6, 0x66, 0x46, 0x34, 0xEE, 0x90, 0xD1, 0x73, 0xA0, 0x1D, 0x2E,
+    0x9A, 0x99, 0x01, 0xAB, 0xA1, 0x24, 0x00, 0x37, 0x94, 0x94, 0x1A, 0xD0, 0x0E, 0x5D, 0xEE, 0xCC,
+    0x88, 0xC6, 0x69, 0x15, 0x81, 0x20, 0x02, 0xB4, 0x86, 0x40, 0x10, 0x01, 0x18, 0xA2, 0x01, 0x11,
+    0x2F, 0x90, 0x02, 0xAC, 0xC5, 0xE5, 0x55, 0x33, 0x47, 0x5E, 0x33, 0x44, 0x72, 0x9E, 0xB3, 0x88,
+    0xCE, 0x69, 0x86, 0x67, 0x6A, 0x46, 0xC4, 0x0C, 0x74, 0x50, 0x84, 0xC1, 0x00, 0x02, 0xB0, 0x42,
+    0xD0, 0x41, 0x11, 0x0A, 0x55, 0x12, 0xA8, 0x40, 0x07, 0x45, 0xD8, 0x00, 0x47, 0x72, 0x9E, 0x03,
+    0x11, 0x80, 0x65, 0xC1, 0x2D, 0xE8, 0xA0, 0x08, 0x85, 0x2A, 0x29, 0x35, 0x40, 0x7A, 0xCE, 0x22,
+    0xFA, 0xB2, 0x19, 0xB6, 0xB4, 0x19, 0x11, 0x1B, 0x50, 0x84, 0xC1, 0x00, 0x84, 0x8C, 0x40, 0x11,
+    0x8A, 0x70, 0x40, 0x02, 0x8A, 0xB0, 0x01, 0xED, 0xD0, 0x04, 0xDD, 0x8C, 0x10, 0x10, 0xA0, 0x85,
+    0x7C, 0x28, 0x88, 0x02, 0x09, 0x4A, 0x14, 0x02, 0x44, 0xC0, 0x73, 0x22, 0x90, 0x33, 0x25, 0x42,
+    0x70, 0x28, 0xE3, 0x13, 0xB4, 0x38, 0x92, 0xF3, 0x1C, 0x88, 0x00, 0xAC, 0x14, 0x91, 0xD0, 0x41,
+    0x11, 0x0A, 0x55, 0x12, 0x58, 0x0C, 0x40, 0x1E, 0x6B, 0x98, 0x38, 0x5B, 0x8C, 0x08, 0x61, 0x07,
+    0x2C, 0x57, 0x28, 0x8B, 0x0D, 0x23, 0x67, 0x0E, 0x27, 0x67, 0xC0, 0xF3, 0x2C, 0x24, 0x22, 0x94,
+    0x18, 0x53, 0x00, 0x07, 0x60, 0x1B, 0x67, 0x1A, 0x82, 0x88, 0x15, 0x88, 0x84, 0x60, 0xC0, 0x21,
+    0x49, 0xE3, 0x19, 0xB8, 0x34, 0x63, 0x3A, 0x6B, 0x0E, 0x3B, 0x9B, 0xAA, 0x3B, 0xA3, 0x47, 0xDE,
+    0xC1, 0xCD, 0x3B, 0x23, 0x24, 0xA0, 0x99, 0x15, 0xA1, 0x9C, 0x42, 0x06, 0x38, 0x24, 0xCB, 0x3A,
+    0x03, 0x22, 0x44, 0x62, 0x11, 0xA2, 0x18, 0x71, 0x1E, 0x10, 0x21, 0x19, 0x89, 0x10, 0xC5, 0x88,
+    0x1C, 0xC0, 0x22, 0xF8, 0xA4, 0xC0, 0x6C, 0xDB, 0x19, 0x31, 0x0A, 0x48, 0x58, 0x00, 0x52, 0x94,
+    0x08, 0x41, 0x86, 0xA8, 0x15, 0x20, 0x68, 0x40, 0x61, 0xE0, 0xD0, 0xD6, 0xF0, 0x2C, 0x42, 0x8C,
+    0x63, 0x46, 0x5C, 0x23, 0x1C, 0x1C, 0x40, 0x84, 0x4C, 0xA4, 0xC0, 0xC1, 0x01, 0x16, 0x83, 0x31,
+    0xCF, 0xA4, 0x42, 0xCF, 0xC0, 0x81, 0xFC, 0x49, 0x07, 0x44, 0x40, 0x26, 0xD2, 0x70, 0x94, 0x18,
+    0x01, 0x00, 0x9A, 0xD9, 0x50, 0x4E, 0x21, 0x03, 0xAC, 0xA2, 0x95, 0x9F, 0xAD, 0xD1, 0x9F, 0x31,
+    0x73, 0xA1, 0x3D, 0xCB, 0xA1, 0xC5, 0x82, 0xA2, 0xC9, 0xDC, 0xA3, 0x4D, 0xA2, 0xA5, 0xD1, 0x24,
+    0xA6, 0xD5, 0x56, 0xA6, 0x59, 0x7B, 0xA6, 0x91, 0x47, 0x17, 0xEC, 0xB3, 0x97, 0xEF, 0xB3, 0xC9,
+    0x67, 0x99, 0x06, 0x91, 0x11, 0x81, 0x88, 0x03, 0x3C, 0x0B, 0xA9, 0x08, 0x28, 0xA6, 0x00, 0x2C,
+    0x24, 0x22, 0xA0, 0x98, 0x02, 0x38, 0x9C, 0x70, 0x3F, 0x93, 0x07, 0xE8, 0x65, 0x02, 0x1A, 0x22,
+    0x36, 0x90, 0x11, 0x0C, 0x78, 0x9C, 0xE1, 0x40, 0xA3, 0x0D, 0x41, 0xC3, 0xE0, 0x41, 0x43, 0x8B,
+    0xED, 0x0C, 0x68, 0xF3, 0x15, 0x68, 0x02, 0xB0, 0x12, 0x86, 0x50, 0x25, 0x01, 0xC0, 0xE4, 0xC4,
+    0x8A, 0x24, 0x48, 0x19, 0xC8, 0x00, 0x88, 0x00, 0x0E, 0x9A, 0x84, 0xA3, 0x20, 0xE2, 0x00, 0xC4,
+    0xEB, 0xC4, 0x3C, 0x44, 0x59, 0x41, 0x23, 0x09, 0x89, 0x8D, 0x00, 0x0E, 0xDD, 0x6B, 0xD0, 0x1A,
+    0x13, 0x91, 0xD8, 0x10, 0xC4, 0x01, 0x2D, 0x22, 0xB1, 0x21, 0x10, 0x01, 0x87, 0x12, 0x48, 0x68,
+    0xCF, 0xE1, 0x34, 0x18, 0x22, 0x12, 0x84, 0x02, 0x00, 0x41, 0x1C, 0x1E, 0x5D, 0xA1, 0x01, 0x11,
+    0x32, 0x90, 0x08, 0x58, 0x8C, 0x58, 0x01, 0x00, 0xE2, 0x01, 0xBA, 0x69, 0xCF, 0xA1, 0x4B, 0x1A,
+    0x1A, 0x61, 0x44, 0x40, 0x83, 0x0E, 0x26, 0x2E, 0x30, 0x4C, 0x88, 0xD3, 0x32, 0x0C, 0x7A, 0x68,
+    0x08, 0x44, 0xC0, 0x21, 0xE5, 0x24, 0x9A, 0x3B, 0xA4, 0x48, 0x44, 0x8B, 0x26, 0xC4, 0x69, 0x80,
+    0x55, 0x62, 0x50, 0x44, 0x66, 0x08, 0x44, 0x4A, 0x02, 0x16, 0x60, 0x42, 0x9C, 0xD6, 0xC1, 0x52,
+    0x19, 0x02, 0x11, 0x60, 0x1D, 0x12, 0x7A, 0x67, 0x00, 0x71, 0x01, 0xF0, 0x87, 0x8A, 0xDC, 0x93,
+    0xE0, 0x51, 0x5E, 0x16, 0x6D, 0x56, 0x17, 0xAD, 0xF2, 0x1D, 0x2D, 0x58, 0x08, 0x56, 0x61, 0x90,
+    0x4C, 0xE1, 0x01, 0x67, 0x01, 0x58, 0x8E, 0xC1, 0x59, 0x8E, 0x61, 0x31, 0x42, 0x1A, 0x8D, 0xC2,
+    0x1A, 0x0D, 0x1C, 0x62, 0x2F, 0xA3, 0x21, 0x33, 0xC1, 0x14, 0x31, 0x00, 0x62, 0x34, 0x98, 0xD2,
+    0xC2, 0x02, 0x07, 0x40, 0xAF, 0x44, 0xCC, 0x21, 0x75, 0x39, 0x1A, 0x21, 0x91, 0x90, 0x0F, 0x85,
+    0xCC, 0x60, 0x8E, 0x85, 0x13, 0x00, 0x72, 0x28, 0xCF, 0x8D, 0x06, 0x48, 0x24, 0xE1, 0x04, 0x00,
+    0x19, 0x48, 0x85, 0x41, 0x53, 0xAC, 0x00, 0x1E, 0xD1, 0x0E, 0xD2, 0xE4, 0x1C, 0xD2, 0xE6, 0xA2,
+    0xD2, 0x08, 0x49, 0x26, 0x9C, 0x70, 0x0E, 0x58, 0x70, 0x23, 0x91, 0x9A, 0x9C, 0xE3, 0x58, 0x04,
+    0xBF, 0x79, 0x42, 0x4B, 0x49, 0x23, 0xE4, 0x22, 0x9A, 0x48, 0x9A, 0x2C, 0x27, 0x01, 0x39, 0x90,
+    0x2C, 0x12, 0x5A, 0x68, 0xBE, 0x24, 0x70, 0xA5, 0xF8, 0x38, 0x9C, 0x53, 0x4A, 0x0B, 0x87, 0xEB,
+    0x3A, 0x69, 0xC8, 0x3A, 0x9C, 0x25, 0x96, 0x21, 0x09, 0x29, 0x00, 0xE8, 0x70, 0xF6, 0x03, 0x64,
+    0x1D, 0x22, 0xEB, 0x21, 0x4D, 0x38, 0x42, 0x24, 0x31, 0x1A, 0x80, 0x38, 0xAD, 0x42, 0x0C, 0x81,
+    0x08, 0x38, 0x44, 0xF4, 0x4A, 0x3B, 0x1C, 0xC6, 0xA1, 0x64, 0x04, 0x7B, 0x88, 0x1D, 0xF0, 0xE0,
+    0x44, 0x4A, 0x30, 0xA7, 0x94, 0x56, 0xC7, 0xE6, 0xB4, 0x48, 0x42, 0x97, 0x16, 0x8F, 0x97, 0x06,
+    0x0E, 0xA6, 0x91, 0x66, 0xB4, 0x83, 0xD9, 0x55, 0x1E, 0xE0, 0x10, 0x8F, 0x30, 0x0D, 0x99, 0x11,
+    0x66, 0x98, 0x22, 0x06, 0x68, 0x30, 0xC3, 0x94, 0x06, 0x2C, 0xC0, 0x84, 0x38, 0x8D, 0xEC, 0x88,
+    0x2C, 0x95, 0x21, 0x10, 0x39, 0x00, 0x11, 0x15, 0xD4, 0xAA, 0xB8, 0xC1, 0x54, 0x96, 0x00, 0x72,
+    0x18, 0x9D, 0x9A, 0x56, 0x50, 0x2B, 0xC1, 0x54, 0x96, 0x80, 0x72, 0x40, 0xBD, 0x23, 0x85, 0x0A,
+    0x16, 0x44, 0x3A, 0x88, 0x18, 0xC2, 0x64, 0x12, 0x07, 0x06, 0x03, 0x1E, 0xC9, 0x15, 0xD4, 0x50,
+    0x8C, 0xD7, 0x5C, 0xDC, 0xD8, 0xC0, 0x24, 0x0A, 0x7D, 0x1A, 0x23, 0x7E, 0x5A, 0x94, 0x7F, 0xDA,
+    0xFC, 0x80, 0x9A, 0x30, 0xA1, 0x45, 0xE0, 0x5D, 0x19, 0x47, 0xF6, 0x34, 0xB1, 0x08, 0x98, 0x1F,
+    0xB0, 0xDE, 0x1F, 0x80, 0x38, 0x0D, 0x11, 0x2B, 0x86, 0x40, 0x24, 0x18, 0xA0, 0x21, 0x62, 0xC3,
+    0x10, 0x88, 0x04, 0x03, 0x44, 0x38, 0x40, 0x04, 0xC0, 0x00, 0x74, 0x83, 0x7B, 0x05, 0x40, 0x48,
+    0x82, 0x30, 0x22, 0x00, 0x88, 0x40, 0x1A, 0xD4, 0x10, 0x2A, 0x80, 0x5B, 0xC1, 0x1B, 0xB5, 0x71,
+    0x39, 0xB5, 0xA2, 0x50, 0x35, 0x33, 0x59, 0x35, 0x64, 0x60, 0xB5, 0x85, 0x63, 0x35, 0x36, 0x71,
+    0x35, 0xF7, 0x82, 0xB5, 0x47, 0x89, 0xB5, 0x78, 0x98, 0x35, 0xF9, 0x9B, 0xB5, 0x59, 0xCD, 0xB5,
+    0xEA, 0xD2, 0x35, 0x70, 0xC0, 0xA8, 0xFA, 0xB0, 0x88, 0x72, 0xA6, 0x46, 0xE3, 0xA6, 0x46, 0x16,
+    0x49, 0xA2, 0xD4, 0xDA, 0xB9, 0xD4, 0x06, 0x42, 0x92, 0x9C, 0xD8, 0xB1, 0x82, 0x0A, 0xE7, 0x20,
+    0x03, 0x8C, 0x43, 0x0D, 0x2D, 0x35, 0x99, 0xB0, 0xC2, 0x01, 0x09, 0x2B, 0x00, 0x13, 0x60, 0x90,
+    0x90, 0x60, 0x54, 0x20, 0xA3, 0xB8, 0x00, 0x16, 0x84, 0xEB, 0xB8, 0x64, 0xB6, 0x01, 0xC4, 0x03,
+    0x29, 0xC6, 0x8B, 0x45, 0xE4, 0x40, 0x35, 0x57, 0x4B, 0x35, 0x42, 0x20, 0x24, 0x27, 0x16, 0x1C,
+    0x64, 0x00, 0x71, 0x88, 0xEE, 0xA8, 0x06, 0x4C, 0xC1, 0x42, 0x22, 0x46, 0x91, 0x29, 0x00, 0x93,
+    0xD3, 0xC8, 0x88, 0x21, 0x10, 0x39, 0x00, 0x83, 0x00, 0xCD, 0xB4, 0xE0, 0x08, 0x52, 0x46, 0x48,
+    0x0D, 0x1C, 0xD2, 0xB6, 0xAA, 0x11, 0x51, 0x04, 0x04, 0xEB, 0x00, 0x7F, 0x98, 0x4B, 0x3C, 0x20,
+    0x3E, 0x13, 0x3B, 0x6C, 0x3F, 0xE9, 0x00, 0x1A, 0x01, 0x21, 0x64, 0x05, 0x29, 0x44, 0x89, 0x70,
+    0x00, 0x67, 0x44, 0x04, 0x23, 0xD0, 0x02, 0x87, 0xE8, 0xD3, 0x6A, 0x04, 0x20, 0x91, 0x0E, 0x13,
+    0x52, 0x28, 0x27, 0x00, 0x05, 0x11, 0x01, 0x13, 0xE2, 0xB4, 0x14, 0x94, 0x44, 0x0D, 0xA6, 0x0C,
+    0x81, 0x08, 0x38, 0x44, 0x6B, 0x57, 0x23, 0x90, 0x88, 0x34, 0x88, 0x60, 0x02, 0x38, 0x94, 0xDD,
+    0x57, 0x6B, 0x88, 0x46, 0x20, 0x19, 0xE1, 0x09, 0x12, 0x88, 0x0A, 0x80, 0x84, 0x38, 0x2D, 0x24,
+    0x98, 0x27, 0xCE, 0x11, 0x88, 0x00, 0x02, 0xF5, 0x00, 0x13, 0xE2, 0xB4, 0x0C, 0xC5, 0x62, 0x19,
+    0x02, 0x11, 0x70, 0x48, 0x66, 0xB2, 0x06, 0x16, 0x11, 0x2D, 0x28, 0xA2, 0x46, 0xC1, 0x26, 0x27,
+    0xC2, 0x0D, 0xA6, 0x0C, 0x64, 0x1A, 0x10, 0x01, 0x13, 0xE2, 0xB4, 0x8C, 0x62, 0xCA, 0x10, 0x88,
+    0x00, 0x88, 0x33, 0x2A, 0x82, 0x11, 0x68, 0x81, 0x4B, 0xE0, 0x66, 0x02, 0x24, 0xAC, 0xB5, 0x77,
+    0xB6, 0xB5, 0xA9, 0xBC, 0x35, 0xEA, 0xC5, 0x35, 0x72, 0xD8, 0xDA, 0x0C, 0x30, 0x10, 0xCD, 0x84,
+    0x00, 0xAB, 0x43, 0xAC, 0x40, 0x86, 0x28, 0x09, 0x1C, 0xCE, 0x8C, 0xAD, 0x0D, 0x44, 0x83, 0x0E,
+    0x66, 0xCD, 0x6D, 0x18, 0x88, 0x43, 0xC9, 0x8C, 0x21, 0x9C, 0x40, 0xEC, 0x00, 0x84, 0x30, 0x21,
+    0x15, 0x29, 0x09, 0xE6, 0xC4, 0xA0, 0x86, 0x98, 0x01, 0x40, 0x87, 0xAD, 0x85, 0x6B, 0x66, 0x81,
+    0x9C, 0x5A, 0xC9, 0x39, 0x55, 0x0B, 0xA9, 0x10, 0x67, 0x08, 0x12, 0x00, 0x76, 0x88, 0x52, 0xB9,
+    0x06, 0x0E, 0x02, 0x6E, 0x74, 0x04, 0xEB, 0x00, 0xFF, 0x49, 0x09, 0x21, 0x4C, 0x88, 0xD3, 0x3A,
+    0xD0, 0x08, 0x6A, 0x08, 0x44, 0xC0, 0x21, 0xA2, 0xEE, 0x1A, 0x39, 0x8C, 0x98, 0x5D, 0x5B, 0x07,
+    0x20, 0x5A, 0x36, 0x24, 0x92, 0x11, 0xCC, 0x0C, 0xE6, 0x04, 0xB0, 0x48, 0x3D, 0x46, 0x52, 0x4D,
+    0xA5, 0xE0, 0x0E, 0xA4, 0x2D, 0x2F, 0x26, 0x49, 0xCC, 0xD7, 0x18, 0xDC, 0xD7, 0x1A, 0x02, 0xD8,
+    0xEA, 0x45, 0xD8, 0x04, 0xE4, 0x1D, 0x2E, 0x80, 0xAF, 0x01, 0x2B, 0x82, 0x28, 0x11, 0x4B, 0x02,
+    0x48, 0x04, 0x51, 0x22, 0xA6, 0x00, 0x48, 0x93, 0xE3, 0x8C, 0x04, 0x88, 0xD0, 0x02, 0x87, 0x4E,
+    0xFC, 0x6B, 0xE0, 0x70, 0xDA, 0x0A, 0x24, 0x5A, 0x70, 0x81, 0x48, 0x0D, 0x88, 0x07, 0xE3, 0x26,
+    0x0F, 0x87, 0x68, 0x1A, 0x6C, 0x02, 0xF2, 0x16, 0x41, 0x25, 0x78, 0x10, 0xF9, 0x2A, 0xD6, 0x21,
+    0xAE, 0x7F, 0x00, 0x80, 0x4C, 0x38, 0xA2, 0x24, 0x31, 0x1A, 0x20, 0x20, 0x0F, 0xB0, 0x2A, 0x94,
+    0x88, 0x25, 0x81, 0x49, 0x22, 0x1C, 0x36, 0x74, 0x28, 0xB6, 0xA5, 0x2F, 0xB6, 0x19, 0x35, 0x36,
+    0x60, 0x21, 0x0C, 0x12, 0x21, 0x52, 0x70, 0x01, 0x58, 0x8B, 0x08, 0x32, 0x6C, 0xEB, 0x4C, 0x6C,
+    0xE4, 0xD0, 0x58, 0x86, 0x6D, 0x30, 0x08, 0x99, 0x21, 0x52, 0x70, 0xE1, 0x80, 0x03, 0xA2, 0x22,
+    0x36, 0xEB, 0x90, 0x68, 0x8B, 0x0D, 0x30, 0x48, 0x42, 0x70, 0x01, 0x1C, 0x0C, 0xE9, 0x21, 0x20,
+    0x87, 0x03, 0x32, 0x6C, 0x06, 0x69, 0x10, 0x29, 0xB8, 0x00, 0x0E, 0x08, 0x50, 0x73, 0x7E, 0x05,
+    0xB3, 0xD9, 0x48, 0xA4, 0xDA, 0xCA, 0xB3, 0xDA, 0xCC, 0x68, 0xDB, 0x8E, 0xBB, 0xDB, 0x16, 0xD2,
+    0xDB, 0x98, 0xE8, 0xDB, 0xDA, 0x20, 0xDC, 0x9C, 0x6F, 0xB5, 0x1E, 0x61, 0xDC, 0xA4, 0x1F, 0xDD,
+    0x26, 0x39, 0xDD, 0x28, 0xC0, 0xDD, 0x2A, 0xDD, 0xDD, 0xEE, 0x34, 0xDE, 0xC2, 0x22, 0x21, 0x34,
+    0xDB, 0x62, 0x35, 0x1B, 0x38, 0x5C, 0x00, 0x66, 0x0B, 0x87, 0x6B, 0xB2, 0x6C, 0xC8, 0x3A, 0x00,
+    0xFC, 0xA1, 0x3A, 0x5C, 0xC7, 0x8B, 0x40, 0xA4, 0x09, 0x11, 0x15, 0x22, 0x89, 0x33, 0x84, 0x02,
+    0x87, 0x18, 0xCD, 0x6C, 0x48, 0x80, 0x4C, 0xB8, 0x42, 0x8A, 0x24, 0x46, 0x03, 0x05, 0x32, 0x35,
+    0x60, 0x61, 0x09, 0x29, 0x3C, 0x70, 0x40, 0x74, 0x16, 0xF3, 0x48, 0x9E, 0xCE, 0xB6, 0xB0, 0xD1,
+    0x36, 0x87, 0xD4, 0x26, 0x10, 0x92, 0x6C, 0x08, 0xE7, 0x80, 0x45, 0x72, 0x86, 0x36, 0x09, 0x8A,
+    0xB6, 0xB1, 0x68, 0x1A, 0xD0, 0x86, 0x6A, 0xD0, 0x46, 0x0A, 0xC2, 0xB2, 0x34, 0x9A, 0xA0, 0xC2,
+    0x0A, 0x00, 0x11, 0x13, 0x98, 0x09, 0x40, 0x63, 0x1A, 0xC2, 0x12, 0xC4, 0x01, 0x03, 0x15, 0x91,
+    0x88, 0xC5, 0x4C, 0x00, 0x0B, 0x52, 0x8C, 0x17, 0x9A, 0xA0, 0x04, 0x87, 0xEE, 0x3D, 0x6D, 0xE0,
+    0x90, 0xC5, 0xA5, 0x0D, 0x61, 0x80, 0x09, 0x71, 0x5A, 0xC6, 0x2B, 0x43, 0x20, 0x02, 0x0E, 0x51,
+    0x6F, 0xDA, 0x88, 0x91, 0x20, 0x5E, 0x58, 0x40, 0x63, 0x1A, 0xC4, 0x13, 0xC4, 0x01, 0x0C, 0x30,
+    0x21, 0x4E, 0xCB, 0x28, 0xAF, 0x0C, 0x81, 0x08, 0x40, 0x4C, 0x88, 0xD3, 0x32, 0x46, 0x50, 0x43,
+    0x20, 0x02, 0x3C, 0xD1, 0x84, 0x23, 0x62, 0x30, 0xA3, 0x81, 0xC5, 0x32, 0xBF, 0x36, 0xB4, 0xD6,
+    0x36, 0x72, 0x38, 0xB9, 0xD7, 0x26, 0x17, 0x1D, 0xFB, 0xD4, 0xA4, 0x18, 0x2F, 0x10, 0xA7, 0x45,
+    0xB0, 0x23, 0x10, 0xB1, 0x34, 0x1A, 0x54, 0xC3, 0x39, 0x02, 0x11, 0x50, 0x20, 0x06, 0x40, 0xC8,
+    0x47, 0x04, 0xC8, 0x36, 0x77, 0xCB, 0x36, 0x39, 0xCE, 0x36, 0x62, 0x44, 0x84, 0x73, 0xC2, 0x02,
+    0x9C, 0x56, 0x11, 0xCE, 0x11, 0x88, 0x00, 0x31, 0x22, 0x9C, 0x83, 0x0C, 0x38, 0x74, 0x3F, 0x6D,
+    0x43, 0x9C, 0x96, 0x11, 0xCE, 0x11, 0x88, 0x00, 0xB1, 0x22, 0x9C, 0x83, 0x0C, 0xB0, 0x20, 0x22,
+    0x22, 0x89, 0x2A, 0x14, 0x58, 0x44, 0x23, 0x6E, 0x8B, 0x50, 0x6E, 0x23, 0x24, 0x89, 0x18, 0x11,
+    0x26, 0x9C, 0x13, 0x16, 0x30, 0xE0, 0x86, 0x25, 0x5C, 0x03, 0x87, 0xAE, 0xD2, 0x6D, 0xE0, 0x80,
+    0x99, 0x9D, 0x07, 0xAB, 0x40, 0xCE, 0xA0, 0x67, 0x69, 0x34, 0xC8, 0x99, 0xF2, 0x00, 0x20, 0x40,
+    0x26, 0xC4, 0x69, 0x19, 0x42, 0x8A, 0x21, 0x10, 0x01, 0x1C, 0xC3, 0x61, 0x88, 0x06, 0x64, 0x04,
+    0x87, 0x5E, 0x20, 0x05, 0x1C, 0xBA, 0x2E, 0xB8, 0xA1, 0x43, 0x79, 0x03, 0xB7, 0x06, 0x1C, 0x36,
+    0x3F, 0x81, 0xCC, 0x03, 0xC2, 0xBB, 0x25, 0xE2, 0xC0, 0x21, 0x94, 0xC4, 0x3C, 0x98, 0xEB, 0x00,
+    0xE0, 0x0E, 0x29, 0x37, 0xDC, 0x18, 0x04, 0x58, 0x05, 0xA4, 0x24, 0x70, 0x28, 0x46, 0xAC, 0xD0,
+    0x88, 0xC3, 0xB3, 0x0E, 0x00, 0x04, 0x98, 0x10, 0xA7, 0x95, 0x30, 0xA2, 0x44, 0x19, 0x02, 0x11,
+    0xB0, 0x79, 0x8E, 0xE4, 0x86, 0xEA, 0xE4, 0xC6, 0x86, 0xE5, 0xE6, 0xF6, 0xE5, 0xF6, 0x64, 0x26,
+    0x16, 0x99, 0xE8, 0x46, 0xC4, 0x03, 0x5C, 0xA9, 0x31, 0x80, 0x80, 0x13, 0x82, 0x6A, 0x00, 0x31,
+    0x01, 0x11, 0xAE, 0x30, 0x22, 0x8C, 0x62, 0x1A, 0x30, 0x11, 0x23, 0xE2, 0xC5, 0x11, 0x16, 0x38,
+    0x9C, 0x09, 0x74, 0x33, 0xC0, 0xE1, 0x14, 0x9C, 0x5B, 0x33, 0x80, 0x8A, 0xE2, 0x0A, 0x59, 0x05,
+    0x1C, 0xA2, 0xE6, 0xB9, 0x91, 0x88, 0xE2, 0xCA, 0x08, 0x80, 0xD3, 0x32, 0x8A, 0x2B, 0x43, 0x20,
+    0x02, 0x20, 0x4E, 0x23, 0x23, 0xCC, 0x10, 0x88, 0x1C, 0x00, 0x21, 0xE6, 0x81, 0x83, 0xB6, 0x11,
+    0x62, 0x21, 0x26, 0x2C, 0x43, 0x1A, 0x93, 0xD1, 0x86, 0xC8, 0x82, 0x38, 0xF0, 0x28, 0x68, 0x28,
+    0xE3, 0x06, 0xEB, 0x16, 0x6B, 0xEC, 0x06, 0x18, 0x40, 0x83, 0x48, 0x33, 0x02, 0x11, 0x71, 0x06,
+    0x38, 0x34, 0xC8, 0x75, 0x13, 0x07, 0x60, 0x1F, 0x08, 0x87, 0xC4, 0x57, 0x6C, 0x40, 0x83, 0x48,
+    0x33, 0xA3, 0x38, 0x44, 0xC4, 0x19, 0xE0, 0x90, 0x86, 0xDA, 0x0D, 0xC0, 0x88, 0xD1, 0x81, 0xCC,
+    0x30, 0xA5, 0x85, 0x05, 0x04, 0x44, 0x04, 0x34, 0x02, 0x09, 0x61, 0x32, 0x98, 0x42, 0x54, 0x00,
+    0x1A, 0x81, 0x60, 0x88, 0x66, 0x92, 0x21, 0x04, 0x31, 0xA2, 0xC2, 0x0B, 0x64, 0x1C, 0xB0, 0x38,
+    0x0A, 0xF0, 0x86, 0x64, 0xF0, 0x06, 0x08, 0xC0, 0x84, 0x54, 0x24, 0x03, 0xA9, 0x32, 0xC4, 0x0C,
+    0x00, 0x31, 0x12, 0xC4, 0x0A, 0x0B, 0x2C, 0x8A, 0x8F, 0xF2, 0xC8, 0x4D, 0xBC, 0x35, 0x88, 0x38,
+    0x40, 0x31, 0xF7, 0x58, 0x40, 0x4C, 0x71, 0x71, 0x81, 0x23, 0x80, 0xB0, 0x83, 0x59, 0x62, 0x99,
+    0x47, 0x37, 0x9F, 0x37, 0x1A, 0xA4, 0x37, 0x4C, 0xA7, 0x37, 0x82, 0x1A, 0x9C, 0x76, 0x88, 0xB7,
+    0xF3, 0xE6, 0x34, 0x18, 0xE3, 0x50, 0x32, 0xA3, 0x3D, 0xC4, 0x0E, 0xD0, 0x02, 0x1E, 0x80, 0x4C,
+    0x88, 0xD3, 0x32, 0xD0, 0x11, 0x43, 0x20, 0x02, 0x10, 0x83, 0x6B, 0x08, 0x6C, 0x21, 0x70, 0x78,
+    0xC4, 0xF5, 0x26, 0x38, 0x8B, 0x63, 0xE0, 0x08, 0x88, 0x12, 0x72, 0x0D, 0x40, 0x44, 0x82, 0x82,
+    0x42, 0x01, 0x8E, 0x11, 0x11, 0x92, 0xCC, 0x30, 0xC8, 0x99, 0x70, 0x0E, 0xD8, 0x14, 0x70, 0x80,
+    0x5B, 0xC9, 0x80, 0x63, 0x17, 0x81, 0x7B, 0x4A, 0x81, 0x8B, 0x9E, 0x81, 0x93, 0x01, 0x83, 0x0B,
+    0x87, 0x4B, 0x99, 0x6F, 0xE8, 0x50, 0x36, 0xF2, 0x6D, 0x91, 0x0E, 0x22, 0x56, 0x24, 0x71, 0x60,
+    0x30, 0xC0, 0x41, 0xC4, 0x88, 0x24, 0x0E, 0x0C, 0x06, 0x3C, 0x2E, 0xE7, 0xBF, 0x49, 0x09, 0xC0,
+    0x51, 0x28, 0xC0, 0xA1, 0x47, 0x71, 0xDA, 0xB7, 0xA3, 0xE0, 0x37, 0xA9, 0xE2, 0x37, 0xE0, 0x20,
+    0x62, 0xC3, 0x81, 0xC1, 0x80, 0xC3, 0xA3, 0xD7, 0x37, 0x60, 0x2D, 0xAC, 0xD5, 0xDE, 0x60, 0x44,
+    0x22, 0x1C, 0x48, 0xBD, 0xBE, 0x3D, 0x1A, 0x63, 0xBF, 0x1D, 0x73, 0xBF, 0x49, 0xD0, 0xBF, 0x91,
+    0xC3, 0x18, 0x04, 0xA2, 0x23, 0x26, 0xC0, 0x60, 0xC0, 0x01, 0x21, 0xF5, 0xDB, 0xE3, 0x91, 0x99,
+    0x98, 0x93, 0xEB, 0x46, 0x04, 0xFC, 0x1B, 0x39, 0x24, 0x40, 0x53, 0x88, 0x07, 0xF1, 0x9E, 0x04,
+    0x07, 0x04, 0xAF, 0x1B, 0x0E, 0x22, 0x36, 0xC0, 0x60, 0x00, 0x44, 0x3A, 0x88, 0x58, 0x21, 0x0E,
+    0x0C, 0x06, 0x40, 0x0E, 0x22, 0x46, 0x88, 0x03, 0x83, 0x01, 0x07, 0x12, 0x03, 0x70, 0x0E, 0x40,
+    0x42, 0x1A, 0x93, 0x61, 0x14, 0x2C, 0x47, 0x10, 0x07, 0x20, 0xD2, 0x41, 0xC4, 0x0A, 0x99, 0xC4,
+    0x81, 0xC1, 0x00, 0x0A, 0xD2, 0x12, 0x22, 0x16, 0x04, 0x58, 0x10, 0xE9, 0x20, 0x62, 0x86, 0x4C,
+    0xE2, 0xC0, 0x60, 0xC0, 0xE2, 0x2B, 0x11, 0x9C, 0xCC, 0x15, 0x1C, 0x32, 0x01, 0x4D, 0x83, 0x08,
+    0xE0, 0x60, 0xDD, 0x9A, 0x83, 0x3B, 0x9C, 0x76, 0x82, 0x93, 0xC8, 0xC1, 0xE0, 0x23, 0x02, 0x62,
+    0x58, 0x70, 0x84, 0x19, 0x61, 0xA5, 0x06, 0x50, 0xC0, 0x40, 0x32, 0x82, 0x39, 0xAC, 0xAC, 0x00,
+    0x50, 0x12, 0x30, 0x20, 0x8D, 0x09, 0x09, 0xE6, 0xB0, 0xB2, 0x04, 0x71, 0x80, 0x43, 0xC4, 0x06,
+    0x74, 0x83, 0x01, 0x24, 0x01, 0x11, 0x11, 0xA7, 0x29, 0x28, 0x14, 0x40, 0x21, 0xA4, 0x81, 0x89,
+    0x11, 0x2C, 0xD5, 0x4C, 0x84, 0x01, 0x1E, 0x09, 0x87, 0xE1, 0x90, 0xE6, 0xE1, 0xA6, 0x29, 0xE2,
+    0xC0, 0x62, 0xA4, 0x28, 0xDC, 0x7C, 0x2F, 0x5C, 0x33, 0x0F, 0x01, 0x7F, 0xA8, 0x90, 0x79, 0x80,
+    0x8E, 0x17, 0x71, 0x48, 0xD6, 0x0A, 0x07, 0x34, 0x13, 0x38, 0x40, 0x94, 0x49, 0x39, 0x8C, 0xD3,
+    0x85, 0x6B, 0x26, 0xA4, 0x21, 0x15, 0x85, 0x0C, 0x41, 0x02, 0x28, 0x18, 0xC1, 0x00, 0x44, 0x4C,
+    0x30, 0x23, 0x18, 0x70, 0x38, 0xC5, 0x0E, 0x27, 0x0F, 0xD1, 0x8B, 0x3C, 0xE6, 0xA1, 0x53, 0x39,
+    0x1C, 0x3A, 0x74, 0xE8, 0x86, 0x6B, 0x0B, 0xAE, 0x66, 0x02, 0xBA, 0x66, 0x02, 0x87, 0x8C, 0x9E,
+    0x03, 0x52, 0x2B, 0x20, 0x07, 0x2C, 0x20, 0x74, 0x09, 0x34, 0xD4, 0x71, 0x40, 0x9C, 0xD6, 0x70,
+    0x86, 0x40, 0x04, 0x2C, 0xB6, 0x04, 0xC4, 0x65, 0x3F, 0xC4, 0x09, 0xCA, 0x82, 0x0F, 0xE8, 0x3D,
+    0x09, 0x10, 0x92, 0x44, 0x34, 0x13, 0x02, 0xAC, 0x90, 0x11, 0xCE, 0x09, 0x64, 0x88, 0x92, 0x00,
+    0x42, 0x16, 0xE4, 0x70, 0x00, 0x84, 0x24, 0x88, 0x11, 0x2C, 0xD5, 0x4C, 0x84, 0x01, 0x2E, 0x05,
+    0x74, 0xE2, 0x06, 0x82, 0xE2, 0x08, 0xAA, 0xE2, 0x90, 0xC9, 0xE2, 0x62, 0xD6, 0xE2, 0x02, 0xA4,
+    0x69, 0x10, 0x01, 0x58, 0x19, 0x52, 0x10, 0xA1, 0x4A, 0x02, 0x00, 0x4A, 0x36, 0x30, 0x85, 0xD8,
+    0x01, 0xD0, 0x61, 0x09, 0x54, 0x1C, 0x20, 0x4C, 0x48, 0x45, 0x2A, 0x50, 0x51, 0x43, 0xCC, 0x00,
+    0xE0, 0x86, 0x21, 0x6A, 0x03, 0x87, 0x8B, 0x5E, 0x71, 0x03, 0x6E, 0x08, 0x65, 0x35, 0x60, 0xC1,
+    0x11, 0xA1, 0xA4, 0xD4, 0x80, 0x81, 0x92, 0x0D, 0x4B, 0xB0, 0x03, 0x20, 0x05, 0x42, 0x8C, 0x88,
+    0x50, 0x45, 0x58, 0x60, 0x3A, 0x08, 0x42, 0x4E, 0x4C, 0x46, 0x6E, 0x74, 0x72, 0x8E, 0x08, 0x75,
+    0xAE, 0x38, 0x78, 0xCE, 0xCC, 0x8E, 0xEE, 0x90, 0x9C, 0x0E, 0xA1, 0x9D, 0x4E, 0xF1, 0x9F, 0x6E,
+    0xB9, 0xA0, 0x8E, 0x41, 0xB2, 0xAE, 0x6D, 0xBE, 0xCE, 0x71, 0xC8, 0xEE, 0xE1, 0xCC, 0x0E, 0xF6,
+    0xF6, 0x4E, 0xD6, 0xF8, 0x6E, 0x26, 0x2B, 0x8F, 0xA6, 0x2F, 0xAF, 0x9E, 0x32, 0xCF, 0x6A, 0x38,
+    0x0F, 0x4C, 0x8E, 0x57, 0xC7, 0xAD, 0x7C, 0xC7, 0x49, 0x0E, 0xC8, 0xE1, 0x32, 0xC8, 0x89, 0x45,
+    0xB4, 0x8A, 0x9B, 0x85, 0xE8, 0x38, 0x81, 0x8A, 0x22, 0xA4, 0x31, 0x21, 0x8A, 0x19, 0x23, 0x88,
+    0x03, 0x56, 0x83, 0x2A, 0x29, 0x01, 0x0C, 0x32, 0x21, 0x4E, 0x6B, 0x38, 0x47, 0x20, 0x02, 0x1E,
+    0x65, 0xE8, 0xE3, 0xE6, 0xF7, 0xE3, 0xB0, 0x59, 0x07, 0x90, 0xA9, 0x22, 0x16, 0xDC, 0x91, 0xCA,
+    0x10, 0x33, 0xA4, 0x06, 0x20, 0x13, 0x22, 0x22, 0xC4, 0x19, 0x42, 0x01, 0x88, 0xD3, 0x2A, 0x52,
+    0x19, 0x02, 0x11, 0x80, 0x00, 0x22, 0xE1, 0x64, 0x9C, 0x50, 0x8C, 0x82, 0xC0, 0x28, 0x58, 0x0D,
+    0x2C, 0xAE, 0x89, 0xC8, 0xB9, 0xB0, 0xC8, 0x21, 0xD4, 0x32, 0x20, 0x8D, 0xC9, 0x60, 0x22, 0x2D,
+    0x41, 0x1C, 0xB0, 0x20, 0x4E, 0x23, 0x2B, 0x42, 0x4A, 0x02, 0x91, 0x03, 0x50, 0x8D, 0x38, 0x20,
+    0x46, 0x53, 0xF8, 0x24, 0x4F, 0x93, 0x3B, 0x20, 0x95, 0x43, 0x97, 0x95, 0x73, 0xB0, 0x97, 0x83,
+    0x31, 0x9B, 0x8B, 0x7A, 0x9B, 0xA3, 0xF8, 0x9B, 0x13, 0x87, 0x94, 0x61, 0x72, 0x0E, 0x3B, 0x64,
+    0xCF, 0x92, 0x23, 0x9A, 0x51, 0x81, 0xDE, 0x0B, 0x64, 0x01, 0x44, 0x33, 0x32, 0xD0, 0x7B, 0x81,
+    0x2C, 0x20, 0x42, 0x1A, 0x53, 0xC1, 0x8C, 0x11, 0xC4, 0x81, 0x47, 0xE4, 0x41, 0xB9, 0x57, 0x4A,
+    0xB9, 0x8A, 0x4E, 0x39, 0x62, 0x1C, 0xA2, 0xF8, 0xC9, 0x11, 0xA3, 0x61, 0x85, 0x05, 0x34, 0x26,
+    0x62, 0x09, 0xE2, 0xC0, 0x61, 0xDD, 0xA2, 0x1C, 0x51, 0x0B, 0x26, 0x40, 0x0C, 0x45, 0xE4, 0xB0,
+    0x06, 0x5A, 0x0D, 0x7A, 0x00, 0x42, 0x34, 0xB3, 0x42, 0x44, 0x11, 0xC8, 0x00, 0x90, 0xC6, 0x34,
+    0x88, 0x29, 0x88, 0x03, 0x87, 0x64, 0xAD, 0x72, 0x40, 0x3C, 0x30, 0x87, 0x79, 0x32, 0x1A, 0x8A,
+    0x82, 0x61, 0x81, 0x47, 0x92, 0x62, 0xB9, 0xD7, 0x6E, 0xB9, 0xDA, 0x70, 0xB9, 0x01, 0x69, 0x4C,
+    0xC5, 0x11, 0x4B, 0x10, 0x07, 0x0E, 0x6B, 0xB4, 0xE5, 0xDE, 0xE1, 0x84, 0xB5, 0x1C, 0xD1, 0x4C,
+    0xB2, 0x22, 0x8A, 0x40, 0xC6, 0x01, 0x0D, 0x41, 0xC4, 0x01, 0x12, 0x82, 0x98, 0xE0, 0x00, 0xF5,
+    0x37, 0x01, 0x39, 0x8C, 0x5E, 0x97, 0x1B, 0x0D, 0x41, 0xCC, 0xB0, 0x00, 0xE9, 0x40, 0x5E, 0x47,
+    0x10, 0x33, 0x98, 0x03, 0x45, 0x04, 0x8F, 0xCC, 0x0F, 0x73, 0x0D, 0x1A, 0x73, 0x31, 0x58, 0x73,
+    0x06, 0x3A, 0xCC, 0x57, 0x98, 0x93, 0x48, 0x02, 0x11, 0x27, 0x00, 0x24, 0x81, 0x88, 0x1C, 0xC0,
+    0xE1, 0xE3, 0x1C, 0x17, 0xD1, 0x8C, 0x84, 0x17, 0xC8, 0x02, 0x93, 0x22, 0x34, 0x73, 0xE8, 0x38,
+    0x73, 0x2D, 0x3F, 0x73, 0x13, 0x4D, 0x73, 0x00, 0x22, 0x49, 0x40, 0x23, 0x90, 0x0E, 0x52, 0xC4,
+    0x39, 0x85, 0xA8, 0x00, 0xA0, 0x83, 0x65, 0xBA, 0x07, 0x19, 0x69, 0x70, 0x44, 0xE4, 0x00, 0x00,
+    0x88, 0x3C, 0x94, 0x7E, 0x1B, 0x00, 0x1A, 0x81, 0x34, 0x9C, 0x42, 0x54, 0x00, 0x22, 0x4A, 0x98,
+    0x88, 0x91, 0x71, 0x86, 0x61, 0x6A, 0x84, 0x05, 0x0C, 0x4F, 0xE4, 0x0C, 0x94, 0x40, 0xC4, 0x0E,
+    0x1A, 0x0D, 0x5A, 0x4C, 0x05, 0x03, 0x50, 0x48, 0x44, 0x8C, 0x0C, 0xCD, 0x84, 0x09, 0x0B, 0x1C,
+    0xBA, 0x0A, 0xF7, 0x00, 0x13, 0xE2, 0x34, 0xC0, 0xCA, 0x08, 0x65, 0x08, 0x44, 0x4A, 0x02, 0x87,
+    0xB1, 0x8C, 0x73, 0xC8, 0x84, 0x34, 0xA6, 0xC2, 0x30, 0x31, 0x04, 0x71, 0x60, 0x01, 0x85, 0xD2,
+    0x2B, 0xA2, 0x99, 0xE0, 0x10, 0x91, 0x73, 0x0E, 0xC0, 0x09, 0x65, 0x35, 0x40, 0xA0, 0x16, 0x87,
+    0x92, 0x21, 0x62, 0x09, 0xC5, 0x12, 0x62, 0x07, 0x1C, 0xB6, 0xDA, 0xCE, 0x0D, 0x04, 0x83, 0x34,
+    0x26, 0x63, 0x85, 0xF0, 0x04, 0x71, 0x40, 0xE1, 0x44, 0x02, 0x31, 0x3A, 0x04, 0xA9, 0xC8, 0xA8,
+    0xB0, 0xC0, 0x63, 0xF9, 0x06, 0x5D, 0x4C, 0x0E, 0x1D, 0x3D, 0x1C, 0x1D, 0x59, 0x1C, 0xC7, 0x9E,
+    0x8B, 0x10, 0x9F, 0x13, 0x66, 0x42, 0x0A, 0x6A, 0x00, 0x44, 0x33, 0x50, 0xAC, 0xC2, 0x04, 0xB2,
+    0xD8, 0x03, 0x93, 0xE0, 0x7D, 0x0E, 0x48, 0x08, 0x74, 0x4D, 0x0F, 0x74, 0xF1, 0x14, 0x74, 0xE4,
+    0x51, 0x1C, 0x4B, 0x65, 0xF0, 0x0D, 0xA3, 0xE9, 0x7F, 0x8E, 0x11, 0x48, 0x02, 0x51, 0x01, 0x1C,
+    0x8A, 0xBF, 0x32, 0x10, 0x02, 0x49, 0x50, 0x01, 0x2C, 0x80, 0xA3, 0xC6, 0xB4, 0x53, 0x7A, 0x11,
+    0x48, 0x42, 0x20, 0x2A, 0x80, 0x05, 0x42, 0x63, 0x00, 0xD9, 0x9A, 0x00, 0x44, 0x3C, 0x44, 0x92,
+    0xA1, 0x23, 0x87, 0x6D, 0x2B, 0x74, 0x23, 0x22, 0x18, 0x13, 0x16, 0x20, 0x90, 0x8C, 0x60, 0x02,
+    0x51, 0x01, 0x68, 0x4C, 0x45, 0x30, 0x46, 0x10, 0x07, 0x16, 0x11, 0xA1, 0xE8, 0x1C, 0xD1, 0xE8,
+    0xC8, 0x61, 0x14, 0x13, 0x5D, 0x23, 0x90, 0x88, 0x60, 0x02, 0x51, 0x01, 0x90, 0x0D, 0xC1, 0x1C,
+    0x60, 0x30, 0x88, 0x08, 0x98, 0x87, 0xCE, 0x61, 0x74, 0x88, 0xD3, 0x42, 0x5C, 0x30, 0x65, 0x08,
+    0x44, 0x80, 0xD8, 0xE1, 0x82, 0x29, 0x03, 0x19, 0x80, 0x41, 0xA4, 0x59, 0x81, 0xCC, 0x13, 0x67,
+    0x00, 0xD2, 0x3A, 0x00, 0x17, 0x2F, 0xB8, 0x24, 0xF8, 0xA4, 0x43, 0x46, 0xA5, 0x5B, 0x95, 0xA5,
+    0x8B, 0xC8, 0xA5, 0xA3, 0x69, 0xA6, 0x03, 0x87, 0x71, 0x93, 0x74, 0x83, 0xAC, 0xF8, 0x52, 0xC1,
+    0x15, 0xB3, 0x0E, 0x38, 0x94, 0x63, 0xA4, 0x1B, 0x0B, 0xE4, 0x34, 0x01, 0x52, 0x89, 0x31, 0x24,
+    0x09, 0x71, 0x5A, 0x85, 0x09, 0xE7, 0x08, 0x44, 0x00, 0x69, 0x02, 0x22, 0x62, 0x34, 0x04, 0x13,
+    0x16, 0x21, 0x00, 0x05, 0xC4, 0x06, 0x96, 0x8A, 0x01, 0x8B, 0xA3, 0x8B, 0x74, 0x24, 0xC9, 0x74,
+    0xC0, 0x20, 0x33, 0xBE, 0x54, 0x70, 0xC5, 0xAC, 0x03, 0x0E, 0x64, 0x26, 0x3E, 0x0E, 0x97, 0xAB,
+    0xE9, 0xC0, 0x41, 0x8C, 0xD1, 0x18, 0xB0, 0x88, 0x5E, 0xE4, 0x11, 0x05, 0xED, 0xE3, 0x4C, 0x91,
+    0x6C, 0x18, 0xC8, 0x1C, 0x80, 0x88, 0x24, 0x60, 0x35, 0x14, 0x73, 0x4A, 0x02, 0x87, 0x26, 0x2F,
+    0x2B, 0x02, 0x10, 0x35, 0xC0, 0x84, 0x38, 0x2D, 0x84, 0xA8, 0x62, 0x48, 0x19, 0x02, 0x11, 0xA0,
+    0x71, 0xEC, 0x41, 0x13, 0x26, 0xD4, 0x26, 0xE9, 0x4B, 0x1D, 0xA2, 0x53, 0x9D, 0x6B, 0x5E, 0xDD,
+    0x33, 0x60, 0xDD, 0x94, 0x05, 0x06, 0x55, 0x63, 0x1D, 0x58, 0x5C, 0x34, 0x33, 0xD3, 0xF0, 0xAB,
+    0x98, 0xD0, 0x61, 0xCD, 0x36, 0x80, 0xF3, 0x34, 0xD2, 0x81, 0xBC, 0x0A, 0x72, 0xA0, 0x88, 0x60,
+    0x12, 0x38, 0xF2, 0x02, 0x85, 0xA8, 0x4E, 0x1E, 0xA9, 0xAE, 0x36, 0xFA, 0x41, 0x98, 0x48, 0x44,
+    0x48, 0x41, 0x8D, 0x00, 0xD4, 0x03, 0xD2, 0x64, 0x01, 0x84, 0x4C, 0x28, 0x27, 0x1C, 0x70, 0x49,
+    0xF2, 0x12, 0x60, 0xEA, 0xB7, 0xD6, 0x3E, 0x56, 0x37, 0xA7, 0x56, 0x97, 0x43, 0x57, 0x07, 0x84,
+    0x83, 0xF5, 0x1C, 0x09, 0x10, 0x25, 0x9D, 0x02, 0x71, 0x20, 0x00, 0x54, 0xC4, 0x82, 0x33, 0xCA,
+    0x10, 0x33, 0xA4, 0x06, 0x90, 0x86, 0x92, 0xC4, 0x09, 0x00, 0x20, 0x4C, 0xA4, 0x41, 0x95, 0x11,
+    0x00, 0x40, 0x20, 0x18, 0xA2, 0x99, 0x21, 0x31, 0x15, 0x15, 0x5E, 0x20, 0x03, 0x10, 0x07, 0xF3,
+    0x27, 0x1D, 0x8B, 0x64, 0x9F, 0x75, 0xC8, 0xD4, 0x75, 0x00, 0xD2, 0x98, 0x00, 0x41, 0x1C, 0x58,
+    0x64, 0x65, 0xAD, 0x6B, 0x07, 0xAE, 0x0B, 0x88, 0x98, 0xF0, 0x64, 0x30, 0x40, 0x38, 0x8C, 0x7E,
+    0x1B, 0x20, 0x22, 0x70, 0xD8, 0x18, 0x43, 0x14, 0x2C, 0xA4, 0xE5, 0x85, 0x87, 0x4C, 0x91, 0x29,
+    0x80, 0x43, 0x94, 0xE5, 0x3A, 0xA0, 0x99, 0x11, 0xA4, 0x90, 0x01, 0x08, 0x44, 0x33, 0x33, 0x04,
+    0x11, 0x47, 0x05, 0x32, 0x80, 0x76, 0x28, 0x73, 0x5E, 0x47, 0x0E, 0x9B, 0x8C, 0xEB, 0x24, 0x81,
+    0x68, 0x66, 0x85, 0x38, 0x2A, 0x90, 0x01, 0x0E, 0x91, 0xBD, 0xEB, 0x04, 0xA2, 0x99, 0x11, 0xE2,
+    0xA8, 0x40, 0x06, 0x78, 0x24, 0x86, 0xB0, 0x6B, 0xFA, 0xB0, 0x9B, 0xEE, 0xB1, 0x1B, 0xC8, 0x61,
+    0x9E, 0x82, 0x5D, 0xE5, 0x50, 0xB2, 0x21, 0x4F, 0xC4, 0x0E, 0xE0, 0x50, 0x32, 0x61, 0x22, 0x76,
+    0xC0, 0xA1, 0xD5, 0x86, 0xDD, 0x40, 0x44, 0xC4, 0xA8, 0x58, 0x01, 0x1C, 0xAC, 0x4C, 0x37, 0x71,
+    0x2A, 0x60, 0x1E, 0xA2, 0xAE, 0xD8, 0x91, 0x0A, 0x34, 0xCB, 0x08, 0xE0, 0xD0, 0xE1, 0xC6, 0xAE,
+    0x31, 0x1D, 0x68, 0x96, 0x21, 0x88, 0x03, 0x5A, 0x07, 0x9A, 0x65, 0x08, 0x44, 0x00, 0x27, 0x92,
+    0x09, 0xC1, 0x1C, 0xB0, 0xC8, 0x7C, 0x65, 0x17, 0x0D, 0x66, 0x27, 0x08, 0x54, 0x14, 0x11, 0x8D,
+    0x40, 0x4A, 0x14, 0x33, 0x26, 0x10, 0x15, 0x00, 0x86, 0x68, 0x46, 0x85, 0x42, 0xEF, 0x05, 0xB2,
+    0x00, 0x03, 0x68, 0x07, 0xC8, 0x2D, 0x48, 0xA3, 0x41, 0x93, 0x76, 0x04, 0xAE, 0x76, 0x08, 0xE4,
+    0x76, 0x8E, 0xEE, 0x76, 0x51, 0x0F, 0x77, 0x92, 0x54, 0x77, 0x73, 0x62, 0x77, 0x34, 0x6C, 0x77,
+    0xC0, 0x84, 0x4C, 0x88, 0xD3, 0x32, 0xC2, 0x10, 0x43, 0x20, 0x62, 0xA9, 0x09, 0xB1, 0x98, 0x21,
+    0x86, 0x40, 0x04, 0x58, 0x10, 0xB1, 0x28, 0x3F, 0x6A, 0xA7, 0x95, 0x6A, 0x07, 0xB4, 0x0A, 0x26,
+    0x93, 0x50, 0x85, 0x80, 0x08, 0x26, 0x93, 0x50, 0x07, 0x44, 0x30, 0x99, 0x84, 0x02, 0x8F, 0x08,
+    0xC5, 0x76, 0x6D, 0xCD, 0x76, 0x73, 0xD1, 0x76, 0xC2, 0x84, 0x54, 0xC4, 0x82, 0x43, 0x4E, 0x0C,
+    0x6A, 0x88, 0x19, 0x52, 0x03, 0x26, 0xC4, 0x69, 0x11, 0x43, 0x0C, 0x81, 0x08, 0x38, 0x98, 0x8D,
+    0x7E, 0x38, 0x44, 0xF3, 0xB6, 0x23, 0x80, 0x61, 0xC1, 0x15, 0x65, 0x84, 0x95, 0x1A, 0xE0, 0xB4,
+    0x82, 0x21, 0x10, 0x01, 0x26, 0x64, 0x42, 0x9C, 0x96, 0x11, 0x86, 0x18, 0x02, 0x11, 0x70, 0x18,
+    0x77, 0x70, 0xD7, 0xC8, 0x43, 0xF4, 0x7E, 0x3B, 0x12, 0x71, 0x22, 0x22, 0x27, 0x00, 0xC1, 0x42,
+    0x3A, 0x4E, 0x44, 0xE4, 0x08, 0x99, 0x02, 0x30, 0x01, 0xC3, 0x82, 0x1B, 0xC2, 0x4A, 0x0D, 0x2C,
+    0xBA, 0xFA, 0xDC, 0x4D, 0x2E, 0xDD, 0x11, 0x72, 0x91, 0x64, 0xE5, 0xAE, 0x7D, 0x9B, 0x02, 0x68,
+    0x26, 0x60, 0x42, 0x2A, 0xD2, 0x11, 0xC8, 0x28, 0x43, 0xCC, 0x00, 0x0E, 0x27, 0x99, 0x47, 0x9A,
+    0x79, 0x88, 0xAA, 0x73, 0x07, 0x4C, 0xE8, 0xA0, 0xFE, 0x95, 0xE1, 0xA0, 0x92, 0x30, 0xE2, 0x70,
+    0x02, 0xE9, 0x6E, 0xA0, 0x07, 0x22, 0xE1, 0x01, 0x09, 0xC8, 0x0C, 0xC0, 0x41, 0x22, 0x52, 0x11,
+    0xCC, 0x40, 0xC2, 0x04, 0x80, 0x10, 0x26, 0xA4, 0x22, 0x16, 0x5C, 0x72, 0x62, 0x50, 0x43, 0xCC,
+    0x90, 0x1A, 0x80, 0x4C, 0x88, 0xD3, 0x2A, 0xC2, 0x10, 0x43, 0x20, 0x02, 0x0E, 0x17, 0x3F, 0xEF,
+    0xC2, 0xE1, 0xBA, 0xE2, 0x1D, 0x22, 0x16, 0xA5, 0x06, 0xEF, 0xF4, 0x0E, 0xEF, 0x80, 0xD6, 0x90,
+    0x84, 0x2A, 0x04, 0x24, 0x24, 0xA1, 0x0E, 0x48, 0x48, 0x42, 0x01, 0xE8, 0x50, 0xAB, 0xF3, 0x0E,
+    0x68, 0x87, 0xDA, 0x99, 0x77, 0x32, 0x41, 0x15, 0x72, 0x40, 0x82, 0x2A, 0x04, 0x04, 0x28, 0x00,
+    0x11, 0x8B, 0xD2, 0xAE, 0x77, 0x9A, 0xB3, 0x77, 0x40, 0x8B, 0x90, 0x49, 0xA8, 0x42, 0x40, 0x83,
+    0x4C, 0x42, 0x1D, 0xD0, 0x20, 0x93, 0x50, 0x00, 0x3D, 0x8C, 0x08, 0xBE, 0x43, 0x07, 0xF1, 0xE2,
+    0x02, 0x88, 0x91, 0x20, 0x4C, 0x58, 0xE0, 0x93, 0xE0, 0xFC, 0x0E, 0x29, 0x02, 0xCF, 0x1D, 0x04,
+    0xEF, 0x8D, 0x06, 0x4F, 0x1A, 0x12, 0x6F, 0x36, 0x1D, 0x8F, 0xCE, 0x28, 0x0F, 0xA0, 0x22, 0xA0,
+    0x99, 0x15, 0xA3, 0x30, 0x53, 0xC8, 0x00, 0x8B, 0xF1, 0x03, 0x78, 0x55, 0x0A, 0x78, 0x4C, 0x38,
+    0x5C, 0x7E, 0x1B, 0x20, 0x87, 0x72, 0x00, 0x78, 0x0B, 0xD0, 0x08, 0xA4, 0x22, 0x15, 0xA2, 0x02,
+    0x28, 0x48, 0xE1, 0x00, 0x80, 0x70, 0x1A, 0x8A, 0x51, 0x10, 0x70, 0x90, 0xD8, 0x60, 0x26, 0x12,
+    0x06, 0x2C, 0x9A, 0x73, 0xE0, 0xC9, 0x35, 0xDB, 0x8D, 0x03, 0x42, 0xF3, 0x90, 0x83, 0xA6, 0xED,
+    0x8A, 0xC3, 0x68, 0x17, 0xBC, 0x65, 0xA1, 0x26, 0xC4, 0x69, 0x15, 0x6C, 0x08, 0x44, 0x00, 0x81,
+    0x24, 0x30, 0xA3, 0x02, 0x38, 0x74, 0xFA, 0xC1, 0x23, 0x84, 0x09, 0x1D, 0xD4, 0x6C, 0x03, 0x1C,
+    0x36, 0x3F, 0xE1, 0xB1, 0xC5, 0xF1, 0x54, 0x0F, 0xC9, 0x25, 0x3C, 0x81, 0x24, 0x90, 0x13, 0xC0,
+    0xA3, 0x70, 0x1D, 0x57, 0xCB, 0x1C, 0x9E, 0xC4, 0x1F, 0x1E, 0x3A, 0x94, 0x61, 0xC3, 0x0B, 0x90,
+    0x05, 0x99, 0x10, 0x42, 0x86, 0x1C, 0x21, 0x45, 0x12, 0x43, 0x84, 0x03, 0x04, 0x0B, 0x89, 0x38,
+    0x42, 0xA6, 0x00, 0x48, 0x48, 0x80, 0x2C, 0x13, 0xEE, 0x38, 0x42, 0x8A, 0x24, 0x46, 0x03, 0x87,
+    0x80, 0x38, 0x05, 0x48, 0x38, 0x5C, 0xF1, 0x00, 0x41, 0xD6, 0x02, 0x01, 0x4E, 0x1A, 0x32, 0xE8,
+    0xC0, 0xA2, 0x1C, 0x31, 0x1E, 0x6D, 0x34, 0x1E, 0xC1, 0x04, 0x6B, 0x91, 0x64, 0x15, 0x0F, 0x9D,
+    0x17, 0x0F, 0x68, 0x04, 0x12, 0x12, 0x9E, 0x4C, 0x85, 0xA8, 0x00, 0x16, 0x1B, 0x46, 0xF1, 0x74,
+    0x70, 0xF1, 0x46, 0x46, 0x78, 0x32, 0x85, 0x05, 0x32, 0xC2, 0x93, 0x29, 0x00, 0x8D, 0xE9, 0x08,
+    0x4F, 0x26, 0x41, 0x1C, 0x40, 0x45, 0x84, 0x30, 0x21, 0x8D, 0x29, 0x61, 0xC6, 0x04, 0x35, 0x04,
+    0x71, 0x40, 0x3C, 0x8C, 0xEF, 0xC6, 0x23, 0x84, 0x59, 0xC1, 0x8C, 0x09, 0x6A, 0x00, 0x84, 0x30,
+    0x21, 0x4E, 0x2B, 0x61, 0xC6, 0x04, 0x35, 0x04, 0x22, 0x60, 0x92, 0x6C, 0x23, 0x0F, 0x91, 0x24,
+    0x2F, 0x9E, 0x25, 0x8F, 0xAA, 0x26, 0x0F, 0x1C, 0x52, 0x34, 0xE4, 0x45, 0xE0, 0x90, 0xDA, 0x20,
+    0xAF, 0x99, 0x0D, 0xCC, 0x14, 0x32, 0x80, 0x66, 0x46, 0x30, 0x53, 0xC8, 0x00, 0x22, 0x70, 0x48,
+    0x05, 0x6F, 0x30, 0x21, 0x4E, 0xEB, 0x40, 0xA6, 0x0C, 0x81, 0x08, 0x10, 0x01, 0x54, 0x33, 0x2B,
+    0x0A, 0x33, 0x85, 0x0C, 0x40, 0x98, 0x88, 0x11, 0x61, 0x84, 0x1A, 0x61, 0x01, 0x00, 0xD5, 0xCC,
+    0x88, 0xC2, 0x4C, 0x21, 0x03, 0x1C, 0xC6, 0xFA, 0xE4, 0x01, 0xF1, 0x00, 0xB4, 0x23, 0x0F, 0x58,
+    0x68, 0x79, 0xC9, 0xA3, 0xED, 0xC8, 0x3B, 0x9C, 0xAC, 0xCA, 0x8B, 0x08, 0x61, 0x42, 0x1A, 0x53,
+    0x61, 0x82, 0x1A, 0x82, 0x38, 0x60, 0x15, 0xA4, 0x01, 0x16, 0x23, 0xD7, 0xF2, 0xE8, 0xF0, 0xF2,
+    0x80, 0x05, 0x99, 0x80, 0xB9, 0x40, 0x96, 0x9C, 0x85, 0xFA, 0xF9, 0x70, 0x48, 0x43, 0x97, 0x47,
+    0x0E, 0x50, 0x88, 0xEA, 0xB4, 0x04, 0x66, 0x08, 0x10, 0x0F, 0x1A, 0xE6, 0x30, 0x16, 0x65, 0x13,
+    0xF3, 0xA6, 0x1E, 0xF3, 0x96, 0x99, 0x70, 0x58, 0x1A, 0xC0, 0x32, 0x1B, 0x0E, 0x4B, 0x03, 0x88,
+    0x5A, 0xC3, 0x60, 0x86, 0x80, 0x45, 0x22, 0xD4, 0x3C, 0x07, 0xDD, 0x3C, 0x60, 0xA1, 0x80, 0x89,
+    0x18, 0x1D, 0x61, 0x96, 0xC4, 0xCA, 0x08, 0x0B, 0x1C, 0xC6, 0xC4, 0xE6, 0x21, 0x36, 0x41, 0x84,
+    0x0B, 0x0E, 0x65, 0xC2, 0x03, 0x80, 0x55, 0x70, 0x4A, 0x02, 0x16, 0x6A, 0x42, 0x9C, 0x06, 0x1C,
+    0x44, 0x13, 0x84, 0x41, 0xA6, 0x89, 0x68, 0x11, 0x46, 0x8C, 0x11, 0x08, 0x40, 0x80, 0x83, 0x58,
+    0x60, 0x3A, 0xF8, 0x70, 0x6A, 0x3B, 0x8F, 0x1D, 0x30, 0x23, 0x4F, 0x1C, 0xB2, 0x9B, 0xE7, 0x9D,
+    0x05, 0x82, 0x32, 0x05, 0x84, 0x32, 0x05, 0x88, 0x48, 0x80, 0x4F, 0x28, 0x70, 0xD8, 0xAC, 0x9F,
+    0x67, 0x0E, 0x9D, 0xDD, 0x80, 0x08, 0x2A, 0x26, 0x20, 0x66, 0x00, 0xA4, 0x31, 0x90, 0xC6, 0x54,
+    0x38, 0x41, 0x1C, 0x58, 0x74, 0xCD, 0xD0, 0xA3, 0xF3, 0xD0, 0x13, 0xDC, 0x61, 0x0C, 0x85, 0x9E,
+    0x20, 0xB8, 0x02, 0x04, 0x8C, 0x88, 0xA0, 0x90, 0x59, 0x00, 0x3B, 0x00, 0x7B, 0x20, 0x61, 0x2C,
+    0xB8, 0x00, 0xA6, 0x06, 0x2E, 0x87, 0x82, 0xF4, 0x96, 0x93, 0xF4, 0x98, 0x18, 0x2F, 0x9A, 0x9B,
+    0xF4, 0x64, 0xAE, 0xF4, 0x04, 0xEA, 0x21, 0x22, 0x60, 0x22, 0x21, 0x41, 0xB1, 0x18, 0x4C, 0x19,
+    0x01, 0x40, 0x18, 0xA2, 0x99, 0xC0, 0xC1, 0x7C, 0x9C, 0xC2, 0xC1, 0x32, 0xF2, 0x84, 0x76, 0xD8,
+    0x24, 0x31, 0x40, 0x0F, 0x9A, 0x42, 0x62, 0x48, 0x68, 0xA1, 0xD1, 0x38, 0xCA, 0xD5, 0x08, 0x05,
+    0x32, 0x91, 0x88, 0x6B, 0xC4, 0x08, 0xC0, 0x74, 0x1E, 0x91, 0xE5, 0xF4, 0x98, 0xF0, 0xF4, 0x30,
+    0xFA, 0xF4, 0x08, 0x16, 0x01, 0xDB, 0x80, 0x0F, 0x34, 0xC0, 0x36, 0xE0, 0x03, 0x18, 0x59, 0x01,
+    0xDB, 0x80, 0xEF, 0x80, 0xD3, 0x42, 0x60, 0xBD, 0x15, 0x65, 0xBD, 0x16, 0x67, 0xBD, 0xE8, 0x76,
+    0x3D, 0x79, 0x81, 0xBD, 0x79, 0x85, 0x3D, 0xCA, 0xD1, 0x9D, 0xCA, 0x88, 0x81, 0x8B, 0x35, 0x2B,
+    0x21, 0x2E, 0x92, 0xC2, 0xEA, 0x21, 0xF2, 0xEA, 0x01, 0x05, 0x22, 0x90, 0x08, 0x51, 0x85, 0x0A,
+    0xC0, 0x82, 0x18, 0x88, 0x43, 0xC9, 0x0E, 0x91, 0x82, 0x13, 0x88, 0x1D, 0x70, 0x50, 0x56, 0xF2,
+    0x60, 0x1E, 0xE2, 0xE9, 0x70, 0x11, 0x38, 0x21, 0x8C, 0x06, 0x0E, 0x08, 0xB4, 0x8D, 0x16, 0x87,
+    0xB9, 0xF5, 0x26, 0xC8, 0xF5, 0x84, 0x09, 0x71, 0xDA, 0x41, 0x93, 0xC4, 0x00, 0xEB, 0x40, 0x84,
+    0xD3, 0x20, 0x14, 0x04, 0x10, 0xA7, 0x21, 0x46, 0x85, 0x1A, 0x02, 0x91, 0xB0, 0x00, 0x73, 0x48,
+    0xAA, 0xAF, 0x07, 0x34, 0xB3, 0x22, 0x18, 0x17, 0x0A, 0x19, 0x00, 0xD0, 0xCC, 0x8C, 0x60, 0x5C,
+    0x28, 0x64, 0x00, 0xB8, 0xA0, 0x1D, 0x4B, 0x4F, 0x39, 0xA7, 0x81, 0x47, 0x34, 0x95, 0xBD, 0xB8,
+    0x9F, 0xBD, 0x89, 0xA2, 0x3D, 0x72, 0x18, 0x09, 0xB2, 0xB7, 0x20, 0x13, 0x49, 0x48, 0x62, 0x04,
+    0x60, 0x00, 0x70, 0xC7, 0x9F, 0x2A, 0x83, 0x99, 0x55, 0x1A, 0x20, 0x0F, 0x11, 0x72, 0xF6, 0x0A,
+    0x40, 0x98, 0x9C, 0x08, 0x99, 0x07, 0x78, 0xB1, 0x03, 0x0A, 0x62, 0x34, 0x54, 0x11, 0x16, 0x80,
+    0x88, 0x04, 0x61, 0x84, 0x02, 0x88, 0x05, 0x99, 0x48, 0x45, 0x48, 0x49, 0x8C, 0x00, 0x36, 0x09,
+    0x17, 0xF7, 0x8E, 0x2F, 0xF7, 0x90, 0x6F, 0xF7, 0x1C, 0xC0, 0xF7, 0xE2, 0xC8, 0xF7, 0xA8, 0xF4,
+    0xF7, 0xC0, 0xE3, 0x9A, 0x7E, 0x48, 0xCC, 0xDE, 0x5E, 0xC5, 0xE0, 0x5E, 0x33, 0x00, 0x0D, 0x50,
+    0x21, 0x20, 0xE5, 0x4F, 0xA9, 0x42, 0x96, 0x20, 0x65, 0x8A, 0x02, 0x20, 0x02, 0x32, 0xE1, 0x08,
+    0x25, 0x46, 0x03, 0x80, 0xC6, 0x20, 0x46, 0x44, 0x20, 0x2E, 0x2C, 0x70, 0xD8, 0x68, 0xF3, 0x31,
+    0x50, 0x0B, 0x89, 0x80, 0x61, 0xB1, 0x14, 0xC0, 0xA1, 0x3B, 0xE9, 0x1E, 0x31, 0xD0, 0x05, 0x60,
+    0x8D, 0x07, 0x62, 0x8D, 0x07, 0x0B, 0x10, 0x0F, 0xE5, 0x62, 0xF7, 0x0E, 0xE4, 0x25, 0x1C, 0x28,
+    0x22, 0x30, 0x21, 0x22, 0xE2, 0x0C, 0xA1, 0xC0, 0x62, 0xDB, 0xF4, 0x5E, 0x9C, 0xF6, 0x1E, 0xD1,
+    0xCC, 0x43, 0x94, 0xE5, 0xBD, 0x02, 0x11, 0x09, 0xA2, 0x0A, 0x05, 0x0E, 0xA5, 0xBB, 0x0C, 0x0A,
+    0x11, 0x20, 0x14, 0x58, 0x10, 0x80, 0xA0, 0x23, 0x74, 0x26, 0xF0, 0xCC, 0x06, 0x23, 0xE2, 0x00,
+    0x16, 0x5D, 0x70, 0x13, 0x38, 0xA4, 0xA0, 0xDF, 0x23, 0x88, 0xC6, 0x8A, 0x10, 0xE3, 0x98, 0x88,
+    0x18, 0x31, 0x82, 0x01, 0x26, 0xA4, 0x1D, 0xA0, 0x11, 0xD6, 0x78, 0x26, 0x2A, 0x22, 0x64, 0x45,
+    0x8A, 0x83, 0x99, 0x70, 0xC0, 0xAD, 0x58, 0x0C, 0xDF, 0x40, 0x1D, 0x1F, 0xB1, 0x1F, 0x9F, 0x11,
+    0x21, 0x1F, 0xEA, 0x26, 0xDF, 0xB2, 0x2A, 0x5F, 0x0B, 0x2E, 0xDF, 0x63, 0x35, 0x1F, 0xC4, 0x45,
+    0x5F, 0xF4, 0x46, 0xDF, 0x84, 0x56, 0x5F, 0x55, 0x5A, 0xDF, 0x85, 0x63, 0x1F, 0x38, 0x10, 0x86,
+    0xE2, 0x98, 0x24, 0x6E, 0xE2, 0x8B, 0xCD, 0xE2, 0x9B, 0x50, 0xE3, 0xA3, 0x7C, 0xE3, 0x13, 0x08,
+    0x62, 0x20, 0x46, 0x45, 0x58, 0x61, 0x59, 0x7A, 0x98, 0x52, 0x21, 0xAC, 0xB0, 0x00, 0x62, 0x44,
+    0x30, 0xA5, 0x42, 0x58, 0x96, 0x9E, 0xA0, 0xC2, 0x0A, 0xE0, 0x90, 0xC0, 0x8C, 0x0F, 0x98, 0x80,
+    0x08, 0x47, 0x84, 0x51, 0x4C, 0x03, 0x07, 0x33, 0xCA, 0x7A, 0x90, 0x76, 0xE0, 0x6A, 0x26, 0x20,
+    0x9A, 0x07, 0x48, 0x40, 0x54, 0x88, 0x88, 0x00, 0x56, 0x86, 0x58, 0xC1, 0x84, 0x92, 0x00, 0x85,
+    0x1C, 0x0C, 0x97, 0xEE, 0x1C, 0xD2, 0x5B, 0xF2, 0x11, 0x0C, 0xD1, 0x4C, 0xC0, 0x84, 0x38, 0xAD,
+    0xE4, 0x05, 0x32, 0xCA, 0x10, 0x88, 0x00, 0xEE, 0x00, 0x73, 0x25, 0xE0, 0xB0, 0xA5, 0x94, 0xCF,
+    0x20, 0x0D, 0x22, 0xB8, 0x00, 0x38, 0xB1, 0x81, 0x08, 0x64, 0xC0, 0x21, 0x09, 0x2D, 0xDF, 0xE0,
+    0x0E, 0x18, 0x49, 0xBE, 0x0E, 0x84, 0x3E, 0x96, 0x16, 0xE5, 0x92, 0xF9, 0x26, 0x9A, 0x09, 0x80,
+    0x08, 0x71, 0x64, 0x86, 0x0A, 0xA4, 0x18, 0x81, 0x0E, 0x38, 0x9C, 0x57, 0x73, 0xA2, 0x22, 0x92,
+    0xA1, 0x02, 0x39, 0xCC, 0x04, 0xB0, 0x48, 0x1E, 0xCE, 0x87, 0xF8, 0xD0, 0x07, 0xC4, 0x03, 0x82,
+    0xC8, 0x0B, 0x11, 0x30, 0x17, 0x11, 0xE1, 0xF9, 0xB4, 0xD7, 0xF9, 0x48, 0x44, 0x31, 0x65, 0x04,
+    0xB0, 0xE8, 0xA2, 0xB2, 0x26, 0xEF, 0xCF, 0xD7, 0x98, 0x8C, 0x62, 0xCA, 0x10, 0xC4, 0x81, 0xC3,
+    0xC9, 0x84, 0x3E, 0x96, 0x51, 0x4C, 0x19, 0xE2, 0x3C, 0x90, 0x51, 0x4C, 0x19, 0xE2, 0x0C, 0xA0,
+    0x01, 0x11, 0x4C, 0x46, 0x14, 0x48, 0x01, 0xE8, 0x41, 0xD3, 0x03, 0xDD, 0x24, 0x21, 0x4E, 0x9F,
+    0x29, 0x50, 0x5F, 0x9B, 0x51, 0x5F, 0x95, 0x54, 0x9F, 0x40, 0x31, 0xD2, 0x04, 0x34, 0x02, 0x69,
+    0x51, 0xC2, 0x28, 0xF6, 0xCE, 0x28, 0x44, 0x05, 0xA0, 0x19, 0x90, 0x07, 0xC1, 0x66, 0xC1, 0x68,
+    0x00, 0xD1, 0xCC, 0x82, 0x42, 0x06, 0x40, 0x0C, 0xC8, 0x83, 0x4C, 0xB8, 0x23, 0x90, 0x25, 0xA2,
+    0x18, 0x0D, 0x20, 0x22, 0x60, 0x55, 0xCC, 0x60, 0x4A, 0x02, 0xE6, 0xE1, 0xBA, 0xB8, 0x00, 0xB1,
+    0x10, 0x0C, 0xD1, 0xCC, 0x8C, 0x14, 0x5E, 0x20, 0x03, 0x2C, 0xA2, 0xE2, 0xF5, 0xC5, 0xFB, 0xF5,
+    0x11, 0x71, 0x81, 0x90, 0xAF, 0x62, 0xD1, 0xC8, 0x87, 0x40, 0x1A, 0xCC, 0x14, 0x2A, 0x80, 0x43,
+    0x32, 0xC4, 0x3E, 0x60, 0x25, 0x04, 0x53, 0x12, 0x00, 0xAC, 0x86, 0x60, 0x4A, 0x02, 0x00, 0x6A,
+    0x25, 0xB0, 0x92, 0xC0, 0xA6, 0xE0, 0x71, 0x1F, 0xA1, 0x73, 0x1F, 0x2A, 0x76, 0x9F, 0x2B, 0x77,
+    0x5F, 0x2C, 0x8A, 0x1F, 0x35, 0x8E, 0x1F, 0x38, 0x64, 0xEC, 0xED, 0x1B, 0x87, 0x2E, 0xB7, 0x7D,
+    0x80, 0xB4, 0x38, 0xAE, 0x21, 0x21, 0x04, 0x2C, 0x8E, 0x6B, 0x28, 0x09, 0x21, 0x80, 0x68, 0x05,
+    0x85, 0x58, 0x7A, 0x60, 0x79, 0x85, 0x1C, 0xC0, 0x71, 0x56, 0x84, 0x82, 0x08, 0x25, 0x70, 0x88,
+    0x42, 0xBF, 0x13, 0x21, 0xE5, 0x40, 0x7B, 0x84, 0xE8, 0xA0, 0x31, 0x62, 0x60, 0xF2, 0xE9, 0xBD,
+    0x2F, 0x2E, 0xBF, 0x8F, 0xE6, 0xC0, 0xCF, 0x66, 0xC4, 0x6F, 0xA1, 0x46, 0x02, 0x4B, 0x0B, 0x50,
+    0x08, 0x82, 0x78, 0x88, 0x48, 0x46, 0xC4, 0x60, 0x0E, 0x38, 0x5C, 0xE9, 0x1D, 0x99, 0xAC, 0x03,
+    0x59, 0x48, 0x04, 0xBD, 0x50, 0xA4, 0x00, 0x0E, 0x97, 0x31, 0xFC, 0x86, 0x75, 0xA8, 0x5F, 0xE1,
+    0xD7, 0x12, 0xD2, 0x22, 0x7B, 0x80, 0x84, 0xB4, 0x80, 0x71, 0xD8, 0x3A, 0x0F, 0x43, 0x34, 0x33,
+    0x81, 0xEC, 0x01, 0x20, 0xED, 0xA0, 0xF4, 0x20, 0xE6, 0x10, 0x49, 0xC6, 0x8F, 0x00, 0x54, 0x82,
+    0x08, 0x18, 0x68, 0x14, 0x62, 0x44, 0x30, 0x82, 0xC1, 0xE1, 0x6C, 0x90, 0x5F, 0x44, 0x1A, 0x98,
+    0x09, 0xE0, 0xD0, 0x6D, 0xC9, 0x6F, 0x70, 0x1A, 0x5B, 0x70, 0x09, 0x30, 0x58, 0xAD, 0x61, 0xA1,
+    0x4B, 0xC0, 0xE7, 0x18, 0x9B, 0x1F, 0xB9, 0x9C, 0x9F, 0xA1, 0xA3, 0x1F, 0x43, 0xBD, 0x5F, 0xFB,
+    0xCE, 0x9F, 0x6B, 0xD8, 0xDF, 0xAC, 0xDA, 0x9F, 0x38, 0x68, 0xD8, 0x9F, 0x43, 0x44, 0xC0, 0x2A,
+    0x08, 0x25, 0x01, 0x79, 0x11, 0x19, 0xD0, 0x8F, 0xF6, 0xD0, 0x8F, 0x18, 0x11, 0x41, 0xE4, 0xB0,
+    0x80, 0xC6, 0x54, 0x04, 0x91, 0x05, 0x71, 0x40, 0x44, 0x2A, 0x82, 0xC8, 0xCC, 0x04, 0x70, 0xD8,
+    0xFC, 0xE9, 0x87, 0x34, 0x48, 0x81, 0x08, 0x40, 0x33, 0x43, 0x88, 0xA8, 0x42, 0x15, 0x32, 0xC0,
+    0x21, 0xEA, 0xB0, 0x5F, 0x81, 0x0E, 0x49, 0x7C, 0xFD, 0xC4, 0x21, 0x7A, 0xAD, 0x1F, 0xD0, 0xCC,
+    0x0A, 0x51, 0x85, 0x2A, 0x64, 0x00, 0x40, 0x33, 0x33, 0x44, 0x15, 0xAA, 0x90, 0x01, 0xC8, 0x06,
+    0x51, 0x45, 0x38, 0xE0, 0x70, 0xEE, 0xDC, 0xAF, 0x1C, 0xA2, 0x4F, 0xFB, 0x01, 0x42, 0x33, 0x1B,
+    0x84, 0x2A, 0x64, 0x80, 0x43, 0x83, 0x70, 0x3F, 0x81, 0x68, 0xA6, 0x05, 0x47, 0x14, 0x32, 0x52,
+    0x03, 0x80, 0x66, 0x36, 0xA8, 0x42, 0x06, 0xE0, 0xC4, 0x43, 0x8C, 0x50, 0x15, 0x84, 0x90, 0x19,
+    0x65, 0x20, 0x23, 0xC2, 0x01, 0x93, 0x08, 0x09, 0x7F, 0xCC, 0x16, 0x7F, 0xEF, 0x1D, 0x7F, 0x74,
+    0x36, 0x7F, 0xC0, 0x02, 0xC4, 0x06, 0x91, 0x8A, 0x01, 0xD6, 0x21, 0x9A, 0xC4, 0x1F, 0x38, 0x88,
+    0x82, 0xF6, 0x01, 0xC4, 0x84, 0x62, 0x00, 0x64, 0x01, 0x62, 0x84, 0x48, 0xC5, 0x80, 0xC5, 0xB5,
+    0x97, 0x3F, 0x3C, 0xF5, 0x32, 0x64, 0x41, 0x0A, 0x84, 0x18, 0x19, 0x49, 0x54, 0x11, 0x16, 0x58,
+    0x20, 0xC7, 0x8B, 0x40, 0x32, 0x13, 0xB3, 0xCC, 0x03, 0x80, 0xC4, 0xA1, 0x45, 0x23, 0xA4, 0x3F,
+    0xD9, 0xAC, 0x3F, 0x81, 0x1C, 0x44, 0x17, 0xF9, 0x1C, 0xCA, 0x56, 0xFD, 0x91, 0xC3, 0xC5, 0x8D,
+    0x87, 0xD1, 0xE0, 0x48, 0x58, 0xE0, 0xC0, 0x5D, 0x8A, 0x02, 0x29, 0x08, 0xC7, 0xD2, 0x23, 0x88,
+    0x0A, 0x40, 0x83, 0x48, 0x33, 0x23, 0x0B, 0x44, 0xC4, 0x19, 0xC0, 0xB2, 0x1A, 0x86, 0x48, 0x09,
+    0x00, 0x07, 0x93, 0x11, 0x03, 0x8B, 0x68, 0x8B, 0x7F, 0x0E, 0x99, 0x7F, 0x00, 0x65, 0x4C, 0x44,
+    0x74, 0x38, 0x94, 0x44, 0x3A, 0xE0, 0x08, 0x06, 0x22, 0x76, 0x02, 0x38, 0x7C, 0xA0, 0xFC, 0x33,
+    0x07, 0x67, 0xBC, 0x23, 0x1E, 0x1C, 0x10, 0x4C, 0x03, 0x07, 0x56, 0xFA, 0x01, 0x08, 0x60, 0x99,
+    0x90, 0xC6, 0x54, 0xA4, 0x21, 0x88, 0x03, 0xC8, 0xA1, 0x0C, 0xEE, 0x1F, 0xA1, 0x0E, 0xB5, 0x6A,
+    0xFF, 0x64, 0x42, 0xC1, 0x07, 0x24, 0x14, 0x0C, 0x90, 0x82, 0x90, 0x03, 0x38, 0x2D, 0x6E, 0xFF,
+    0x43, 0xAC, 0xFF, 0x5B, 0x14, 0x00, 0x64, 0x75, 0x01, 0x7C, 0x71, 0x02, 0x8C, 0x27, 0x03, 0x9C,
+    0xDB, 0x03, 0xA4, 0x47, 0x04, 0xAC, 0x9F, 0x05, 0x14, 0x87, 0x08, 0xE6, 0x7F, 0xC0, 0x82, 0x48,
+    0x2C, 0x42, 0x94, 0x24, 0xCE, 0x03, 0x26, 0x84, 0x90, 0x0D, 0x61, 0x88, 0x70, 0x00, 0x0B, 0x88,
+    0x48, 0xC3, 0xB8, 0xC5, 0x04, 0x70, 0x28, 0x60, 0x78, 0xB2, 0x0C, 0x44, 0x24, 0x2B, 0xD2, 0x12,
+    0xC1, 0x1C, 0xF0, 0x48, 0xA4, 0x1F, 0x80, 0x4E, 0x01, 0x48, 0xAB, 0x02, 0x08, 0x4C, 0x40, 0x84,
+    0x23, 0xC4, 0x28, 0xA6, 0x81, 0x45, 0x11, 0x65, 0xAD, 0xC5, 0x11, 0xC0, 0x81, 0x88, 0x64, 0xC4,
+    0x12, 0xC1, 0x1C, 0x00, 0x81, 0x28, 0xDC, 0x80, 0x34, 0x6B, 0xE0, 0x00, 0x1C, 0x48, 0x62, 0x71,
+    0xAE, 0x07, 0xD0, 0xBA, 0x08, 0x90, 0x38, 0x2C, 0x60, 0x36, 0x5C, 0x58, 0x06, 0x80, 0x30, 0x84,
+    0x8C, 0x08, 0x43, 0xBC, 0x70, 0x80, 0x83, 0x88, 0x48, 0x44, 0xB8, 0x30, 0x98, 0x00, 0x9C, 0x43,
+    0xF6, 0x2E, 0x40, 0x44, 0x00, 0x26, 0x62, 0x44, 0x9C, 0x21, 0x54, 0x19, 0x61, 0x01, 0x4E, 0x44,
+    0x1A, 0xD0, 0x43, 0x26, 0x80, 0xC3, 0x28, 0x37, 0x40, 0x81, 0x1C, 0x44, 0xB1, 0x91, 0x70, 0xA8,
+    0x66, 0x40, 0x1A, 0x53, 0xC2, 0x8C, 0x41, 0x8C, 0x2C, 0x41, 0x1C, 0x38, 0xC4, 0x27, 0x04, 0x8C,
+    0x70, 0xC3, 0x40, 0xA6, 0x81, 0x83, 0x68, 0x40, 0xC0, 0xC9, 0x91, 0x54, 0x8F, 0x06, 0x4E, 0xC0,
+    0x98, 0x52, 0xC0, 0xDA, 0x56, 0xC0, 0x65, 0x34, 0x40, 0xC4, 0xD2, 0x02, 0xA6, 0x08, 0x10, 0x54,
+    0xC4, 0x1A, 0xA6, 0x28, 0x0C, 0x4C, 0x07, 0x11, 0xB5, 0x8A, 0x01, 0x83, 0x21, 0x00, 0xD1, 0xA0,
+    0x03, 0x02, 0x3A, 0x0A, 0xE4, 0x30, 0xDE, 0x17, 0x10, 0x99, 0x64, 0x83, 0x08, 0xE3, 0x80, 0x43,
+    0x84, 0x64, 0x40, 0x02, 0x31, 0x07, 0xED, 0xB6, 0x2D, 0x8C, 0x76, 0x38, 0x61, 0x0D, 0x88, 0x4C,
+    0xB8, 0x22, 0x08, 0x47, 0x46, 0x03, 0x70, 0x44, 0x10, 0x8E, 0x8C, 0x06, 0x26, 0x09, 0xF3, 0x01,
+    0x1D, 0x2A, 0x03, 0x9F, 0x6A, 0x03, 0xE3, 0x7C, 0x03, 0xC1, 0x21, 0x9A, 0x3C, 0x20, 0x39, 0x10,
+    0x79, 0x06, 0xD0, 0x20, 0xD2, 0x89, 0x20, 0xE2, 0x40, 0x30, 0x29, 0xC2, 0x10, 0x88, 0xD2, 0x17,
+    0xD8, 0x38, 0x18, 0x18, 0xC9, 0x18, 0x08, 0x08, 0x27, 0x21, 0x28, 0x08, 0x16, 0x0B, 0x8B, 0xF7,
+    0xA6, 0x8C, 0x02, 0xD1, 0x62, 0x09, 0x4B, 0x20, 0x7B, 0x50, 0x20, 0xB0, 0x2C, 0x48, 0x46, 0x8C,
+    0x08, 0x71, 0xC2, 0xB2, 0xF4, 0xC4, 0xA0, 0x44, 0x49, 0x22, 0x87, 0x05, 0x0E, 0xF5, 0x72, 0x02,
+    0xD1, 0xA1, 0xA0, 0xEA, 0x00, 0x3E, 0x40, 0xA3, 0x93, 0x0A, 0x10, 0xCA, 0xD2, 0x13, 0x83, 0x12,
+    0xB5, 0x01, 0x40, 0x2B, 0x08, 0x04, 0x3C, 0xBA, 0x93, 0x05, 0x4A, 0xB5, 0x05, 0xD2, 0xE3, 0x05,
+    0x02, 0xF4, 0x70, 0xA9, 0x2B, 0x50, 0x58, 0x80, 0x18, 0xA1, 0x58, 0x2A, 0x06, 0x00, 0x22, 0x19,
+    0xA1, 0x58, 0x2A, 0xE6, 0x00, 0x46, 0x04, 0xB0, 0x08, 0x83, 0x9C, 0x29, 0x0F, 0x54, 0x94, 0x13,
+    0x83, 0x1A, 0xC7, 0xD2, 0xC0, 0x63, 0x50, 0xE3, 0x00, 0xAC, 0xC0, 0xB0, 0x07, 0x08, 0x84, 0x6C,
+    0x50, 0x22, 0x1C, 0x60, 0x70, 0xA8, 0x58, 0x91, 0x02, 0x59, 0x88, 0x19, 0x80, 0x01, 0x26, 0x27,
+    0x73, 0x07, 0xE0, 0x65, 0x02, 0x8B, 0xAD, 0xA1, 0x81, 0x4E, 0xAE, 0x81, 0x80, 0x40, 0x1A, 0x8A,
+    0x0A, 0x60, 0x51, 0x8A, 0xF1, 0x62, 0xFE, 0xE6, 0x2F, 0x73, 0x62, 0xC2, 0x41, 0x06, 0x68, 0x0A,
+    0x6A, 0x1D, 0xAC, 0xD3, 0x04, 0x20, 0x84, 0x83, 0x90, 0x15, 0x21, 0x28, 0x18, 0x0E, 0x38, 0x44,
+    0xA8, 0x0E, 0x24, 0x8B, 0x22, 0xD0, 0x81, 0x83, 0x8A, 0x4C, 0xC0, 0x40, 0x0E, 0x86, 0x72, 0x0F,
+    0x9C, 0x86, 0x10, 0x14, 0x04, 0x87, 0x73, 0xE3, 0x81, 0x11, 0x32, 0x51, 0xC0, 0xEA, 0x10, 0x46,
+    0x0C, 0x56, 0x12, 0x40, 0x01, 0xAB, 0x42, 0x18, 0x31, 0x58, 0x49, 0x00, 0x40, 0x45, 0xA4, 0x81,
+    0x15, 0x13, 0xC0, 0x28, 0x59, 0x98, 0x20, 0xBA, 0x9D, 0xE0, 0xCA, 0xA5, 0x60, 0x0B, 0xA7, 0xA0,
+    0x4B, 0xA8, 0x60, 0x74, 0xB4, 0xA0, 0xE4, 0x1E, 0x0C, 0x65, 0xDE, 0x20, 0x98, 0x0C, 0xBE, 0x43,
+    0x6A, 0x24, 0x11, 0x8C, 0x9B, 0x11, 0x9C, 0x8D, 0x12, 0x44, 0x87, 0xAE, 0x46, 0x1E, 0xCD, 0x42,
+    0x10, 0xB2, 0xE0, 0x1C, 0x70, 0x68, 0xDE, 0x22, 0x38, 0x80, 0x83, 0x78, 0x70, 0x16, 0xA4, 0xC1,
+    0x14, 0xE2, 0x02, 0x30, 0x11, 0xE6, 0x10, 0x8B, 0x49, 0x10, 0x1D, 0x92, 0x13, 0x09, 0x8A, 0x0C,
+    0x53, 0x46, 0x70, 0x42, 0x01, 0xB2, 0xC3, 0x94, 0x11, 0x9C, 0x08, 0x07, 0x54, 0x98, 0x32, 0x82,
+    0x6B, 0xE0, 0x90, 0x75, 0x5C, 0x80, 0x60, 0x87, 0xA0, 0x61, 0x31, 0x04, 0x33, 0xC9, 0x04, 0x32,
+    0x0E, 0x10, 0x0F, 0x5D, 0xDA, 0x04, 0x11, 0x67, 0x90, 0x0D, 0x48, 0xAC, 0x03, 0x4C, 0xD8, 0x43,
+    0xC8, 0x8A, 0x80, 0x46, 0x8B, 0xE1, 0x80, 0xC5, 0x16, 0x42, 0xC1, 0x98, 0x46, 0xC1, 0x85, 0x92,
+    0x0D, 0x2D, 0xB1, 0x03, 0x18, 0x44, 0x33, 0x2B, 0x8C, 0x20, 0x2E, 0x90, 0x01, 0x1E, 0x50, 0x28,
+    0xBD, 0x5A, 0x53, 0x63, 0xE2, 0x69, 0x02, 0x60, 0x24, 0xA1, 0xA5, 0x00, 0x00, 0x23, 0xA1, 0x90,
+    0x05, 0x26, 0x9B, 0x68, 0x05, 0xDF, 0xE3, 0x14, 0x62, 0x72, 0x05, 0x71, 0x58, 0x6F, 0x18, 0x40,
+    0x1C, 0x1C, 0xDE, 0x52, 0x30, 0x09, 0x06, 0x11, 0x07, 0x16, 0x91, 0x89, 0x05, 0x9B, 0x91, 0x05,
+    0xC9, 0x01, 0x42, 0x0E, 0xC0, 0x81, 0x6C, 0x15, 0x15, 0xC2, 0x90, 0x66, 0x86, 0x41, 0xC4, 0x85,
+    0x33, 0xC0, 0x24, 0x91, 0xC3, 0x20, 0x9A, 0xD3, 0x60, 0x0B, 0xA7, 0x20, 0xE5, 0xD8, 0x20, 0x58,
+    0x34, 0xC1, 0x17, 0x9C, 0x0D, 0x18, 0x1C, 0x08, 0x73, 0x88, 0x41, 0x2F, 0x88, 0x10, 0xB2, 0x62,
+    0x04, 0x27, 0xC2, 0x01, 0x0D, 0x23, 0xB8, 0x06, 0x0E, 0x91, 0xC9, 0xB7, 0x8E, 0x99, 0x20, 0x1C,
+    0x1C, 0x00, 0x60, 0x20, 0x02, 0xB0, 0x2C, 0xB8, 0x23, 0x38, 0xA1, 0x4A, 0x4A, 0x0D, 0x2C, 0x1A,
+    0x87, 0x0C, 0xB6, 0x9D, 0x0C, 0x12, 0xCC, 0x82, 0x34, 0x48, 0x63, 0x3A, 0xCA, 0x4B, 0x82, 0x08,
+    0xE2, 0x80, 0xE9, 0x24, 0x10, 0x37, 0x20, 0x78, 0x74, 0x08, 0x25, 0x99, 0x2B, 0x1A, 0xA4, 0x53,
+    0x1A, 0x34, 0x87, 0xB3, 0x3D, 0x83, 0x67, 0x61, 0xE2, 0x35, 0x4A, 0xE3, 0x35, 0x0A, 0xD1, 0x10,
+    0xA3, 0x01, 0x06, 0x12, 0x16, 0x60, 0x9C, 0x04, 0x37, 0x20, 0x38, 0x70, 0x11, 0x5E, 0x5B, 0x34,
+    0xFA, 0x87, 0x51, 0xE4, 0x1A, 0x14, 0x26, 0x44, 0x9A, 0x09, 0xE1, 0x0C, 0x80, 0x58, 0x70, 0x82,
+    0x20, 0x2E, 0x35, 0x70, 0x68, 0x0A, 0x37, 0x28, 0x4C, 0x74, 0x01, 0xBC, 0xCF, 0x81, 0xD0, 0x82,
+    0xE2, 0xD0, 0x10, 0x90, 0x6C, 0x21, 0x05, 0x2E, 0x05, 0x30, 0x29, 0xD6, 0x38, 0x38, 0x66, 0x39,
+    0x68, 0x06, 0x3A, 0x18, 0xAD, 0x3A, 0x18, 0x04, 0x4E, 0x3C, 0x68, 0x30, 0xFB, 0x32, 0x51, 0x11,
+    0xA9, 0x30, 0x4C, 0x0D, 0x66, 0x02, 0x78, 0x18, 0xC7, 0x8B, 0x40, 0x80, 0x25, 0x6A, 0x33, 0x87,
+    0x61, 0x2C, 0x48, 0x63, 0x32, 0x0C, 0x73, 0x2E, 0x09, 0xE2, 0x00, 0x61, 0xA2, 0xE2, 0x21, 0x71,
+    0xEE, 0x20, 0xB0, 0x3A, 0x0C, 0x53, 0x83, 0x99, 0x92, 0x40, 0x86, 0x61, 0x6A, 0x30, 0x13, 0xC0,
+    0xA9, 0xD0, 0x1C, 0xE1, 0x00, 0x68, 0x61, 0xE9, 0x69, 0xA1, 0x49, 0x72, 0x21, 0xE3, 0x73, 0x61,
+    0x7B, 0x75, 0xE1, 0x3B, 0x77, 0x61, 0x4C, 0xA6, 0xA1, 0x94, 0xD2, 0x61, 0xD8, 0x4C, 0xB2, 0x1F,
+    0x64, 0x0D, 0x20, 0x7C, 0x47, 0x20, 0x94, 0x95, 0x20, 0x9C, 0xBA, 0x22, 0xA4, 0x59, 0x23, 0x1C,
+    0x90, 0x0A, 0x1D, 0x48, 0x71, 0x0E, 0xA0, 0x06, 0x03, 0x98, 0x10, 0xA7, 0x65, 0xB8, 0x32, 0x04,
+    0x22, 0x00, 0x20, 0x1C, 0x0D, 0x29, 0x10, 0x24, 0x00, 0x84, 0x80, 0x10, 0xB2, 0xE2, 0xC4, 0xA0,
+    0x44, 0x38, 0x60, 0x11, 0xA6, 0x84, 0x70, 0xB2, 0x85, 0x10, 0x19, 0x87, 0x60, 0xEA, 0x11, 0x14,
+    0x10, 0x0F, 0xF0, 0x01, 0x24, 0x50, 0x44, 0x33, 0x23, 0x82, 0x66, 0x81, 0x0C, 0xB0, 0x88, 0x7C,
+    0x44, 0x18, 0x05, 0x45, 0x08, 0x16, 0xC5, 0xB1, 0x54, 0xA6, 0x81, 0x08, 0xDB, 0x81, 0x78, 0xB9,
+    0x0D, 0x04, 0x58, 0x0D, 0x64, 0x88, 0x92, 0x80, 0x89, 0x2E, 0x0C, 0x34, 0xBC, 0x10, 0x11, 0x0E,
+    0x00, 0x84, 0x59, 0x31, 0x4C, 0x51, 0x03, 0x1C, 0x92, 0x93, 0x11, 0x02, 0x8D, 0x40, 0xC8, 0x8A,
+    0x33, 0x0A, 0x51, 0xE1, 0x00, 0x51, 0x04, 0x0E, 0x1A, 0xDB, 0x1C, 0x44, 0x01, 0x15, 0x05, 0x40,
+    0x8B, 0x28, 0x04, 0x2C, 0x12, 0x98, 0x13, 0x22, 0x3C, 0x16, 0x8A, 0x45, 0xF2, 0x4A, 0x42, 0x19,
+    0x72, 0x36, 0x81, 0x1C, 0xCA, 0x3B, 0x12, 0x12, 0x03, 0x31, 0x2A, 0x42, 0x58, 0x61, 0x01, 0x12,
+    0x21, 0x2B, 0xC2, 0x39, 0xE1, 0x80, 0x43, 0x49, 0x55, 0xC2, 0xB1, 0x38, 0x4E, 0x85, 0x23, 0x71,
+    0x4A, 0x48, 0x8C, 0x84, 0xB0, 0xC2, 0x02, 0x05, 0x61, 0x1D, 0xB0, 0x88, 0xAE, 0x4C, 0x28, 0x1F,
+    0x4D, 0x58, 0x50, 0x6B, 0x11, 0x2F, 0x98, 0x50, 0xDB, 0x98, 0x70, 0xC1, 0x11, 0xA7, 0xB2, 0x94,
+    0x1A, 0x68, 0x38, 0x95, 0xA5, 0xD4, 0x40, 0xC3, 0xA9, 0x2C, 0x81, 0x05, 0x57, 0x8A, 0x8F, 0xEA,
+    0x52, 0x83, 0x43, 0x8A, 0x6F, 0xC2, 0x82, 0x5A, 0x0B, 0x8B, 0xB8, 0x07, 0xD8, 0xAC, 0x03, 0x96,
+    0x05, 0x37, 0x54, 0x96, 0x52, 0x03, 0x87, 0x92, 0x0C, 0x85, 0xC4, 0x78, 0x44, 0xE1, 0x27, 0x94,
+    0x1D, 0x28, 0xD4, 0x43, 0x28, 0x24, 0x46, 0x84, 0x0A, 0x61, 0x85, 0x05, 0x34, 0xA6, 0x42, 0x85,
+    0xB0, 0x04, 0x71, 0xA0, 0x41, 0x85, 0xB0, 0x0E, 0x68, 0x50, 0x21, 0x2C, 0xB0, 0x88, 0x28, 0x53,
+    0x28, 0xA1, 0x53, 0x58, 0x50, 0x6B, 0x11, 0xAB, 0xA4, 0x50, 0x93, 0xA5, 0x70, 0xC1, 0x19, 0x2A,
+    0x9C, 0x53, 0x59, 0x4A, 0x0D, 0x54, 0xA8, 0x70, 0x4E, 0x65, 0x29, 0x35, 0x50, 0xA1, 0xC2, 0x39,
+    0x95, 0x25, 0xC0, 0x69, 0x11, 0x2A, 0x9C, 0x23, 0x10, 0x01, 0x93, 0xC5, 0x4D, 0x85, 0xC8, 0x6E,
+    0x85, 0xEE, 0x80, 0x85, 0xFA, 0x8A, 0x85, 0x84, 0x8C, 0x50, 0xE1, 0x9C, 0x70, 0x00, 0x6A, 0x2D,
+    0x62, 0x78, 0x14, 0x6A, 0xA3, 0x15, 0xAE, 0x43, 0x6D, 0xB1, 0x42, 0xDC, 0xA1, 0xC2, 0x39, 0x95,
+    0xA5, 0xD4, 0x40, 0x87, 0x0A, 0xE7, 0x54, 0x96, 0x40, 0x86, 0x0A, 0xE7, 0x54, 0x96, 0xC0, 0x61,
+    0x8D, 0x5E, 0xA1, 0xD3, 0x2A, 0x54, 0x38, 0x47, 0x20, 0x02, 0x90, 0x0A, 0x15, 0xCE, 0x11, 0x33,
+    0x80, 0xC3, 0xC9, 0xC2, 0xC2, 0x18, 0xA1, 0xC2, 0x39, 0xC8, 0x80, 0x06, 0x15, 0xCE, 0x01, 0xC6,
+    0x21, 0x4A, 0x66, 0x21, 0x69, 0x10, 0x4A, 0xAC, 0x00, 0x00, 0xAB, 0x42, 0x28, 0xB1, 0x4A, 0x02,
+    0x88, 0x66, 0x46, 0x0C, 0xB6, 0x02, 0x19, 0x40, 0x39, 0x44, 0xF8, 0x2D, 0x24, 0xE2, 0x61, 0x04,
+    0x6E, 0x21, 0x60, 0x90, 0x08, 0x53, 0x5C, 0x00, 0x0B, 0x24, 0x1E, 0x00, 0x08, 0x13, 0x03, 0xC4,
+    0x21, 0xEA, 0x6F, 0x02, 0xD1, 0x0E, 0x66, 0xA6, 0x64, 0x10, 0xD2, 0x4C, 0x70, 0xE1, 0x0C, 0x00,
+    0x88, 0x70, 0xC2, 0x2B, 0xA6, 0x01, 0xC6, 0x02, 0xC8, 0x03, 0x32, 0x8F, 0xB4, 0xCB, 0xD3, 0x04,
+    0xC3, 0xC5, 0x0C, 0x43, 0x07, 0x13, 0xC3, 0x37, 0x1B, 0xC3, 0x18, 0x35, 0x43, 0x22, 0x1E, 0xA2,
+    0x10, 0x18, 0x0A, 0xE4, 0x90, 0xA4, 0xBF, 0x70, 0x20, 0x0D, 0x27, 0xAC, 0x00, 0x0C, 0xC4, 0xA8,
+    0x38, 0x61, 0x85, 0x05, 0x34, 0xF3, 0x80, 0xE4, 0xCA, 0x04, 0x22, 0x4D, 0x88, 0x00, 0x4C, 0xC4,
+    0x68, 0x41, 0x11, 0x8A, 0x33, 0x84, 0x2A, 0x23, 0x2C, 0x00, 0x61, 0x88, 0x66, 0x22, 0x46, 0x47,
+    0x4C, 0xE1, 0x05, 0x32, 0xC2, 0x02, 0xE4, 0x21, 0xE2, 0x8B, 0x21, 0x49, 0x88, 0xE8, 0x04, 0xA0,
+    0x31, 0x11, 0x11, 0x1D, 0x41, 0x1C, 0x58, 0x74, 0xCE, 0x32, 0xC4, 0xD8, 0x0F, 0x58, 0x87, 0x28,
+    0x4D, 0x86, 0x00, 0x43, 0x34, 0x13, 0x31, 0x32, 0xC2, 0x0B, 0x64, 0x84, 0x05, 0x10, 0x0C, 0xD1,
+    0x4C, 0x48, 0x63, 0x42, 0xC2, 0x0B, 0x64, 0x08, 0xE2, 0xC0, 0x21, 0xB1, 0x24, 0x81, 0x3C, 0x94,
+    0x46, 0x9E, 0x40, 0x1A, 0x63, 0xC1, 0x11, 0x61, 0xA5, 0x06, 0x16, 0x49, 0xF8, 0x0C, 0xD1, 0x04,
+    0x0D, 0x01, 0x49, 0x42, 0x1A, 0xD3, 0x61, 0x62, 0x39, 0x47, 0x10, 0x07, 0x48, 0xB2, 0x21, 0x9A,
+    0x70, 0x0E, 0x38, 0xCC, 0x38, 0x34, 0x94, 0x87, 0x08, 0x91, 0x86, 0x24, 0xC2, 0x44, 0x23, 0x4E,
+    0x00, 0x1A, 0x93, 0x61, 0xA2, 0x11, 0x47, 0x10, 0x07, 0x2E, 0x97, 0x27, 0xA6, 0x9C, 0x5D, 0x0D,
+    0x9F, 0x6B, 0x0D, 0xA3, 0xA8, 0x0D, 0xEB, 0x59, 0x0E, 0x0B, 0x81, 0x14, 0x14, 0x15, 0x00, 0xAA,
+    0x19, 0x0D, 0x06, 0x31, 0xB2, 0xC0, 0x61, 0x34, 0xB1, 0xE1, 0x02, 0x34, 0x13, 0x31, 0x3A, 0x62,
+    0x4C, 0x85, 0x8C, 0xB0, 0xC0, 0x21, 0x12, 0xB4, 0x21, 0x21, 0xC9, 0x8A, 0x18, 0x4D, 0x38, 0x07,
+    0x1C, 0xE4, 0x8F, 0xBD, 0x2C, 0xBA, 0x13, 0x1C, 0x52, 0x84, 0x1C, 0x92, 0xC3, 0x27, 0x78, 0xC3,
+    0x66, 0x20, 0x46, 0x04, 0x62, 0x64, 0x85, 0x65, 0xE9, 0x61, 0xC6, 0x04, 0xB2, 0x82, 0x09, 0x0B,
+    0x1C, 0xCE, 0x00, 0x1C, 0x12, 0x13, 0x32, 0x21, 0x0E, 0x25, 0x3B, 0x86, 0x18, 0x02, 0xB1, 0x03,
+    0xA0, 0x03, 0x57, 0x2B, 0x9E, 0x43, 0x4A, 0x88, 0xC3, 0x66, 0x20, 0x46, 0x03, 0x23, 0x2B, 0x2C,
+    0x60, 0x1C, 0x22, 0x6B, 0x1C, 0x12, 0x23, 0x81, 0xAC, 0xB0, 0x80, 0xC6, 0x34, 0x90, 0x25, 0x88,
+    0x03, 0x9A, 0x81, 0x88, 0x90, 0xC6, 0x74, 0x04, 0xB2, 0x82, 0x11, 0xC4, 0x81, 0x43, 0x44, 0xA1,
+    0x43, 0x72, 0x88, 0xC5, 0x78, 0x81, 0xAC, 0xC3, 0x75, 0x4F, 0x02, 0xA2, 0x11, 0x48, 0x43, 0x2A,
+    0x44, 0x05, 0xA0, 0x2E, 0x10, 0x34, 0x5E, 0xA0, 0x75, 0x00, 0x1C, 0xBE, 0x77, 0x1D, 0x12, 0xCF,
+    0x3C, 0x44, 0xA8, 0x3A, 0x04, 0x82, 0x85, 0x64, 0xA8, 0x10, 0x87, 0x90, 0x29, 0x00, 0xE4, 0xA0,
+    0x51, 0x52, 0xE7, 0x91, 0x28, 0xEE, 0x10, 0xD9, 0xEE, 0x70, 0x6E, 0xF0, 0x10, 0x1C, 0x10, 0xCD,
+    0x72, 0x78, 0xE6, 0xC1, 0xB9, 0x27, 0xC1, 0xE1, 0xDC, 0xDF, 0x21, 0x3B, 0x40, 0x1D, 0x8C, 0x39,
+    0x38, 0x35, 0x8E, 0x81, 0x08, 0xA7, 0x41, 0x0C, 0x05, 0xC1, 0x65, 0x33, 0xF2, 0xE1, 0x3B, 0x01,
+    0x62, 0x74, 0x06, 0xA2, 0xA4, 0x07, 0xE2, 0x74, 0x0B, 0x22, 0x3B, 0x64, 0xF2, 0x3D, 0x24, 0xE6,
+    0xE1, 0xAC, 0xED, 0x61, 0x3C, 0xC4, 0x8F, 0x3D, 0x44, 0x04, 0x60, 0x65, 0xBC, 0x30, 0x8C, 0x50,
+    0x25, 0x81, 0x86, 0x17, 0x86, 0x69, 0x40, 0x84, 0x88, 0x8A, 0x17, 0x86, 0x11, 0x0A, 0x20, 0xA6,
+    0x78, 0x88, 0x6A, 0xC1, 0x01, 0xAC, 0x02, 0xA1, 0xC0, 0xA3, 0xA8, 0xF6, 0xA1, 0xAB, 0xFA, 0xE1,
+    0x23, 0xFF, 0x21, 0x60, 0x38, 0x94, 0x41, 0x12, 0x1C, 0x0B, 0x40, 0xE4, 0x34, 0x48, 0x06, 0x4C,
+    0x88, 0xD3, 0x4A, 0xA0, 0x41, 0x44, 0xE4, 0x32, 0x04, 0x22, 0x40, 0x3B, 0xC4, 0xBE, 0x3F, 0x74,
+    0x18, 0x87, 0x92, 0x11, 0xED, 0x21, 0x76, 0x00, 0x76, 0xD0, 0x4E, 0x13, 0xE0, 0x70, 0x1A, 0x5C,
+    0xF1, 0x22, 0x44, 0xA4, 0x81, 0x43, 0xB6, 0x08, 0xC4, 0x03, 0x5B, 0x16, 0x44, 0x46, 0x88, 0x24,
+    0x0E, 0x30, 0x39, 0x8C, 0xAC, 0x78, 0x71, 0xA0, 0x77, 0x00, 0x70, 0xF0, 0x10, 0x16, 0x84, 0x01,
+    0x26, 0x44, 0x00, 0x96, 0x05, 0x87, 0x8C, 0xF0, 0xCA, 0x10, 0xAA, 0xA4, 0xD4, 0xC0, 0xE1, 0xD2,
+    0x0D, 0x22, 0xC1, 0x12, 0xCE, 0x08, 0x0F, 0x20, 0x0D, 0xA3, 0xA5, 0x00, 0x2E, 0x4F, 0xAA, 0x10,
+    0x97, 0xC4, 0x10, 0x23, 0xE9, 0x10, 0xA7, 0xF5, 0x10, 0x6F, 0x0F, 0x11, 0x03, 0x40, 0x10, 0x5C,
+    0x05, 0x92, 0x45, 0x29, 0x04, 0x0E, 0x27, 0xBC, 0x10, 0x1B, 0xDD, 0x00, 0x0B, 0x01, 0x74, 0x03,
+    0x2C, 0x03, 0x2C, 0xA2, 0xBB, 0x21, 0x2A, 0xD1, 0x45, 0x11, 0xCA, 0x48, 0xC0, 0x61, 0x01, 0x4E,
+    0x6C, 0x10, 0x09, 0x19, 0xC0, 0x20, 0xE6, 0xC1, 0x04, 0x6E, 0xE1, 0xE1, 0xEC, 0x20, 0xA2, 0xE3,
+    0x0A, 0x06, 0x42, 0xE0, 0xC0, 0xB1, 0xD5, 0x03, 0xD0, 0x38, 0xEC, 0x10, 0xAF, 0x12, 0x11, 0x11,
+    0x15, 0x88, 0xA0, 0x27, 0x14, 0x88, 0x40, 0x04, 0xBD, 0x06, 0x3E, 0x05, 0x8B, 0x11, 0x97, 0x0F,
+    0x12, 0x19, 0x50, 0x12, 0x5B, 0xDB, 0x12, 0x9F, 0x3D, 0x13, 0x23, 0x58, 0x13, 0xE5, 0xEE, 0x13,
+    0xC1, 0x21, 0x1B, 0x2F, 0xA2, 0x70, 0x10, 0xA3, 0xA2, 0x30, 0x07, 0x07, 0xF0, 0x2C, 0xC0, 0x44,
+    0x32, 0x5E, 0x4C, 0x65, 0x04, 0x70, 0xD8, 0xF6, 0x8F, 0x78, 0x0E, 0x5B, 0xC8, 0x11, 0xD1, 0x61,
+    0xC3, 0x36, 0xA2, 0x80, 0x00, 0x2D, 0x82, 0x08, 0x25, 0x0A, 0x01, 0x10, 0x88, 0x22, 0x64, 0x06,
+    0x11, 0x9A, 0x85, 0x03, 0x16, 0xDB, 0xE5, 0x11, 0xDD, 0xF3, 0x11, 0x91, 0x09, 0x01, 0x5A, 0x83,
+    0x12, 0x85, 0x00, 0xCE, 0xE2, 0x98, 0x03, 0x0C, 0x43, 0x06, 0x8B, 0x39, 0xC0, 0x01, 0x5C, 0x80,
+    0x08, 0xC0, 0x8A, 0x80, 0x44, 0xA8, 0x92, 0xC0, 0xE1, 0xEB, 0x47, 0x22, 0x39, 0xAC, 0xDD, 0x48,
+    0x5C, 0x88, 0x0A, 0x91, 0x10, 0xA7, 0x75, 0x4C, 0x71, 0x04, 0x22, 0xE0, 0x40, 0x6A, 0x10, 0xC6,
+    0xE1, 0x34, 0x38, 0x22, 0x44, 0x88, 0x48, 0x03, 0x87, 0xCF, 0x37, 0x89, 0x44, 0x04, 0x4C, 0x54,
+    0x44, 0x32, 0x62, 0x30, 0x65, 0x30, 0x13, 0xC0, 0x22, 0x69, 0x52, 0x62, 0xAC, 0x59, 0x22, 0x38,
+    0x8C, 0x6B, 0x2C, 0x59, 0x26, 0xD2, 0x90, 0xCA, 0x08, 0x40, 0x5C, 0x64, 0x19, 0x17, 0x9B, 0xD8,
+    0x4A, 0x04, 0x22, 0x64, 0xC1, 0x19, 0xC8, 0x14, 0x23, 0x52, 0x03, 0x87, 0xB4, 0xFA, 0x52, 0x00,
+    0x15, 0x91, 0x88, 0x32, 0x98, 0x09, 0x00, 0x10, 0xE1, 0x06, 0x64, 0x8A, 0x69, 0x60, 0x71, 0x88,
+    0x2F, 0xB1, 0x59, 0x32, 0x11, 0x10, 0x16, 0xD2, 0x30, 0x8A, 0x4A, 0x01, 0x00, 0x87, 0x8D, 0x86,
+    0x89, 0x02, 0x4E, 0x08, 0x44, 0x35, 0x40, 0x1C, 0xE2, 0x40, 0xA9, 0x20, 0x84, 0xAC, 0x08, 0x44,
+    0x89, 0x70, 0x00, 0x44, 0x7A, 0x16, 0x00, 0x23, 0x62, 0x05, 0x8D, 0xA9, 0xB4, 0x60, 0x00, 0xC6,
+    0x89, 0x80, 0x08, 0x59, 0x70, 0xC8, 0x8B, 0xC8, 0x14, 0x23, 0x52, 0x03, 0x87, 0x31, 0xC0, 0x89,
+    0xEC, 0xD0, 0x29, 0x37, 0x11, 0x1D, 0x34, 0x9C, 0xA9, 0x40, 0x56, 0x05, 0x33, 0x0F, 0x89, 0x04,
+    0x16, 0x51, 0x9F, 0x13, 0x1D, 0xE2, 0x13, 0x09, 0x69, 0x42, 0x80, 0x95, 0x60, 0x44, 0x49, 0xE0,
+    0x70, 0x96, 0x3C, 0xD1, 0x89, 0x87, 0x98, 0xE0, 0x89, 0x08, 0x21, 0x23, 0x06, 0x32, 0x22, 0x1C,
+    0x90, 0x30, 0x90, 0x69, 0x80, 0x3B, 0xC4, 0x82, 0x96, 0x89, 0x10, 0x69, 0x66, 0x20, 0x23, 0xCE,
+    0x00, 0x10, 0x69, 0x26, 0x18, 0x71, 0x06, 0x30, 0x0F, 0xDD, 0x0A, 0x14, 0x11, 0x61, 0xA1, 0x16,
+    0x20, 0x46, 0xB0, 0x54, 0x0C, 0xC0, 0x38, 0x0D, 0x8E, 0x10, 0x0F, 0x91, 0x06, 0x4E, 0x89, 0x75,
+    0x14, 0xCD, 0x2E, 0x15, 0xD1, 0x3C, 0x15, 0x1B, 0x41, 0x62, 0xDC, 0x6D, 0x15, 0x23, 0x84, 0x15,
+    0x25, 0xB6, 0x39, 0xE6, 0x1E, 0x16, 0xF1, 0xAE, 0xAC, 0xC0, 0xA1, 0xB4, 0x8C, 0x62, 0x23, 0xA9,
+    0x02, 0x7C, 0x80, 0x59, 0x30, 0x2C, 0x1D, 0xB0, 0x8C, 0x7D, 0xC0, 0x27, 0xC9, 0x3A, 0x9A, 0x89,
+    0x95, 0x22, 0x8A, 0x96, 0x22, 0x43, 0x99, 0x62, 0x53, 0x48, 0x4C, 0xCC, 0x9D, 0x22, 0x9E, 0xA4,
+    0x22, 0x30, 0x0F, 0x8E, 0xCC, 0xC4, 0x0E, 0x1A, 0xDD, 0x29, 0x0E, 0x8B, 0x37, 0x29, 0x2A, 0x42,
+    0x46, 0x88, 0x30, 0xC3, 0x01, 0xE4, 0xE1, 0x0A, 0x9C, 0x22, 0xB1, 0x14, 0xB2, 0x60, 0x86, 0x03,
+    0x54, 0x84, 0x6C, 0x08, 0x69, 0x86, 0x03, 0x16, 0x43, 0x0E, 0x15, 0xCB, 0x16, 0x15, 0x81, 0x62,
+    0x22, 0x62, 0x44, 0x28, 0x75, 0x04, 0x03, 0xE0, 0x82, 0x20, 0x1B, 0xE0, 0x44, 0xA4, 0x21, 0x54,
+    0x64, 0x02, 0x10, 0x91, 0x82, 0x6D, 0x02, 0x58, 0x00, 0xC1, 0xB2, 0x22, 0x4C, 0x9E, 0x58, 0x54,
+    0x77, 0x55, 0xA4, 0x94, 0x55, 0x34, 0x87, 0x0D, 0x00, 0x31, 0x52, 0x4B, 0x20, 0xEE, 0x00, 0xAD,
+    0x80, 0x60, 0xA0, 0x51, 0x09, 0x04, 0x03, 0x94, 0x71, 0x38, 0xD4, 0xCC, 0x30, 0x88, 0x39, 0x88,
+    0xD8, 0x00, 0x87, 0x6E, 0xEB, 0x8A, 0x64, 0x91, 0xF0, 0x96, 0x42, 0x56, 0x5B, 0x11, 0x98, 0x87,
+    0x24, 0x79, 0x79, 0x0D, 0xD2, 0x98, 0x86, 0x40, 0x04, 0x71, 0xE0, 0xD0, 0xB9, 0x5C, 0xF1, 0x38,
+    0x9C, 0x65, 0x34, 0xA0, 0xB4, 0x80, 0x65, 0x24, 0x40, 0x94, 0x16, 0x38, 0xA4, 0xC3, 0x57, 0x8C,
+    0x1C, 0xCA, 0x38, 0x19, 0xC8, 0x20, 0xE6, 0x20, 0x60, 0x0E, 0x9D, 0x13, 0x16, 0xCF, 0xE1, 0xBC,
+    0x27, 0xC1, 0x82, 0x33, 0x90, 0x41, 0xCC, 0xC1, 0xD4, 0x00, 0x6A, 0x26, 0x40, 0xC4, 0x06, 0xA0,
+    0x0B, 0xCA, 0x00, 0x8B, 0x4C, 0x20, 0x8B, 0x2E, 0x32, 0x8B, 0x87, 0xD2, 0x1A, 0xA0, 0x20, 0x18,
+    0x1C, 0x36, 0x23, 0x4F, 0x10, 0x92, 0x70, 0x10, 0x03, 0xB5, 0x90, 0x0E, 0x7A, 0x14, 0x0C, 0x8B,
+    0xA5, 0x00, 0x0E, 0x19, 0x81, 0x16, 0x0D, 0x62, 0x3A, 0x88, 0xD8, 0x81, 0x5C, 0x18, 0x30, 0x18,
+    0x80, 0x24, 0xBC, 0x60, 0xE9, 0x40, 0x2F, 0x00, 0xE0, 0x10, 0x61, 0x17, 0x8B, 0x90, 0x0D, 0x05,
+    0x87, 0x03, 0x00, 0x0A, 0xD2, 0x98, 0x8A, 0x92, 0xB0, 0x20, 0x0E, 0x8C, 0x0E, 0xF0, 0x2D, 0x9A,
+    0x22, 0x2E, 0x2E, 0x5C, 0x97, 0x31, 0x67, 0x2E, 0x46, 0xD8, 0x2E, 0x4E, 0xAA, 0x0E, 0x50, 0x74,
+    0x2F, 0x5A, 0xBE, 0x2F, 0x06, 0x01, 0x20, 0xB8, 0x86, 0xA2, 0x14, 0x02, 0x87, 0x18, 0x85, 0x8B,
+    0x00, 0x26, 0x03, 0xF6, 0x01, 0x40, 0x41, 0x69, 0xE0, 0xF0, 0x28, 0x72, 0x91, 0x1C, 0x1C, 0x79,
+    0x2B, 0x20, 0xA6, 0x83, 0x88, 0x15, 0x61, 0xC0, 0x60, 0xC0, 0xA1, 0x13, 0xEC, 0x22, 0xE3, 0xC4,
+    0xC3, 0x08, 0xD5, 0x45, 0xC7, 0x46, 0x20, 0x63, 0xD0, 0x05, 0x1C, 0x5B, 0x81, 0x8C, 0x41, 0x17,
+    0x88, 0x1C, 0x5B, 0x60, 0xD0, 0x05, 0x8F, 0x6D, 0xC5, 0x8B, 0xEF, 0xCA, 0x8B, 0xB3, 0xD6, 0x8B,
+    0x0C, 0x39, 0x68, 0x5C, 0xBC, 0x00, 0x8C, 0x03, 0xC7, 0x5B, 0x0A, 0xE4, 0x70, 0x18, 0x69, 0x06,
+    0x18, 0x1C, 0xD9, 0xB0, 0x50, 0x38, 0x00, 0x22, 0x91, 0x04, 0x24, 0x4E, 0x00, 0x87, 0xED, 0xE9,
+    0x8B, 0xC1, 0x42, 0xC8, 0x0A, 0x83, 0x98, 0x4C, 0xE1, 0x00, 0x06, 0x69, 0x20, 0x8E, 0x05, 0x70,
+    0x18, 0xA9, 0xBF, 0xE8, 0x44, 0x83, 0x6C, 0x28, 0x66, 0x1D, 0x00, 0x1C, 0x0C, 0x1A, 0x0D, 0x4D,
+    0xA2, 0x7D, 0x32, 0x3A, 0x9D, 0x32, 0x52, 0xD9, 0x32, 0x62, 0x38, 0x09, 0x80, 0xC5, 0xE2, 0x20,
+    0xC6, 0x86, 0x2C, 0xC6, 0x71, 0x38, 0x55, 0xC3, 0x88, 0x0E, 0x67, 0x50, 0x18, 0x9D, 0x06, 0x58,
+    0x16, 0x5C, 0x31, 0x04, 0x22, 0x25, 0xA5, 0x06, 0xA0, 0xC3, 0xD9, 0xF4, 0x2F, 0xA7, 0x2D, 0x00,
+    0xAD, 0x0E, 0x34, 0xF2, 0x55, 0x40, 0x9C, 0x06, 0x58, 0x16, 0xDC, 0x21, 0x86, 0x40, 0xA4, 0xA4,
+    0xD4, 0xC0, 0x21, 0x32, 0x15, 0x63, 0x81, 0x88, 0x43, 0x64, 0x28, 0x46, 0x62, 0x14, 0xE0, 0xB0,
+    0xC0, 0x41, 0x23, 0xD1, 0x14, 0x51, 0x50, 0x85, 0x02, 0x8F, 0xC5, 0x7A, 0x8C, 0xCF, 0x81, 0x8C,
+    0xD2, 0x88, 0x8C, 0x02, 0xD1, 0x8C, 0x43, 0x54, 0x39, 0x46, 0xA2, 0x99, 0x19, 0x47, 0x05, 0xB2,
+    0x02, 0x19, 0x40, 0x63, 0x32, 0x8E, 0x0A, 0x64, 0x09, 0xE2, 0x00, 0x27, 0x62, 0x0D, 0xA7, 0x22,
+    0xF3, 0x00, 0x47, 0x22, 0x0D, 0x27, 0xA2, 0x13, 0xC0, 0x62, 0x79, 0x25, 0x23, 0xAB, 0x26, 0xA3,
+    0x40, 0xB4, 0x83, 0x41, 0xEE, 0x32, 0xE4, 0x20, 0xC2, 0x23, 0x05, 0x3A, 0x90, 0x47, 0xDE, 0xE1,
+    0x2C, 0x8E, 0x81, 0x23, 0x12, 0x72, 0x0D, 0x1C, 0x52, 0xC9, 0x32, 0x2E, 0x48, 0x63, 0x12, 0x92,
+    0x20, 0x0E, 0x1C, 0x3C, 0xDA, 0x7C, 0x2C, 0x10, 0x3E, 0x22, 0xAC, 0x34, 0x59, 0x21, 0x96, 0xE9,
+    0x14, 0xD4, 0x01, 0xC1, 0xE2, 0x0B, 0x34, 0x63, 0xCC, 0x35, 0xE3, 0x01, 0x0E, 0xA6, 0xBD, 0x10,
+    0x17, 0x04, 0x11, 0x38, 0x50, 0x2D, 0x38, 0x0E, 0x63, 0xC0, 0x19, 0x81, 0x06, 0x07, 0x90, 0x06,
+    0x00, 0x0D, 0x6E, 0x28, 0x84, 0x34, 0x70, 0xF8, 0x0C, 0xCF, 0xD8, 0x10, 0xB1, 0x81, 0xAC, 0x60,
+    0x00, 0x60, 0x22, 0x11, 0x71, 0x95, 0x11, 0x80, 0x09, 0x61, 0x88, 0x05, 0x27, 0x94, 0x11, 0x52,
+    0x03, 0xC3, 0xE1, 0x3B, 0x8D, 0xA2, 0x44, 0x8D, 0x43, 0x74, 0x8D, 0x24, 0x9F, 0x8D, 0xA8, 0xBE,
+    0x8D, 0xEB, 0xC4, 0x8D, 0x0C, 0xD3, 0x8D, 0x6E, 0xED, 0x8D, 0x4F, 0x10, 0x8E, 0x70, 0x3A, 0x8E,
+    0xD1, 0x40, 0x8E, 0xB2, 0x4E, 0x8E, 0xD3, 0x65, 0x8E, 0x34, 0x79, 0x8E, 0xF5, 0x80, 0x8E, 0xD6,
+    0x8C, 0x8E, 0x40, 0x83, 0x31, 0x0E, 0x25, 0x23, 0xC4, 0x43, 0xEC, 0x00, 0x84, 0xD2, 0x38, 0x96,
+    0x34, 0x0B, 0xC8, 0x19, 0xE0, 0xD0, 0x09, 0xAA, 0xF1, 0x00, 0x96, 0x85, 0x1C, 0xB4, 0xA5, 0xCA,
+    0x69, 0x87, 0x13, 0x65, 0x8D, 0x85, 0x13, 0x4D, 0x40, 0x80, 0x2C, 0xC8, 0x84, 0x7B, 0x96, 0x38,
+    0x0A, 0xBD, 0x8A, 0xCC, 0x00, 0x90, 0x89, 0x9A, 0x10, 0xA7, 0x01, 0x56, 0xC9, 0x19, 0x62, 0xB0,
+    0x21, 0x10, 0x29, 0x09, 0x2C, 0x3A, 0x31, 0x36, 0x46, 0x4D, 0x36, 0x92, 0xC3, 0xC9, 0xC3, 0xC6,
+    0x48, 0x9A, 0x1C, 0x77, 0xD0, 0x06, 0x33, 0x82, 0x1C, 0x08, 0x31, 0xF7, 0xA0, 0x82, 0x89, 0x1C,
+    0xAC, 0x4F, 0x22, 0x20, 0x8C, 0xC8, 0xA1, 0x9A, 0xD1, 0x11, 0x8C, 0x33, 0x88, 0x91, 0x05, 0x0E,
+    0x21, 0x5F, 0x1B, 0x05, 0x42, 0x92, 0x80, 0x08, 0x77, 0x90, 0xA0, 0xC2, 0x39, 0xC5, 0x34, 0x80,
+    0x02, 0x16, 0x64, 0x42, 0x08, 0xD9, 0x22, 0x48, 0xD0, 0xAC, 0x24, 0x31, 0x44, 0x38, 0x40, 0x45,
+    0xC4, 0x03, 0xE0, 0xDA, 0xBC, 0x43, 0x24, 0xE7, 0x46, 0x42, 0x1E, 0x4C, 0x82, 0x12, 0x50, 0x07,
+    0x44, 0xFA, 0x01, 0x87, 0x68, 0xE6, 0x8D, 0x40, 0xE3, 0x50, 0x15, 0x11, 0x01, 0xC1, 0x42, 0x42,
+    0x02, 0x9B, 0xC1, 0x14, 0x99, 0x02, 0x20, 0x4D, 0x80, 0x3A, 0x20, 0x3B, 0x55, 0x3B, 0x9C, 0x19,
+    0x70, 0x7C, 0x88, 0x08, 0x98, 0x10, 0xA7, 0x01, 0x56, 0x0C, 0x41, 0x04, 0xC5, 0x60, 0xCA, 0x10,
+    0x88, 0x94, 0x04, 0x20, 0x02, 0x01, 0x04, 0x0B, 0x09, 0x21, 0x68, 0x08, 0x15, 0x8A, 0x4C, 0x01,
+    0x1C, 0xC6, 0x7C, 0x38, 0x2E, 0x04, 0x20, 0x91, 0x8E, 0x25, 0x4E, 0x4C, 0xA1, 0x9C, 0x00, 0x10,
+    0xE2, 0x10, 0xFD, 0xC5, 0x91, 0x68, 0x06, 0xA2, 0x99, 0x88, 0x91, 0xB1, 0x02, 0x19, 0x61, 0x01,
+    0x03, 0xD1, 0x4C, 0xC4, 0xC8, 0x08, 0x2B, 0x90, 0x11, 0x16, 0x80, 0x50, 0xA4, 0x41, 0x68, 0x16,
+    0x00, 0xE2, 0x21, 0xE6, 0x21, 0x19, 0x92, 0x23, 0xD0, 0xCC, 0x06, 0x32, 0x0A, 0x19, 0xE0, 0x90,
+    0x06, 0xCB, 0x91, 0x18, 0x09, 0xEC, 0x84, 0x05, 0x04, 0xD2, 0x04, 0x34, 0x02, 0x02, 0x4C, 0xC4,
+    0xA8, 0x18, 0xA2, 0x8C, 0xB0, 0xC0, 0x61, 0xBC, 0x9C, 0x23, 0xB2, 0xAC, 0x43, 0xAD, 0xDC, 0x83,
+    0x45, 0x27, 0x00, 0x40, 0x23, 0x0F, 0x56, 0x38, 0x51, 0xC8, 0x05, 0x92, 0xFD, 0x10, 0x9A, 0xFD,
+    0x10, 0x08, 0x11, 0x49, 0xC8, 0x84, 0x3B, 0xC4, 0x0C, 0xE6, 0x88, 0xD1, 0x00, 0x84, 0x58, 0xC6,
+    0xC1, 0x3A, 0x5E, 0xC4, 0xA2, 0x39, 0xA8, 0xE3, 0xC4, 0x9A, 0x80, 0xE0, 0xB0, 0x03, 0x26, 0x89,
+    0x01, 0x11, 0x30, 0x0E, 0xC6, 0x3A, 0x00, 0x0E, 0xE9, 0x77, 0x1D, 0xC9, 0x22, 0x38, 0x4B, 0x06,
+    0xC2, 0xC4, 0x40, 0x41, 0xAD, 0x85, 0x75, 0x4F, 0x02, 0x8C, 0xFD, 0x80, 0x05, 0xA0, 0xD5, 0x01,
+    0xF9, 0x7E, 0xA4, 0x4B, 0x53, 0x79, 0x47, 0xF4, 0x7D, 0xC7, 0xF5, 0x88, 0xC7, 0xD8, 0x8C, 0x47,
+    0xC9, 0x9A, 0x47, 0x71, 0x88, 0x9A, 0xEE, 0x28, 0xD0, 0x43, 0xDA, 0x72, 0x47, 0x76, 0xA8, 0x23,
+    0xEE, 0x48, 0x1A, 0x18, 0x7B, 0xE0, 0x80, 0x45, 0xDC, 0x51, 0x83, 0x4C, 0x38, 0x43, 0x28, 0x41,
+    0xC4, 0x68, 0x00, 0x05, 0x44, 0x08, 0x21, 0x2B, 0x8A, 0x11, 0xE1, 0x80, 0xC3, 0xC5, 0x84, 0x47,
+    0x62, 0x42, 0x08, 0x59, 0x61, 0x44, 0x18, 0x22, 0x1C, 0x00, 0x19, 0x26, 0x5C, 0x91, 0xC4, 0x12,
+    0xA3, 0x01, 0x74, 0x21, 0x54, 0x49, 0x82, 0x64, 0x3F, 0xE4, 0x10, 0xB0, 0xEE, 0x01, 0x2D, 0x36,
+    0xC3, 0x12, 0xCD, 0xB3, 0x3C, 0x92, 0x85, 0xF6, 0x97, 0x00, 0x5C, 0xA9, 0xB1, 0x43, 0xC4, 0xF3,
+    0x3F, 0x7C, 0xA0, 0x6B, 0xAC, 0x07, 0x58, 0x56, 0xC2, 0x29, 0x09, 0x4C, 0x1E, 0xB2, 0x3D, 0x36,
+    0xCE, 0x3D, 0xC6, 0x47, 0x3E, 0xCE, 0x11, 0x3F, 0x9A, 0x45, 0x84, 0xAD, 0xC7, 0x19, 0xB2, 0x47,
+    0x60, 0x02, 0x22, 0x04, 0x68, 0x19, 0x61, 0x14, 0x23, 0x0A, 0x01, 0x26, 0x20, 0x58, 0x48, 0x45,
+    0x18, 0x45, 0xA6, 0x00, 0x00, 0xC1, 0x42, 0x22, 0xC2, 0x28, 0x32, 0x05, 0x00, 0x11, 0xA8, 0x75,
+    0x40, 0x80, 0x93, 0x76, 0x68, 0xFE, 0xF7, 0x48, 0x30, 0x0E, 0x25, 0x23, 0xD0, 0x43, 0xEC, 0x80,
+    0x43, 0xC2, 0xC5, 0x47, 0xA0, 0x11, 0x48, 0x43, 0x28, 0x44, 0x05, 0xA0, 0x11, 0x48, 0x42, 0x21,
+    0x2A, 0x80, 0x47, 0xB4, 0x1A, 0x2F, 0x89, 0xD4, 0xC7, 0x39, 0xE0, 0xC7, 0x02, 0x11, 0x80, 0x09,
+    0x71, 0x5A, 0x87, 0xA8, 0x42, 0x95, 0x21, 0x10, 0x01, 0x90, 0x79, 0xB8, 0x82, 0xFB, 0x88, 0x2C,
+    0xC0, 0x84, 0x33, 0xCA, 0x10, 0x49, 0x8C, 0x06, 0x20, 0x13, 0xAE, 0x28, 0x43, 0x24, 0x31, 0x1A,
+    0x38, 0x40, 0x4A, 0x09, 0x60, 0x11, 0x44, 0xCB, 0x90, 0x61, 0xDC, 0x10, 0x08, 0xD8, 0x5C, 0x4D,
+    0x7F, 0x6C, 0xFE, 0x7F, 0x74, 0x4D, 0x80, 0x8C, 0x7F, 0x80, 0x94, 0x5F, 0x81, 0x9C, 0x5D, 0x82,
+    0x34, 0x87, 0xCE, 0x6E, 0x40, 0xE8, 0x60, 0xF9, 0x6D, 0xC0, 0x82, 0x94, 0x43, 0x2C, 0xFE, 0x47,
+    0x44, 0x00, 0x26, 0xC4, 0x69, 0x25, 0xA2, 0x0A, 0x55, 0x86, 0x40, 0x04, 0x34, 0x88, 0xDA, 0x00,
+    0x01, 0x69, 0x90, 0x09, 0x67, 0x28, 0x41, 0xC4, 0x68, 0xC0, 0x42, 0xB4, 0x83, 0xF9, 0x01, 0xBA,
+    0x43, 0x4A, 0x0C, 0xC8, 0x79, 0x40, 0xA9, 0x3A, 0x60, 0x02, 0xD6, 0xE2, 0x52, 0xFD, 0x80, 0xF6,
+    0x09, 0x24, 0x8E, 0x18, 0xAC, 0xA4, 0xD4, 0x40, 0xC4, 0x60, 0x25, 0x81, 0x45, 0xF0, 0xF0, 0x80,
+    0x49, 0x1D, 0x48, 0xC4, 0xA1, 0x64, 0x84, 0x12, 0x88, 0x1D, 0x70, 0xE8, 0x56, 0x04, 0x89, 0x34,
+    0xA6, 0x41, 0x0C, 0x41, 0x1C, 0x10, 0xC9, 0x06, 0x31, 0x90, 0x39, 0xE0, 0x90, 0x2A, 0x0B, 0xD2,
+    0x89, 0x10, 0x42, 0x56, 0xA8, 0x81, 0x8C, 0x08, 0x07, 0x00, 0x56, 0x83, 0x19, 0xAC, 0x24, 0x60,
+    0x3D, 0x92, 0xBE, 0x41, 0xBA, 0xCF, 0x41, 0x52, 0x53, 0x42, 0x0A, 0xE0, 0xA0, 0xDD, 0x78, 0x11,
+    0x2E, 0x48, 0xA1, 0x81, 0x43, 0xDA, 0x45, 0xC8, 0x66, 0x1E, 0x12, 0x13, 0x42, 0x02, 0x11, 0xAE,
+    0x60, 0x64, 0x14, 0xD3, 0x00, 0x22, 0x56, 0x30, 0x32, 0x42, 0x30, 0x40, 0x33, 0x11, 0x44, 0xCC,
+    0x60, 0x64, 0x84, 0x60, 0x00, 0x76, 0xD0, 0x8C, 0x3C, 0x71, 0x88, 0x5C, 0x0A, 0x49, 0x20, 0x13,
+    0x8E, 0x28, 0x46, 0x84, 0xD1, 0xC0, 0x01, 0xB9, 0x27, 0xA4, 0xA5, 0x21, 0xE2, 0x21, 0x72, 0x73,
+    0x00, 0x38, 0x08, 0xBE, 0x43, 0x7A, 0x94, 0x01, 0x87, 0x9C, 0x64, 0x1E, 0xC1, 0x39, 0x87, 0x8C,
+    0x8B, 0x63, 0xCF, 0x90, 0xD1, 0xD5, 0x90, 0x40, 0x33, 0x11, 0x24, 0xC2, 0x14, 0x32, 0x1A, 0xE0,
+    0x04, 0x24, 0xC1, 0x20, 0x19, 0xC0, 0x21, 0xC9, 0x4B, 0x40, 0x84, 0x38, 0xB1, 0x41, 0x20, 0x03,
+    0x16, 0x5A, 0xE7, 0x61, 0xE4, 0x3D, 0x09, 0x58, 0xEE, 0x20, 0x6A, 0x7F, 0x71, 0xF2, 0x8C, 0x20,
+    0x12, 0x85, 0x7E, 0xA7, 0x15, 0x21, 0x32, 0x7A, 0x23, 0x12, 0x1C, 0x4A, 0xF5, 0x4B, 0x3C, 0x4E,
+    0x3B, 0x00, 0x8F, 0x53, 0xD0, 0x12, 0x60, 0x20, 0xE0, 0x50, 0xFA, 0x22, 0x72, 0x90, 0x00, 0x9C,
+    0xF1, 0xAF, 0xC2, 0x22, 0xE1, 0xAC, 0xD2, 0xC0, 0xC1, 0x80, 0x43, 0x24, 0x02, 0x08, 0x1C, 0x6A,
+    0x92, 0x21, 0x30, 0x98, 0x50, 0x24, 0x62, 0xE3, 0x80, 0x4F, 0xC0, 0x8D, 0x18, 0x42, 0xA2, 0x48,
+    0xE4, 0xAC, 0xC8, 0x55, 0xB4, 0xC8, 0x96, 0x90, 0x0A, 0x57, 0xB6, 0xC8, 0xF9, 0xBE, 0x48, 0x01,
+    0x39, 0x09, 0x42, 0x41, 0x20, 0x2E, 0x92, 0x44, 0x45, 0x46, 0x23, 0x4F, 0x00, 0xB2, 0x20, 0x94,
+    0x03, 0x0E, 0xC9, 0xBC, 0x89, 0xC0, 0x81, 0xE4, 0x2D, 0xC5, 0xE2, 0xA9, 0x71, 0xCC, 0x1C, 0x59,
+    0xA4, 0xA0, 0x03, 0x20, 0x70, 0x1A, 0xC4, 0x80, 0xE0, 0x40, 0x08, 0x28, 0xF2, 0x90, 0x0A, 0x2F,
+    0x72, 0x2D, 0x10, 0xD4, 0xEC, 0x61, 0xEC, 0x07, 0x58, 0x46, 0x04, 0x62, 0x69, 0x81, 0x43, 0x10,
+    0x88, 0xC5, 0x83, 0x88, 0x0D, 0x61, 0xC0, 0x60, 0xC0, 0x26, 0x61, 0x6A, 0xE4, 0x41, 0x6F, 0xE4,
+    0xA2, 0x71, 0x64, 0xE4, 0x75, 0xE4, 0xFC, 0x77, 0x24, 0x45, 0x81, 0xE4, 0x38, 0x3C, 0x72, 0x8D,
+    0x22, 0xA4, 0x88, 0x00, 0x46, 0x43, 0x34, 0xA1, 0x2C, 0xB0, 0x18, 0x41, 0x1B, 0x69, 0x8F, 0x1B,
+    0x59, 0x0A, 0x6A, 0x00, 0x46, 0x43, 0x10, 0x66, 0x81, 0x86, 0x29, 0xC2, 0x05, 0x87, 0x13, 0xAF,
+    0x51, 0xC2, 0x69, 0x80, 0x42, 0x41, 0x60, 0x2D, 0x12, 0xE2, 0x1E, 0xA8, 0x7B, 0x12, 0x20, 0x8D,
+    0xB1, 0x10, 0x92, 0x6C, 0x20, 0xE1, 0x1C, 0x60, 0x42, 0x1A, 0x53, 0x61, 0xC4, 0x10, 0xC4, 0x81,
+    0xC3, 0x16, 0xB1, 0xC8, 0x73, 0x49, 0xAA, 0x1F, 0x79, 0xEE, 0x49, 0x80, 0x04, 0x20, 0xE9, 0x5C,
+    0xAE, 0x38, 0xEF, 0x49, 0x30, 0x44, 0xE0, 0xC0, 0x6A, 0xC3, 0xCE, 0x32, 0x12, 0x60, 0x48, 0x0B,
+    0x68, 0x07, 0xE6, 0x9E, 0x04, 0x96, 0x95, 0x90, 0x12, 0xB8, 0x54, 0xFD, 0x90, 0x5C, 0x52, 0xEF,
+    0x6B, 0x1A, 0x91, 0x8C, 0x46, 0x91, 0xA4, 0x2A, 0x92, 0x3C, 0x16, 0xD2, 0x00, 0x51, 0x0A, 0x40,
+    0x2C, 0x30, 0x18, 0x18, 0xC8, 0x41, 0x0C, 0x47, 0xD0, 0xE2, 0xEA, 0xCB, 0x88, 0x5C, 0x8F, 0xE4,
+    0xB0, 0x0E, 0xF5, 0x2B, 0xFC, 0x2C, 0x64, 0x20, 0x15, 0x69, 0x5D, 0xB1, 0x02, 0x30, 0x11, 0x0D,
+    0x31, 0x22, 0x02, 0x09, 0x0B, 0x1C, 0x0C, 0x79, 0x9A, 0x2C, 0x22, 0x63, 0x49, 0xBA, 0x03, 0x0E,
+    0x11, 0xD2, 0x44, 0x44, 0x32, 0x21, 0x05, 0x73, 0xC0, 0x21, 0x69, 0xE0, 0xD0, 0x44, 0xB4, 0x82,
+    0x11, 0x08, 0xF0, 0x3C, 0x4E, 0x34, 0x33, 0x0E, 0x8B, 0x11, 0x99, 0x01, 0x34, 0xCE, 0x73, 0x38,
+    0x01, 0x0E, 0x10, 0x05, 0x1C, 0x92, 0xF3, 0x49, 0x8A, 0x83, 0x43, 0xC0, 0x2D, 0x27, 0x21, 0x14,
+    0x08, 0x0E, 0x51, 0xE8, 0x77, 0x22, 0x09, 0x24, 0x14, 0x73, 0xC0, 0x21, 0x9D, 0xA5, 0xE4, 0x44,
+    0x05, 0xA4, 0x81, 0x0D, 0x26, 0x03, 0x20, 0x91, 0xC3, 0x45, 0x50, 0xC9, 0x72, 0x50, 0xEE, 0x49,
+    0xA0, 0x34, 0x98, 0x13, 0x52, 0x05, 0x88, 0x20, 0x02, 0x0D, 0xD2, 0x14, 0x70, 0x2B, 0x9E, 0x2D,
+    0x39, 0x88, 0x2E, 0x69, 0x0C, 0x2F, 0x99, 0xC2, 0x30, 0xB9, 0x42, 0x31, 0xD9, 0x3A, 0x33, 0xF9,
+    0x18, 0x35, 0x19, 0x69, 0x35, 0x29, 0x5F, 0x36, 0x39, 0x83, 0x37, 0x59, 0x4D, 0xF7, 0x60, 0x11,
+    0x38, 0x89, 0x51, 0x38, 0x19, 0x90, 0x03, 0xCD, 0x8D, 0x87, 0xC3, 0x26, 0x72, 0xC9, 0x83, 0x40,
+    0x6A, 0x82, 0x08, 0x13, 0xD0, 0x0D, 0xAA, 0x10, 0x70, 0x38, 0x7E, 0xBC, 0xD5, 0xE8, 0x04, 0xB2,
+    0xC0, 0x22, 0xE2, 0xBF, 0x64, 0x0C, 0xC2, 0x24, 0xD0, 0x20, 0xD2, 0x6C, 0x10, 0xE4, 0x0C, 0x70,
+    0x08, 0x2A, 0xB1, 0xD1, 0x0E, 0xF4, 0x75, 0x0D, 0x0E, 0x08, 0x6D, 0x3E, 0x50, 0xD2, 0x6C, 0x58,
+    0x5F, 0x8D, 0x9D, 0x01, 0x1E, 0x09, 0x47, 0x26, 0x5D, 0x52, 0x26, 0xA5, 0x5D, 0x26, 0x03, 0x72,
+    0xA0, 0x33, 0x24, 0xC1, 0x20, 0x09, 0x29, 0xB8, 0x00, 0x4C, 0xBA, 0x81, 0x26, 0x34, 0x00, 0xD2,
+    0x10, 0xD2, 0x09, 0xE0, 0x90, 0x7E, 0x69, 0x72, 0x1C, 0x4E, 0x0D, 0x4D, 0x3A, 0x0D, 0xA1, 0x1B,
+    0x28, 0x22, 0x01, 0x1C, 0x9E, 0x1B, 0x02, 0x90, 0x83, 0xD3, 0x43, 0x00, 0xC0, 0x4A, 0x20, 0xAC,
+    0x24, 0xC0, 0x69, 0x05, 0x06, 0x11, 0x70, 0xD8, 0x04, 0x36, 0x49, 0x34, 0x93, 0x2E, 0xD8, 0x03,
+    0x98, 0x74, 0x42, 0x20, 0x7B, 0x80, 0xC5, 0x95, 0xB9, 0xC9, 0x19, 0x43, 0x00, 0xC4, 0x68, 0x09,
+    0x47, 0x38, 0x02, 0x38, 0xBA, 0x21, 0x1D, 0x04, 0x0E, 0x67, 0x0C, 0x01, 0x1E, 0xDD, 0x30, 0x4A,
+    0x04, 0x07, 0xD8, 0xCB, 0x41, 0x2C, 0x40, 0x37, 0xDC, 0xD2, 0xC0, 0x61, 0xF5, 0xE5, 0xA4, 0x83,
+    0x01, 0xCD, 0x8C, 0x60, 0xA8, 0x15, 0x32, 0x00, 0x72, 0xA0, 0xFB, 0x8E, 0x32, 0x79, 0x1E, 0x3B,
+    0xB9, 0x90, 0x3B, 0xD9, 0xE8, 0x3B, 0xE9, 0x2E, 0x3C, 0x09, 0x48, 0x88, 0xD3, 0x1A, 0xC4, 0x39,
+    0x88, 0x00, 0x8E, 0x44, 0xC8, 0x04, 0x74, 0xC2, 0x01, 0x88, 0x78, 0x00, 0xF4, 0x9D, 0x01, 0xD0,
+    0x09, 0x85, 0x00, 0xCC, 0x33, 0x11, 0x13, 0x69, 0x48, 0x61, 0x04, 0x70, 0x48, 0x8D, 0x3D, 0xE9,
+    0x0E, 0x5B, 0xE7, 0x61, 0xE8, 0x41, 0x70, 0x97, 0x01, 0x46, 0x07, 0x48, 0xF0, 0x1A, 0xF8, 0x40,
+    0x29, 0x32, 0x41, 0x59, 0x78, 0x41, 0x79, 0x48, 0xFD, 0x86, 0xD2, 0x41, 0xB9, 0x18, 0xB5, 0xC3,
+    0xFE, 0x42, 0xD9, 0x34, 0x44, 0x19, 0x8F, 0x44, 0x29, 0xAF, 0xB9, 0x83, 0x87, 0x47, 0x09, 0x0E,
+    0x27, 0x11, 0x28, 0xA3, 0x76, 0x30, 0x3D, 0x87, 0xE1, 0x20, 0x62, 0x84, 0x18, 0x30, 0x18, 0x40,
+    0x27, 0xC8, 0x00, 0x4C, 0x3A, 0x61, 0x28, 0x80, 0x58, 0x0D, 0x35, 0x84, 0x04, 0x0E, 0x67, 0x56,
+    0x28, 0x8D, 0xE9, 0x14, 0xC0, 0x01, 0x2D, 0x0D, 0xC2, 0xC1, 0x01, 0x90, 0x83, 0x18, 0x04, 0xA2,
+    0xC3, 0x26, 0x1E, 0x4A, 0xA4, 0x01, 0x26, 0x12, 0x51, 0x48, 0x19, 0x01, 0x40, 0x26, 0x1C, 0x41,
+    0x9E, 0x18, 0x0D, 0x20, 0x46, 0x03, 0x09, 0x61, 0x81, 0x45, 0xA3, 0x33, 0xCA, 0xF8, 0x37, 0x4A,
+    0x70, 0x38, 0x11, 0x46, 0xB9, 0x2C, 0xB8, 0x02, 0x99, 0x92, 0x52, 0xB3, 0xD4, 0x84, 0x92, 0x52,
+    0x03, 0x10, 0xD1, 0x60, 0xCA, 0x10, 0x0A, 0x00, 0xA2, 0x51, 0xF1, 0xA5, 0x82, 0x2B, 0x66, 0x01,
+    0xD4, 0x33, 0x11, 0xA3, 0x82, 0xC5, 0x11, 0x16, 0x38, 0x9C, 0x0F, 0xA4, 0x04, 0x62, 0x43, 0x0B,
+    0xC5, 0x00, 0xBA, 0xA1, 0x85, 0x01, 0x0E, 0x57, 0x1E, 0x29, 0x91, 0x48, 0x27, 0x20, 0x03, 0xB8,
+    0x43, 0x2A, 0x50, 0xCA, 0x88, 0x90, 0x04, 0xA2, 0x99, 0x1D, 0x0C, 0x99, 0x70, 0x54, 0x20, 0x03,
+    0x88, 0x08, 0x49, 0x20, 0x9A, 0x19, 0xC2, 0x90, 0x09, 0x47, 0x05, 0x32, 0xC0, 0x24, 0x09, 0x30,
+    0x65, 0x0C, 0x31, 0xE5, 0x44, 0x34, 0x25, 0x45, 0x35, 0x25, 0xD0, 0x10, 0x32, 0xE1, 0x85, 0x03,
+    0x0E, 0x26, 0x01, 0xB7, 0x80, 0xC3, 0xC9, 0x66, 0x4A, 0x76, 0xC0, 0xDC, 0x9D, 0x51, 0x10, 0xCA,
+    0x00, 0x07, 0x9A, 0x7B, 0x6D, 0x00, 0x83, 0x34, 0x14, 0xE6, 0x02, 0x78, 0x44, 0xD1, 0xA7, 0x94,
+    0xFF, 0xA7, 0x9C, 0x1C, 0xA8, 0x04, 0x8B, 0xEB, 0x6F, 0x44, 0x2F, 0xF5, 0x94, 0xE4, 0x30, 0x82,
+    0x96, 0xA3, 0x16, 0xCC, 0x00, 0x10, 0xAD, 0x20, 0x06, 0x02, 0x10, 0x91, 0x6E, 0x08, 0xC2, 0x00,
+    0xA8, 0x40, 0x1C, 0x70, 0x88, 0xDA, 0x51, 0x49, 0x16, 0x63, 0x29, 0x2A, 0x75, 0x34, 0x2A, 0x1B,
+    0x1D, 0x31, 0x60, 0x20, 0x00, 0x89, 0x18, 0x30, 0x98, 0x00, 0x1A, 0x06, 0x0C, 0xE0, 0xB0, 0xF9,
+    0xA4, 0xD2, 0x68, 0x11, 0x03, 0x0A, 0xE2, 0xC0, 0x81, 0xC1, 0x48, 0xE5, 0xE7, 0xB1, 0x51, 0xE5,
+    0xC2, 0x52, 0x65, 0x5B, 0x56, 0xA5, 0xA3, 0x57, 0xA5, 0xA4, 0x58, 0xE5, 0xA4, 0x59, 0xA5, 0xE5,
+    0x5A, 0xE5, 0x00, 0x90, 0x82, 0x50, 0x00, 0x99, 0x00, 0xC5, 0x01, 0x87, 0x0B, 0x66, 0x5F, 0x8E,
+    0x81, 0x08, 0xC0, 0xAA, 0x48, 0xC8, 0x09, 0x55, 0x12, 0xE0, 0x4C, 0x3A, 0x61, 0x20, 0x70, 0x80,
+    0xB0, 0xE2, 0x72, 0xD0, 0x3A, 0x0F, 0x03, 0x91, 0x05, 0x54, 0x1C, 0x70, 0x38, 0x51, 0x57, 0xB9,
+    0xAC, 0x86, 0x2B, 0x52, 0x02, 0x4E, 0xC3, 0x15, 0x03, 0x82, 0xC5, 0xA6, 0x9E, 0x1E, 0x4B, 0xC3,
+    0x4A, 0xA7, 0xB1, 0x09, 0x04, 0x5D, 0xA0, 0x1D, 0x38, 0x0C, 0x56, 0x5E, 0x12, 0xA5, 0x56, 0x22,
+    0xF9, 0x56, 0xBA, 0x55, 0x57, 0xCA, 0x68, 0x57, 0xD6, 0x7C, 0x57, 0x82, 0x43, 0xAC, 0xD2, 0x4A,
+    0x69, 0x1E, 0x44, 0xE2, 0x1E, 0x1C, 0x90, 0xC2, 0x8E, 0x2D, 0x16, 0xD5, 0x56, 0x46, 0xE5, 0x56,
+    0x02, 0x06, 0x09, 0x60, 0x01, 0x1C, 0xCC, 0x2D, 0x07, 0x02, 0x5A, 0x42, 0x31, 0x04, 0x2C, 0x92,
+    0x28, 0x57, 0xCA, 0x3F, 0x57, 0x02, 0x23, 0xA1, 0x88, 0x05, 0x54, 0xC4, 0x68, 0x98, 0x61, 0x01,
+    0x44, 0x3B, 0x90, 0xC0, 0x96, 0x42, 0x0E, 0xAA, 0xE4, 0x29, 0x01, 0x33, 0xA1, 0x9C, 0x01, 0x0E,
+    0x1D, 0xD0, 0x2B, 0x09, 0x97, 0x80, 0x66, 0x00, 0x07, 0x84, 0xE4, 0x95, 0x8B, 0x24, 0xF9, 0x95,
+    0xA8, 0x01, 0x96, 0x40, 0xE3, 0x0E, 0x28, 0x91, 0xA9, 0x34, 0xC0, 0xB2, 0xE0, 0x86, 0x51, 0x52,
+    0x6A, 0xC0, 0x82, 0x38, 0x2D, 0x21, 0x09, 0x44, 0xC0, 0x22, 0x5A, 0x85, 0xE5, 0xF4, 0x86, 0x25,
+    0x30, 0xE8, 0x86, 0x42, 0x16, 0x30, 0xE8, 0x86, 0x9F, 0xF4, 0x89, 0x00, 0x77, 0xA0, 0xBF, 0x82,
+    0x71, 0x2A, 0x2A, 0x64, 0xB9, 0x10, 0x4D, 0xC1, 0x3C, 0x65, 0xD9, 0x1C, 0x66, 0xF9, 0x32, 0x67,
+    0x19, 0xE7, 0x68, 0x39, 0xBD, 0x69, 0x49, 0x47, 0x6A, 0x69, 0x93, 0x6A, 0x19, 0x10, 0xE3, 0x00,
+    0x91, 0xBB, 0x0C, 0x3D, 0x8C, 0x82, 0xB2, 0x6C, 0xA6, 0x08, 0x67, 0x28, 0xC4, 0xC8, 0x30, 0x0D,
+    0x14, 0x28, 0x66, 0xC0, 0xA1, 0x8C, 0x44, 0x02, 0x83, 0x0E, 0x27, 0xED, 0x67, 0xE4, 0x01, 0xEA,
+    0xFB, 0xCC, 0x21, 0x9E, 0x9B, 0xA5, 0x33, 0x1B, 0x08, 0x1A, 0xC1, 0x52, 0x82, 0x06, 0xB0, 0x0E,
+    0x34, 0x22, 0x11, 0xB8, 0x43, 0x19, 0x40, 0xCB, 0x86, 0x68, 0x66, 0x44, 0x44, 0x24, 0x90, 0x01,
+    0x0E, 0xC9, 0x56, 0x0C, 0x91, 0x09, 0x71, 0x5A, 0x46, 0x44, 0x47, 0x0C, 0x81, 0x08, 0x38, 0xA4,
+    0xBE, 0xB4, 0x1C, 0xC8, 0xC1, 0xB0, 0x8B, 0xCB, 0x81, 0xFE, 0x9D, 0xD7, 0xA1, 0xEE, 0x56, 0x25,
+    0x39, 0x38, 0xA4, 0x7E, 0x23, 0x0F, 0xB4, 0xE9, 0x28, 0x44, 0xAA, 0xE1, 0x22, 0x83, 0xC1, 0x24,
+    0x49, 0xB0, 0x25, 0x02, 0xB6, 0xA5, 0x63, 0xB7, 0x25, 0x0D, 0x30, 0x25, 0x20, 0x0F, 0x88, 0x25,
+    0x09, 0x16, 0x9D, 0x99, 0x2D, 0xA3, 0xA3, 0x2D, 0xD1, 0x81, 0x48, 0xE2, 0x16, 0x46, 0x37, 0xA0,
+    0xF0, 0x00, 0x09, 0x68, 0x07, 0x5A, 0xD2, 0x1F, 0x84, 0x73, 0xA0, 0x6D, 0xBE, 0x83, 0x5A, 0x80,
+    0x09, 0x71, 0x5A, 0x46, 0x64, 0xA9, 0x0C, 0x81, 0x08, 0x40, 0x21, 0xD3, 0x44, 0x0E, 0x86, 0xE2,
+    0x1C, 0x1F, 0x4B, 0x5C, 0x2E, 0x91, 0x72, 0x2E, 0x29, 0x88, 0x2E, 0xC9, 0xA4, 0x88, 0xC3, 0xE5,
+    0x23, 0xC5, 0xA5, 0x2C, 0xC9, 0xE5, 0x5C, 0xCA, 0x25, 0x10, 0x0F, 0x46, 0x17, 0xE9, 0x20, 0x03,
+    0x69, 0x38, 0x62, 0x05, 0x70, 0x48, 0xE1, 0x71, 0x89, 0x8C, 0x86, 0x12, 0xC5, 0x02, 0x82, 0x05,
+    0x91, 0x74, 0x81, 0x3A, 0x00, 0x3A, 0x90, 0x9C, 0x33, 0x41, 0x0F, 0x9A, 0x38, 0xB9, 0x10, 0x11,
+    0xD1, 0x08, 0x24, 0x23, 0xD4, 0x60, 0x02, 0x51, 0x01, 0x90, 0x88, 0xD1, 0x50, 0xC4, 0x09, 0xCB,
+    0x52, 0x83, 0x4E, 0x00, 0xDA, 0x01, 0x7A, 0x81, 0xD5, 0x29, 0x21, 0xDB, 0xE5, 0x79, 0xDE, 0x25,
+    0x02, 0xE8, 0x25, 0x93, 0xEA, 0xA5, 0x3B, 0xEE, 0xE5, 0x14, 0xFB, 0x25, 0x8D, 0x03, 0x26, 0xFE,
+    0x04, 0x66, 0xAE, 0x09, 0xA6, 0xE0, 0x2C, 0x8B, 0x6E, 0x30, 0x28, 0x25, 0x70, 0x88, 0x94, 0x70,
+    0xD0, 0x08, 0xA4, 0xE0, 0x04, 0x4B, 0x8F, 0x20, 0x2A, 0x80, 0x45, 0xE2, 0xC3, 0x4B, 0x84, 0xCA,
+    0x4B, 0x60, 0x18, 0xDC, 0x81, 0xE5, 0x22, 0x14, 0x60, 0xD2, 0x01, 0xD0, 0xD2, 0x03, 0x43, 0x18,
+    0x96, 0x2A, 0x18, 0xCA, 0x00, 0xDE, 0x21, 0x09, 0x8E, 0x0D, 0xD2, 0x98, 0x84, 0x28, 0x88, 0x03,
+    0x87, 0xFA, 0x11, 0x7A, 0x44, 0x46, 0x1A, 0x82, 0xC8, 0x01, 0x1C, 0xBA, 0xCF, 0x5E, 0x02, 0x84,
+    0x6E, 0x28, 0x2F, 0x00, 0x84, 0x6E, 0x40, 0x2F, 0x80, 0x4B, 0x92, 0xE7, 0xCB, 0xF3, 0xE9, 0x4B,
+    0x76, 0xEC, 0x4B, 0x5A, 0xEF, 0xCB, 0x4A, 0xF2, 0x4B, 0x21, 0x22, 0x0D, 0x0A, 0x99, 0x00, 0xB0,
+    0x03, 0x0D, 0xCD, 0x0A, 0x96, 0x6E, 0x80, 0xE8, 0x02, 0x44, 0x43, 0x0A, 0x10, 0x09, 0x40, 0x34,
+    0x1D, 0xBA, 0x61, 0x40, 0x80, 0x88, 0x10, 0xA3, 0x1D, 0x68, 0x85, 0xF7, 0x2C, 0xC6, 0xE2, 0x5F,
+    0x4E, 0x1C, 0x60, 0x3E, 0xEE, 0x40, 0x7B, 0x6D, 0xE5, 0xD0, 0x41, 0x00, 0x13, 0x98, 0x07, 0x3A,
+    0x3D, 0x0C, 0x30, 0xDD, 0x80, 0x4C, 0x03, 0x00, 0x4A, 0xD2, 0x11, 0x65, 0xB0, 0x03, 0x38, 0x8F,
+    0x6E, 0x40, 0x2C, 0x82, 0x43, 0xC6, 0x0E, 0x4C, 0x40, 0xD2, 0x0D, 0xA5, 0x1D, 0x80, 0x98, 0x22,
+    0x44, 0x44, 0xBC, 0x30, 0x8C, 0x50, 0x00, 0x42, 0x12, 0x44, 0x0E, 0xE0, 0x95, 0xDC, 0x0A, 0xD3,
+    0x6C, 0x0C, 0xF3, 0x10, 0x0D, 0x13, 0x21, 0x16, 0x33, 0x4D, 0x18, 0x53, 0x61, 0x19, 0xD3, 0x19,
+    0x1A, 0x73, 0x6E, 0x0C, 0x93, 0x2E, 0x1B, 0xD3, 0x3E, 0x1F, 0x13, 0x53, 0x20, 0x13, 0x1C, 0xCA,
+    0xBE, 0xF2, 0xCC, 0x83, 0x03, 0x2F, 0x44, 0xE7, 0x50, 0x13, 0x0C, 0x13, 0xD3, 0x0D, 0x30, 0x34,
+    0x90, 0x00, 0x03, 0x70, 0x10, 0xBA, 0x01, 0x06, 0x70, 0x89, 0x9E, 0x88, 0xD9, 0xEE, 0x88, 0x19,
+    0xA3, 0x89, 0x29, 0x7F, 0x8A, 0x39, 0xC5, 0x8A, 0x49, 0x0E, 0xB5, 0x0A, 0x31, 0xE3, 0xA1, 0xA6,
+    0xFA, 0x04, 0x2A, 0x10, 0x06, 0x98, 0x0E, 0x42, 0x47, 0x00, 0x44, 0x4C, 0x08, 0xC2, 0x80, 0x45,
+    0xA0, 0xDF, 0x49, 0xBD, 0xA1, 0x40, 0x42, 0x27, 0x04, 0x02, 0x0E, 0x29, 0x46, 0x31, 0x91, 0x91,
+    0x20, 0xCC, 0x02, 0x74, 0x01, 0x62, 0x0E, 0x02, 0x88, 0x4E, 0x10, 0x07, 0x00, 0x07, 0xFA, 0x58,
+    0x56, 0x8B, 0x24, 0xCF, 0x97, 0xAD, 0xBD, 0x98, 0x87, 0xA4, 0x1B, 0xA0, 0x38, 0x80, 0x39, 0xD0,
+    0xE6, 0x5D, 0x38, 0x3C, 0x21, 0xC3, 0x24, 0x07, 0x9A, 0x60, 0x98, 0x00, 0x42, 0x37, 0x14, 0x1C,
+    0xC0, 0xE1, 0x8C, 0x21, 0x00, 0x3B, 0x00, 0x81, 0x4B, 0x5B, 0x94, 0x70, 0xC7, 0x9C, 0x9D, 0xC7,
+    0x8C, 0x87, 0x33, 0xE9, 0x98, 0x24, 0xC1, 0xB0, 0x00, 0x9C, 0x06, 0xC3, 0x06, 0x04, 0x26, 0xDD,
+    0x60, 0xD8, 0x19, 0x00, 0xE2, 0xB4, 0x03, 0x8D, 0x18, 0xB3, 0xC3, 0x97, 0x08, 0x3D, 0x77, 0xD0,
+    0x3C, 0x08, 0xE5, 0x20, 0x09, 0x30, 0x34, 0x30, 0x49, 0x0E, 0x92, 0x89, 0xB2, 0x8E, 0xD6, 0xA8,
+    0x92, 0x29, 0x0D, 0x93, 0x19, 0x2C, 0x88, 0x74, 0x10, 0xB1, 0x23, 0x32, 0x99, 0xC4, 0x81, 0xC1,
+    0x00, 0xF2, 0x50, 0x97, 0x1D, 0x6D, 0xD0, 0x0D, 0x27, 0x2C, 0x60, 0x88, 0xC8, 0x81, 0xF6, 0x99,
+    0xD8, 0x21, 0xF0, 0xDE, 0xCD, 0xE1, 0x50, 0xCB, 0xC8, 0x38, 0x10, 0xB1, 0xB4, 0xC0, 0x23, 0xAA,
+    0x55, 0x66, 0xEC, 0x5B, 0x26, 0x4E, 0x5D, 0x26, 0x39, 0xC4, 0x8F, 0xCA, 0x5C, 0x56, 0xC3, 0x0D,
+    0x29, 0x01, 0xF1, 0x40, 0x6F, 0x4E, 0x61, 0xD1, 0x61, 0x2C, 0x53, 0x2E, 0x2D, 0x73, 0x59, 0x07,
+    0x88, 0xFF, 0x92, 0x16, 0x40, 0x47, 0x20, 0x91, 0x0A, 0x00, 0x04, 0xEB, 0x00, 0xC3, 0xE7, 0x09,
+    0x81, 0x0F, 0xB4, 0xE2, 0x34, 0x0E, 0xA3, 0xFB, 0x32, 0xC9, 0x41, 0x4C, 0x5C, 0xE6, 0x01, 0x49,
+    0x5C, 0xE6, 0x23, 0x4A, 0x64, 0x66, 0xA4, 0x67, 0xE6, 0xE4, 0x68, 0x26, 0x70, 0x0E, 0x26, 0xBC,
+    0x10, 0x0F, 0x0F, 0x35, 0x33, 0x85, 0x73, 0xA0, 0x27, 0x1C, 0x79, 0xA0, 0xF1, 0x1A, 0xC5, 0x51,
+    0x09, 0xC8, 0x60, 0x00, 0x39, 0x07, 0x3A, 0x65, 0x91, 0x93, 0x40, 0x6D, 0x87, 0xB1, 0xBF, 0x99,
+    0x73, 0xC4, 0x99, 0x94, 0xC9, 0x99, 0xE4, 0x30, 0x52, 0x77, 0x12, 0x90, 0x62, 0x81, 0x39, 0x00,
+    0x39, 0x00, 0xA0, 0xE5, 0xE0, 0x50, 0xBA, 0x01, 0x31, 0x70, 0xA8, 0x1D, 0x9D, 0xE9, 0xE8, 0x04,
+    0xC4, 0x40, 0x01, 0x62, 0x00, 0x00, 0x00, 0x00,
+};
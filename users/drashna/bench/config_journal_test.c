@@ -0,0 +1,371 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Power loss simulator for config_journal.c, and for the migration of the legacy config block into it by
+ * drashna_eeconfig.c.
+ *
+ * Makes random writes to random keys, enough to fill the banks and compact them many times over. Before each write
+ * is made for real, it's repeated once for every byte it writes, with the power cut at that byte: the torn byte is
+ * either never written, or written with garbage. After each cut the journal is recovered as it would be on boot, and
+ * every key has to read back as its old value, or (for the key being written) the new one. Another write is then
+ * made, which has to survive the next boot along with everything else, as appends carry on past whatever the cut
+ * left behind.
+ *
+ * Then it migrates a legacy config block, with the power cut at every byte of that too, and checks that every boot
+ * after a cut ends up with the legacy settings, that settings changed after the migration stay changed, and that a
+ * datablock without a valid legacy block is left for the defaults.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o config_journal_test -Iusers/drashna/bench/qmk -Iusers/drashna -DCONFIG_JOURNAL_ENABLE \
+ *         -DCONFIG_JOURNAL_SIZE=512 -DUSERSPACE_CONFIG_SIZE=64 -DEECONFIG_USER_DATA_SIZE=576 \
+ *         users/drashna/bench/config_journal_test.c users/drashna/config_journal.c \
+ *         users/drashna/drashna_eeconfig.c users/drashna/drashna_crc.c
+ *     ./config_journal_test
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eeconfig.h"
+#include "config_journal.h"
+#include "drashna_runtime.h"
+
+#define TEST_WRITES     400
+#define TEST_VALUE_SIZE 24 // every key at this size still fits in a bank, so compaction always succeeds
+
+_Static_assert(sizeof(config_journal_header_t) +
+                       CONFIG_JOURNAL_KEY_COUNT * (CONFIG_JOURNAL_RECORD_OVERHEAD + TEST_VALUE_SIZE) <=
+                   CONFIG_JOURNAL_BANK_SIZE,
+               "Test values don't all fit in a bank");
+
+userspace_config_t userspace_config;
+
+uint32_t timer_read32(void) {
+    return 0;
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return 0;
+}
+
+/*
+ * The user datablock, and the power
+ */
+
+typedef enum tear_t {
+    TEAR_DROP,    // the byte the power is cut at is never written
+    TEAR_GARBAGE, // or is written with garbage
+    TEAR_COUNT,
+} tear_t;
+
+static uint8_t  datablock[EECONFIG_USER_DATA_SIZE];
+static bool     datablock_valid;
+static int32_t  power_left = -1; // bytes that can still be written before the power is cut, or -1 for no cut
+static tear_t   tear;
+static uint32_t bytes_written, out_of_bounds;
+
+bool eeconfig_is_user_datablock_valid(void) {
+    return datablock_valid;
+}
+
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t size) {
+    if (offset + size > sizeof(datablock)) {
+        out_of_bounds++;
+        return;
+    }
+    memcpy(data, &datablock[offset], size);
+}
+
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t size) {
+    if (offset + size > sizeof(datablock)) {
+        out_of_bounds++;
+        return;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        if (power_left == 0) {
+            if (tear == TEAR_GARBAGE) {
+                datablock[offset + i] = rand();
+                tear                  = TEAR_DROP;
+            }
+            continue;
+        }
+        if (power_left > 0) {
+            power_left--;
+        }
+        datablock[offset + i] = ((const uint8_t *)data)[i];
+        datablock_valid       = true; // the core writes the version along with the data
+        bytes_written++;
+    }
+}
+
+/*
+ * Journal: every key is old or new after a cut
+ */
+
+typedef struct key_value_t {
+    uint8_t data[TEST_VALUE_SIZE];
+    uint8_t size; // 0 if the key was never written
+} key_value_t;
+
+static key_value_t values[CONFIG_JOURNAL_KEY_COUNT];
+
+static void random_value(key_value_t *value) {
+    value->size = 1 + rand() % TEST_VALUE_SIZE;
+    for (uint8_t i = 0; i < value->size; i++) {
+        value->data[i] = rand();
+    }
+}
+
+static bool key_is(uint8_t key, const key_value_t *value) {
+    uint8_t data[UINT8_MAX];
+    uint8_t size = config_journal_read(key, data, sizeof(data));
+    return size == value->size && memcmp(data, value->data, size) == 0;
+}
+
+/**
+ * @brief Checks every key after a boot, with `key` allowed to be either its old value or `new_value`.
+ *
+ * @return true if every key is as expected, with *is_new set if `key` has the new value
+ */
+static bool keys_are(const key_value_t *expected, uint8_t key, const key_value_t *new_value, bool *is_new) {
+    for (uint8_t i = 0; i < CONFIG_JOURNAL_KEY_COUNT; i++) {
+        if (i == key && key_is(i, new_value)) {
+            *is_new = true;
+        } else if (!key_is(i, &expected[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+typedef struct journal_stats_t {
+    uint32_t writes, compactions, cuts, new_values, torn_boots;
+} journal_stats_t;
+
+/**
+ * @brief Makes a write once for every byte it writes, with the power cut at that byte, checks each boot after the
+ * cut, and then makes it for real.
+ */
+static bool test_write(uint8_t key, const key_value_t *value, journal_stats_t *stats) {
+    static uint8_t before[sizeof(datablock)];
+    key_value_t    expected[CONFIG_JOURNAL_KEY_COUNT], follow_value;
+    uint8_t        follow_key;
+
+    memcpy(before, datablock, sizeof(datablock));
+    config_journal_init();
+    bytes_written = 0;
+    config_journal_write(key, value->data, value->size);
+    uint32_t total = bytes_written;
+
+    for (uint32_t cut = 0; cut < total; cut++) {
+        for (tear_t mode = 0; mode < TEAR_COUNT; mode++) {
+            bool is_new = false;
+
+            memcpy(datablock, before, sizeof(datablock));
+            config_journal_init();
+            power_left = cut;
+            tear       = mode;
+            config_journal_write(key, value->data, value->size);
+            power_left = -1;
+
+            config_journal_init();
+            stats->cuts++;
+            stats->torn_boots += config_journal_get_stats()->torn;
+            if (!keys_are(values, key, value, &is_new)) {
+                printf("write %u, key %u: a key was lost by a power cut after %u of %u bytes (%s)\n", stats->writes,
+                       key, cut, total, mode == TEAR_DROP ? "dropped" : "garbage");
+                return false;
+            }
+            stats->new_values += is_new;
+
+            // writes carry on after the cut, and survive the next boot
+            memcpy(expected, values, sizeof(values));
+            if (is_new) {
+                expected[key] = *value;
+            }
+            follow_key = rand() % CONFIG_JOURNAL_KEY_COUNT;
+            random_value(&follow_value);
+            if (!config_journal_write(follow_key, follow_value.data, follow_value.size)) {
+                printf("write %u: a write after a power cut failed\n", stats->writes);
+                return false;
+            }
+            expected[follow_key] = follow_value;
+            config_journal_init();
+            if (!keys_are(expected, CONFIG_JOURNAL_KEY_COUNT, NULL, &is_new)) {
+                printf("write %u, key %u: a write after a power cut after %u of %u bytes (%s) was lost\n",
+                       stats->writes, key, cut, total, mode == TEAR_DROP ? "dropped" : "garbage");
+                return false;
+            }
+        }
+    }
+
+    memcpy(datablock, before, sizeof(datablock));
+    config_journal_init();
+    uint16_t compactions = config_journal_get_stats()->compactions;
+    if (!config_journal_write(key, value->data, value->size)) {
+        printf("write %u: failed\n", stats->writes);
+        return false;
+    }
+    stats->compactions += config_journal_get_stats()->compactions != compactions;
+    values[key] = *value;
+    stats->writes++;
+    return true;
+}
+
+static bool test_journal(void) {
+    journal_stats_t stats = {0};
+    bool            is_new;
+
+    memset(datablock, 0, sizeof(datablock));
+    if (config_journal_init()) {
+        printf("a journal was found in a blank datablock\n");
+        return false;
+    }
+    for (uint16_t i = 0; i < TEST_WRITES; i++) {
+        key_value_t value;
+        random_value(&value);
+        if (!test_write(rand() % CONFIG_JOURNAL_KEY_COUNT, &value, &stats)) {
+            return false;
+        }
+    }
+    config_journal_init();
+    if (!keys_are(values, CONFIG_JOURNAL_KEY_COUNT, NULL, &is_new)) {
+        printf("a key was lost\n");
+        return false;
+    }
+    if (stats.compactions < 10) {
+        printf("only %u compactions\n", stats.compactions);
+        return false;
+    }
+    printf("journal: %u writes, %u compactions, %u power cuts (%u new, %u torn tails): no key was lost\n",
+           stats.writes, stats.compactions, stats.cuts, stats.new_values, stats.torn_boots);
+    return true;
+}
+
+/*
+ * Migration from the legacy config block
+ */
+
+typedef struct test_group_t {
+    uint8_t offset, size;
+} test_group_t;
+
+#define TEST_GROUP(member) {offsetof(userspace_config_t, member), sizeof(((userspace_config_t *)NULL)->member)}
+
+// the groups drashna_eeconfig.c writes, as the bytes between them aren't stored
+static const test_group_t groups[] = {
+    TEST_GROUP(rgb),
+    TEST_GROUP(gaming),
+    TEST_GROUP(display),
+    TEST_GROUP(debug),
+    TEST_GROUP(pointing),
+    TEST_GROUP(rtc),
+    {offsetof(userspace_config_t, rtc) + sizeof(((userspace_config_t *)NULL)->rtc), 1}, // nuke_switch and check
+};
+
+static bool config_is(const userspace_config_t *expected) {
+    for (uint8_t i = 0; i < sizeof(groups) / sizeof(groups[0]); i++) {
+        if (memcmp(&userspace_config.raw[groups[i].offset], &expected->raw[groups[i].offset], groups[i].size) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_migration(void) {
+    static uint8_t     legacy_image[sizeof(datablock)];
+    userspace_config_t legacy;
+
+    for (uint8_t i = 0; i < sizeof(legacy.raw); i++) {
+        legacy.raw[i] = rand();
+    }
+    legacy.check = true;
+    memset(datablock, 0, sizeof(datablock));
+    memcpy(datablock, &legacy, USERSPACE_CONFIG_SIZE);
+    datablock_valid = true;
+    memcpy(legacy_image, datablock, sizeof(datablock));
+
+    bytes_written = 0;
+    userspace_config_read();
+    uint32_t total = bytes_written;
+    if (!config_is(&legacy) || total == 0) {
+        printf("the legacy config block wasn't migrated\n");
+        return false;
+    }
+    if (memcmp(datablock, legacy_image, USERSPACE_CONFIG_SIZE) != 0) {
+        printf("the legacy config block was written to\n");
+        return false;
+    }
+    bytes_written = 0;
+    userspace_config_read();
+    if (!config_is(&legacy) || bytes_written != 0) {
+        printf("the migrated config didn't come back from the journal on the next boot\n");
+        return false;
+    }
+
+    for (uint32_t cut = 0; cut < total; cut++) {
+        for (tear_t mode = 0; mode < TEAR_COUNT; mode++) {
+            memcpy(datablock, legacy_image, sizeof(datablock));
+            power_left = cut;
+            tear       = mode;
+            userspace_config_read();
+            power_left = -1;
+            userspace_config_read();
+            userspace_config_read();
+            if (!config_is(&legacy) || !userspace_config.check) {
+                printf("migration: the legacy config was lost by a power cut after %u of %u bytes (%s)\n", cut, total,
+                       mode == TEAR_DROP ? "dropped" : "garbage");
+                return false;
+            }
+        }
+    }
+
+    // changes after the migration are kept, rather than migrated over again
+    userspace_config.rtc.timezone = userspace_config.rtc.timezone + 1;
+    userspace_config.rgb.idle_anim ^= 1;
+    legacy = userspace_config;
+    userspace_config_mark_dirty();
+    userspace_config_flush();
+    userspace_config_read();
+    if (!config_is(&legacy)) {
+        printf("a change made after the migration was lost\n");
+        return false;
+    }
+
+    // without a valid legacy block, nothing is migrated, and the check bit is left clear for the defaults
+    memset(datablock, 0, sizeof(datablock));
+    datablock_valid = false;
+    bytes_written   = 0;
+    userspace_config_read();
+    if (userspace_config.check || bytes_written != 0) {
+        printf("an invalid datablock was migrated\n");
+        return false;
+    }
+    memcpy(datablock, legacy_image, sizeof(datablock));
+    datablock[offsetof(userspace_config_t, rtc) + sizeof(legacy.rtc)] = 0; // check bit
+    datablock_valid                                                     = true;
+    userspace_config_read();
+    if (userspace_config.check || bytes_written != 0) {
+        printf("a legacy block without the check bit was migrated\n");
+        return false;
+    }
+
+    printf("migration: %u bytes written, %u power cuts: the legacy config was never lost\n", total,
+           total * TEAR_COUNT);
+    return true;
+}
+
+int main(void) {
+    srand(1);
+    if (!test_journal() || !test_migration() || out_of_bounds) {
+        if (out_of_bounds) {
+            printf("%u accesses past the end of the datablock\n", out_of_bounds);
+        }
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("every power cut recovered either the old or the new value\n");
+    return 0;
+}
@@ -0,0 +1,589 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host check and benchmark for console_ring.c, and the console sinks fed from it by sendchar.c.
+ *
+ * Checks the line lookup the displays use, console_ring_get_lines(), against the lines of the whole output kept
+ * separately, after every chunk of random output with empty, short, overlong and longer than the ring lines, from
+ * before the ring first wraps to long after. Then checks the reader accounting: a reader that reads random amounts
+ * at random intervals, and falls more than a ring behind at times, has to read every byte right for its position,
+ * pick up at the oldest byte held after a drop, and read and drop exactly as many bytes as were written between
+ * them, across several wraps of the 16 bit positions. The same again with the writer in another thread, so that
+ * reads are lapped while they copy. The copies console_ring.c makes go through test_memcpy(), which yields part way
+ * through while the threads run, so that the threads swap in the middle of copies even on a single core.
+ *
+ * Then checks housekeeping_task_sendchar() with a busy endpoint: the USB sink stops taking bytes part way through,
+ * and has to pick up where it stopped once it's free again, with nothing lost or repeated, while the other sinks are
+ * fed everything. And once it's been busy for more than a ring's worth, it has to count the rest as dropped.
+ *
+ * Then it times a stand in for the scan loop: a fixed amount of work per scan, with the three sinks each costing a
+ * fixed time per byte. That's timed with no logging, with a line of logging every scan, with a 768 byte burst every
+ * 8 scans, and with a 2 KB dump every 1000 scans, through the ring and housekeeping_task_sendchar(), and through the
+ * inline sendchar the ring replaced, which handed every byte to every sink as it was printed. It reports the mean time
+ * of all scans, what that is over no logging, and the mean of the scans that printed (the slowest scan on a host is
+ * down to the host). The sinks are fed all the ring holds each scan, so logging costs about the same either way, as
+ * the sinks do the same work, and every byte of the lines and the bursts has to be delivered. The dumps don't fit in
+ * the ring, so through it only the last ring's worth of each is delivered, and the rest has to be counted as dropped.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -pthread -Dmemcpy=test_memcpy -DSEGGER_RTT_ENABLE -DVIRTSER_ENABLE -o console_ring_bench \
+ *         -Iusers/drashna/bench/qmk -Iusers/drashna users/drashna/bench/console_ring_bench.c \
+ *         users/drashna/console_ring.c users/drashna/sendchar.c
+ *     ./console_ring_bench
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "console_ring.h"
+#include "sendchar.h"
+#include "SEGGER_RTT.h"
+#include "virtser.h"
+
+#define TEST_LINE_COUNT      25
+#define TEST_LINE_LENGTH     38
+#define TEST_LINES_OUTPUT    (256 * 1024)
+#define TEST_READER_OUTPUT   (4 * 65536)
+#define TEST_THREADED_OUTPUT (16 * 65536)
+#define TEST_BUSY_OUTPUT     600
+#define TEST_BUSY_TAKEN      100 // bytes the USB sink takes before it's busy
+#define YIELD_ONE_IN         512 // chance of yielding after each byte copied, while the threads run
+
+#define BENCH_SCANS       20000
+#define BENCH_SCAN_SPINS  2000 // work in a scan
+#define BENCH_SINK_SPINS  40   // work per byte, in each sink
+#define BENCH_BURST_SIZE  768
+#define BENCH_BURST_EVERY 8
+#define BENCH_DUMP_SIZE   2048
+#define BENCH_DUMP_EVERY  1000
+
+/*
+ * Everything written to the ring, and what each byte at a position should be
+ */
+
+static uint32_t written;
+
+static uint8_t pattern(uint32_t position) {
+    return (position * 2654435761u) >> 24;
+}
+
+static uint32_t random_below(uint32_t limit) {
+    static _Thread_local uint32_t state = 0;
+
+    if (state == 0) {
+        state = (uint32_t)(uintptr_t)&state | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % limit;
+}
+
+static volatile bool yield_in_copies;
+static uint32_t      copies;
+
+void *test_memcpy(void *destination, const void *source, size_t size) {
+    volatile uint8_t *to   = destination;
+    const uint8_t    *from = source;
+
+    copies++;
+    for (size_t i = 0; i < size; i++) {
+        to[i] = from[i];
+        if (yield_in_copies && random_below(YIELD_ONE_IN) == 0) {
+            sched_yield();
+        }
+    }
+    return destination;
+}
+
+#define CHECK(condition, ...) \
+    if (!(condition)) {       \
+        printf(__VA_ARGS__);  \
+        printf("\n");         \
+        return false;         \
+    }
+
+/*
+ * console_ring_get_lines(), against the whole output
+ */
+
+static uint8_t output[TEST_LINES_OUTPUT];
+
+static bool check_lines(void) {
+    console_ring_line_t lines[TEST_LINE_COUNT];
+    bool                wrapped = written >= CONSOLE_RING_SIZE;
+    uint32_t            oldest  = wrapped ? written - CONSOLE_RING_SIZE : 0;
+    uint32_t            end     = written;
+
+    console_ring_get_lines(lines, TEST_LINE_COUNT, TEST_LINE_LENGTH);
+    for (int i = TEST_LINE_COUNT - 1; i >= 0; i--) {
+        uint32_t start = end;
+        while (start && output[start - 1] != '\n') {
+            start--;
+        }
+
+        // a line is only whole in the ring if the newline before it is too, or it's the start of the output
+        bool     whole  = start ? start - 1 >= oldest : !wrapped;
+        uint32_t length = !whole ? 0 : end - start < TEST_LINE_LENGTH ? end - start : TEST_LINE_LENGTH;
+        CHECK(lines[i].length == length, "%u bytes written: line %d is %u long, expected %u", written, i,
+              lines[i].length, length);
+        for (uint8_t j = 0; j < length; j++) {
+            CHECK(console_ring_peek(lines[i].start + j) == output[start + j],
+                  "%u bytes written: line %d differs at byte %u", written, i, j);
+        }
+        if (!whole || !start) {
+            // everything older is gone too, or never was
+            while (--i >= 0) {
+                CHECK(lines[i].length == 0, "%u bytes written: line %d is %u long, expected none", written, i,
+                      lines[i].length);
+            }
+            break;
+        }
+        end = start - 1;
+    }
+    return true;
+}
+
+static uint32_t random_line_length(void) {
+    uint32_t roll = random_below(100);
+    if (roll < 15) {
+        return 0;
+    } else if (roll < 60) {
+        return 1 + random_below(TEST_LINE_LENGTH);
+    } else if (roll < 98) {
+        return TEST_LINE_LENGTH + random_below(3 * TEST_LINE_LENGTH);
+    }
+    return CONSOLE_RING_SIZE / 2 + random_below(CONSOLE_RING_SIZE);
+}
+
+static bool test_lines(uint32_t *checks) {
+    uint32_t length = 0;
+
+    // the lines test owns the ring from the start, so it sees the output before the ring first wraps
+    while (written < TEST_LINES_OUTPUT) {
+        uint32_t chunk = 1 + random_below(40);
+        for (uint32_t i = 0; i < chunk && written < TEST_LINES_OUTPUT; i++) {
+            uint8_t c;
+            if (!length) {
+                c      = '\n';
+                length = random_line_length() + 1;
+            } else {
+                c = 'a' + random_below(26);
+            }
+            length--;
+            output[written++] = c;
+            console_ring_write(c);
+        }
+        if (!check_lines()) {
+            return false;
+        }
+        (*checks)++;
+    }
+    return true;
+}
+
+/*
+ * Reader accounting
+ */
+
+typedef struct test_reader_t {
+    console_ring_reader_t reader;
+    uint32_t              position; // of the next byte, not wrapped
+    uint32_t              reads, read, dropped, drops;
+} test_reader_t;
+
+static void test_reader_init(test_reader_t *test) {
+    memset(test, 0, sizeof(*test));
+    test->reader.tail = console_ring_head();
+    test->position    = written;
+}
+
+/**
+ * @brief Reads, and checks what was read against the position it's from.
+ *
+ * @param head_at_read bytes written when the read was made, or 0 when the writer is another thread
+ */
+static bool test_reader_read(test_reader_t *test, uint16_t size, uint32_t head_at_read) {
+    uint8_t  buffer[CONSOLE_RING_SIZE];
+    uint32_t dropped = test->reader.dropped;
+    uint16_t count   = console_ring_read(&test->reader, buffer, size);
+
+    test->reads++;
+    if (test->reader.dropped != dropped) {
+        test->position += test->reader.dropped - dropped;
+        test->dropped += test->reader.dropped - dropped;
+        test->drops++;
+        CHECK(!head_at_read || test->position == head_at_read - CONSOLE_RING_SIZE,
+              "after a drop, the reader picked up at %u, not the oldest byte held (%u)", test->position,
+              head_at_read - CONSOLE_RING_SIZE);
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        CHECK(buffer[i] == pattern(test->position + i), "read 0x%02X at %u, expected 0x%02X", buffer[i],
+              test->position + i, pattern(test->position + i));
+    }
+    test->position += count;
+    test->read += count;
+    CHECK((uint16_t)test->position == test->reader.tail, "reader tail %u, expected %u", test->reader.tail,
+          (uint16_t)test->position);
+    return true;
+}
+
+static bool test_reader(test_reader_t *test) {
+    uint32_t start = written;
+
+    test_reader_init(test);
+    while (written - start < TEST_READER_OUTPUT) {
+        // mostly short bursts that the reader keeps up with, and now and then more than a ring's worth
+        uint32_t burst = random_below(20) ? random_below(CONSOLE_RING_SIZE / 4) : random_below(3 * CONSOLE_RING_SIZE);
+        for (uint32_t i = 0; i < burst; i++) {
+            console_ring_write(pattern(written++));
+        }
+        for (uint8_t reads = random_below(4); reads > 0; reads--) {
+            if (!test_reader_read(test, 1 + random_below(CONSOLE_RING_SIZE), written)) {
+                return false;
+            }
+        }
+    }
+    while (test->position != written) {
+        if (!test_reader_read(test, CONSOLE_RING_SIZE, written)) {
+            return false;
+        }
+    }
+    CHECK(test->read + test->dropped == written - start, "read %u and dropped %u of %u bytes", test->read,
+          test->dropped, written - start);
+    CHECK(test->drops, "the reader never fell behind");
+    return true;
+}
+
+static volatile bool writer_done;
+
+static void *writer_thread(void *arg) {
+    uint32_t end = written + TEST_THREADED_OUTPUT;
+
+    while (written < end) {
+        // mostly short bursts, and now and then a few rings, so the reader falls behind when it next runs
+        uint32_t burst = random_below(8) ? random_below(CONSOLE_RING_SIZE / 4) : random_below(3 * CONSOLE_RING_SIZE);
+        for (; burst > 0 && written < end; burst--) {
+            console_ring_write(pattern(written));
+            __atomic_store_n(&written, written + 1, __ATOMIC_RELEASE);
+        }
+        sched_yield();
+    }
+    writer_done = true;
+    return NULL;
+}
+
+static void *reader_thread(void *arg) {
+    test_reader_t *test = (test_reader_t *)arg;
+
+    while (true) {
+        bool done = writer_done;
+        if (!test_reader_read(test, 1 + random_below(CONSOLE_RING_SIZE), 0)) {
+            return (void *)1;
+        }
+        if (done && test->position == __atomic_load_n(&written, __ATOMIC_ACQUIRE)) {
+            return NULL;
+        }
+        if (random_below(4) == 0) {
+            sched_yield();
+        }
+    }
+}
+
+static bool test_reader_threaded(test_reader_t *test, uint32_t *lapped) {
+    uint32_t  start = written;
+    pthread_t writer, reader;
+    void     *failed;
+
+    test_reader_init(test);
+    copies          = 0;
+    yield_in_copies = true;
+    pthread_create(&reader, NULL, reader_thread, test);
+    pthread_create(&writer, NULL, writer_thread, NULL);
+    pthread_join(writer, NULL);
+    pthread_join(reader, &failed);
+    yield_in_copies = false;
+    if (failed) {
+        return false;
+    }
+    CHECK(test->read + test->dropped == written - start, "read %u and dropped %u of %u bytes", test->read,
+          test->dropped, written - start);
+    CHECK(test->drops, "the reader never fell behind");
+    // every attempt at a read makes two copies, so any more than that were reads that were lapped and retried
+    *lapped = copies / 2 - test->reads;
+    CHECK(*lapped, "no read was lapped while it copied");
+    return true;
+}
+
+/*
+ * Console sinks, which take a fixed time per byte, and a USB endpoint that can be busy
+ */
+
+static volatile uint32_t spin;
+static bool              sinks_cost;
+static uint32_t          sink_bytes;
+static int32_t           usb_free = -1; // bytes the USB sink takes before it's busy, or -1 for no limit
+static bool              usb_check;
+static uint32_t          usb_bytes, usb_position, usb_wrong;
+
+static void spend(uint32_t spins) {
+    for (uint32_t i = 0; i < spins; i++) {
+        spin++;
+    }
+}
+
+static void sink(uint32_t size) {
+    sink_bytes += size;
+    if (sinks_cost) {
+        spend(size * BENCH_SINK_SPINS);
+    }
+}
+
+int8_t sendchar(uint8_t c) {
+    if (usb_free == 0) {
+        return -1;
+    } else if (usb_free > 0) {
+        usb_free--;
+    }
+    usb_bytes++;
+    if (usb_check && c != pattern(usb_position++)) {
+        usb_wrong++;
+    }
+    sink(1);
+    return 0;
+}
+
+unsigned SEGGER_RTT_Write(unsigned BufferIndex, const void *pBuffer, unsigned NumBytes) {
+    sink(NumBytes);
+    return NumBytes;
+}
+
+void virtser_send(const uint8_t byte) {
+    sink(1);
+}
+
+uint32_t timer_read32(void) {
+    return 0;
+}
+
+/*
+ * housekeeping_task_sendchar(), with a busy endpoint
+ */
+
+static bool test_busy(void) {
+    // catch the sinks up on the tests before
+    housekeeping_task_sendchar();
+    uint32_t dropped = console_sink_get_dropped(CONSOLE_SINK_USB);
+    sink_bytes   = 0;
+    usb_bytes    = 0;
+    usb_position = written;
+    usb_check    = true;
+
+    usb_free = TEST_BUSY_TAKEN;
+    for (uint16_t i = 0; i < TEST_BUSY_OUTPUT; i++) {
+        console_ring_write(pattern(written++));
+    }
+    housekeeping_task_sendchar();
+    CHECK(usb_bytes == TEST_BUSY_TAKEN, "the busy USB sink was sent %u bytes, expected %u", usb_bytes,
+          TEST_BUSY_TAKEN);
+    CHECK(sink_bytes - usb_bytes == (CONSOLE_SINK_COUNT - 1) * TEST_BUSY_OUTPUT,
+          "the other sinks were sent %u bytes, expected %u", sink_bytes - usb_bytes,
+          (CONSOLE_SINK_COUNT - 1) * TEST_BUSY_OUTPUT);
+
+    usb_free = -1;
+    housekeeping_task_sendchar();
+    CHECK(usb_bytes == TEST_BUSY_OUTPUT && !usb_wrong,
+          "once free, the USB sink had been sent %u bytes, %u of them wrong, expected %u", usb_bytes, usb_wrong,
+          TEST_BUSY_OUTPUT);
+
+    // busy for three rings' worth, so it only gets the last
+    usb_free = 0;
+    for (uint16_t i = 0; i < 3 * CONSOLE_RING_SIZE; i++) {
+        console_ring_write(pattern(written++));
+    }
+    housekeeping_task_sendchar();
+    CHECK(usb_bytes == TEST_BUSY_OUTPUT, "the busy USB sink was sent %u bytes", usb_bytes - TEST_BUSY_OUTPUT);
+    usb_free     = -1;
+    usb_position = written - CONSOLE_RING_SIZE;
+    housekeeping_task_sendchar();
+    uint32_t usb_dropped = console_sink_get_dropped(CONSOLE_SINK_USB) - dropped;
+    CHECK(usb_bytes == TEST_BUSY_OUTPUT + CONSOLE_RING_SIZE && !usb_wrong,
+          "after falling behind, the USB sink was sent %u bytes, %u of them wrong, expected the last %u",
+          usb_bytes - TEST_BUSY_OUTPUT, usb_wrong, CONSOLE_RING_SIZE);
+    CHECK(usb_dropped == 2 * CONSOLE_RING_SIZE, "the USB sink dropped %u bytes, expected %u", usb_dropped,
+          2 * CONSOLE_RING_SIZE);
+    usb_check = false;
+    return true;
+}
+
+/*
+ * Scan loop benchmark
+ */
+
+/**
+ * @brief The sendchar the ring replaced, which handed each character to every sink as it was printed.
+ */
+static int8_t inline_sendchar(uint8_t c) {
+    sendchar(c);
+    SEGGER_RTT_Write(0, &c, 1);
+    virtser_send(c);
+    return 0;
+}
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+typedef enum bench_logging_t {
+    BENCH_LOGGING_NONE,
+    BENCH_LOGGING_LINES,
+    BENCH_LOGGING_BURSTS,
+    BENCH_LOGGING_DUMPS,
+} bench_logging_t;
+
+typedef struct bench_result_t {
+    double   mean_us, printing_mean_us;
+    uint32_t printed, delivered, dropped;
+} bench_result_t;
+
+static uint32_t dropped_bytes(void) {
+    uint32_t dropped = 0;
+    for (uint8_t i = 0; i < CONSOLE_SINK_COUNT; i++) {
+        dropped += console_sink_get_dropped(i);
+    }
+    return dropped;
+}
+
+static bench_result_t bench(bench_logging_t logging, bool ring) {
+    static const char line[] = "layer 3, mods 0x02, keycode 0x0004 pressed\n";
+    int8_t (*print_char)(uint8_t) = ring ? drashna_sendchar : inline_sendchar;
+    bench_result_t result         = {0};
+    double         total = 0, printing_total = 0;
+    uint32_t       printing_scans = 0;
+
+    // catch the sinks up on everything before, for free
+    sinks_cost = false;
+    housekeeping_task_sendchar();
+    sinks_cost       = true;
+    sink_bytes       = 0;
+    uint32_t dropped = dropped_bytes();
+
+    for (uint32_t scan = 0; scan < BENCH_SCANS; scan++) {
+        bool printing = logging == BENCH_LOGGING_LINES ||
+                        (logging == BENCH_LOGGING_BURSTS && scan % BENCH_BURST_EVERY == 0) ||
+                        (logging == BENCH_LOGGING_DUMPS && scan % BENCH_DUMP_EVERY == 0);
+        double start = now();
+        spend(BENCH_SCAN_SPINS);
+        if (logging == BENCH_LOGGING_LINES) {
+            for (const char *c = line; *c; c++) {
+                print_char(*c);
+            }
+            result.printed += sizeof(line) - 1;
+        } else if (printing) {
+            uint16_t size = logging == BENCH_LOGGING_BURSTS ? BENCH_BURST_SIZE : BENCH_DUMP_SIZE;
+            for (uint16_t i = 0; i < size; i++) {
+                print_char(i % 64 == 63 ? '\n' : 'a' + i % 26);
+            }
+            result.printed += size;
+        }
+        housekeeping_task_sendchar();
+        double elapsed = (now() - start) * 1e6;
+        total += elapsed;
+        if (printing) {
+            printing_total += elapsed;
+            printing_scans++;
+        }
+    }
+    result.mean_us          = total / BENCH_SCANS;
+    result.printing_mean_us = printing_scans ? printing_total / printing_scans : 0;
+    result.delivered        = sink_bytes;
+    result.dropped          = dropped_bytes() - dropped;
+    return result;
+}
+
+/**
+ * @brief Checks that every sink was sent all that was printed, or through the ring, all of it that fit in the ring.
+ */
+static bool check_bench(bench_logging_t logging, bool ring, const bench_result_t *result) {
+    uint32_t dropped = 0;
+
+    if (ring && logging == BENCH_LOGGING_DUMPS) {
+        dropped = (BENCH_DUMP_SIZE - CONSOLE_RING_SIZE) * (BENCH_SCANS / BENCH_DUMP_EVERY) * CONSOLE_SINK_COUNT;
+    }
+    CHECK(result->delivered == result->printed * CONSOLE_SINK_COUNT - dropped && result->dropped == dropped,
+          "%s: %u bytes printed, %u delivered and %u dropped, expected %u dropped", ring ? "ring" : "inline",
+          result->printed, result->delivered, result->dropped, dropped);
+    return true;
+}
+
+static double sink_ns_per_byte(void) {
+    uint32_t passes = 0;
+    double   start  = now(), elapsed;
+
+    sinks_cost = true;
+    do {
+        sink(1024);
+        passes++;
+    } while ((elapsed = now() - start) < 0.25);
+    return elapsed * 1e9 / (passes * 1024.0);
+}
+
+int main(void) {
+    static const char *logging_names[] = {"no logging", "a line every scan", "768 B every 8 scans",
+                                          "2 KB every 1000 scans"};
+    test_reader_t      test;
+    uint32_t           checks = 0, lapped;
+    bench_result_t     inline_none, ring_none;
+
+    if (!test_lines(&checks)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("console_ring_get_lines: matched the whole output after %u chunks of %u bytes\n", checks, written);
+    if (!test_reader(&test)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("reader: %u bytes read and %u dropped in %u drops, every byte right for its position\n", test.read,
+           test.dropped, test.drops);
+    if (!test_reader_threaded(&test, &lapped)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("threaded reader: %u bytes read and %u dropped in %u drops, %u reads lapped, every byte right for its "
+           "position\n",
+           test.read, test.dropped, test.drops, lapped);
+    if (!test_busy()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("busy endpoint: the USB sink picked up where it stopped, and counted what it fell behind on as dropped\n");
+
+    printf("scan loop, %d sinks at %.1f ns/byte each:\n", CONSOLE_SINK_COUNT, sink_ns_per_byte());
+    for (bench_logging_t logging = BENCH_LOGGING_NONE; logging <= BENCH_LOGGING_DUMPS; logging++) {
+        bench_result_t inline_result = bench(logging, false), ring_result = bench(logging, true);
+        if (logging == BENCH_LOGGING_NONE) {
+            inline_none = inline_result;
+            ring_none   = ring_result;
+        }
+        printf("  %-22s inline: %6.2f us mean, %+6.2f us over none, %7.2f us printing, %7u bytes delivered\n",
+               logging_names[logging], inline_result.mean_us, inline_result.mean_us - inline_none.mean_us,
+               inline_result.printing_mean_us, inline_result.delivered);
+        printf("  %-22s ring:   %6.2f us mean, %+6.2f us over none, %7.2f us printing, %7u bytes delivered, %u "
+               "dropped\n",
+               "", ring_result.mean_us, ring_result.mean_us - ring_none.mean_us, ring_result.printing_mean_us,
+               ring_result.delivered, ring_result.dropped);
+        if (!check_bench(logging, false, &inline_result) || !check_bench(logging, true, &ring_result)) {
+            printf("FAILED\n");
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host check and benchmark for drashna_crc.c, against the bit-at-a-time CRC-16/ARC it replaced.
+ *
+ * Checks crc16_update_byte() against the bitwise update for every CRC value and every byte, and the standard check
+ * value. Then checks that a CRC built up a piece at a time, the way the dynamic macros and the config journal build
+ * theirs, matches the CRC of the whole block, for random blocks split at random points. Last, it times both over
+ * buffers the size of a dynamic macro slot and a config journal bank.
+ *
+ * Build it once for each table: the 256 entry one, and the 16 entry one that AVR uses (from PROGMEM).
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o crc_bench -Iusers/drashna/bench/qmk -Iusers/drashna users/drashna/bench/crc_bench.c \
+ *         users/drashna/drashna_crc.c
+ *     ./crc_bench
+ *     cc -O2 -DCRC16_NIBBLE_TABLE -o crc_bench_nibble -Iusers/drashna/bench/qmk -Iusers/drashna \
+ *         users/drashna/bench/crc_bench.c users/drashna/drashna_crc.c
+ *     ./crc_bench_nibble
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "drashna_crc.h"
+
+#define MIN_BENCH_SECONDS 0.25
+#define BENCH_BLOCKS      10000
+#define BENCH_MAX_SIZE    1024
+
+#ifdef CRC16_NIBBLE_TABLE
+#    define BENCH_TABLE "16 entry table"
+#else // CRC16_NIBBLE_TABLE
+#    define BENCH_TABLE "256 entry table"
+#endif // CRC16_NIBBLE_TABLE
+
+/**
+ * @brief The bit-at-a-time update the tables replaced. Kept out of line, as it was in the firmware.
+ */
+__attribute__((noinline)) static uint16_t crc16_update_bitwise(uint16_t crc, uint8_t data) {
+    crc ^= data;
+    for (uint8_t i = 0; i < 8; ++i) {
+        if (crc & 1) {
+            crc = (crc >> 1) ^ 0xA001;
+        } else {
+            crc = (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static uint16_t crc16_block_bitwise(uint16_t crc, const uint8_t *data, uint16_t size) {
+    while (size--) {
+        crc = crc16_update_bitwise(crc, *data++);
+    }
+    return crc;
+}
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+/*
+ * Checks
+ */
+
+static bool check_every_byte(void) {
+    for (uint32_t crc = 0; crc <= UINT16_MAX; crc++) {
+        for (uint16_t data = 0; data <= UINT8_MAX; data++) {
+            if (crc16_update_byte(crc, data) != crc16_update_bitwise(crc, data)) {
+                printf("crc 0x%04X, byte 0x%02X: 0x%04X, expected 0x%04X\n", crc, data, crc16_update_byte(crc, data),
+                       crc16_update_bitwise(crc, data));
+                return false;
+            }
+        }
+    }
+    uint16_t check = crc16_update_block(0, "123456789", 9);
+    if (check != 0xBB3D) {
+        printf("check value 0x%04X, expected 0xBB3D\n", check);
+        return false;
+    }
+    return true;
+}
+
+static bool check_incremental(void) {
+    static uint8_t block[BENCH_MAX_SIZE];
+
+    for (uint32_t i = 0; i < BENCH_BLOCKS; i++) {
+        uint16_t size = rand() % (BENCH_MAX_SIZE + 1), seed = rand() % 2 ? 0 : 0xFFFF;
+        for (uint16_t j = 0; j < size; j++) {
+            block[j] = rand();
+        }
+
+        uint16_t whole = crc16_update_block(seed, block, size), pieces = seed;
+        for (uint16_t offset = 0, piece; offset < size; offset += piece) {
+            piece  = rand() % 4 ? 1 + rand() % 16 : 0; // single bytes and short runs, with some empty pieces
+            piece  = piece > size - offset ? size - offset : piece;
+            pieces = crc16_update_block(pieces, &block[offset], piece);
+        }
+        if (whole != pieces || whole != crc16_block_bitwise(seed, block, size)) {
+            printf("block %u of %u bytes: 0x%04X whole, 0x%04X in pieces, 0x%04X bitwise\n", i, size, whole, pieces,
+                   crc16_block_bitwise(seed, block, size));
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Benchmark
+ */
+
+static double bench(uint16_t size, bool bitwise) {
+    static uint8_t    block[BENCH_MAX_SIZE];
+    volatile uint16_t sink;
+    size_t            passes = 0;
+    double            start  = now(), elapsed;
+
+    for (uint16_t i = 0; i < size; i++) {
+        block[i] = rand();
+    }
+    do {
+        sink = bitwise ? crc16_block_bitwise(0, block, size) : crc16_update_block(0, block, size);
+        passes++;
+    } while ((elapsed = now() - start) < MIN_BENCH_SECONDS);
+    (void)sink;
+    return elapsed * 1e9 / ((double)passes * size);
+}
+
+int main(void) {
+    static const struct {
+        const char *name;
+        uint16_t    size;
+    } sizes[] = {
+        {"dynamic macro slot", 197},
+        {"config journal bank", 256},
+        {"1 KiB", 1024},
+    };
+
+    srand(1);
+    if (!check_every_byte() || !check_incremental()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%s: matches the bitwise CRC-16/ARC for every CRC and byte, and in %u blocks built up in pieces\n",
+           BENCH_TABLE, BENCH_BLOCKS);
+    for (uint8_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        double table = bench(sizes[i].size, false), bitwise = bench(sizes[i].size, true);
+        printf("  %-20s %4u bytes: %5.2f ns/byte, bitwise %5.2f ns/byte (%.1fx)\n", sizes[i].name, sizes[i].size,
+               table, bitwise, bitwise / table);
+    }
+    return 0;
+}
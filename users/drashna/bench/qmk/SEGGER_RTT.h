@@ -0,0 +1,8 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for SEGGER_RTT.h, shared by the bench harnesses. The harness provides the sink.
+
+#pragma once
+
+unsigned SEGGER_RTT_Write(unsigned BufferIndex, const void* pBuffer, unsigned NumBytes);
@@ -0,0 +1,31 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's action.h, shared by the bench harnesses. The harness implements process_record().
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+#include "keycodes.h"
+#include "util.h"
+
+typedef struct {
+    bool    interrupted : 1;
+    bool    reserved2 : 1;
+    bool    reserved1 : 1;
+    bool    reserved0 : 1;
+    uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+    uint16_t keycode;
+#endif
+} keyrecord_t;
+
+void process_record(keyrecord_t *record);
+void clear_keyboard(void);
@@ -0,0 +1,19 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's action_layer.h, shared by the bench harnesses. The harness owns the layer state.
+
+#pragma once
+
+#include <stdint.h>
+#include "keyboard.h"
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+void    layer_clear(void);
+bool    layer_state_cmp(layer_state_t cmp_layer_state, uint8_t layer);
+uint8_t get_highest_layer(layer_state_t state);
+void    layer_state_set(layer_state_t state);
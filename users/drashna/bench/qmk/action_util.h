@@ -0,0 +1,12 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's action_util.h, shared by the bench harnesses.
+
+#pragma once
+
+#include <stdint.h>
+
+uint8_t get_mods(void);
+uint8_t get_weak_mods(void);
+uint8_t get_oneshot_mods(void);
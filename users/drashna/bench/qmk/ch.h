@@ -0,0 +1,28 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for ChibiOS's ch.h, shared by the bench harnesses. Locking the system is a mutex the writer threads
+// share.
+
+#pragma once
+
+#include <pthread.h>
+
+typedef int syssts_t;
+
+extern pthread_mutex_t ch_system_lock;
+
+static inline void chSysLock(void) {
+    pthread_mutex_lock(&ch_system_lock);
+}
+static inline void chSysUnlock(void) {
+    pthread_mutex_unlock(&ch_system_lock);
+}
+static inline syssts_t chSysGetStatusAndLockX(void) {
+    chSysLock();
+    return 0;
+}
+static inline void chSysRestoreStatusX(syssts_t status) {
+    (void)status;
+    chSysUnlock();
+}
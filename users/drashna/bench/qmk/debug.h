@@ -0,0 +1,9 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's debug.h, shared by the bench harnesses. Debug output is dropped.
+
+#pragma once
+
+#define dprintf(...)
+#define dprintln(...)
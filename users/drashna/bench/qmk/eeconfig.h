@@ -0,0 +1,18 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's eeconfig.h, shared by the bench harnesses. The harness keeps the user datablock in
+// memory, and it starts past the core config.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EECONFIG_SIZE           64
+#define EECONFIG_USER_DATABLOCK ((uint8_t *)EECONFIG_SIZE)
+
+bool eeconfig_is_enabled(void);
+bool eeconfig_is_user_datablock_valid(void);
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t size);
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t size);
@@ -0,0 +1,13 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's eeprom.h, shared by the bench harnesses. The harness keeps the EEPROM in memory.
+
+#pragma once
+
+#include <stdint.h>
+
+uint8_t eeprom_read_byte(const uint8_t *addr);
+void    eeprom_read_block(void *buf, const void *addr, uint32_t len);
+void    eeprom_update_byte(uint8_t *addr, uint8_t value);
+void    eeprom_update_block(const void *buf, void *addr, uint32_t len);
@@ -0,0 +1,39 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's keyboard.h, shared by the bench harnesses. The key event types, the split side
+// the activity timers and the scan rate.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+#define KEYEQ(keya, keyb) ((keya).row == (keyb).row && (keya).col == (keyb).col)
+
+typedef enum keyevent_type_t {
+    TICK_EVENT        = 0,
+    KEY_EVENT         = 1,
+    ENCODER_CW_EVENT  = 2,
+    ENCODER_CCW_EVENT = 3,
+    COMBO_EVENT       = 4,
+} keyevent_type_t;
+
+typedef struct {
+    keypos_t        key;
+    uint16_t        time;
+    keyevent_type_t type;
+    bool            pressed;
+} keyevent_t;
+
+bool     is_keyboard_master(void);
+bool     is_keyboard_left(void);
+uint32_t last_input_activity_elapsed(void);
+uint32_t last_matrix_activity_time(void);
+uint32_t last_encoder_activity_time(void);
+uint32_t get_matrix_scan_rate(void);
@@ -0,0 +1,30 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's keycode_config.h, shared by the bench harnesses.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef union {
+    uint16_t raw;
+    struct {
+        bool swap_control_capslock    : 1;
+        bool capslock_to_control      : 1;
+        bool swap_lalt_lgui           : 1;
+        bool swap_ralt_rgui           : 1;
+        bool no_gui                   : 1;
+        bool swap_grave_esc           : 1;
+        bool swap_backslash_backspace : 1;
+        bool nkro                     : 1;
+        bool swap_lctl_lgui           : 1;
+        bool swap_rctl_rgui           : 1;
+        bool oneshot_enable           : 1;
+        bool swap_escape_capslock     : 1;
+        bool autocorrect_enable       : 1;
+    };
+} keymap_config_t;
+
+extern keymap_config_t keymap_config;
@@ -0,0 +1,333 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's keycodes.h and modifiers.h, shared by the bench harnesses. Only the ranges, helpers
+// and basic keycodes the harnesses use, with Quantum's values.
+
+#pragma once
+
+#include <stdint.h>
+
+// clang-format off
+#define QK_BASIC                     0x0000
+#define QK_BASIC_MAX                 0x00FF
+#define QK_MODS                      0x0100
+#define QK_MODS_MAX                  0x1FFF
+#define QK_MOD_TAP                   0x2000
+#define QK_MOD_TAP_MAX               0x3FFF
+#define QK_LAYER_TAP                 0x4000
+#define QK_LAYER_TAP_MAX             0x4FFF
+#define QK_LAYER_MOD                 0x5000
+#define QK_LAYER_MOD_MAX             0x51FF
+#define QK_TO                        0x5200
+#define QK_TO_MAX                    0x521F
+#define QK_MOMENTARY                 0x5220
+#define QK_MOMENTARY_MAX             0x523F
+#define QK_DEF_LAYER                 0x5240
+#define QK_DEF_LAYER_MAX             0x525F
+#define QK_TOGGLE_LAYER              0x5260
+#define QK_TOGGLE_LAYER_MAX          0x527F
+#define QK_ONE_SHOT_LAYER            0x5280
+#define QK_ONE_SHOT_LAYER_MAX        0x529F
+#define QK_ONE_SHOT_MOD              0x52A0
+#define QK_ONE_SHOT_MOD_MAX          0x52BF
+#define QK_PERSISTENT_DEF_LAYER      0x52E0
+#define QK_PERSISTENT_DEF_LAYER_MAX  0x52FF
+#define QK_TAP_DANCE                 0x5700
+#define QK_TAP_DANCE_MAX             0x57FF
+#define QK_MAGIC                     0x7000
+#define QK_MAGIC_MAX                 0x70FF
+#define QK_AUDIO                     0x7480
+#define QK_AUDIO_MAX                 0x74BF
+#define QK_COMMUNITY_MODULE          0x77C0
+#define QK_COMMUNITY_MODULE_MAX      0x77FF
+#define QK_LIGHTING                  0x7800
+#define QK_LIGHTING_MAX              0x78FF
+#define QK_QUANTUM                   0x7C00
+#define QK_QUANTUM_MAX               0x7DFF
+#define QK_USER                      0x7E40
+#define QK_USER_MAX                  0x7FFF
+
+#define DYN_MACRO_PROG               0x7C53
+#define DYN_MACRO_KEY00              0x7C54
+#define DYN_MACRO_KEY15              0x7C63
+
+#define IS_QK_BASIC(code)             ((code) >= QK_BASIC && (code) <= QK_BASIC_MAX)
+#define IS_QK_MODS(code)              ((code) >= QK_MODS && (code) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(code)           ((code) >= QK_MOD_TAP && (code) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(code)         ((code) >= QK_LAYER_TAP && (code) <= QK_LAYER_TAP_MAX)
+#define IS_QK_LAYER_MOD(code)         ((code) >= QK_LAYER_MOD && (code) <= QK_LAYER_MOD_MAX)
+#define IS_QK_MOMENTARY(code)         ((code) >= QK_MOMENTARY && (code) <= QK_MOMENTARY_MAX)
+#define IS_QK_DEF_LAYER(code)         ((code) >= QK_DEF_LAYER && (code) <= QK_DEF_LAYER_MAX)
+#define IS_QK_ONE_SHOT_LAYER(code)    ((code) >= QK_ONE_SHOT_LAYER && (code) <= QK_ONE_SHOT_LAYER_MAX)
+#define IS_QK_ONE_SHOT_MOD(code)      ((code) >= QK_ONE_SHOT_MOD && (code) <= QK_ONE_SHOT_MOD_MAX)
+#define IS_QK_AUDIO(code)             ((code) >= QK_AUDIO && (code) <= QK_AUDIO_MAX)
+#define IS_QK_LIGHTING(code)          ((code) >= QK_LIGHTING && (code) <= QK_LIGHTING_MAX)
+#define IS_RGB_KEYCODE(code)          ((code) >= QK_LIGHTING + 0x20 && (code) <= QK_LIGHTING_MAX)
+#define IS_MODIFIER_KEYCODE(code)     ((code) >= KC_LEFT_CTRL && (code) <= KC_RIGHT_GUI)
+
+#define QK_MODS_GET_MODS(kc)          (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+
+#define MAGIC_KEYCODE_RANGE           QK_MAGIC ... QK_MAGIC_MAX
+#define AUDIO_KEYCODE_RANGE           QK_AUDIO ... QK_AUDIO_MAX
+#define QUANTUM_KEYCODE_RANGE         QK_QUANTUM ... QK_QUANTUM_MAX
+#define USER_KEYCODE_RANGE            QK_USER ... QK_USER_MAX
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x11
+#define MOD_RSFT 0x12
+#define MOD_RALT 0x14
+#define MOD_RGUI 0x18
+
+#define MOD_BIT_LCTRL  0x01
+#define MOD_BIT_LSHIFT 0x02
+#define MOD_BIT_LALT   0x04
+#define MOD_BIT_LGUI   0x08
+#define MOD_BIT_RCTRL  0x10
+#define MOD_BIT_RSHIFT 0x20
+#define MOD_BIT_RALT   0x40
+#define MOD_BIT_RGUI   0x80
+#define MOD_MASK_CTRL  (MOD_BIT_LCTRL | MOD_BIT_RCTRL)
+#define MOD_MASK_SHIFT (MOD_BIT_LSHIFT | MOD_BIT_RSHIFT)
+
+#define LCTL(kc) ((kc) | 0x0100)
+#define LSFT(kc) ((kc) | 0x0200)
+#define RSFT(kc) ((kc) | 0x1200)
+#define RALT(kc) ((kc) | 0x1400)
+
+enum qk_keycode_defines {
+    KC_NO                   = 0x0000,
+    KC_TRANSPARENT          = 0x0001,
+    KC_A                    = 0x0004,
+    KC_Z                    = 0x001D,
+    KC_1                    = 0x001E,
+    KC_0                    = 0x0027,
+    KC_ENTER                = 0x0028,
+    KC_ESCAPE               = 0x0029,
+    KC_BACKSPACE            = 0x002A,
+    KC_TAB                  = 0x002B,
+    KC_SPACE                = 0x002C,
+    KC_MINUS                = 0x002D,
+    KC_EQUAL                = 0x002E,
+    KC_LEFT_BRACKET         = 0x002F,
+    KC_RIGHT_BRACKET        = 0x0030,
+    KC_BACKSLASH            = 0x0031,
+    KC_NONUS_HASH           = 0x0032,
+    KC_SEMICOLON            = 0x0033,
+    KC_QUOTE                = 0x0034,
+    KC_GRAVE                = 0x0035,
+    KC_COMMA                = 0x0036,
+    KC_DOT                  = 0x0037,
+    KC_SLASH                = 0x0038,
+    KC_CAPS_LOCK            = 0x0039,
+    KC_F1                   = 0x003A,
+    KC_F12                  = 0x0045,
+    KC_PRINT_SCREEN         = 0x0046,
+    KC_SCROLL_LOCK          = 0x0047,
+    KC_PAUSE                = 0x0048,
+    KC_INSERT               = 0x0049,
+    KC_HOME                 = 0x004A,
+    KC_PAGE_UP              = 0x004B,
+    KC_DELETE               = 0x004C,
+    KC_END                  = 0x004D,
+    KC_PAGE_DOWN            = 0x004E,
+    KC_RIGHT                = 0x004F,
+    KC_LEFT                 = 0x0050,
+    KC_DOWN                 = 0x0051,
+    KC_UP                   = 0x0052,
+    KC_NONUS_BACKSLASH      = 0x0064,
+    KC_APPLICATION          = 0x0065,
+    KC_F13                  = 0x0068,
+    KC_F24                  = 0x0073,
+    KC_SYSTEM_POWER         = 0x00A5,
+    KC_SYSTEM_SLEEP         = 0x00A6,
+    KC_SYSTEM_WAKE          = 0x00A7,
+    KC_AUDIO_MUTE           = 0x00A8,
+    KC_AUDIO_VOL_UP         = 0x00A9,
+    KC_AUDIO_VOL_DOWN       = 0x00AA,
+    KC_MEDIA_NEXT_TRACK     = 0x00AB,
+    KC_MEDIA_PREV_TRACK     = 0x00AC,
+    KC_MEDIA_STOP           = 0x00AD,
+    KC_MEDIA_PLAY_PAUSE     = 0x00AE,
+    KC_MEDIA_SELECT         = 0x00AF,
+    KC_MEDIA_EJECT          = 0x00B0,
+    KC_MAIL                 = 0x00B1,
+    KC_CALCULATOR           = 0x00B2,
+    KC_MY_COMPUTER          = 0x00B3,
+    KC_WWW_SEARCH           = 0x00B4,
+    KC_WWW_HOME             = 0x00B5,
+    KC_WWW_BACK             = 0x00B6,
+    KC_WWW_FORWARD          = 0x00B7,
+    KC_WWW_STOP             = 0x00B8,
+    KC_WWW_REFRESH          = 0x00B9,
+    KC_WWW_FAVORITES        = 0x00BA,
+    KC_MEDIA_FAST_FORWARD   = 0x00BB,
+    KC_MEDIA_REWIND         = 0x00BC,
+    KC_BRIGHTNESS_UP        = 0x00BD,
+    KC_BRIGHTNESS_DOWN      = 0x00BE,
+    QK_MOUSE_CURSOR_UP      = 0x00CD,
+    QK_MOUSE_CURSOR_DOWN    = 0x00CE,
+    QK_MOUSE_CURSOR_LEFT    = 0x00CF,
+    QK_MOUSE_CURSOR_RIGHT   = 0x00D0,
+    QK_MOUSE_BUTTON_1       = 0x00D1,
+    QK_MOUSE_BUTTON_2       = 0x00D2,
+    QK_MOUSE_BUTTON_3       = 0x00D3,
+    QK_MOUSE_BUTTON_4       = 0x00D4,
+    QK_MOUSE_BUTTON_5       = 0x00D5,
+    QK_MOUSE_BUTTON_6       = 0x00D6,
+    QK_MOUSE_BUTTON_7       = 0x00D7,
+    QK_MOUSE_BUTTON_8       = 0x00D8,
+    QK_MOUSE_WHEEL_UP       = 0x00D9,
+    QK_MOUSE_WHEEL_DOWN     = 0x00DA,
+    QK_MOUSE_WHEEL_LEFT     = 0x00DB,
+    QK_MOUSE_WHEEL_RIGHT    = 0x00DC,
+    QK_MOUSE_ACCELERATION_0 = 0x00DD,
+    QK_MOUSE_ACCELERATION_1 = 0x00DE,
+    QK_MOUSE_ACCELERATION_2 = 0x00DF,
+    KC_LEFT_CTRL            = 0x00E0,
+    KC_LEFT_SHIFT           = 0x00E1,
+    KC_LEFT_ALT             = 0x00E2,
+    KC_LEFT_GUI             = 0x00E3,
+    KC_RIGHT_CTRL           = 0x00E4,
+    KC_RIGHT_SHIFT          = 0x00E5,
+    KC_RIGHT_ALT            = 0x00E6,
+    KC_RIGHT_GUI            = 0x00E7,
+};
+
+#define KC_B    (KC_A + 1)
+#define KC_C    (KC_A + 2)
+#define KC_D    (KC_A + 3)
+#define KC_E    (KC_A + 4)
+#define KC_F    (KC_A + 5)
+#define KC_G    (KC_A + 6)
+#define KC_H    (KC_A + 7)
+#define KC_I    (KC_A + 8)
+#define KC_J    (KC_A + 9)
+#define KC_K    (KC_A + 10)
+#define KC_L    (KC_A + 11)
+#define KC_M    (KC_A + 12)
+#define KC_N    (KC_A + 13)
+#define KC_O    (KC_A + 14)
+#define KC_P    (KC_A + 15)
+#define KC_Q    (KC_A + 16)
+#define KC_R    (KC_A + 17)
+#define KC_S    (KC_A + 18)
+#define KC_T    (KC_A + 19)
+#define KC_U    (KC_A + 20)
+#define KC_V    (KC_A + 21)
+#define KC_W    (KC_A + 22)
+#define KC_X    (KC_A + 23)
+#define KC_Y    (KC_A + 24)
+#define KC_2    (KC_1 + 1)
+#define KC_3    (KC_1 + 2)
+#define KC_4    (KC_1 + 3)
+#define KC_5    (KC_1 + 4)
+#define KC_6    (KC_1 + 5)
+#define KC_7    (KC_1 + 6)
+#define KC_8    (KC_1 + 7)
+#define KC_9    (KC_1 + 8)
+#define KC_F2   (KC_F1 + 1)
+#define KC_F3   (KC_F1 + 2)
+#define KC_F4   (KC_F1 + 3)
+#define KC_F5   (KC_F1 + 4)
+#define KC_F6   (KC_F1 + 5)
+#define KC_F7   (KC_F1 + 6)
+#define KC_F8   (KC_F1 + 7)
+#define KC_F9   (KC_F1 + 8)
+#define KC_F10  (KC_F1 + 9)
+#define KC_F11  (KC_F1 + 10)
+#define KC_F14  (KC_F13 + 1)
+#define KC_F15  (KC_F13 + 2)
+#define KC_F16  (KC_F13 + 3)
+#define KC_F17  (KC_F13 + 4)
+#define KC_F18  (KC_F13 + 5)
+#define KC_F19  (KC_F13 + 6)
+#define KC_F20  (KC_F13 + 7)
+#define KC_F21  (KC_F13 + 8)
+#define KC_F22  (KC_F13 + 9)
+#define KC_F23  (KC_F13 + 10)
+
+#define KC_TRNS KC_TRANSPARENT
+#define KC_ENT  KC_ENTER
+#define KC_ESC  KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC  KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL  KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_BSLS KC_BACKSLASH
+#define KC_NUHS KC_NONUS_HASH
+#define KC_SCLN KC_SEMICOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV  KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPS_LOCK
+#define KC_PSCR KC_PRINT_SCREEN
+#define KC_SCRL KC_SCROLL_LOCK
+#define KC_PAUS KC_PAUSE
+#define KC_INS  KC_INSERT
+#define KC_PGUP KC_PAGE_UP
+#define KC_DEL  KC_DELETE
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_RGHT KC_RIGHT
+#define KC_NUBS KC_NONUS_BACKSLASH
+#define KC_APP  KC_APPLICATION
+#define KC_PWR  KC_SYSTEM_POWER
+#define KC_SLEP KC_SYSTEM_SLEEP
+#define KC_WAKE KC_SYSTEM_WAKE
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_MNXT KC_MEDIA_NEXT_TRACK
+#define KC_MPRV KC_MEDIA_PREV_TRACK
+#define KC_MSTP KC_MEDIA_STOP
+#define KC_MPLY KC_MEDIA_PLAY_PAUSE
+#define KC_MSEL KC_MEDIA_SELECT
+#define KC_EJCT KC_MEDIA_EJECT
+#define KC_CALC KC_CALCULATOR
+#define KC_MYCM KC_MY_COMPUTER
+#define KC_WSCH KC_WWW_SEARCH
+#define KC_WHOM KC_WWW_HOME
+#define KC_WBAK KC_WWW_BACK
+#define KC_WFWD KC_WWW_FORWARD
+#define KC_WSTP KC_WWW_STOP
+#define KC_WREF KC_WWW_REFRESH
+#define KC_WFAV KC_WWW_FAVORITES
+#define KC_MFFD KC_MEDIA_FAST_FORWARD
+#define KC_MRWD KC_MEDIA_REWIND
+#define KC_BRIU KC_BRIGHTNESS_UP
+#define KC_BRID KC_BRIGHTNESS_DOWN
+#define MS_UP   QK_MOUSE_CURSOR_UP
+#define MS_DOWN QK_MOUSE_CURSOR_DOWN
+#define MS_LEFT QK_MOUSE_CURSOR_LEFT
+#define MS_RGHT QK_MOUSE_CURSOR_RIGHT
+#define MS_BTN1 QK_MOUSE_BUTTON_1
+#define MS_BTN2 QK_MOUSE_BUTTON_2
+#define MS_BTN3 QK_MOUSE_BUTTON_3
+#define MS_BTN4 QK_MOUSE_BUTTON_4
+#define MS_BTN5 QK_MOUSE_BUTTON_5
+#define MS_BTN6 QK_MOUSE_BUTTON_6
+#define MS_BTN7 QK_MOUSE_BUTTON_7
+#define MS_BTN8 QK_MOUSE_BUTTON_8
+#define MS_WHLU QK_MOUSE_WHEEL_UP
+#define MS_WHLD QK_MOUSE_WHEEL_DOWN
+#define MS_WHLL QK_MOUSE_WHEEL_LEFT
+#define MS_WHLR QK_MOUSE_WHEEL_RIGHT
+#define MS_ACL0 QK_MOUSE_ACCELERATION_0
+#define MS_ACL1 QK_MOUSE_ACCELERATION_1
+#define MS_ACL2 QK_MOUSE_ACCELERATION_2
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+// clang-format on
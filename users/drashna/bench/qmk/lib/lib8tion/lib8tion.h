@@ -0,0 +1,66 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for lib8tion, shared by the bench harnesses. The same maths as the C versions in lib8tion.
+
+#pragma once
+
+#include <stdint.h>
+
+static inline uint8_t scale8(uint8_t i, uint8_t scale) {
+    return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+static inline uint16_t scale16by8(uint16_t i, uint8_t scale) {
+    return ((uint32_t)i * (1 + (uint32_t)scale)) >> 8;
+}
+
+static inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    uint16_t t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+static inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    return i > j ? i - j : 0;
+}
+
+static inline uint8_t mod8(uint8_t a, uint8_t m) {
+    while (a >= m) {
+        a -= m;
+    }
+    return a;
+}
+
+extern uint16_t rand16seed;
+
+static inline uint8_t random8(void) {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return (uint8_t)(rand16seed & 0xFF) + (uint8_t)(rand16seed >> 8);
+}
+
+static inline int8_t abs8(int8_t i) {
+    return i < 0 ? -i : i;
+}
+
+static inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+    uint8_t              offset             = theta;
+
+    if (theta & 0x40) {
+        offset = (uint8_t)255 - offset;
+    }
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) {
+        secoffset++;
+    }
+    uint8_t section = offset >> 4;
+    uint8_t b       = b_m16_interleave[section * 2];
+    uint8_t m16     = b_m16_interleave[section * 2 + 1];
+    uint8_t mx      = (m16 * secoffset) >> 4;
+    int8_t  y       = mx + b;
+    if (theta & 0x80) {
+        y = -y;
+    }
+    return y + 128;
+}
@@ -0,0 +1,6 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's print.h, shared by the bench harnesses. sendchar.c only needs it for the sendchar hook.
+
+#pragma once
@@ -0,0 +1,8 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for <quantum/color.h>, shared by the bench harnesses.
+
+#pragma once
+
+#include "../color.h"
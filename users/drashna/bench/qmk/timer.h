@@ -0,0 +1,21 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's timer.h, shared by the bench harnesses. The harness sets the time.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TIMER_DIFF_16(a, b) (uint16_t)((a) - (b))
+#define TIMER_DIFF_32(a, b) (uint32_t)((a) - (b))
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+
+static inline bool timer_expired(uint16_t current, uint16_t future) {
+    return (uint16_t)(current - future) < 0x8000;
+}
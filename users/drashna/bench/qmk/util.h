@@ -0,0 +1,19 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's util.h, shared by the bench harnesses.
+
+#pragma once
+
+#ifndef PACKED
+#    define PACKED __attribute__((packed))
+#endif
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef ARRAY_SIZE
+#    define ARRAY_SIZE(array) (sizeof((array)) / sizeof((array)[0]))
+#endif
@@ -0,0 +1,10 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for the version.h QMK generates at build time, shared by the bench harnesses.
+
+#pragma once
+
+#define QMK_VERSION   "0.0.0-bench"
+#define QMK_BUILDDATE "2025-01-01-00:00:00"
+#define QMK_GIT_HASH  "0000000"
@@ -0,0 +1,10 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum's virtser.h, shared by the bench harnesses. The harness provides the sink.
+
+#pragma once
+
+#include <stdint.h>
+
+void virtser_send(const uint8_t byte);
@@ -0,0 +1,313 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for wpm_stats.c, against a naive model that keeps every sample ever added in plain arrays.
+ *
+ * Drives the statistics with a random mix of ticks (typing in bursts, with idle time between), one second samples
+ * added directly the way the split sync adds them, one second histories replaced with wpm_stats_set_seconds() from
+ * random sequence numbers, and the odd wpm_stats_init(). After every call, each resolution's history, newest sample
+ * and mean, the tick average, the peak, every percentile from 0 to 100 and the sequence number are checked against
+ * the model, which works each of them out from scratch: the means by summing the window, and the percentiles by
+ * sorting the non-zero ten second samples in it and rounding up to the top of the histogram bin.
+ *
+ * Before that, the sequence number is checked on its own as it wraps, both from added samples and from a replaced
+ * history that wraps it.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o wpm_stats_test -Iusers/drashna -DWPM_GRAPH_SAMPLES=20 users/drashna/bench/wpm_stats_test.c \
+ *         users/drashna/wpm_stats.c
+ *     ./wpm_stats_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wpm_stats.h"
+
+#define TEST_STEPS      200000
+#define TEST_MAX_SAMPLE (TEST_STEPS + WPM_GRAPH_SAMPLES + 16)
+
+/*
+ * The model: every sample at each resolution since the last init, oldest first
+ */
+
+typedef struct model_series_t {
+    uint8_t samples[TEST_MAX_SAMPLE];
+    size_t  count;
+    uint8_t length; // samples kept by wpm_stats.c
+} model_series_t;
+
+static model_series_t model[WPM_STATS_RESOLUTION_COUNT] = {
+    [WPM_STATS_SECONDS]     = {.length = WPM_GRAPH_SAMPLES},
+    [WPM_STATS_TEN_SECONDS] = {.length = WPM_STATS_TEN_SECOND_SAMPLES},
+    [WPM_STATS_MINUTES]     = {.length = WPM_STATS_MINUTE_SAMPLES},
+};
+
+static uint8_t  model_ticks[WPM_STATS_TICKS_PER_SECOND];
+static size_t   model_tick_count;
+static uint16_t model_ten_second_sum, model_minute_sum;
+static uint8_t  model_ten_second_count, model_minute_count;
+static uint8_t  model_seq, model_peak;
+
+static void model_init(void) {
+    for (uint8_t i = 0; i < WPM_STATS_RESOLUTION_COUNT; i++) {
+        model[i].count = 0;
+    }
+    memset(model_ticks, 0, sizeof(model_ticks));
+    model_tick_count       = 0;
+    model_ten_second_sum   = 0;
+    model_minute_sum       = 0;
+    model_ten_second_count = 0;
+    model_minute_count     = 0;
+    model_seq              = 0;
+    model_peak             = 0;
+}
+
+static void model_append(wpm_stats_resolution_t resolution, uint8_t value) {
+    model[resolution].samples[model[resolution].count++] = value;
+}
+
+static void model_add_second(uint8_t wpm) {
+    model_append(WPM_STATS_SECONDS, wpm);
+    model_seq++;
+    if (wpm > model_peak) {
+        model_peak = wpm;
+    }
+    model_ten_second_sum += wpm;
+    if (++model_ten_second_count < 10) {
+        return;
+    }
+    model_append(WPM_STATS_TEN_SECONDS, model_ten_second_sum / 10);
+    model_minute_sum += model_ten_second_sum / 10;
+    model_ten_second_sum   = 0;
+    model_ten_second_count = 0;
+    if (++model_minute_count < 6) {
+        return;
+    }
+    model_append(WPM_STATS_MINUTES, model_minute_sum / 6);
+    model_minute_sum   = 0;
+    model_minute_count = 0;
+}
+
+static uint8_t model_average(void) {
+    uint16_t sum = 0;
+    for (uint8_t i = 0; i < WPM_STATS_TICKS_PER_SECOND; i++) {
+        sum += model_ticks[i];
+    }
+    return sum / WPM_STATS_TICKS_PER_SECOND;
+}
+
+static bool model_tick(uint8_t wpm) {
+    model_ticks[model_tick_count++ % WPM_STATS_TICKS_PER_SECOND] = wpm;
+    if (model_tick_count % WPM_STATS_TICKS_PER_SECOND) {
+        return false;
+    }
+    model_add_second(model_average());
+    return true;
+}
+
+static void model_set_seconds(uint8_t seq, const uint8_t *samples, uint8_t count) {
+    memcpy(model[WPM_STATS_SECONDS].samples, samples, count);
+    model[WPM_STATS_SECONDS].count = count;
+    model_seq                      = seq + count;
+}
+
+/**
+ * @brief The sample a history holds at an age, 0 being the newest, or 0 if that far back was never filled.
+ */
+static uint8_t model_history(wpm_stats_resolution_t resolution, uint8_t age) {
+    const model_series_t *series = &model[resolution];
+    return age < series->count ? series->samples[series->count - 1 - age] : 0;
+}
+
+static uint8_t model_mean(wpm_stats_resolution_t resolution) {
+    const model_series_t *series = &model[resolution];
+    size_t                window = series->count < series->length ? series->count : series->length;
+    uint32_t              sum    = 0;
+
+    for (size_t i = series->count - window; i < series->count; i++) {
+        sum += series->samples[i];
+    }
+    return window ? sum / window : 0;
+}
+
+static int compare_samples(const void *a, const void *b) {
+    return *(const uint8_t *)a - *(const uint8_t *)b;
+}
+
+/**
+ * @brief Gets the non-zero ten second samples in the window, sorted.
+ *
+ * @return size_t number of samples
+ */
+static size_t model_typing(uint8_t *typing) {
+    const model_series_t *series = &model[WPM_STATS_TEN_SECONDS];
+    size_t                count  = 0;
+
+    for (uint8_t age = 0; age < series->length && age < series->count; age++) {
+        if (model_history(WPM_STATS_TEN_SECONDS, age)) {
+            typing[count++] = model_history(WPM_STATS_TEN_SECONDS, age);
+        }
+    }
+    qsort(typing, count, 1, compare_samples);
+    return count;
+}
+
+static uint8_t model_percentile(const uint8_t *typing, size_t count, uint8_t percentile) {
+    if (!count) {
+        return 0;
+    }
+
+    size_t rank = (count * percentile + 99) / 100;
+    if (!rank) {
+        rank = 1;
+    }
+    uint16_t value = typing[rank - 1] / WPM_STATS_HISTOGRAM_BIN_WIDTH * WPM_STATS_HISTOGRAM_BIN_WIDTH +
+                     WPM_STATS_HISTOGRAM_BIN_WIDTH - 1;
+    return value > UINT8_MAX ? UINT8_MAX : value;
+}
+
+/*
+ * Checks
+ */
+
+static const char *resolution_names[WPM_STATS_RESOLUTION_COUNT] = {"seconds", "ten seconds", "minutes"};
+
+#define CHECK(condition, ...)            \
+    if (!(condition)) {                  \
+        printf("step %u: ", step);       \
+        printf(__VA_ARGS__);             \
+        printf("\n");                    \
+        return false;                    \
+    }
+
+static bool check_against_model(uint32_t step) {
+    for (uint8_t resolution = 0; resolution < WPM_STATS_RESOLUTION_COUNT; resolution++) {
+        const char    *name    = resolution_names[resolution];
+        const uint8_t *history = wpm_stats_history(resolution);
+
+        CHECK(wpm_stats_history_length(resolution) == model[resolution].length, "%s: length %u, expected %u", name,
+              wpm_stats_history_length(resolution), model[resolution].length);
+        for (uint8_t age = 0; age < model[resolution].length; age++) {
+            CHECK(history[age] == model_history(resolution, age), "%s: sample %u is %u, expected %u", name, age,
+                  history[age], model_history(resolution, age));
+        }
+        CHECK(wpm_stats_newest(resolution) == model_history(resolution, 0), "%s: newest %u, expected %u", name,
+              wpm_stats_newest(resolution), model_history(resolution, 0));
+        CHECK(wpm_stats_mean(resolution) == model_mean(resolution), "%s: mean %u, expected %u", name,
+              wpm_stats_mean(resolution), model_mean(resolution));
+    }
+    uint8_t typing[WPM_STATS_TEN_SECOND_SAMPLES];
+    size_t  count = model_typing(typing);
+    for (uint8_t percentile = 0; percentile <= 100; percentile++) {
+        uint8_t expected = model_percentile(typing, count, percentile);
+        CHECK(wpm_stats_percentile(percentile) == expected, "percentile %u is %u, expected %u", percentile,
+              wpm_stats_percentile(percentile), expected);
+    }
+    CHECK(wpm_stats_average() == model_average(), "average %u, expected %u", wpm_stats_average(), model_average());
+    CHECK(wpm_stats_peak() == model_peak, "peak %u, expected %u", wpm_stats_peak(), model_peak);
+    CHECK(wpm_stats_seconds_seq() == model_seq, "seq %u, expected %u", wpm_stats_seconds_seq(), model_seq);
+    return true;
+}
+
+static bool test_seq_wrap(void) {
+    uint32_t step = 0;
+    uint8_t  samples[WPM_GRAPH_SAMPLES];
+
+    wpm_stats_init();
+    for (; step < 600; step++) {
+        CHECK(wpm_stats_seconds_seq() == (uint8_t)step, "seq %u after %u samples", wpm_stats_seconds_seq(), step);
+        wpm_stats_add_second(step);
+    }
+
+    // a replaced history that wraps the sequence number, and samples added after it
+    for (uint8_t i = 0; i < WPM_GRAPH_SAMPLES; i++) {
+        samples[i] = 100 + i;
+    }
+    wpm_stats_set_seconds(UINT8_MAX - 2, samples, WPM_GRAPH_SAMPLES);
+    CHECK(wpm_stats_seconds_seq() == (uint8_t)(WPM_GRAPH_SAMPLES - 3), "seq %u after a wrapping history",
+          wpm_stats_seconds_seq());
+    CHECK(wpm_stats_newest(WPM_STATS_SECONDS) == 100 + WPM_GRAPH_SAMPLES - 1, "newest %u after a replaced history",
+          wpm_stats_newest(WPM_STATS_SECONDS));
+    wpm_stats_add_second(7);
+    CHECK(wpm_stats_seconds_seq() == (uint8_t)(WPM_GRAPH_SAMPLES - 2), "seq %u after adding to a wrapped history",
+          wpm_stats_seconds_seq());
+    CHECK(wpm_stats_history(WPM_STATS_SECONDS)[1] == 100 + WPM_GRAPH_SAMPLES - 1, "replaced history was lost");
+    return true;
+}
+
+/*
+ * Random use
+ */
+
+static uint8_t random_wpm(bool typing) {
+    return typing ? 20 + rand() % 236 : 0;
+}
+
+typedef struct test_stats_t {
+    uint32_t ticks, seconds, replaced, wraps, inits;
+} test_stats_t;
+
+static bool test_random(test_stats_t *stats) {
+    uint8_t samples[WPM_GRAPH_SAMPLES + 8];
+    bool    typing = false;
+    uint8_t last_seq;
+
+    wpm_stats_init();
+    model_init();
+    last_seq = wpm_stats_seconds_seq();
+    for (uint32_t step = 0; step < TEST_STEPS; step++) {
+        int roll = rand() % 10000;
+        if (rand() % 50 == 0) {
+            typing = !typing;
+        }
+
+        if (roll < 9000) {
+            uint8_t wpm = random_wpm(typing);
+            CHECK(wpm_stats_tick(wpm) == model_tick(wpm), "a tick added a second when the model didn't, or not");
+            stats->ticks++;
+        } else if (roll < 9900) {
+            uint8_t wpm = random_wpm(typing || rand() % 4 == 0);
+            wpm_stats_add_second(wpm);
+            model_add_second(wpm);
+            stats->seconds++;
+        } else if (roll < 9998) {
+            uint8_t seq = rand(), count = rand() % (sizeof(samples) + 1);
+            for (uint8_t i = 0; i < count; i++) {
+                samples[i] = random_wpm(rand() % 2);
+            }
+            wpm_stats_set_seconds(seq, samples, count);
+            model_set_seconds(seq, samples, count);
+            stats->replaced++;
+        } else {
+            wpm_stats_init();
+            model_init();
+            stats->inits++;
+        }
+
+        if (wpm_stats_seconds_seq() < last_seq) {
+            stats->wraps++;
+        }
+        last_seq = wpm_stats_seconds_seq();
+        if (!check_against_model(step)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    test_stats_t stats = {0};
+
+    srand(1);
+    if (!test_seq_wrap() || !test_random(&stats)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%u ticks, %u seconds added, %u histories replaced, %u inits, %u sequence wraps\n", stats.ticks,
+           stats.seconds, stats.replaced, stats.inits, stats.wraps);
+    printf("every history, mean, percentile and sequence number matched the naive model\n");
+    return 0;
+}
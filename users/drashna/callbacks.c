@@ -57,7 +57,7 @@ userspace_runtime_state_t userspace_runtime_state;
 __attribute__((weak)) void keyboard_pre_init_keymap(void) {}
 void                       keyboard_pre_init_user(void) {
     print_set_sendchar(drashna_sendchar);
-    eeconfig_read_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_read();
     if (!eeconfig_is_user_datablock_valid() || !userspace_config.check) {
         eeconfig_init_user();
     }
@@ -112,6 +112,10 @@ void                       keyboard_post_init_user(void) {
     void keyboard_post_init_wpm(void);
     keyboard_post_init_wpm();
 #endif // WPM_ENABLE
+#ifdef AUTOCORRECT_DAWG_ENABLE
+    void keyboard_post_init_autocorrect_dawg(void);
+    keyboard_post_init_autocorrect_dawg();
+#endif // AUTOCORRECT_DAWG_ENABLE
     keyboard_post_init_keymap();
 }
 
@@ -127,6 +131,7 @@ bool shutdown_user(bool jump_to_bootloader) {
     if (!shutdown_keymap(jump_to_bootloader)) {
         return false;
     }
+    userspace_config_flush();
 #ifdef RGBLIGHT_ENABLE
     rgblight_shutdown(jump_to_bootloader);
 #endif // RGBLIGHT_ENABLE
@@ -150,6 +155,7 @@ __attribute__((weak)) void suspend_power_down_keymap(void) {}
 
 void suspend_power_down_user(void) {
     set_is_device_suspended(true);
+    userspace_config_flush();
     if (layer_state_is(_GAMEPAD)) {
         layer_off(_GAMEPAD);
     }
@@ -305,7 +311,7 @@ void                       eeconfig_init_user(void) {
     eeconfig_update_keymap(&keymap_config);
 
     eeconfig_init_keymap();
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_write_all();
 #ifdef COMMUNITY_MODULE_POINTING_DEVICE_ACCEL_ENABLE
     void eeconfig_init_pointing_device(void);
     eeconfig_init_pointing_device();
@@ -387,6 +393,9 @@ void                       housekeeping_task_user(void) {
 #if defined(CUSTOM_TAP_DANCE_ENABLE) // Run Diablo 3 macro checking code.
     run_diablo_macro_check();
 #endif // CUSTOM_TAP_DANCE_ENABLE
+#ifdef CUSTOM_DYNAMIC_MACROS_ENABLE
+    housekeeping_task_dynamic_macro();
+#endif // CUSTOM_DYNAMIC_MACROS_ENABLE
 #if defined(CUSTOM_RGB_MATRIX)
     housekeeping_task_rgb_matrix();
 #endif // CUSTOM_RGB_MATRIX
@@ -400,6 +409,8 @@ void                       housekeeping_task_user(void) {
     void housekeeping_task_wpm(void);
     housekeeping_task_wpm();
 #endif // WPM_ENABLE
+    housekeeping_task_userspace_config();
+    housekeeping_task_sendchar();
     housekeeping_task_keymap();
 }
 
@@ -421,7 +432,7 @@ bool rtc_set_time_user(rtc_time_t *time) {
     userspace_config.rtc.is_dst     = time->is_dst;
     userspace_config.rtc.timezone   = time->timezone;
     userspace_config.rtc.format_24h = time->format;
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_mark_dirty();
     if (is_keyboard_master()) {
         rtc_needs_sync = rtc_is_connected();
     }
@@ -0,0 +1,344 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "config_journal.h"
+#include "eeconfig.h"
+#include "drashna_crc.h"
+#include <stddef.h>
+#include <string.h>
+
+#define CONFIG_JOURNAL_CHUNK_SIZE 16
+
+_Static_assert(CONFIG_JOURNAL_OFFSET >= USERSPACE_CONFIG_SIZE,
+               "Config journal doesn't fit in the user datablock, after the legacy config block");
+_Static_assert(CONFIG_JOURNAL_BANK_SIZE > sizeof(config_journal_header_t) + CONFIG_JOURNAL_RECORD_OVERHEAD,
+               "Config journal banks are too small to hold a record");
+
+typedef struct config_journal_state_t {
+    uint16_t offsets[CONFIG_JOURNAL_KEY_COUNT]; // newest record for each key, 0 if there is none
+    uint16_t write_pos;
+    uint16_t generation;
+    uint8_t  bank;
+    bool     is_formatted;
+    bool     needs_compaction;
+} config_journal_state_t;
+
+static config_journal_state_t journal = {0};
+static config_journal_stats_t stats   = {0};
+
+static inline void config_journal_read_bank(uint8_t bank, uint16_t offset, void *data, uint16_t size) {
+    eeconfig_read_user_datablock(data, CONFIG_JOURNAL_OFFSET + bank * CONFIG_JOURNAL_BANK_SIZE + offset, size);
+}
+
+static inline void config_journal_write_bank(uint8_t bank, uint16_t offset, const void *data, uint16_t size) {
+    eeconfig_update_user_datablock(data, CONFIG_JOURNAL_OFFSET + bank * CONFIG_JOURNAL_BANK_SIZE + offset, size);
+}
+
+/**
+ * @brief Seeds a record CRC with the bank generation, and the record header.
+ *
+ * @param generation generation of the bank the record is in
+ * @param record record header
+ * @return uint16_t partial CRC, to be continued with the payload
+ */
+static uint16_t config_journal_record_crc(uint16_t generation, const config_journal_record_t *record) {
+    uint16_t crc = crc16_update_block(0xFFFF, &generation, sizeof(generation));
+    return crc16_update_block(crc, record, sizeof(config_journal_record_t));
+}
+
+/**
+ * @brief Reads a bank header, and checks that it is intact.
+ *
+ * @param bank bank to read
+ * @param header where to store the header
+ * @return true if the header is valid
+ */
+static bool config_journal_read_header(uint8_t bank, config_journal_header_t *header) {
+    config_journal_read_bank(bank, 0, header, sizeof(config_journal_header_t));
+    return header->magic == CONFIG_JOURNAL_MAGIC &&
+           header->crc == crc16_update_block(0xFFFF, header, offsetof(config_journal_header_t, crc));
+}
+
+/**
+ * @brief Walks the records of a bank, indexing the newest record for each key. The walk stops at the first record
+ * that is malformed or fails its CRC, which is where the next record will be appended.
+ *
+ * @param bank bank to scan
+ * @param generation generation of the bank
+ * @param offsets set to the offset of the newest record for each key
+ * @return uint16_t offset just past the last valid record
+ */
+static uint16_t config_journal_scan(uint8_t bank, uint16_t generation, uint16_t *offsets) {
+    uint16_t pos = sizeof(config_journal_header_t);
+
+    while (pos + CONFIG_JOURNAL_RECORD_OVERHEAD < CONFIG_JOURNAL_BANK_SIZE) {
+        config_journal_record_t record;
+        uint8_t                 chunk[CONFIG_JOURNAL_CHUNK_SIZE];
+        uint16_t                checksum;
+
+        config_journal_read_bank(bank, pos, &record, sizeof(config_journal_record_t));
+        if (record.length == 0 || pos + CONFIG_JOURNAL_RECORD_OVERHEAD + record.length > CONFIG_JOURNAL_BANK_SIZE) {
+            break;
+        }
+        uint16_t crc = config_journal_record_crc(generation, &record);
+        for (uint16_t i = 0; i < record.length; i += sizeof(chunk)) {
+            uint8_t size = MIN(sizeof(chunk), record.length - i);
+            config_journal_read_bank(bank, pos + sizeof(config_journal_record_t) + i, chunk, size);
+            crc = crc16_update_block(crc, chunk, size);
+        }
+        config_journal_read_bank(bank, pos + sizeof(config_journal_record_t) + record.length, &checksum,
+                                 sizeof(checksum));
+        if (crc != checksum) {
+            break;
+        }
+        // keys from a newer build are skipped, but still walked past
+        if (record.key < CONFIG_JOURNAL_KEY_COUNT) {
+            offsets[record.key] = pos;
+        }
+        pos += CONFIG_JOURNAL_RECORD_OVERHEAD + record.length;
+    }
+    return pos;
+}
+
+/**
+ * @brief Checks that everything after the last record is still zeroed, as left by the last compaction. Anything
+ * else is the remains of a torn append, which could be misread as a record once appends resume past it.
+ *
+ * @param bank bank to check
+ * @param pos offset just past the last valid record
+ * @return true if the rest of the bank is clean
+ */
+static bool config_journal_tail_is_clean(uint8_t bank, uint16_t pos) {
+    uint8_t chunk[CONFIG_JOURNAL_CHUNK_SIZE];
+
+    while (pos < CONFIG_JOURNAL_BANK_SIZE) {
+        uint8_t size = MIN(sizeof(chunk), CONFIG_JOURNAL_BANK_SIZE - pos);
+        config_journal_read_bank(bank, pos, chunk, size);
+        for (uint8_t i = 0; i < size; i++) {
+            if (chunk[i] != 0) {
+                return false;
+            }
+        }
+        pos += size;
+    }
+    return true;
+}
+
+/**
+ * @brief Recovers the journal on boot: picks the bank with the newest intact header, and finds the newest intact
+ * record for each key in it.
+ *
+ * @return true if a journal was found, false if it has never been formatted
+ */
+bool config_journal_init(void) {
+    config_journal_header_t headers[2];
+    bool                    valid[2];
+
+    memset(&journal, 0, sizeof(journal));
+    for (uint8_t bank = 0; bank < 2; bank++) {
+        valid[bank] = config_journal_read_header(bank, &headers[bank]);
+    }
+    if (!valid[0] && !valid[1]) {
+        return false;
+    }
+    if (valid[0] && valid[1]) {
+        journal.bank = (int16_t)(headers[1].generation - headers[0].generation) > 0 ? 1 : 0;
+    } else {
+        journal.bank = valid[1] ? 1 : 0;
+    }
+
+    journal.generation       = headers[journal.bank].generation;
+    journal.write_pos        = config_journal_scan(journal.bank, journal.generation, journal.offsets);
+    journal.needs_compaction = !config_journal_tail_is_clean(journal.bank, journal.write_pos);
+    journal.is_formatted     = true;
+
+    stats.torn      = journal.needs_compaction;
+    stats.recovered = 0;
+    for (uint8_t key = 0; key < CONFIG_JOURNAL_KEY_COUNT; key++) {
+        if (journal.offsets[key]) {
+            stats.recovered++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the newest value stored for a key. If the stored value is shorter than requested (written by an
+ * older build), the rest of the buffer is left untouched.
+ *
+ * @param key key to read
+ * @param data where to store the value
+ * @param size size of the buffer
+ * @return uint8_t number of bytes read, 0 if there is no value for the key
+ */
+uint8_t config_journal_read(uint8_t key, void *data, uint8_t size) {
+    config_journal_record_t record;
+
+    if (key >= CONFIG_JOURNAL_KEY_COUNT || journal.offsets[key] == 0) {
+        return 0;
+    }
+    config_journal_read_bank(journal.bank, journal.offsets[key], &record, sizeof(config_journal_record_t));
+    size = MIN(size, record.length);
+    config_journal_read_bank(journal.bank, journal.offsets[key] + sizeof(config_journal_record_t), data, size);
+    return size;
+}
+
+/**
+ * @brief Writes a record at the given position. The CRC goes last, so a record only becomes valid once all of it
+ * has been written.
+ *
+ * @param bank bank to write to
+ * @param generation generation of the bank
+ * @param pos offset to write at
+ * @param key key of the record
+ * @param data payload
+ * @param size payload size
+ */
+static void config_journal_append(uint8_t bank, uint16_t generation, uint16_t pos, uint8_t key, const void *data,
+                                  uint8_t size) {
+    config_journal_record_t record = {
+        .key    = key,
+        .length = size,
+    };
+    uint16_t crc = crc16_update_block(config_journal_record_crc(generation, &record), data, size);
+
+    config_journal_write_bank(bank, pos, &record, sizeof(config_journal_record_t));
+    config_journal_write_bank(bank, pos + sizeof(config_journal_record_t), data, size);
+    config_journal_write_bank(bank, pos + sizeof(config_journal_record_t) + size, &crc, sizeof(crc));
+}
+
+/**
+ * @brief Copies a live record into the bank being compacted into, re-stamping it with the new generation.
+ *
+ * @param pos offset of the record in the live bank
+ * @param target bank being compacted into
+ * @param generation generation of the target bank
+ * @param target_pos offset to write the record at
+ * @return uint16_t size of the copied record
+ */
+static uint16_t config_journal_copy(uint16_t pos, uint8_t target, uint16_t generation, uint16_t target_pos) {
+    config_journal_record_t record;
+    uint8_t                 chunk[CONFIG_JOURNAL_CHUNK_SIZE];
+
+    config_journal_read_bank(journal.bank, pos, &record, sizeof(config_journal_record_t));
+    uint16_t crc = config_journal_record_crc(generation, &record);
+    config_journal_write_bank(target, target_pos, &record, sizeof(config_journal_record_t));
+    for (uint16_t i = 0; i < record.length; i += sizeof(chunk)) {
+        uint8_t size = MIN(sizeof(chunk), record.length - i);
+        config_journal_read_bank(journal.bank, pos + sizeof(config_journal_record_t) + i, chunk, size);
+        config_journal_write_bank(target, target_pos + sizeof(config_journal_record_t) + i, chunk, size);
+        crc = crc16_update_block(crc, chunk, size);
+    }
+    config_journal_write_bank(target, target_pos + sizeof(config_journal_record_t) + record.length, &crc,
+                              sizeof(crc));
+    return CONFIG_JOURNAL_RECORD_OVERHEAD + record.length;
+}
+
+/**
+ * @brief Rewrites the newest record for each key into the other bank, followed by the new value for `key`, zeroes
+ * the rest of that bank, and only then writes its header. Until the header is written the old bank stays live, so
+ * losing power at any point leaves either the old or the new bank intact.
+ *
+ * @param key key being written, whose old record is dropped. CONFIG_JOURNAL_KEY_COUNT to only compact
+ * @param data new value for the key
+ * @param size size of the new value
+ * @return true if everything fit
+ */
+static bool config_journal_compact(uint8_t key, const void *data, uint8_t size) {
+    config_journal_header_t header = {
+        .magic      = CONFIG_JOURNAL_MAGIC,
+        .generation = journal.generation + 1,
+    };
+    uint16_t offsets[CONFIG_JOURNAL_KEY_COUNT] = {0};
+    uint8_t  zeros[CONFIG_JOURNAL_CHUNK_SIZE]  = {0};
+    uint8_t  target                            = journal.is_formatted ? journal.bank ^ 1 : 0;
+    uint16_t pos                               = sizeof(config_journal_header_t);
+    uint16_t needed                            = pos;
+
+    if (key < CONFIG_JOURNAL_KEY_COUNT) {
+        needed += CONFIG_JOURNAL_RECORD_OVERHEAD + size;
+    }
+    for (uint8_t i = 0; i < CONFIG_JOURNAL_KEY_COUNT; i++) {
+        if (i != key && journal.offsets[i]) {
+            config_journal_record_t record;
+            config_journal_read_bank(journal.bank, journal.offsets[i], &record, sizeof(config_journal_record_t));
+            needed += CONFIG_JOURNAL_RECORD_OVERHEAD + record.length;
+        }
+    }
+    if (needed > CONFIG_JOURNAL_BANK_SIZE) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < CONFIG_JOURNAL_KEY_COUNT; i++) {
+        if (i != key && journal.offsets[i]) {
+            offsets[i] = pos;
+            pos += config_journal_copy(journal.offsets[i], target, header.generation, pos);
+        }
+    }
+    if (key < CONFIG_JOURNAL_KEY_COUNT) {
+        config_journal_append(target, header.generation, pos, key, data, size);
+        offsets[key] = pos;
+        pos += CONFIG_JOURNAL_RECORD_OVERHEAD + size;
+    }
+    for (uint16_t i = pos; i < CONFIG_JOURNAL_BANK_SIZE; i += sizeof(zeros)) {
+        config_journal_write_bank(target, i, zeros, MIN(sizeof(zeros), CONFIG_JOURNAL_BANK_SIZE - i));
+    }
+    header.crc = crc16_update_block(0xFFFF, &header, offsetof(config_journal_header_t, crc));
+    config_journal_write_bank(target, 0, &header, sizeof(config_journal_header_t));
+
+    memcpy(journal.offsets, offsets, sizeof(offsets));
+    journal.bank             = target;
+    journal.generation       = header.generation;
+    journal.write_pos        = pos;
+    journal.is_formatted     = true;
+    journal.needs_compaction = false;
+    stats.compactions++;
+    return true;
+}
+
+/**
+ * @brief Stores a new value for a key, by appending a record to the live bank. Only the record itself is written,
+ * so the cost is proportional to the size of the value rather than the whole datablock. When the bank is full,
+ * it's compacted into the other one first.
+ *
+ * @param key key to write
+ * @param data value to store
+ * @param size size of the value, 1 to 255 bytes
+ * @return true if the value was stored
+ */
+bool config_journal_write(uint8_t key, const void *data, uint8_t size) {
+    if (key >= CONFIG_JOURNAL_KEY_COUNT || size == 0) {
+        return false;
+    }
+    if (!journal.is_formatted || journal.needs_compaction ||
+        journal.write_pos + CONFIG_JOURNAL_RECORD_OVERHEAD + size > CONFIG_JOURNAL_BANK_SIZE) {
+        if (!config_journal_compact(key, data, size)) {
+            return false;
+        }
+    } else {
+        config_journal_append(journal.bank, journal.generation, journal.write_pos, key, data, size);
+        journal.offsets[key] = journal.write_pos;
+        journal.write_pos += CONFIG_JOURNAL_RECORD_OVERHEAD + size;
+    }
+    stats.appends++;
+    return true;
+}
+
+/**
+ * @brief Drops every stored value, by compacting into an empty bank.
+ *
+ * @return true on success
+ */
+bool config_journal_format(void) {
+    memset(journal.offsets, 0, sizeof(journal.offsets));
+    return config_journal_compact(CONFIG_JOURNAL_KEY_COUNT, NULL, 0);
+}
+
+/**
+ * @brief Get the config journal stats
+ *
+ * @return const config_journal_stats_t*
+ */
+const config_journal_stats_t *config_journal_get_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,61 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "util.h"
+
+#define CONFIG_JOURNAL_MAGIC             0x4A43
+#define CONFIG_JOURNAL_BANK_SIZE         (CONFIG_JOURNAL_SIZE / 2)
+// the journal takes the end of the user datablock, leaving the layout before it as it was before the journal
+#define CONFIG_JOURNAL_OFFSET            (EECONFIG_USER_DATA_SIZE - CONFIG_JOURNAL_SIZE)
+// size of the dynamic macro header stored under CONFIG_JOURNAL_KEY_MACROS
+#define CONFIG_JOURNAL_MACRO_HEADER_SIZE 6
+
+typedef enum config_journal_key_t {
+    CONFIG_JOURNAL_KEY_RGB = 0,
+    CONFIG_JOURNAL_KEY_GAMING,
+    CONFIG_JOURNAL_KEY_DISPLAY,
+    CONFIG_JOURNAL_KEY_DEBUG,
+    CONFIG_JOURNAL_KEY_POINTING,
+    CONFIG_JOURNAL_KEY_RTC,
+    CONFIG_JOURNAL_KEY_FLAGS,
+    CONFIG_JOURNAL_KEY_MACROS,
+    CONFIG_JOURNAL_KEY_COUNT,
+} config_journal_key_t;
+
+/**
+ * @brief Starts each bank. Only the bank with the newest valid header is live; the header is written last when a
+ * bank is compacted into, so a bank that was only partially written is never picked.
+ */
+typedef struct PACKED config_journal_header_t {
+    uint16_t magic;
+    uint16_t generation;
+    uint16_t crc;
+} config_journal_header_t;
+
+/**
+ * @brief Precedes each record's payload. The payload is followed by a CRC of the bank generation, this header and
+ * the payload, so records left over from an older generation of the bank are never mistaken for live ones.
+ */
+typedef struct PACKED config_journal_record_t {
+    uint8_t key;
+    uint8_t length;
+} config_journal_record_t;
+
+#define CONFIG_JOURNAL_RECORD_OVERHEAD (sizeof(config_journal_record_t) + sizeof(uint16_t))
+
+typedef struct config_journal_stats_t {
+    uint16_t appends;
+    uint16_t compactions;
+    uint8_t  recovered; // live records found at boot
+    bool     torn;      // a partially written record was found at boot, and discarded
+} config_journal_stats_t;
+
+bool                          config_journal_init(void);
+uint8_t                       config_journal_read(uint8_t key, void *data, uint8_t size);
+bool                          config_journal_write(uint8_t key, const void *data, uint8_t size);
+bool                          config_journal_format(void);
+const config_journal_stats_t *config_journal_get_stats(void);
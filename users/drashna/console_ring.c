@@ -0,0 +1,156 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "console_ring.h"
+#include <string.h>
+
+/**
+ * @brief Byte ring that every console sink reads from, so that printing doesn't wait on any of them.
+ *
+ * Positions are free running 16 bit counters, and only the low bits index the buffer. The writer never waits for
+ * the readers: it overwrites the oldest bytes, and each reader checks after copying whether what it copied was
+ * overwritten under it. The writer is expected to be the main loop, as the writes from other threads are not
+ * serialized against it (they can only garble each other's output, not the ring).
+ */
+
+#define CONSOLE_RING_MASK (CONSOLE_RING_SIZE - 1)
+
+#define console_ring_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static uint8_t           ring[CONSOLE_RING_SIZE];
+static volatile uint16_t head    = 0;
+static volatile bool     is_full = false;
+
+/**
+ * @brief Adds a byte to the ring, overwriting the oldest one if it is full.
+ *
+ * @param c byte to add
+ */
+void console_ring_write(uint8_t c) {
+    uint16_t position = head;
+
+    ring[position & CONSOLE_RING_MASK] = c;
+    console_ring_barrier();
+    head = position + 1;
+    if (position == CONSOLE_RING_MASK) {
+        is_full = true;
+    }
+}
+
+/**
+ * @brief Gets the position the next byte will be written to.
+ *
+ * @return uint16_t head position
+ */
+uint16_t console_ring_head(void) {
+    return head;
+}
+
+/**
+ * @brief Gets the number of bytes behind the head that are still held by the ring.
+ *
+ * @return uint16_t number of bytes
+ */
+uint16_t console_ring_available(void) {
+    return is_full ? CONSOLE_RING_SIZE : head;
+}
+
+/**
+ * @brief Gets the byte at a position, without any check that it hasn't been overwritten.
+ *
+ * @param position position to read
+ * @return uint8_t byte at that position
+ */
+uint8_t console_ring_peek(uint16_t position) {
+    return ring[position & CONSOLE_RING_MASK];
+}
+
+/**
+ * @brief Copies the bytes a reader hasn't seen yet, and moves it past them.
+ *
+ * @param reader reader to copy for
+ * @param buffer where to copy to
+ * @param size size of the buffer
+ * @return uint16_t number of bytes copied
+ */
+uint16_t console_ring_read(console_ring_reader_t *reader, uint8_t *buffer, uint16_t size) {
+    uint16_t count;
+
+    for (;;) {
+        uint16_t end = head;
+        console_ring_barrier();
+
+        uint16_t behind = end - reader->tail;
+        if (behind > CONSOLE_RING_SIZE) {
+            reader->dropped += behind - CONSOLE_RING_SIZE;
+            reader->tail = end - CONSOLE_RING_SIZE;
+            behind       = CONSOLE_RING_SIZE;
+        }
+        count = behind < size ? behind : size;
+
+        // in at most two pieces, either side of the end of the buffer
+        uint16_t offset = reader->tail & CONSOLE_RING_MASK;
+        uint16_t first  = CONSOLE_RING_SIZE - offset < count ? CONSOLE_RING_SIZE - offset : count;
+        memcpy(buffer, &ring[offset], first);
+        memcpy(buffer + first, ring, count - first);
+
+        // if the writer lapped the copy, the start of it may have been overwritten, so skip past and try again
+        console_ring_barrier();
+        if ((uint16_t)(head - reader->tail) <= CONSOLE_RING_SIZE) {
+            break;
+        }
+    }
+    reader->tail += count;
+    return count;
+}
+
+/**
+ * @brief Moves a reader back over the end of what it last read, for what it couldn't pass on, so that it's read
+ * again next time. If the writer laps it first, it's counted as dropped as usual.
+ *
+ * @param reader reader to move back
+ * @param count number of bytes, no more than the last read returned
+ */
+void console_ring_unread(console_ring_reader_t *reader, uint16_t count) {
+    reader->tail -= count;
+}
+
+/**
+ * @brief Finds the last lines of output, by walking back from the newest byte to the newlines before it.
+ *
+ * Lines longer than max_length are cut short. Lines that are no longer held by the ring are left empty, and once
+ * the ring has wrapped, so is the oldest line it holds part of, as its start has been overwritten (or can't be told
+ * apart from it, when the newline before it is the byte that was).
+ *
+ * @param lines set to each line, oldest first. The last one is the line that is still being written.
+ * @param count number of lines to find
+ * @param max_length longest line to return
+ */
+void console_ring_get_lines(console_ring_line_t *lines, uint8_t count, uint8_t max_length) {
+    // is_full first, so a head read after the ring wraps is still clamped to what the ring holds
+    bool     wrapped   = is_full;
+    uint16_t end       = head;
+    uint16_t available = wrapped || end > CONSOLE_RING_SIZE ? CONSOLE_RING_SIZE : end;
+
+    for (uint8_t i = count; i-- > 0;) {
+        uint16_t start = end;
+        while (available && ring[(uint16_t)(start - 1) & CONSOLE_RING_MASK] != '\n') {
+            --start;
+            --available;
+        }
+        uint16_t length = end - start;
+        lines[i].start  = start;
+        lines[i].length = !available && wrapped ? 0 : length < max_length ? length : max_length;
+        if (!available) {
+            // out of output, so everything before this is empty
+            while (i-- > 0) {
+                lines[i].start  = start;
+                lines[i].length = 0;
+            }
+            break;
+        }
+        // step over the newline that ends the line before
+        end = start - 1;
+        --available;
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef CONSOLE_RING_SIZE
+#    define CONSOLE_RING_SIZE 1024
+#endif // CONSOLE_RING_SIZE
+
+_Static_assert((CONSOLE_RING_SIZE & (CONSOLE_RING_SIZE - 1)) == 0, "CONSOLE_RING_SIZE must be a power of two!");
+_Static_assert(CONSOLE_RING_SIZE <= 32768, "CONSOLE_RING_SIZE is too large!");
+
+/**
+ * @brief A consumer of the console ring. Each one reads at its own pace, and if it falls a whole ring behind, the
+ * bytes it missed are counted as dropped rather than holding up the writer.
+ */
+typedef struct console_ring_reader_t {
+    uint16_t tail; // position of the next byte to read
+    uint32_t dropped;
+} console_ring_reader_t;
+
+/**
+ * @brief A line of output held by the console ring.
+ */
+typedef struct console_ring_line_t {
+    uint16_t start; // position of the first byte
+    uint8_t  length;
+} console_ring_line_t;
+
+void     console_ring_write(uint8_t c);
+uint16_t console_ring_head(void);
+uint16_t console_ring_available(void);
+uint8_t  console_ring_peek(uint16_t position);
+uint16_t console_ring_read(console_ring_reader_t *reader, uint8_t *buffer, uint16_t size);
+void     console_ring_unread(console_ring_reader_t *reader, uint16_t count);
+void     console_ring_get_lines(console_ring_line_t *lines, uint8_t count, uint8_t max_length);
@@ -3,12 +3,14 @@
 
 #include "drashna.h"
 #include "display.h"
+#include "console_ring.h"
 
 #if defined(OLED_ENABLE) && defined(CUSTOM_OLED_DRIVER)
 #    include "display/oled/oled_stuff.h"
 #endif // OLED_ENABLE && CUSTOM_OLED_DRIVER
 #if defined(QUANTUM_PAINTER_ENABLE) && defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
 #    include "qp.h"
+#    include "display/painter/painter_damage.h"
 #    if defined(DISPLAY_KEYLOGGER_ENABLE)
 #        include "display/painter/keylogger.h"
 #    endif
@@ -72,9 +74,12 @@ void housekeeping_task_display(void) {
 bool process_record_display_driver(uint16_t keycode, keyrecord_t* record) {
     userspace_runtime_state.last_keycode   = keycode;
     userspace_runtime_state.last_key_event = record->event;
-#if defined(CUSTOM_QUANTUM_PAINTER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
+#if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    painter_damage_mark(PAINTER_DAMAGE_INPUT);
+#    if defined(DISPLAY_KEYLOGGER_ENABLE)
     keylogger_process(keycode, record);
-#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
+#    endif // DISPLAY_KEYLOGGER_ENABLE
+#endif     // CUSTOM_QUANTUM_PAINTER_ENABLE
     if (record->event.pressed) {
 #ifdef OLED_ENABLE
         if (!process_record_user_oled(keycode, record)) {
@@ -116,10 +121,7 @@ void keyboard_post_init_display_driver(void) {
 #endif // QUANTUM_PAINTER_ENABLE && CUSTOM_QUANTUM_PAINTER_ENABLE
 }
 
-bool           console_log_needs_redraw = false, console_has_redrawn = false;
-static uint8_t log_write_idx = 0;
-static char    loglines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1][DISPLAY_CONSOLE_LOG_LINE_LENGTH + 2];
-char*          logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM + 1];
+bool console_log_needs_redraw = false, console_has_redrawn = false;
 
 #if defined(OLED_ENABLE) && !defined(QUANTUM_PAINTER_ENABLE)
 _Static_assert(DISPLAY_CONSOLE_LOG_LINE_LENGTH <= (OLED_DISPLAY_WIDTH / OLED_FONT_WIDTH),
@@ -127,39 +129,31 @@ _Static_assert(DISPLAY_CONSOLE_LOG_LINE_LENGTH <= (OLED_DISPLAY_WIDTH / OLED_FON
 #endif
 
 /**
- * @brief Function for capturing console log messages.
+ * @brief Finds the lines of console output to display, straight from the console ring.
  *
- * @param c
+ * Lines longer than DISPLAY_CONSOLE_LOG_LINE_LENGTH are cut short, and lines that are no longer whole in the ring
+ * are left empty.
+ *
+ * @param lines set to each line, oldest first. The last one is the line that is still being written.
  */
-void display_sendchar_hook(uint8_t c) {
-    static bool first_setup = false;
-    if (!first_setup) {
-        memset(loglines, 0, sizeof(loglines));
-        for (int i = 0; i < (DISPLAY_CONSOLE_LOG_LINE_NUM + 1); ++i) {
-            logline_ptrs[i] = loglines[i];
-        }
-        first_setup = true;
-    }
+void display_console_get_lines(display_console_line_t lines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1]) {
+    console_ring_get_lines(lines, DISPLAY_CONSOLE_LOG_LINE_NUM + 1, DISPLAY_CONSOLE_LOG_LINE_LENGTH);
+}
 
-    if (c == '\n') {
-        logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM][log_write_idx] = 0;
-        char* tmp                                                 = logline_ptrs[0];
-        for (int i = 0; i < DISPLAY_CONSOLE_LOG_LINE_NUM; ++i) {
-            logline_ptrs[i] = logline_ptrs[i + 1];
-        }
-        logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM]    = tmp;
-        log_write_idx                                 = 0;
-        logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM][0] = 0;
-        console_log_needs_redraw                      = true;
-        console_has_redrawn                           = false;
-    } else if (log_write_idx >= (DISPLAY_CONSOLE_LOG_LINE_LENGTH)) {
-        // Ignore.
-    } else {
-        logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM][log_write_idx++] = c;
-        logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM][log_write_idx]   = 0;
-        console_log_needs_redraw                                    = true;
-        console_has_redrawn                                         = false;
+/**
+ * @brief Copies a console line out of the console ring. This isn't checked against the ring being written at the
+ * same time, as any line that is torn by it gets redrawn with the output that tore it.
+ *
+ * @param line line to copy, from display_console_get_lines()
+ * @param buffer set to the line, null terminated
+ * @return char* the buffer
+ */
+char* display_console_copy_line(const display_console_line_t* line, char buffer[DISPLAY_CONSOLE_LOG_LINE_LENGTH + 1]) {
+    for (uint8_t i = 0; i < line->length; i++) {
+        buffer[i] = console_ring_peek(line->start + i);
     }
+    buffer[line->length] = '\0';
+    return buffer;
 }
 
 void display_rotate_screen(bool clockwise, bool is_left) {
@@ -196,7 +190,10 @@ void display_rotate_screen(bool clockwise, bool is_left) {
 #else
     userspace_config.display.oled.rotation = temp_rotation;
 #endif // QUANTUM_PAINTER_ENABLE
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_mark_dirty();
+#if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    painter_damage_mark(PAINTER_DAMAGE_ALL);
+#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
 #ifdef QUANTUM_PAINTER_ILI9341_ENABLE
     init_display_ili9341_rotation();
 #endif // QUANTUM_PAINTER_ILI9341_ENABLE
@@ -211,6 +208,11 @@ void display_rotate_screen(bool clockwise, bool is_left) {
 bool display_menu_set_dirty_user(bool state) {
     userspace_runtime_state.display.menu_state_runtime.dirty        = state;
     userspace_runtime_state.display.menu_state_runtime.has_rendered = !state;
+#if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    if (state) {
+        painter_damage_mark(PAINTER_DAMAGE_MENU);
+    }
+#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
     return true;
 }
 
@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include "action.h"
 #include "progmem.h"
+#include "console_ring.h"
 
 extern bool layer_map_has_updated;
 
@@ -36,5 +37,9 @@ void display_rotate_screen(bool clockwise, bool is_left);
 #        endif // QUANTUM_PAINTER_ILI9488_SPI_ENABLE
 #    endif     // OLED_ENABLE && !QUANTUM_PAINTER_ENABLE
 #endif         // DISPLAY_CONSOLE_LOG_LINE_LENGTH
-extern bool  console_log_needs_redraw, console_has_redrawn;
-extern char* logline_ptrs[DISPLAY_CONSOLE_LOG_LINE_NUM + 1];
+extern bool console_log_needs_redraw, console_has_redrawn;
+
+typedef console_ring_line_t display_console_line_t;
+
+void  display_console_get_lines(display_console_line_t lines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1]);
+char* display_console_copy_line(const display_console_line_t* line, char buffer[DISPLAY_CONSOLE_LOG_LINE_LENGTH + 1]);
@@ -72,10 +72,10 @@ ifeq ($(strip $(QUANTUM_PAINTER_ENABLE)), yes)
         SRC += $(USER_PATH)/display/painter/graphics/qmk_logo_220x220.qgf.c \
             $(USER_PATH)/display/painter/graphics/qmk_powered_by.qgf.c \
             $(USER_PATH)/display/painter/graphics/akira_explosion.qgf.c \
-            $(USER_PATH)/display/painter/graphics/asuka-240x320.qgf.c \
-            $(USER_PATH)/display/painter/graphics/anime-girl-jacket-240x320.qgf.c \
-            $(USER_PATH)/display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.qgf.c \
-            $(USER_PATH)/display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.qgf.c \
+            $(USER_PATH)/display/painter/graphics/asuka-240x320.rle565.c \
+            $(USER_PATH)/display/painter/graphics/anime-girl-jacket-240x320.rle565.c \
+            $(USER_PATH)/display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.rle565.c \
+            $(USER_PATH)/display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.rle565.c \
             $(USER_PATH)/display/painter/graphics/large_nyan_cat.qgf.c \
             $(USER_PATH)/display/painter/graphics/nyan_cat.qgf.c
 
@@ -87,10 +87,14 @@ ifeq ($(strip $(QUANTUM_PAINTER_ENABLE)), yes)
             $(USER_PATH)/display/painter/fonts/font_thintel15.qff.c
 
         SRC += $(USER_PATH)/display/painter/painter.c \
+                $(USER_PATH)/display/painter/painter_damage.c \
+                $(USER_PATH)/display/painter/painter_rle565.c \
+                $(USER_PATH)/display/painter/painter_life.c \
                 $(USER_PATH)/display/painter/graphics.qgf.c
 
         ifeq ($(strip $(MULTITHREADED_PAINTER_ENABLE)), yes)
             OPT_DEFS += -DMULTITHREADED_PAINTER_ENABLE
+            SRC += $(USER_PATH)/display/painter/display_state.c
         endif
         ifeq ($(strip $(SCREENSAVER_TESTING_ENABLE)), yes)
             OPT_DEFS += -DSCREENSAVER_TESTING_ENABLE
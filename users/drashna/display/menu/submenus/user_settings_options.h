@@ -7,7 +7,7 @@ bool menu_handler_overwatch_mode(menu_input_t input) {
         case menu_input_right:
         case menu_input_enter:
             userspace_config.gaming.is_overwatch = !userspace_config.gaming.is_overwatch;
-            eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+            userspace_config_mark_dirty();
             return false;
         default:
             return true;
@@ -24,7 +24,7 @@ bool menu_handler_gamepad_swap(menu_input_t input) {
         case menu_input_right:
         case menu_input_enter:
             userspace_config.gaming.swapped_numbers = !userspace_config.gaming.swapped_numbers;
-            eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+            userspace_config_mark_dirty();
             return false;
         default:
             return true;
@@ -41,7 +41,7 @@ bool menu_handler_clap_trap(menu_input_t input) {
         case menu_input_right:
         case menu_input_enter:
             userspace_config.gaming.clap_trap_enable = !userspace_config.gaming.clap_trap_enable;
-            eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+            userspace_config_mark_dirty();
             return false;
         default:
             return true;
@@ -20,6 +20,9 @@
 #ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
 #    include "layer_map.h"
 #endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+#    include "wpm_stats.h"
+#endif // WPM_ENABLE
 #ifdef COMMUNITY_MODULE_KEYBOARD_LOCK_ENABLE
 #    include "keyboard_lock.h"
 #endif // COMMUNITY_MODULE_KEYBOARD_LOCK_ENABLE
@@ -119,22 +122,49 @@ void split_sync_oled_keylogger_str(const uint8_t *data, uint8_t size) {
 }
 #endif // DISPLAY_KEYLOGGER_ENABLE
 
+/**
+ * @brief Marks every block that overlaps a range of the OLED buffer as dirty, in one go rather than per byte.
+ *
+ * @param start index of the first byte in the range
+ * @param end index one past the last byte in the range
+ */
+void oled_buffer_mark_dirty(uint16_t start, uint16_t end) {
+    if (start >= end) {
+        return;
+    }
+    uint8_t first = start / OLED_BLOCK_SIZE;
+    uint8_t last  = (end - 1) / OLED_BLOCK_SIZE;
+    // shifting 2 rather than 1 up to the last block wraps around to all bits set, rather than overflowing
+    oled_dirty |= (OLED_BLOCK_TYPE)((((OLED_BLOCK_TYPE)2 << last) - 1) & ~(((OLED_BLOCK_TYPE)1 << first) - 1));
+}
+
+/**
+ * @brief Scrolls a section of the OLED buffer by one pixel column, a row at a time.
+ *
+ * Panning left drops the first column and leaves the last one as it was. Panning right pulls in the column to the
+ * left of the section (or a blank one, at the edge of the screen) and drops the last one.
+ *
+ * @param left direction to pan in
+ * @param y_start first row (page) to pan
+ * @param y_end row after the last one to pan
+ * @param x_start first column to pan
+ * @param x_end column after the last one to pan
+ */
 void oled_pan_section(bool left, uint16_t y_start, uint16_t y_end, uint16_t x_start, uint16_t x_end) {
-    uint16_t i = 0;
+    if (x_end <= x_start + 1) {
+        return;
+    }
     for (uint16_t y = y_start; y < y_end; y++) {
+        uint8_t *row = &oled_buffer[y * oled_rotation_width];
         if (left) {
-            for (uint16_t x = x_start; x < x_end - 1; x++) {
-                i              = y * oled_rotation_width + x;
-                oled_buffer[i] = oled_buffer[i + 1];
-                oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
-            }
+            memmove(&row[x_start], &row[x_start + 1], x_end - x_start - 1);
+        } else if (x_start) {
+            memmove(&row[x_start], &row[x_start - 1], x_end - x_start);
         } else {
-            for (uint16_t x = x_end - 1; x >= x_start; x--) {
-                i              = y * oled_rotation_width + x;
-                oled_buffer[i] = oled_buffer[i - 1];
-                oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
-            }
+            memmove(&row[1], &row[0], x_end - 1);
+            row[0] = 0;
         }
+        oled_buffer_mark_dirty(y * oled_rotation_width + x_start, y * oled_rotation_width + x_end);
     }
 }
 
@@ -167,7 +197,7 @@ bool process_record_user_oled(uint16_t keycode, keyrecord_t *record) {
                 break;
             case OLED_LOCK:
                 userspace_config.display.oled.screen_lock = !userspace_config.display.oled.screen_lock;
-                eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+                userspace_config_mark_dirty();
                 if (userspace_config.display.oled.screen_lock) {
                     oled_on();
                 }
@@ -560,6 +590,9 @@ void render_wpm(uint8_t padding, uint8_t col, uint8_t line) {
 /**
  * @brief Renders dynamic WPM graph on screen
  *
+ * Plots the newest one second sample from the WPM statistics, which is also kept up to date on the slave half by
+ * the split sync.
+ *
  * @param start_offset horizontal pixel location (from left side of screen) to start rendering graph
  * @param cutoff horizontal pixel location (from left side of screen) to stop rendering graph
  * @param max_lines_graph vertical pixel height of graph
@@ -569,7 +602,7 @@ void render_wpm_graph(uint8_t start_offset, uint8_t cutoff, uint8_t max_lines_gr
 #ifdef WPM_ENABLE
     static uint16_t timer   = 0;
     static uint8_t  x       = OLED_DISPLAY_HEIGHT - 1;
-    uint8_t         currwpm = get_current_wpm();
+    uint8_t         currwpm = wpm_stats_newest(WPM_STATS_SECONDS);
     float           max_wpm = OLED_WPM_GRAPH_MAX_WPM;
 
     if (timer_elapsed(timer) >
@@ -732,9 +765,13 @@ void render_mouse_mode(uint8_t col, uint8_t line) {
 }
 
 void render_console_output(uint8_t col, uint8_t line) {
+    display_console_line_t lines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1];
+    char                   buffer[DISPLAY_CONSOLE_LOG_LINE_LENGTH + 1];
+
+    display_console_get_lines(lines);
     for (uint8_t i = 0; i < DISPLAY_CONSOLE_LOG_LINE_NUM; i++) {
         oled_set_cursor(col, line + i);
-        oled_write(logline_ptrs[i], false);
+        oled_write(display_console_copy_line(&lines[i], buffer), false);
     }
 }
 
@@ -1102,7 +1139,7 @@ __attribute__((weak)) bool oled_task_keymap(void) {
     return true;
 }
 
-__attribute__((weak)) void render_oled_screensaver(void) {
+__attribute__((weak)) void render_oled_screensaver(bool restart) {
     oled_off();
 }
 
@@ -1119,8 +1156,8 @@ bool oled_task_user(void) {
     }
 
     if (oled_screensaver_enabled) {
+        render_oled_screensaver(!was_screensaver_enabled);
         was_screensaver_enabled = true;
-        render_oled_screensaver();
         return false;
     }
     if (was_screensaver_enabled) {
@@ -1225,42 +1262,56 @@ void oled_shutdown(bool jump_to_bootloader) {
     oled_render_dirty(true);
 }
 
-void oled_write_compressed(compressed_oled_frame_t frame) {
-    uint16_t block_index = 0;
-    for (uint16_t i = 0; i < frame.data_len; i++) {
-        uint8_t bit          = i % 8;
-        uint8_t map_index    = i / 8;
-        uint8_t _block_map   = frame.block_map[map_index];
-        uint8_t nonzero_byte = (_block_map & (1 << bit));
-        if (nonzero_byte) {
-            const char data = frame.block_list[block_index++];
-            oled_write_raw_byte(data, i);
+/**
+ * @brief Decodes a compressed frame straight into the OLED buffer.
+ *
+ * Each bit of the block map stands for one byte of the frame, and the set bits take the next byte of the block list
+ * while the rest are blank. Frames are decoded a map byte (eight bytes of buffer) at a time, and only the groups
+ * that change are written and marked dirty.
+ *
+ * @param frame frame to decode
+ * @param in_progmem whether the block map and list are in PROGMEM
+ */
+static void oled_write_compressed_frame(compressed_oled_frame_t frame, bool in_progmem) {
+    const uint8_t *block_map  = (const uint8_t *)frame.block_map;
+    const uint8_t *block_list = (const uint8_t *)frame.block_list;
+    uint16_t       data_len   = MIN(frame.data_len, OLED_MATRIX_SIZE);
+
+    for (uint16_t i = 0; i < data_len; i += 8) {
+        uint8_t group[8] = {0};
+        uint8_t size     = MIN(8, data_len - i);
+        uint8_t map      = in_progmem ? pgm_read_byte(block_map++) : *block_map++;
+
+        if (map == 0xFF && size == 8) {
+            // every byte is set, so it's a straight copy
+            if (in_progmem) {
+                memcpy_P(group, block_list, 8);
+            } else {
+                memcpy(group, block_list, 8);
+            }
+            block_list += 8;
         } else {
-            const char data = (const char)0x00;
-            oled_write_raw_byte(data, i);
+            for (uint8_t bit = 0; map && bit < size; bit++, map >>= 1) {
+                if (map & 1) {
+                    group[bit] = in_progmem ? pgm_read_byte(block_list++) : *block_list++;
+                }
+            }
+        }
+        if (memcmp(&oled_buffer[i], group, size) != 0) {
+            memcpy(&oled_buffer[i], group, size);
+            oled_buffer_mark_dirty(i, i + size);
         }
     }
 }
-#ifndef pgm_read_byte_near
-#    define pgm_read_byte_near(addr) pgm_read_byte(addr)
-#endif
+
+void oled_write_compressed(compressed_oled_frame_t frame) {
+    oled_write_compressed_frame(frame, false);
+}
 
 void oled_write_compressed_P(compressed_oled_frame_t frame) {
-    uint16_t block_index = 0;
-    for (uint16_t i = 0; i < frame.data_len; i++) {
-        uint8_t bit          = i % 8;
-        uint8_t map_index    = i / 8;
-        uint8_t _block_map   = (uint8_t)pgm_read_byte_near(frame.block_map + map_index);
-        uint8_t nonzero_byte = (_block_map & (1 << bit));
-        if (nonzero_byte) {
-            const char data = (const char)pgm_read_byte_near(frame.block_list + block_index++);
-            oled_write_raw_byte(data, i);
-        } else {
-            const char data = (const char)0x00;
-            oled_write_raw_byte(data, i);
-        }
-    }
+    oled_write_compressed_frame(frame, true);
 }
+
 /**
  * @brief Re-initializes the OLED display with the specified rotation and inversion settings.
  *
@@ -1291,7 +1342,7 @@ void oled_post_init(void) {
 void oled_brightness_increase_step(void) {
     userspace_config.display.oled.brightness = qadd8(userspace_config.display.oled.brightness, OLED_BRIGHTNESS_STEP);
     oled_set_brightness(userspace_config.display.oled.brightness);
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_mark_dirty();
 }
 
 /**
@@ -1304,5 +1355,5 @@ void oled_brightness_increase_step(void) {
 void oled_brightness_decrease_step(void) {
     userspace_config.display.oled.brightness = qsub8(userspace_config.display.oled.brightness, OLED_BRIGHTNESS_STEP);
     oled_set_brightness(userspace_config.display.oled.brightness);
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_mark_dirty();
 }
@@ -60,6 +60,8 @@ void oled_brightness_decrease_step(void);
 
 void        render_wpm_graph(uint8_t start_offset, uint8_t cutoff, uint8_t max_lines_graph, uint8_t vertical_offset);
 void        oled_pan_section(bool left, uint16_t y_start, uint16_t y_end, uint16_t x_start, uint16_t x_end);
+void        oled_buffer_mark_dirty(uint16_t start, uint16_t end);
+void        render_oled_screensaver(bool restart);
 const char* get_oled_keylogger_str(void);
 void        split_sync_oled_keylogger_str(const uint8_t* data, uint8_t size);
 
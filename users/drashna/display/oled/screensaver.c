@@ -4,28 +4,110 @@
 #include "oled_driver.h"
 #include "timer.h"
 #include "util.h"
+#include "progmem.h"
+#include "oled_stuff.h"
 
-#include "screensavers/matrix_scroll.h"
+#if defined(OLED_DISPLAY_128X128)
+#    if defined(MCU_RP) || defined(QMK_MCU_SERIES_STM32F4XX) || defined(OLED_DISPLAY_FORCE_SCREENSAVER)
+#        define SCREENSAVER_ANIM_ENABLED
+#    endif
+#elif defined(OLED_DISPLAY_128X64)
+#    define SCREENSAVER_ANIM_ENABLED
+#endif
 
 #define FRAME_DURATION 30 // How long each frame lasts in milliseconds
 
-void render_oled_screensaver(void) {
 #if defined(SCREENSAVER_ANIM_ENABLED)
-    static uint32_t timer         = 0;
-    static uint8_t  current_frame = 0;
+// regenerate with screensavers/encode_screensaver.py after changing screensavers/matrix_scroll.h
+#    include "screensavers/matrix_scroll_delta.h"
+
+_Static_assert(SCREENSAVER_FRAME_SIZE <= OLED_MATRIX_SIZE, "Screensaver frames are larger than the OLED buffer!");
+
+#    define SCREENSAVER_FLAG_KEYFRAME 0x01
+
+extern uint8_t oled_buffer[OLED_MATRIX_SIZE];
 
-    // Run animation
-    if (timer_elapsed(timer) > FRAME_DURATION) {
-        // Set timer to updated time
-        timer = timer_read();
+/**
+ * @brief Copies a run of bytes into the OLED buffer, and marks the part of it that actually changed as dirty, so that
+ * only the blocks that differ from the last frame get sent to the display.
+ *
+ * @param position index in the OLED buffer to start at
+ * @param data bytes to copy, from PROGMEM, or NULL to clear the run instead
+ * @param length number of bytes in the run
+ */
+static void screensaver_write_run(uint16_t position, const uint8_t *data, uint16_t length) {
+    uint16_t first = UINT16_MAX, last = 0;
 
-        // Increment frame
-        current_frame = (current_frame + 1) % ARRAY_SIZE(screensaver);
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t value = data ? pgm_read_byte(&data[i]) : 0;
+        if (oled_buffer[position + i] != value) {
+            oled_buffer[position + i] = value;
+            if (first == UINT16_MAX) {
+                first = position + i;
+            }
+            last = position + i + 1;
+        }
     }
+    if (first != UINT16_MAX) {
+        oled_buffer_mark_dirty(first, last);
+    }
+}
 
-    // Draw frame to OLED
-    oled_write_raw_P(screensaver[current_frame], ARRAY_SIZE(screensaver[current_frame]));
+/**
+ * @brief Applies a frame of the delta encoded animation to the OLED buffer. Keyframes are encoded against a blank
+ * screen, so the gaps between their runs are cleared rather than left as they were.
+ *
+ * @param offset offset of the frame in screensaver_data
+ * @return uint16_t offset of the frame after it
+ */
+static uint16_t screensaver_decode_frame(uint16_t offset) {
+    bool     keyframe = pgm_read_byte(&screensaver_data[offset++]) & SCREENSAVER_FLAG_KEYFRAME;
+    uint16_t position = 0;
 
+    for (;;) {
+        uint8_t skip   = pgm_read_byte(&screensaver_data[offset]);
+        uint8_t length = pgm_read_byte(&screensaver_data[offset + 1]);
+        offset += 2;
+        if (!skip && !length) {
+            break;
+        }
+        if (keyframe) {
+            screensaver_write_run(position, NULL, skip);
+        }
+        position += skip;
+        screensaver_write_run(position, &screensaver_data[offset], length);
+        position += length;
+        offset += length;
+    }
+    if (keyframe) {
+        screensaver_write_run(position, NULL, SCREENSAVER_FRAME_SIZE - position);
+    }
+    return offset;
+}
+#endif // SCREENSAVER_ANIM_ENABLED
+
+/**
+ * @brief Renders the screensaver animation, advancing it a frame every FRAME_DURATION.
+ *
+ * @param restart true when the screensaver has just been started, to start the animation from its first frame
+ */
+void render_oled_screensaver(bool restart) {
+#if defined(SCREENSAVER_ANIM_ENABLED)
+    static uint32_t timer  = 0;
+    static uint16_t offset = 0;
+
+    if (restart) {
+        // the first frame is a keyframe, so this doesn't depend on what was on the screen before
+        timer  = timer_read();
+        offset = screensaver_decode_frame(0);
+    } else if (timer_elapsed(timer) > FRAME_DURATION) {
+        timer  = timer_read();
+        offset = screensaver_decode_frame(offset);
+        // the data ends with the delta from the last frame back to the first, so carry on from the second
+        if (offset >= SCREENSAVER_DATA_SIZE) {
+            offset = SCREENSAVER_LOOP_OFFSET;
+        }
+    }
 #else
     oled_off();
 #endif
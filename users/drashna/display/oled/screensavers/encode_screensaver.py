@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Encodes a raw OLED screensaver animation into the delta format played by screensaver.c.
+
+The input is a header holding one or more `screensaver[frames][size + 1]` arrays of raw OLED buffer contents, like
+matrix_scroll.h. Each array is encoded on its own, and the output picks one by OLED_MATRIX_SIZE.
+
+Every frame is stored as the bytes that changed since the frame before it. Keyframes are stored against a blank
+buffer instead, so they don't depend on what was on the screen, and playback always starts from one. A frame is:
+
+    flags:8                          1 if it's a keyframe
+    (skip:8 length:8 byte...)...     runs of changed bytes, each `skip` bytes after the end of the last one
+    0:8 0:8                          end of the frame
+
+A run with a length of 0 only skips, for gaps longer than 255 bytes. After the last frame comes the delta from it
+back to the first, and the animation loops from the second frame onwards.
+
+Every encoding is decoded again and played back through two loops before it is written, and the tool fails if any
+frame doesn't come out exactly as it went in.
+
+Usage: encode_screensaver.py matrix_scroll.h [-o matrix_scroll_delta.h] [-k keyframe_interval]
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+FLAG_KEYFRAME = 0x01
+MAX_SKIP = 255
+MAX_LENGTH = 255
+# a gap this short costs no more to resend than to skip, and saves a run
+MERGE_GAP = 2
+ARRAY_RE = re.compile(r'screensaver\[(\d+)\]\[(\d+)\s*\+\s*1\]\s*PROGMEM\s*=\s*\{(.*?)\n\};', re.S)
+FRAME_RE = re.compile(r'//\s*frame\s*\d+')
+NUMBER_RE = re.compile(r'\b\d+\b')
+
+
+def parse_animations(path):
+    """Reads every screensaver array in a header, as lists of frames, keyed by frame size."""
+    animations = {}
+    for match in ARRAY_RE.finditer(Path(path).read_text(encoding='utf-8')):
+        count, size, body = int(match.group(1)), int(match.group(2)), match.group(3)
+        frames = []
+        for chunk in FRAME_RE.split(body)[1:]:
+            frame = bytes(int(number) for number in NUMBER_RE.findall(chunk))
+            if len(frame) > size:
+                sys.exit(f'{path}: frame {len(frames)} of the {size} byte animation is {len(frame)} bytes')
+            # shorter initializers are zero filled by the compiler
+            frames.append(frame + bytes(size - len(frame)))
+        if len(frames) != count:
+            sys.exit(f'{path}: expected {count} frames of {size} bytes, found {len(frames)}')
+        animations[size] = frames
+    if not animations:
+        sys.exit(f'{path}: no screensaver arrays found')
+    return animations
+
+
+def changed_runs(previous, frame):
+    """Finds the runs of bytes that differ between two frames, merging runs separated by short gaps."""
+    runs = []
+    i = 0
+    while i < len(frame):
+        if previous[i] == frame[i]:
+            i += 1
+            continue
+        start = i
+        while i < len(frame) and previous[i] != frame[i]:
+            i += 1
+        if runs and start - runs[-1][1] <= MERGE_GAP:
+            runs[-1][1] = i
+        else:
+            runs.append([start, i])
+    return runs
+
+
+def encode_frame(previous, frame, keyframe):
+    """Encodes a frame, against the previous one, or a blank one if it's a keyframe."""
+    if keyframe:
+        previous = bytes(len(frame))
+    data = bytearray([FLAG_KEYFRAME if keyframe else 0])
+    position = 0
+    for start, end in changed_runs(previous, frame):
+        skip = start - position
+        while skip > MAX_SKIP:
+            data += bytes([MAX_SKIP, 0])
+            skip -= MAX_SKIP
+        while end - start > MAX_LENGTH:
+            data += bytes([skip, MAX_LENGTH]) + frame[start:start + MAX_LENGTH]
+            start += MAX_LENGTH
+            skip = 0
+        data += bytes([skip, end - start]) + frame[start:end]
+        position = end
+    data += bytes([0, 0])
+    return bytes(data)
+
+
+def encode(frames, keyframe_interval):
+    """Encodes an animation, returning the data and the offset playback loops back to."""
+    data = bytearray()
+    loop_offset = 0
+    for index, frame in enumerate(frames):
+        keyframe = index == 0 or (keyframe_interval and index % keyframe_interval == 0)
+        data += encode_frame(frames[index - 1], frame, keyframe)
+        if index == 0:
+            loop_offset = len(data)
+    data += encode_frame(frames[-1], frames[0], False)
+    return bytes(data), loop_offset
+
+
+def decode_frame(data, offset, buffer):
+    """Applies the frame at an offset to the buffer, the same way screensaver.c does, returning the next offset."""
+    if data[offset] & FLAG_KEYFRAME:
+        buffer[:] = bytes(len(buffer))
+    offset += 1
+    position = 0
+    while True:
+        skip, length = data[offset], data[offset + 1]
+        offset += 2
+        if skip == 0 and length == 0:
+            return offset
+        position += skip
+        if position + length > len(buffer):
+            raise ValueError(f'run at {position} overflows the frame')
+        buffer[position:position + length] = data[offset:offset + length]
+        offset += length
+        position += length
+
+
+def verify(frames, data, loop_offset):
+    """Plays the encoding back through two loops, checking every frame."""
+    buffer = bytearray(b'\xA5' * len(frames[0]))
+    offset = 0
+    for step in range(2 * len(frames) + 1):
+        offset = decode_frame(data, offset, buffer)
+        if offset == len(data):
+            offset = loop_offset
+        expected = frames[step % len(frames)]
+        if buffer != expected:
+            mismatch = next(i for i in range(len(buffer)) if buffer[i] != expected[i])
+            sys.exit(f'round trip failed: frame {step % len(frames)} differs at byte {mismatch}')
+
+
+def generate(animations, source, output, keyframe_interval):
+    lines = [
+        "// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>",
+        '// SPDX-License-Identifier: GPL-3.0-or-later',
+        '',
+        f'// Generated from {Path(source).name} by encode_screensaver.py, do not edit by hand.',
+        '',
+        '#pragma once',
+        '',
+        '#include "progmem.h"',
+        '',
+    ]
+    for index, (size, frames) in enumerate(sorted(animations.items(), reverse=True)):
+        data, loop_offset = encode(frames, keyframe_interval)
+        verify(frames, data, loop_offset)
+        raw = len(frames) * (size + 1)
+        keyframes = sum(1 for i in range(len(frames)) if i == 0 or (keyframe_interval and i % keyframe_interval == 0))
+        lines += [
+            f'#{"if" if index == 0 else "elif"} OLED_MATRIX_SIZE == {size}',
+            f'// {len(frames)} frames, {keyframes} keyframes: {len(data)} bytes, from {raw} bytes raw',
+            f'#    define SCREENSAVER_FRAME_COUNT {len(frames)}',
+            f'#    define SCREENSAVER_FRAME_SIZE  {size}',
+            f'#    define SCREENSAVER_DATA_SIZE   {len(data)}',
+            f'#    define SCREENSAVER_LOOP_OFFSET {loop_offset}',
+            '',
+            '// clang-format off',
+            'static const uint8_t screensaver_data[SCREENSAVER_DATA_SIZE] PROGMEM = {',
+        ]
+        lines += ['    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',' for i in range(0, len(data), 16)]
+        lines += ['};', '// clang-format on']
+        print(f'{size} byte frames: {len(frames)} frames, {keyframes} keyframes, {len(data)} bytes '
+              f'(raw: {raw} bytes, {raw / len(data):.1f}x), round trip verified')
+    lines += ['#endif // OLED_MATRIX_SIZE', '']
+    Path(output).write_text('\n'.join(lines), encoding='utf-8')
+    print(f'wrote {output}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('animation', help='header holding the raw screensaver frames')
+    parser.add_argument('-o', '--output', help='defaults to the input name with a _delta suffix')
+    parser.add_argument('-k', '--keyframe-interval', type=int, default=36,
+                        help='frames between keyframes, 0 for only the first frame (default: 36)')
+    args = parser.parse_args()
+
+    output = args.output or Path(args.animation).with_name(Path(args.animation).stem + '_delta.h')
+    generate(parse_animations(args.animation), args.animation, output, args.keyframe_interval)
+
+
+if __name__ == '__main__':
+    main()
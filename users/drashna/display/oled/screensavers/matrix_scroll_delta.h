@@ -0,0 +1,1465 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from matrix_scroll.h by encode_screensaver.py, do not edit by hand.
+
+#pragma once
+
+#include "progmem.h"
+
+#if OLED_MATRIX_SIZE == 2048
+// 72 frames, 2 keyframes: 15044 bytes, from 147528 bytes raw
+#    define SCREENSAVER_FRAME_COUNT 72
+#    define SCREENSAVER_FRAME_SIZE  2048
+#    define SCREENSAVER_DATA_SIZE   15044
+#    define SCREENSAVER_LOOP_OFFSET 994
+
+// clang-format off
+static const uint8_t screensaver_data[SCREENSAVER_DATA_SIZE] PROGMEM = {
+    0x01, 0x0A, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x23, 0x0A, 0x1C, 0xC8, 0x3C, 0x00, 0x00, 0x74, 0x04,
+    0xFF, 0xF4, 0x84, 0x13, 0x04, 0xFF, 0x40, 0x60, 0x18, 0x05, 0x03, 0xFF, 0x08, 0x10, 0x08, 0x0F,
+    0x38, 0x06, 0x0C, 0x70, 0x40, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x05,
+    0x0A, 0x69, 0x49, 0x92, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0, 0x0A, 0x04, 0x09, 0x89, 0x79,
+    0x0F, 0x23, 0x04, 0xCD, 0x38, 0x78, 0x84, 0x03, 0x01, 0x01, 0x15, 0x05, 0x38, 0x06, 0x0C, 0x70,
+    0x40, 0x05, 0x03, 0xFC, 0x14, 0x1C, 0x0C, 0x08, 0x09, 0x89, 0x79, 0x0F, 0x02, 0x72, 0x8A, 0x8E,
+    0x06, 0x0B, 0x38, 0x08, 0x8E, 0x78, 0x80, 0x84, 0xFD, 0x84, 0x80, 0x42, 0x42, 0x09, 0x0A, 0xC0,
+    0xB1, 0x8C, 0xC0, 0x00, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x1D, 0x05, 0x08, 0x08, 0xF8, 0x08, 0x08,
+    0x19, 0x04, 0x82, 0x62, 0x3E, 0xC4, 0x06, 0x05, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x0A, 0x09, 0xF9,
+    0x64, 0x14, 0xF8, 0x00, 0x08, 0x3E, 0xFE, 0x08, 0x06, 0x0A, 0xD3, 0x92, 0x24, 0x00, 0xF8, 0x28,
+    0x28, 0x28, 0x00, 0xF0, 0x0A, 0x08, 0xE0, 0x18, 0x31, 0xC0, 0x00, 0x10, 0xF0, 0x10, 0x1F, 0x03,
+    0x90, 0x51, 0x30, 0x1A, 0x04, 0x49, 0xF0, 0xE0, 0x31, 0x05, 0x05, 0x08, 0x88, 0xEE, 0x59, 0x80,
+    0x0C, 0x09, 0xFD, 0x01, 0xC0, 0x00, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x05, 0x0A, 0x10, 0xF0, 0x11,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0xFC, 0x11, 0x0A, 0x0A, 0x48, 0x48, 0x90, 0x01, 0x01, 0x52, 0x53,
+    0xF2, 0x48, 0x40, 0x1D, 0x04, 0xE3, 0x12, 0x12, 0xE0, 0x19, 0x03, 0xC0, 0x33, 0x04, 0x06, 0x05,
+    0x41, 0x40, 0xF7, 0x40, 0x01, 0x0B, 0x08, 0x96, 0xE3, 0xC1, 0x60, 0x00, 0x00, 0x06, 0x01, 0x07,
+    0x03, 0x22, 0xC3, 0xFA, 0x05, 0x02, 0xC3, 0x3E, 0x0A, 0x09, 0x03, 0x02, 0x04, 0x00, 0x10, 0x10,
+    0xDC, 0xD3, 0x30, 0x07, 0x01, 0xF0, 0x03, 0x04, 0x20, 0x20, 0x20, 0xE0, 0x04, 0x05, 0x10, 0x10,
+    0xD0, 0xD0, 0x30, 0x06, 0x04, 0xE0, 0x23, 0x25, 0xE4, 0x18, 0x05, 0x03, 0x82, 0x42, 0x27, 0xC0,
+    0x05, 0x05, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x0B, 0x03, 0xC0, 0x87, 0xC9, 0x0C, 0x04, 0x96, 0x91,
+    0x91, 0xF0, 0x05, 0x01, 0x08, 0x05, 0x03, 0xC0, 0x80, 0xC0, 0x07, 0x04, 0xF8, 0x07, 0x00, 0xF0,
+    0x06, 0x08, 0x58, 0x8F, 0xF4, 0x03, 0x00, 0x88, 0x64, 0x03, 0x06, 0x04, 0x58, 0xFF, 0x20, 0x20,
+    0x06, 0x04, 0x46, 0xF9, 0xF9, 0x4F, 0x10, 0x04, 0x10, 0x10, 0xF0, 0x20, 0x04, 0x0F, 0x40, 0x4F,
+    0xC0, 0x40, 0x41, 0x06, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x00, 0x10, 0xFC, 0x03, 0x0A, 0x05, 0xE0,
+    0x31, 0x3C, 0x23, 0xE0, 0x0A, 0x04, 0xF0, 0x90, 0x08, 0x07, 0x0C, 0x04, 0xB1, 0x4C, 0x03, 0x80,
+    0x06, 0x04, 0x50, 0x88, 0x07, 0x80, 0x06, 0x09, 0x4C, 0x43, 0x43, 0xC0, 0x06, 0x25, 0x24, 0x2E,
+    0x20, 0x05, 0x0E, 0x82, 0x81, 0xFF, 0x81, 0xE1, 0x80, 0x80, 0x80, 0x00, 0x00, 0x50, 0x89, 0x07,
+    0x80, 0x06, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x04, 0x0D, 0x40,
+    0x40, 0xCF, 0x40, 0x40, 0x00, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x0C, 0x03, 0x0C, 0x05, 0x01, 0x40,
+    0x50, 0xCC, 0x23, 0x0A, 0x03, 0x0F, 0x00, 0x01, 0x0D, 0x04, 0x11, 0xC8, 0x44, 0x03, 0x05, 0x05,
+    0x80, 0x82, 0x9F, 0xA7, 0x81, 0x06, 0x0A, 0x50, 0x48, 0x46, 0x01, 0x00, 0x01, 0xA1, 0x1F, 0x01,
+    0x01, 0x04, 0x0E, 0x80, 0xB0, 0x8F, 0x40, 0x1F, 0x50, 0x50, 0x50, 0x00, 0x00, 0x82, 0x9F, 0xA7,
+    0x81, 0x05, 0x05, 0x90, 0x90, 0xFF, 0x90, 0x10, 0x05, 0x04, 0x20, 0x18, 0xD7, 0x1F, 0x05, 0x0A,
+    0x08, 0x08, 0x0F, 0x08, 0x08, 0x00, 0x63, 0x5F, 0x40, 0xC0, 0x10, 0x05, 0x01, 0x31, 0xEF, 0x01,
+    0x01, 0x0A, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x05, 0x98, 0x97, 0x10, 0x1C, 0x20, 0x04, 0x05,
+    0x10, 0x10, 0xDF, 0x10, 0x10, 0x06, 0x08, 0x02, 0x42, 0x32, 0x0E, 0x32, 0x4A, 0x7F, 0x02, 0x06,
+    0x0E, 0x02, 0x62, 0x1F, 0x02, 0x02, 0x82, 0xC2, 0xB2, 0x0E, 0x00, 0x10, 0x10, 0x10, 0x10, 0x05,
+    0x05, 0x10, 0x08, 0x7E, 0x05, 0x18, 0x06, 0x04, 0x60, 0x3F, 0x10, 0x0C, 0x0A, 0x04, 0x31, 0x8A,
+    0x0F, 0x10, 0x0F, 0x06, 0x80, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0x0A, 0x04, 0xBF, 0x25, 0x25, 0x25,
+    0x0B, 0x03, 0x34, 0x24, 0x49, 0x07, 0x12, 0x8E, 0x6D, 0x3F, 0x01, 0x00, 0x7E, 0x1C, 0x0C, 0x7E,
+    0x06, 0x03, 0x7F, 0x80, 0x00, 0x64, 0x94, 0xFF, 0x04, 0x06, 0x09, 0x72, 0x4A, 0x46, 0x00, 0x00,
+    0x04, 0x84, 0x64, 0x1C, 0x0B, 0x05, 0x1C, 0x03, 0x06, 0x38, 0x20, 0x05, 0x04, 0x66, 0x1C, 0xBC,
+    0x42, 0x0A, 0x04, 0x87, 0x43, 0x30, 0x0F, 0x0F, 0x03, 0x7F, 0x04, 0x08, 0x0D, 0x04, 0x7F, 0x20,
+    0x30, 0x0C, 0x0B, 0x04, 0x7C, 0x82, 0x82, 0x7C, 0x05, 0x14, 0x80, 0x84, 0xFC, 0x84, 0x80, 0x00,
+    0xFE, 0x42, 0xFE, 0x00, 0x00, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x82, 0xC2, 0x32, 0x0E, 0x04, 0x0A,
+    0x42, 0x42, 0x42, 0xFE, 0x00, 0x01, 0x81, 0x7D, 0x0D, 0x03, 0x0B, 0x03, 0xFC, 0x14, 0x1C, 0x07,
+    0x05, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x09, 0x05, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x2D, 0x05, 0x04,
+    0x84, 0x7F, 0x04, 0x04, 0x05, 0x13, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x04, 0xF4, 0x1C, 0x04, 0x42,
+    0x42, 0x7E, 0x43, 0x42, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0x05, 0x09, 0xFC, 0x94, 0x94, 0x94, 0x04,
+    0x05, 0xFC, 0x04, 0x04, 0x0B, 0x04, 0x08, 0xFF, 0xA4, 0x9C, 0x06, 0x04, 0x0E, 0x87, 0x61, 0x1E,
+    0x0A, 0x05, 0x04, 0x85, 0x7F, 0x04, 0x04, 0x2C, 0x05, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x0B, 0x0E,
+    0xF9, 0x28, 0x28, 0x28, 0x00, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x38, 0xB7, 0xFC, 0x04, 0x04, 0x0A,
+    0x10, 0x14, 0xFC, 0x14, 0x14, 0x00, 0x00, 0xFE, 0x80, 0x60, 0x0B, 0x04, 0x38, 0xB7, 0xFC, 0x04,
+    0x06, 0x05, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x09, 0x03, 0x08, 0xF9, 0x08, 0x06, 0x05, 0x08, 0x08,
+    0xF8, 0x08, 0x08, 0x24, 0x04, 0x08, 0x0A, 0x09, 0x08, 0x0B, 0x0E, 0xB9, 0x49, 0x49, 0xF9, 0x00,
+    0x10, 0xD3, 0x70, 0x10, 0x00, 0x0A, 0x09, 0x08, 0x08, 0x05, 0x09, 0x30, 0xE1, 0xE1, 0x11, 0x00,
+    0x07, 0xC5, 0x7C, 0x88, 0x0B, 0x04, 0xE2, 0x91, 0xF0, 0x80, 0x06, 0x05, 0x28, 0x2B, 0xF8, 0x24,
+    0x20, 0x08, 0x05, 0x61, 0x1F, 0x11, 0xF1, 0x11, 0x05, 0x03, 0xFC, 0x20, 0x41, 0x26, 0x04, 0x11,
+    0x11, 0xF1, 0x01, 0x0B, 0x0E, 0x21, 0xA2, 0x62, 0x03, 0x00, 0x04, 0xFB, 0x00, 0x80, 0x00, 0xC1,
+    0x31, 0x01, 0x01, 0x04, 0x0A, 0x10, 0x13, 0xF0, 0x11, 0x12, 0x00, 0xFB, 0x00, 0x00, 0xC3, 0x06,
+    0x09, 0xE0, 0xDC, 0xF0, 0x10, 0x00, 0x0B, 0x88, 0xF8, 0x13, 0x05, 0x05, 0x10, 0x10, 0xF6, 0x11,
+    0x10, 0x09, 0x05, 0x20, 0x24, 0xE3, 0x20, 0x20, 0x05, 0x06, 0x03, 0x20, 0xFC, 0x90, 0x90, 0x80,
+    0x00, 0x00, 0x00, 0x7F, 0x01, 0x8D, 0x0A, 0x04, 0x7C, 0x82, 0x82, 0x7C, 0x7C, 0x01, 0xB0, 0xC3,
+    0x04, 0x39, 0x48, 0x98, 0x01, 0x28, 0x04, 0xF1, 0xE1, 0x61, 0xF1, 0x4F, 0x04, 0x02, 0xC2, 0x32,
+    0x03, 0x1C, 0x03, 0xFE, 0x09, 0x80, 0x0A, 0x04, 0x03, 0x00, 0x00, 0x03, 0x0C, 0x04, 0x53, 0x92,
+    0xD4, 0x30, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x09, 0x3F, 0x29, 0xE0, 0x00, 0x03,
+    0x02, 0x02, 0x03, 0x04, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x02, 0x03, 0x04, 0x19,
+    0x02, 0x40, 0xF8, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x02, 0x38, 0x27, 0x1B, 0x03, 0xA0, 0x40, 0x00, 0x3D, 0x04, 0x80, 0xF0, 0x80, 0x00, 0x0A,
+    0x05, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x80, 0x81, 0x80, 0x15, 0x01, 0x00, 0x03, 0x01,
+    0x01, 0x3B, 0x04, 0x88, 0x8F, 0x88, 0x88, 0x24, 0x04, 0x1C, 0x12, 0x11, 0x00, 0x14, 0x05, 0x00,
+    0x20, 0xE8, 0x38, 0x27, 0x3A, 0x05, 0x02, 0x02, 0x3F, 0x22, 0x22, 0x24, 0x04, 0xA2, 0x22, 0x3E,
+    0x20, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x03, 0x7E, 0x0A, 0x0E, 0xB2, 0x04, 0x80, 0x8E,
+    0x92, 0xE6, 0x2E, 0x05, 0x00, 0x04, 0x9F, 0x7F, 0x04, 0x72, 0x04, 0xDC, 0x24, 0x24, 0xFC, 0x06,
+    0x01, 0x15, 0x03, 0x05, 0xFE, 0x08, 0x09, 0x08, 0x00, 0x18, 0x05, 0x10, 0x14, 0xFC, 0x14, 0x14,
+    0x45, 0x03, 0x08, 0x08, 0xFA, 0x09, 0x03, 0x01, 0x01, 0x01, 0x0A, 0x04, 0x01, 0x09, 0x09, 0x09,
+    0x1A, 0x04, 0xE0, 0x91, 0xF1, 0x81, 0x45, 0x01, 0x01, 0x31, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0x48, 0x48, 0xC3, 0x00, 0x00, 0x00, 0x2C, 0x05, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0x7C, 0x02,
+    0x01, 0x01, 0x07, 0x04, 0xC5, 0x29, 0x3D, 0x43, 0x27, 0x03, 0x0C, 0x06, 0xFE, 0x25, 0x04, 0x00,
+    0x10, 0x10, 0xF0, 0x7C, 0x05, 0x20, 0xA1, 0xF9, 0x21, 0x01, 0x7B, 0x06, 0x03, 0x4C, 0x4F, 0x90,
+    0x00, 0x00, 0xF0, 0x01, 0x28, 0x75, 0x05, 0x80, 0xB0, 0xE8, 0xA7, 0xA0, 0x04, 0x02, 0x04, 0x04,
+    0x2B, 0x04, 0x81, 0x00, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x05, 0x00, 0x80,
+    0x8F, 0x88, 0x08, 0x31, 0x04, 0x00, 0x40, 0x40, 0x40, 0x15, 0x04, 0x00, 0x00, 0xC0, 0x00, 0xFF,
+    0x00, 0x47, 0x05, 0x00, 0x82, 0xA2, 0xE2, 0x9C, 0xFF, 0x00, 0x4A, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7D, 0x01, 0x40, 0x00, 0x00, 0x00, 0xD8, 0x03, 0xC0, 0x30, 0x0F, 0x33, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x67, 0x05, 0x40, 0x53, 0xF0, 0x50, 0x53, 0x1C, 0x01, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x03, 0x43, 0x82, 0xF2, 0x0C, 0x03, 0x07, 0x04, 0x04, 0x0C,
+    0x04, 0xEC, 0x72, 0x03, 0xE4, 0x0B, 0x08, 0x40, 0x80, 0xF0, 0x00, 0x00, 0x80, 0x60, 0x00, 0x4B,
+    0x03, 0x0C, 0x03, 0x03, 0x06, 0x05, 0x00, 0xD0, 0x88, 0x87, 0xC0, 0x0B, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x08, 0x06, 0x01, 0x2D, 0x03, 0x00, 0x00, 0x00, 0x15, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x2C, 0x23, 0xE0, 0x1B, 0x04, 0x0F, 0x83, 0x81, 0x0F, 0x0B, 0x04, 0x00, 0xC0, 0x40,
+    0x00, 0x28, 0x04, 0x02, 0x1F, 0x27, 0x01, 0x05, 0x05, 0x80, 0x80, 0xE0, 0x80, 0x00, 0x07, 0x01,
+    0x00, 0x0C, 0x08, 0x40, 0x40, 0x40, 0xC0, 0x11, 0x11, 0x11, 0x1F, 0x1B, 0x04, 0x9F, 0x84, 0x87,
+    0x1C, 0x37, 0x04, 0x41, 0x3D, 0x07, 0x01, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x05, 0x10,
+    0x90, 0x10, 0x1F, 0x10, 0xB7, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x41, 0x04, 0x7C, 0x82, 0x82, 0x7C,
+    0x37, 0x01, 0x01, 0x35, 0x04, 0x7C, 0x82, 0x82, 0x7C, 0x32, 0x05, 0x10, 0xFE, 0x81, 0xC0, 0x30,
+    0x0A, 0x05, 0x10, 0x7E, 0x88, 0x3C, 0x08, 0x6C, 0x04, 0x00, 0x09, 0x08, 0x08, 0x0B, 0x03, 0x04,
+    0xC4, 0x7F, 0x16, 0x05, 0x24, 0x27, 0xE4, 0x3C, 0x00, 0x7B, 0x02, 0x14, 0xF2, 0x00, 0x00, 0x00,
+    0xAC, 0x04, 0x88, 0x89, 0xF9, 0x80, 0x5B, 0x04, 0x7E, 0x88, 0x3C, 0x08, 0x52, 0x04, 0xC0, 0xB0,
+    0x8C, 0xC0, 0x25, 0x04, 0xA0, 0xF8, 0x23, 0x00, 0x23, 0x04, 0x38, 0x1D, 0x80, 0x78, 0x2F, 0x01,
+    0x01, 0x07, 0x05, 0x3E, 0x01, 0xC0, 0x3C, 0x00, 0x40, 0x03, 0xE4, 0x12, 0x11, 0x38, 0x04, 0x14,
+    0x12, 0x11, 0x10, 0x7C, 0x05, 0x42, 0x82, 0xF2, 0x02, 0x00, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0x03, 0xD0, 0xAC, 0x23, 0x0A, 0x05, 0x00, 0x31, 0x28, 0xE7, 0x00, 0x3C, 0x05, 0x80, 0x80,
+    0xE0, 0x80, 0x80, 0x2C, 0x04, 0x27, 0x28, 0xE8, 0x07, 0x0A, 0x05, 0x04, 0x44, 0x44, 0xC7, 0x24,
+    0x41, 0x03, 0x00, 0x00, 0x00, 0x7D, 0x04, 0x80, 0x80, 0x80, 0x00, 0x6B, 0x01, 0x00, 0x29, 0x04,
+    0x00, 0x00, 0x80, 0x00, 0x04, 0x05, 0x04, 0x05, 0x7F, 0x45, 0x45, 0x42, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x10, 0xFC, 0x03, 0x00, 0xFF, 0x00, 0x36, 0x05, 0xE8, 0x09, 0xFF, 0xE8, 0x08,
+    0x36, 0x04, 0xE0, 0x20, 0x39, 0xE1, 0x07, 0x05, 0x24, 0x27, 0xE4, 0x24, 0x20, 0x34, 0x06, 0x60,
+    0x1E, 0x10, 0xF3, 0x11, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x30, 0x03, 0x04, 0x02, 0x01, 0x07,
+    0x03, 0x00, 0xFC, 0x03, 0x10, 0x04, 0x43, 0xF8, 0x20, 0xE3, 0x2C, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x05, 0x8D, 0x42, 0x20, 0x1C, 0x00, 0x2C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03,
+    0x00, 0x00, 0x00, 0xBD, 0x05, 0x04, 0xC4, 0x34, 0x0C, 0x04, 0x30, 0x05, 0x80, 0x84, 0x84, 0xFC,
+    0x80, 0x09, 0x05, 0x04, 0xE4, 0x14, 0x1C, 0x00, 0x39, 0x01, 0x01, 0x34, 0x02, 0x3C, 0x00, 0x0C,
+    0x04, 0xF0, 0xE1, 0x61, 0xF0, 0xD0, 0x04, 0xC2, 0x82, 0xC7, 0x00, 0x24, 0x08, 0x86, 0x41, 0xC1,
+    0x00, 0x80, 0x87, 0x84, 0x84, 0x50, 0x05, 0x51, 0xCC, 0x43, 0x40, 0x00, 0x19, 0x02, 0x8C, 0x63,
+    0x08, 0x04, 0xCF, 0x82, 0x83, 0xCE, 0x05, 0x01, 0x84, 0x0A, 0x03, 0x90, 0x08, 0x86, 0x5E, 0x04,
+    0x06, 0x05, 0x04, 0x0E, 0x0F, 0x02, 0x06, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x23, 0x19,
+    0x07, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x05, 0x80, 0x80, 0x00, 0x00, 0x00, 0x49, 0x04,
+    0x00, 0x80, 0x00, 0x00, 0x1F, 0x01, 0x10, 0x50, 0x01, 0x00, 0x2E, 0x04, 0x4A, 0x4A, 0x7E, 0x00,
+    0x4B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x04, 0x38, 0x08, 0x8E, 0x78, 0x47, 0x05, 0x09,
+    0x3F, 0xC4, 0x1E, 0x04, 0x11, 0x01, 0x60, 0x1F, 0x01, 0x7D, 0x4B, 0x01, 0x01, 0x32, 0x05, 0x84,
+    0x84, 0xFC, 0x84, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2D, 0x03, 0x28, 0x28, 0xF8, 0x60, 0x03,
+    0x00, 0x00, 0x00, 0x1A, 0x03, 0x01, 0x01, 0x01, 0x33, 0x05, 0x28, 0x28, 0xF9, 0x24, 0x20, 0x28,
+    0x03, 0x50, 0x50, 0xF0, 0x45, 0x05, 0x01, 0x78, 0x07, 0x80, 0x79, 0x07, 0x02, 0x06, 0x01, 0x72,
+    0x04, 0x00, 0x98, 0x94, 0x93, 0x2F, 0x04, 0x9C, 0x92, 0x93, 0x84, 0x0B, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0x06, 0x00, 0xD1, 0x0C, 0x83, 0x40, 0x40, 0x37, 0x04, 0x80, 0x10,
+    0x8C, 0x03, 0x0B, 0x08, 0x40, 0x40, 0x40, 0xC0, 0x00, 0x20, 0x20, 0x20, 0x2D, 0x05, 0x4F, 0xC3,
+    0x44, 0x48, 0x08, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x04, 0x91, 0x91, 0x9F, 0x40, 0x50,
+    0x03, 0x00, 0x00, 0x00, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x05, 0x02, 0x62, 0x1F,
+    0x02, 0x02, 0x4F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0xFF, 0x08, 0x10, 0x00, 0x00, 0xA8,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x04, 0x89, 0x89, 0x89, 0xFF, 0x4C, 0x01, 0x08, 0x53, 0x05,
+    0xF0, 0x53, 0x70, 0x00, 0x00, 0x66, 0x05, 0x41, 0x51, 0xF1, 0x51, 0x51, 0x10, 0x03, 0x03, 0xF8,
+    0x00, 0x41, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x00,
+    0x7D, 0x01, 0xCC, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x83, 0x05, 0x08, 0xC8,
+    0x28, 0x38, 0x00, 0x5E, 0x05, 0xE2, 0x82, 0x43, 0x20, 0x20, 0x19, 0x03, 0x11, 0x12, 0x12, 0x0A,
+    0x07, 0x00, 0x23, 0xA0, 0xE0, 0x23, 0x03, 0xE2, 0x4D, 0x06, 0x00, 0xC7, 0x81, 0xC2, 0x04, 0x04,
+    0x27, 0x04, 0x88, 0x87, 0x80, 0x80, 0x7D, 0x02, 0x80, 0x60, 0x2A, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x45, 0x44, 0xCE, 0x20, 0x0A, 0x02, 0x03, 0x1F, 0x0F, 0x03, 0xF9, 0x87, 0x80,
+    0x1A, 0x02, 0x80, 0x80, 0x08, 0x01, 0x9F, 0x39, 0x05, 0x01, 0x31, 0x0F, 0x01, 0x01, 0x14, 0x02,
+    0x00, 0x00, 0x03, 0x07, 0x47, 0x20, 0x1C, 0x03, 0x00, 0x20, 0x28, 0x1F, 0x05, 0x32, 0x4A, 0x7F,
+    0x02, 0x00, 0x1F, 0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x08, 0x03, 0x64, 0x1E, 0x00, 0x40,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x77, 0x05, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x3C, 0x09, 0x82, 0x42,
+    0x32, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x1C, 0x04, 0x10, 0xFE, 0x49, 0x38,
+    0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x04, 0x90, 0x51, 0x31, 0x01, 0x07, 0x03, 0x01,
+    0x01, 0x01, 0x11, 0x01, 0x24, 0x20, 0x04, 0x1C, 0x00, 0x80, 0x70, 0x24, 0x03, 0x24, 0xE2, 0x21,
+    0x07, 0x04, 0xE3, 0xC0, 0xC0, 0xE0, 0x0B, 0x03, 0xF2, 0x12, 0x10, 0x3C, 0x02, 0x02, 0x01, 0x00,
+    0x00, 0x00, 0xF5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x72, 0x05, 0x00, 0xF8, 0x70, 0x30, 0xF8, 0x06,
+    0x01, 0xD2, 0x35, 0x04, 0xE1, 0x91, 0xF1, 0x80, 0x05, 0x05, 0x08, 0x08, 0xF9, 0x08, 0x08, 0x32,
+    0x04, 0xC9, 0x28, 0x38, 0x01, 0x0A, 0x04, 0xE0, 0x11, 0x09, 0x70, 0x2E, 0x04, 0x03, 0x00, 0x00,
+    0x03, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1E, 0x04, 0x00, 0x87, 0xE0, 0x19, 0x07, 0x03,
+    0xFE, 0x09, 0x80, 0x17, 0x01, 0x20, 0x5A, 0x03, 0x91, 0x90, 0x9F, 0x07, 0x05, 0x03, 0x02, 0x02,
+    0x03, 0x04, 0x4A, 0x04, 0x86, 0xF9, 0x49, 0xCF, 0x7C, 0x04, 0x40, 0x8F, 0x0A, 0x89, 0xCA, 0x01,
+    0x1F, 0x4E, 0x03, 0x82, 0xBF, 0xA2, 0x7C, 0x05, 0x00, 0x60, 0x18, 0x0F, 0x71, 0x24, 0x03, 0x42,
+    0x7E, 0x42, 0x32, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x04, 0x71, 0x04, 0x1C, 0x0F,
+    0xC0, 0x3C, 0x7C, 0x02, 0x0A, 0x09, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0x10, 0xF0,
+    0x10, 0x00, 0x00, 0x00, 0x4E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0x05, 0x38, 0x06, 0x0C, 0x70,
+    0x40, 0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x46, 0x01, 0xFC, 0x3A, 0x05, 0x0E, 0x80, 0x40, 0x38,
+    0x00, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x02, 0x09, 0xF8, 0x30, 0x02, 0xFC, 0x00, 0x25,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xD0, 0xD0, 0x3C, 0x03, 0x87, 0x81, 0x82, 0x1B,
+    0x04, 0x82, 0xF2, 0x42, 0xC2, 0x1A, 0x04, 0x8C, 0x62, 0xC3, 0x04, 0x40, 0x04, 0xC8, 0x08, 0x8F,
+    0x48, 0x1A, 0x04, 0x80, 0x6F, 0x0A, 0x09, 0x1A, 0x05, 0x83, 0x00, 0x80, 0x07, 0x04, 0x0A, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x05, 0x00, 0xEF, 0x03, 0x04, 0x88,
+    0x28, 0x03, 0x83, 0x9F, 0x80, 0x1C, 0x0A, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x2A, 0x05, 0x00, 0x90, 0x88, 0x84, 0x83, 0x1A, 0x05, 0x81, 0xB1, 0x8F, 0x81, 0x81, 0x09,
+    0x03, 0x1C, 0x12, 0x11, 0x34, 0x04, 0xCA, 0xFF, 0x82, 0x80, 0x38, 0x03, 0x38, 0x06, 0x01, 0x19,
+    0x04, 0x40, 0x47, 0x49, 0x73, 0x24, 0x04, 0x62, 0x14, 0x1E, 0x21, 0x06, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x05, 0x40, 0x42, 0x7E, 0x42, 0x40, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x05, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x3F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0x43,
+    0x43, 0x01, 0x84, 0xA1, 0x04, 0x24, 0x64, 0xE4, 0x1C, 0x37, 0x03, 0x10, 0xF1, 0x11, 0x44, 0x01,
+    0x01, 0x38, 0x03, 0x02, 0x03, 0x02, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x22,
+    0xE1, 0x20, 0x00, 0x00, 0x00, 0x2D, 0x01, 0xB4, 0x7D, 0x05, 0x04, 0xC4, 0xBF, 0xFD, 0x00, 0x7B,
+    0x01, 0x01, 0xCE, 0x06, 0x08, 0x89, 0x89, 0x70, 0x00, 0xF9, 0x09, 0x04, 0x23, 0x24, 0xFF, 0xE0,
+    0x1F, 0x04, 0x83, 0x60, 0x50, 0x93, 0x4A, 0x06, 0x22, 0xA2, 0xE3, 0x22, 0x00, 0xE3, 0x09, 0x04,
+    0x08, 0x56, 0x95, 0xD7, 0x1F, 0x04, 0x03, 0x04, 0x04, 0x03, 0x34, 0x01, 0xF2, 0x7D, 0x02, 0x0C,
+    0x03, 0x6A, 0x01, 0x8F, 0x58, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x04, 0x9F, 0x87, 0x83, 0x9F,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x9B, 0xA4, 0xA4, 0x3F, 0xFF, 0x00,
+    0x5A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x31, 0xF8, 0x06, 0x00, 0x00, 0x18, 0x04, 0x82,
+    0xA2, 0xE2, 0x9C, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0xFF, 0x48, 0x60, 0x04, 0xB8,
+    0x48, 0x48, 0xF8, 0x06, 0x04, 0x3A, 0x49, 0x98, 0x00, 0x45, 0x04, 0x80, 0x7C, 0x04, 0xC0, 0x32,
+    0x05, 0x02, 0xC2, 0x32, 0x03, 0x00, 0x45, 0x05, 0x21, 0xE1, 0x21, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x2C, 0x05, 0x20, 0x90, 0xFC, 0x03, 0x00, 0x3F, 0x04, 0xFF, 0x84, 0x84, 0x84, 0x6D, 0x04, 0xFF,
+    0x84, 0x84, 0x84, 0x4B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x00, 0x39,
+    0x01, 0x1C, 0x35, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x01, 0x10, 0x3D, 0x03, 0xE1, 0x41, 0xE1, 0x2E,
+    0x03, 0x90, 0xE0, 0xC0, 0x0F, 0x05, 0x48, 0x4A, 0x4A, 0xFB, 0x02, 0x38, 0x03, 0x08, 0x06, 0x01,
+    0x40, 0x07, 0x04, 0x84, 0x84, 0x87, 0x80, 0x00, 0xC8, 0x7E, 0x02, 0x00, 0x8F, 0x57, 0x04, 0x00,
+    0x07, 0xC8, 0x88, 0x1B, 0x03, 0x2F, 0x23, 0x21, 0x5E, 0x06, 0x00, 0x87, 0x80, 0x81, 0x4E, 0x08,
+    0x19, 0x04, 0x81, 0xA1, 0x99, 0x07, 0x73, 0x02, 0xB8, 0x86, 0x0A, 0x07, 0x11, 0x01, 0x3F, 0x01,
+    0x01, 0x00, 0x1D, 0x6C, 0x05, 0x30, 0x2F, 0x20, 0x38, 0x40, 0x05, 0x04, 0x38, 0x46, 0x45, 0x39,
+    0x10, 0x04, 0x09, 0x09, 0xC9, 0x38, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x09, 0xFF, 0xA4, 0x9C, 0x69, 0x01, 0x08, 0x43,
+    0x04, 0xFC, 0x20, 0x43, 0x00, 0x7C, 0x02, 0x03, 0xE0, 0x18, 0x03, 0x83, 0xE2, 0x18, 0x00, 0x00,
+    0x00, 0xCE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x09, 0xC9, 0x38, 0x7D,
+    0x01, 0x8D, 0xA5, 0x05, 0x03, 0x04, 0xFF, 0x08, 0x80, 0x7B, 0x0A, 0x00, 0x53, 0x92, 0xD2, 0x33,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0xC3, 0xBC, 0xE4, 0x23, 0x4A, 0x04, 0x24, 0x24, 0x27,
+    0xE0, 0x11, 0x02, 0xF0, 0x00, 0x1B, 0x03, 0x11, 0x0D, 0x07, 0x33, 0x03, 0xCC, 0x83, 0xC0, 0x15,
+    0x04, 0x28, 0x24, 0x23, 0xE0, 0x64, 0x03, 0x11, 0x0C, 0x03, 0x14, 0x04, 0x4F, 0x41, 0x43, 0xCF,
+    0x1C, 0x03, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x5A, 0x02, 0x0E, 0x11, 0x1D, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x05, 0x04, 0x84, 0x7C, 0x04, 0x04, 0x58, 0x06, 0x60,
+    0x58, 0x46, 0xE0, 0x00, 0x00, 0x27, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x1F, 0xFF, 0x36, 0x01,
+    0x42, 0x47, 0x01, 0x01, 0x40, 0x05, 0x11, 0xFE, 0x48, 0x38, 0x00, 0x0E, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x69, 0x03, 0x41, 0x01, 0x01, 0x11, 0x01, 0x7C, 0x46, 0x04, 0x10, 0x10, 0xFE, 0xF1,
+    0x42, 0x05, 0x53, 0x50, 0xF0, 0x4B, 0x40, 0x35, 0x04, 0x04, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0xE2, 0x04, 0x70, 0x8C, 0x8A, 0x72, 0x0B, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x41, 0x04, 0x80, 0x60,
+    0x1E, 0x00, 0x29, 0x01, 0x8C, 0x0D, 0x01, 0x01, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03,
+    0xE0, 0x10, 0x10, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0x38, 0x20, 0x13, 0x01, 0xC0,
+    0x7D, 0x05, 0x2A, 0x2E, 0xE9, 0x00, 0x9F, 0x7E, 0x02, 0x00, 0x06, 0xFB, 0x02, 0xBF, 0x81, 0x2A,
+    0x03, 0x00, 0x00, 0x00, 0x50, 0x05, 0x30, 0x2F, 0x20, 0x38, 0x40, 0x6D, 0x04, 0x04, 0x9F, 0x7F,
+    0x04, 0x19, 0x05, 0x01, 0x81, 0x7D, 0x0D, 0x03, 0x5E, 0x01, 0x01, 0x17, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x43, 0x0A, 0x82, 0x62, 0x3E, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0x02, 0xF8, 0x08, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0x01, 0x00, 0x00, 0x01,
+    0x03, 0x03, 0xF0, 0x10, 0x00, 0x3C, 0x09, 0x20, 0xA0, 0x60, 0x00, 0x23, 0x20, 0xE0, 0x20, 0x20,
+    0x4A, 0x04, 0x91, 0x91, 0x91, 0x71, 0x00, 0x00, 0x00, 0x14, 0x04, 0xCC, 0x38, 0x78, 0x84, 0x3F,
+    0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x7D, 0x08, 0x20, 0xC0, 0xF8,
+    0x00, 0x4A, 0x4A, 0x4B, 0xC2, 0x38, 0x04, 0x48, 0x46, 0xC1, 0x40, 0x3F, 0x05, 0x00, 0x20, 0x28,
+    0x26, 0xC1, 0x2E, 0x03, 0xF1, 0x2D, 0xE7, 0x07, 0x03, 0x10, 0x0F, 0x01, 0x73, 0x03, 0x0F, 0x04,
+    0x0F, 0x29, 0x04, 0x47, 0xC8, 0x48, 0x47, 0x05, 0x04, 0x40, 0x51, 0x7C, 0xC3, 0x72, 0x06, 0x01,
+    0x81, 0x9F, 0x91, 0x51, 0x00, 0x04, 0x05, 0x08, 0x04, 0x3F, 0x02, 0x0C, 0x98, 0x01, 0x80, 0x7F,
+    0x02, 0x7F, 0x04, 0x0A, 0x04, 0xF8, 0x24, 0x3C, 0xE0, 0x58, 0x05, 0x00, 0xCC, 0x38, 0x78, 0x84,
+    0x7C, 0x01, 0x08, 0xA6, 0x05, 0x20, 0x28, 0xF9, 0x29, 0x29, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0x04, 0x20, 0xE3, 0x22, 0x02, 0x19, 0x04, 0x40, 0xF8, 0x20, 0xE0, 0x00, 0x00, 0x00, 0x0A,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x7C, 0x01, 0x8D, 0x6A,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x84, 0x64, 0x1C, 0x59, 0x04, 0x38, 0x48, 0x98,
+    0x00, 0x1F, 0x01, 0x01, 0x18, 0x04, 0xE4, 0x17, 0x10, 0xE0, 0x23, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x81, 0x61, 0x51, 0x91, 0x50, 0x05, 0x50, 0x93, 0xD5, 0x34, 0x00, 0x23, 0x08, 0x20, 0x20,
+    0xE0, 0x00, 0x43, 0x44, 0xC4, 0x43, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0x03, 0x20, 0x20, 0xE0, 0x10, 0x04, 0x48, 0xFA, 0xCE, 0x09, 0x11, 0x03, 0x40,
+    0x80, 0x00, 0x67, 0x03, 0x5F, 0x4C, 0x4B, 0x6F, 0x01, 0x81, 0x03, 0x02, 0x01, 0x01, 0x05, 0x03,
+    0x01, 0x21, 0x19, 0x38, 0x04, 0x4A, 0x7F, 0x02, 0x00, 0x36, 0x05, 0x11, 0x10, 0x90, 0xBF, 0x00,
+    0x05, 0x05, 0x00, 0x25, 0x25, 0x3F, 0x01, 0x1E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x06, 0x21, 0x21, 0x21, 0x7F, 0x00, 0x00, 0x44, 0x01, 0xB0, 0x7F, 0x04, 0x07,
+    0xC4, 0x3C, 0x04, 0x32, 0x04, 0x00, 0x69, 0x49, 0x92, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x05, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x0F, 0x05, 0x09, 0x3F, 0xC4, 0x1E, 0x04, 0x09, 0x01, 0x01,
+    0x0F, 0x04, 0xE1, 0x18, 0x14, 0xE4, 0x24, 0x01, 0xFE, 0x26, 0x01, 0x01, 0x14, 0x01, 0x01, 0x15,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0xFC, 0x10, 0x11, 0x11, 0x01,
+    0x3F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x05, 0xE0, 0x20, 0x38, 0xE0, 0x00, 0x19, 0x05,
+    0x40, 0x50, 0xF0, 0x50, 0x50, 0x05, 0x05, 0x03, 0x22, 0xE2, 0x22, 0x00, 0x40, 0x02, 0x20, 0xE0,
+    0x12, 0x05, 0x94, 0x92, 0x91, 0x70, 0x00, 0x0A, 0x04, 0x3B, 0x02, 0x03, 0xE0, 0x00, 0x00, 0x00,
+    0x21, 0x05, 0x80, 0x84, 0xFC, 0x84, 0x80, 0x06, 0x04, 0xE4, 0x94, 0x8C, 0x00, 0x7E, 0x01, 0xFC,
+    0xFF, 0x00, 0xFF, 0x00, 0xDE, 0x03, 0x40, 0x40, 0x87, 0x1E, 0x04, 0x4F, 0x84, 0x0F, 0x80, 0x5A,
+    0x04, 0x03, 0xEC, 0x94, 0x93, 0x1E, 0x04, 0x02, 0x1F, 0x27, 0x01, 0x32, 0x03, 0x84, 0xBF, 0x82,
+    0x7C, 0x05, 0x10, 0x10, 0x10, 0x1F, 0x10, 0x92, 0x01, 0xC5, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0x04, 0xC4, 0x34, 0xFF, 0x1C, 0xEC, 0x05, 0x00, 0xF8, 0x28, 0x28, 0x28, 0x23, 0x05, 0x00,
+    0x20, 0xFD, 0x91, 0x71, 0x1E, 0x05, 0xD0, 0x11, 0xFF, 0xD1, 0x10, 0x18, 0x04, 0x11, 0x7C, 0xFC,
+    0x11, 0x15, 0x04, 0x21, 0x39, 0xE1, 0x01, 0x23, 0x0F, 0x00, 0x20, 0xE3, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x70, 0x90, 0x90, 0xF0, 0x0F, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x80, 0xE7, 0x1B, 0x02, 0x18, 0x03, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x36, 0x04, 0x09, 0x89,
+    0x79, 0x0F, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC4, 0xBF, 0xFC, 0x16, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x13, 0x05, 0x00, 0xC1, 0x31, 0x1F, 0xE2, 0x28,
+    0x03, 0x00, 0x00, 0x00, 0x15, 0x01, 0x01, 0x23, 0x01, 0x01, 0x16, 0x01, 0x00, 0x09, 0x05, 0x3C,
+    0x04, 0x07, 0x84, 0x7C, 0x7C, 0x03, 0x08, 0xFA, 0x09, 0x38, 0x03, 0xC1, 0xE0, 0x18, 0x37, 0x05,
+    0x60, 0x33, 0xF0, 0x00, 0x03, 0x06, 0x04, 0xF9, 0x01, 0x01, 0xC1, 0x36, 0x03, 0x01, 0x00, 0x07,
+    0x03, 0x03, 0x00, 0x00, 0x00, 0x06, 0x01, 0x43, 0x2C, 0x0E, 0xC0, 0xBF, 0xE0, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x42, 0xC3, 0x40, 0x3C, 0x03, 0x80, 0x40, 0xC0, 0x06, 0x01, 0xC0,
+    0x31, 0x09, 0x80, 0xF0, 0x40, 0xC0, 0x00, 0xD0, 0x8F, 0x81, 0x40, 0x2D, 0x03, 0x00, 0x00, 0x00,
+    0x11, 0x05, 0x4A, 0xCE, 0x09, 0x80, 0x7F, 0x36, 0x04, 0x0C, 0x03, 0x07, 0x08, 0x2C, 0x05, 0x00,
+    0x40, 0x40, 0xC0, 0x20, 0x0E, 0x07, 0x4F, 0x49, 0x49, 0xCF, 0x00, 0x01, 0x10, 0x58, 0x04, 0x01,
+    0x1F, 0xF1, 0x11, 0x7C, 0x05, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0xFF, 0x00, 0x22, 0x02, 0x08, 0x0A,
+    0x7A, 0x04, 0x83, 0x42, 0x32, 0x0E, 0x6E, 0x04, 0x10, 0x10, 0x11, 0x10, 0x06, 0x04, 0x1E, 0x00,
+    0xE0, 0x1E, 0x0F, 0x04, 0x24, 0x24, 0x25, 0xFD, 0x69, 0x03, 0x12, 0xFF, 0xF0, 0x0B, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA2, 0x03, 0x69, 0x49, 0x92, 0xCC, 0x04, 0xF9, 0x70, 0x30, 0xF8, 0x59, 0x03, 0x00,
+    0x00, 0x00, 0x23, 0x01, 0x01, 0x58, 0x04, 0x00, 0xE0, 0x80, 0x40, 0x29, 0x06, 0x72, 0x3A, 0x03,
+    0xF2, 0x48, 0x4B, 0x7A, 0x06, 0x28, 0x24, 0x23, 0xC0, 0x04, 0xC4, 0x8F, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x45, 0x04, 0x07, 0xE8, 0x08, 0x07, 0x33, 0x04, 0x80, 0x80, 0x80, 0x00, 0x19, 0x01, 0xC2,
+    0x2A, 0x05, 0x00, 0x30, 0x1F, 0xE8, 0x06, 0x50, 0x04, 0x21, 0x10, 0x08, 0x07, 0x59, 0x04, 0x64,
+    0x94, 0xFF, 0x04, 0x55, 0x04, 0x09, 0x7E, 0x9C, 0x06, 0x07, 0x01, 0xAF, 0x2A, 0x03, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x00, 0x80, 0x00, 0x00, 0x4A, 0x04, 0x1C, 0x83, 0x72, 0x0E, 0x7C, 0x05, 0xFF,
+    0x40, 0x60, 0x18, 0x00, 0x49, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0xF0, 0x49, 0x78,
+    0xC0, 0x12, 0x01, 0x10, 0x20, 0x05, 0x24, 0x25, 0xE5, 0x25, 0x20, 0x28, 0x03, 0x90, 0xF0, 0x80,
+    0x19, 0x04, 0x01, 0x00, 0x00, 0x01, 0x19, 0x05, 0x00, 0x4A, 0xF1, 0xE0, 0x30, 0x16, 0x03, 0xE4,
+    0x23, 0x00, 0x0B, 0x03, 0x82, 0xC2, 0x33, 0x0F, 0x05, 0xC0, 0x41, 0x70, 0xC7, 0x03, 0x40, 0x04,
+    0x00, 0x38, 0x03, 0x04, 0x00, 0x00, 0x00, 0x7A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x01, 0x20, 0xE4,
+    0x02, 0xC0, 0x37, 0x7D, 0x04, 0x03, 0x02, 0x02, 0x07, 0x0B, 0x01, 0x24, 0x2D, 0x08, 0x0D, 0x07,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x01, 0x79, 0x2C, 0x03, 0x50, 0x88, 0x07, 0x03, 0x03,
+    0x80, 0x00, 0x80, 0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x0F, 0x49, 0x49, 0x4F, 0xC0,
+    0x50, 0x04, 0x1F, 0x87, 0x83, 0x1F, 0x15, 0x05, 0x00, 0x00, 0xE0, 0x00, 0x80, 0x0E, 0x04, 0x02,
+    0x06, 0x1E, 0x01, 0x50, 0x04, 0x9F, 0xAC, 0xA2, 0x1F, 0xFF, 0x00, 0x07, 0x04, 0x8D, 0x42, 0x20,
+    0x1C, 0x4B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x25, 0x1F, 0xF2, 0x12, 0x10, 0x7D, 0x01,
+    0x49, 0x41, 0x09, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x04, 0x07, 0x84, 0x7C, 0x6E, 0x03, 0x10, 0xE0,
+    0xFC, 0x07, 0x07, 0x08, 0x8A, 0x69, 0x18, 0x08, 0x02, 0x01, 0x0C, 0x03, 0x62, 0x32, 0xF2, 0x41,
+    0x04, 0x10, 0x14, 0xDE, 0xB1, 0x1B, 0x01, 0x03, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
+    0x08, 0xFF, 0xA4, 0x9C, 0xCF, 0x04, 0xC0, 0xB1, 0x8C, 0xC0, 0x0A, 0x05, 0x3C, 0x04, 0x07, 0x84,
+    0x7C, 0x32, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x01, 0x01, 0x0C, 0x02, 0x02, 0x01, 0x35,
+    0x01, 0x58, 0xFF, 0x00, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x06, 0x01, 0x84, 0x76, 0x04, 0xC0, 0x80,
+    0x80, 0xC0, 0x04, 0x02, 0x86, 0x7D, 0x37, 0x01, 0xC3, 0x21, 0x01, 0xC8, 0x5B, 0x04, 0x0C, 0x0B,
+    0x08, 0x1C, 0x1E, 0x05, 0x0C, 0x0B, 0x08, 0xFC, 0x00, 0x4F, 0x01, 0x80, 0x2C, 0x01, 0xB1, 0x52,
+    0x03, 0x7F, 0x04, 0x08, 0x29, 0x05, 0x00, 0x7F, 0x20, 0x30, 0x0C, 0x07, 0x01, 0xFE, 0x6A, 0x05,
+    0x60, 0x5F, 0x41, 0x70, 0x80, 0x0E, 0x04, 0x04, 0xC4, 0xBF, 0xFC, 0x7C, 0x01, 0x01, 0x1D, 0x01,
+    0x80, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x00, 0xF1, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x04, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x17, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0x04, 0xC8, 0x28, 0x38, 0x00, 0x19, 0x03, 0x00, 0xE0, 0x10, 0x42, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7B, 0x05, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1E, 0x04, 0xC2, 0x22, 0xA7,
+    0xC0, 0x77, 0x09, 0x40, 0x4F, 0xFA, 0x49, 0x40, 0x07, 0x0B, 0x08, 0x07, 0x3C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x36, 0x04, 0x00, 0x40, 0x58, 0xC7, 0x20, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x04, 0x00,
+    0x80, 0x00, 0x00, 0x34, 0x01, 0x00, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x8E, 0x01, 0x30, 0x24, 0x01, 0x00, 0x59, 0x05, 0x04, 0x1F, 0xFF, 0x00, 0x00,
+    0x1B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x10, 0x05, 0x01,
+    0x0E, 0x9B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x1D, 0x00, 0x80, 0x71, 0x1E, 0x03, 0x58,
+    0x52, 0xF1, 0x3E, 0x04, 0x50, 0x50, 0xF0, 0x48, 0x19, 0x02, 0x02, 0x01, 0x12, 0x04, 0x93, 0xE0,
+    0xC0, 0x60, 0x0A, 0x03, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x3A, 0x04, 0x80, 0x8E, 0x92, 0xE6,
+    0x81, 0x05, 0x40, 0x42, 0x42, 0x7E, 0x40, 0x3A, 0x02, 0x00, 0x00, 0xA3, 0x02, 0xC2, 0x3D, 0x7D,
+    0x01, 0x03, 0xDB, 0x02, 0x44, 0x44, 0x2C, 0x04, 0x91, 0x8D, 0x87, 0x00, 0x4E, 0x02, 0x90, 0x7C,
+    0x2C, 0x04, 0x48, 0x88, 0x0F, 0x88, 0x3C, 0x04, 0x80, 0x18, 0x07, 0x80, 0x7B, 0x06, 0x00, 0x9F,
+    0x87, 0x83, 0x1F, 0x00, 0x7A, 0x04, 0x20, 0x23, 0xA4, 0xB9, 0x88, 0x02, 0xC6, 0x45, 0x32, 0x05,
+    0x80, 0x84, 0xFC, 0x84, 0x80, 0x45, 0x05, 0x42, 0x22, 0xFB, 0x16, 0x60, 0x68, 0x04, 0x20, 0x10,
+    0xFC, 0x03, 0x0F, 0x05, 0x00, 0x7C, 0xB3, 0x8A, 0x7C, 0x2C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0x01, 0x01, 0x07, 0x04, 0x38, 0x07, 0xE4, 0x1C, 0x38, 0x03, 0x50, 0x30, 0x00, 0x40, 0x03,
+    0x24, 0x26, 0x25, 0x7D, 0x04, 0x02, 0x92, 0xE2, 0xC3, 0x00, 0x00, 0x00, 0x21, 0x05, 0x00, 0x0F,
+    0x80, 0x70, 0x0F, 0x1A, 0x04, 0x88, 0x88, 0xF8, 0x80, 0x2C, 0x05, 0x00, 0x1C, 0x83, 0x72, 0x0E,
+    0x7B, 0x02, 0x00, 0x1D, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0xF0, 0xE0, 0x61, 0xF0,
+    0x3F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x02, 0x88,
+    0x88, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x03, 0x00, 0x00, 0x03, 0x3F, 0x05, 0x00,
+    0x00, 0x80, 0xE0, 0x18, 0x10, 0x03, 0x10, 0x10, 0x10, 0x1C, 0x03, 0x90, 0xD0, 0x30, 0xE3, 0x09,
+    0xC7, 0x0B, 0x88, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x77, 0x09, 0x0F, 0x03, 0x04, 0x08, 0x08,
+    0x20, 0x20, 0x20, 0x00, 0x32, 0x07, 0x82, 0xDF, 0x27, 0x81, 0x00, 0x00, 0x00, 0x05, 0x01, 0x9C,
+    0x73, 0x0F, 0x43, 0x21, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0x00, 0x07,
+    0x18, 0x2B, 0x01, 0x00, 0x7F, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0D, 0x05, 0x1E, 0x02, 0x03,
+    0xC2, 0x3E, 0x54, 0x04, 0x08, 0xF8, 0x08, 0x00, 0x06, 0x05, 0x08, 0x09, 0xFE, 0x08, 0x08, 0x22,
+    0x01, 0x83, 0x4F, 0x03, 0x7D, 0xFD, 0x10, 0x06, 0x04, 0x1C, 0x03, 0x80, 0x70, 0x23, 0x01, 0x01,
+    0x4D, 0x05, 0xC0, 0x3C, 0x22, 0xE1, 0x20, 0x28, 0x04, 0xE2, 0x1E, 0x93, 0x70, 0x00, 0x00, 0x00,
+    0x62, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x8C, 0x5C, 0x04, 0x0E, 0x80, 0x40, 0x38,
+    0x7C, 0x01, 0x01, 0x61, 0x05, 0x43, 0xF8, 0x20, 0xF0, 0x20, 0x7C, 0x02, 0x01, 0x0E, 0x29, 0x03,
+    0x00, 0x00, 0x00, 0x7D, 0x04, 0xC0, 0x00, 0x80, 0x40, 0xFF, 0x00, 0x9A, 0x05, 0x00, 0x20, 0xA8,
+    0xB8, 0x27, 0x1F, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x06, 0x42, 0x42, 0x42, 0xFE, 0x00, 0x00, 0x2B,
+    0x02, 0x00, 0x09, 0x2B, 0x04, 0x42, 0x42, 0x42, 0xFE, 0x3C, 0x05, 0x42, 0x43, 0x42, 0xFE, 0x00,
+    0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x04, 0x70, 0x10, 0x1C,
+    0xF1, 0x10, 0x05, 0x00, 0x1A, 0x85, 0x40, 0x3C, 0x20, 0x06, 0x40, 0x00, 0x00, 0x00, 0x38, 0x48,
+    0x42, 0x02, 0x02, 0x01, 0x12, 0x05, 0x81, 0x7C, 0x04, 0xC0, 0x50, 0x40, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x03, 0xE2, 0xA1, 0xE0, 0x1B, 0x04, 0x39, 0x01, 0x01, 0xE1, 0x00, 0x00, 0x00,
+    0x13, 0x05, 0x42, 0x42, 0x7E, 0x42, 0x42, 0xA3, 0x09, 0x1C, 0x83, 0x72, 0x0E, 0x00, 0x42, 0x42,
+    0x42, 0x42, 0x77, 0x01, 0x01, 0x43, 0x01, 0x00, 0x7A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x6C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x70, 0x38, 0x00, 0xF0, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x1D, 0x05, 0x10, 0x10, 0xD7, 0xD0, 0x30, 0x3C, 0x09, 0x80, 0xF0, 0x40, 0xC0, 0x03,
+    0x42, 0x82, 0xF7, 0x00, 0x15, 0x04, 0x80, 0x60, 0xC0, 0x00, 0x1E, 0x03, 0x98, 0x87, 0x80, 0x42,
+    0x04, 0xCC, 0x03, 0x83, 0x40, 0x6C, 0x04, 0x00, 0x91, 0x8C, 0x83, 0x0D, 0x03, 0xE3, 0x84, 0x88,
+    0x05, 0x04, 0x89, 0xF9, 0x4F, 0x40, 0x2E, 0x04, 0x02, 0x1F, 0x27, 0x01, 0x31, 0x05, 0x10, 0x90,
+    0x9F, 0x90, 0x10, 0x0B, 0x04, 0x01, 0x1F, 0x14, 0x13, 0x05, 0x05, 0x04, 0x03, 0x3E, 0x02, 0x02,
+    0x2D, 0x04, 0x33, 0x0E, 0x1E, 0x21, 0x4E, 0x01, 0x00, 0x31, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0x04, 0x21, 0xA1, 0x21, 0x21, 0x18, 0x02, 0x40, 0x09, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x3D, 0x03, 0x00, 0x00, 0x00, 0x5F, 0x05, 0x02, 0x7A, 0x02, 0x83, 0x78, 0x19, 0x03, 0x10,
+    0xF0, 0x10, 0x00, 0x00, 0x00, 0x27, 0x08, 0x88, 0x88, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0x04, 0x7C, 0xB2, 0x8A, 0x7C, 0x5E, 0x05, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x1E, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xDA, 0x03, 0x11, 0xF0, 0x10, 0x50, 0x04, 0x48, 0x4B, 0x48, 0xF8, 0x29, 0x03, 0x02,
+    0x03, 0x02, 0x16, 0x03, 0x00, 0x00, 0x00, 0x37, 0x04, 0x04, 0x04, 0x04, 0x07, 0x0D, 0x02, 0xCE,
+    0x30, 0x32, 0x03, 0x90, 0x90, 0x90, 0x47, 0x03, 0x02, 0x01, 0x1F, 0x4C, 0x05, 0x0C, 0x83, 0x63,
+    0x00, 0x00, 0x41, 0x01, 0x03, 0x38, 0x09, 0x04, 0x03, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x05, 0x80, 0x82, 0x9F, 0xA7, 0x81, 0x05, 0x05, 0x00, 0x01, 0x01, 0x81, 0x01, 0x3C, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x05, 0x90, 0x10, 0x1F, 0x10, 0x10, 0x28, 0x01, 0x31, 0x5C, 0x03,
+    0x06, 0x03, 0x7F, 0x20, 0x04, 0x82, 0x7A, 0x0E, 0x02, 0x7C, 0x04, 0x09, 0x09, 0xC9, 0x38, 0x2D,
+    0x05, 0x80, 0x84, 0xFC, 0x84, 0x80, 0x7C, 0x01, 0xE0, 0x21, 0x04, 0xF8, 0x70, 0x30, 0xF8, 0x59,
+    0x05, 0x00, 0xF0, 0x09, 0x09, 0xF0, 0x1E, 0x04, 0x01, 0x00, 0x00, 0x01, 0x32, 0x04, 0x0A, 0x09,
+    0xC8, 0x38, 0x19, 0x01, 0x11, 0x09, 0x05, 0x00, 0x79, 0x02, 0x82, 0x79, 0x54, 0x02, 0x02, 0x01,
+    0x1B, 0x01, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x72, 0x04, 0xC0, 0xBE, 0x82, 0xE0, 0x1F, 0x04,
+    0x24, 0x24, 0x25, 0xE0, 0x59, 0x05, 0xC0, 0xE0, 0x18, 0x00, 0x01, 0x1E, 0x04, 0x48, 0x4C, 0xFB,
+    0x00, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x20,
+    0x20, 0x20, 0x0D, 0x03, 0x00, 0x00, 0x00, 0x2A, 0x04, 0x0F, 0x81, 0x40, 0x40, 0x13, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x5C, 0x93, 0xD0, 0x30, 0x07, 0x03, 0x40, 0xF0, 0x40, 0x1A,
+    0x05, 0x80, 0x40, 0x40, 0x80, 0x00, 0x27, 0x05, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x13, 0x05, 0x80,
+    0x00, 0x00, 0x80, 0x00, 0x0F, 0x04, 0x8C, 0x82, 0x83, 0x04, 0x45, 0x05, 0x00, 0x02, 0x9F, 0x27,
+    0x01, 0x41, 0x03, 0x81, 0x9F, 0x94, 0x37, 0x06, 0x80, 0x0E, 0x01, 0x03, 0x1C, 0x10, 0x40, 0x04,
+    0x20, 0x28, 0x38, 0x27, 0x99, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x80, 0x00, 0x00,
+    0x7C, 0x01, 0x24, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x81, 0x05, 0x04, 0xC4, 0x34, 0x0C, 0x04,
+    0x27, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x4A, 0x05, 0x00, 0xF0, 0xC9, 0x28,
+    0xF0, 0x1A, 0x03, 0x49, 0x4A, 0xCA, 0x0B, 0x01, 0x00, 0x04, 0x04, 0x00, 0x80, 0xC0, 0x30, 0x4A,
+    0x05, 0x00, 0x11, 0x12, 0x92, 0x71, 0x00, 0x00, 0x00, 0x19, 0x08, 0x8D, 0x42, 0x20, 0x1C, 0x60,
+    0x58, 0x46, 0xE0, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x04, 0x1C, 0x83, 0x72, 0x0E, 0x5A,
+    0x04, 0xF9, 0x64, 0x14, 0xF8, 0x1E, 0x01, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04,
+    0x90, 0x50, 0x31, 0x00, 0x24, 0x02, 0x01, 0x01, 0x26, 0x01, 0xF8, 0x1A, 0x01, 0x00, 0x14, 0x03,
+    0x4B, 0x4A, 0xFA, 0x28, 0x05, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x3B, 0x01, 0x48, 0x36, 0x04, 0x87,
+    0x62, 0x03, 0x00, 0x06, 0x02, 0x0C, 0x03, 0x60, 0x04, 0xE2, 0x21, 0x3F, 0xE0, 0x0F, 0x04, 0x06,
+    0xC5, 0x04, 0x8E, 0x69, 0x04, 0x06, 0x09, 0x09, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0x01, 0x00,
+    0x03, 0x01, 0x00, 0x4F, 0x01, 0xF8, 0x2B, 0x05, 0x00, 0x80, 0xFF, 0x40, 0x30, 0x1D, 0x05, 0x38,
+    0x08, 0x8E, 0x78, 0x00, 0x5A, 0x01, 0xF9, 0x21, 0x01, 0x09, 0x12, 0x05, 0x00, 0x0E, 0x80, 0x41,
+    0x38, 0x45, 0x04, 0x20, 0xA1, 0xF8, 0x20, 0x33, 0x02, 0x09, 0x08, 0x42, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x04, 0x07, 0x34, 0x04, 0x6A, 0x11, 0x00, 0xE0, 0x06, 0x05, 0xE1, 0x82, 0x42,
+    0x21, 0x20, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x42, 0x42, 0x42, 0x42, 0xFF, 0x00, 0x47, 0x04, 0x04,
+    0xC4, 0x7C, 0x88, 0x7B, 0x05, 0x00, 0xC3, 0x30, 0x00, 0x03, 0x1F, 0x05, 0x44, 0x44, 0xF7, 0x40,
+    0x40, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x17, 0x02, 0x18,
+    0x07, 0x42, 0x03, 0xC0, 0xA0, 0x20, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x40,
+    0x40, 0xC0, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x02, 0x00, 0x00, 0x1B, 0x04, 0x00,
+    0xE0, 0x80, 0x80, 0xE8, 0x03, 0x00, 0x00, 0x00, 0x78, 0x04, 0x7E, 0x4A, 0x4A, 0x4A, 0x3D, 0x07,
+    0x00, 0x00, 0x00, 0xC8, 0x28, 0xFE, 0x08, 0x1F, 0x04, 0xC1, 0x31, 0x1F, 0xE2, 0x55, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x7B, 0x01, 0x48, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x04, 0x70, 0x0F, 0xC9, 0x38, 0x59, 0x04, 0x20, 0x38, 0xE0, 0x00, 0x1F, 0x04, 0x4C, 0x4A, 0xC9,
+    0x78, 0x6D, 0x05, 0x12, 0x13, 0xE0, 0xF0, 0x13, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2D, 0x03, 0x00,
+    0x00, 0x00, 0x2D, 0x05, 0x08, 0x09, 0xF8, 0x08, 0x08, 0x33, 0x05, 0x20, 0xFC, 0x11, 0x78, 0x10,
+    0x13, 0x03, 0xE0, 0x90, 0xF0, 0x2F, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0x03, 0x48, 0x48, 0xFF, 0x4C, 0x02, 0xF8, 0x08, 0x5B, 0x05, 0x4C, 0x43, 0xF0, 0x40, 0x40, 0x70,
+    0x06, 0xE6, 0x25, 0x3C, 0x2E, 0xE0, 0x00, 0x06, 0x02, 0x18, 0x07, 0x5F, 0x04, 0xC6, 0xE9, 0x09,
+    0xCF, 0x0F, 0x06, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x00, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x04, 0x21, 0x10, 0x0C, 0x03, 0x28, 0x04, 0x00, 0x80, 0x80, 0x00, 0x1F, 0x03, 0x01, 0x1F, 0x14,
+    0x7D, 0x04, 0x22, 0x22, 0x3E, 0x20, 0xE3, 0x05, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x32, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x04, 0xC0, 0x30, 0x0F, 0x00, 0x7C, 0x01, 0xF8, 0xEC, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x04, 0xC3, 0x44, 0x77, 0xC0, 0x00, 0x00, 0x00, 0x36,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x60, 0x58, 0x46, 0xE0, 0x00, 0x55, 0x07, 0xCC, 0x38,
+    0x78, 0x84, 0x00, 0x1F, 0xFF, 0x7E, 0x01, 0x01, 0x9C, 0x04, 0xC0, 0x31, 0x29, 0xC8, 0x31, 0x05,
+    0x30, 0x18, 0xF8, 0x00, 0x00, 0x46, 0x04, 0x01, 0x02, 0x02, 0x01, 0x32, 0x04, 0xC0, 0x33, 0x00,
+    0x00, 0x09, 0x02, 0x00, 0x00, 0x7E, 0x02, 0x40, 0x40, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x6F, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x80, 0xF0, 0x40, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x5E, 0x04,
+    0x80, 0x80, 0x80, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x64, 0x05, 0x60, 0x5F,
+    0x41, 0x70, 0xC2, 0x04, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0xB3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x37,
+    0x05, 0x1A, 0x84, 0x40, 0x38, 0x00, 0x41, 0x03, 0x10, 0xFE, 0xD0, 0x2D, 0x0C, 0x3D, 0x00, 0xC0,
+    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xC8, 0x74, 0x08, 0x6C, 0x12, 0x01, 0xE0, 0x00,
+    0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x3A, 0x05, 0x00, 0xC1, 0xB1, 0x1F, 0xE2, 0x55, 0x05, 0x60,
+    0x5F, 0x41, 0x70, 0x80, 0x43, 0x05, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x33, 0x01, 0xB0, 0x12, 0x05,
+    0x14, 0x14, 0xFC, 0x12, 0x10, 0x31, 0x01, 0x08, 0x4A, 0x01, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x2D, 0x04, 0x08, 0x89, 0x88, 0x70, 0x4B, 0x04, 0x30, 0xF0, 0x00, 0x00, 0x2D, 0x09, 0x02,
+    0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x20, 0x20, 0xE3, 0x20, 0x20, 0x6D,
+    0x05, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x09, 0x04, 0x00, 0x40, 0x87, 0xF0, 0x20, 0x02, 0x80, 0x78,
+    0x0D, 0x02, 0x71, 0x1F, 0x1B, 0x03, 0x40, 0xD8, 0x47, 0x16, 0x03, 0x00, 0x00, 0x00, 0x37, 0x04,
+    0x06, 0x05, 0x04, 0x0E, 0x0B, 0x04, 0xD0, 0xE8, 0x06, 0xC1, 0x19, 0x05, 0x08, 0x08, 0x0F, 0x08,
+    0x08, 0x14, 0x04, 0x00, 0xC0, 0x00, 0x00, 0x46, 0x04, 0x61, 0x50, 0x4C, 0x43, 0x3C, 0x03, 0x10,
+    0x1F, 0x10, 0x3D, 0x05, 0x02, 0x42, 0x3E, 0x02, 0x02, 0x3A, 0x05, 0x00, 0x3F, 0x25, 0x25, 0x25,
+    0x90, 0x04, 0x00, 0x80, 0x00, 0x00, 0xBB, 0x05, 0x80, 0x85, 0xFD, 0x84, 0x80, 0x45, 0x01, 0x08,
+    0x7F, 0x01, 0x82, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x7C, 0x01, 0xFF,
+    0x5C, 0x05, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x56, 0x03, 0x91, 0x70, 0x00, 0x23, 0x02, 0x33, 0x28,
+    0x57, 0x03, 0x4B, 0xFA, 0x02, 0xFF, 0x00, 0xE3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x51, 0x02, 0x00,
+    0x00, 0x1B, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x04, 0x80,
+    0x80, 0x80, 0x00, 0x1A, 0x04, 0x00, 0x80, 0x80, 0x00, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA8,
+    0x05, 0x00, 0xFC, 0x94, 0x94, 0x94, 0x7C, 0x02, 0x84, 0xFC, 0x20, 0x05, 0x70, 0x8C, 0x8A, 0x72,
+    0x00, 0x14, 0x04, 0x09, 0x09, 0xF9, 0x09, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x46, 0x01, 0x08,
+    0x18, 0x01, 0x01, 0x1D, 0x03, 0x24, 0xE4, 0x24, 0x1E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B,
+    0x05, 0x40, 0x70, 0xC0, 0x00, 0x00, 0x2C, 0x09, 0xC4, 0x32, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x7C, 0x01, 0x01, 0x12, 0x06, 0x08,
+    0x0A, 0xFE, 0x8A, 0x8A, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x59, 0x0F, 0x00, 0x12, 0x12,
+    0x92, 0x70, 0x00, 0x70, 0x0C, 0x18, 0xE0, 0x80, 0x85, 0x84, 0x84, 0xBC, 0x73, 0x01, 0xFE, 0x95,
+    0x03, 0x00, 0x00, 0x00, 0x0D, 0x04, 0x79, 0x02, 0x82, 0x79, 0x1E, 0x04, 0x6A, 0x12, 0x03, 0xE2,
+    0x4C, 0x01, 0xD0, 0x0D, 0x03, 0x08, 0x04, 0x03, 0x1F, 0x03, 0x04, 0x02, 0x01, 0x04, 0x01, 0x00,
+    0x19, 0x02, 0x00, 0x00, 0x62, 0x02, 0x50, 0x90, 0x1A, 0x02, 0x80, 0x78, 0x41, 0x03, 0x8F, 0x48,
+    0x48, 0x72, 0x02, 0x81, 0x81, 0x08, 0x04, 0x0E, 0x11, 0x11, 0x0E, 0x60, 0x01, 0xFE, 0x10, 0x06,
+    0x20, 0x23, 0x24, 0x39, 0x00, 0x00, 0x67, 0x05, 0x62, 0x9A, 0xFF, 0x02, 0x02, 0x85, 0x04, 0x6E,
+    0x92, 0x92, 0xFE, 0x06, 0x04, 0x6E, 0x92, 0x92, 0xFE, 0xFF, 0x00, 0x28, 0x05, 0xFE, 0x10, 0x20,
+    0x01, 0x00, 0x7B, 0x02, 0x01, 0x3C, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x0F, 0x80, 0x70, 0x0F, 0x00,
+    0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x04, 0x43, 0x42, 0x7E, 0x40, 0x59, 0x02, 0x0B, 0xFE,
+    0x12, 0x01, 0x1C, 0xB5, 0x03, 0xF8, 0x0B, 0xF8, 0x7D, 0x03, 0x03, 0x01, 0x03, 0xFF, 0x00, 0xB0,
+    0x01, 0x00, 0x3A, 0x04, 0x11, 0x11, 0x1F, 0x10, 0x3F, 0x04, 0x00, 0x00, 0x00, 0xE0, 0x16, 0x01,
+    0xC1, 0x39, 0x01, 0x00, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0x18, 0x06, 0x04, 0x05,
+    0x00, 0x00, 0x80, 0x80, 0x00, 0x2D, 0x06, 0x00, 0x01, 0x71, 0x0D, 0x03, 0x01, 0x04, 0x05, 0x00,
+    0x3E, 0x41, 0x41, 0x3E, 0x29, 0x01, 0x21, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x66, 0x1C,
+    0x3C, 0x42, 0x00, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x53, 0x06, 0x00, 0x04, 0x84,
+    0x7F, 0x04, 0x04, 0x0E, 0x05, 0x80, 0x00, 0x80, 0x00, 0x00, 0x05, 0x01, 0xFC, 0x61, 0x03, 0x00,
+    0x20, 0x11, 0x52, 0x04, 0x1C, 0x0E, 0xC0, 0x3C, 0x37, 0x05, 0x08, 0x09, 0xFE, 0x08, 0x08, 0x40,
+    0x02, 0x02, 0x01, 0x3A, 0x01, 0x03, 0x3D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x42, 0xF9,
+    0x20, 0xE0, 0x10, 0x05, 0x11, 0x12, 0xF2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x04, 0xF4,
+    0x1C, 0x04, 0x0F, 0x1C, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x00, 0x8D, 0x42, 0x20, 0x1C, 0x60, 0x58,
+    0x46, 0xE0, 0x00, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x88, 0x88, 0xF8, 0x80, 0x00, 0x94, 0x94, 0xFC,
+    0x0C, 0x08, 0xC1, 0xB1, 0x1F, 0xE2, 0x60, 0x58, 0x46, 0xE0, 0x1A, 0x03, 0xFE, 0x42, 0xFE, 0x20,
+    0x04, 0x43, 0x42, 0x7E, 0x40, 0x0F, 0x18, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x00, 0xCC, 0x38, 0x78,
+    0x84, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x69, 0x49, 0x92, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x10,
+    0x09, 0x1C, 0x83, 0x72, 0x0E, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x18, 0x05, 0x08, 0x0A, 0xFE, 0x8A,
+    0x8A, 0x10, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x0B, 0x04, 0x04, 0x07, 0x84, 0x7C, 0x10, 0x18, 0x12,
+    0x12, 0x92, 0x70, 0x00, 0x70, 0x0C, 0x18, 0xE0, 0x80, 0x85, 0x84, 0x84, 0xBC, 0x04, 0x07, 0x84,
+    0x7C, 0x00, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x09, 0x0F, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x00, 0x09,
+    0x08, 0xFE, 0x08, 0x08, 0x0E, 0x80, 0x40, 0x38, 0x18, 0x05, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x10,
+    0x04, 0xC0, 0xBE, 0x82, 0xE0, 0x0C, 0x02, 0x02, 0x01, 0x11, 0x04, 0x20, 0xFE, 0x91, 0x70, 0x0B,
+    0x07, 0xC2, 0x3D, 0x00, 0x00, 0xF8, 0x0B, 0xF8, 0x0B, 0x0E, 0x08, 0x08, 0xFA, 0x09, 0x08, 0x00,
+    0xC0, 0x33, 0x28, 0xC8, 0x00, 0x11, 0xF0, 0x10, 0x1A, 0x04, 0x08, 0x89, 0x88, 0x70, 0x0F, 0x06,
+    0x30, 0x18, 0xF8, 0x00, 0x00, 0x01, 0x1D, 0x05, 0x48, 0x48, 0x4B, 0xFA, 0x02, 0x0A, 0x08, 0x43,
+    0xF8, 0x20, 0xF0, 0x20, 0x03, 0x01, 0x03, 0x0B, 0x0F, 0x01, 0xF9, 0x01, 0x01, 0xC1, 0x00, 0x79,
+    0x02, 0x82, 0x79, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x19, 0x04, 0x6A, 0x12, 0x03, 0xE2, 0x0F, 0x05,
+    0x20, 0x20, 0xE3, 0x20, 0x20, 0x1E, 0x06, 0x04, 0x44, 0x44, 0xF7, 0x40, 0x40, 0x0A, 0x03, 0x01,
+    0xCE, 0x30, 0x10, 0x0F, 0x87, 0x62, 0x03, 0x00, 0x00, 0x08, 0x04, 0x03, 0x00, 0x00, 0x4C, 0x43,
+    0xF0, 0x40, 0x40, 0x18, 0x05, 0x84, 0xF2, 0x41, 0xE0, 0x40, 0x0F, 0x03, 0x40, 0x87, 0xF0, 0x20,
+    0x03, 0x80, 0x78, 0x07, 0x0B, 0x04, 0xE2, 0x71, 0x1F, 0xE0, 0x06, 0x03, 0x80, 0x80, 0x80, 0x06,
+    0x05, 0xE6, 0x25, 0x3C, 0x2E, 0xE0, 0x06, 0x03, 0x40, 0xD8, 0x47, 0x1B, 0x03, 0x03, 0x1C, 0x01,
+    0x10, 0x03, 0x0C, 0x83, 0x63, 0x0A, 0x02, 0x80, 0x78, 0x13, 0x04, 0x06, 0x05, 0x04, 0x0E, 0x0B,
+    0x04, 0xD0, 0xE8, 0x06, 0xC1, 0x06, 0x04, 0x48, 0x88, 0x0F, 0x88, 0x05, 0x05, 0x01, 0x00, 0x10,
+    0x0C, 0x03, 0x05, 0x05, 0x08, 0x08, 0x8F, 0x48, 0x48, 0x1E, 0x03, 0x80, 0x80, 0x80, 0x0B, 0x05,
+    0x04, 0x03, 0xFF, 0x80, 0x80, 0x09, 0x02, 0x01, 0x10, 0x14, 0x04, 0x11, 0x11, 0x1F, 0x10, 0x0A,
+    0x04, 0xA1, 0x90, 0x8C, 0x43, 0x06, 0x04, 0x02, 0x9F, 0x27, 0x01, 0x06, 0x04, 0x81, 0x81, 0x81,
+    0x01, 0x06, 0x04, 0x0E, 0x11, 0x91, 0x0E, 0x16, 0x01, 0xE0, 0x06, 0x05, 0x10, 0x10, 0x1F, 0x10,
+    0x10, 0x0B, 0x04, 0xC1, 0x1F, 0x14, 0x13, 0x0A, 0x01, 0x1F, 0x22, 0x05, 0x02, 0x62, 0xDF, 0x02,
+    0x02, 0x05, 0x05, 0x0E, 0x01, 0x03, 0x1C, 0x10, 0x04, 0x04, 0x20, 0x23, 0x24, 0x39, 0x06, 0x04,
+    0x10, 0x0C, 0x7E, 0x01, 0x15, 0x05, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0x05, 0x04, 0x3F, 0x25, 0x25,
+    0x25, 0x0B, 0x04, 0x3F, 0x10, 0x18, 0x06, 0x06, 0x05, 0x80, 0x80, 0x00, 0x00, 0x1D, 0x22, 0x05,
+    0x62, 0x9A, 0xFF, 0x02, 0x02, 0x05, 0x05, 0x01, 0x71, 0x0D, 0x03, 0x01, 0x05, 0x04, 0x3E, 0x41,
+    0x41, 0x3E, 0x1E, 0x04, 0x82, 0x7A, 0x0E, 0x02, 0x06, 0x04, 0x21, 0x21, 0x21, 0x21, 0x07, 0x01,
+    0x80, 0x03, 0x04, 0x66, 0x1C, 0x3C, 0x42, 0x05, 0x06, 0x30, 0x2F, 0x20, 0x38, 0x40, 0x09, 0x21,
+    0x04, 0xC8, 0x28, 0xFE, 0x08, 0x07, 0x04, 0x6E, 0x92, 0x92, 0xFE, 0x06, 0x04, 0x6E, 0x92, 0x92,
+    0xFE, 0x13, 0x04, 0x42, 0x42, 0x42, 0xFE, 0x07, 0x05, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x05, 0x05,
+    0x04, 0x84, 0x7F, 0x04, 0x04, 0x05, 0x14, 0x1C, 0x83, 0x72, 0x0E, 0x00, 0x60, 0x5F, 0x41, 0x70,
+    0x80, 0x00, 0x80, 0x00, 0x00, 0x04, 0xF4, 0x1C, 0x04, 0x00, 0xFC, 0x09, 0x05, 0x80, 0x84, 0xFC,
+    0x84, 0x80, 0x14, 0x02, 0x01, 0x01, 0x08, 0x03, 0xC0, 0x30, 0x0F, 0x06, 0x05, 0x80, 0x84, 0xFC,
+    0x84, 0x80, 0x13, 0x04, 0x38, 0x08, 0x8E, 0x78, 0x07, 0x04, 0x70, 0x8C, 0x8A, 0x72, 0x06, 0x04,
+    0x20, 0x11, 0xFC, 0x03, 0x05, 0x15, 0x42, 0x43, 0x42, 0xFE, 0x00, 0x80, 0x8E, 0x92, 0xE6, 0x00,
+    0x1E, 0x02, 0x03, 0xC2, 0x3E, 0x83, 0x42, 0x32, 0x0E, 0x00, 0x08, 0x0A, 0x04, 0xE0, 0x18, 0x14,
+    0xE4, 0x1E, 0x03, 0x38, 0x90, 0x78, 0x07, 0x04, 0x1C, 0x0E, 0xC0, 0x3C, 0x14, 0x03, 0x09, 0xF8,
+    0x08, 0x07, 0x05, 0x08, 0x08, 0xFE, 0x08, 0x08, 0x04, 0x04, 0xFE, 0x10, 0x20, 0x01, 0x07, 0x14,
+    0x1A, 0x84, 0x40, 0x38, 0x00, 0x08, 0x08, 0xFE, 0x08, 0x08, 0x1A, 0x85, 0x40, 0x3C, 0x04, 0x07,
+    0x84, 0x7C, 0x00, 0x82, 0x0A, 0x04, 0x70, 0x0F, 0xC9, 0x38, 0x1D, 0x04, 0x20, 0xA2, 0xF9, 0x20,
+    0x07, 0x02, 0x02, 0x01, 0x16, 0x05, 0x11, 0x11, 0xFD, 0x10, 0x10, 0x05, 0x04, 0x1C, 0x03, 0x80,
+    0x70, 0x05, 0x05, 0x01, 0x3C, 0x00, 0xC0, 0x3C, 0x06, 0x07, 0xF1, 0xC8, 0x28, 0xF0, 0x00, 0x00,
+    0x03, 0x03, 0x0A, 0x81, 0x7C, 0x04, 0xC0, 0x50, 0x52, 0xF1, 0x00, 0x00, 0x11, 0x0A, 0x08, 0x4C,
+    0x4A, 0xC9, 0x78, 0x00, 0x20, 0xE0, 0x20, 0x19, 0x04, 0xC3, 0x44, 0x77, 0xC0, 0x1E, 0x05, 0xC0,
+    0x3C, 0x26, 0xE1, 0x20, 0x06, 0x04, 0x42, 0xF9, 0x20, 0xE0, 0x06, 0x04, 0xC4, 0x32, 0x61, 0x80,
+    0x06, 0x04, 0x11, 0x12, 0xF2, 0x01, 0x06, 0x0A, 0x39, 0x01, 0x01, 0xE1, 0xE2, 0x12, 0x13, 0xE0,
+    0xF0, 0x13, 0x00, 0x00, 0x00, 0x05, 0x04, 0x82, 0xA2, 0xE2, 0x9C, 0x06, 0x04, 0x42, 0x42, 0x42,
+    0x42, 0x0A, 0x05, 0x00, 0xCC, 0x38, 0x78, 0x84, 0x31, 0x04, 0x80, 0xFF, 0x40, 0x30, 0x41, 0x05,
+    0xFF, 0x08, 0x10, 0x00, 0x00, 0x36, 0x01, 0x01, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x24, 0x26, 0xFD, 0x16, 0x0C, 0x10, 0xF0, 0x10, 0x00,
+    0x00, 0x10, 0xD0, 0x70, 0x10, 0xF0, 0x52, 0x71, 0x12, 0x02, 0xF8, 0x08, 0x47, 0x03, 0x02, 0x02,
+    0x03, 0x15, 0x08, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x04, 0x03, 0x9B, 0x09, 0xE8, 0x24, 0xE3,
+    0x00, 0x00, 0x8C, 0xF3, 0x40, 0xE0, 0x71, 0x09, 0x06, 0x95, 0x94, 0x2E, 0x00, 0x00, 0x0F, 0x04,
+    0x0F, 0x03, 0x03, 0xC3, 0x5C, 0x01, 0x3A, 0x02, 0x00, 0x00, 0x35, 0x05, 0x00, 0x06, 0x04, 0x09,
+    0x00, 0x44, 0x02, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x70, 0x01, 0x00, 0x0C, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x40, 0x20, 0x1C, 0x00, 0x13,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x01, 0x42, 0xF4, 0x05, 0x05, 0x04, 0xF4, 0x34, 0x0C,
+    0x0B, 0x05, 0x10, 0xD3, 0xFE, 0x10, 0x10, 0x62, 0x03, 0xC2, 0x21, 0x10, 0x07, 0x03, 0xC6, 0x31,
+    0x60, 0x0C, 0x03, 0x03, 0x04, 0x07, 0x00, 0x00, 0x00, 0xAC, 0x03, 0x94, 0x94, 0xFC, 0xFF, 0x00,
+    0x52, 0x04, 0xE2, 0x12, 0x13, 0xE0, 0x23, 0x03, 0x23, 0xFD, 0xE3, 0x57, 0x03, 0x03, 0x05, 0x04,
+    0x22, 0x04, 0x08, 0x06, 0x05, 0x07, 0x82, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x05, 0xC0, 0x03, 0x9C,
+    0x41, 0x40, 0x4A, 0x04, 0x40, 0x80, 0x00, 0x80, 0x2D, 0x08, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x2F, 0x04, 0x91, 0x91, 0x9F, 0x90, 0x42, 0x01, 0x00, 0x06, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x03, 0x01, 0x1F, 0xD4, 0x20, 0x04, 0x20, 0x10, 0x0C, 0x03, 0x28, 0x03, 0x8C,
+    0xFE, 0x81, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x30, 0x0C, 0x03, 0x00, 0x4B,
+    0x04, 0x04, 0x84, 0x64, 0x1C, 0x67, 0x05, 0x01, 0x81, 0x7D, 0x0D, 0x03, 0x47, 0x01, 0x00, 0x29,
+    0x05, 0x1E, 0x03, 0x03, 0xC2, 0x3E, 0x06, 0x05, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x31, 0x04, 0xFE,
+    0x43, 0xFE, 0x00, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x01, 0x01, 0x09, 0x01, 0x91,
+    0x36, 0x01, 0x00, 0x12, 0x01, 0x84, 0x3E, 0x05, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x7C, 0x02, 0x06,
+    0x01, 0x00, 0x00, 0x00, 0x85, 0x04, 0x20, 0x10, 0xFC, 0x03, 0x15, 0x04, 0x09, 0x09, 0xF9, 0x09,
+    0x31, 0x04, 0x7D, 0xB2, 0x8A, 0x7C, 0x05, 0x05, 0x00, 0x1C, 0xC8, 0x3C, 0x00, 0x26, 0x01, 0x01,
+    0x11, 0x07, 0x08, 0x3E, 0xFE, 0x08, 0x00, 0x84, 0x85, 0x3D, 0x01, 0x09, 0x13, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x02, 0x12, 0xF1, 0x20, 0x04, 0x38, 0x1F, 0x80, 0x78, 0x36, 0x01, 0x00, 0x45,
+    0x09, 0x7C, 0x02, 0x81, 0x78, 0x00, 0xFA, 0xFB, 0x02, 0x00, 0x3C, 0x04, 0x40, 0xC3, 0x45, 0x44,
+    0x3C, 0x02, 0x88, 0xF7, 0x3F, 0x01, 0x0F, 0x92, 0x04, 0xE5, 0x04, 0x0E, 0xE0, 0x1E, 0x04, 0xA6,
+    0x44, 0x09, 0x80, 0x5A, 0x04, 0xA1, 0x90, 0x8E, 0x81, 0x1E, 0x04, 0x91, 0x88, 0x84, 0x03, 0x38,
+    0x02, 0xDF, 0x54, 0x7D, 0x05, 0x18, 0x17, 0x10, 0x1C, 0x20, 0xC0, 0x04, 0xC1, 0x31, 0x1F, 0xE2,
+    0x13, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x06, 0x18, 0x07,
+    0xC4, 0x3C, 0x04, 0x00, 0x3A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x82, 0x03, 0x02, 0x04,
+    0xC4, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x02, 0x39, 0x90, 0x50, 0x01, 0x01, 0x0C, 0x02,
+    0x0E, 0xC8, 0x82, 0x03, 0x00, 0x00, 0x00, 0x3B, 0x05, 0x00, 0x10, 0x16, 0x11, 0xE0, 0x1E, 0x03,
+    0x60, 0x33, 0xF4, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x40, 0x42,
+    0x42, 0x7E, 0x40, 0x2D, 0x04, 0xFC, 0x94, 0x94, 0x94, 0x2E, 0x03, 0x94, 0x94, 0xFC, 0x87, 0x04,
+    0xF0, 0x48, 0x78, 0xC0, 0x0F, 0x04, 0x24, 0x64, 0xE4, 0x1C, 0x0A, 0x06, 0x84, 0x85, 0x84, 0xFC,
+    0x00, 0x00, 0x59, 0x04, 0x11, 0xF0, 0x10, 0x01, 0x11, 0x01, 0x01, 0x06, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x1C, 0x81, 0x5A, 0x09, 0xF2, 0x12, 0x1F, 0x12, 0xF2, 0x00, 0x24, 0xC3,
+    0xF8, 0x14, 0x05, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x05, 0x04, 0x20, 0x22, 0xFF, 0xE2, 0x1A, 0x04,
+    0xFA, 0x02, 0x03, 0xC2, 0x39, 0x07, 0x08, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x1E, 0x04, 0x08,
+    0x86, 0xF5, 0x47, 0x1A, 0x03, 0x87, 0xF2, 0x43, 0x20, 0x04, 0x78, 0x4F, 0xC0, 0x40, 0x38, 0x02,
+    0x84, 0x6F, 0x42, 0x03, 0x10, 0x0C, 0x03, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x04,
+    0x03, 0x1F, 0x20, 0x03, 0x8F, 0x83, 0x84, 0x4C, 0x04, 0x00, 0x80, 0x00, 0x00, 0x2D, 0x03, 0x1C,
+    0x12, 0x11, 0x1F, 0x01, 0x00, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x04, 0x04, 0x9F, 0x7F,
+    0x04, 0x2D, 0x04, 0x08, 0xFF, 0xA4, 0x9C, 0x36, 0x05, 0x00, 0x89, 0x88, 0xF8, 0x80, 0x10, 0x01,
+    0x01, 0x61, 0x03, 0x1C, 0x25, 0xCC, 0x07, 0x01, 0x38, 0x74, 0x04, 0x01, 0x01, 0x01, 0x01, 0xD9,
+    0x02, 0x60, 0x33, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x20, 0x10, 0xFC, 0x03, 0x6D, 0x03, 0x84, 0xFC,
+    0x84, 0x0C, 0x04, 0xC5, 0x29, 0x3D, 0x43, 0x46, 0x04, 0x0E, 0x80, 0x41, 0x38, 0x32, 0x01, 0x84,
+    0x17, 0x03, 0x08, 0xF8, 0x08, 0x2F, 0x01, 0x01, 0x4C, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x19,
+    0x03, 0x00, 0x00, 0x00, 0x48, 0x05, 0x54, 0x52, 0xF1, 0x48, 0x60, 0x32, 0x01, 0xE0, 0x21, 0x05,
+    0xC4, 0xBC, 0xE7, 0x20, 0x00, 0x0E, 0x04, 0x46, 0x45, 0xC7, 0x40, 0x10, 0x02, 0xE0, 0x2C, 0x56,
+    0x05, 0x80, 0x79, 0x4D, 0xC7, 0x40, 0x0F, 0x03, 0x10, 0x0F, 0x01, 0x69, 0x04, 0x01, 0xF0, 0x0C,
+    0x03, 0x69, 0x04, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x11, 0x04, 0x7E, 0x1C, 0x0C, 0x7E, 0x40,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x38, 0x05, 0x08,
+    0x08, 0xFE, 0x08, 0x08, 0x31, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x11,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x28, 0x2B, 0x20, 0x04, 0x38, 0x1F, 0x80, 0x78, 0x10,
+    0x01, 0xF0, 0x09, 0x01, 0x80, 0x13, 0x03, 0x48, 0x48, 0xC8, 0x29, 0x03, 0xA0, 0xA6, 0xE1, 0x1F,
+    0x03, 0xC4, 0x22, 0x11, 0x00, 0x00, 0x00, 0xA2, 0x03, 0x08, 0x00, 0x00, 0x5B, 0x04, 0x60, 0xF0,
+    0x0C, 0x00, 0x7C, 0x04, 0x04, 0xF7, 0x34, 0x0C, 0x28, 0x03, 0x50, 0x50, 0xF1, 0x10, 0x04, 0x08,
+    0xC9, 0x28, 0x38, 0x3D, 0x03, 0xE6, 0x11, 0x10, 0x29, 0x03, 0x02, 0x02, 0x03, 0x11, 0x02, 0x21,
+    0xFE, 0x3F, 0x04, 0x43, 0xFD, 0x44, 0x40, 0x1D, 0x04, 0x80, 0x61, 0xCE, 0x00, 0x5A, 0x03, 0x7C,
+    0x53, 0xDF, 0x1F, 0x05, 0xE3, 0x70, 0x00, 0xE7, 0x04, 0xD9, 0x04, 0x41, 0x41, 0x41, 0x41, 0x29,
+    0x01, 0x00, 0x2F, 0x01, 0xDC, 0x22, 0x05, 0x02, 0x42, 0x3E, 0x02, 0x02, 0x27, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2C, 0x04, 0x21, 0x10, 0x08, 0x07, 0x81, 0x04, 0x00, 0x00, 0x00, 0x00, 0xDA,
+    0x03, 0x85, 0xFC, 0x84, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x01, 0x08, 0x52, 0x05, 0x05,
+    0x05, 0xF5, 0x35, 0x0C, 0x4B, 0x05, 0x90, 0x7F, 0xC8, 0x48, 0x40, 0x2C, 0x02, 0x06, 0x01, 0x07,
+    0x05, 0x03, 0x7C, 0x07, 0x80, 0x78, 0x41, 0x02, 0x30, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x04, 0x42,
+    0x42, 0x42, 0x42, 0x22, 0x05, 0xC8, 0x28, 0xFE, 0x08, 0x00, 0x7C, 0x02, 0x85, 0xFD, 0x25, 0x04,
+    0x05, 0xF4, 0x1C, 0x04, 0x38, 0x02, 0x3E, 0xFE, 0x42, 0x01, 0x09, 0x31, 0x03, 0x21, 0x20, 0xE0,
+    0x07, 0x02, 0x02, 0x01, 0x43, 0x02, 0xC1, 0x3D, 0x2F, 0x04, 0x02, 0x02, 0x03, 0x02, 0x1F, 0x02,
+    0xA1, 0x63, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x01, 0x03, 0x1C, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x09, 0xE0, 0x28, 0x66, 0x01, 0x00, 0x96, 0x91, 0x91, 0x90, 0x04, 0x04, 0x00,
+    0x47, 0x44, 0xC4, 0x0C, 0x03, 0x80, 0x60, 0x00, 0x39, 0x01, 0x80, 0x25, 0x04, 0x08, 0x08, 0x09,
+    0x0E, 0x03, 0x02, 0x10, 0x0F, 0x81, 0x04, 0x50, 0x48, 0xC6, 0x01, 0x16, 0x02, 0xDF, 0x80, 0x63,
+    0x05, 0x08, 0x88, 0x88, 0x8F, 0x48, 0x15, 0x05, 0x07, 0x00, 0x01, 0x0E, 0x08, 0x32, 0x02, 0x1F,
+    0x14, 0x0D, 0x01, 0xC2, 0x6F, 0x05, 0x3F, 0x05, 0x07, 0x00, 0x00, 0x09, 0x04, 0x00, 0x62, 0x5F,
+    0x7E, 0x9E, 0x05, 0x00, 0x04, 0x9F, 0x7F, 0x04, 0xFF, 0x00, 0x54, 0x05, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x6E, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x13, 0xFE, 0xD0, 0x10, 0x05, 0x02, 0x50,
+    0xF0, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x04, 0xC4, 0x27, 0xE0, 0x00, 0x3C, 0x0A, 0x10,
+    0x10, 0xF0, 0x00, 0x60, 0x31, 0xF0, 0x07, 0x03, 0x02, 0x00, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x88,
+    0x88, 0xF8, 0x80, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x87, 0x40, 0x20, 0x1C,
+    0x0F, 0x02, 0x84, 0xFC, 0x6B, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x05, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x05, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x38, 0x04, 0x10, 0xF0, 0x10, 0x00, 0x06, 0x02,
+    0x50, 0x70, 0x3A, 0x01, 0x89, 0x4B, 0x04, 0xC0, 0x42, 0x72, 0xC3, 0x7C, 0x04, 0x01, 0x08, 0x04,
+    0x03, 0x2E, 0x05, 0xD7, 0x22, 0x03, 0xC0, 0x00, 0x44, 0x04, 0x24, 0x30, 0xBF, 0x61, 0x33, 0x03,
+    0xC8, 0x04, 0x82, 0x46, 0x05, 0x04, 0x02, 0x1F, 0x01, 0x06, 0xFF, 0x00, 0x15, 0x06, 0x00, 0x3E,
+    0x01, 0x00, 0x07, 0x18, 0x51, 0x01, 0x8C, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x05,
+    0x64, 0x94, 0xFF, 0x04, 0x00, 0x18, 0x04, 0x64, 0x94, 0xFF, 0x04, 0x20, 0x04, 0x12, 0x32, 0xF2,
+    0x0E, 0x10, 0x05, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0x3F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x02, 0x01, 0x01, 0x1E, 0x05, 0x00, 0x08, 0x08, 0x08,
+    0x08, 0x29, 0x01, 0x42, 0x3E, 0x03, 0x88, 0x71, 0x7E, 0x1B, 0x04, 0xF8, 0x64, 0x14, 0xF8, 0x35,
+    0x01, 0x00, 0x27, 0x04, 0x04, 0x05, 0xF4, 0x34, 0x11, 0x05, 0x08, 0x0B, 0xF8, 0x00, 0x00, 0x06,
+    0x02, 0x01, 0x01, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0x04, 0x76, 0x91, 0x90, 0xF0, 0x0F,
+    0x05, 0x01, 0xA1, 0xA1, 0xE1, 0x01, 0x1E, 0x05, 0x54, 0x52, 0xF1, 0x48, 0x40, 0x05, 0x04, 0x4E,
+    0x49, 0x48, 0xC0, 0x10, 0x04, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0xFC,
+    0x84, 0x00, 0x15, 0x05, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x35, 0x04, 0xC5, 0x29, 0x3D, 0x43, 0x1F,
+    0x04, 0x20, 0x10, 0xFC, 0x03, 0x06, 0x01, 0x42, 0x18, 0x04, 0x82, 0xA2, 0xE2, 0x9C, 0x36, 0x01,
+    0x04, 0x24, 0x01, 0x01, 0x32, 0x05, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x77, 0x08, 0x38, 0x1F, 0x80,
+    0x78, 0x00, 0x90, 0x52, 0x31, 0x55, 0x04, 0xC0, 0x42, 0x72, 0xC3, 0x1F, 0x08, 0x24, 0xA2, 0x61,
+    0x00, 0xC0, 0x43, 0x72, 0xC2, 0x24, 0x03, 0xF3, 0x10, 0xF0, 0x2E, 0x04, 0x41, 0x08, 0x04, 0x03,
+    0x4B, 0x03, 0x07, 0x02, 0x07, 0x1B, 0x03, 0x00, 0x00, 0x00, 0x7D, 0x03, 0x00, 0x80, 0x60, 0xCE,
+    0x01, 0x11, 0x7D, 0x05, 0x3F, 0x25, 0x25, 0x25, 0x00, 0x2E, 0x01, 0x87, 0x7D, 0x04, 0x60, 0x18,
+    0x07, 0x00, 0x7C, 0x03, 0x1C, 0x62, 0xA2, 0x0C, 0x03, 0x8E, 0x92, 0xE6, 0xB3, 0x05, 0x98, 0x70,
+    0xF0, 0x08, 0x00, 0x13, 0x03, 0x00, 0x00, 0x00, 0x65, 0x04, 0x09, 0x08, 0xF8, 0x01, 0x14, 0x03,
+    0x10, 0x10, 0xFC, 0x29, 0x03, 0x00, 0x00, 0x00, 0x6F, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x05, 0x10,
+    0x10, 0xE0, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x04, 0x05, 0x0C, 0x06, 0xFE, 0x00, 0x00, 0x0A, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x03, 0x39, 0x48,
+    0x98, 0x07, 0x04, 0x0A, 0x09, 0x08, 0x08, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x5F, 0x01, 0xC2, 0x03,
+    0x01, 0x00, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x40, 0x89, 0x03, 0xC8, 0x84, 0xC3,
+    0x07, 0x02, 0x00, 0x00, 0x61, 0x08, 0x48, 0x49, 0xFE, 0x40, 0x40, 0x80, 0x70, 0xCF, 0x0B, 0x03,
+    0x11, 0x0C, 0x03, 0x06, 0x04, 0x00, 0x90, 0x90, 0x20, 0x06, 0x05, 0x80, 0xA0, 0xE3, 0xBC, 0xA1,
+    0x55, 0x0A, 0x0C, 0x13, 0x1F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x54, 0x1C, 0x02, 0x00, 0x00,
+    0x7C, 0x01, 0x81, 0x7C, 0x04, 0x10, 0x0C, 0x7E, 0x01, 0xC1, 0x01, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0x04, 0xF8, 0x24, 0x3C, 0xE0, 0x4B, 0x01, 0x88, 0x35, 0x03, 0x00, 0x00,
+    0x00, 0x1B, 0x02, 0x10, 0x20, 0xBD, 0x05, 0x10, 0x10, 0xF1, 0x11, 0x10, 0x7D, 0x01, 0x03, 0x38,
+    0x01, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0x05, 0x8C, 0x06, 0xFE, 0x00, 0x00, 0x0A, 0x04, 0x08, 0x08,
+    0x08, 0x08, 0xFF, 0x00, 0xAE, 0x04, 0x24, 0x25, 0x25, 0xE0, 0x7C, 0x04, 0xF8, 0x04, 0x03, 0xC0,
+    0x23, 0x05, 0xE1, 0x28, 0x3C, 0x23, 0xE0, 0x4A, 0x04, 0xC7, 0x22, 0x27, 0xC0, 0x2D, 0x05, 0x01,
+    0x00, 0x10, 0x0C, 0x03, 0x4A, 0x04, 0x07, 0x08, 0x08, 0x07, 0x1B, 0x02, 0x00, 0x00, 0x33, 0x05,
+    0x82, 0x1F, 0x01, 0x86, 0x80, 0x44, 0x03, 0x00, 0x00, 0xE0, 0x34, 0x05, 0x1F, 0x06, 0x09, 0x10,
+    0x10, 0xFF, 0x00, 0x14, 0x05, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x3C, 0x05, 0xF8, 0x04, 0x02, 0x1C,
+    0x60, 0x7B, 0x05, 0x08, 0x3F, 0xC4, 0x1E, 0x04, 0x0F, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x40, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x01, 0x01, 0x11, 0x01, 0x01, 0x6B, 0x04, 0xF0, 0x50, 0x50, 0x50,
+    0x6D, 0x05, 0xC0, 0xE3, 0x18, 0x00, 0x00, 0x0A, 0x04, 0x03, 0x02, 0x02, 0x02, 0x32, 0x03, 0xF1,
+    0x11, 0xF1, 0x37, 0x0E, 0x61, 0x30, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x05, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x63, 0x03, 0xFC, 0x14,
+    0x1D, 0x16, 0x03, 0x10, 0x10, 0xF0, 0x2E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x04, 0x09, 0x09,
+    0x09, 0x09, 0x2D, 0x01, 0xC8, 0x1C, 0x04, 0xE0, 0x91, 0xF1, 0x80, 0x41, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x36, 0x04, 0xFB, 0x00, 0x00, 0xC3, 0x42, 0x02, 0x60, 0xC0, 0x5B, 0x04, 0x9C, 0x93,
+    0x9F, 0x80, 0x28, 0x05, 0x91, 0x9C, 0x93, 0x90, 0x80, 0x09, 0x05, 0x40, 0x4F, 0xC4, 0x4F, 0x40,
+    0x41, 0x04, 0x00, 0x10, 0x0C, 0x03, 0x29, 0x02, 0x10, 0x0F, 0x0B, 0x03, 0x00, 0x00, 0xCF, 0x20,
+    0x04, 0xAF, 0x23, 0xA4, 0x68, 0x7C, 0x04, 0x18, 0x05, 0x07, 0x08, 0x7C, 0x04, 0x02, 0x02, 0x02,
+    0x02, 0xDF, 0x04, 0xC4, 0x38, 0x3F, 0x00, 0x68, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x84,
+    0x1C, 0x03, 0x69, 0x49, 0x92, 0x41, 0x04, 0x90, 0x50, 0xFD, 0x10, 0x1A, 0x05, 0x80, 0x84, 0x84,
+    0xFC, 0x80, 0x1D, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x06, 0x10, 0x14, 0xFC, 0x14, 0x14, 0x00, 0x2B,
+    0x03, 0x05, 0x06, 0xF7, 0x1D, 0x02, 0xF0, 0x10, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0x01, 0x04, 0x10, 0x03, 0xE1, 0x19, 0x01, 0x0B, 0x04, 0x93, 0x92, 0x92, 0x72, 0x3C, 0x04, 0xE0,
+    0xDF, 0xF0, 0x10, 0x0B, 0x02, 0x10, 0x10, 0x00, 0x00, 0x00, 0x4E, 0x04, 0x8D, 0x42, 0x20, 0x1C,
+    0x41, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x05, 0x10, 0x8A, 0x52, 0x7A, 0x86, 0x7C, 0x04,
+    0x71, 0x6E, 0xF8, 0x08, 0x50, 0x04, 0x06, 0xF9, 0x08, 0x80, 0x0B, 0x03, 0x49, 0x49, 0x91, 0x0D,
+    0x02, 0xE3, 0x20, 0x0B, 0x03, 0x44, 0x73, 0xC1, 0x51, 0x05, 0x43, 0xFA, 0x22, 0x23, 0xE5, 0x0A,
+    0x03, 0x03, 0x02, 0x04, 0x07, 0x08, 0x00, 0xF8, 0x06, 0x01, 0x00, 0x94, 0x97, 0x94, 0x5F, 0x08,
+    0x92, 0x91, 0x9F, 0x81, 0x01, 0xC0, 0x90, 0xCC, 0x0B, 0x0A, 0x20, 0x31, 0xED, 0x27, 0x20, 0x00,
+    0x58, 0x4F, 0xFC, 0x43, 0x19, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x05, 0x97, 0x98, 0x98, 0x97, 0x80,
+    0x28, 0x08, 0x80, 0x90, 0x8C, 0x03, 0x00, 0x11, 0x0C, 0x03, 0x0B, 0x0F, 0x04, 0xE4, 0x07, 0x04,
+    0xE4, 0x00, 0x0C, 0x93, 0x5F, 0x40, 0x00, 0x23, 0x20, 0x20, 0xE7, 0x14, 0x03, 0xA0, 0x40, 0x00,
+    0x1B, 0x02, 0x10, 0x0F, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x0B, 0x04, 0x52, 0x52, 0x5F, 0x40, 0x15,
+    0x09, 0x0E, 0x11, 0x11, 0x0E, 0x00, 0x21, 0x11, 0x0F, 0x09, 0x4F, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xC6, 0x04, 0x1C, 0x03, 0x06, 0x38, 0x62, 0x05, 0x02, 0x72, 0x8A, 0x8E, 0x00, 0x10, 0x04, 0xE4,
+    0x94, 0x8C, 0x00, 0x45, 0x01, 0x00, 0x22, 0x01, 0x02, 0x1D, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x7B,
+    0x05, 0x00, 0x81, 0x60, 0x1E, 0x00, 0x5D, 0x06, 0x01, 0x26, 0x27, 0xE4, 0x24, 0x20, 0x19, 0x01,
+    0x11, 0x61, 0x03, 0x70, 0x94, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5A, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x7B, 0x05, 0xC0, 0xB1, 0x8C, 0xC0,
+    0x00, 0x7E, 0x01, 0x11, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x74, 0x93, 0x91,
+    0xF0, 0x10, 0x03, 0x20, 0xFC, 0xE0, 0x60, 0x02, 0x00, 0x00, 0x06, 0x05, 0x00, 0xC3, 0x84, 0xC4,
+    0x07, 0x63, 0x05, 0x00, 0x91, 0x6D, 0xC7, 0x00, 0x0A, 0x09, 0xE0, 0x70, 0x00, 0xE0, 0x00, 0x50,
+    0xFF, 0x21, 0x20, 0x68, 0x06, 0x00, 0xE3, 0x00, 0x00, 0xE7, 0x04, 0x0D, 0x0A, 0x00, 0x82, 0x01,
+    0x1F, 0x81, 0x81, 0x20, 0x30, 0xEF, 0x40, 0x2D, 0x04, 0x0F, 0xE3, 0x24, 0x08, 0x46, 0x09, 0x9F,
+    0x86, 0x89, 0x10, 0x10, 0x18, 0x06, 0x03, 0x1C, 0x0B, 0x02, 0x47, 0x40, 0x20, 0x05, 0x0C, 0x0B,
+    0x08, 0x0E, 0x10, 0x44, 0x05, 0x12, 0x10, 0x10, 0x1F, 0x10, 0x0F, 0x04, 0x00, 0x1A, 0x12, 0x24,
+    0xFF, 0x00, 0xD7, 0x03, 0xF9, 0x28, 0x38, 0x15, 0x03, 0x00, 0x00, 0x00, 0x29, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x12, 0x92, 0x70, 0x1F, 0x04, 0x04, 0xF4, 0x34, 0x0C, 0x10, 0x01, 0x01,
+    0x17, 0x02, 0xA0, 0xF8, 0x2B, 0x01, 0x1C, 0x04, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1A, 0x04, 0x96, 0x91, 0x90, 0x70, 0x5E, 0x02, 0x48, 0x48, 0x00, 0x00, 0x00, 0x04, 0x05,
+    0x18, 0x07, 0xC4, 0x3C, 0x04, 0x23, 0x04, 0x1C, 0x83, 0x72, 0x0E, 0x15, 0x04, 0x09, 0x89, 0x79,
+    0x0F, 0x37, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x05, 0xFF, 0x08, 0x10, 0x00, 0x00,
+    0x0F, 0x04, 0xC1, 0x31, 0x1F, 0xE2, 0x15, 0x01, 0x01, 0x53, 0x01, 0xB0, 0x12, 0x04, 0x1A, 0x84,
+    0x40, 0x38, 0x46, 0x04, 0x1A, 0x84, 0x40, 0x38, 0x7C, 0x01, 0x01, 0xB0, 0x04, 0xF7, 0x04, 0x04,
+    0xF0, 0x69, 0x04, 0xD1, 0x8D, 0x87, 0xC0, 0x06, 0x04, 0x40, 0x50, 0xFF, 0x40, 0x06, 0x02, 0xF8,
+    0x27, 0x10, 0x05, 0x00, 0xEF, 0x74, 0x0F, 0xE0, 0x46, 0x05, 0x91, 0x0C, 0x03, 0x80, 0x80, 0x0A,
+    0x05, 0x4F, 0x83, 0x01, 0x8F, 0x00, 0x05, 0x05, 0x2C, 0x33, 0x3F, 0xE0, 0x50, 0x18, 0x04, 0x10,
+    0xC8, 0x86, 0x01, 0x14, 0x04, 0xC0, 0x50, 0x4F, 0xC0, 0x2E, 0x05, 0x1F, 0x06, 0x09, 0x10, 0x10,
+    0x0A, 0x03, 0x82, 0x9F, 0xA7, 0x24, 0x03, 0x07, 0x00, 0x01, 0x03, 0x01, 0xF1, 0x11, 0x04, 0x0D,
+    0x12, 0x12, 0x1F, 0x64, 0x09, 0x21, 0x3F, 0x21, 0x00, 0x41, 0x31, 0xAF, 0xBF, 0x00, 0x2D, 0x03,
+    0x00, 0x00, 0x80, 0x4B, 0x05, 0x20, 0x82, 0x4F, 0x3F, 0x02, 0xFF, 0x00, 0x5E, 0x05, 0x00, 0x1A,
+    0x85, 0x40, 0x38, 0x7B, 0x03, 0x00, 0x25, 0x24, 0x12, 0x05, 0x91, 0x7E, 0xC8, 0x49, 0x40, 0x45,
+    0x05, 0x26, 0xA1, 0xFC, 0x20, 0x20, 0x30, 0x05, 0x00, 0xF0, 0x10, 0xF7, 0x00, 0x14, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x03, 0xE2, 0x1A, 0x06, 0x02, 0x03, 0x04, 0xC8,
+    0x28, 0xFE, 0x08, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x11, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0x05, 0x04, 0x84, 0x64, 0x1C, 0x00, 0x22, 0x02, 0x01, 0x01, 0x0D, 0x01,
+    0xF8, 0x23, 0x01, 0xF4, 0x13, 0x08, 0xFC, 0x90, 0x70, 0x00, 0x38, 0x1C, 0x81, 0x78, 0x0A, 0x02,
+    0x39, 0x1C, 0x6F, 0x05, 0xF0, 0x14, 0x1E, 0x11, 0xF0, 0x22, 0x04, 0x40, 0x00, 0x00, 0x00, 0x4B,
+    0x05, 0x10, 0x13, 0xD2, 0xD4, 0x30, 0x28, 0x08, 0xC0, 0xBC, 0xE3, 0x20, 0x00, 0x80, 0xF0, 0x40,
+    0x4C, 0x02, 0x18, 0x07, 0x0E, 0x07, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0xF1,
+    0x7D, 0x07, 0x5F, 0x09, 0x10, 0x2C, 0x2B, 0x2F, 0xE0, 0x40, 0x40, 0xC0, 0x00, 0x10, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0x08, 0x4E, 0x51, 0x51, 0x0E, 0x00, 0xA1, 0x91, 0x8F, 0x0B, 0x03, 0x58,
+    0x46, 0x43, 0x07, 0x04, 0x80, 0x80, 0x80, 0x00, 0x5F, 0x08, 0x02, 0x42, 0x32, 0x0E, 0x00, 0x3F,
+    0x10, 0x3F, 0x0B, 0x04, 0x02, 0x42, 0x32, 0x0E, 0xAC, 0x05, 0x00, 0x7C, 0x12, 0x1E, 0x70, 0x59,
+    0x03, 0x0C, 0x06, 0xFE, 0xC1, 0x05, 0x00, 0x00, 0x88, 0x70, 0x7F, 0x7B, 0x03, 0x00, 0x82, 0x05,
+    0x2A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x05, 0xD0, 0x12, 0xFF, 0xD0, 0x10, 0x49, 0x03, 0x00,
+    0xC0, 0x20, 0x11, 0x05, 0x40, 0x50, 0xF3, 0x50, 0x50, 0x19, 0x09, 0x01, 0x00, 0x07, 0x03, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x01, 0x40, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x67, 0x05, 0x24,
+    0x1F, 0xF2, 0x12, 0x10, 0x22, 0x05, 0x00, 0x82, 0x42, 0x32, 0x0E, 0x56, 0x01, 0x01, 0x24, 0x05,
+    0x84, 0x84, 0xFC, 0x84, 0x84, 0x05, 0x05, 0x00, 0xDC, 0x24, 0x24, 0xFC, 0x28, 0x03, 0x38, 0x90,
+    0x78, 0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x80, 0x70, 0x06, 0x04, 0x08, 0x08,
+    0x08, 0x08, 0x07, 0x03, 0x1D, 0x81, 0x79, 0x28, 0x02, 0x02, 0x01, 0x39, 0x08, 0x00, 0xF8, 0x08,
+    0x80, 0xC0, 0x42, 0x71, 0xC0, 0xFF, 0x00, 0x13, 0x03, 0x8F, 0xF4, 0x03, 0x7D, 0x02, 0x83, 0x43,
+    0x0C, 0x08, 0x81, 0xFF, 0x81, 0x81, 0x00, 0xF0, 0x8F, 0x80, 0x56, 0x02, 0xC6, 0x49, 0x1F, 0x09,
+    0x80, 0xB0, 0x8F, 0x00, 0x00, 0x41, 0x5F, 0x54, 0x13, 0x55, 0x05, 0x18, 0x17, 0x10, 0x1C, 0x20,
+    0x36, 0x03, 0xB1, 0xAF, 0x3F, 0x10, 0x04, 0x02, 0x02, 0x02, 0x02, 0x1C, 0x01, 0x00, 0x33, 0x03,
+    0x7F, 0x21, 0x7F, 0x16, 0x04, 0x34, 0x24, 0x49, 0x00, 0x19, 0x04, 0x37, 0x49, 0x49, 0x7F, 0x10,
+    0x03, 0x00, 0x00, 0x00, 0xAD, 0x05, 0x0C, 0x06, 0xFE, 0x00, 0x00, 0x7D, 0x01, 0x84, 0x70, 0x04,
+    0xF1, 0x50, 0x50, 0x50, 0x09, 0x06, 0x80, 0x61, 0x18, 0x80, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x04, 0x03, 0x02, 0x02, 0x02, 0x09, 0x03, 0x01, 0x71, 0x91, 0x34, 0x03, 0x50,
+    0x50, 0xF0, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x38, 0x08, 0x8E,
+    0x78, 0x34, 0x05, 0x02, 0xE2, 0x1A, 0x06, 0x02, 0x44, 0x01, 0x01, 0x84, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x63, 0x04, 0x10, 0x12, 0xFF, 0xF0, 0x16, 0x02, 0x90, 0xF0, 0x15, 0x05, 0x08, 0x09, 0xF8,
+    0x08, 0x08, 0x07, 0x03, 0x00, 0x00, 0x00, 0x40, 0x04, 0x04, 0x03, 0x02, 0x03, 0x2D, 0x05, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x05, 0x40, 0xF8, 0x20, 0x20, 0xE1, 0x3B, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x67, 0x05, 0x11, 0x0C, 0xF3, 0x00, 0x00, 0x10, 0x03, 0xE0, 0xA0, 0xA0, 0x5E, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0C, 0xE3, 0x80, 0x72, 0x05, 0x01, 0x80, 0x80, 0x80, 0x40, 0x04,
+    0x01, 0x40, 0x11, 0x01, 0x80, 0x44, 0x01, 0x42, 0x24, 0x06, 0x02, 0x02, 0x62, 0x1F, 0x02, 0x02,
+    0x0F, 0x05, 0x0E, 0x01, 0x03, 0x1C, 0x51, 0x40, 0x03, 0x84, 0x47, 0x3C, 0x29, 0x04, 0x66, 0x1C,
+    0x3C, 0x42, 0xFF, 0x00, 0x10, 0x05, 0xFF, 0x84, 0x84, 0x84, 0x00, 0x5E, 0x02, 0x0E, 0x80, 0x1C,
+    0x01, 0x80, 0x60, 0x04, 0x00, 0xF1, 0x50, 0x70, 0x11, 0x05, 0x11, 0x7C, 0xFC, 0x11, 0x00, 0x66,
+    0x04, 0x00, 0x73, 0x90, 0x90, 0x07, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0xF4, 0x12, 0xF1, 0x23,
+    0x05, 0x48, 0x09, 0xE8, 0x6F, 0x1B, 0x00, 0x00, 0x00, 0x31, 0x03, 0x94, 0x94, 0xFC, 0x42, 0x05,
+    0xC4, 0x34, 0xFF, 0x04, 0x04, 0x6B, 0x05, 0x80, 0x84, 0xFC, 0x85, 0x80, 0x0C, 0x01, 0x15, 0x56,
+    0x04, 0x83, 0x63, 0x3E, 0xC4, 0x33, 0x04, 0x51, 0x50, 0xF0, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x04, 0x01, 0x00, 0x00, 0x01, 0x34, 0x02, 0x72, 0xC3, 0x0D, 0x03, 0x48, 0xF8, 0x00,
+    0x2D, 0x04, 0xE3, 0x12, 0x13, 0xE0, 0x37, 0x04, 0x00, 0x00, 0x00, 0x00, 0x41, 0x04, 0x03, 0x04,
+    0x04, 0x03, 0x37, 0x04, 0x90, 0x90, 0x90, 0x80, 0x0B, 0x04, 0xF8, 0x07, 0x00, 0xF0, 0x0A, 0x04,
+    0x00, 0x80, 0x70, 0x0F, 0x0B, 0x04, 0x51, 0x4C, 0xC3, 0x40, 0x23, 0x05, 0xC7, 0x28, 0x28, 0xC7,
+    0x00, 0x37, 0x03, 0x10, 0x08, 0x07, 0x0B, 0x04, 0x06, 0x25, 0x24, 0x2E, 0x0B, 0x03, 0x10, 0xEF,
+    0x81, 0x24, 0x04, 0xC7, 0x48, 0x48, 0xC7, 0x06, 0x03, 0xEF, 0xE3, 0x04, 0x56, 0x03, 0x00, 0x00,
+    0x00, 0x24, 0x05, 0x23, 0x1F, 0x00, 0x00, 0x00, 0x23, 0x02, 0x98, 0x97, 0x15, 0x01, 0x8E, 0x18,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x03, 0x34, 0x24, 0x49, 0x11, 0x08, 0x05, 0xC5, 0x3F, 0x04,
+    0x64, 0x94, 0xFF, 0x04, 0x32, 0x03, 0x4A, 0x4A, 0x7E, 0x9B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x46,
+    0x04, 0x08, 0xFF, 0xA4, 0x9C, 0xC0, 0x05, 0x00, 0x09, 0x08, 0xF8, 0x00, 0x1E, 0x03, 0x39, 0x48,
+    0x98, 0x5A, 0x05, 0x10, 0x21, 0xA1, 0xFD, 0x21, 0x1D, 0x04, 0x02, 0x72, 0x92, 0x93, 0x00, 0x00,
+    0x00, 0x45, 0x04, 0x08, 0x08, 0x08, 0x08, 0x1E, 0x05, 0x6E, 0x92, 0x92, 0xFE, 0x00, 0x59, 0x05,
+    0x09, 0x09, 0xC9, 0x38, 0x00, 0x1F, 0x01, 0x84, 0x0C, 0x03, 0xC0, 0x31, 0x0F, 0x4D, 0x01, 0x91,
+    0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x37, 0x0B, 0x00, 0x24, 0xE2, 0x21, 0x00, 0x00, 0x4C, 0x4B,
+    0xC8, 0x48, 0x40, 0x03, 0x05, 0x20, 0x24, 0xE2, 0x21, 0x20, 0x32, 0x04, 0xF8, 0x00, 0x00, 0xC0,
+    0x23, 0x05, 0x01, 0x28, 0x24, 0x23, 0x20, 0x10, 0x08, 0x04, 0xF7, 0x04, 0x00, 0x00, 0x90, 0x98,
+    0x97, 0x06, 0x03, 0xF0, 0x07, 0x00, 0x1C, 0x03, 0xC4, 0xA4, 0x23, 0x37, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC4, 0x84, 0xC4, 0x04, 0x36, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+    0x08, 0x07, 0x0A, 0x04, 0x07, 0x88, 0x68, 0x07, 0x2A, 0x09, 0x80, 0x80, 0x00, 0x00, 0xB1, 0x4C,
+    0x03, 0x80, 0x00, 0x0F, 0x04, 0x4C, 0x43, 0x43, 0xC0, 0x1E, 0x02, 0x90, 0x88, 0x04, 0x03, 0x80,
+    0x40, 0x40, 0x0E, 0x05, 0x04, 0xC3, 0x5F, 0x40, 0xC0, 0x2E, 0x05, 0x11, 0xC8, 0x44, 0x03, 0x00,
+    0x0F, 0x04, 0x50, 0x48, 0x46, 0x01, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x06, 0x10, 0x10,
+    0x9F, 0x10, 0x10, 0x00, 0x13, 0x04, 0x4D, 0x52, 0x52, 0xDF, 0x4B, 0x05, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0x2C, 0x04, 0x31, 0x0A, 0x0F, 0x10, 0xD0, 0x09, 0xF8, 0x04, 0x02, 0x1C, 0x61, 0x81, 0x7D,
+    0x0D, 0x03, 0x0A, 0x04, 0x00, 0xFC, 0x14, 0x1C, 0x6E, 0x01, 0x01, 0xFF, 0x00, 0x30, 0x06, 0xFC,
+    0x20, 0x42, 0x01, 0x00, 0x00, 0x32, 0x03, 0x23, 0xA2, 0x62, 0x41, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x08, 0xE8, 0x68, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x1E, 0x02, 0x03, 0xC2, 0x3E,
+    0x7D, 0x01, 0xE3, 0x20, 0x04, 0x12, 0x32, 0xF2, 0x0E, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x03, 0xFD, 0x14, 0x1C, 0x8B, 0x04, 0x70, 0x10, 0x1C, 0xF0, 0x42, 0x04, 0x25, 0x24, 0x24, 0xE0,
+    0x37, 0x02, 0x02, 0x01, 0x35, 0x05, 0x24, 0xE3, 0x20, 0x00, 0x00, 0x09, 0x03, 0x70, 0x94, 0x93,
+    0x47, 0x03, 0xF1, 0x11, 0xF1, 0x25, 0x03, 0x94, 0x97, 0x94, 0x55, 0x03, 0x07, 0x02, 0x07, 0x33,
+    0x04, 0x11, 0x1C, 0xF3, 0x20, 0x0B, 0x04, 0x91, 0x9D, 0x97, 0x80, 0x06, 0x04, 0x17, 0x18, 0xF8,
+    0x27, 0x37, 0x03, 0x00, 0x00, 0x00, 0x29, 0x04, 0x0C, 0xE3, 0x81, 0x8E, 0x0B, 0x04, 0x80, 0x90,
+    0x8C, 0x03, 0x06, 0x04, 0x0C, 0x03, 0x01, 0x0E, 0x37, 0x03, 0x40, 0x40, 0x40, 0xFF, 0x00, 0x82,
+    0x05, 0x68, 0x0A, 0xFE, 0x8A, 0x8A, 0x4A, 0x04, 0x04, 0x9F, 0x7F, 0x04, 0x06, 0x04, 0x82, 0x42,
+    0x32, 0x0E, 0x72, 0x01, 0x01, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x82, 0x04, 0x31, 0xE0, 0xE0, 0x10, 0x1E, 0x04, 0xF1, 0x50,
+    0x50, 0x51, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x73, 0x90, 0x91, 0xF2, 0x1E, 0x04,
+    0x03, 0x02, 0x02, 0x02, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0xC0, 0xB8, 0xE0,
+    0x14, 0x04, 0x20, 0x23, 0xA4, 0xE4, 0x2E, 0x03, 0xD0, 0x20, 0x00, 0x4C, 0x03, 0x17, 0x18, 0xF8,
+    0x24, 0x04, 0x47, 0xF8, 0x28, 0x27, 0x39, 0x02, 0xC8, 0x87, 0x2F, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0x43, 0x41, 0xCE, 0x09, 0x06, 0x00, 0xC2, 0x41, 0x5F, 0xC1, 0x01, 0x28, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x05, 0x07, 0x00, 0x01, 0x0E, 0x08, 0x0A, 0x03, 0xE1, 0xD1, 0x0F, 0x1F, 0x09,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x01, 0x37, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x03, 0x47, 0x3F, 0x00, 0x03, 0x01, 0x00, 0x71, 0x01, 0x0C, 0x0B, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x00, 0x09,
+    0x09, 0xF9, 0x09, 0x08, 0x82, 0x42, 0x32, 0x0E, 0x78, 0x01, 0x01, 0x11, 0x04, 0x8D, 0x42, 0x20,
+    0x1C, 0x8B, 0x03, 0x80, 0x60, 0x1E, 0x55, 0x05, 0x80, 0x61, 0x18, 0x80, 0x00, 0x0A, 0x04, 0xF1,
+    0x50, 0x50, 0x50, 0x15, 0x01, 0x01, 0x43, 0x01, 0x00, 0x13, 0x05, 0x01, 0x21, 0xA1, 0x63, 0x00,
+    0x09, 0x05, 0x00, 0x73, 0x92, 0x92, 0xF2, 0x59, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x4E, 0x04, 0xFC,
+    0x14, 0x1C, 0x00, 0x05, 0x05, 0x00, 0x04, 0xF4, 0x1C, 0x04, 0x0B, 0x05, 0x04, 0x84, 0x7F, 0x04,
+    0x04, 0x13, 0x01, 0x84, 0x4D, 0x04, 0x00, 0x94, 0x94, 0xFC, 0x17, 0x01, 0xFD, 0x47, 0x05, 0x08,
+    0x08, 0xF8, 0x08, 0x08, 0x0F, 0x04, 0x12, 0x12, 0x13, 0xFE, 0x06, 0x02, 0x82, 0x62, 0x62, 0x01,
+    0x01, 0x11, 0x04, 0x11, 0x11, 0xFF, 0xF1, 0x1E, 0x04, 0x24, 0x26, 0x25, 0xFC, 0x25, 0x05, 0x51,
+    0x51, 0xF1, 0x49, 0x40, 0x52, 0x04, 0x02, 0x02, 0x02, 0x03, 0x25, 0x03, 0x10, 0xDC, 0xD3, 0x19,
+    0x04, 0x00, 0x03, 0x04, 0xF4, 0x7D, 0x04, 0x0C, 0x03, 0xC0, 0x30, 0x0B, 0x04, 0x11, 0x8D, 0x67,
+    0x00, 0x6D, 0x04, 0x02, 0xE1, 0x9F, 0x80, 0x0A, 0x05, 0x04, 0x83, 0x9F, 0x80, 0x00, 0x14, 0x04,
+    0x02, 0xE1, 0x3F, 0x01, 0x47, 0x02, 0x21, 0x91, 0x33, 0x05, 0x4C, 0x4B, 0x48, 0xCE, 0x10, 0x45,
+    0x04, 0x32, 0x4A, 0x7F, 0x02, 0x24, 0x03, 0x21, 0x3F, 0x21, 0x38, 0x03, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x02, 0x05, 0x46, 0x22, 0xFB, 0x16, 0x60, 0x1E, 0x04, 0xFC, 0x94, 0x94, 0x94, 0x28, 0x05,
+    0x39, 0x06, 0x0C, 0x70, 0x40, 0x2E, 0x01, 0x01, 0x69, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
+    0x05, 0x00, 0x01, 0xFC, 0x00, 0xC0, 0x2E, 0x03, 0xE0, 0x18, 0x00, 0x41, 0x04, 0xE4, 0xDE, 0xF1,
+    0x10, 0x05, 0x05, 0x00, 0x26, 0xE3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x19, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x05, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x60, 0x01, 0x80, 0x1B, 0x02, 0x02, 0x01,
+    0xCB, 0x05, 0x10, 0x10, 0xD7, 0xD0, 0x30, 0x1A, 0x05, 0x43, 0x44, 0xFC, 0x43, 0x40, 0x13, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x97, 0x92, 0x97, 0xF0, 0x2D, 0x03, 0x58, 0xFF, 0x20, 0x1C,
+    0x04, 0x10, 0xFF, 0x2F, 0x08, 0x13, 0x04, 0xC0, 0x00, 0x80, 0x40, 0x15, 0x03, 0x10, 0x08, 0x07,
+    0x33, 0x04, 0x82, 0x81, 0x9F, 0x00, 0x7C, 0x04, 0x5F, 0x42, 0x43, 0x00, 0x11, 0x01, 0x00, 0x7D,
+    0x04, 0x10, 0x80, 0x80, 0x00, 0x82, 0x04, 0x66, 0x1C, 0x3C, 0x42, 0x37, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x1D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x31, 0x1F, 0xE2, 0x01, 0xFF, 0x00,
+    0x01, 0x04, 0x1C, 0x0E, 0xC0, 0x3C, 0x7C, 0x02, 0x02, 0x01, 0x12, 0x04, 0x71, 0x6E, 0xF8, 0x08,
+    0x7C, 0x01, 0x24, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x04, 0x0F,
+    0x80, 0x70, 0x0F, 0x19, 0x09, 0xFF, 0x40, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x01,
+    0x20, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x13, 0xFE, 0x05, 0x10, 0x10, 0xF1, 0x10,
+    0x10, 0x7D, 0x01, 0x03, 0x1B, 0x03, 0x23, 0xA2, 0x62, 0x16, 0x04, 0x72, 0x3A, 0x03, 0xF0, 0x0B,
+    0x05, 0x49, 0x49, 0xC9, 0x49, 0x40, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x36, 0x03, 0x07, 0x04,
+    0x04, 0x16, 0x03, 0x08, 0x04, 0x03, 0x0C, 0x02, 0x90, 0x98, 0x1C, 0x03, 0xC0, 0x80, 0x80, 0x8A,
+    0x01, 0x20, 0x23, 0x05, 0x8C, 0x83, 0xF1, 0x8E, 0x80, 0x44, 0x05, 0x80, 0x87, 0x80, 0x81, 0x8E,
+    0x0B, 0x05, 0x01, 0xA1, 0x1F, 0x01, 0x01, 0x17, 0x04, 0x90, 0x90, 0xFF, 0x90, 0x07, 0x04, 0x18,
+    0x26, 0x3F, 0x00, 0x45, 0x05, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x27, 0x06, 0x10, 0x08, 0x7E, 0x05,
+    0x18, 0x00, 0x16, 0x01, 0x90, 0x70, 0x01, 0xBC, 0x0B, 0x05, 0x05, 0xC5, 0x3F, 0x04, 0x04, 0x47,
+    0x01, 0xC2, 0x16, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x05, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x36, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x13, 0x0A, 0x42, 0x42, 0x7F, 0x42, 0x42, 0x1E, 0x02, 0x03, 0xC2,
+    0x3E, 0x25, 0x01, 0x01, 0x3A, 0x07, 0x7E, 0x00, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x16, 0x01, 0x01,
+    0x33, 0x03, 0x08, 0xF8, 0x08, 0x30, 0x02, 0x02, 0x01, 0x33, 0x04, 0xE1, 0x90, 0xF0, 0x80, 0x13,
+    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x03, 0x00, 0x00, 0x00, 0x47, 0x04, 0x03, 0x00, 0x00,
+    0x03, 0x31, 0x03, 0x00, 0x40, 0x40, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x8E,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x04, 0x04, 0x12, 0x32,
+    0xF2, 0x0E, 0x2D, 0x01, 0xFC, 0x46, 0x01, 0x12, 0xFE, 0x04, 0xC3, 0x32, 0x63, 0x80, 0x55, 0x05,
+    0x24, 0x27, 0x24, 0xE0, 0x00, 0x22, 0x05, 0xC1, 0x00, 0x80, 0x43, 0x42, 0x54, 0x03, 0x88, 0x64,
+    0x03, 0x24, 0x04, 0x1F, 0x13, 0xF4, 0x28, 0x09, 0x05, 0xC0, 0x67, 0xE8, 0x08, 0x07, 0x06, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x04, 0x50, 0x88, 0x07, 0x80, 0x1B, 0x03, 0xFF, 0x80, 0x80,
+    0x22, 0x05, 0x00, 0xEF, 0x20, 0x00, 0x00, 0x05, 0x05, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x2D, 0x05,
+    0x82, 0x9F, 0xA7, 0x81, 0x00, 0x18, 0x03, 0x58, 0x66, 0x7F, 0x6D, 0x01, 0x0E, 0x23, 0x02, 0x00,
+    0x00, 0x57, 0x03, 0x04, 0x04, 0x04, 0x24, 0x03, 0x00, 0x00, 0x00, 0xC1, 0x06, 0x00, 0x02, 0xE2,
+    0x1A, 0x06, 0x02, 0x18, 0x02, 0x00, 0x00, 0x21, 0x05, 0xF8, 0x04, 0x03, 0x1C, 0x60, 0x36, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x05, 0x10, 0x14, 0xFC, 0x14, 0x14, 0x55, 0x01, 0x08, 0x12, 0x04, 0x00,
+    0x39, 0x48, 0x98, 0x11, 0x07, 0x01, 0x01, 0x01, 0x00, 0xFA, 0x09, 0xF8, 0x64, 0x03, 0x02, 0x22,
+    0xA2, 0x16, 0x03, 0x03, 0x01, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x36,
+    0x05, 0x38, 0x08, 0x8E, 0x78, 0x00, 0x0F, 0x04, 0x42, 0x42, 0x42, 0x42, 0x29, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01,
+    0xF9, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2E, 0x01, 0x40, 0x17, 0x01, 0x84, 0x33,
+    0x01, 0x08, 0x3B, 0x04, 0x10, 0xF0, 0x10, 0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05,
+    0x08, 0x88, 0xEE, 0x59, 0x80, 0x33, 0x04, 0x52, 0x53, 0xF2, 0x48, 0x1F, 0x03, 0xFB, 0x00, 0x80,
+    0x06, 0x03, 0x50, 0x50, 0xF0, 0x19, 0x05, 0x01, 0x00, 0x07, 0x00, 0x01, 0x55, 0x04, 0x0C, 0x07,
+    0x02, 0x01, 0x32, 0x02, 0x88, 0x64, 0x7D, 0x04, 0x06, 0x05, 0x04, 0x0E, 0x0B, 0x02, 0xF0, 0x90,
+    0x7E, 0x03, 0x0F, 0x00, 0x01, 0xCD, 0x04, 0x22, 0x22, 0x3E, 0x20, 0xFF, 0x00, 0x0A, 0x05, 0x60,
+    0x58, 0x46, 0xE0, 0x00, 0x7C, 0x05, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x6D, 0x03, 0x1C, 0x24, 0xCC,
+    0x0C, 0x01, 0xF9, 0x2B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x09, 0x08, 0x3B, 0x04,
+    0x01, 0x01, 0x01, 0x01, 0x0A, 0x04, 0x11, 0x11, 0xFF, 0xF1, 0x2A, 0x09, 0x20, 0xA0, 0xFC, 0x20,
+    0x20, 0x01, 0x01, 0x01, 0x01, 0x49, 0x04, 0x04, 0x03, 0x02, 0x03, 0x1B, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x31, 0x04, 0x1C, 0xC8, 0x3C, 0x00, 0x7C, 0x04, 0x85, 0xFC, 0x84, 0x00, 0x72,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x38, 0x04, 0x01, 0x30,
+    0x39, 0x05, 0x00, 0x12, 0xD1, 0x70, 0x10, 0x7B, 0x04, 0x00, 0x74, 0x3B, 0x00, 0x0C, 0x05, 0x21,
+    0xF9, 0xF9, 0x21, 0x00, 0x53, 0x02, 0x87, 0x64, 0x26, 0x03, 0x98, 0x94, 0x93, 0x1B, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x35, 0x0B, 0x06, 0x05, 0x04, 0x0E, 0x00, 0x00, 0x47, 0x48, 0xF8, 0x47, 0x40,
+    0x3C, 0x04, 0x40, 0x80, 0x00, 0x80, 0x2E, 0x04, 0x43, 0x41, 0x8E, 0x00, 0x09, 0x05, 0xE7, 0xE0,
+    0x1F, 0x0F, 0x08, 0x05, 0x02, 0x00, 0x00, 0x66, 0x04, 0x0F, 0x16, 0x11, 0x0F, 0x0A, 0x05, 0x63,
+    0x5F, 0x40, 0xC0, 0x00, 0x05, 0x02, 0x00, 0x00, 0x30, 0x01, 0x90, 0x7F, 0x04, 0x46, 0x21, 0x10,
+    0x0E, 0x81, 0x04, 0xFE, 0x42, 0xFE, 0x00, 0x28, 0x03, 0x00, 0x00, 0x00, 0x51, 0x04, 0x04, 0xF4,
+    0x1C, 0x04, 0x1E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x0D, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x38,
+    0xB7, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x74, 0x01, 0x03, 0x03, 0x05, 0x02, 0x01, 0x00, 0x00,
+    0xF0, 0x22, 0x05, 0xF1, 0xC1, 0x21, 0x10, 0x10, 0x36, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+    0x04, 0xFB, 0x01, 0x03, 0xC0, 0x0B, 0x04, 0x0B, 0x88, 0xF8, 0x13, 0x06, 0x05, 0x03, 0x00, 0x01,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x6C, 0x05, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x05, 0x05, 0x69, 0x49,
+    0x92, 0x00, 0x00, 0x04, 0x01, 0xC0, 0x0A, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x40, 0x05, 0x38, 0x06,
+    0x0C, 0x70, 0x40, 0x24, 0x01, 0x30, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x03,
+    0x00, 0x00, 0x00, 0x29, 0x01, 0xE8, 0x05, 0x01, 0x50, 0x4C, 0x05, 0x00, 0x00, 0xC0, 0x3C, 0x00,
+    0x90, 0x04, 0x6C, 0x13, 0x00, 0xE0, 0x46, 0x05, 0x4C, 0x47, 0xFA, 0x41, 0x40, 0x0E, 0x06, 0x90,
+    0x91, 0x90, 0xF0, 0x03, 0x02, 0x1D, 0x03, 0x84, 0x62, 0x01, 0x47, 0x05, 0x07, 0x00, 0x1F, 0x0F,
+    0x08, 0x0E, 0x06, 0x08, 0x18, 0x18, 0xFF, 0x20, 0x00, 0x1C, 0x05, 0xE6, 0x25, 0x3C, 0x2E, 0xE0,
+    0x40, 0x06, 0xE1, 0x82, 0x81, 0x9F, 0x00, 0x00, 0x13, 0x05, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x1D,
+    0x05, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x40, 0x04, 0x1F, 0x50, 0x50, 0x50, 0x15, 0x05, 0x20, 0x18,
+    0x17, 0x1F, 0x00, 0xDD, 0x02, 0x21, 0x21, 0xFF, 0x00, 0x04, 0x05, 0x40, 0x31, 0xF8, 0x06, 0x00,
+    0x7D, 0x01, 0x0F, 0x2E, 0x05, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x33, 0x04, 0xB9, 0x48, 0x48, 0xF8,
+    0x0F, 0x04, 0x30, 0xE1, 0xE1, 0x11, 0x33, 0x02, 0x41, 0x00, 0x25, 0x03, 0x11, 0x11, 0xF1, 0x0B,
+    0x05, 0x00, 0x21, 0xA2, 0x62, 0x03, 0x0F, 0x04, 0x03, 0x00, 0x01, 0x02, 0x19, 0x05, 0x10, 0x13,
+    0xF0, 0x11, 0x12, 0x0A, 0x04, 0xE3, 0x12, 0x13, 0xE0, 0x05, 0x06, 0x03, 0x20, 0xFC, 0x90, 0x90,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x03, 0x1C, 0x80, 0x78, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x04, 0x70, 0x90,
+    0x90, 0xF0, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x41, 0x40, 0xF7, 0x40, 0x61,
+    0x02, 0xB8, 0xE0, 0x19, 0x03, 0x06, 0x09, 0x0F, 0xFF, 0x00, 0x9D, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x32, 0x03, 0x82, 0xC2, 0xB2, 0x2E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x04, 0x04, 0x84, 0x64,
+    0x1C, 0xFF, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x04, 0x70, 0x90, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x31, 0x04,
+    0x38, 0x08, 0x8E, 0x78, 0x48, 0x01, 0xF8, 0x26, 0x02, 0x1F, 0xFF, 0x07, 0x06, 0x38, 0x08, 0x8E,
+    0x78, 0x00, 0x01, 0x0E, 0x04, 0xC0, 0xB1, 0x8C, 0xC0, 0x5F, 0x01, 0x01, 0x09, 0x01, 0x1B, 0x0E,
+    0x03, 0x00, 0x00, 0x00, 0x04, 0x01, 0x01, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x02, 0x00,
+    0x00, 0x2F, 0x03, 0x40, 0x70, 0xC0, 0x1F, 0x03, 0x20, 0xE0, 0x20, 0x29, 0x01, 0xF0, 0x22, 0x04,
+    0x41, 0x41, 0x41, 0x41, 0x7C, 0x03, 0x90, 0x90, 0x90, 0x38, 0x04, 0x47, 0xF0, 0xFF, 0x4F, 0x18,
+    0x05, 0x46, 0x45, 0xC4, 0x4E, 0x40, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x03, 0x10, 0x09,
+    0x07, 0x1B, 0x01, 0x0F, 0x17, 0x04, 0x40, 0x50, 0xCC, 0x23, 0x29, 0x04, 0x80, 0x80, 0x80, 0x80,
+    0x4F, 0x05, 0x01, 0x31, 0x0F, 0x01, 0x01, 0xBA, 0x04, 0x00, 0x72, 0x4A, 0x46, 0x64, 0x05, 0x80,
+    0x84, 0xFC, 0x84, 0x80, 0xFF, 0x00, 0x02, 0x04, 0x41, 0x20, 0xF8, 0x06, 0x1E, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x5A, 0x0E, 0xB8, 0x48, 0x4B, 0xF8, 0x00, 0x20, 0xFF, 0x10, 0x78, 0x10, 0x0A, 0x09,
+    0x08, 0x08, 0x0A, 0x04, 0x06, 0xC5, 0x7C, 0x88, 0x06, 0x04, 0x10, 0x7C, 0xFC, 0x10, 0x18, 0x05,
+    0x01, 0xF1, 0xC9, 0x29, 0xF1, 0x44, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x03,
+    0x00, 0x00, 0xC3, 0x22, 0x05, 0x00, 0xE1, 0x12, 0x12, 0xE1, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x05, 0x00, 0x09, 0x89, 0x79, 0x0F, 0x7C, 0x01, 0x11, 0x0E, 0x04,
+    0xD3, 0x92, 0x24, 0x00, 0x54, 0x04, 0xE1, 0x90, 0xF0, 0x81, 0x15, 0x04, 0x02, 0xFD, 0x00, 0xC0,
+    0x0B, 0x03, 0x08, 0xF8, 0x09, 0x05, 0x02, 0xFC, 0x10, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0x04, 0x73, 0x90, 0x30, 0x03, 0x15, 0x03, 0x6E, 0x13, 0x01, 0x14, 0x02, 0x03, 0x02, 0x2C, 0x04,
+    0x00, 0x00, 0xF0, 0x00, 0x1D, 0x04, 0x04, 0x84, 0x64, 0x07, 0xFF, 0x00, 0xFF, 0x00, 0x49, 0x05,
+    0x06, 0x03, 0x7F, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x00, 0x7C, 0x82,
+    0x82, 0x7C, 0x1D, 0x05, 0x02, 0x72, 0x8A, 0x8E, 0x00, 0xE9, 0x04, 0xF9, 0x28, 0x28, 0x28, 0x28,
+    0x03, 0x00, 0x00, 0x00, 0x51, 0x04, 0xB9, 0x49, 0x49, 0xF9, 0x28, 0x01, 0x70, 0x11, 0x05, 0x61,
+    0x1F, 0x11, 0xF1, 0x11, 0x4B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x13, 0xF0, 0x11, 0x12, 0x28,
+    0x05, 0x24, 0xA3, 0xFC, 0x20, 0x20, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0x04, 0x6E, 0x92, 0x92, 0xFE, 0x34, 0x01, 0xE2, 0x68, 0x07, 0x80, 0x85, 0xFC, 0x84, 0x80,
+    0x42, 0x42, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0A, 0x00, 0x09, 0xF8, 0x08, 0x00, 0x00,
+    0x09, 0x3E, 0xFE, 0x08, 0x1A, 0x04, 0xE0, 0x18, 0x31, 0xC0, 0x0B, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x10, 0x10, 0xFE, 0xF0, 0x1E, 0x08, 0x01, 0x01, 0xFD,
+    0x01, 0xC1, 0x00, 0x02, 0x01, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x01, 0x01, 0x0A,
+    0x07, 0x20, 0xE0, 0x20, 0x00, 0x00, 0x20, 0xE0, 0x33, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x04, 0x00,
+    0x20, 0x20, 0x20, 0x29, 0x05, 0xEC, 0x27, 0x22, 0xE1, 0x00, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x0D, 0x44, 0x27, 0xC0, 0x00, 0xC0, 0x20, 0x20, 0xC0, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x0B,
+    0x04, 0x44, 0x42, 0xC1, 0x40, 0x46, 0x05, 0x46, 0xF9, 0xF9, 0x4F, 0x00, 0x05, 0x03, 0x00, 0x80,
+    0x60, 0x0F, 0x06, 0x40, 0x4F, 0xC0, 0x40, 0x41, 0x06, 0x06, 0x03, 0x10, 0x0C, 0x03, 0x0A, 0x04,
+    0xE0, 0x30, 0x3F, 0x21, 0x47, 0x04, 0x50, 0x89, 0x07, 0x80, 0x7C, 0x04, 0x02, 0x1F, 0x27, 0x01,
+    0x10, 0x04, 0xD8, 0x17, 0x1F, 0xC0, 0x20, 0x01, 0xEF, 0x25, 0x03, 0x10, 0x9F, 0x90, 0x33, 0x04,
+    0x43, 0x20, 0x1C, 0x03, 0x1E, 0x05, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0x0A, 0x04, 0x3F, 0x25, 0x25,
+    0x25, 0x15, 0x04, 0x82, 0x4F, 0x3F, 0x02, 0x93, 0x04, 0xFF, 0x84, 0x84, 0x84, 0x28, 0x06, 0x00,
+    0x09, 0x09, 0xF9, 0x09, 0x08, 0x2D, 0x05, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x4A, 0x01, 0x85, 0x57,
+    0x04, 0x00, 0xFF, 0x80, 0x60, 0x7C, 0x01, 0x07, 0x18, 0x05, 0x29, 0x29, 0xF9, 0x24, 0x20, 0x7B,
+    0x05, 0x10, 0xF6, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0xFF, 0x08, 0x10, 0x00, 0x00,
+    0x55, 0x04, 0x87, 0x40, 0x20, 0x1C, 0xB1, 0x04, 0xC0, 0xB1, 0x8C, 0xC0, 0x15, 0x01, 0xF0, 0x44,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x05, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x14, 0x01, 0x11, 0x26,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0xE0, 0x13, 0x10, 0xE0, 0x0F, 0x04, 0x00, 0xC0,
+    0x30, 0x60, 0x06, 0x03, 0xC3, 0x30, 0x00, 0x57, 0x01, 0xD0, 0x05, 0x07, 0x00, 0x00, 0x00, 0xE0,
+    0x23, 0x25, 0xE4, 0x18, 0x03, 0x03, 0x82, 0x42, 0x17, 0x04, 0xC4, 0x82, 0xC1, 0x00, 0x41, 0x02,
+    0x00, 0x00, 0x39, 0x03, 0x31, 0x3C, 0x23, 0x63, 0x05, 0x40, 0x40, 0xCF, 0x40, 0x40, 0x42, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x35, 0x05, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x3C, 0x03, 0x8A, 0x0F, 0x10, 0x7C, 0x05, 0x87, 0x43, 0x30, 0x0F, 0x00, 0x4E, 0x04, 0x42,
+    0x42, 0x42, 0xFE, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x05, 0xF8, 0x04, 0x02, 0x1C, 0x60,
+    0xFF, 0x00, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x56, 0x06,
+    0xF8, 0x07, 0x80, 0x00, 0xC1, 0x31, 0x16, 0x03, 0xE0, 0xDC, 0xF0, 0x07, 0x03, 0x20, 0xE0, 0x20,
+    0x00, 0x00, 0x00, 0x36, 0x05, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x3E, 0x06, 0x00, 0x04, 0x84, 0x7F,
+    0x04, 0x04, 0x39, 0x01, 0x01, 0x32, 0x04, 0x02, 0x72, 0x8A, 0x8E, 0x0B, 0x02, 0x84, 0xFD, 0x6A,
+    0x07, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x0D, 0x04, 0xF8, 0x28, 0x28, 0x28, 0x6A, 0x01,
+    0xFD, 0x03, 0x05, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x03,
+    0x48, 0x48, 0x90, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x4E, 0x4B, 0x49, 0xC0, 0x00,
+    0x00, 0x06, 0x01, 0x0F, 0x02, 0xC3, 0x3E, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02,
+    0x04, 0x38, 0x05, 0x90, 0x90, 0xF0, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04,
+    0xC0, 0x88, 0xC6, 0x01, 0x14, 0x01, 0x08, 0x05, 0x04, 0xC0, 0x80, 0xC0, 0x00, 0x4A, 0x04, 0x40,
+    0x40, 0xF8, 0x40, 0xDA, 0x04, 0x82, 0x9F, 0xA7, 0x81, 0x10, 0x04, 0x18, 0xD7, 0x1F, 0x00, 0x47,
+    0x02, 0xDF, 0x10, 0x1F, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x60, 0x3F, 0x10, 0x0C, 0x1D,
+    0x01, 0x80, 0x28, 0x04, 0x8E, 0x6D, 0x3F, 0x01, 0x53, 0x03, 0x7F, 0x04, 0x08, 0x00, 0x00, 0x00,
+    0x62, 0x05, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x04,
+    0xCD, 0x38, 0x78, 0x84, 0xFB, 0x05, 0x00, 0x90, 0x51, 0x30, 0x00, 0x19, 0x04, 0x49, 0xF0, 0xE0,
+    0x31, 0x23, 0x05, 0x00, 0x10, 0xF0, 0x11, 0x00, 0x1F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x03, 0xE3, 0x12, 0x12, 0x1A, 0x04, 0xC0, 0x33, 0x04, 0x00, 0x15, 0x04, 0x96,
+    0xE3, 0xC1, 0x60, 0x0A, 0x05, 0x00, 0x22, 0xC3, 0xFA, 0x00, 0x1F, 0x08, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x87, 0xC9, 0x00, 0x0B,
+    0x03, 0x96, 0x91, 0x91, 0x35, 0x02, 0x00, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x06, 0x04, 0x00, 0x10,
+    0x10, 0xF0, 0x12, 0x01, 0xFC, 0x51, 0x03, 0x80, 0x80, 0x80, 0x0B, 0x03, 0x00, 0x80, 0x80, 0x1B,
+    0x02, 0x0C, 0x03, 0xFF, 0x00, 0x1D, 0x01, 0xBF, 0x24, 0x01, 0x80, 0x5A, 0x04, 0x7F, 0x20, 0x30,
+    0x0C, 0x1F, 0x05, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x7C, 0x02, 0x7E, 0x43, 0x0F, 0x05, 0x04, 0x05,
+    0xFC, 0x04, 0x04, 0x15, 0x05, 0x0E, 0x87, 0x61, 0x1E, 0x00, 0x13, 0x03, 0x00, 0x00, 0x00, 0x4D,
+    0x01, 0xFE, 0x0D, 0x04, 0x38, 0xB7, 0xFC, 0x04, 0x06, 0x05, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x4F,
+    0x05, 0x10, 0xD3, 0x70, 0x10, 0x00, 0x1D, 0x02, 0xE2, 0x91, 0x07, 0x04, 0x00, 0x28, 0x2B, 0xF8,
+    0x51, 0x03, 0x04, 0xFB, 0x00, 0x24, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x20, 0x24, 0xE3, 0x20,
+    0x20, 0x00, 0x00, 0x00,
+};
+// clang-format on
+#elif OLED_MATRIX_SIZE == 1024
+// 72 frames, 2 keyframes: 7868 bytes, from 73800 bytes raw
+#    define SCREENSAVER_FRAME_COUNT 72
+#    define SCREENSAVER_FRAME_SIZE  1024
+#    define SCREENSAVER_DATA_SIZE   7868
+#    define SCREENSAVER_LOOP_OFFSET 474
+
+// clang-format off
+static const uint8_t screensaver_data[SCREENSAVER_DATA_SIZE] PROGMEM = {
+    0x01, 0x0A, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x23, 0x0A, 0x1C, 0xC8, 0x3C, 0x00, 0x00, 0x74, 0x04,
+    0xFF, 0xF4, 0x84, 0x13, 0x04, 0xFF, 0x40, 0x60, 0x18, 0x05, 0x03, 0xFF, 0x08, 0x10, 0x08, 0x0F,
+    0x38, 0x06, 0x0C, 0x70, 0x40, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x05,
+    0x0A, 0x69, 0x49, 0x92, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0, 0x0A, 0x04, 0x09, 0x89, 0x79,
+    0x0F, 0x23, 0x04, 0xCD, 0x38, 0x78, 0x84, 0x03, 0x01, 0x01, 0x15, 0x05, 0x38, 0x06, 0x0C, 0x70,
+    0x40, 0x05, 0x03, 0xFC, 0x14, 0x1C, 0x0C, 0x08, 0x09, 0x89, 0x79, 0x0F, 0x02, 0x72, 0x8A, 0x8E,
+    0x06, 0x0B, 0x38, 0x08, 0x8E, 0x78, 0x80, 0x84, 0xFD, 0x84, 0x80, 0x42, 0x42, 0x09, 0x0A, 0xC0,
+    0xB1, 0x8C, 0xC0, 0x00, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x1D, 0x05, 0x08, 0x08, 0xF8, 0x08, 0x08,
+    0x19, 0x04, 0x82, 0x62, 0x3E, 0xC4, 0x06, 0x05, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x0A, 0x09, 0xF9,
+    0x64, 0x14, 0xF8, 0x00, 0x08, 0x3E, 0xFE, 0x08, 0x06, 0x0A, 0xD3, 0x92, 0x24, 0x00, 0xF8, 0x28,
+    0x28, 0x28, 0x00, 0xF0, 0x0A, 0x08, 0xE0, 0x18, 0x31, 0xC0, 0x00, 0x10, 0xF0, 0x10, 0x1F, 0x03,
+    0x90, 0x51, 0x30, 0x1A, 0x04, 0x49, 0xF0, 0xE0, 0x31, 0x05, 0x05, 0x08, 0x88, 0xEE, 0x59, 0x80,
+    0x0C, 0x09, 0xFD, 0x01, 0xC0, 0x00, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x05, 0x0A, 0x10, 0xF0, 0x11,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0xFC, 0x11, 0x0A, 0x0A, 0x48, 0x48, 0x90, 0x01, 0x01, 0x52, 0x53,
+    0xF2, 0x48, 0x40, 0x1D, 0x04, 0xE3, 0x12, 0x12, 0xE0, 0x19, 0x03, 0xC0, 0x33, 0x04, 0x06, 0x05,
+    0x41, 0x40, 0xF7, 0x40, 0x01, 0x0B, 0x08, 0x96, 0xE3, 0xC1, 0x60, 0x00, 0x00, 0x06, 0x01, 0x07,
+    0x03, 0x22, 0xC3, 0xFA, 0x05, 0x02, 0xC3, 0x3E, 0x0A, 0x09, 0x03, 0x02, 0x04, 0x00, 0x10, 0x10,
+    0xDC, 0xD3, 0x30, 0x07, 0x01, 0xF0, 0x03, 0x04, 0x20, 0x20, 0x20, 0xE0, 0x04, 0x05, 0x10, 0x10,
+    0xD0, 0xD0, 0x30, 0x06, 0x04, 0xE0, 0x23, 0x25, 0xE4, 0x18, 0x05, 0x03, 0x82, 0x42, 0x27, 0xC0,
+    0x05, 0x05, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x0B, 0x03, 0xC0, 0x87, 0xC9, 0x0C, 0x04, 0x96, 0x91,
+    0x91, 0xF0, 0x05, 0x01, 0x08, 0x05, 0x03, 0xC0, 0x80, 0xC0, 0x07, 0x04, 0xF8, 0x07, 0x00, 0xF0,
+    0x06, 0x08, 0x58, 0x8F, 0xF4, 0x03, 0x00, 0x88, 0x64, 0x03, 0x06, 0x04, 0x58, 0xFF, 0x20, 0x20,
+    0x06, 0x04, 0x46, 0xF9, 0xF9, 0x4F, 0x10, 0x04, 0x10, 0x10, 0xF0, 0x20, 0x04, 0x0F, 0x40, 0x4F,
+    0xC0, 0x40, 0x41, 0x06, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x00, 0x10, 0xFC, 0x03, 0x0A, 0x05, 0xE0,
+    0x31, 0x3C, 0x23, 0xE0, 0x0A, 0x04, 0xF0, 0x90, 0x08, 0x07, 0x0C, 0x04, 0xB1, 0x4C, 0x03, 0x80,
+    0x06, 0x04, 0x50, 0x88, 0x07, 0x80, 0x06, 0x09, 0x4C, 0x43, 0x43, 0xC0, 0x06, 0x25, 0x24, 0x2E,
+    0x20, 0x05, 0x0E, 0x82, 0x81, 0xFF, 0x81, 0xE1, 0x80, 0x80, 0x80, 0x00, 0x00, 0x50, 0x89, 0x07,
+    0x80, 0x06, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x04, 0x0D, 0x40,
+    0x40, 0xCF, 0x40, 0x40, 0x00, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x0C, 0x03, 0x0C, 0x05, 0x01, 0x40,
+    0x50, 0xCC, 0x23, 0x0A, 0x03, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x8D, 0x0A, 0x04,
+    0x7C, 0x82, 0x82, 0x7C, 0x7C, 0x01, 0xB0, 0xC3, 0x04, 0x39, 0x48, 0x98, 0x01, 0x28, 0x04, 0xF1,
+    0xE1, 0x61, 0xF1, 0x4F, 0x04, 0x02, 0xC2, 0x32, 0x03, 0x1C, 0x03, 0xFE, 0x09, 0x80, 0x0A, 0x04,
+    0x03, 0x00, 0x00, 0x03, 0x0C, 0x04, 0x53, 0x92, 0xD4, 0x30, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0x09, 0x3F, 0x29, 0xE0, 0x00, 0x03, 0x02, 0x02, 0x03, 0x04, 0x14, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0x02, 0x03, 0x04, 0x19, 0x02, 0x40, 0xF8, 0x1C, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x38, 0x27, 0x1B, 0x03, 0xA0, 0x40,
+    0x00, 0x3D, 0x04, 0x80, 0xF0, 0x80, 0x00, 0x0A, 0x05, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x03,
+    0x80, 0x81, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x05, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0x7C, 0x02, 0x01,
+    0x01, 0x07, 0x04, 0xC5, 0x29, 0x3D, 0x43, 0x27, 0x03, 0x0C, 0x06, 0xFE, 0x25, 0x04, 0x00, 0x10,
+    0x10, 0xF0, 0x7C, 0x05, 0x20, 0xA1, 0xF9, 0x21, 0x01, 0x7B, 0x06, 0x03, 0x4C, 0x4F, 0x90, 0x00,
+    0x00, 0xF0, 0x01, 0x28, 0x75, 0x05, 0x80, 0xB0, 0xE8, 0xA7, 0xA0, 0x04, 0x02, 0x04, 0x04, 0x2B,
+    0x04, 0x81, 0x00, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x05, 0x00, 0x80, 0x8F,
+    0x88, 0x08, 0x00, 0x00, 0x00, 0xD8, 0x03, 0xC0, 0x30, 0x0F, 0x33, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x67, 0x05, 0x40, 0x53, 0xF0, 0x50, 0x53, 0x1C, 0x01, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x4A, 0x03, 0x43, 0x82, 0xF2, 0x0C, 0x03, 0x07, 0x04, 0x04, 0x0C, 0x04, 0xEC,
+    0x72, 0x03, 0xE4, 0x0B, 0x08, 0x40, 0x80, 0xF0, 0x00, 0x00, 0x80, 0x60, 0x00, 0x4B, 0x03, 0x0C,
+    0x03, 0x03, 0x06, 0x05, 0x00, 0xD0, 0x88, 0x87, 0xC0, 0x0B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x06, 0x01, 0x2D, 0x03, 0x00, 0x00, 0x00, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x2C, 0x23, 0xE0, 0x1B, 0x04, 0x0F, 0x83, 0x81, 0x0F, 0x00, 0x00, 0x00, 0xAC, 0x04, 0x88, 0x89,
+    0xF9, 0x80, 0x5B, 0x04, 0x7E, 0x88, 0x3C, 0x08, 0x52, 0x04, 0xC0, 0xB0, 0x8C, 0xC0, 0x25, 0x04,
+    0xA0, 0xF8, 0x23, 0x00, 0x23, 0x04, 0x38, 0x1D, 0x80, 0x78, 0x2F, 0x01, 0x01, 0x07, 0x05, 0x3E,
+    0x01, 0xC0, 0x3C, 0x00, 0x40, 0x03, 0xE4, 0x12, 0x11, 0x38, 0x04, 0x14, 0x12, 0x11, 0x10, 0x7C,
+    0x05, 0x42, 0x82, 0xF2, 0x02, 0x00, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0xAC,
+    0x23, 0x0A, 0x05, 0x00, 0x31, 0x28, 0xE7, 0x00, 0x3C, 0x05, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x2C,
+    0x04, 0x27, 0x28, 0xE8, 0x07, 0x0A, 0x05, 0x04, 0x44, 0x44, 0xC7, 0x24, 0x00, 0x00, 0x00, 0x36,
+    0x05, 0x8D, 0x42, 0x20, 0x1C, 0x00, 0x2C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x00,
+    0x00, 0x00, 0xBD, 0x05, 0x04, 0xC4, 0x34, 0x0C, 0x04, 0x30, 0x05, 0x80, 0x84, 0x84, 0xFC, 0x80,
+    0x09, 0x05, 0x04, 0xE4, 0x14, 0x1C, 0x00, 0x39, 0x01, 0x01, 0x34, 0x02, 0x3C, 0x00, 0x0C, 0x04,
+    0xF0, 0xE1, 0x61, 0xF0, 0xD0, 0x04, 0xC2, 0x82, 0xC7, 0x00, 0x24, 0x08, 0x86, 0x41, 0xC1, 0x00,
+    0x80, 0x87, 0x84, 0x84, 0x50, 0x05, 0x51, 0xCC, 0x43, 0x40, 0x00, 0x19, 0x02, 0x8C, 0x63, 0x08,
+    0x04, 0xCF, 0x82, 0x83, 0xCE, 0x05, 0x01, 0x84, 0x0A, 0x03, 0x90, 0x08, 0x86, 0x5E, 0x04, 0x06,
+    0x05, 0x04, 0x0E, 0x0F, 0x02, 0x06, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2D, 0x03, 0x28, 0x28,
+    0xF8, 0x60, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x03, 0x01, 0x01, 0x01, 0x33, 0x05, 0x28, 0x28, 0xF9,
+    0x24, 0x20, 0x28, 0x03, 0x50, 0x50, 0xF0, 0x45, 0x05, 0x01, 0x78, 0x07, 0x80, 0x79, 0x07, 0x02,
+    0x06, 0x01, 0x72, 0x04, 0x00, 0x98, 0x94, 0x93, 0x2F, 0x04, 0x9C, 0x92, 0x93, 0x84, 0x0B, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x06, 0x00, 0xD1, 0x0C, 0x83, 0x40, 0x40, 0x37,
+    0x04, 0x80, 0x10, 0x8C, 0x03, 0x0B, 0x08, 0x40, 0x40, 0x40, 0xC0, 0x00, 0x20, 0x20, 0x20, 0x2D,
+    0x05, 0x4F, 0xC3, 0x44, 0x48, 0x08, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x00, 0x7D, 0x01,
+    0xCC, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x83, 0x05, 0x08, 0xC8, 0x28, 0x38,
+    0x00, 0x5E, 0x05, 0xE2, 0x82, 0x43, 0x20, 0x20, 0x19, 0x03, 0x11, 0x12, 0x12, 0x0A, 0x07, 0x00,
+    0x23, 0xA0, 0xE0, 0x23, 0x03, 0xE2, 0x4D, 0x06, 0x00, 0xC7, 0x81, 0xC2, 0x04, 0x04, 0x27, 0x04,
+    0x88, 0x87, 0x80, 0x80, 0x7D, 0x02, 0x80, 0x60, 0x2A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x04, 0x45, 0x44, 0xCE, 0x20, 0x0A, 0x02, 0x03, 0x1F, 0x00, 0x00, 0x00, 0xF5, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x72, 0x05, 0x00, 0xF8, 0x70, 0x30, 0xF8, 0x06, 0x01, 0xD2, 0x35, 0x04, 0xE1, 0x91,
+    0xF1, 0x80, 0x05, 0x05, 0x08, 0x08, 0xF9, 0x08, 0x08, 0x32, 0x04, 0xC9, 0x28, 0x38, 0x01, 0x0A,
+    0x04, 0xE0, 0x11, 0x09, 0x70, 0x2E, 0x04, 0x03, 0x00, 0x00, 0x03, 0x05, 0x05, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x1E, 0x04, 0x00, 0x87, 0xE0, 0x19, 0x07, 0x03, 0xFE, 0x09, 0x80, 0x17, 0x01, 0x20,
+    0x5A, 0x03, 0x91, 0x90, 0x9F, 0x07, 0x05, 0x03, 0x02, 0x02, 0x03, 0x04, 0x4A, 0x04, 0x86, 0xF9,
+    0x49, 0xCF, 0x7C, 0x04, 0x40, 0x8F, 0x0A, 0x89, 0x00, 0x00, 0x00, 0x4E, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x05, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x46, 0x01,
+    0xFC, 0x3A, 0x05, 0x0E, 0x80, 0x40, 0x38, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x02,
+    0x09, 0xF8, 0x30, 0x02, 0xFC, 0x00, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xD0,
+    0xD0, 0x3C, 0x03, 0x87, 0x81, 0x82, 0x1B, 0x04, 0x82, 0xF2, 0x42, 0xC2, 0x1A, 0x04, 0x8C, 0x62,
+    0xC3, 0x04, 0x40, 0x04, 0xC8, 0x08, 0x8F, 0x48, 0x1A, 0x04, 0x80, 0x6F, 0x0A, 0x09, 0x1A, 0x05,
+    0x83, 0x00, 0x80, 0x07, 0x04, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x05, 0x00, 0xEF, 0x03, 0x04, 0x88, 0x28, 0x03, 0x83, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x2D,
+    0x01, 0xB4, 0x7D, 0x05, 0x04, 0xC4, 0xBF, 0xFD, 0x00, 0x7B, 0x01, 0x01, 0xCE, 0x06, 0x08, 0x89,
+    0x89, 0x70, 0x00, 0xF9, 0x09, 0x04, 0x23, 0x24, 0xFF, 0xE0, 0x1F, 0x04, 0x83, 0x60, 0x50, 0x93,
+    0x4A, 0x06, 0x22, 0xA2, 0xE3, 0x22, 0x00, 0xE3, 0x09, 0x04, 0x08, 0x56, 0x95, 0xD7, 0x1F, 0x04,
+    0x03, 0x04, 0x04, 0x03, 0x34, 0x01, 0xF2, 0x7D, 0x02, 0x0C, 0x03, 0x6A, 0x01, 0x8F, 0x00, 0x00,
+    0x00, 0x2C, 0x05, 0x20, 0x90, 0xFC, 0x03, 0x00, 0x3F, 0x04, 0xFF, 0x84, 0x84, 0x84, 0x6D, 0x04,
+    0xFF, 0x84, 0x84, 0x84, 0x4B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x00,
+    0x39, 0x01, 0x1C, 0x35, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x01, 0x10, 0x3D, 0x03, 0xE1, 0x41, 0xE1,
+    0x2E, 0x03, 0x90, 0xE0, 0xC0, 0x0F, 0x05, 0x48, 0x4A, 0x4A, 0xFB, 0x02, 0x38, 0x03, 0x08, 0x06,
+    0x01, 0x40, 0x07, 0x04, 0x84, 0x84, 0x87, 0x80, 0x00, 0xC8, 0x7E, 0x02, 0x00, 0x8F, 0x57, 0x04,
+    0x00, 0x07, 0xC8, 0x88, 0x1B, 0x03, 0x2F, 0x23, 0x21, 0x00, 0x00, 0x00, 0xCE, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x05, 0x00, 0x09, 0x09, 0xC9, 0x38, 0x7D, 0x01, 0x8D, 0xA5, 0x05, 0x03,
+    0x04, 0xFF, 0x08, 0x80, 0x7B, 0x0A, 0x00, 0x53, 0x92, 0xD2, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x04, 0xC3, 0xBC, 0xE4, 0x23, 0x4A, 0x04, 0x24, 0x24, 0x27, 0xE0, 0x11, 0x02, 0xF0, 0x00,
+    0x1B, 0x03, 0x11, 0x0D, 0x07, 0x33, 0x03, 0xCC, 0x83, 0xC0, 0x15, 0x04, 0x28, 0x24, 0x23, 0xE0,
+    0x64, 0x03, 0x11, 0x0C, 0x03, 0x14, 0x04, 0x4F, 0x41, 0x43, 0xCF, 0x00, 0x00, 0x00, 0xE2, 0x04,
+    0x70, 0x8C, 0x8A, 0x72, 0x0B, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x41, 0x04, 0x80, 0x60, 0x1E, 0x00,
+    0x29, 0x01, 0x8C, 0x0D, 0x01, 0x01, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x10,
+    0x10, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x02, 0x38, 0x20, 0x13, 0x01, 0xC0, 0x7D, 0x05,
+    0x2A, 0x2E, 0xE9, 0x00, 0x9F, 0x7E, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x04, 0xCC, 0x38,
+    0x78, 0x84, 0x3F, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x7D, 0x08,
+    0x20, 0xC0, 0xF8, 0x00, 0x4A, 0x4A, 0x4B, 0xC2, 0x38, 0x04, 0x48, 0x46, 0xC1, 0x40, 0x3F, 0x05,
+    0x00, 0x20, 0x28, 0x26, 0xC1, 0x2E, 0x03, 0xF1, 0x2D, 0xE7, 0x07, 0x03, 0x10, 0x0F, 0x01, 0x73,
+    0x03, 0x0F, 0x04, 0x0F, 0x29, 0x04, 0x47, 0xC8, 0x48, 0x47, 0x05, 0x04, 0x40, 0x51, 0x7C, 0xC3,
+    0x00, 0x00, 0x00, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x09, 0x09, 0xF9, 0x09, 0x08,
+    0x7C, 0x01, 0x8D, 0x6A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x84, 0x64, 0x1C, 0x59,
+    0x04, 0x38, 0x48, 0x98, 0x00, 0x1F, 0x01, 0x01, 0x18, 0x04, 0xE4, 0x17, 0x10, 0xE0, 0x23, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0x61, 0x51, 0x91, 0x50, 0x05, 0x50, 0x93, 0xD5, 0x34, 0x00,
+    0x23, 0x08, 0x20, 0x20, 0xE0, 0x00, 0x43, 0x44, 0xC4, 0x43, 0x2D, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0x20, 0x20, 0xE0, 0x10, 0x04, 0x48, 0xFA, 0xCE,
+    0x09, 0x11, 0x03, 0x40, 0x80, 0x00, 0x67, 0x03, 0x5F, 0x4C, 0x4B, 0x00, 0x00, 0x00, 0x21, 0x05,
+    0x80, 0x84, 0xFC, 0x84, 0x80, 0x06, 0x04, 0xE4, 0x94, 0x8C, 0x00, 0x7E, 0x01, 0xFC, 0xFF, 0x00,
+    0xFF, 0x00, 0xDE, 0x03, 0x40, 0x40, 0x87, 0x1E, 0x04, 0x4F, 0x84, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x36, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC4, 0xBF, 0xFC,
+    0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x13, 0x05, 0x00, 0xC1,
+    0x31, 0x1F, 0xE2, 0x28, 0x03, 0x00, 0x00, 0x00, 0x15, 0x01, 0x01, 0x23, 0x01, 0x01, 0x16, 0x01,
+    0x00, 0x09, 0x05, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x7C, 0x03, 0x08, 0xFA, 0x09, 0x38, 0x03, 0xC1,
+    0xE0, 0x18, 0x37, 0x05, 0x60, 0x33, 0xF0, 0x00, 0x03, 0x06, 0x04, 0xF9, 0x01, 0x01, 0xC1, 0x36,
+    0x03, 0x01, 0x00, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x06, 0x01, 0x43, 0x2C, 0x0E, 0xC0, 0xBF,
+    0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x42, 0xC3, 0x40, 0x3C, 0x03, 0x80, 0x40,
+    0xC0, 0x06, 0x01, 0xC0, 0x31, 0x09, 0x80, 0xF0, 0x40, 0xC0, 0x00, 0xD0, 0x8F, 0x81, 0x40, 0x2D,
+    0x03, 0x00, 0x00, 0x00, 0x11, 0x05, 0x4A, 0xCE, 0x09, 0x80, 0x7F, 0x36, 0x04, 0x0C, 0x03, 0x07,
+    0x08, 0x2C, 0x05, 0x00, 0x40, 0x40, 0xC0, 0x20, 0x0E, 0x07, 0x4F, 0x49, 0x49, 0xCF, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x00, 0xA2, 0x03, 0x69, 0x49, 0x92, 0xCC, 0x04, 0xF9, 0x70, 0x30, 0xF8, 0x59,
+    0x03, 0x00, 0x00, 0x00, 0x23, 0x01, 0x01, 0x58, 0x04, 0x00, 0xE0, 0x80, 0x40, 0x29, 0x06, 0x72,
+    0x3A, 0x03, 0xF2, 0x48, 0x4B, 0x7A, 0x06, 0x28, 0x24, 0x23, 0xC0, 0x04, 0xC4, 0x8F, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x45, 0x04, 0x07, 0xE8, 0x08, 0x07, 0x00, 0x00, 0x00, 0x7A, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7D, 0x01, 0x20, 0xE4, 0x02, 0xC0, 0x37, 0x7D, 0x04, 0x03, 0x02, 0x02, 0x07, 0x0B, 0x01,
+    0x24, 0x2D, 0x08, 0x0D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x01, 0x79, 0x2C, 0x03,
+    0x50, 0x88, 0x07, 0x03, 0x03, 0x80, 0x00, 0x80, 0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x05,
+    0x0F, 0x49, 0x49, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x04, 0x08, 0xFF, 0xA4, 0x9C, 0xCF, 0x04,
+    0xC0, 0xB1, 0x8C, 0xC0, 0x0A, 0x05, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x32, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x39, 0x01, 0x01, 0x0C, 0x02, 0x02, 0x01, 0x35, 0x01, 0x58, 0xFF, 0x00, 0x1C, 0x03,
+    0x00, 0x00, 0x00, 0x06, 0x01, 0x84, 0x76, 0x04, 0xC0, 0x80, 0x80, 0xC0, 0x04, 0x02, 0x86, 0x7D,
+    0x37, 0x01, 0xC3, 0x21, 0x01, 0xC8, 0x00, 0x00, 0x00, 0xF1, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x04,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x17, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x04, 0xC8, 0x28, 0x38, 0x00, 0x19, 0x03, 0x00, 0xE0, 0x10, 0x42,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x05, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1E, 0x04, 0xC2,
+    0x22, 0xA7, 0xC0, 0x77, 0x09, 0x40, 0x4F, 0xFA, 0x49, 0x40, 0x07, 0x0B, 0x08, 0x07, 0x3C, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0x00, 0x40, 0x58, 0xC7, 0x00, 0x00, 0x00, 0x3A, 0x04, 0x80,
+    0x8E, 0x92, 0xE6, 0x81, 0x05, 0x40, 0x42, 0x42, 0x7E, 0x40, 0x3A, 0x02, 0x00, 0x00, 0xA3, 0x02,
+    0xC2, 0x3D, 0x7D, 0x01, 0x03, 0xDB, 0x02, 0x44, 0x44, 0x2C, 0x04, 0x91, 0x8D, 0x87, 0x00, 0x4E,
+    0x02, 0x90, 0x7C, 0x2C, 0x04, 0x48, 0x88, 0x0F, 0x88, 0x3C, 0x04, 0x80, 0x18, 0x07, 0x80, 0x00,
+    0x00, 0x00, 0x21, 0x05, 0x00, 0x0F, 0x80, 0x70, 0x0F, 0x1A, 0x04, 0x88, 0x88, 0xF8, 0x80, 0x2C,
+    0x05, 0x00, 0x1C, 0x83, 0x72, 0x0E, 0x7B, 0x02, 0x00, 0x1D, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x04, 0xF0, 0xE0, 0x61, 0xF0, 0x3F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0x02, 0x88, 0x88, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x03,
+    0x00, 0x00, 0x03, 0x3F, 0x05, 0x00, 0x00, 0x80, 0xE0, 0x18, 0x10, 0x03, 0x10, 0x10, 0x10, 0x1C,
+    0x03, 0x90, 0xD0, 0x30, 0xE3, 0x09, 0xC7, 0x0B, 0x88, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x77,
+    0x09, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x8C, 0x5C, 0x04, 0x0E, 0x80, 0x40, 0x38, 0x7C, 0x01, 0x01,
+    0x61, 0x05, 0x43, 0xF8, 0x20, 0xF0, 0x20, 0x7C, 0x02, 0x01, 0x0E, 0x29, 0x03, 0x00, 0x00, 0x00,
+    0x7D, 0x04, 0xC0, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x13, 0x05, 0x42, 0x42, 0x7E, 0x42, 0x42,
+    0xA3, 0x09, 0x1C, 0x83, 0x72, 0x0E, 0x00, 0x42, 0x42, 0x42, 0x42, 0x77, 0x01, 0x01, 0x43, 0x01,
+    0x00, 0x7A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x6C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x04, 0x70, 0x38, 0x00, 0xF0, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x05, 0x10, 0x10, 0xD7,
+    0xD0, 0x30, 0x3C, 0x09, 0x80, 0xF0, 0x40, 0xC0, 0x03, 0x42, 0x82, 0xF7, 0x00, 0x15, 0x04, 0x80,
+    0x60, 0xC0, 0x00, 0x1E, 0x03, 0x98, 0x87, 0x80, 0x42, 0x04, 0xCC, 0x03, 0x83, 0x40, 0x6C, 0x04,
+    0x00, 0x91, 0x8C, 0x83, 0x0D, 0x03, 0xE3, 0x84, 0x88, 0x05, 0x04, 0x89, 0xF9, 0x4F, 0x40, 0x00,
+    0x00, 0x00, 0x27, 0x08, 0x88, 0x88, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x04, 0x7C, 0xB2,
+    0x8A, 0x7C, 0x5E, 0x05, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x1E, 0x04, 0x00, 0x00, 0x00, 0x00, 0xDA,
+    0x03, 0x11, 0xF0, 0x10, 0x50, 0x04, 0x48, 0x4B, 0x48, 0xF8, 0x29, 0x03, 0x02, 0x03, 0x02, 0x16,
+    0x03, 0x00, 0x00, 0x00, 0x37, 0x04, 0x04, 0x04, 0x04, 0x07, 0x0D, 0x02, 0xCE, 0x30, 0x32, 0x03,
+    0x90, 0x90, 0x90, 0x47, 0x03, 0x02, 0x01, 0x1F, 0x4C, 0x05, 0x0C, 0x83, 0x63, 0x00, 0x00, 0x41,
+    0x01, 0x03, 0x38, 0x09, 0x04, 0x03, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x72, 0x04, 0xC0, 0xBE, 0x82, 0xE0, 0x1F, 0x04, 0x24, 0x24, 0x25, 0xE0, 0x59, 0x05,
+    0xC0, 0xE0, 0x18, 0x00, 0x01, 0x1E, 0x04, 0x48, 0x4C, 0xFB, 0x00, 0x62, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x6E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x20, 0x20, 0x20, 0x0D, 0x03, 0x00, 0x00,
+    0x00, 0x2A, 0x04, 0x0F, 0x81, 0x40, 0x40, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04,
+    0x5C, 0x93, 0xD0, 0x30, 0x07, 0x03, 0x40, 0xF0, 0x40, 0x1A, 0x05, 0x80, 0x40, 0x40, 0x80, 0x00,
+    0x27, 0x05, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x13, 0x05, 0x80, 0x00, 0x00, 0x80, 0x00, 0x0F, 0x04,
+    0x8C, 0x82, 0x83, 0x04, 0x00, 0x00, 0x00, 0x19, 0x08, 0x8D, 0x42, 0x20, 0x1C, 0x60, 0x58, 0x46,
+    0xE0, 0x8B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x04, 0x1C, 0x83, 0x72, 0x0E, 0x5A, 0x04, 0xF9,
+    0x64, 0x14, 0xF8, 0x1E, 0x01, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x90, 0x50,
+    0x31, 0x00, 0x24, 0x02, 0x01, 0x01, 0x26, 0x01, 0xF8, 0x1A, 0x01, 0x00, 0x14, 0x03, 0x4B, 0x4A,
+    0xFA, 0x28, 0x05, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x3B, 0x01, 0x48, 0x36, 0x04, 0x87, 0x62, 0x03,
+    0x00, 0x06, 0x02, 0x0C, 0x03, 0x60, 0x04, 0xE2, 0x21, 0x3F, 0xE0, 0x0F, 0x04, 0x06, 0xC5, 0x04,
+    0x8E, 0x69, 0x04, 0x06, 0x09, 0x09, 0x0F, 0x00, 0x00, 0x00, 0xA7, 0x04, 0x42, 0x42, 0x42, 0x42,
+    0xFF, 0x00, 0x47, 0x04, 0x04, 0xC4, 0x7C, 0x88, 0x7B, 0x05, 0x00, 0xC3, 0x30, 0x00, 0x03, 0x1F,
+    0x05, 0x44, 0x44, 0xF7, 0x40, 0x40, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x02, 0x18, 0x07, 0x42, 0x03, 0xC0, 0xA0, 0x20, 0x10, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x04, 0x40, 0x40, 0xC0, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2D, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x05, 0x08, 0x09,
+    0xF8, 0x08, 0x08, 0x33, 0x05, 0x20, 0xFC, 0x11, 0x78, 0x10, 0x13, 0x03, 0xE0, 0x90, 0xF0, 0x2F,
+    0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0x48, 0x48, 0xFF, 0x4C, 0x02,
+    0xF8, 0x08, 0x5B, 0x05, 0x4C, 0x43, 0xF0, 0x40, 0x40, 0x70, 0x06, 0xE6, 0x25, 0x3C, 0x2E, 0xE0,
+    0x00, 0x06, 0x02, 0x18, 0x07, 0x5F, 0x04, 0xC6, 0xE9, 0x09, 0xCF, 0x0F, 0x06, 0x01, 0x00, 0x10,
+    0x0C, 0x03, 0x00, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x60, 0x58, 0x46, 0xE0, 0x00, 0x55, 0x07, 0xCC, 0x38, 0x78, 0x84, 0x00,
+    0x1F, 0xFF, 0x7E, 0x01, 0x01, 0x9C, 0x04, 0xC0, 0x31, 0x29, 0xC8, 0x31, 0x05, 0x30, 0x18, 0xF8,
+    0x00, 0x00, 0x46, 0x04, 0x01, 0x02, 0x02, 0x01, 0x32, 0x04, 0xC0, 0x33, 0x00, 0x00, 0x09, 0x02,
+    0x00, 0x00, 0x7E, 0x02, 0x40, 0x40, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x6F, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x03, 0x80, 0xF0, 0x40, 0x00, 0x00, 0x00, 0x3A, 0x05, 0x00, 0xC1, 0xB1, 0x1F, 0xE2,
+    0x55, 0x05, 0x60, 0x5F, 0x41, 0x70, 0x80, 0x43, 0x05, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x33, 0x01,
+    0xB0, 0x12, 0x05, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x31, 0x01, 0x08, 0x4A, 0x01, 0x03, 0x03, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0x04, 0x08, 0x89, 0x88, 0x70, 0x4B, 0x04, 0x30, 0xF0, 0x00, 0x00,
+    0x2D, 0x09, 0x02, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x05, 0x20, 0x20, 0xE3,
+    0x20, 0x20, 0x6D, 0x05, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x09, 0x04, 0x00, 0x40, 0x87, 0xF0, 0x20,
+    0x02, 0x80, 0x78, 0x0D, 0x02, 0x71, 0x1F, 0x1B, 0x03, 0x40, 0xD8, 0x47, 0x16, 0x03, 0x00, 0x00,
+    0x00, 0x37, 0x04, 0x06, 0x05, 0x04, 0x0E, 0x0B, 0x04, 0xD0, 0xE8, 0x06, 0xC1, 0x19, 0x05, 0x08,
+    0x08, 0x0F, 0x08, 0x08, 0x14, 0x04, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x09,
+    0x09, 0xF9, 0x09, 0x08, 0x7C, 0x01, 0xFF, 0x5C, 0x05, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x56, 0x03,
+    0x91, 0x70, 0x00, 0x23, 0x02, 0x33, 0x28, 0x57, 0x03, 0x4B, 0xFA, 0x02, 0xFF, 0x00, 0xE3, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x7C, 0x01, 0x01,
+    0x12, 0x06, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x59, 0x0F,
+    0x00, 0x12, 0x12, 0x92, 0x70, 0x00, 0x70, 0x0C, 0x18, 0xE0, 0x80, 0x85, 0x84, 0x84, 0xBC, 0x73,
+    0x01, 0xFE, 0x95, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x04, 0x79, 0x02, 0x82, 0x79, 0x1E, 0x04, 0x6A,
+    0x12, 0x03, 0xE2, 0x4C, 0x01, 0xD0, 0x0D, 0x03, 0x08, 0x04, 0x03, 0x1F, 0x03, 0x04, 0x02, 0x01,
+    0x04, 0x01, 0x00, 0x19, 0x02, 0x00, 0x00, 0x62, 0x02, 0x50, 0x90, 0x1A, 0x02, 0x80, 0x78, 0x41,
+    0x03, 0x8F, 0x48, 0x48, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x0F, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x04, 0x43, 0x42, 0x7E, 0x40, 0x59, 0x02, 0x0B, 0xFE, 0x12, 0x01,
+    0x1C, 0xB5, 0x03, 0xF8, 0x0B, 0xF8, 0x7D, 0x03, 0x03, 0x01, 0x03, 0xFF, 0x00, 0xB0, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x04, 0x04, 0xF4, 0x1C, 0x04, 0x0F, 0x1C, 0x42, 0x42, 0x7E, 0x42, 0x42,
+    0x00, 0x8D, 0x42, 0x20, 0x1C, 0x60, 0x58, 0x46, 0xE0, 0x00, 0x0F, 0x80, 0x70, 0x0F, 0x00, 0x88,
+    0x88, 0xF8, 0x80, 0x00, 0x94, 0x94, 0xFC, 0x0C, 0x08, 0xC1, 0xB1, 0x1F, 0xE2, 0x60, 0x58, 0x46,
+    0xE0, 0x1A, 0x03, 0xFE, 0x42, 0xFE, 0x20, 0x04, 0x43, 0x42, 0x7E, 0x40, 0x0F, 0x18, 0x08, 0x0A,
+    0xFE, 0x8A, 0x8A, 0x00, 0xCC, 0x38, 0x78, 0x84, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x69, 0x49, 0x92,
+    0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x10, 0x09, 0x1C, 0x83, 0x72, 0x0E, 0x04, 0x04, 0xFC, 0x04,
+    0x04, 0x18, 0x05, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x10, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x0B, 0x04,
+    0x04, 0x07, 0x84, 0x7C, 0x10, 0x18, 0x12, 0x12, 0x92, 0x70, 0x00, 0x70, 0x0C, 0x18, 0xE0, 0x80,
+    0x85, 0x84, 0x84, 0xBC, 0x04, 0x07, 0x84, 0x7C, 0x00, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x09, 0x0F,
+    0x3C, 0x04, 0x07, 0x84, 0x7C, 0x00, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x0E, 0x80, 0x40, 0x38, 0x18,
+    0x05, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x10, 0x04, 0xC0, 0xBE, 0x82, 0xE0, 0x0C, 0x02, 0x02, 0x01,
+    0x11, 0x04, 0x20, 0xFE, 0x91, 0x70, 0x0B, 0x07, 0xC2, 0x3D, 0x00, 0x00, 0xF8, 0x0B, 0xF8, 0x0B,
+    0x0E, 0x08, 0x08, 0xFA, 0x09, 0x08, 0x00, 0xC0, 0x33, 0x28, 0xC8, 0x00, 0x11, 0xF0, 0x10, 0x1A,
+    0x04, 0x08, 0x89, 0x88, 0x70, 0x0F, 0x06, 0x30, 0x18, 0xF8, 0x00, 0x00, 0x01, 0x1D, 0x05, 0x48,
+    0x48, 0x4B, 0xFA, 0x02, 0x0A, 0x08, 0x43, 0xF8, 0x20, 0xF0, 0x20, 0x03, 0x01, 0x03, 0x0B, 0x0F,
+    0x01, 0xF9, 0x01, 0x01, 0xC1, 0x00, 0x79, 0x02, 0x82, 0x79, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x19,
+    0x04, 0x6A, 0x12, 0x03, 0xE2, 0x0F, 0x05, 0x20, 0x20, 0xE3, 0x20, 0x20, 0x1E, 0x06, 0x04, 0x44,
+    0x44, 0xF7, 0x40, 0x40, 0x0A, 0x03, 0x01, 0xCE, 0x30, 0x10, 0x0F, 0x87, 0x62, 0x03, 0x00, 0x00,
+    0x08, 0x04, 0x03, 0x00, 0x00, 0x4C, 0x43, 0xF0, 0x40, 0x40, 0x18, 0x05, 0x84, 0xF2, 0x41, 0xE0,
+    0x40, 0x0F, 0x03, 0x40, 0x87, 0xF0, 0x20, 0x03, 0x80, 0x78, 0x07, 0x0B, 0x04, 0xE2, 0x71, 0x1F,
+    0xE0, 0x06, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0xE6, 0x25, 0x3C, 0x2E, 0xE0, 0x06, 0x03, 0x40,
+    0xD8, 0x47, 0x1B, 0x03, 0x03, 0x1C, 0x01, 0x10, 0x03, 0x0C, 0x83, 0x63, 0x0A, 0x02, 0x80, 0x78,
+    0x13, 0x04, 0x06, 0x05, 0x04, 0x0E, 0x0B, 0x04, 0xD0, 0xE8, 0x06, 0xC1, 0x06, 0x04, 0x48, 0x88,
+    0x0F, 0x88, 0x05, 0x05, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x05, 0x05, 0x08, 0x08, 0x8F, 0x48, 0x48,
+    0x1E, 0x03, 0x80, 0x80, 0x80, 0x0B, 0x05, 0x04, 0x03, 0xFF, 0x80, 0x80, 0x09, 0x02, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x05, 0x04, 0x82, 0xA2, 0xE2, 0x9C, 0x06, 0x04, 0x42, 0x42, 0x42, 0x42, 0x0A,
+    0x05, 0x00, 0xCC, 0x38, 0x78, 0x84, 0x31, 0x04, 0x80, 0xFF, 0x40, 0x30, 0x41, 0x05, 0xFF, 0x08,
+    0x10, 0x00, 0x00, 0x36, 0x01, 0x01, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x46, 0x03, 0x24, 0x26, 0xFD, 0x16, 0x0C, 0x10, 0xF0, 0x10, 0x00, 0x00, 0x10,
+    0xD0, 0x70, 0x10, 0xF0, 0x52, 0x71, 0x12, 0x02, 0xF8, 0x08, 0x47, 0x03, 0x02, 0x02, 0x03, 0x15,
+    0x08, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x04, 0x03, 0x9B, 0x09, 0xE8, 0x24, 0xE3, 0x00, 0x00,
+    0x8C, 0xF3, 0x40, 0xE0, 0x71, 0x09, 0x06, 0x95, 0x94, 0x2E, 0x00, 0x00, 0x0F, 0x04, 0x0F, 0x03,
+    0x03, 0xC3, 0x5C, 0x01, 0x3A, 0x02, 0x00, 0x00, 0x35, 0x05, 0x00, 0x06, 0x04, 0x09, 0x00, 0x44,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x03, 0x94, 0x94, 0xFC, 0xFF, 0x00, 0x52, 0x04, 0xE2,
+    0x12, 0x13, 0xE0, 0x23, 0x03, 0x23, 0xFD, 0xE3, 0x57, 0x03, 0x03, 0x05, 0x04, 0x22, 0x04, 0x08,
+    0x06, 0x05, 0x07, 0x82, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x05, 0xC0, 0x03, 0x9C, 0x41, 0x40, 0x4A,
+    0x04, 0x40, 0x80, 0x00, 0x80, 0x2D, 0x08, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x85, 0x04, 0x20, 0x10, 0xFC, 0x03, 0x15, 0x04, 0x09, 0x09, 0xF9, 0x09, 0x31, 0x04,
+    0x7D, 0xB2, 0x8A, 0x7C, 0x05, 0x05, 0x00, 0x1C, 0xC8, 0x3C, 0x00, 0x26, 0x01, 0x01, 0x11, 0x07,
+    0x08, 0x3E, 0xFE, 0x08, 0x00, 0x84, 0x85, 0x3D, 0x01, 0x09, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x02, 0x12, 0xF1, 0x20, 0x04, 0x38, 0x1F, 0x80, 0x78, 0x36, 0x01, 0x00, 0x45, 0x09, 0x7C,
+    0x02, 0x81, 0x78, 0x00, 0xFA, 0xFB, 0x02, 0x00, 0x3C, 0x04, 0x40, 0xC3, 0x45, 0x44, 0x3C, 0x02,
+    0x88, 0xF7, 0x3F, 0x01, 0x0F, 0x92, 0x04, 0xE5, 0x04, 0x0E, 0xE0, 0x1E, 0x04, 0xA6, 0x44, 0x09,
+    0x80, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x40, 0x42, 0x42, 0x7E,
+    0x40, 0x2D, 0x04, 0xFC, 0x94, 0x94, 0x94, 0x2E, 0x03, 0x94, 0x94, 0xFC, 0x87, 0x04, 0xF0, 0x48,
+    0x78, 0xC0, 0x0F, 0x04, 0x24, 0x64, 0xE4, 0x1C, 0x0A, 0x06, 0x84, 0x85, 0x84, 0xFC, 0x00, 0x00,
+    0x59, 0x04, 0x11, 0xF0, 0x10, 0x01, 0x11, 0x01, 0x01, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x1C, 0x81, 0x5A, 0x09, 0xF2, 0x12, 0x1F, 0x12, 0xF2, 0x00, 0x24, 0xC3, 0xF8, 0x14,
+    0x05, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x05, 0x04, 0x20, 0x22, 0xFF, 0xE2, 0x1A, 0x04, 0xFA, 0x02,
+    0x03, 0xC2, 0x39, 0x07, 0x08, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x1E, 0x04, 0x08, 0x86, 0xF5,
+    0x47, 0x1A, 0x03, 0x87, 0xF2, 0x43, 0x20, 0x04, 0x78, 0x4F, 0xC0, 0x40, 0x38, 0x02, 0x84, 0x6F,
+    0x42, 0x03, 0x10, 0x0C, 0x03, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x03, 0x04, 0x03, 0x1F,
+    0x20, 0x03, 0x8F, 0x83, 0x84, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x20, 0x10, 0xFC, 0x03, 0x6D, 0x03,
+    0x84, 0xFC, 0x84, 0x0C, 0x04, 0xC5, 0x29, 0x3D, 0x43, 0x46, 0x04, 0x0E, 0x80, 0x41, 0x38, 0x32,
+    0x01, 0x84, 0x17, 0x03, 0x08, 0xF8, 0x08, 0x2F, 0x01, 0x01, 0x4C, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x19, 0x03, 0x00, 0x00, 0x00, 0x48, 0x05, 0x54, 0x52, 0xF1, 0x48, 0x60, 0x32, 0x01, 0xE0,
+    0x21, 0x05, 0xC4, 0xBC, 0xE7, 0x20, 0x00, 0x0E, 0x04, 0x46, 0x45, 0xC7, 0x40, 0x10, 0x02, 0xE0,
+    0x2C, 0x56, 0x05, 0x80, 0x79, 0x4D, 0xC7, 0x40, 0x0F, 0x03, 0x10, 0x0F, 0x01, 0x69, 0x04, 0x01,
+    0xF0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0xA2, 0x03, 0x08, 0x00, 0x00, 0x5B, 0x04, 0x60, 0xF0, 0x0C,
+    0x00, 0x7C, 0x04, 0x04, 0xF7, 0x34, 0x0C, 0x28, 0x03, 0x50, 0x50, 0xF1, 0x10, 0x04, 0x08, 0xC9,
+    0x28, 0x38, 0x3D, 0x03, 0xE6, 0x11, 0x10, 0x29, 0x03, 0x02, 0x02, 0x03, 0x11, 0x02, 0x21, 0xFE,
+    0x3F, 0x04, 0x43, 0xFD, 0x44, 0x40, 0x1D, 0x04, 0x80, 0x61, 0xCE, 0x00, 0x5A, 0x03, 0x7C, 0x53,
+    0xDF, 0x1F, 0x05, 0xE3, 0x70, 0x00, 0xE7, 0x04, 0x00, 0x00, 0x00, 0x05, 0x04, 0x42, 0x42, 0x42,
+    0x42, 0x22, 0x05, 0xC8, 0x28, 0xFE, 0x08, 0x00, 0x7C, 0x02, 0x85, 0xFD, 0x25, 0x04, 0x05, 0xF4,
+    0x1C, 0x04, 0x38, 0x02, 0x3E, 0xFE, 0x42, 0x01, 0x09, 0x31, 0x03, 0x21, 0x20, 0xE0, 0x07, 0x02,
+    0x02, 0x01, 0x43, 0x02, 0xC1, 0x3D, 0x2F, 0x04, 0x02, 0x02, 0x03, 0x02, 0x1F, 0x02, 0xA1, 0x63,
+    0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x01, 0x03, 0x1C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x09, 0xE0, 0x28, 0x66, 0x01, 0x00, 0x96, 0x91, 0x91, 0x90, 0x04, 0x04, 0x00, 0x47, 0x44,
+    0xC4, 0x0C, 0x03, 0x80, 0x60, 0x00, 0x39, 0x01, 0x80, 0x25, 0x04, 0x08, 0x08, 0x09, 0x0E, 0x03,
+    0x02, 0x10, 0x0F, 0x81, 0x04, 0x50, 0x48, 0xC6, 0x01, 0x16, 0x02, 0xDF, 0x80, 0x00, 0x00, 0x00,
+    0x2B, 0x05, 0x00, 0x88, 0x88, 0xF8, 0x80, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00,
+    0x87, 0x40, 0x20, 0x1C, 0x0F, 0x02, 0x84, 0xFC, 0x6B, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x05,
+    0x84, 0x00, 0x00, 0x00, 0x00, 0x36, 0x05, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x38, 0x04, 0x10, 0xF0,
+    0x10, 0x00, 0x06, 0x02, 0x50, 0x70, 0x3A, 0x01, 0x89, 0x4B, 0x04, 0xC0, 0x42, 0x72, 0xC3, 0x7C,
+    0x04, 0x01, 0x08, 0x04, 0x03, 0x2E, 0x05, 0xD7, 0x22, 0x03, 0xC0, 0x00, 0x44, 0x04, 0x24, 0x30,
+    0xBF, 0x61, 0x33, 0x03, 0xC8, 0x04, 0x82, 0x46, 0x05, 0x04, 0x02, 0x1F, 0x01, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x84, 0xFC, 0x84, 0x00, 0x15, 0x05, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x35, 0x04,
+    0xC5, 0x29, 0x3D, 0x43, 0x1F, 0x04, 0x20, 0x10, 0xFC, 0x03, 0x06, 0x01, 0x42, 0x18, 0x04, 0x82,
+    0xA2, 0xE2, 0x9C, 0x36, 0x01, 0x04, 0x24, 0x01, 0x01, 0x32, 0x05, 0x3C, 0x04, 0x07, 0x84, 0x7C,
+    0x77, 0x08, 0x38, 0x1F, 0x80, 0x78, 0x00, 0x90, 0x52, 0x31, 0x55, 0x04, 0xC0, 0x42, 0x72, 0xC3,
+    0x1F, 0x08, 0x24, 0xA2, 0x61, 0x00, 0xC0, 0x43, 0x72, 0xC2, 0x24, 0x03, 0xF3, 0x10, 0xF0, 0x2E,
+    0x04, 0x41, 0x08, 0x04, 0x03, 0x4B, 0x03, 0x07, 0x02, 0x07, 0x1B, 0x03, 0x00, 0x00, 0x00, 0x7D,
+    0x03, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x04, 0x05, 0x0C, 0x06, 0xFE, 0x00, 0x00, 0x0A, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x03, 0x39, 0x48,
+    0x98, 0x07, 0x04, 0x0A, 0x09, 0x08, 0x08, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x5F, 0x01, 0xC2, 0x03,
+    0x01, 0x00, 0x06, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x40, 0x89, 0x03, 0xC8, 0x84, 0xC3,
+    0x07, 0x02, 0x00, 0x00, 0x61, 0x08, 0x48, 0x49, 0xFE, 0x40, 0x40, 0x80, 0x70, 0xCF, 0x0B, 0x03,
+    0x11, 0x0C, 0x03, 0x06, 0x04, 0x00, 0x90, 0x90, 0x20, 0x06, 0x05, 0x80, 0xA0, 0xE3, 0xBC, 0xA1,
+    0x55, 0x0A, 0x0C, 0x13, 0x1F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x54, 0x1C, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1D, 0x05, 0x8C, 0x06, 0xFE, 0x00, 0x00, 0x0A, 0x04, 0x08, 0x08, 0x08, 0x08,
+    0xFF, 0x00, 0xAE, 0x04, 0x24, 0x25, 0x25, 0xE0, 0x7C, 0x04, 0xF8, 0x04, 0x03, 0xC0, 0x23, 0x05,
+    0xE1, 0x28, 0x3C, 0x23, 0xE0, 0x4A, 0x04, 0xC7, 0x22, 0x27, 0xC0, 0x2D, 0x05, 0x01, 0x00, 0x10,
+    0x0C, 0x03, 0x4A, 0x04, 0x07, 0x08, 0x08, 0x07, 0x1B, 0x02, 0x00, 0x00, 0x33, 0x05, 0x82, 0x1F,
+    0x01, 0x86, 0x80, 0x44, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x8E, 0x05, 0x04, 0x04, 0xFC,
+    0x04, 0x04, 0x63, 0x03, 0xFC, 0x14, 0x1D, 0x16, 0x03, 0x10, 0x10, 0xF0, 0x2E, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0x04, 0x09, 0x09, 0x09, 0x09, 0x2D, 0x01, 0xC8, 0x1C, 0x04, 0xE0, 0x91, 0xF1,
+    0x80, 0x41, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0xFB, 0x00, 0x00, 0xC3, 0x42, 0x02,
+    0x60, 0xC0, 0x5B, 0x04, 0x9C, 0x93, 0x9F, 0x80, 0x28, 0x05, 0x91, 0x9C, 0x93, 0x90, 0x80, 0x09,
+    0x05, 0x40, 0x4F, 0xC4, 0x4F, 0x40, 0x41, 0x04, 0x00, 0x10, 0x0C, 0x03, 0x29, 0x02, 0x10, 0x0F,
+    0x0B, 0x03, 0x00, 0x00, 0xCF, 0x20, 0x04, 0xAF, 0x23, 0xA4, 0x68, 0x00, 0x00, 0x00, 0x4E, 0x04,
+    0x8D, 0x42, 0x20, 0x1C, 0x41, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x05, 0x10, 0x8A, 0x52,
+    0x7A, 0x86, 0x7C, 0x04, 0x71, 0x6E, 0xF8, 0x08, 0x50, 0x04, 0x06, 0xF9, 0x08, 0x80, 0x0B, 0x03,
+    0x49, 0x49, 0x91, 0x0D, 0x02, 0xE3, 0x20, 0x0B, 0x03, 0x44, 0x73, 0xC1, 0x51, 0x05, 0x43, 0xFA,
+    0x22, 0x23, 0xE5, 0x0A, 0x03, 0x03, 0x02, 0x04, 0x07, 0x08, 0x00, 0xF8, 0x06, 0x01, 0x00, 0x94,
+    0x97, 0x94, 0x5F, 0x08, 0x92, 0x91, 0x9F, 0x81, 0x01, 0xC0, 0x90, 0xCC, 0x0B, 0x0A, 0x20, 0x31,
+    0xED, 0x27, 0x20, 0x00, 0x58, 0x4F, 0xFC, 0x43, 0x19, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x05, 0x97,
+    0x98, 0x98, 0x97, 0x80, 0x28, 0x08, 0x80, 0x90, 0x8C, 0x03, 0x00, 0x11, 0x0C, 0x03, 0x0B, 0x0F,
+    0x04, 0xE4, 0x07, 0x04, 0xE4, 0x00, 0x0C, 0x93, 0x5F, 0x40, 0x00, 0x23, 0x20, 0x20, 0xE7, 0x14,
+    0x03, 0xA0, 0x40, 0x00, 0x1B, 0x02, 0x10, 0x0F, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x5A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x04, 0xF4, 0x1C,
+    0x04, 0x7B, 0x05, 0xC0, 0xB1, 0x8C, 0xC0, 0x00, 0x7E, 0x01, 0x11, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x68, 0x05, 0x00, 0x74, 0x93, 0x91, 0xF0, 0x10, 0x03, 0x20, 0xFC, 0xE0, 0x60, 0x02, 0x00,
+    0x00, 0x06, 0x05, 0x00, 0xC3, 0x84, 0xC4, 0x07, 0x63, 0x05, 0x00, 0x91, 0x6D, 0xC7, 0x00, 0x0A,
+    0x09, 0xE0, 0x70, 0x00, 0xE0, 0x00, 0x50, 0xFF, 0x21, 0x20, 0x68, 0x06, 0x00, 0xE3, 0x00, 0x00,
+    0xE7, 0x04, 0x0D, 0x0A, 0x00, 0x82, 0x01, 0x1F, 0x81, 0x81, 0x20, 0x30, 0xEF, 0x40, 0x2D, 0x04,
+    0x0F, 0xE3, 0x24, 0x08, 0x00, 0x00, 0x00, 0x04, 0x05, 0x18, 0x07, 0xC4, 0x3C, 0x04, 0x23, 0x04,
+    0x1C, 0x83, 0x72, 0x0E, 0x15, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x37, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x12, 0x05, 0xFF, 0x08, 0x10, 0x00, 0x00, 0x0F, 0x04, 0xC1, 0x31, 0x1F, 0xE2, 0x15,
+    0x01, 0x01, 0x53, 0x01, 0xB0, 0x12, 0x04, 0x1A, 0x84, 0x40, 0x38, 0x46, 0x04, 0x1A, 0x84, 0x40,
+    0x38, 0x7C, 0x01, 0x01, 0xB0, 0x04, 0xF7, 0x04, 0x04, 0xF0, 0x69, 0x04, 0xD1, 0x8D, 0x87, 0xC0,
+    0x06, 0x04, 0x40, 0x50, 0xFF, 0x40, 0x06, 0x02, 0xF8, 0x27, 0x10, 0x05, 0x00, 0xEF, 0x74, 0x0F,
+    0xE0, 0x46, 0x05, 0x91, 0x0C, 0x03, 0x80, 0x80, 0x0A, 0x05, 0x4F, 0x83, 0x01, 0x8F, 0x00, 0x05,
+    0x05, 0x2C, 0x33, 0x3F, 0xE0, 0x50, 0x18, 0x04, 0x10, 0xC8, 0x86, 0x01, 0x14, 0x04, 0xC0, 0x50,
+    0x4F, 0xC0, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x03, 0xE2, 0x1A, 0x06, 0x02, 0x03, 0x04, 0xC8, 0x28,
+    0xFE, 0x08, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x11, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x05, 0x04, 0x84, 0x64, 0x1C, 0x00, 0x22, 0x02, 0x01, 0x01, 0x0D, 0x01, 0xF8,
+    0x23, 0x01, 0xF4, 0x13, 0x08, 0xFC, 0x90, 0x70, 0x00, 0x38, 0x1C, 0x81, 0x78, 0x0A, 0x02, 0x39,
+    0x1C, 0x6F, 0x05, 0xF0, 0x14, 0x1E, 0x11, 0xF0, 0x22, 0x04, 0x40, 0x00, 0x00, 0x00, 0x4B, 0x05,
+    0x10, 0x13, 0xD2, 0xD4, 0x30, 0x28, 0x08, 0xC0, 0xBC, 0xE3, 0x20, 0x00, 0x80, 0xF0, 0x40, 0x4C,
+    0x02, 0x18, 0x07, 0x0E, 0x07, 0xF8, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0xF1, 0x7D,
+    0x07, 0x5F, 0x09, 0x10, 0x2C, 0x2B, 0x2F, 0xE0, 0x40, 0x40, 0xC0, 0x00, 0x10, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x24, 0x1F, 0xF2, 0x12, 0x10, 0x22, 0x05, 0x00, 0x82,
+    0x42, 0x32, 0x0E, 0x56, 0x01, 0x01, 0x24, 0x05, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x05, 0x05, 0x00,
+    0xDC, 0x24, 0x24, 0xFC, 0x28, 0x03, 0x38, 0x90, 0x78, 0x38, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x00, 0x80, 0x70, 0x06, 0x04, 0x08, 0x08, 0x08, 0x08, 0x07, 0x03, 0x1D, 0x81, 0x79, 0x28,
+    0x02, 0x02, 0x01, 0x39, 0x08, 0x00, 0xF8, 0x08, 0x80, 0xC0, 0x42, 0x71, 0xC0, 0xFF, 0x00, 0x13,
+    0x03, 0x8F, 0xF4, 0x03, 0x7D, 0x02, 0x83, 0x43, 0x0C, 0x08, 0x81, 0xFF, 0x81, 0x81, 0x00, 0xF0,
+    0x8F, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x38, 0x08, 0x8E,
+    0x78, 0x34, 0x05, 0x02, 0xE2, 0x1A, 0x06, 0x02, 0x44, 0x01, 0x01, 0x84, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x63, 0x04, 0x10, 0x12, 0xFF, 0xF0, 0x16, 0x02, 0x90, 0xF0, 0x15, 0x05, 0x08, 0x09, 0xF8,
+    0x08, 0x08, 0x07, 0x03, 0x00, 0x00, 0x00, 0x40, 0x04, 0x04, 0x03, 0x02, 0x03, 0x2D, 0x05, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x05, 0x40, 0xF8, 0x20, 0x20, 0xE1, 0x3B, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x67, 0x05, 0x11, 0x0C, 0xF3, 0x00, 0x00, 0x10, 0x03, 0xE0, 0xA0, 0xA0, 0x5E, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0C, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x31, 0x03, 0x94, 0x94, 0xFC,
+    0x42, 0x05, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0x6B, 0x05, 0x80, 0x84, 0xFC, 0x85, 0x80, 0x0C, 0x01,
+    0x15, 0x56, 0x04, 0x83, 0x63, 0x3E, 0xC4, 0x33, 0x04, 0x51, 0x50, 0xF0, 0x00, 0x0B, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x04, 0x01, 0x00, 0x00, 0x01, 0x34, 0x02, 0x72, 0xC3, 0x0D, 0x03, 0x48,
+    0xF8, 0x00, 0x2D, 0x04, 0xE3, 0x12, 0x13, 0xE0, 0x37, 0x04, 0x00, 0x00, 0x00, 0x00, 0x41, 0x04,
+    0x03, 0x04, 0x04, 0x03, 0x37, 0x04, 0x90, 0x90, 0x90, 0x80, 0x0B, 0x04, 0xF8, 0x07, 0x00, 0xF0,
+    0x0A, 0x04, 0x00, 0x80, 0x70, 0x0F, 0x0B, 0x04, 0x51, 0x4C, 0xC3, 0x40, 0x23, 0x05, 0xC7, 0x28,
+    0x28, 0xC7, 0x00, 0x37, 0x03, 0x10, 0x08, 0x07, 0x0B, 0x04, 0x06, 0x25, 0x24, 0x2E, 0x0B, 0x03,
+    0x10, 0xEF, 0x81, 0x24, 0x04, 0xC7, 0x48, 0x48, 0xC7, 0x06, 0x03, 0xEF, 0xE3, 0x04, 0x00, 0x00,
+    0x00, 0x45, 0x04, 0x08, 0x08, 0x08, 0x08, 0x1E, 0x05, 0x6E, 0x92, 0x92, 0xFE, 0x00, 0x59, 0x05,
+    0x09, 0x09, 0xC9, 0x38, 0x00, 0x1F, 0x01, 0x84, 0x0C, 0x03, 0xC0, 0x31, 0x0F, 0x4D, 0x01, 0x91,
+    0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x37, 0x0B, 0x00, 0x24, 0xE2, 0x21, 0x00, 0x00, 0x4C, 0x4B,
+    0xC8, 0x48, 0x40, 0x03, 0x05, 0x20, 0x24, 0xE2, 0x21, 0x20, 0x32, 0x04, 0xF8, 0x00, 0x00, 0xC0,
+    0x23, 0x05, 0x01, 0x28, 0x24, 0x23, 0x20, 0x10, 0x08, 0x04, 0xF7, 0x04, 0x00, 0x00, 0x90, 0x98,
+    0x97, 0x06, 0x03, 0xF0, 0x07, 0x00, 0x1C, 0x03, 0xC4, 0xA4, 0x23, 0x37, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC4, 0x84, 0xC4, 0x04, 0x36, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08,
+    0x08, 0x07, 0x0A, 0x04, 0x07, 0x88, 0x68, 0x07, 0x2A, 0x09, 0x80, 0x80, 0x00, 0x00, 0xB1, 0x4C,
+    0x03, 0x80, 0x00, 0x0F, 0x04, 0x4C, 0x43, 0x43, 0xC0, 0x1E, 0x02, 0x90, 0x88, 0x04, 0x03, 0x80,
+    0x40, 0x40, 0x0E, 0x05, 0x04, 0xC3, 0x5F, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x1E, 0x02,
+    0x03, 0xC2, 0x3E, 0x7D, 0x01, 0xE3, 0x20, 0x04, 0x12, 0x32, 0xF2, 0x0E, 0x06, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x03, 0xFD, 0x14, 0x1C, 0x8B, 0x04, 0x70, 0x10, 0x1C, 0xF0, 0x42, 0x04, 0x25,
+    0x24, 0x24, 0xE0, 0x37, 0x02, 0x02, 0x01, 0x35, 0x05, 0x24, 0xE3, 0x20, 0x00, 0x00, 0x09, 0x03,
+    0x70, 0x94, 0x93, 0x47, 0x03, 0xF1, 0x11, 0xF1, 0x25, 0x03, 0x94, 0x97, 0x94, 0x55, 0x03, 0x07,
+    0x02, 0x07, 0x33, 0x04, 0x11, 0x1C, 0xF3, 0x20, 0x0B, 0x04, 0x91, 0x9D, 0x97, 0x80, 0x06, 0x04,
+    0x17, 0x18, 0xF8, 0x27, 0x37, 0x03, 0x00, 0x00, 0x00, 0x29, 0x04, 0x0C, 0xE3, 0x81, 0x8E, 0x0B,
+    0x04, 0x80, 0x90, 0x8C, 0x03, 0x06, 0x04, 0x0C, 0x03, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x27, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x82, 0x04, 0x31, 0xE0, 0xE0, 0x10, 0x1E, 0x04, 0xF1, 0x50,
+    0x50, 0x51, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x73, 0x90, 0x91, 0xF2, 0x1E, 0x04,
+    0x03, 0x02, 0x02, 0x02, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0xC0, 0xB8, 0xE0,
+    0x14, 0x04, 0x20, 0x23, 0xA4, 0xE4, 0x2E, 0x03, 0xD0, 0x20, 0x00, 0x4C, 0x03, 0x17, 0x18, 0xF8,
+    0x24, 0x04, 0x47, 0xF8, 0x28, 0x27, 0x39, 0x02, 0xC8, 0x87, 0x2F, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0x43, 0x41, 0xCE, 0x09, 0x06, 0x00, 0xC2, 0x41, 0x5F, 0xC1, 0x01, 0x00, 0x00, 0x00, 0x4E,
+    0x04, 0xFC, 0x14, 0x1C, 0x00, 0x05, 0x05, 0x00, 0x04, 0xF4, 0x1C, 0x04, 0x0B, 0x05, 0x04, 0x84,
+    0x7F, 0x04, 0x04, 0x13, 0x01, 0x84, 0x4D, 0x04, 0x00, 0x94, 0x94, 0xFC, 0x17, 0x01, 0xFD, 0x47,
+    0x05, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x0F, 0x04, 0x12, 0x12, 0x13, 0xFE, 0x06, 0x02, 0x82, 0x62,
+    0x62, 0x01, 0x01, 0x11, 0x04, 0x11, 0x11, 0xFF, 0xF1, 0x1E, 0x04, 0x24, 0x26, 0x25, 0xFC, 0x25,
+    0x05, 0x51, 0x51, 0xF1, 0x49, 0x40, 0x52, 0x04, 0x02, 0x02, 0x02, 0x03, 0x25, 0x03, 0x10, 0xDC,
+    0xD3, 0x19, 0x04, 0x00, 0x03, 0x04, 0xF4, 0x7D, 0x04, 0x0C, 0x03, 0xC0, 0x30, 0x0B, 0x04, 0x11,
+    0x8D, 0x67, 0x00, 0x6D, 0x04, 0x02, 0xE1, 0x9F, 0x80, 0x0A, 0x05, 0x04, 0x83, 0x9F, 0x80, 0x00,
+    0x14, 0x04, 0x02, 0xE1, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x05, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x60, 0x01, 0x80, 0x1B, 0x02, 0x02, 0x01, 0xCB, 0x05,
+    0x10, 0x10, 0xD7, 0xD0, 0x30, 0x1A, 0x05, 0x43, 0x44, 0xFC, 0x43, 0x40, 0x13, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x04, 0x97, 0x92, 0x97, 0xF0, 0x2D, 0x03, 0x58, 0xFF, 0x20, 0x1C, 0x04, 0x10,
+    0xFF, 0x2F, 0x08, 0x13, 0x04, 0xC0, 0x00, 0x80, 0x40, 0x15, 0x03, 0x10, 0x08, 0x07, 0x33, 0x04,
+    0x82, 0x81, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x04,
+    0x0F, 0x80, 0x70, 0x0F, 0x19, 0x09, 0xFF, 0x40, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+    0x01, 0x20, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x13, 0xFE, 0x05, 0x10, 0x10, 0xF1,
+    0x10, 0x10, 0x7D, 0x01, 0x03, 0x1B, 0x03, 0x23, 0xA2, 0x62, 0x16, 0x04, 0x72, 0x3A, 0x03, 0xF0,
+    0x0B, 0x05, 0x49, 0x49, 0xC9, 0x49, 0x40, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x36, 0x03, 0x07,
+    0x04, 0x04, 0x16, 0x03, 0x08, 0x04, 0x03, 0x0C, 0x02, 0x90, 0x98, 0x1C, 0x03, 0xC0, 0x80, 0x80,
+    0x8A, 0x01, 0x20, 0x23, 0x05, 0x8C, 0x83, 0xF1, 0x8E, 0x80, 0x00, 0x00, 0x00, 0x1D, 0x01, 0x00,
+    0x8E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x04, 0x04, 0x12,
+    0x32, 0xF2, 0x0E, 0x2D, 0x01, 0xFC, 0x46, 0x01, 0x12, 0xFE, 0x04, 0xC3, 0x32, 0x63, 0x80, 0x55,
+    0x05, 0x24, 0x27, 0x24, 0xE0, 0x00, 0x22, 0x05, 0xC1, 0x00, 0x80, 0x43, 0x42, 0x54, 0x03, 0x88,
+    0x64, 0x03, 0x24, 0x04, 0x1F, 0x13, 0xF4, 0x28, 0x09, 0x05, 0xC0, 0x67, 0xE8, 0x08, 0x07, 0x06,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x04, 0x50, 0x88, 0x07, 0x80, 0x1B, 0x03, 0xFF, 0x80,
+    0x80, 0x22, 0x05, 0x00, 0xEF, 0x20, 0x00, 0x00, 0x05, 0x05, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x04, 0x1C, 0x62, 0xA2, 0x9C, 0x36, 0x05, 0x38, 0x08, 0x8E, 0x78, 0x00, 0x0F,
+    0x04, 0x42, 0x42, 0x42, 0x42, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0xF9, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x2E, 0x01, 0x40, 0x17, 0x01, 0x84, 0x33, 0x01, 0x08, 0x3B, 0x04, 0x10, 0xF0, 0x10,
+    0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x08, 0x88, 0xEE, 0x59, 0x80, 0x33, 0x04,
+    0x52, 0x53, 0xF2, 0x48, 0x1F, 0x03, 0xFB, 0x00, 0x80, 0x06, 0x03, 0x50, 0x50, 0xF0, 0x19, 0x05,
+    0x01, 0x00, 0x07, 0x00, 0x01, 0x55, 0x04, 0x0C, 0x07, 0x02, 0x01, 0x32, 0x02, 0x88, 0x64, 0x7D,
+    0x04, 0x06, 0x05, 0x04, 0x0E, 0x0B, 0x02, 0xF0, 0x90, 0x7E, 0x03, 0x0F, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x31, 0x04, 0x1C, 0xC8, 0x3C, 0x00, 0x7C, 0x04, 0x85, 0xFC, 0x84, 0x00, 0x72, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x38, 0x04, 0x01, 0x30, 0x39, 0x05,
+    0x00, 0x12, 0xD1, 0x70, 0x10, 0x7B, 0x04, 0x00, 0x74, 0x3B, 0x00, 0x0C, 0x05, 0x21, 0xF9, 0xF9,
+    0x21, 0x00, 0x53, 0x02, 0x87, 0x64, 0x26, 0x03, 0x98, 0x94, 0x93, 0x1B, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x35, 0x0B, 0x06, 0x05, 0x04, 0x0E, 0x00, 0x00, 0x47, 0x48, 0xF8, 0x47, 0x40, 0x3C, 0x04,
+    0x40, 0x80, 0x00, 0x80, 0x2E, 0x04, 0x43, 0x41, 0x8E, 0x00, 0x09, 0x05, 0xE7, 0xE0, 0x1F, 0x0F,
+    0x08, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x05, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x05,
+    0x05, 0x69, 0x49, 0x92, 0x00, 0x00, 0x04, 0x01, 0xC0, 0x0A, 0x04, 0x09, 0x89, 0x79, 0x0F, 0x40,
+    0x05, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x24, 0x01, 0x30, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x48, 0x03, 0x00, 0x00, 0x00, 0x29, 0x01, 0xE8, 0x05, 0x01, 0x50, 0x4C, 0x05, 0x00, 0x00,
+    0xC0, 0x3C, 0x00, 0x90, 0x04, 0x6C, 0x13, 0x00, 0xE0, 0x46, 0x05, 0x4C, 0x47, 0xFA, 0x41, 0x40,
+    0x0E, 0x06, 0x90, 0x91, 0x90, 0xF0, 0x03, 0x02, 0x1D, 0x03, 0x84, 0x62, 0x01, 0x47, 0x05, 0x07,
+    0x00, 0x1F, 0x0F, 0x08, 0x0E, 0x06, 0x08, 0x18, 0x18, 0xFF, 0x20, 0x00, 0x1C, 0x05, 0xE6, 0x25,
+    0x3C, 0x2E, 0xE0, 0x40, 0x06, 0xE1, 0x82, 0x81, 0x9F, 0x00, 0x00, 0x13, 0x05, 0x80, 0x8C, 0xF3,
+    0x81, 0x0E, 0x1D, 0x05, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x1A, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0x1C, 0x80, 0x78, 0x0F, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x04, 0x70, 0x90, 0x90, 0xF0, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x04, 0x41, 0x40, 0xF7, 0x40, 0x61, 0x02, 0xB8, 0xE0, 0x19, 0x03, 0x06, 0x09, 0x0F,
+    0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x31, 0x04, 0x38, 0x08, 0x8E, 0x78, 0x48,
+    0x01, 0xF8, 0x26, 0x02, 0x1F, 0xFF, 0x07, 0x06, 0x38, 0x08, 0x8E, 0x78, 0x00, 0x01, 0x0E, 0x04,
+    0xC0, 0xB1, 0x8C, 0xC0, 0x5F, 0x01, 0x01, 0x09, 0x01, 0x1B, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x04,
+    0x01, 0x01, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x2F, 0x03, 0x40, 0x70,
+    0xC0, 0x1F, 0x03, 0x20, 0xE0, 0x20, 0x29, 0x01, 0xF0, 0x22, 0x04, 0x41, 0x41, 0x41, 0x41, 0x7C,
+    0x03, 0x90, 0x90, 0x90, 0x38, 0x04, 0x47, 0xF0, 0xFF, 0x4F, 0x18, 0x05, 0x46, 0x45, 0xC4, 0x4E,
+    0x40, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0x03, 0x10, 0x09, 0x07, 0x1B, 0x01, 0x0F, 0x17,
+    0x04, 0x40, 0x50, 0xCC, 0x23, 0x00, 0x00, 0x00, 0xC5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+    0x05, 0x00, 0x09, 0x89, 0x79, 0x0F, 0x7C, 0x01, 0x11, 0x0E, 0x04, 0xD3, 0x92, 0x24, 0x00, 0x54,
+    0x04, 0xE1, 0x90, 0xF0, 0x81, 0x15, 0x04, 0x02, 0xFD, 0x00, 0xC0, 0x0B, 0x03, 0x08, 0xF8, 0x09,
+    0x05, 0x02, 0xFC, 0x10, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x04, 0x73, 0x90, 0x30, 0x03,
+    0x15, 0x03, 0x6E, 0x13, 0x01, 0x14, 0x02, 0x03, 0x02, 0x2C, 0x04, 0x00, 0x00, 0xF0, 0x00, 0x1D,
+    0x04, 0x04, 0x84, 0x64, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
+    0x04, 0x6E, 0x92, 0x92, 0xFE, 0x34, 0x01, 0xE2, 0x68, 0x07, 0x80, 0x85, 0xFC, 0x84, 0x80, 0x42,
+    0x42, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0A, 0x00, 0x09, 0xF8, 0x08, 0x00, 0x00, 0x09,
+    0x3E, 0xFE, 0x08, 0x1A, 0x04, 0xE0, 0x18, 0x31, 0xC0, 0x0B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x10, 0x10, 0xFE, 0xF0, 0x1E, 0x08, 0x01, 0x01, 0xFD, 0x01,
+    0xC1, 0x00, 0x02, 0x01, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x01, 0x01, 0x0A, 0x07,
+    0x20, 0xE0, 0x20, 0x00, 0x00, 0x20, 0xE0, 0x33, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x04, 0x00, 0x20,
+    0x20, 0x20, 0x29, 0x05, 0xEC, 0x27, 0x22, 0xE1, 0x00, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x0D, 0x44, 0x27, 0xC0, 0x00, 0xC0, 0x20, 0x20, 0xC0, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x0B, 0x04,
+    0x44, 0x42, 0xC1, 0x40, 0x46, 0x05, 0x46, 0xF9, 0xF9, 0x4F, 0x00, 0x05, 0x03, 0x00, 0x80, 0x60,
+    0x0F, 0x06, 0x40, 0x4F, 0xC0, 0x40, 0x41, 0x06, 0x06, 0x03, 0x10, 0x0C, 0x03, 0x0A, 0x04, 0xE0,
+    0x30, 0x3F, 0x21, 0x47, 0x04, 0x50, 0x89, 0x07, 0x80, 0x00, 0x00, 0x00, 0x57, 0x05, 0xFF, 0x08,
+    0x10, 0x00, 0x00, 0x55, 0x04, 0x87, 0x40, 0x20, 0x1C, 0xB1, 0x04, 0xC0, 0xB1, 0x8C, 0xC0, 0x15,
+    0x01, 0xF0, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x05, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x14,
+    0x01, 0x11, 0x26, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0xE0, 0x13, 0x10, 0xE0, 0x0F,
+    0x04, 0x00, 0xC0, 0x30, 0x60, 0x06, 0x03, 0xC3, 0x30, 0x00, 0x57, 0x01, 0xD0, 0x05, 0x07, 0x00,
+    0x00, 0x00, 0xE0, 0x23, 0x25, 0xE4, 0x18, 0x03, 0x03, 0x82, 0x42, 0x17, 0x04, 0xC4, 0x82, 0xC1,
+    0x00, 0x41, 0x02, 0x00, 0x00, 0x39, 0x03, 0x31, 0x3C, 0x23, 0x63, 0x05, 0x40, 0x40, 0xCF, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x36, 0x05, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x3E, 0x06, 0x00, 0x04, 0x84,
+    0x7F, 0x04, 0x04, 0x39, 0x01, 0x01, 0x32, 0x04, 0x02, 0x72, 0x8A, 0x8E, 0x0B, 0x02, 0x84, 0xFD,
+    0x6A, 0x07, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x0D, 0x04, 0xF8, 0x28, 0x28, 0x28, 0x6A,
+    0x01, 0xFD, 0x03, 0x05, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0C,
+    0x03, 0x48, 0x48, 0x90, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x4E, 0x4B, 0x49, 0xC0,
+    0x00, 0x00, 0x06, 0x01, 0x0F, 0x02, 0xC3, 0x3E, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x02, 0x04, 0x38, 0x05, 0x90, 0x90, 0xF0, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x04, 0xC0, 0x88, 0xC6, 0x01, 0x14, 0x01, 0x08, 0x05, 0x04, 0xC0, 0x80, 0xC0, 0x00, 0x4A, 0x04,
+    0x40, 0x40, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x62, 0x05, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x28, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x04, 0xCD, 0x38, 0x78, 0x84, 0xFB, 0x05, 0x00, 0x90, 0x51,
+    0x30, 0x00, 0x19, 0x04, 0x49, 0xF0, 0xE0, 0x31, 0x23, 0x05, 0x00, 0x10, 0xF0, 0x11, 0x00, 0x1F,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xE3, 0x12, 0x12, 0x1A, 0x04,
+    0xC0, 0x33, 0x04, 0x00, 0x15, 0x04, 0x96, 0xE3, 0xC1, 0x60, 0x0A, 0x05, 0x00, 0x22, 0xC3, 0xFA,
+    0x00, 0x1F, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x23, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x03, 0x87, 0xC9, 0x00, 0x0B, 0x03, 0x96, 0x91, 0x91, 0x35, 0x02, 0x00, 0x00, 0x0C,
+    0x02, 0x00, 0x00, 0x06, 0x04, 0x00, 0x10, 0x10, 0xF0, 0x12, 0x01, 0xFC, 0x51, 0x03, 0x80, 0x80,
+    0x80, 0x0B, 0x03, 0x00, 0x80, 0x80, 0x1B, 0x02, 0x0C, 0x03, 0x00, 0x00,
+};
+// clang-format on
+#endif // OLED_MATRIX_SIZE
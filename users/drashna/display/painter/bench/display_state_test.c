@@ -0,0 +1,222 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for the display_state.c seqlock, with the main loop and the painter thread as two threads.
+ *
+ * The writer thread fills the state with a pattern made from the sequence number of the next snapshot, and publishes
+ * it with one damage bit per publish. The reader thread reads as fast as it can, and checks every snapshot it gets:
+ * the whole snapshot has to be from one publish (no torn copies), sequence numbers only go forward, and the damage has
+ * to include the bit of every publish since its last read, as the snapshots it skipped are never seen.
+ *
+ * The copies display_state.c makes go through test_memcpy(), which yields at random bytes, so that the threads swap
+ * in the middle of copies even on a single core. The writer yields a random number of times between publishes too,
+ * as a writer that never stops publishing would keep the reader retrying.
+ *
+ * Before that, a single threaded run checks that skipped damage is carried over, and dropped once it has been read.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -pthread -Dmemcpy=test_memcpy -o display_state_test -Iusers/drashna/display/painter/bench \
+ *         -Iusers/drashna/bench/qmk -Iusers/drashna -DUSERSPACE_CONFIG_SIZE=64 \
+ *         users/drashna/display/painter/bench/display_state_test.c users/drashna/display/painter/display_state.c
+ *     ./display_state_test
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include "display/painter/display_state.h"
+
+#define TEST_PUBLISHES 100000
+#define DAMAGE_BITS    16
+#define YIELD_ONE_IN   32 // chance of yielding after each byte copied
+#define WRITER_YIELDS  8  // at most, for the rest of the main loop between publishes
+
+pthread_mutex_t           ch_system_lock = PTHREAD_MUTEX_INITIALIZER;
+userspace_config_t        userspace_config;
+userspace_runtime_state_t userspace_runtime_state;
+keymap_config_t           keymap_config;
+
+static volatile bool writer_done;
+
+static uint32_t random_below(uint32_t limit) {
+    static _Thread_local uint32_t state = 0;
+
+    if (state == 0) {
+        state = (uint32_t)(uintptr_t)&state | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % limit;
+}
+
+void *test_memcpy(void *destination, const void *source, size_t size) {
+    volatile uint8_t *to   = destination;
+    const uint8_t    *from = source;
+
+    for (size_t i = 0; i < size; i++) {
+        to[i] = from[i];
+        if (random_below(YIELD_ONE_IN) == 0) {
+            sched_yield();
+        }
+    }
+    return destination;
+}
+
+/*
+ * What a publish with a given sequence number looks like
+ */
+
+static uint16_t damage_of(uint32_t seq) {
+    return 1 << (seq % DAMAGE_BITS);
+}
+
+static uint16_t damage_between(uint32_t last, uint32_t seq) {
+    uint16_t damage = 0;
+    for (uint32_t i = last + 1; i <= seq && i - last <= DAMAGE_BITS; i++) {
+        damage |= damage_of(i);
+    }
+    return damage;
+}
+
+static void fill_state(uint32_t seq) {
+    memset(&userspace_runtime_state, (uint8_t)(seq * 7), sizeof(userspace_runtime_state));
+    memset(userspace_config.raw, (uint8_t)seq, sizeof(userspace_config.raw));
+    keymap_config.raw = (uint16_t)seq;
+}
+
+static bool snapshot_is(const display_state_snapshot_t *snapshot, uint32_t seq) {
+    const uint8_t *runtime_state = (const uint8_t *)&snapshot->userspace_runtime_state;
+    for (size_t i = 0; i < sizeof(snapshot->userspace_runtime_state); i++) {
+        if (runtime_state[i] != (uint8_t)(seq * 7)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < sizeof(snapshot->userspace_config.raw); i++) {
+        if (snapshot->userspace_config.raw[i] != (uint8_t)seq) {
+            return false;
+        }
+    }
+    return snapshot->keymap_config.raw == (uint16_t)seq;
+}
+
+/*
+ * Single threaded: damage carried over skipped snapshots
+ */
+
+#define CHECK(condition, message) \
+    if (!(condition)) {           \
+        printf("%s\n", message);  \
+        return false;             \
+    }
+
+static bool test_damage_carry(uint32_t *seq, uint32_t *last_seq) {
+    display_state_snapshot_t snapshot;
+
+    fill_state(++*seq);
+    display_state_publish(0x0001);
+    CHECK(display_state_read(&snapshot, last_seq) && snapshot.damage == 0x0001, "first snapshot has the wrong damage");
+    CHECK(!display_state_read(&snapshot, last_seq), "read the same snapshot twice");
+
+    fill_state(++*seq);
+    display_state_publish(0x0002);
+    fill_state(++*seq);
+    display_state_publish(0x0004);
+    fill_state(++*seq);
+    display_state_publish(0x0008);
+    CHECK(display_state_read(&snapshot, last_seq) && snapshot_is(&snapshot, *seq), "didn't read the latest snapshot");
+    CHECK(snapshot.damage == 0x000E, "damage of skipped snapshots wasn't carried over");
+
+    fill_state(++*seq);
+    display_state_publish(0x0010);
+    CHECK(display_state_read(&snapshot, last_seq) && snapshot.damage == 0x0010,
+          "damage that was read was carried over");
+    return true;
+}
+
+/*
+ * Threaded: publish and read at the same time
+ */
+
+typedef struct reader_stats_t {
+    uint32_t reads, skipped, torn, backwards, missing_damage, last_seq;
+} reader_stats_t;
+
+static uint32_t first_threaded_seq;
+
+static void *writer_thread(void *arg) {
+    for (uint32_t seq = first_threaded_seq; seq < first_threaded_seq + TEST_PUBLISHES; seq++) {
+        fill_state(seq);
+        display_state_publish(damage_of(seq));
+        for (uint32_t i = random_below(WRITER_YIELDS + 1); i > 0; i--) {
+            sched_yield();
+        }
+    }
+    writer_done = true;
+    return NULL;
+}
+
+static void *reader_thread(void *arg) {
+    reader_stats_t          *stats = (reader_stats_t *)arg;
+    display_state_snapshot_t snapshot;
+    uint32_t                 last_seq = stats->last_seq;
+
+    while (true) {
+        bool     done = writer_done;
+        uint32_t seq  = last_seq;
+        if (!display_state_read(&snapshot, &seq)) {
+            if (done) {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        stats->reads++;
+        if (seq <= last_seq) {
+            stats->backwards++;
+        } else {
+            stats->skipped += seq - last_seq - 1;
+        }
+        if (!snapshot_is(&snapshot, seq)) {
+            stats->torn++;
+        }
+        uint16_t expected = damage_between(last_seq, seq);
+        if ((snapshot.damage & expected) != expected) {
+            stats->missing_damage++;
+        }
+        last_seq = seq;
+    }
+    stats->last_seq = last_seq;
+    return NULL;
+}
+
+int main(void) {
+    uint32_t       seq = 0, last_seq = 0;
+    reader_stats_t stats = {0};
+    pthread_t      writer, reader;
+
+    if (!test_damage_carry(&seq, &last_seq)) {
+        printf("FAILED\n");
+        return 1;
+    }
+
+    first_threaded_seq = seq + 1;
+    stats.last_seq     = last_seq;
+    pthread_create(&reader, NULL, reader_thread, &stats);
+    pthread_create(&writer, NULL, writer_thread, NULL);
+    pthread_join(writer, NULL);
+    pthread_join(reader, NULL);
+
+    printf("%u publishes, %u reads, %u skipped, %u torn, %u backwards, %u missing damage\n", TEST_PUBLISHES,
+           stats.reads, stats.skipped, stats.torn, stats.backwards, stats.missing_damage);
+    if (stats.torn || stats.backwards || stats.missing_damage || stats.last_seq != seq + TEST_PUBLISHES ||
+        stats.reads < 2) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("every snapshot read was whole, and carried the damage of the ones skipped\n");
+    return 0;
+}
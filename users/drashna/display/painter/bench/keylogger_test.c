@@ -0,0 +1,332 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for the keylogger's generated codepoint table, against the string path it replaces.
+ *
+ * Every basic keycode is logged with no mods, Shift, AltGr and other mod combinations, with caps lock on and off,
+ * through add_keycode_to_keylogger_str() and keylogger_process(). What lands in the keylog has to be what the string
+ * path gives: the keycode name, through keycode_repr() and the casing, decoded from UTF-8. get_keyode_character() is
+ * checked the same way, for basic keycodes and for basic keycodes with mods applied. So if the replacements in
+ * keylogger.c are changed without rerunning generate_keylogger_codepoints.py, this fails.
+ *
+ * The keycode names are the ones Quantum's keycode_string.c gives basic keycodes. The media and mouse keycodes only
+ * have names with extrakeys and mousekeys enabled, so it is built both ways.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o keylogger_test -Iusers/drashna/display/painter/bench -Iusers/drashna/bench/qmk -Iusers/drashna \
+ *         -DEXTRAKEY_ENABLE -DMOUSEKEY_ENABLE users/drashna/display/painter/bench/keylogger_test.c \
+ *         users/drashna/display/painter/keylogger.c
+ *     ./keylogger_test
+ *     cc -O2 -o keylogger_test_basic -Iusers/drashna/display/painter/bench -Iusers/drashna/bench/qmk \
+ *         -Iusers/drashna users/drashna/display/painter/bench/keylogger_test.c \
+ *         users/drashna/display/painter/keylogger.c
+ *     ./keylogger_test_basic
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "display/painter/keylogger.h"
+#include "utf8.h"
+
+#define TEST_TIMING_ROUNDS 2000
+
+static uint8_t test_mods;
+static bool    test_caps_lock;
+
+static const uint8_t logged_mods[] = {
+    0,
+    MOD_BIT_LSHIFT,
+    MOD_BIT_RSHIFT,
+    MOD_BIT_RALT,
+    MOD_BIT_LCTRL,
+    MOD_BIT_LALT,
+    MOD_BIT_LGUI,
+    MOD_BIT_LSHIFT | MOD_BIT_RSHIFT,
+    MOD_BIT_LSHIFT | MOD_BIT_LCTRL,
+    MOD_BIT_RSHIFT | MOD_BIT_RALT,
+};
+
+static const uint16_t applied_mods[] = {MOD_LCTL, MOD_LSFT, MOD_LALT, MOD_RSFT, MOD_RALT, MOD_LCTL | MOD_LSFT};
+
+/*
+ * Quantum stand ins
+ */
+
+uint8_t get_mods(void) {
+    return test_mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return 0;
+}
+
+led_t host_keyboard_led_state(void) {
+    return (led_t){.caps_lock = test_caps_lock};
+}
+
+uint16_t keycode_config(uint16_t keycode) {
+    return keycode;
+}
+
+uint8_t mod_config(uint8_t mod) {
+    return mod;
+}
+
+uint16_t extract_basic_keycode(uint16_t keycode, keyrecord_t *record, bool check_hold) {
+    return IS_QK_MODS(keycode) ? QK_MODS_GET_BASIC_KEYCODE(keycode) : keycode;
+}
+
+const char *decode_utf8(const char *str, int32_t *code_point) {
+    const uint8_t *bytes = (const uint8_t *)str;
+
+    if (bytes[0] < 0x80) {
+        *code_point = bytes[0];
+        return str + 1;
+    } else if ((bytes[0] & 0xE0) == 0xC0) {
+        *code_point = ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+        return str + 2;
+    } else if ((bytes[0] & 0xF0) == 0xE0) {
+        *code_point = ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+        return str + 3;
+    } else if ((bytes[0] & 0xF8) == 0xF0) {
+        *code_point =
+            ((bytes[0] & 0x07) << 18) | ((bytes[1] & 0x3F) << 12) | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+        return str + 4;
+    }
+    *code_point = -1;
+    return str + 1;
+}
+
+// clang-format off
+static const struct {
+    uint16_t    keycode;
+    const char *name;
+} keycode_names[] = {
+    {KC_NO, "XXXXXXX"}, {KC_TRNS, "_______"},
+    {KC_ENT, "KC_ENT"}, {KC_ESC, "KC_ESC"}, {KC_BSPC, "KC_BSPC"}, {KC_TAB, "KC_TAB"}, {KC_SPC, "KC_SPC"},
+    {KC_MINS, "KC_MINS"}, {KC_EQL, "KC_EQL"}, {KC_LBRC, "KC_LBRC"}, {KC_RBRC, "KC_RBRC"}, {KC_BSLS, "KC_BSLS"},
+    {KC_NUHS, "KC_NUHS"}, {KC_SCLN, "KC_SCLN"}, {KC_QUOT, "KC_QUOT"}, {KC_GRV, "KC_GRV"}, {KC_COMM, "KC_COMM"},
+    {KC_DOT, "KC_DOT"}, {KC_SLSH, "KC_SLSH"}, {KC_CAPS, "KC_CAPS"}, {KC_PSCR, "KC_PSCR"}, {KC_SCRL, "KC_SCRL"},
+    {KC_PAUS, "KC_PAUS"}, {KC_INS, "KC_INS"}, {KC_HOME, "KC_HOME"}, {KC_PGUP, "KC_PGUP"}, {KC_DEL, "KC_DEL"},
+    {KC_END, "KC_END"}, {KC_PGDN, "KC_PGDN"}, {KC_RGHT, "KC_RGHT"}, {KC_LEFT, "KC_LEFT"}, {KC_DOWN, "KC_DOWN"},
+    {KC_UP, "KC_UP"}, {KC_NUBS, "KC_NUBS"}, {KC_APP, "KC_APP"},
+#ifdef EXTRAKEY_ENABLE
+    {KC_PWR, "KC_PWR"}, {KC_SLEP, "KC_SLEP"}, {KC_WAKE, "KC_WAKE"}, {KC_MUTE, "KC_MUTE"}, {KC_VOLU, "KC_VOLU"},
+    {KC_VOLD, "KC_VOLD"}, {KC_MNXT, "KC_MNXT"}, {KC_MPRV, "KC_MPRV"}, {KC_MSTP, "KC_MSTP"}, {KC_MPLY, "KC_MPLY"},
+    {KC_MSEL, "KC_MSEL"}, {KC_EJCT, "KC_EJCT"}, {KC_MAIL, "KC_MAIL"}, {KC_CALC, "KC_CALC"}, {KC_MYCM, "KC_MYCM"},
+    {KC_WSCH, "KC_WSCH"}, {KC_WHOM, "KC_WHOM"}, {KC_WBAK, "KC_WBAK"}, {KC_WFWD, "KC_WFWD"}, {KC_WSTP, "KC_WSTP"},
+    {KC_WREF, "KC_WREF"}, {KC_WFAV, "KC_WFAV"}, {KC_MFFD, "KC_MFFD"}, {KC_MRWD, "KC_MRWD"}, {KC_BRIU, "KC_BRIU"},
+    {KC_BRID, "KC_BRID"},
+#endif // EXTRAKEY_ENABLE
+#ifdef MOUSEKEY_ENABLE
+    {MS_UP, "MS_UP"}, {MS_DOWN, "MS_DOWN"}, {MS_LEFT, "MS_LEFT"}, {MS_RGHT, "MS_RGHT"}, {MS_BTN1, "MS_BTN1"},
+    {MS_BTN2, "MS_BTN2"}, {MS_BTN3, "MS_BTN3"}, {MS_BTN4, "MS_BTN4"}, {MS_BTN5, "MS_BTN5"}, {MS_BTN6, "MS_BTN6"},
+    {MS_BTN7, "MS_BTN7"}, {MS_BTN8, "MS_BTN8"}, {MS_WHLU, "MS_WHLU"}, {MS_WHLD, "MS_WHLD"}, {MS_WHLL, "MS_WHLL"},
+    {MS_WHLR, "MS_WHLR"}, {MS_ACL0, "MS_ACL0"}, {MS_ACL1, "MS_ACL1"}, {MS_ACL2, "MS_ACL2"},
+#endif // MOUSEKEY_ENABLE
+    {KC_LCTL, "KC_LCTL"}, {KC_LSFT, "KC_LSFT"}, {KC_LALT, "KC_LALT"}, {KC_LGUI, "KC_LGUI"}, {KC_RCTL, "KC_RCTL"},
+    {KC_RSFT, "KC_RSFT"}, {KC_RALT, "KC_RALT"}, {KC_RGUI, "KC_RGUI"},
+};
+// clang-format on
+
+// Same names as keycode_string.c, which falls back to the keycode in hex.
+const char *get_keycode_string(uint16_t keycode) {
+    static char name[8];
+
+    if (KC_A <= keycode && keycode <= KC_Z) {
+        snprintf(name, sizeof(name), "KC_%c", 'A' + keycode - KC_A);
+        return name;
+    }
+    if (KC_1 <= keycode && keycode <= KC_0) {
+        snprintf(name, sizeof(name), "KC_%c", keycode == KC_0 ? '0' : '1' + keycode - KC_1);
+        return name;
+    }
+    if (KC_F1 <= keycode && keycode <= KC_F12) {
+        snprintf(name, sizeof(name), "KC_F%d", 1 + keycode - KC_F1);
+        return name;
+    }
+    if (KC_F13 <= keycode && keycode <= KC_F24) {
+        snprintf(name, sizeof(name), "KC_F%d", 13 + keycode - KC_F13);
+        return name;
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(keycode_names); i++) {
+        if (keycode_names[i].keycode == keycode) {
+            return keycode_names[i].name;
+        }
+    }
+    snprintf(name, sizeof(name), "0x%04X", keycode);
+    return name;
+}
+
+/*
+ * The string path, as the keylogger took it for every key before the table
+ */
+
+static const char *expected_string(uint16_t keycode, uint8_t mods, bool casing) {
+    static char lowercase[2];
+    const char *str = get_keycode_string(keycode);
+
+    keycode_repr(&str, mods);
+    bool shift = test_mods & MOD_MASK_SHIFT;
+    if (casing && str[0] >= 'A' && str[0] <= 'Z' && str[1] == '\0' && !(shift ^ test_caps_lock)) {
+        lowercase[0] = tolower((unsigned char)str[0]);
+        str          = lowercase;
+    }
+    return str;
+}
+
+static uint8_t expected_codepoints(uint16_t keycode, uint8_t mods, int32_t *codepoints) {
+    const char *str   = expected_string(keycode, mods, true);
+    uint8_t     count = 0;
+
+    while (*str) {
+        str = decode_utf8(str, &codepoints[count++]);
+    }
+    return count;
+}
+
+/*
+ * Checks
+ */
+
+#define CHECK(condition, ...)     \
+    if (!(condition)) {           \
+        printf("  " __VA_ARGS__); \
+        printf("\n");             \
+        return false;             \
+    }
+
+static int32_t cell(const keylog_buffer_t *keylog, uint8_t index) {
+    return keylog->chars[(keylog->head + index) % DISPLAY_KEYLOGGER_LENGTH];
+}
+
+// whether logging the keycode appended what the string path gives, and nothing else
+static bool check_logged(const keylog_buffer_t *before, uint16_t keycode, uint8_t mods, const char *via) {
+    const keylog_buffer_t *after = get_keylogger_buffer();
+    int32_t                expected[32];
+    uint8_t                count = expected_codepoints(keycode, mods, expected);
+    uint8_t                shown = count < DISPLAY_KEYLOGGER_LENGTH ? count : DISPLAY_KEYLOGGER_LENGTH;
+
+    CHECK(after->head == (before->head + count) % DISPLAY_KEYLOGGER_LENGTH,
+          "%s 0x%02X, mods 0x%02X, caps %d: appended the wrong number of characters", via, keycode, mods,
+          test_caps_lock);
+    for (uint8_t i = 0; i < DISPLAY_KEYLOGGER_LENGTH - shown; i++) {
+        CHECK(cell(after, i) == cell(before, i + shown), "%s 0x%02X, mods 0x%02X: changed an older character", via,
+              keycode, mods);
+    }
+    for (uint8_t i = 0; i < shown; i++) {
+        int32_t logged = cell(after, DISPLAY_KEYLOGGER_LENGTH - shown + i);
+        CHECK(logged == expected[count - shown + i],
+              "%s 0x%02X, mods 0x%02X, caps %d: logged U+%04X instead of U+%04X (\"%s\")", via, keycode, mods,
+              test_caps_lock, (unsigned)logged, (unsigned)expected[count - shown + i],
+              expected_string(keycode, mods, true));
+    }
+    return true;
+}
+
+static bool test_logging(uint32_t *checked) {
+    keylog_buffer_t before;
+
+    for (int caps = 0; caps <= 1; caps++) {
+        test_caps_lock = caps;
+        for (size_t m = 0; m < ARRAY_SIZE(logged_mods); m++) {
+            test_mods = logged_mods[m];
+            for (uint16_t keycode = 0; keycode <= KC_RIGHT_GUI; keycode++) {
+                before = *get_keylogger_buffer();
+                add_keycode_to_keylogger_str(keycode, test_mods);
+                if (!check_logged(&before, keycode, test_mods, "add_keycode_to_keylogger_str")) {
+                    return false;
+                }
+                (*checked)++;
+
+                // backspace edits the log, and modifiers aren't logged
+                if (keycode == KC_BSPC || IS_MODIFIER_KEYCODE(keycode)) {
+                    continue;
+                }
+                keyrecord_t record = {.event.pressed = true};
+                before             = *get_keylogger_buffer();
+                keylogger_process(keycode, &record);
+                if (!check_logged(&before, keycode, test_mods, "keylogger_process")) {
+                    return false;
+                }
+                (*checked)++;
+            }
+        }
+    }
+    return true;
+}
+
+static bool test_characters(uint32_t *checked) {
+    keypos_t key = {.row = 0, .col = 0};
+
+    for (int caps = 0; caps <= 1; caps++) {
+        test_caps_lock = caps;
+        for (uint8_t shift = 0; shift <= 1; shift++) {
+            test_mods = shift ? MOD_BIT_LSHIFT : 0;
+            for (uint16_t keycode = KC_TRNS; keycode <= KC_RIGHT_GUI; keycode++) {
+                const char *character = get_keyode_character(keycode, &key);
+                const char *expected  = expected_string(keycode, 0, KC_A <= keycode && keycode <= KC_Z);
+                CHECK(character != NULL && strcmp(character, expected) == 0,
+                      "get_keyode_character 0x%02X, caps %d, shift %d: \"%s\" instead of \"%s\"", keycode, caps, shift,
+                      character, expected);
+                (*checked)++;
+
+                for (size_t m = 0; m < ARRAY_SIZE(applied_mods); m++) {
+                    uint16_t modded = keycode | (applied_mods[m] << 8);
+                    character       = get_keyode_character(modded, &key);
+                    expected        = expected_string(keycode, applied_mods[m], false);
+                    CHECK(character != NULL && strcmp(character, expected) == 0,
+                          "get_keyode_character 0x%04X: \"%s\" instead of \"%s\"", modded, character, expected);
+                    (*checked)++;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void) {
+    uint32_t checked = 0;
+
+    if (!test_logging(&checked) || !test_characters(&checked)) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%u keycode and mod combinations checked against the string path\n", checked);
+
+    // the character of every basic keycode, with no mods, through the table and through the string path
+    volatile char sink = 0;
+    keypos_t      key  = {.row = 0, .col = 0};
+    test_mods          = 0;
+    test_caps_lock     = false;
+    double start       = now();
+    for (int round = 0; round < TEST_TIMING_ROUNDS; round++) {
+        for (uint16_t keycode = KC_TRNS; keycode <= KC_RIGHT_GUI; keycode++) {
+            sink += *get_keyode_character(keycode, &key);
+        }
+    }
+    double table = now() - start;
+    start        = now();
+    for (int round = 0; round < TEST_TIMING_ROUNDS; round++) {
+        for (uint16_t keycode = KC_TRNS; keycode <= KC_RIGHT_GUI; keycode++) {
+            sink += *expected_string(keycode, 0, KC_A <= keycode && keycode <= KC_Z);
+        }
+    }
+    double strings = now() - start;
+    double keys    = TEST_TIMING_ROUNDS * (double)KC_RIGHT_GUI;
+    printf("  character of a keycode: %.1f ns, through the string path %.1f ns\n", table / keys * 1e9,
+           strings / keys * 1e9);
+
+    printf("every keycode logged and drawn the same as through the string path\n");
+    return 0;
+}
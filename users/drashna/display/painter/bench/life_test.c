@@ -0,0 +1,359 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test and benchmark for painter_life.c.
+ *
+ * Runs the bitboard Game of Life next to the bool grid version render_life() used before, for a few hundred random
+ * seeds: the same seed, generations and scattered clusters, with the outline and cell colours changing along the way.
+ * After every generation the grids and the changed cells have to match, and so do the framebuffers the two draw into.
+ * Then it times a generation of each, and counts the windows each opens on the panel per frame, a rectangle or a
+ * viewport for pixel data each.
+ *
+ * Build it once streaming pixel data, and once drawing rectangles, as it does straight to an ILI9488.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o life_test -Iusers/drashna/display/painter/bench -Iusers/drashna/bench/qmk -Iusers/drashna \
+ *         users/drashna/display/painter/bench/life_test.c users/drashna/display/painter/painter_life.c
+ *     ./life_test
+ *     cc -O2 -DQUANTUM_PAINTER_ILI9488_ENABLE -o life_test_rects -Iusers/drashna/display/painter/bench \
+ *         -Iusers/drashna/bench/qmk -Iusers/drashna users/drashna/display/painter/bench/life_test.c \
+ *         users/drashna/display/painter/painter_life.c
+ *     ./life_test_rects
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "qp.h"
+#include "display/painter/painter_life.h"
+
+#define MIN_BENCH_SECONDS 0.25
+#define TEST_SEEDS        500
+#define TEST_FRAMES       300
+#define FRAME_WIDTH       (PAINTER_LIFE_WIDTH * PAINTER_LIFE_PITCH + 1)
+#define FRAME_HEIGHT      (PAINTER_LIFE_HEIGHT * PAINTER_LIFE_PITCH + 1)
+
+#ifdef PAINTER_LIFE_DRAW_RECTS
+#    define LIFE_DRAWN_WITH "rectangles"
+#else // PAINTER_LIFE_DRAW_RECTS
+#    define LIFE_DRAWN_WITH "pixel data"
+#endif // PAINTER_LIFE_DRAW_RECTS
+
+/*
+ * The device: a framebuffer of native RGB565 pixels, passed as the device so that each version gets its own. Colours
+ * are converted the way Quantum Painter converts them for an RGB565 panel.
+ */
+
+typedef uint16_t framebuffer_t[FRAME_HEIGHT][FRAME_WIDTH];
+
+static uint32_t windows;
+static struct {
+    uint16_t (*framebuffer)[FRAME_WIDTH];
+    uint16_t left, top, right, bottom;
+    uint32_t written;
+} viewport;
+
+rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
+    uint8_t region, remainder, p, q, t, v = hsv.v, s = hsv.s;
+
+    if (s == 0) {
+        return (rgb_t){v, v, v};
+    }
+    region    = hsv.h * 6 / 255;
+    remainder = (hsv.h * 2 - region * 85) * 3;
+    p         = (v * (255 - s)) >> 8;
+    q         = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t         = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 6:
+        case 0:
+            return (rgb_t){v, t, p};
+        case 1:
+            return (rgb_t){q, v, p};
+        case 2:
+            return (rgb_t){p, v, t};
+        case 3:
+            return (rgb_t){p, q, v};
+        case 4:
+            return (rgb_t){t, p, v};
+        default:
+            return (rgb_t){v, p, q};
+    }
+}
+
+static uint16_t native_pixel(uint8_t hue, uint8_t sat, uint8_t val) {
+    rgb_t rgb = hsv_to_rgb_nocie((hsv_t){hue, sat, val});
+    return __builtin_bswap16((rgb.r >> 3) << 11 | (rgb.g >> 2) << 5 | rgb.b >> 3);
+}
+
+/**
+ * @brief Whether all of the last viewport was filled with pixel data, as leaving part of it would show on a panel.
+ */
+static bool viewport_filled(void) {
+    return viewport.framebuffer == NULL ||
+           viewport.written == (uint32_t)(viewport.right - viewport.left + 1) * (viewport.bottom - viewport.top + 1);
+}
+
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue,
+             uint8_t sat, uint8_t val, bool filled) {
+    uint16_t(*framebuffer)[FRAME_WIDTH] = (uint16_t(*)[FRAME_WIDTH])device;
+
+    if (right >= FRAME_WIDTH || bottom >= FRAME_HEIGHT || left > right || top > bottom || !viewport_filled()) {
+        return false;
+    }
+    viewport.framebuffer = NULL;
+    for (uint16_t y = top; y <= bottom; y++) {
+        for (uint16_t x = left; x <= right; x++) {
+            if (filled || y == top || y == bottom || x == left || x == right) {
+                framebuffer[y][x] = native_pixel(hue, sat, val);
+            }
+        }
+    }
+    windows++;
+    return true;
+}
+
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    if (right >= FRAME_WIDTH || bottom >= FRAME_HEIGHT || left > right || top > bottom || !viewport_filled()) {
+        return false;
+    }
+    viewport.framebuffer = (uint16_t(*)[FRAME_WIDTH])device;
+    viewport.left        = left;
+    viewport.top         = top;
+    viewport.right       = right;
+    viewport.bottom      = bottom;
+    viewport.written     = 0;
+    windows++;
+    return true;
+}
+
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint16_t *pixels = pixel_data;
+    uint16_t        width  = viewport.right - viewport.left + 1;
+
+    if ((uint16_t(*)[FRAME_WIDTH])device != viewport.framebuffer ||
+        viewport.written + native_pixel_count > (uint32_t)width * (viewport.bottom - viewport.top + 1)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < native_pixel_count; i++, viewport.written++) {
+        viewport.framebuffer[viewport.top + viewport.written / width][viewport.left + viewport.written % width] =
+            pixels[i];
+    }
+    return true;
+}
+
+/*
+ * Reference: the grids and drawing render_life() had, with its rectangles relative to the grid.
+ */
+
+static bool grid[PAINTER_LIFE_HEIGHT][PAINTER_LIFE_WIDTH], new_grid[PAINTER_LIFE_HEIGHT][PAINTER_LIFE_WIDTH],
+    changed_grid[PAINTER_LIFE_HEIGHT][PAINTER_LIFE_WIDTH];
+
+static void reference_seed(void) {
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            grid[y][x] = (rand() < PAINTER_LIFE_INITIAL_ALIVE_PROBABILITY * RAND_MAX);
+        }
+    }
+}
+
+static void reference_draw(framebuffer_t framebuffer, hsv_t outline, hsv_t alive) {
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            if (changed_grid[y][x]) {
+                uint16_t left   = x * PAINTER_LIFE_PITCH;
+                uint16_t top    = y * PAINTER_LIFE_PITCH;
+                uint16_t right  = left + PAINTER_LIFE_PITCH;
+                uint16_t bottom = top + PAINTER_LIFE_PITCH;
+
+                qp_rect(framebuffer, left, top, right, bottom, outline.h, outline.s, outline.v, false);
+                qp_rect(framebuffer, left + 1, top + 1, right - 1, bottom - 1, 0, 0, 0, true);
+                if (grid[y][x]) {
+                    qp_rect(framebuffer, left + PAINTER_LIFE_OUTLINE_SIZE, top + PAINTER_LIFE_OUTLINE_SIZE,
+                            right - PAINTER_LIFE_OUTLINE_SIZE, bottom - PAINTER_LIFE_OUTLINE_SIZE, alive.h, alive.s,
+                            alive.v, true);
+                }
+            }
+        }
+    }
+}
+
+static void reference_step(void) {
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            uint8_t alive_neighbors = 0;
+
+            for (int8_t dy = -1; dy <= 1; dy++) {
+                for (int8_t dx = -1; dx <= 1; dx++) {
+                    if (dy == 0 && dx == 0) continue;
+                    int8_t ny = y + dy;
+                    int8_t nx = x + dx;
+                    if (ny >= 0 && ny < PAINTER_LIFE_HEIGHT && nx >= 0 && nx < PAINTER_LIFE_WIDTH) {
+                        alive_neighbors += grid[ny][nx];
+                    }
+                }
+            }
+            if (grid[y][x]) {
+                new_grid[y][x] = (alive_neighbors == 2 || alive_neighbors == 3);
+            } else {
+                new_grid[y][x] = (alive_neighbors == 3);
+            }
+            changed_grid[y][x] = (grid[y][x] != new_grid[y][x]);
+        }
+    }
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            grid[y][x] = new_grid[y][x];
+        }
+    }
+}
+
+static void reference_scatter(uint8_t x, uint8_t y, uint8_t size) {
+    for (uint8_t dy = 0; dy < size; dy++) {
+        for (uint8_t dx = 0; dx < size; dx++) {
+            bool is_alive                = rand() % 2;
+            grid[y + dy][x + dx]         = is_alive;
+            changed_grid[y + dy][x + dx] = true;
+        }
+    }
+}
+
+/*
+ * Test
+ */
+
+static bool grids_match(const painter_life_t *life) {
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            if (grid[y][x] != ((life->rows[y] >> x) & 1) || changed_grid[y][x] != ((life->changed[y] >> x) & 1)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Runs both versions from one seed, the way render_life() calls them: draw, step, and now and then scatter a
+ * cluster. Each random step is given the same rand() sequence in both.
+ */
+static bool test_seed(unsigned seed, uint32_t *reference_windows, uint32_t *life_windows) {
+    static framebuffer_t  reference_framebuffer, life_framebuffer;
+    static const hsv_t    colours[] = {{0, 0, 160}, {23, 89, 255}, {131, 99, 255}, {176, 77, 255}};
+    static painter_life_t life;
+    unsigned              state;
+
+    memset(reference_framebuffer, 0x5A, sizeof(reference_framebuffer));
+    memset(life_framebuffer, 0x5A, sizeof(life_framebuffer));
+    memset(changed_grid, 0, sizeof(changed_grid));
+    memset(&life, 0, sizeof(life));
+
+    srand(seed);
+    state = rand();
+    srand(state);
+    reference_seed();
+    srand(state);
+    painter_life_seed(&life);
+    if (!grids_match(&life)) {
+        printf("seed %u: the seeded grids differ\n", seed);
+        return false;
+    }
+
+    for (uint16_t frame = 0; frame < TEST_FRAMES; frame++) {
+        hsv_t outline = {frame / 40 * 37, 255, 255 / 4};
+        hsv_t alive   = colours[frame / 25 % (sizeof(colours) / sizeof(colours[0]))];
+
+        windows = 0;
+        reference_draw(reference_framebuffer, outline, alive);
+        *reference_windows += windows;
+        windows = 0;
+        if (!painter_life_draw(life_framebuffer, 0, 0, &life, outline, alive) || !viewport_filled()) {
+            printf("seed %u, frame %u: drawing failed\n", seed, frame);
+            return false;
+        }
+        *life_windows += windows;
+        if (memcmp(reference_framebuffer, life_framebuffer, sizeof(life_framebuffer)) != 0) {
+            printf("seed %u, frame %u: the framebuffers differ\n", seed, frame);
+            return false;
+        }
+
+        reference_step();
+        painter_life_step(&life);
+        if (!grids_match(&life)) {
+            printf("seed %u, generation %u: the grids differ\n", seed, frame + 1);
+            return false;
+        }
+
+        if (frame % 7 == 0) {
+            state = rand();
+            srand(state);
+            uint8_t x = rand() % (PAINTER_LIFE_WIDTH - 3), y = rand() % (PAINTER_LIFE_HEIGHT - 3);
+            reference_scatter(x, y, 3);
+            srand(state);
+            x = rand() % (PAINTER_LIFE_WIDTH - 3), y = rand() % (PAINTER_LIFE_HEIGHT - 3);
+            painter_life_scatter(&life, x, y, 3);
+            if (!grids_match(&life)) {
+                printf("seed %u, generation %u: the scattered grids differ\n", seed, frame + 1);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*
+ * Benchmark
+ */
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static double time_step(bool bitboard) {
+    static painter_life_t life;
+    uint32_t              generations = 0;
+    double                start       = now(), elapsed;
+
+    do {
+        srand(generations);
+        if (bitboard) {
+            painter_life_seed(&life);
+        } else {
+            reference_seed();
+        }
+        for (uint8_t i = 0; i < 64; i++, generations++) {
+            if (bitboard) {
+                painter_life_step(&life);
+            } else {
+                reference_step();
+            }
+        }
+    } while ((elapsed = now() - start) < MIN_BENCH_SECONDS);
+    return elapsed / generations;
+}
+
+int main(void) {
+    uint32_t reference_windows = 0, life_windows = 0;
+    bool     passed            = true;
+
+    for (unsigned seed = 1; seed <= TEST_SEEDS && passed; seed++) {
+        passed = test_seed(seed, &reference_windows, &life_windows);
+    }
+    if (passed) {
+        printf("%u seeds, %u generations each: grids, changed cells and framebuffers match\n", TEST_SEEDS, TEST_FRAMES);
+    }
+
+    double reference_time = time_step(false), life_time = time_step(true);
+    printf("generation: %.0f ns with bool grids, %.0f ns with bitboards (%.1fx)\n", reference_time * 1e9,
+           life_time * 1e9, reference_time / life_time);
+    printf("windows per frame: %.1f with rectangles cell by cell, %.1f with %s in spans\n",
+           (double)reference_windows / (TEST_SEEDS * TEST_FRAMES), (double)life_windows / (TEST_SEEDS * TEST_FRAMES),
+           LIFE_DRAWN_WITH);
+    printf("%s\n", passed ? "all generations match" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,493 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for the painter damage, driving the real ILI9341 renderer the way the firmware does.
+ *
+ * Boots the display with keyboard_post_init_quantum_painter(), then runs housekeeping_task_display_menu_user() every
+ * millisecond, so painter_damage.c, ili9341_draw_user() and the painter_render_* blocks are the ones in the
+ * firmware. The panel is a fake that records the draw calls: a frame is everything between qp_get_geometry() and
+ * qp_flush(), each block is told apart by the first text it draws, and the Game of Life by its viewports. The
+ * Quantum state the blocks show is set by the test, which counts how often a frame reads it.
+ *
+ * Checks that an idle display only wakes for the idle refresh, and that a refresh only redraws the time based blocks
+ * without reading any other state. Then that each change, including the ones nothing presses a key for (caps word
+ * timing out, the host OS being detected), is drawn within a throttle period and only by the blocks showing it,
+ * that bursts of marks are drawn once a throttle period, and that an animation runs at the throttle rate while it's
+ * shown and stops with it.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -w -o painter_damage_test -Iusers/drashna/display/painter/bench -Iusers/drashna/bench/qmk \
+ *         -Iusers/drashna -Iusers/drashna/hardware -DUSERSPACE_CONFIG_SIZE=64 -DQUANTUM_PAINTER_TASK_THROTTLE=10 \
+ *         -DQUANTUM_PAINTER_DISPLAY_TIMEOUT=3600000 -DDISPLAY_CS_PIN=NO_PIN -DDISPLAY_DC_PIN=NO_PIN \
+ *         -DCUSTOM_QUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_ILI9341_ENABLE -DCUSTOM_QUANTUM_PAINTER_ILI9341 \
+ *         -DOS_DETECTION_ENABLE -DCAPS_WORD_ENABLE -DCOMMUNITY_MODULE_RTC_ENABLE -DAUTOCORRECT_ENABLE \
+ *         -DSPLIT_KEYBOARD users/drashna/display/painter/bench/painter_damage_test.c \
+ *         users/drashna/display/painter/painter_damage.c users/drashna/display/painter/painter.c \
+ *         users/drashna/display/painter/ili9341_display.c users/drashna/display/painter/painter_life.c \
+ *         users/drashna/display/painter/painter_rle565.c users/drashna/display/painter/graphics.qgf.c \
+ *         users/drashna/display/painter/fonts/*.qff.c users/drashna/display/painter/graphics/akira_explosion.qgf.c \
+ *         users/drashna/display/painter/graphics/large_nyan_cat.qgf.c \
+ *         users/drashna/display/painter/graphics/qmk_logo_220x220.qgf.c \
+ *         users/drashna/display/painter/graphics/qmk_powered_by.qgf.c \
+ *         users/drashna/display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.rle565.c
+ *     ./painter_damage_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "qp.h"
+#include "qp_comms.h"
+#include "os_detection.h"
+#include "split_util.h"
+#include "drashna_runtime.h"
+#include "drashna_layers.h"
+#include "display/display.h"
+#include "display/painter/painter_damage.h"
+#include "display/painter/painter_life.h"
+
+void keyboard_post_init_quantum_painter(void);
+void housekeeping_task_display_menu_user(void);
+
+/*
+ * Quantum stand ins, with the time and state set by the test
+ */
+
+static uint32_t now, last_input, scan_rate = 1000;
+static uint8_t  mods;
+static led_t    led_state;
+static bool     caps_word;
+static uint32_t state_reads; // reads of the (non time based) state, while drawing a frame
+static bool     in_frame;
+
+layer_state_t             layer_state, default_layer_state = 1;
+keymap_config_t           keymap_config;
+userspace_config_t        userspace_config;
+userspace_runtime_state_t userspace_runtime_state;
+os_variant_t              host_os = OS_UNSURE;
+bool                      autocorrect_str_has_changed;
+char                      autocorrected_str_raw[2][21];
+bool                      console_log_needs_redraw, console_has_redrawn;
+
+uint16_t timer_read(void) {
+    return now;
+}
+uint32_t timer_read32(void) {
+    return now;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)now - last;
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return now - last;
+}
+void wait_ms(uint32_t ms) {}
+
+uint32_t last_input_activity_elapsed(void) {
+    return now - last_input;
+}
+uint32_t last_matrix_activity_time(void) {
+    return last_input;
+}
+uint32_t last_encoder_activity_time(void) {
+    return 0;
+}
+uint32_t get_matrix_scan_rate(void) {
+    return scan_rate;
+}
+
+uint8_t get_mods(void) {
+    state_reads += in_frame;
+    return mods;
+}
+uint8_t get_weak_mods(void) {
+    return 0;
+}
+uint8_t get_oneshot_mods(void) {
+    return 0;
+}
+led_t host_keyboard_led_state(void) {
+    state_reads += in_frame;
+    return led_state;
+}
+bool is_caps_word_on(void) {
+    state_reads += in_frame;
+    return caps_word;
+}
+os_variant_t detected_host_os(void) {
+    state_reads += in_frame;
+    return host_os;
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+    for (uint8_t layer = 31; layer > 0; layer--) {
+        if (state & ((layer_state_t)1 << layer)) {
+            return layer;
+        }
+    }
+    return 0;
+}
+bool layer_state_cmp(layer_state_t state, uint8_t layer) {
+    return layer ? (state & ((layer_state_t)1 << layer)) != 0 : state == 0;
+}
+bool is_gaming_layer_active(layer_state_t state) {
+    return false;
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+bool is_keyboard_left(void) {
+    return false;
+}
+bool is_transport_connected(void) {
+    return true;
+}
+bool is_device_suspended(void) {
+    return false;
+}
+bool eeconfig_is_enabled(void) {
+    return true;
+}
+void userspace_config_mark_dirty(void) {}
+
+bool rtc_is_connected(void) {
+    return true;
+}
+char *rtc_read_date_time_str(void) {
+    static char buf[24];
+    snprintf(buf, sizeof(buf), "2025-01-01 00:00:%02u", (unsigned)(now / 1000 % 60));
+    return buf;
+}
+
+const char *get_hardware_id_string(void) {
+    return "BENCH";
+}
+const char *get_layer_name_string(uint8_t layer, bool alt_name, bool is_default) {
+    return "LAYER";
+}
+const char *os_variant_to_string(os_variant_t os_detected) {
+    return "OS";
+}
+const char *get_keycode_string(uint16_t keycode) {
+    return "KC";
+}
+const char *get_u8_str(uint8_t curr_num, char curr_pad) {
+    static char buf[4];
+    snprintf(buf, sizeof(buf), "%3u", curr_num);
+    return buf;
+}
+
+void display_console_get_lines(display_console_line_t lines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1]) {
+    memset(lines, 0, sizeof(display_console_line_t) * (DISPLAY_CONSOLE_LOG_LINE_NUM + 1));
+}
+char *display_console_copy_line(const display_console_line_t *line, char buffer[DISPLAY_CONSOLE_LOG_LINE_LENGTH + 1]) {
+    buffer[0] = '\0';
+    return buffer;
+}
+
+rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
+    return (rgb_t){hsv.v, hsv.v, hsv.v};
+}
+
+/*
+ * The recording panel
+ */
+
+typedef enum {
+    BLOCK_SCAN_RATE,
+    BLOCK_LOCK_STATE,
+    BLOCK_KEYMAP_CONFIG,
+    BLOCK_DEVICE_CONFIG,
+    BLOCK_MODIFIERS,
+    BLOCK_HOST_OS,
+    BLOCK_DEFAULT_LAYER,
+    BLOCK_LAYER,
+    BLOCK_AUTOCORRECT,
+    BLOCK_RTC,
+    BLOCK_COUNT,
+} block_t;
+
+// the first text each block draws
+static const char *block_text[BLOCK_COUNT] = {
+    [BLOCK_SCAN_RATE] = "SCANS: ",      [BLOCK_LOCK_STATE] = "SCRL",      [BLOCK_KEYMAP_CONFIG] = "NKRO",
+    [BLOCK_DEVICE_CONFIG] = "AUDIO",    [BLOCK_MODIFIERS] = "Modifiers:", [BLOCK_HOST_OS] = "OS: ",
+    [BLOCK_DEFAULT_LAYER] = "Layout: ", [BLOCK_LAYER] = "Layer: ",        [BLOCK_AUTOCORRECT] = "Autocorrected: ",
+    [BLOCK_RTC] = "RTC Date/Time: ",
+};
+
+typedef struct panel_t {
+    uint32_t frames, draws, viewports;
+    uint32_t blocks[BLOCK_COUNT];
+} panel_t;
+
+static panel_t panel;
+
+painter_device_t qp_ili9341_make_spi_device(uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin,
+                                            pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode) {
+    return &panel;
+}
+
+bool qp_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+bool qp_power(painter_device_t device, bool power_on) {
+    return true;
+}
+bool qp_clear(painter_device_t device) {
+    return true;
+}
+void qp_get_geometry(painter_device_t device, uint16_t *width, uint16_t *height, painter_rotation_t *rotation,
+                     uint16_t *offset_x, uint16_t *offset_y) {
+    *width   = 240;
+    *height  = 320;
+    in_frame = true;
+}
+bool qp_flush(painter_device_t device) {
+    panel.frames++;
+    in_frame = false;
+    return true;
+}
+bool qp_comms_start(painter_device_t device) {
+    return true;
+}
+void qp_comms_stop(painter_device_t device) {}
+void qp_comms_command(painter_device_t device, uint8_t cmd) {}
+
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    panel.viewports++;
+    return true;
+}
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    panel.draws++;
+    return true;
+}
+bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat,
+             uint8_t val) {
+    panel.draws++;
+    return true;
+}
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue,
+             uint8_t sat, uint8_t val, bool filled) {
+    panel.draws++;
+    return true;
+}
+
+// the sizes come from the QGF and QFF headers, after the 5 byte block header and the format's own
+static painter_image_desc_t images[32];
+static painter_font_desc_t  fonts[8];
+static uint8_t              image_count, font_count;
+
+painter_image_handle_t qp_load_image_mem(const void *buffer) {
+    const uint8_t        *qgf   = buffer;
+    painter_image_desc_t *image = &images[image_count++];
+    image->width                = qgf[17] | qgf[18] << 8;
+    image->height               = qgf[19] | qgf[20] << 8;
+    image->frame_count          = qgf[21] | qgf[22] << 8;
+    return image;
+}
+bool qp_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image) {
+    panel.draws++;
+    return true;
+}
+bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg,
+                          uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    panel.draws++;
+    return true;
+}
+deferred_token qp_animate(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image) {
+    panel.draws++;
+    return 1;
+}
+void qp_stop_animation(deferred_token anim_token) {}
+
+painter_font_handle_t qp_load_font_mem(const void *buffer) {
+    painter_font_desc_t *font = &fonts[font_count++];
+    font->line_height         = ((const uint8_t *)buffer)[17];
+    return font;
+}
+int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
+    return strlen(str) * font->line_height / 2;
+}
+int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font,
+                            const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg,
+                            uint8_t sat_bg, uint8_t val_bg) {
+    panel.draws++;
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        if (strncmp(str, block_text[block], strlen(block_text[block])) == 0) {
+            panel.blocks[block]++;
+        }
+    }
+    return qp_textwidth(font, str);
+}
+
+static void run(uint32_t ms) {
+    for (uint32_t end = now + ms; now < end; now++) {
+        housekeeping_task_display_menu_user();
+    }
+}
+
+/*
+ * Test
+ */
+
+#define CHECK(condition, ...)              \
+    if (!(condition)) {                    \
+        printf("%5u ms: ", (unsigned)now); \
+        printf(__VA_ARGS__);               \
+        printf("\n");                      \
+        return false;                      \
+    }
+
+// checks that a change drew one frame, within a throttle period, and only redrew the blocks given
+#define CHECK_REDRAWN(what, ...)                                                                                    \
+    do {                                                                                                            \
+        const block_t redrawn[] = {__VA_ARGS__};                                                                    \
+        uint32_t      expected[BLOCK_COUNT];                                                                        \
+        memcpy(expected, before.blocks, sizeof(expected));                                                          \
+        for (uint8_t i = 0; i < sizeof(redrawn) / sizeof(redrawn[0]); i++) {                                        \
+            expected[redrawn[i]]++;                                                                                 \
+        }                                                                                                           \
+        run(QUANTUM_PAINTER_TASK_THROTTLE + 1);                                                                     \
+        CHECK(panel.frames == before.frames + 1, "%s drew %u frames", what, panel.frames - before.frames);         \
+        for (uint8_t block = 0; block < BLOCK_COUNT; block++) {                                                     \
+            CHECK(panel.blocks[block] == expected[block], "%s drew the \"%s\" block %d times", what,                \
+                  block_text[block], (int)(panel.blocks[block] - before.blocks[block]));                            \
+        }                                                                                                           \
+    } while (0)
+
+// lets the last frame's throttle period and the idle refresh pass, so the next change gets its own frame
+static void settle(void) {
+    run(PAINTER_IDLE_REFRESH_MS - now % PAINTER_IDLE_REFRESH_MS + QUANTUM_PAINTER_TASK_THROTTLE);
+}
+
+static bool test_damage(void) {
+    panel_t before;
+
+    // Boot draws everything
+    keyboard_post_init_quantum_painter();
+    run(1000);
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        CHECK(panel.blocks[block] > 0, "the \"%s\" block wasn't drawn at boot", block_text[block]);
+    }
+
+    // Idle: only the idle refresh, which only redraws the time based blocks, and doesn't read anything else
+    before      = panel;
+    state_reads = 0;
+    run(5000);
+    scan_rate = 1200;
+    run(5000);
+    CHECK(panel.frames - before.frames == 10000 / PAINTER_IDLE_REFRESH_MS, "%u frames while idle",
+          panel.frames - before.frames);
+    CHECK(state_reads == 0, "idle frames read the state %u times", state_reads);
+    CHECK(panel.blocks[BLOCK_SCAN_RATE] == before.blocks[BLOCK_SCAN_RATE] + 1, "the scan rate was drawn %u times",
+          panel.blocks[BLOCK_SCAN_RATE] - before.blocks[BLOCK_SCAN_RATE]);
+    CHECK(panel.blocks[BLOCK_RTC] > before.blocks[BLOCK_RTC] + 10000 / 250, "the clock was only drawn %u times",
+          panel.blocks[BLOCK_RTC] - before.blocks[BLOCK_RTC]);
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        CHECK(block == BLOCK_SCAN_RATE || block == BLOCK_RTC || panel.blocks[block] == before.blocks[block],
+              "idle frames redrew the \"%s\" block", block_text[block]);
+    }
+
+    // Keymap config, as process_record marks it: the keymap config and the modifiers it swaps
+    settle();
+    before             = panel;
+    keymap_config.nkro = true;
+    painter_damage_mark(PAINTER_DAMAGE_INPUT);
+    CHECK_REDRAWN("a keymap config change", BLOCK_KEYMAP_CONFIG, BLOCK_MODIFIERS);
+
+    // Layers, picked up by the damage task
+    settle();
+    before      = panel;
+    layer_state = (layer_state_t)1 << _LOWER;
+    CHECK_REDRAWN("a layer change", BLOCK_DEFAULT_LAYER, BLOCK_LAYER);
+
+    // Mods
+    settle();
+    before = panel;
+    mods   = 0x02;
+    CHECK_REDRAWN("a mods change", BLOCK_MODIFIERS);
+
+    // Lock LEDs
+    settle();
+    before              = panel;
+    led_state.caps_lock = true;
+    CHECK_REDRAWN("a lock LED change", BLOCK_LOCK_STATE);
+
+    // Caps word turns on with a key press, but times out without one, and both are drawn with the keymap config
+    settle();
+    before    = panel;
+    caps_word = true;
+    painter_damage_mark(PAINTER_DAMAGE_INPUT);
+    CHECK_REDRAWN("caps word turning on", BLOCK_KEYMAP_CONFIG, BLOCK_MODIFIERS);
+    settle();
+    before    = panel;
+    caps_word = false;
+    CHECK_REDRAWN("caps word timing out", BLOCK_KEYMAP_CONFIG, BLOCK_MODIFIERS);
+
+    // The host OS is detected without a key press, and swaps ctl and gui for macOS, as drashna.c does
+    settle();
+    before                       = panel;
+    host_os                      = OS_MACOS;
+    keymap_config.swap_lctl_lgui = true;
+    painter_damage_mark(PAINTER_DAMAGE_HOST_OS);
+    CHECK_REDRAWN("the host OS being detected", BLOCK_KEYMAP_CONFIG, BLOCK_MODIFIERS, BLOCK_HOST_OS);
+
+    // Typing: a mark every millisecond is drawn at most once a throttle period
+    before = panel;
+    for (uint32_t i = 0; i < 1000; i++) {
+        userspace_runtime_state.last_keycode = i;
+        last_input                           = now;
+        painter_damage_mark(PAINTER_DAMAGE_INPUT);
+        run(1);
+    }
+    run(QUANTUM_PAINTER_TASK_THROTTLE + 1);
+    CHECK(panel.frames - before.frames <= 1000 / QUANTUM_PAINTER_TASK_THROTTLE + 1, "%u frames for 1000 ms of typing",
+          panel.frames - before.frames);
+    CHECK(panel.frames - before.frames >= 1000 / QUANTUM_PAINTER_TASK_THROTTLE - 1, "only %u frames while typing",
+          panel.frames - before.frames);
+
+    // The Game of Life runs at the throttle rate while it's shown, without an idle refresh to wait for
+    settle();
+    before                                              = panel;
+    userspace_config.display.painter.left.display_mode = 4;
+    painter_damage_mark(PAINTER_DAMAGE_MENU);
+    run(1000);
+    CHECK(panel.frames - before.frames >= 1000 / QUANTUM_PAINTER_TASK_THROTTLE - 1, "only %u frames of animation",
+          panel.frames - before.frames);
+    CHECK(panel.frames - before.frames <= 1000 / QUANTUM_PAINTER_TASK_THROTTLE + 1, "%u frames in 1000 ms of animation",
+          panel.frames - before.frames);
+    CHECK(panel.viewports - before.viewports >= (1000 / QUANTUM_PAINTER_TASK_THROTTLE - 1) /
+                                                     PAINTER_LIFE_FRAMES_PER_GENERATION,
+          "only %u generations drawn", panel.viewports - before.viewports);
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        CHECK(block == BLOCK_SCAN_RATE || block == BLOCK_RTC || panel.blocks[block] == before.blocks[block],
+              "animation frames redrew the \"%s\" block", block_text[block]);
+    }
+
+    // And stops with it
+    userspace_config.display.painter.left.display_mode = 2;
+    painter_damage_mark(PAINTER_DAMAGE_MENU);
+    settle();
+    before = panel;
+    run(1000);
+    CHECK(panel.viewports == before.viewports, "the animation ran after it was hidden");
+    CHECK(panel.frames - before.frames == 1000 / PAINTER_IDLE_REFRESH_MS, "%u frames after the animation stopped",
+          panel.frames - before.frames);
+    return true;
+}
+
+int main(void) {
+    // the painter colours, as eeconfig would have them
+    userspace_config.display.painter.hsv.primary   = (hsv_t){.h = 128, .s = 255, .v = 255};
+    userspace_config.display.painter.hsv.secondary = (hsv_t){.h = 213, .s = 255, .v = 255};
+
+    if (!test_damage()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%u frames, %u draw calls, %u viewports\n", panel.frames, panel.draws, panel.viewports);
+    printf("idle refreshes only redraw the time based blocks, and each change only the blocks showing it\n");
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum Painter's qp.h, for the painter tests and benchmarks. Each of them provides the device.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "quantum/quantum.h" // as qp_internal.h does
+
+typedef const void *painter_device_t;
+typedef uint32_t    pin_t;
+typedef uint8_t     deferred_token;
+
+#define INVALID_DEFERRED_TOKEN 0
+#define NO_PIN                 ((pin_t)~0)
+
+typedef enum { QP_ROTATION_0, QP_ROTATION_90, QP_ROTATION_180, QP_ROTATION_270 } painter_rotation_t;
+
+typedef struct painter_font_desc_t {
+    uint8_t line_height;
+} painter_font_desc_t;
+typedef const painter_font_desc_t *painter_font_handle_t;
+
+typedef struct painter_image_desc_t {
+    uint16_t width;
+    uint16_t height;
+    uint16_t frame_count;
+} painter_image_desc_t;
+typedef const painter_image_desc_t *painter_image_handle_t;
+
+bool qp_init(painter_device_t device, painter_rotation_t rotation);
+bool qp_power(painter_device_t device, bool power_on);
+bool qp_clear(painter_device_t device);
+bool qp_flush(painter_device_t device);
+void qp_get_geometry(painter_device_t device, uint16_t *width, uint16_t *height, painter_rotation_t *rotation,
+                     uint16_t *offset_x, uint16_t *offset_y);
+
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
+bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat,
+             uint8_t val);
+bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue,
+             uint8_t sat, uint8_t val, bool filled);
+
+painter_image_handle_t qp_load_image_mem(const void *buffer);
+bool                   qp_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image);
+bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg,
+                          uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+deferred_token qp_animate(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image);
+void           qp_stop_animation(deferred_token anim_token);
+
+painter_font_handle_t qp_load_font_mem(const void *buffer);
+int16_t               qp_textwidth(painter_font_handle_t font, const char *str);
+int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font,
+                            const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg,
+                            uint8_t sat_bg, uint8_t val_bg);
+
+painter_device_t qp_ili9341_make_spi_device(uint16_t panel_width, uint16_t panel_height, pin_t chip_select_pin,
+                                            pin_t dc_pin, pin_t reset_pin, uint16_t spi_divisor, int spi_mode);
@@ -0,0 +1,12 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum Painter's qp_comms.h, for the painter tests.
+
+#pragma once
+
+#include "qp.h"
+
+bool qp_comms_start(painter_device_t device);
+void qp_comms_stop(painter_device_t device);
+void qp_comms_command(painter_device_t device, uint8_t cmd);
@@ -0,0 +1,9 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for Quantum Painter's qp_ili9xxx_opcodes.h, for the painter tests.
+
+#pragma once
+
+#define ILI9XXX_CMD_INVERT_OFF 0x20
+#define ILI9XXX_CMD_INVERT_ON  0x21
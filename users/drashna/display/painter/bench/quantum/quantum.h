@@ -0,0 +1,38 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for quantum.h, for the painter tests, which provide the functions they call.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "action.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "eeconfig.h"
+#include "keyboard.h"
+#include "keycodes.h"
+#include "led.h"
+#include "progmem.h"
+#include "timer.h"
+#include "util.h"
+#include "wait.h"
+#ifdef CAPS_WORD_ENABLE
+#    include "caps_word.h"
+#endif // CAPS_WORD_ENABLE
+
+#ifndef PRODUCT
+#    define PRODUCT "Bench"
+#endif // PRODUCT
+// painter_render_qmk_info() shows the newlib version the firmware was built with
+#ifndef _NEWLIB_VERSION
+#    define _NEWLIB_VERSION "host"
+#endif // _NEWLIB_VERSION
+
+const char *get_keycode_string(uint16_t keycode);
+uint16_t    keycode_config(uint16_t keycode);
+uint8_t     mod_config(uint8_t mod);
+const char *get_u8_str(uint8_t curr_num, char curr_pad);
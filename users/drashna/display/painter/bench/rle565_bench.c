@@ -0,0 +1,290 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test and benchmark for painter_rle565.c.
+ *
+ * Draws every screensaver image through painter_rle565_draw() into a framebuffer, checks the result against the
+ * reference bitmaps convert_rle565.py writes with --reference, and times it. For comparison, the same image is also
+ * drawn from its QGF, with a decoder modelled on the generic Quantum Painter one: the palette is converted from HSV on
+ * every draw, and the RLE stream and the pixels go through a callback each.
+ *
+ * From the root of the userspace:
+ *
+ *     python3 users/drashna/display/painter/graphics/convert_rle565.py --reference /tmp/rle565 \
+ *         users/drashna/display/painter/graphics/[a-z]*-240x320.qgf.c
+ *     cc -O2 -o rle565_bench -Iusers/drashna/display/painter/bench -Iusers/drashna/bench/qmk -Iusers/drashna \
+ *         users/drashna/display/painter/bench/rle565_bench.c users/drashna/display/painter/painter_rle565.c \
+ *         users/drashna/display/painter/graphics/[a-z]*-240x320.rle565.c \
+ *         users/drashna/display/painter/graphics/[a-z]*-240x320.qgf.c
+ *     ./rle565_bench /tmp/rle565
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "qp.h"
+#include "display/painter/painter_rle565.h"
+#include "display/painter/graphics/anime-girl-jacket-240x320.rle565.h"
+#include "display/painter/graphics/asuka-240x320.rle565.h"
+#include "display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.rle565.h"
+#include "display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.rle565.h"
+#include "display/painter/graphics/anime-girl-jacket-240x320.qgf.h"
+#include "display/painter/graphics/asuka-240x320.qgf.h"
+#include "display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.qgf.h"
+#include "display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.qgf.h"
+
+#define MIN_BENCH_SECONDS 0.25
+#define FRAME_WIDTH       240
+#define FRAME_HEIGHT      320
+// QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE from display/painter/config.h, in pixels
+#define QGF_BUFFER_PIXELS 1024
+
+#define BENCH_IMAGE(name) {#name, &name##_rle565, name, sizeof(name)}
+
+typedef struct bench_image_t {
+    const char                   *name;
+    const painter_rle565_image_t *image;
+    const uint8_t                *qgf;
+    uint32_t                      qgf_size;
+} bench_image_t;
+
+static const bench_image_t images[] = {
+    BENCH_IMAGE(gfx_asuka_240x320),
+    BENCH_IMAGE(gfx_anime_girl_jacket_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_00_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_01_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_02_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_03_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_04_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_05_240x320),
+    BENCH_IMAGE(gfx_neon_genesis_evangelion_initial_machine_06_240x320),
+    BENCH_IMAGE(gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320),
+};
+
+/*
+ * The device: a framebuffer the viewport and pixel data go to, the way the panel would take them.
+ */
+
+static uint16_t framebuffer[FRAME_WIDTH * FRAME_HEIGHT];
+static uint32_t framebuffer_position, framebuffer_end;
+static uint32_t pixdata_calls;
+
+bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    (void)device;
+    if (right >= FRAME_WIDTH || bottom >= FRAME_HEIGHT || left != 0 || right != FRAME_WIDTH - 1) {
+        return false;
+    }
+    framebuffer_position = top * FRAME_WIDTH;
+    framebuffer_end      = (bottom + 1) * FRAME_WIDTH;
+    return true;
+}
+
+bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    (void)device;
+    if (native_pixel_count > framebuffer_end - framebuffer_position) {
+        return false;
+    }
+    memcpy(&framebuffer[framebuffer_position], pixel_data, native_pixel_count * sizeof(uint16_t));
+    framebuffer_position += native_pixel_count;
+    pixdata_calls++;
+    return true;
+}
+
+/*
+ * QGF path, modelled on the generic decoder in quantum/painter/qp_draw_image.c.
+ */
+
+typedef struct qgf_stream_t {
+    const uint8_t *data;
+    uint32_t       position, size;
+} qgf_stream_t;
+
+typedef struct qgf_rle_state_t {
+    qgf_stream_t *stream;
+    uint8_t       mode, remaining, value;
+} qgf_rle_state_t;
+
+typedef struct qgf_pixel_state_t {
+    const uint16_t *palette;
+    uint16_t        buffer[QGF_BUFFER_PIXELS];
+    uint16_t        pixels;
+} qgf_pixel_state_t;
+
+static int16_t qgf_stream_get(qgf_stream_t *stream) {
+    return stream->position < stream->size ? stream->data[stream->position++] : -1;
+}
+
+static int16_t qgf_rle_get(qgf_rle_state_t *state) {
+    if (state->remaining == 0) {
+        int16_t marker = qgf_stream_get(state->stream);
+        if (marker < 0) {
+            return -1;
+        }
+        state->mode      = marker < 128;
+        state->remaining = marker < 128 ? marker : marker - 127;
+        if (state->mode) {
+            state->value = qgf_stream_get(state->stream);
+        }
+    }
+    state->remaining--;
+    return state->mode ? state->value : qgf_stream_get(state->stream);
+}
+
+static bool qgf_append_pixel(qgf_pixel_state_t *state, uint8_t index) {
+    state->buffer[state->pixels++] = state->palette[index];
+    if (state->pixels == QGF_BUFFER_PIXELS) {
+        state->pixels = 0;
+        return qp_pixdata(NULL, state->buffer, QGF_BUFFER_PIXELS);
+    }
+    return true;
+}
+
+static uint16_t qgf_palette_convert(uint8_t h, uint8_t s, uint8_t v) {
+    uint8_t r = v, g = v, b = v;
+    if (s) {
+        uint8_t region    = h * 6 / 255;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+        uint8_t p         = (v * (255 - s)) >> 8;
+        uint8_t q         = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        uint8_t t         = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+        switch (region) {
+            case 6:
+            case 0:
+                r = v, g = t, b = p;
+                break;
+            case 1:
+                r = q, g = v, b = p;
+                break;
+            case 2:
+                r = p, g = v, b = t;
+                break;
+            case 3:
+                r = p, g = q, b = v;
+                break;
+            case 4:
+                r = t, g = p, b = v;
+                break;
+            default:
+                r = v, g = p, b = q;
+                break;
+        }
+    }
+    uint16_t rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    return __builtin_bswap16(rgb565);
+}
+
+static bool qgf_draw(const uint8_t *qgf, uint32_t size) {
+    static qgf_pixel_state_t pixel_state;
+    uint16_t                 palette[256];
+    qgf_stream_t             stream = {0};
+
+    if (!qp_viewport(NULL, 0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1)) {
+        return false;
+    }
+    for (uint32_t offset = 0; offset < size;) {
+        uint8_t  type   = qgf[offset];
+        uint32_t length = qgf[offset + 2] | qgf[offset + 3] << 8 | qgf[offset + 4] << 16;
+        if (type == 0x03) {
+            for (uint32_t i = 0; i < length / 3; i++) {
+                const uint8_t *entry = &qgf[offset + 5 + i * 3];
+                palette[i]           = qgf_palette_convert(entry[0], entry[1], entry[2]);
+            }
+        } else if (type == 0x05) {
+            stream = (qgf_stream_t){.data = &qgf[offset + 5], .size = length};
+        }
+        offset += 5 + length;
+    }
+
+    qgf_rle_state_t rle = {.stream = &stream};
+    pixel_state.palette = palette;
+    pixel_state.pixels  = 0;
+    for (uint32_t i = 0; i < FRAME_WIDTH * FRAME_HEIGHT; i++) {
+        int16_t index = qgf_rle_get(&rle);
+        if (index < 0 || !qgf_append_pixel(&pixel_state, index)) {
+            return false;
+        }
+    }
+    return pixel_state.pixels == 0 || qp_pixdata(NULL, pixel_state.buffer, pixel_state.pixels);
+}
+
+/*
+ * Benchmark
+ */
+
+static double now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static bool read_reference(const char *directory, const char *name, uint16_t *pixels) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.rgb565", directory, name);
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    size_t count = fread(pixels, sizeof(uint16_t), FRAME_WIDTH * FRAME_HEIGHT, file);
+    fclose(file);
+    return count == FRAME_WIDTH * FRAME_HEIGHT;
+}
+
+static double time_draw(const bench_image_t *image, bool rle565) {
+    uint32_t draws = 0;
+    double   start = now(), elapsed;
+    do {
+        for (uint8_t i = 0; i < 8; i++, draws++) {
+            if (rle565) {
+                painter_rle565_draw(NULL, 0, 0, image->image);
+            } else {
+                qgf_draw(image->qgf, image->qgf_size);
+            }
+        }
+    } while ((elapsed = now() - start) < MIN_BENCH_SECONDS);
+    return elapsed / draws;
+}
+
+int main(int argc, char **argv) {
+    static uint16_t reference[FRAME_WIDTH * FRAME_HEIGHT];
+    bool            passed      = true;
+    uint32_t        rle565_size = 0, qgf_size = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s reference_directory\n", argv[0]);
+        return 2;
+    }
+
+    printf("%-56s %8s %8s %9s %9s %7s\n", "image", "bytes", "QGF", "us/draw", "QGF us", "calls");
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        const bench_image_t *image = &images[i];
+        uint32_t             size  = image->image->palette_size * sizeof(uint16_t) + image->image->data_size;
+
+        if (!read_reference(argv[1], image->name, reference)) {
+            fprintf(stderr, "%s: can't read the reference bitmap\n", image->name);
+            return 2;
+        }
+        memset(framebuffer, 0xA5, sizeof(framebuffer));
+        pixdata_calls = 0;
+        if (!painter_rle565_draw(NULL, 0, 0, image->image) || framebuffer_position != framebuffer_end ||
+            memcmp(framebuffer, reference, sizeof(reference)) != 0) {
+            printf("%s: RLE565 doesn't match the reference\n", image->name);
+            passed = false;
+        }
+        uint32_t calls = pixdata_calls;
+        memset(framebuffer, 0xA5, sizeof(framebuffer));
+        if (!qgf_draw(image->qgf, image->qgf_size) || memcmp(framebuffer, reference, sizeof(reference)) != 0) {
+            printf("%s: QGF doesn't match the reference\n", image->name);
+            passed = false;
+        }
+
+        printf("%-56s %8u %8u %9.1f %9.1f %7u\n", image->name, size, image->qgf_size,
+               time_draw(image, true) * 1e6, time_draw(image, false) * 1e6, calls);
+        rle565_size += size;
+        qgf_size += image->qgf_size;
+    }
+    printf("total: %u bytes, against %u bytes as QGF\n", rle565_size, qgf_size);
+    printf("%s\n", passed ? "all images match their references" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for the rtc community module's rtc.h, for the painter tests.
+
+#pragma once
+
+#include <stdbool.h>
+
+bool        rtc_is_connected(void);
+const char *rtc_read_date_time_str(void);
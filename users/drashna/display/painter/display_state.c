@@ -0,0 +1,84 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "display/painter/display_state.h"
+#include <string.h>
+#include <ch.h>
+
+#define display_state_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/**
+ * Double buffered seqlock. The main loop is the only writer: it builds the next snapshot in the buffer the reader
+ * isn't pointed at, then bumps `published` to flip to it. `writing` is bumped before a buffer is touched, so a
+ * reader can tell if the buffer it copied from was reused under it (which takes two publishes during one copy)
+ * and retry. The writer never waits on the reader, and the reader only ever retries, never waits.
+ */
+static display_state_snapshot_t snapshots[2];
+static volatile uint32_t         published     = 0;
+static volatile uint32_t         writing       = 0;
+static volatile uint32_t         consumed      = 0;
+static uint16_t                  unread_damage = 0;
+
+/**
+ * @brief Publishes the current state for the painter thread. Called from the main loop only.
+ *
+ * The split transport writes into the runtime state and keylogger from its own thread on the slave half, so the
+ * copy is made with the system locked. That only holds off the transport for the length of the copy, and never
+ * the painter thread.
+ *
+ * The painter thread only reads the latest snapshot, so the damage of any it skipped is carried into this one. If it
+ * is reading the previous one right now, that damage is kept as well, which only costs a block a look it didn't need.
+ *
+ * @param damage painter_damage_t bits that changed since the last publish
+ */
+void display_state_publish(uint16_t damage) {
+    uint32_t                  seq      = published + 1;
+    display_state_snapshot_t *snapshot = &snapshots[seq & 1];
+
+    unread_damage = consumed == published ? damage : unread_damage | damage;
+
+    writing = seq;
+    display_state_barrier();
+
+    chSysLock();
+    memcpy(&snapshot->userspace_runtime_state, &userspace_runtime_state, sizeof(userspace_runtime_state_t));
+    memcpy(&snapshot->userspace_config, &userspace_config, sizeof(userspace_config_t));
+    snapshot->keymap_config.raw = keymap_config.raw;
+#ifdef WPM_ENABLE
+    memcpy(snapshot->wpm_graph_samples, wpm_stats_history(WPM_STATS_SECONDS), sizeof(snapshot->wpm_graph_samples));
+#endif // WPM_ENABLE
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+    memcpy(&snapshot->keylogger, get_keylogger_buffer(), sizeof(keylog_buffer_t));
+#endif // DISPLAY_KEYLOGGER_ENABLE
+    chSysUnlock();
+    snapshot->damage = unread_damage;
+
+    display_state_barrier();
+    published = seq;
+}
+
+/**
+ * @brief Copies the latest published snapshot, if there is a newer one than the caller last read. Called from the
+ * painter thread only.
+ *
+ * @param snapshot where to copy the snapshot to
+ * @param last_seq sequence number of the caller's current copy, updated on success
+ * @return true if a newer snapshot was copied
+ */
+bool display_state_read(display_state_snapshot_t *snapshot, uint32_t *last_seq) {
+    uint32_t seq;
+
+    do {
+        seq = published;
+        if (seq == *last_seq) {
+            return false;
+        }
+        display_state_barrier();
+        memcpy(snapshot, &snapshots[seq & 1], sizeof(display_state_snapshot_t));
+        display_state_barrier();
+    } while (writing - seq >= 2);
+
+    *last_seq = seq;
+    consumed  = seq;
+    return true;
+}
@@ -0,0 +1,36 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "drashna_runtime.h"
+#include "keycode_config.h"
+#ifdef WPM_ENABLE
+#    include "wpm_stats.h"
+#endif // WPM_ENABLE
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+#    include "display/painter/keylogger.h"
+#endif // DISPLAY_KEYLOGGER_ENABLE
+
+/**
+ * @brief Copy of everything the painter thread reads that is written by the main loop or the split transport.
+ * Member names match the globals they are copied from, so render code can use PAINTER_STATE(name) to read from
+ * the snapshot when the painter is threaded, and from the globals directly when it isn't.
+ */
+typedef struct display_state_snapshot_t {
+    userspace_runtime_state_t userspace_runtime_state;
+    userspace_config_t        userspace_config;
+    keymap_config_t           keymap_config;
+#ifdef WPM_ENABLE
+    uint8_t wpm_graph_samples[WPM_GRAPH_SAMPLES];
+#endif // WPM_ENABLE
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+    keylog_buffer_t keylogger;
+#endif // DISPLAY_KEYLOGGER_ENABLE
+    uint16_t damage; // painter_damage_t bits since the snapshot the painter thread last read
+} display_state_snapshot_t;
+
+void display_state_publish(uint16_t damage);
+bool display_state_read(display_state_snapshot_t *snapshot, uint32_t *last_seq);
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Generates keylogger_codepoints.h, the codepoint table keylogger.c looks basic keycodes up in.
+
+The keylogger turns a keycode into text by taking the name get_keycode_string() gives it, stripping the prefix and
+swapping it for the symbol in the replacements table, if there is one. That is a string compare for every
+replacement and a UTF-8 decode on every keypress. Most basic keycodes end up as a single codepoint, so this runs the
+same steps for each of them once, at build time, and writes out the result as a table indexed by keycode.
+
+The replacements and the prefixes are read from keylogger.c, so they stay the one list to edit. The keycode names
+are the ones Quantum's keycode_string.c gives basic keycodes. The media and mouse keycodes only have names there
+when extrakeys and mousekeys are enabled, so their entries are behind the same feature flags. Keycodes that don't
+end up as a single codepoint are left out, and still go through the string path.
+
+Rerun it after changing the replacements. The keylogger test in painter/bench fails if the table is stale.
+
+Usage: generate_keylogger_codepoints.py [keylogger.c] [-o keylogger_codepoints.h]
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+N_MODS = 3
+NO_MODS, SHIFT, AL_GR = range(N_MODS)
+
+C_STRING = r'"((?:[^"\\]|\\.)*)"'
+C_STRING_OR_NULL = rf'(?:{C_STRING}|NULL)'
+REPLACEMENT_RE = re.compile(
+    rf'^\s*replacement\(\s*{C_STRING}\s*,\s*{C_STRING_OR_NULL}\s*,\s*{C_STRING_OR_NULL}\s*,\s*{C_STRING_OR_NULL}\s*\)'
+)
+PREFIXES_RE = re.compile(r'char \*prefixes\[\] = \{([^}]*)\};')
+
+# Names keycode_string.c gives the basic keycodes, and the feature flag they need, in keycode order.
+KEYCODE_NAMES = [(f'KC_{c}', None) for c in 'ABCDEFGHIJKLMNOPQRSTUVWXYZ1234567890']
+KEYCODE_NAMES += [(f'KC_{name}', None) for name in [
+    'ENT', 'ESC', 'BSPC', 'TAB', 'SPC', 'MINS', 'EQL', 'LBRC', 'RBRC', 'BSLS', 'NUHS', 'SCLN', 'QUOT', 'GRV',
+    'COMM', 'DOT', 'SLSH', 'CAPS'
+]]
+KEYCODE_NAMES += [(f'KC_F{n}', None) for n in range(1, 13)]
+KEYCODE_NAMES += [(f'KC_{name}', None) for name in [
+    'PSCR', 'SCRL', 'PAUS', 'INS', 'HOME', 'PGUP', 'DEL', 'END', 'PGDN', 'RGHT', 'LEFT', 'DOWN', 'UP', 'NUBS', 'APP'
+]]
+KEYCODE_NAMES += [(f'KC_F{n}', None) for n in range(13, 25)]
+KEYCODE_NAMES += [(f'KC_{name}', 'EXTRAKEY_ENABLE') for name in [
+    'PWR', 'SLEP', 'WAKE', 'MUTE', 'VOLU', 'VOLD', 'MNXT', 'MPRV', 'MSTP', 'MPLY', 'MSEL', 'EJCT', 'MAIL', 'CALC',
+    'MYCM', 'WSCH', 'WHOM', 'WBAK', 'WFWD', 'WSTP', 'WREF', 'WFAV', 'MFFD', 'MRWD', 'BRIU', 'BRID'
+]]
+KEYCODE_NAMES += [(name, 'MOUSEKEY_ENABLE') for name in [
+    'MS_UP', 'MS_DOWN', 'MS_LEFT', 'MS_RGHT', 'MS_BTN1', 'MS_BTN2', 'MS_BTN3', 'MS_BTN4', 'MS_BTN5', 'MS_BTN6',
+    'MS_BTN7', 'MS_BTN8', 'MS_WHLU', 'MS_WHLD', 'MS_WHLL', 'MS_WHLR', 'MS_ACL0', 'MS_ACL1', 'MS_ACL2'
+]]
+KEYCODE_NAMES += [(f'KC_{name}', None) for name in ['LCTL', 'LSFT', 'LALT', 'LGUI', 'RCTL', 'RSFT', 'RALT', 'RGUI']]
+
+
+def c_unescape(string):
+    return re.sub(r'\\(.)', lambda match: {'n': '\n', 't': '\t', '0': '\0'}.get(match.group(1), match.group(1)),
+                  string)
+
+
+def parse_keylogger(path):
+    """Reads the replacements table and the prefixes skip_prefix() strips."""
+    replacements = {}
+    source = Path(path).read_text(encoding='utf-8')
+    for line in source.splitlines():
+        match = REPLACEMENT_RE.match(line)
+        if not match:
+            continue
+        raw, *strings = [None if group is None else c_unescape(group) for group in match.groups()]
+        # find_replacement() stops at the first match
+        replacements.setdefault(raw, strings)
+    match = PREFIXES_RE.search(source)
+    if not replacements or not match:
+        sys.exit(f'{path}: no replacements table or prefixes found')
+    prefixes = [c_unescape(prefix) for prefix in re.findall(C_STRING, match.group(1))]
+    return replacements, prefixes
+
+
+def skip_prefix(name, prefixes):
+    for prefix in prefixes:
+        if name.startswith(prefix):
+            return name[len(prefix):]
+    return name
+
+
+def maybe_symbol(name, variant, replacements):
+    """Same as maybe_symbol(), for the mods of one variant: the variant's string, falling back to NO_MODS."""
+    strings = replacements.get(name)
+    if strings is None:
+        return name
+    target = strings[variant] if strings[variant] is not None else strings[NO_MODS]
+    return target if target is not None else name
+
+
+def single_codepoint(string):
+    """Same as single_codepoint() in keylogger.c: 0 unless the string is exactly one codepoint in the BMP."""
+    if len(string) != 1 or ord(string) > 0xFFFF:
+        return 0
+    return ord(string)
+
+
+def c_codepoint(codepoint):
+    if codepoint == 0:
+        return '0'
+    if chr(codepoint) in "\\'":
+        return f"u'\\{chr(codepoint)}'"
+    if codepoint < 0x20 or codepoint == 0x7F:
+        return f'0x{codepoint:04X}'
+    return f"u'{chr(codepoint)}'"
+
+
+def generate(replacements, prefixes, output):
+    entries = []
+    for keycode, feature in KEYCODE_NAMES:
+        name = skip_prefix(keycode, prefixes)
+        variants = [single_codepoint(maybe_symbol(name, variant, replacements)) for variant in range(N_MODS)]
+        unmapped = single_codepoint(name)
+        if any(variants) or unmapped:
+            entries.append((keycode, feature, variants + [unmapped]))
+
+    width = max(len(keycode) for keycode, _, _ in entries) + 2
+    lines = [
+        "// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>",
+        '// SPDX-License-Identifier: GPL-3.0-or-later',
+        '',
+        '// Generated by generate_keylogger_codepoints.py from the replacements in keylogger.c, do not edit by hand.',
+        '',
+        '#pragma once',
+        '',
+        f'// {len(entries)} basic keycodes, as codepoints(no mods, shift, altgr, other mods).',
+        '',
+        '// clang-format off',
+        'static const keycode_codepoints_t keycode_codepoints[KC_RIGHT_GUI + 1] PROGMEM = {',
+    ]
+    current_feature = None
+    for keycode, feature, codepoints in entries:
+        if feature != current_feature:
+            if current_feature:
+                lines.append(f'#endif // {current_feature}')
+            if feature:
+                lines.append(f'#ifdef {feature}')
+            current_feature = feature
+        lines.append(f'    {"[" + keycode + "]":<{width}} = codepoints({", ".join(map(c_codepoint, codepoints))}),')
+    if current_feature:
+        lines.append(f'#endif // {current_feature}')
+    lines += ['};', '// clang-format on', '']
+    Path(output).write_text('\n'.join(lines), encoding='utf-8')
+
+    print(f'{len(entries)} of {len(KEYCODE_NAMES)} basic keycodes are single codepoints, {len(replacements)} '
+          f'replacements')
+    print(f'wrote {output}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('keylogger', nargs='?', default=Path(__file__).parent / 'keylogger.c',
+                        help='keylogger.c, to read the replacements from')
+    parser.add_argument('-o', '--output', default=Path(__file__).parent / 'keylogger_codepoints.h')
+    args = parser.parse_args()
+
+    replacements, prefixes = parse_keylogger(args.keylogger)
+    generate(replacements, prefixes, args.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,3780 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from anime-girl-jacket-240x320.qgf.c by convert_rle565.py, do not edit by hand.
+
+#include "anime-girl-jacket-240x320.rle565.h"
+
+// 240x320, 165 colours: 60078 bytes, from 72542 bytes as QGF
+// clang-format off
+static const uint16_t gfx_anime_girl_jacket_240x320_palette[165] = {
+    0x0000, 0x2100, 0x0100, 0x4200, 0x2000, 0x6300, 0x2200, 0x4100,
+    0x8408, 0xFFFF, 0x6308, 0xE708, 0x7BCE, 0x6909, 0x1AF5, 0x9143,
+    0xD5E3, 0xD363, 0x3613, 0x8400, 0x379D, 0x0809, 0x4A42, 0x3ABE,
+    0x2519, 0x0F3B, 0xC731, 0xFDDE, 0x8308, 0xB674, 0x99AD, 0x6629,
+    0xF684, 0xB684, 0x4108, 0x159D, 0x957C, 0x2D63, 0xA819, 0x3474,
+    0xE430, 0x8B4A, 0x3364, 0x4C32, 0x144C, 0x117C, 0x4D0A, 0x57E4,
+    0xB063, 0x9A9D, 0xA500, 0x3233, 0x0008, 0x505B, 0x5DE7, 0x0509,
+    0xF723, 0xBCDE, 0x54EB, 0xA400, 0xA408, 0x8300, 0x1DDF, 0xB07B,
+    0xAB09, 0x4709, 0x9384, 0xF9BD, 0xF7DD, 0xA310, 0x75C4, 0xE508,
+    0x4300, 0x6208, 0x7EEF, 0x304B, 0xAE1A, 0xFAAD, 0x2F7B, 0xC410,
+    0x4E1A, 0x8318, 0x2932, 0xCE42, 0xC608, 0x4711, 0x4719, 0xBBEE,
+    0xA508, 0x52B3, 0xEC09, 0x4B22, 0x4909, 0x0108, 0xAE32, 0xC931,
+    0xC418, 0x949C, 0x4308, 0x0419, 0x9664, 0xA909, 0x5BBE, 0x3564,
+    0x8C32, 0xD3B3, 0xCA19, 0x0701, 0x97B5, 0xB9F4, 0x0E4B, 0xB8E4,
+    0x3DF7, 0x8A19, 0xD312, 0x0709, 0x6B62, 0x4208, 0xBCCE, 0x1CEF,
+    0xCF32, 0x0719, 0x6749, 0x4110, 0xFB9D, 0x3BB6, 0xCD4A, 0x8D8A,
+    0x0B1A, 0x979D, 0xE931, 0x7785, 0x765D, 0xC408, 0xA308, 0x8508,
+    0x8861, 0x35B5, 0xC508, 0x9BCE, 0x2B1A, 0xBFF7, 0x19E5, 0x4480,
+    0x4609, 0x6200, 0xE500, 0x8F1D, 0xBFEF, 0xAC62, 0xA300, 0x4CD9,
+    0x2120, 0xBFFF, 0x2709, 0x90DA, 0x9CC6, 0x0F2B, 0x0791, 0x2108,
+    0x18BE, 0x6719, 0xB40A, 0xFBE5, 0xEF3B,
+};
+
+static const uint8_t gfx_anime_girl_jacket_240x320_data[59748] = {
+    0x03, 0x03, 0x71, 0x80, 0x8C, 0x83, 0x5B, 0x07, 0x8C, 0x5B, 0x8C, 0x6A, 0x8C, 0x5B, 0x50, 0x5B,
+    0x87, 0x50, 0x0B, 0x80, 0x5B, 0x2E, 0x50, 0x25, 0x80, 0x80, 0x6A, 0x6A, 0x80, 0x80, 0x2B, 0x81,
+    0x68, 0x81, 0x2B, 0x81, 0x80, 0x83, 0x2B, 0x01, 0x80, 0x53, 0x83, 0x4B, 0x2C, 0x30, 0x5F, 0x82,
+    0x52, 0x2B, 0x35, 0x80, 0x6A, 0x53, 0x78, 0x68, 0x68, 0x5B, 0x80, 0x8C, 0x5B, 0x8C, 0x8C, 0x6A,
+    0x6A, 0x65, 0x71, 0x0D, 0x6A, 0x0D, 0x65, 0x6B, 0x11, 0x1E, 0x14, 0x14, 0x35, 0x21, 0x14, 0x21,
+    0x21, 0x23, 0x23, 0x14, 0x23, 0x14, 0x42, 0x1A, 0x00, 0x01, 0x89, 0x00, 0x12, 0x04, 0x00, 0x16,
+    0x42, 0x42, 0x82, 0x30, 0x14, 0x21, 0x42, 0x14, 0x6C, 0x6C, 0x43, 0x2D, 0x6E, 0x89, 0x61, 0x42,
+    0x83, 0x27, 0x03, 0x3F, 0x7E, 0x7E, 0x18, 0x89, 0x00, 0x0F, 0x04, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0xA1, 0x19, 0x4B, 0x4B, 0x11, 0x35, 0x35, 0x4B, 0x4B, 0x35, 0x87, 0x4B, 0x82, 0x19, 0x81, 0x53,
+    0x11, 0x4B, 0x53, 0x71, 0x71, 0x53, 0x35, 0x68, 0x2B, 0x2B, 0x71, 0x6A, 0x80, 0x71, 0x71, 0x80,
+    0x8C, 0x65, 0x71, 0x82, 0x0D, 0x0D, 0x65, 0x53, 0x53, 0x5B, 0x80, 0x71, 0x65, 0x78, 0x4B, 0x5E,
+    0x0D, 0x65, 0x65, 0x78, 0x82, 0x19, 0x81, 0x78, 0x80, 0x19, 0x82, 0x78, 0x14, 0x6A, 0x8C, 0x9D,
+    0x78, 0x19, 0x78, 0x19, 0x19, 0x33, 0x33, 0x4B, 0x2E, 0x50, 0x0F, 0x33, 0x9D, 0x9D, 0x78, 0x33,
+    0x9D, 0x33, 0x81, 0x4C, 0x01, 0x06, 0x6A, 0x81, 0x8C, 0x84, 0x5B, 0x06, 0x50, 0x8C, 0x80, 0x80,
+    0x5B, 0x5B, 0x2B, 0x87, 0x50, 0x04, 0x6A, 0x5B, 0x5B, 0x50, 0x4E, 0x82, 0x8C, 0x05, 0x2B, 0x68,
+    0x5E, 0x19, 0x4B, 0x19, 0x82, 0x53, 0x18, 0x2B, 0x68, 0x68, 0x53, 0x2B, 0x5F, 0x53, 0x6E, 0x19,
+    0x4B, 0x35, 0x35, 0x2B, 0x30, 0x35, 0x4B, 0x27, 0x35, 0x2B, 0x2B, 0x53, 0x53, 0x2B, 0x2B, 0x6A,
+    0x82, 0x5B, 0x81, 0x80, 0x1A, 0x6A, 0x0D, 0x6A, 0x71, 0x6A, 0x71, 0x65, 0x65, 0x11, 0x1E, 0x1E,
+    0x14, 0x35, 0x21, 0x14, 0x23, 0x23, 0x14, 0x14, 0x23, 0x6C, 0x3F, 0x07, 0x04, 0x79, 0x75, 0x04,
+    0x87, 0x00, 0x1C, 0x01, 0x00, 0x07, 0x00, 0x25, 0x21, 0x5F, 0x30, 0x14, 0x21, 0x42, 0x23, 0x14,
+    0x89, 0x6C, 0x23, 0x29, 0x23, 0x23, 0x42, 0x24, 0x27, 0x3F, 0x27, 0x30, 0x29, 0x63, 0x02, 0x22,
+    0x88, 0x00, 0x0F, 0x02, 0x01, 0x00, 0x56, 0x52, 0x26, 0x05, 0x87, 0x53, 0x0F, 0x0F, 0x11, 0x11,
+    0x4B, 0x0F, 0x11, 0x82, 0x35, 0x02, 0x4B, 0x35, 0x4B, 0x87, 0x35, 0x08, 0x4B, 0x6A, 0x65, 0x78,
+    0x4B, 0x53, 0x2B, 0x68, 0x2B, 0x84, 0x6A, 0x80, 0x8C, 0x83, 0x71, 0x1D, 0x65, 0x80, 0x4B, 0x4B,
+    0x5B, 0x65, 0x6A, 0x8C, 0x19, 0x19, 0x5E, 0x65, 0x65, 0x80, 0x78, 0x19, 0x78, 0x19, 0x19, 0x78,
+    0x78, 0x19, 0x78, 0x4C, 0x6A, 0x8C, 0x9D, 0x19, 0x19, 0x78, 0x81, 0x19, 0x82, 0x33, 0x81, 0x50,
+    0x81, 0x33, 0x82, 0x9D, 0x82, 0x33, 0x01, 0x5E, 0x9D, 0x0C, 0x01, 0x80, 0x5B, 0x8C, 0x68, 0x5B,
+    0x5B, 0x2B, 0x5B, 0x5B, 0x8C, 0x71, 0x6A, 0x82, 0x5B, 0x82, 0x50, 0x81, 0x4C, 0x82, 0x50, 0x82,
+    0x5B, 0x0C, 0x50, 0x2D, 0x2B, 0x5E, 0x5E, 0x19, 0x4B, 0x35, 0x11, 0x11, 0x35, 0x11, 0x35, 0x81,
+    0x4B, 0x83, 0x53, 0x25, 0x82, 0x4B, 0x6E, 0x4B, 0x19, 0x35, 0x11, 0x80, 0x30, 0x27, 0x11, 0x24,
+    0x21, 0x27, 0x6E, 0x53, 0x53, 0x78, 0x5E, 0x80, 0x8C, 0x8C, 0x5B, 0x5B, 0x6A, 0x71, 0x0D, 0x0D,
+    0x65, 0x71, 0x71, 0x0D, 0x71, 0x24, 0x1E, 0x1E, 0x14, 0x35, 0x82, 0x14, 0x08, 0x6C, 0x14, 0x23,
+    0x89, 0x29, 0x00, 0x1A, 0x3F, 0x1C, 0x8A, 0x00, 0x13, 0x75, 0x5F, 0x45, 0x07, 0x30, 0x82, 0x30,
+    0x14, 0x42, 0x21, 0x14, 0x6C, 0x23, 0x89, 0x43, 0x7E, 0x3F, 0x1E, 0x61, 0x21, 0x82, 0x27, 0x04,
+    0x30, 0x26, 0x02, 0x49, 0x04, 0x88, 0x00, 0x0F, 0x02, 0x9F, 0x02, 0x63, 0x6E, 0x4B, 0x6E, 0x63,
+    0x05, 0x4B, 0x11, 0x11, 0x2A, 0x11, 0x11, 0x2A, 0x8D, 0x11, 0x25, 0x35, 0x6A, 0x0D, 0x78, 0x4B,
+    0x53, 0x53, 0x68, 0x80, 0x55, 0x0D, 0x0D, 0x71, 0x6A, 0x5E, 0x2B, 0x2B, 0x5E, 0x80, 0x80, 0x5E,
+    0x4B, 0x4B, 0x2B, 0x6A, 0x6A, 0x68, 0x4B, 0x4B, 0x5E, 0x65, 0x65, 0x8C, 0x78, 0x19, 0x19, 0x78,
+    0x5E, 0x81, 0x19, 0x82, 0x78, 0x0A, 0x80, 0x2B, 0x9D, 0x19, 0x78, 0x19, 0x33, 0x0F, 0x33, 0x33,
+    0x0F, 0x81, 0x50, 0x81, 0x33, 0x83, 0x9D, 0x81, 0x33, 0x01, 0x5E, 0x78, 0x0C, 0x02, 0x8C, 0x2B,
+    0x5B, 0x68, 0x2B, 0x5B, 0x2B, 0x5B, 0x5B, 0x80, 0x71, 0x80, 0x81, 0x4C, 0x83, 0x50, 0x81, 0x4C,
+    0x82, 0x50, 0x82, 0x5B, 0x05, 0x4C, 0x59, 0x2B, 0x5E, 0x19, 0x35, 0x81, 0x11, 0x82, 0x27, 0x38,
+    0x24, 0x2A, 0x27, 0x27, 0x11, 0x11, 0x19, 0x19, 0x29, 0x0F, 0x35, 0x4B, 0x4B, 0x35, 0x11, 0x2B,
+    0x11, 0x24, 0x27, 0x20, 0x24, 0x27, 0x27, 0x11, 0x0F, 0x4B, 0x78, 0x68, 0x5B, 0x5B, 0x6A, 0x80,
+    0x80, 0x5B, 0x80, 0x71, 0x71, 0x65, 0x6A, 0x6A, 0x5B, 0x14, 0x1E, 0x1E, 0x23, 0x30, 0x14, 0x14,
+    0x1E, 0x1E, 0x6C, 0x1E, 0x29, 0x00, 0x95, 0x23, 0x1A, 0x8A, 0x00, 0x09, 0x04, 0x00, 0x82, 0x5F,
+    0x01, 0x1F, 0x82, 0x3F, 0x14, 0x24, 0x82, 0x14, 0x81, 0x23, 0x0C, 0x43, 0x2D, 0x29, 0x14, 0x23,
+    0x23, 0x24, 0x11, 0x27, 0x7E, 0x01, 0x1C, 0x07, 0x8C, 0x00, 0x0A, 0x0A, 0x7E, 0x35, 0x6E, 0x35,
+    0x63, 0x0B, 0x11, 0x2A, 0x2A, 0x27, 0x82, 0x21, 0x81, 0x24, 0x45, 0x21, 0x24, 0x24, 0x27, 0x2A,
+    0x27, 0x11, 0x27, 0x2A, 0x11, 0x11, 0x4B, 0x6A, 0x0D, 0x8C, 0x2B, 0x80, 0x6A, 0x71, 0x71, 0x55,
+    0x0D, 0x6A, 0x2B, 0x8C, 0x4B, 0x4B, 0x19, 0x5E, 0x5A, 0x5B, 0x19, 0x35, 0x35, 0x2B, 0x6A, 0x71,
+    0x53, 0x4B, 0x35, 0x68, 0x65, 0x65, 0x8C, 0x78, 0x78, 0x5E, 0x80, 0x6A, 0x5E, 0x19, 0x78, 0x19,
+    0x78, 0x80, 0x2B, 0x9D, 0x19, 0x78, 0x33, 0x33, 0x0F, 0x33, 0x33, 0x0F, 0x50, 0x4C, 0x0F, 0x19,
+    0x9D, 0x84, 0x33, 0x01, 0x5E, 0x78, 0x01, 0x01, 0x5B, 0x82, 0x5E, 0x81, 0x2B, 0x82, 0x8C, 0x01,
+    0x71, 0x5E, 0x81, 0x50, 0x81, 0x5B, 0x84, 0x4C, 0x82, 0x50, 0x0A, 0x5B, 0x5E, 0x50, 0x5E, 0x69,
+    0x19, 0x19, 0x35, 0x27, 0x24, 0x27, 0x82, 0x21, 0x01, 0x20, 0x24, 0x83, 0x21, 0x03, 0x24, 0x11,
+    0x29, 0x11, 0x84, 0x27, 0x1E, 0x2B, 0x27, 0x21, 0x21, 0x24, 0x35, 0x0F, 0x0F, 0x11, 0x0F, 0x0F,
+    0x35, 0x5E, 0x2B, 0x78, 0x80, 0x8C, 0x80, 0x80, 0x71, 0x80, 0x6A, 0x8C, 0x50, 0x78, 0x6A, 0x4B,
+    0x14, 0x4D, 0x14, 0x30, 0x84, 0x1E, 0x05, 0x29, 0x03, 0x3F, 0x1E, 0x52, 0x00, 0x81, 0x01, 0x86,
+    0x00, 0x80, 0x02, 0x82, 0x00, 0x08, 0x07, 0x82, 0x63, 0x04, 0x56, 0x42, 0x14, 0x23, 0x14, 0x82,
+    0x6C, 0x0C, 0x23, 0x89, 0x6C, 0x25, 0x42, 0x2D, 0x3F, 0x61, 0x21, 0x2D, 0x1A, 0x01, 0x49, 0x8A,
+    0x00, 0x0F, 0x07, 0x01, 0x00, 0x02, 0x1F, 0x30, 0x30, 0x35, 0x35, 0x08, 0x52, 0x27, 0x27, 0x24,
+    0x14, 0x23, 0x86, 0x21, 0x34, 0x24, 0x27, 0x21, 0x21, 0x27, 0x27, 0x11, 0x35, 0x5B, 0x2B, 0x80,
+    0x6A, 0x0D, 0x71, 0x0D, 0x71, 0x2B, 0x53, 0x4B, 0x35, 0x78, 0x4B, 0x11, 0x4B, 0x5B, 0x50, 0x5E,
+    0x4B, 0x35, 0x35, 0x5E, 0x71, 0x8C, 0x4B, 0x35, 0x4B, 0x8C, 0x65, 0x6A, 0x8C, 0x19, 0x78, 0x6A,
+    0x71, 0x65, 0x5A, 0x19, 0x4B, 0x78, 0x78, 0x8C, 0x68, 0x9D, 0x81, 0x19, 0x81, 0x33, 0x83, 0x0F,
+    0x04, 0x50, 0x4C, 0x2C, 0x0F, 0x9D, 0x84, 0x33, 0x01, 0x4C, 0x9D, 0x0B, 0x03, 0x2B, 0x78, 0x19,
+    0x78, 0x5E, 0x68, 0x8C, 0x05, 0x1C, 0x3B, 0x5B, 0x81, 0x4C, 0x82, 0x50, 0x82, 0x4C, 0x82, 0x5E,
+    0x0B, 0x4C, 0x50, 0x5E, 0x50, 0x5E, 0x46, 0x53, 0x0F, 0x24, 0x21, 0x20, 0x24, 0x8A, 0x21, 0x25,
+    0x95, 0x21, 0x14, 0x4D, 0x14, 0x14, 0x21, 0x29, 0x24, 0x20, 0x2A, 0x4B, 0x0F, 0x0F, 0x4B, 0x2A,
+    0x20, 0x14, 0x31, 0x2A, 0x2B, 0x8C, 0x80, 0x68, 0x2B, 0x5B, 0x6A, 0x80, 0x5B, 0x50, 0x4B, 0x5B,
+    0x65, 0x6B, 0x68, 0x4D, 0x14, 0x2A, 0x82, 0x1E, 0x08, 0x43, 0x3F, 0x06, 0x42, 0x1E, 0x29, 0x63,
+    0x02, 0x5D, 0x88, 0x00, 0x80, 0x01, 0x83, 0x00, 0x16, 0x56, 0x1C, 0x01, 0x3F, 0x3F, 0x16, 0x1F,
+    0x18, 0x1F, 0x95, 0x23, 0x6C, 0x3F, 0x60, 0x01, 0x00, 0x00, 0x51, 0x16, 0x2D, 0x18, 0x00, 0x04,
+    0x8B, 0x00, 0x0C, 0x02, 0x01, 0x07, 0x00, 0x63, 0x6E, 0x11, 0x27, 0x7E, 0x03, 0x35, 0x1D, 0x21,
+    0x81, 0x23, 0x81, 0x14, 0x82, 0x21, 0x1C, 0x14, 0x21, 0x21, 0x14, 0x23, 0x23, 0x27, 0x21, 0x27,
+    0x53, 0x53, 0x35, 0x11, 0x11, 0x19, 0x53, 0x11, 0x11, 0x2A, 0x2A, 0x11, 0x11, 0x4B, 0x4B, 0x11,
+    0x4B, 0x2B, 0x8C, 0x19, 0x82, 0x11, 0x17, 0x35, 0x71, 0x8C, 0x35, 0x35, 0x19, 0x6A, 0x6A, 0x8C,
+    0x50, 0x19, 0x5E, 0x8C, 0x78, 0x4C, 0x40, 0x4C, 0x0F, 0x78, 0x78, 0x2B, 0x53, 0x33, 0x19, 0x86,
+    0x0F, 0x81, 0x4C, 0x02, 0x2C, 0x0F, 0x9D, 0x84, 0x33, 0x01, 0x4C, 0x9D, 0x10, 0x3D, 0x5E, 0x78,
+    0x19, 0x19, 0x78, 0x5E, 0x2B, 0x8C, 0x18, 0x00, 0x00, 0x4F, 0x6A, 0x5E, 0x4C, 0x50, 0x82, 0x4C,
+    0x83, 0x5E, 0x06, 0x5B, 0x5E, 0x5E, 0x78, 0x69, 0x53, 0x0F, 0x82, 0x14, 0x81, 0x21, 0x0B, 0x24,
+    0x21, 0x23, 0x21, 0x20, 0x23, 0x81, 0x14, 0x21, 0x21, 0x4E, 0x14, 0x82, 0x1E, 0x2B, 0x81, 0x21,
+    0x53, 0x27, 0x0F, 0x19, 0x0F, 0x11, 0x4B, 0x2A, 0x4D, 0x17, 0x43, 0x66, 0x14, 0x53, 0x2B, 0x41,
+    0x6A, 0x8C, 0x5B, 0x8C, 0x5B, 0x8C, 0x5E, 0x6A, 0x6B, 0x41, 0x55, 0x6B, 0x5E, 0x14, 0x21, 0x1E,
+    0x1E, 0x43, 0x42, 0x91, 0x42, 0x1E, 0x25, 0x4F, 0x03, 0x07, 0x8B, 0x00, 0x04, 0x22, 0x18, 0x00,
+    0x07, 0x45, 0x87, 0x00, 0x01, 0x18, 0x16, 0x85, 0x00, 0x02, 0x02, 0x1C, 0x22, 0x8C, 0x00, 0x12,
+    0x02, 0x01, 0x02, 0x03, 0x03, 0x00, 0x03, 0x7E, 0x27, 0x30, 0x4F, 0x26, 0x24, 0x21, 0x14, 0x81,
+    0x14, 0x14, 0x23, 0x81, 0x21, 0x83, 0x14, 0x0D, 0x6C, 0x89, 0x21, 0x30, 0x26, 0x13, 0x0B, 0x47,
+    0xA1, 0x6E, 0x27, 0x24, 0x24, 0x21, 0x82, 0x27, 0x21, 0x67, 0x35, 0x4B, 0x11, 0x11, 0x53, 0x50,
+    0x0F, 0x2A, 0x11, 0x2A, 0x27, 0x5E, 0x71, 0x78, 0x4B, 0x68, 0x8C, 0x8C, 0x50, 0x78, 0x19, 0x5E,
+    0x78, 0x0F, 0x19, 0x5A, 0x50, 0x0F, 0x4B, 0x19, 0x68, 0x19, 0x33, 0x83, 0x0F, 0x80, 0x33, 0x82,
+    0x0F, 0x81, 0x4C, 0x01, 0x33, 0x9D, 0x85, 0x33, 0x81, 0x4C, 0x80, 0x3C, 0x81, 0x78, 0x82, 0x19,
+    0x18, 0x78, 0x5E, 0x78, 0xA1, 0x00, 0x49, 0x01, 0x00, 0x91, 0x26, 0x4C, 0x4C, 0x5E, 0x4C, 0x4C,
+    0x5E, 0x5E, 0x50, 0x5E, 0x19, 0x78, 0x19, 0x46, 0x27, 0x20, 0x84, 0x14, 0x0B, 0x42, 0x23, 0x1E,
+    0x23, 0x25, 0x2D, 0x23, 0x2D, 0x21, 0x3F, 0x4E, 0x4D, 0x83, 0x1E, 0x2C, 0x14, 0x53, 0x4B, 0x19,
+    0x78, 0x0F, 0x35, 0x11, 0x1E, 0x66, 0x43, 0x1E, 0x43, 0x21, 0x35, 0x2A, 0x41, 0x41, 0x6A, 0x5B,
+    0x68, 0x5E, 0x5E, 0x5B, 0x0B, 0x13, 0x90, 0x58, 0x0D, 0x0D, 0x2B, 0x20, 0x43, 0x43, 0x1E, 0x18,
+    0x35, 0x43, 0x3F, 0x45, 0x06, 0x01, 0x02, 0x04, 0x01, 0x8A, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02,
+    0x88, 0x00, 0x80, 0x04, 0x97, 0x00, 0x0A, 0x02, 0x01, 0x01, 0x3D, 0x03, 0x00, 0x5F, 0x3F, 0x7E,
+    0x79, 0x21, 0x81, 0x14, 0x82, 0x81, 0x03, 0x1E, 0x14, 0x24, 0x20, 0x83, 0x1E, 0x0B, 0x6C, 0x35,
+    0x55, 0x90, 0x90, 0x55, 0x1C, 0x08, 0x3B, 0x26, 0x27, 0x24, 0x83, 0x27, 0x09, 0x1D, 0x11, 0x4B,
+    0x0F, 0x2A, 0x24, 0x11, 0x11, 0x2A, 0x11, 0x82, 0x27, 0x0E, 0x5B, 0x80, 0x19, 0x80, 0x8C, 0x8C,
+    0x50, 0x78, 0x19, 0x0F, 0x11, 0x11, 0x19, 0x5A, 0x50, 0x82, 0x0F, 0x01, 0x19, 0x4B, 0x83, 0x0F,
+    0x04, 0x19, 0x33, 0x0F, 0x11, 0x0F, 0x81, 0x4C, 0x81, 0x9D, 0x84, 0x33, 0x02, 0x0F, 0x4C, 0x50,
+    0x16, 0x37, 0x53, 0x19, 0x4B, 0x19, 0x19, 0x53, 0x78, 0x52, 0x96, 0x8C, 0x50, 0x40, 0x3C, 0x00,
+    0x00, 0x22, 0x55, 0x4C, 0x9D, 0x78, 0x5E, 0x78, 0x83, 0x19, 0x03, 0x2A, 0x8E, 0x6C, 0x23, 0x88,
+    0x42, 0x38, 0x25, 0x1F, 0x74, 0x1A, 0x95, 0x16, 0x61, 0x17, 0x6C, 0x1E, 0x43, 0x6C, 0x35, 0x68,
+    0x11, 0x35, 0x5E, 0x53, 0x27, 0x20, 0x20, 0x21, 0x35, 0x2A, 0x67, 0x21, 0x2A, 0x1E, 0x23, 0x5E,
+    0x80, 0x50, 0x4B, 0x11, 0x68, 0x80, 0x5B, 0x5E, 0x6B, 0x05, 0x41, 0x71, 0x0D, 0x35, 0x43, 0xA0,
+    0x16, 0x52, 0x4D, 0x23, 0x51, 0x01, 0x03, 0x00, 0x01, 0x06, 0x02, 0x86, 0x00, 0x80, 0x02, 0x84,
+    0x00, 0x01, 0x02, 0x04, 0x8E, 0x00, 0x01, 0x02, 0x00, 0x81, 0x01, 0x8F, 0x00, 0x01, 0x02, 0x01,
+    0x82, 0x03, 0x4E, 0x04, 0x16, 0x3F, 0x79, 0x14, 0x14, 0x31, 0x14, 0x31, 0x1E, 0x1E, 0x43, 0x14,
+    0x67, 0x43, 0x43, 0x1E, 0xA3, 0x2D, 0x8C, 0x68, 0x6A, 0x5A, 0x0D, 0x8A, 0x47, 0x55, 0x41, 0x68,
+    0x27, 0x27, 0x24, 0x27, 0x27, 0x24, 0x2A, 0x35, 0x0F, 0x11, 0x24, 0x21, 0x27, 0x2A, 0x11, 0x2A,
+    0x27, 0x21, 0x27, 0x5B, 0x6A, 0x5A, 0x8C, 0x8C, 0x19, 0x9D, 0x19, 0x11, 0x11, 0x0F, 0x4B, 0x4C,
+    0x19, 0x0F, 0x11, 0x11, 0x19, 0x35, 0x0F, 0x33, 0x0F, 0x33, 0x4C, 0x19, 0x11, 0x2C, 0x33, 0x4C,
+    0x33, 0x4C, 0x84, 0x33, 0x81, 0x0F, 0x01, 0x78, 0x4C, 0x20, 0x90, 0x19, 0x4B, 0x19, 0x19, 0x78,
+    0x78, 0x19, 0x0B, 0x80, 0x68, 0x50, 0x50, 0x2E, 0x5A, 0x41, 0x03, 0x00, 0x22, 0x26, 0x80, 0x19,
+    0x4B, 0x4B, 0x19, 0x0F, 0x24, 0x14, 0x46, 0x21, 0x14, 0x23, 0x42, 0x82, 0x2D, 0x81, 0x3F, 0x39,
+    0x2D, 0x3F, 0x2D, 0x61, 0x61, 0x89, 0x43, 0x4E, 0x46, 0x9C, 0x43, 0x43, 0x39, 0x89, 0xA1, 0x6A,
+    0x5E, 0x0F, 0x5E, 0x8C, 0x68, 0x68, 0x2B, 0x6A, 0x80, 0x8C, 0x5E, 0x2A, 0x0F, 0x24, 0x6C, 0x89,
+    0x6C, 0x21, 0x7C, 0x2A, 0x8C, 0x50, 0x67, 0x1D, 0x0F, 0x55, 0x80, 0x6A, 0x40, 0x71, 0x14, 0x2D,
+    0x45, 0x14, 0x43, 0x16, 0x01, 0x75, 0x01, 0x03, 0x07, 0x02, 0x8A, 0x00, 0x01, 0x04, 0x01, 0x84,
+    0x00, 0x01, 0x02, 0x01, 0x8A, 0x00, 0x81, 0x02, 0x03, 0x01, 0x02, 0x01, 0x02, 0x8E, 0x00, 0x01,
+    0x02, 0x01, 0x82, 0x03, 0x04, 0x1C, 0x16, 0x1F, 0x14, 0x1E, 0x82, 0x14, 0x19, 0x43, 0x1E, 0x43,
+    0x4D, 0x31, 0x43, 0x17, 0x0C, 0x1E, 0x27, 0x21, 0x42, 0x35, 0x5E, 0x80, 0x71, 0x41, 0x0D, 0x5B,
+    0x53, 0x2A, 0x24, 0x21, 0x24, 0x24, 0x27, 0x82, 0x11, 0x2A, 0x67, 0x11, 0x24, 0x14, 0x24, 0x11,
+    0x2A, 0x24, 0x24, 0x21, 0x2A, 0x2B, 0x80, 0x5B, 0x35, 0x2A, 0x4C, 0x78, 0x11, 0x11, 0x0F, 0x2C,
+    0x0F, 0x11, 0x11, 0x2A, 0x2A, 0x4B, 0x35, 0x0F, 0x2C, 0x19, 0x2E, 0x78, 0x11, 0x2A, 0x0F, 0x33,
+    0x9D, 0x33, 0x9D, 0x33, 0x0F, 0x81, 0x33, 0x82, 0x0F, 0x01, 0x78, 0x2E, 0x80, 0x6A, 0x83, 0x4B,
+    0x05, 0x19, 0x4B, 0x26, 0x55, 0x50, 0x4C, 0x83, 0x50, 0x81, 0x4C, 0x0F, 0x6A, 0x3B, 0x3D, 0x29,
+    0x5F, 0x5B, 0x19, 0x0F, 0x21, 0x31, 0x14, 0x2F, 0x1E, 0x4D, 0x1E, 0x43, 0x82, 0x1E, 0x81, 0x43,
+    0x38, 0x17, 0x39, 0x17, 0x43, 0x3E, 0x0C, 0x1B, 0x61, 0x46, 0x76, 0x0C, 0x17, 0x8B, 0x17, 0x82,
+    0x0D, 0x19, 0x5E, 0x2B, 0x8C, 0x6A, 0x71, 0x8C, 0x2B, 0x5B, 0x50, 0x19, 0x2A, 0x0F, 0x4B, 0x25,
+    0x32, 0x78, 0x67, 0x1D, 0x11, 0x6A, 0x50, 0x1D, 0x1D, 0x64, 0x78, 0x5A, 0x50, 0x80, 0x80, 0x25,
+    0x18, 0x25, 0x4D, 0x2D, 0x01, 0x01, 0x06, 0x03, 0x03, 0x04, 0x8A, 0x00, 0x81, 0x01, 0x03, 0x04,
+    0x00, 0x00, 0x9F, 0x81, 0x06, 0x81, 0x01, 0x89, 0x00, 0x01, 0x02, 0x01, 0x83, 0x03, 0x80, 0x02,
+    0x8F, 0x00, 0x80, 0x01, 0x82, 0x06, 0x04, 0x18, 0x51, 0x79, 0x31, 0x1E, 0x82, 0x14, 0x02, 0x43,
+    0x4D, 0x43, 0x82, 0x0C, 0x13, 0x17, 0x0C, 0x21, 0x14, 0x76, 0x1E, 0x11, 0x4B, 0x4B, 0x33, 0x4B,
+    0x4B, 0x24, 0x1B, 0x3F, 0x27, 0x20, 0x24, 0x24, 0x27, 0x82, 0x11, 0x07, 0x24, 0x27, 0x0F, 0x1D,
+    0x14, 0x21, 0x27, 0x24, 0x82, 0x21, 0x0B, 0x27, 0x4B, 0x35, 0x24, 0x11, 0x78, 0x4C, 0x0F, 0x11,
+    0x11, 0x2C, 0x0F, 0x82, 0x11, 0x0A, 0x2A, 0x4B, 0x11, 0x2C, 0x33, 0x50, 0x4C, 0x11, 0x2A, 0x67,
+    0x33, 0x81, 0x9D, 0x82, 0x33, 0x07, 0x0F, 0x33, 0x0F, 0x2C, 0x2C, 0x11, 0x5E, 0x2E, 0x80, 0x68,
+    0x82, 0x4B, 0x81, 0x19, 0x03, 0x68, 0x85, 0x8C, 0x50, 0x81, 0x5E, 0x82, 0x50, 0x2C, 0x78, 0x5E,
+    0x4C, 0x50, 0x5E, 0x3F, 0x2B, 0x2A, 0x21, 0x81, 0x1E, 0x14, 0x31, 0x2F, 0x61, 0x6E, 0x6E, 0x30,
+    0x30, 0x35, 0x52, 0x52, 0x30, 0x2D, 0x14, 0x0C, 0x3F, 0x39, 0x8B, 0x8B, 0x89, 0x8E, 0x39, 0x0C,
+    0x8B, 0x8B, 0x4A, 0x2D, 0x80, 0x4B, 0x78, 0x5E, 0x5E, 0x53, 0x35, 0x82, 0x4B, 0x1D, 0x19, 0x5E,
+    0x2A, 0x2C, 0x5E, 0x2D, 0x0D, 0x72, 0x64, 0x1D, 0x1D, 0x2E, 0x9D, 0x31, 0x31, 0x1D, 0x2C, 0x4C,
+    0x50, 0x2B, 0x68, 0x08, 0x60, 0x14, 0x14, 0x1F, 0x02, 0x05, 0x03, 0x05, 0x8B, 0x00, 0x09, 0x01,
+    0x02, 0x00, 0x00, 0x07, 0x62, 0x0A, 0x05, 0x03, 0x01, 0x8A, 0x00, 0x09, 0x02, 0x01, 0x07, 0x03,
+    0x03, 0x05, 0x05, 0x03, 0x01, 0x02, 0x8C, 0x00, 0x82, 0x01, 0x1F, 0x45, 0x1C, 0x04, 0x2B, 0x14,
+    0x1E, 0x14, 0x14, 0x1E, 0x1E, 0x4D, 0x0C, 0x39, 0x0C, 0x0C, 0x76, 0x43, 0x53, 0x53, 0x11, 0x35,
+    0x53, 0x2B, 0x50, 0x5E, 0x53, 0x27, 0x27, 0x30, 0x35, 0x2A, 0x14, 0x82, 0x21, 0x08, 0x2A, 0x11,
+    0x24, 0x14, 0x14, 0x2C, 0x0F, 0x21, 0x14, 0x84, 0x21, 0x08, 0x14, 0x27, 0x27, 0x24, 0x27, 0x78,
+    0x4C, 0x4B, 0x2A, 0x82, 0x11, 0x81, 0x2A, 0x0A, 0x11, 0x27, 0x0F, 0x11, 0x11, 0x9D, 0x4C, 0x2C,
+    0x2A, 0x27, 0x2A, 0x84, 0x33, 0x83, 0x0F, 0x04, 0x2C, 0x33, 0x0F, 0x4C, 0x50, 0x0C, 0x68, 0x4B,
+    0x19, 0x4B, 0x19, 0x68, 0x0A, 0x07, 0x8C, 0x5E, 0x5E, 0x2B, 0x5B, 0x84, 0x4C, 0x24, 0x50, 0x5E,
+    0x35, 0x67, 0x20, 0x14, 0x23, 0x14, 0x81, 0x14, 0x6F, 0x61, 0x79, 0x01, 0x55, 0x68, 0x5B, 0x2B,
+    0x03, 0x53, 0x1E, 0x6C, 0x39, 0x3F, 0x17, 0x0C, 0x39, 0x43, 0xA3, 0x0C, 0x39, 0x17, 0x1B, 0x39,
+    0x29, 0x5B, 0x78, 0x82, 0x19, 0x22, 0x5E, 0x4B, 0x11, 0x2C, 0x67, 0x4B, 0x2B, 0x11, 0x67, 0x2C,
+    0x11, 0x2B, 0x9D, 0x1D, 0x20, 0x64, 0x50, 0x2C, 0x31, 0x31, 0x83, 0x1D, 0x67, 0x68, 0x2B, 0x68,
+    0x03, 0x18, 0x14, 0x7E, 0x00, 0x05, 0x3D, 0x86, 0x01, 0x8A, 0x00, 0x81, 0x02, 0x09, 0x00, 0x01,
+    0x62, 0x3C, 0x3C, 0x3D, 0x03, 0x06, 0x01, 0x02, 0x8A, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x48,
+    0x82, 0x05, 0x02, 0x62, 0x01, 0x02, 0x8A, 0x00, 0x80, 0x02, 0x84, 0x01, 0x80, 0x0F, 0x82, 0x14,
+    0x23, 0x20, 0x1E, 0x43, 0x7D, 0x8B, 0x39, 0x8B, 0x39, 0x76, 0x1E, 0x4B, 0x5E, 0x53, 0x5E, 0x5F,
+    0x2D, 0x6E, 0x5C, 0x3F, 0x21, 0x2B, 0x53, 0x2B, 0x53, 0x81, 0x14, 0x21, 0x21, 0x11, 0x21, 0x1E,
+    0x6C, 0xA0, 0x1D, 0x11, 0x24, 0x84, 0x21, 0x15, 0x23, 0x21, 0x21, 0x24, 0x27, 0x24, 0x78, 0x50,
+    0x78, 0x2A, 0x11, 0x11, 0x67, 0x2C, 0x33, 0x27, 0x27, 0x0F, 0x11, 0x0F, 0x4C, 0x33, 0x82, 0x27,
+    0x07, 0x11, 0x2C, 0x0F, 0x0F, 0x33, 0x0F, 0x11, 0x2C, 0x82, 0x0F, 0x81, 0x33, 0x01, 0x4C, 0x9D,
+    0x80, 0x2B, 0x82, 0x19, 0x2B, 0x4B, 0x26, 0x01, 0x01, 0x02, 0x47, 0x5B, 0x8C, 0x6A, 0x5B, 0x4C,
+    0x68, 0x72, 0x19, 0x5B, 0x4B, 0x27, 0x11, 0x27, 0x14, 0x83, 0x14, 0x14, 0x81, 0x10, 0x1E, 0x30,
+    0x03, 0x80, 0x78, 0x5E, 0x68, 0x80, 0x41, 0x4D, 0x39, 0x39, 0x2D, 0x89, 0x17, 0x39, 0x0C, 0xA3,
+    0x43, 0x82, 0x39, 0x04, 0x16, 0x3B, 0x5E, 0x4B, 0x19, 0x84, 0x0F, 0x81, 0x11, 0x1C, 0x67, 0x4B,
+    0x33, 0x66, 0x3E, 0x35, 0x71, 0x0F, 0x1D, 0x1D, 0x64, 0x4C, 0x2C, 0x31, 0x31, 0x14, 0x1D, 0x1D,
+    0x4B, 0x6E, 0x7E, 0x1C, 0x45, 0x3F, 0x63, 0x01, 0x1C, 0x3C, 0x03, 0x8A, 0x00, 0x81, 0x02, 0x0A,
+    0x00, 0x03, 0x96, 0x8A, 0x8A, 0x08, 0x91, 0x06, 0x03, 0x03, 0x01, 0x8B, 0x00, 0x04, 0x06, 0x62,
+    0x0A, 0x0A, 0x05, 0x83, 0x03, 0x02, 0x06, 0x01, 0x02, 0x8D, 0x00, 0x26, 0x0A, 0x11, 0x20, 0x14,
+    0x20, 0x14, 0x4D, 0x66, 0x66, 0x39, 0x39, 0x0C, 0x0C, 0x76, 0x89, 0x35, 0x4B, 0x53, 0x19, 0x29,
+    0x16, 0x1A, 0x5E, 0x52, 0x5F, 0x26, 0x2B, 0x6A, 0x68, 0x1E, 0x1E, 0x14, 0x42, 0x14, 0x81, 0x17,
+    0x0C, 0xA0, 0x14, 0x82, 0x21, 0x80, 0x24, 0x82, 0x21, 0x80, 0x23, 0x82, 0x21, 0x23, 0x24, 0x21,
+    0x11, 0x4C, 0x4C, 0x0F, 0x27, 0x2A, 0x11, 0x33, 0x9D, 0x24, 0x27, 0x35, 0x27, 0x2C, 0x4C, 0x2C,
+    0x27, 0x24, 0x27, 0x11, 0x2C, 0x0F, 0x2C, 0x2C, 0x11, 0x11, 0x2C, 0x0F, 0x0F, 0x11, 0x0F, 0x33,
+    0x4C, 0x33, 0x46, 0x52, 0x53, 0x19, 0x19, 0x2B, 0x55, 0x5B, 0x6A, 0x55, 0x3C, 0x01, 0x96, 0x37,
+    0x71, 0x78, 0x33, 0x35, 0x61, 0x35, 0x11, 0x11, 0x35, 0x11, 0x23, 0x21, 0x2D, 0x14, 0x14, 0x10,
+    0x1E, 0x24, 0xA1, 0x5E, 0x78, 0x78, 0x19, 0x5E, 0x5A, 0x11, 0x3E, 0x39, 0x0C, 0x3F, 0x23, 0x36,
+    0x39, 0x57, 0x1E, 0x1B, 0x66, 0x6E, 0x3B, 0x80, 0x19, 0x11, 0x0F, 0x4B, 0x4B, 0x2A, 0x20, 0x20,
+    0x24, 0x21, 0x76, 0x1D, 0x33, 0x31, 0x4A, 0x67, 0x6A, 0x11, 0x82, 0x1D, 0x10, 0x33, 0x2C, 0x7C,
+    0x4D, 0x31, 0x31, 0x20, 0x2A, 0x27, 0x82, 0x5F, 0x7E, 0x0A, 0x07, 0x3D, 0x58, 0x4F, 0x8A, 0x00,
+    0x0C, 0x02, 0x01, 0x02, 0x03, 0x3C, 0x8A, 0x8A, 0x13, 0x08, 0x05, 0x05, 0x03, 0x01, 0x8C, 0x00,
+    0x81, 0x02, 0x08, 0x03, 0x0A, 0x3C, 0x47, 0x3B, 0x05, 0x0A, 0x05, 0x03, 0x81, 0x01, 0x8A, 0x00,
+    0x09, 0x04, 0x00, 0x02, 0x2B, 0x20, 0x14, 0x1E, 0x1E, 0x43, 0x1B, 0x82, 0x39, 0x03, 0x0C, 0x8B,
+    0x66, 0x89, 0x82, 0x53, 0x13, 0x19, 0x4B, 0x53, 0x6E, 0x30, 0x5F, 0x47, 0x55, 0x35, 0x53, 0x6E,
+    0x1E, 0x6C, 0x23, 0x43, 0x39, 0x43, 0x17, 0x1E, 0x81, 0x83, 0x21, 0x03, 0x24, 0x21, 0x24, 0x23,
+    0x83, 0x21, 0x14, 0x42, 0x24, 0x11, 0x2E, 0x50, 0x78, 0x67, 0x2A, 0x2A, 0x2C, 0x33, 0x27, 0x24,
+    0x11, 0x27, 0x2C, 0x33, 0x67, 0x24, 0x27, 0x67, 0x87, 0x11, 0x06, 0x2C, 0x11, 0x67, 0x2C, 0x33,
+    0x4C, 0x9D, 0x5A, 0x19, 0x53, 0x78, 0x4B, 0x79, 0x82, 0x4B, 0x78, 0x4C, 0x4C, 0x2B, 0x80, 0x0D,
+    0x85, 0x96, 0x6A, 0x11, 0x61, 0x2A, 0x11, 0x11, 0x67, 0x1D, 0x21, 0x69, 0x69, 0x81, 0x1E, 0x10,
+    0x23, 0x43, 0x68, 0x80, 0x19, 0x78, 0x19, 0x50, 0x4C, 0x5E, 0x81, 0x39, 0x1B, 0x1B, 0x2D, 0x23,
+    0x43, 0x43, 0x17, 0x81, 0x11, 0x4B, 0x73, 0x68, 0x2C, 0x11, 0x11, 0x2A, 0x35, 0x27, 0x14, 0x14,
+    0x24, 0x17, 0x3E, 0x0C, 0x20, 0x0F, 0x64, 0x31, 0x0F, 0x11, 0x20, 0x20, 0x1D, 0x33, 0x67, 0x7C,
+    0x4D, 0x7C, 0x7C, 0x81, 0x20, 0x27, 0x63, 0x6E, 0x35, 0x00, 0x03, 0x05, 0x58, 0x06, 0x8A, 0x00,
+    0x81, 0x02, 0x09, 0x91, 0x3C, 0x47, 0x58, 0x3B, 0x3C, 0x58, 0x54, 0x05, 0x01, 0x82, 0x00, 0x80,
+    0x01, 0x8B, 0x00, 0x0B, 0x04, 0x01, 0x03, 0x58, 0x54, 0x0B, 0x08, 0x05, 0x48, 0x03, 0x01, 0x02,
+    0x8A, 0x00, 0x2F, 0x02, 0x00, 0x00, 0x67, 0x1E, 0x17, 0x0C, 0x0C, 0x39, 0x39, 0x1B, 0x39, 0x0C,
+    0x76, 0x0C, 0x17, 0x25, 0x6E, 0x30, 0x7E, 0x2B, 0xA1, 0x52, 0x6E, 0x29, 0x52, 0x25, 0x6C, 0x23,
+    0x21, 0x1E, 0x1E, 0x0C, 0x1B, 0x57, 0x57, 0x3F, 0x55, 0x55, 0x53, 0x27, 0x14, 0x21, 0x27, 0x21,
+    0x21, 0x23, 0x24, 0x82, 0x21, 0x81, 0x24, 0x12, 0x2A, 0x78, 0x2E, 0x4C, 0x67, 0x67, 0x24, 0x27,
+    0x2C, 0x24, 0x24, 0x11, 0x27, 0x2A, 0x2C, 0x24, 0x24, 0x67, 0x2C, 0x82, 0x11, 0x0B, 0x2A, 0x27,
+    0x67, 0x67, 0x11, 0x67, 0x67, 0x27, 0x11, 0x78, 0x50, 0x4C, 0x81, 0x5E, 0x07, 0x30, 0x25, 0x73,
+    0x5E, 0x35, 0x4E, 0x53, 0x5E, 0x82, 0x4C, 0x4C, 0x50, 0x6A, 0x05, 0x2B, 0x27, 0x11, 0x2A, 0x67,
+    0x29, 0x52, 0x69, 0x69, 0x6C, 0x81, 0x43, 0x7F, 0x30, 0x66, 0x23, 0x5E, 0x5E, 0x19, 0x19, 0x50,
+    0x50, 0x53, 0x14, 0x1B, 0x1B, 0x36, 0x3E, 0x25, 0x2D, 0x1B, 0x1B, 0x20, 0x0F, 0x4B, 0x55, 0x0F,
+    0x67, 0x2A, 0x11, 0x24, 0x21, 0x2A, 0x21, 0x20, 0x17, 0x94, 0x99, 0x8B, 0x39, 0x9C, 0x2A, 0x83,
+    0x64, 0x0F, 0x83, 0x14, 0x83, 0x2C, 0x64, 0x7C, 0x7D, 0x7C, 0x4D, 0x7C, 0x14, 0x27, 0x0A, 0x27,
+    0x5F, 0x00, 0x05, 0x4F, 0x03, 0x8B, 0x00, 0x12, 0x02, 0x05, 0x32, 0x58, 0x92, 0x3B, 0x58, 0x15,
+    0x8A, 0x75, 0x04, 0x00, 0x02, 0x01, 0x03, 0x06, 0x02, 0x02, 0x03, 0x83, 0x01, 0x11, 0x02, 0x01,
+    0x01, 0x00, 0x01, 0x06, 0x75, 0x00, 0x00, 0x3B, 0x0B, 0x0B, 0x3B, 0x3D, 0x05, 0x03, 0x01, 0x07,
+    0x8A, 0x00, 0x52, 0x03, 0x00, 0x1F, 0x4D, 0x66, 0x17, 0x0C, 0x39, 0x0C, 0x1B, 0x0C, 0x0C, 0x39,
+    0x17, 0xA3, 0x6C, 0x14, 0x1E, 0x23, 0x42, 0x25, 0x7E, 0x7E, 0x3B, 0x5F, 0x20, 0x1E, 0xA0, 0x6C,
+    0x81, 0xA0, 0x27, 0x25, 0x11, 0x42, 0x29, 0x42, 0x4E, 0x79, 0x35, 0x14, 0x27, 0x11, 0x27, 0x21,
+    0x81, 0x21, 0x14, 0x21, 0x21, 0x11, 0x24, 0x42, 0x24, 0x0F, 0x4B, 0x27, 0x24, 0x24, 0x20, 0x27,
+    0x21, 0x1D, 0x11, 0x27, 0x2A, 0x2A, 0x21, 0x21, 0x27, 0x67, 0x2C, 0x27, 0x24, 0x2A, 0x24, 0x67,
+    0x11, 0x27, 0x67, 0x11, 0x11, 0x67, 0x82, 0x4C, 0x59, 0x5B, 0x53, 0x89, 0x7A, 0x65, 0x4C, 0x50,
+    0x35, 0x4E, 0x53, 0x78, 0x5E, 0x50, 0x50, 0x4C, 0x5E, 0x35, 0x67, 0x27, 0x7E, 0x63, 0x00, 0x1C,
+    0x69, 0x46, 0x6C, 0x4D, 0x61, 0x7F, 0x81, 0x25, 0x6C, 0x31, 0x5E, 0x19, 0x78, 0x5E, 0x5E, 0x27,
+    0x1E, 0x76, 0x39, 0x36, 0x36, 0x0C, 0x42, 0x17, 0x3E, 0x1E, 0x0F, 0x19, 0x2B, 0x2A, 0x24, 0x21,
+    0x21, 0x23, 0x21, 0x21, 0x24, 0x8B, 0x09, 0x94, 0x09, 0x76, 0x0C, 0x09, 0x94, 0x31, 0x31, 0x1D,
+    0x31, 0x9C, 0x7D, 0x67, 0x64, 0x7C, 0x7D, 0x7D, 0x66, 0x7C, 0x31, 0x25, 0x56, 0x11, 0x01, 0x03,
+    0x05, 0x1C, 0x02, 0x88, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x05, 0x08, 0x47, 0x92, 0x3B, 0x73, 0x9A,
+    0x08, 0x06, 0x82, 0x03, 0x82, 0x0A, 0x82, 0x05, 0x02, 0x48, 0x03, 0x05, 0x82, 0x03, 0x10, 0x06,
+    0x03, 0x03, 0x1C, 0x03, 0x03, 0x4F, 0x48, 0x02, 0x22, 0x47, 0x54, 0x54, 0x05, 0x75, 0x49, 0x02,
+    0x8A, 0x00, 0x0C, 0x03, 0x22, 0x00, 0x11, 0x66, 0xA0, 0x0C, 0x39, 0x1B, 0x6C, 0x89, 0x0C, 0x43,
+    0x82, 0x0C, 0x1D, 0x1E, 0x6C, 0x17, 0x17, 0x43, 0x81, 0x3F, 0x6E, 0x11, 0x23, 0x57, 0x0C, 0x64,
+    0x1E, 0x81, 0x0D, 0x13, 0x80, 0x2D, 0x2B, 0x6E, 0x44, 0x4E, 0x68, 0x1E, 0x89, 0x27, 0x27, 0x24,
+    0x89, 0x82, 0x23, 0x02, 0x11, 0x4B, 0x2A, 0x83, 0x21, 0x0A, 0x24, 0x21, 0x20, 0x21, 0x21, 0x20,
+    0x21, 0x30, 0x11, 0x2C, 0x27, 0x82, 0x21, 0x04, 0x14, 0x6E, 0x0D, 0x11, 0x24, 0x81, 0x27, 0x82,
+    0x67, 0x05, 0x2A, 0x11, 0x0F, 0x4C, 0x4C, 0x78, 0x06, 0x73, 0x4B, 0x7E, 0x00, 0x3D, 0x71, 0x50,
+    0x82, 0x5E, 0x81, 0x53, 0x35, 0x5E, 0x50, 0x5E, 0x67, 0x27, 0x6E, 0x56, 0x00, 0x22, 0x51, 0x00,
+    0x74, 0x1E, 0x4D, 0x81, 0x7F, 0x2F, 0x2D, 0x71, 0x24, 0x0C, 0x14, 0x19, 0x5E, 0x5E, 0x24, 0x14,
+    0x9C, 0x1E, 0x61, 0x4A, 0x94, 0x43, 0x14, 0x17, 0x3E, 0x0C, 0x2A, 0x5E, 0x19, 0x24, 0x21, 0x23,
+    0x14, 0x21, 0x3F, 0x6C, 0x94, 0x09, 0x09, 0x8D, 0x09, 0x39, 0x0C, 0x82, 0x09, 0x11, 0x7D, 0x31,
+    0x83, 0x3E, 0x76, 0x67, 0x64, 0x7C, 0x7D, 0x4D, 0x7D, 0x31, 0x4D, 0x16, 0x5F, 0x2B, 0x00, 0x03,
+    0x81, 0x18, 0x89, 0x00, 0x14, 0x01, 0x00, 0x01, 0x3C, 0x58, 0x85, 0x92, 0x0B, 0x15, 0x3B, 0x4F,
+    0x58, 0x1C, 0x13, 0x8A, 0x0B, 0x8A, 0x3B, 0x05, 0x96, 0x08, 0x82, 0x0A, 0x82, 0x05, 0x11, 0x03,
+    0x3D, 0x05, 0x3C, 0x85, 0x03, 0x13, 0x73, 0x1C, 0x00, 0x01, 0x58, 0x54, 0x3C, 0x49, 0x06, 0x03,
+    0x02, 0x89, 0x00, 0x33, 0x01, 0x0A, 0x00, 0x56, 0x43, 0x17, 0x0C, 0x39, 0x8B, 0xA0, 0x39, 0x23,
+    0x23, 0x0C, 0x1E, 0x42, 0x1E, 0x42, 0x42, 0x27, 0x3F, 0x25, 0x7E, 0x2D, 0x16, 0x23, 0x42, 0x6E,
+    0x4C, 0x81, 0x3F, 0x42, 0x89, 0x6C, 0x0C, 0x25, 0x2D, 0x57, 0x16, 0x53, 0x1E, 0x6C, 0x1E, 0x81,
+    0x14, 0x6C, 0x23, 0x23, 0x21, 0x19, 0x78, 0x11, 0x84, 0x21, 0x1A, 0x20, 0x14, 0x20, 0x14, 0x20,
+    0x21, 0x11, 0x0F, 0x67, 0x24, 0x21, 0x21, 0x35, 0x26, 0x37, 0x92, 0x5C, 0x67, 0x21, 0x27, 0x27,
+    0x2A, 0x27, 0x6E, 0x3D, 0x80, 0x33, 0x81, 0x5E, 0x08, 0x5F, 0x5B, 0x55, 0x1C, 0x22, 0x02, 0x01,
+    0x56, 0x8C, 0x81, 0x2B, 0x82, 0x5E, 0x81, 0x35, 0x48, 0x1F, 0x01, 0x00, 0x00, 0x4F, 0x1F, 0x88,
+    0x59, 0x46, 0x1E, 0x59, 0x10, 0x46, 0x7E, 0x11, 0x19, 0x1E, 0x8B, 0x27, 0x50, 0x35, 0x81, 0x6C,
+    0x76, 0x14, 0x42, 0x4A, 0x94, 0x23, 0x3F, 0x6C, 0x36, 0x3E, 0x27, 0x2B, 0x68, 0x27, 0x14, 0x23,
+    0x23, 0x35, 0x23, 0x36, 0x09, 0x8D, 0x8D, 0x4A, 0x09, 0x1B, 0x1B, 0x8D, 0x09, 0xA0, 0x20, 0x7C,
+    0x1D, 0x1B, 0x4A, 0x1D, 0x64, 0x7C, 0x9C, 0x7D, 0x4D, 0x31, 0x4D, 0x1F, 0x5F, 0x47, 0x01, 0x62,
+    0x1A, 0x51, 0x89, 0x00, 0x81, 0x02, 0x10, 0x48, 0x47, 0x54, 0x85, 0x8A, 0x0D, 0x58, 0x02, 0x55,
+    0x41, 0x47, 0x41, 0x5C, 0x5C, 0x6B, 0x8A, 0x3B, 0x81, 0x58, 0x83, 0x08, 0x13, 0x3C, 0x08, 0x0A,
+    0x08, 0x3B, 0x3D, 0x4F, 0x8A, 0x06, 0x3C, 0x41, 0x0B, 0x02, 0x01, 0x96, 0x54, 0x13, 0x05, 0x22,
+    0x02, 0x8A, 0x00, 0x28, 0x4F, 0x56, 0x00, 0x2D, 0x0C, 0x0C, 0x39, 0x0C, 0x0C, 0x1B, 0x23, 0x89,
+    0x16, 0xA1, 0x82, 0x0C, 0x3F, 0x32, 0x26, 0x5F, 0x42, 0x52, 0x02, 0x26, 0x42, 0x02, 0x3B, 0x33,
+    0x14, 0x82, 0x61, 0x6C, 0x1E, 0x8B, 0x42, 0x35, 0x95, 0x79, 0x53, 0x14, 0x43, 0x83, 0x6C, 0x05,
+    0x14, 0x23, 0x21, 0x35, 0x19, 0x2C, 0x81, 0x21, 0x82, 0x20, 0x83, 0x14, 0x18, 0x21, 0x14, 0x11,
+    0x11, 0x21, 0x21, 0x27, 0x55, 0x13, 0x32, 0x41, 0x0A, 0x87, 0x6A, 0x1D, 0x24, 0x24, 0x27, 0x29,
+    0x02, 0x00, 0x73, 0x33, 0x5E, 0x78, 0x3B, 0x2B, 0x6A, 0x8C, 0x2B, 0x8C, 0x71, 0x08, 0x01, 0x9F,
+    0x58, 0x6A, 0x2B, 0x29, 0x5F, 0x79, 0x75, 0x04, 0x00, 0x00, 0x18, 0x4E, 0x69, 0x2F, 0x10, 0x10,
+    0x69, 0x10, 0x10, 0x16, 0x14, 0x1E, 0x78, 0x20, 0x0C, 0x14, 0x8C, 0x0F, 0x43, 0xA0, 0x0C, 0x43,
+    0x0C, 0x36, 0x17, 0x42, 0x30, 0x39, 0x36, 0x4A, 0x43, 0x2B, 0x53, 0x35, 0x14, 0x14, 0x3F, 0x6C,
+    0x09, 0x4A, 0x8D, 0x82, 0x09, 0x0D, 0x4A, 0x23, 0x36, 0x09, 0x09, 0x42, 0x31, 0x31, 0x1D, 0x76,
+    0x94, 0x20, 0x67, 0x31, 0x81, 0x7D, 0x82, 0x31, 0x0A, 0x1F, 0x79, 0x63, 0x00, 0x63, 0x1F, 0x00,
+    0x07, 0x00, 0x00, 0x01, 0x85, 0x00, 0x2C, 0x02, 0x03, 0x87, 0x8A, 0x8A, 0x47, 0x5C, 0x0B, 0x22,
+    0x0B, 0x0D, 0x9A, 0x0D, 0x40, 0x40, 0x0D, 0x5C, 0x55, 0x0B, 0x73, 0x73, 0x47, 0x58, 0x8A, 0x8A,
+    0x37, 0x8A, 0x3B, 0x47, 0x73, 0x58, 0x45, 0x37, 0x47, 0x01, 0x9A, 0x40, 0x15, 0x07, 0x04, 0x13,
+    0x32, 0x08, 0x22, 0x06, 0x8A, 0x00, 0x36, 0x03, 0x25, 0x51, 0x18, 0x17, 0x43, 0x0C, 0x8B, 0x8B,
+    0x42, 0x3F, 0x1E, 0x79, 0x0A, 0x42, 0x77, 0xA0, 0x26, 0x23, 0x1B, 0x2D, 0x29, 0x1F, 0x92, 0x16,
+    0x63, 0x08, 0x2A, 0x1E, 0x2B, 0x2B, 0x82, 0x30, 0x1B, 0x43, 0x2D, 0x26, 0x56, 0x27, 0x6E, 0x1E,
+    0x6C, 0x6C, 0x43, 0x43, 0x6C, 0x81, 0x20, 0x67, 0x67, 0x11, 0x67, 0x20, 0x21, 0x20, 0x84, 0x14,
+    0x11, 0x23, 0x14, 0x2A, 0x11, 0x2D, 0x30, 0x5F, 0x0A, 0x90, 0x87, 0x05, 0x0B, 0x71, 0x50, 0x0F,
+    0x21, 0x27, 0x26, 0x82, 0x00, 0x03, 0x91, 0x5E, 0x5E, 0x78, 0x0D, 0x6A, 0x80, 0x8C, 0x71, 0x2B,
+    0x5E, 0x2B, 0x5B, 0x26, 0x03, 0x3B, 0x5F, 0x1F, 0x01, 0x82, 0x00, 0x03, 0x51, 0x7B, 0x4E, 0x2F,
+    0x85, 0x10, 0x3C, 0x74, 0x68, 0x17, 0x17, 0x11, 0x20, 0x1B, 0x1E, 0x5E, 0x67, 0x7D, 0x0C, 0x39,
+    0x0C, 0x4A, 0x0C, 0x89, 0x23, 0x1E, 0x0C, 0x3E, 0x70, 0x17, 0x25, 0x21, 0x3F, 0x35, 0x21, 0x23,
+    0x8B, 0x94, 0x8D, 0x09, 0x39, 0x0C, 0x23, 0x25, 0x2D, 0x61, 0x39, 0x39, 0x24, 0x7C, 0x20, 0x20,
+    0x9C, 0x09, 0x7C, 0x67, 0x31, 0x3E, 0x7C, 0x31, 0x31, 0x14, 0x60, 0x37, 0x56, 0x00, 0x56, 0x49,
+    0x89, 0x00, 0x81, 0x02, 0x0A, 0x0A, 0x8A, 0x32, 0x8A, 0x15, 0x41, 0x03, 0x08, 0x5A, 0x71, 0x40,
+    0x82, 0x2E, 0x08, 0x5A, 0x40, 0x0D, 0x15, 0x5C, 0x5C, 0x55, 0x0B, 0x9A, 0x82, 0x41, 0x12, 0x73,
+    0x37, 0x15, 0x41, 0x90, 0x85, 0x15, 0x58, 0x75, 0x5C, 0x5A, 0x73, 0x00, 0x00, 0x0A, 0x0A, 0x05,
+    0x03, 0x02, 0x86, 0x00, 0x36, 0x04, 0x02, 0x00, 0x00, 0x16, 0x25, 0x00, 0x27, 0x43, 0x0C, 0x17,
+    0x1B, 0x30, 0x56, 0x43, 0x25, 0x25, 0x7E, 0x0C, 0x39, 0x29, 0x7E, 0xA0, 0x6C, 0x30, 0x35, 0x0D,
+    0x23, 0x5F, 0x03, 0x81, 0x42, 0x24, 0x68, 0x78, 0xA0, 0x39, 0xA0, 0x1B, 0x23, 0x61, 0x57, 0x89,
+    0x43, 0x0C, 0x6C, 0x42, 0x81, 0x6C, 0x69, 0x69, 0x61, 0x59, 0x59, 0x38, 0x81, 0x20, 0x82, 0x14,
+    0x1B, 0x1E, 0x14, 0x14, 0x1E, 0x23, 0x53, 0x54, 0x05, 0x58, 0x48, 0x05, 0x65, 0x1C, 0x06, 0x65,
+    0x5E, 0x33, 0x33, 0x2A, 0x29, 0x02, 0x00, 0x1A, 0x52, 0x00, 0x2B, 0x33, 0x78, 0x0A, 0x6A, 0x2B,
+    0x26, 0xA1, 0x2B, 0x5B, 0x2B, 0x50, 0x5E, 0x6A, 0x60, 0x82, 0x00, 0x08, 0x01, 0x51, 0x7F, 0x2F,
+    0x74, 0x88, 0x6D, 0x2F, 0x46, 0x83, 0x10, 0x3E, 0x74, 0x27, 0x43, 0x66, 0x1E, 0x24, 0x1B, 0x66,
+    0x35, 0x24, 0x9C, 0x0C, 0x81, 0x17, 0x4A, 0x43, 0x43, 0x17, 0x94, 0x8B, 0x0C, 0x36, 0x6C, 0x43,
+    0x35, 0x82, 0x6A, 0x27, 0x09, 0x1B, 0x94, 0x36, 0x25, 0x25, 0x23, 0x23, 0x17, 0x4A, 0x36, 0x2D,
+    0x2D, 0x14, 0x7C, 0x67, 0x20, 0x7D, 0x09, 0x7D, 0x2C, 0x4D, 0x3E, 0x7C, 0x31, 0x31, 0x20, 0x07,
+    0x52, 0x60, 0x02, 0x18, 0x00, 0x00, 0x01, 0x88, 0x00, 0x0E, 0x01, 0x08, 0x8A, 0x32, 0x37, 0x5C,
+    0x3C, 0x05, 0x0D, 0x5A, 0x5A, 0x4C, 0x2E, 0x50, 0x72, 0x81, 0x2E, 0x83, 0x40, 0x18, 0x0D, 0x41,
+    0x0D, 0x65, 0x0D, 0x65, 0x5C, 0x9A, 0x0D, 0x5C, 0x0D, 0x9A, 0x6B, 0x0D, 0x05, 0x3B, 0x0D, 0x0D,
+    0x73, 0x00, 0x00, 0x0A, 0x03, 0x03, 0x01, 0x8A, 0x00, 0x33, 0x75, 0x42, 0x60, 0x82, 0x4D, 0x17,
+    0x0C, 0x0C, 0x42, 0x52, 0x29, 0x3F, 0x23, 0x68, 0x23, 0x42, 0x73, 0x37, 0x25, 0x82, 0x3F, 0x17,
+    0x30, 0x0C, 0x63, 0x2B, 0x6E, 0x2B, 0x80, 0x5B, 0x19, 0x57, 0x6C, 0x25, 0x0C, 0x17, 0xA0, 0x57,
+    0x23, 0x42, 0x89, 0x6E, 0x30, 0x1E, 0x69, 0x3A, 0x3A, 0x9B, 0x59, 0x38, 0x2C, 0x20, 0x84, 0x14,
+    0x81, 0x1E, 0x18, 0x30, 0x55, 0x13, 0x0B, 0x03, 0x03, 0x05, 0x58, 0x32, 0x13, 0x1F, 0x7F, 0x59,
+    0x40, 0x2E, 0x4C, 0x6E, 0x5F, 0x95, 0x21, 0x42, 0x00, 0x26, 0x4B, 0x78, 0x15, 0x80, 0x55, 0x8A,
+    0x2B, 0x5E, 0x50, 0x5B, 0x2B, 0x50, 0x5B, 0x85, 0x02, 0x02, 0x45, 0x74, 0x46, 0x2F, 0x6D, 0x59,
+    0x16, 0x6F, 0x2F, 0x85, 0x10, 0x3E, 0x46, 0x4D, 0x1E, 0x76, 0x23, 0x43, 0x8B, 0x6E, 0x14, 0x0C,
+    0x43, 0x20, 0x1B, 0x3E, 0x42, 0x43, 0x6C, 0x36, 0x1B, 0x43, 0x0C, 0x17, 0x30, 0x26, 0x92, 0x2C,
+    0x1D, 0x1E, 0x09, 0x4A, 0x29, 0x25, 0x8D, 0x0C, 0x23, 0x30, 0x2D, 0x09, 0x44, 0x82, 0x7C, 0x7C,
+    0x67, 0x1D, 0x66, 0x09, 0x3E, 0x1D, 0x3E, 0x76, 0x31, 0x31, 0x7C, 0x24, 0x60, 0x29, 0x04, 0x0A,
+    0x86, 0x00, 0x1C, 0x16, 0x51, 0x85, 0x00, 0x0B, 0x02, 0x00, 0x62, 0x58, 0x32, 0x8A, 0x73, 0x6B,
+    0x7B, 0x0B, 0x50, 0x2E, 0x85, 0x72, 0x01, 0x4C, 0x5A, 0x82, 0x2E, 0x19, 0x40, 0x65, 0x40, 0x5A,
+    0x40, 0x40, 0x71, 0x41, 0x0D, 0x65, 0x65, 0x41, 0x90, 0x0D, 0x65, 0x07, 0x9A, 0x40, 0x0D, 0x87,
+    0x02, 0x04, 0x03, 0x9F, 0x01, 0x02, 0x88, 0x00, 0x2C, 0x01, 0x00, 0x95, 0x4E, 0x01, 0x14, 0x43,
+    0x0C, 0x6C, 0x23, 0x43, 0x03, 0x82, 0x6C, 0x5F, 0x6E, 0x2D, 0x2D, 0x42, 0x23, 0x14, 0x39, 0x4A,
+    0x3E, 0xA0, 0x61, 0x89, 0x0B, 0x6B, 0x4B, 0x83, 0x20, 0x57, 0x30, 0x6E, 0x6C, 0x31, 0x0C, 0x44,
+    0x53, 0x68, 0x68, 0x78, 0x4B, 0x89, 0x82, 0x3A, 0x24, 0x69, 0x1D, 0x3A, 0x3A, 0x61, 0x83, 0x20,
+    0x14, 0x1E, 0x1E, 0x11, 0x80, 0x32, 0x0B, 0x32, 0x9A, 0x13, 0x0A, 0x92, 0x32, 0x16, 0x7F, 0x10,
+    0x3A, 0x3A, 0x7F, 0x40, 0x40, 0x5E, 0x14, 0x1E, 0x20, 0x14, 0x1F, 0x05, 0x19, 0x78, 0x0D, 0x37,
+    0x96, 0x6A, 0x2B, 0x2B, 0x80, 0x2B, 0x5E, 0x53, 0x53, 0x08, 0x02, 0x16, 0x69, 0x83, 0x2F, 0x03,
+    0x69, 0x1A, 0x6F, 0x2F, 0x84, 0x10, 0x81, 0x3A, 0x57, 0x14, 0x4D, 0x17, 0x43, 0x42, 0x66, 0x35,
+    0x1E, 0x0C, 0x1E, 0x1E, 0x8D, 0x1B, 0x42, 0x8B, 0xA0, 0x17, 0x43, 0x17, 0x0C, 0x27, 0x5E, 0x68,
+    0x6A, 0x1D, 0x21, 0x1D, 0x3E, 0x6C, 0x29, 0x0C, 0x2D, 0x19, 0x5E, 0x7E, 0x0C, 0x09, 0x61, 0x4C,
+    0x83, 0x7C, 0x27, 0x14, 0x9C, 0x8D, 0x4A, 0x1B, 0x8D, 0x76, 0x7C, 0x83, 0x31, 0x82, 0x08, 0x1A,
+    0x00, 0x86, 0x06, 0x60, 0x1A, 0x3F, 0x23, 0x1F, 0x00, 0x07, 0x3D, 0x00, 0x01, 0x00, 0x02, 0x0A,
+    0x08, 0x32, 0x15, 0x73, 0x08, 0x01, 0x2E, 0x50, 0x50, 0x72, 0x12, 0x72, 0x12, 0x38, 0x72, 0x72,
+    0x50, 0x81, 0x72, 0x87, 0x2E, 0x12, 0x71, 0x65, 0x5A, 0x5A, 0x40, 0x41, 0x41, 0x40, 0x6B, 0x34,
+    0x0D, 0x55, 0x0D, 0x48, 0x00, 0x00, 0x07, 0x01, 0x02, 0x8A, 0x00, 0x2E, 0x51, 0x42, 0x7B, 0x30,
+    0x0C, 0x43, 0x23, 0x89, 0x4A, 0x95, 0x79, 0x25, 0x48, 0x82, 0x6C, 0x36, 0x99, 0x09, 0x36, 0xA0,
+    0x43, 0x4A, 0x0C, 0x39, 0x17, 0xA1, 0x68, 0x0C, 0x8D, 0x77, 0x76, 0x30, 0x30, 0x1D, 0x1D, 0x43,
+    0x61, 0x68, 0x53, 0x5E, 0x19, 0x59, 0x10, 0x3A, 0x3A, 0x46, 0x69, 0x82, 0x3A, 0x08, 0x21, 0x20,
+    0x20, 0x23, 0x24, 0x5B, 0x6B, 0x41, 0x00, 0x82, 0x58, 0x03, 0x0B, 0x6B, 0x2B, 0x59, 0x85, 0x3A,
+    0x0A, 0x5F, 0x65, 0x40, 0x20, 0x1E, 0x14, 0x31, 0x7E, 0x00, 0x78, 0x19, 0x03, 0x79, 0x82, 0x55,
+    0x80, 0x81, 0x2B, 0x82, 0x53, 0x05, 0x79, 0x5F, 0x69, 0x2F, 0x2F, 0x10, 0x82, 0x2F, 0x02, 0x6D,
+    0x88, 0x46, 0x81, 0x2F, 0x83, 0x10, 0x43, 0x69, 0x3A, 0x59, 0x4D, 0x17, 0x8B, 0x23, 0x42, 0x2A,
+    0x43, 0x8B, 0x14, 0x66, 0x8D, 0x23, 0x6C, 0x76, 0x36, 0x94, 0x0C, 0x94, 0x0C, 0x6E, 0x78, 0x78,
+    0x5E, 0x24, 0x21, 0x1D, 0x24, 0xA0, 0x3E, 0x35, 0x35, 0x21, 0x35, 0x1E, 0x8D, 0x09, 0x25, 0x2C,
+    0x7C, 0x7C, 0x27, 0x64, 0x4D, 0x8D, 0x8D, 0x94, 0x94, 0x76, 0x31, 0x7C, 0x21, 0x56, 0x1C, 0x75,
+    0x07, 0x22, 0x06, 0x00, 0x07, 0x02, 0x63, 0x23, 0x1F, 0x03, 0x07, 0x82, 0x00, 0x18, 0x01, 0x08,
+    0x08, 0x54, 0x15, 0x8A, 0x05, 0x96, 0x2E, 0x50, 0x4C, 0x72, 0x12, 0x72, 0x12, 0x12, 0x72, 0x72,
+    0x4C, 0x72, 0x72, 0x4C, 0x72, 0x50, 0x4C, 0x82, 0x72, 0x02, 0x4C, 0x2E, 0x65, 0x82, 0x2E, 0x0E,
+    0x0D, 0x9A, 0x65, 0x71, 0x13, 0x03, 0x0D, 0x55, 0x0B, 0x5D, 0x00, 0x02, 0x02, 0x01, 0x02, 0x82,
+    0x00, 0x80, 0x01, 0x86, 0x00, 0x3E, 0x25, 0x1A, 0x82, 0x17, 0x43, 0x3F, 0x1E, 0x36, 0x39, 0x5F,
+    0x3F, 0x25, 0x3F, 0x39, 0x39, 0x89, 0x3F, 0x25, 0x61, 0x0C, 0x99, 0x29, 0x52, 0x3E, 0x1E, 0x76,
+    0x70, 0x77, 0x39, 0x8B, 0x43, 0x64, 0x64, 0x1D, 0x83, 0x2D, 0x2B, 0x68, 0x78, 0x59, 0x2F, 0x43,
+    0x10, 0x10, 0x3A, 0x3A, 0x2F, 0x3A, 0x3A, 0x10, 0x3A, 0x10, 0x19, 0x5A, 0x13, 0x00, 0x9F, 0x05,
+    0x41, 0x15, 0x6B, 0x56, 0x7F, 0x84, 0x3A, 0x81, 0x9B, 0x0B, 0x3A, 0x7F, 0x32, 0x0D, 0x53, 0x4D,
+    0x81, 0x14, 0x42, 0x02, 0x80, 0x0F, 0x09, 0x71, 0x50, 0x26, 0x68, 0x5E, 0x68, 0x2B, 0xA1, 0x82,
+    0x59, 0x81, 0x6F, 0x81, 0x10, 0x83, 0x2F, 0x04, 0x6D, 0x74, 0x59, 0x6F, 0x2F, 0x83, 0x10, 0x4E,
+    0x69, 0x59, 0x69, 0x4D, 0x17, 0x0C, 0x17, 0x6E, 0x27, 0x1B, 0x66, 0x21, 0x39, 0x94, 0x30, 0x1B,
+    0x8B, 0x36, 0x99, 0x09, 0x09, 0x6C, 0x6E, 0x24, 0x4B, 0x11, 0x14, 0x27, 0x80, 0x53, 0x76, 0x36,
+    0x30, 0x30, 0x35, 0x3F, 0x0C, 0x09, 0x57, 0x2B, 0x31, 0x7C, 0x4D, 0x1D, 0x2C, 0x31, 0x94, 0x8D,
+    0x94, 0x4A, 0x1B, 0x4D, 0x31, 0x16, 0x3F, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x63, 0x5F, 0x00,
+    0x60, 0x17, 0x5F, 0x00, 0x34, 0x00, 0x00, 0x03, 0x08, 0x13, 0x0B, 0x0B, 0x13, 0x03, 0x41, 0x81,
+    0x50, 0x82, 0x72, 0x82, 0x12, 0x82, 0x72, 0x03, 0x12, 0x72, 0x38, 0x12, 0x85, 0x72, 0x12, 0x50,
+    0x5A, 0x2E, 0x2E, 0x50, 0x65, 0x90, 0x41, 0x65, 0x5C, 0x00, 0x0B, 0x41, 0x73, 0x3C, 0x00, 0x02,
+    0x01, 0x02, 0x89, 0x00, 0x2B, 0x01, 0x00, 0x1F, 0x29, 0x3C, 0x1E, 0x89, 0x30, 0x17, 0x39, 0x8D,
+    0x23, 0x7E, 0xA0, 0x61, 0x25, 0x7E, 0x25, 0x23, 0x1B, 0x4A, 0x4A, 0x57, 0x56, 0x92, 0x1E, 0x36,
+    0x57, 0xA0, 0x8B, 0x57, 0x57, 0x43, 0x64, 0x64, 0x83, 0x1D, 0x1D, 0x11, 0x19, 0x35, 0x10, 0x43,
+    0x10, 0x82, 0x3A, 0x01, 0x10, 0x2F, 0x82, 0x3A, 0x0A, 0x59, 0x35, 0x0D, 0x08, 0x08, 0x0A, 0x7B,
+    0x05, 0x6B, 0x5B, 0x4E, 0x89, 0x3A, 0x0A, 0x10, 0x1F, 0x13, 0x13, 0x30, 0x4D, 0x14, 0x1E, 0x18,
+    0x56, 0x0F, 0x07, 0x7F, 0x2B, 0x68, 0x56, 0x79, 0xA1, 0x16, 0x7F, 0x82, 0x2F, 0x80, 0x46, 0x81,
+    0x2F, 0x83, 0x6F, 0x04, 0x6D, 0x7F, 0x7F, 0x0E, 0x2F, 0x82, 0x10, 0x81, 0x3A, 0x81, 0x59, 0x24,
+    0x21, 0x66, 0x43, 0x3E, 0x30, 0x27, 0x3E, 0x17, 0x27, 0x4A, 0x43, 0x2D, 0x8D, 0x0C, 0x09, 0x8D,
+    0x8D, 0x99, 0x95, 0x00, 0x6C, 0x31, 0x67, 0x14, 0x4B, 0x5F, 0x23, 0x9C, 0x1B, 0x17, 0x21, 0x2B,
+    0x23, 0x39, 0x09, 0x2D, 0x4B, 0x82, 0x7C, 0x17, 0x64, 0x2C, 0x14, 0x94, 0x8D, 0x94, 0x8D, 0x1B,
+    0x9C, 0x30, 0x0A, 0x89, 0x28, 0x00, 0x01, 0x00, 0x04, 0x00, 0x5F, 0x68, 0x00, 0x34, 0x52, 0x23,
+    0x83, 0x00, 0x09, 0x03, 0x05, 0x13, 0x8A, 0x3C, 0x03, 0x06, 0x65, 0x50, 0x2E, 0x82, 0x72, 0x02,
+    0x12, 0x38, 0x12, 0x83, 0x72, 0x18, 0x33, 0x38, 0x38, 0x72, 0x38, 0x33, 0x33, 0x72, 0x72, 0x4C,
+    0x2E, 0x4C, 0x2E, 0x50, 0x5A, 0x90, 0x37, 0x0D, 0x65, 0x05, 0x01, 0x6B, 0x8A, 0x8A, 0x01, 0x82,
+    0x00, 0x80, 0x01, 0x89, 0x00, 0x0F, 0x01, 0x02, 0x16, 0x62, 0x23, 0x42, 0x52, 0x76, 0x94, 0x0C,
+    0x3F, 0x49, 0x8A, 0x71, 0x23, 0x39, 0x81, 0x4A, 0x82, 0x36, 0x0C, 0x44, 0x79, 0x0B, 0x81, 0x1B,
+    0x39, 0x21, 0x21, 0x1B, 0x57, 0x81, 0x64, 0x20, 0x82, 0x1D, 0x09, 0x24, 0x1D, 0x21, 0x2F, 0x1E,
+    0x3A, 0x3A, 0x2F, 0x10, 0x3A, 0x82, 0x10, 0x0A, 0x21, 0x2C, 0x2E, 0x75, 0x00, 0x0B, 0x87, 0x03,
+    0x87, 0x74, 0x10, 0x83, 0x3A, 0x80, 0x10, 0x85, 0x3A, 0x0A, 0x10, 0x59, 0x06, 0x32, 0x0B, 0x21,
+    0x7D, 0x43, 0x16, 0x62, 0x4B, 0x08, 0x2F, 0x69, 0x53, 0x74, 0x59, 0x46, 0x2F, 0x2F, 0x10, 0x85,
+    0x2F, 0x81, 0x6F, 0x81, 0x6D, 0x03, 0x7F, 0x7A, 0x6F, 0x2F, 0x84, 0x10, 0x16, 0x59, 0x3F, 0x2D,
+    0x4D, 0x17, 0x4A, 0x23, 0x21, 0x1B, 0x9C, 0x20, 0x4A, 0x61, 0x43, 0x09, 0x17, 0x8D, 0x09, 0x1B,
+    0x0C, 0x4E, 0x00, 0x1A, 0x82, 0x1D, 0x0C, 0x67, 0x3F, 0x1A, 0x43, 0x94, 0x09, 0x30, 0x7E, 0xA0,
+    0x8D, 0x99, 0x16, 0x1D, 0x82, 0x7C, 0x0C, 0x64, 0x11, 0x20, 0x94, 0x8D, 0x09, 0x4A, 0x0C, 0x17,
+    0x82, 0x2D, 0x43, 0x1F, 0x82, 0x00, 0x13, 0x04, 0x00, 0x79, 0x29, 0x49, 0x22, 0x13, 0x24, 0x52,
+    0x00, 0x00, 0x01, 0x03, 0x05, 0x32, 0x58, 0x03, 0x01, 0x03, 0x40, 0x81, 0x2E, 0x81, 0x4C, 0x82,
+    0x72, 0x04, 0x12, 0x72, 0x4C, 0x72, 0x33, 0x82, 0x38, 0x01, 0x72, 0x38, 0x83, 0x33, 0x12, 0x72,
+    0x2E, 0x4C, 0x50, 0x50, 0x2E, 0x41, 0x47, 0x41, 0x41, 0x0B, 0x00, 0x05, 0x9A, 0x8A, 0x13, 0x00,
+    0x00, 0x01, 0x8A, 0x00, 0x81, 0x18, 0x27, 0x60, 0x02, 0x3F, 0x7E, 0x79, 0x21, 0x29, 0x1A, 0x29,
+    0x49, 0x32, 0x80, 0x66, 0x70, 0x57, 0x77, 0x0C, 0x43, 0x77, 0x89, 0x3D, 0x6B, 0x2A, 0x43, 0x39,
+    0x3F, 0x26, 0x1B, 0x77, 0x83, 0x64, 0x64, 0x84, 0x46, 0x20, 0x1D, 0x1D, 0x21, 0x46, 0x2F, 0x83,
+    0x3A, 0x0D, 0x2F, 0x6D, 0x2F, 0x31, 0x14, 0x53, 0x71, 0x6A, 0x0B, 0x13, 0x58, 0x74, 0x59, 0x10,
+    0x83, 0x3A, 0x82, 0x10, 0x80, 0x3A, 0x85, 0x10, 0x08, 0x7A, 0x05, 0x13, 0x29, 0x7D, 0x43, 0x3F,
+    0x02, 0x4B, 0x52, 0x10, 0x2F, 0x4E, 0x3F, 0x2F, 0x2F, 0x10, 0x46, 0x46, 0x6F, 0x2F, 0x10, 0x6F,
+    0x6F, 0x6D, 0x6F, 0x2F, 0x46, 0x74, 0x9F, 0x01, 0x59, 0x6D, 0x10, 0x10, 0x2F, 0x10, 0x10, 0x59,
+    0x4E, 0x69, 0x11, 0x89, 0x39, 0x27, 0x1E, 0x1B, 0x66, 0x21, 0x3E, 0x42, 0x1B, 0x36, 0x0C, 0x09,
+    0x0C, 0x89, 0x09, 0x89, 0x02, 0x2B, 0x1D, 0x1D, 0x67, 0x1D, 0x4D, 0x29, 0x23, 0x0C, 0x3F, 0x5F,
+    0x43, 0x4A, 0x09, 0x89, 0x2B, 0x83, 0x4D, 0x7D, 0x31, 0x67, 0x2C, 0x1D, 0x94, 0x8D, 0x8D, 0x3E,
+    0x1B, 0x23, 0x7E, 0x1E, 0x6C, 0x16, 0x83, 0x00, 0x1D, 0x4F, 0x3C, 0x2B, 0xA1, 0x56, 0x11, 0x2B,
+    0x16, 0x00, 0x00, 0x06, 0x03, 0x05, 0x54, 0x08, 0x02, 0x02, 0x0A, 0x40, 0x5A, 0x5A, 0x2E, 0x4C,
+    0x72, 0x4C, 0x72, 0x72, 0x4C, 0x2E, 0x50, 0x82, 0x38, 0x01, 0x12, 0x72, 0x81, 0x38, 0x82, 0x33,
+    0x13, 0x72, 0x2E, 0x2E, 0x50, 0x50, 0x4C, 0x0D, 0x3C, 0x9A, 0x9A, 0x41, 0x05, 0x00, 0x32, 0x8A,
+    0x58, 0x22, 0x00, 0x00, 0x01, 0x89, 0x00, 0x2C, 0x1F, 0x95, 0x00, 0x02, 0x7E, 0x2B, 0x05, 0x1A,
+    0x82, 0x0C, 0x23, 0x00, 0x03, 0x92, 0x55, 0x7D, 0x70, 0x57, 0x43, 0x23, 0x70, 0x25, 0x06, 0x71,
+    0x4C, 0x7D, 0x6C, 0x26, 0x80, 0x14, 0x3F, 0x11, 0x84, 0x64, 0x46, 0x3A, 0x83, 0x1D, 0x64, 0x1D,
+    0x46, 0x3A, 0x3A, 0x9B, 0x3A, 0x82, 0x10, 0x09, 0x2F, 0x21, 0x35, 0x5B, 0x41, 0x5A, 0x5A, 0x88,
+    0x59, 0x10, 0x86, 0x3A, 0x81, 0x2F, 0x84, 0x10, 0x0A, 0x69, 0x10, 0x7F, 0x06, 0x02, 0x05, 0x24,
+    0x66, 0x23, 0x02, 0x6E, 0x07, 0x10, 0x2F, 0x69, 0x53, 0x46, 0x46, 0x2F, 0x46, 0x82, 0x2F, 0x0D,
+    0x46, 0x6F, 0x0E, 0x6F, 0x69, 0x7E, 0x4E, 0x5F, 0x02, 0x00, 0x16, 0x2F, 0x10, 0x2F, 0x82, 0x10,
+    0x73, 0x7F, 0x7E, 0x4E, 0x4B, 0x23, 0x1B, 0x25, 0x23, 0x43, 0x42, 0x6C, 0x6C, 0x3F, 0x09, 0x39,
+    0xA0, 0xA0, 0x61, 0x8D, 0x09, 0x57, 0x5F, 0x2C, 0x1D, 0x1D, 0x2C, 0x20, 0x94, 0xA0, 0x16, 0x43,
+    0x25, 0x2D, 0x09, 0x8D, 0x09, 0x74, 0x4B, 0x7C, 0x94, 0x94, 0x7D, 0x2A, 0x67, 0x67, 0x3E, 0x09,
+    0x94, 0x4A, 0x3E, 0x25, 0x42, 0x6C, 0x61, 0x51, 0x00, 0x00, 0x07, 0x03, 0x1C, 0x18, 0x26, 0x3B,
+    0x56, 0x29, 0x26, 0x56, 0x00, 0x00, 0x03, 0x03, 0x0A, 0x8A, 0x08, 0x04, 0x00, 0x0A, 0x0D, 0x40,
+    0x0D, 0x5A, 0x50, 0x4C, 0x50, 0x4C, 0x72, 0x2E, 0x8A, 0x2E, 0x38, 0x12, 0x12, 0x72, 0x72, 0x33,
+    0x33, 0x72, 0x33, 0x72, 0x72, 0x50, 0x2E, 0x50, 0x2E, 0x4C, 0x5A, 0x85, 0x47, 0x73, 0x73, 0x3B,
+    0x02, 0x01, 0x8A, 0x08, 0x0A, 0x83, 0x00, 0x03, 0x1F, 0x60, 0x00, 0x01, 0x84, 0x00, 0x24, 0x75,
+    0x4E, 0x51, 0x02, 0x4F, 0x79, 0x3F, 0x36, 0x43, 0x3F, 0x29, 0x00, 0x75, 0x3C, 0x13, 0x26, 0x1E,
+    0x4A, 0x6C, 0x81, 0x3E, 0x5F, 0x3C, 0x54, 0x5A, 0x1D, 0x3F, 0x6E, 0x2B, 0x71, 0x5E, 0x1D, 0x84,
+    0x21, 0x3A, 0x3A, 0x20, 0x82, 0x1D, 0x80, 0x10, 0x82, 0x3A, 0x0A, 0x2F, 0x10, 0x10, 0x3A, 0x10,
+    0x11, 0x65, 0x0D, 0x40, 0x25, 0x69, 0x88, 0x3A, 0x88, 0x10, 0x09, 0x3A, 0x10, 0x7A, 0x00, 0x02,
+    0x5F, 0x14, 0x14, 0x75, 0x5F, 0x09, 0x10, 0x2F, 0x2F, 0x95, 0x27, 0x6F, 0x10, 0x2F, 0x46, 0x2F,
+    0x83, 0x6F, 0x81, 0x69, 0x81, 0x4E, 0x04, 0x26, 0x49, 0x00, 0x16, 0x2F, 0x84, 0x10, 0x29, 0x4E,
+    0x53, 0x4B, 0x27, 0x17, 0x1B, 0x3F, 0x3F, 0x95, 0xA3, 0x4A, 0x23, 0x7E, 0x14, 0x1B, 0x23, 0x6C,
+    0x8D, 0x8D, 0x4A, 0x99, 0x35, 0x33, 0x21, 0x67, 0x67, 0x1B, 0x09, 0x39, 0x5F, 0x35, 0x16, 0x36,
+    0x09, 0x09, 0x89, 0x18, 0x67, 0x7D, 0x09, 0x3E, 0x7C, 0x82, 0x67, 0x08, 0x3E, 0x99, 0x4A, 0x3E,
+    0x17, 0x25, 0x6C, 0x2D, 0x28, 0x82, 0x00, 0x20, 0x22, 0x08, 0x63, 0x1A, 0x06, 0xA1, 0x52, 0x1F,
+    0x18, 0x91, 0x00, 0x00, 0x06, 0x06, 0x1C, 0x58, 0x05, 0x04, 0x00, 0x0A, 0x0D, 0x0D, 0x5C, 0x40,
+    0x2E, 0x2E, 0x5A, 0x50, 0x50, 0x65, 0x02, 0x5A, 0x12, 0x82, 0x72, 0x06, 0x4C, 0x72, 0x72, 0x33,
+    0x33, 0x72, 0x4C, 0x82, 0x2E, 0x13, 0x65, 0x2E, 0x2E, 0x85, 0x4F, 0x92, 0x3B, 0x47, 0x03, 0x00,
+    0x0A, 0x13, 0x0A, 0x01, 0x00, 0x00, 0x61, 0x23, 0x3F, 0x18, 0x86, 0x00, 0x26, 0x4E, 0x1A, 0x00,
+    0x00, 0x29, 0x4A, 0x57, 0x36, 0x1B, 0x1A, 0x00, 0x05, 0x08, 0x79, 0x13, 0x55, 0x2D, 0x89, 0x61,
+    0x42, 0x0D, 0x90, 0x55, 0x5A, 0x80, 0x63, 0x05, 0x00, 0x08, 0x4C, 0x19, 0x64, 0x61, 0x3A, 0x3A,
+    0x14, 0x1D, 0x1D, 0x64, 0x82, 0x3A, 0x09, 0x10, 0x0E, 0x10, 0x46, 0x46, 0x10, 0x69, 0x5A, 0x53,
+    0x59, 0x89, 0x3A, 0x86, 0x10, 0x0C, 0x3A, 0x10, 0x3A, 0x3A, 0x10, 0x4E, 0x00, 0x5D, 0x07, 0x67,
+    0x21, 0x7B, 0x05, 0x82, 0x2F, 0x05, 0x69, 0x53, 0x6F, 0x6F, 0x2F, 0x46, 0x82, 0x6F, 0x20, 0x2F,
+    0x46, 0x61, 0x6F, 0x46, 0x4E, 0x56, 0x3D, 0x00, 0x7A, 0x6F, 0x2F, 0x2F, 0x3A, 0x10, 0x2F, 0x59,
+    0x7E, 0x14, 0x43, 0x0C, 0x39, 0x30, 0x14, 0x35, 0x11, 0x43, 0x2D, 0x21, 0x2B, 0x25, 0x39, 0x09,
+    0x82, 0x4A, 0x3C, 0x8D, 0x61, 0x5E, 0x33, 0x4B, 0x36, 0x09, 0x99, 0x09, 0x29, 0x04, 0x61, 0x09,
+    0x8D, 0x09, 0x74, 0x55, 0x38, 0x4D, 0x17, 0x7D, 0x7D, 0x1D, 0x67, 0x67, 0x1B, 0x36, 0x3E, 0x36,
+    0x23, 0x42, 0x61, 0x60, 0x00, 0x04, 0x00, 0x00, 0x02, 0x26, 0x4F, 0x18, 0x79, 0x80, 0x82, 0x02,
+    0x90, 0x01, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x08, 0x62, 0x00, 0x00, 0x13, 0x55, 0x55, 0x15, 0x0D,
+    0x82, 0x5A, 0x81, 0x2E, 0x02, 0x15, 0x01, 0x2E, 0x83, 0x72, 0x1E, 0x0D, 0x5A, 0x4C, 0x33, 0x33,
+    0x4C, 0x4C, 0x5A, 0x5A, 0x8C, 0x0D, 0x5A, 0x5A, 0x9A, 0x1C, 0x3C, 0x08, 0x85, 0x3B, 0x00, 0x00,
+    0x58, 0x03, 0x03, 0x00, 0x1F, 0x0C, 0x29, 0x2B, 0x29, 0x07, 0x83, 0x00, 0x34, 0x04, 0x02, 0x52,
+    0x25, 0x00, 0x00, 0x35, 0x1B, 0x39, 0x3E, 0x4A, 0x1A, 0x00, 0x00, 0x03, 0x0D, 0x2E, 0x32, 0x06,
+    0x2B, 0x53, 0x92, 0x75, 0x0A, 0x5C, 0x65, 0x6B, 0x00, 0x07, 0x3C, 0x3D, 0x5E, 0x79, 0x5E, 0x84,
+    0x64, 0x27, 0x89, 0x84, 0x64, 0x61, 0x3A, 0x2F, 0x10, 0x6D, 0x6D, 0x10, 0x46, 0x69, 0x10, 0x10,
+    0x69, 0x3A, 0x81, 0x10, 0x88, 0x3A, 0x86, 0x10, 0x0C, 0x3A, 0x10, 0x3A, 0x3A, 0x10, 0x74, 0x04,
+    0x00, 0x13, 0x1D, 0x24, 0x00, 0x05, 0x81, 0x10, 0x81, 0x2F, 0x13, 0x53, 0x61, 0x6F, 0x6F, 0x2F,
+    0x46, 0x6F, 0x46, 0x69, 0x6F, 0x61, 0x6F, 0x46, 0x4E, 0x60, 0x60, 0x5F, 0x1F, 0x2F, 0x6F, 0x84,
+    0x10, 0x34, 0x21, 0x17, 0x66, 0x8B, 0x43, 0x43, 0x17, 0x14, 0x0F, 0x11, 0x43, 0x99, 0x2D, 0x26,
+    0x3E, 0x94, 0x94, 0x8D, 0x4A, 0x4A, 0x0C, 0x19, 0x2C, 0x11, 0x4A, 0x09, 0x94, 0x09, 0x3F, 0x6E,
+    0x17, 0x09, 0x09, 0x57, 0x28, 0x80, 0x64, 0x83, 0x9C, 0x09, 0x3E, 0x20, 0x67, 0x67, 0x3E, 0x3E,
+    0x8B, 0x1B, 0x25, 0x61, 0x18, 0x00, 0x07, 0x83, 0x00, 0x05, 0x45, 0x26, 0x26, 0x2A, 0x26, 0x3B,
+    0x81, 0x26, 0x82, 0x00, 0x0D, 0x06, 0x48, 0x0A, 0x0A, 0x05, 0x00, 0x00, 0x05, 0x37, 0x0B, 0x54,
+    0x5C, 0x40, 0x5A, 0x82, 0x40, 0x25, 0x41, 0x3C, 0x2E, 0x72, 0x72, 0x4C, 0x72, 0x6B, 0x0D, 0x33,
+    0x50, 0x4C, 0x50, 0x2E, 0x40, 0x40, 0x6A, 0x5C, 0x65, 0x40, 0x15, 0x05, 0x91, 0x08, 0x96, 0x08,
+    0x01, 0x00, 0x05, 0x3D, 0x03, 0x00, 0x18, 0x61, 0x6E, 0x82, 0x7E, 0x86, 0x85, 0x00, 0x23, 0x60,
+    0x29, 0x01, 0x00, 0x53, 0x1B, 0x1B, 0x76, 0x0C, 0x82, 0x51, 0x45, 0x06, 0x15, 0x50, 0x41, 0x0A,
+    0x3B, 0x6B, 0x6B, 0x32, 0x06, 0x0A, 0x3B, 0x54, 0x02, 0x0B, 0x47, 0x06, 0x4C, 0x5E, 0x2C, 0x84,
+    0x10, 0x64, 0x38, 0x82, 0x69, 0x81, 0x10, 0x01, 0x3A, 0x2F, 0x85, 0x10, 0x80, 0x2F, 0x86, 0x3A,
+    0x81, 0x10, 0x82, 0x3A, 0x85, 0x10, 0x81, 0x3A, 0x0B, 0x10, 0x3A, 0x10, 0x74, 0x74, 0x02, 0x86,
+    0x2A, 0x2A, 0x95, 0x00, 0x02, 0x80, 0x10, 0x82, 0x2F, 0x03, 0x69, 0x27, 0x6D, 0x6F, 0x82, 0x46,
+    0x02, 0x6F, 0x46, 0x6D, 0x82, 0x6F, 0x06, 0x4E, 0x02, 0x88, 0x6F, 0x2B, 0x69, 0x2F, 0x82, 0x10,
+    0x35, 0x2F, 0x88, 0x21, 0x43, 0x61, 0x43, 0x0C, 0x6C, 0xA3, 0x46, 0x21, 0x24, 0x17, 0x70, 0x59,
+    0x29, 0x57, 0x0C, 0x1B, 0x36, 0x4A, 0x8D, 0x36, 0x30, 0x11, 0x11, 0x36, 0x09, 0x4A, 0x09, 0x23,
+    0x1E, 0x6C, 0x09, 0x09, 0x44, 0x28, 0x4C, 0x64, 0x31, 0x7D, 0x7D, 0x14, 0x1D, 0x64, 0x11, 0x1B,
+    0x0C, 0x0C, 0x1E, 0x7E, 0x52, 0x00, 0x04, 0x84, 0x00, 0x07, 0x01, 0x71, 0x2B, 0x2B, 0x56, 0x55,
+    0x78, 0x0A, 0x82, 0x00, 0x13, 0x06, 0x05, 0x0A, 0x05, 0x05, 0x00, 0x00, 0x48, 0x58, 0x58, 0x13,
+    0x9A, 0x65, 0x40, 0x0D, 0x5C, 0x0D, 0x41, 0x37, 0x5A, 0x83, 0x4C, 0x02, 0x41, 0x6A, 0x33, 0x82,
+    0x2E, 0x80, 0x5A, 0x82, 0x0D, 0x14, 0x6B, 0x41, 0x0D, 0x55, 0x03, 0x01, 0x08, 0x03, 0x3C, 0x0A,
+    0x04, 0x02, 0x3D, 0x01, 0x00, 0x1F, 0x42, 0x6E, 0x29, 0x52, 0x47, 0x82, 0x00, 0x33, 0x02, 0x07,
+    0x00, 0x01, 0x60, 0x07, 0x01, 0x5F, 0x9C, 0x39, 0x1B, 0x8B, 0x14, 0x35, 0x13, 0x91, 0x3B, 0x5C,
+    0x41, 0x3B, 0x37, 0x08, 0x92, 0x40, 0x08, 0x9F, 0x01, 0x06, 0x03, 0x15, 0x9A, 0x9A, 0x4C, 0x5E,
+    0x67, 0x84, 0x46, 0x10, 0x33, 0x59, 0x3A, 0x3A, 0x10, 0x3A, 0x3A, 0x10, 0x10, 0x3A, 0x10, 0x3A,
+    0x10, 0x2F, 0x83, 0x10, 0x81, 0x3A, 0x82, 0x10, 0x80, 0x2F, 0x85, 0x10, 0x10, 0x3A, 0x10, 0x10,
+    0x3A, 0x3A, 0x10, 0x10, 0x7F, 0x07, 0x74, 0x03, 0x2A, 0x7D, 0x29, 0x00, 0x01, 0x00, 0x01, 0x2F,
+    0x10, 0x82, 0x2F, 0x05, 0x46, 0x6F, 0x6F, 0x46, 0x3F, 0x46, 0x84, 0x6F, 0x1D, 0x6D, 0x95, 0x16,
+    0x6F, 0x6D, 0x53, 0x74, 0x10, 0x2F, 0x10, 0x6D, 0x59, 0x96, 0x14, 0x43, 0x4E, 0x43, 0x39, 0x59,
+    0x46, 0x6F, 0x6D, 0x59, 0x59, 0x10, 0x88, 0x95, 0xA3, 0xA3, 0x6C, 0x82, 0xA0, 0x1E, 0x23, 0x4B,
+    0x67, 0x0F, 0x1E, 0x8D, 0x99, 0x09, 0x42, 0x14, 0x43, 0x99, 0x09, 0x0C, 0x1F, 0x33, 0x20, 0x4D,
+    0x7C, 0x20, 0x1D, 0x1D, 0x67, 0x2A, 0x39, 0x0C, 0x76, 0x2D, 0x07, 0x00, 0x04, 0x85, 0x00, 0x0B,
+    0x01, 0x2B, 0x68, 0x86, 0x05, 0x55, 0x2B, 0x1A, 0x22, 0x00, 0x01, 0x06, 0x82, 0x05, 0x30, 0x03,
+    0x00, 0x00, 0x05, 0x08, 0x0A, 0x06, 0x73, 0x0D, 0x0D, 0x41, 0x9A, 0x5C, 0x41, 0x0B, 0x0D, 0x2E,
+    0x2E, 0x50, 0x2E, 0x65, 0x71, 0x0D, 0x65, 0x40, 0x0D, 0x65, 0x5C, 0x5C, 0x15, 0x8A, 0x0B, 0x15,
+    0x79, 0x01, 0x00, 0x05, 0x01, 0x62, 0x08, 0x01, 0x00, 0x03, 0x03, 0x00, 0x60, 0x42, 0x7E, 0x2B,
+    0x81, 0x5F, 0x82, 0x00, 0x28, 0x1A, 0x56, 0x00, 0x00, 0x02, 0x00, 0x56, 0x29, 0x20, 0x1B, 0x76,
+    0x8B, 0x35, 0x0D, 0x32, 0x3C, 0x86, 0x08, 0x58, 0x58, 0x02, 0x00, 0x03, 0x5A, 0x0B, 0x05, 0x49,
+    0x91, 0x03, 0x13, 0x90, 0x50, 0x50, 0x4C, 0x64, 0x84, 0x14, 0x10, 0x95, 0x74, 0x7F, 0x81, 0x59,
+    0x82, 0x10, 0x80, 0x69, 0x8B, 0x10, 0x80, 0x2F, 0x83, 0x10, 0x11, 0x3A, 0x10, 0x10, 0x3A, 0x10,
+    0x10, 0x3A, 0x3A, 0x69, 0x10, 0x59, 0x22, 0x00, 0x16, 0x37, 0x1D, 0x19, 0x01, 0x82, 0x00, 0x4E,
+    0x10, 0x2F, 0x2F, 0x10, 0x10, 0x3F, 0x3F, 0x6F, 0x2F, 0x3F, 0x3F, 0x8E, 0x6F, 0x46, 0x6F, 0x6D,
+    0x6F, 0x59, 0x6F, 0x2F, 0x6D, 0x2D, 0x87, 0x59, 0x6D, 0x2F, 0x46, 0x51, 0x75, 0x23, 0x0C, 0x17,
+    0x0C, 0xA3, 0x69, 0x46, 0xA3, 0x6D, 0x6D, 0x10, 0x3A, 0x1F, 0x4E, 0x3F, 0x17, 0x09, 0x70, 0x77,
+    0x1B, 0x61, 0x6E, 0x35, 0x0F, 0x4B, 0x14, 0x3E, 0x94, 0x0C, 0x35, 0x0C, 0x8D, 0x1B, 0x61, 0x26,
+    0x72, 0x7C, 0x4D, 0x31, 0x1D, 0x1D, 0x20, 0x1D, 0x67, 0x17, 0x17, 0x66, 0x16, 0x04, 0x02, 0x81,
+    0x01, 0x83, 0x00, 0x42, 0x03, 0x68, 0x52, 0x02, 0x00, 0x1C, 0x05, 0x1C, 0x45, 0x00, 0x00, 0x02,
+    0x06, 0x05, 0x03, 0x05, 0x03, 0x00, 0x00, 0x03, 0x0A, 0x03, 0x02, 0x58, 0x15, 0x5C, 0x0B, 0x0B,
+    0x0D, 0x9A, 0x47, 0x15, 0x5A, 0x5A, 0x2E, 0x2E, 0x6A, 0x0B, 0x0B, 0x65, 0x0D, 0x0D, 0x65, 0x41,
+    0x41, 0x8A, 0x08, 0x87, 0x54, 0x47, 0x06, 0x00, 0x03, 0x06, 0x01, 0x48, 0x01, 0x00, 0x01, 0x03,
+    0x00, 0x51, 0x29, 0x25, 0x6E, 0x26, 0x56, 0x82, 0x00, 0x31, 0x56, 0x25, 0x01, 0x07, 0x00, 0x00,
+    0x52, 0x4E, 0x35, 0x36, 0x39, 0x6C, 0x68, 0x71, 0x6B, 0x0B, 0x32, 0x92, 0x0B, 0x48, 0x02, 0x06,
+    0x13, 0x0D, 0x55, 0x15, 0x3D, 0x05, 0x9F, 0x02, 0x05, 0x2E, 0x33, 0x78, 0x2A, 0x84, 0x7C, 0x23,
+    0x9B, 0x3A, 0x59, 0x74, 0x28, 0x7F, 0x10, 0x10, 0x2F, 0x10, 0x2F, 0x46, 0x89, 0x10, 0x80, 0x2F,
+    0x81, 0x10, 0x81, 0x3A, 0x84, 0x10, 0x0E, 0x3A, 0x10, 0x3A, 0x10, 0x1F, 0x00, 0x22, 0x16, 0x75,
+    0x0D, 0x32, 0x02, 0x75, 0x62, 0x01, 0x81, 0x10, 0x81, 0x2F, 0x0C, 0x10, 0x59, 0x53, 0x2F, 0x6D,
+    0x59, 0x74, 0x46, 0x8E, 0x46, 0x6F, 0x6F, 0x46, 0x82, 0x6F, 0x0D, 0x0E, 0x69, 0x00, 0x7F, 0x6D,
+    0x8E, 0x7A, 0x00, 0x51, 0x1E, 0x3E, 0x8B, 0x17, 0x0C, 0x82, 0xA3, 0x81, 0x6F, 0x30, 0x6D, 0x10,
+    0x88, 0x69, 0x11, 0x35, 0x23, 0x39, 0x4A, 0x09, 0x89, 0x42, 0x21, 0x2C, 0x11, 0x4B, 0x11, 0x1B,
+    0x09, 0x8B, 0x17, 0x30, 0x11, 0x42, 0x26, 0x72, 0x31, 0x7C, 0x14, 0x1D, 0x1D, 0x64, 0x64, 0x4B,
+    0x14, 0x76, 0x1E, 0x51, 0x04, 0x02, 0x29, 0x60, 0x00, 0x04, 0x00, 0x5D, 0x5F, 0x55, 0x02, 0x84,
+    0x00, 0x1E, 0x04, 0x00, 0x01, 0x01, 0x06, 0x03, 0x03, 0x05, 0x01, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x00, 0x0A, 0x0B, 0x73, 0x58, 0x54, 0x0D, 0x37, 0x4F, 0x3C, 0x0D, 0x0D, 0x5A, 0x5A, 0x41, 0x8A,
+    0x9A, 0x83, 0x41, 0x17, 0x73, 0x9A, 0x58, 0x05, 0x0A, 0x87, 0x08, 0x01, 0x00, 0x01, 0x03, 0x01,
+    0x03, 0x06, 0x00, 0x00, 0x02, 0x1F, 0x16, 0x00, 0x16, 0x2D, 0x5F, 0x91, 0x82, 0x00, 0x12, 0x03,
+    0x7E, 0x26, 0x29, 0x02, 0x00, 0x63, 0x2D, 0x2B, 0x76, 0x3E, 0x1E, 0x4B, 0x19, 0x11, 0x2A, 0x11,
+    0x30, 0x11, 0x82, 0x2D, 0x1A, 0x21, 0x81, 0x0C, 0x80, 0x92, 0x71, 0x42, 0x23, 0x23, 0x66, 0x76,
+    0x2A, 0x84, 0x7C, 0x83, 0x83, 0x9B, 0x9B, 0x3A, 0x10, 0x3A, 0x69, 0x10, 0x46, 0x10, 0x2F, 0x6F,
+    0x82, 0x10, 0x80, 0x3A, 0x83, 0x10, 0x03, 0x3A, 0x10, 0x10, 0x2F, 0x87, 0x10, 0x0F, 0x3A, 0x10,
+    0x3A, 0x10, 0x74, 0x07, 0x00, 0x22, 0x4E, 0x01, 0x07, 0x62, 0x5D, 0x02, 0x79, 0x04, 0x81, 0x2F,
+    0x36, 0x10, 0x4E, 0x46, 0x10, 0x4B, 0x69, 0x59, 0x69, 0x1F, 0x69, 0x6F, 0x8E, 0x8E, 0x46, 0x2F,
+    0x6F, 0x6F, 0x8E, 0x0E, 0x2F, 0x49, 0x79, 0x8E, 0x7F, 0x02, 0x34, 0x86, 0x17, 0x3E, 0x39, 0x0C,
+    0x39, 0x8B, 0x43, 0x8E, 0x8E, 0xA3, 0x43, 0x8E, 0x46, 0x59, 0x24, 0x24, 0x27, 0x61, 0x39, 0x09,
+    0x23, 0xA0, 0x17, 0x11, 0x67, 0x67, 0x2C, 0x8B, 0x82, 0x09, 0x13, 0x43, 0x36, 0x6C, 0x68, 0x64,
+    0x1D, 0x20, 0x14, 0x1D, 0x1D, 0x83, 0x20, 0x53, 0x17, 0x3E, 0x42, 0x00, 0x04, 0x5F, 0x4E, 0x83,
+    0x00, 0x03, 0x07, 0x01, 0x02, 0x04, 0x82, 0x00, 0x80, 0x34, 0x84, 0x00, 0x35, 0x06, 0x01, 0x06,
+    0x03, 0x02, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x03, 0x32, 0x8A, 0x08, 0x58, 0x41, 0x92, 0x58,
+    0x05, 0x9A, 0x41, 0x0D, 0x2E, 0x0B, 0x58, 0x3B, 0x37, 0x55, 0x9A, 0x73, 0x0B, 0x73, 0x13, 0x03,
+    0x06, 0x0A, 0x0A, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x18, 0x16, 0x49, 0x00,
+    0x02, 0x18, 0x1C, 0x84, 0x00, 0x0F, 0x52, 0x5F, 0x23, 0x95, 0x00, 0x04, 0x1A, 0x16, 0x76, 0x36,
+    0x1E, 0x19, 0x11, 0x09, 0x09, 0x99, 0x85, 0x09, 0x05, 0x99, 0xA3, 0x5B, 0x0D, 0x80, 0x4A, 0x82,
+    0x09, 0x08, 0x99, 0x1D, 0x84, 0x31, 0x7C, 0x20, 0x50, 0x7F, 0x3A, 0x81, 0x10, 0x82, 0x2F, 0x02,
+    0x10, 0x46, 0x6F, 0x85, 0x10, 0x03, 0x2F, 0x10, 0x3A, 0x10, 0x82, 0x2F, 0x16, 0x10, 0x2F, 0x2F,
+    0x10, 0x2F, 0x2F, 0x10, 0x10, 0x3A, 0x10, 0x59, 0x07, 0x00, 0x00, 0x75, 0x95, 0x04, 0x00, 0x02,
+    0x02, 0x7A, 0x7F, 0x51, 0x0E, 0x4E, 0x10, 0x29, 0x6B, 0x8C, 0x69, 0x69, 0x35, 0x7E, 0x7E, 0x15,
+    0x4E, 0x6F, 0x69, 0x46, 0x82, 0x6F, 0x81, 0x0E, 0x1B, 0x8E, 0x0E, 0x7A, 0x5F, 0x1A, 0x02, 0x62,
+    0x04, 0x51, 0x66, 0x3E, 0x1B, 0x1B, 0x36, 0x1B, 0x39, 0x43, 0x76, 0x1B, 0x31, 0x4D, 0x89, 0x69,
+    0x76, 0x4A, 0x99, 0x8D, 0x36, 0x82, 0x4A, 0x1D, 0x39, 0x11, 0x11, 0x20, 0x14, 0x4D, 0x09, 0x94,
+    0x4A, 0x36, 0x09, 0x3F, 0x2D, 0x09, 0x3E, 0x7C, 0x21, 0x21, 0x0C, 0x94, 0x25, 0x42, 0x1B, 0x94,
+    0x74, 0x34, 0x37, 0x6E, 0x4E, 0x04, 0x84, 0x00, 0x02, 0x34, 0x00, 0x02, 0x87, 0x00, 0x33, 0x03,
+    0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x13, 0x58, 0x3D, 0x05, 0x55,
+    0x92, 0x32, 0x06, 0x9A, 0x9A, 0x0B, 0x0D, 0x55, 0x08, 0x0A, 0x58, 0x73, 0x54, 0x54, 0x8A, 0x58,
+    0x05, 0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x04, 0x60, 0x52, 0x75,
+    0x07, 0x00, 0x04, 0x82, 0x00, 0x80, 0x04, 0x82, 0x00, 0x24, 0x79, 0xA1, 0x42, 0x89, 0x7A, 0x04,
+    0x01, 0x79, 0x31, 0x6C, 0x14, 0x19, 0x30, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x99, 0x99, 0x09, 0x8D,
+    0x09, 0xA3, 0x5B, 0x0D, 0x56, 0x36, 0x09, 0x99, 0x09, 0x99, 0x20, 0x84, 0x83, 0x83, 0x14, 0x81,
+    0x59, 0x81, 0x3A, 0x85, 0x2F, 0x01, 0x8E, 0x2F, 0x88, 0x10, 0x07, 0x2F, 0x46, 0x2F, 0x46, 0x6F,
+    0x2F, 0x46, 0x2F, 0x83, 0x10, 0x0D, 0x59, 0x60, 0x00, 0x04, 0x00, 0x60, 0x4E, 0x00, 0x34, 0x60,
+    0x7F, 0x59, 0x59, 0x7F, 0x4F, 0x63, 0x7F, 0x02, 0x03, 0x96, 0x63, 0x28, 0x55, 0x35, 0x4E, 0x26,
+    0x5F, 0x6F, 0x46, 0x46, 0x6D, 0x8E, 0x6D, 0xA3, 0xA3, 0x6F, 0x0E, 0x4E, 0x48, 0x01, 0x02, 0x75,
+    0x04, 0x45, 0x17, 0x1B, 0x3E, 0x3E, 0x36, 0x36, 0x0C, 0x36, 0x4A, 0x1B, 0x0C, 0x39, 0x39, 0x69,
+    0x94, 0x4A, 0x94, 0x4A, 0x94, 0x4A, 0x99, 0x8D, 0x4A, 0x21, 0x2C, 0x24, 0x31, 0x14, 0x09, 0x8D,
+    0x3E, 0x1B, 0x23, 0x18, 0x23, 0x09, 0x09, 0x9C, 0x1D, 0x43, 0x99, 0x61, 0x3F, 0x0C, 0x17, 0x0C,
+    0x1F, 0x00, 0x3F, 0x14, 0x4E, 0x87, 0x00, 0x80, 0x04, 0x86, 0x00, 0x04, 0x02, 0x01, 0x06, 0x06,
+    0x02, 0x82, 0x00, 0x80, 0x01, 0x83, 0x00, 0x28, 0x62, 0x13, 0x0A, 0x22, 0x8A, 0x6B, 0x3C, 0x00,
+    0x3B, 0x9A, 0x8A, 0x08, 0x0D, 0x3B, 0x75, 0x0A, 0x3B, 0x3B, 0x0A, 0x58, 0x08, 0x03, 0x01, 0x02,
+    0x01, 0x01, 0x04, 0x00, 0x01, 0x75, 0x04, 0x00, 0x02, 0x60, 0x95, 0x5D, 0x00, 0x7E, 0x1A, 0x00,
+    0x02, 0x85, 0x00, 0x0E, 0x49, 0x86, 0x27, 0x23, 0x3F, 0x07, 0x00, 0x07, 0x11, 0x14, 0x23, 0x78,
+    0x25, 0x09, 0x99, 0x85, 0x09, 0x14, 0x99, 0x09, 0x57, 0x6A, 0x40, 0x79, 0x1B, 0x09, 0x09, 0x99,
+    0x09, 0x81, 0x84, 0x84, 0x7C, 0x21, 0x59, 0x59, 0x3A, 0x3A, 0x2F, 0x82, 0x6D, 0x09, 0x6F, 0x6D,
+    0x6D, 0x6F, 0x2F, 0x2F, 0x10, 0x10, 0x46, 0x2F, 0x81, 0x46, 0x84, 0x2F, 0x03, 0x10, 0x46, 0x46,
+    0x2F, 0x83, 0x10, 0x08, 0x1F, 0x00, 0x04, 0x00, 0x34, 0x9F, 0x51, 0x07, 0x88, 0x82, 0x59, 0x01,
+    0x9B, 0x59, 0x23, 0x7B, 0x9F, 0x00, 0x00, 0x9F, 0x02, 0x02, 0x16, 0x2B, 0x59, 0x74, 0x7A, 0x2F,
+    0x6D, 0x8E, 0x0E, 0x8E, 0x8E, 0xA3, 0x8E, 0x6D, 0x0E, 0x4E, 0x00, 0x01, 0x06, 0x22, 0x00, 0x1C,
+    0x0C, 0x39, 0x1B, 0x36, 0x4A, 0x1B, 0x3E, 0x82, 0x36, 0x28, 0x4A, 0x94, 0x1B, 0x69, 0x8D, 0x4A,
+    0x94, 0x8D, 0x94, 0x4A, 0x99, 0x4A, 0x09, 0x6C, 0x11, 0x64, 0x67, 0x27, 0x9C, 0x09, 0x17, 0x95,
+    0x16, 0x89, 0x8B, 0x09, 0x09, 0x7D, 0x64, 0x7C, 0x76, 0x25, 0x0C, 0x8B, 0x31, 0x6C, 0x7B, 0x79,
+    0x81, 0x1E, 0x1F, 0x90, 0x00, 0x03, 0x01, 0x06, 0x06, 0x02, 0x82, 0x00, 0x80, 0x01, 0x83, 0x00,
+    0x0F, 0x01, 0x08, 0x0A, 0x01, 0x3B, 0x0B, 0x08, 0x00, 0x48, 0x0B, 0x8A, 0x05, 0x32, 0x3B, 0x03,
+    0x0A, 0x83, 0x08, 0x02, 0x0A, 0x03, 0x01, 0x82, 0x02, 0x85, 0x00, 0x09, 0x18, 0x2D, 0x7B, 0x02,
+    0x5F, 0x3F, 0x82, 0xA1, 0x4F, 0x02, 0x85, 0x00, 0x0B, 0x03, 0x4B, 0x14, 0x61, 0x51, 0x01, 0x02,
+    0x79, 0x43, 0x14, 0x50, 0x30, 0x83, 0x09, 0x80, 0x99, 0x84, 0x09, 0x19, 0x70, 0x6A, 0x40, 0x5C,
+    0x0C, 0x09, 0x99, 0x09, 0x09, 0x4D, 0x84, 0x84, 0x7C, 0x4B, 0x74, 0x59, 0x3A, 0x10, 0x2F, 0x10,
+    0x6D, 0x2F, 0x6F, 0x6D, 0x6D, 0x6F, 0x83, 0x6D, 0x81, 0x46, 0x03, 0x2F, 0x27, 0x30, 0x69, 0x81,
+    0x10, 0x82, 0x2F, 0x82, 0x10, 0x0C, 0x69, 0x10, 0x7A, 0x00, 0x00, 0x03, 0x5D, 0x04, 0x04, 0x51,
+    0x59, 0x10, 0x3A, 0x81, 0x59, 0x81, 0x9B, 0x81, 0x00, 0x80, 0x04, 0x82, 0x00, 0x0A, 0x02, 0x16,
+    0x4E, 0x59, 0x69, 0x2F, 0x6F, 0x6F, 0x8E, 0x6F, 0x6D, 0x82, 0x0E, 0x3B, 0x69, 0x7A, 0x45, 0x00,
+    0x00, 0x06, 0x02, 0x00, 0x45, 0x0C, 0x3E, 0x1B, 0x36, 0x36, 0x4A, 0x36, 0x36, 0x94, 0x36, 0x4A,
+    0x94, 0x3E, 0x69, 0x3E, 0x8D, 0x8D, 0x4A, 0x4A, 0x94, 0x94, 0x8D, 0x70, 0x30, 0x31, 0x20, 0x67,
+    0x67, 0x35, 0x17, 0x09, 0x39, 0x70, 0x09, 0x4D, 0x7C, 0x76, 0x4D, 0x1D, 0x11, 0x6E, 0x81, 0x57,
+    0x14, 0x20, 0x23, 0x00, 0x29, 0x6C, 0x1A, 0x62, 0x90, 0x00, 0x01, 0x01, 0x06, 0x81, 0x01, 0x88,
+    0x00, 0x14, 0x05, 0x62, 0x06, 0x91, 0x58, 0x08, 0x04, 0x01, 0x58, 0x58, 0x03, 0x03, 0x58, 0x48,
+    0x49, 0x48, 0x05, 0x1C, 0x0A, 0x05, 0x01, 0x81, 0x00, 0x81, 0x02, 0x84, 0x00, 0x0A, 0x22, 0x3F,
+    0x28, 0x00, 0x25, 0x30, 0x05, 0x29, 0x5F, 0x16, 0x95, 0x85, 0x00, 0x0D, 0x02, 0x2B, 0x27, 0x89,
+    0x28, 0x45, 0x4F, 0x00, 0x3F, 0x27, 0x40, 0x11, 0x09, 0x99, 0x87, 0x09, 0x11, 0x4A, 0x71, 0x5A,
+    0x0D, 0xA0, 0x09, 0x8D, 0x8D, 0x09, 0x89, 0x64, 0x83, 0x7C, 0x68, 0x00, 0x56, 0x4E, 0x10, 0x84,
+    0x6D, 0x0C, 0x6F, 0x0E, 0x6D, 0x6F, 0x59, 0x7F, 0x74, 0x6A, 0x50, 0x53, 0x79, 0x92, 0x69, 0x83,
+    0x2F, 0x81, 0x10, 0x0D, 0x69, 0x27, 0x10, 0x5F, 0x34, 0x60, 0x5F, 0x6A, 0x00, 0x22, 0x74, 0x69,
+    0x10, 0x3A, 0x81, 0x59, 0x82, 0x9B, 0x0B, 0x9F, 0x00, 0x00, 0x04, 0x04, 0x51, 0x1A, 0x45, 0x69,
+    0x46, 0x46, 0x2F, 0x82, 0x6F, 0x40, 0x8E, 0x6F, 0x0E, 0x6F, 0x74, 0x07, 0x45, 0x95, 0x00, 0x00,
+    0x01, 0x22, 0x00, 0x1C, 0x39, 0x36, 0x36, 0x4A, 0x36, 0x36, 0x4A, 0x36, 0x36, 0x4A, 0x4A, 0x36,
+    0x36, 0x46, 0x1B, 0x8D, 0x8D, 0x4A, 0x8D, 0x4A, 0x4A, 0x09, 0x42, 0x0F, 0x31, 0x81, 0x9C, 0x4B,
+    0x5E, 0x31, 0x6C, 0x17, 0x36, 0x36, 0x7C, 0x7C, 0x31, 0x31, 0x27, 0x02, 0x07, 0x6C, 0x43, 0x1D,
+    0x21, 0x25, 0x00, 0x2D, 0x1A, 0x18, 0x29, 0x90, 0x00, 0x02, 0x01, 0x06, 0x01, 0x89, 0x00, 0x10,
+    0x06, 0x03, 0x03, 0x01, 0x05, 0x08, 0x01, 0x00, 0x0A, 0x3B, 0x03, 0x00, 0x08, 0x3D, 0x01, 0x06,
+    0x01, 0x82, 0x03, 0x80, 0x01, 0x86, 0x00, 0x0C, 0x02, 0x22, 0x4E, 0x1F, 0x00, 0x00, 0x6E, 0x6E,
+    0x85, 0x6E, 0x96, 0x7E, 0x3F, 0x83, 0x00, 0x11, 0x02, 0x00, 0x00, 0x6A, 0x5E, 0x30, 0x1F, 0x49,
+    0x29, 0x22, 0x75, 0x68, 0x50, 0x11, 0x09, 0x99, 0x09, 0x99, 0x85, 0x09, 0x04, 0x4A, 0x6A, 0x5A,
+    0x0D, 0x0C, 0x83, 0x09, 0x0B, 0x57, 0x84, 0x7C, 0x84, 0x78, 0x04, 0x96, 0x32, 0x79, 0x95, 0x69,
+    0x2F, 0x82, 0x8E, 0x1F, 0x69, 0x3F, 0x25, 0x5F, 0x0D, 0x54, 0x41, 0x55, 0x03, 0x75, 0x74, 0x46,
+    0x10, 0x2F, 0x10, 0x2F, 0x2F, 0x10, 0x2C, 0x46, 0x74, 0x00, 0x00, 0x03, 0x1F, 0x1C, 0x88, 0x69,
+    0x2F, 0x3A, 0x10, 0x3A, 0x82, 0x59, 0x81, 0x9B, 0x25, 0x08, 0x00, 0x34, 0x00, 0x00, 0x51, 0x6F,
+    0x46, 0x2F, 0x2F, 0x46, 0x2F, 0x6F, 0x6F, 0x6D, 0x6F, 0x0E, 0x69, 0x60, 0x02, 0x16, 0x62, 0x74,
+    0x07, 0x00, 0x62, 0x02, 0x00, 0x45, 0x39, 0x4A, 0x4A, 0x36, 0x4A, 0x4A, 0x94, 0x1B, 0x36, 0x82,
+    0x4A, 0x15, 0x36, 0x44, 0x36, 0x8D, 0x8D, 0x99, 0x94, 0x99, 0x09, 0x23, 0x6E, 0x2C, 0x64, 0x4D,
+    0x09, 0x17, 0x53, 0x7D, 0x7C, 0x1D, 0x27, 0x7D, 0x83, 0x7C, 0x0E, 0x27, 0x4F, 0x1F, 0x7D, 0x14,
+    0x1D, 0x20, 0x82, 0x01, 0x18, 0x82, 0x23, 0x18, 0x00, 0x04, 0x84, 0x00, 0x02, 0x5D, 0x7A, 0x5D,
+    0x86, 0x00, 0x82, 0x01, 0x86, 0x00, 0x80, 0x01, 0x82, 0x00, 0x12, 0x06, 0x03, 0x02, 0x02, 0x08,
+    0x01, 0x00, 0x01, 0x05, 0x03, 0x00, 0x06, 0x3D, 0x00, 0x02, 0x01, 0x07, 0x03, 0x01, 0x88, 0x00,
+    0x0C, 0x42, 0x6C, 0x62, 0x02, 0x03, 0x03, 0x82, 0x35, 0x6E, 0x2B, 0x30, 0x63, 0x02, 0x82, 0x00,
+    0x10, 0x02, 0x00, 0x00, 0xA1, 0x40, 0x26, 0x1F, 0x01, 0x26, 0x26, 0x00, 0x47, 0x0F, 0x23, 0x70,
+    0x1B, 0x66, 0x86, 0x09, 0x2B, 0x77, 0x71, 0x4C, 0x82, 0x23, 0x4A, 0x17, 0x43, 0x23, 0x83, 0x84,
+    0x83, 0x7C, 0x19, 0x07, 0x3D, 0x32, 0x96, 0x00, 0x9F, 0x69, 0x95, 0x3F, 0x14, 0x82, 0x6A, 0x35,
+    0x35, 0x2B, 0x00, 0x02, 0x04, 0x00, 0x3B, 0x69, 0x10, 0x2F, 0x2F, 0x10, 0x10, 0x2F, 0x69, 0x21,
+    0x7E, 0x82, 0x00, 0x01, 0x28, 0x4E, 0x81, 0x10, 0x82, 0x3A, 0x01, 0x10, 0x3A, 0x83, 0x59, 0x80,
+    0x9B, 0x0B, 0xA1, 0x60, 0x7B, 0x00, 0x04, 0x04, 0x4E, 0x8E, 0x10, 0x2F, 0x46, 0x2F, 0x82, 0x6F,
+    0x40, 0x0E, 0x59, 0x02, 0x3C, 0x29, 0x2B, 0x5F, 0x74, 0x22, 0x00, 0x02, 0x02, 0x01, 0x45, 0x1B,
+    0x94, 0x4A, 0x36, 0x94, 0x94, 0x39, 0x4A, 0x8D, 0x4A, 0x4A, 0x8D, 0x4A, 0x44, 0x36, 0x94, 0x4A,
+    0x4A, 0x3E, 0x3E, 0x1E, 0x23, 0x21, 0x2C, 0x2C, 0x7D, 0x09, 0x99, 0x39, 0x39, 0x66, 0x20, 0x27,
+    0x1E, 0x4D, 0x7C, 0x31, 0x31, 0x83, 0x24, 0x1E, 0x31, 0x14, 0x31, 0x21, 0x18, 0x00, 0x52, 0x1E,
+    0x3F, 0x02, 0x86, 0x00, 0x02, 0x4E, 0x46, 0x28, 0x86, 0x00, 0x01, 0x02, 0x01, 0x86, 0x00, 0x01,
+    0x7B, 0x51, 0x82, 0x00, 0x81, 0x01, 0x10, 0x9F, 0x02, 0x05, 0x01, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x02, 0x03, 0x02, 0x00, 0x01, 0x01, 0x06, 0x01, 0x86, 0x00, 0x0E, 0x04, 0x16, 0x1A, 0x25, 0x1A,
+    0x1C, 0x13, 0x00, 0x22, 0x82, 0x53, 0x35, 0x35, 0x63, 0x34, 0x82, 0x00, 0x10, 0x01, 0x00, 0x00,
+    0x1C, 0x8C, 0x3C, 0x18, 0x51, 0x87, 0x65, 0x3C, 0x00, 0x5F, 0x1D, 0x36, 0x70, 0x43, 0x83, 0x09,
+    0x33, 0x8D, 0x09, 0x09, 0x70, 0x71, 0x2C, 0x2D, 0x58, 0x79, 0x55, 0x8C, 0x6B, 0x38, 0x84, 0x83,
+    0x7C, 0x5B, 0x00, 0x1C, 0x58, 0x03, 0x5D, 0x00, 0x46, 0x74, 0x79, 0x23, 0x55, 0x13, 0x82, 0x53,
+    0x0B, 0x00, 0x79, 0x62, 0x00, 0x16, 0x10, 0x10, 0x2F, 0x2F, 0x46, 0x64, 0x38, 0x27, 0x7F, 0x0B,
+    0x1F, 0x74, 0x0F, 0x21, 0x2F, 0x85, 0x10, 0x81, 0x59, 0x81, 0x9B, 0x01, 0x59, 0x9B, 0x36, 0x6E,
+    0x3A, 0x88, 0x34, 0x00, 0x00, 0x45, 0x61, 0x6F, 0x46, 0x6F, 0x2F, 0x6F, 0x6F, 0x2F, 0x42, 0x5F,
+    0x96, 0x5F, 0x2B, 0x3B, 0x35, 0x4E, 0x00, 0x00, 0x45, 0x60, 0x00, 0x45, 0x3E, 0x36, 0x4A, 0x94,
+    0x09, 0x76, 0x43, 0x4A, 0x3E, 0x36, 0x4A, 0x36, 0x1B, 0x44, 0x9C, 0x9C, 0x4D, 0x1E, 0x31, 0x83,
+    0x21, 0x23, 0x3F, 0x2C, 0x67, 0x66, 0x83, 0x09, 0x13, 0x94, 0x17, 0x8B, 0x8D, 0x09, 0x4A, 0x76,
+    0x4D, 0x1D, 0x24, 0x4D, 0x31, 0x31, 0x4D, 0x24, 0x00, 0x1F, 0x4D, 0x6C, 0x28, 0x86, 0x00, 0x03,
+    0x88, 0x44, 0x46, 0x28, 0x82, 0x00, 0x80, 0x04, 0x82, 0x00, 0x81, 0x02, 0x86, 0x00, 0x01, 0x28,
+    0x7A, 0x82, 0x00, 0x11, 0x02, 0x00, 0x03, 0x02, 0x01, 0x06, 0x00, 0x00, 0x01, 0x03, 0x02, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x06, 0x87, 0x00, 0x0F, 0x60, 0x63, 0x00, 0x00, 0x04, 0x52, 0x2B,
+    0x04, 0x4E, 0x29, 0x02, 0xA1, 0x7E, 0x16, 0x34, 0x02, 0x82, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x2B,
+    0x15, 0x79, 0x51, 0x4F, 0x65, 0x6A, 0x03, 0x00, 0x50, 0x7D, 0x09, 0x0C, 0x86, 0x09, 0x0D, 0x70,
+    0x35, 0x4C, 0x30, 0x8A, 0x0B, 0x40, 0x33, 0x0D, 0x33, 0x84, 0x84, 0x7C, 0x68, 0x83, 0x00, 0x81,
+    0x02, 0x1E, 0x46, 0x25, 0x13, 0x56, 0x5F, 0x8A, 0x03, 0x3B, 0x85, 0x71, 0x35, 0x05, 0x51, 0x46,
+    0x10, 0x10, 0x2F, 0x2F, 0x10, 0x33, 0x3F, 0x0F, 0x3F, 0x46, 0x6D, 0x6D, 0x14, 0x1D, 0x10, 0x10,
+    0x2F, 0x82, 0x10, 0x80, 0x3A, 0x82, 0x59, 0x02, 0x3A, 0x59, 0x7F, 0x80, 0x7E, 0x81, 0x60, 0x83,
+    0x00, 0x23, 0x28, 0x46, 0x6F, 0x2F, 0x46, 0x6F, 0x6D, 0x59, 0x5B, 0x1C, 0x45, 0x52, 0x79, 0x60,
+    0x91, 0x16, 0x45, 0x00, 0x25, 0x1A, 0x00, 0x45, 0x39, 0x8D, 0x4A, 0x4A, 0x8D, 0x76, 0x4D, 0x7D,
+    0x7D, 0x43, 0x17, 0x1E, 0x14, 0x43, 0x82, 0x4D, 0x08, 0x7C, 0x31, 0x83, 0x23, 0x4B, 0x4B, 0x11,
+    0x67, 0x3E, 0x82, 0x09, 0x03, 0x99, 0x09, 0x09, 0x99, 0x83, 0x09, 0x02, 0x8D, 0x35, 0x14, 0x82,
+    0x31, 0x05, 0x7C, 0x29, 0x1F, 0x1E, 0x1E, 0x16, 0x82, 0x00, 0x80, 0x04, 0x82, 0x00, 0x04, 0x07,
+    0x61, 0x59, 0x46, 0x51, 0x85, 0x00, 0x81, 0x02, 0x80, 0x01, 0x84, 0x00, 0x03, 0x04, 0x00, 0x7A,
+    0x88, 0x84, 0x00, 0x0E, 0x03, 0x02, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x06, 0x00, 0x00, 0x01,
+    0x04, 0x00, 0x01, 0x81, 0x02, 0x85, 0x00, 0x02, 0x02, 0x00, 0x04, 0x82, 0x00, 0x0A, 0x07, 0x6E,
+    0x3F, 0x7E, 0x22, 0x9F, 0x00, 0x34, 0x45, 0x00, 0x02, 0x82, 0x00, 0x10, 0x01, 0x00, 0x00, 0x26,
+    0x33, 0x80, 0x51, 0x1C, 0x71, 0x5A, 0x71, 0x01, 0x3B, 0x50, 0x33, 0x2A, 0x70, 0x85, 0x09, 0x30,
+    0x70, 0x81, 0x2E, 0x30, 0xA1, 0x0B, 0x9D, 0x2E, 0x26, 0x16, 0x12, 0x38, 0x84, 0x6A, 0x00, 0x75,
+    0x02, 0x05, 0x62, 0x00, 0x46, 0x25, 0x48, 0x58, 0x08, 0x96, 0x45, 0x9F, 0x01, 0x56, 0x5F, 0x06,
+    0x59, 0x10, 0x10, 0x2F, 0x46, 0x21, 0x21, 0x46, 0x6D, 0x6F, 0x6D, 0x6D, 0x2F, 0x2F, 0x10, 0x10,
+    0x2F, 0x84, 0x10, 0x81, 0x59, 0x04, 0x9B, 0x59, 0x59, 0x3A, 0x7A, 0x09, 0x16, 0x00, 0x02, 0x62,
+    0x00, 0x00, 0x03, 0x00, 0x45, 0x46, 0x84, 0x6F, 0x0E, 0x2D, 0x03, 0x16, 0x26, 0x13, 0x1F, 0x00,
+    0x13, 0x62, 0x03, 0x43, 0x1F, 0x00, 0x49, 0x8B, 0x83, 0x94, 0x14, 0x3E, 0x4D, 0x4D, 0x7D, 0x7D,
+    0x4D, 0x4D, 0x1E, 0x43, 0x7D, 0x7D, 0x4D, 0x7C, 0x31, 0x6C, 0x42, 0x19, 0x0F, 0x11, 0x67, 0x3E,
+    0x85, 0x09, 0x1E, 0x99, 0x36, 0x09, 0x99, 0x09, 0x17, 0x2D, 0x4D, 0x14, 0x14, 0x4D, 0x27, 0x5F,
+    0x14, 0x1E, 0x1E, 0x1F, 0x00, 0x01, 0x5D, 0x00, 0x02, 0x00, 0x00, 0x52, 0x6D, 0x8F, 0x74, 0x28,
+    0x00, 0x04, 0x84, 0x00, 0x80, 0x02, 0x87, 0x00, 0x0B, 0x74, 0x7F, 0x7B, 0x00, 0x00, 0x51, 0x7B,
+    0x04, 0x07, 0x00, 0x00, 0x07, 0x98, 0x00, 0x05, 0x16, 0xA0, 0x1F, 0x48, 0x01, 0x04, 0x86, 0x00,
+    0x80, 0x02, 0x82, 0x00, 0x18, 0x11, 0x64, 0x1F, 0x7B, 0x65, 0x50, 0x68, 0xA1, 0x00, 0x5A, 0x4C,
+    0x19, 0x8B, 0x09, 0x99, 0x09, 0x09, 0x99, 0x09, 0x70, 0x44, 0x50, 0x5E, 0x56, 0x0D, 0x82, 0x4C,
+    0x20, 0x68, 0x72, 0x12, 0x12, 0x92, 0x00, 0x5D, 0x02, 0x9A, 0x9A, 0x00, 0x69, 0x74, 0x02, 0x03,
+    0x13, 0x13, 0x62, 0x62, 0x05, 0x00, 0x00, 0x7F, 0x6F, 0x10, 0x6D, 0x2F, 0x46, 0x21, 0x46, 0x6D,
+    0x6F, 0x6D, 0x83, 0x2F, 0x80, 0x46, 0x81, 0x2F, 0x83, 0x10, 0x01, 0x3A, 0x7F, 0x82, 0x59, 0x02,
+    0x3A, 0x7F, 0x96, 0x22, 0x1F, 0x00, 0x01, 0x01, 0x04, 0x01, 0x03, 0x62, 0x02, 0x4E, 0x6D, 0x2F,
+    0x8E, 0xA3, 0x0E, 0x4E, 0x5F, 0x23, 0x61, 0x0B, 0x5F, 0x75, 0x0A, 0x07, 0x56, 0x76, 0x1F, 0x04,
+    0x49, 0x0C, 0x8D, 0x4A, 0x94, 0x09, 0x36, 0x82, 0x7D, 0x81, 0x17, 0x0E, 0x43, 0x89, 0x6C, 0x4D,
+    0x7D, 0x1E, 0x4D, 0x1E, 0x23, 0x35, 0x33, 0x11, 0x1D, 0x67, 0x3E, 0x84, 0x09, 0x1E, 0x4A, 0x23,
+    0x0C, 0x09, 0x8D, 0x09, 0x89, 0x36, 0x09, 0x1B, 0x7D, 0x20, 0x82, 0x14, 0x81, 0x1E, 0x61, 0x01,
+    0x00, 0x1A, 0x95, 0x04, 0x00, 0x00, 0x07, 0x86, 0x59, 0x97, 0x98, 0x02, 0x7B, 0x85, 0x00, 0x80,
+    0x02, 0x86, 0x00, 0x0C, 0x7B, 0x4E, 0x69, 0x51, 0x00, 0x00, 0x1F, 0x74, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x97, 0x00, 0x0B, 0x60, 0x29, 0x49, 0x25, 0x05, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
+    0x83, 0x00, 0x0E, 0x04, 0x00, 0x26, 0x31, 0x16, 0x07, 0x65, 0x5A, 0x2E, 0x50, 0x03, 0x90, 0x2C,
+    0x67, 0x4D, 0x84, 0x09, 0x16, 0x94, 0x57, 0x44, 0x33, 0x2E, 0x0D, 0x55, 0x40, 0x2E, 0x50, 0x5A,
+    0x4C, 0x84, 0x4C, 0x01, 0x00, 0x01, 0x7A, 0x46, 0x46, 0x69, 0x2F, 0x46, 0x83, 0x4E, 0x08, 0x95,
+    0x59, 0x74, 0x4E, 0x59, 0x2F, 0x2F, 0x6D, 0x6F, 0x82, 0x6D, 0x02, 0x6F, 0x2F, 0x6F, 0x85, 0x2F,
+    0x85, 0x10, 0x81, 0x59, 0x05, 0x3A, 0x59, 0x3A, 0x7F, 0x75, 0x05, 0x36, 0x49, 0x00, 0x01, 0x62,
+    0x02, 0x06, 0x03, 0x01, 0x00, 0x4E, 0x6D, 0x6F, 0x8E, 0x8E, 0x0E, 0x59, 0x48, 0x29, 0x2D, 0x82,
+    0x5E, 0x56, 0x04, 0x62, 0x5F, 0x36, 0x1F, 0x00, 0x01, 0x0C, 0x8D, 0x4A, 0x8D, 0x8D, 0x09, 0x1E,
+    0x81, 0x76, 0x76, 0x3E, 0x4A, 0xA0, 0x89, 0x76, 0x0C, 0x76, 0x1B, 0x3E, 0x0C, 0x35, 0x33, 0x11,
+    0x1D, 0x2C, 0x3E, 0x82, 0x09, 0x08, 0x39, 0x14, 0x1D, 0x2A, 0x36, 0x09, 0x09, 0x99, 0x6C, 0x83,
+    0x09, 0x13, 0x3F, 0x81, 0x4D, 0x23, 0x43, 0x16, 0x00, 0x00, 0x4E, 0x89, 0x51, 0x00, 0x00, 0x45,
+    0x00, 0x7F, 0x9B, 0x5D, 0x07, 0x51, 0x83, 0x00, 0x02, 0x04, 0x00, 0x02, 0x86, 0x00, 0x08, 0x75,
+    0x4E, 0x61, 0x28, 0x00, 0x00, 0x1F, 0x61, 0x51, 0x9B, 0x00, 0x81, 0x51, 0x02, 0x04, 0x01, 0x03,
+    0x85, 0x00, 0x80, 0x06, 0x84, 0x00, 0x0F, 0x01, 0x00, 0x1D, 0x6E, 0x04, 0x35, 0x20, 0x2A, 0x67,
+    0x42, 0x00, 0x35, 0x53, 0x53, 0x70, 0x99, 0x83, 0x09, 0x10, 0x57, 0x70, 0x11, 0x2E, 0x41, 0x3B,
+    0x5C, 0x6B, 0x0D, 0x4C, 0x9D, 0x2C, 0x65, 0x5D, 0x28, 0x03, 0x74, 0x87, 0x0E, 0x0D, 0x6F, 0x0E,
+    0x6D, 0x6D, 0x0E, 0x6D, 0x2F, 0x6D, 0x6D, 0x0E, 0x6D, 0x6D, 0x8E, 0x46, 0x83, 0x2F, 0x11, 0x6D,
+    0x2F, 0x69, 0x7F, 0x69, 0x10, 0x69, 0x10, 0x10, 0x3A, 0x7F, 0x69, 0x59, 0x59, 0x88, 0x04, 0x75,
+    0x62, 0x5B, 0x4F, 0x01, 0x01, 0x06, 0x00, 0x01, 0x0A, 0x07, 0x01, 0x69, 0x6D, 0x8E, 0x8E, 0x6F,
+    0x0E, 0x8E, 0x51, 0x73, 0x63, 0x00, 0x29, 0x56, 0x04, 0x08, 0x5F, 0x94, 0x1A, 0x00, 0x00, 0xA0,
+    0x94, 0x4A, 0x99, 0x94, 0x09, 0x17, 0x17, 0x94, 0x94, 0x4A, 0x8D, 0x1B, 0x89, 0x1B, 0x4A, 0x36,
+    0x36, 0x4A, 0x09, 0x43, 0x19, 0x0F, 0x1D, 0x2C, 0x83, 0x9C, 0x76, 0x31, 0x1D, 0x1D, 0x83, 0x1D,
+    0x31, 0x3E, 0x09, 0x70, 0x6C, 0x09, 0x99, 0x09, 0x23, 0x6C, 0x09, 0x94, 0x1B, 0x89, 0x07, 0x00,
+    0x45, 0x61, 0x6C, 0x1F, 0x00, 0x04, 0x02, 0x1F, 0x3A, 0x9E, 0x34, 0x00, 0x51, 0x34, 0x82, 0x00,
+    0x02, 0x04, 0x00, 0x02, 0x86, 0x00, 0x08, 0x51, 0x61, 0x46, 0x1F, 0x00, 0x00, 0x28, 0x44, 0x95,
+    0x9E, 0x00, 0x02, 0x01, 0x06, 0x01, 0x82, 0x00, 0x02, 0x01, 0x02, 0x03, 0x84, 0x00, 0x05, 0x01,
+    0x02, 0x82, 0x7E, 0x04, 0x14, 0x83, 0x09, 0x1A, 0x4E, 0x29, 0x9C, 0x24, 0x39, 0x09, 0x8D, 0x09,
+    0x8D, 0x09, 0x57, 0x99, 0x24, 0x5A, 0x7E, 0x42, 0x14, 0x6C, 0x6C, 0x64, 0x33, 0x2E, 0x41, 0x1F,
+    0x6D, 0x16, 0x5F, 0x86, 0x0E, 0x03, 0x46, 0x6F, 0x6D, 0x8E, 0x82, 0x6D, 0x80, 0x6F, 0x82, 0x6D,
+    0x81, 0x6F, 0x17, 0x6D, 0x69, 0x6F, 0x6D, 0x0E, 0x46, 0x7F, 0x7A, 0x7B, 0x02, 0x59, 0x10, 0x69,
+    0x10, 0x10, 0x59, 0x7F, 0x7F, 0x16, 0x60, 0x00, 0x07, 0x02, 0x6B, 0x20, 0x79, 0x0A, 0x03, 0x06,
+    0x07, 0x03, 0x06, 0x01, 0x00, 0x69, 0x6D, 0x6F, 0x6F, 0x8E, 0x0E, 0x0E, 0x88, 0x00, 0x07, 0x04,
+    0x49, 0x18, 0x00, 0x01, 0x2B, 0x09, 0x16, 0x02, 0x02, 0x6C, 0x4A, 0x36, 0x94, 0x82, 0x8D, 0x0F,
+    0x09, 0x4A, 0x4A, 0x8D, 0x94, 0xA0, 0x44, 0x36, 0x1B, 0x17, 0x43, 0xA0, 0x36, 0x4A, 0x7D, 0x2A,
+    0x82, 0x2C, 0x81, 0x1D, 0x21, 0x83, 0x7C, 0x31, 0x7C, 0x31, 0x1D, 0x1D, 0x31, 0x14, 0x81, 0x09,
+    0x99, 0x39, 0x42, 0x09, 0x99, 0x99, 0x09, 0x95, 0x04, 0x00, 0x25, 0x6C, 0x16, 0x00, 0x00, 0x04,
+    0x02, 0x28, 0x3A, 0x28, 0x7A, 0x5D, 0x28, 0x85, 0x00, 0x80, 0x02, 0x85, 0x00, 0x0A, 0x04, 0x5D,
+    0x4E, 0x44, 0x7A, 0x04, 0x00, 0x1F, 0x89, 0x89, 0x51, 0x9B, 0x00, 0x04, 0x07, 0x00, 0x00, 0x49,
+    0x02, 0x82, 0x00, 0x81, 0x02, 0x01, 0x62, 0x02, 0x83, 0x00, 0x0D, 0x02, 0x1F, 0x49, 0x18, 0x00,
+    0x24, 0x8D, 0x09, 0x99, 0x99, 0x09, 0x25, 0x66, 0x8D, 0x82, 0x09, 0x07, 0x99, 0x09, 0x09, 0x57,
+    0x8D, 0x81, 0x40, 0x24, 0x83, 0x09, 0x07, 0x1E, 0x2C, 0x9D, 0x78, 0x53, 0x6D, 0x4E, 0x5F, 0x83,
+    0x0E, 0x0D, 0xA3, 0x0E, 0x8E, 0x46, 0x0E, 0x0E, 0x8E, 0x6D, 0x8E, 0x2F, 0x6D, 0x0E, 0x0E, 0x6F,
+    0x82, 0x6D, 0x16, 0x6F, 0x0E, 0x59, 0x7A, 0x01, 0x02, 0x02, 0x00, 0x01, 0x69, 0x6F, 0x3A, 0x10,
+    0x3A, 0x4E, 0x7F, 0x02, 0x00, 0x04, 0x04, 0x06, 0x6A, 0x2E, 0x02, 0x86, 0x07, 0x06, 0x82, 0x03,
+    0x33, 0x01, 0x06, 0x00, 0x25, 0x0E, 0x6F, 0x8E, 0x8E, 0x0E, 0x0E, 0x7F, 0x00, 0x3D, 0x1F, 0x45,
+    0x60, 0x7B, 0x15, 0x35, 0x09, 0x95, 0x0A, 0x3C, 0x6C, 0x8D, 0x36, 0x8D, 0x09, 0x94, 0x94, 0x39,
+    0x43, 0x8B, 0x1B, 0x1E, 0x14, 0x17, 0x43, 0x14, 0x0C, 0x1E, 0x1E, 0x43, 0x17, 0x1B, 0x43, 0x14,
+    0x7D, 0x39, 0x4A, 0x9C, 0x14, 0x82, 0x31, 0x13, 0x7C, 0x31, 0x1D, 0x31, 0x0F, 0x67, 0x31, 0x7D,
+    0x30, 0x31, 0x0C, 0x4A, 0x8D, 0x44, 0x07, 0x00, 0x18, 0x89, 0x95, 0x04, 0x83, 0x00, 0x07, 0x28,
+    0x7F, 0x88, 0x9E, 0x00, 0x28, 0x00, 0x04, 0x83, 0x00, 0x80, 0x02, 0x85, 0x00, 0x0A, 0x5D, 0x00,
+    0x28, 0x4E, 0x7A, 0x51, 0x51, 0x60, 0x89, 0x44, 0x74, 0x9E, 0x00, 0x01, 0x03, 0x01, 0x82, 0x00,
+    0x03, 0x06, 0x02, 0x03, 0x02, 0x83, 0x00, 0x0E, 0x02, 0x29, 0x28, 0x02, 0x48, 0x27, 0x09, 0x8D,
+    0x09, 0x99, 0x09, 0xA0, 0x25, 0x09, 0x8D, 0x84, 0x09, 0x10, 0x39, 0x99, 0x43, 0x5A, 0x2C, 0x09,
+    0x99, 0x8D, 0x09, 0x17, 0x0F, 0x33, 0x5E, 0x50, 0x2F, 0x59, 0x26, 0x82, 0x0E, 0x03, 0xA3, 0x0E,
+    0x0E, 0x46, 0x84, 0x0E, 0x01, 0x6F, 0x6D, 0x81, 0x0E, 0x82, 0x6D, 0x18, 0x0E, 0x6F, 0x69, 0x4E,
+    0x51, 0x04, 0x04, 0x5D, 0x5D, 0x00, 0x7A, 0x8E, 0x2F, 0x59, 0x10, 0x59, 0x7F, 0x88, 0x02, 0x02,
+    0x00, 0x51, 0x2B, 0x72, 0x50, 0x3A, 0x3C, 0x01, 0x01, 0x00, 0x02, 0x01, 0x05, 0x47, 0x02, 0x1F,
+    0x8E, 0x6F, 0x6D, 0x8E, 0x8E, 0x0E, 0x46, 0x05, 0x4E, 0x0E, 0x3F, 0xA1, 0x03, 0x8C, 0x53, 0x09,
+    0x42, 0x13, 0x3B, 0x6C, 0x8D, 0x36, 0x4A, 0x94, 0x09, 0x94, 0x0C, 0x81, 0x14, 0x23, 0x42, 0x24,
+    0x43, 0x14, 0x24, 0x17, 0x43, 0x17, 0x0C, 0x36, 0x57, 0x57, 0x09, 0x09, 0x99, 0x70, 0x99, 0x4A,
+    0x4D, 0x82, 0x31, 0x10, 0x7C, 0x20, 0x31, 0x53, 0x24, 0x7C, 0x11, 0x50, 0x38, 0x33, 0x0F, 0x27,
+    0x1A, 0x04, 0x00, 0x95, 0x2D, 0x83, 0x00, 0x07, 0x02, 0x00, 0x34, 0x1F, 0x59, 0x9E, 0x00, 0x28,
+    0x85, 0x00, 0x80, 0x02, 0x85, 0x00, 0x0C, 0x28, 0x00, 0x04, 0x34, 0x5D, 0x28, 0x60, 0x60, 0x89,
+    0x44, 0x61, 0x00, 0x34, 0x9C, 0x00, 0x08, 0x03, 0x01, 0x01, 0x00, 0x00, 0x05, 0x01, 0x06, 0x01,
+    0x82, 0x00, 0x0E, 0x04, 0x00, 0x5F, 0x74, 0x01, 0x4F, 0x27, 0x99, 0x99, 0x09, 0x09, 0x3E, 0x09,
+    0x4E, 0x39, 0x82, 0x09, 0x14, 0x8D, 0x09, 0x09, 0x0C, 0x70, 0x0C, 0x40, 0x50, 0x4A, 0x09, 0x99,
+    0x09, 0x4A, 0x2C, 0x33, 0x5B, 0x55, 0x4E, 0x2F, 0x56, 0x8E, 0x83, 0x0E, 0x05, 0x46, 0x8E, 0x8E,
+    0x0E, 0x0E, 0x8E, 0x82, 0x6D, 0x81, 0x0E, 0x81, 0x6D, 0x04, 0x0E, 0x6D, 0x0E, 0x4E, 0x02, 0x82,
+    0x00, 0x11, 0x04, 0x00, 0x02, 0x69, 0x0E, 0x2F, 0x59, 0x59, 0x74, 0x59, 0x59, 0x56, 0x03, 0x63,
+    0x29, 0x35, 0x33, 0x72, 0x81, 0x48, 0x2D, 0x0A, 0x06, 0x45, 0x06, 0x00, 0x86, 0x85, 0x0A, 0x46,
+    0x8E, 0x6D, 0x8E, 0x8E, 0x0E, 0x6F, 0x46, 0x0E, 0x4E, 0x68, 0xA1, 0x4F, 0x02, 0x82, 0x09, 0xA0,
+    0x0B, 0x05, 0x6C, 0x8D, 0x36, 0x94, 0x8D, 0x94, 0x94, 0x8B, 0x14, 0x14, 0x21, 0x1E, 0x4D, 0xA0,
+    0x17, 0x0C, 0x36, 0x57, 0x36, 0x81, 0x94, 0x82, 0x8D, 0x81, 0x94, 0x04, 0x99, 0x70, 0x09, 0x09,
+    0x7D, 0x83, 0x31, 0x11, 0x7C, 0x6E, 0x24, 0x7C, 0x5E, 0x0F, 0x2C, 0x33, 0x38, 0x71, 0x02, 0x00,
+    0x63, 0x2D, 0x51, 0x04, 0x00, 0x9F, 0x84, 0x00, 0x05, 0x59, 0x7F, 0x04, 0x34, 0x00, 0x02, 0x82,
+    0x00, 0x81, 0x02, 0x84, 0x00, 0x0F, 0x01, 0x98, 0x7B, 0x7A, 0x28, 0x00, 0x00, 0x5D, 0x00, 0x4E,
+    0x46, 0x89, 0x28, 0x51, 0x00, 0x01, 0x9A, 0x00, 0x01, 0x22, 0x01, 0x82, 0x00, 0x03, 0x05, 0x07,
+    0x03, 0x01, 0x82, 0x00, 0x0E, 0x04, 0x00, 0x18, 0x16, 0x00, 0x00, 0x27, 0x09, 0x94, 0x09, 0x99,
+    0x1B, 0x09, 0x6C, 0x42, 0x85, 0x09, 0x05, 0x57, 0x36, 0x70, 0x9C, 0x66, 0x94, 0x83, 0x09, 0x07,
+    0x27, 0x12, 0x50, 0x04, 0x56, 0x6D, 0x2B, 0x46, 0x84, 0x0E, 0x80, 0xA3, 0x85, 0x0E, 0x0A, 0x6D,
+    0x0E, 0x6D, 0x6D, 0x0E, 0x6D, 0x0E, 0x6D, 0x0E, 0x69, 0x18, 0x83, 0x00, 0x0D, 0x74, 0x0E, 0x6F,
+    0x2F, 0x2F, 0x59, 0x7F, 0x6F, 0x46, 0x10, 0x69, 0x4E, 0x35, 0x59, 0x81, 0x11, 0x0B, 0x02, 0x01,
+    0x06, 0x06, 0x55, 0x4F, 0x04, 0x02, 0x55, 0x6B, 0x61, 0x0E, 0x82, 0x8E, 0x1B, 0x6D, 0x8E, 0x0E,
+    0x69, 0x00, 0x04, 0x6A, 0x0D, 0x00, 0x1A, 0x99, 0x36, 0x2A, 0x55, 0x17, 0x4A, 0x36, 0x4A, 0x4A,
+    0x94, 0x94, 0x36, 0x6C, 0x39, 0x39, 0x99, 0x4A, 0x44, 0x81, 0x1B, 0x82, 0x4A, 0x1D, 0x8D, 0x94,
+    0x94, 0x09, 0x8D, 0x8D, 0x09, 0x94, 0x8D, 0x09, 0x09, 0x0C, 0x1B, 0x3E, 0x4D, 0x83, 0x7C, 0x68,
+    0x1D, 0x20, 0x35, 0x1D, 0x33, 0x38, 0x11, 0x05, 0x00, 0x00, 0x95, 0x16, 0x88, 0x00, 0x03, 0x74,
+    0x59, 0x5D, 0x04, 0x82, 0x00, 0x80, 0x04, 0x84, 0x00, 0x80, 0x04, 0x84, 0x00, 0x0D, 0x51, 0x7A,
+    0x28, 0x49, 0x00, 0x02, 0x5D, 0x1F, 0x4E, 0x16, 0x28, 0x7B, 0x22, 0x7B, 0x89, 0x00, 0x09, 0x02,
+    0x00, 0x34, 0x5D, 0x04, 0x00, 0x00, 0x04, 0x00, 0x02, 0x85, 0x00, 0x01, 0x01, 0x06, 0x82, 0x00,
+    0x03, 0x03, 0x05, 0x07, 0x0A, 0x84, 0x00, 0x17, 0x51, 0x63, 0x63, 0x00, 0x3F, 0x09, 0x36, 0x09,
+    0x8D, 0x8B, 0x99, 0x8D, 0x16, 0x66, 0x09, 0x09, 0x99, 0x09, 0x09, 0x0C, 0x77, 0x09, 0x09, 0x8D,
+    0x82, 0x09, 0x15, 0x8D, 0x09, 0x1E, 0x72, 0x2C, 0x82, 0x06, 0x59, 0x4E, 0x61, 0x0E, 0x46, 0x8E,
+    0x2F, 0x4E, 0x74, 0x35, 0x21, 0x4E, 0x4E, 0x59, 0x69, 0x81, 0x6D, 0x83, 0x0E, 0x14, 0x6D, 0x6F,
+    0x6D, 0x0E, 0x6F, 0x95, 0x86, 0x00, 0x1F, 0x8E, 0x8E, 0x2F, 0x6F, 0x6D, 0x7F, 0x6F, 0x0E, 0x0E,
+    0x2F, 0x35, 0x6A, 0x82, 0x59, 0x80, 0x3A, 0x1E, 0x04, 0x02, 0x00, 0x9F, 0x02, 0x00, 0x47, 0x45,
+    0x00, 0x92, 0x35, 0x0E, 0x6D, 0x6F, 0x46, 0x8E, 0x0E, 0x0E, 0x28, 0x06, 0x3C, 0x00, 0x05, 0x00,
+    0x1A, 0x4A, 0x1B, 0x27, 0x13, 0xA0, 0x8D, 0x82, 0x4A, 0x82, 0x94, 0x2A, 0x39, 0x94, 0x4A, 0x8D,
+    0x4A, 0x44, 0x76, 0x1B, 0x36, 0x36, 0x94, 0x09, 0x8D, 0x94, 0x8D, 0x09, 0x99, 0x09, 0x8D, 0x09,
+    0x8D, 0x09, 0x1B, 0x94, 0x09, 0x94, 0x76, 0x7D, 0x29, 0x23, 0x2A, 0x1E, 0x7D, 0x64, 0x2C, 0x52,
+    0x00, 0x00, 0x63, 0x95, 0x00, 0x00, 0x02, 0x82, 0x00, 0x80, 0x04, 0x82, 0x00, 0x02, 0x7B, 0x28,
+    0x34, 0x85, 0x00, 0x80, 0x02, 0x85, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7B, 0x51,
+    0x5D, 0x00, 0x00, 0x7B, 0x82, 0x28, 0x0A, 0x00, 0x28, 0x00, 0x00, 0x5D, 0x07, 0x00, 0x00, 0x7B,
+    0x00, 0x04, 0x82, 0x00, 0x03, 0x5D, 0x00, 0x02, 0x04, 0x83, 0x00, 0x80, 0x34, 0x84, 0x00, 0x01,
+    0x01, 0x06, 0x82, 0x00, 0x03, 0x06, 0x08, 0x07, 0x62, 0x85, 0x00, 0x0C, 0x02, 0x3F, 0x60, 0x82,
+    0x09, 0x94, 0x8D, 0x94, 0x0C, 0x8D, 0x09, 0x3F, 0x42, 0x84, 0x09, 0x04, 0x0C, 0x1B, 0x99, 0x09,
+    0x8D, 0x82, 0x09, 0x30, 0x4A, 0x09, 0x1B, 0x33, 0x2C, 0x2C, 0x9A, 0x56, 0x1F, 0x4E, 0x0E, 0x26,
+    0x4E, 0x16, 0x02, 0x04, 0x07, 0x4C, 0x4C, 0x13, 0x00, 0x3C, 0x2B, 0x18, 0x7A, 0x74, 0x8E, 0x6F,
+    0x0E, 0x6D, 0x6D, 0x6F, 0x6D, 0x6D, 0x2F, 0x59, 0x6F, 0x0E, 0x2F, 0x2F, 0x6D, 0x2F, 0x59, 0x0E,
+    0x6D, 0x69, 0x2B, 0x0D, 0x74, 0x83, 0x59, 0x80, 0x9F, 0x82, 0x00, 0x09, 0x16, 0x74, 0x68, 0x91,
+    0x04, 0x01, 0x13, 0x29, 0x6F, 0x46, 0x82, 0x8E, 0x0F, 0x46, 0x18, 0x47, 0x71, 0x82, 0x56, 0x00,
+    0x1F, 0x4A, 0x8D, 0x29, 0x01, 0xA0, 0x8D, 0x4A, 0x36, 0x83, 0x4A, 0x06, 0x1B, 0x8D, 0x4A, 0x94,
+    0x4A, 0x44, 0x76, 0x82, 0x36, 0x01, 0x94, 0x4A, 0x82, 0x94, 0x81, 0x99, 0x84, 0x09, 0x02, 0x8B,
+    0x4A, 0x99, 0x82, 0x09, 0x0B, 0x25, 0x11, 0x27, 0x66, 0x31, 0x31, 0x42, 0x01, 0x00, 0x02, 0x16,
+    0x1C, 0x8A, 0x00, 0x02, 0x07, 0x00, 0x02, 0x84, 0x00, 0x02, 0x02, 0x00, 0x04, 0x84, 0x00, 0x19,
+    0x51, 0x07, 0x00, 0x00, 0x75, 0x00, 0x00, 0x51, 0x28, 0x7A, 0x1F, 0x28, 0x51, 0x7A, 0x00, 0x28,
+    0x28, 0x00, 0x01, 0x7B, 0x02, 0x00, 0x51, 0x98, 0x7B, 0x34, 0x82, 0x00, 0x07, 0x04, 0x5D, 0x00,
+    0x22, 0x60, 0x04, 0x00, 0x34, 0x84, 0x00, 0x01, 0x02, 0x06, 0x82, 0x00, 0x04, 0x02, 0x87, 0x01,
+    0x06, 0x01, 0x84, 0x00, 0x13, 0x02, 0x24, 0x25, 0x02, 0x89, 0x09, 0x94, 0x3E, 0x14, 0x17, 0x36,
+    0x23, 0x16, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x0C, 0x39, 0x88, 0x09, 0x0F, 0x11, 0x2E, 0x9D, 0x5E,
+    0x05, 0x3D, 0x4E, 0x6D, 0x30, 0x72, 0x12, 0x5A, 0x5D, 0x01, 0x06, 0x60, 0x82, 0x55, 0x06, 0x92,
+    0x65, 0x0D, 0x41, 0x27, 0x1E, 0x8E, 0x82, 0x6D, 0x01, 0x2F, 0x6D, 0x82, 0x0E, 0x0C, 0x89, 0x46,
+    0x6D, 0x6D, 0x59, 0x69, 0x6F, 0x46, 0x3F, 0x0D, 0x7E, 0x59, 0x9B, 0x82, 0x59, 0x1D, 0x6B, 0x1A,
+    0x00, 0x00, 0x28, 0x8E, 0x6F, 0x25, 0x51, 0x00, 0x41, 0x80, 0x46, 0x8E, 0x0E, 0x0E, 0x6F, 0x0E,
+    0x59, 0x04, 0x92, 0x55, 0x5F, 0x00, 0x56, 0x36, 0x4A, 0x43, 0x16, 0x0C, 0x84, 0x4A, 0x0C, 0x94,
+    0x4A, 0x3E, 0x94, 0x4A, 0x94, 0x4A, 0x44, 0x76, 0x36, 0x4A, 0x36, 0x4A, 0x84, 0x36, 0x16, 0x77,
+    0x36, 0x4A, 0x09, 0x8D, 0x09, 0x1B, 0x4A, 0x09, 0x8D, 0x8D, 0x09, 0x2D, 0x29, 0x39, 0x76, 0x31,
+    0x31, 0x7A, 0x00, 0x00, 0x63, 0xA1, 0x8A, 0x00, 0x03, 0x45, 0x82, 0x02, 0x7B, 0x83, 0x00, 0x81,
+    0x07, 0x80, 0x02, 0x82, 0x00, 0x24, 0x04, 0x00, 0x51, 0x4E, 0x7A, 0x00, 0x07, 0x1A, 0x01, 0x00,
+    0x00, 0x28, 0x7F, 0x7F, 0x74, 0x88, 0x88, 0x51, 0x51, 0x7A, 0x7B, 0x00, 0x98, 0x98, 0x00, 0x28,
+    0x88, 0x88, 0x5D, 0x5D, 0x00, 0x18, 0x26, 0x04, 0x34, 0x2B, 0x7E, 0x87, 0x00, 0x09, 0x04, 0x06,
+    0x02, 0x00, 0x00, 0x02, 0x3C, 0x06, 0x02, 0x01, 0x85, 0x00, 0x12, 0x11, 0x23, 0x00, 0x1F, 0x94,
+    0x8D, 0x7D, 0x53, 0x27, 0x14, 0x30, 0x60, 0x39, 0x09, 0x94, 0x8D, 0x09, 0x0C, 0x39, 0x86, 0x09,
+    0x81, 0x99, 0x1A, 0xA0, 0x5A, 0x33, 0x19, 0x7B, 0x06, 0x4E, 0x3F, 0x12, 0x38, 0x38, 0x12, 0x07,
+    0x49, 0x5A, 0x03, 0x13, 0x2E, 0x5A, 0x71, 0x4B, 0x1D, 0x14, 0x8E, 0x0E, 0x6D, 0x6F, 0x81, 0x6D,
+    0x82, 0x0E, 0x81, 0x46, 0x0D, 0x4B, 0x46, 0x6D, 0x6F, 0x4E, 0x6F, 0x6D, 0x2F, 0x2F, 0x69, 0x3A,
+    0x3A, 0x59, 0x7F, 0x81, 0x74, 0x3D, 0x5B, 0x30, 0x51, 0x00, 0x5D, 0x74, 0x0E, 0x0E, 0x2F, 0x59,
+    0x5F, 0x55, 0x6F, 0x0E, 0x8E, 0x8E, 0x6D, 0x0E, 0x46, 0x00, 0x3C, 0x03, 0x07, 0x86, 0x63, 0x36,
+    0x4A, 0x94, 0x09, 0x4A, 0x4A, 0x36, 0x4A, 0x36, 0x36, 0x4A, 0x4A, 0x36, 0x4A, 0x4A, 0x94, 0x4A,
+    0x44, 0x76, 0x3E, 0x36, 0x4A, 0x4A, 0x36, 0x8D, 0x09, 0x99, 0x70, 0x4A, 0x70, 0x39, 0x57, 0x09,
+    0x09, 0x8B, 0x0C, 0x8D, 0x82, 0x09, 0x05, 0x61, 0x16, 0x9C, 0x7C, 0x7D, 0x3F, 0x82, 0x00, 0x04,
+    0x4F, 0x01, 0x01, 0x00, 0x4F, 0x87, 0x00, 0x01, 0x01, 0x49, 0x82, 0x00, 0x04, 0x04, 0x00, 0x00,
+    0x01, 0x04, 0x83, 0x00, 0x0D, 0x04, 0x00, 0x60, 0x14, 0x61, 0x98, 0x5D, 0x01, 0x5D, 0x98, 0x98,
+    0x34, 0x7F, 0x59, 0x82, 0x7F, 0x0A, 0x88, 0x74, 0x88, 0x74, 0x28, 0x28, 0x88, 0x74, 0x88, 0x7F,
+    0x88, 0x82, 0x00, 0x07, 0x06, 0x48, 0x01, 0x28, 0x1D, 0x4E, 0x34, 0x04, 0x86, 0x00, 0x01, 0x06,
+    0x02, 0x82, 0x00, 0x02, 0x08, 0x0A, 0x02, 0x86, 0x00, 0x13, 0x6E, 0x14, 0x1A, 0x01, 0x42, 0x09,
+    0x4D, 0x21, 0x20, 0x14, 0x35, 0x62, 0x25, 0x09, 0x8D, 0x8D, 0x36, 0xA0, 0x39, 0x99, 0x85, 0x09,
+    0x08, 0x8D, 0x09, 0x1B, 0x0F, 0x67, 0x35, 0xA1, 0x03, 0x4B, 0x84, 0x38, 0x0B, 0x13, 0x02, 0x4C,
+    0x0F, 0x11, 0x21, 0x6F, 0x8E, 0x8E, 0x0E, 0x0E, 0x6D, 0x82, 0x0E, 0x16, 0x8E, 0x46, 0x59, 0x7A,
+    0x28, 0x59, 0x2F, 0x2F, 0x0E, 0x0E, 0x59, 0x59, 0x46, 0x7F, 0x59, 0x10, 0x2F, 0x59, 0x7F, 0x74,
+    0x75, 0x74, 0x2B, 0x1A, 0x42, 0x27, 0x1F, 0x00, 0x01, 0x00, 0x2D, 0x0E, 0x6F, 0x0E, 0x69, 0x74,
+    0x0E, 0x6F, 0x8E, 0x0E, 0x0E, 0x8E, 0x0E, 0x28, 0x02, 0x00, 0x49, 0x03, 0x4F, 0x1B, 0x4A, 0x81,
+    0x36, 0x82, 0x4A, 0x03, 0x36, 0x4A, 0x36, 0x4A, 0x81, 0x36, 0x82, 0x4A, 0x26, 0x36, 0x44, 0x76,
+    0x3E, 0x3E, 0x36, 0x94, 0x4A, 0x36, 0x4A, 0x99, 0x70, 0x70, 0x09, 0x09, 0x4A, 0x36, 0x09, 0x17,
+    0x6C, 0x94, 0x94, 0x8D, 0x09, 0x6C, 0x29, 0x7C, 0x7C, 0x23, 0x07, 0x02, 0x02, 0x07, 0x1C, 0x25,
+    0x7B, 0x02, 0x7E, 0x75, 0x8D, 0x00, 0x81, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x05, 0x51, 0x98,
+    0x00, 0x2D, 0x66, 0x4E, 0x82, 0x8F, 0x14, 0x88, 0x27, 0x1F, 0x28, 0x69, 0x69, 0x59, 0x4E, 0x7F,
+    0x69, 0x69, 0x59, 0x74, 0x74, 0x7F, 0x4E, 0x59, 0x7F, 0x98, 0x92, 0x1F, 0x82, 0x98, 0x07, 0x8F,
+    0x3F, 0x7C, 0x74, 0x00, 0x07, 0x5D, 0x04, 0x84, 0x00, 0x01, 0x06, 0x02, 0x82, 0x00, 0x04, 0x05,
+    0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x14, 0x04, 0x00, 0x26, 0x23, 0x35, 0x1A, 0x52, 0x17, 0x4D,
+    0x66, 0x14, 0x11, 0x35, 0x82, 0x63, 0x36, 0x09, 0x99, 0x99, 0xA0, 0x39, 0x82, 0x09, 0x80, 0x8D,
+    0x85, 0x09, 0x0D, 0x2A, 0x0D, 0x2B, 0x86, 0x87, 0x38, 0x38, 0x12, 0x38, 0x38, 0x12, 0x82, 0x74,
+    0x46, 0x86, 0x0E, 0x1B, 0x6F, 0x46, 0x8E, 0x2D, 0x74, 0x53, 0x45, 0x00, 0x7B, 0x59, 0x6D, 0x6F,
+    0x69, 0x88, 0x1F, 0x7B, 0x7A, 0x7A, 0x86, 0x16, 0x03, 0x56, 0x79, 0x82, 0x74, 0x03, 0x74, 0x5F,
+    0x1A, 0x23, 0x81, 0x52, 0x00, 0x85, 0x03, 0x01, 0x46, 0x8E, 0x2F, 0x2F, 0x8E, 0x6F, 0x0E, 0x8E,
+    0x0E, 0x8E, 0x0E, 0x0E, 0x74, 0x00, 0x52, 0x03, 0x02, 0x45, 0x1B, 0x4A, 0x82, 0x36, 0x80, 0x3E,
+    0x84, 0x36, 0x07, 0x39, 0x36, 0x36, 0x4A, 0x3E, 0x1B, 0x44, 0x0C, 0x82, 0x3E, 0x80, 0x4A, 0x82,
+    0x8D, 0x1C, 0x4A, 0x70, 0x57, 0x99, 0x99, 0x09, 0x4A, 0x36, 0x1B, 0x1B, 0x36, 0x8D, 0x99, 0x09,
+    0x89, 0x16, 0x7D, 0x43, 0x1A, 0x00, 0x01, 0x00, 0x02, 0x30, 0x42, 0x00, 0x02, 0x3F, 0x56, 0x8C,
+    0x00, 0x82, 0x02, 0x01, 0x00, 0x06, 0x82, 0x00, 0x81, 0x88, 0x2D, 0x34, 0x28, 0x23, 0x7D, 0x14,
+    0x2D, 0x23, 0x7C, 0x7D, 0x61, 0x7A, 0x7F, 0x44, 0x46, 0x69, 0x59, 0x46, 0x46, 0x89, 0x4E, 0x59,
+    0x46, 0x69, 0x69, 0x8F, 0x26, 0x2A, 0x14, 0x2D, 0x88, 0x88, 0x61, 0x7C, 0x23, 0x28, 0x00, 0x98,
+    0x98, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x02, 0x82, 0x00, 0x04, 0x05, 0x87, 0x07, 0x00,
+    0x02, 0x85, 0x00, 0x11, 0x35, 0x19, 0x5F, 0x16, 0x25, 0x9C, 0x36, 0x20, 0x50, 0x21, 0x2D, 0x45,
+    0x23, 0x09, 0x36, 0x09, 0x0C, 0x39, 0x83, 0x09, 0x81, 0x99, 0x07, 0x70, 0x39, 0xA0, 0x89, 0x35,
+    0x4B, 0x52, 0x85, 0x83, 0x38, 0x03, 0x12, 0x4B, 0x59, 0x6D, 0x83, 0x0E, 0x20, 0x8E, 0x0E, 0x6F,
+    0x1E, 0x14, 0x1E, 0x1E, 0x89, 0x61, 0x53, 0x01, 0x00, 0x07, 0x4E, 0x0E, 0x2F, 0x6D, 0x2F, 0x4E,
+    0x60, 0x00, 0x22, 0x1A, 0x01, 0x7F, 0x1F, 0x00, 0x02, 0x5F, 0x7A, 0x00, 0x34, 0x00, 0x0B, 0x1E,
+    0x6C, 0x25, 0x00, 0x0A, 0x2E, 0x04, 0x18, 0x6F, 0x6F, 0x2F, 0x6F, 0x81, 0x8E, 0x82, 0x0E, 0x0C,
+    0x6D, 0x0E, 0x7F, 0x07, 0x35, 0x07, 0x00, 0x45, 0x8B, 0x4A, 0x36, 0x36, 0x1B, 0x83, 0x36, 0x2D,
+    0x3E, 0x36, 0x39, 0x36, 0x36, 0x4A, 0x3E, 0x36, 0x44, 0x0C, 0x3E, 0x3E, 0x1B, 0x36, 0x4A, 0x8D,
+    0x4A, 0x1B, 0x77, 0x57, 0x09, 0x8D, 0x94, 0x8D, 0x99, 0x77, 0x36, 0x09, 0x09, 0x99, 0x09, 0x4E,
+    0x0A, 0x9C, 0x25, 0x00, 0x18, 0x18, 0x00, 0x5F, 0x4D, 0x11, 0x07, 0x00, 0x3F, 0x1A, 0x8D, 0x00,
+    0x03, 0x01, 0x07, 0x00, 0x01, 0x82, 0x00, 0x2F, 0x88, 0x7F, 0x28, 0x7B, 0x28, 0x4E, 0x89, 0x1E,
+    0x43, 0x8E, 0x46, 0x10, 0x3A, 0x69, 0x44, 0x44, 0x46, 0x46, 0x44, 0x57, 0x57, 0x44, 0x46, 0x6C,
+    0x46, 0x59, 0x7F, 0x46, 0x89, 0x1E, 0x4D, 0x7C, 0x7C, 0x31, 0x42, 0x88, 0x5D, 0x98, 0x88, 0x28,
+    0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x02, 0x82, 0x00, 0x04, 0x05, 0x87, 0x07, 0x01, 0x02,
+    0x82, 0x00, 0x0C, 0x07, 0x00, 0x00, 0x73, 0x6A, 0x5F, 0xA1, 0x29, 0x43, 0x8D, 0x27, 0x50, 0x31,
+    0x82, 0x25, 0x0A, 0x4A, 0x09, 0x09, 0x0C, 0x39, 0x09, 0x36, 0x2D, 0x20, 0x4A, 0x23, 0x82, 0x53,
+    0x03, 0x3F, 0x1D, 0x35, 0x55, 0x84, 0x38, 0x01, 0x59, 0x10, 0x82, 0x6D, 0x81, 0x46, 0x04, 0x6F,
+    0x21, 0x8E, 0x1E, 0x8E, 0x83, 0x0E, 0x18, 0x25, 0x04, 0x62, 0x92, 0x55, 0x0A, 0x7F, 0x0E, 0x6D,
+    0x6D, 0x0E, 0x0E, 0x59, 0x1F, 0x69, 0x59, 0x69, 0x6F, 0x7F, 0x60, 0x56, 0x28, 0x00, 0x01, 0x03,
+    0x81, 0x1E, 0x18, 0x3F, 0x00, 0x00, 0x80, 0x2C, 0x02, 0x1A, 0x0E, 0x6F, 0x6F, 0x8E, 0x0E, 0x6D,
+    0x8E, 0x8E, 0x0E, 0x0E, 0x59, 0x04, 0x0B, 0x0B, 0x04, 0x22, 0x0C, 0x8D, 0x81, 0x36, 0x81, 0x1B,
+    0x82, 0x36, 0x2D, 0x77, 0x3E, 0x1B, 0x77, 0x3E, 0x36, 0x36, 0x4A, 0x44, 0x0C, 0x3E, 0x1B, 0x1B,
+    0x39, 0x4A, 0x09, 0x1B, 0x0C, 0x8D, 0x4A, 0x09, 0x09, 0x99, 0x09, 0x09, 0x36, 0x8D, 0x09, 0x09,
+    0x8D, 0x09, 0x25, 0x00, 0x25, 0x75, 0x00, 0x2D, 0x60, 0x01, 0x21, 0x66, 0x25, 0x16, 0x00, 0x1F,
+    0x75, 0x8D, 0x00, 0x12, 0x01, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x74, 0x59, 0x7F, 0x7A, 0x98,
+    0x98, 0x8F, 0x9E, 0x7F, 0x59, 0x59, 0x46, 0x84, 0x44, 0x04, 0x57, 0x77, 0x70, 0x70, 0x57, 0x84,
+    0x44, 0x81, 0x46, 0x12, 0x69, 0x59, 0x4E, 0x7F, 0x74, 0x7A, 0x5D, 0x98, 0x88, 0x9E, 0x88, 0x00,
+    0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x48, 0x58, 0x05, 0x84, 0x00, 0x28,
+    0x06, 0x00, 0x00, 0x04, 0x58, 0x5E, 0x60, 0x6E, 0x42, 0x36, 0x4B, 0x33, 0x31, 0x16, 0xA0, 0x25,
+    0x42, 0x09, 0x09, 0x0C, 0x39, 0x09, 0x77, 0x2B, 0x4C, 0x76, 0x42, 0x71, 0x30, 0x2B, 0x2B, 0x5F,
+    0x4F, 0x0D, 0x72, 0x38, 0x38, 0x67, 0x10, 0x10, 0x2F, 0x81, 0x6D, 0x81, 0x46, 0x81, 0x8E, 0x85,
+    0x0E, 0x1A, 0x8E, 0x35, 0x03, 0x22, 0x5C, 0x41, 0x79, 0x91, 0x28, 0x0E, 0x6D, 0x6F, 0x8E, 0x8E,
+    0x0E, 0x6F, 0x59, 0x6D, 0x2F, 0x46, 0x2F, 0x46, 0x74, 0x03, 0x00, 0x00, 0x07, 0x0D, 0x14, 0x1E,
+    0x23, 0x02, 0x00, 0x01, 0x83, 0x1F, 0x00, 0x4E, 0x0E, 0x6F, 0x8E, 0x6D, 0x81, 0x8E, 0x82, 0x0E,
+    0x0D, 0x69, 0x00, 0x5C, 0x15, 0x00, 0x01, 0x89, 0x1B, 0x39, 0x36, 0x1B, 0x3E, 0x36, 0x77, 0x81,
+    0x3E, 0x82, 0x36, 0x17, 0x1B, 0x70, 0x36, 0x1B, 0x57, 0x0C, 0x1B, 0x3E, 0x1B, 0x0C, 0x6C, 0x1B,
+    0x8D, 0x09, 0x99, 0x4A, 0x8D, 0x09, 0x99, 0x8D, 0x8D, 0x36, 0x8D, 0x99, 0x82, 0x09, 0x0D, 0x89,
+    0x00, 0x07, 0x02, 0x7E, 0x2D, 0x00, 0x26, 0x4D, 0x1E, 0x52, 0x4F, 0x22, 0x02, 0x8D, 0x00, 0x80,
+    0x01, 0x81, 0x02, 0x83, 0x00, 0x0C, 0x51, 0x7F, 0x46, 0x69, 0x7F, 0x9E, 0x9E, 0x7F, 0x7F, 0x59,
+    0x69, 0x89, 0x44, 0x84, 0x57, 0x80, 0x77, 0x82, 0x70, 0x80, 0x77, 0x82, 0x57, 0x82, 0x44, 0x0B,
+    0x46, 0x69, 0x7F, 0x7F, 0x9E, 0x8F, 0x8F, 0x88, 0x88, 0x7F, 0x59, 0x7A, 0x83, 0x00, 0x02, 0x06,
+    0x00, 0x04, 0x83, 0x00, 0x03, 0x03, 0x58, 0x96, 0x02, 0x83, 0x00, 0x2B, 0x06, 0x34, 0x47, 0x03,
+    0x04, 0x5E, 0x6E, 0x29, 0x27, 0x17, 0x27, 0x11, 0x17, 0x16, 0x0C, 0x3F, 0x18, 0x99, 0x09, 0x0C,
+    0x39, 0x09, 0x70, 0x4B, 0x33, 0x20, 0x42, 0x40, 0x80, 0x35, 0x21, 0x91, 0x00, 0x5A, 0x2E, 0x5A,
+    0x4E, 0x10, 0x10, 0x46, 0x1E, 0x64, 0x38, 0x61, 0x88, 0x0E, 0x1A, 0x2B, 0x6B, 0x5B, 0x71, 0x75,
+    0x00, 0x55, 0x8C, 0x00, 0x74, 0x0E, 0x6D, 0x6F, 0x46, 0x2F, 0x46, 0x46, 0x59, 0x69, 0x95, 0x69,
+    0x2F, 0x4E, 0x74, 0x16, 0x02, 0x00, 0x0C, 0x31, 0x1E, 0x89, 0x45, 0x00, 0x5D, 0x37, 0x07, 0x00,
+    0x00, 0x69, 0x0E, 0x8E, 0x83, 0x0E, 0x3C, 0x6D, 0x0E, 0x46, 0x00, 0x15, 0x5C, 0x02, 0x02, 0xA0,
+    0x09, 0x36, 0x4A, 0x94, 0x8D, 0x8D, 0x70, 0x3E, 0x57, 0x57, 0x8B, 0x0C, 0x39, 0x1B, 0x1B, 0x36,
+    0x57, 0x39, 0x1B, 0x1B, 0x76, 0x39, 0x0C, 0x0C, 0x36, 0x4A, 0x8D, 0x4A, 0x09, 0x8D, 0x8D, 0x99,
+    0x09, 0x36, 0x8D, 0x09, 0x99, 0x99, 0x09, 0xA0, 0x5D, 0x00, 0x03, 0x2D, 0x60, 0x00, 0x30, 0x27,
+    0x29, 0x86, 0x3F, 0x1A, 0x8E, 0x00, 0x80, 0x01, 0x85, 0x00, 0x0C, 0x18, 0x4E, 0x44, 0x44, 0x2F,
+    0x46, 0x69, 0x69, 0x46, 0x46, 0x44, 0x44, 0x57, 0x82, 0x77, 0x18, 0x70, 0x77, 0x77, 0x70, 0x70,
+    0x77, 0x77, 0x57, 0x57, 0x77, 0x77, 0x57, 0x57, 0x44, 0x44, 0x46, 0x69, 0x59, 0x7F, 0x7F, 0x9B,
+    0x59, 0x69, 0x69, 0x7A, 0x83, 0x00, 0x80, 0x03, 0x85, 0x00, 0x03, 0x03, 0x58, 0x3B, 0x01, 0x83,
+    0x00, 0x2A, 0x04, 0x00, 0x73, 0x52, 0x00, 0x55, 0x20, 0x26, 0x2D, 0x23, 0x7D, 0x66, 0x0C, 0x28,
+    0x09, 0x25, 0x16, 0x99, 0x09, 0x0C, 0x0C, 0x09, 0x70, 0x53, 0x72, 0x64, 0x2D, 0x5A, 0x27, 0x81,
+    0x2C, 0x50, 0x51, 0x13, 0x4C, 0x3F, 0x2F, 0x14, 0x64, 0x38, 0x7C, 0x33, 0x61, 0x84, 0x0E, 0x14,
+    0xA3, 0x0E, 0x0E, 0x8E, 0x82, 0x05, 0x1C, 0x91, 0x01, 0x00, 0x96, 0x73, 0x06, 0x01, 0x00, 0x74,
+    0x46, 0x4E, 0x69, 0x59, 0x46, 0x83, 0x2F, 0x06, 0x10, 0x6D, 0x4E, 0x59, 0x2F, 0x59, 0x7A, 0x0B,
+    0x14, 0x1E, 0x0C, 0x52, 0x00, 0x5D, 0x49, 0x07, 0x00, 0x00, 0x18, 0x8E, 0x84, 0x0E, 0x3C, 0x6D,
+    0x0E, 0x46, 0x01, 0x13, 0x41, 0x9F, 0x02, 0x25, 0x61, 0xA0, 0x89, 0x3F, 0x95, 0x25, 0x2C, 0x53,
+    0x1F, 0x56, 0x55, 0x51, 0x51, 0x49, 0x23, 0x4A, 0x39, 0x39, 0x76, 0x3E, 0x76, 0x39, 0x39, 0x1B,
+    0x1B, 0x4A, 0x0C, 0x36, 0x4A, 0x4A, 0x8D, 0x8D, 0x09, 0x36, 0x4A, 0x09, 0x8D, 0x09, 0x09, 0xA0,
+    0x01, 0x00, 0x45, 0x52, 0x00, 0x07, 0x5F, 0x3F, 0x3F, 0x62, 0x21, 0x7E, 0x8E, 0x00, 0x80, 0x02,
+    0x85, 0x00, 0x01, 0x18, 0x59, 0x86, 0x44, 0x82, 0x57, 0x80, 0x77, 0x83, 0x70, 0x81, 0x77, 0x83,
+    0x70, 0x81, 0x57, 0x0A, 0x77, 0x70, 0x70, 0x77, 0x57, 0x57, 0x44, 0x44, 0x46, 0x46, 0x69, 0x83,
+    0x46, 0x06, 0x7A, 0x00, 0x04, 0x00, 0x00, 0x62, 0x02, 0x84, 0x00, 0x03, 0x01, 0x58, 0x3B, 0x06,
+    0x84, 0x00, 0x1A, 0x03, 0x48, 0x11, 0x18, 0x02, 0x0F, 0x24, 0x25, 0x23, 0x17, 0x8D, 0x2D, 0x1A,
+    0x09, 0x2D, 0x36, 0x09, 0x09, 0x39, 0x0C, 0x99, 0x8D, 0x53, 0x50, 0x24, 0x2D, 0x2E, 0x82, 0x33,
+    0x0A, 0x4B, 0x7B, 0x65, 0x27, 0x21, 0x38, 0x84, 0x7C, 0x38, 0x19, 0x46, 0x82, 0x0E, 0x80, 0x8E,
+    0x83, 0x0E, 0x12, 0x8E, 0x7A, 0x00, 0x02, 0x00, 0x02, 0x7B, 0x60, 0x29, 0x1F, 0x51, 0x18, 0x60,
+    0x74, 0x0E, 0x6D, 0x0E, 0x8E, 0x6F, 0x85, 0x2F, 0x81, 0x4E, 0x81, 0x10, 0x80, 0x2F, 0x0D, 0x1E,
+    0x4D, 0x66, 0x25, 0x00, 0x7B, 0x45, 0x49, 0x00, 0x00, 0x04, 0x4E, 0x0E, 0x8E, 0x84, 0x0E, 0x11,
+    0x46, 0x86, 0x03, 0x08, 0x00, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x02, 0x00, 0x2E, 0x2E, 0x48,
+    0x32, 0x0D, 0x82, 0x00, 0x05, 0x2D, 0x8D, 0x0C, 0x39, 0x1B, 0x36, 0x82, 0x1B, 0x06, 0x3E, 0x39,
+    0x36, 0x4A, 0x36, 0x36, 0x8D, 0x82, 0x09, 0x12, 0x4A, 0x94, 0x99, 0x99, 0x09, 0x99, 0x1A, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0x18, 0x42, 0x23, 0x3F, 0x18, 0x14, 0x26, 0x8E, 0x00, 0x80, 0x02, 0x81,
+    0x00, 0x82, 0x02, 0x05, 0x00, 0x75, 0x61, 0x44, 0xA3, 0x0E, 0x84, 0x57, 0x81, 0x77, 0x83, 0x70,
+    0x0B, 0x77, 0x57, 0x77, 0x70, 0x70, 0x77, 0x57, 0x57, 0x77, 0x70, 0x77, 0x70, 0x82, 0x77, 0x81,
+    0x57, 0x84, 0x44, 0x81, 0x46, 0x06, 0x7A, 0x34, 0x07, 0x01, 0x00, 0x0A, 0x01, 0x84, 0x00, 0x03,
+    0x01, 0x3C, 0x3B, 0x48, 0x84, 0x00, 0x22, 0x48, 0x02, 0x11, 0x3F, 0x00, 0x13, 0x31, 0x2D, 0x23,
+    0x23, 0x3E, 0x16, 0x2D, 0x36, 0x23, 0x09, 0x8D, 0x09, 0x0C, 0x0C, 0x09, 0x99, 0x6E, 0x50, 0x2A,
+    0x7D, 0x24, 0xA0, 0x0C, 0x1E, 0x28, 0x2E, 0x38, 0x38, 0x12, 0x82, 0x38, 0x03, 0x52, 0x69, 0x0E,
+    0x8E, 0x83, 0x0E, 0x81, 0x8E, 0x10, 0x0E, 0x7A, 0x02, 0x7A, 0x74, 0x4E, 0x59, 0x46, 0x69, 0x46,
+    0x46, 0x8E, 0x69, 0x8E, 0x0E, 0x0E, 0x6D, 0x81, 0x46, 0x81, 0x69, 0x82, 0x46, 0x04, 0x69, 0x2F,
+    0x7A, 0x3F, 0x10, 0x81, 0x69, 0x06, 0x1E, 0x4D, 0x66, 0x61, 0x00, 0x02, 0x07, 0x83, 0x00, 0x01,
+    0x60, 0x8E, 0x85, 0x0E, 0x02, 0x6F, 0x52, 0x75, 0x82, 0x00, 0x03, 0x01, 0x00, 0x1A, 0x60, 0x82,
+    0x00, 0x2D, 0x32, 0x5A, 0x54, 0x92, 0x9A, 0x00, 0x07, 0x00, 0x42, 0x94, 0x0C, 0x39, 0x1B, 0x3E,
+    0x1B, 0x3E, 0x1B, 0x3E, 0x39, 0x1B, 0x0C, 0x1B, 0x09, 0x4A, 0x8D, 0x09, 0x09, 0x1B, 0x36, 0x09,
+    0x99, 0x09, 0x61, 0x00, 0x7E, 0x25, 0x00, 0x00, 0x06, 0x03, 0x42, 0x2D, 0x16, 0x29, 0x2D, 0x01,
+    0x90, 0x00, 0x81, 0x01, 0x04, 0x06, 0x03, 0x00, 0x00, 0x2D, 0x81, 0x44, 0x84, 0x57, 0x81, 0x77,
+    0x84, 0x70, 0x80, 0x77, 0x82, 0x57, 0x05, 0x77, 0x57, 0x57, 0x44, 0x57, 0x70, 0x84, 0x77, 0x82,
+    0x57, 0x84, 0x44, 0x07, 0x69, 0x88, 0x00, 0x48, 0x00, 0x04, 0x0A, 0x01, 0x85, 0x00, 0x02, 0x08,
+    0x87, 0x0A, 0x84, 0x00, 0x1E, 0x03, 0x02, 0x68, 0x1E, 0x52, 0x00, 0x19, 0x43, 0x30, 0x42, 0x1E,
+    0x60, 0x17, 0x6C, 0x0C, 0x09, 0x99, 0x09, 0x39, 0x0C, 0x99, 0x70, 0x6E, 0x4C, 0x0F, 0x0C, 0x76,
+    0x3E, 0x1B, 0x16, 0x65, 0x84, 0x38, 0x05, 0x12, 0x2B, 0x10, 0x0E, 0x0E, 0x8E, 0x83, 0x0E, 0x20,
+    0x8E, 0x1E, 0x46, 0x69, 0x46, 0x0E, 0x0E, 0x6F, 0x6F, 0x46, 0x46, 0x8E, 0x0E, 0x59, 0x2B, 0x61,
+    0x6F, 0x8E, 0x0E, 0x6F, 0x6F, 0x2F, 0x6F, 0x46, 0x74, 0x16, 0x7F, 0x59, 0x5F, 0x69, 0x69, 0x10,
+    0x69, 0x04, 0x1E, 0x17, 0x66, 0x6C, 0x60, 0x86, 0x00, 0x0B, 0x61, 0x0E, 0x8E, 0x0E, 0x0E, 0x8E,
+    0x0E, 0x2F, 0x30, 0x60, 0x00, 0x04, 0x82, 0x00, 0x01, 0x18, 0x16, 0x83, 0x00, 0x29, 0x0B, 0x08,
+    0x96, 0x48, 0x02, 0x01, 0x00, 0x2D, 0x4A, 0x39, 0x39, 0x1B, 0x36, 0x3E, 0x1B, 0x1B, 0x3E, 0x39,
+    0x1B, 0x43, 0x17, 0x36, 0x4A, 0x8D, 0x8D, 0x09, 0x1B, 0x36, 0x09, 0x09, 0x36, 0x18, 0x01, 0x23,
+    0x1A, 0x00, 0x00, 0x01, 0x00, 0x29, 0x23, 0x00, 0x81, 0x3F, 0x82, 0x00, 0x80, 0x07, 0x8D, 0x00,
+    0x06, 0x01, 0x00, 0x06, 0x3D, 0x00, 0x00, 0x4E, 0x81, 0x44, 0x82, 0x57, 0x82, 0x77, 0x85, 0x70,
+    0x80, 0x77, 0x87, 0x57, 0x81, 0x70, 0x84, 0x77, 0x81, 0x57, 0x80, 0x0E, 0x83, 0x44, 0x07, 0x69,
+    0x7A, 0x00, 0x79, 0x00, 0x01, 0x08, 0x01, 0x85, 0x00, 0x02, 0x08, 0x87, 0x08, 0x84, 0x00, 0x1D,
+    0x75, 0x00, 0x26, 0x1E, 0x2D, 0x00, 0x13, 0x4D, 0x23, 0x30, 0x52, 0x1A, 0x36, 0x25, 0x8D, 0x8D,
+    0x99, 0x09, 0x39, 0x8B, 0x09, 0x70, 0x7E, 0x5B, 0x0F, 0x8B, 0x7D, 0x4A, 0x95, 0x03, 0x84, 0x38,
+    0x01, 0x12, 0x95, 0x83, 0x0E, 0x81, 0xA3, 0x84, 0x0E, 0x0C, 0x8E, 0x0E, 0x8E, 0x6F, 0x61, 0x61,
+    0x8E, 0x6F, 0x8E, 0x6F, 0x6D, 0x69, 0x6F, 0x83, 0x0E, 0x0D, 0x8E, 0x6D, 0x2F, 0x6F, 0x29, 0x2B,
+    0x5B, 0x13, 0x0B, 0x79, 0x46, 0x3A, 0x59, 0x69, 0x0D, 0x4D, 0x17, 0x43, 0x0C, 0x25, 0x00, 0x00,
+    0x5D, 0x00, 0x00, 0x04, 0x01, 0x16, 0xA3, 0x84, 0x0E, 0x04, 0x10, 0x35, 0x1F, 0x00, 0x04, 0x82,
+    0x00, 0x10, 0x22, 0x3F, 0x75, 0x00, 0x00, 0x04, 0x0A, 0x13, 0x08, 0x87, 0x05, 0x00, 0x00, 0x2D,
+    0x8D, 0x39, 0x1B, 0x83, 0x3E, 0x83, 0x1B, 0x04, 0x39, 0x43, 0x0C, 0x3E, 0x8D, 0x83, 0x36, 0x81,
+    0x09, 0x0D, 0x25, 0x00, 0x2D, 0x18, 0x00, 0x4F, 0x63, 0x04, 0x00, 0x22, 0x2D, 0x07, 0x23, 0x30,
+    0x82, 0x00, 0x01, 0x63, 0x22, 0x89, 0x00, 0x0C, 0x01, 0x02, 0x02, 0x03, 0x00, 0x05, 0x1C, 0x00,
+    0x04, 0x74, 0x44, 0x44, 0x57, 0x82, 0x77, 0x87, 0x70, 0x83, 0x77, 0x80, 0x70, 0x82, 0x57, 0x82,
+    0x77, 0x80, 0x70, 0x82, 0x77, 0x03, 0x70, 0x57, 0x57, 0x3A, 0x83, 0x44, 0x07, 0x59, 0x28, 0x06,
+    0x55, 0x00, 0x07, 0x08, 0x01, 0x85, 0x00, 0x03, 0x08, 0x32, 0x08, 0x01, 0x82, 0x00, 0x1E, 0x01,
+    0x02, 0x04, 0x37, 0x31, 0x1E, 0x1A, 0x00, 0x0F, 0x36, 0x4E, 0x3D, 0x2D, 0x6C, 0x23, 0x09, 0x09,
+    0x99, 0x09, 0x39, 0x8B, 0x09, 0x70, 0x6E, 0x5E, 0x19, 0x17, 0x1B, 0x95, 0x02, 0x72, 0x83, 0x38,
+    0x04, 0x2E, 0x59, 0x0E, 0x0E, 0x8E, 0x83, 0x0E, 0x80, 0xA3, 0x84, 0x0E, 0x80, 0x8E, 0x81, 0x46,
+    0x81, 0x8E, 0x81, 0x46, 0x82, 0x6F, 0x83, 0x0E, 0x81, 0x8E, 0x0D, 0x0E, 0x46, 0x2F, 0x69, 0x7E,
+    0x3F, 0x53, 0x2B, 0x26, 0x13, 0x29, 0x46, 0x3A, 0x59, 0x05, 0x17, 0x0C, 0x17, 0x17, 0x66, 0x1A,
+    0x84, 0x00, 0x02, 0x04, 0x00, 0x46, 0x82, 0x0E, 0x3B, 0x6D, 0x0E, 0x10, 0x30, 0x29, 0x00, 0x5D,
+    0x00, 0x00, 0x01, 0x02, 0x4E, 0x1A, 0x00, 0x00, 0x05, 0x4F, 0x02, 0x03, 0x08, 0x05, 0x07, 0x00,
+    0x3F, 0x94, 0x39, 0x1B, 0x36, 0x36, 0x3E, 0x1B, 0x1B, 0x3E, 0x1B, 0x39, 0x1B, 0x43, 0x39, 0x1B,
+    0x3E, 0x4A, 0x94, 0x3E, 0x36, 0x09, 0xA0, 0x00, 0x16, 0x16, 0x00, 0x18, 0x29, 0x18, 0x02, 0x00,
+    0x00, 0x45, 0x49, 0x2D, 0x1F, 0x82, 0x00, 0x01, 0x30, 0x1A, 0x89, 0x00, 0x0D, 0x02, 0x00, 0x00,
+    0x06, 0x00, 0x05, 0x3D, 0x04, 0x00, 0x16, 0x89, 0x44, 0xA3, 0x57, 0x81, 0x77, 0x82, 0x70, 0x04,
+    0x4A, 0x70, 0x70, 0x99, 0x70, 0x83, 0x77, 0x81, 0x70, 0x81, 0x77, 0x80, 0x57, 0x85, 0x70, 0x03,
+    0x77, 0x57, 0x57, 0x10, 0x82, 0x44, 0x08, 0x89, 0x7F, 0x34, 0x05, 0x80, 0x00, 0x01, 0x86, 0x02,
+    0x85, 0x00, 0x24, 0x62, 0x08, 0x08, 0x05, 0x02, 0x00, 0x00, 0x5D, 0x03, 0x07, 0x00, 0x20, 0x17,
+    0x2D, 0x00, 0xA1, 0x3E, 0x89, 0x00, 0x89, 0x4E, 0x4A, 0x09, 0x99, 0x99, 0x09, 0x39, 0x39, 0x09,
+    0x36, 0x6E, 0x2B, 0x78, 0x66, 0x25, 0x00, 0x90, 0x83, 0x38, 0x03, 0x4C, 0x59, 0x0E, 0xA3, 0x81,
+    0x8E, 0x87, 0x0E, 0x83, 0x8E, 0x05, 0x46, 0x61, 0x69, 0x6F, 0x0E, 0x6F, 0x81, 0x0E, 0x84, 0x8E,
+    0x81, 0x46, 0x0C, 0x59, 0x2F, 0x69, 0x69, 0x4E, 0x50, 0x4B, 0x53, 0x55, 0x2E, 0x5F, 0x59, 0x69,
+    0x81, 0x17, 0x0B, 0x0C, 0x8B, 0x76, 0x8B, 0x3F, 0x00, 0x34, 0x02, 0x00, 0x04, 0x4F, 0x4E, 0x83,
+    0x0E, 0x1D, 0x6D, 0x10, 0x2D, 0x30, 0x00, 0x5D, 0x00, 0x01, 0x01, 0x00, 0x2D, 0x1F, 0x00, 0x04,
+    0x06, 0x45, 0x22, 0x00, 0x03, 0x45, 0x04, 0x01, 0x42, 0x4A, 0x39, 0x1B, 0x3E, 0x36, 0x1B, 0x3E,
+    0x83, 0x1B, 0x12, 0x3E, 0x0C, 0x39, 0x1B, 0x3E, 0x36, 0x3E, 0x3E, 0x4A, 0x4A, 0x1A, 0x7B, 0x1A,
+    0x60, 0x00, 0x89, 0x23, 0x4F, 0x02, 0x82, 0x00, 0x05, 0x22, 0x1A, 0x02, 0x00, 0x00, 0x02, 0x81,
+    0x42, 0x89, 0x00, 0x0E, 0x02, 0x00, 0x00, 0x06, 0x01, 0x0A, 0x1C, 0x01, 0x00, 0x1F, 0x89, 0x44,
+    0x44, 0x57, 0x77, 0x83, 0x70, 0x05, 0x99, 0x70, 0x99, 0x70, 0x70, 0x57, 0x81, 0x77, 0x82, 0x70,
+    0x82, 0x57, 0x86, 0x70, 0x02, 0x57, 0x77, 0x0E, 0x82, 0x44, 0x08, 0x46, 0x88, 0x00, 0x37, 0x6A,
+    0x00, 0x01, 0x86, 0x01, 0x85, 0x00, 0x04, 0x62, 0x0A, 0x08, 0x08, 0x01, 0x82, 0x00, 0x21, 0x86,
+    0x91, 0x00, 0x30, 0x4D, 0x6C, 0x1F, 0x04, 0x43, 0x3F, 0x07, 0x1A, 0x23, 0x09, 0x94, 0x09, 0x99,
+    0x99, 0x1B, 0x0C, 0x4A, 0x77, 0x6E, 0x68, 0x53, 0x7E, 0x06, 0x04, 0x12, 0x38, 0x38, 0x72, 0x29,
+    0x2F, 0x82, 0x0E, 0x81, 0x8E, 0x83, 0x0E, 0x23, 0xA3, 0x0E, 0xA3, 0x43, 0xA3, 0x89, 0x61, 0x61,
+    0x46, 0x6D, 0x0E, 0x6F, 0x4E, 0x26, 0x7A, 0x59, 0x0E, 0x8E, 0x0E, 0x6F, 0x8E, 0x6D, 0x42, 0x30,
+    0x6F, 0x69, 0x2F, 0x16, 0x5A, 0x11, 0x53, 0x71, 0x80, 0x13, 0x06, 0x16, 0x80, 0x6C, 0x82, 0x0C,
+    0x81, 0x8B, 0x08, 0x0C, 0x45, 0x00, 0x63, 0x60, 0x01, 0x86, 0x28, 0x0E, 0x82, 0x6D, 0x35, 0x0E,
+    0x69, 0x2D, 0x23, 0x00, 0x07, 0x00, 0x04, 0x5D, 0x88, 0x3F, 0x02, 0x00, 0x51, 0x16, 0x02, 0x00,
+    0x04, 0x02, 0x01, 0x04, 0x16, 0x17, 0x39, 0x1B, 0x1B, 0x3E, 0x36, 0x3E, 0x1B, 0x1B, 0x3E, 0x1B,
+    0x1B, 0x3E, 0x8B, 0x39, 0x1B, 0x3E, 0x36, 0x3E, 0x0C, 0x36, 0x61, 0x00, 0x00, 0x52, 0x29, 0x95,
+    0x09, 0x3E, 0x7E, 0x01, 0x02, 0x82, 0x00, 0x07, 0x60, 0x00, 0x00, 0x04, 0x45, 0x14, 0x27, 0x63,
+    0x88, 0x00, 0x0D, 0x06, 0x00, 0x00, 0x02, 0x00, 0x48, 0x08, 0x03, 0x04, 0x49, 0x2D, 0x44, 0x44,
+    0x57, 0x81, 0x77, 0x82, 0x70, 0x83, 0x99, 0x0B, 0x70, 0x44, 0x44, 0x57, 0x77, 0x77, 0x57, 0x57,
+    0x44, 0x44, 0x70, 0x99, 0x83, 0x70, 0x81, 0x77, 0x81, 0x57, 0x81, 0x44, 0x09, 0x89, 0x59, 0x7B,
+    0x00, 0xA1, 0x26, 0x00, 0x01, 0x86, 0x01, 0x85, 0x00, 0x04, 0x03, 0x0A, 0x08, 0x08, 0x03, 0x82,
+    0x00, 0x1F, 0x06, 0x3B, 0x00, 0x2B, 0x7D, 0x43, 0x25, 0x00, 0x25, 0x45, 0x95, 0x1A, 0x0C, 0x70,
+    0x70, 0x94, 0x8D, 0x4A, 0x39, 0x0C, 0x77, 0x77, 0x6E, 0x71, 0x96, 0x92, 0x4F, 0x5A, 0x38, 0x38,
+    0x4C, 0x25, 0x83, 0x0E, 0x80, 0x6D, 0x86, 0x0E, 0x05, 0xA3, 0x43, 0x46, 0x61, 0x42, 0x6F, 0x82,
+    0x0E, 0x19, 0x59, 0x56, 0x00, 0x03, 0x01, 0x26, 0x8E, 0x8E, 0x6F, 0x46, 0x6F, 0x6D, 0x6F, 0x2B,
+    0x3F, 0x46, 0x46, 0x28, 0x55, 0x29, 0x08, 0x3B, 0x08, 0x87, 0x01, 0x00, 0x20, 0x81, 0x0C, 0x0C,
+    0x8B, 0x1B, 0x0C, 0x8B, 0x1A, 0x04, 0x86, 0x45, 0x7B, 0x29, 0x02, 0x6F, 0x0E, 0x0E, 0x6D, 0x6D,
+    0x69, 0x2D, 0x76, 0x28, 0x01, 0x01, 0x25, 0x89, 0x10, 0x1C, 0x00, 0x00, 0x52, 0x42, 0x82, 0x00,
+    0x0D, 0x29, 0x2D, 0x63, 0x3F, 0x3E, 0x6C, 0x39, 0x3E, 0x36, 0x1B, 0x3E, 0x1B, 0x1B, 0x36, 0x82,
+    0x1B, 0x81, 0x39, 0x0F, 0x3E, 0x36, 0x3E, 0x3E, 0x39, 0x0C, 0x16, 0x00, 0x1A, 0x0C, 0x18, 0x0C,
+    0x4A, 0x3E, 0x42, 0x45, 0x82, 0x00, 0x01, 0x07, 0x01, 0x82, 0x00, 0x05, 0x4F, 0x21, 0x3F, 0x52,
+    0x00, 0x9F, 0x85, 0x00, 0x1B, 0x01, 0x03, 0x00, 0x00, 0x02, 0x00, 0x3D, 0x47, 0x03, 0x04, 0x00,
+    0x29, 0x6C, 0x44, 0x57, 0x57, 0x77, 0x70, 0x70, 0x99, 0x70, 0x99, 0x99, 0x4A, 0x99, 0x69, 0x7F,
+    0x46, 0x82, 0x44, 0x05, 0x69, 0x7F, 0x44, 0x99, 0x70, 0x99, 0x82, 0x70, 0x81, 0x77, 0x0D, 0x57,
+    0xA3, 0x44, 0x6C, 0x46, 0x88, 0x00, 0x00, 0x26, 0x82, 0x00, 0x01, 0x08, 0x01, 0x83, 0x00, 0x28,
+    0x01, 0x00, 0x03, 0x05, 0x0A, 0x08, 0x03, 0x00, 0x00, 0x02, 0x01, 0x3B, 0x00, 0x47, 0x14, 0x0C,
+    0x6C, 0x4F, 0x02, 0x1A, 0x42, 0x1F, 0x36, 0x8D, 0x77, 0x4A, 0x94, 0x4A, 0x0C, 0x57, 0x70, 0x99,
+    0x29, 0x13, 0x65, 0x79, 0x3B, 0x38, 0x38, 0x12, 0x74, 0x8A, 0x0E, 0x05, 0xA3, 0x7D, 0x1E, 0x46,
+    0x69, 0x6F, 0x82, 0x0E, 0x09, 0x46, 0x16, 0x03, 0x03, 0x00, 0x03, 0x65, 0x56, 0x6F, 0x8E, 0x82,
+    0x6F, 0x0E, 0x8E, 0x46, 0x29, 0x69, 0x69, 0x7F, 0x03, 0x13, 0x71, 0x6A, 0xA1, 0x49, 0x62, 0x01,
+    0x00, 0x31, 0x23, 0x1B, 0x76, 0x8B, 0x8B, 0x66, 0x76, 0x25, 0x00, 0x07, 0x00, 0x29, 0x23, 0x02,
+    0x4E, 0x0E, 0x6D, 0x2F, 0x6D, 0x10, 0x2D, 0x76, 0x17, 0x56, 0x7E, 0x36, 0x36, 0x39, 0x51, 0x00,
+    0x00, 0x25, 0x89, 0x02, 0x01, 0x07, 0x1E, 0x94, 0x16, 0x42, 0x3E, 0x89, 0x17, 0x36, 0x36, 0x1B,
+    0x3E, 0x1B, 0x39, 0x3E, 0x83, 0x1B, 0x11, 0x39, 0x3E, 0x36, 0x3E, 0x1B, 0x1B, 0x61, 0x00, 0x51,
+    0x36, 0x42, 0x3F, 0x09, 0x36, 0x36, 0x23, 0x2D, 0x22, 0x86, 0x00, 0x03, 0x1C, 0x35, 0x21, 0x95,
+    0x82, 0x00, 0x80, 0x04, 0x83, 0x00, 0x0E, 0x01, 0x03, 0x02, 0x00, 0x01, 0x00, 0x91, 0x26, 0x56,
+    0x00, 0x00, 0x45, 0x61, 0x89, 0x44, 0x81, 0x57, 0x83, 0x70, 0x0E, 0x4A, 0x99, 0x99, 0x8D, 0x70,
+    0x88, 0x8F, 0x9E, 0x9B, 0x9E, 0x98, 0x74, 0x70, 0x4A, 0x94, 0x83, 0x70, 0x0F, 0x77, 0x57, 0x57,
+    0x44, 0x6C, 0x89, 0x59, 0x51, 0x00, 0x00, 0x82, 0x5F, 0x00, 0x01, 0x08, 0x01, 0x83, 0x00, 0x06,
+    0x03, 0x00, 0x06, 0x05, 0x0A, 0x08, 0x05, 0x83, 0x00, 0x0F, 0x86, 0x03, 0x06, 0x27, 0x17, 0x3F,
+    0x07, 0x02, 0x52, 0x1A, 0x18, 0x35, 0x0F, 0x4B, 0x42, 0x30, 0x82, 0x68, 0x0A, 0x4B, 0x30, 0x25,
+    0x2B, 0x65, 0x06, 0x9D, 0x84, 0x38, 0x6A, 0x2F, 0x89, 0x0E, 0x04, 0x0C, 0x7D, 0x8E, 0x6D, 0x6F,
+    0x82, 0x0E, 0x1D, 0x46, 0x16, 0x13, 0x6B, 0x68, 0x0F, 0x85, 0x55, 0x65, 0x5F, 0x8E, 0x6F, 0x6F,
+    0x2F, 0x6F, 0x6D, 0x74, 0x95, 0x46, 0x69, 0x1F, 0x04, 0x53, 0x3F, 0x4E, 0x80, 0x02, 0x63, 0x3B,
+    0x6B, 0x31, 0x66, 0x1B, 0x8B, 0x17, 0x76, 0x0C, 0x76, 0x23, 0x00, 0x00, 0x4F, 0x4D, 0x17, 0x1C,
+    0x74, 0x0E, 0x6D, 0x0E, 0x0E, 0x46, 0x27, 0x1B, 0x76, 0x17, 0x0C, 0x76, 0x1B, 0x39, 0x60, 0x00,
+    0x00, 0x42, 0x6C, 0x02, 0x00, 0x45, 0x17, 0x76, 0x25, 0x23, 0x36, 0x17, 0x6C, 0x4A, 0x1B, 0x3E,
+    0x36, 0x1B, 0x1B, 0x3E, 0x83, 0x1B, 0x12, 0x39, 0x3E, 0x3E, 0x4A, 0x39, 0x36, 0x16, 0x00, 0x6C,
+    0x36, 0x3F, 0x36, 0x4A, 0x36, 0x42, 0x23, 0x42, 0x61, 0x75, 0x85, 0x00, 0x05, 0x4F, 0x35, 0x14,
+    0x29, 0x5D, 0x01, 0x85, 0x00, 0x08, 0x06, 0x62, 0x02, 0x00, 0x01, 0x00, 0x91, 0x5F, 0x63, 0x82,
+    0x00, 0x06, 0x29, 0x6C, 0x6C, 0x44, 0x57, 0x57, 0x77, 0x83, 0x70, 0x81, 0x94, 0x07, 0x70, 0x44,
+    0x7A, 0x8F, 0x8F, 0x98, 0x4E, 0x99, 0x84, 0x70, 0x81, 0x77, 0x81, 0x57, 0x81, 0x44, 0x02, 0x89,
+    0x61, 0x88, 0x82, 0x00, 0x06, 0x16, 0x1A, 0x00, 0x07, 0x86, 0x06, 0x01, 0x82, 0x00, 0x06, 0x05,
+    0x00, 0x02, 0x05, 0x3D, 0x08, 0x05, 0x83, 0x00, 0x1E, 0x75, 0x0A, 0x02, 0x53, 0x1E, 0x29, 0x00,
+    0x22, 0x02, 0x01, 0x03, 0x41, 0x0D, 0x0D, 0x65, 0x0D, 0x6B, 0x15, 0x0D, 0x0D, 0x6B, 0x68, 0x8C,
+    0x08, 0x41, 0x38, 0x38, 0x72, 0x59, 0x0E, 0x8E, 0x85, 0x0E, 0x81, 0xA3, 0x13, 0x43, 0x8E, 0x0E,
+    0x0E, 0x8E, 0x8E, 0x0E, 0x6F, 0x35, 0x3B, 0x01, 0x8C, 0x64, 0x1D, 0x7C, 0x29, 0x55, 0x5A, 0x53,
+    0x6D, 0x83, 0x6F, 0x0E, 0x6D, 0x74, 0x74, 0x2F, 0x74, 0x02, 0x56, 0x69, 0x69, 0x59, 0x4E, 0x48,
+    0x01, 0x65, 0x4C, 0x2B, 0x76, 0x66, 0x43, 0x17, 0x1B, 0x8B, 0x66, 0x43, 0x3F, 0x1F, 0x81, 0x66,
+    0x66, 0x82, 0x7A, 0x0E, 0x6D, 0x2F, 0x46, 0x7F, 0x3F, 0x4A, 0x2D, 0x23, 0x3E, 0x1B, 0x39, 0x57,
+    0x1F, 0x00, 0x01, 0x17, 0x6C, 0x02, 0x00, 0x45, 0x17, 0x3E, 0x30, 0x23, 0x1B, 0x0C, 0x23, 0x1B,
+    0x82, 0x36, 0x80, 0x39, 0x82, 0x1B, 0x15, 0x76, 0x1B, 0x1B, 0x39, 0x3E, 0x4A, 0x3E, 0x3E, 0x0C,
+    0x00, 0x29, 0x09, 0x89, 0xA0, 0x09, 0x36, 0x1B, 0x6C, 0x8D, 0x3F, 0x43, 0x42, 0x85, 0x00, 0x03,
+    0x1F, 0x3F, 0x14, 0x16, 0x87, 0x00, 0x08, 0x03, 0x0A, 0x02, 0x00, 0x01, 0x22, 0x01, 0xA1, 0x3F,
+    0x82, 0x00, 0x05, 0x1C, 0x2D, 0x6C, 0x44, 0x44, 0x57, 0x82, 0x77, 0x85, 0x70, 0x03, 0x44, 0x88,
+    0x88, 0x4E, 0x81, 0x77, 0x83, 0x70, 0x81, 0x77, 0x81, 0x57, 0x81, 0x44, 0x03, 0x89, 0x46, 0x4E,
+    0x34, 0x82, 0x00, 0x06, 0x25, 0x1A, 0x00, 0x01, 0x1C, 0x02, 0x5D, 0x82, 0x00, 0x04, 0x0A, 0x01,
+    0x02, 0x03, 0x49, 0x81, 0x05, 0x84, 0x00, 0x1B, 0x4F, 0x02, 0x80, 0x1E, 0x26, 0x00, 0x00, 0x01,
+    0x9F, 0x03, 0x3B, 0x37, 0x73, 0x03, 0x49, 0x3D, 0x79, 0x90, 0x90, 0x56, 0x55, 0x0D, 0x47, 0x38,
+    0x84, 0x38, 0x2C, 0x6D, 0x83, 0x0E, 0x19, 0x8E, 0x0E, 0x0E, 0x8E, 0x43, 0x8E, 0x8E, 0x0E, 0x0E,
+    0x8E, 0x0E, 0x0E, 0x2D, 0x8A, 0x00, 0x0A, 0x0D, 0x64, 0x67, 0x1D, 0x14, 0x53, 0x8A, 0x65, 0x68,
+    0x2F, 0x82, 0x6F, 0x81, 0x2F, 0x0D, 0x4E, 0x5E, 0x4B, 0x0B, 0x13, 0x7F, 0x3A, 0x10, 0x69, 0x29,
+    0x75, 0x03, 0x2E, 0x72, 0x48, 0x9C, 0x17, 0x17, 0x43, 0x43, 0x66, 0x9C, 0x0C, 0x76, 0x0C, 0x76,
+    0x66, 0x76, 0x25, 0x00, 0x51, 0x75, 0x9F, 0x02, 0x3C, 0x42, 0x8B, 0x60, 0x6C, 0x61, 0x1A, 0x3E,
+    0x77, 0x1F, 0x00, 0x1A, 0x1B, 0x6C, 0x02, 0x00, 0x51, 0x17, 0x3E, 0x3F, 0x23, 0x76, 0x1B, 0x23,
+    0xA0, 0x36, 0x36, 0x1B, 0x3E, 0x66, 0x0C, 0x76, 0x76, 0x1B, 0x1B, 0x39, 0x3E, 0x3E, 0x36, 0x4A,
+    0x61, 0x00, 0xA0, 0x36, 0x42, 0x36, 0x1B, 0x36, 0x0C, 0x89, 0x23, 0x3F, 0x30, 0x52, 0x83, 0x00,
+    0x06, 0x07, 0x00, 0x7E, 0x2D, 0x2D, 0x52, 0x01, 0x86, 0x00, 0x0D, 0x49, 0x0A, 0x01, 0x00, 0x22,
+    0x02, 0x3C, 0x4F, 0x3F, 0x02, 0x00, 0x04, 0x00, 0x1A, 0x81, 0x89, 0x81, 0x44, 0x81, 0x57, 0x86,
+    0x77, 0x03, 0x70, 0x44, 0x44, 0x70, 0x85, 0x77, 0x81, 0x57, 0x1B, 0x0C, 0x44, 0x44, 0x6C, 0x89,
+    0x69, 0x28, 0x00, 0x01, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x0A, 0x02, 0x5D, 0x00, 0x00, 0x02,
+    0x08, 0x01, 0x02, 0x07, 0x03, 0x48, 0x03, 0x84, 0x00, 0x20, 0x87, 0x96, 0x92, 0x2B, 0x4F, 0x1C,
+    0x04, 0x26, 0x03, 0x07, 0x6E, 0x5F, 0x00, 0x01, 0x00, 0x49, 0x01, 0x02, 0x00, 0x1C, 0x9D, 0x14,
+    0x64, 0x84, 0x84, 0x38, 0x67, 0x6D, 0x6D, 0x0E, 0x0E, 0x6D, 0x0E, 0x83, 0x8E, 0x27, 0x0E, 0x6D,
+    0x8E, 0x8E, 0x0E, 0x46, 0x26, 0x2E, 0x65, 0x41, 0x6A, 0x41, 0x5B, 0x2C, 0x64, 0x67, 0x2B, 0x08,
+    0x5C, 0x5C, 0x46, 0x6F, 0x2F, 0x6F, 0x2F, 0x10, 0x4B, 0x2E, 0x0D, 0x0B, 0x2B, 0x3A, 0x10, 0x74,
+    0x4F, 0x00, 0x02, 0x71, 0x72, 0x64, 0x0E, 0x8B, 0x0C, 0x0C, 0x17, 0x43, 0x43, 0x81, 0x1E, 0x1E,
+    0x7D, 0x66, 0x3E, 0x1B, 0x43, 0x24, 0x82, 0x42, 0x35, 0x1E, 0x17, 0x76, 0x61, 0x07, 0x43, 0x1F,
+    0x02, 0x6C, 0x70, 0x74, 0x06, 0x81, 0x1B, 0x43, 0x01, 0x00, 0x45, 0x17, 0x1B, 0x25, 0x61, 0x76,
+    0x1B, 0x17, 0x3F, 0x36, 0x1B, 0x36, 0x1B, 0x7C, 0x76, 0x0C, 0x8B, 0x1B, 0x39, 0x1B, 0x36, 0x3E,
+    0x3E, 0x70, 0x1A, 0x52, 0x8D, 0x43, 0x23, 0x1B, 0x4A, 0x8B, 0x6C, 0x42, 0x3F, 0x42, 0x95, 0x84,
+    0x00, 0x05, 0x07, 0x00, 0x16, 0x3F, 0x7E, 0x60, 0x87, 0x00, 0x09, 0x03, 0x05, 0x00, 0x00, 0x01,
+    0x03, 0x05, 0x22, 0x16, 0x02, 0x83, 0x00, 0x80, 0x4E, 0x81, 0x89, 0x82, 0x44, 0x82, 0x57, 0x81,
+    0x77, 0x04, 0x70, 0x57, 0xA3, 0x57, 0x77, 0x81, 0x57, 0x81, 0x77, 0x82, 0x57, 0x07, 0x39, 0xA3,
+    0x44, 0x44, 0x89, 0x89, 0x61, 0x88, 0x82, 0x00, 0x14, 0x04, 0x00, 0x30, 0x51, 0x00, 0x00, 0x62,
+    0x06, 0x04, 0x01, 0x00, 0x04, 0x08, 0x06, 0x00, 0x04, 0x03, 0x62, 0x03, 0x00, 0x01, 0x82, 0x00,
+    0x15, 0x22, 0x37, 0x96, 0x4F, 0x5B, 0x82, 0x00, 0x1A, 0x35, 0x56, 0x9C, 0x21, 0x71, 0x13, 0x13,
+    0x95, 0x51, 0x90, 0x72, 0x38, 0x38, 0x7C, 0x82, 0x84, 0x01, 0x38, 0x67, 0x82, 0x6D, 0x81, 0x0E,
+    0x81, 0x8E, 0x18, 0x6D, 0x0E, 0x8E, 0x0E, 0x6D, 0x8E, 0x8E, 0x2D, 0x0D, 0x0B, 0x55, 0x90, 0x47,
+    0x85, 0x05, 0x78, 0x2C, 0x0F, 0x67, 0x19, 0x07, 0x90, 0x6B, 0x7F, 0x2F, 0x82, 0x69, 0x0E, 0x25,
+    0x65, 0x8C, 0x40, 0x5C, 0x4E, 0x69, 0x82, 0x02, 0x00, 0x00, 0x32, 0x2E, 0x12, 0x2A, 0x86, 0x66,
+    0x3E, 0x4D, 0x1E, 0x14, 0x23, 0x7E, 0x3F, 0x23, 0x6C, 0x76, 0x76, 0x52, 0x1E, 0x17, 0x76, 0x95,
+    0x18, 0x2D, 0x63, 0x01, 0x30, 0x99, 0x23, 0x5B, 0x43, 0x1B, 0x17, 0x45, 0x00, 0x1C, 0xA0, 0x3E,
+    0x3F, 0x61, 0x1B, 0x0C, 0x3E, 0x2D, 0x43, 0x4A, 0x1B, 0x0C, 0x7D, 0x9C, 0x0C, 0x0C, 0x8B, 0x76,
+    0x1B, 0x4A, 0x57, 0x99, 0xA0, 0x34, 0x23, 0x4A, 0x61, 0x0C, 0xA0, 0x6C, 0x17, 0x0C, 0x6C, 0x3F,
+    0x81, 0x61, 0x86, 0x00, 0x05, 0x02, 0x29, 0x25, 0x45, 0x00, 0x02, 0x85, 0x00, 0x09, 0x03, 0x05,
+    0x00, 0x00, 0x01, 0x03, 0x3C, 0x00, 0x16, 0x3D, 0x83, 0x00, 0x01, 0x75, 0x2D, 0x81, 0x89, 0x86,
+    0x44, 0x80, 0x3A, 0x82, 0x97, 0x04, 0x9B, 0x97, 0x97, 0x69, 0x44, 0x81, 0xA3, 0x82, 0x44, 0x04,
+    0x6C, 0x89, 0x46, 0x46, 0x74, 0x83, 0x00, 0x14, 0x04, 0x00, 0x7E, 0x75, 0x00, 0x00, 0x03, 0x06,
+    0x02, 0x01, 0x00, 0x04, 0x0A, 0x03, 0x00, 0x00, 0x03, 0x62, 0x06, 0x01, 0x75, 0x83, 0x00, 0x10,
+    0x37, 0x96, 0x63, 0x71, 0x35, 0x4F, 0x22, 0x3F, 0x7E, 0x31, 0x4D, 0x31, 0x27, 0x4C, 0x25, 0x1F,
+    0x38, 0x86, 0x84, 0x81, 0x38, 0x07, 0x10, 0x0E, 0x6D, 0x6D, 0x0E, 0x6D, 0x6D, 0x0E, 0x81, 0x6D,
+    0x82, 0x0E, 0x24, 0x4E, 0x06, 0x91, 0x3C, 0x05, 0x03, 0x62, 0x9F, 0x32, 0x4C, 0x2E, 0x4C, 0x2C,
+    0x78, 0x03, 0x85, 0x08, 0x0B, 0x3F, 0x59, 0x95, 0x2B, 0x6A, 0x50, 0x4C, 0x5E, 0x35, 0x35, 0x41,
+    0x04, 0x00, 0x00, 0x85, 0x2E, 0x4C, 0x24, 0x35, 0x80, 0x0C, 0x82, 0x66, 0x46, 0x76, 0x8B, 0x66,
+    0x66, 0x17, 0x36, 0x23, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x66, 0x01, 0x16, 0x1B, 0x0C, 0x63, 0x16,
+    0x52, 0x2D, 0x25, 0x52, 0x99, 0x24, 0x5A, 0x4D, 0x39, 0x43, 0x60, 0x00, 0x49, 0xA0, 0x1B, 0x43,
+    0x43, 0x0C, 0x0C, 0x1B, 0x6C, 0x3F, 0x3E, 0x1B, 0x8B, 0x66, 0x0C, 0x0C, 0x17, 0x17, 0x76, 0x3E,
+    0x36, 0x3E, 0x94, 0x6C, 0x45, 0x76, 0x8B, 0x81, 0x0C, 0xA0, 0x43, 0x9C, 0x8B, 0x43, 0x2D, 0x6C,
+    0x16, 0x00, 0x51, 0x1F, 0x84, 0x00, 0x02, 0x03, 0x1F, 0x22, 0x86, 0x00, 0x0A, 0x02, 0x03, 0x05,
+    0x00, 0x00, 0x01, 0x01, 0x47, 0x00, 0x29, 0x1A, 0x84, 0x00, 0x07, 0x18, 0x61, 0x61, 0x89, 0x89,
+    0x6C, 0x89, 0x7F, 0x81, 0x9E, 0x87, 0x8F, 0x0A, 0x9E, 0x7F, 0x59, 0x89, 0x89, 0x6C, 0x89, 0x46,
+    0x46, 0x7F, 0x34, 0x83, 0x00, 0x06, 0x01, 0x04, 0x30, 0x01, 0x00, 0x00, 0x03, 0x82, 0x01, 0x81,
+    0x02, 0x08, 0x05, 0x03, 0x00, 0x00, 0x03, 0x62, 0x01, 0x01, 0x60, 0x82, 0x00, 0x11, 0x02, 0x85,
+    0x96, 0x03, 0x53, 0x20, 0x30, 0x00, 0x56, 0x30, 0x7D, 0x43, 0x17, 0x0C, 0x39, 0x89, 0x51, 0x4C,
+    0x86, 0x84, 0x81, 0x38, 0x07, 0x69, 0x0E, 0x6D, 0x6D, 0x8E, 0x6D, 0x6D, 0x0E, 0x82, 0x8E, 0x26,
+    0x46, 0x95, 0x32, 0x03, 0x9F, 0x26, 0x54, 0x58, 0x03, 0x03, 0x15, 0x2E, 0x8C, 0x5B, 0x19, 0x5E,
+    0x8A, 0x02, 0x92, 0x6B, 0x55, 0x60, 0x71, 0x4C, 0x19, 0x5E, 0x2B, 0x35, 0x2B, 0x92, 0x0A, 0x00,
+    0x00, 0x0A, 0xA4, 0x3F, 0x56, 0x1F, 0x23, 0x4A, 0x66, 0x9C, 0x66, 0x0C, 0x25, 0x42, 0x66, 0x7D,
+    0x8B, 0x42, 0x1A, 0x07, 0x04, 0x00, 0x00, 0x1A, 0x89, 0x00, 0x00, 0x89, 0x0C, 0x01, 0x25, 0x63,
+    0x89, 0x3E, 0x3F, 0x8E, 0x14, 0x65, 0x17, 0x1B, 0x17, 0x60, 0x07, 0x22, 0x6C, 0x76, 0x76, 0x0C,
+    0x0C, 0x76, 0x8B, 0x3E, 0x30, 0x23, 0x3E, 0x0C, 0x66, 0x17, 0x66, 0x4D, 0x4D, 0x76, 0x1B, 0x3E,
+    0x36, 0x70, 0x61, 0x52, 0x36, 0xA0, 0x6C, 0x66, 0x8B, 0x7D, 0x7D, 0x17, 0x66, 0x1E, 0x2D, 0x00,
+    0x01, 0x1A, 0x25, 0x84, 0x00, 0x01, 0x18, 0x03, 0x88, 0x00, 0x0B, 0x05, 0x03, 0x00, 0x00, 0x01,
+    0x03, 0x13, 0x00, 0x16, 0x7E, 0x00, 0x07, 0x83, 0x00, 0x80, 0x1A, 0x82, 0x61, 0x03, 0x89, 0x46,
+    0x46, 0x59, 0x83, 0x9B, 0x85, 0x97, 0x08, 0x7F, 0x59, 0x89, 0x61, 0x89, 0x69, 0x69, 0x7F, 0x7B,
+    0x84, 0x00, 0x03, 0x03, 0x01, 0x16, 0x22, 0x81, 0x00, 0x82, 0x01, 0x21, 0x06, 0x01, 0x01, 0x03,
+    0x06, 0x00, 0x00, 0x03, 0x62, 0x02, 0x03, 0x18, 0x01, 0x00, 0x51, 0x02, 0x01, 0x1C, 0x02, 0x30,
+    0x1D, 0x14, 0x63, 0x00, 0x24, 0x7D, 0x17, 0x0C, 0x17, 0x57, 0x89, 0x49, 0x00, 0x38, 0x85, 0x84,
+    0x17, 0x38, 0x2B, 0x61, 0x6D, 0x0E, 0x0E, 0x6F, 0x6D, 0x89, 0x8E, 0x8E, 0xA3, 0x21, 0x5E, 0x0B,
+    0x41, 0x92, 0x30, 0x27, 0x02, 0x03, 0x01, 0x01, 0x41, 0x82, 0x2E, 0x18, 0x50, 0x5A, 0x53, 0x82,
+    0x16, 0x32, 0x91, 0x01, 0x8C, 0x5E, 0x6A, 0x7E, 0x7E, 0x53, 0x2B, 0x2D, 0x1F, 0x00, 0x02, 0x8C,
+    0x61, 0x6D, 0x2F, 0x7A, 0x18, 0x81, 0x66, 0x32, 0x76, 0x6C, 0x04, 0x16, 0x0C, 0x1B, 0x42, 0x00,
+    0x1F, 0x00, 0x95, 0x25, 0x45, 0x22, 0x25, 0x00, 0x00, 0x29, 0x42, 0x07, 0x42, 0x51, 0x2D, 0x16,
+    0x90, 0x6F, 0x61, 0x90, 0x0C, 0x76, 0x0C, 0x18, 0x00, 0x04, 0x81, 0x1B, 0x76, 0x0C, 0x0C, 0x76,
+    0x8B, 0x1B, 0xA0, 0x95, 0x8B, 0x66, 0x17, 0x43, 0x17, 0x4D, 0x7D, 0x81, 0x1B, 0x82, 0x4A, 0x11,
+    0x4E, 0x7E, 0x4A, 0x6C, 0x64, 0x7C, 0x17, 0x7D, 0x17, 0x17, 0x66, 0x43, 0x60, 0x00, 0x00, 0x1A,
+    0x89, 0x45, 0x83, 0x00, 0x01, 0x18, 0x1F, 0x82, 0x00, 0x80, 0x01, 0x84, 0x00, 0x0A, 0x05, 0x03,
+    0x00, 0x00, 0x02, 0x01, 0x58, 0x01, 0x07, 0x16, 0x00, 0x81, 0x01, 0x83, 0x00, 0x06, 0x16, 0x61,
+    0x61, 0x69, 0x61, 0x61, 0x46, 0x81, 0x9B, 0x82, 0x3A, 0x01, 0x9B, 0x3A, 0x82, 0x9B, 0x11, 0x69,
+    0x61, 0x69, 0x61, 0x69, 0x69, 0x7F, 0x34, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01,
+    0x07, 0x82, 0x00, 0x24, 0x01, 0x06, 0x06, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x03, 0x56, 0x75, 0x00, 0x1F, 0x28, 0x02, 0x4F, 0x63, 0x5F, 0x20, 0x14, 0x16, 0x00, 0x20, 0x43,
+    0x17, 0x0C, 0x17, 0x8B, 0x89, 0x01, 0x71, 0x26, 0x38, 0x84, 0x84, 0x14, 0x20, 0x31, 0x83, 0x2F,
+    0x6D, 0x0E, 0x0E, 0x8E, 0x8E, 0x0E, 0x61, 0x21, 0x4D, 0x5B, 0x02, 0x56, 0x1E, 0x77, 0x57, 0x5F,
+    0x00, 0x82, 0x01, 0x1B, 0x50, 0x2E, 0x2E, 0x53, 0x59, 0x6D, 0x59, 0x59, 0x7F, 0x71, 0x5C, 0x65,
+    0x0B, 0x71, 0x74, 0x29, 0x53, 0x17, 0x76, 0x52, 0x34, 0x02, 0x5F, 0x6D, 0x6F, 0x6D, 0x0E, 0x74,
+    0x4C, 0x17, 0x66, 0x1B, 0x42, 0x00, 0x30, 0x3E, 0x61, 0x00, 0x1A, 0x25, 0x00, 0x81, 0x94, 0x3F,
+    0x00, 0x45, 0x04, 0x07, 0x1F, 0x52, 0x18, 0x23, 0x00, 0x02, 0x22, 0x3F, 0x70, 0x4E, 0x52, 0x1B,
+    0x0C, 0x8B, 0x1A, 0x00, 0x00, 0x23, 0x1B, 0x76, 0x17, 0x0C, 0x76, 0x66, 0x8B, 0x3E, 0x2D, 0x30,
+    0x9C, 0x7D, 0x43, 0x17, 0x7D, 0x9C, 0x39, 0x1B, 0x8D, 0x77, 0x4A, 0x6E, 0x29, 0x4A, 0x20, 0x83,
+    0x66, 0x17, 0x43, 0x8B, 0x66, 0x17, 0x25, 0x00, 0x00, 0x22, 0x1A, 0x89, 0x45, 0x01, 0x82, 0x00,
+    0x04, 0x01, 0x49, 0x00, 0x00, 0x02, 0x85, 0x00, 0x01, 0x05, 0x03, 0x82, 0x00, 0x01, 0x01, 0x85,
+    0x83, 0x00, 0x02, 0x01, 0x03, 0x04, 0x83, 0x00, 0x04, 0x16, 0x61, 0x61, 0x59, 0x2D, 0x81, 0x7F,
+    0x87, 0x9E, 0x81, 0x7F, 0x81, 0x59, 0x81, 0x61, 0x01, 0x74, 0x34, 0x85, 0x00, 0x01, 0x04, 0x3D,
+    0x86, 0x00, 0x83, 0x03, 0x80, 0x01, 0x82, 0x00, 0x1C, 0x01, 0x06, 0x01, 0x03, 0x18, 0x60, 0x00,
+    0x60, 0x74, 0x00, 0x49, 0x1A, 0x62, 0x27, 0x14, 0x25, 0x00, 0x24, 0x7D, 0x17, 0x0C, 0xA0, 0x39,
+    0x42, 0x73, 0x71, 0x00, 0x41, 0x38, 0x82, 0x84, 0x34, 0x38, 0x84, 0x7C, 0x31, 0x46, 0x0E, 0x59,
+    0x43, 0x1B, 0x17, 0x6F, 0x6E, 0x19, 0x7C, 0x2B, 0x16, 0x8B, 0x77, 0x0C, 0x76, 0x42, 0x00, 0x05,
+    0x00, 0x00, 0x65, 0x33, 0x27, 0x2F, 0x6D, 0x10, 0x10, 0x3A, 0x6D, 0x4E, 0x08, 0x00, 0x13, 0x74,
+    0x95, 0x2B, 0x24, 0x66, 0x8B, 0x30, 0x00, 0x01, 0x28, 0x6D, 0x6D, 0x8E, 0x6F, 0x46, 0x4D, 0x17,
+    0x0C, 0x39, 0x95, 0x00, 0x1E, 0x1E, 0x07, 0x1C, 0x1E, 0x16, 0x00, 0x42, 0x81, 0x14, 0x04, 0x00,
+    0x63, 0x7E, 0x00, 0x00, 0x25, 0x23, 0x02, 0x25, 0x8B, 0x36, 0x57, 0x2D, 0x2D, 0x3E, 0x8B, 0x0C,
+    0x1F, 0x00, 0x00, 0x23, 0x1B, 0x0C, 0x17, 0x0C, 0x8B, 0x66, 0x76, 0x0C, 0x8B, 0x29, 0x23, 0x66,
+    0x17, 0x66, 0x7D, 0x8B, 0x39, 0x1B, 0x4A, 0x3E, 0x7C, 0x6E, 0x52, 0x3E, 0x23, 0x17, 0x17, 0x9C,
+    0x17, 0x14, 0x1E, 0x23, 0x45, 0x52, 0x00, 0x7A, 0x95, 0x95, 0x00, 0x01, 0x22, 0x85, 0x00, 0x80,
+    0x01, 0x85, 0x00, 0x01, 0x05, 0x03, 0x82, 0x00, 0x09, 0x07, 0x08, 0x22, 0x00, 0x04, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x83, 0x00, 0x80, 0x16, 0x82, 0x61, 0x0F, 0x69, 0x4E, 0x74, 0x7A, 0x28, 0x28,
+    0x98, 0x28, 0x7A, 0x74, 0x7F, 0x4E, 0x2D, 0x61, 0x61, 0x74, 0x87, 0x00, 0x03, 0x22, 0x3D, 0x00,
+    0x04, 0x84, 0x00, 0x82, 0x03, 0x01, 0x62, 0x01, 0x82, 0x00, 0x12, 0x02, 0x01, 0x04, 0x22, 0x18,
+    0x60, 0x00, 0x00, 0x95, 0x28, 0x00, 0x63, 0x02, 0x29, 0x1E, 0x7E, 0x02, 0x24, 0x66, 0x82, 0x17,
+    0x06, 0x1B, 0x3F, 0x41, 0x37, 0x01, 0x00, 0x80, 0x85, 0x84, 0x25, 0x83, 0x14, 0x59, 0x26, 0x66,
+    0x43, 0x46, 0x10, 0x23, 0x2A, 0x0F, 0x0C, 0x77, 0x76, 0x9C, 0x7C, 0x7C, 0x57, 0x90, 0x13, 0x48,
+    0x00, 0x96, 0x69, 0x6D, 0x10, 0x10, 0x6D, 0x2F, 0x59, 0x18, 0x34, 0x00, 0x91, 0x3F, 0x1E, 0x66,
+    0x7D, 0x82, 0x66, 0x08, 0x2D, 0x00, 0x00, 0x1F, 0x0E, 0x6F, 0x6D, 0x59, 0x2F, 0x2F, 0x17, 0x66,
+    0x0C, 0x51, 0x18, 0x1E, 0x4F, 0x04, 0x23, 0x1B, 0x1F, 0x00, 0x00, 0x0A, 0x43, 0x56, 0x04, 0x1A,
+    0x23, 0x00, 0x00, 0x23, 0x23, 0x30, 0x4A, 0x1B, 0xA3, 0x0E, 0x0C, 0x8B, 0x0C, 0x0C, 0x39, 0x16,
+    0x00, 0x00, 0x23, 0x1B, 0x17, 0x0C, 0x17, 0x0C, 0x66, 0x66, 0x0C, 0x1B, 0x1E, 0x29, 0x82, 0x66,
+    0x0B, 0x7D, 0x0C, 0x39, 0x3E, 0x1B, 0x9C, 0x1B, 0x61, 0x1F, 0x76, 0x81, 0x1E, 0x82, 0x43, 0x07,
+    0x81, 0x2D, 0x60, 0x56, 0x56, 0x00, 0x25, 0x2D, 0x89, 0x00, 0x80, 0x01, 0x84, 0x00, 0x02, 0x02,
+    0x05, 0x01, 0x83, 0x00, 0x01, 0x85, 0x02, 0x83, 0x00, 0x02, 0x62, 0x02, 0x01, 0x84, 0x00, 0x01,
+    0x7A, 0x61, 0x81, 0x89, 0x81, 0x44, 0x82, 0x57, 0x81, 0x44, 0x80, 0x6C, 0x82, 0x89, 0x04, 0x61,
+    0x69, 0x88, 0x00, 0x01, 0x86, 0x00, 0x80, 0x22, 0x81, 0x01, 0x85, 0x00, 0x04, 0x03, 0x01, 0x03,
+    0x05, 0x01, 0x82, 0x00, 0x1E, 0x02, 0x01, 0x00, 0x07, 0x56, 0x18, 0x04, 0x00, 0x1F, 0x4E, 0x04,
+    0x01, 0x01, 0x60, 0x23, 0x6E, 0x51, 0x2A, 0x66, 0x17, 0x17, 0x1E, 0x39, 0x95, 0x91, 0x73, 0x0A,
+    0x92, 0x5D, 0x55, 0x38, 0x85, 0x84, 0x09, 0x95, 0x29, 0x1E, 0x10, 0x2F, 0x74, 0x32, 0x1D, 0x9C,
+    0x7C, 0x83, 0x84, 0x1F, 0x7C, 0x99, 0x25, 0x02, 0x03, 0x5D, 0x00, 0x74, 0x0E, 0x6D, 0x2F, 0x7F,
+    0x28, 0x00, 0x00, 0x04, 0x02, 0x18, 0x9C, 0x3E, 0x17, 0x0C, 0x8B, 0x7D, 0x17, 0x42, 0x9F, 0x00,
+    0x28, 0x6D, 0x2F, 0x46, 0x81, 0x2F, 0x4E, 0x17, 0x0C, 0x89, 0x00, 0x7E, 0x52, 0x00, 0x26, 0x27,
+    0x1E, 0x18, 0x00, 0x16, 0x3F, 0x9C, 0x29, 0x00, 0x35, 0x7D, 0x1F, 0x00, 0x17, 0x23, 0x3F, 0x3E,
+    0x1B, 0xA3, 0x0E, 0x76, 0x9C, 0x0C, 0x8B, 0x9C, 0x7E, 0x32, 0x01, 0x61, 0x3E, 0x9C, 0x0C, 0x66,
+    0x8B, 0x43, 0x66, 0x8B, 0x8B, 0x1B, 0x2D, 0x6E, 0x76, 0x7D, 0x43, 0x8B, 0x7C, 0x7C, 0x9C, 0x36,
+    0x1B, 0x0C, 0x63, 0x2D, 0x43, 0x21, 0x4D, 0x81, 0x81, 0x76, 0x2D, 0x5F, 0x1F, 0x00, 0x00, 0x3F,
+    0x89, 0x00, 0x60, 0x18, 0x00, 0x04, 0x84, 0x00, 0x80, 0x01, 0x84, 0x00, 0x02, 0x01, 0x03, 0x01,
+    0x83, 0x00, 0x01, 0x3C, 0x03, 0x83, 0x00, 0x0E, 0x03, 0x01, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x04, 0x7A, 0x61, 0x6C, 0x44, 0x57, 0x77, 0x82, 0x70, 0x06, 0x77, 0x57, 0x44, 0x89, 0x89, 0x2D,
+    0x1F, 0x86, 0x00, 0x04, 0x02, 0x00, 0x02, 0x49, 0x04, 0x86, 0x00, 0x04, 0x03, 0x01, 0x05, 0x1C,
+    0x01, 0x82, 0x00, 0x11, 0x02, 0x00, 0x00, 0x22, 0x4F, 0x4F, 0x01, 0x00, 0x00, 0x2D, 0x7A, 0x00,
+    0x01, 0x01, 0x29, 0x7E, 0x56, 0x25, 0x82, 0x17, 0x0A, 0x43, 0x57, 0x29, 0x03, 0x60, 0x3B, 0x62,
+    0x01, 0x02, 0x37, 0x38, 0x82, 0x84, 0x1A, 0x38, 0x84, 0x64, 0x1F, 0x69, 0x2F, 0x7A, 0x13, 0x64,
+    0x7C, 0x84, 0x84, 0x7C, 0x7C, 0x38, 0x38, 0x84, 0x70, 0x23, 0x34, 0x01, 0x02, 0x00, 0x01, 0x59,
+    0x59, 0x28, 0x81, 0x00, 0x81, 0x04, 0x82, 0x00, 0x0C, 0x18, 0x81, 0x3E, 0x17, 0x66, 0x1E, 0x42,
+    0x7D, 0x63, 0x00, 0x51, 0x2F, 0x10, 0x82, 0x2F, 0x0B, 0x7D, 0x76, 0x3F, 0x04, 0x22, 0x03, 0x55,
+    0x03, 0x71, 0x14, 0x07, 0x1A, 0x82, 0x76, 0x23, 0x3F, 0x00, 0x23, 0x66, 0x25, 0x82, 0x3E, 0x14,
+    0x2D, 0x3E, 0x1B, 0xA3, 0x0E, 0x8B, 0x66, 0x66, 0x31, 0x7C, 0x6E, 0x65, 0x01, 0x42, 0x3E, 0x76,
+    0x0C, 0x66, 0x76, 0x17, 0x17, 0x9C, 0x8B, 0x0C, 0x8B, 0x6E, 0x3F, 0x3E, 0x82, 0x7C, 0x17, 0x17,
+    0x39, 0x1B, 0x0C, 0x39, 0x2D, 0x02, 0x6E, 0x3F, 0x4D, 0x66, 0x1E, 0x14, 0x82, 0x16, 0x18, 0x00,
+    0x00, 0x61, 0x4E, 0x04, 0x7E, 0x95, 0x1F, 0x8B, 0x00, 0x02, 0x01, 0x03, 0x01, 0x83, 0x00, 0x01,
+    0x3C, 0x03, 0x83, 0x00, 0x05, 0x07, 0x03, 0x00, 0x00, 0x63, 0x1F, 0x82, 0x00, 0x02, 0x04, 0x28,
+    0x61, 0x81, 0x44, 0x82, 0x57, 0x1F, 0xA3, 0x44, 0x44, 0x6C, 0x89, 0x4E, 0x51, 0x34, 0x5D, 0x34,
+    0x00, 0x00, 0x02, 0x01, 0x07, 0x00, 0x00, 0x02, 0x1C, 0x04, 0x00, 0x00, 0x01, 0x51, 0x63, 0x01,
+    0x00, 0x02, 0x01, 0x0A, 0x1C, 0x02, 0x82, 0x00, 0x81, 0x02, 0x1D, 0x00, 0x07, 0x08, 0x51, 0x51,
+    0x00, 0x00, 0x1A, 0x3F, 0x00, 0x01, 0x00, 0x03, 0x6E, 0x63, 0x25, 0x4D, 0xA0, 0x17, 0x0C, 0x39,
+    0x16, 0x13, 0x47, 0x08, 0x0A, 0x3C, 0x87, 0x48, 0x4F, 0x85, 0x38, 0x2E, 0x59, 0x10, 0x28, 0x86,
+    0x38, 0x84, 0x7C, 0x84, 0x84, 0x7C, 0x84, 0x84, 0x38, 0x38, 0x39, 0x1B, 0x1F, 0x00, 0x9F, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x22, 0x3F, 0x1B, 0x9C,
+    0x66, 0x56, 0x23, 0x16, 0x00, 0x45, 0x46, 0x2F, 0x2F, 0x10, 0x6D, 0x4D, 0x43, 0x39, 0x1A, 0x00,
+    0x15, 0x38, 0x2E, 0x05, 0x2A, 0x81, 0x00, 0x25, 0x7D, 0x35, 0x24, 0x1E, 0x3C, 0x1E, 0x43, 0x21,
+    0x1E, 0x8B, 0x66, 0x1E, 0x1B, 0x3E, 0xA3, 0x0E, 0x7C, 0x31, 0x7C, 0x31, 0x7C, 0x24, 0x80, 0x01,
+    0x42, 0x3E, 0x66, 0x39, 0x0C, 0x0C, 0x17, 0x17, 0x66, 0x8B, 0x0C, 0x17, 0x66, 0x29, 0x1D, 0x7C,
+    0x7D, 0x39, 0x39, 0x0C, 0x0C, 0x76, 0x0C, 0x43, 0x52, 0x1C, 0x1C, 0x25, 0x43, 0x66, 0x30, 0x3D,
+    0x52, 0x18, 0x00, 0x5F, 0x1A, 0x51, 0x91, 0x30, 0x95, 0x4E, 0x85, 0x00, 0x80, 0x01, 0x84, 0x00,
+    0x02, 0x01, 0x06, 0x01, 0x83, 0x00, 0x01, 0x3C, 0x03, 0x84, 0x00, 0x0C, 0x48, 0x00, 0x5D, 0x1C,
+    0x11, 0x53, 0x55, 0x01, 0x04, 0x00, 0x60, 0x4E, 0x6C, 0x84, 0x44, 0x10, 0x6C, 0x61, 0x16, 0x5D,
+    0x34, 0x98, 0x98, 0x34, 0x00, 0x02, 0x06, 0x96, 0x07, 0x00, 0x00, 0x02, 0x49, 0x84, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x02, 0x01, 0x0A, 0x49, 0x01, 0x82, 0x00, 0x04, 0x9F, 0x02, 0x00, 0x07, 0x0A,
+    0x81, 0x28, 0x82, 0x00, 0x17, 0x25, 0x1A, 0x00, 0x04, 0x00, 0x29, 0x22, 0x6E, 0x31, 0x43, 0x17,
+    0x17, 0x0C, 0x7A, 0x05, 0x92, 0x0B, 0x13, 0x54, 0x41, 0x5A, 0x2B, 0x6C, 0x84, 0x83, 0x38, 0x03,
+    0x21, 0x28, 0x92, 0x84, 0x81, 0x38, 0x86, 0x84, 0x0D, 0x38, 0x4D, 0x36, 0x23, 0x00, 0x00, 0x7B,
+    0x9F, 0x00, 0x04, 0x02, 0x56, 0x42, 0x3F, 0x82, 0x00, 0x10, 0x02, 0x22, 0x00, 0x04, 0x52, 0x17,
+    0x4A, 0x1F, 0x1A, 0x16, 0x00, 0x00, 0x29, 0x8E, 0x2F, 0x2F, 0x6D, 0x4E, 0x17, 0x6C, 0x1F, 0x2B,
+    0x38, 0x38, 0x32, 0x32, 0x27, 0x23, 0x02, 0x52, 0x18, 0x00, 0x5B, 0x7D, 0x30, 0x14, 0x7D, 0x4D,
+    0x76, 0x17, 0x43, 0x1E, 0x23, 0x81, 0xA3, 0x6D, 0x7C, 0x31, 0x83, 0x31, 0x7C, 0x27, 0x11, 0x02,
+    0x2D, 0x3E, 0x76, 0x8B, 0x0C, 0x0C, 0x43, 0x17, 0x17, 0x8B, 0x0C, 0x66, 0x17, 0x66, 0x68, 0x11,
+    0x3E, 0x17, 0x0C, 0x76, 0x0C, 0x0C, 0x66, 0x17, 0x23, 0x29, 0x86, 0x04, 0x16, 0x61, 0x1F, 0xA1,
+    0x2B, 0x00, 0x51, 0x1E, 0x3F, 0x01, 0x18, 0x16, 0x2D, 0x25, 0x01, 0x84, 0x00, 0x01, 0x01, 0x02,
+    0x83, 0x00, 0x02, 0x01, 0x22, 0x01, 0x83, 0x00, 0x01, 0x3C, 0x91, 0x84, 0x00, 0x22, 0x48, 0x22,
+    0x00, 0x07, 0x53, 0x5E, 0x35, 0x63, 0x7B, 0x34, 0x00, 0x00, 0x7A, 0x3F, 0x61, 0x89, 0x61, 0x4E,
+    0x74, 0x51, 0x5D, 0x98, 0x7A, 0x88, 0x28, 0x04, 0x04, 0x1C, 0x86, 0x04, 0x00, 0x04, 0x00, 0x01,
+    0x1C, 0x87, 0x00, 0x04, 0x02, 0x01, 0x08, 0x49, 0x01, 0x82, 0x00, 0x04, 0x01, 0x02, 0x00, 0x04,
+    0x03, 0x81, 0x28, 0x82, 0x00, 0x17, 0x51, 0x16, 0x01, 0x00, 0x00, 0x60, 0x07, 0x35, 0x20, 0x6C,
+    0xA0, 0x17, 0x0C, 0x1F, 0x3D, 0x85, 0x71, 0x30, 0x78, 0x4C, 0x2E, 0x4B, 0x57, 0x43, 0x82, 0x38,
+    0x03, 0x2C, 0x7B, 0x65, 0x84, 0x81, 0x38, 0x87, 0x84, 0x21, 0x38, 0x7C, 0x77, 0x36, 0x52, 0x04,
+    0x56, 0x25, 0x01, 0x56, 0x2D, 0x76, 0x1B, 0x0C, 0x18, 0x00, 0x01, 0x29, 0x4F, 0x00, 0x01, 0x00,
+    0x49, 0x23, 0x3F, 0x04, 0x45, 0x00, 0x01, 0x05, 0x5F, 0x59, 0x2F, 0x88, 0x1B, 0x31, 0x20, 0x14,
+    0x4D, 0x83, 0x72, 0x2E, 0x40, 0x14, 0x30, 0x00, 0x04, 0x04, 0x49, 0x19, 0x7D, 0x43, 0x43, 0x66,
+    0x30, 0x45, 0x75, 0x07, 0x02, 0x00, 0x25, 0xA3, 0x6D, 0x84, 0x31, 0x17, 0x2A, 0x1D, 0x02, 0x42,
+    0x36, 0x76, 0x0C, 0x9C, 0x0C, 0x66, 0x66, 0x7D, 0x43, 0x8B, 0x66, 0x17, 0x17, 0x43, 0x56, 0x42,
+    0x3E, 0x66, 0x39, 0x76, 0x82, 0x17, 0x0D, 0x27, 0x3C, 0x18, 0x49, 0x00, 0x5D, 0x75, 0x82, 0x56,
+    0x00, 0x25, 0x1E, 0x52, 0x00, 0x82, 0x1F, 0x01, 0x02, 0x01, 0x82, 0x00, 0x03, 0x07, 0x00, 0x02,
+    0x01, 0x83, 0x00, 0x01, 0x02, 0x01, 0x84, 0x00, 0x01, 0x3C, 0x91, 0x84, 0x00, 0x1B, 0x01, 0x48,
+    0x00, 0x63, 0x1A, 0x00, 0x07, 0x7B, 0x5D, 0x7B, 0x5D, 0x22, 0x00, 0x00, 0x7B, 0x98, 0x7B, 0x5D,
+    0x5D, 0x98, 0x88, 0x9E, 0x88, 0x7A, 0x98, 0x07, 0x96, 0x01, 0x82, 0x00, 0x03, 0x04, 0x00, 0x01,
+    0x1C, 0x84, 0x00, 0x07, 0x01, 0x00, 0x00, 0x02, 0x07, 0x0A, 0x03, 0x01, 0x82, 0x00, 0x0C, 0x02,
+    0x01, 0x00, 0x00, 0x01, 0x51, 0x51, 0x00, 0x00, 0x02, 0x00, 0x45, 0x60, 0x83, 0x00, 0x15, 0x35,
+    0x20, 0x1E, 0xA0, 0x43, 0x0C, 0x1F, 0x32, 0x6B, 0x5E, 0x3E, 0x81, 0x72, 0x4C, 0x1E, 0x57, 0x44,
+    0x7C, 0x38, 0x9D, 0x5D, 0x26, 0x81, 0x38, 0x89, 0x84, 0x19, 0x38, 0x84, 0x77, 0x70, 0x4E, 0x04,
+    0x29, 0x0C, 0x42, 0x76, 0x3E, 0x76, 0x17, 0x1B, 0x61, 0x00, 0x00, 0x42, 0x66, 0x86, 0x00, 0x45,
+    0x01, 0x00, 0x18, 0x05, 0x82, 0x00, 0x04, 0x90, 0x02, 0x02, 0x75, 0x00, 0x55, 0x83, 0x43, 0x4D,
+    0x1E, 0x64, 0x12, 0x72, 0x4C, 0x31, 0x52, 0x05, 0x2B, 0x2C, 0x64, 0x84, 0x31, 0x0C, 0x17, 0x66,
+    0x27, 0x4E, 0x42, 0x42, 0x89, 0x6C, 0x1B, 0xA3, 0x6D, 0x4D, 0x83, 0x84, 0x31, 0x31, 0x7C, 0x83,
+    0x01, 0x2D, 0x3E, 0x39, 0x76, 0x76, 0x8B, 0x66, 0x31, 0x0F, 0x20, 0x4D, 0x66, 0x17, 0xA0, 0x66,
+    0x31, 0x45, 0x3F, 0x9C, 0x43, 0x0C, 0x17, 0x43, 0x4D, 0x42, 0x56, 0x42, 0x3F, 0x45, 0x00, 0x75,
+    0x01, 0x00, 0x00, 0x60, 0x18, 0x07, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x00, 0x49, 0x07, 0x22,
+    0x02, 0x01, 0x22, 0x83, 0x00, 0x01, 0x02, 0x01, 0x84, 0x00, 0x01, 0x3C, 0x3D, 0x84, 0x00, 0x06,
+    0x04, 0x13, 0x00, 0x7E, 0x1F, 0x00, 0x07, 0x84, 0x00, 0x0C, 0x7B, 0x5D, 0x00, 0x00, 0x34, 0x7B,
+    0x98, 0x28, 0x28, 0x98, 0x60, 0x5B, 0x0A, 0x81, 0x07, 0x83, 0x00, 0x01, 0x5D, 0x00, 0x81, 0x01,
+    0x87, 0x00, 0x04, 0x06, 0x01, 0x0A, 0x01, 0x03, 0x82, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x02,
+    0x84, 0x00, 0x1E, 0x9F, 0x00, 0x49, 0x00, 0x01, 0x00, 0x00, 0x30, 0x20, 0x1E, 0x43, 0x17, 0x44,
+    0x1F, 0x0D, 0x65, 0x2E, 0x33, 0x1D, 0x67, 0x4D, 0x39, 0x44, 0x0C, 0x61, 0x5F, 0x07, 0x80, 0x38,
+    0x9D, 0x38, 0x84, 0x84, 0x86, 0x38, 0x1F, 0x39, 0x99, 0x61, 0x00, 0x95, 0x3E, 0x36, 0x39, 0x0C,
+    0x8B, 0x76, 0x8B, 0x8B, 0x1F, 0x00, 0x1A, 0x94, 0x9C, 0x1A, 0x00, 0x75, 0x01, 0x04, 0x05, 0x75,
+    0x04, 0x01, 0x3C, 0x00, 0x04, 0x03, 0x01, 0x03, 0x64, 0x43, 0x1E, 0x4D, 0x84, 0x38, 0x0A, 0x67,
+    0x1D, 0x83, 0x1D, 0x20, 0x38, 0x38, 0x1D, 0x14, 0x14, 0x23, 0x81, 0x1E, 0x83, 0x23, 0x0B, 0x8E,
+    0x6D, 0x43, 0x64, 0x38, 0x83, 0x7D, 0x4D, 0x14, 0x00, 0x3F, 0x3E, 0x82, 0x76, 0x1A, 0x66, 0x76,
+    0x83, 0x2A, 0x7D, 0x81, 0x4D, 0x4D, 0x66, 0x17, 0x17, 0x23, 0x3C, 0x7E, 0x43, 0x66, 0x17, 0x1E,
+    0x17, 0x17, 0x25, 0x25, 0x5F, 0x49, 0x07, 0x00, 0x22, 0x88, 0x00, 0x08, 0x01, 0x00, 0x00, 0x56,
+    0x4F, 0x03, 0x01, 0x06, 0x22, 0x84, 0x00, 0x80, 0x02, 0x84, 0x00, 0x01, 0x3C, 0x3D, 0x85, 0x00,
+    0x05, 0x58, 0x00, 0x52, 0x30, 0x63, 0x01, 0x83, 0x00, 0x80, 0x51, 0x84, 0x00, 0x81, 0x02, 0x83,
+    0x00, 0x09, 0x4F, 0x91, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x34, 0x00, 0x81, 0x01, 0x87, 0x00,
+    0x81, 0x02, 0x02, 0x0A, 0x01, 0x06, 0x82, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x02, 0x85, 0x00,
+    0x80, 0x01, 0x84, 0x00, 0x13, 0x1A, 0x24, 0x6C, 0x1E, 0x43, 0x44, 0x56, 0x5A, 0x15, 0x50, 0x2E,
+    0x4C, 0xA0, 0x57, 0x8B, 0xA0, 0x95, 0x62, 0x00, 0x5B, 0x81, 0x84, 0x84, 0x38, 0x81, 0x84, 0x26,
+    0x7C, 0x8B, 0x7D, 0x7C, 0x31, 0x2C, 0x84, 0x76, 0x4A, 0xA0, 0x00, 0x29, 0x3E, 0x43, 0x0C, 0x1B,
+    0x39, 0x8B, 0x8B, 0x39, 0x25, 0x00, 0x00, 0x6C, 0x94, 0x3E, 0x29, 0x04, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x02, 0x3D, 0x34, 0x04, 0x02, 0x5D, 0x25, 0x64, 0xA0, 0x1E, 0x1E, 0x84, 0x1D, 0x38, 0x64,
+    0x64, 0x14, 0x83, 0x1D, 0x1D, 0x64, 0x38, 0x12, 0x12, 0x33, 0x86, 0x18, 0x06, 0x1C, 0x68, 0x79,
+    0x02, 0x00, 0x4E, 0x0E, 0x17, 0x7C, 0x38, 0x31, 0x9C, 0x66, 0x20, 0x00, 0x30, 0x3E, 0x82, 0x76,
+    0x18, 0x0C, 0x17, 0x31, 0x4D, 0x7D, 0x4D, 0x81, 0x4D, 0x17, 0x66, 0x17, 0x43, 0x14, 0x6A, 0x29,
+    0x1E, 0x76, 0x1E, 0x42, 0x7E, 0x1A, 0x16, 0x1A, 0x00, 0x04, 0x88, 0x00, 0x80, 0x04, 0x82, 0x00,
+    0x06, 0x02, 0x85, 0x86, 0x02, 0x05, 0x03, 0x22, 0x84, 0x00, 0x80, 0x02, 0x84, 0x00, 0x01, 0x3C,
+    0x1C, 0x83, 0x00, 0x17, 0x02, 0x00, 0x05, 0x03, 0x90, 0x26, 0x34, 0x04, 0x00, 0x00, 0x04, 0x18,
+    0x7E, 0x00, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0x83, 0x00, 0x80, 0x86,
+    0x84, 0x00, 0x01, 0x02, 0x01, 0x87, 0x00, 0x04, 0x06, 0x02, 0x05, 0x02, 0x49, 0x82, 0x00, 0x01,
+    0x06, 0x01, 0x8F, 0x00, 0x11, 0x29, 0x18, 0x7E, 0x0C, 0x6C, 0x26, 0x78, 0x65, 0x2E, 0x0F, 0x17,
+    0x1B, 0xA3, 0x4E, 0x28, 0x00, 0x07, 0x33, 0x82, 0x38, 0x82, 0x84, 0x1F, 0x83, 0x7C, 0x17, 0x0C,
+    0x77, 0x1B, 0x70, 0x44, 0x6C, 0x9C, 0x76, 0x1B, 0x70, 0xA0, 0x34, 0x1F, 0x76, 0x0C, 0x1B, 0x39,
+    0x39, 0x1B, 0x0C, 0x17, 0x89, 0x45, 0x00, 0x25, 0x4A, 0x3E, 0x1B, 0x3F, 0x82, 0x00, 0x07, 0x0A,
+    0x00, 0x02, 0x0A, 0x04, 0x00, 0x9F, 0x00, 0x09, 0x64, 0x4D, 0x43, 0x84, 0x38, 0x14, 0x38, 0x12,
+    0x64, 0x20, 0x81, 0x1D, 0x81, 0x38, 0x82, 0x12, 0x1D, 0x4B, 0x91, 0x8A, 0x79, 0x37, 0x52, 0x5F,
+    0x07, 0x00, 0x95, 0x0E, 0x7C, 0x7C, 0x83, 0x7C, 0x17, 0x8B, 0x14, 0x00, 0x35, 0x3E, 0x1B, 0x76,
+    0x1B, 0x66, 0x17, 0x4D, 0x4D, 0x7D, 0x17, 0x82, 0x4D, 0x81, 0x7D, 0x15, 0x4D, 0xA0, 0x23, 0x29,
+    0x95, 0x3F, 0x95, 0x7E, 0x30, 0x21, 0x42, 0x60, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x08, 0x04, 0x01, 0x55, 0x00, 0x06, 0x96, 0x03, 0x0A, 0x02, 0x82, 0x00,
+    0x80, 0x07, 0x85, 0x00, 0x01, 0x3C, 0x1C, 0x83, 0x00, 0x06, 0x48, 0x00, 0x00, 0x13, 0x1F, 0x26,
+    0x02, 0x82, 0x00, 0x02, 0x01, 0x60, 0x18, 0x83, 0x00, 0x06, 0x45, 0x86, 0x00, 0x00, 0x18, 0x63,
+    0x02, 0x86, 0x00, 0x80, 0x7B, 0x81, 0x00, 0x81, 0x02, 0x86, 0x00, 0x05, 0x01, 0x07, 0x02, 0x05,
+    0x48, 0x1C, 0x82, 0x00, 0x06, 0x03, 0x06, 0x04, 0x00, 0x02, 0x04, 0x02, 0x85, 0x00, 0x80, 0x01,
+    0x82, 0x00, 0x43, 0x01, 0x00, 0x07, 0x2D, 0x1B, 0x44, 0x56, 0x2C, 0x33, 0x2A, 0x3E, 0x6C, 0x3F,
+    0x1F, 0x9F, 0x00, 0x63, 0x42, 0x7C, 0x84, 0x84, 0x7C, 0x0C, 0x57, 0x1B, 0x77, 0x77, 0x0C, 0x57,
+    0x1B, 0x3E, 0x57, 0x3F, 0x83, 0x9C, 0x76, 0x9C, 0x7D, 0x57, 0x07, 0x56, 0x76, 0x39, 0x0C, 0x39,
+    0x39, 0x0C, 0x0C, 0x1E, 0x17, 0x16, 0x00, 0x63, 0x3E, 0x76, 0x76, 0x8B, 0x07, 0x00, 0x00, 0x01,
+    0x62, 0x4F, 0x49, 0x02, 0x00, 0x7B, 0x00, 0x05, 0x64, 0x4D, 0x7C, 0x38, 0x38, 0x14, 0x82, 0x38,
+    0x81, 0x1D, 0x81, 0x38, 0x01, 0x67, 0x12, 0x82, 0x2E, 0x33, 0x00, 0x79, 0x67, 0x53, 0x18, 0x80,
+    0x60, 0x00, 0x35, 0x0E, 0x31, 0x84, 0x12, 0x64, 0x9C, 0x76, 0x21, 0x00, 0x35, 0x3E, 0x8B, 0x76,
+    0x8B, 0x66, 0x7D, 0x4D, 0x4D, 0x66, 0x17, 0x7D, 0x1E, 0x17, 0x4D, 0x4D, 0x43, 0x43, 0x0C, 0x2D,
+    0x63, 0x00, 0x25, 0x2D, 0x3F, 0x82, 0x22, 0x00, 0x02, 0x00, 0x00, 0x03, 0x45, 0x49, 0x88, 0x00,
+    0x08, 0x3C, 0x3B, 0x00, 0x05, 0x3C, 0x62, 0x0A, 0x02, 0x04, 0x83, 0x00, 0x80, 0x01, 0x83, 0x00,
+    0x01, 0x86, 0x3D, 0x83, 0x00, 0x16, 0x0A, 0x01, 0x00, 0x05, 0x03, 0x53, 0x52, 0x07, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x5D, 0x16, 0x1C, 0x02, 0x07, 0x07, 0x00, 0x00, 0x07, 0x01, 0x82, 0x00, 0x80,
+    0x04, 0x82, 0x00, 0x05, 0x34, 0x51, 0x22, 0x00, 0x01, 0x02, 0x84, 0x00, 0x07, 0x5D, 0x00, 0x00,
+    0x01, 0x01, 0x1C, 0x48, 0x03, 0x82, 0x00, 0x05, 0x06, 0x03, 0x07, 0x00, 0x02, 0x03, 0x83, 0x00,
+    0x04, 0x04, 0x00, 0x00, 0x02, 0x9F, 0x83, 0x00, 0x0D, 0x01, 0x18, 0x16, 0x2D, 0x60, 0x35, 0x0F,
+    0x2B, 0x16, 0x86, 0x03, 0x02, 0x03, 0x25, 0x82, 0xA0, 0x02, 0x43, 0x0C, 0x57, 0x84, 0x0C, 0x28,
+    0x8B, 0x1B, 0x1B, 0x77, 0x1E, 0x7C, 0x7C, 0x76, 0x77, 0x7C, 0x7C, 0xA3, 0x7B, 0x18, 0x39, 0x0C,
+    0x44, 0x39, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x42, 0x01, 0x00, 0x42, 0x3E, 0x4A, 0x17, 0x00, 0x52,
+    0x82, 0x02, 0x87, 0x5B, 0x90, 0x02, 0x04, 0x05, 0x04, 0x01, 0x64, 0x31, 0x82, 0x84, 0x36, 0x14,
+    0x38, 0x38, 0x64, 0x64, 0x1D, 0x2C, 0x21, 0x2C, 0xA2, 0x19, 0x30, 0xA1, 0x16, 0x2B, 0x90, 0x37,
+    0x2B, 0x26, 0x02, 0x00, 0x95, 0x0E, 0x84, 0x84, 0x64, 0x7C, 0x8B, 0x3E, 0x2D, 0x00, 0x35, 0x3E,
+    0x0C, 0x9C, 0x9C, 0x66, 0x7D, 0x4D, 0x4D, 0x17, 0x17, 0x4D, 0x4D, 0x17, 0x4D, 0x43, 0x66, 0x23,
+    0x16, 0x4F, 0x96, 0x3C, 0x01, 0x07, 0x83, 0x00, 0x07, 0x07, 0x86, 0x47, 0x08, 0x22, 0x00, 0x00,
+    0x04, 0x85, 0x00, 0x07, 0x07, 0x55, 0x01, 0x00, 0x58, 0x58, 0x1C, 0x05, 0x85, 0x00, 0x80, 0x06,
+    0x83, 0x00, 0x0F, 0x3D, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x91, 0x08, 0x01, 0x1A,
+    0x63, 0x00, 0x5D, 0x82, 0x00, 0x01, 0x07, 0x1A, 0x89, 0x00, 0x80, 0x34, 0x82, 0x00, 0x06, 0x51,
+    0x88, 0x28, 0x00, 0x00, 0x01, 0x02, 0x84, 0x00, 0x07, 0x5D, 0x01, 0x02, 0x00, 0x01, 0x0A, 0x48,
+    0x03, 0x82, 0x00, 0x07, 0x06, 0x03, 0x03, 0x00, 0x00, 0x08, 0x04, 0x00, 0x81, 0x02, 0x82, 0x00,
+    0x17, 0x02, 0x01, 0x22, 0x04, 0x01, 0x07, 0x00, 0x49, 0x7A, 0x1A, 0x01, 0x22, 0x1C, 0x3B, 0x13,
+    0x96, 0x96, 0x16, 0x23, 0x0C, 0x17, 0xA0, 0xA0, 0x44, 0x84, 0x0C, 0x2A, 0xA0, 0x4D, 0x0C, 0x57,
+    0x57, 0x17, 0x17, 0x76, 0x1B, 0x77, 0x1B, 0x1B, 0x70, 0x44, 0x02, 0x5F, 0x1B, 0x76, 0x57, 0x39,
+    0x0C, 0x17, 0x0C, 0x17, 0x0C, 0x1E, 0x45, 0x02, 0x56, 0x3E, 0x94, 0x0C, 0x00, 0x25, 0x3E, 0x1A,
+    0x82, 0x19, 0x78, 0x01, 0x00, 0x3D, 0x04, 0x55, 0x1D, 0x83, 0x64, 0x64, 0x1D, 0x20, 0x38, 0x38,
+    0x31, 0x1D, 0x14, 0x38, 0x38, 0x12, 0x12, 0x38, 0x20, 0x20, 0x39, 0x6E, 0x05, 0x18, 0x63, 0x1F,
+    0x16, 0x4B, 0x61, 0x0E, 0x38, 0x7C, 0x1B, 0x8B, 0x76, 0x3E, 0x24, 0x01, 0x25, 0x1B, 0x66, 0x76,
+    0x7D, 0x7D, 0x66, 0x1E, 0x4D, 0x66, 0x43, 0x17, 0x21, 0x20, 0x9C, 0x6C, 0x25, 0x07, 0x03, 0x3C,
+    0x18, 0x29, 0x2D, 0x2D, 0x00, 0x00, 0x01, 0x03, 0x96, 0x73, 0x32, 0x06, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x02, 0x00, 0x00, 0x60, 0x1C, 0x91, 0x3B, 0x00, 0x03, 0x47, 0x58, 0x08, 0x01, 0x83, 0x00,
+    0x15, 0x02, 0x01, 0x62, 0x02, 0x34, 0x00, 0x00, 0x05, 0x96, 0x02, 0x00, 0x00, 0x01, 0x48, 0x41,
+    0x00, 0x07, 0x05, 0x02, 0x00, 0x5D, 0x51, 0x85, 0x00, 0x14, 0x04, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x98, 0x00, 0x07, 0x00, 0x7A, 0x7F, 0x28, 0x00, 0x00, 0x01, 0x02, 0x86,
+    0x00, 0x05, 0x01, 0x00, 0x01, 0x0A, 0x05, 0x62, 0x82, 0x00, 0x31, 0x01, 0x03, 0x03, 0x02, 0x00,
+    0x01, 0x49, 0x00, 0x00, 0x01, 0x08, 0x02, 0x00, 0x01, 0x01, 0x03, 0x05, 0x03, 0x0A, 0x4F, 0x1A,
+    0x7A, 0x4E, 0x45, 0x32, 0x65, 0x5C, 0x03, 0x52, 0x89, 0x39, 0xA0, 0xA0, 0x43, 0x17, 0xA0, 0xA0,
+    0x0C, 0xA0, 0x6C, 0xA0, 0x17, 0x14, 0x4D, 0x17, 0x77, 0x84, 0x84, 0x77, 0x3E, 0x81, 0x36, 0x82,
+    0x1B, 0x03, 0x0C, 0x00, 0x16, 0x4A, 0x82, 0x39, 0x16, 0x1B, 0x39, 0x8B, 0x66, 0x66, 0x81, 0x52,
+    0x00, 0x01, 0x43, 0x94, 0x3E, 0x63, 0x42, 0x4A, 0x9C, 0x3E, 0x11, 0x11, 0x3F, 0x07, 0x47, 0x02,
+    0x0B, 0x64, 0x1D, 0x1D, 0x83, 0x14, 0x1D, 0x12, 0x64, 0x66, 0x7D, 0x7D, 0x84, 0x85, 0x12, 0x13,
+    0x64, 0x4B, 0x24, 0x7D, 0x0C, 0x1B, 0x3E, 0x76, 0x0C, 0x0E, 0x84, 0x84, 0x8B, 0x9C, 0x76, 0x76,
+    0x43, 0x00, 0x6E, 0x3E, 0x82, 0x66, 0x2C, 0x7D, 0x7C, 0x4D, 0x17, 0x7D, 0x7D, 0x1E, 0x20, 0x30,
+    0x25, 0x60, 0x00, 0x07, 0x16, 0x35, 0x23, 0x8B, 0x42, 0x56, 0x01, 0x49, 0x08, 0x3B, 0x54, 0x01,
+    0x07, 0x22, 0x1C, 0x06, 0x1C, 0x03, 0x45, 0x1C, 0x04, 0x00, 0x52, 0x6A, 0x37, 0x03, 0x00, 0x85,
+    0x8A, 0x13, 0x08, 0x02, 0x83, 0x00, 0x19, 0x02, 0x01, 0x0A, 0x00, 0x5D, 0x00, 0x00, 0x0A, 0x3B,
+    0x01, 0x00, 0x02, 0x1C, 0x02, 0x55, 0x3D, 0x00, 0x3B, 0x22, 0x5D, 0x00, 0x51, 0x88, 0x7A, 0x28,
+    0x51, 0x84, 0x00, 0x80, 0x04, 0x85, 0x00, 0x0A, 0x34, 0x00, 0x22, 0x00, 0x51, 0x74, 0x34, 0x00,
+    0x00, 0x22, 0x02, 0x88, 0x00, 0x03, 0x01, 0x3C, 0x05, 0x03, 0x82, 0x00, 0x1F, 0x02, 0x03, 0x0A,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x63, 0x07, 0x04, 0x00, 0x07, 0x03, 0x62, 0x03,
+    0x00, 0x1A, 0x1F, 0x32, 0x40, 0x90, 0x49, 0x16, 0x18, 0x51, 0x3F, 0x0C, 0x44, 0x84, 0xA0, 0x2F,
+    0x44, 0x0C, 0x89, 0xA0, 0x2D, 0x6E, 0x17, 0x0C, 0x83, 0x38, 0x84, 0x77, 0x1B, 0x36, 0x3E, 0x70,
+    0x77, 0x84, 0x7C, 0x16, 0x30, 0x1B, 0x0C, 0x39, 0x3E, 0x39, 0x0C, 0x76, 0x17, 0x66, 0x21, 0x2D,
+    0x5D, 0x00, 0x6E, 0x94, 0x4A, 0x35, 0x31, 0x3E, 0x3E, 0x36, 0x4C, 0x0F, 0x39, 0x1E, 0x53, 0x00,
+    0x81, 0x2C, 0x84, 0x38, 0x39, 0x31, 0x7D, 0x7D, 0x9C, 0x7C, 0x38, 0x12, 0x12, 0x2C, 0x64, 0x12,
+    0x12, 0x72, 0x2C, 0x38, 0x38, 0x64, 0x31, 0x76, 0x44, 0x2F, 0x84, 0x8C, 0x0F, 0x7D, 0x76, 0x36,
+    0x76, 0x07, 0x53, 0x3E, 0x0C, 0x66, 0x7D, 0x17, 0x4D, 0x83, 0x7C, 0x7D, 0x43, 0x4D, 0x81, 0x29,
+    0x07, 0x01, 0x18, 0x30, 0x4D, 0x27, 0x7E, 0x5F, 0x03, 0x01, 0x91, 0x03, 0x79, 0x0B, 0x5D, 0x83,
+    0x00, 0x0F, 0x49, 0x05, 0x06, 0x02, 0x06, 0x01, 0x04, 0x82, 0x41, 0x37, 0x00, 0x05, 0x73, 0x3C,
+    0x08, 0x0A, 0x83, 0x00, 0x03, 0x02, 0x01, 0x01, 0x62, 0x83, 0x00, 0x11, 0x0A, 0x3B, 0x03, 0x00,
+    0x06, 0x47, 0x02, 0x73, 0x37, 0x00, 0x03, 0x51, 0x88, 0x88, 0x51, 0x51, 0x7B, 0x28, 0x82, 0x7F,
+    0x16, 0x74, 0x88, 0x7A, 0x28, 0x7A, 0x88, 0x7A, 0x74, 0x7A, 0x00, 0x7B, 0x74, 0x7A, 0x51, 0x04,
+    0x7B, 0x04, 0x00, 0x00, 0x01, 0x02, 0x75, 0x01, 0x83, 0x00, 0x81, 0x02, 0x0D, 0x00, 0x03, 0x3C,
+    0x48, 0x06, 0x00, 0x02, 0x00, 0x04, 0x03, 0x0A, 0x06, 0x00, 0x02, 0x82, 0x00, 0x4B, 0x02, 0x00,
+    0x91, 0x37, 0x08, 0x3C, 0x05, 0x0A, 0x3C, 0x3B, 0x0B, 0x32, 0x32, 0x92, 0x03, 0x00, 0x95, 0x57,
+    0xA0, 0x3F, 0x63, 0x1A, 0x23, 0x0C, 0x44, 0xA0, 0xA0, 0x0C, 0x44, 0x24, 0x6E, 0x25, 0x2D, 0x23,
+    0x0C, 0x23, 0x31, 0x84, 0x76, 0x1B, 0x77, 0x57, 0x3E, 0x7D, 0x84, 0x38, 0x7C, 0x57, 0x1B, 0x36,
+    0x3E, 0x3E, 0x1B, 0x76, 0x8B, 0x8B, 0x66, 0x17, 0x21, 0x1E, 0x45, 0x00, 0x75, 0x39, 0x4A, 0x17,
+    0x3E, 0x4A, 0x36, 0x64, 0x2E, 0x31, 0x39, 0x1B, 0x39, 0x75, 0x01, 0x2C, 0x38, 0x82, 0x12, 0x0F,
+    0x38, 0x12, 0x12, 0x64, 0x66, 0x7D, 0x66, 0x84, 0x12, 0x38, 0x31, 0x0C, 0x14, 0x38, 0x72, 0xA2,
+    0x82, 0x12, 0x3C, 0xA2, 0x38, 0x46, 0x6D, 0x21, 0x13, 0x33, 0x66, 0x66, 0x1D, 0x1D, 0x79, 0x50,
+    0x7C, 0x76, 0x17, 0x17, 0x4D, 0x7D, 0x66, 0x83, 0x83, 0x4D, 0x61, 0x1F, 0x07, 0x00, 0x00, 0x25,
+    0x23, 0x29, 0x26, 0x02, 0x1C, 0x4F, 0x08, 0x05, 0x79, 0x96, 0x01, 0x00, 0x02, 0x79, 0x16, 0x63,
+    0x00, 0x0A, 0x0A, 0x07, 0x03, 0x01, 0x07, 0x37, 0x26, 0x3D, 0x01, 0x37, 0x6B, 0x60, 0x60, 0x03,
+    0x83, 0x00, 0x03, 0x02, 0x00, 0x01, 0x03, 0x83, 0x00, 0x12, 0x3D, 0x3B, 0x06, 0x00, 0x01, 0x47,
+    0x01, 0x0A, 0x55, 0x00, 0x00, 0x7B, 0x4E, 0x59, 0x7F, 0x7B, 0x60, 0x7B, 0x74, 0x88, 0x69, 0x06,
+    0x4E, 0x7A, 0x00, 0x28, 0x59, 0x7A, 0x88, 0x84, 0x00, 0x03, 0x01, 0x06, 0x45, 0x07, 0x83, 0x00,
+    0x81, 0x01, 0x3B, 0x00, 0x03, 0x96, 0x03, 0x01, 0x02, 0x02, 0x00, 0x04, 0x03, 0x08, 0x03, 0x00,
+    0x00, 0x07, 0x07, 0x02, 0x00, 0x00, 0x01, 0x48, 0x03, 0x03, 0x91, 0x03, 0x91, 0x03, 0x47, 0x26,
+    0x0A, 0x02, 0x00, 0x00, 0x07, 0x28, 0x25, 0x89, 0x89, 0x7E, 0x3B, 0x6E, 0xA0, 0x0C, 0x6C, 0x3F,
+    0x63, 0x53, 0x35, 0x48, 0x6C, 0x39, 0x21, 0x20, 0x4E, 0x61, 0x99, 0x1B, 0x1B, 0x3E, 0x1B, 0x82,
+    0x38, 0x1D, 0x7D, 0x36, 0x36, 0x1B, 0x1B, 0x39, 0x8B, 0x76, 0x39, 0x8B, 0x0C, 0x43, 0x42, 0x76,
+    0x29, 0x01, 0x79, 0x83, 0x94, 0x70, 0x76, 0x31, 0x38, 0x38, 0x33, 0x4D, 0x36, 0x8B, 0x36, 0x7E,
+    0x01, 0x2C, 0x38, 0x86, 0x12, 0x01, 0x64, 0x7C, 0x82, 0x38, 0x06, 0x64, 0x4D, 0x8B, 0x8B, 0x38,
+    0x72, 0x4C, 0x85, 0x12, 0x0C, 0x46, 0x43, 0x9D, 0x31, 0x1B, 0x7C, 0x12, 0x12, 0x6B, 0x72, 0x38,
+    0x1D, 0x66, 0x84, 0x17, 0x27, 0x43, 0x42, 0x32, 0x07, 0x06, 0x26, 0x35, 0x56, 0x01, 0x22, 0x01,
+    0x62, 0x03, 0x91, 0x07, 0x63, 0x06, 0x02, 0x1A, 0x6E, 0x2A, 0x11, 0x27, 0x3F, 0x00, 0x00, 0x91,
+    0x07, 0x02, 0x00, 0x02, 0x56, 0x3F, 0x00, 0x87, 0x55, 0x32, 0x28, 0x28, 0x01, 0x81, 0x04, 0x83,
+    0x00, 0x81, 0x01, 0x17, 0x02, 0x04, 0x00, 0x00, 0x49, 0x3B, 0x02, 0x00, 0x00, 0x05, 0x00, 0x0A,
+    0x80, 0x04, 0x34, 0x34, 0x7A, 0x7F, 0x4E, 0x88, 0x28, 0x16, 0x7A, 0x4E, 0x83, 0x69, 0x81, 0x46,
+    0x06, 0x69, 0x46, 0x88, 0x00, 0x04, 0x7A, 0x69, 0x81, 0x88, 0x82, 0x00, 0x81, 0x04, 0x81, 0x75,
+    0x80, 0x51, 0x84, 0x00, 0x81, 0x06, 0x0F, 0x01, 0x03, 0x3C, 0x03, 0x22, 0x00, 0x02, 0x00, 0x00,
+    0x03, 0x08, 0x05, 0x04, 0x04, 0x02, 0x0A, 0x88, 0x00, 0x01, 0x02, 0x01, 0x81, 0x00, 0x81, 0x03,
+    0x84, 0x00, 0x38, 0x01, 0x22, 0x18, 0x51, 0x02, 0x4F, 0x16, 0x28, 0x49, 0x7E, 0x81, 0x2D, 0x42,
+    0x57, 0x61, 0x30, 0xA0, 0x30, 0x95, 0x61, 0x17, 0x14, 0x0C, 0x39, 0x4D, 0x84, 0x38, 0x7D, 0x36,
+    0x3E, 0x39, 0x57, 0x0C, 0x76, 0x8B, 0x39, 0x76, 0x17, 0x1E, 0x42, 0x3E, 0x81, 0x90, 0x29, 0x52,
+    0x7D, 0x64, 0x38, 0x64, 0x31, 0x39, 0x27, 0x7C, 0x4A, 0x39, 0x94, 0x6E, 0x01, 0x2C, 0x38, 0x82,
+    0x12, 0x80, 0x38, 0x82, 0x12, 0x81, 0x38, 0x82, 0x12, 0x81, 0x38, 0x81, 0x64, 0x80, 0x12, 0x81,
+    0x72, 0x85, 0x12, 0x02, 0x38, 0x7D, 0x7C, 0x82, 0x9C, 0x81, 0x38, 0x32, 0x0B, 0x58, 0x12, 0x2C,
+    0x0C, 0x7C, 0x84, 0x66, 0x43, 0x7D, 0x23, 0x37, 0x13, 0x4B, 0x24, 0x24, 0x30, 0x5F, 0x01, 0x00,
+    0x00, 0x04, 0x02, 0x00, 0x0A, 0x80, 0x53, 0x64, 0x1D, 0x64, 0x6E, 0x8C, 0x6B, 0x24, 0x56, 0x00,
+    0x02, 0x07, 0x00, 0x00, 0x02, 0x7E, 0x1F, 0x00, 0x41, 0x41, 0x85, 0x51, 0x75, 0x02, 0x07, 0x84,
+    0x00, 0x07, 0x01, 0x00, 0x04, 0x00, 0x00, 0x04, 0x1C, 0x13, 0x82, 0x00, 0x1D, 0x02, 0x01, 0x06,
+    0x8C, 0x75, 0x7B, 0x00, 0x00, 0x1F, 0x88, 0x74, 0x7F, 0x69, 0x69, 0x74, 0x61, 0x4E, 0x1F, 0x96,
+    0x16, 0x46, 0x46, 0x4E, 0x28, 0x00, 0x28, 0x4E, 0x7F, 0x7A, 0x28, 0x83, 0x00, 0x03, 0x98, 0x5D,
+    0x49, 0x1C, 0x84, 0x00, 0x81, 0x48, 0x1C, 0x01, 0x05, 0x3C, 0x3D, 0x01, 0x00, 0x75, 0x00, 0x00,
+    0x91, 0x08, 0x0A, 0x00, 0x04, 0x00, 0x3C, 0x22, 0x00, 0x02, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00,
+    0x05, 0x0A, 0x03, 0x05, 0x82, 0x00, 0x33, 0x02, 0x01, 0x49, 0x03, 0x54, 0x3B, 0x00, 0x00, 0x01,
+    0x00, 0x34, 0x5D, 0x29, 0x4D, 0x43, 0x17, 0x0C, 0x61, 0x35, 0x23, 0x23, 0x4D, 0x1E, 0x42, 0x3F,
+    0x3F, 0x0C, 0x36, 0x6C, 0x17, 0x7C, 0x7D, 0x77, 0x76, 0x1B, 0x39, 0x76, 0x39, 0x8B, 0x76, 0x39,
+    0x17, 0x1E, 0x81, 0x76, 0x43, 0x84, 0x6A, 0x40, 0x38, 0x83, 0x4D, 0x82, 0x0C, 0x05, 0x2C, 0x31,
+    0x4A, 0x3E, 0x36, 0x61, 0x01, 0x2C, 0x38, 0x86, 0x12, 0x81, 0x38, 0x84, 0x12, 0x80, 0xA2, 0x81,
+    0x12, 0x81, 0x72, 0x85, 0x12, 0x3A, 0xA2, 0x31, 0x76, 0x66, 0x66, 0x39, 0x64, 0x12, 0x41, 0x02,
+    0x72, 0x7D, 0x43, 0x84, 0x84, 0x4D, 0x66, 0x20, 0x9A, 0x0D, 0x2A, 0x31, 0x7D, 0x7D, 0x20, 0x4F,
+    0x00, 0x01, 0x04, 0x00, 0x01, 0x68, 0x11, 0x2C, 0x64, 0x2B, 0x33, 0x19, 0x55, 0x80, 0x13, 0x27,
+    0x53, 0x00, 0x04, 0x00, 0x04, 0x00, 0x51, 0x30, 0x00, 0x92, 0x5C, 0x9A, 0x18, 0x75, 0x00, 0x00,
+    0x01, 0x84, 0x00, 0x02, 0x01, 0x00, 0x01, 0x82, 0x00, 0x01, 0x1C, 0x8A, 0x83, 0x00, 0x1C, 0x75,
+    0x03, 0x5B, 0x18, 0x74, 0x00, 0x18, 0x74, 0x61, 0x89, 0x69, 0x69, 0x46, 0x44, 0x61, 0x95, 0x51,
+    0x03, 0x95, 0x89, 0x4E, 0x61, 0x44, 0x69, 0x46, 0x69, 0x69, 0x74, 0x7A, 0x83, 0x00, 0x03, 0x28,
+    0x5D, 0x01, 0x06, 0x84, 0x00, 0x5E, 0x05, 0x0A, 0x22, 0x3B, 0x3C, 0x05, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x91, 0x58, 0x0A, 0x49, 0x00, 0x00, 0x62, 0x0B, 0x02, 0x5D, 0x02, 0x04, 0x00, 0x01, 0x00,
+    0x04, 0x06, 0x06, 0x01, 0x47, 0x9A, 0x03, 0x00, 0x00, 0x01, 0x91, 0x1C, 0x1C, 0x03, 0x03, 0x00,
+    0x04, 0x51, 0x1A, 0x02, 0x02, 0x82, 0x23, 0x20, 0x30, 0x35, 0x42, 0x2D, 0x2D, 0xA0, 0x1B, 0x17,
+    0x14, 0x81, 0x4D, 0x1E, 0x1B, 0x77, 0x83, 0x9C, 0x77, 0x76, 0x1B, 0x8B, 0x0C, 0x8B, 0x8B, 0x39,
+    0x39, 0x0C, 0x81, 0x81, 0x0C, 0x57, 0x4D, 0x38, 0x3B, 0x1A, 0x76, 0x66, 0x7D, 0x17, 0x17, 0x2A,
+    0x14, 0x4A, 0x70, 0x4A, 0x77, 0x81, 0x38, 0x8B, 0x12, 0x80, 0xA2, 0x83, 0x12, 0x81, 0x72, 0x85,
+    0x12, 0x3A, 0xA2, 0x64, 0x3E, 0x9C, 0x0C, 0x7C, 0x38, 0x12, 0x0B, 0x49, 0x68, 0x4D, 0x17, 0x4D,
+    0xA0, 0x43, 0x43, 0x30, 0x0D, 0x67, 0x4D, 0x1E, 0x4D, 0x20, 0x18, 0x01, 0x03, 0x02, 0x02, 0x1F,
+    0x11, 0x78, 0x19, 0x35, 0x19, 0x65, 0x2B, 0x5A, 0x33, 0x8C, 0x0D, 0x19, 0x35, 0x13, 0x00, 0x34,
+    0x00, 0x04, 0x07, 0x02, 0x96, 0x71, 0x73, 0x0B, 0x56, 0x75, 0x00, 0x04, 0x34, 0x85, 0x00, 0x01,
+    0x02, 0x07, 0x82, 0x00, 0x1D, 0x49, 0x92, 0x00, 0x00, 0x07, 0x02, 0x03, 0x02, 0x5B, 0x37, 0x74,
+    0x74, 0x22, 0x89, 0x89, 0xA3, 0x57, 0x44, 0x44, 0x46, 0x88, 0x7A, 0x2D, 0x74, 0x16, 0x16, 0x44,
+    0x57, 0x44, 0x57, 0x82, 0x44, 0x08, 0x4E, 0x34, 0x51, 0x07, 0x00, 0x00, 0x7A, 0x5D, 0x02, 0x85,
+    0x00, 0x05, 0x05, 0x08, 0x01, 0x3B, 0x3D, 0x03, 0x82, 0x00, 0x05, 0x01, 0x00, 0x91, 0x3C, 0x08,
+    0x03, 0x82, 0x00, 0x01, 0x13, 0x05, 0x83, 0x00, 0x08, 0x02, 0x01, 0x00, 0x01, 0x03, 0x01, 0x13,
+    0x0D, 0x37, 0x83, 0x00, 0x39, 0x02, 0x00, 0x00, 0x01, 0x4F, 0x03, 0x25, 0x17, 0x95, 0x00, 0x02,
+    0x6A, 0x5F, 0x30, 0x23, 0x2D, 0xA4, 0xA4, 0x6C, 0x36, 0x1B, 0x76, 0x0C, 0x17, 0x35, 0x20, 0x1E,
+    0x38, 0x84, 0x0C, 0x0C, 0x1B, 0x1B, 0x39, 0x0C, 0x39, 0x8B, 0x8B, 0x66, 0x81, 0x81, 0x0C, 0x8B,
+    0x39, 0x84, 0x92, 0x00, 0x24, 0x66, 0x7D, 0x17, 0x8B, 0x2A, 0x1E, 0x36, 0x9C, 0x7C, 0x64, 0x81,
+    0x38, 0x90, 0x12, 0x01, 0xA2, 0x72, 0x86, 0x12, 0x36, 0x38, 0x9C, 0x66, 0x7C, 0x38, 0x12, 0x12,
+    0x32, 0x16, 0x95, 0x3F, 0x7D, 0x4D, 0xA0, 0x7C, 0x11, 0x33, 0x64, 0x43, 0x31, 0x1E, 0x1E, 0x1A,
+    0x00, 0x05, 0x05, 0x75, 0x06, 0x67, 0x80, 0x53, 0x2B, 0x68, 0x65, 0x4C, 0x9D, 0x65, 0x33, 0x80,
+    0x50, 0x80, 0x11, 0x32, 0x3D, 0x00, 0x02, 0x04, 0x79, 0x00, 0x41, 0x47, 0x86, 0x13, 0x79, 0x62,
+    0x81, 0x01, 0x86, 0x00, 0x01, 0x01, 0x02, 0x82, 0x00, 0x0E, 0x91, 0x0B, 0x00, 0x22, 0x1C, 0x3C,
+    0x0A, 0x00, 0x26, 0x55, 0x34, 0x61, 0x51, 0x2D, 0x57, 0x83, 0x44, 0x07, 0x7A, 0x16, 0xA0, 0x95,
+    0x28, 0x4E, 0x2D, 0x4E, 0x81, 0x57, 0x83, 0x44, 0x81, 0x28, 0x06, 0x69, 0x51, 0x00, 0x75, 0x28,
+    0x34, 0x02, 0x85, 0x00, 0x81, 0x05, 0x03, 0x00, 0x3B, 0x91, 0x01, 0x82, 0x00, 0x0B, 0x01, 0x04,
+    0x91, 0x08, 0x08, 0x01, 0x00, 0x9F, 0x04, 0x00, 0x6B, 0x85, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00,
+    0x17, 0x0A, 0x87, 0x96, 0x5C, 0x55, 0x62, 0x04, 0x00, 0x01, 0x7B, 0x07, 0x9F, 0x01, 0x5F, 0x30,
+    0x55, 0x81, 0x17, 0x1F, 0x00, 0x73, 0x26, 0x7E, 0x42, 0x82, 0xA4, 0x01, 0x81, 0x36, 0x81, 0x39,
+    0x82, 0x1B, 0x1B, 0x1E, 0x23, 0x33, 0x12, 0x33, 0x33, 0x2C, 0x81, 0x66, 0x66, 0x76, 0x39, 0x0C,
+    0x66, 0x14, 0x1E, 0x0C, 0x76, 0x57, 0x84, 0x38, 0x00, 0x1A, 0x76, 0x4D, 0x7D, 0x66, 0x19, 0x81,
+    0x38, 0x82, 0x12, 0x81, 0x38, 0x87, 0x12, 0x80, 0x38, 0x82, 0x12, 0x09, 0xA2, 0x12, 0xA2, 0x12,
+    0x12, 0xA2, 0x72, 0x12, 0x12, 0xA2, 0x83, 0x12, 0x02, 0x38, 0x0C, 0x66, 0x82, 0x38, 0x31, 0x12,
+    0x37, 0x53, 0x21, 0x5F, 0x83, 0x4D, 0x4D, 0x20, 0x33, 0x12, 0x20, 0x81, 0x31, 0x4D, 0x7E, 0x02,
+    0x08, 0x05, 0x02, 0x01, 0x91, 0x68, 0x5E, 0x5E, 0x79, 0x2B, 0x4C, 0x2E, 0x80, 0x5B, 0x55, 0x5A,
+    0x2B, 0x3B, 0x2A, 0x26, 0x08, 0x01, 0x00, 0x18, 0x26, 0x01, 0x0D, 0x96, 0x22, 0x08, 0x47, 0x3D,
+    0x01, 0x87, 0x00, 0x01, 0x02, 0x01, 0x82, 0x00, 0x1A, 0x1C, 0x55, 0x00, 0x00, 0x0A, 0x79, 0x05,
+    0x00, 0xA1, 0x2B, 0x00, 0x51, 0x7B, 0x16, 0x57, 0x44, 0x44, 0x57, 0x89, 0x6C, 0x16, 0x7B, 0x02,
+    0x07, 0x00, 0x1A, 0x95, 0x84, 0x44, 0x05, 0x4E, 0x28, 0x61, 0x46, 0x7A, 0x00, 0x81, 0x7B, 0x87,
+    0x00, 0x05, 0x3D, 0x03, 0x00, 0x96, 0x03, 0x02, 0x82, 0x00, 0x2A, 0x04, 0x01, 0x01, 0x86, 0x3C,
+    0x03, 0x00, 0x02, 0x01, 0x02, 0x15, 0x50, 0x75, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x79,
+    0x3B, 0x37, 0x5C, 0x06, 0x00, 0x0A, 0x08, 0x00, 0x00, 0x0A, 0x3D, 0x02, 0x79, 0x0A, 0x52, 0x42,
+    0x23, 0x56, 0x55, 0x24, 0x2D, 0x7E, 0x82, 0xA4, 0x09, 0x23, 0x3E, 0x1B, 0x1B, 0x39, 0x39, 0x57,
+    0x77, 0x36, 0x2C, 0x82, 0x12, 0x18, 0xA2, 0x14, 0x0C, 0x66, 0x0C, 0x39, 0x0C, 0x0C, 0x23, 0x81,
+    0x0C, 0x0C, 0x39, 0x1B, 0x31, 0x86, 0x00, 0x42, 0x9C, 0x43, 0x7D, 0x19, 0x38, 0x1D, 0x31, 0x81,
+    0x38, 0x01, 0x38, 0x33, 0x84, 0x12, 0x81, 0xA2, 0x83, 0x12, 0x80, 0xA2, 0x84, 0x12, 0x01, 0xA2,
+    0x72, 0x86, 0x12, 0x4E, 0x64, 0x39, 0x4D, 0x2C, 0x64, 0x2C, 0x33, 0x79, 0x5E, 0x1E, 0x29, 0x35,
+    0x81, 0x83, 0x1D, 0x64, 0x84, 0x14, 0x1E, 0x31, 0x3F, 0x02, 0x03, 0x06, 0x00, 0x05, 0x73, 0x02,
+    0x16, 0x68, 0x2B, 0x68, 0x41, 0x65, 0x92, 0x32, 0x41, 0xA1, 0x6A, 0x6E, 0x90, 0x11, 0x8C, 0x87,
+    0x03, 0x00, 0x52, 0x01, 0x47, 0x40, 0x9A, 0x8A, 0x47, 0x92, 0x96, 0x02, 0x00, 0x3D, 0x01, 0x00,
+    0x00, 0x5D, 0x00, 0x00, 0x1C, 0x05, 0x00, 0x00, 0x04, 0x06, 0x58, 0x00, 0x00, 0x02, 0x08, 0x05,
+    0x00, 0x47, 0x53, 0x82, 0x00, 0x1C, 0x7B, 0x44, 0x57, 0x44, 0x57, 0x89, 0xA0, 0x81, 0x1A, 0x18,
+    0x6A, 0x85, 0x3C, 0x4E, 0x57, 0x77, 0x57, 0x57, 0x44, 0x61, 0x74, 0x61, 0x46, 0x1A, 0x04, 0x34,
+    0x00, 0x00, 0x04, 0x85, 0x00, 0x04, 0x3D, 0x03, 0x00, 0x96, 0x03, 0x83, 0x00, 0x0C, 0x07, 0x01,
+    0x02, 0x1C, 0x1C, 0x3C, 0x06, 0x00, 0x00, 0x75, 0x13, 0x5A, 0x0B, 0x82, 0x00, 0x27, 0x60, 0x01,
+    0x04, 0x00, 0x06, 0x3C, 0x47, 0x6B, 0x03, 0x00, 0x13, 0x0D, 0x08, 0x00, 0x01, 0x3B, 0x3D, 0x00,
+    0x00, 0x1F, 0x1E, 0x17, 0x30, 0x32, 0x53, 0x1E, 0x66, 0x42, 0xA4, 0xA4, 0x23, 0x3E, 0x0C, 0x39,
+    0x39, 0x1B, 0x39, 0x1B, 0x57, 0x2C, 0x83, 0x12, 0x19, 0x1D, 0x7C, 0x9C, 0x8B, 0x0C, 0x66, 0x4D,
+    0x81, 0x43, 0x17, 0x3E, 0x39, 0x42, 0x18, 0x00, 0x1F, 0x20, 0x0C, 0xA0, 0x76, 0x42, 0x4D, 0x77,
+    0x6C, 0x12, 0x38, 0x01, 0x12, 0x33, 0x86, 0x12, 0x83, 0xA2, 0x01, 0x12, 0xA2, 0x83, 0x12, 0x81,
+    0x72, 0x85, 0x12, 0x69, 0xA2, 0x31, 0x4D, 0x31, 0x23, 0x21, 0x27, 0x11, 0x79, 0x78, 0x81, 0x24,
+    0x82, 0x20, 0x1D, 0x20, 0x83, 0x14, 0x14, 0x81, 0x21, 0x63, 0x00, 0x00, 0x04, 0x47, 0x8C, 0x6B,
+    0x34, 0x1A, 0x19, 0x80, 0x18, 0x6B, 0x5C, 0x0D, 0x6A, 0x13, 0x43, 0x3F, 0x53, 0x4B, 0x53, 0x6E,
+    0x32, 0x03, 0x51, 0x82, 0x00, 0x71, 0x2E, 0x5C, 0x5C, 0x73, 0x8A, 0x08, 0x01, 0x03, 0x58, 0x03,
+    0x00, 0x00, 0x5D, 0x00, 0x02, 0x4F, 0x3D, 0x02, 0x75, 0x91, 0x00, 0x01, 0x34, 0x00, 0x00, 0x03,
+    0x73, 0x05, 0x1C, 0x35, 0x01, 0x02, 0x04, 0x00, 0x16, 0x57, 0x57, 0x44, 0x57, 0x95, 0x42, 0x7D,
+    0x5E, 0x2A, 0x1D, 0x29, 0x89, 0x70, 0x77, 0x57, 0x57, 0x44, 0x44, 0x74, 0x61, 0x74, 0x8B, 0x00,
+    0x05, 0x3D, 0x05, 0x00, 0x96, 0x03, 0x02, 0x82, 0x00, 0x37, 0x01, 0x06, 0x01, 0x03, 0x91, 0x3C,
+    0x48, 0x04, 0x00, 0x07, 0x91, 0x32, 0x41, 0x62, 0x00, 0x00, 0x18, 0x16, 0x00, 0x00, 0x02, 0x03,
+    0x08, 0x47, 0x07, 0x00, 0x62, 0x40, 0x5C, 0x1C, 0x04, 0x03, 0x96, 0x75, 0x75, 0x01, 0x6E, 0x4D,
+    0x23, 0x55, 0x78, 0x1E, 0x17, 0x0C, 0x3F, 0xA4, 0xA0, 0x36, 0x39, 0x39, 0x57, 0x0C, 0x8B, 0x1B,
+    0x77, 0x2C, 0x83, 0x12, 0x81, 0x38, 0x17, 0x83, 0x76, 0x0C, 0x8B, 0x0C, 0x1E, 0x17, 0x1B, 0x89,
+    0x1A, 0x01, 0x07, 0x11, 0x9C, 0x9C, 0x17, 0x0C, 0x3E, 0x21, 0x4D, 0x39, 0x20, 0x12, 0x38, 0x01,
+    0x12, 0x33, 0x85, 0x12, 0x03, 0xA2, 0x12, 0x2E, 0xA2, 0x82, 0x12, 0x80, 0xA2, 0x83, 0x12, 0x01,
+    0x72, 0xA2, 0x84, 0x12, 0x45, 0x64, 0x81, 0x14, 0x81, 0x20, 0x20, 0x24, 0x0F, 0x56, 0x4B, 0x20,
+    0x21, 0x82, 0x53, 0x83, 0x31, 0x83, 0x31, 0x4D, 0x4D, 0x1A, 0x00, 0x00, 0x03, 0x5C, 0x2E, 0x6B,
+    0x00, 0x04, 0x0A, 0x2A, 0x79, 0x01, 0x8C, 0x2C, 0x1E, 0x3F, 0x00, 0x7E, 0x1E, 0x79, 0x82, 0x5F,
+    0x42, 0x0B, 0x91, 0x1A, 0x63, 0x05, 0x40, 0x2E, 0x65, 0x41, 0x92, 0x58, 0x62, 0x03, 0x08, 0x58,
+    0x06, 0x34, 0x7B, 0x00, 0x00, 0x49, 0x3D, 0x01, 0x02, 0x49, 0x05, 0x85, 0x00, 0x14, 0x5C, 0x6B,
+    0x34, 0x4B, 0x45, 0x00, 0x22, 0x29, 0x00, 0x28, 0x61, 0x57, 0x77, 0x44, 0x4E, 0x29, 0x6E, 0x23,
+    0x61, 0x44, 0x70, 0x84, 0x57, 0x02, 0x44, 0x1F, 0x51, 0x8C, 0x00, 0x03, 0x3D, 0x3C, 0x00, 0x08,
+    0x81, 0x01, 0x83, 0x00, 0x11, 0x62, 0x0A, 0x00, 0x05, 0x08, 0x62, 0x00, 0x34, 0x01, 0x08, 0x85,
+    0x92, 0x37, 0x9F, 0x00, 0x00, 0x29, 0x18, 0x82, 0x00, 0x28, 0x08, 0x3D, 0x03, 0x00, 0x5D, 0x0D,
+    0x40, 0x13, 0x0A, 0x02, 0x0A, 0x08, 0x05, 0x03, 0x05, 0x2A, 0x43, 0x68, 0x68, 0x1E, 0xA0, 0x66,
+    0x23, 0xA4, 0xA0, 0x17, 0x76, 0x76, 0x39, 0x8B, 0x39, 0x57, 0x57, 0x2C, 0x38, 0x64, 0x64, 0x38,
+    0x38, 0x84, 0x66, 0x81, 0x39, 0x83, 0x43, 0x10, 0x29, 0x04, 0x00, 0x29, 0x4D, 0x8B, 0x7D, 0x66,
+    0x76, 0xA0, 0x6C, 0x3F, 0x81, 0x1B, 0x7C, 0x12, 0x38, 0x0B, 0x12, 0x33, 0x12, 0x12, 0xA2, 0x12,
+    0x12, 0xA2, 0x12, 0xA2, 0x40, 0xA2, 0x83, 0x12, 0x80, 0xA2, 0x82, 0x12, 0x80, 0x72, 0x81, 0xA2,
+    0x82, 0x12, 0x5B, 0x64, 0x46, 0x20, 0x31, 0x81, 0x20, 0x20, 0x21, 0x11, 0x63, 0x6E, 0x20, 0x24,
+    0x30, 0x26, 0x2C, 0x64, 0x20, 0x24, 0x30, 0x25, 0x01, 0x01, 0x32, 0x65, 0x40, 0x0D, 0x75, 0x00,
+    0x96, 0x3B, 0x2A, 0x5B, 0x6E, 0x45, 0x6C, 0x09, 0x25, 0x02, 0x0A, 0x42, 0x7E, 0x24, 0x2B, 0x2A,
+    0x71, 0x13, 0x25, 0x96, 0x0D, 0x0D, 0x65, 0x0D, 0x90, 0x92, 0x9A, 0x8A, 0x58, 0x03, 0x62, 0x1C,
+    0x02, 0x5D, 0x00, 0x01, 0x1C, 0x03, 0x01, 0x00, 0x22, 0x75, 0x00, 0x00, 0x34, 0x00, 0x01, 0x22,
+    0x03, 0x73, 0x02, 0x53, 0x1A, 0x00, 0x07, 0x8B, 0x1A, 0x00, 0x00, 0x16, 0x61, 0x57, 0x77, 0x82,
+    0x44, 0x80, 0x57, 0x82, 0x77, 0x04, 0x70, 0x77, 0x44, 0x2D, 0x7A, 0x8D, 0x00, 0x3B, 0x07, 0x03,
+    0x0A, 0x07, 0x1C, 0x48, 0x06, 0x07, 0x02, 0x00, 0x00, 0x49, 0x3C, 0x05, 0x85, 0x85, 0x48, 0x02,
+    0x00, 0x04, 0x05, 0x08, 0x1C, 0x37, 0x3B, 0x00, 0x00, 0x63, 0x95, 0x00, 0x04, 0x00, 0x02, 0x05,
+    0x07, 0x00, 0x00, 0x0B, 0x71, 0x13, 0x8A, 0x3C, 0x01, 0x01, 0x49, 0x1C, 0x05, 0x47, 0x21, 0x30,
+    0x5B, 0x1E, 0x17, 0x7D, 0xA0, 0x23, 0x23, 0x81, 0x1B, 0x0C, 0x83, 0x39, 0x1D, 0x77, 0x2C, 0x2C,
+    0x1D, 0x31, 0x7C, 0x84, 0x7C, 0x76, 0x0C, 0x1B, 0x43, 0x3F, 0x52, 0x7E, 0x86, 0x1A, 0x21, 0x7D,
+    0x66, 0x7D, 0x66, 0x9C, 0x23, 0x93, 0xA4, 0xA4, 0x25, 0x61, 0x83, 0x81, 0x38, 0x82, 0x12, 0x80,
+    0xA2, 0x82, 0x12, 0x50, 0xA2, 0x12, 0x40, 0x2E, 0x12, 0xA2, 0xA2, 0x12, 0xA2, 0x12, 0x12, 0x38,
+    0x33, 0x9D, 0xA2, 0xA2, 0x12, 0x33, 0x1D, 0x4D, 0x46, 0x1E, 0x81, 0x31, 0x20, 0x20, 0x24, 0x24,
+    0x18, 0x53, 0x20, 0x24, 0x4D, 0x7E, 0x0D, 0x5B, 0x27, 0x83, 0x56, 0x02, 0x3C, 0x15, 0x41, 0x55,
+    0x40, 0x0D, 0x3D, 0x92, 0x40, 0x0B, 0x19, 0x19, 0x2B, 0x73, 0x55, 0x35, 0x35, 0x56, 0x30, 0x47,
+    0x27, 0x35, 0x35, 0x53, 0x30, 0x03, 0x5F, 0x6B, 0x8C, 0x73, 0x9A, 0x90, 0x90, 0x85, 0x63, 0x03,
+    0x05, 0x00, 0x01, 0x00, 0x04, 0x88, 0x00, 0x1E, 0x02, 0x3B, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x13,
+    0x03, 0x26, 0x29, 0x00, 0x00, 0x1A, 0x29, 0x00, 0x00, 0x01, 0x00, 0x28, 0x4E, 0x6C, 0x57, 0x77,
+    0x70, 0x77, 0x57, 0x44, 0x61, 0x74, 0x51, 0x8F, 0x00, 0x52, 0x04, 0x03, 0x01, 0x04, 0x1C, 0x48,
+    0x1C, 0x07, 0x00, 0x00, 0x04, 0x01, 0x47, 0x6B, 0x41, 0x41, 0x08, 0x02, 0x00, 0x91, 0x3C, 0x0A,
+    0x03, 0x92, 0x90, 0x13, 0x00, 0x00, 0x29, 0x1A, 0x00, 0x02, 0x03, 0x48, 0x02, 0x00, 0x00, 0x13,
+    0x54, 0x47, 0x3B, 0x3C, 0x3D, 0x01, 0x02, 0x1C, 0x08, 0x03, 0x6A, 0x20, 0x19, 0x14, 0x17, 0x17,
+    0x43, 0x6C, 0x30, 0x0C, 0x39, 0x0C, 0x8B, 0x8B, 0x39, 0x39, 0x1B, 0x2C, 0x38, 0x83, 0x4D, 0x66,
+    0x9C, 0x0C, 0x39, 0x1B, 0x17, 0x6E, 0x08, 0x04, 0x16, 0x1E, 0x9C, 0x7D, 0x8B, 0x82, 0x66, 0x80,
+    0x2D, 0x81, 0x93, 0x84, 0x25, 0x81, 0x38, 0x82, 0x12, 0x82, 0xA2, 0x81, 0x12, 0x16, 0xA2, 0x5C,
+    0xA2, 0x12, 0xA2, 0xA2, 0x12, 0x12, 0xA2, 0x2C, 0x43, 0x83, 0x2A, 0x64, 0x64, 0x20, 0x4D, 0x4D,
+    0x1E, 0x46, 0x81, 0x1E, 0x14, 0x82, 0x24, 0x02, 0x1D, 0x18, 0x53, 0x82, 0x20, 0x48, 0x53, 0x41,
+    0x0F, 0x78, 0x52, 0x03, 0x37, 0x15, 0x15, 0x9A, 0x13, 0x13, 0x3D, 0x92, 0x50, 0x5A, 0x5C, 0x6A,
+    0x25, 0x82, 0x52, 0x29, 0x94, 0x42, 0x16, 0x66, 0xA1, 0x79, 0xA1, 0x52, 0x79, 0x24, 0x0A, 0x16,
+    0x2B, 0x13, 0x03, 0x03, 0x07, 0x03, 0x02, 0x01, 0x22, 0x22, 0x45, 0x22, 0x60, 0x18, 0x1F, 0x95,
+    0x16, 0x29, 0x29, 0x52, 0x95, 0x45, 0x04, 0x0A, 0x8A, 0x01, 0x02, 0x03, 0x07, 0x00, 0x08, 0x58,
+    0x75, 0x6E, 0x02, 0x00, 0x00, 0x01, 0x06, 0x84, 0x00, 0x0B, 0x62, 0x1F, 0x16, 0x16, 0x7A, 0x1F,
+    0x51, 0x02, 0x00, 0x02, 0x1C, 0x03, 0x88, 0x00, 0x0C, 0x01, 0x00, 0x01, 0x00, 0x00, 0x07, 0x62,
+    0x03, 0x03, 0x86, 0x05, 0x4F, 0x03, 0x82, 0x00, 0x54, 0x07, 0x85, 0x47, 0x3B, 0x3C, 0x0A, 0x75,
+    0x00, 0x49, 0x4F, 0x03, 0x03, 0x3B, 0x90, 0x58, 0x00, 0x00, 0x0A, 0x16, 0x00, 0x00, 0x03, 0x03,
+    0x01, 0x00, 0x00, 0x01, 0x06, 0x3B, 0x85, 0x3D, 0x05, 0x02, 0x00, 0x03, 0x86, 0x05, 0x03, 0x78,
+    0x20, 0x1E, 0x43, 0x43, 0x0C, 0x3F, 0x3F, 0x1B, 0x17, 0x0C, 0x39, 0x8B, 0x0C, 0x8B, 0x39, 0x2C,
+    0x2C, 0x7D, 0x8B, 0x8B, 0x39, 0x1B, 0x1E, 0x16, 0x01, 0x52, 0x29, 0x2D, 0x42, 0x8B, 0x7D, 0x66,
+    0x0C, 0x66, 0x66, 0x2D, 0xA4, 0x93, 0x25, 0x4E, 0x25, 0x25, 0x4E, 0x4E, 0x2A, 0x12, 0x83, 0x12,
+    0x81, 0xA2, 0x81, 0x12, 0x81, 0x2E, 0x50, 0x12, 0xA2, 0x12, 0x12, 0xA2, 0x12, 0x12, 0x1D, 0xA0,
+    0x20, 0x24, 0x4D, 0x4D, 0x1E, 0x1E, 0x31, 0x1E, 0x46, 0x31, 0x1E, 0x24, 0x24, 0x20, 0x27, 0x2A,
+    0x4F, 0x53, 0x14, 0x20, 0x21, 0x0F, 0x91, 0x53, 0x20, 0x1F, 0x1A, 0x8A, 0x0B, 0x73, 0x32, 0x02,
+    0x5D, 0x00, 0x15, 0x50, 0x50, 0x65, 0x73, 0x2A, 0x2B, 0x11, 0x82, 0x35, 0x32, 0x3F, 0x3E, 0x79,
+    0x5F, 0x42, 0x0C, 0x29, 0x1E, 0x16, 0x02, 0x95, 0x95, 0x16, 0x1A, 0x16, 0x74, 0x52, 0x16, 0x29,
+    0x25, 0x1F, 0x1A, 0x1A, 0x52, 0x29, 0x29, 0x1A, 0x82, 0x1F, 0x10, 0x25, 0x16, 0x49, 0x3C, 0x58,
+    0x02, 0x3C, 0x03, 0x01, 0x01, 0x3D, 0x01, 0x00, 0x2B, 0x86, 0x00, 0x04, 0x81, 0x01, 0x82, 0x00,
+    0x03, 0x01, 0x75, 0x03, 0x02, 0x82, 0x00, 0x82, 0x01, 0x05, 0x05, 0x45, 0x05, 0x03, 0x07, 0x01,
+    0x86, 0x00, 0x0F, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x45, 0x03, 0x05, 0x05, 0x03, 0x03,
+    0x02, 0x00, 0x04, 0x84, 0x00, 0x46, 0x03, 0x75, 0x00, 0x00, 0x05, 0x02, 0x49, 0x47, 0x79, 0x7B,
+    0x34, 0x01, 0x00, 0x1A, 0xA1, 0x01, 0x3D, 0x03, 0x06, 0x00, 0x00, 0x02, 0x02, 0x07, 0x3C, 0x0A,
+    0x03, 0x01, 0x02, 0x02, 0x03, 0x0A, 0x00, 0x32, 0x21, 0x43, 0x4D, 0xA0, 0x1E, 0x7E, 0x6C, 0x0C,
+    0x17, 0x0C, 0x0C, 0x17, 0x0C, 0x0C, 0x39, 0x2C, 0x64, 0x9C, 0x76, 0x76, 0x1B, 0x1E, 0x22, 0x02,
+    0x07, 0x3F, 0x36, 0x76, 0x42, 0x8B, 0x39, 0x8B, 0x1B, 0x1B, 0x23, 0xA4, 0x2D, 0x84, 0x25, 0x03,
+    0x2D, 0x4E, 0x4E, 0x38, 0x83, 0x12, 0x04, 0xA2, 0x72, 0x12, 0x72, 0x2E, 0x82, 0xA2, 0x81, 0x12,
+    0x45, 0xA2, 0x12, 0x12, 0x31, 0x4D, 0x20, 0x24, 0x4D, 0x31, 0x31, 0x7C, 0x83, 0x4D, 0x46, 0x31,
+    0x14, 0x27, 0x1D, 0x24, 0x11, 0x2A, 0x4F, 0x53, 0x20, 0x24, 0x20, 0x11, 0x91, 0x91, 0x30, 0x25,
+    0x7E, 0x3F, 0x0B, 0x41, 0x15, 0x03, 0x00, 0x00, 0x08, 0x40, 0x2E, 0x40, 0x6B, 0x35, 0x2B, 0x30,
+    0x1F, 0x01, 0x00, 0x25, 0x4A, 0x81, 0x39, 0x43, 0x2D, 0x29, 0x1A, 0x96, 0x00, 0x45, 0x6E, 0x1A,
+    0x18, 0x56, 0x28, 0x60, 0x45, 0x02, 0x22, 0x8A, 0x00, 0x23, 0x45, 0x82, 0x06, 0x91, 0x02, 0x91,
+    0x03, 0x05, 0x06, 0x03, 0x01, 0x02, 0x37, 0x26, 0x34, 0x00, 0x00, 0x01, 0x02, 0x00, 0x07, 0x62,
+    0x0A, 0x45, 0x1C, 0x75, 0x1C, 0x05, 0x3D, 0x1C, 0x48, 0x05, 0x08, 0x48, 0x06, 0x02, 0x87, 0x00,
+    0x08, 0x02, 0x00, 0x01, 0x00, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x81, 0x03, 0x81, 0x01, 0x82, 0x00,
+    0x05, 0x01, 0x18, 0x18, 0x45, 0x01, 0x02, 0x82, 0x00, 0x0F, 0x01, 0x22, 0x04, 0x3D, 0x05, 0x98,
+    0x5D, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x49, 0x0A, 0x05, 0x01, 0x83, 0x00, 0x82, 0x03, 0x34, 0x02,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0x23, 0x1E, 0x1E, 0x17, 0x2D, 0x35, 0x66, 0x17, 0x8B, 0x66,
+    0x17, 0x17, 0x0C, 0x66, 0x0C, 0x2C, 0x84, 0x3E, 0x76, 0x39, 0x36, 0x30, 0x00, 0x7E, 0x43, 0x1B,
+    0x0C, 0x0C, 0x42, 0x1B, 0x39, 0x39, 0x76, 0x77, 0x2D, 0x25, 0x93, 0x25, 0x25, 0x4E, 0x95, 0x25,
+    0x2D, 0x61, 0x61, 0x38, 0x82, 0x12, 0x81, 0xA2, 0x03, 0x12, 0xA2, 0x4C, 0x72, 0x83, 0xA2, 0x81,
+    0x12, 0x34, 0xA2, 0x2C, 0x6C, 0x1E, 0x20, 0x24, 0x31, 0x31, 0x1E, 0x31, 0x83, 0x14, 0x46, 0x20,
+    0x27, 0x27, 0x1D, 0x27, 0x2A, 0x11, 0x4F, 0x68, 0x20, 0x21, 0x24, 0x27, 0x37, 0x49, 0x16, 0x26,
+    0x74, 0x4E, 0x06, 0x15, 0x71, 0x58, 0x00, 0x04, 0x91, 0x15, 0x2E, 0x2E, 0x5C, 0x68, 0x27, 0x13,
+    0x3B, 0x5F, 0x3F, 0x89, 0x42, 0x95, 0x18, 0x86, 0x00, 0x05, 0x02, 0x00, 0x00, 0x02, 0x01, 0x04,
+    0x87, 0x00, 0x29, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x5F, 0x1C, 0x04, 0x00, 0x01, 0x07,
+    0x92, 0x05, 0x04, 0x01, 0x06, 0x03, 0x41, 0x00, 0x01, 0x22, 0x47, 0x58, 0x02, 0x00, 0x0A, 0x3C,
+    0x08, 0x87, 0x3D, 0x08, 0x08, 0x62, 0x0A, 0x48, 0x0A, 0x08, 0x06, 0x03, 0x02, 0x87, 0x00, 0x28,
+    0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x07, 0x07, 0x01, 0x03, 0x02, 0x01, 0x01, 0x00, 0x07, 0x1A,
+    0x95, 0x25, 0x3F, 0x3F, 0x25, 0x52, 0x16, 0x28, 0x51, 0x01, 0x00, 0x04, 0x02, 0x02, 0x5D, 0x5D,
+    0x01, 0x00, 0x00, 0x1A, 0x18, 0x00, 0x3B, 0x58, 0x03, 0x82, 0x00, 0x0B, 0x34, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x02, 0x22, 0x01, 0x04, 0x01, 0x23, 0x82, 0x1E, 0x25, 0x52, 0x81, 0x4D, 0x43, 0x66,
+    0x17, 0x66, 0x9C, 0x66, 0x17, 0x39, 0x2C, 0x83, 0x1B, 0x76, 0x8B, 0x8B, 0x25, 0x42, 0x1B, 0x39,
+    0x0C, 0x8B, 0x8B, 0x1E, 0x39, 0x8B, 0x36, 0x9C, 0x7C, 0x84, 0x38, 0x38, 0x84, 0x25, 0x4E, 0x95,
+    0x25, 0x82, 0x61, 0x80, 0x2A, 0x82, 0x12, 0x81, 0xA2, 0x01, 0x12, 0x50, 0x82, 0x72, 0x12, 0xA2,
+    0x12, 0xA2, 0x12, 0xA2, 0x12, 0x20, 0x14, 0x31, 0x20, 0x24, 0x1E, 0x31, 0x31, 0x81, 0x31, 0x21,
+    0x46, 0x20, 0x82, 0x24, 0x20, 0x27, 0x35, 0x11, 0x63, 0x68, 0x27, 0x27, 0x67, 0x24, 0x53, 0x2D,
+    0x09, 0x3E, 0x44, 0x28, 0x00, 0x02, 0x32, 0x0B, 0x75, 0x00, 0x49, 0x0B, 0x6B, 0x2E, 0x40, 0x15,
+    0x24, 0x16, 0x42, 0x23, 0x29, 0x45, 0x8A, 0x00, 0x02, 0x34, 0x00, 0x02, 0x90, 0x00, 0x01, 0x63,
+    0x56, 0x82, 0x00, 0x15, 0x01, 0x71, 0x37, 0x00, 0x02, 0x45, 0x03, 0x0B, 0x96, 0x00, 0x00, 0x07,
+    0x3C, 0x3C, 0x48, 0x08, 0x58, 0x13, 0x3B, 0x13, 0x3B, 0x13, 0x84, 0x05, 0x04, 0x1C, 0x03, 0x01,
+    0x02, 0x07, 0x85, 0x00, 0x29, 0x01, 0x07, 0x00, 0x00, 0x04, 0x02, 0x07, 0x04, 0x06, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x86, 0x4F, 0x01, 0x02, 0x00, 0x00, 0x75, 0x51, 0x18, 0x18, 0x95, 0x1A, 0x16,
+    0x1A, 0x06, 0x3D, 0x01, 0x00, 0x00, 0x02, 0x00, 0x22, 0x7E, 0x02, 0x96, 0x8A, 0x08, 0x01, 0x82,
+    0x00, 0x80, 0x01, 0x88, 0x00, 0x06, 0x25, 0x31, 0x1E, 0x25, 0x6E, 0x7D, 0x81, 0x82, 0x1E, 0x81,
+    0x66, 0x81, 0x17, 0x09, 0x0C, 0x2C, 0x83, 0x1B, 0x76, 0x39, 0x76, 0x0C, 0x1B, 0x8B, 0x82, 0x0C,
+    0x07, 0x8B, 0x17, 0x76, 0x1B, 0x7D, 0x7C, 0x38, 0x12, 0x82, 0x38, 0x07, 0x52, 0x7A, 0x16, 0x95,
+    0x2D, 0x2D, 0x7F, 0x4E, 0x82, 0x12, 0x3A, 0xA2, 0x12, 0x33, 0x5B, 0x38, 0x33, 0x72, 0xA2, 0x12,
+    0x12, 0xA2, 0x12, 0x64, 0x81, 0x14, 0x81, 0x20, 0x64, 0x81, 0x83, 0x31, 0x7C, 0x31, 0x21, 0x46,
+    0x20, 0x24, 0x24, 0x27, 0x27, 0x11, 0x11, 0x4F, 0x68, 0x2A, 0x30, 0x2A, 0x2A, 0x11, 0x43, 0x17,
+    0x70, 0x7F, 0x07, 0x00, 0x28, 0x42, 0x5F, 0x48, 0x00, 0x00, 0x37, 0x54, 0x41, 0x5A, 0x5C, 0x6E,
+    0x61, 0x1A, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00, 0x03, 0x02, 0x00, 0x00, 0x48, 0x83, 0x00, 0x01,
+    0x03, 0x07, 0x90, 0x00, 0x0D, 0x04, 0x52, 0x01, 0x00, 0x04, 0x01, 0x32, 0x96, 0x00, 0x00, 0x3D,
+    0x13, 0x05, 0x55, 0x83, 0x00, 0x0F, 0x01, 0x06, 0x49, 0x3C, 0x58, 0x85, 0x8A, 0x8A, 0x3B, 0x85,
+    0x58, 0x47, 0x47, 0x08, 0x03, 0x01, 0x81, 0x07, 0x86, 0x00, 0x01, 0x01, 0x22, 0x83, 0x00, 0x03,
+    0x04, 0x00, 0x06, 0x75, 0x8E, 0x00, 0x13, 0x03, 0x1C, 0x07, 0x1C, 0x79, 0x79, 0x4F, 0x18, 0x63,
+    0x60, 0x07, 0x2D, 0x18, 0x91, 0x3B, 0x54, 0x06, 0x00, 0x00, 0x02, 0x83, 0x00, 0x01, 0x01, 0x22,
+    0x82, 0x00, 0x11, 0x04, 0x45, 0x21, 0x2D, 0x60, 0x83, 0x1E, 0x81, 0x81, 0x14, 0x81, 0x17, 0x17,
+    0x66, 0x0C, 0x8B, 0x2C, 0x1D, 0x82, 0x1B, 0x0E, 0x66, 0x0C, 0x0C, 0x8B, 0x76, 0x39, 0x0C, 0x0C,
+    0x7D, 0x39, 0x76, 0x4D, 0x7C, 0x7C, 0x84, 0x82, 0xA4, 0x07, 0x7F, 0x4E, 0x95, 0x16, 0x25, 0x2D,
+    0x4E, 0x0F, 0x80, 0xA2, 0x82, 0x12, 0x06, 0x72, 0x74, 0x38, 0x38, 0x64, 0x2C, 0xA2, 0x82, 0x12,
+    0x01, 0x33, 0x64, 0x82, 0x14, 0x29, 0x20, 0x27, 0x83, 0x83, 0x81, 0x31, 0x31, 0x21, 0x46, 0x20,
+    0x27, 0x1D, 0x24, 0x27, 0x11, 0x30, 0x47, 0x2B, 0x2A, 0x2A, 0x6E, 0x63, 0x14, 0x1D, 0x2C, 0x6F,
+    0x7A, 0x00, 0x16, 0x3F, 0x25, 0x95, 0x05, 0x22, 0x00, 0x92, 0x5A, 0x0D, 0x41, 0x5A, 0x92, 0x04,
+    0x83, 0x00, 0x11, 0x06, 0x05, 0x49, 0x00, 0x00, 0x87, 0x0B, 0x5C, 0x5C, 0x0D, 0x37, 0x00, 0x73,
+    0x05, 0x00, 0x04, 0x04, 0x02, 0x87, 0x00, 0x81, 0x04, 0x81, 0x00, 0x0E, 0x01, 0x00, 0x1A, 0x1F,
+    0x00, 0x00, 0x6A, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0x01, 0x29, 0x87, 0x00, 0x0C, 0x01, 0x0A,
+    0x13, 0x0A, 0x1C, 0x1C, 0x0A, 0x05, 0x03, 0x03, 0x48, 0x06, 0x01, 0x87, 0x00, 0x05, 0x01, 0x07,
+    0x00, 0x01, 0x00, 0x02, 0x82, 0x00, 0x01, 0x06, 0x34, 0x82, 0x00, 0x80, 0x34, 0x81, 0x01, 0x85,
+    0x00, 0x80, 0x04, 0x86, 0x00, 0x0C, 0x86, 0x85, 0x56, 0x25, 0x74, 0x4F, 0x02, 0x03, 0x87, 0x3C,
+    0x07, 0x00, 0x02, 0x82, 0x00, 0x26, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x1A,
+    0x18, 0x82, 0x31, 0x14, 0x14, 0x31, 0x14, 0x14, 0x4D, 0x7D, 0x0C, 0x17, 0x0C, 0x2C, 0x83, 0x36,
+    0x1B, 0x8B, 0x27, 0x0C, 0x1B, 0x8B, 0x76, 0x39, 0x17, 0x0C, 0x17, 0x39, 0x66, 0x83, 0x39, 0x0A,
+    0x2D, 0xA4, 0xA4, 0x4E, 0x61, 0x4E, 0x25, 0x61, 0x2D, 0x61, 0x38, 0x3B, 0x23, 0x67, 0x12, 0x40,
+    0x74, 0x30, 0x2C, 0x2C, 0x64, 0x1D, 0x12, 0xA2, 0x12, 0x12, 0x67, 0x2C, 0x83, 0x23, 0x14, 0x1D,
+    0x27, 0x14, 0x83, 0x83, 0x31, 0x83, 0x21, 0x46, 0x24, 0x1D, 0x2A, 0x27, 0x2A, 0x2A, 0x27, 0x26,
+    0x82, 0x64, 0x2A, 0x79, 0x16, 0x57, 0x1B, 0x0C, 0x3A, 0x45, 0x30, 0x25, 0x1F, 0x01, 0x6E, 0x30,
+    0x01, 0x00, 0x03, 0x40, 0x5C, 0x8A, 0x5C, 0x8A, 0x82, 0x00, 0x11, 0x03, 0x8A, 0x15, 0x15, 0x08,
+    0x00, 0x02, 0x15, 0x0D, 0x0D, 0x6A, 0x0D, 0x05, 0x00, 0x9A, 0x08, 0x00, 0x04, 0x82, 0x00, 0x08,
+    0x49, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x62, 0x02, 0x83, 0x00, 0x08, 0x51, 0x95, 0x00, 0x03,
+    0x41, 0x8A, 0x03, 0x03, 0x01, 0x82, 0x00, 0x01, 0x16, 0x18, 0x86, 0x00, 0x0B, 0x01, 0x05, 0x05,
+    0x08, 0x05, 0x05, 0x13, 0x08, 0x3C, 0x3C, 0x0A, 0x1C, 0x88, 0x00, 0x0F, 0x01, 0x00, 0x07, 0x01,
+    0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x01, 0x03, 0x83, 0x00, 0x80, 0x04,
+    0x8E, 0x00, 0x0C, 0x01, 0x00, 0x03, 0x0A, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x62, 0x04,
+    0x83, 0x00, 0x05, 0x02, 0x03, 0x00, 0x00, 0x01, 0x27, 0x85, 0x14, 0x23, 0x81, 0x1E, 0x17, 0x17,
+    0x0C, 0x2C, 0x31, 0x1B, 0x1B, 0x8B, 0x31, 0x76, 0x8B, 0x8B, 0x17, 0x1B, 0x23, 0x43, 0x43, 0x39,
+    0x39, 0x0C, 0x0C, 0x8B, 0x1B, 0x81, 0xA4, 0x84, 0x2D, 0x61, 0x4E, 0x95, 0x2D, 0x61, 0x4E, 0x12,
+    0x5D, 0x6C, 0x44, 0x1A, 0x28, 0x42, 0x64, 0x67, 0x1D, 0x83, 0x81, 0x2C, 0xA2, 0x12, 0x2C, 0x6C,
+    0x64, 0x38, 0x31, 0x83, 0x64, 0x64, 0x20, 0x20, 0x24, 0x20, 0x20, 0x21, 0x46, 0x24, 0x2A, 0x67,
+    0x2A, 0x2A, 0x67, 0x4B, 0x37, 0x82, 0x27, 0x30, 0x86, 0x25, 0x59, 0x9B, 0x3A, 0x74, 0x37, 0x1E,
+    0x25, 0x30, 0x29, 0x14, 0x23, 0x01, 0x00, 0x02, 0x0D, 0x0D, 0x48, 0x58, 0x03, 0x7B, 0x03, 0x01,
+    0x4F, 0x6B, 0x15, 0x0B, 0x03, 0x00, 0x01, 0x54, 0x5C, 0x15, 0x15, 0x6B, 0x0A, 0x00, 0x0B, 0x26,
+    0x7E, 0x30, 0x42, 0x23, 0x27, 0x29, 0x00, 0x7B, 0x00, 0x00, 0x04, 0x0A, 0x58, 0x03, 0x04, 0x83,
+    0x00, 0x0C, 0x1A, 0x1F, 0x05, 0x58, 0x0B, 0x37, 0x03, 0x00, 0x01, 0x22, 0x00, 0x1F, 0x29, 0x82,
+    0x00, 0x0F, 0x04, 0x51, 0x1C, 0x00, 0x02, 0x1C, 0x3C, 0x08, 0x3C, 0x8A, 0x8A, 0x73, 0x8A, 0x58,
+    0x3C, 0x29, 0x88, 0x00, 0x02, 0x02, 0x01, 0x22, 0x82, 0x00, 0x04, 0x15, 0x71, 0x07, 0x62, 0x5D,
+    0x82, 0x00, 0x01, 0x05, 0x62, 0x81, 0x00, 0x81, 0x34, 0x89, 0x00, 0x11, 0x34, 0x00, 0x00, 0x04,
+    0x01, 0x03, 0x02, 0x02, 0x03, 0x06, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x07, 0x0A, 0x83, 0x00,
+    0x05, 0x01, 0x62, 0x03, 0x01, 0x00, 0x79, 0x82, 0x20, 0x27, 0x31, 0x83, 0x20, 0x31, 0x81, 0x1E,
+    0x43, 0x4D, 0x17, 0x2C, 0x83, 0x77, 0x1B, 0x1B, 0x39, 0x39, 0x0C, 0x8B, 0x8B, 0x39, 0x43, 0x17,
+    0x43, 0x0C, 0x9C, 0x39, 0x76, 0x9C, 0x8B, 0x17, 0x2D, 0x93, 0x2D, 0x2D, 0x4E, 0x16, 0x61, 0x2D,
+    0x33, 0x38, 0x81, 0x6C, 0x81, 0x30, 0x3E, 0x42, 0x24, 0x27, 0x1D, 0x35, 0x4E, 0x19, 0x12, 0x12,
+    0x64, 0x4E, 0x80, 0x5C, 0x2B, 0x4B, 0x2A, 0x35, 0x24, 0x20, 0x1D, 0x1D, 0x20, 0x21, 0x46, 0x1D,
+    0x2A, 0x2A, 0x67, 0x24, 0x1D, 0x6E, 0x3C, 0x48, 0x35, 0x6E, 0x00, 0x7B, 0x26, 0x68, 0x18, 0x96,
+    0x6E, 0x29, 0x30, 0x56, 0x95, 0x29, 0x23, 0x16, 0x03, 0x00, 0x0B, 0x0D, 0x26, 0x3D, 0x01, 0x01,
+    0x03, 0x05, 0x05, 0x0B, 0x0B, 0x87, 0x82, 0x00, 0x3C, 0x0A, 0x73, 0x15, 0x6B, 0x15, 0x48, 0x00,
+    0x6B, 0x53, 0x6C, 0x24, 0x35, 0x7E, 0x82, 0x5F, 0x07, 0x00, 0x01, 0x02, 0x01, 0x00, 0x62, 0x73,
+    0x15, 0x05, 0x00, 0x00, 0x01, 0x60, 0x82, 0x02, 0x3C, 0x13, 0x05, 0x48, 0x02, 0x00, 0x9F, 0x00,
+    0x07, 0x25, 0x49, 0x00, 0x03, 0x00, 0x18, 0x56, 0x02, 0x00, 0x62, 0x08, 0x0A, 0x8A, 0x8A, 0x73,
+    0x73, 0x8A, 0x05, 0x82, 0x56, 0x01, 0x88, 0x00, 0x81, 0x01, 0x82, 0x00, 0x0E, 0x48, 0x03, 0x03,
+    0x05, 0x00, 0x04, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x04, 0x86, 0x00, 0x0B, 0x04,
+    0x00, 0x00, 0x02, 0x62, 0x08, 0x9A, 0x55, 0x03, 0x01, 0x06, 0x02, 0x81, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x80, 0x02, 0x83, 0x00, 0x07, 0x03, 0x08, 0x48, 0x00, 0x00, 0x5F, 0x24, 0x27, 0x82, 0x14,
+    0x09, 0x20, 0x14, 0x14, 0x1E, 0x1E, 0x81, 0x17, 0x2C, 0x83, 0x57, 0x82, 0x39, 0x18, 0x0C, 0x8B,
+    0x0C, 0x8B, 0x8B, 0x76, 0x8B, 0x6C, 0x0C, 0x76, 0x0C, 0x0C, 0x66, 0x17, 0x76, 0x81, 0x93, 0x2D,
+    0x61, 0x4E, 0x16, 0x4E, 0x6E, 0x38, 0x12, 0x3A, 0x6C, 0x44, 0x68, 0x68, 0x23, 0x42, 0xA4, 0x78,
+    0x26, 0x60, 0x5E, 0x12, 0x12, 0x1D, 0x95, 0x18, 0x29, 0x49, 0x2A, 0x30, 0x91, 0x56, 0x82, 0x27,
+    0x2A, 0x11, 0x21, 0x46, 0x24, 0x2A, 0x67, 0x2A, 0x27, 0x24, 0x27, 0x86, 0x00, 0x3D, 0x45, 0x00,
+    0x00, 0x05, 0x00, 0x01, 0x22, 0x16, 0x63, 0x25, 0x53, 0x7E, 0x68, 0x3F, 0x22, 0x03, 0x00, 0x3B,
+    0x0D, 0x80, 0x03, 0x82, 0x01, 0x04, 0x05, 0x0A, 0x13, 0x87, 0x0A, 0x82, 0x00, 0x3E, 0x03, 0x0B,
+    0x0B, 0x73, 0x0B, 0x3D, 0x00, 0x6B, 0x2B, 0x63, 0x04, 0x04, 0x00, 0x02, 0x18, 0x49, 0x02, 0x00,
+    0x02, 0x00, 0x00, 0x49, 0x55, 0x40, 0x6B, 0x22, 0x00, 0x01, 0x00, 0x82, 0x51, 0x01, 0x08, 0x3C,
+    0x03, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x18, 0x00, 0x02, 0x01, 0x00, 0x52, 0x05, 0x02, 0x01,
+    0x03, 0x47, 0x13, 0x13, 0x8A, 0x58, 0x3C, 0x48, 0x16, 0x45, 0x02, 0x02, 0x01, 0x83, 0x00, 0x0C,
+    0x49, 0x07, 0x00, 0x02, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x03, 0x01, 0x82, 0x00, 0x08,
+    0x01, 0x02, 0x04, 0x04, 0x80, 0x0D, 0x00, 0x00, 0x04, 0x85, 0x00, 0x81, 0x01, 0x0E, 0x48, 0x62,
+    0x87, 0x41, 0x65, 0x0A, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x84, 0x00, 0x09,
+    0x01, 0x08, 0x13, 0x02, 0x00, 0x00, 0x01, 0x53, 0x1D, 0x14, 0x82, 0x20, 0x83, 0x14, 0x81, 0x1E,
+    0x01, 0x2C, 0x83, 0x82, 0x39, 0x84, 0x0C, 0x12, 0x76, 0x0C, 0x8B, 0x6C, 0x8B, 0x0C, 0x0C, 0x17,
+    0x17, 0x76, 0x9C, 0x81, 0x93, 0x2A, 0x2D, 0x25, 0x1A, 0xA1, 0x50, 0x81, 0x38, 0x81, 0x6C, 0x1A,
+    0x5B, 0x63, 0x30, 0x6E, 0x30, 0x61, 0x89, 0x1A, 0x6A, 0x12, 0x12, 0x1D, 0x3F, 0x6E, 0x30, 0x26,
+    0x31, 0x4B, 0x29, 0x24, 0x30, 0x2A, 0x67, 0x19, 0x11, 0x46, 0x11, 0x82, 0x0F, 0x22, 0x24, 0x21,
+    0x2D, 0x63, 0x04, 0x00, 0x00, 0x01, 0x02, 0x58, 0x00, 0x7B, 0x00, 0x29, 0x45, 0x29, 0x35, 0x1F,
+    0x53, 0x1A, 0x02, 0x04, 0x00, 0x06, 0x73, 0x32, 0x01, 0x5D, 0x02, 0x00, 0x06, 0x03, 0x0A, 0x0A,
+    0x01, 0x82, 0x00, 0x19, 0x01, 0x32, 0x58, 0x54, 0x0B, 0x01, 0x00, 0x6B, 0x71, 0x7E, 0x5F, 0x52,
+    0x82, 0x29, 0x1F, 0x03, 0x05, 0x00, 0x00, 0x62, 0x3C, 0x05, 0x90, 0x0D, 0x0D, 0x32, 0x82, 0x00,
+    0x1F, 0x51, 0x29, 0x00, 0x47, 0x8A, 0x01, 0x08, 0x01, 0x00, 0x06, 0x00, 0x07, 0x1A, 0x00, 0x00,
+    0x01, 0x00, 0x63, 0x1F, 0x01, 0x06, 0x03, 0x08, 0x87, 0x08, 0x58, 0x08, 0x06, 0x63, 0x86, 0x01,
+    0x02, 0x84, 0x00, 0x29, 0x04, 0x18, 0x75, 0x02, 0x00, 0x22, 0x02, 0x00, 0x06, 0x00, 0x00, 0x01,
+    0x03, 0x03, 0x00, 0x60, 0x45, 0x00, 0x01, 0x04, 0x00, 0x71, 0x67, 0x2B, 0x00, 0x04, 0x04, 0x00,
+    0x00, 0x02, 0x03, 0x49, 0x06, 0x01, 0x06, 0x00, 0x22, 0x15, 0x0D, 0x08, 0x00, 0x02, 0x82, 0x00,
+    0x02, 0x02, 0x00, 0x04, 0x84, 0x00, 0x04, 0x04, 0x08, 0x37, 0x3B, 0x02, 0x82, 0x00, 0x0F, 0x49,
+    0x2A, 0x20, 0x1D, 0x20, 0x21, 0x14, 0x14, 0x20, 0x20, 0x1E, 0x20, 0x33, 0x83, 0x39, 0x76, 0x81,
+    0x39, 0x82, 0x17, 0x15, 0x0C, 0x76, 0x0C, 0x0C, 0x17, 0x8B, 0x0C, 0x66, 0x4D, 0xA0, 0x66, 0x23,
+    0x93, 0x2C, 0x33, 0x9D, 0x5B, 0x18, 0x5A, 0x4C, 0x33, 0x38, 0x42, 0x6C, 0x24, 0x41, 0x1C, 0x03,
+    0x25, 0x2D, 0x61, 0x95, 0x7A, 0x0B, 0x12, 0xA2, 0x1D, 0x30, 0x6E, 0x35, 0x2B, 0x83, 0x53, 0x07,
+    0x1F, 0x30, 0x64, 0x64, 0x67, 0x27, 0x46, 0x35, 0x80, 0x0F, 0x0F, 0x1D, 0x24, 0x30, 0x79, 0x03,
+    0x00, 0x00, 0x02, 0x04, 0x07, 0x00, 0x04, 0x00, 0x1A, 0x63, 0x7E, 0x7E, 0x96, 0x25, 0x07, 0x02,
+    0x00, 0x00, 0x04, 0x0B, 0x0B, 0x02, 0x00, 0x02, 0x00, 0x02, 0x06, 0x56, 0x63, 0x04, 0x82, 0x00,
+    0x1A, 0x04, 0x05, 0x58, 0x13, 0x58, 0x02, 0x00, 0x41, 0x13, 0x18, 0x18, 0x45, 0x1C, 0x07, 0x00,
+    0x3B, 0x5C, 0x1C, 0x18, 0x01, 0x02, 0x92, 0x71, 0x0D, 0x15, 0x73, 0x05, 0x82, 0x00, 0x1B, 0x52,
+    0x18, 0x01, 0x73, 0x01, 0x48, 0x08, 0x03, 0x02, 0x07, 0x00, 0x16, 0x1C, 0x00, 0x00, 0x01, 0x02,
+    0x56, 0x3C, 0x06, 0x05, 0x06, 0x08, 0x08, 0x0A, 0x03, 0x0A, 0x56, 0x82, 0x03, 0x80, 0x02, 0x83,
+    0x00, 0x2D, 0x07, 0x1A, 0x07, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x01, 0x34, 0x01, 0x22, 0x37,
+    0x04, 0x4F, 0x51, 0x00, 0x00, 0x02, 0x03, 0x47, 0x2B, 0x83, 0x6E, 0x79, 0x4F, 0x01, 0x0A, 0x4F,
+    0x3C, 0x3D, 0x05, 0x02, 0x01, 0x01, 0x34, 0x32, 0x0D, 0x08, 0x00, 0x02, 0x00, 0x00, 0x01, 0x03,
+    0x82, 0x00, 0x1E, 0x02, 0x07, 0x00, 0x01, 0x04, 0x8A, 0x9A, 0x0A, 0x01, 0x00, 0x01, 0x01, 0x00,
+    0x82, 0x24, 0x2A, 0x20, 0x20, 0x1D, 0x21, 0x20, 0x20, 0x14, 0x20, 0x33, 0x83, 0x8B, 0x8B, 0x0C,
+    0x66, 0x0C, 0x82, 0x17, 0x81, 0x0C, 0x12, 0x8B, 0x17, 0x0C, 0x0C, 0x66, 0x17, 0x81, 0x2D, 0x23,
+    0x23, 0x12, 0x12, 0xA4, 0x5B, 0x18, 0x72, 0x12, 0x33, 0x38, 0x32, 0x64, 0x78, 0x3D, 0x07, 0x6B,
+    0x2D, 0x95, 0x25, 0x1A, 0x28, 0x0D, 0x12, 0x12, 0x1D, 0x25, 0x35, 0x35, 0x29, 0x83, 0x2A, 0x68,
+    0x6E, 0x16, 0x1D, 0x67, 0x2C, 0x27, 0x69, 0x24, 0x53, 0x80, 0x67, 0x1D, 0x24, 0x30, 0x26, 0x63,
+    0x00, 0x04, 0x04, 0x07, 0x02, 0x02, 0x00, 0x00, 0x60, 0x6E, 0x18, 0x56, 0x79, 0x18, 0x82, 0x00,
+    0x4D, 0x04, 0x00, 0x08, 0x0B, 0x03, 0x45, 0x25, 0x1A, 0x02, 0x03, 0x79, 0x63, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x03, 0x05, 0x08, 0x05, 0x02, 0x00, 0x41, 0x92, 0x01, 0x02, 0x02, 0x96, 0x02, 0x1F,
+    0x71, 0x5A, 0x96, 0x08, 0x00, 0x96, 0x71, 0x40, 0x0D, 0x55, 0x32, 0x8A, 0x03, 0x02, 0x02, 0x49,
+    0x52, 0x00, 0x58, 0x06, 0x03, 0x58, 0x0A, 0x00, 0x01, 0x00, 0x1A, 0x1A, 0x00, 0x00, 0x03, 0x02,
+    0x48, 0x5F, 0x01, 0x03, 0x06, 0x62, 0x0A, 0x05, 0x01, 0x52, 0x56, 0x03, 0x06, 0x03, 0x02, 0x83,
+    0x00, 0x01, 0x07, 0x1F, 0x83, 0x00, 0x23, 0x06, 0x0A, 0x07, 0x03, 0x03, 0x91, 0x02, 0x05, 0x07,
+    0x47, 0x00, 0x04, 0x04, 0x00, 0x13, 0x67, 0x1D, 0x31, 0x3E, 0x14, 0x20, 0x5F, 0x05, 0x58, 0x08,
+    0x05, 0x03, 0x22, 0x02, 0x07, 0x00, 0x32, 0x0D, 0x3D, 0x00, 0x02, 0x81, 0x00, 0x81, 0x03, 0x82,
+    0x00, 0x08, 0x02, 0x00, 0x00, 0x1C, 0x04, 0x54, 0x6B, 0x0A, 0x04, 0x82, 0x00, 0x04, 0x34, 0x00,
+    0x2B, 0x67, 0x1D, 0x81, 0x64, 0x83, 0x20, 0x0A, 0x1D, 0x33, 0x83, 0x66, 0x8B, 0x83, 0x84, 0x4D,
+    0x17, 0x43, 0x17, 0x82, 0x0C, 0x03, 0x43, 0x17, 0x17, 0xA0, 0x82, 0x17, 0x0A, 0x0C, 0x67, 0xA2,
+    0x72, 0x52, 0x52, 0x1A, 0x33, 0x12, 0x38, 0x12, 0x27, 0x2C, 0x7E, 0x68, 0x68, 0x4B, 0x2A, 0x3F,
+    0x49, 0x25, 0x1F, 0x32, 0x12, 0x12, 0x64, 0x6E, 0x30, 0x6E, 0x7E, 0x24, 0x26, 0x68, 0x20, 0x1D,
+    0x11, 0x82, 0x19, 0x1D, 0x46, 0x64, 0x2A, 0x82, 0x4B, 0x20, 0x27, 0x35, 0x52, 0x45, 0x00, 0x00,
+    0x04, 0x82, 0x00, 0x02, 0x86, 0x51, 0x00, 0x82, 0x53, 0x10, 0x60, 0x00, 0x06, 0x28, 0x86, 0x02,
+    0x00, 0x05, 0x0B, 0x13, 0x86, 0x26, 0x79, 0x00, 0x07, 0x03, 0x02, 0x84, 0x00, 0x1A, 0x02, 0x01,
+    0x01, 0x48, 0x00, 0x03, 0x55, 0x62, 0x86, 0x9A, 0x0A, 0x4F, 0x07, 0x00, 0x55, 0x5C, 0x34, 0x01,
+    0x92, 0x65, 0x0D, 0x41, 0x73, 0x0B, 0x0B, 0x47, 0x03, 0x82, 0x00, 0x1E, 0x18, 0x16, 0x00, 0x0B,
+    0x0D, 0x62, 0x3B, 0x02, 0x00, 0x07, 0x07, 0x1A, 0x01, 0x02, 0x01, 0x06, 0x01, 0x4F, 0x1A, 0x01,
+    0x03, 0x03, 0x75, 0x02, 0x56, 0x25, 0x06, 0x3B, 0x62, 0x03, 0x01, 0x83, 0x00, 0x27, 0x49, 0x1F,
+    0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x03, 0x05, 0x49, 0x02, 0x63, 0x86, 0x3D, 0x1F, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x18, 0xA1, 0x68, 0x43, 0x17, 0x24, 0x7D, 0x63, 0x03, 0x3B, 0x48, 0x05, 0x03,
+    0x01, 0x01, 0x06, 0x01, 0x79, 0x13, 0x83, 0x00, 0x01, 0x03, 0x01, 0x84, 0x00, 0x1F, 0x32, 0x0D,
+    0x02, 0x06, 0x41, 0x08, 0x00, 0x00, 0x34, 0x00, 0x01, 0x34, 0x03, 0x67, 0x20, 0x20, 0x14, 0x21,
+    0x14, 0x20, 0x21, 0x1D, 0x33, 0x31, 0x17, 0x4D, 0x83, 0x93, 0x84, 0x17, 0xA0, 0x43, 0x82, 0x17,
+    0x02, 0xA0, 0x66, 0x43, 0x82, 0x17, 0x08, 0x20, 0x78, 0x33, 0x72, 0x5B, 0x16, 0x1A, 0x1A, 0xA4,
+    0x82, 0x12, 0x1B, 0x25, 0x1F, 0x6E, 0x20, 0x24, 0x1D, 0x52, 0x00, 0x51, 0x00, 0x71, 0x12, 0x12,
+    0x67, 0x27, 0x2A, 0x67, 0x67, 0x24, 0x2B, 0x03, 0x63, 0x5F, 0x7E, 0x27, 0x24, 0x1D, 0x69, 0x82,
+    0x67, 0x04, 0x5F, 0x11, 0x24, 0x35, 0x52, 0x82, 0x00, 0x18, 0x04, 0x56, 0x25, 0x42, 0x4D, 0x30,
+    0x00, 0x01, 0x47, 0x3C, 0x00, 0x4F, 0x21, 0x17, 0x81, 0x30, 0x22, 0x01, 0x54, 0x0A, 0x01, 0x01,
+    0x02, 0x00, 0x07, 0x81, 0x02, 0x85, 0x00, 0x3A, 0x01, 0x05, 0x06, 0x00, 0x05, 0x55, 0x07, 0x02,
+    0x15, 0x55, 0x58, 0x62, 0x06, 0x92, 0x3B, 0x00, 0x0B, 0x0D, 0x0D, 0x71, 0x9A, 0x0B, 0x9A, 0x37,
+    0x03, 0x03, 0x07, 0x01, 0x00, 0x00, 0x1A, 0x49, 0x3B, 0x73, 0x13, 0x3C, 0x03, 0x00, 0x02, 0x00,
+    0x16, 0x49, 0x00, 0x02, 0x49, 0x03, 0x01, 0x82, 0x5F, 0x01, 0x01, 0x03, 0x02, 0x3F, 0x79, 0x3D,
+    0x3B, 0x08, 0x03, 0x84, 0x00, 0x14, 0x4F, 0x18, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x9F, 0x48,
+    0x7B, 0x02, 0x82, 0x56, 0x45, 0x63, 0x86, 0x68, 0x75, 0x00, 0x04, 0x82, 0x00, 0x0F, 0x2A, 0x09,
+    0x9C, 0x9C, 0x76, 0x1F, 0x01, 0x1C, 0x03, 0x62, 0x02, 0x00, 0x08, 0x48, 0x08, 0x05, 0x83, 0x00,
+    0x80, 0x01, 0x84, 0x00, 0x06, 0x1C, 0x40, 0x5C, 0x05, 0x00, 0x58, 0x54, 0x82, 0x00, 0x16, 0x1A,
+    0x6E, 0x00, 0x00, 0x4B, 0x24, 0x42, 0x14, 0x20, 0x14, 0x81, 0x24, 0x1D, 0x2C, 0x81, 0x43, 0x83,
+    0x84, 0x84, 0x93, 0x84, 0xA3, 0x1E, 0x84, 0x17, 0x09, 0x1E, 0x81, 0x17, 0x23, 0x6A, 0x37, 0x33,
+    0x64, 0x78, 0x26, 0x82, 0x1A, 0x02, 0x12, 0x38, 0x12, 0x26, 0x68, 0x6E, 0x2A, 0x24, 0x21, 0x21,
+    0x6E, 0x01, 0x07, 0x00, 0x6A, 0x12, 0x12, 0x67, 0x24, 0x1D, 0x1D, 0x64, 0x1D, 0x2A, 0x68, 0x6E,
+    0x68, 0x20, 0x1D, 0x1D, 0x24, 0x69, 0x67, 0x2A, 0x67, 0x30, 0x80, 0x27, 0x53, 0x63, 0x04, 0x00,
+    0x29, 0x82, 0x81, 0x11, 0x21, 0x27, 0x25, 0x00, 0x34, 0x5D, 0x04, 0x01, 0x2A, 0x24, 0x11, 0x27,
+    0x14, 0x30, 0x00, 0x05, 0x08, 0x03, 0x82, 0x00, 0x01, 0x01, 0x02, 0x86, 0x00, 0x3A, 0x02, 0x87,
+    0x08, 0x04, 0x48, 0x8A, 0x04, 0x01, 0x3D, 0x9A, 0x13, 0x05, 0x05, 0x41, 0x6B, 0x79, 0x0D, 0x6B,
+    0x55, 0x37, 0x9A, 0x0D, 0x0D, 0x0B, 0x13, 0x03, 0x1C, 0x22, 0x00, 0x00, 0x49, 0x1A, 0x03, 0x1C,
+    0x90, 0x05, 0x08, 0x02, 0x01, 0x00, 0x45, 0x1F, 0x00, 0x02, 0x01, 0x06, 0x05, 0x05, 0x5F, 0x5F,
+    0x02, 0x00, 0x30, 0x7E, 0x0A, 0x3B, 0x58, 0x58, 0x01, 0x84, 0x00, 0x05, 0x56, 0x45, 0x00, 0x00,
+    0x02, 0x01, 0x82, 0x00, 0x1E, 0x03, 0x02, 0x96, 0x3B, 0x01, 0x82, 0x45, 0x4C, 0x83, 0x7E, 0x02,
+    0x00, 0x04, 0xA1, 0x6C, 0x3E, 0x4A, 0x09, 0x66, 0x1B, 0x1B, 0x16, 0x05, 0x86, 0x01, 0x62, 0x04,
+    0x08, 0x05, 0x1C, 0x08, 0x82, 0x00, 0x01, 0x01, 0x07, 0x83, 0x00, 0x34, 0x01, 0x0D, 0x0D, 0x5C,
+    0x05, 0x00, 0x06, 0x3B, 0x34, 0x07, 0x26, 0x29, 0x18, 0x00, 0x00, 0x71, 0x3F, 0x2D, 0x23, 0x14,
+    0x14, 0x20, 0x20, 0x24, 0x2C, 0x31, 0x83, 0x84, 0x31, 0x84, 0x38, 0x93, 0x4D, 0x17, 0x4D, 0x4D,
+    0x17, 0x1E, 0x1E, 0x21, 0x53, 0x53, 0x55, 0x05, 0x75, 0x2E, 0x9D, 0x64, 0x33, 0x26, 0x18, 0x06,
+    0x5A, 0x81, 0x12, 0x3E, 0x9D, 0x19, 0x2A, 0x2A, 0x0F, 0x24, 0x30, 0x5B, 0x79, 0x18, 0x2A, 0x12,
+    0x12, 0x67, 0x24, 0x64, 0x27, 0x1D, 0x1D, 0x11, 0x78, 0x1D, 0x1D, 0x64, 0x1D, 0x1D, 0x27, 0x69,
+    0x2C, 0x2A, 0x11, 0x64, 0x53, 0x29, 0x16, 0x02, 0x00, 0x22, 0x42, 0x30, 0x6E, 0x6E, 0x53, 0x20,
+    0x52, 0x00, 0x00, 0x04, 0x00, 0x26, 0x2A, 0x0F, 0x20, 0x20, 0x27, 0x42, 0x60, 0x01, 0x05, 0x62,
+    0x00, 0x04, 0x02, 0x89, 0x00, 0x1A, 0x08, 0x0A, 0x00, 0x03, 0x0B, 0x49, 0x75, 0x86, 0x13, 0x55,
+    0x05, 0x4F, 0x55, 0x6B, 0x55, 0x6B, 0x0D, 0x41, 0x0B, 0x0D, 0x40, 0x0D, 0x15, 0x3B, 0x05, 0x02,
+    0x22, 0x82, 0x00, 0x06, 0x1F, 0x1A, 0x00, 0x37, 0x02, 0x05, 0x0A, 0x82, 0x00, 0x10, 0x29, 0x75,
+    0x02, 0x02, 0x03, 0x05, 0x08, 0x03, 0x29, 0x30, 0x2D, 0x2D, 0x05, 0x96, 0x47, 0x8A, 0x13, 0x85,
+    0x00, 0x27, 0x1A, 0x49, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x34, 0x06, 0x06, 0x1C, 0x55, 0x62,
+    0x16, 0x13, 0x33, 0x8C, 0x18, 0x00, 0x5D, 0x00, 0x83, 0x3E, 0x31, 0x21, 0x4D, 0x36, 0x94, 0x94,
+    0x3E, 0x1A, 0x03, 0x05, 0x03, 0x04, 0x87, 0x87, 0x03, 0x05, 0x82, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x0A, 0x47, 0x0D, 0x0B, 0x0B, 0x00, 0x00, 0x02, 0x01, 0x00, 0x53, 0x2B, 0x83, 0x00, 0x27, 0x22,
+    0x7E, 0x30, 0x42, 0x27, 0x14, 0x20, 0x24, 0x20, 0x2C, 0x83, 0x84, 0x83, 0x17, 0x84, 0x84, 0x93,
+    0x84, 0x43, 0x4D, 0x66, 0x17, 0x81, 0x6C, 0x53, 0x8C, 0x92, 0x03, 0x1C, 0x62, 0x5A, 0x6B, 0x9D,
+    0x64, 0x8A, 0x02, 0x04, 0x01, 0x40, 0x12, 0x16, 0x68, 0x6E, 0x2A, 0x9D, 0x2E, 0x9D, 0x27, 0x5E,
+    0x6A, 0x2D, 0x27, 0x12, 0x12, 0x2C, 0x24, 0x64, 0x67, 0x67, 0x1D, 0x0F, 0x53, 0x24, 0x27, 0x82,
+    0x1D, 0x25, 0x24, 0x69, 0x0F, 0x11, 0x11, 0x2C, 0x27, 0xA1, 0x49, 0x00, 0x00, 0x1F, 0x14, 0x24,
+    0x21, 0x27, 0x20, 0x81, 0x1F, 0x59, 0x46, 0x74, 0x00, 0x68, 0x27, 0x35, 0x0F, 0x19, 0x53, 0x42,
+    0x1A, 0x00, 0x48, 0x03, 0x00, 0x00, 0x02, 0x01, 0x88, 0x00, 0x1B, 0x02, 0x08, 0x02, 0x02, 0x58,
+    0x03, 0x22, 0x3C, 0x1A, 0x2B, 0x27, 0x42, 0x0C, 0x30, 0x9A, 0x71, 0x0D, 0x40, 0x40, 0x65, 0x0D,
+    0x5C, 0x41, 0x73, 0x8A, 0x05, 0x1C, 0x02, 0x82, 0x00, 0x05, 0x1A, 0x01, 0x03, 0x05, 0x45, 0x0A,
+    0x82, 0x00, 0x13, 0x1F, 0x49, 0x01, 0x01, 0x06, 0x05, 0x3C, 0x03, 0x6E, 0x6C, 0x6C, 0x29, 0x05,
+    0x85, 0x8A, 0x58, 0x03, 0x00, 0x01, 0x34, 0x82, 0x00, 0x05, 0x1A, 0x07, 0x00, 0x00, 0x22, 0x01,
+    0x82, 0x00, 0x09, 0x02, 0x03, 0x00, 0x13, 0x1A, 0x22, 0x71, 0x5E, 0x00, 0x01, 0x82, 0x00, 0x11,
+    0x7E, 0x53, 0x2C, 0x64, 0x35, 0x3E, 0x09, 0x4A, 0x0C, 0xA1, 0x01, 0x3C, 0x79, 0x04, 0x08, 0x58,
+    0x91, 0x06, 0x87, 0x00, 0x1A, 0x01, 0x15, 0x54, 0x0B, 0x03, 0x04, 0x00, 0x56, 0x45, 0x03, 0x79,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x63, 0x27, 0x2D, 0x25, 0x14, 0x20, 0x2A, 0x24, 0x2A, 0x83,
+    0x82, 0x84, 0x19, 0x93, 0x84, 0x38, 0x84, 0xA0, 0x4D, 0x23, 0x43, 0x6C, 0x42, 0x5B, 0x8C, 0x3C,
+    0x00, 0x01, 0x92, 0x55, 0x32, 0x5C, 0x65, 0x50, 0x05, 0x34, 0x03, 0x72, 0x12, 0x81, 0x0F, 0x1F,
+    0x33, 0x2E, 0x4C, 0x9D, 0x42, 0x18, 0x2A, 0x23, 0x2A, 0x12, 0x12, 0x2C, 0x24, 0x67, 0x11, 0x67,
+    0x64, 0x0F, 0x19, 0x24, 0x27, 0x1D, 0x27, 0x1D, 0x2A, 0x69, 0x6E, 0x0F, 0x2C, 0x2A, 0x30, 0x1C,
+    0x82, 0x00, 0x01, 0x16, 0x27, 0x82, 0x14, 0x15, 0x76, 0x42, 0x69, 0x6D, 0x10, 0x2F, 0x28, 0x26,
+    0x0F, 0x11, 0x68, 0x26, 0x4B, 0x2A, 0x1F, 0x00, 0x48, 0x03, 0x07, 0x00, 0x02, 0x01, 0x89, 0x00,
+    0x1A, 0x47, 0x49, 0x00, 0x0A, 0x06, 0x00, 0x18, 0x24, 0x26, 0x1E, 0x30, 0x0C, 0x0C, 0x2D, 0x25,
+    0x6A, 0x5A, 0x5A, 0x65, 0x65, 0x0D, 0x5C, 0x15, 0x54, 0x8A, 0x08, 0x01, 0x82, 0x00, 0x05, 0x7B,
+    0x1A, 0x00, 0x85, 0x22, 0x06, 0x82, 0x00, 0x2A, 0x1F, 0x18, 0x02, 0x03, 0x06, 0x05, 0x05, 0x52,
+    0x2D, 0x06, 0x3D, 0x3F, 0x37, 0x3B, 0x8A, 0x0A, 0x00, 0x01, 0x22, 0x7B, 0x00, 0x01, 0x07, 0x1A,
+    0x00, 0x00, 0x02, 0x1C, 0x62, 0x02, 0x00, 0x00, 0x22, 0x02, 0x01, 0x02, 0x86, 0x00, 0x50, 0x67,
+    0x34, 0x22, 0x02, 0x82, 0x00, 0x10, 0x71, 0x67, 0x9C, 0x66, 0x76, 0x17, 0x09, 0x09, 0x66, 0x18,
+    0x29, 0x23, 0x00, 0x05, 0x8A, 0x3D, 0x02, 0x82, 0x00, 0x80, 0x01, 0x83, 0x00, 0x09, 0x0A, 0x32,
+    0x3C, 0x62, 0x00, 0x00, 0x37, 0x68, 0x5F, 0x56, 0x82, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x01, 0x00,
+    0x82, 0x24, 0x20, 0x14, 0x27, 0x1D, 0x2A, 0x64, 0x14, 0x82, 0x83, 0x81, 0x84, 0x17, 0x83, 0x81,
+    0x6C, 0x1E, 0x1E, 0x4D, 0x17, 0x3F, 0x71, 0x0D, 0x3C, 0x00, 0x02, 0x41, 0x87, 0x37, 0x8A, 0x34,
+    0x32, 0x2E, 0x0A, 0x0A, 0x72, 0x12, 0x01, 0x0F, 0x41, 0x82, 0x4C, 0x37, 0x0F, 0x11, 0x53, 0x20,
+    0x42, 0x24, 0x12, 0x12, 0x2C, 0x27, 0x64, 0x11, 0x2A, 0x64, 0x0F, 0x19, 0x1D, 0x1D, 0x64, 0x1D,
+    0x2A, 0x2A, 0x69, 0x82, 0x33, 0x11, 0x42, 0x16, 0x00, 0x07, 0x01, 0x00, 0x25, 0x24, 0x81, 0x14,
+    0x81, 0x81, 0x95, 0x10, 0x10, 0x3A, 0x3A, 0x7F, 0x02, 0x19, 0x11, 0x68, 0x56, 0x53, 0x35, 0x45,
+    0x00, 0x01, 0x06, 0x01, 0x8C, 0x00, 0x1A, 0x05, 0x07, 0x5D, 0x08, 0x03, 0x00, 0x16, 0x11, 0x6A,
+    0x17, 0x27, 0x23, 0x0C, 0x61, 0x25, 0x4B, 0x0D, 0x5A, 0x71, 0x0D, 0x5C, 0x5C, 0x15, 0x15, 0x32,
+    0x58, 0x03, 0x83, 0x00, 0x32, 0x1A, 0x1F, 0x02, 0x07, 0x00, 0x07, 0x00, 0x00, 0x45, 0x1A, 0x02,
+    0x05, 0x0A, 0x08, 0x48, 0x29, 0x29, 0x02, 0x3C, 0x7E, 0x79, 0x8A, 0x92, 0x04, 0x02, 0x03, 0x02,
+    0x5D, 0x00, 0x00, 0x45, 0x1F, 0x00, 0x00, 0x03, 0x05, 0x05, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x47, 0x96, 0x00, 0x9D, 0x9C, 0x7A, 0x00, 0x5D, 0x82, 0x00, 0x14, 0x79, 0x33, 0x1D, 0x42, 0x79,
+    0x71, 0x66, 0x09, 0x09, 0x81, 0x2A, 0x4D, 0x00, 0x62, 0x58, 0x87, 0x02, 0x00, 0x00, 0x02, 0x01,
+    0x83, 0x00, 0x0A, 0x0A, 0x3C, 0x48, 0x00, 0x02, 0x00, 0x80, 0x50, 0x65, 0x49, 0x02, 0x84, 0x00,
+    0x27, 0x02, 0x00, 0x49, 0x11, 0x20, 0x27, 0x27, 0x64, 0x2A, 0x2A, 0x31, 0x14, 0x81, 0x6C, 0x83,
+    0x64, 0x1E, 0xA0, 0xA0, 0x43, 0x4D, 0x43, 0x1E, 0x2D, 0x82, 0x55, 0x07, 0x08, 0x03, 0x47, 0x08,
+    0x92, 0x08, 0x3D, 0x22, 0x6B, 0x41, 0x37, 0x72, 0x12, 0x20, 0x2C, 0x40, 0x9D, 0x9D, 0x4C, 0x2C,
+    0x2A, 0x1D, 0x24, 0x42, 0x24, 0x12, 0x12, 0x2C, 0x27, 0x64, 0x11, 0x4B, 0x64, 0x4B, 0x53, 0x24,
+    0x27, 0x24, 0x1D, 0x2A, 0x16, 0x69, 0x19, 0x0F, 0x42, 0x3F, 0x22, 0x83, 0x00, 0x17, 0x56, 0x27,
+    0x21, 0x23, 0x25, 0x3C, 0x88, 0x10, 0x10, 0x59, 0x3A, 0x7F, 0x00, 0x86, 0x68, 0x78, 0x19, 0x6E,
+    0x18, 0x00, 0x00, 0x04, 0x06, 0x9F, 0x8B, 0x00, 0x1B, 0x9F, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00,
+    0x82, 0x1F, 0x0A, 0x81, 0x20, 0x25, 0x89, 0x35, 0x16, 0x53, 0x0D, 0x40, 0x41, 0x5C, 0x0D, 0x5C,
+    0x15, 0x15, 0x0B, 0x32, 0x0A, 0x83, 0x00, 0x46, 0x01, 0x1F, 0x75, 0x02, 0x34, 0x06, 0x01, 0x00,
+    0x22, 0x18, 0x01, 0x62, 0x03, 0x05, 0x87, 0x58, 0x23, 0x2D, 0x29, 0x5F, 0x92, 0x55, 0x13, 0x00,
+    0x3D, 0x03, 0x00, 0x00, 0x04, 0x00, 0x4F, 0x18, 0x00, 0x00, 0x62, 0x01, 0x06, 0x08, 0x01, 0x00,
+    0x03, 0x03, 0x00, 0xA1, 0x22, 0x00, 0x2C, 0x3E, 0x42, 0x00, 0x00, 0x78, 0x18, 0x00, 0x08, 0x11,
+    0x24, 0x60, 0x00, 0x0B, 0x68, 0x4A, 0x09, 0x4D, 0x20, 0x21, 0x01, 0x03, 0x3C, 0x32, 0x07, 0x82,
+    0x00, 0x10, 0x02, 0x00, 0x00, 0x01, 0x49, 0x03, 0x06, 0x04, 0x04, 0x00, 0x26, 0x26, 0x2E, 0x2E,
+    0x00, 0x04, 0x05, 0x84, 0x00, 0x11, 0x01, 0x00, 0x26, 0x2C, 0x2C, 0x2A, 0x21, 0x20, 0x2A, 0x83,
+    0x81, 0x1E, 0x81, 0x14, 0x83, 0x4D, 0x43, 0x1E, 0x82, 0x4D, 0x11, 0x1E, 0x4D, 0x14, 0x56, 0x04,
+    0x0B, 0x3B, 0x04, 0x13, 0x55, 0x48, 0x55, 0x0A, 0x85, 0x40, 0x45, 0x2E, 0x72, 0x15, 0x2C, 0x72,
+    0x2A, 0x33, 0x33, 0x2A, 0x30, 0x21, 0x24, 0x42, 0x24, 0x12, 0x12, 0x2C, 0x24, 0x67, 0x2A, 0x5E,
+    0x11, 0x4B, 0x19, 0x24, 0x82, 0x67, 0x08, 0x2A, 0x68, 0x69, 0x2C, 0x2A, 0x61, 0x26, 0x00, 0x01,
+    0x83, 0x00, 0x10, 0x02, 0x4F, 0x87, 0x13, 0x0D, 0x5F, 0x10, 0x10, 0x3A, 0x59, 0x60, 0x00, 0x00,
+    0x04, 0x4F, 0x63, 0x49, 0x83, 0x00, 0x81, 0x01, 0x8C, 0x00, 0x37, 0x04, 0x00, 0x01, 0x75, 0x00,
+    0x00, 0x45, 0x7E, 0x00, 0x3F, 0x27, 0x5F, 0x82, 0x5F, 0x52, 0x68, 0x41, 0x65, 0x5C, 0x9A, 0x41,
+    0x0D, 0x41, 0x5C, 0x15, 0x13, 0x0A, 0x01, 0x00, 0x04, 0x00, 0x00, 0x22, 0x1F, 0x48, 0x03, 0x02,
+    0x00, 0x02, 0x00, 0x1A, 0x63, 0x01, 0x08, 0x62, 0x3C, 0x87, 0x26, 0x30, 0x5F, 0x3B, 0x65, 0x6B,
+    0x3C, 0x58, 0x45, 0x84, 0x00, 0x28, 0x63, 0x60, 0x00, 0x00, 0x62, 0x00, 0x22, 0x00, 0x00, 0x07,
+    0x03, 0x02, 0x63, 0x63, 0x00, 0x01, 0x2C, 0x3E, 0x6C, 0xA1, 0x6E, 0x67, 0x14, 0x00, 0x00, 0xA0,
+    0x94, 0x26, 0x30, 0x2B, 0x11, 0x3E, 0x09, 0x6C, 0x24, 0x3F, 0x04, 0x06, 0x87, 0x96, 0x03, 0x85,
+    0x00, 0x23, 0x02, 0x1C, 0x62, 0x02, 0x00, 0x07, 0x18, 0x19, 0x71, 0x50, 0x2E, 0x00, 0x9F, 0x02,
+    0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x04, 0x01, 0x78, 0x4B, 0x11, 0x20, 0x21, 0x67, 0x81, 0x81,
+    0x1E, 0x81, 0x14, 0x31, 0x1E, 0x43, 0x84, 0x1E, 0x10, 0x81, 0x4D, 0x52, 0x04, 0x40, 0x86, 0x00,
+    0x13, 0x2E, 0x65, 0x41, 0x85, 0x92, 0x6B, 0x08, 0x6A, 0x12, 0x07, 0x0F, 0x33, 0x24, 0x9D, 0x33,
+    0x30, 0x29, 0x20, 0x82, 0x24, 0x81, 0x12, 0x13, 0x2C, 0x24, 0x67, 0x2A, 0x0F, 0x53, 0x0F, 0x53,
+    0x1D, 0x2A, 0x2C, 0x2A, 0x67, 0x52, 0x25, 0x80, 0x30, 0x25, 0x00, 0x07, 0x83, 0x00, 0x03, 0x07,
+    0x3D, 0x85, 0x90, 0x82, 0x65, 0x06, 0x5F, 0x59, 0x7F, 0x51, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02,
+    0x02, 0x01, 0x02, 0x8E, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x07, 0x64, 0x3C, 0x52, 0x90, 0x28, 0x74,
+    0x88, 0x3F, 0x5E, 0x6B, 0x0D, 0x82, 0x15, 0x06, 0x5C, 0x0D, 0x9A, 0x0B, 0x32, 0x03, 0x5D, 0x84,
+    0x00, 0x44, 0x18, 0x82, 0x01, 0x01, 0x00, 0x02, 0x04, 0x1A, 0x1A, 0x00, 0x62, 0x08, 0x13, 0x58,
+    0x3B, 0x03, 0x55, 0x55, 0x41, 0x15, 0x08, 0x3B, 0x91, 0x00, 0x02, 0x01, 0x00, 0x00, 0x18, 0x60,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x47, 0x3B, 0x34, 0x1A, 0x05, 0x00, 0x02, 0x2C, 0x36,
+    0x17, 0x25, 0x3E, 0x64, 0x4A, 0x29, 0x00, 0x6E, 0x2D, 0x7E, 0x94, 0x3E, 0x09, 0x3E, 0x09, 0x23,
+    0x4B, 0x6E, 0x00, 0x75, 0x13, 0x85, 0x06, 0x85, 0x00, 0x81, 0x01, 0x1A, 0x00, 0x04, 0x34, 0x2B,
+    0x56, 0x05, 0x41, 0x2E, 0x2E, 0x01, 0x00, 0x04, 0x04, 0x06, 0x01, 0x04, 0x00, 0x07, 0x00, 0x00,
+    0x80, 0x19, 0x67, 0x20, 0x21, 0x67, 0x14, 0x83, 0x81, 0x18, 0x31, 0x1E, 0x4D, 0x4D, 0x1E, 0x81,
+    0x81, 0x1E, 0x81, 0x1E, 0x30, 0x00, 0x0B, 0x96, 0x02, 0x55, 0x96, 0x9A, 0x73, 0x47, 0x07, 0x04,
+    0x60, 0x41, 0x2E, 0x20, 0x2C, 0x67, 0x21, 0x2C, 0x33, 0x35, 0x24, 0x1D, 0x20, 0x21, 0x24, 0x12,
+    0x12, 0x38, 0x27, 0x2A, 0x2A, 0x11, 0x2B, 0x5B, 0x53, 0x64, 0x0F, 0x2C, 0x27, 0x68, 0x01, 0x91,
+    0x02, 0x18, 0x51, 0x00, 0x01, 0x83, 0x00, 0x0E, 0x01, 0x3C, 0x58, 0x73, 0x6B, 0x41, 0x65, 0x40,
+    0x6B, 0x49, 0x00, 0x01, 0x02, 0x62, 0x06, 0x82, 0x00, 0x80, 0x02, 0x83, 0x00, 0x01, 0x02, 0x01,
+    0x92, 0x00, 0x14, 0x29, 0x53, 0x29, 0x7F, 0x74, 0x4E, 0x59, 0x82, 0x82, 0x0D, 0x6B, 0x6B, 0x73,
+    0x32, 0x73, 0x6B, 0x3B, 0x0A, 0x87, 0x03, 0x02, 0x85, 0x00, 0x02, 0x1A, 0x4F, 0x02, 0x82, 0x00,
+    0x3D, 0x60, 0x1A, 0x04, 0x00, 0x03, 0x32, 0x13, 0x01, 0x7E, 0x6E, 0x32, 0x73, 0x54, 0x08, 0x92,
+    0x03, 0x26, 0x7E, 0x00, 0x04, 0x00, 0x1A, 0x51, 0x00, 0x00, 0x06, 0x01, 0x01, 0x00, 0x04, 0x54,
+    0x01, 0x56, 0x18, 0x00, 0x01, 0x00, 0x78, 0x9C, 0x66, 0x3F, 0x4A, 0x7C, 0x3E, 0x43, 0x01, 0x5D,
+    0x02, 0x5F, 0x4A, 0x4A, 0x94, 0x4A, 0x36, 0x11, 0x0F, 0x29, 0x00, 0x01, 0x0A, 0x13, 0x03, 0x86,
+    0x00, 0x0A, 0x02, 0x00, 0x04, 0x79, 0x80, 0x7B, 0x00, 0x04, 0x03, 0x6A, 0x07, 0x82, 0x00, 0x03,
+    0x03, 0x06, 0x00, 0x02, 0x82, 0x00, 0x21, 0x18, 0x2C, 0x64, 0x24, 0x21, 0x67, 0x81, 0x81, 0x14,
+    0x81, 0x81, 0x1E, 0x81, 0x1E, 0x4D, 0x4D, 0x81, 0x14, 0x31, 0x81, 0x14, 0x42, 0x04, 0x5D, 0x01,
+    0x3C, 0x50, 0x07, 0x00, 0x13, 0x0B, 0x22, 0x04, 0x01, 0x81, 0x90, 0x1E, 0x2A, 0x67, 0x20, 0x64,
+    0x0F, 0x2A, 0x24, 0x24, 0x21, 0x20, 0x27, 0x12, 0x12, 0x38, 0x2A, 0x2C, 0x2C, 0x2A, 0x0F, 0x13,
+    0x53, 0x2A, 0x11, 0x11, 0x16, 0x06, 0x01, 0x04, 0x00, 0x3C, 0x48, 0x85, 0x00, 0x0E, 0x02, 0x1C,
+    0x3B, 0x87, 0x0B, 0x6B, 0x73, 0x8A, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x06, 0x9C, 0x00, 0x15,
+    0x9F, 0x29, 0x5F, 0x4E, 0xA1, 0x2B, 0x16, 0x95, 0x25, 0x47, 0x92, 0x47, 0x86, 0x02, 0x62, 0x13,
+    0x03, 0x06, 0x08, 0x13, 0x03, 0x02, 0x84, 0x00, 0x02, 0x03, 0x1F, 0x02, 0x82, 0x00, 0x3D, 0x45,
+    0x1F, 0x00, 0x00, 0x02, 0x3D, 0x3B, 0x1C, 0x47, 0x9A, 0x9A, 0x37, 0x08, 0x08, 0x90, 0x35, 0x7D,
+    0x42, 0x01, 0x04, 0x00, 0x82, 0x51, 0x00, 0x00, 0x62, 0x07, 0x01, 0x02, 0x22, 0x02, 0x03, 0x5F,
+    0x00, 0x00, 0x07, 0x00, 0x54, 0x64, 0x9C, 0x27, 0x7D, 0x9C, 0x9C, 0x94, 0x52, 0x00, 0x00, 0x5F,
+    0x4A, 0x4A, 0x94, 0x94, 0x14, 0x19, 0x67, 0x29, 0x00, 0x75, 0x62, 0x87, 0x03, 0x85, 0x00, 0x12,
+    0x01, 0x00, 0x00, 0x1F, 0x26, 0x07, 0x00, 0x04, 0x34, 0x32, 0x65, 0x04, 0x00, 0x01, 0x5D, 0x02,
+    0x04, 0x07, 0x02, 0x82, 0x00, 0x10, 0x7B, 0x2C, 0x64, 0x21, 0x21, 0x11, 0x14, 0x20, 0x14, 0x81,
+    0x14, 0x81, 0x81, 0x1E, 0x1E, 0x4D, 0x1E, 0x82, 0x14, 0x0F, 0x81, 0x20, 0x18, 0x02, 0x00, 0x85,
+    0x8C, 0x04, 0x04, 0x37, 0x08, 0x0A, 0x04, 0x00, 0x03, 0x90, 0x0E, 0x2C, 0x67, 0x21, 0x20, 0x1D,
+    0x24, 0x27, 0x24, 0x21, 0x20, 0x67, 0x12, 0x12, 0x33, 0x2A, 0x82, 0x2C, 0x0C, 0x2A, 0xA1, 0x68,
+    0x2A, 0x11, 0x82, 0x00, 0x03, 0x00, 0x04, 0x00, 0x9F, 0x85, 0x84, 0x00, 0x0B, 0x01, 0x00, 0x03,
+    0x3D, 0x3B, 0x08, 0x13, 0x48, 0x00, 0x34, 0x9F, 0x03, 0x83, 0x00, 0x80, 0x02, 0x81, 0x01, 0x9A,
+    0x00, 0x14, 0x85, 0x29, 0x03, 0x85, 0x28, 0x88, 0x16, 0x3C, 0x0A, 0x07, 0x04, 0x63, 0x60, 0x02,
+    0x08, 0x0A, 0x02, 0x07, 0x13, 0x13, 0x03, 0x83, 0x00, 0x44, 0x01, 0x00, 0x18, 0x1F, 0x01, 0x01,
+    0x00, 0x49, 0x29, 0x91, 0x02, 0x02, 0x01, 0x15, 0x13, 0x3B, 0x32, 0x8A, 0x3C, 0x1C, 0x06, 0x6E,
+    0x3E, 0x7D, 0x42, 0x07, 0x00, 0x00, 0x1A, 0x75, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x06, 0x05, 0x00,
+    0x82, 0x45, 0x00, 0x04, 0x00, 0x01, 0x00, 0x50, 0x84, 0x11, 0x20, 0x9C, 0x76, 0x3E, 0x81, 0x00,
+    0x01, 0x29, 0x94, 0x3E, 0x09, 0x76, 0x29, 0x2A, 0x11, 0x79, 0x00, 0x01, 0x03, 0x05, 0x03, 0x84,
+    0x00, 0x81, 0x01, 0x03, 0x00, 0xA1, 0x29, 0x51, 0x83, 0x00, 0x30, 0x41, 0x2E, 0x07, 0x00, 0x01,
+    0x01, 0x5D, 0x00, 0x6A, 0x85, 0x04, 0x00, 0x04, 0x00, 0x19, 0x64, 0x24, 0x24, 0x0F, 0x20, 0x24,
+    0x20, 0x14, 0x14, 0x81, 0x14, 0x81, 0x81, 0x1E, 0x1E, 0x81, 0x14, 0x14, 0x83, 0x14, 0x56, 0x04,
+    0x91, 0x13, 0x96, 0x1A, 0x18, 0x01, 0x62, 0x03, 0x13, 0x01, 0x08, 0x65, 0x05, 0x0F, 0x2A, 0x20,
+    0x24, 0x24, 0x21, 0x82, 0x24, 0x05, 0x20, 0x2A, 0x12, 0x12, 0x33, 0x2A, 0x82, 0x2C, 0x1E, 0x11,
+    0x53, 0xA1, 0x2A, 0x2B, 0x01, 0x49, 0x48, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x49, 0x01, 0x07, 0x22, 0x00, 0x34, 0x00, 0x07, 0x98, 0x7B, 0x82, 0x00,
+    0x03, 0x01, 0x0A, 0x0A, 0x01, 0x97, 0x00, 0x16, 0x02, 0x04, 0x02, 0x5F, 0x60, 0x51, 0x7B, 0x85,
+    0x26, 0x4F, 0x02, 0x02, 0x95, 0x3F, 0x0A, 0x85, 0x3C, 0x54, 0x05, 0x01, 0x08, 0x87, 0x62, 0x82,
+    0x00, 0x27, 0x01, 0x00, 0x00, 0x07, 0x16, 0x01, 0x00, 0x00, 0x07, 0x16, 0x1C, 0x02, 0x45, 0x00,
+    0x80, 0x53, 0x13, 0x13, 0x58, 0x1C, 0x03, 0x02, 0x2B, 0x3E, 0x66, 0x23, 0x01, 0x00, 0x01, 0x16,
+    0x01, 0x00, 0x00, 0x62, 0x00, 0x03, 0x06, 0x02, 0x86, 0x1A, 0x82, 0x00, 0x1A, 0x34, 0x01, 0x00,
+    0x0A, 0x38, 0x2C, 0x11, 0x7D, 0x3E, 0x94, 0x3E, 0x1F, 0x04, 0x29, 0x4A, 0x94, 0x3E, 0x14, 0x68,
+    0x71, 0x53, 0x16, 0x00, 0x01, 0x62, 0x87, 0x05, 0x86, 0x00, 0x1D, 0x1C, 0x26, 0x91, 0x00, 0x04,
+    0x00, 0x00, 0x01, 0x03, 0x90, 0x00, 0x01, 0x05, 0x03, 0x00, 0x00, 0x41, 0x37, 0x00, 0x02, 0x04,
+    0x00, 0x71, 0x1D, 0x2A, 0x2A, 0x0F, 0x21, 0x20, 0x21, 0x82, 0x20, 0x17, 0x27, 0x20, 0x81, 0x81,
+    0x4D, 0x1E, 0x14, 0x20, 0x14, 0x14, 0x16, 0x00, 0x22, 0x96, 0x93, 0x93, 0x52, 0x07, 0x01, 0x91,
+    0x85, 0x47, 0x0D, 0x50, 0x0E, 0x2C, 0x11, 0x20, 0x21, 0x21, 0x24, 0x24, 0x67, 0x1D, 0x24, 0x11,
+    0xA2, 0x12, 0x33, 0x2A, 0x82, 0x2C, 0x11, 0x11, 0x19, 0x3B, 0x19, 0x47, 0x07, 0x07, 0x0A, 0x02,
+    0x00, 0x75, 0x01, 0x00, 0x00, 0x01, 0x03, 0x06, 0x01, 0x82, 0x00, 0x01, 0x07, 0x7B, 0x84, 0x00,
+    0x01, 0x07, 0x5D, 0x84, 0x00, 0x80, 0x03, 0x81, 0x05, 0x98, 0x00, 0x15, 0x01, 0x00, 0x86, 0x35,
+    0x85, 0x75, 0x82, 0x5F, 0x00, 0x56, 0x23, 0x0C, 0x25, 0x13, 0x8A, 0x58, 0x32, 0x8A, 0x08, 0x87,
+    0x87, 0x48, 0x86, 0x00, 0x01, 0x18, 0x4F, 0x82, 0x00, 0x14, 0x52, 0x18, 0x00, 0x0B, 0x92, 0x32,
+    0x1D, 0x2A, 0x48, 0x06, 0x1C, 0x3D, 0x03, 0x26, 0x9C, 0x9C, 0x6C, 0x7B, 0x00, 0x03, 0x1A, 0x82,
+    0x00, 0x05, 0x03, 0x00, 0x01, 0x01, 0x00, 0x55, 0x82, 0x00, 0x1B, 0x04, 0x00, 0x00, 0x04, 0x00,
+    0x0D, 0x64, 0x2A, 0x7D, 0x7D, 0x7E, 0x23, 0x89, 0x00, 0x06, 0x1E, 0x3E, 0x20, 0x1D, 0x1D, 0x48,
+    0x52, 0x16, 0x04, 0x01, 0x0A, 0x48, 0x03, 0x85, 0x00, 0x11, 0x03, 0xA1, 0x02, 0x34, 0x02, 0x00,
+    0x04, 0x06, 0x02, 0x02, 0x00, 0x00, 0x05, 0x08, 0x06, 0x01, 0x75, 0x05, 0x82, 0x00, 0x07, 0x04,
+    0x00, 0x03, 0x2A, 0x67, 0x0F, 0x33, 0x24, 0x81, 0x21, 0x82, 0x24, 0x0D, 0x67, 0x1D, 0x83, 0x14,
+    0x14, 0x31, 0x14, 0x20, 0x14, 0x14, 0x6E, 0x00, 0x00, 0x1A, 0x82, 0x93, 0x06, 0x96, 0x48, 0x03,
+    0x3C, 0x6B, 0x4C, 0x2E, 0x81, 0x11, 0x2A, 0x20, 0x24, 0x24, 0x21, 0x24, 0x67, 0x27, 0x2A, 0x0F,
+    0xA2, 0x12, 0x33, 0x2A, 0x0F, 0x0F, 0x2C, 0x2C, 0x53, 0x65, 0x8C, 0x3B, 0x01, 0x04, 0x06, 0x34,
+    0x04, 0x02, 0x01, 0x00, 0x03, 0x3D, 0x48, 0x06, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x34, 0x04, 0x87, 0x00, 0x03, 0x01, 0x06, 0x06, 0x02, 0x96, 0x00, 0x17, 0x06, 0x9F, 0x00, 0x00,
+    0x5F, 0x1D, 0x53, 0x82, 0x49, 0x1A, 0x1B, 0x14, 0x35, 0x7E, 0x5F, 0x4F, 0x5F, 0x73, 0x0B, 0x54,
+    0x08, 0x3B, 0x03, 0x01, 0x85, 0x00, 0x01, 0x02, 0x56, 0x82, 0x00, 0x14, 0x1A, 0x60, 0x00, 0x32,
+    0x5C, 0x0B, 0x2B, 0x7D, 0x17, 0x18, 0x06, 0x85, 0x08, 0x4F, 0x4D, 0x3E, 0xA0, 0x51, 0x02, 0x52,
+    0x6E, 0x82, 0x00, 0x07, 0x02, 0x00, 0x00, 0x01, 0x51, 0x3B, 0x00, 0x04, 0x84, 0x00, 0x17, 0x04,
+    0x00, 0x2C, 0x7C, 0x9C, 0x3F, 0x01, 0x18, 0x1E, 0x16, 0x04, 0x56, 0x26, 0x30, 0x53, 0x2A, 0x4F,
+    0x01, 0x7B, 0x00, 0x07, 0x05, 0x08, 0x03, 0x84, 0x00, 0x03, 0x04, 0x4F, 0x13, 0x02, 0x82, 0x00,
+    0x0B, 0x02, 0x00, 0x34, 0x00, 0x00, 0x02, 0x05, 0x07, 0x04, 0x06, 0x1C, 0x3B, 0x83, 0x00, 0x18,
+    0x04, 0x34, 0x8C, 0x64, 0x0F, 0x9D, 0x24, 0x24, 0x21, 0x24, 0x21, 0x24, 0x64, 0x1D, 0x20, 0x1D,
+    0x21, 0x14, 0x14, 0x20, 0x14, 0x14, 0x47, 0x00, 0x3B, 0x82, 0x93, 0x07, 0x90, 0x62, 0x05, 0x91,
+    0x9A, 0x2E, 0x4C, 0x22, 0x02, 0x2A, 0x11, 0x1D, 0x83, 0x24, 0x81, 0x2A, 0x0F, 0x11, 0x0F, 0xA2,
+    0x12, 0x38, 0x11, 0x0F, 0x0F, 0x2C, 0x2C, 0x78, 0x71, 0x50, 0x79, 0x90, 0x47, 0x86, 0x00, 0x0B,
+    0x0A, 0x3B, 0x08, 0x75, 0x01, 0x05, 0x01, 0x04, 0x07, 0x00, 0x00, 0x04, 0x82, 0x00, 0x80, 0x04,
+    0x84, 0x00, 0x81, 0x02, 0x98, 0x00, 0x17, 0x06, 0x02, 0x00, 0x04, 0x00, 0x52, 0x52, 0x07, 0x29,
+    0x3E, 0x6C, 0x9C, 0x42, 0x16, 0x49, 0x16, 0x52, 0x0B, 0x8A, 0x08, 0x0A, 0x13, 0x03, 0x02, 0x86,
+    0x00, 0x81, 0x63, 0x81, 0x00, 0x1C, 0x4F, 0x56, 0x52, 0x25, 0x42, 0x82, 0x6B, 0x31, 0x09, 0x0C,
+    0x25, 0x03, 0x13, 0x9F, 0x81, 0x1B, 0x0C, 0x51, 0x19, 0x67, 0x18, 0x00, 0x00, 0x01, 0x06, 0x48,
+    0x06, 0x03, 0x04, 0x89, 0x00, 0x0E, 0x78, 0x9C, 0x43, 0x95, 0x00, 0x00, 0x08, 0x35, 0x01, 0x04,
+    0x06, 0x2B, 0x35, 0x4B, 0x3B, 0x83, 0x00, 0x02, 0x06, 0x05, 0x03, 0x83, 0x00, 0x02, 0x02, 0x47,
+    0x4F, 0x83, 0x00, 0x80, 0x04, 0x84, 0x00, 0x07, 0x07, 0x03, 0x01, 0x07, 0x03, 0x06, 0x00, 0x02,
+    0x84, 0x00, 0x21, 0x05, 0x11, 0x2C, 0x9D, 0x0F, 0x1D, 0x42, 0x24, 0x21, 0x24, 0x42, 0x20, 0x1D,
+    0x20, 0x14, 0x20, 0x14, 0x14, 0x31, 0x2A, 0x86, 0x92, 0x87, 0x65, 0x52, 0x26, 0x34, 0x03, 0x07,
+    0x9F, 0x0D, 0x4C, 0x48, 0x00, 0x0E, 0x67, 0x2A, 0x1D, 0x24, 0x27, 0x24, 0x64, 0x2A, 0x2C, 0x11,
+    0x0F, 0xA2, 0xA2, 0x33, 0x11, 0x82, 0x0F, 0x06, 0x2A, 0x19, 0x0D, 0x9D, 0x3C, 0x3B, 0x3D, 0x84,
+    0x00, 0x09, 0x22, 0x04, 0x52, 0x3B, 0x08, 0x0A, 0x03, 0x05, 0x03, 0x00, 0x81, 0x5F, 0x81, 0x00,
+    0x81, 0x01, 0x87, 0x00, 0x80, 0x02, 0x97, 0x00, 0x02, 0x01, 0x06, 0x9F, 0x82, 0x00, 0x13, 0x07,
+    0x02, 0x25, 0x66, 0x21, 0x17, 0x3F, 0x29, 0x5D, 0x16, 0x82, 0x79, 0x13, 0x3B, 0x0A, 0x05, 0x08,
+    0x48, 0x02, 0x01, 0x85, 0x00, 0x1F, 0x01, 0x86, 0x00, 0x02, 0x86, 0x29, 0x23, 0x09, 0x09, 0x25,
+    0x03, 0x1D, 0x09, 0x94, 0x09, 0x89, 0x60, 0x00, 0x23, 0x3E, 0x66, 0x35, 0x83, 0x19, 0x5F, 0x00,
+    0x00, 0x01, 0x03, 0x0A, 0x05, 0x07, 0x88, 0x00, 0x05, 0x04, 0x00, 0x26, 0x7C, 0x25, 0x4F, 0x82,
+    0x00, 0x08, 0x3C, 0x4F, 0x00, 0x0A, 0x71, 0x7C, 0x35, 0x79, 0x22, 0x82, 0x00, 0x02, 0x06, 0x05,
+    0x03, 0x83, 0x00, 0x02, 0x03, 0x3C, 0x91, 0x82, 0x00, 0x80, 0x02, 0x85, 0x00, 0x06, 0x98, 0x45,
+    0x48, 0x06, 0x01, 0x03, 0x02, 0x85, 0x00, 0x12, 0x01, 0x68, 0x64, 0x5B, 0x19, 0x0F, 0x1D, 0x24,
+    0x67, 0x24, 0x24, 0x20, 0x21, 0x21, 0x83, 0x2A, 0x2A, 0x1E, 0x6E, 0x82, 0x93, 0x02, 0x18, 0x02,
+    0x07, 0x83, 0x00, 0x04, 0x58, 0x65, 0x87, 0x00, 0x86, 0x81, 0x2A, 0x16, 0x1D, 0x67, 0x2A, 0x67,
+    0x1D, 0x67, 0x11, 0x11, 0x0F, 0xA2, 0xA2, 0x72, 0x11, 0x2C, 0x0F, 0x0F, 0x2A, 0x6E, 0x65, 0x4C,
+    0x01, 0x01, 0x02, 0x83, 0x00, 0x10, 0x01, 0x0A, 0x01, 0x03, 0x3C, 0x08, 0x0A, 0x62, 0x08, 0x03,
+    0x02, 0x3C, 0x1F, 0x02, 0x02, 0x06, 0x02, 0xA0, 0x00, 0x18, 0x01, 0x03, 0x04, 0x00, 0x00, 0x04,
+    0x1F, 0x3F, 0x7D, 0x1E, 0x14, 0x7E, 0x74, 0x06, 0x1F, 0x95, 0x05, 0x05, 0x58, 0x08, 0x3B, 0x05,
+    0x05, 0x06, 0x02, 0x87, 0x00, 0x81, 0x04, 0x15, 0x00, 0x07, 0x29, 0x27, 0x3E, 0x09, 0x2D, 0x02,
+    0x2B, 0x3E, 0x8D, 0x36, 0x09, 0x39, 0x1F, 0x2D, 0x94, 0x4A, 0x66, 0x64, 0x53, 0x1F, 0x82, 0x00,
+    0x03, 0x06, 0x0A, 0x03, 0x01, 0x8A, 0x00, 0x0E, 0x02, 0x20, 0x5F, 0x48, 0x49, 0x00, 0x01, 0x5E,
+    0x2B, 0x5D, 0x01, 0x16, 0x1F, 0x03, 0x91, 0x83, 0x00, 0x02, 0x03, 0x05, 0x03, 0x82, 0x00, 0x07,
+    0x01, 0x18, 0x1C, 0x04, 0x00, 0x00, 0x01, 0x02, 0x85, 0x00, 0x06, 0x98, 0x60, 0x54, 0x0A, 0x01,
+    0x03, 0x07, 0x82, 0x00, 0x80, 0x02, 0x82, 0x00, 0x0C, 0x92, 0x33, 0x4C, 0x2B, 0x16, 0x1D, 0x27,
+    0x1D, 0x24, 0x1D, 0x84, 0x2D, 0x67, 0x82, 0x93, 0x01, 0x6E, 0x1A, 0x83, 0x93, 0x0A, 0x1A, 0x06,
+    0x00, 0x04, 0x5D, 0x3B, 0x65, 0x96, 0x00, 0x63, 0x93, 0x02, 0x11, 0x2A, 0x1D, 0x82, 0x67, 0x0F,
+    0x64, 0x2A, 0x11, 0x11, 0x2C, 0xA2, 0xA2, 0x33, 0x11, 0x2C, 0x11, 0x0F, 0x11, 0x19, 0x90, 0x6B,
+    0x86, 0x00, 0x0A, 0x03, 0x05, 0x01, 0x07, 0x45, 0x1C, 0x3D, 0x06, 0x13, 0x26, 0x08, 0x83, 0x00,
+    0x80, 0x02, 0x9F, 0x00, 0x81, 0x02, 0x18, 0x01, 0x03, 0x02, 0x07, 0x03, 0x82, 0x3E, 0x0C, 0x81,
+    0x66, 0x3F, 0x88, 0x5F, 0x03, 0x4E, 0x87, 0x02, 0x03, 0x3C, 0x0A, 0x08, 0x13, 0x05, 0x06, 0x02,
+    0x87, 0x00, 0x17, 0x02, 0x34, 0x00, 0x00, 0x52, 0x11, 0x9C, 0x09, 0x23, 0x02, 0x5A, 0x7C, 0x09,
+    0x36, 0x8D, 0x09, 0x36, 0x0C, 0x09, 0x36, 0x17, 0x2C, 0x82, 0x18, 0x82, 0x00, 0x02, 0x01, 0x03,
+    0x01, 0x8B, 0x00, 0x0E, 0x02, 0x68, 0x56, 0x13, 0x85, 0x04, 0x00, 0x5E, 0x1D, 0x7A, 0x00, 0x01,
+    0x00, 0x00, 0x02, 0x83, 0x00, 0x03, 0x01, 0x48, 0x03, 0x02, 0x82, 0x00, 0x80, 0x01, 0x83, 0x00,
+    0x01, 0x02, 0x01, 0x84, 0x00, 0x07, 0x05, 0x3C, 0x41, 0x6B, 0x87, 0x03, 0x9F, 0x04, 0x86, 0x00,
+    0x10, 0x02, 0x92, 0x41, 0x05, 0x0F, 0x1D, 0x24, 0x1D, 0x64, 0xA4, 0x93, 0xA4, 0xA4, 0x93, 0x93,
+    0xA4, 0x26, 0x85, 0x93, 0x09, 0x52, 0x01, 0x00, 0x98, 0x87, 0x91, 0x06, 0x00, 0x26, 0x93, 0x81,
+    0x2A, 0x81, 0x64, 0x11, 0x1D, 0x64, 0x67, 0x11, 0x11, 0x2A, 0x2C, 0xA2, 0xA2, 0x33, 0x11, 0x2C,
+    0x2C, 0x0F, 0x2C, 0x19, 0x07, 0x06, 0x86, 0x00, 0x0E, 0x05, 0x03, 0x01, 0x03, 0x60, 0x45, 0x05,
+    0x48, 0x3C, 0x96, 0x06, 0x04, 0x00, 0x04, 0x00, 0x81, 0x01, 0x9E, 0x00, 0x81, 0x01, 0x13, 0x00,
+    0x04, 0x34, 0x51, 0x2A, 0x27, 0x42, 0x23, 0x4D, 0x30, 0x98, 0x4E, 0x06, 0x29, 0x56, 0x02, 0x75,
+    0x06, 0x05, 0x48, 0x82, 0x05, 0x80, 0x01, 0x8C, 0x00, 0x13, 0x95, 0x30, 0x7D, 0x99, 0x43, 0x02,
+    0x78, 0x27, 0x99, 0x4A, 0x36, 0x8D, 0x09, 0x8D, 0x4A, 0x36, 0x31, 0x72, 0x1A, 0x86, 0x82, 0x00,
+    0x81, 0x01, 0x8E, 0x00, 0x0D, 0x04, 0x13, 0x41, 0x00, 0x34, 0x06, 0x5F, 0x4E, 0x04, 0x01, 0x01,
+    0x04, 0x00, 0x04, 0x82, 0x00, 0x06, 0x02, 0x03, 0x06, 0x00, 0x00, 0x04, 0x22, 0x89, 0x00, 0x07,
+    0x01, 0x03, 0x13, 0x0D, 0x65, 0x32, 0x13, 0x05, 0x89, 0x00, 0x0E, 0x02, 0x00, 0x6A, 0x12, 0x2C,
+    0x1D, 0x1D, 0xA4, 0x93, 0x93, 0xA4, 0x19, 0x93, 0x93, 0x1A, 0x87, 0x93, 0x08, 0x26, 0x00, 0x00,
+    0x5D, 0x01, 0x18, 0x07, 0x00, 0x52, 0x16, 0x2A, 0x11, 0x67, 0x67, 0x1D, 0x1D, 0x67, 0x11, 0x11,
+    0x2A, 0x2C, 0xA2, 0xA2, 0x33, 0x11, 0x2C, 0x2C, 0x0F, 0x2C, 0x78, 0x00, 0x00, 0x04, 0x84, 0x00,
+    0x0A, 0x02, 0x05, 0x01, 0x06, 0x58, 0x05, 0x48, 0x3C, 0x56, 0x03, 0x01, 0x84, 0x00, 0x80, 0x01,
+    0x81, 0x03, 0xA0, 0x00, 0x10, 0x62, 0x00, 0x7E, 0x3E, 0x3C, 0x30, 0x11, 0x82, 0x00, 0x4E, 0x29,
+    0x26, 0x1F, 0x00, 0x07, 0x02, 0x06, 0x81, 0x03, 0x82, 0x06, 0x01, 0x01, 0x06, 0x88, 0x00, 0x16,
+    0x02, 0x04, 0x00, 0x1A, 0x68, 0x31, 0x94, 0x1B, 0x01, 0x35, 0x11, 0x70, 0x09, 0x4A, 0x95, 0x81,
+    0x09, 0x09, 0x76, 0x1D, 0x71, 0x1A, 0x45, 0x82, 0x00, 0x81, 0x01, 0x8D, 0x00, 0x0C, 0x34, 0x04,
+    0x03, 0x5A, 0x00, 0x02, 0x04, 0x00, 0x1F, 0x63, 0x02, 0x03, 0x04, 0x85, 0x00, 0x01, 0x03, 0x06,
+    0x8D, 0x00, 0x08, 0x03, 0x08, 0x08, 0x0D, 0x0D, 0x32, 0x13, 0x01, 0x04, 0x88, 0x00, 0x0E, 0x02,
+    0x3C, 0x0F, 0x33, 0x2C, 0x67, 0x1D, 0xA4, 0x93, 0x93, 0xA4, 0xA4, 0x93, 0x52, 0x26, 0x88, 0x93,
+    0x07, 0x03, 0x04, 0x00, 0x96, 0x93, 0x26, 0x00, 0x49, 0x81, 0x0F, 0x81, 0x2A, 0x0F, 0x64, 0x67,
+    0x2A, 0x0F, 0x11, 0x2A, 0x0F, 0xA2, 0xA2, 0x72, 0x0F, 0x0F, 0x11, 0x0F, 0x2C, 0x68, 0x87, 0x00,
+    0x13, 0x03, 0x01, 0x00, 0x06, 0x48, 0x0A, 0x03, 0x63, 0x3C, 0x00, 0x5D, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x02, 0x06, 0x75, 0x02, 0xA1, 0x00, 0x17, 0x26, 0x7D, 0x35, 0x24, 0x30, 0x04, 0x60, 0x69,
+    0x52, 0x16, 0x7B, 0x03, 0x9F, 0x03, 0x02, 0x02, 0x06, 0x06, 0x02, 0x9F, 0x01, 0x26, 0x86, 0x04,
+    0x82, 0x00, 0x82, 0x02, 0x1B, 0x00, 0x45, 0x04, 0x04, 0x51, 0x6E, 0x1D, 0x3E, 0x6C, 0x00, 0x6E,
+    0x24, 0xA0, 0x09, 0x09, 0x25, 0x00, 0x25, 0x3E, 0x83, 0x42, 0x7A, 0x6E, 0x45, 0x00, 0x02, 0x02,
+    0x01, 0x8C, 0x00, 0x05, 0x02, 0x04, 0x34, 0x00, 0x1A, 0x50, 0x84, 0x00, 0x03, 0x01, 0x03, 0x00,
+    0x02, 0x85, 0x00, 0x01, 0x02, 0x06, 0x8D, 0x00, 0x08, 0x05, 0x47, 0x37, 0x5C, 0x0D, 0x0B, 0x0A,
+    0x00, 0x34, 0x89, 0x00, 0x0C, 0x75, 0x9D, 0x4B, 0x0F, 0x67, 0x2A, 0xA4, 0x93, 0x93, 0xA4, 0x93,
+    0x52, 0x26, 0x88, 0x93, 0x08, 0x07, 0x00, 0x00, 0x86, 0x5B, 0x93, 0x93, 0x63, 0x02, 0x05, 0x0F,
+    0x4B, 0x2A, 0x2A, 0x67, 0x2A, 0x82, 0x0F, 0x04, 0x11, 0x0F, 0xA2, 0xA2, 0x72, 0x84, 0x0F, 0x02,
+    0x68, 0x00, 0x02, 0x84, 0x00, 0x0F, 0x04, 0x48, 0x00, 0x00, 0x06, 0x48, 0x03, 0x01, 0x4F, 0x05,
+    0x01, 0x00, 0x00, 0x06, 0x02, 0x01, 0x82, 0x00, 0x01, 0x02, 0x01, 0x9F, 0x00, 0x19, 0x04, 0x00,
+    0x00, 0x11, 0x64, 0x29, 0x34, 0x0A, 0x74, 0x5F, 0x25, 0x28, 0x02, 0x02, 0x03, 0x06, 0x06, 0x00,
+    0x01, 0x03, 0x01, 0x5D, 0x01, 0x68, 0x79, 0x01, 0x82, 0x00, 0x1E, 0x02, 0x03, 0x0A, 0x3D, 0x13,
+    0x47, 0x00, 0x7B, 0x29, 0x5F, 0x26, 0x22, 0x00, 0x52, 0x31, 0x30, 0x94, 0x94, 0xA0, 0x00, 0x00,
+    0x45, 0x26, 0x11, 0x7E, 0x68, 0x01, 0x00, 0x01, 0x01, 0x22, 0x8E, 0x00, 0x07, 0x02, 0x00, 0x56,
+    0x8C, 0x02, 0x04, 0x00, 0x34, 0x82, 0x04, 0x02, 0x22, 0x02, 0x22, 0x82, 0x00, 0x06, 0x04, 0x00,
+    0x02, 0x02, 0x00, 0x00, 0x02, 0x89, 0x00, 0x0A, 0x01, 0x1C, 0x79, 0x5F, 0x5F, 0x6A, 0x87, 0x05,
+    0x07, 0x00, 0x02, 0x87, 0x00, 0x0C, 0x02, 0x04, 0xA1, 0x19, 0x19, 0x2C, 0x2A, 0x93, 0xA4, 0x93,
+    0xA4, 0x26, 0x18, 0x82, 0x93, 0x80, 0xA4, 0x83, 0x93, 0x05, 0x5B, 0x07, 0x00, 0x01, 0x04, 0x26,
+    0x83, 0x93, 0x80, 0x7B, 0x81, 0x19, 0x83, 0x2C, 0x82, 0x0F, 0x0A, 0x30, 0x0F, 0xA2, 0xA2, 0x72,
+    0x0F, 0x19, 0x19, 0x0F, 0x0F, 0x5E, 0x86, 0x00, 0x05, 0x01, 0x04, 0x00, 0x02, 0x01, 0x03, 0x82,
+    0x06, 0x81, 0x01, 0x83, 0x00, 0x05, 0x05, 0x55, 0x03, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x81, 0x01,
+    0x19, 0x45, 0x07, 0x00, 0x3C, 0x06, 0x5D, 0x5D, 0x7A, 0x4E, 0x88, 0x16, 0x75, 0x06, 0x06, 0x03,
+    0x01, 0x06, 0x00, 0x02, 0x03, 0x06, 0x01, 0x07, 0x62, 0x02, 0x01, 0x82, 0x00, 0x09, 0x03, 0x06,
+    0x49, 0x3B, 0x01, 0x0D, 0x62, 0x00, 0x16, 0x86, 0x82, 0x00, 0x0E, 0x56, 0x7C, 0x63, 0x4D, 0x3E,
+    0x3E, 0x7A, 0x00, 0x00, 0x1F, 0x31, 0x83, 0x37, 0x01, 0x02, 0x81, 0x01, 0x90, 0x00, 0x81, 0x02,
+    0x04, 0x4F, 0x03, 0x00, 0x00, 0x07, 0x82, 0x00, 0x05, 0x9F, 0x01, 0x05, 0x00, 0x60, 0x52, 0x82,
+    0x00, 0x80, 0x01, 0x8D, 0x00, 0x07, 0x07, 0x54, 0x13, 0x13, 0x32, 0x13, 0x0A, 0x06, 0x87, 0x00,
+    0x0D, 0x01, 0x00, 0x01, 0x01, 0x00, 0x5B, 0x19, 0x0F, 0x0F, 0x1A, 0x2A, 0x93, 0x5B, 0x96, 0x84,
+    0x93, 0x80, 0x5B, 0x82, 0x93, 0x06, 0x1A, 0x5D, 0x00, 0x04, 0x18, 0x93, 0x5B, 0x82, 0x93, 0x80,
+    0x26, 0x81, 0x19, 0x82, 0x2C, 0x83, 0x0F, 0x0A, 0x35, 0x33, 0xA2, 0xA2, 0x72, 0x0F, 0x0F, 0x19,
+    0x78, 0x0F, 0x82, 0x82, 0x00, 0x80, 0x04, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81,
+    0x03, 0x01, 0x06, 0x01, 0x84, 0x00, 0x03, 0x03, 0x0B, 0x3D, 0x01, 0xA0, 0x00, 0x0D, 0x1F, 0x16,
+    0x52, 0x00, 0x03, 0x22, 0x00, 0x00, 0x51, 0x7A, 0x28, 0x60, 0x00, 0x04, 0x82, 0x00, 0x08, 0x02,
+    0x01, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x01, 0x83, 0x00, 0x19, 0x02, 0x03, 0x02, 0x00, 0x00,
+    0x0D, 0x13, 0x00, 0x18, 0x16, 0x5D, 0x00, 0x00, 0x45, 0x83, 0x71, 0x4B, 0x9C, 0x76, 0x23, 0x4F,
+    0x42, 0x14, 0x9C, 0x24, 0x18, 0x81, 0x00, 0x81, 0x01, 0x87, 0x00, 0x80, 0x01, 0x85, 0x00, 0x11,
+    0x04, 0x49, 0x22, 0x29, 0x6B, 0x0D, 0x53, 0x51, 0x01, 0x0A, 0x11, 0x11, 0x45, 0x01, 0x01, 0x49,
+    0x4F, 0x52, 0x81, 0x00, 0x81, 0x02, 0x8D, 0x00, 0x0D, 0x01, 0x48, 0x58, 0x37, 0x79, 0x47, 0x0A,
+    0x02, 0x00, 0x04, 0x02, 0x00, 0x01, 0x4F, 0x83, 0x00, 0x0B, 0x04, 0x00, 0x34, 0x05, 0x78, 0x4B,
+    0xA4, 0x93, 0xA4, 0x2D, 0x86, 0x18, 0x84, 0x93, 0x80, 0x26, 0x82, 0x93, 0x05, 0x52, 0x02, 0x07,
+    0x86, 0x52, 0x5B, 0x84, 0x93, 0x81, 0x19, 0x86, 0x0F, 0x0A, 0x35, 0x33, 0xA2, 0xA2, 0x72, 0x0F,
+    0x0F, 0x9D, 0x5E, 0x9D, 0x86, 0x8A, 0x00, 0x04, 0x02, 0x01, 0x06, 0x06, 0x02, 0x86, 0x00, 0x02,
+    0x02, 0x01, 0x02, 0x9F, 0x00, 0x0C, 0x45, 0x1F, 0x18, 0x7E, 0x7B, 0x18, 0x00, 0x56, 0x52, 0x1A,
+    0x5F, 0x52, 0x1A, 0x82, 0x18, 0x0B, 0x56, 0x1F, 0x45, 0x00, 0x00, 0x45, 0x16, 0x25, 0x25, 0x29,
+    0x45, 0x02, 0x82, 0x00, 0x1C, 0x03, 0x01, 0x01, 0x73, 0x04, 0x65, 0x79, 0x00, 0x28, 0x29, 0x02,
+    0x00, 0x00, 0x34, 0x20, 0x17, 0x20, 0x7D, 0x23, 0x81, 0x3E, 0x9C, 0x31, 0x3E, 0x27, 0x3C, 0x34,
+    0x00, 0x01, 0x8E, 0x00, 0x12, 0x1A, 0x42, 0x17, 0x0C, 0x9C, 0x20, 0x20, 0x7C, 0x35, 0x1A, 0x1C,
+    0x27, 0x9C, 0x53, 0x02, 0x1C, 0x35, 0x4F, 0x86, 0x82, 0x00, 0x80, 0x02, 0x8F, 0x00, 0x05, 0x0A,
+    0x58, 0x37, 0x08, 0x03, 0x02, 0x83, 0x00, 0x04, 0x55, 0x5B, 0x26, 0x22, 0x04, 0x82, 0x00, 0x81,
+    0x04, 0x07, 0xA1, 0x4B, 0x35, 0x5B, 0x93, 0x52, 0x90, 0x5B, 0x84, 0x93, 0x01, 0xA4, 0x5B, 0x82,
+    0x93, 0x09, 0x00, 0x49, 0x26, 0x52, 0x52, 0x5B, 0x93, 0x93, 0x26, 0x93, 0x81, 0x19, 0x86, 0x0F,
+    0x0B, 0x4B, 0x33, 0xA2, 0xA2, 0x72, 0x19, 0x19, 0x9D, 0x9D, 0x71, 0x00, 0x04, 0x8A, 0x00, 0x82,
+    0x02, 0x86, 0x00, 0x05, 0x06, 0x00, 0x00, 0x02, 0x02, 0x04, 0x9C, 0x00, 0x1C, 0x07, 0x56, 0x4F,
+    0x60, 0x1A, 0x45, 0x16, 0x04, 0x14, 0x25, 0x16, 0x3F, 0x2D, 0x6C, 0x3E, 0x8B, 0x43, 0x81, 0x2D,
+    0x42, 0x45, 0x45, 0x42, 0x3F, 0x16, 0x16, 0x3F, 0x42, 0x1A, 0x82, 0x00, 0x81, 0x02, 0x17, 0x00,
+    0x4C, 0x03, 0x0D, 0x41, 0x00, 0x00, 0x52, 0x3C, 0x55, 0x55, 0x00, 0x2A, 0x09, 0x4A, 0x1E, 0x02,
+    0x30, 0x4A, 0x31, 0x9C, 0x3E, 0x3F, 0x47, 0x8D, 0x00, 0x03, 0x04, 0x00, 0x1A, 0x6C, 0x83, 0x94,
+    0x12, 0x8B, 0x66, 0x4D, 0x1D, 0x7D, 0x9C, 0x23, 0x1C, 0x27, 0x24, 0x02, 0x1C, 0x53, 0x05, 0x07,
+    0x04, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x80, 0x01, 0x83, 0x00, 0x05, 0x06, 0x08, 0x58, 0x48, 0x03,
+    0x01, 0x82, 0x00, 0x06, 0x04, 0x65, 0x2E, 0x5B, 0x49, 0x00, 0x04, 0x82, 0x00, 0x04, 0x5D, 0x00,
+    0x5E, 0x6E, 0x93, 0x83, 0x26, 0x85, 0x93, 0x0D, 0x26, 0x5B, 0x93, 0x90, 0x00, 0x91, 0x1A, 0x1A,
+    0x5B, 0x93, 0x5B, 0x93, 0x93, 0x5B, 0x01, 0x78, 0x19, 0x86, 0x0F, 0x09, 0x4B, 0x33, 0xA2, 0xA2,
+    0x72, 0x19, 0x19, 0x5E, 0x9D, 0x08, 0x8C, 0x00, 0x81, 0x02, 0x86, 0x00, 0x06, 0x02, 0x0A, 0x01,
+    0x00, 0x00, 0x02, 0x01, 0x9C, 0x00, 0x1D, 0x4F, 0x63, 0x63, 0x18, 0x56, 0x63, 0x30, 0x1A, 0x14,
+    0x07, 0x3F, 0x1B, 0x3F, 0x1A, 0x23, 0x4F, 0x3F, 0x42, 0x25, 0x2D, 0x01, 0x25, 0x1A, 0x00, 0x1F,
+    0x1C, 0x00, 0x1C, 0x2D, 0x1C, 0x82, 0x00, 0x19, 0x22, 0x00, 0x2E, 0x51, 0x87, 0x0D, 0x00, 0x04,
+    0x30, 0x3C, 0x78, 0x67, 0x00, 0x4B, 0x94, 0x94, 0x2D, 0x00, 0x49, 0x4D, 0x66, 0x76, 0x9C, 0x52,
+    0x49, 0x01, 0x8E, 0x00, 0x13, 0x4F, 0x83, 0x9C, 0x09, 0x1E, 0x81, 0x3E, 0x1B, 0x3E, 0x8B, 0x2A,
+    0x9C, 0x7C, 0x5B, 0x47, 0x4B, 0x22, 0x01, 0x82, 0x47, 0x83, 0x00, 0x80, 0x01, 0x89, 0x00, 0x01,
+    0x01, 0x03, 0x83, 0x00, 0x04, 0x01, 0x08, 0x47, 0x48, 0x06, 0x84, 0x00, 0x02, 0x26, 0x41, 0x01,
+    0x82, 0x00, 0x0B, 0x90, 0x26, 0x00, 0x00, 0x04, 0x73, 0xA4, 0x1A, 0x18, 0x52, 0x5B, 0x26, 0x84,
+    0x93, 0x0E, 0x65, 0x7A, 0x51, 0x37, 0x03, 0x00, 0x18, 0x93, 0x1A, 0x93, 0x26, 0x62, 0x86, 0x93,
+    0x5B, 0x01, 0x78, 0x19, 0x86, 0x0F, 0x0A, 0x4B, 0x9D, 0xA2, 0xA2, 0x72, 0x19, 0x19, 0x5E, 0x65,
+    0x02, 0x04, 0x8C, 0x00, 0x02, 0x02, 0x01, 0x02, 0x83, 0x00, 0x07, 0x04, 0x02, 0x05, 0x06, 0x00,
+    0x00, 0x02, 0x01, 0x9B, 0x00, 0x3A, 0x07, 0x18, 0x4F, 0x63, 0x1F, 0x63, 0x7E, 0x27, 0x16, 0x14,
+    0x02, 0x61, 0x0C, 0x95, 0x2D, 0x95, 0x1A, 0x94, 0x42, 0x42, 0x2D, 0x00, 0x4E, 0x04, 0x01, 0x42,
+    0x6C, 0x00, 0x00, 0x1F, 0x1A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x5A, 0x41, 0x02, 0x85, 0x00, 0x00,
+    0x82, 0x6A, 0x8C, 0x20, 0x1C, 0x82, 0x3E, 0x94, 0x2D, 0x01, 0x02, 0x7E, 0x3E, 0x4D, 0x24, 0x52,
+    0x7B, 0x8D, 0x00, 0x17, 0x04, 0x00, 0x4F, 0x9D, 0x0F, 0x20, 0x20, 0x21, 0x6C, 0x17, 0x17, 0x89,
+    0x16, 0x7E, 0x3D, 0x65, 0x33, 0x27, 0x49, 0x06, 0x5F, 0x52, 0x63, 0x60, 0x8B, 0x00, 0x02, 0x03,
+    0x0A, 0x03, 0x84, 0x00, 0x03, 0x3D, 0x47, 0x05, 0x02, 0x83, 0x00, 0x01, 0x07, 0x03, 0x82, 0x00,
+    0x0D, 0x3B, 0x19, 0x0F, 0x0F, 0x4F, 0x00, 0x00, 0x62, 0x82, 0x26, 0x5B, 0x93, 0x5B, 0x26, 0x84,
+    0x93, 0x0E, 0x90, 0x28, 0x28, 0x02, 0x22, 0x04, 0x18, 0x93, 0x93, 0x26, 0x02, 0x86, 0x48, 0x86,
+    0x96, 0x01, 0x78, 0x19, 0x83, 0x0F, 0x0B, 0x19, 0x0F, 0x0F, 0x4B, 0x9D, 0xA2, 0xA2, 0x72, 0x19,
+    0x78, 0x9D, 0x85, 0x82, 0x00, 0x80, 0x04, 0x8A, 0x00, 0x02, 0x02, 0x01, 0x02, 0x85, 0x00, 0x01,
+    0x03, 0x01, 0x9F, 0x00, 0x1E, 0x1C, 0x63, 0x1F, 0x4F, 0x26, 0x1F, 0x7E, 0x2D, 0x1E, 0x30, 0x1F,
+    0x4A, 0x23, 0x25, 0x36, 0x3F, 0x30, 0x6C, 0x25, 0x23, 0x1A, 0x02, 0x2D, 0x25, 0x52, 0x16, 0x23,
+    0x04, 0x00, 0x63, 0x1A, 0x84, 0x00, 0x16, 0x0D, 0x4C, 0x3D, 0x00, 0x07, 0x00, 0x1A, 0x33, 0x78,
+    0x30, 0x1F, 0x1C, 0x66, 0x36, 0x25, 0x00, 0x56, 0x03, 0x42, 0x27, 0x31, 0x52, 0x34, 0x8E, 0x00,
+    0x16, 0x03, 0x25, 0x33, 0x19, 0x24, 0x81, 0x6C, 0x89, 0x25, 0x95, 0x2D, 0x6E, 0x16, 0x7A, 0x91,
+    0x2A, 0x81, 0x07, 0x06, 0x60, 0x52, 0x56, 0x4F, 0x8A, 0x00, 0x03, 0x06, 0x08, 0x08, 0x06, 0x82,
+    0x02, 0x81, 0x00, 0x03, 0x03, 0x08, 0x03, 0x01, 0x87, 0x00, 0x80, 0x80, 0x82, 0x2C, 0x0A, 0x9D,
+    0x13, 0x0A, 0x34, 0x00, 0x9F, 0x5B, 0x93, 0x5B, 0x93, 0x26, 0x83, 0x93, 0x0D, 0x26, 0x91, 0x00,
+    0x92, 0x49, 0x9F, 0x00, 0x03, 0x18, 0x5B, 0x86, 0x5D, 0x3D, 0x08, 0x81, 0x00, 0x81, 0x78, 0x83,
+    0x0F, 0x81, 0x19, 0x0B, 0x0F, 0x6E, 0x9D, 0xA2, 0xA2, 0x72, 0x78, 0x78, 0x8C, 0x00, 0x04, 0x02,
+    0x8D, 0x00, 0x81, 0x02, 0x84, 0x00, 0x01, 0x04, 0x07, 0xA0, 0x00, 0x1E, 0x45, 0x3C, 0x1A, 0x63,
+    0x03, 0x04, 0x00, 0x5D, 0x51, 0x04, 0x49, 0x1F, 0x1A, 0x22, 0x45, 0x25, 0x25, 0x95, 0x95, 0x1F,
+    0x00, 0x04, 0x51, 0x95, 0x3F, 0x2D, 0x7E, 0x00, 0x04, 0x4F, 0x18, 0x84, 0x00, 0x16, 0x26, 0x66,
+    0x23, 0x28, 0x00, 0x00, 0x18, 0x2E, 0x84, 0x35, 0x26, 0x00, 0x20, 0x3E, 0x30, 0x7E, 0x01, 0x00,
+    0x1A, 0x7C, 0x20, 0x16, 0x60, 0x8D, 0x00, 0x19, 0x07, 0x2D, 0x29, 0x51, 0x29, 0x42, 0x25, 0x29,
+    0x42, 0x6C, 0x3F, 0x7A, 0x02, 0x30, 0x42, 0x00, 0x51, 0x4F, 0x00, 0x06, 0x75, 0xA1, 0x79, 0x91,
+    0x00, 0x04, 0x88, 0x00, 0x81, 0x08, 0x09, 0x05, 0x01, 0x06, 0x06, 0x02, 0x00, 0x00, 0x03, 0x08,
+    0x06, 0x84, 0x00, 0x81, 0x04, 0x81, 0x00, 0x1F, 0x68, 0x1D, 0x11, 0x4B, 0x02, 0x96, 0x40, 0x07,
+    0x00, 0x06, 0x26, 0x5B, 0x5B, 0x93, 0x90, 0x26, 0x93, 0x5B, 0x90, 0x00, 0x02, 0x00, 0x86, 0x18,
+    0x00, 0x01, 0x00, 0x04, 0x49, 0x03, 0x91, 0x86, 0x82, 0x00, 0x01, 0x5E, 0x78, 0x83, 0x0F, 0x82,
+    0x19, 0x08, 0x4B, 0x9D, 0xA2, 0xA2, 0x72, 0x5E, 0x9D, 0x63, 0x01, 0x8F, 0x00, 0x81, 0x01, 0x80,
+    0x02, 0xA5, 0x00, 0x0B, 0x01, 0x03, 0x85, 0x4F, 0x5F, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x04,
+    0x82, 0x00, 0x80, 0x02, 0x83, 0x00, 0x80, 0x02, 0x82, 0x00, 0x26, 0x02, 0x00, 0x02, 0x00, 0x01,
+    0x02, 0x75, 0x07, 0x00, 0x00, 0x02, 0x02, 0x60, 0x23, 0x1E, 0x4D, 0x14, 0x45, 0x04, 0x02, 0x2E,
+    0x64, 0x1E, 0x56, 0x00, 0x35, 0x3E, 0x3F, 0x81, 0x07, 0x52, 0x68, 0x2A, 0x20, 0x82, 0x45, 0x00,
+    0x18, 0x1C, 0x85, 0x00, 0x80, 0x04, 0x83, 0x00, 0x0F, 0x4B, 0x83, 0x51, 0x98, 0x29, 0x30, 0x30,
+    0x6E, 0x42, 0x2D, 0x4E, 0x28, 0x96, 0x0F, 0x25, 0x02, 0x83, 0x00, 0x02, 0x4F, 0x26, 0x03, 0x88,
+    0x00, 0x0E, 0x02, 0x48, 0x08, 0x08, 0x05, 0x03, 0x03, 0x48, 0x03, 0x03, 0x00, 0x00, 0x22, 0x62,
+    0x01, 0x83, 0x00, 0x0F, 0x01, 0x13, 0x65, 0x03, 0x00, 0x03, 0x2C, 0x1D, 0x0F, 0x6A, 0x65, 0x90,
+    0x75, 0x02, 0x06, 0x4F, 0x82, 0x5B, 0x81, 0x90, 0x12, 0x26, 0x85, 0x02, 0x01, 0x07, 0x00, 0x75,
+    0x52, 0x01, 0x03, 0x00, 0x01, 0x49, 0x86, 0x96, 0x04, 0x00, 0x00, 0x04, 0x04, 0x5E, 0x4C, 0x0F,
+    0x0F, 0x19, 0x81, 0x0F, 0x82, 0x19, 0x06, 0x9D, 0x72, 0xA2, 0x72, 0x9D, 0x5B, 0x22, 0x90, 0x00,
+    0x02, 0x02, 0x01, 0x02, 0xA5, 0x00, 0x0C, 0x01, 0x07, 0x86, 0x4F, 0x58, 0x56, 0x29, 0x45, 0x00,
+    0x34, 0x00, 0x00, 0x34, 0x85, 0x00, 0x2D, 0x01, 0x02, 0x02, 0x01, 0x00, 0x07, 0x00, 0x01, 0x22,
+    0x00, 0x02, 0x06, 0x00, 0x00, 0x01, 0x03, 0x06, 0x3F, 0x1D, 0x1D, 0x83, 0x14, 0x16, 0x00, 0x5D,
+    0x5E, 0x33, 0x9C, 0x29, 0x00, 0x5F, 0x9C, 0x25, 0x81, 0x24, 0x7D, 0x20, 0x6E, 0x14, 0xA1, 0x07,
+    0x00, 0x18, 0x60, 0x00, 0x01, 0x86, 0x00, 0x08, 0x49, 0x7E, 0x67, 0x67, 0x63, 0x28, 0x7A, 0x4B,
+    0x19, 0x83, 0x28, 0x04, 0x7B, 0x3D, 0x53, 0x56, 0x04, 0x83, 0x00, 0x01, 0x01, 0x02, 0x89, 0x00,
+    0x0C, 0x03, 0x0A, 0x08, 0x08, 0x05, 0x03, 0x48, 0x05, 0x05, 0x03, 0x00, 0x01, 0x06, 0x81, 0x01,
+    0x84, 0x00, 0x22, 0x71, 0x8C, 0x26, 0x34, 0x00, 0x47, 0x68, 0x8C, 0x8C, 0x37, 0x0A, 0xA1, 0x07,
+    0x9F, 0x0A, 0x85, 0x90, 0x37, 0x87, 0x18, 0x18, 0x06, 0x03, 0x91, 0x49, 0x00, 0x49, 0x26, 0x91,
+    0x01, 0x02, 0x49, 0x96, 0x3D, 0x01, 0x83, 0x00, 0x05, 0x4C, 0x5E, 0x0F, 0x19, 0x19, 0x0F, 0x82,
+    0x19, 0x06, 0x4B, 0x4C, 0x72, 0xA2, 0x4C, 0x4C, 0x90, 0x92, 0x00, 0x81, 0x02, 0xA5, 0x00, 0x3E,
+    0x22, 0x00, 0x02, 0xA1, 0x47, 0x16, 0x35, 0x6E, 0x00, 0x01, 0x35, 0x6E, 0x18, 0x04, 0x04, 0x00,
+    0x86, 0x18, 0x26, 0x49, 0x7E, 0x2D, 0x16, 0x18, 0x00, 0x1F, 0x1C, 0x00, 0x02, 0x03, 0x13, 0x01,
+    0x00, 0x06, 0x03, 0x03, 0x3F, 0x67, 0x20, 0x1D, 0x83, 0x16, 0x00, 0x7B, 0x4B, 0x33, 0x7D, 0x2D,
+    0x00, 0x1C, 0x4D, 0x29, 0x31, 0x83, 0x7C, 0x31, 0x53, 0x6E, 0x29, 0x1C, 0x00, 0x1C, 0x60, 0x88,
+    0x00, 0x17, 0x3C, 0x82, 0x71, 0x1D, 0x64, 0x74, 0x88, 0x18, 0x05, 0x28, 0x7A, 0x49, 0x5D, 0x7A,
+    0x28, 0x5B, 0x03, 0x00, 0x00, 0x5D, 0x02, 0x00, 0x22, 0x06, 0x88, 0x00, 0x01, 0x06, 0x0A, 0x82,
+    0x08, 0x82, 0x05, 0x81, 0x08, 0x03, 0x03, 0x01, 0x05, 0x03, 0x86, 0x00, 0x21, 0x41, 0x40, 0x80,
+    0x86, 0x00, 0x00, 0x79, 0x33, 0x5C, 0x62, 0x3B, 0x90, 0x01, 0x91, 0x13, 0x03, 0x3B, 0x62, 0x08,
+    0x18, 0x86, 0x02, 0x03, 0x96, 0x1C, 0x00, 0x4F, 0xA1, 0x85, 0x07, 0x03, 0x86, 0x96, 0x07, 0x83,
+    0x00, 0x80, 0x5D, 0x81, 0x5B, 0x82, 0x0F, 0x84, 0x19, 0x05, 0x4C, 0x72, 0x72, 0x50, 0x50, 0x91,
+    0xBA, 0x00, 0x3F, 0x01, 0x00, 0x02, 0x05, 0x26, 0x1F, 0x4F, 0x35, 0x00, 0x4F, 0x83, 0x6E, 0x31,
+    0x82, 0x00, 0x1A, 0x16, 0x82, 0x31, 0x52, 0x16, 0x23, 0x2D, 0x29, 0x03, 0x43, 0x7E, 0x29, 0x00,
+    0x48, 0x71, 0x49, 0x00, 0x03, 0x03, 0x02, 0x6E, 0x20, 0x1D, 0x83, 0x21, 0x18, 0x00, 0x07, 0x19,
+    0x9D, 0x7C, 0x6C, 0x03, 0x00, 0x20, 0x5F, 0x6E, 0x11, 0x2A, 0x16, 0x22, 0x00, 0x1A, 0x01, 0x04,
+    0x04, 0x1F, 0x07, 0x84, 0x00, 0x80, 0x02, 0x82, 0x00, 0x0E, 0x02, 0x85, 0x20, 0x83, 0x25, 0x88,
+    0x16, 0x82, 0x74, 0x74, 0x51, 0x28, 0x28, 0x82, 0x6A, 0x83, 0x00, 0x03, 0x04, 0x00, 0x00, 0x22,
+    0x88, 0x00, 0x0D, 0x03, 0x0A, 0x08, 0x13, 0x0A, 0x05, 0x08, 0x0A, 0x08, 0x08, 0x06, 0x01, 0x08,
+    0x03, 0x84, 0x00, 0x25, 0x04, 0x00, 0x03, 0x5A, 0x50, 0x41, 0x00, 0x02, 0x75, 0x2A, 0x9D, 0x05,
+    0x07, 0x90, 0x01, 0x7B, 0x03, 0x62, 0x96, 0x45, 0x96, 0x18, 0x91, 0x03, 0x07, 0x1C, 0x91, 0x00,
+    0x18, 0x37, 0x86, 0x86, 0x3D, 0x85, 0x03, 0x00, 0x00, 0x04, 0x82, 0x00, 0x81, 0x8C, 0x81, 0x9D,
+    0x01, 0x19, 0x78, 0x83, 0x19, 0x04, 0x4C, 0x72, 0x72, 0x50, 0x65, 0x95, 0x00, 0x82, 0x02, 0xA2,
+    0x00, 0x3F, 0x03, 0x02, 0x01, 0x3D, 0x16, 0x00, 0x30, 0x29, 0x00, 0x1C, 0x2D, 0x00, 0x1F, 0x81,
+    0x1A, 0x16, 0x00, 0x30, 0x30, 0x31, 0x56, 0x02, 0x1F, 0x42, 0x22, 0x5F, 0x82, 0x3F, 0x00, 0x3B,
+    0x0D, 0x00, 0x00, 0x03, 0x01, 0x00, 0x5F, 0x24, 0x24, 0x27, 0x82, 0x00, 0x00, 0x34, 0x29, 0x72,
+    0x7C, 0x17, 0x86, 0x00, 0x16, 0x51, 0x01, 0x00, 0x00, 0x04, 0x01, 0x03, 0x1A, 0x7B, 0x00, 0x00,
+    0x1F, 0x51, 0x84, 0x00, 0x80, 0x02, 0x82, 0x00, 0x0E, 0x5D, 0x00, 0x6E, 0x7C, 0x11, 0x1A, 0x2D,
+    0x42, 0x2D, 0x59, 0x1F, 0x52, 0x53, 0x19, 0x4F, 0x82, 0x00, 0x80, 0x07, 0x82, 0x00, 0x80, 0x01,
+    0x87, 0x00, 0x80, 0x02, 0x82, 0x05, 0x02, 0x13, 0x05, 0x0A, 0x83, 0x08, 0x81, 0x06, 0x01, 0x0A,
+    0x01, 0x85, 0x00, 0x27, 0x02, 0x00, 0x55, 0x5B, 0x65, 0x96, 0x02, 0x00, 0x91, 0x6B, 0x08, 0x00,
+    0x08, 0x03, 0x07, 0x22, 0x96, 0x05, 0x0A, 0x96, 0x18, 0x0A, 0x05, 0x9F, 0x1C, 0x91, 0x00, 0x18,
+    0x96, 0x07, 0x26, 0x85, 0x96, 0x02, 0x00, 0x01, 0x04, 0x00, 0x01, 0x02, 0x81, 0x8C, 0x81, 0x5B,
+    0x0A, 0x9D, 0x78, 0x78, 0x19, 0x78, 0x19, 0x4C, 0x72, 0x50, 0x50, 0x96, 0x95, 0x00, 0x81, 0x02,
+    0xA2, 0x00, 0x29, 0x04, 0x03, 0x4F, 0x03, 0x4F, 0x60, 0x04, 0x1D, 0x60, 0x00, 0x56, 0x01, 0x82,
+    0x35, 0x20, 0x56, 0x04, 0x63, 0x2D, 0x4F, 0x7D, 0x1A, 0x00, 0x23, 0x3F, 0x00, 0x25, 0x31, 0x6E,
+    0x00, 0x8A, 0x6B, 0x00, 0x01, 0x03, 0x00, 0x01, 0x00, 0x45, 0x79, 0x1C, 0x02, 0x82, 0x00, 0x09,
+    0x53, 0x50, 0x24, 0x5F, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x82, 0x00, 0x06, 0x07, 0x1A, 0x07,
+    0x00, 0x00, 0x45, 0x49, 0x86, 0x00, 0x80, 0x04, 0x83, 0x00, 0x14, 0x26, 0x56, 0x03, 0x30, 0x2D,
+    0x25, 0x89, 0x16, 0x5D, 0x45, 0x79, 0x00, 0x04, 0x00, 0x3D, 0x26, 0x95, 0x60, 0x45, 0x00, 0x02,
+    0x86, 0x00, 0x80, 0x01, 0x82, 0x05, 0x01, 0x08, 0x05, 0x83, 0x08, 0x01, 0x0A, 0x06, 0x81, 0x01,
+    0x86, 0x00, 0x05, 0x01, 0x02, 0x01, 0x9A, 0x71, 0x41, 0x82, 0x00, 0x1E, 0x04, 0x01, 0x9F, 0x08,
+    0x3B, 0x02, 0x03, 0x96, 0x08, 0x08, 0x37, 0xA1, 0x3C, 0x03, 0x75, 0x45, 0x22, 0x00, 0x26, 0x96,
+    0x00, 0x26, 0x85, 0x06, 0x01, 0x01, 0x9F, 0x00, 0x07, 0x91, 0x01, 0x01, 0x5B, 0x6A, 0x82, 0x9D,
+    0x81, 0x19, 0x06, 0x5E, 0x9D, 0x19, 0x4C, 0x2E, 0x2E, 0x65, 0x96, 0x00, 0x81, 0x02, 0x81, 0x00,
+    0x81, 0x02, 0x9E, 0x00, 0x26, 0x01, 0x02, 0x52, 0xA1, 0x07, 0x5D, 0x45, 0x27, 0x00, 0x01, 0x14,
+    0x18, 0x68, 0x64, 0x4B, 0x30, 0x1F, 0x30, 0x25, 0x7E, 0x31, 0x1F, 0x00, 0x43, 0x25, 0x07, 0x07,
+    0x68, 0x16, 0x00, 0x58, 0x68, 0x51, 0x06, 0x0A, 0x00, 0x03, 0x00, 0x34, 0x85, 0x00, 0x08, 0x5F,
+    0x05, 0x02, 0x00, 0x34, 0x00, 0x00, 0x01, 0x02, 0x82, 0x00, 0x03, 0x04, 0x02, 0x29, 0x01, 0x82,
+    0x00, 0x80, 0x07, 0x87, 0x00, 0x81, 0x01, 0x17, 0x00, 0x34, 0x00, 0x34, 0x00, 0x03, 0x3F, 0x4E,
+    0x4E, 0x74, 0x7F, 0x7F, 0x27, 0x51, 0x00, 0x55, 0x58, 0x1F, 0x4E, 0x29, 0x1F, 0x00, 0x07, 0x02,
+    0x85, 0x00, 0x01, 0x01, 0x03, 0x82, 0x05, 0x80, 0x48, 0x83, 0x08, 0x80, 0x48, 0x81, 0x01, 0x87,
+    0x00, 0x81, 0x01, 0x03, 0x00, 0x06, 0x92, 0x3C, 0x84, 0x00, 0x1A, 0x75, 0x13, 0x90, 0x07, 0x0A,
+    0x3D, 0x1C, 0x3C, 0x18, 0x37, 0x85, 0x07, 0x91, 0x08, 0x07, 0x00, 0x26, 0x75, 0x00, 0x90, 0x96,
+    0x02, 0x06, 0x03, 0x02, 0x02, 0x07, 0x81, 0x03, 0x0D, 0x5B, 0x80, 0x19, 0x4C, 0x5B, 0x9D, 0x5E,
+    0x78, 0x4C, 0x19, 0x50, 0x2E, 0x50, 0x96, 0x97, 0x00, 0x81, 0x02, 0x81, 0x00, 0x82, 0x02, 0x9D,
+    0x00, 0x26, 0x1C, 0x26, 0x37, 0x00, 0x34, 0x00, 0x29, 0x1A, 0x0A, 0x31, 0x25, 0x00, 0x19, 0x11,
+    0x29, 0x18, 0x7E, 0x34, 0x02, 0x29, 0x1A, 0x45, 0x23, 0x21, 0x9C, 0x3F, 0x35, 0x5F, 0x02, 0x47,
+    0x30, 0x7B, 0x08, 0x48, 0x00, 0x06, 0x9F, 0x02, 0x03, 0x83, 0x00, 0x01, 0x04, 0x02, 0x82, 0x00,
+    0x0B, 0x34, 0x02, 0x00, 0x01, 0x5D, 0x01, 0x00, 0x00, 0x7B, 0x00, 0x60, 0x01, 0x8C, 0x00, 0x81,
+    0x01, 0x13, 0x00, 0x04, 0x01, 0x02, 0x00, 0x1F, 0x7F, 0x5D, 0x98, 0x88, 0x28, 0x05, 0xA1, 0x5F,
+    0x63, 0x47, 0x22, 0x28, 0x45, 0x01, 0x88, 0x00, 0x0B, 0x01, 0x03, 0x62, 0x05, 0x06, 0x03, 0x08,
+    0x0A, 0x08, 0x08, 0x03, 0x01, 0x88, 0x00, 0x80, 0x02, 0x84, 0x00, 0x21, 0x02, 0x00, 0x02, 0x01,
+    0x08, 0x03, 0x91, 0x08, 0x02, 0x75, 0x05, 0x22, 0x63, 0x1F, 0x13, 0x85, 0x62, 0x08, 0x58, 0x07,
+    0x02, 0x26, 0x9F, 0x04, 0x90, 0x85, 0x01, 0x62, 0x03, 0x07, 0x22, 0x9F, 0x02, 0x3D, 0x0E, 0x5B,
+    0x73, 0x78, 0x9D, 0x8C, 0x4C, 0x78, 0x19, 0x19, 0x5E, 0x4C, 0x2E, 0x5C, 0x00, 0x01, 0x87, 0x00,
+    0x80, 0x02, 0x8E, 0x00, 0x80, 0x01, 0x82, 0x02, 0x04, 0x00, 0x02, 0x02, 0x01, 0x02, 0x9A, 0x00,
+    0x01, 0x3B, 0x8A, 0x83, 0x00, 0x22, 0x02, 0x29, 0x56, 0x35, 0x3F, 0x2B, 0x49, 0x7B, 0x02, 0x00,
+    0x18, 0x81, 0x1F, 0x00, 0x00, 0x45, 0x49, 0x75, 0x1A, 0x56, 0x82, 0x49, 0x01, 0x79, 0x26, 0x01,
+    0x3C, 0x03, 0x00, 0x01, 0x06, 0x06, 0x01, 0x00, 0x07, 0x82, 0x00, 0x08, 0x1A, 0x49, 0x02, 0x00,
+    0x34, 0x00, 0x02, 0x9F, 0x04, 0x82, 0x00, 0x0A, 0x48, 0x56, 0x45, 0x00, 0x02, 0x00, 0x00, 0x04,
+    0x00, 0x01, 0x4F, 0x83, 0x00, 0x13, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x2D,
+    0x74, 0x34, 0x88, 0x98, 0x96, 0x1A, 0x56, 0x04, 0x00, 0x73, 0x8B, 0x00, 0x80, 0x02, 0x81, 0x06,
+    0x82, 0x03, 0x81, 0x05, 0x81, 0x08, 0x01, 0x0A, 0x06, 0x93, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x07, 0x48, 0x02, 0x1F, 0x60, 0x96, 0x1C, 0x05, 0x47, 0x96, 0x03, 0x3D, 0x26, 0x02, 0x00,
+    0x18, 0x92, 0x02, 0x1C, 0x03, 0x91, 0x3D, 0x62, 0x01, 0x03, 0x0C, 0x8C, 0x90, 0x4C, 0x9D, 0x8C,
+    0x0D, 0x71, 0x19, 0x9D, 0x4C, 0x50, 0x5A, 0x13, 0x87, 0x00, 0x81, 0x02, 0x03, 0x01, 0x22, 0x01,
+    0x02, 0x8C, 0x00, 0x82, 0x02, 0x80, 0x00, 0x83, 0x02, 0x01, 0x06, 0x02, 0x98, 0x00, 0x25, 0x37,
+    0x58, 0x00, 0x00, 0x1C, 0x75, 0x00, 0x00, 0x18, 0x78, 0x5E, 0x50, 0x2B, 0x05, 0x00, 0x00, 0x81,
+    0x8D, 0x6C, 0x02, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x79, 0x56, 0x03, 0x0A,
+    0x01, 0x00, 0x01, 0x48, 0x01, 0x81, 0x02, 0x83, 0x00, 0x02, 0x56, 0x22, 0x00, 0x81, 0x01, 0x82,
+    0x00, 0x10, 0x04, 0x00, 0x01, 0x52, 0x27, 0x2B, 0x16, 0x7B, 0x00, 0x00, 0x02, 0x00, 0x45, 0x68,
+    0x78, 0x96, 0x01, 0x84, 0x00, 0x80, 0x02, 0x83, 0x00, 0x0D, 0x29, 0x89, 0x98, 0x7F, 0x28, 0x00,
+    0xA1, 0x49, 0x04, 0x00, 0x01, 0x47, 0x00, 0x04, 0x89, 0x00, 0x10, 0x01, 0x06, 0x03, 0x03, 0x06,
+    0x01, 0x03, 0x05, 0x0A, 0x0A, 0x03, 0x02, 0x00, 0x00, 0x01, 0x03, 0x62, 0x82, 0x0A, 0x01, 0x62,
+    0x03, 0x87, 0x06, 0x84, 0x00, 0x1A, 0x01, 0x00, 0x01, 0x02, 0x51, 0x1F, 0x91, 0x37, 0x05, 0x3C,
+    0x3C, 0x08, 0x05, 0x47, 0x65, 0x62, 0x06, 0x4F, 0x37, 0x05, 0x05, 0x01, 0x03, 0x05, 0x03, 0x03,
+    0x3D, 0x03, 0x80, 0x85, 0x90, 0x55, 0x82, 0x41, 0x05, 0x6A, 0x8C, 0x50, 0x2E, 0x71, 0x02, 0x87,
+    0x00, 0x07, 0x02, 0x01, 0x01, 0x06, 0x03, 0x03, 0x01, 0x02, 0x8F, 0x00, 0x82, 0x02, 0x05, 0x03,
+    0x06, 0x02, 0x02, 0x00, 0x02, 0x94, 0x00, 0x13, 0x3B, 0x05, 0x00, 0x45, 0x3F, 0x45, 0x00, 0x00,
+    0x45, 0x56, 0x49, 0x04, 0x1A, 0x5F, 0x7E, 0x1E, 0x42, 0x18, 0x2D, 0x42, 0x83, 0x00, 0x0E, 0x01,
+    0x07, 0x07, 0x00, 0x00, 0x56, 0x63, 0x06, 0x0A, 0x02, 0x00, 0x02, 0x06, 0x48, 0x02, 0x83, 0x00,
+    0x01, 0x01, 0x26, 0x82, 0x00, 0x0B, 0x02, 0x00, 0x01, 0x45, 0x1A, 0x27, 0x81, 0x4D, 0x4D, 0x7E,
+    0x29, 0x45, 0x83, 0x00, 0x03, 0x04, 0x82, 0x50, 0x45, 0x86, 0x00, 0x0F, 0x02, 0x00, 0x04, 0x02,
+    0x56, 0x95, 0x88, 0x28, 0x5D, 0x1C, 0x03, 0x00, 0x00, 0x3C, 0x08, 0x86, 0x8B, 0x00, 0x0D, 0x01,
+    0x06, 0x03, 0x06, 0x06, 0x02, 0x06, 0x03, 0x62, 0x05, 0x06, 0x01, 0x02, 0x01, 0x84, 0x03, 0x01,
+    0x06, 0x01, 0x86, 0x02, 0x81, 0x01, 0x80, 0x07, 0x86, 0x00, 0x17, 0x34, 0x28, 0x45, 0x3B, 0x8A,
+    0x0B, 0x3D, 0x86, 0x1C, 0x86, 0x90, 0x65, 0x1C, 0x91, 0x85, 0x90, 0x0A, 0x0A, 0x75, 0x75, 0x06,
+    0x03, 0x3D, 0x3C, 0x0B, 0x71, 0x03, 0x03, 0x0A, 0x0A, 0x37, 0x41, 0x65, 0x41, 0x6A, 0x2E, 0x92,
+    0x8B, 0x00, 0x04, 0x01, 0x03, 0x62, 0x03, 0x06, 0x82, 0x01, 0x8D, 0x00, 0x87, 0x02, 0x94, 0x00,
+    0x16, 0x58, 0x03, 0x7B, 0x16, 0x45, 0x00, 0x51, 0x3D, 0x00, 0x07, 0x00, 0x30, 0x4D, 0x17, 0x9C,
+    0x6E, 0x30, 0x29, 0x00, 0x4E, 0x30, 0x00, 0x01, 0x85, 0x00, 0x05, 0x1C, 0x03, 0x05, 0x06, 0x01,
+    0x00, 0x82, 0x01, 0x84, 0x00, 0x10, 0x45, 0x52, 0x00, 0x00, 0x49, 0x5F, 0x18, 0x29, 0x7D, 0x23,
+    0x3E, 0x7D, 0x7D, 0x4D, 0x6E, 0x7E, 0x86, 0x83, 0x00, 0x06, 0x04, 0x49, 0x0F, 0x9F, 0x00, 0x02,
+    0x01, 0x83, 0x00, 0x11, 0x02, 0x00, 0x04, 0x7B, 0x01, 0x00, 0x01, 0x02, 0x05, 0x00, 0x52, 0x60,
+    0x02, 0x03, 0x05, 0x3D, 0x00, 0x04, 0x8A, 0x00, 0x04, 0x02, 0x01, 0x01, 0x00, 0x02, 0x81, 0x06,
+    0x85, 0x01, 0x81, 0x04, 0x8F, 0x00, 0x81, 0x01, 0x83, 0x00, 0x17, 0x51, 0x60, 0x3D, 0x3B, 0x92,
+    0x37, 0x3D, 0x86, 0x08, 0x47, 0x90, 0x41, 0x0A, 0x03, 0x85, 0x90, 0x47, 0x3C, 0x03, 0x06, 0x03,
+    0x86, 0x85, 0x3C, 0x0F, 0x80, 0x92, 0x41, 0x5A, 0x65, 0x90, 0x9A, 0x9A, 0x55, 0x65, 0x0D, 0x01,
+    0x34, 0x00, 0x00, 0x02, 0x87, 0x00, 0x0A, 0x07, 0x01, 0x03, 0x05, 0x62, 0x05, 0x05, 0x0A, 0x03,
+    0x01, 0x02, 0x8C, 0x00, 0x01, 0x02, 0x01, 0x83, 0x02, 0x94, 0x00, 0x17, 0x63, 0x4F, 0x1F, 0x03,
+    0x00, 0x05, 0x53, 0x53, 0x82, 0x63, 0x30, 0x30, 0x31, 0x4D, 0x26, 0x00, 0x1F, 0x21, 0x2D, 0x02,
+    0x2D, 0x95, 0x00, 0x01, 0x85, 0x00, 0x28, 0x75, 0x06, 0x07, 0x00, 0x00, 0x22, 0x00, 0x00, 0x5D,
+    0x00, 0x01, 0x03, 0x00, 0x1F, 0x1F, 0x3C, 0x30, 0x20, 0x1E, 0x56, 0x14, 0x66, 0x3F, 0x25, 0x17,
+    0x7D, 0x9C, 0x35, 0x7E, 0x63, 0x00, 0x04, 0x00, 0x9F, 0x07, 0x04, 0x9D, 0x4F, 0x00, 0x02, 0x01,
+    0x83, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x02, 0x02, 0x04, 0x00, 0x22, 0x00, 0x18, 0x2D, 0x45, 0x05,
+    0x02, 0x01, 0x58, 0xB0, 0x00, 0x18, 0x49, 0x51, 0x3D, 0x3B, 0x92, 0x90, 0x85, 0x3B, 0x96, 0x3B,
+    0x85, 0x90, 0x90, 0x08, 0x0A, 0x37, 0x41, 0x90, 0x37, 0x3C, 0x3B, 0x37, 0x85, 0x3B, 0x3C, 0x0A,
+    0x65, 0x37, 0x92, 0x0B, 0x8A, 0x92, 0x0B, 0x58, 0x8A, 0x0D, 0x92, 0x83, 0x00, 0x80, 0x02, 0x89,
+    0x00, 0x01, 0x01, 0x03, 0x82, 0x0A, 0x82, 0x08, 0x01, 0x05, 0x01, 0x8B, 0x00, 0x80, 0x01, 0x99,
+    0x00, 0x19, 0x45, 0x60, 0x00, 0x02, 0x00, 0x22, 0x00, 0x00, 0x52, 0x26, 0x8C, 0x35, 0x11, 0x26,
+    0x02, 0x63, 0x01, 0x60, 0x42, 0x5F, 0x00, 0x23, 0x18, 0x02, 0x1C, 0x01, 0x83, 0x00, 0x01, 0x75,
+    0x01, 0x83, 0x00, 0x22, 0x60, 0x45, 0x00, 0x75, 0x03, 0x00, 0x00, 0x1A, 0x51, 0x2B, 0x31, 0x7C,
+    0x30, 0x56, 0x9C, 0x1E, 0x1A, 0x01, 0x30, 0x76, 0x9C, 0x6E, 0x16, 0x18, 0x00, 0x04, 0x00, 0x02,
+    0x01, 0x00, 0x55, 0x1C, 0x00, 0x00, 0x02, 0x84, 0x00, 0x01, 0x02, 0x01, 0x82, 0x00, 0x09, 0x04,
+    0x9F, 0x8A, 0x2B, 0x6E, 0x01, 0x58, 0x00, 0x04, 0x08, 0xB1, 0x00, 0x17, 0x22, 0x90, 0x90, 0x41,
+    0x41, 0x90, 0x6B, 0x92, 0x90, 0x92, 0x55, 0x90, 0x08, 0x85, 0x90, 0x41, 0x71, 0x80, 0x71, 0x90,
+    0x92, 0x90, 0x92, 0x13, 0x0D, 0x58, 0x45, 0x96, 0x91, 0x75, 0x06, 0x05, 0x85, 0x32, 0x0D, 0x96,
+    0x00, 0x00, 0x04, 0x8C, 0x00, 0x0A, 0x01, 0x06, 0x3D, 0x0A, 0x05, 0x05, 0x0A, 0x08, 0x0A, 0x03,
+    0x01, 0xA2, 0x00, 0x80, 0x02, 0x85, 0x00, 0x14, 0x02, 0x00, 0x00, 0x52, 0x85, 0x41, 0x9A, 0x24,
+    0x27, 0x4F, 0x3B, 0x9A, 0x3D, 0x25, 0xA0, 0x1A, 0x1F, 0x89, 0x3D, 0x1C, 0x02, 0x82, 0x00, 0x26,
+    0x04, 0x01, 0x01, 0x00, 0x00, 0x63, 0x42, 0x81, 0x4D, 0x3F, 0x75, 0x02, 0x04, 0x00, 0x16, 0x22,
+    0x78, 0x83, 0x31, 0x26, 0x30, 0x3E, 0x61, 0x82, 0x35, 0x03, 0x43, 0x66, 0x25, 0x00, 0x16, 0x42,
+    0x01, 0x00, 0x04, 0x01, 0x34, 0x01, 0x02, 0x87, 0x00, 0x81, 0x02, 0x0C, 0x00, 0x04, 0x00, 0x88,
+    0x5E, 0x5E, 0x71, 0x5F, 0x60, 0x62, 0x51, 0x07, 0x01, 0xB1, 0x00, 0x02, 0x01, 0x41, 0x5A, 0x82,
+    0x65, 0x11, 0x40, 0x6A, 0x5A, 0x65, 0x5A, 0x65, 0x0D, 0x65, 0x65, 0x5A, 0x19, 0x5B, 0x80, 0x65,
+    0x65, 0x0D, 0x65, 0x71, 0x0A, 0x5A, 0x65, 0x5A, 0x5A, 0x2E, 0x5A, 0x5A, 0x2E, 0x6A, 0x65, 0x03,
+    0x91, 0x00, 0x0A, 0x01, 0x05, 0x3C, 0x3C, 0x08, 0x0A, 0x0A, 0x08, 0x08, 0x05, 0x06, 0xA0, 0x00,
+    0x80, 0x02, 0x87, 0x00, 0x12, 0x02, 0x29, 0x63, 0x9A, 0x5F, 0xA0, 0x76, 0x21, 0x3B, 0x47, 0x90,
+    0x37, 0x3F, 0x89, 0x00, 0x2D, 0x3F, 0x02, 0x22, 0x83, 0x00, 0x81, 0x02, 0x23, 0x00, 0x07, 0x2A,
+    0x9D, 0x2E, 0x5B, 0x4D, 0x2D, 0x00, 0x00, 0x60, 0x95, 0x03, 0x0F, 0x83, 0x24, 0x86, 0x4D, 0x3E,
+    0x4E, 0x0F, 0x20, 0x01, 0x7E, 0x9C, 0x6E, 0x00, 0x34, 0x25, 0x25, 0x00, 0x01, 0x03, 0x00, 0x56,
+    0x90, 0x87, 0x00, 0x0C, 0x02, 0x00, 0x95, 0x56, 0x02, 0x74, 0x4E, 0x6B, 0x18, 0x79, 0x16, 0x60,
+    0x1F, 0xB4, 0x00, 0x80, 0x55, 0x82, 0x9D, 0x81, 0x33, 0x0E, 0x0F, 0x2C, 0x67, 0x64, 0x64, 0x1D,
+    0x1D, 0x83, 0x83, 0x20, 0x64, 0x1D, 0x64, 0x64, 0x1D, 0x81, 0x64, 0x09, 0x41, 0x90, 0x3B, 0x73,
+    0x71, 0x65, 0x41, 0x55, 0x65, 0x41, 0x95, 0x00, 0x03, 0x05, 0x08, 0x3C, 0x08, 0x83, 0x0A, 0x01,
+    0x03, 0x06, 0xA5, 0x00, 0x3E, 0x04, 0x00, 0x00, 0x16, 0x29, 0x55, 0x35, 0x1E, 0x20, 0x24, 0x6E,
+    0x32, 0x55, 0x3B, 0x56, 0x23, 0x00, 0x34, 0x23, 0x79, 0x00, 0x00, 0x04, 0x00, 0x34, 0x5D, 0x00,
+    0x00, 0x16, 0xA4, 0x2E, 0x9D, 0x9D, 0x24, 0x42, 0x00, 0x34, 0x1A, 0x29, 0x96, 0x2C, 0x83, 0x29,
+    0x16, 0x76, 0x9C, 0x74, 0x79, 0x4F, 0x00, 0x92, 0x31, 0x6E, 0x7B, 0x00, 0x1A, 0x2D, 0x86, 0x00,
+    0x02, 0x01, 0x0A, 0x2B, 0x86, 0x00, 0x0F, 0x03, 0x4F, 0x02, 0x95, 0x3F, 0x02, 0x02, 0x95, 0x82,
+    0x26, 0x08, 0x88, 0x28, 0x28, 0x04, 0x03, 0xA1, 0x00, 0x07, 0x01, 0x48, 0x05, 0x05, 0x3D, 0x05,
+    0x06, 0x01, 0x82, 0x03, 0x01, 0x01, 0x02, 0x83, 0x00, 0x01, 0x07, 0x9D, 0x83, 0x0F, 0x04, 0x4B,
+    0x30, 0x30, 0x35, 0x6E, 0x82, 0x29, 0x06, 0x68, 0x2B, 0x82, 0x2B, 0x2B, 0x68, 0x4B, 0x81, 0x5B,
+    0x09, 0x5A, 0x5B, 0x6A, 0x40, 0x5A, 0x2E, 0x5A, 0x5A, 0x2E, 0x0D, 0x85, 0x00, 0x83, 0x02, 0x83,
+    0x00, 0x80, 0x02, 0x88, 0x00, 0x08, 0x06, 0x0A, 0x08, 0x08, 0x05, 0x03, 0x62, 0x03, 0x02, 0xA7,
+    0x00, 0x10, 0x79, 0x35, 0x26, 0x1A, 0xA1, 0x68, 0x4F, 0x2D, 0x26, 0x92, 0x0D, 0x5F, 0x2D, 0x00,
+    0x00, 0x29, 0x42, 0x82, 0x00, 0x81, 0x03, 0x81, 0x04, 0x26, 0x00, 0x25, 0x68, 0x5B, 0x0F, 0x0F,
+    0x5B, 0x16, 0x00, 0x00, 0x16, 0x18, 0x79, 0x2A, 0x24, 0x63, 0x27, 0x9C, 0x9C, 0x88, 0x01, 0x3B,
+    0x29, 0x42, 0x7D, 0x29, 0x7A, 0x28, 0x75, 0x25, 0x1A, 0x02, 0x01, 0x01, 0x02, 0x5F, 0x4F, 0x00,
+    0x01, 0x83, 0x00, 0x81, 0x63, 0x0E, 0x00, 0x07, 0x4E, 0x16, 0x00, 0x1F, 0x95, 0x5F, 0x08, 0x60,
+    0x51, 0x60, 0x1C, 0x7A, 0x9F, 0x98, 0x00, 0x80, 0x04, 0x82, 0x00, 0x0B, 0x02, 0x06, 0x62, 0x08,
+    0x08, 0x05, 0x0A, 0x0A, 0x48, 0x0A, 0x08, 0x0A, 0x82, 0x05, 0x81, 0x03, 0x80, 0x01, 0x82, 0x00,
+    0x01, 0x01, 0x5A, 0x83, 0x33, 0x83, 0x9D, 0x80, 0x4C, 0x82, 0x2E, 0x05, 0x4C, 0x50, 0x50, 0x2E,
+    0x2E, 0x50, 0x82, 0x4C, 0x82, 0x4C, 0x80, 0x9D, 0x84, 0x4C, 0x80, 0x55, 0x86, 0x00, 0x04, 0x02,
+    0x06, 0x03, 0x06, 0x01, 0x81, 0x04, 0x8B, 0x00, 0x06, 0x02, 0x03, 0x62, 0x0A, 0x05, 0x06, 0x02,
+    0xA8, 0x00, 0x14, 0x53, 0x11, 0x18, 0x00, 0x82, 0x2B, 0x5F, 0x5F, 0x26, 0x24, 0x21, 0x3F, 0x00,
+    0x06, 0x00, 0x2D, 0x60, 0x00, 0x00, 0x92, 0x41, 0x82, 0x00, 0x23, 0x5F, 0x9D, 0x65, 0x9D, 0x5A,
+    0x80, 0x56, 0x00, 0x07, 0x7E, 0x07, 0x8C, 0x2C, 0x4B, 0x56, 0x66, 0x9C, 0x76, 0x88, 0x8C, 0x21,
+    0x0C, 0x14, 0x7D, 0xA4, 0x8F, 0x9E, 0x00, 0x16, 0x95, 0x00, 0x01, 0x01, 0x03, 0x75, 0xA1, 0x83,
+    0x00, 0x81, 0x01, 0x10, 0x22, 0x63, 0x00, 0x04, 0x5F, 0x35, 0x00, 0x00, 0x7A, 0x53, 0x08, 0x01,
+    0x01, 0x1F, 0x28, 0x7A, 0x03, 0x9A, 0x00, 0x0A, 0x01, 0x22, 0x03, 0x05, 0x05, 0x0A, 0x05, 0x05,
+    0x03, 0x06, 0x48, 0x83, 0x0A, 0x05, 0x05, 0x03, 0x06, 0x06, 0x03, 0x01, 0x82, 0x00, 0x80, 0x37,
+    0x8F, 0x2C, 0x82, 0x33, 0x01, 0x2C, 0x0F, 0x80, 0x2C, 0x85, 0x33, 0x02, 0x4C, 0x9D, 0x41, 0x87,
+    0x00, 0x03, 0x02, 0x03, 0x03, 0x62, 0x81, 0x03, 0x87, 0x00, 0x80, 0x02, 0x84, 0x00, 0x04, 0x02,
+    0x06, 0x06, 0x01, 0x02, 0xA6, 0x00, 0x3F, 0x91, 0x00, 0x5D, 0x25, 0x4B, 0x79, 0x52, 0x53, 0x2B,
+    0x18, 0x22, 0x3D, 0x23, 0x52, 0x00, 0x07, 0x00, 0x1F, 0x29, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00,
+    0x34, 0x02, 0x8C, 0x5B, 0x65, 0x65, 0x90, 0x06, 0x00, 0x4F, 0x29, 0x00, 0x78, 0x2C, 0x79, 0x7E,
+    0x9C, 0x7C, 0x42, 0x88, 0x20, 0x17, 0x43, 0x21, 0x14, 0x53, 0x98, 0x9E, 0x7B, 0x49, 0x4E, 0x18,
+    0x00, 0x03, 0x06, 0x5D, 0x16, 0x2D, 0x49, 0x82, 0x00, 0x80, 0x02, 0x83, 0x00, 0x0B, 0x3C, 0x25,
+    0x79, 0x00, 0x7B, 0x2B, 0x4F, 0x02, 0x45, 0x95, 0x5F, 0x63, 0x9A, 0x00, 0x03, 0x02, 0x01, 0x01,
+    0x02, 0x83, 0x00, 0x80, 0x01, 0x81, 0x00, 0x83, 0x01, 0x01, 0x62, 0x03, 0x82, 0x06, 0x09, 0x03,
+    0x01, 0x02, 0x04, 0x00, 0x07, 0x2C, 0x64, 0x67, 0x64, 0x86, 0x1D, 0x01, 0x64, 0x1D, 0x84, 0x64,
+    0x80, 0x67, 0x81, 0x2C, 0x80, 0x64, 0x82, 0x2C, 0x05, 0x33, 0x2C, 0x2C, 0x33, 0x33, 0x73, 0x89,
+    0x00, 0x08, 0x02, 0x03, 0x05, 0x08, 0x0A, 0x05, 0x05, 0x06, 0x01, 0x8A, 0x00, 0x81, 0x01, 0xA7,
+    0x00, 0x12, 0x02, 0x06, 0x00, 0x49, 0x52, 0x2B, 0xA1, 0x79, 0x5F, 0x02, 0x1F, 0x53, 0x30, 0x49,
+    0x02, 0x00, 0x00, 0x07, 0x45, 0x82, 0x00, 0x29, 0x04, 0x5D, 0x00, 0x04, 0x04, 0x02, 0x79, 0x90,
+    0x1C, 0x00, 0x06, 0x04, 0x1F, 0x7A, 0x07, 0x33, 0x19, 0x00, 0x21, 0x7D, 0x14, 0x4E, 0x88, 0x83,
+    0x17, 0x76, 0x42, 0x11, 0x63, 0x34, 0x34, 0x00, 0x00, 0x16, 0x7E, 0x00, 0x00, 0x0A, 0x00, 0x7E,
+    0x3F, 0x07, 0x82, 0x00, 0x01, 0x01, 0x07, 0x82, 0x00, 0x0D, 0x91, 0x82, 0x5F, 0x01, 0x00, 0x87,
+    0x22, 0x00, 0x01, 0x16, 0x79, 0x03, 0x04, 0x02, 0x97, 0x00, 0x80, 0x02, 0x8E, 0x00, 0x0E, 0x02,
+    0x01, 0x01, 0x06, 0x03, 0x06, 0x02, 0x00, 0x04, 0x04, 0x00, 0x78, 0x1D, 0x1D, 0x83, 0x83, 0x31,
+    0x83, 0x20, 0x80, 0x1D, 0x84, 0x20, 0x82, 0x1D, 0x01, 0x1D, 0x64, 0x81, 0x67, 0x82, 0x2C, 0x81,
+    0x33, 0x02, 0x37, 0x00, 0x04, 0x89, 0x00, 0x0B, 0x01, 0x06, 0x13, 0x08, 0x87, 0x08, 0x08, 0x05,
+    0x48, 0x03, 0x01, 0x04, 0x84, 0x00, 0x80, 0x04, 0xA7, 0x00, 0x10, 0x49, 0x08, 0x03, 0x02, 0x06,
+    0x00, 0x51, 0x7B, 0x00, 0x56, 0x30, 0x29, 0x3F, 0x6E, 0x1C, 0x00, 0x06, 0x82, 0x00, 0x03, 0x02,
+    0x00, 0x01, 0x02, 0x82, 0x00, 0x18, 0x01, 0x00, 0x00, 0x02, 0x02, 0x5D, 0x00, 0x22, 0x00, 0x52,
+    0x7B, 0x85, 0x2C, 0x80, 0x18, 0x7C, 0x31, 0x7C, 0x61, 0x28, 0x20, 0x43, 0x3F, 0x56, 0x7B, 0x84,
+    0x00, 0x06, 0x1A, 0x30, 0x60, 0x00, 0x03, 0x06, 0x04, 0x87, 0x00, 0x0D, 0x02, 0x00, 0x04, 0x26,
+    0x7E, 0x00, 0x02, 0x22, 0x00, 0x01, 0x3D, 0x08, 0x1C, 0x86, 0xAC, 0x00, 0x82, 0x02, 0x82, 0x00,
+    0x0E, 0x02, 0x00, 0x5F, 0x83, 0x83, 0x31, 0x7C, 0x7D, 0x31, 0x14, 0x7C, 0x14, 0x31, 0x83, 0x31,
+    0x81, 0x83, 0x81, 0x20, 0x83, 0x1D, 0x0B, 0x83, 0x31, 0x31, 0x83, 0x83, 0x1D, 0x64, 0x2C, 0x2C,
+    0x79, 0x00, 0x04, 0x8C, 0x00, 0x0C, 0x01, 0x03, 0x0A, 0x08, 0x58, 0x8A, 0x0B, 0x13, 0x58, 0x85,
+    0x3D, 0x07, 0x04, 0xA9, 0x00, 0x18, 0x03, 0x0D, 0x0D, 0x08, 0x02, 0x34, 0x28, 0x98, 0x00, 0x0A,
+    0x26, 0x52, 0x4F, 0x00, 0x00, 0x04, 0x02, 0x48, 0x01, 0x00, 0x02, 0x00, 0x00, 0x32, 0x22, 0x83,
+    0x00, 0x22, 0x34, 0x00, 0x03, 0x5D, 0x00, 0x01, 0x00, 0x16, 0x5D, 0x73, 0x80, 0x05, 0x1F, 0x31,
+    0x31, 0x7C, 0x42, 0x98, 0x96, 0x45, 0x02, 0x00, 0x00, 0x04, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x30,
+    0x52, 0x00, 0x9F, 0x03, 0x04, 0x88, 0x00, 0x0C, 0x02, 0x00, 0x05, 0x47, 0x62, 0x01, 0x03, 0x07,
+    0x37, 0x03, 0x01, 0x07, 0x02, 0xB1, 0x00, 0x05, 0x04, 0x00, 0x00, 0x3D, 0x67, 0x64, 0x82, 0x1D,
+    0x01, 0x2A, 0x19, 0x82, 0x11, 0x09, 0x4B, 0x19, 0x19, 0x4B, 0x0F, 0x4B, 0x19, 0x5E, 0x5E, 0x78,
+    0x0B, 0x4D, 0x31, 0x7C, 0x7C, 0x83, 0x1D, 0x1D, 0x67, 0x2C, 0x56, 0x00, 0x04, 0x8E, 0x00, 0x0D,
+    0x02, 0x06, 0x05, 0x0A, 0x08, 0x8A, 0x73, 0x15, 0x15, 0x0B, 0x54, 0x87, 0x0A, 0x07, 0xA5, 0x00,
+    0x3F, 0x07, 0x32, 0x37, 0x92, 0x73, 0x01, 0x00, 0x04, 0x04, 0x01, 0x9F, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x06, 0x00, 0x05, 0x03, 0x00, 0x00, 0x34, 0x00, 0x50, 0x92, 0x00, 0x02, 0x00, 0x00, 0x02,
+    0x75, 0x07, 0x04, 0x01, 0x00, 0x45, 0x7E, 0x00, 0x8A, 0x06, 0x00, 0x00, 0x56, 0x5F, 0xA1, 0x28,
+    0x98, 0x00, 0x00, 0x5D, 0x04, 0x04, 0x5D, 0x01, 0x98, 0x04, 0x00, 0x00, 0x52, 0x30, 0x49, 0x00,
+    0x48, 0x82, 0x00, 0x80, 0x1A, 0x82, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x06, 0x34, 0x00, 0x8A, 0x4F,
+    0x08, 0x9A, 0x4F, 0x02, 0x22, 0x22, 0x00, 0x02, 0x9C, 0x00, 0x81, 0x02, 0x81, 0x01, 0x92, 0x00,
+    0x15, 0x02, 0x00, 0x20, 0x7D, 0x7D, 0x9C, 0x9C, 0x3E, 0x83, 0x81, 0x94, 0x3E, 0x3E, 0x7D, 0x7C,
+    0x31, 0x7D, 0x4D, 0x7D, 0x7C, 0x1D, 0x64, 0x0B, 0x31, 0x4D, 0x4D, 0x31, 0x4D, 0x81, 0x83, 0x2C,
+    0x64, 0x6A, 0x00, 0x04, 0x82, 0x00, 0x80, 0x02, 0x8F, 0x00, 0x05, 0x06, 0x05, 0x08, 0x08, 0x58,
+    0x54, 0x82, 0x8A, 0x03, 0x3B, 0x0A, 0x06, 0x02, 0xA0, 0x00, 0x08, 0x02, 0x05, 0x41, 0x03, 0x41,
+    0x00, 0x41, 0x91, 0x3D, 0x83, 0x00, 0x04, 0x07, 0x02, 0x02, 0x01, 0x00, 0x82, 0x02, 0x13, 0x00,
+    0x07, 0x00, 0x00, 0x9A, 0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x00, 0x01, 0x02, 0x7B, 0x00, 0x1F,
+    0x16, 0x00, 0x03, 0x83, 0x00, 0x03, 0x34, 0x00, 0x98, 0x7A, 0x84, 0x00, 0x20, 0x7B, 0x01, 0x8F,
+    0x98, 0x00, 0x00, 0x18, 0x7E, 0x63, 0x34, 0x06, 0x01, 0x01, 0x6E, 0x25, 0x00, 0x02, 0x00, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x00, 0x08, 0x79, 0x96, 0x9F, 0x00, 0x52, 0x53, 0x02, 0x34, 0x96, 0x00,
+    0x0B, 0x06, 0x48, 0x05, 0x87, 0x08, 0x05, 0x48, 0x48, 0x05, 0x06, 0x08, 0x48, 0x93, 0x00, 0x0D,
+    0x24, 0x7D, 0x7C, 0x7D, 0x76, 0x9C, 0x4D, 0x64, 0x3E, 0x3E, 0x9C, 0x4A, 0x0C, 0x7D, 0x82, 0x31,
+    0x80, 0x83, 0x81, 0x1D, 0x0A, 0x2A, 0x9C, 0x76, 0x4D, 0x83, 0x1D, 0x1D, 0x2C, 0x64, 0x2B, 0x01,
+    0x97, 0x00, 0x01, 0x01, 0x06, 0x82, 0x05, 0x07, 0x0A, 0x08, 0x3C, 0x0A, 0x03, 0x03, 0x06, 0x02,
+    0x99, 0x00, 0x81, 0x01, 0x82, 0x00, 0x29, 0x22, 0x6B, 0x15, 0x71, 0x0A, 0x71, 0x02, 0x33, 0x2E,
+    0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x9F, 0x02, 0x1C, 0x48, 0x34, 0x00, 0x00, 0x03, 0x06,
+    0x00, 0x02, 0x1F, 0x89, 0xA0, 0xA0, 0x2D, 0x62, 0x02, 0x00, 0x04, 0x1A, 0x18, 0x00, 0x03, 0x75,
+    0x01, 0x82, 0x00, 0x05, 0x04, 0x00, 0x88, 0x98, 0x5D, 0x04, 0x82, 0x00, 0x10, 0x96, 0x8F, 0x8F,
+    0x00, 0x00, 0x04, 0x7E, 0x56, 0x00, 0x03, 0x02, 0x00, 0x81, 0x52, 0x00, 0x00, 0x02, 0x84, 0x00,
+    0x0B, 0x13, 0x9A, 0x06, 0x00, 0x0A, 0x3F, 0x11, 0x82, 0x01, 0x00, 0x00, 0x04, 0x8E, 0x00, 0x81,
+    0x01, 0x0F, 0x04, 0x00, 0x01, 0x07, 0x03, 0x96, 0x37, 0x8A, 0x32, 0x55, 0x8A, 0x13, 0x0A, 0x0A,
+    0x62, 0x03, 0x88, 0x00, 0x01, 0x01, 0x07, 0x87, 0x00, 0x0D, 0x04, 0x2A, 0x7D, 0x4D, 0x7D, 0x36,
+    0x66, 0x3E, 0x20, 0x31, 0x3E, 0x7C, 0x94, 0x7D, 0x81, 0x7C, 0x81, 0x83, 0x82, 0x1D, 0x09, 0x0F,
+    0x1D, 0x7D, 0x4D, 0x1D, 0x83, 0x31, 0x31, 0x83, 0x4B, 0x9F, 0x00, 0x05, 0x02, 0x03, 0x03, 0x06,
+    0x06, 0x22, 0x98, 0x00, 0x02, 0x45, 0x30, 0x45, 0x82, 0x00, 0x28, 0x04, 0x00, 0x47, 0x6B, 0x4C,
+    0x1D, 0x8C, 0x50, 0x8C, 0x3C, 0x00, 0xA1, 0x02, 0x00, 0x07, 0x02, 0x04, 0x03, 0x16, 0x53, 0x34,
+    0x00, 0x04, 0x05, 0x7B, 0x00, 0x1F, 0x43, 0x25, 0x1F, 0x29, 0x42, 0x42, 0x1C, 0x00, 0x00, 0x56,
+    0x60, 0x00, 0x01, 0x02, 0x84, 0x00, 0x18, 0x04, 0x7B, 0x88, 0x22, 0x02, 0x00, 0x98, 0x8F, 0x88,
+    0x88, 0x8F, 0x00, 0x34, 0x00, 0x1F, 0x2D, 0x60, 0x02, 0x9F, 0x00, 0x2B, 0x2A, 0x07, 0x00, 0x02,
+    0x82, 0x00, 0x09, 0x02, 0x8A, 0x73, 0x01, 0x34, 0x52, 0x27, 0x82, 0x48, 0x52, 0x81, 0x00, 0x81,
+    0x02, 0x8D, 0x00, 0x12, 0x02, 0x01, 0x01, 0x07, 0x00, 0x01, 0x01, 0x00, 0x06, 0x08, 0x08, 0x13,
+    0x55, 0x32, 0x13, 0x08, 0x0A, 0x06, 0x75, 0x88, 0x00, 0x01, 0x01, 0x07, 0x86, 0x00, 0x13, 0x5D,
+    0x00, 0x35, 0x7D, 0x31, 0x66, 0x9C, 0x4D, 0x9C, 0x7C, 0x2C, 0x66, 0x9C, 0x8D, 0x9C, 0x31, 0x4D,
+    0x31, 0x20, 0x1D, 0x81, 0x64, 0x0A, 0x2C, 0x7D, 0x83, 0x67, 0x64, 0x31, 0x83, 0x4D, 0x7C, 0x0F,
+    0x01, 0xA2, 0x00, 0x81, 0x02, 0x80, 0x01, 0x97, 0x00, 0x02, 0x07, 0x60, 0x01, 0x86, 0x00, 0x24,
+    0x26, 0x0F, 0x19, 0x33, 0x26, 0x58, 0x75, 0x53, 0x3C, 0x7B, 0x06, 0x00, 0x01, 0x82, 0x03, 0x05,
+    0x18, 0x49, 0x00, 0x3B, 0x07, 0x00, 0x42, 0x56, 0x03, 0x29, 0x29, 0x82, 0x6E, 0x7E, 0x00, 0x07,
+    0x7E, 0x45, 0x00, 0x00, 0x02, 0x81, 0x00, 0x81, 0x04, 0x82, 0x00, 0x14, 0x28, 0x9E, 0x7B, 0x45,
+    0x9E, 0x9E, 0x7A, 0x97, 0x88, 0x01, 0x34, 0x04, 0x00, 0x04, 0x00, 0x00, 0x02, 0x04, 0x00, 0x79,
+    0x26, 0x83, 0x00, 0x0E, 0x01, 0x8A, 0x4F, 0x00, 0x00, 0x35, 0x11, 0x03, 0x01, 0x29, 0x5F, 0x00,
+    0x00, 0x02, 0x01, 0x8C, 0x00, 0x80, 0x02, 0x82, 0x01, 0x84, 0x00, 0x82, 0x02, 0x0A, 0x03, 0x05,
+    0x03, 0x87, 0x13, 0x13, 0x05, 0x05, 0x06, 0x01, 0x1C, 0x90, 0x00, 0x13, 0x4B, 0x83, 0x4D, 0x76,
+    0x7D, 0x64, 0x7D, 0x66, 0x64, 0x64, 0x76, 0x36, 0x7C, 0x20, 0x7C, 0x31, 0x20, 0x64, 0x2C, 0x67,
+    0x0E, 0x78, 0x1D, 0x83, 0x31, 0x1D, 0x1D, 0x64, 0x64, 0x78, 0x2C, 0x4F, 0x00, 0x02, 0x00, 0x01,
+    0x90, 0x00, 0x80, 0x04, 0x87, 0x00, 0x04, 0x04, 0x02, 0x3D, 0x63, 0x1C, 0x9B, 0x00, 0x80, 0x04,
+    0x82, 0x00, 0x2A, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x41, 0x26, 0x2C, 0x5B, 0x45, 0x26,
+    0x2B, 0x6A, 0x68, 0x00, 0x1C, 0x71, 0x1A, 0x56, 0x82, 0x60, 0x01, 0x03, 0x00, 0x4F, 0x6E, 0x85,
+    0x6E, 0x68, 0x53, 0x35, 0x6E, 0x56, 0x04, 0x4F, 0x7E, 0x22, 0x00, 0x04, 0x00, 0x02, 0x82, 0x00,
+    0x0C, 0x22, 0x26, 0x5B, 0x9D, 0x29, 0x7F, 0x47, 0x28, 0x9E, 0x28, 0x9E, 0x97, 0x7B, 0x84, 0x00,
+    0x14, 0x04, 0x02, 0x00, 0x00, 0x03, 0x5B, 0x03, 0x00, 0x00, 0x02, 0x3D, 0x22, 0x00, 0x18, 0x30,
+    0x5F, 0x01, 0x1C, 0x30, 0x26, 0x02, 0x9C, 0x00, 0x0C, 0x34, 0x00, 0x02, 0x03, 0x03, 0x0A, 0x08,
+    0x06, 0x0A, 0x0A, 0x56, 0x06, 0x07, 0x8C, 0x00, 0x15, 0x04, 0x00, 0x19, 0x2C, 0x64, 0x7C, 0x8B,
+    0x83, 0x31, 0x81, 0x9C, 0x33, 0x7C, 0x9C, 0x31, 0x20, 0x83, 0x83, 0x20, 0x1D, 0x2C, 0x67, 0x0A,
+    0x8C, 0x33, 0x33, 0x1D, 0x33, 0x4C, 0x4C, 0x5A, 0x6B, 0x2C, 0xA1, 0x8E, 0x00, 0x84, 0x01, 0x88,
+    0x00, 0x07, 0x03, 0x1A, 0x5F, 0x82, 0x79, 0x85, 0x02, 0x00, 0x81, 0x02, 0x99, 0x00, 0x03, 0x04,
+    0x00, 0x06, 0x48, 0x85, 0x00, 0x4A, 0x03, 0x48, 0x00, 0x55, 0x5B, 0x37, 0x26, 0x26, 0x00, 0x79,
+    0x71, 0x37, 0x3C, 0x53, 0x00, 0x02, 0x9F, 0x00, 0x60, 0x16, 0x82, 0x2B, 0x41, 0x2B, 0x35, 0x4B,
+    0x1F, 0x00, 0x56, 0x52, 0x00, 0x04, 0x01, 0x00, 0x00, 0x22, 0x82, 0x35, 0x11, 0x67, 0x1D, 0x1D,
+    0x50, 0x4E, 0x7F, 0x07, 0x7A, 0x8F, 0x7A, 0x97, 0x28, 0x00, 0x04, 0x00, 0x1F, 0x60, 0x00, 0x02,
+    0x34, 0x00, 0x00, 0x47, 0x86, 0x00, 0x03, 0x01, 0x00, 0x1A, 0x42, 0x25, 0x4F, 0x00, 0x18, 0x6E,
+    0x63, 0xA2, 0x00, 0x81, 0x02, 0x06, 0x01, 0x00, 0x06, 0x0A, 0x62, 0x03, 0x02, 0x8E, 0x00, 0x11,
+    0x80, 0x33, 0x33, 0x2C, 0x83, 0x64, 0x64, 0x1D, 0x31, 0x2A, 0x2C, 0x4D, 0x31, 0x2C, 0x2C, 0x67,
+    0x20, 0x67, 0x81, 0x33, 0x0A, 0x5A, 0x4C, 0x2E, 0x50, 0x50, 0x2E, 0x40, 0x71, 0x41, 0x65, 0x37,
+    0x8C, 0x00, 0x07, 0x01, 0x22, 0x49, 0x05, 0x05, 0x03, 0x22, 0x01, 0x85, 0x00, 0x0A, 0x1C, 0x1A,
+    0x52, 0x26, 0x03, 0x00, 0x00, 0x03, 0x03, 0x13, 0x75, 0x81, 0x01, 0x9B, 0x00, 0x02, 0x03, 0x75,
+    0x34, 0x85, 0x00, 0x30, 0x04, 0x58, 0x37, 0x00, 0x3B, 0x5B, 0x03, 0x37, 0x41, 0x65, 0x26, 0x35,
+    0x00, 0x03, 0x75, 0x00, 0x01, 0x82, 0x2B, 0x53, 0x6E, 0x6A, 0x80, 0x4B, 0x63, 0x00, 0x1F, 0x52,
+    0x00, 0x22, 0x03, 0x01, 0x04, 0x00, 0x1A, 0x2A, 0x2A, 0x24, 0x20, 0x20, 0x2B, 0x2A, 0x59, 0x8F,
+    0x28, 0x9E, 0x28, 0x97, 0x9E, 0x82, 0x00, 0x01, 0x82, 0x1F, 0x84, 0x00, 0x0D, 0x01, 0x05, 0x3C,
+    0x06, 0x00, 0x00, 0x56, 0x35, 0x01, 0x00, 0x52, 0x25, 0x07, 0x04, 0x86, 0x00, 0x80, 0x07, 0x95,
+    0x00, 0x80, 0x34, 0x87, 0x00, 0x82, 0x02, 0x03, 0x01, 0x22, 0x02, 0x01, 0x8C, 0x00, 0x13, 0x0D,
+    0x72, 0x9D, 0x2C, 0x2C, 0x33, 0x33, 0x0F, 0x0F, 0x67, 0x0F, 0x4D, 0x83, 0x0F, 0x2C, 0x0F, 0x64,
+    0x33, 0x33, 0x0F, 0x83, 0x65, 0x06, 0x6A, 0x40, 0x5A, 0x41, 0x9A, 0x5C, 0x08, 0x8B, 0x00, 0x81,
+    0x02, 0x05, 0x01, 0x03, 0x06, 0x06, 0x01, 0x02, 0x84, 0x00, 0x0C, 0x07, 0x1A, 0x52, 0x79, 0x00,
+    0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x00, 0x06, 0x82, 0x01, 0x93, 0x00, 0x03, 0x04, 0x00, 0x25,
+    0x2D, 0x83, 0x00, 0x27, 0x3B, 0x05, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0x03, 0x3D, 0x05, 0x65, 0x15, 0x32, 0x68, 0x52, 0x00, 0x02, 0x02, 0x04, 0x02, 0x85, 0x53, 0x11,
+    0x19, 0x4B, 0x53, 0x26, 0x01, 0x00, 0x1F, 0x1C, 0x22, 0x1F, 0x08, 0x03, 0x82, 0x00, 0x07, 0x22,
+    0x3F, 0x82, 0x53, 0x27, 0x52, 0x24, 0x11, 0x82, 0x9E, 0x18, 0x8F, 0x28, 0x97, 0x34, 0x00, 0x04,
+    0x16, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x85, 0x3B, 0x01, 0x02, 0x00, 0x5D, 0x00, 0x5B, 0x0F,
+    0x29, 0x16, 0x5D, 0x87, 0x00, 0x02, 0x05, 0x4F, 0x01, 0x8D, 0x00, 0x05, 0x01, 0x63, 0x56, 0x1A,
+    0x1A, 0x18, 0x8C, 0x00, 0x04, 0x02, 0x01, 0x02, 0x00, 0x02, 0x8B, 0x00, 0x13, 0x0D, 0x4C, 0x9D,
+    0x4C, 0x33, 0x9D, 0x4C, 0x33, 0x2C, 0x2C, 0x14, 0x33, 0x2C, 0x67, 0x2C, 0x33, 0x2C, 0x0F, 0x2E,
+    0x5E, 0x0B, 0x4F, 0x32, 0x5C, 0x4C, 0x0D, 0x41, 0x55, 0x0B, 0x71, 0x73, 0x05, 0x02, 0x8E, 0x00,
+    0x01, 0x02, 0x01, 0x84, 0x00, 0x11, 0x04, 0x18, 0x1A, 0x1F, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+    0x01, 0x05, 0x03, 0x03, 0x02, 0x00, 0x00, 0x04, 0x90, 0x00, 0x80, 0x01, 0x82, 0x00, 0x2E, 0x02,
+    0x53, 0x9C, 0x1A, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x96, 0x41, 0x92, 0x01, 0x02, 0x00, 0x3B,
+    0x01, 0x00, 0x02, 0x02, 0x00, 0x08, 0x0A, 0x13, 0x79, 0x7B, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00,
+    0x47, 0x4B, 0x11, 0x35, 0x53, 0x49, 0x04, 0x7B, 0x35, 0x49, 0x02, 0x34, 0x06, 0x0A, 0x83, 0x00,
+    0x11, 0x4F, 0x9F, 0x71, 0x11, 0x79, 0x83, 0x30, 0x9E, 0x97, 0x97, 0x9E, 0x04, 0x8F, 0x98, 0x34,
+    0x02, 0x7E, 0x16, 0x84, 0x00, 0x0E, 0x49, 0x1C, 0x02, 0x00, 0x01, 0x00, 0x02, 0x49, 0x35, 0x2B,
+    0x02, 0x34, 0x00, 0x00, 0x04, 0x84, 0x00, 0x01, 0x96, 0x49, 0x85, 0x00, 0x80, 0x02, 0x85, 0x00,
+    0x0D, 0x1C, 0x1F, 0x56, 0x45, 0x22, 0x01, 0x45, 0x51, 0x00, 0x02, 0x02, 0x16, 0x4E, 0x60, 0x8A,
+    0x00, 0x80, 0x04, 0x8A, 0x00, 0x12, 0x02, 0x41, 0x5A, 0x5A, 0x2E, 0x9D, 0x9D, 0x2E, 0x4C, 0x2C,
+    0x33, 0x0F, 0x4C, 0x33, 0x33, 0x9D, 0x78, 0x5B, 0x8C, 0x81, 0x65, 0x0B, 0x03, 0x58, 0x6A, 0x65,
+    0x65, 0x73, 0x8A, 0x0B, 0x73, 0x3B, 0x03, 0x02, 0x8C, 0x00, 0x02, 0x01, 0x00, 0x02, 0x84, 0x00,
+    0x05, 0x60, 0x25, 0x18, 0x04, 0x00, 0x75, 0x82, 0x00, 0x02, 0x04, 0x48, 0x58, 0x82, 0x0B, 0x04,
+    0x32, 0x3B, 0x03, 0x06, 0x02, 0x8E, 0x00, 0x01, 0x22, 0x49, 0x82, 0x00, 0x04, 0x0B, 0x07, 0x4F,
+    0x21, 0x18, 0x84, 0x00, 0x0E, 0x07, 0x05, 0x47, 0x4F, 0x37, 0x3D, 0x55, 0x96, 0x00, 0x04, 0x07,
+    0x34, 0x00, 0x00, 0x04, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00, 0x19, 0x02, 0x00, 0x03, 0xA1, 0x56,
+    0x02, 0x02, 0x00, 0x86, 0x1A, 0x00, 0x9F, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x34, 0x02, 0x04, 0x02,
+    0xA1, 0x2A, 0x79, 0x84, 0x74, 0x83, 0x97, 0x04, 0x28, 0x5D, 0x98, 0x04, 0x02, 0x81, 0x29, 0x83,
+    0x00, 0x03, 0x01, 0x00, 0x01, 0x02, 0x82, 0x00, 0x04, 0x01, 0x00, 0x3D, 0x3C, 0x04, 0x86, 0x00,
+    0x80, 0x04, 0x82, 0x00, 0x80, 0x04, 0x8B, 0x00, 0x01, 0x07, 0x1C, 0x88, 0x00, 0x04, 0x60, 0x95,
+    0x3F, 0x3F, 0x4F, 0x95, 0x00, 0x13, 0x9A, 0x0D, 0x0D, 0x40, 0x5A, 0x40, 0x2E, 0x5A, 0x2E, 0x2E,
+    0x40, 0x2E, 0x5A, 0x5A, 0x65, 0x65, 0x6B, 0x6B, 0x73, 0x37, 0x0A, 0x03, 0x47, 0x65, 0x54, 0x41,
+    0x58, 0x13, 0x13, 0x05, 0x48, 0x01, 0x8B, 0x00, 0x81, 0x02, 0x86, 0x00, 0x17, 0x1F, 0x29, 0x18,
+    0x04, 0x08, 0x03, 0x00, 0x00, 0x02, 0x3D, 0x3C, 0x47, 0x8A, 0x73, 0x73, 0x9A, 0x92, 0x8A, 0x08,
+    0x08, 0x06, 0x0A, 0x03, 0x04, 0x8B, 0x00, 0x0C, 0x22, 0x01, 0x00, 0x00, 0x87, 0x55, 0x05, 0x02,
+    0x63, 0x27, 0x1F, 0x00, 0x01, 0x85, 0x00, 0x2A, 0x05, 0x79, 0x71, 0x0A, 0x00, 0x03, 0x03, 0x01,
+    0x07, 0x00, 0x04, 0x01, 0x9F, 0x02, 0x01, 0x04, 0x00, 0x06, 0x06, 0x01, 0x9F, 0x06, 0x03, 0x06,
+    0x03, 0x00, 0x1F, 0x1A, 0x34, 0x45, 0x18, 0x00, 0x3C, 0x03, 0x01, 0x00, 0x02, 0x91, 0x85, 0x02,
+    0x08, 0x51, 0x88, 0x83, 0x97, 0x07, 0x9B, 0x97, 0x98, 0x04, 0x04, 0x00, 0x26, 0x95, 0x8C, 0x00,
+    0x03, 0x04, 0x01, 0x86, 0x48, 0x82, 0x00, 0x09, 0x01, 0x00, 0x00, 0x60, 0x34, 0x00, 0x02, 0x4F,
+    0x1C, 0x07, 0x88, 0x00, 0x12, 0x01, 0x03, 0x03, 0x49, 0x47, 0x8A, 0x73, 0x8A, 0x6B, 0x92, 0x96,
+    0x22, 0x00, 0x01, 0x03, 0x52, 0x3F, 0x1A, 0x07, 0x84, 0x00, 0x80, 0x01, 0x8D, 0x00, 0x13, 0x47,
+    0x9A, 0x8A, 0x9A, 0x55, 0x15, 0x41, 0x0B, 0x0B, 0x0D, 0x9A, 0x55, 0x41, 0x0D, 0x92, 0x8A, 0x37,
+    0x13, 0x58, 0x3C, 0x0A, 0x06, 0x85, 0x8A, 0x8A, 0x13, 0x03, 0x03, 0x48, 0x03, 0x06, 0x01, 0x8A,
+    0x00, 0x01, 0x02, 0x01, 0x85, 0x00, 0x19, 0x1C, 0x25, 0x52, 0x00, 0x05, 0x87, 0x01, 0x00, 0x02,
+    0x03, 0x0B, 0x15, 0x55, 0x41, 0x15, 0x15, 0x73, 0x0B, 0x0B, 0x58, 0x3B, 0x3B, 0x06, 0x03, 0x02,
+    0x9F, 0x8A, 0x00, 0x80, 0x07, 0x82, 0x00, 0x1E, 0x03, 0x90, 0x0B, 0x32, 0x01, 0x00, 0x63, 0x21,
+    0x1F, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x04, 0x00, 0x06, 0x07, 0x04, 0x26, 0x4B, 0x82,
+    0x48, 0x02, 0x06, 0x06, 0x62, 0x05, 0x02, 0x82, 0x00, 0x17, 0x06, 0x02, 0x01, 0x02, 0x01, 0x01,
+    0x04, 0x00, 0x1F, 0x4F, 0x04, 0x9F, 0x28, 0x04, 0x03, 0x3B, 0x00, 0x00, 0x02, 0x26, 0x3C, 0x4F,
+    0x28, 0x9E, 0x84, 0x97, 0x08, 0x9B, 0x97, 0x9E, 0x00, 0x34, 0x04, 0x08, 0x35, 0x01, 0x83, 0x00,
+    0x80, 0x01, 0x88, 0x00, 0x03, 0x07, 0x3B, 0x00, 0x01, 0x83, 0x00, 0x06, 0x01, 0x00, 0x45, 0x29,
+    0x29, 0x56, 0x49, 0x87, 0x00, 0x14, 0x02, 0x03, 0x08, 0x87, 0x58, 0x15, 0x5C, 0x65, 0x40, 0x40,
+    0x0D, 0x41, 0x15, 0x73, 0x1C, 0x04, 0x00, 0x04, 0x29, 0x25, 0x51, 0x84, 0x00, 0x80, 0x07, 0x8C,
+    0x00, 0x13, 0x3C, 0x47, 0x08, 0x08, 0x58, 0x47, 0x92, 0x08, 0x08, 0x13, 0x37, 0x58, 0x08, 0x3C,
+    0x48, 0x48, 0x4F, 0x3C, 0x3D, 0x91, 0x08, 0x01, 0x03, 0x48, 0x47, 0x02, 0x01, 0x01, 0x06, 0x02,
+    0x8C, 0x00, 0x82, 0x02, 0x83, 0x00, 0x0F, 0x18, 0x25, 0x60, 0x01, 0x47, 0x62, 0x00, 0x00, 0x02,
+    0x3B, 0x15, 0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x82, 0x15, 0x07, 0x6B, 0x54, 0x8A, 0x85, 0x0A, 0x01,
+    0x00, 0x34, 0x8D, 0x00, 0x12, 0x02, 0x4F, 0x92, 0x13, 0x47, 0x91, 0x01, 0x00, 0x47, 0x20, 0x52,
+    0x00, 0x00, 0x02, 0x06, 0x03, 0x06, 0x00, 0x04, 0x82, 0x00, 0x32, 0x01, 0xA1, 0x52, 0x01, 0x26,
+    0x82, 0x48, 0x02, 0x01, 0x02, 0x00, 0x00, 0x07, 0x00, 0x03, 0x1C, 0x02, 0x00, 0x00, 0x04, 0x00,
+    0x29, 0x91, 0x00, 0x00, 0x60, 0x07, 0x02, 0x79, 0x9F, 0x00, 0x3C, 0x15, 0x08, 0x1F, 0x9E, 0x97,
+    0x97, 0x9B, 0x97, 0x97, 0x9B, 0x9B, 0x97, 0x97, 0x28, 0x00, 0x00, 0x02, 0x6E, 0x28, 0x8D, 0x00,
+    0x02, 0x07, 0xA1, 0x01, 0x84, 0x00, 0x06, 0x4F, 0x53, 0x82, 0x82, 0x2B, 0x7E, 0x01, 0x87, 0x00,
+    0x15, 0x02, 0x03, 0x87, 0x0B, 0x6B, 0x15, 0x5C, 0x0D, 0x40, 0x0D, 0x0D, 0x40, 0x65, 0x0D, 0x92,
+    0x85, 0x45, 0x02, 0x00, 0x18, 0x25, 0x18, 0x91, 0x00, 0x13, 0x3D, 0x08, 0x49, 0x03, 0x91, 0x48,
+    0x3B, 0x03, 0x48, 0x03, 0x05, 0x0A, 0x0A, 0x02, 0x06, 0x03, 0x03, 0x1C, 0x86, 0x03, 0x06, 0x07,
+    0x02, 0x03, 0x03, 0x9F, 0x01, 0x04, 0x94, 0x00, 0x19, 0x16, 0x95, 0x01, 0x01, 0x54, 0x49, 0x00,
+    0x00, 0x49, 0x0B, 0x5C, 0x41, 0x41, 0x5C, 0x0D, 0x0D, 0x5C, 0x9A, 0x41, 0x15, 0x73, 0x58, 0x05,
+    0x91, 0x22, 0x00, 0x81, 0x04, 0x8D, 0x00, 0x39, 0x3D, 0x58, 0x08, 0x41, 0x08, 0x86, 0x06, 0x80,
+    0x3B, 0x8C, 0x1D, 0x49, 0x00, 0x00, 0x02, 0x02, 0x03, 0x06, 0x62, 0x03, 0x01, 0x00, 0x04, 0x04,
+    0x00, 0x34, 0x63, 0x6E, 0x1C, 0x04, 0x42, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x03, 0x08, 0x06, 0x02,
+    0x02, 0x00, 0x3D, 0x56, 0x00, 0x7B, 0x8F, 0x7B, 0x28, 0x00, 0x32, 0x0B, 0x00, 0x92, 0x32, 0x79,
+    0x56, 0x97, 0x83, 0x9B, 0x80, 0x97, 0x82, 0x9B, 0x06, 0x97, 0x9E, 0x00, 0x5D, 0x00, 0x26, 0x35,
+    0x85, 0x00, 0x04, 0x04, 0x16, 0x60, 0x00, 0x01, 0x82, 0x00, 0x0F, 0x04, 0x58, 0x3C, 0x00, 0x34,
+    0x00, 0x00, 0x2D, 0x14, 0x68, 0x26, 0x30, 0x35, 0x2B, 0x82, 0x02, 0x86, 0x00, 0x16, 0x01, 0x05,
+    0x58, 0x8A, 0x41, 0x73, 0x73, 0x15, 0x0D, 0x6B, 0x41, 0x40, 0x6B, 0x41, 0x9A, 0x8A, 0x3B, 0x0A,
+    0x03, 0x00, 0x75, 0x25, 0x1F, 0x90, 0x00, 0x83, 0x01, 0x01, 0x03, 0x02, 0x82, 0x03, 0x0A, 0x62,
+    0x03, 0x03, 0x3D, 0x02, 0x06, 0x06, 0x02, 0x06, 0x06, 0x02, 0x04, 0x00, 0x02, 0x05, 0x02, 0x04,
+    0x94, 0x00, 0x0C, 0x22, 0x95, 0x1F, 0x02, 0x75, 0x49, 0x01, 0x00, 0x01, 0x08, 0x0B, 0x73, 0x41,
+    0x84, 0x40, 0x08, 0x5C, 0x41, 0x73, 0x32, 0x3B, 0x85, 0x03, 0x22, 0x01, 0x90, 0x00, 0x0B, 0x4F,
+    0x13, 0x05, 0x15, 0x3B, 0x96, 0x58, 0x0F, 0x33, 0x78, 0x80, 0x02, 0x83, 0x00, 0x81, 0x02, 0x81,
+    0x05, 0x04, 0x48, 0x75, 0x02, 0x1C, 0x03, 0x83, 0x00, 0x04, 0x01, 0xA1, 0x07, 0x00, 0x02, 0x87,
+    0x00, 0x0C, 0x5F, 0x1F, 0x00, 0x00, 0x9E, 0x98, 0x28, 0x7B, 0x49, 0x0D, 0x03, 0x4F, 0x88, 0x81,
+    0x7F, 0x83, 0x9B, 0x80, 0x97, 0x83, 0x9B, 0x08, 0x97, 0x9E, 0x5D, 0x5D, 0x00, 0x03, 0x35, 0x16,
+    0x75, 0x82, 0x00, 0x05, 0x04, 0x00, 0x81, 0x1E, 0x00, 0x01, 0x83, 0x00, 0x0E, 0x02, 0x5F, 0x49,
+    0x00, 0x04, 0x51, 0x42, 0x26, 0x02, 0x29, 0x2A, 0x30, 0x5F, 0x52, 0x62, 0x85, 0x00, 0x04, 0x01,
+    0x0A, 0x8A, 0x0B, 0x6B, 0x84, 0x9A, 0x0E, 0x73, 0x9A, 0x41, 0x55, 0x32, 0x0B, 0x3B, 0x3B, 0x96,
+    0x3D, 0x03, 0x00, 0x00, 0x16, 0x1F, 0x92, 0x00, 0x0E, 0x02, 0x00, 0x01, 0x00, 0x03, 0x03, 0x02,
+    0x02, 0x01, 0x04, 0x01, 0x04, 0x00, 0x00, 0x01, 0x81, 0x00, 0x04, 0x00, 0x01, 0x02, 0x00, 0x04,
+    0x93, 0x00, 0x0D, 0x49, 0x1F, 0x1C, 0x02, 0x06, 0x03, 0x00, 0x00, 0x01, 0x08, 0x47, 0x8A, 0x15,
+    0x0D, 0x83, 0x40, 0x0E, 0x0D, 0x6B, 0x13, 0x0A, 0x0A, 0x0B, 0x41, 0x91, 0x00, 0x00, 0x98, 0x28,
+    0x28, 0x7B, 0x5D, 0x8A, 0x00, 0x1D, 0x01, 0x05, 0x8A, 0x05, 0x05, 0x8A, 0x85, 0x65, 0x78, 0x33,
+    0x33, 0x05, 0x34, 0x00, 0x00, 0x04, 0x00, 0x63, 0x63, 0x00, 0x01, 0x02, 0x22, 0x00, 0x02, 0x03,
+    0x06, 0x01, 0x22, 0x00, 0x81, 0x26, 0x83, 0x00, 0x80, 0x02, 0x81, 0x04, 0x82, 0x00, 0x0F, 0xA1,
+    0x2B, 0x91, 0x00, 0x00, 0x98, 0x28, 0x98, 0x8F, 0x00, 0x41, 0x54, 0x7F, 0x9B, 0x9B, 0x3A, 0x83,
+    0x9B, 0x80, 0x97, 0x83, 0x9B, 0x81, 0x97, 0x80, 0x98, 0x82, 0x00, 0x1E, 0x58, 0x14, 0x3F, 0x00,
+    0x00, 0x01, 0x00, 0x56, 0x17, 0x2D, 0x7B, 0x00, 0x34, 0x02, 0x48, 0x00, 0x00, 0x03, 0x98, 0x98,
+    0x00, 0x02, 0x52, 0x8C, 0x79, 0x3D, 0x4B, 0x11, 0x53, 0x26, 0x1F, 0x83, 0x00, 0x16, 0x01, 0x06,
+    0x05, 0x54, 0x15, 0x5C, 0x0D, 0x71, 0x40, 0x5A, 0x5A, 0x0D, 0x40, 0x0D, 0x5C, 0x41, 0x6B, 0x0B,
+    0x13, 0x05, 0x62, 0x45, 0x01, 0x82, 0x00, 0x01, 0x16, 0x1A, 0x90, 0x00, 0x80, 0x34, 0x84, 0x00,
+    0x03, 0x07, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x04, 0x00, 0x97, 0x00, 0x04, 0x56, 0x18, 0x00,
+    0x00, 0x9F, 0x82, 0x00, 0x13, 0x01, 0x0A, 0x0A, 0x58, 0x73, 0x0B, 0x15, 0x0D, 0x40, 0x40, 0x37,
+    0x3C, 0x13, 0x8A, 0x58, 0x22, 0x02, 0x00, 0x04, 0x98, 0x84, 0x8F, 0x02, 0x88, 0x51, 0x02, 0x85,
+    0x00, 0x22, 0x04, 0x00, 0x02, 0x9F, 0x5D, 0x05, 0x3D, 0x04, 0x01, 0x2E, 0x4C, 0x50, 0x33, 0x79,
+    0x00, 0x04, 0x00, 0x9F, 0x00, 0x00, 0x24, 0x8D, 0x95, 0x00, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
+    0x01, 0x02, 0x00, 0x5F, 0x37, 0x89, 0x00, 0x0E, 0x6E, 0x31, 0x02, 0x04, 0x00, 0x00, 0x04, 0x00,
+    0x8F, 0x9E, 0x7A, 0x5F, 0x59, 0x9B, 0x3A, 0x84, 0x9B, 0x80, 0x97, 0x83, 0x9B, 0x81, 0x97, 0x25,
+    0x98, 0x00, 0x00, 0x04, 0x00, 0x52, 0x52, 0x01, 0x00, 0x04, 0x2B, 0x27, 0x1A, 0x16, 0x7E, 0x00,
+    0x00, 0x06, 0x08, 0x01, 0x00, 0x02, 0x04, 0x28, 0x62, 0x00, 0x28, 0x4B, 0x54, 0x91, 0x56, 0x35,
+    0x7E, 0x79, 0x18, 0x00, 0x00, 0x07, 0x84, 0x00, 0x1A, 0x01, 0x03, 0x03, 0x8A, 0x5C, 0x40, 0x5A,
+    0x5A, 0x2E, 0x65, 0x0D, 0x41, 0x3B, 0x05, 0x08, 0x48, 0x0A, 0x3C, 0x03, 0x9F, 0x02, 0x00, 0x00,
+    0x7E, 0x18, 0x00, 0x02, 0x9F, 0x00, 0x95, 0x00, 0x03, 0x07, 0x49, 0x22, 0x07, 0x85, 0x00, 0x0D,
+    0x06, 0x01, 0x0A, 0x13, 0x13, 0x37, 0x32, 0x15, 0x0D, 0x13, 0x13, 0x9A, 0x9A, 0x06, 0x82, 0x00,
+    0x20, 0x98, 0x8F, 0x8F, 0x98, 0x34, 0x06, 0x00, 0x03, 0x02, 0x60, 0x07, 0x00, 0x00, 0x04, 0x04,
+    0x00, 0x00, 0x01, 0x00, 0x0A, 0x13, 0x03, 0x5D, 0x00, 0x00, 0x41, 0x2E, 0x0F, 0x1D, 0xA1, 0x00,
+    0x00, 0x04, 0x82, 0x00, 0x11, 0x01, 0x7D, 0x09, 0x23, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x03, 0x82, 0x00, 0x10, 0x45, 0x82, 0x1A, 0x1F, 0x00, 0x01,
+    0x24, 0x24, 0x60, 0x00, 0x5D, 0x34, 0x00, 0x86, 0x9E, 0x97, 0x88, 0x81, 0x59, 0x86, 0x9B, 0x80,
+    0x3A, 0x81, 0x9B, 0x82, 0x97, 0x80, 0x98, 0x82, 0x00, 0x20, 0x22, 0x63, 0x07, 0x00, 0x18, 0x2A,
+    0x53, 0x06, 0x02, 0xA1, 0x01, 0x25, 0x1A, 0x02, 0x03, 0x05, 0x01, 0x00, 0x00, 0x34, 0x1C, 0x04,
+    0x00, 0x6E, 0x82, 0x62, 0x01, 0x5F, 0x60, 0x22, 0x01, 0x00, 0x04, 0x82, 0x02, 0x1C, 0x3D, 0x58,
+    0x73, 0x0B, 0x08, 0x86, 0x00, 0x01, 0x9F, 0x02, 0x71, 0x40, 0x32, 0x0D, 0x87, 0x0B, 0x54, 0x08,
+    0x03, 0x01, 0x05, 0x08, 0x06, 0x02, 0x01, 0x00, 0x01, 0x1F, 0x03, 0xA0, 0x00, 0x95, 0x00, 0x01,
+    0x42, 0x25, 0x85, 0x00, 0x1F, 0x07, 0x01, 0x02, 0x03, 0x01, 0x01, 0x08, 0x0B, 0x58, 0x03, 0x49,
+    0x0B, 0x92, 0x06, 0x00, 0x7B, 0x00, 0x00, 0x28, 0x9E, 0x8F, 0x00, 0x75, 0x32, 0x87, 0x4F, 0x29,
+    0x90, 0x05, 0x01, 0x00, 0x04, 0x82, 0x00, 0x0E, 0x02, 0x00, 0x01, 0x87, 0x58, 0x07, 0x06, 0x49,
+    0x05, 0x50, 0x2E, 0x4D, 0x30, 0x00, 0x34, 0x84, 0x00, 0x08, 0x4F, 0x3E, 0x36, 0x16, 0x00, 0x02,
+    0x02, 0x01, 0x04, 0x83, 0x00, 0x81, 0x02, 0x18, 0x00, 0x04, 0x01, 0x05, 0x02, 0x4F, 0x42, 0x14,
+    0x14, 0x17, 0x6E, 0x00, 0x02, 0x7E, 0x24, 0x11, 0x18, 0x00, 0x00, 0x7B, 0x88, 0x97, 0x97, 0x9B,
+    0x3A, 0x86, 0x9B, 0x81, 0x3A, 0x80, 0x9B, 0x82, 0x97, 0x49, 0x8F, 0x5D, 0x00, 0x34, 0x5D, 0x00,
+    0x05, 0x25, 0x27, 0x26, 0x00, 0x00, 0x01, 0x4F, 0x2D, 0x1E, 0x29, 0x00, 0x02, 0x06, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x01, 0x00, 0x60, 0x24, 0x4F, 0x75, 0x00, 0x45, 0x75, 0x00, 0x01, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x07, 0x03, 0x92, 0x6B, 0x5A, 0x6A, 0x40, 0x41, 0x0A, 0x05, 0x06, 0x4F, 0x92,
+    0x03, 0x0B, 0x58, 0x06, 0x01, 0x03, 0x03, 0x01, 0x06, 0x01, 0x00, 0x02, 0x00, 0x01, 0x26, 0x49,
+    0x04, 0x00, 0x00, 0x04, 0x9B, 0x00, 0x92, 0x00, 0x04, 0x04, 0x00, 0x00, 0x16, 0x52, 0x83, 0x00,
+    0x80, 0x04, 0x81, 0x00, 0x82, 0x02, 0x1B, 0x62, 0x48, 0x03, 0x07, 0x07, 0x05, 0x08, 0x04, 0x02,
+    0x51, 0x7A, 0x98, 0x04, 0x98, 0x97, 0x8F, 0x05, 0x63, 0x5C, 0x06, 0x19, 0x9D, 0x75, 0x06, 0x58,
+    0x92, 0x02, 0x34, 0x84, 0x00, 0x0A, 0x03, 0x87, 0x05, 0x96, 0x68, 0x2A, 0x33, 0x2E, 0x31, 0x42,
+    0x02, 0x82, 0x00, 0x29, 0x01, 0x02, 0x00, 0x00, 0x2B, 0x9C, 0x61, 0x00, 0x04, 0x00, 0x02, 0x62,
+    0x62, 0x00, 0x00, 0x02, 0x49, 0x27, 0xA1, 0x00, 0x34, 0x34, 0x06, 0x01, 0x53, 0x80, 0x0D, 0x0B,
+    0x82, 0x20, 0x18, 0x02, 0x00, 0x7B, 0x53, 0x31, 0x29, 0x00, 0x00, 0x88, 0x9E, 0x97, 0x82, 0x9B,
+    0x87, 0x3A, 0x80, 0x9B, 0x82, 0x97, 0x15, 0x8F, 0x00, 0x04, 0x00, 0x00, 0x1A, 0x81, 0x27, 0x05,
+    0x02, 0x00, 0x34, 0x60, 0x27, 0x53, 0x0A, 0x02, 0x04, 0x00, 0x00, 0x9F, 0x02, 0x82, 0x00, 0x30,
+    0x02, 0x01, 0x00, 0x29, 0x11, 0x00, 0x07, 0x60, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x18, 0x1A,
+    0x1F, 0x1F, 0x60, 0x7B, 0x00, 0x03, 0x90, 0x5A, 0x50, 0x41, 0x06, 0x07, 0x5D, 0x01, 0x05, 0x1C,
+    0x22, 0x06, 0x05, 0x62, 0x00, 0x02, 0x00, 0x01, 0x02, 0x00, 0x02, 0x3D, 0x82, 0x25, 0x00, 0x00,
+    0x04, 0x9B, 0x00, 0x91, 0x00, 0x80, 0x04, 0x82, 0x00, 0x01, 0x16, 0x6E, 0x85, 0x00, 0x1F, 0x01,
+    0x00, 0x00, 0x01, 0x05, 0x01, 0x00, 0x3D, 0x3D, 0x03, 0x00, 0x34, 0x28, 0x88, 0x88, 0x07, 0x98,
+    0x9E, 0x9E, 0x8F, 0x0D, 0x9A, 0x13, 0x00, 0x47, 0x0A, 0x01, 0x37, 0x55, 0x52, 0x2D, 0x28, 0x83,
+    0x00, 0x39, 0x02, 0x06, 0x01, 0x05, 0x0F, 0x20, 0x2C, 0x72, 0x83, 0x23, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00, 0x30, 0x66, 0x29, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x45, 0x02,
+    0x00, 0x52, 0x9C, 0x68, 0x05, 0x02, 0x00, 0x01, 0x18, 0x5E, 0x65, 0x5A, 0x80, 0x13, 0x68, 0x53,
+    0x04, 0x07, 0x00, 0x02, 0x25, 0x29, 0x00, 0x28, 0x7A, 0x7A, 0x9E, 0x9B, 0x84, 0x3A, 0x80, 0x9B,
+    0x83, 0x3A, 0x01, 0x97, 0x9B, 0x82, 0x97, 0x16, 0x04, 0x00, 0x1C, 0x68, 0x14, 0x7E, 0x00, 0x00,
+    0x02, 0x00, 0x5F, 0x67, 0x52, 0x04, 0x00, 0x00, 0x04, 0x04, 0x01, 0x01, 0x07, 0x00, 0x34, 0x84,
+    0x00, 0x21, 0x27, 0x82, 0x1C, 0x22, 0x00, 0x00, 0x01, 0x04, 0x04, 0x28, 0x42, 0x61, 0x61, 0x42,
+    0x4E, 0x4E, 0x74, 0x02, 0x00, 0x34, 0x91, 0x3B, 0x55, 0x13, 0x01, 0x00, 0x00, 0x03, 0x0A, 0x03,
+    0x00, 0x75, 0x03, 0x7B, 0x85, 0x00, 0x02, 0x1A, 0x42, 0x06, 0x9D, 0x00, 0x93, 0x00, 0x04, 0x01,
+    0x00, 0x63, 0x4D, 0x56, 0x83, 0x00, 0x08, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x48, 0x0A,
+    0x82, 0x00, 0x24, 0x28, 0x7A, 0x74, 0x28, 0x34, 0x8F, 0x5F, 0x28, 0x98, 0x03, 0x05, 0x87, 0x08,
+    0x00, 0x75, 0x26, 0x1A, 0x42, 0x36, 0x09, 0x39, 0x7A, 0x00, 0x00, 0x04, 0x00, 0x9F, 0x4F, 0x27,
+    0x67, 0x33, 0x0F, 0x7C, 0x42, 0x62, 0x00, 0x04, 0x83, 0x00, 0x09, 0x02, 0x01, 0x02, 0x24, 0x1E,
+    0x18, 0x00, 0x0A, 0x48, 0x01, 0x84, 0x00, 0x08, 0x07, 0x86, 0x91, 0x58, 0x0B, 0x06, 0x00, 0x16,
+    0x0F, 0x82, 0x2E, 0x03, 0x71, 0x55, 0x5E, 0x34, 0x82, 0x00, 0x07, 0x30, 0x91, 0x9F, 0x88, 0x88,
+    0x97, 0x8F, 0x9B, 0x84, 0x3A, 0x80, 0x9B, 0x82, 0x3A, 0x85, 0x97, 0x81, 0x34, 0x09, 0x22, 0x26,
+    0x80, 0x00, 0x07, 0x00, 0x00, 0x52, 0x83, 0x35, 0x82, 0x00, 0x08, 0x25, 0x16, 0x00, 0x01, 0x00,
+    0x00, 0x9F, 0x00, 0x04, 0x83, 0x00, 0x02, 0x56, 0x1D, 0x3D, 0x82, 0x00, 0x1C, 0x06, 0x02, 0x1A,
+    0x0C, 0x70, 0x77, 0x70, 0x70, 0x0C, 0x61, 0x2D, 0x89, 0x60, 0x02, 0x01, 0x00, 0x00, 0x91, 0x92,
+    0x06, 0x9F, 0x02, 0x06, 0x06, 0x00, 0x00, 0x01, 0x51, 0x75, 0x82, 0x00, 0x04, 0x01, 0x00, 0x29,
+    0x7E, 0x02, 0x9D, 0x00, 0x90, 0x00, 0x80, 0x22, 0x83, 0x00, 0x07, 0x02, 0x2D, 0x23, 0x02, 0x00,
+    0x00, 0x16, 0x45, 0x83, 0x00, 0x1E, 0x01, 0x22, 0x00, 0x00, 0x5D, 0x51, 0x60, 0x88, 0x74, 0x7F,
+    0x34, 0x8F, 0x1F, 0x0B, 0x47, 0x32, 0x1C, 0x05, 0x05, 0x48, 0x55, 0x6E, 0x82, 0x17, 0x09, 0x8D,
+    0x6C, 0x95, 0x63, 0x28, 0x51, 0x82, 0x00, 0x08, 0x4B, 0x4A, 0x66, 0x4C, 0x31, 0xA0, 0x03, 0x02,
+    0x04, 0x86, 0x00, 0x27, 0x08, 0x20, 0x30, 0x01, 0x00, 0x45, 0x56, 0x08, 0x1C, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x71, 0x79, 0x00, 0x1A, 0x24, 0x4C, 0x2E, 0x4C, 0x80, 0x8A, 0x5B,
+    0x00, 0x00, 0x1F, 0x42, 0x6E, 0x00, 0x7A, 0x9E, 0x9E, 0x97, 0x97, 0x7F, 0x87, 0x3A, 0x80, 0x9B,
+    0x84, 0x97, 0x27, 0x9E, 0x28, 0x98, 0x00, 0x02, 0x3D, 0x91, 0x34, 0x00, 0x6E, 0x1D, 0x21, 0x23,
+    0x06, 0x29, 0x2B, 0x7E, 0x16, 0x29, 0x63, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+    0x00, 0x2B, 0x30, 0x00, 0x04, 0x7E, 0x7E, 0x28, 0x77, 0x77, 0x57, 0x83, 0x77, 0x13, 0x99, 0x61,
+    0x42, 0xA3, 0x28, 0x28, 0x00, 0x00, 0x04, 0x00, 0x48, 0x49, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00,
+    0x51, 0x75, 0x83, 0x00, 0x02, 0x45, 0x30, 0x60, 0x9E, 0x00, 0x90, 0x00, 0x01, 0x18, 0x01, 0x83,
+    0x00, 0x02, 0x63, 0x24, 0x16, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x29, 0x02, 0x00, 0x00, 0x51,
+    0x74, 0x28, 0x7A, 0x88, 0x59, 0x7A, 0x98, 0x28, 0x13, 0x41, 0x0B, 0x40, 0x38, 0x84, 0x5C, 0x1F,
+    0x25, 0x16, 0x39, 0x09, 0x6C, 0x1A, 0x00, 0x00, 0x5D, 0x01, 0x7B, 0x02, 0x34, 0x00, 0x11, 0x7D,
+    0x9C, 0x20, 0x7E, 0x04, 0x00, 0x02, 0x82, 0x00, 0x12, 0x02, 0x00, 0x00, 0x04, 0x00, 0x52, 0x83,
+    0x52, 0x00, 0x00, 0x02, 0x25, 0x86, 0x02, 0x03, 0x03, 0x00, 0x91, 0x0A, 0x82, 0x00, 0x12, 0x07,
+    0x48, 0x03, 0x01, 0x16, 0x5E, 0x4C, 0x5B, 0x5B, 0x90, 0x9A, 0x01, 0x75, 0x18, 0x2D, 0x51, 0x00,
+    0x51, 0x88, 0x82, 0x97, 0x02, 0x88, 0x7F, 0x9B, 0x85, 0x3A, 0x81, 0x97, 0x80, 0x9B, 0x83, 0x97,
+    0x02, 0x9E, 0x98, 0x04, 0x84, 0x00, 0x11, 0x35, 0x2A, 0x85, 0x18, 0x2B, 0x52, 0x01, 0x56, 0x6E,
+    0x27, 0x1A, 0x00, 0x07, 0x00, 0x7B, 0x00, 0x04, 0x02, 0x82, 0x00, 0x09, 0x04, 0x2B, 0x7E, 0x82,
+    0x30, 0x18, 0x61, 0xA3, 0x57, 0x99, 0x81, 0x70, 0x82, 0x77, 0x07, 0x6C, 0x2D, 0x44, 0x6C, 0x1A,
+    0x4E, 0x45, 0x02, 0x81, 0x00, 0x82, 0x01, 0x0B, 0x5D, 0x02, 0x06, 0x03, 0x07, 0x00, 0x00, 0x01,
+    0x34, 0x00, 0x7E, 0x52, 0x9F, 0x00, 0x8F, 0x00, 0x02, 0x7B, 0x30, 0x04, 0x82, 0x00, 0x31, 0x49,
+    0x7E, 0x79, 0x2C, 0x60, 0x00, 0x04, 0x02, 0x00, 0x04, 0x5D, 0x04, 0x04, 0x00, 0x28, 0x7F, 0x7F,
+    0x28, 0x74, 0x74, 0x7F, 0x75, 0x98, 0x0A, 0x3D, 0x3B, 0x04, 0x9F, 0x08, 0x65, 0x68, 0x4E, 0x1F,
+    0x36, 0x09, 0x61, 0x45, 0x02, 0x01, 0x00, 0x51, 0x25, 0x2D, 0x25, 0x5D, 0x04, 0x47, 0x0F, 0x2A,
+    0x1A, 0x8B, 0x00, 0x04, 0x4B, 0x24, 0x63, 0x00, 0x02, 0x86, 0x00, 0x02, 0x47, 0x79, 0x01, 0x84,
+    0x00, 0x0B, 0x01, 0x00, 0x00, 0x3D, 0x22, 0x01, 0x48, 0x00, 0x4F, 0x91, 0x00, 0x03, 0x82, 0x00,
+    0x07, 0x7A, 0x97, 0x97, 0x98, 0x51, 0x9B, 0x7F, 0x9B, 0x83, 0x3A, 0x01, 0x9B, 0x97, 0x81, 0x9B,
+    0x83, 0x97, 0x33, 0x8F, 0x98, 0x04, 0x7B, 0x5D, 0x5D, 0x28, 0x00, 0x3D, 0x27, 0x5F, 0x87, 0x53,
+    0x22, 0x02, 0x7E, 0x16, 0x79, 0x30, 0x61, 0x1F, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x04, 0x60, 0x1F, 0x00, 0x00, 0x02, 0x0A, 0x5F, 0x25, 0x89, 0x57, 0x99, 0x70, 0x57, 0x6C,
+    0x0C, 0x95, 0x70, 0x95, 0x25, 0x44, 0x7A, 0x83, 0x00, 0x03, 0x07, 0x75, 0x02, 0x07, 0x82, 0x00,
+    0x04, 0x02, 0x34, 0x00, 0x56, 0x6E, 0x96, 0x00, 0x01, 0x02, 0x01, 0x87, 0x00, 0x8F, 0x00, 0x36,
+    0x22, 0x3F, 0x03, 0x04, 0x00, 0x00, 0x04, 0x03, 0x01, 0x71, 0x5B, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x7A, 0x4E, 0x59, 0x7F, 0x7A, 0x7F, 0x88, 0x7A, 0x92, 0x75, 0x91, 0x03, 0x62,
+    0x48, 0x00, 0x34, 0x18, 0x3F, 0x16, 0x2D, 0x61, 0x3F, 0x00, 0x49, 0x75, 0x00, 0x29, 0x36, 0x09,
+    0x23, 0x36, 0x23, 0x51, 0x00, 0x02, 0x04, 0x8B, 0x00, 0x03, 0x01, 0x11, 0x2A, 0x02, 0x83, 0x00,
+    0x81, 0x02, 0x82, 0x00, 0x01, 0x48, 0x01, 0x86, 0x00, 0x0A, 0x01, 0x00, 0x07, 0x00, 0x01, 0x07,
+    0x00, 0x16, 0x25, 0x4F, 0x01, 0x82, 0x00, 0x06, 0x9E, 0x97, 0x8F, 0x00, 0x34, 0x9B, 0x3A, 0x83,
+    0x9B, 0x81, 0x97, 0x81, 0x9B, 0x84, 0x97, 0x18, 0x88, 0x28, 0x98, 0x28, 0x28, 0x98, 0x5D, 0x34,
+    0x00, 0x79, 0x11, 0x68, 0x5F, 0x00, 0x01, 0x30, 0x07, 0x7E, 0x18, 0x30, 0x16, 0x1F, 0x5D, 0x00,
+    0x04, 0x84, 0x00, 0x16, 0x02, 0x03, 0x48, 0x0A, 0x0A, 0x62, 0x08, 0x03, 0x01, 0x05, 0x56, 0x3F,
+    0x44, 0x44, 0x6C, 0x77, 0x4E, 0x42, 0x57, 0x60, 0x61, 0x44, 0x25, 0x84, 0x00, 0x09, 0x22, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0x60, 0x1F, 0x52, 0x47, 0x94, 0x00, 0x82, 0x01, 0x06, 0x06, 0x01, 0x01,
+    0x00, 0x01, 0x02, 0x01, 0x81, 0x02, 0x8F, 0x00, 0x02, 0x04, 0x30, 0x18, 0x83, 0x00, 0x2F, 0x01,
+    0x00, 0x07, 0x2E, 0x13, 0x00, 0x04, 0x01, 0x00, 0x00, 0x34, 0x7A, 0x7F, 0x7F, 0x59, 0x74, 0x88,
+    0x7F, 0x16, 0x4F, 0x13, 0x01, 0x05, 0x02, 0x0A, 0x06, 0x02, 0x02, 0x3F, 0x16, 0x8B, 0x99, 0x16,
+    0x00, 0x02, 0x07, 0x00, 0x3F, 0x99, 0x77, 0x39, 0x61, 0x0C, 0x70, 0x43, 0x18, 0x02, 0x04, 0x8C,
+    0x00, 0x11, 0xA1, 0x82, 0x22, 0x00, 0x04, 0x07, 0x07, 0x01, 0x06, 0x00, 0x00, 0x22, 0x08, 0x02,
+    0x00, 0x00, 0x01, 0x02, 0x85, 0x00, 0x14, 0x07, 0x0A, 0x00, 0x02, 0x00, 0x18, 0x1A, 0x02, 0x00,
+    0x7B, 0x28, 0x97, 0x9E, 0x5D, 0x01, 0x00, 0x88, 0x9B, 0x9B, 0x3A, 0x9B, 0x83, 0x97, 0x80, 0x9B,
+    0x84, 0x97, 0x82, 0x8F, 0x81, 0x28, 0x31, 0x98, 0x00, 0x00, 0x04, 0x02, 0x26, 0x26, 0x52, 0x11,
+    0x6E, 0x16, 0x91, 0x52, 0x79, 0x27, 0x30, 0x6E, 0x29, 0x1A, 0x45, 0x00, 0x04, 0x00, 0x00, 0x06,
+    0x86, 0x86, 0x01, 0x03, 0x03, 0x3C, 0x87, 0x4F, 0x37, 0x0B, 0x08, 0x01, 0x30, 0xA0, 0x0C, 0x77,
+    0x61, 0x95, 0x61, 0x16, 0x1A, 0x44, 0x44, 0x2D, 0x7B, 0x82, 0x00, 0x08, 0x04, 0x02, 0x01, 0x00,
+    0x02, 0x00, 0x16, 0x52, 0x26, 0x94, 0x00, 0x01, 0x01, 0x22, 0x82, 0x03, 0x81, 0x06, 0x81, 0x01,
+    0x82, 0x06, 0x80, 0x02, 0x8F, 0x00, 0x03, 0x04, 0x1A, 0x7E, 0x02, 0x85, 0x00, 0x01, 0x92, 0x5C,
+    0x84, 0x00, 0x81, 0x88, 0x81, 0x7F, 0x21, 0x59, 0x7A, 0x88, 0x74, 0x1F, 0x01, 0x02, 0x00, 0x4F,
+    0x2D, 0x05, 0x01, 0x02, 0x6E, 0x29, 0x6C, 0x99, 0xA3, 0x18, 0x00, 0x28, 0x1A, 0x52, 0x09, 0x77,
+    0x70, 0x36, 0x2D, 0x1B, 0x99, 0x4A, 0x7F, 0x98, 0x04, 0x8D, 0x00, 0x01, 0x04, 0x01, 0x83, 0x00,
+    0x05, 0x02, 0x05, 0x03, 0x00, 0x05, 0x1C, 0x82, 0x00, 0x19, 0x01, 0x06, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x4F, 0x62, 0x00, 0x02, 0x04, 0x00, 0x03, 0x00, 0x00, 0x75, 0x8F, 0x97, 0x98, 0x00,
+    0x5D, 0x00, 0x7A, 0x3A, 0x83, 0x9B, 0x01, 0x97, 0x9B, 0x85, 0x97, 0x19, 0x9E, 0x97, 0x28, 0x8F,
+    0x28, 0x75, 0x01, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x00, 0x53, 0x83, 0x26, 0x53, 0x60, 0x52,
+    0x5F, 0x6A, 0x29, 0x35, 0x24, 0x2D, 0x82, 0x00, 0x1B, 0x02, 0x00, 0x18, 0x52, 0x05, 0x86, 0x05,
+    0x96, 0x47, 0x32, 0x0B, 0x32, 0x79, 0x42, 0x6E, 0x47, 0x16, 0x44, 0x89, 0x74, 0x6C, 0x95, 0x00,
+    0x61, 0x44, 0x6C, 0x2D, 0x7B, 0x83, 0x00, 0x06, 0x01, 0x00, 0x9F, 0x00, 0x86, 0x6A, 0x05, 0x8E,
+    0x00, 0x82, 0x02, 0x06, 0x01, 0x00, 0x00, 0x07, 0x05, 0x3D, 0x0A, 0x83, 0x05, 0x82, 0x03, 0x81,
+    0x06, 0x81, 0x02, 0x8F, 0x00, 0x01, 0x25, 0x47, 0x85, 0x00, 0x02, 0x07, 0x58, 0x02, 0x82, 0x00,
+    0x1B, 0x28, 0x88, 0x88, 0x7F, 0x7F, 0x4E, 0x28, 0x88, 0x88, 0x7B, 0x00, 0x7B, 0x04, 0x56, 0x25,
+    0x02, 0x00, 0x56, 0x29, 0x2D, 0x99, 0x6C, 0x1F, 0x00, 0x00, 0x07, 0x60, 0x44, 0x82, 0x70, 0x04,
+    0x4A, 0x3F, 0x42, 0x2D, 0x25, 0x82, 0x8F, 0x80, 0x01, 0x8A, 0x00, 0x0C, 0x01, 0x04, 0x00, 0x00,
+    0x02, 0x03, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x37, 0x83, 0x00, 0x81, 0x03, 0x09, 0x02, 0x00,
+    0x02, 0x87, 0x01, 0x07, 0x0A, 0x00, 0x51, 0x04, 0x84, 0x00, 0x80, 0x02, 0x81, 0x8F, 0x83, 0x00,
+    0x80, 0x51, 0x82, 0x9B, 0x80, 0x3A, 0x82, 0x9B, 0x01, 0x97, 0x9B, 0x81, 0x97, 0x83, 0x9E, 0x05,
+    0x7A, 0x8F, 0x9E, 0x98, 0x7B, 0x5D, 0x85, 0x00, 0x2A, 0x49, 0x55, 0x26, 0x19, 0x29, 0x2B, 0x56,
+    0x52, 0x1C, 0x41, 0x26, 0x53, 0x30, 0x19, 0x41, 0x03, 0x60, 0x1A, 0x4F, 0x01, 0x08, 0x56, 0x37,
+    0x13, 0x0B, 0x47, 0x3D, 0x2A, 0x53, 0x02, 0x02, 0x06, 0x1F, 0x44, 0x74, 0x61, 0x57, 0x7A, 0x51,
+    0x2D, 0x61, 0x89, 0x60, 0x84, 0x00, 0x0A, 0x01, 0x00, 0x07, 0x26, 0xA1, 0x75, 0x00, 0x00, 0x04,
+    0x45, 0x60, 0x88, 0x00, 0x85, 0x01, 0x03, 0x00, 0x03, 0x1C, 0x96, 0x81, 0x08, 0x82, 0x1C, 0x81,
+    0x3D, 0x82, 0x05, 0x81, 0x01, 0x80, 0x02, 0x8E, 0x00, 0x01, 0x1F, 0x25, 0x83, 0x00, 0x0A, 0x04,
+    0x1C, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7B, 0x7A, 0x88, 0x82, 0x7F, 0x02, 0x60, 0x7F, 0x7A,
+    0x82, 0x00, 0x01, 0x04, 0x02, 0x82, 0x00, 0x16, 0x29, 0x4E, 0x8D, 0x61, 0x95, 0x4F, 0x79, 0x00,
+    0x28, 0x25, 0x70, 0x70, 0x77, 0x70, 0x77, 0x1A, 0x5D, 0x3C, 0x59, 0x8F, 0x9E, 0x98, 0x01, 0x87,
+    0x00, 0x0F, 0x01, 0x00, 0x22, 0x02, 0x00, 0x01, 0x06, 0x03, 0x06, 0x9F, 0x5D, 0x22, 0x01, 0x00,
+    0x3D, 0x6A, 0x82, 0x00, 0x0C, 0x01, 0x03, 0x06, 0x00, 0x00, 0x03, 0x06, 0x00, 0x75, 0x01, 0x45,
+    0x2D, 0x01, 0x84, 0x00, 0x08, 0x04, 0x98, 0x5D, 0x04, 0x00, 0x00, 0x03, 0x91, 0x7F, 0x81, 0x3A,
+    0x83, 0x9B, 0x83, 0x97, 0x81, 0x9E, 0x3A, 0x97, 0x9E, 0x8F, 0x28, 0x8F, 0x8F, 0x7B, 0x98, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x91, 0x52, 0x4B, 0x53, 0x35, 0x37, 0xA1, 0x79, 0x79,
+    0x02, 0x3C, 0x80, 0x7E, 0x89, 0x77, 0x77, 0x39, 0x23, 0x1A, 0x02, 0x3C, 0x58, 0x62, 0x03, 0x35,
+    0x35, 0x96, 0x00, 0x5D, 0x3D, 0x03, 0x74, 0x3F, 0x74, 0x77, 0x61, 0x01, 0x2D, 0x89, 0x95, 0x00,
+    0x7A, 0x5D, 0x84, 0x00, 0x06, 0x63, 0x6A, 0x3C, 0x00, 0x00, 0x04, 0x1C, 0x81, 0x63, 0x88, 0x00,
+    0x80, 0x02, 0x82, 0x06, 0x0F, 0x03, 0x01, 0x00, 0x03, 0x08, 0x3B, 0x3B, 0x3C, 0x3C, 0x96, 0x96,
+    0x86, 0x1C, 0x3D, 0x3D, 0x1C, 0x81, 0x03, 0x82, 0x01, 0x8A, 0x00, 0x0A, 0x02, 0x04, 0x00, 0x16,
+    0x1A, 0x00, 0x01, 0x00, 0x00, 0x75, 0x02, 0x82, 0x00, 0x2E, 0x96, 0x22, 0x00, 0x28, 0x88, 0x74,
+    0x7F, 0x74, 0x60, 0x7F, 0x28, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x34, 0x00, 0x90, 0x16, 0x57, 0x61,
+    0x61, 0x7A, 0xA1, 0x4B, 0x18, 0x16, 0x61, 0x09, 0x57, 0x77, 0x99, 0x29, 0x8F, 0x97, 0x5F, 0x57,
+    0x57, 0x4E, 0x04, 0x45, 0x1C, 0x00, 0x02, 0x1A, 0x2D, 0x82, 0x00, 0x0F, 0x02, 0x00, 0x00, 0x02,
+    0x5D, 0x01, 0x01, 0x03, 0x48, 0x01, 0x02, 0x03, 0x07, 0x00, 0x00, 0x03, 0x83, 0x00, 0x81, 0x01,
+    0x81, 0x00, 0x09, 0x01, 0x22, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0x07, 0x82, 0x00, 0x0E,
+    0x01, 0x04, 0x00, 0x04, 0x00, 0x07, 0x03, 0x06, 0x74, 0x3A, 0x9B, 0x7F, 0x3A, 0x9B, 0x7F, 0x81,
+    0x97, 0x81, 0x9E, 0x82, 0x97, 0x81, 0x9E, 0x05, 0x98, 0x28, 0x8F, 0x5D, 0x98, 0x5D, 0x86, 0x00,
+    0x0D, 0x01, 0x00, 0x5F, 0x63, 0x68, 0x68, 0x29, 0x47, 0x01, 0x00, 0x00, 0x95, 0x70, 0x99, 0x82,
+    0x77, 0x08, 0x09, 0x99, 0x42, 0x00, 0x04, 0x00, 0x2B, 0x7C, 0x37, 0x83, 0x00, 0x81, 0x08, 0x0A,
+    0x95, 0x7A, 0x44, 0x44, 0x7B, 0x95, 0x61, 0x00, 0x74, 0x7A, 0x7B, 0x83, 0x00, 0x03, 0x01, 0x56,
+    0x26, 0x03, 0x82, 0x00, 0x81, 0x63, 0x80, 0x49, 0x88, 0x00, 0x0C, 0x01, 0x03, 0x03, 0x48, 0x03,
+    0x01, 0x00, 0x49, 0x3C, 0x3B, 0x85, 0x85, 0x3B, 0x82, 0x3C, 0x03, 0x08, 0x3D, 0x3D, 0x86, 0x82,
+    0x91, 0x02, 0x03, 0x07, 0x04, 0x89, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x02, 0x26, 0x4F, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x04, 0x00, 0x03, 0x82, 0x00, 0x2C, 0x07, 0x7A, 0x88, 0x74, 0x88, 0x60, 0x7F,
+    0x28, 0x00, 0x91, 0x35, 0xA0, 0x04, 0x00, 0x07, 0xA1, 0x89, 0x61, 0x61, 0x89, 0x04, 0x5D, 0x02,
+    0x95, 0x28, 0x1F, 0x6C, 0x99, 0x99, 0x61, 0x00, 0x98, 0x98, 0x1A, 0x70, 0x89, 0x04, 0x7A, 0x63,
+    0x02, 0x1A, 0x29, 0x1C, 0x1F, 0x02, 0x82, 0x00, 0x0E, 0x34, 0x00, 0x04, 0x00, 0x00, 0x06, 0x01,
+    0x01, 0x07, 0x06, 0x03, 0x04, 0x04, 0x22, 0x02, 0x84, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x01, 0x00,
+    0x02, 0x07, 0x00, 0x02, 0x00, 0x75, 0x82, 0x82, 0x00, 0x11, 0x07, 0x00, 0x04, 0x9F, 0x5D, 0x02,
+    0x03, 0x0A, 0x3B, 0x7A, 0x3A, 0x7F, 0x9B, 0x9B, 0x74, 0x7A, 0x7A, 0x51, 0x84, 0x9E, 0x81, 0x8F,
+    0x80, 0x28, 0x82, 0x98, 0x81, 0x7B, 0x82, 0x00, 0x80, 0x04, 0x86, 0x00, 0x0B, 0x01, 0x56, 0x2B,
+    0x07, 0x8F, 0x74, 0x61, 0x44, 0x2D, 0x77, 0x94, 0x70, 0x82, 0x77, 0x25, 0x99, 0x89, 0x00, 0x01,
+    0x6E, 0x16, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x0B, 0x60, 0x51, 0x6C, 0x44, 0x51, 0x5D, 0x7B,
+    0x95, 0x2D, 0x28, 0x5D, 0x28, 0x7B, 0x00, 0x00, 0x01, 0x56, 0x08, 0x04, 0x00, 0x00, 0x45, 0x63,
+    0x63, 0x01, 0x87, 0x00, 0x14, 0x01, 0x03, 0x03, 0x05, 0x3D, 0x05, 0x01, 0x02, 0x49, 0x85, 0x32,
+    0x92, 0x85, 0x47, 0x85, 0x47, 0x47, 0x3C, 0x08, 0x08, 0x3C, 0x83, 0x05, 0x01, 0x03, 0x02, 0x8D,
+    0x00, 0x03, 0x01, 0x60, 0x4F, 0x02, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x28, 0x51, 0x7A, 0x88,
+    0x88, 0x51, 0x7F, 0x98, 0x96, 0x26, 0x7E, 0x24, 0x30, 0x7B, 0x05, 0x95, 0x89, 0x4E, 0x57, 0x29,
+    0x00, 0x00, 0x86, 0x4E, 0x7B, 0x3F, 0x16, 0x3F, 0x44, 0x51, 0x5D, 0x8F, 0x91, 0x2D, 0x70, 0x28,
+    0x98, 0x60, 0x05, 0x25, 0x1F, 0x34, 0x8B, 0x00, 0x81, 0x02, 0x06, 0x04, 0x01, 0x06, 0x00, 0x00,
+    0x03, 0x01, 0x86, 0x00, 0x02, 0x1C, 0x52, 0x1A, 0x84, 0x00, 0x01, 0x8C, 0x18, 0x82, 0x04, 0x16,
+    0x02, 0x03, 0x01, 0x03, 0x03, 0x06, 0x45, 0x87, 0x06, 0x63, 0x7F, 0x88, 0x7F, 0x5F, 0x56, 0x87,
+    0x05, 0x88, 0x9E, 0x88, 0x9E, 0x9E, 0x88, 0x82, 0x8F, 0x04, 0x28, 0x98, 0x28, 0x7B, 0x98, 0x84,
+    0x00, 0x17, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x22, 0x22, 0x01, 0x8F, 0x97, 0x61, 0x57,
+    0x44, 0x4E, 0x77, 0x99, 0x0C, 0x6C, 0x8D, 0x77, 0x70, 0x74, 0x84, 0x00, 0x15, 0x07, 0x1A, 0x02,
+    0x00, 0x0A, 0x92, 0x00, 0x61, 0x44, 0x51, 0x04, 0x28, 0x69, 0x2D, 0x51, 0x7B, 0x7A, 0x60, 0x49,
+    0x00, 0x86, 0x79, 0x82, 0x00, 0x03, 0x03, 0x45, 0x4F, 0x06, 0x87, 0x00, 0x0D, 0x02, 0x01, 0x06,
+    0x03, 0x3D, 0x0A, 0x1C, 0x07, 0x00, 0x0A, 0x58, 0x47, 0x47, 0x8A, 0x83, 0x47, 0x03, 0x85, 0x3C,
+    0x3B, 0x85, 0x83, 0x0A, 0x03, 0x05, 0x01, 0x02, 0x01, 0x8C, 0x00, 0x05, 0x01, 0x45, 0x86, 0x00,
+    0x00, 0x07, 0x87, 0x00, 0x29, 0x51, 0x88, 0x88, 0x51, 0x88, 0x51, 0x26, 0x01, 0x9F, 0x37, 0x30,
+    0x16, 0x01, 0x2D, 0x4E, 0x44, 0x44, 0x49, 0x00, 0x34, 0x52, 0x25, 0x5D, 0x89, 0x57, 0x2D, 0x60,
+    0x00, 0x28, 0x9E, 0x8F, 0x6D, 0x2D, 0x98, 0x28, 0x00, 0x52, 0x3F, 0x00, 0x00, 0x02, 0x75, 0x86,
+    0x00, 0x02, 0x04, 0x00, 0x04, 0x82, 0x00, 0x04, 0x01, 0x9F, 0x00, 0x07, 0x03, 0x86, 0x00, 0x04,
+    0x56, 0x42, 0x42, 0x6C, 0x16, 0x82, 0x00, 0x28, 0x22, 0x80, 0x22, 0x00, 0x00, 0x04, 0x02, 0x01,
+    0x05, 0x3D, 0x05, 0x58, 0x96, 0x91, 0x4F, 0x26, 0x3B, 0x88, 0x5F, 0x3B, 0x05, 0x05, 0x7A, 0x9E,
+    0x7A, 0x8F, 0x9E, 0x88, 0x8F, 0x9E, 0x9E, 0x8F, 0x28, 0x98, 0x98, 0x5D, 0x34, 0x00, 0x00, 0x45,
+    0x51, 0x83, 0x00, 0x2F, 0x01, 0x34, 0x02, 0xA0, 0x3F, 0x30, 0x7A, 0x00, 0x4E, 0x59, 0x69, 0x8D,
+    0x6C, 0x29, 0x99, 0x44, 0x2D, 0x70, 0x8D, 0x77, 0x57, 0x16, 0x00, 0x01, 0x00, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x9F, 0x58, 0x04, 0x4E, 0x44, 0x7B, 0x7B, 0x7A, 0x95, 0x61, 0x7B, 0x60, 0x7A, 0x18,
+    0x7A, 0x1F, 0x52, 0x3C, 0x82, 0x00, 0x03, 0x3D, 0x63, 0x45, 0x01, 0x87, 0x00, 0x09, 0x02, 0x06,
+    0x03, 0x91, 0x1C, 0x0A, 0x08, 0x22, 0x02, 0x08, 0x81, 0x47, 0x83, 0x37, 0x01, 0x8A, 0x47, 0x83,
+    0x85, 0x05, 0x1C, 0x86, 0x1C, 0x0A, 0x3D, 0x03, 0x81, 0x01, 0x8D, 0x00, 0x03, 0x01, 0x45, 0x60,
+    0x04, 0x84, 0x00, 0x2D, 0x04, 0x00, 0x04, 0x00, 0x00, 0x28, 0x7A, 0x51, 0x88, 0x1F, 0x3D, 0x00,
+    0x00, 0x03, 0x63, 0x01, 0x16, 0x4E, 0x61, 0x44, 0x4E, 0x00, 0x04, 0x00, 0x30, 0x16, 0x02, 0x61,
+    0x44, 0x89, 0x49, 0x00, 0x42, 0x3F, 0x7F, 0x9E, 0x98, 0x98, 0x04, 0x1F, 0x29, 0x04, 0x00, 0x01,
+    0x02, 0x01, 0x82, 0x00, 0x0F, 0x02, 0x00, 0x9F, 0x01, 0x5D, 0x00, 0x9F, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x02, 0x05, 0x05, 0x02, 0x84, 0x00, 0x21, 0x45, 0x2D, 0x29, 0x7E, 0x7E, 0x2D, 0x51, 0x00,
+    0x00, 0x85, 0x79, 0x00, 0x00, 0x02, 0x07, 0x02, 0x03, 0x0A, 0x08, 0x3C, 0x87, 0x92, 0x79, 0x2B,
+    0xA1, 0x63, 0x1F, 0x4F, 0x08, 0x48, 0x60, 0x9E, 0x7A, 0x60, 0x82, 0x28, 0x0A, 0x51, 0x28, 0x28,
+    0x98, 0x22, 0x00, 0x34, 0x00, 0x00, 0x01, 0x07, 0x82, 0x00, 0x1B, 0x04, 0x02, 0x51, 0x30, 0x6B,
+    0x0A, 0x2B, 0x9D, 0x90, 0x4F, 0x08, 0x35, 0x11, 0x9E, 0x46, 0x09, 0x61, 0x25, 0x57, 0x2D, 0x89,
+    0x57, 0x70, 0x0C, 0x0C, 0x1F, 0x00, 0x01, 0x85, 0x00, 0x16, 0x08, 0x03, 0x16, 0x88, 0x02, 0x74,
+    0x69, 0x7A, 0x74, 0x5D, 0x28, 0x60, 0x28, 0x28, 0x16, 0x60, 0x18, 0x00, 0x00, 0x06, 0xA1, 0x85,
+    0x22, 0x88, 0x00, 0x0A, 0x01, 0x03, 0x03, 0x91, 0x1C, 0x1C, 0x3C, 0x75, 0x01, 0x3C, 0x8A, 0x86,
+    0x37, 0x01, 0x47, 0x85, 0x81, 0x47, 0x02, 0x1C, 0x86, 0x1C, 0x82, 0x3D, 0x81, 0x03, 0x8F, 0x00,
+    0x04, 0x49, 0x63, 0x03, 0x00, 0x01, 0x87, 0x00, 0x81, 0x7B, 0x01, 0x7A, 0x4F, 0x85, 0x00, 0x2A,
+    0x74, 0x4E, 0x6C, 0x44, 0x16, 0x00, 0x00, 0x60, 0x20, 0x60, 0x7B, 0x61, 0x95, 0x28, 0x00, 0x1A,
+    0x23, 0x57, 0x36, 0x25, 0x02, 0x00, 0x63, 0x3F, 0x08, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x02, 0x07, 0x48, 0x48, 0x62, 0x0A, 0x3B, 0x96, 0x0A, 0x60, 0x84, 0x00, 0x26, 0x34, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x29, 0x29, 0x82, 0x6E, 0x35, 0x30, 0x16, 0x00, 0x01, 0x80, 0x49, 0x00,
+    0x00, 0x22, 0x01, 0x02, 0x62, 0x0A, 0x08, 0x45, 0x08, 0x15, 0x50, 0x55, 0x88, 0x88, 0x13, 0x3D,
+    0x06, 0x05, 0x7A, 0x88, 0x28, 0x82, 0x88, 0x02, 0x28, 0x45, 0x04, 0x84, 0x00, 0x21, 0x01, 0x02,
+    0x00, 0x07, 0x00, 0x5D, 0x00, 0x00, 0x5F, 0x18, 0x60, 0x0D, 0x55, 0x05, 0x13, 0x03, 0x0A, 0x0D,
+    0x05, 0x65, 0x0F, 0x9E, 0x43, 0x99, 0x16, 0x25, 0x4E, 0x0C, 0x61, 0x0C, 0x89, 0x0C, 0x6C, 0x7B,
+    0x84, 0x00, 0x17, 0x01, 0x00, 0x03, 0x37, 0x00, 0x28, 0x1C, 0x7F, 0x46, 0x74, 0x28, 0x22, 0x28,
+    0x28, 0x7A, 0x51, 0x9F, 0x00, 0x49, 0x60, 0x01, 0x3C, 0x16, 0x56, 0x88, 0x00, 0x0B, 0x01, 0x06,
+    0x03, 0x03, 0x3D, 0x1C, 0x1C, 0x3C, 0x49, 0x01, 0x3C, 0x8A, 0x84, 0x37, 0x05, 0x90, 0x37, 0x47,
+    0x85, 0x47, 0x37, 0x07, 0x1C, 0x86, 0x1C, 0x3D, 0x1C, 0x1C, 0x05, 0x03, 0x8F, 0x00, 0x04, 0x04,
+    0x07, 0x1C, 0x1A, 0x18, 0x88, 0x00, 0x02, 0x07, 0x7B, 0x02, 0x82, 0x00, 0x21, 0x01, 0x00, 0x28,
+    0x88, 0x4E, 0x89, 0x46, 0x49, 0x00, 0x00, 0x4F, 0x11, 0x63, 0x00, 0x4E, 0x1A, 0x00, 0x00, 0x25,
+    0x57, 0x70, 0x44, 0x28, 0x00, 0x62, 0x35, 0x3B, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x82,
+    0x00, 0x0C, 0x01, 0x03, 0x01, 0x05, 0x92, 0x7A, 0x28, 0x65, 0x2A, 0x62, 0x02, 0x06, 0x02, 0x86,
+    0x00, 0x4F, 0x16, 0x5F, 0x2B, 0x6E, 0x6E, 0x30, 0x16, 0x02, 0x45, 0x68, 0x04, 0x00, 0x00, 0x01,
+    0x02, 0x06, 0x08, 0x08, 0x3C, 0x1C, 0x0A, 0x41, 0x92, 0x9E, 0x9E, 0x45, 0x48, 0x01, 0x75, 0x4F,
+    0x88, 0x28, 0x28, 0x7A, 0x28, 0x7B, 0x01, 0x03, 0x01, 0x01, 0x03, 0x75, 0x03, 0x91, 0x49, 0x01,
+    0x3B, 0x90, 0x01, 0x03, 0x05, 0x0A, 0x85, 0x32, 0x01, 0x75, 0x0D, 0x55, 0x01, 0x34, 0x54, 0x6B,
+    0x41, 0x47, 0x2E, 0x2B, 0x9E, 0x36, 0x44, 0x0A, 0x29, 0x57, 0x0C, 0x23, 0x61, 0x2D, 0x0C, 0x95,
+    0x00, 0x01, 0x82, 0x00, 0x81, 0x18, 0x0D, 0x02, 0x58, 0x07, 0x7B, 0x51, 0x59, 0x4E, 0x88, 0x28,
+    0x04, 0x7A, 0x7A, 0x51, 0x01, 0x82, 0x00, 0x04, 0x07, 0x02, 0x63, 0x4F, 0x03, 0x88, 0x00, 0x0A,
+    0x02, 0x03, 0x48, 0x3D, 0x3D, 0x1C, 0x08, 0x3C, 0x03, 0x01, 0x85, 0x82, 0x37, 0x08, 0x90, 0x37,
+    0x90, 0x9A, 0x37, 0x37, 0x47, 0x47, 0x37, 0x08, 0x86, 0x3C, 0x86, 0x1C, 0x86, 0x86, 0x0A, 0x05,
+    0x02, 0x91, 0x00, 0x01, 0x49, 0x45, 0x88, 0x00, 0x03, 0x04, 0x00, 0x00, 0x01, 0x82, 0x04, 0x02,
+    0x5D, 0x7A, 0x74, 0x82, 0x4E, 0x1D, 0x01, 0x00, 0x7B, 0x51, 0x30, 0x52, 0x00, 0x88, 0x28, 0x00,
+    0x5D, 0x23, 0x57, 0x77, 0x25, 0x7F, 0x51, 0x29, 0x95, 0x00, 0x7B, 0x22, 0x00, 0x00, 0x6E, 0x30,
+    0x02, 0x00, 0x00, 0x5D, 0x82, 0x03, 0x80, 0x87, 0x82, 0x28, 0x05, 0x92, 0x48, 0x62, 0x02, 0x02,
+    0x9F, 0x82, 0x00, 0x80, 0x07, 0x82, 0x00, 0x26, 0x16, 0x29, 0x82, 0x7E, 0x53, 0x30, 0x1F, 0x00,
+    0x79, 0xA1, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0x05, 0x3C, 0x3D, 0x05, 0x37, 0x3B, 0x60, 0x88,
+    0x28, 0x07, 0x75, 0x01, 0x01, 0x28, 0x88, 0x28, 0x7A, 0x51, 0x03, 0x3B, 0x90, 0x90, 0x37, 0x83,
+    0x05, 0x22, 0x9F, 0x03, 0x05, 0x29, 0x53, 0x58, 0x13, 0x08, 0x90, 0x32, 0x01, 0x13, 0x07, 0x9A,
+    0x73, 0x96, 0x18, 0x61, 0x60, 0x3B, 0x0D, 0x55, 0x5A, 0x88, 0x9B, 0x44, 0x28, 0x4F, 0x6C, 0x57,
+    0x0C, 0x61, 0x4E, 0x89, 0x61, 0x85, 0x00, 0x0C, 0x07, 0x02, 0x3B, 0x91, 0x00, 0x7A, 0x59, 0x7A,
+    0x74, 0x28, 0x51, 0x7A, 0x51, 0x83, 0x00, 0x04, 0x04, 0x00, 0x86, 0x45, 0x02, 0x89, 0x00, 0x0D,
+    0x06, 0x05, 0x3D, 0x3D, 0x1C, 0x1C, 0x08, 0x08, 0x03, 0x03, 0x85, 0x92, 0x90, 0x37, 0x82, 0x90,
+    0x05, 0x9A, 0x90, 0x37, 0x47, 0x47, 0x37, 0x08, 0x86, 0x3C, 0x86, 0x1C, 0x86, 0x1C, 0x0A, 0x3D,
+    0x01, 0x82, 0x00, 0x81, 0x02, 0x9A, 0x00, 0x36, 0x49, 0x51, 0x00, 0x00, 0x7B, 0x28, 0x4E, 0x7F,
+    0x4E, 0x74, 0x00, 0x00, 0x88, 0x28, 0x6E, 0x16, 0x00, 0x7B, 0x00, 0x00, 0x60, 0x44, 0x57, 0x6C,
+    0x74, 0x61, 0x5F, 0x30, 0x00, 0x06, 0x03, 0x01, 0x00, 0x63, 0x3E, 0x27, 0x00, 0x00, 0x04, 0x62,
+    0x03, 0x62, 0x3B, 0x28, 0x56, 0x1F, 0x28, 0x05, 0x87, 0x87, 0x03, 0x85, 0x05, 0x00, 0x02, 0x84,
+    0x00, 0x4E, 0x45, 0x42, 0x5F, 0x56, 0x30, 0x95, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x01, 0x02,
+    0x01, 0x01, 0x02, 0x48, 0x05, 0x37, 0x37, 0x62, 0x05, 0x13, 0x05, 0x04, 0x02, 0x9F, 0x91, 0x7A,
+    0x28, 0x51, 0x02, 0x3B, 0x90, 0x41, 0x15, 0x6B, 0x8A, 0x0A, 0x03, 0x03, 0x22, 0x07, 0x03, 0x9A,
+    0x26, 0x6A, 0x0D, 0x4C, 0x3B, 0x13, 0x5A, 0x1C, 0x03, 0x52, 0x23, 0x02, 0x3C, 0x08, 0x68, 0x49,
+    0x06, 0x5F, 0x6E, 0x92, 0x6B, 0x8F, 0x6F, 0x4E, 0x02, 0x16, 0xA0, 0x6C, 0x6C, 0x61, 0x4E, 0x2D,
+    0x5D, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00, 0x0A, 0x3C, 0x07, 0x00, 0x74, 0x88, 0x88, 0x74, 0x22,
+    0x28, 0x7B, 0x04, 0x84, 0x00, 0x02, 0x3D, 0x63, 0x75, 0x89, 0x00, 0x03, 0x01, 0x03, 0x62, 0x05,
+    0x82, 0x1C, 0x81, 0x08, 0x81, 0x03, 0x80, 0x47, 0x82, 0x90, 0x08, 0x9A, 0x90, 0x90, 0x9A, 0x9A,
+    0x37, 0x47, 0x47, 0x37, 0x08, 0x96, 0x86, 0x86, 0x1C, 0x1C, 0x0A, 0x05, 0x3D, 0x06, 0x82, 0x00,
+    0x81, 0x02, 0x99, 0x00, 0x2B, 0x04, 0x95, 0x51, 0x04, 0x5D, 0x98, 0x98, 0x74, 0x4E, 0x7F, 0x16,
+    0x00, 0x00, 0x74, 0x28, 0x56, 0x52, 0x00, 0x04, 0x00, 0x85, 0x63, 0x6C, 0x57, 0x4E, 0x61, 0x25,
+    0x64, 0x7B, 0x04, 0x05, 0x01, 0x5F, 0x22, 0x0A, 0x2B, 0x13, 0x00, 0x00, 0x13, 0x85, 0x06, 0x03,
+    0x3C, 0x83, 0x28, 0x07, 0x01, 0x62, 0x0A, 0x05, 0x58, 0x0A, 0x01, 0x47, 0x85, 0x00, 0x07, 0x1A,
+    0x2D, 0x30, 0x7E, 0x45, 0x00, 0x07, 0x80, 0x82, 0x00, 0x41, 0x01, 0x03, 0x03, 0x01, 0x04, 0x03,
+    0x4F, 0x85, 0x62, 0x91, 0x98, 0x98, 0x7B, 0x02, 0x01, 0x06, 0x9F, 0x7A, 0x7B, 0x00, 0x92, 0x92,
+    0x0B, 0x58, 0x8A, 0x55, 0x62, 0x03, 0x07, 0x01, 0x00, 0x1A, 0x1A, 0x05, 0x0D, 0x65, 0x4B, 0x8C,
+    0x32, 0x00, 0x92, 0x40, 0x04, 0x90, 0x53, 0x05, 0x96, 0x47, 0x96, 0x82, 0x02, 0x22, 0x03, 0x4F,
+    0x32, 0x98, 0x9E, 0x46, 0x0A, 0x86, 0x25, 0x89, 0x89, 0x6C, 0x74, 0x28, 0x83, 0x00, 0x80, 0x02,
+    0x82, 0x00, 0x08, 0x08, 0x00, 0x07, 0x7A, 0x88, 0x7F, 0x7A, 0x00, 0x34, 0x85, 0x00, 0x02, 0x75,
+    0x56, 0x05, 0x8A, 0x00, 0x10, 0x02, 0x03, 0x05, 0x48, 0x3D, 0x1C, 0x0A, 0x0A, 0x08, 0x05, 0x03,
+    0x37, 0x9A, 0x9A, 0x90, 0x9A, 0x90, 0x82, 0x9A, 0x03, 0x37, 0x47, 0x47, 0x37, 0x81, 0x86, 0x82,
+    0x1C, 0x82, 0x0A, 0x80, 0x03, 0x82, 0x00, 0x02, 0x02, 0x01, 0x02, 0x98, 0x00, 0x40, 0x18, 0x16,
+    0x00, 0x00, 0x34, 0x7B, 0x98, 0x88, 0x74, 0x7F, 0x7A, 0x04, 0x00, 0x74, 0x74, 0x22, 0x22, 0x00,
+    0x00, 0x07, 0x40, 0x4F, 0x44, 0x89, 0x95, 0x4E, 0x6E, 0x26, 0x00, 0x05, 0x03, 0x01, 0x31, 0x16,
+    0x01, 0x91, 0x00, 0x5D, 0x85, 0x40, 0x91, 0x06, 0x54, 0x54, 0x4F, 0x86, 0x03, 0x58, 0x48, 0x03,
+    0x03, 0x02, 0x08, 0x0A, 0x03, 0x37, 0x37, 0x91, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7B, 0x18, 0x82,
+    0x00, 0x01, 0x56, 0x60, 0x82, 0x00, 0x42, 0x5D, 0x03, 0x01, 0x00, 0x03, 0x8A, 0x3B, 0x13, 0x13,
+    0x07, 0x98, 0x7B, 0x01, 0x02, 0x01, 0x04, 0x00, 0x5D, 0x03, 0x5B, 0x0D, 0x03, 0x07, 0x03, 0x03,
+    0x63, 0x00, 0x00, 0x62, 0x13, 0x07, 0x60, 0x1F, 0x22, 0x9A, 0x80, 0x6E, 0x80, 0x68, 0x7E, 0x34,
+    0x0D, 0x54, 0x02, 0x87, 0x52, 0x6E, 0x26, 0x00, 0x56, 0x26, 0x07, 0x9F, 0x00, 0x11, 0x2D, 0x98,
+    0x59, 0x88, 0x00, 0x29, 0x3F, 0x44, 0x89, 0x7A, 0x00, 0x1F, 0x85, 0x00, 0x07, 0x02, 0x86, 0x02,
+    0x00, 0x7A, 0x74, 0x7A, 0x5D, 0x84, 0x00, 0x05, 0x07, 0x05, 0x4F, 0x18, 0x1C, 0x02, 0x8B, 0x00,
+    0x0D, 0x03, 0x05, 0x0A, 0x3D, 0x1C, 0x1C, 0x0A, 0x86, 0x03, 0x3D, 0x37, 0x90, 0x73, 0x9A, 0x83,
+    0x90, 0x81, 0x37, 0x81, 0x47, 0x80, 0x37, 0x84, 0x1C, 0x82, 0x0A, 0x80, 0x03, 0x82, 0x00, 0x02,
+    0x02, 0x01, 0x02, 0x98, 0x00, 0x0F, 0x49, 0x29, 0x04, 0x00, 0x18, 0x51, 0x34, 0x28, 0x88, 0x74,
+    0x28, 0x00, 0x00, 0x4E, 0x4E, 0x18, 0x82, 0x00, 0x28, 0x3B, 0x65, 0x87, 0x61, 0x3F, 0x74, 0x29,
+    0x52, 0x01, 0x22, 0x5D, 0x00, 0x3B, 0x83, 0x11, 0x08, 0x13, 0x00, 0x0A, 0x2E, 0x41, 0x00, 0x96,
+    0x41, 0x15, 0x15, 0x73, 0x8A, 0x87, 0x05, 0x03, 0x00, 0x02, 0x03, 0x0A, 0x05, 0x02, 0x37, 0x3C,
+    0x3D, 0x02, 0x85, 0x00, 0x81, 0x04, 0x53, 0x16, 0x60, 0x04, 0x3C, 0x96, 0x08, 0x08, 0x3B, 0x47,
+    0x80, 0x5A, 0x50, 0x5E, 0x19, 0x55, 0x02, 0x55, 0x03, 0x00, 0x00, 0x01, 0x03, 0x6B, 0x8C, 0x55,
+    0x58, 0x96, 0x06, 0x7B, 0x45, 0x03, 0x01, 0x02, 0x03, 0x75, 0x41, 0x41, 0x91, 0x03, 0x27, 0x25,
+    0x48, 0x20, 0x14, 0x1E, 0x18, 0x06, 0x41, 0x9F, 0x0B, 0x56, 0x16, 0x05, 0x62, 0x00, 0x26, 0x96,
+    0x06, 0x00, 0x30, 0x81, 0x5D, 0x7A, 0x74, 0x04, 0x95, 0x3F, 0x3F, 0x4E, 0x5D, 0x28, 0x74, 0x22,
+    0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x86, 0x02, 0x00, 0x7A, 0x28, 0x87, 0x00, 0x02, 0x45, 0x1C,
+    0x49, 0x8D, 0x00, 0x0B, 0x01, 0x48, 0x05, 0x3D, 0x3D, 0x1C, 0x08, 0x1C, 0x06, 0x3D, 0x37, 0x90,
+    0x81, 0x73, 0x83, 0x90, 0x81, 0x37, 0x81, 0x47, 0x80, 0x37, 0x84, 0x1C, 0x82, 0x0A, 0x80, 0x03,
+    0x82, 0x00, 0x02, 0x02, 0x01, 0x02, 0x99, 0x00, 0x3A, 0x56, 0x52, 0x52, 0x16, 0x04, 0x00, 0x04,
+    0x98, 0x88, 0x28, 0x00, 0x00, 0x74, 0x7F, 0x16, 0x00, 0x01, 0x07, 0x47, 0x41, 0x13, 0x4E, 0x4E,
+    0x74, 0x11, 0x45, 0x04, 0x01, 0x00, 0x00, 0x05, 0x5C, 0x3C, 0x8A, 0x13, 0x03, 0x71, 0x65, 0x00,
+    0x58, 0x65, 0x65, 0x6B, 0x5C, 0x41, 0x8A, 0x08, 0x06, 0x00, 0x00, 0x22, 0x7B, 0x02, 0x1C, 0x05,
+    0x0A, 0x06, 0x47, 0x05, 0x83, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x18, 0x53, 0x52,
+    0x5F, 0x79, 0x79, 0x37, 0x37, 0x56, 0x18, 0x18, 0x37, 0x96, 0x00, 0x0F, 0xA1, 0x00, 0x1C, 0x67,
+    0x9C, 0x27, 0x13, 0x0B, 0x54, 0x03, 0x00, 0x5D, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0D, 0x6A,
+    0x65, 0x32, 0x2B, 0x30, 0x63, 0x30, 0x24, 0x25, 0x96, 0x9F, 0x85, 0x3B, 0x03, 0x3B, 0x06, 0x05,
+    0x63, 0x56, 0x0A, 0x86, 0x4F, 0x04, 0x96, 0x2B, 0x02, 0x5D, 0x7A, 0x04, 0x60, 0x4E, 0x1A, 0x5D,
+    0x16, 0x1F, 0x74, 0x22, 0x84, 0x00, 0x05, 0x49, 0x02, 0x00, 0x00, 0x7B, 0x34, 0x95, 0x00, 0x81,
+    0x02, 0x81, 0x01, 0x08, 0x03, 0x48, 0x3D, 0x3D, 0x1C, 0x08, 0x3D, 0x06, 0x3D, 0x82, 0x37, 0x80,
+    0x73, 0x81, 0x90, 0x83, 0x37, 0x81, 0x47, 0x80, 0x37, 0x83, 0x1C, 0x83, 0x0A, 0x80, 0x03, 0x82,
+    0x00, 0x02, 0x02, 0x01, 0x02, 0x9A, 0x00, 0x03, 0x01, 0x22, 0x00, 0x04, 0x82, 0x00, 0x10, 0x34,
+    0x51, 0x00, 0x04, 0x74, 0x7F, 0x74, 0x51, 0x00, 0x00, 0x3B, 0x73, 0x13, 0x28, 0x16, 0x6E, 0x1A,
+    0x81, 0x00, 0x82, 0x01, 0x1D, 0x00, 0x7E, 0x29, 0x05, 0x75, 0x58, 0x6A, 0x7B, 0x34, 0x0D, 0x6A,
+    0x41, 0x53, 0x71, 0x32, 0x0B, 0x08, 0x06, 0x02, 0x00, 0x18, 0x95, 0x1F, 0x01, 0x02, 0x06, 0x0A,
+    0x48, 0x02, 0x22, 0x85, 0x00, 0x01, 0x60, 0x18, 0x85, 0x00, 0x02, 0x04, 0x00, 0x02, 0x83, 0x00,
+    0x0D, 0x04, 0x00, 0x50, 0x2B, 0x49, 0x18, 0x6E, 0x30, 0x1A, 0x03, 0x85, 0x03, 0x00, 0x34, 0x85,
+    0x00, 0x2B, 0x4F, 0x6A, 0x55, 0x0D, 0x6A, 0x03, 0x52, 0x2B, 0x00, 0x13, 0x5F, 0x25, 0x3D, 0x34,
+    0x32, 0x9F, 0x58, 0x06, 0x48, 0x95, 0x29, 0x02, 0x07, 0x08, 0x75, 0x00, 0x7B, 0x34, 0x00, 0x51,
+    0x7B, 0x75, 0x7A, 0x7B, 0x7A, 0x4E, 0x1F, 0x7A, 0x49, 0x00, 0x04, 0x00, 0x00, 0x01, 0x9A, 0x00,
+    0x82, 0x02, 0x0A, 0x01, 0x02, 0x01, 0x03, 0x05, 0x3D, 0x1C, 0x86, 0x3D, 0x03, 0x3D, 0x83, 0x37,
+    0x80, 0x90, 0x84, 0x37, 0x82, 0x47, 0x87, 0x3D, 0x80, 0x03, 0x82, 0x00, 0x02, 0x02, 0x01, 0x02,
+    0x99, 0x00, 0x80, 0x5D, 0x8A, 0x00, 0x0D, 0x7A, 0x4E, 0x74, 0x7A, 0x00, 0x00, 0x05, 0x08, 0x05,
+    0x00, 0x16, 0x2B, 0x00, 0x34, 0x83, 0x00, 0x2E, 0x7B, 0x7D, 0x6E, 0x00, 0x07, 0x47, 0x02, 0x03,
+    0x8A, 0x55, 0x37, 0x92, 0x2B, 0x71, 0x9A, 0x0B, 0x13, 0x03, 0x02, 0x00, 0x00, 0x22, 0x1A, 0x4E,
+    0x3F, 0x4F, 0x02, 0x00, 0x00, 0x01, 0x01, 0x22, 0x00, 0x02, 0x00, 0x00, 0x1A, 0x60, 0x00, 0x37,
+    0x8C, 0x5B, 0x5E, 0x6E, 0x42, 0x7E, 0x29, 0x82, 0x53, 0x0A, 0x68, 0x53, 0x7E, 0x71, 0x4C, 0x18,
+    0x91, 0x00, 0x00, 0x02, 0x22, 0x86, 0x00, 0x19, 0x04, 0x85, 0x0D, 0x3C, 0x1A, 0x52, 0x71, 0x41,
+    0x26, 0x03, 0x68, 0x08, 0x95, 0x42, 0x4F, 0x58, 0x00, 0x13, 0x22, 0x02, 0x58, 0x06, 0x05, 0x00,
+    0x07, 0x03, 0x82, 0x00, 0x81, 0x98, 0x0A, 0x00, 0x5D, 0x03, 0x02, 0x07, 0x7A, 0x4E, 0x4E, 0x51,
+    0x51, 0x07, 0x83, 0x00, 0x80, 0x22, 0x83, 0x00, 0x80, 0x04, 0x95, 0x00, 0x82, 0x02, 0x82, 0x01,
+    0x07, 0x03, 0x05, 0x05, 0x0A, 0x1C, 0x0A, 0x05, 0x1C, 0x88, 0x37, 0x83, 0x47, 0x85, 0x3D, 0x81,
+    0x05, 0x80, 0x03, 0x82, 0x00, 0x02, 0x02, 0x01, 0x02, 0x9B, 0x00, 0x80, 0x04, 0x88, 0x00, 0x4A,
+    0x51, 0x4E, 0x88, 0x28, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00, 0x52, 0x56, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x75, 0x2B, 0x4F, 0x00, 0x03, 0x03, 0x00, 0x0A, 0x92, 0x3B, 0x08, 0x08, 0x13, 0x54,
+    0x8A, 0x05, 0x75, 0x03, 0x08, 0x01, 0x02, 0x00, 0x00, 0x7B, 0x1A, 0x16, 0x1F, 0x00, 0x00, 0x4F,
+    0x01, 0x02, 0x00, 0x02, 0x00, 0x00, 0x52, 0x01, 0x01, 0x9A, 0x5A, 0x50, 0x33, 0x11, 0x31, 0x1D,
+    0x67, 0x20, 0x20, 0x31, 0x83, 0x83, 0x14, 0x26, 0x8C, 0x08, 0x91, 0x85, 0x00, 0x2E, 0x04, 0x00,
+    0x04, 0x34, 0x00, 0x04, 0x41, 0x2C, 0x19, 0x03, 0x63, 0x0D, 0x37, 0x41, 0x41, 0x9A, 0x5E, 0x25,
+    0x45, 0x91, 0x79, 0x01, 0x02, 0x62, 0x00, 0x48, 0x62, 0x02, 0x1F, 0x16, 0x02, 0x04, 0x03, 0x04,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x34, 0x60, 0x7F, 0x74, 0x4E, 0x51, 0x00, 0x01, 0xA0, 0x00, 0x81,
+    0x02, 0x81, 0x01, 0x08, 0x02, 0x06, 0x62, 0x0A, 0x0A, 0x1C, 0x0A, 0x0A, 0x86, 0x87, 0x37, 0x84,
+    0x47, 0x84, 0x3D, 0x82, 0x05, 0x80, 0x03, 0x82, 0x00, 0x82, 0x02, 0x01, 0x00, 0x02, 0xA0, 0x00,
+    0x80, 0x01, 0x82, 0x00, 0x27, 0x28, 0x74, 0x51, 0x00, 0x00, 0x01, 0x22, 0x00, 0x3D, 0x26, 0x00,
+    0x45, 0x4F, 0x00, 0x22, 0x02, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x00, 0x03, 0x48, 0x96, 0x13,
+    0x79, 0x47, 0x13, 0x08, 0x1C, 0x22, 0x00, 0x37, 0x47, 0x06, 0x02, 0x00, 0x01, 0x85, 0x00, 0x80,
+    0x01, 0x84, 0x00, 0x02, 0x1C, 0x56, 0x04, 0x85, 0x00, 0x02, 0x4F, 0x6A, 0x50, 0x83, 0x0F, 0x0B,
+    0x19, 0x5E, 0x47, 0x9A, 0x58, 0x06, 0x34, 0x04, 0x04, 0x00, 0x00, 0x04, 0x84, 0x00, 0x29, 0x03,
+    0x06, 0x47, 0x64, 0x0F, 0x06, 0x4F, 0x79, 0x73, 0x0D, 0x65, 0x86, 0x03, 0x62, 0x86, 0x02, 0x52,
+    0x2D, 0x47, 0x00, 0x03, 0x08, 0x00, 0x3F, 0x95, 0x00, 0x00, 0x18, 0x79, 0x00, 0x56, 0x22, 0x04,
+    0x00, 0x28, 0x28, 0x74, 0x7B, 0x28, 0x51, 0x1F, 0x01, 0xA1, 0x00, 0x06, 0x02, 0x01, 0x02, 0x01,
+    0x01, 0x03, 0x0A, 0x82, 0x1C, 0x06, 0x0A, 0x86, 0x47, 0x37, 0x37, 0x47, 0x92, 0x81, 0x37, 0x85,
+    0x47, 0x84, 0x3D, 0x82, 0x05, 0x80, 0x03, 0x82, 0x00, 0x82, 0x02, 0x01, 0x00, 0x01, 0x9E, 0x00,
+    0x80, 0x04, 0x85, 0x00, 0x01, 0x98, 0x45, 0x82, 0x00, 0x0A, 0x02, 0x00, 0x18, 0x79, 0x00, 0x86,
+    0x60, 0x02, 0x56, 0x2D, 0x29, 0x81, 0x02, 0x83, 0x00, 0x11, 0x02, 0x0D, 0x4F, 0x48, 0x26, 0x6E,
+    0x02, 0x75, 0x03, 0x06, 0x48, 0x37, 0x48, 0x03, 0x86, 0x02, 0x00, 0x04, 0x8A, 0x00, 0x15, 0x18,
+    0x4F, 0x00, 0x01, 0x55, 0x40, 0x40, 0x5A, 0x65, 0x80, 0x19, 0x50, 0x19, 0x2C, 0x0F, 0x2C, 0x19,
+    0x4C, 0x71, 0x01, 0x47, 0x06, 0x82, 0x00, 0x80, 0x34, 0x85, 0x00, 0x2C, 0x04, 0x9F, 0x03, 0x01,
+    0x45, 0x1D, 0x33, 0x02, 0x96, 0x15, 0x0B, 0x41, 0x58, 0x3D, 0x03, 0x01, 0x25, 0x3F, 0x56, 0x37,
+    0x00, 0x00, 0x06, 0x0A, 0x7B, 0x45, 0x45, 0x00, 0x45, 0x79, 0x00, 0x18, 0x45, 0x00, 0x45, 0x61,
+    0x7A, 0x5D, 0x07, 0x1F, 0x1A, 0x7B, 0x00, 0x00, 0x04, 0x9F, 0x00, 0x10, 0x01, 0x02, 0x02, 0x00,
+    0x02, 0x03, 0x05, 0x0A, 0x1C, 0x1C, 0x0A, 0x86, 0x85, 0x37, 0x37, 0x47, 0x92, 0x81, 0x37, 0x85,
+    0x47, 0x03, 0x91, 0x3D, 0x3D, 0x05, 0x82, 0x91, 0x01, 0x05, 0x06, 0x82, 0x00, 0x82, 0x02, 0x01,
+    0x07, 0x01, 0xAB, 0x00, 0x0C, 0x07, 0x56, 0x02, 0x02, 0x00, 0x00, 0x34, 0x04, 0x79, 0x27, 0x29,
+    0x00, 0x04, 0x82, 0x00, 0x13, 0x4F, 0x78, 0x71, 0x73, 0x65, 0x68, 0x00, 0x01, 0x06, 0x02, 0x05,
+    0x01, 0x01, 0x03, 0x02, 0x22, 0x0A, 0x00, 0x00, 0x04, 0x88, 0x00, 0x1B, 0x63, 0x01, 0x02, 0x01,
+    0x05, 0x13, 0x73, 0x8C, 0x4C, 0x83, 0x9C, 0x6A, 0x0B, 0x92, 0x6B, 0x6B, 0x41, 0x55, 0x58, 0x02,
+    0x00, 0x02, 0x1C, 0x18, 0x51, 0x00, 0x00, 0x18, 0x84, 0x00, 0x81, 0x04, 0x20, 0x01, 0x00, 0x60,
+    0x83, 0x19, 0x01, 0x58, 0x85, 0x08, 0x5C, 0x3D, 0x1C, 0x30, 0x16, 0x00, 0x02, 0x45, 0x03, 0x00,
+    0x02, 0x07, 0x00, 0x25, 0x1A, 0x00, 0x49, 0x3C, 0x00, 0x00, 0x07, 0x00, 0x34, 0x7A, 0x82, 0x16,
+    0x01, 0x1F, 0x01, 0xA3, 0x00, 0x80, 0x01, 0x84, 0x00, 0x0A, 0x01, 0x03, 0x3D, 0x1C, 0x3D, 0x96,
+    0x85, 0x47, 0x47, 0x85, 0x47, 0x82, 0x85, 0x84, 0x47, 0x82, 0x05, 0x01, 0x62, 0x05, 0x83, 0x03,
+    0x82, 0x00, 0x03, 0x02, 0x01, 0x02, 0x01, 0xAC, 0x00, 0x81, 0x45, 0x84, 0x00, 0x1E, 0x02, 0x92,
+    0x47, 0x45, 0x00, 0x04, 0x00, 0x00, 0x02, 0x71, 0x4C, 0x6A, 0x55, 0x9A, 0x96, 0x00, 0x01, 0x02,
+    0x22, 0x01, 0x00, 0x01, 0x00, 0x02, 0x05, 0x45, 0x04, 0x23, 0x1F, 0x00, 0x07, 0x86, 0x00, 0x1B,
+    0x18, 0x04, 0x00, 0x1A, 0x29, 0x68, 0x26, 0x86, 0x1C, 0x4F, 0x7E, 0x35, 0x30, 0x42, 0x2D, 0x29,
+    0x18, 0x00, 0x51, 0x18, 0x1A, 0x16, 0x1F, 0x60, 0x5D, 0x00, 0x45, 0x1A, 0x82, 0x00, 0x1E, 0x07,
+    0x16, 0x07, 0x00, 0x02, 0x7B, 0x98, 0x63, 0x83, 0x5E, 0x00, 0x3B, 0x32, 0x1C, 0x13, 0x30, 0x6E,
+    0x07, 0x30, 0x45, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x52, 0x30, 0x03, 0x07, 0x01, 0x82, 0x00,
+    0x02, 0x04, 0x00, 0x01, 0x81, 0x7B, 0xAE, 0x00, 0x0B, 0x01, 0x05, 0x0A, 0x08, 0x3C, 0x85, 0x47,
+    0x92, 0x92, 0x85, 0x85, 0x3B, 0x84, 0x85, 0x83, 0x05, 0x83, 0x03, 0x80, 0x01, 0x83, 0x00, 0x81,
+    0x02, 0xAD, 0x00, 0x0A, 0x63, 0x49, 0x00, 0x5D, 0x04, 0x07, 0x4F, 0x90, 0x58, 0x3C, 0x04, 0x83,
+    0x00, 0x05, 0x13, 0x6A, 0x65, 0x65, 0x41, 0x05, 0x83, 0x00, 0x0E, 0x07, 0x00, 0x02, 0x02, 0x00,
+    0x01, 0x05, 0x00, 0x25, 0x23, 0x02, 0x02, 0x00, 0x00, 0x34, 0x83, 0x00, 0x01, 0x49, 0x1F, 0x82,
+    0x00, 0x12, 0x07, 0x1C, 0x45, 0x4F, 0x02, 0x16, 0x0C, 0x94, 0x3E, 0x9C, 0x7D, 0x66, 0x17, 0x2D,
+    0x29, 0x23, 0x1A, 0x00, 0x04, 0x82, 0x00, 0x1A, 0x63, 0x1F, 0x00, 0x00, 0x04, 0x00, 0x18, 0x03,
+    0x00, 0x00, 0x5D, 0x51, 0x75, 0x85, 0x2A, 0xA1, 0x02, 0x08, 0x22, 0x58, 0x08, 0x37, 0x82, 0x6C,
+    0x1F, 0x00, 0x22, 0x83, 0x00, 0x04, 0x79, 0x53, 0x49, 0x00, 0x5D, 0x82, 0x00, 0x81, 0x1F, 0xAF,
+    0x00, 0x81, 0x01, 0x05, 0x02, 0x01, 0x75, 0x1C, 0x3D, 0x1C, 0x88, 0x3C, 0x81, 0x85, 0x87, 0x03,
+    0x80, 0x01, 0x83, 0x00, 0x01, 0x01, 0x9F, 0xAC, 0x00, 0x01, 0x07, 0x63, 0x82, 0x00, 0x05, 0x02,
+    0x03, 0x58, 0x8A, 0x65, 0x03, 0x84, 0x00, 0x06, 0x37, 0x65, 0x30, 0x53, 0x41, 0x00, 0x34, 0x82,
+    0x00, 0x0D, 0x02, 0x00, 0x01, 0x00, 0x5D, 0x01, 0x00, 0x4F, 0x53, 0x91, 0x00, 0x01, 0x00, 0x01,
+    0x83, 0x00, 0x02, 0x01, 0x18, 0x1F, 0x83, 0x00, 0x10, 0x22, 0x58, 0x05, 0x74, 0x8D, 0x76, 0x24,
+    0x2B, 0x63, 0x79, 0x37, 0x52, 0x24, 0x11, 0x82, 0x52, 0x02, 0x83, 0x00, 0x01, 0x16, 0x63, 0x84,
+    0x00, 0x81, 0x49, 0x81, 0x00, 0x10, 0x04, 0x0A, 0x01, 0x0A, 0x53, 0x96, 0x02, 0x03, 0x0A, 0x3C,
+    0x03, 0x08, 0x02, 0x04, 0x00, 0x00, 0x02, 0x82, 0x00, 0x03, 0x63, 0x2B, 0x04, 0x75, 0x83, 0x00,
+    0x01, 0x29, 0x4F, 0xB2, 0x00, 0x04, 0x01, 0x49, 0x1C, 0x3D, 0x1C, 0x82, 0x3C, 0x80, 0x85, 0x82,
+    0x3B, 0x82, 0x85, 0x80, 0x3B, 0x87, 0x03, 0x80, 0x01, 0x82, 0x00, 0x80, 0x02, 0x81, 0x01, 0xAC,
+    0x00, 0x01, 0x22, 0x1C, 0x82, 0x00, 0x0F, 0x01, 0x03, 0x65, 0x9A, 0x05, 0x04, 0x04, 0x00, 0x00,
+    0x01, 0x01, 0x73, 0x8C, 0x81, 0x30, 0x6B, 0x88, 0x00, 0x81, 0x02, 0x0A, 0x04, 0x16, 0x79, 0x37,
+    0x00, 0x5D, 0x00, 0x29, 0x23, 0x4F, 0x04, 0x82, 0x00, 0x41, 0x01, 0x00, 0x4F, 0x5F, 0x6E, 0x4D,
+    0x43, 0x1A, 0x17, 0x20, 0x52, 0x60, 0x86, 0x03, 0x86, 0x56, 0xA1, 0x47, 0x35, 0x7E, 0x06, 0x00,
+    0x00, 0x04, 0x22, 0x00, 0x18, 0x22, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x07, 0x00,
+    0x03, 0x05, 0x00, 0x63, 0x85, 0x56, 0x82, 0x06, 0x01, 0x06, 0x00, 0x01, 0x00, 0x16, 0x1A, 0x00,
+    0x01, 0x00, 0x00, 0x45, 0x56, 0x04, 0x02, 0x02, 0x04, 0x18, 0x29, 0x56, 0xB0, 0x00, 0x05, 0x01,
+    0x06, 0x1C, 0x91, 0x1C, 0x86, 0x81, 0x3C, 0x81, 0x85, 0x82, 0x47, 0x84, 0x85, 0x80, 0x3B, 0x82,
+    0x62, 0x80, 0x05, 0x83, 0x03, 0x80, 0x06, 0x82, 0x00, 0x01, 0x02, 0x01, 0xAD, 0x00, 0x01, 0x1F,
+    0x1C, 0x82, 0x00, 0x04, 0x01, 0x91, 0x87, 0x55, 0x3B, 0x82, 0x00, 0x08, 0x04, 0x00, 0x3D, 0x55,
+    0x65, 0x68, 0x5E, 0x58, 0x01, 0x85, 0x00, 0x0E, 0x02, 0x7B, 0x29, 0x25, 0x52, 0x37, 0x01, 0x27,
+    0x51, 0x00, 0x02, 0x23, 0x1E, 0x52, 0x01, 0x84, 0x00, 0x19, 0x91, 0x52, 0x35, 0x20, 0x89, 0x30,
+    0x27, 0x26, 0x06, 0x75, 0x49, 0x04, 0x04, 0x00, 0x1C, 0x5F, 0x53, 0x30, 0x56, 0x49, 0x52, 0x95,
+    0x1A, 0x00, 0x25, 0x18, 0x83, 0x00, 0x81, 0x01, 0x0D, 0x02, 0x00, 0x01, 0x22, 0x03, 0x06, 0x00,
+    0x18, 0x23, 0x2D, 0x30, 0x30, 0x02, 0x9F, 0x82, 0x00, 0x04, 0x18, 0x1F, 0x60, 0x7E, 0x01, 0x83,
+    0x00, 0x07, 0x01, 0x02, 0x04, 0x1F, 0x25, 0x4F, 0x01, 0x34, 0xA6, 0x00, 0x81, 0x01, 0x80, 0x03,
+    0x82, 0x01, 0x04, 0x03, 0x05, 0x05, 0x3B, 0x47, 0x81, 0x90, 0x85, 0x55, 0x81, 0x73, 0x85, 0x37,
+    0x84, 0x08, 0x82, 0x96, 0x05, 0x08, 0x3D, 0x01, 0x01, 0x05, 0x06, 0xAD, 0x00, 0x80, 0x49, 0x82,
+    0x00, 0x15, 0x02, 0x00, 0x49, 0x90, 0x08, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x85, 0x8A, 0x37,
+    0x80, 0x6A, 0x01, 0x02, 0x04, 0x00, 0x00, 0x02, 0x82, 0x00, 0x0D, 0x3F, 0x86, 0x2D, 0x81, 0xA1,
+    0x16, 0x29, 0x23, 0x7E, 0x23, 0x25, 0x29, 0x16, 0x1A, 0x83, 0x00, 0x36, 0x1C, 0x82, 0x26, 0x37,
+    0x58, 0x49, 0x52, 0x2B, 0x1C, 0x00, 0x02, 0x00, 0x34, 0x00, 0x34, 0x00, 0x02, 0x82, 0x68, 0x6E,
+    0x42, 0x7E, 0x60, 0x00, 0x4E, 0x09, 0x61, 0x00, 0x00, 0x01, 0x5D, 0x00, 0x00, 0x04, 0x00, 0x06,
+    0x03, 0x02, 0x00, 0x63, 0x17, 0x16, 0x00, 0x07, 0x11, 0x79, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x51,
+    0x51, 0x18, 0x56, 0x82, 0x00, 0x80, 0x04, 0x83, 0x00, 0x01, 0x45, 0x1C, 0xA8, 0x00, 0x07, 0x02,
+    0x01, 0x03, 0x03, 0x06, 0x01, 0x02, 0x01, 0x86, 0x03, 0x80, 0x22, 0x82, 0x07, 0x82, 0x22, 0x80,
+    0x07, 0x81, 0x01, 0x81, 0x07, 0x82, 0x92, 0x80, 0x37, 0x83, 0x90, 0x05, 0x9A, 0x37, 0x96, 0x96,
+    0x4F, 0x05, 0x84, 0x01, 0xA8, 0x00, 0x80, 0x60, 0x82, 0x00, 0x04, 0x01, 0x00, 0x00, 0x08, 0x3B,
+    0x85, 0x00, 0x06, 0x47, 0x62, 0x22, 0x37, 0x96, 0x00, 0x02, 0x85, 0x00, 0x0F, 0x51, 0x17, 0x3F,
+    0x81, 0x82, 0x7E, 0x9C, 0x18, 0x7E, 0x7D, 0x6E, 0x01, 0x61, 0x57, 0x4E, 0x04, 0x82, 0x00, 0x09,
+    0x02, 0x79, 0x68, 0x53, 0x35, 0x18, 0x26, 0x2B, 0x00, 0x34, 0x82, 0x00, 0x10, 0x18, 0x1A, 0x00,
+    0x60, 0x03, 0x52, 0x42, 0x03, 0x02, 0x00, 0x2D, 0x99, 0x77, 0x70, 0x95, 0x00, 0x01, 0x83, 0x00,
+    0x16, 0x22, 0x03, 0x02, 0x01, 0x00, 0x30, 0x30, 0x02, 0x28, 0x81, 0xA1, 0x03, 0x03, 0x04, 0x00,
+    0x02, 0x63, 0x28, 0x5D, 0x00, 0x82, 0x51, 0x02, 0x88, 0x00, 0x80, 0x03, 0x81, 0x22, 0xA2, 0x00,
+    0x0D, 0x01, 0x22, 0x62, 0x0A, 0x08, 0x13, 0x58, 0x3C, 0x0A, 0x05, 0x3C, 0x4F, 0x85, 0x37, 0x84,
+    0x47, 0x81, 0x58, 0x82, 0x73, 0x83, 0x8A, 0x80, 0x47, 0x81, 0x6A, 0x15, 0x8C, 0x6A, 0x65, 0x65,
+    0x6A, 0x80, 0x80, 0x41, 0x90, 0x9A, 0x71, 0x9A, 0x92, 0x90, 0x47, 0x8A, 0x47, 0x03, 0x03, 0x0A,
+    0x0A, 0x06, 0x82, 0x02, 0x9F, 0x00, 0x01, 0x22, 0x18, 0x83, 0x00, 0x03, 0x01, 0x47, 0x03, 0x06,
+    0x85, 0x00, 0x03, 0x4F, 0x05, 0x00, 0x01, 0x84, 0x00, 0x17, 0x02, 0x00, 0x04, 0x4F, 0x18, 0x35,
+    0x6E, 0x79, 0x52, 0x52, 0x1B, 0x1F, 0x02, 0x79, 0x05, 0x00, 0x61, 0x44, 0x46, 0x1F, 0x00, 0x00,
+    0x18, 0x03, 0x84, 0x00, 0x03, 0x4B, 0x52, 0x60, 0x52, 0x82, 0x1A, 0x0A, 0x3F, 0x61, 0x25, 0x7E,
+    0x00, 0x16, 0x25, 0x00, 0x00, 0x2D, 0x99, 0x83, 0x77, 0x01, 0x18, 0x04, 0x82, 0x00, 0x82, 0x01,
+    0x81, 0x00, 0x11, 0x02, 0x25, 0x1A, 0x01, 0x56, 0x7E, 0x45, 0x00, 0x48, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x02, 0x00, 0x30, 0x27, 0x88, 0x00, 0x04, 0x1C, 0x18, 0x6A, 0x30, 0x56, 0x9E, 0x00, 0x05,
+    0x01, 0x34, 0x02, 0x08, 0x32, 0x9A, 0x82, 0x65, 0x16, 0x71, 0x90, 0x65, 0x55, 0x13, 0x55, 0x65,
+    0x8C, 0x5B, 0x5B, 0x8C, 0x80, 0x5B, 0x6A, 0x55, 0x80, 0x65, 0x65, 0x6A, 0x65, 0x5C, 0x71, 0x65,
+    0x81, 0x9D, 0x02, 0x33, 0x9D, 0x50, 0x82, 0x9D, 0x13, 0x78, 0x80, 0x6A, 0x8C, 0x8C, 0x6A, 0x65,
+    0x6A, 0x71, 0x71, 0x73, 0x05, 0x47, 0x71, 0x41, 0x47, 0x3C, 0x3C, 0x3D, 0x01, 0x9F, 0x00, 0x80,
+    0x07, 0x84, 0x00, 0x02, 0x3C, 0x18, 0x02, 0x83, 0x00, 0x03, 0x5D, 0x7B, 0x03, 0x86, 0x88, 0x00,
+    0x15, 0x02, 0x7E, 0x29, 0x2B, 0x18, 0x6E, 0x53, 0x18, 0x7E, 0x00, 0x02, 0x3C, 0x52, 0x0A, 0x46,
+    0x59, 0x59, 0x7A, 0x00, 0x00, 0x52, 0x63, 0x82, 0x00, 0x1D, 0x04, 0x00, 0x6E, 0x5F, 0x22, 0x5F,
+    0x16, 0x95, 0x25, 0x16, 0x1F, 0x1C, 0x04, 0x00, 0x52, 0x2D, 0x00, 0x74, 0x99, 0x77, 0x70, 0x70,
+    0x77, 0x77, 0x44, 0x51, 0x00, 0x00, 0x01, 0x22, 0x82, 0x00, 0x13, 0x34, 0x04, 0x52, 0x5F, 0x07,
+    0x00, 0x04, 0x26, 0x05, 0x00, 0x5D, 0x00, 0x04, 0x00, 0x00, 0x63, 0x79, 0x82, 0x6E, 0x22, 0x86,
+    0x00, 0x06, 0x86, 0x41, 0x55, 0xA1, 0x26, 0x82, 0x18, 0x9C, 0x00, 0x82, 0x01, 0x06, 0x3D, 0x41,
+    0x6A, 0x80, 0x5B, 0x4C, 0x50, 0x82, 0x4C, 0x13, 0x9D, 0x65, 0x32, 0x2B, 0x33, 0x19, 0x0F, 0x19,
+    0x33, 0x2C, 0x78, 0x8C, 0x19, 0x78, 0x4C, 0x4C, 0x5E, 0x5B, 0x5B, 0x5E, 0x82, 0x2C, 0x19, 0x67,
+    0x0F, 0x19, 0x2C, 0x2C, 0x0F, 0x4C, 0x5B, 0x0F, 0x0F, 0x5E, 0x5B, 0x8C, 0x5B, 0x4C, 0x6A, 0x8A,
+    0x55, 0x4C, 0x50, 0x55, 0x41, 0x90, 0x9A, 0x37, 0x3D, 0xA4, 0x00, 0x02, 0x02, 0x49, 0x04, 0x82,
+    0x00, 0x04, 0x75, 0x28, 0x1F, 0x18, 0x03, 0x86, 0x00, 0x20, 0x04, 0x00, 0x5F, 0x42, 0x1F, 0x5F,
+    0x23, 0x23, 0x08, 0x1F, 0x45, 0x00, 0x00, 0x86, 0x26, 0x08, 0x74, 0x59, 0x7F, 0x51, 0x00, 0x00,
+    0x16, 0x18, 0x01, 0x00, 0x00, 0x22, 0x00, 0x53, 0x5F, 0x00, 0x02, 0x83, 0x00, 0x11, 0x04, 0x16,
+    0x25, 0x00, 0x1A, 0x30, 0x00, 0x44, 0x77, 0x77, 0x70, 0x70, 0x77, 0x57, 0x70, 0x89, 0x34, 0x04,
+    0x86, 0x00, 0x10, 0x96, 0x82, 0x26, 0xA1, 0x5F, 0x82, 0x71, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02,
+    0x0A, 0x0A, 0x02, 0x22, 0x83, 0x00, 0x80, 0x34, 0x82, 0x00, 0x07, 0x79, 0x41, 0x05, 0x07, 0x37,
+    0x79, 0x56, 0x07, 0x99, 0x00, 0x09, 0x01, 0x03, 0x0A, 0x0A, 0x13, 0x41, 0x8C, 0x4C, 0x9D, 0x33,
+    0x83, 0x0F, 0x81, 0x2C, 0x04, 0x0F, 0x0D, 0x15, 0x0F, 0x64, 0x82, 0x67, 0x81, 0x2C, 0x08, 0x0F,
+    0x2C, 0x67, 0x67, 0x19, 0x8C, 0x78, 0x50, 0x0F, 0x1D, 0x2C, 0x20, 0x1D, 0x83, 0x64, 0x2C, 0x64,
+    0x1D, 0x0F, 0x4C, 0x0F, 0x20, 0x2C, 0x0F, 0x19, 0x78, 0x0F, 0x0F, 0x50, 0x55, 0x80, 0x2C, 0x0F,
+    0x6A, 0x8C, 0x80, 0x71, 0x0D, 0x73, 0x3D, 0xA8, 0x00, 0x05, 0x02, 0x1F, 0x28, 0x34, 0x18, 0x01,
+    0x87, 0x00, 0x2C, 0x1F, 0x1E, 0x18, 0x00, 0x00, 0x45, 0x00, 0x52, 0x25, 0x00, 0x00, 0x04, 0x02,
+    0x30, 0x6E, 0x29, 0x88, 0x28, 0x00, 0x00, 0x04, 0x82, 0x26, 0x4F, 0x00, 0x00, 0x75, 0x00, 0x7E,
+    0x2B, 0x01, 0x3D, 0x01, 0x07, 0x07, 0x00, 0x49, 0x16, 0x01, 0x00, 0x1A, 0x29, 0x22, 0x89, 0x44,
+    0x82, 0x57, 0x81, 0xA3, 0x02, 0x44, 0x4E, 0x34, 0x85, 0x00, 0x09, 0x02, 0x9F, 0x00, 0x4F, 0x5B,
+    0x6A, 0x79, 0x9F, 0x55, 0x49, 0x83, 0x00, 0x03, 0x01, 0x02, 0x01, 0x04, 0x87, 0x00, 0x09, 0x3D,
+    0x2B, 0x85, 0x00, 0x00, 0x49, 0x90, 0xA1, 0x49, 0x04, 0x90, 0x00, 0x80, 0x04, 0x86, 0x00, 0x22,
+    0x01, 0x0A, 0x58, 0x79, 0x9A, 0x80, 0x9D, 0x33, 0x0F, 0x0F, 0x2C, 0x64, 0x20, 0x1D, 0x1D, 0x20,
+    0x83, 0x0F, 0x0D, 0x41, 0x1D, 0x83, 0x83, 0x20, 0x1D, 0x1D, 0x67, 0x67, 0x64, 0x20, 0x1D, 0x0F,
+    0x5A, 0x5B, 0x11, 0x80, 0x0F, 0x82, 0x31, 0x19, 0x83, 0x1D, 0x1D, 0x20, 0x11, 0x19, 0x64, 0x31,
+    0x11, 0x20, 0x1D, 0x11, 0x14, 0x64, 0x0F, 0x2B, 0x6A, 0x64, 0x64, 0x78, 0x5E, 0x5E, 0x5B, 0x5B,
+    0x6A, 0x37, 0xA9, 0x00, 0x04, 0x60, 0x28, 0x00, 0x7B, 0x75, 0x85, 0x00, 0x0A, 0x01, 0x00, 0x18,
+    0x3F, 0x04, 0x00, 0x45, 0x00, 0x18, 0x25, 0x01, 0x82, 0x00, 0x04, 0x3F, 0x2D, 0x6E, 0xA3, 0x89,
+    0x83, 0x00, 0x16, 0x5F, 0x1A, 0x63, 0x02, 0x00, 0x62, 0x00, 0x1A, 0x35, 0x25, 0x81, 0x3F, 0x00,
+    0x00, 0x02, 0x95, 0x1A, 0x00, 0x00, 0x56, 0x7E, 0x00, 0x74, 0x82, 0x59, 0x82, 0x4E, 0x06, 0x7A,
+    0x00, 0x51, 0x3F, 0x18, 0x00, 0x07, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x01, 0x05, 0x9A, 0x84,
+    0x00, 0x0D, 0x04, 0x00, 0x01, 0x8A, 0x05, 0x00, 0x04, 0x02, 0x00, 0x00, 0x34, 0x4F, 0x30, 0x4F,
+    0x82, 0x00, 0x02, 0x90, 0x79, 0x86, 0x88, 0x00, 0x03, 0x45, 0x49, 0x01, 0x02, 0x8C, 0x00, 0x08,
+    0x01, 0x05, 0x58, 0x9A, 0x65, 0x9D, 0x33, 0x19, 0x2A, 0x82, 0x83, 0x16, 0x31, 0x14, 0x31, 0x31,
+    0x7C, 0x31, 0x9D, 0x80, 0x53, 0x3E, 0x4D, 0x31, 0x83, 0x31, 0x11, 0x83, 0x1D, 0x31, 0x7C, 0x83,
+    0x5E, 0x8C, 0x68, 0x1E, 0x11, 0x20, 0x7C, 0x31, 0x9C, 0x9C, 0x7D, 0x24, 0x67, 0x4B, 0x20, 0x31,
+    0x24, 0x7D, 0x24, 0x1D, 0x7D, 0x1D, 0x64, 0x4B, 0x9A, 0x27, 0x31, 0x1D, 0x64, 0x2A, 0x78, 0x5E,
+    0x5B, 0x55, 0x03, 0xA8, 0x00, 0x04, 0x7B, 0x75, 0x00, 0x00, 0x51, 0x84, 0x00, 0x80, 0x01, 0x82,
+    0x00, 0x10, 0x52, 0x16, 0x18, 0x3C, 0x63, 0x45, 0x02, 0x00, 0x00, 0x02, 0x29, 0x3F, 0x5F, 0x2D,
+    0x77, 0x57, 0x2D, 0x82, 0x00, 0x81, 0x1A, 0x20, 0x56, 0x4F, 0x00, 0x05, 0x00, 0x63, 0x53, 0x00,
+    0x49, 0x22, 0x51, 0x60, 0x82, 0x16, 0x1A, 0x45, 0x00, 0x1F, 0x7E, 0x00, 0x51, 0x88, 0x7A, 0x7A,
+    0x28, 0x51, 0x5D, 0x00, 0x1F, 0x61, 0x2D, 0x2D, 0x1A, 0x8A, 0x00, 0x02, 0x02, 0x41, 0x04, 0x85,
+    0x00, 0x02, 0x01, 0x79, 0x08, 0x83, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x16, 0x26, 0x05, 0x75, 0x5F,
+    0x82, 0x37, 0x1C, 0x89, 0x00, 0x02, 0x49, 0x86, 0x02, 0x8C, 0x00, 0x07, 0x01, 0x03, 0x08, 0x41,
+    0x8C, 0x4C, 0x4B, 0x67, 0x81, 0x31, 0x81, 0x81, 0x81, 0x4D, 0x83, 0x7D, 0x10, 0x64, 0x11, 0x19,
+    0x24, 0x7D, 0x7C, 0x7C, 0x7D, 0x35, 0x2A, 0x31, 0x31, 0x4D, 0x31, 0x27, 0x0F, 0x4B, 0x1E, 0x14,
+    0x2A, 0x31, 0x31, 0x7D, 0x43, 0x9C, 0x31, 0x19, 0x11, 0x7D, 0x20, 0x20, 0x9C, 0x20, 0x1D, 0x7D,
+    0x24, 0x20, 0x2A, 0x65, 0x27, 0x9C, 0x4D, 0x20, 0x83, 0x67, 0x19, 0x8C, 0x71, 0x3B, 0xA7, 0x00,
+    0x81, 0x51, 0x80, 0x01, 0x81, 0x00, 0x81, 0x7B, 0x84, 0x00, 0x10, 0x51, 0x07, 0x00, 0x03, 0x16,
+    0x5F, 0x1C, 0x18, 0x04, 0x1A, 0x56, 0x00, 0x1F, 0x25, 0x5F, 0x16, 0x23, 0x82, 0x44, 0x26, 0x60,
+    0x00, 0x00, 0x56, 0x52, 0x56, 0x1A, 0x00, 0x0B, 0x00, 0x49, 0x53, 0x45, 0x00, 0x00, 0x60, 0x52,
+    0x1F, 0x00, 0x02, 0x07, 0x00, 0x16, 0x29, 0x45, 0x02, 0x51, 0x28, 0x51, 0x00, 0x9F, 0x00, 0x95,
+    0x6C, 0x2D, 0x25, 0x95, 0x2D, 0x1A, 0x88, 0x00, 0x03, 0x5D, 0x00, 0x03, 0x05, 0x85, 0x00, 0x03,
+    0x06, 0x03, 0x00, 0x34, 0x85, 0x00, 0x06, 0x07, 0x26, 0x26, 0x29, 0x24, 0x6E, 0x4F, 0x89, 0x00,
+    0x04, 0x04, 0x00, 0x01, 0x1F, 0x56, 0x8C, 0x00, 0x21, 0x06, 0x0A, 0x90, 0x6A, 0x19, 0x1D, 0x7C,
+    0x7C, 0x31, 0x4D, 0x7D, 0x17, 0x4D, 0x66, 0x66, 0x76, 0x76, 0x21, 0x1D, 0x6A, 0x65, 0x2A, 0x9C,
+    0x4D, 0x9C, 0x2A, 0x27, 0x7C, 0x83, 0x31, 0x31, 0x20, 0x67, 0x1D, 0x1F, 0x31, 0x11, 0x83, 0x2A,
+    0x20, 0x7D, 0x7D, 0x20, 0x78, 0x11, 0x9C, 0x14, 0x4D, 0x7D, 0x4D, 0x1D, 0x31, 0x20, 0x20, 0x0F,
+    0x6A, 0x4B, 0x7D, 0x20, 0x11, 0x24, 0x67, 0x19, 0x80, 0x0D, 0x37, 0x01, 0xA6, 0x00, 0x05, 0x60,
+    0x1A, 0x22, 0x00, 0x51, 0x7B, 0x85, 0x00, 0x22, 0x01, 0x4F, 0x07, 0x04, 0x02, 0x04, 0x56, 0x07,
+    0x00, 0x60, 0x18, 0x00, 0x25, 0x18, 0x0A, 0x2D, 0x30, 0x89, 0x44, 0x46, 0x88, 0x00, 0x00, 0x18,
+    0x29, 0x03, 0x1F, 0x04, 0x82, 0x45, 0x00, 0x68, 0x60, 0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x30,
+    0x79, 0x01, 0x00, 0x34, 0x83, 0x98, 0x0A, 0x7A, 0x57, 0x6C, 0x61, 0x25, 0x16, 0x16, 0x4E, 0x75,
+    0x00, 0x04, 0x88, 0x00, 0x01, 0x13, 0x02, 0x82, 0x00, 0x03, 0x02, 0x01, 0x0A, 0x02, 0x89, 0x00,
+    0x04, 0x85, 0x5F, 0x82, 0x79, 0x03, 0x8C, 0x00, 0x03, 0x07, 0x5F, 0x6E, 0x4F, 0x8A, 0x00, 0x21,
+    0x01, 0x1C, 0x90, 0x8C, 0x0F, 0x67, 0x2A, 0x11, 0x1D, 0x31, 0x83, 0x7C, 0x31, 0x31, 0x7D, 0x4D,
+    0x4D, 0x67, 0x2A, 0x4B, 0x92, 0x55, 0x2A, 0x7C, 0x31, 0x6E, 0x11, 0x83, 0x1D, 0x20, 0x14, 0x1D,
+    0x11, 0x2C, 0x1F, 0x31, 0x4B, 0x2A, 0x11, 0x64, 0x31, 0x83, 0x4B, 0x68, 0x0F, 0x31, 0x20, 0x7C,
+    0x7C, 0x31, 0x1D, 0x2A, 0x21, 0x1D, 0x0F, 0x65, 0x2B, 0x31, 0x4B, 0x4B, 0x11, 0x0F, 0x5B, 0x71,
+    0x0D, 0x92, 0x01, 0x8E, 0x00, 0x02, 0x49, 0xA1, 0x01, 0x95, 0x00, 0x02, 0x18, 0x75, 0x5D, 0x81,
+    0x51, 0x86, 0x00, 0x05, 0x01, 0x4F, 0x96, 0x0A, 0x45, 0x03, 0x84, 0x00, 0x19, 0x04, 0x49, 0x7F,
+    0x69, 0x2D, 0x61, 0x69, 0x69, 0x28, 0x00, 0x00, 0x49, 0x29, 0x04, 0x1F, 0x02, 0x75, 0x01, 0x00,
+    0x82, 0x82, 0x00, 0x00, 0x04, 0x34, 0x01, 0x82, 0x00, 0x81, 0x6E, 0x02, 0x1C, 0x04, 0x01, 0x83,
+    0x98, 0x0C, 0x28, 0x6C, 0x44, 0x89, 0x57, 0x89, 0x74, 0x18, 0x16, 0x1F, 0x00, 0x00, 0x04, 0x87,
+    0x00, 0x81, 0x02, 0x81, 0x00, 0x03, 0x02, 0x03, 0x03, 0x01, 0x86, 0x00, 0x07, 0x04, 0x34, 0x00,
+    0x04, 0x00, 0x00, 0x05, 0x01, 0x8F, 0x00, 0x03, 0x63, 0x6E, 0x5F, 0x02, 0x88, 0x00, 0x21, 0x01,
+    0x3C, 0x41, 0x5E, 0x19, 0x0F, 0x19, 0x0F, 0x1D, 0x1D, 0x11, 0x67, 0x2A, 0x64, 0x83, 0x20, 0x64,
+    0x19, 0x0F, 0x1D, 0x55, 0x47, 0x92, 0x19, 0x0F, 0x6A, 0x4B, 0x67, 0x78, 0x2A, 0x11, 0x0F, 0x0F,
+    0x78, 0x1F, 0x20, 0x0F, 0x4B, 0x2A, 0x0F, 0x11, 0x4B, 0x2B, 0x68, 0x78, 0x0F, 0x11, 0x11, 0x2A,
+    0x2A, 0x1D, 0x19, 0x24, 0x2A, 0x5E, 0x41, 0x71, 0x11, 0x19, 0x19, 0x11, 0x0F, 0x6A, 0x6A, 0x9A,
+    0x3B, 0x22, 0x8D, 0x00, 0x03, 0x04, 0x45, 0x5F, 0x07, 0x95, 0x00, 0x04, 0x22, 0x45, 0x7B, 0x00,
+    0x51, 0x87, 0x00, 0x04, 0x02, 0x07, 0x75, 0x00, 0x04, 0x86, 0x00, 0x24, 0x74, 0x69, 0x69, 0x59,
+    0x69, 0x74, 0x00, 0x00, 0x02, 0x02, 0x1A, 0x07, 0x60, 0x16, 0x16, 0x86, 0x00, 0x86, 0x7E, 0x29,
+    0x05, 0x02, 0x00, 0x00, 0x04, 0x1A, 0x23, 0x35, 0x37, 0x49, 0x5D, 0x00, 0x34, 0x98, 0x98, 0x34,
+    0x74, 0x84, 0x44, 0x07, 0x61, 0x16, 0x28, 0x00, 0x28, 0x01, 0x00, 0x01, 0x8A, 0x00, 0x03, 0x01,
+    0x62, 0x01, 0x02, 0x86, 0x00, 0x07, 0x01, 0x03, 0x00, 0x01, 0x00, 0x18, 0x30, 0x45, 0x8E, 0x00,
+    0x02, 0x04, 0x00, 0x01, 0x81, 0x5F, 0x88, 0x00, 0x21, 0x03, 0x3C, 0x9A, 0x80, 0x5B, 0x50, 0x0F,
+    0x11, 0x4B, 0x80, 0x5B, 0x5B, 0x65, 0x5E, 0x5E, 0x19, 0x0F, 0x80, 0x71, 0x0F, 0x80, 0x3B, 0x90,
+    0x65, 0x50, 0x2B, 0x78, 0x68, 0x41, 0x68, 0x19, 0x4C, 0x19, 0x8C, 0x0D, 0x2A, 0x68, 0x78, 0x19,
+    0x4B, 0x68, 0x71, 0x41, 0x19, 0x6A, 0x68, 0x0F, 0x68, 0x78, 0x82, 0x5E, 0x0E, 0x0F, 0x19, 0x5B,
+    0x9A, 0x9A, 0x68, 0x5E, 0x68, 0x5E, 0x19, 0x71, 0x55, 0x92, 0x13, 0x06, 0x8E, 0x00, 0x01, 0x01,
+    0x4F, 0x97, 0x00, 0x01, 0x01, 0x7B, 0x84, 0x00, 0x80, 0x04, 0x84, 0x00, 0x06, 0x01, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x04, 0x84, 0x00, 0x04, 0x28, 0x88, 0x74, 0x7A, 0x34, 0x83, 0x00, 0x12, 0x01,
+    0x00, 0x04, 0x60, 0x04, 0x9F, 0x00, 0x00, 0x01, 0x29, 0x23, 0x42, 0x2D, 0x42, 0x23, 0x21, 0x29,
+    0x3C, 0x06, 0x85, 0x00, 0x02, 0x04, 0x60, 0x46, 0x82, 0x44, 0x07, 0x46, 0x69, 0x95, 0x51, 0x74,
+    0x46, 0x74, 0x49, 0x8B, 0x00, 0x81, 0x01, 0x89, 0x00, 0x06, 0x8A, 0x01, 0x00, 0x00, 0x60, 0x5F,
+    0x01, 0x92, 0x00, 0x02, 0x86, 0x37, 0x01, 0x86, 0x00, 0x21, 0x03, 0x85, 0x92, 0x73, 0x5B, 0x5E,
+    0x2B, 0x2B, 0x5B, 0x8C, 0x71, 0x2B, 0x8C, 0x2B, 0x2B, 0x80, 0x5B, 0x41, 0x92, 0x8C, 0x78, 0x37,
+    0x90, 0x6A, 0x4C, 0x2B, 0x5B, 0x71, 0x92, 0x53, 0x78, 0x8C, 0x78, 0x71, 0x1F, 0x4B, 0x6A, 0x6A,
+    0x5B, 0x80, 0x80, 0x32, 0x79, 0x53, 0x55, 0x5B, 0x0F, 0x65, 0x5B, 0x40, 0x65, 0x5B, 0x19, 0x9D,
+    0x6A, 0x3B, 0x8A, 0x6A, 0x80, 0x6A, 0x41, 0x5B, 0x71, 0x58, 0x47, 0x0A, 0x02, 0xB8, 0x00, 0x05,
+    0x07, 0x00, 0x04, 0x04, 0x7B, 0x5D, 0x86, 0x00, 0x15, 0x04, 0x00, 0x02, 0x00, 0x5D, 0x00, 0x00,
+    0x75, 0x2D, 0x30, 0x1F, 0x63, 0x1A, 0x7E, 0x4F, 0x1A, 0x25, 0x35, 0x7E, 0x82, 0x4F, 0x02, 0x85,
+    0x00, 0x13, 0x5D, 0x00, 0x02, 0x02, 0x16, 0x61, 0x61, 0x69, 0x4E, 0x74, 0x98, 0x74, 0x44, 0x89,
+    0x89, 0x4E, 0x51, 0x00, 0x34, 0x04, 0x93, 0x00, 0x07, 0x08, 0x47, 0x34, 0x00, 0x00, 0x03, 0x0A,
+    0x49, 0x90, 0x00, 0x03, 0x01, 0x02, 0x01, 0x07, 0x86, 0x00, 0x21, 0x03, 0x3C, 0x47, 0x73, 0x8C,
+    0x5B, 0x54, 0x73, 0x41, 0x41, 0x71, 0x65, 0x6A, 0x35, 0x6A, 0x71, 0x9A, 0x0B, 0x08, 0x71, 0x19,
+    0x55, 0x37, 0x80, 0x8C, 0x8C, 0x41, 0x55, 0x47, 0x68, 0x2B, 0x41, 0x5B, 0x71, 0x1E, 0x6A, 0x55,
+    0x6B, 0x55, 0x92, 0x92, 0x85, 0x3C, 0x2B, 0x90, 0x6A, 0x35, 0x90, 0x65, 0x8C, 0x71, 0x5C, 0x5B,
+    0x5B, 0x41, 0x48, 0x13, 0x6B, 0x5F, 0xA1, 0x0B, 0x6B, 0x79, 0x3C, 0x08, 0x0A, 0x91, 0x00, 0x80,
+    0x75, 0x98, 0x00, 0x01, 0x04, 0x01, 0x87, 0x00, 0x09, 0x5D, 0x00, 0x04, 0x00, 0x1F, 0x18, 0x04,
+    0x00, 0x4E, 0x74, 0x88, 0x00, 0x11, 0x01, 0x30, 0x52, 0x00, 0x01, 0x00, 0x63, 0x2D, 0x42, 0x30,
+    0x30, 0x56, 0x01, 0x00, 0x00, 0x01, 0x02, 0x01, 0x88, 0x00, 0x09, 0x04, 0x00, 0x00, 0x22, 0x4E,
+    0x7A, 0x7A, 0x51, 0x51, 0x4E, 0x82, 0x44, 0x81, 0x46, 0x01, 0x7F, 0x34, 0x96, 0x00, 0x07, 0x55,
+    0x07, 0x00, 0x00, 0x91, 0x56, 0x18, 0x04, 0x8E, 0x00, 0x81, 0x04, 0x89, 0x00, 0x21, 0x06, 0x1C,
+    0x05, 0x58, 0x6A, 0x71, 0x08, 0x4F, 0x90, 0x47, 0x73, 0x92, 0x55, 0x26, 0xA1, 0x26, 0x37, 0x3B,
+    0x0A, 0x37, 0x6B, 0x58, 0x47, 0x26, 0x41, 0x55, 0x3B, 0x37, 0x58, 0x26, 0x82, 0x13, 0x26, 0x71,
+    0x1F, 0x3B, 0x79, 0x3B, 0x47, 0x05, 0x05, 0x3C, 0x01, 0xA1, 0x56, 0x47, 0x2B, 0x55, 0x92, 0x55,
+    0x9A, 0x0B, 0x9A, 0x55, 0x8A, 0x75, 0x06, 0x13, 0x5F, 0x1F, 0x85, 0x13, 0x08, 0x86, 0x03, 0x06,
+    0x01, 0x90, 0x00, 0x03, 0x22, 0x00, 0x00, 0x01, 0x95, 0x00, 0x80, 0x01, 0x83, 0x00, 0x80, 0x04,
+    0x82, 0x00, 0x0E, 0x01, 0x51, 0x5D, 0x00, 0x00, 0x04, 0x00, 0x28, 0x4E, 0x69, 0x59, 0x28, 0x00,
+    0x00, 0x34, 0x84, 0x00, 0x02, 0x18, 0x29, 0x07, 0x83, 0x00, 0x02, 0x5D, 0x49, 0x7B, 0x83, 0x00,
+    0x80, 0x04, 0x86, 0x00, 0x80, 0x01, 0x84, 0x00, 0x07, 0x04, 0x00, 0x75, 0x49, 0x04, 0x00, 0x51,
+    0x61, 0x82, 0x44, 0x06, 0x89, 0x46, 0x7F, 0x98, 0x28, 0x88, 0x7B, 0x94, 0x00, 0x06, 0x85, 0x37,
+    0x00, 0x04, 0x00, 0x79, 0x05, 0x8D, 0x00, 0x04, 0x1F, 0x03, 0x02, 0x00, 0x34, 0x88, 0x00, 0x21,
+    0x02, 0x03, 0x03, 0x3C, 0x92, 0x92, 0x3C, 0x75, 0x91, 0x86, 0x3C, 0x08, 0x08, 0x05, 0x4F, 0x4F,
+    0x08, 0x05, 0x03, 0x3D, 0x03, 0x05, 0x05, 0x47, 0x37, 0x73, 0x91, 0x3C, 0x48, 0x37, 0x26, 0x48,
+    0x87, 0x9A, 0x1D, 0x0A, 0x3C, 0x0A, 0x03, 0x48, 0x03, 0x1C, 0x02, 0x4F, 0xA1, 0x48, 0x82, 0x47,
+    0x3B, 0x85, 0x47, 0x58, 0x85, 0x37, 0x13, 0x06, 0x07, 0x3D, 0x4F, 0x28, 0x05, 0x3C, 0x62, 0x03,
+    0x01, 0x95, 0x00, 0x80, 0x01, 0x96, 0x00, 0x02, 0x01, 0x45, 0x01, 0x84, 0x00, 0x0C, 0x07, 0x28,
+    0x28, 0x00, 0x5D, 0x51, 0x74, 0x69, 0x69, 0x59, 0x7F, 0x7A, 0x18, 0x86, 0x00, 0x0F, 0x75, 0x00,
+    0x3D, 0x3B, 0x96, 0x03, 0x06, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x07, 0x00, 0x04, 0x8D, 0x00,
+    0x04, 0x51, 0x96, 0x07, 0x00, 0x74, 0x82, 0x44, 0x09, 0x89, 0x69, 0x74, 0x00, 0x7A, 0x4E, 0x7F,
+    0x74, 0x28, 0x34, 0x92, 0x00, 0x08, 0x02, 0x26, 0x22, 0x00, 0x00, 0x03, 0x00, 0x45, 0x60, 0x85,
+    0x00, 0x01, 0x07, 0x49, 0x82, 0x00, 0x02, 0x60, 0x23, 0x22, 0x8C, 0x00, 0x81, 0x01, 0x06, 0x06,
+    0x3D, 0x86, 0x01, 0x22, 0x49, 0x03, 0x82, 0x06, 0x14, 0x0A, 0x1C, 0x03, 0x06, 0x03, 0x06, 0x22,
+    0x07, 0x01, 0x03, 0x62, 0x03, 0x47, 0x03, 0x03, 0x02, 0x05, 0x4F, 0x06, 0x02, 0x86, 0x04, 0x03,
+    0x05, 0x06, 0x06, 0x03, 0x82, 0x02, 0x14, 0x03, 0x56, 0x48, 0x4F, 0x08, 0x13, 0x3D, 0x87, 0x05,
+    0x03, 0x0A, 0x05, 0x06, 0x04, 0x01, 0x62, 0x28, 0x75, 0x03, 0x06, 0x01, 0x81, 0x02, 0x95, 0x00,
+    0x80, 0x01, 0x96, 0x00, 0x03, 0x01, 0x18, 0x01, 0x45, 0x82, 0x00, 0x0C, 0x51, 0x7A, 0x7A, 0x7B,
+    0x28, 0x59, 0x69, 0x59, 0x59, 0x7F, 0x7F, 0x28, 0x07, 0x87, 0x00, 0x02, 0x3C, 0x5C, 0x40, 0x82,
+    0x5A, 0x0B, 0x40, 0x71, 0x0D, 0x0D, 0x55, 0x15, 0x08, 0x06, 0x26, 0x71, 0x03, 0x01, 0x89, 0x00,
+    0x13, 0x75, 0x01, 0x03, 0x9F, 0x00, 0x51, 0x95, 0x4E, 0x7F, 0x74, 0x28, 0x00, 0x7A, 0x69, 0x59,
+    0x4E, 0x7F, 0x88, 0x7A, 0x22, 0x92, 0x00, 0x05, 0x79, 0x55, 0x34, 0x00, 0x00, 0x04, 0x81, 0x1A,
+    0x85, 0x00, 0x01, 0x49, 0x07, 0x82, 0x00, 0x02, 0x25, 0x81, 0x02, 0x82, 0x00, 0x81, 0x02, 0x87,
+    0x00, 0x08, 0x02, 0x00, 0x00, 0x01, 0x22, 0x00, 0x02, 0x02, 0x06, 0x83, 0x02, 0x13, 0x1C, 0x01,
+    0x02, 0x01, 0x06, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x3D, 0x03, 0x00, 0x5D, 0x04, 0x63, 0x03,
+    0x02, 0x01, 0x81, 0x01, 0x81, 0x02, 0x83, 0x00, 0x07, 0x01, 0x1C, 0x03, 0x4F, 0x03, 0x06, 0x03,
+    0x06, 0x81, 0x01, 0x82, 0x02, 0x06, 0x01, 0x02, 0x02, 0x7B, 0x7B, 0x01, 0x04, 0x8C, 0x00, 0x80,
+    0x01, 0x8A, 0x00, 0x02, 0x07, 0x00, 0x02, 0x87, 0x00, 0x80, 0x07, 0x8C, 0x00, 0x0B, 0x22, 0x1C,
+    0x95, 0x4E, 0x45, 0x51, 0x7A, 0x88, 0x7A, 0x28, 0x34, 0x88, 0x83, 0x7F, 0x01, 0x88, 0x5D, 0x88,
+    0x00, 0x1C, 0x13, 0x0D, 0x6A, 0x40, 0x5A, 0x5A, 0x2E, 0x5A, 0x40, 0x40, 0x71, 0x5C, 0x58, 0x00,
+    0x80, 0x2C, 0x54, 0x13, 0x40, 0x2E, 0x40, 0x15, 0x13, 0x04, 0x02, 0x02, 0x00, 0x00, 0x02, 0x89,
+    0x00, 0x07, 0x7B, 0x61, 0x59, 0x4E, 0x7F, 0x74, 0x88, 0x28, 0x93, 0x00, 0x0C, 0x02, 0x82, 0x02,
+    0x00, 0x00, 0x04, 0x26, 0x03, 0x00, 0x04, 0x02, 0x00, 0x34, 0x84, 0x00, 0x02, 0x04, 0x45, 0x51,
+    0xA5, 0x00, 0x08, 0x01, 0x9F, 0x00, 0x00, 0x04, 0x1C, 0x0A, 0x00, 0x01, 0x88, 0x00, 0x06, 0x01,
+    0x02, 0x1C, 0x01, 0x01, 0x06, 0x02, 0x87, 0x00, 0x80, 0x5D, 0x92, 0x00, 0x80, 0x02, 0x88, 0x00,
+    0x01, 0x49, 0x02, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x80, 0x01, 0x8D, 0x00, 0x01, 0x01, 0x22,
+    0x81, 0x28, 0x82, 0x88, 0x07, 0x28, 0x7A, 0x51, 0x00, 0x28, 0x88, 0x88, 0x7A, 0x8A, 0x00, 0x01,
+    0x9A, 0x40, 0x85, 0x5A, 0x81, 0x40, 0x15, 0x5C, 0x32, 0x08, 0x5D, 0x3C, 0x64, 0x71, 0x65, 0x2E,
+    0x0D, 0x08, 0x75, 0x02, 0x34, 0x00, 0x34, 0x00, 0x01, 0x34, 0x00, 0x00, 0x01, 0x87, 0x00, 0x06,
+    0x88, 0x59, 0x7F, 0x88, 0x88, 0x98, 0x04, 0x94, 0x00, 0x81, 0x56, 0x81, 0x00, 0x12, 0x03, 0x56,
+    0x00, 0x1F, 0x49, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x34, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x02, 0xA3, 0x00, 0x80, 0x02, 0x82, 0x00, 0x01, 0x01, 0x03, 0x81, 0x00, 0x8A, 0x00, 0x80, 0x07,
+    0x9E, 0x00, 0x02, 0x3D, 0x63, 0x02, 0x87, 0x00, 0x06, 0x22, 0x06, 0x00, 0x03, 0x86, 0x1C, 0x01,
+    0x92, 0x00, 0x08, 0x07, 0x5D, 0x98, 0x7A, 0x88, 0x7A, 0x28, 0x28, 0x5D, 0x8E, 0x00, 0x01, 0x62,
+    0x6A, 0x81, 0x5A, 0x85, 0x2E, 0x81, 0x40, 0x0D, 0x5C, 0x6B, 0x08, 0x04, 0x64, 0x2B, 0x0B, 0x54,
+    0x03, 0x91, 0x13, 0x9A, 0x40, 0x03, 0x8F, 0x00, 0x03, 0x7B, 0x51, 0x7B, 0x00, 0x81, 0x04, 0x94,
+    0x00, 0x0D, 0x49, 0x52, 0x04, 0x04, 0x02, 0x34, 0x00, 0x21, 0x52, 0x00, 0x00, 0x4F, 0x6E, 0x1C,
+    0x82, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 0x22, 0xA9, 0x00, 0x80, 0x01, 0x81, 0x00, 0xAB, 0x00,
+    0x02, 0x49, 0x18, 0x91, 0x86, 0x00, 0x04, 0x02, 0x07, 0x49, 0x49, 0x03, 0x94, 0x00, 0x01, 0x28,
+    0x51, 0x81, 0x00, 0x82, 0x98, 0x80, 0x5D, 0x8F, 0x00, 0x80, 0x0B, 0x83, 0x2E, 0x80, 0x50, 0x82,
+    0x72, 0x0A, 0x4C, 0x2E, 0x2E, 0x5A, 0x40, 0x15, 0x04, 0x24, 0x68, 0x0B, 0x5A, 0x83, 0x2E, 0x02,
+    0x5A, 0x0A, 0x02, 0x81, 0x04, 0x8C, 0x00, 0x80, 0x04, 0x82, 0x00, 0x80, 0x07, 0x8B, 0x00, 0x80,
+    0x04, 0x89, 0x00, 0x0C, 0x1A, 0x4F, 0x00, 0x00, 0x34, 0x07, 0x68, 0x86, 0x00, 0x56, 0x27, 0x1A,
+    0x02, 0x83, 0x00, 0x01, 0x06, 0x02, 0x83, 0x00, 0x80, 0x02, 0x81, 0x01, 0xA7, 0x00, 0xAC, 0x00,
+    0x02, 0x3D, 0x56, 0x1C, 0x8F, 0x00, 0x82, 0x01, 0x90, 0x00, 0x80, 0x04, 0x92, 0x00, 0x1B, 0x6B,
+    0x5A, 0x50, 0x2E, 0x40, 0x40, 0x5A, 0x2E, 0x4C, 0x4C, 0x72, 0x50, 0x2E, 0x5A, 0x71, 0x00, 0x67,
+    0x19, 0x32, 0x5C, 0x0D, 0x40, 0x0D, 0x15, 0x5C, 0x40, 0x00, 0x34, 0x8D, 0x00, 0x02, 0x04, 0x00,
+    0x34, 0x8B, 0x00, 0x80, 0x02, 0x87, 0x00, 0x80, 0x04, 0x82, 0x00, 0x0A, 0x45, 0x82, 0x00, 0x04,
+    0x00, 0x00, 0x07, 0x00, 0x1F, 0x67, 0x56, 0x82, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x06, 0x82,
+    0x00, 0x03, 0x01, 0x03, 0x06, 0x01, 0xA7, 0x00, 0xA7, 0x00, 0x80, 0x02, 0x84, 0x00, 0x03, 0x22,
+    0x29, 0x1F, 0x00, 0x81, 0x04, 0x8A, 0x00, 0x04, 0x07, 0x03, 0x03, 0x06, 0x02, 0x90, 0x00, 0x80,
+    0x04, 0x91, 0x00, 0x01, 0x3B, 0x40, 0x82, 0x2E, 0x03, 0x5A, 0x40, 0x2E, 0x50, 0x82, 0x72, 0x81,
+    0x2E, 0x0F, 0x50, 0x01, 0x11, 0x4B, 0x32, 0x71, 0x0D, 0x15, 0x47, 0x48, 0x5A, 0x40, 0x03, 0x34,
+    0x00, 0x04, 0x8A, 0x00, 0x80, 0x04, 0x8D, 0x00, 0x02, 0x01, 0x48, 0x04, 0x83, 0x00, 0x03, 0x02,
+    0x00, 0x00, 0x04, 0x83, 0x00, 0x17, 0x2B, 0x1C, 0x04, 0x00, 0x04, 0x04, 0x1A, 0x35, 0x47, 0x00,
+    0x02, 0x00, 0x00, 0x07, 0x04, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x06, 0x02, 0xA8, 0x00,
+    0xAB, 0x00, 0x08, 0x02, 0x00, 0x00, 0x01, 0x1A, 0x1A, 0x04, 0x00, 0x07, 0x88, 0x00, 0x06, 0x01,
+    0x03, 0x05, 0x48, 0x05, 0x06, 0x02, 0xA2, 0x00, 0x01, 0x03, 0x0D, 0x83, 0x2E, 0x01, 0x5A, 0x2E,
+    0x84, 0x72, 0x81, 0x50, 0x0C, 0x32, 0x4B, 0x64, 0x0B, 0x92, 0x3B, 0x62, 0x06, 0x54, 0x0D, 0x3B,
+    0x73, 0x3D, 0x82, 0x00, 0x80, 0x04, 0x97, 0x00, 0x02, 0x05, 0x0B, 0x0A, 0x83, 0x00, 0x01, 0x13,
+    0x03, 0x85, 0x00, 0x01, 0x18, 0x52, 0x82, 0x00, 0x09, 0x01, 0x5F, 0x55, 0x00, 0x01, 0x00, 0x07,
+    0x90, 0x26, 0x07, 0x82, 0x00, 0x06, 0x02, 0x03, 0x01, 0x00, 0x04, 0x01, 0x02, 0xA7, 0x00, 0xAC,
+    0x00, 0x06, 0x03, 0x00, 0x00, 0x01, 0x1A, 0x1F, 0x45, 0x88, 0x00, 0x01, 0x02, 0x01, 0x82, 0x48,
+    0x02, 0x05, 0x03, 0x01, 0xA0, 0x00, 0x03, 0x02, 0x01, 0x9F, 0x0D, 0x81, 0x5A, 0x84, 0x2E, 0x14,
+    0x72, 0x50, 0x72, 0x72, 0x2E, 0x2E, 0x0B, 0x4B, 0x1D, 0x32, 0x0B, 0x6B, 0x15, 0x0D, 0x5A, 0x72,
+    0x50, 0x5C, 0x6B, 0x02, 0x34, 0x8B, 0x00, 0x02, 0x04, 0x00, 0x04, 0x8A, 0x00, 0x09, 0x13, 0x0D,
+    0x73, 0x07, 0x00, 0x00, 0x04, 0x0B, 0x54, 0x01, 0x83, 0x00, 0x0F, 0x04, 0x00, 0x52, 0x07, 0x02,
+    0x00, 0x00, 0x07, 0x90, 0x07, 0x00, 0x63, 0x68, 0x26, 0x06, 0x08, 0x82, 0x00, 0x06, 0x02, 0x08,
+    0x0A, 0x04, 0x00, 0x00, 0x02, 0xA7, 0x00, 0xAD, 0x00, 0x81, 0x02, 0x05, 0x04, 0x00, 0x06, 0x5F,
+    0x56, 0x01, 0x86, 0x00, 0x81, 0x01, 0x05, 0x06, 0x48, 0x0A, 0x48, 0x03, 0x06, 0x9D, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x54, 0x13, 0x08, 0x40, 0x84, 0x2E, 0x80, 0x4C, 0x81, 0x2E, 0x83, 0x72, 0x0E,
+    0x50, 0x0B, 0x35, 0x4B, 0x32, 0x2E, 0x72, 0x50, 0x50, 0x4C, 0x50, 0x0B, 0x0B, 0x55, 0x07, 0x95,
+    0x00, 0x0F, 0x04, 0x00, 0x00, 0x02, 0x01, 0x0B, 0x15, 0x15, 0x54, 0x00, 0x00, 0x48, 0x54, 0x15,
+    0x58, 0x07, 0x84, 0x00, 0x81, 0x18, 0x83, 0x00, 0x07, 0x22, 0x49, 0x95, 0x24, 0x26, 0x00, 0x3F,
+    0x82, 0x83, 0x00, 0x05, 0x04, 0x05, 0x0A, 0x02, 0x00, 0x5D, 0xA7, 0x00, 0xAF, 0x00, 0x06, 0x01,
+    0x00, 0x00, 0x04, 0x1C, 0x63, 0x4F, 0x87, 0x00, 0x06, 0x02, 0x03, 0x05, 0x03, 0x03, 0x06, 0x01,
+    0x9E, 0x00, 0x05, 0x03, 0x15, 0x13, 0x62, 0x0D, 0x2E, 0x81, 0x72, 0x82, 0x50, 0x83, 0x72, 0x12,
+    0x50, 0x72, 0x72, 0x6B, 0x35, 0x78, 0x8A, 0x0D, 0x5A, 0x5A, 0x2E, 0x72, 0x2E, 0x41, 0x0B, 0x15,
+    0x3D, 0x00, 0x02, 0x96, 0x00, 0x0D, 0x02, 0x48, 0x0B, 0x6B, 0x5C, 0x0B, 0x07, 0x00, 0x08, 0x0B,
+    0x0B, 0x54, 0x05, 0x02, 0x83, 0x00, 0x0E, 0x91, 0x26, 0x02, 0x00, 0x04, 0x00, 0x02, 0x30, 0x81,
+    0x0B, 0x00, 0x49, 0x20, 0x2B, 0x02, 0x83, 0x00, 0x03, 0x07, 0x03, 0x03, 0x02, 0xA8, 0x00, 0xAF,
+    0x00, 0x08, 0x02, 0x01, 0x00, 0x00, 0x04, 0x04, 0x4F, 0x62, 0x01, 0x86, 0x00, 0x81, 0x01, 0x81,
+    0x06, 0x81, 0x01, 0x9E, 0x00, 0x0A, 0x32, 0x0D, 0x58, 0x13, 0x8A, 0x5A, 0x2E, 0x50, 0x72, 0x4C,
+    0x50, 0x84, 0x72, 0x81, 0x4C, 0x0F, 0x32, 0x35, 0x2C, 0x0B, 0x40, 0x5C, 0x0B, 0x0B, 0x5C, 0x6B,
+    0x13, 0x15, 0x40, 0x41, 0x04, 0x34, 0x96, 0x00, 0x08, 0x01, 0x58, 0x15, 0x5C, 0x0D, 0x15, 0x0A,
+    0x01, 0x13, 0x82, 0x0B, 0x01, 0x54, 0x05, 0x84, 0x00, 0x0D, 0x63, 0x86, 0x00, 0x04, 0x00, 0x5F,
+    0x30, 0x90, 0x01, 0x00, 0x3D, 0x71, 0x47, 0x3D, 0x84, 0x00, 0x80, 0x04, 0x81, 0x03, 0xA8, 0x00,
+    0xB1, 0x00, 0x80, 0x22, 0x83, 0x00, 0x02, 0x01, 0x07, 0x02, 0x87, 0x00, 0x03, 0x02, 0x01, 0x01,
+    0x07, 0x81, 0x02, 0x9B, 0x00, 0x07, 0x01, 0x5C, 0x40, 0x54, 0x0A, 0x5C, 0x5C, 0x40, 0x82, 0x2E,
+    0x84, 0x4C, 0x13, 0x50, 0x5A, 0x0D, 0x02, 0x11, 0x11, 0x05, 0x41, 0x55, 0x08, 0x0A, 0x32, 0x5C,
+    0x54, 0x40, 0x72, 0x2E, 0x0B, 0x00, 0x04, 0x95, 0x00, 0x09, 0x48, 0x0B, 0x73, 0x0D, 0x0D, 0x5C,
+    0x58, 0x06, 0x13, 0x54, 0x82, 0x0B, 0x01, 0x87, 0x01, 0x83, 0x00, 0x07, 0x07, 0x63, 0x00, 0x00,
+    0x04, 0x08, 0x8C, 0x86, 0x82, 0x00, 0x02, 0x01, 0x37, 0x22, 0x85, 0x00, 0x02, 0x01, 0x03, 0x01,
+    0xA7, 0x00, 0xB0, 0x00, 0x80, 0x04, 0x81, 0x00, 0x81, 0x02, 0x85, 0x00, 0x01, 0x02, 0x22, 0x86,
+    0x00, 0x80, 0x01, 0x82, 0x02, 0x9A, 0x00, 0x23, 0x0A, 0x0D, 0x40, 0x73, 0x00, 0x32, 0x50, 0x2E,
+    0x40, 0x5A, 0x40, 0x2E, 0x2E, 0x5A, 0x5A, 0x40, 0x40, 0x0D, 0x55, 0x02, 0x11, 0x4B, 0x48, 0x0D,
+    0x40, 0x5A, 0x2E, 0x72, 0x72, 0x5C, 0x0D, 0x5C, 0x85, 0x65, 0x00, 0x34, 0x94, 0x00, 0x01, 0x01,
+    0x13, 0x81, 0x54, 0x82, 0x5C, 0x09, 0x0B, 0x48, 0x08, 0x54, 0x54, 0x32, 0x54, 0x87, 0x03, 0x02,
+    0x83, 0x00, 0x06, 0x91, 0x01, 0x00, 0x00, 0x0A, 0x6A, 0x4F, 0x82, 0x00, 0x01, 0x03, 0x63, 0x87,
+    0x00, 0x01, 0x07, 0x03, 0xA7, 0x00, 0xB6, 0x00, 0x80, 0x07, 0x83, 0x00, 0x02, 0x01, 0x0A, 0x02,
+    0x88, 0x00, 0x01, 0x01, 0x02, 0x99, 0x00, 0x16, 0x08, 0x0D, 0x40, 0x5C, 0x07, 0x01, 0x5C, 0x72,
+    0x50, 0x40, 0x5A, 0x5A, 0x2E, 0x40, 0x5A, 0x2E, 0x40, 0x40, 0x0D, 0x00, 0x11, 0x0F, 0x13, 0x82,
+    0x40, 0x0B, 0x6B, 0x0B, 0x54, 0x5D, 0x5C, 0x40, 0x00, 0x32, 0x03, 0x00, 0x05, 0x06, 0x92, 0x00,
+    0x10, 0x03, 0x58, 0x32, 0x0B, 0x0D, 0x0D, 0x5C, 0x0B, 0x05, 0x08, 0x87, 0x32, 0x13, 0x13, 0x87,
+    0x08, 0x06, 0x83, 0x00, 0x80, 0x01, 0x82, 0x00, 0x08, 0x02, 0x37, 0x9A, 0x04, 0x34, 0x06, 0x37,
+    0x03, 0x01, 0x87, 0x00, 0x80, 0x03, 0xA7, 0x00, 0xB3, 0x00, 0x09, 0x04, 0x00, 0x00, 0x02, 0x01,
+    0x07, 0x01, 0x02, 0x06, 0x0A, 0x89, 0x00, 0x82, 0x02, 0x94, 0x00, 0x80, 0x04, 0x82, 0x00, 0x27,
+    0x87, 0x5C, 0x40, 0x40, 0x08, 0x03, 0x58, 0x40, 0x72, 0x72, 0x2E, 0x72, 0x2E, 0x40, 0x2E, 0x50,
+    0x2E, 0x2E, 0x41, 0x00, 0x30, 0x11, 0x13, 0x0D, 0x5A, 0x0D, 0x0D, 0x6B, 0x5A, 0x32, 0x5C, 0x40,
+    0x00, 0x08, 0x08, 0x03, 0x0B, 0x8A, 0x0A, 0x02, 0x8F, 0x00, 0x11, 0x03, 0x87, 0x0B, 0x15, 0x5C,
+    0x40, 0x40, 0x0D, 0x0B, 0x08, 0x05, 0x87, 0x32, 0x13, 0x13, 0x08, 0x05, 0x06, 0x88, 0x00, 0x07,
+    0x04, 0x55, 0x4F, 0x91, 0xA1, 0x05, 0x00, 0x07, 0x87, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xB7, 0x00,
+    0x05, 0x02, 0x01, 0x01, 0x06, 0x0A, 0x1C, 0x89, 0x00, 0x81, 0x02, 0x81, 0x01, 0x92, 0x00, 0x2C,
+    0x01, 0x49, 0x00, 0x00, 0x02, 0x87, 0x15, 0x40, 0x40, 0x32, 0x48, 0x47, 0x5C, 0x40, 0x50, 0x72,
+    0x72, 0x50, 0x2E, 0x5A, 0x2E, 0x2E, 0x50, 0x8A, 0x00, 0x11, 0x2C, 0x15, 0x50, 0x0D, 0x54, 0x0A,
+    0x58, 0x0D, 0x0D, 0x96, 0x5A, 0x55, 0x40, 0x6B, 0x87, 0x5C, 0x5C, 0x0B, 0x05, 0x8E, 0x00, 0x0B,
+    0x07, 0x58, 0x0B, 0x0B, 0x15, 0x0D, 0x5A, 0x5A, 0x0D, 0x6B, 0x58, 0x05, 0x82, 0x32, 0x03, 0x87,
+    0x13, 0x62, 0x02, 0x82, 0x00, 0x80, 0x04, 0x85, 0x00, 0x05, 0x03, 0x85, 0x41, 0x3C, 0x7B, 0x04,
+    0x83, 0x00, 0x80, 0x02, 0xAC, 0x00, 0x8C, 0x00, 0x80, 0x04, 0x8E, 0x00, 0x80, 0x04, 0x9D, 0x00,
+    0x05, 0x03, 0x0A, 0x00, 0x00, 0x03, 0x75, 0x87, 0x00, 0x02, 0x04, 0x02, 0x01, 0x91, 0x00, 0x0F,
+    0x45, 0x22, 0x00, 0x00, 0x05, 0x87, 0x41, 0x40, 0x40, 0x13, 0x87, 0x15, 0x0D, 0x40, 0x5A, 0x2E,
+    0x82, 0x72, 0x1E, 0x2E, 0x5A, 0x2E, 0x5A, 0x47, 0x00, 0x30, 0x11, 0x13, 0x05, 0x62, 0x0A, 0x58,
+    0x08, 0x0D, 0x2E, 0x3D, 0x5A, 0x5A, 0x0D, 0x0B, 0x5C, 0x15, 0x15, 0x73, 0x8A, 0x03, 0x06, 0x62,
+    0x05, 0x06, 0x87, 0x00, 0x0F, 0x01, 0x0A, 0x87, 0x54, 0x0B, 0x6B, 0x5C, 0x65, 0x5A, 0x5A, 0x0D,
+    0x54, 0x13, 0x13, 0x05, 0x03, 0x82, 0x06, 0x80, 0x02, 0x85, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03,
+    0x82, 0x00, 0x04, 0x4F, 0x25, 0x63, 0x00, 0x04, 0xB0, 0x00, 0x84, 0x00, 0x05, 0x02, 0x00, 0x02,
+    0x00, 0x00, 0x02, 0x83, 0x00, 0x80, 0x02, 0xAB, 0x00, 0x01, 0x03, 0x0A, 0x82, 0x00, 0x03, 0x48,
+    0x37, 0x26, 0x01, 0x99, 0x00, 0x10, 0x60, 0x01, 0x00, 0x00, 0x08, 0x87, 0x6B, 0x65, 0x5A, 0x8A,
+    0x03, 0x15, 0x5A, 0x40, 0x2E, 0x50, 0x2E, 0x82, 0x72, 0x1E, 0x2E, 0x40, 0x5A, 0x65, 0x02, 0x30,
+    0x11, 0x13, 0x55, 0x0D, 0x5C, 0x0D, 0x0D, 0x2E, 0x8A, 0x05, 0x5C, 0x0A, 0x01, 0x3C, 0x0B, 0x0B,
+    0x15, 0x15, 0x6B, 0x73, 0x0B, 0x0B, 0x15, 0x13, 0x02, 0x85, 0x00, 0x02, 0x9F, 0x03, 0x08, 0x83,
+    0x32, 0x08, 0x15, 0x0D, 0x40, 0x40, 0x15, 0x0B, 0x32, 0x05, 0x02, 0x83, 0x00, 0x81, 0x01, 0x86,
+    0x00, 0x06, 0x25, 0x7E, 0x00, 0x00, 0x56, 0x2D, 0x56, 0x92, 0x00, 0x02, 0x04, 0x00, 0x02, 0x8D,
+    0x00, 0x80, 0x04, 0x8E, 0x00, 0x80, 0x04, 0x86, 0x00, 0x80, 0x04, 0x82, 0x00, 0x80, 0x04, 0xAE,
+    0x00, 0x01, 0x06, 0x0A, 0x83, 0x00, 0x03, 0x01, 0x26, 0x68, 0x56, 0x98, 0x00, 0x0F, 0x18, 0x04,
+    0x00, 0x01, 0x87, 0x87, 0x0B, 0x0D, 0x5A, 0x0B, 0x03, 0x0B, 0x0D, 0x40, 0x2E, 0x50, 0x81, 0x2E,
+    0x82, 0x72, 0x82, 0x2E, 0x11, 0x02, 0x35, 0x67, 0x13, 0x55, 0x40, 0x5C, 0x54, 0x87, 0x08, 0x5D,
+    0x91, 0x0D, 0x02, 0x08, 0x0B, 0x15, 0x5C, 0x83, 0x0D, 0x07, 0x5C, 0x15, 0x15, 0x58, 0x03, 0x00,
+    0x00, 0x02, 0x82, 0x01, 0x15, 0x00, 0x03, 0x05, 0x05, 0x08, 0x03, 0x01, 0x1C, 0x15, 0x5C, 0x0D,
+    0x5C, 0x0B, 0x08, 0x01, 0x00, 0x01, 0x06, 0x06, 0x02, 0x00, 0x34, 0x85, 0x00, 0x08, 0x60, 0x2D,
+    0x75, 0x00, 0x29, 0x2D, 0x86, 0x00, 0x04, 0xB2, 0x00, 0x8D, 0x00, 0x80, 0x5D, 0x89, 0x00, 0x80,
+    0x04, 0xA1, 0x00, 0x01, 0x01, 0x0A, 0x83, 0x00, 0x06, 0x04, 0x00, 0x63, 0x2B, 0x29, 0x05, 0x04,
+    0x94, 0x00, 0x3A, 0x49, 0x18, 0x00, 0x00, 0x05, 0x32, 0x87, 0x15, 0x0D, 0x40, 0x41, 0x9F, 0x0B,
+    0x40, 0x71, 0x5A, 0x2E, 0x2E, 0x4C, 0x72, 0x72, 0x12, 0x72, 0x50, 0x50, 0x02, 0x6E, 0x64, 0x13,
+    0x58, 0x0B, 0x05, 0x03, 0x08, 0x5C, 0x5C, 0x07, 0x5A, 0x47, 0x13, 0x0D, 0x0D, 0x71, 0x65, 0x40,
+    0x0D, 0x5C, 0x15, 0x15, 0x0B, 0x87, 0x03, 0x00, 0x00, 0x02, 0x01, 0x03, 0x03, 0x48, 0x83, 0x87,
+    0x13, 0x08, 0x05, 0x05, 0x15, 0x40, 0x5A, 0x40, 0x6B, 0x03, 0x03, 0x13, 0x08, 0x62, 0x01, 0x03,
+    0x08, 0x8A, 0x8A, 0x32, 0x03, 0x82, 0x00, 0x09, 0x06, 0x00, 0x00, 0x2D, 0x23, 0x03, 0x00, 0x04,
+    0x00, 0x02, 0x99, 0x00, 0x80, 0x02, 0x83, 0x00, 0x80, 0x02, 0x88, 0x00, 0x80, 0x02, 0x86, 0x00,
+    0x80, 0x01, 0x03, 0x8A, 0x73, 0x8A, 0x32, 0x83, 0x92, 0x07, 0x73, 0x9A, 0x0B, 0x9A, 0x73, 0x8A,
+    0x13, 0x92, 0x82, 0x9A, 0x12, 0x0B, 0x9A, 0x9A, 0x92, 0x9A, 0x92, 0x92, 0x90, 0xA1, 0x37, 0x3B,
+    0x85, 0x92, 0x85, 0x05, 0x3D, 0x1C, 0x03, 0x04, 0x95, 0x00, 0x01, 0x06, 0x0A, 0x87, 0x00, 0x03,
+    0x18, 0x68, 0x86, 0x02, 0x93, 0x00, 0x5A, 0x18, 0x60, 0x00, 0x02, 0x58, 0x32, 0x87, 0x15, 0x40,
+    0x5A, 0x0D, 0x01, 0x13, 0x0D, 0x0D, 0x2E, 0x4C, 0x4C, 0x72, 0x72, 0x50, 0x72, 0x2E, 0x5A, 0x40,
+    0x00, 0x19, 0x2C, 0x05, 0x87, 0x15, 0x0B, 0x5C, 0x40, 0x2E, 0x40, 0x9F, 0x5B, 0x19, 0x91, 0x0D,
+    0x55, 0x0D, 0x5C, 0x0D, 0x5C, 0x6B, 0x6B, 0x41, 0x54, 0x87, 0x48, 0x02, 0x9F, 0x02, 0x00, 0x01,
+    0x01, 0x06, 0x05, 0x32, 0x6B, 0x6B, 0x15, 0x0B, 0x13, 0x0D, 0x50, 0x5A, 0x0D, 0x55, 0x54, 0x13,
+    0x03, 0x13, 0x32, 0x6B, 0x6B, 0x85, 0x91, 0x04, 0x00, 0x02, 0x00, 0x00, 0x02, 0x1A, 0x01, 0x42,
+    0x4D, 0x02, 0x83, 0x00, 0x02, 0x04, 0x00, 0x02, 0x89, 0x00, 0x0A, 0x04, 0x01, 0x01, 0x03, 0x05,
+    0x08, 0x3B, 0x3B, 0x85, 0x92, 0x90, 0x82, 0x9A, 0x01, 0x41, 0x9A, 0x83, 0x90, 0x11, 0x92, 0x3B,
+    0xA1, 0x8A, 0x8A, 0x47, 0x85, 0x3B, 0x8A, 0x0B, 0x92, 0x37, 0x92, 0x37, 0x37, 0x47, 0x37, 0x3B,
+    0x06, 0x4C, 0x5E, 0x5E, 0x8C, 0x5B, 0x5E, 0x5B, 0x81, 0x5E, 0x83, 0x78, 0x1A, 0x19, 0x8C, 0x8C,
+    0x33, 0x78, 0x33, 0x33, 0x19, 0x19, 0x78, 0x33, 0x78, 0x78, 0x9D, 0x78, 0x68, 0x65, 0x78, 0x19,
+    0x5E, 0x8C, 0x80, 0x65, 0x55, 0x3B, 0x62, 0x02, 0x93, 0x00, 0x01, 0x02, 0x62, 0x87, 0x00, 0x81,
+    0x07, 0x81, 0x1A, 0x02, 0x49, 0x00, 0x07, 0x90, 0x00, 0x0E, 0x60, 0x1C, 0x00, 0x06, 0x0B, 0x54,
+    0x13, 0x54, 0x0D, 0x5A, 0x40, 0x3B, 0x58, 0x0D, 0x40, 0x83, 0x5A, 0x19, 0x2E, 0x50, 0x2E, 0x2E,
+    0x40, 0x5C, 0x00, 0x19, 0x68, 0x03, 0x55, 0x40, 0x40, 0x71, 0x6B, 0x58, 0x01, 0x02, 0x0D, 0xA1,
+    0x03, 0x5C, 0x5C, 0x0D, 0x0D, 0x5C, 0x82, 0x15, 0x03, 0x54, 0x13, 0x05, 0x03, 0x83, 0x02, 0x05,
+    0x01, 0x06, 0x75, 0x62, 0x87, 0x0B, 0x82, 0x15, 0x19, 0x0B, 0x41, 0x5A, 0x40, 0x6B, 0x03, 0x05,
+    0x79, 0x47, 0x92, 0x3D, 0x01, 0x00, 0x00, 0x06, 0x03, 0x62, 0x02, 0x34, 0x00, 0x00, 0x22, 0x3D,
+    0x24, 0x18, 0x02, 0x84, 0x00, 0x01, 0x04, 0x02, 0x88, 0x00, 0x26, 0x01, 0x05, 0x3B, 0x92, 0x9A,
+    0x41, 0x0D, 0x71, 0x80, 0x6A, 0x80, 0x5E, 0x4C, 0x78, 0x19, 0x9D, 0x78, 0x5E, 0x5E, 0x78, 0x5E,
+    0x5B, 0x5B, 0x35, 0x2B, 0x41, 0x41, 0x0D, 0x41, 0x71, 0x5B, 0x4C, 0x50, 0x5E, 0x5B, 0x5E, 0x5E,
+    0x50, 0x80, 0x81, 0x19, 0x12, 0x4B, 0x19, 0x5E, 0x19, 0x0F, 0x4B, 0x4B, 0x19, 0x11, 0x0F, 0x19,
+    0x0F, 0x11, 0x19, 0x11, 0x0F, 0x11, 0x2A, 0x11, 0x83, 0x2A, 0x10, 0x1D, 0x2C, 0x19, 0x5E, 0x71,
+    0x67, 0x11, 0x2C, 0x0F, 0x9D, 0x5B, 0x6A, 0x41, 0x8A, 0x05, 0x03, 0x01, 0x91, 0x00, 0x04, 0x01,
+    0x06, 0x00, 0x00, 0x02, 0x82, 0x00, 0x80, 0x01, 0x82, 0x00, 0x04, 0x04, 0x49, 0x1F, 0x18, 0x07,
+    0x90, 0x00, 0x13, 0x45, 0x04, 0x00, 0x06, 0x15, 0x0B, 0x0A, 0x87, 0x5C, 0x40, 0x5A, 0x0A, 0x05,
+    0x9A, 0x15, 0x0D, 0x6A, 0x71, 0x0D, 0x40, 0x82, 0x2E, 0x41, 0x5A, 0x15, 0x00, 0x19, 0x26, 0x03,
+    0x71, 0x0D, 0x32, 0x48, 0x02, 0x87, 0x75, 0x96, 0x47, 0x00, 0x58, 0x32, 0x0D, 0x40, 0x0D, 0x15,
+    0x0B, 0x0B, 0x54, 0x08, 0x62, 0x01, 0x02, 0x02, 0x06, 0x03, 0x48, 0x0A, 0x08, 0x03, 0x48, 0x03,
+    0x05, 0x08, 0x3B, 0x37, 0x55, 0x5A, 0x5A, 0x6A, 0x26, 0x5B, 0x19, 0x68, 0x03, 0x34, 0x9F, 0x05,
+    0x13, 0x13, 0x48, 0x06, 0x02, 0x02, 0x00, 0x56, 0x45, 0x00, 0x63, 0x2B, 0x82, 0x00, 0x02, 0x04,
+    0x22, 0x02, 0x8A, 0x00, 0x0F, 0x03, 0x0A, 0x37, 0x41, 0x6A, 0x5B, 0x4C, 0x5E, 0x5E, 0x19, 0x0F,
+    0x19, 0x19, 0x0F, 0x67, 0x64, 0x82, 0x67, 0x81, 0x1D, 0x81, 0x11, 0x0A, 0x1D, 0x24, 0x80, 0x80,
+    0x5B, 0x5B, 0x80, 0x6B, 0x4B, 0x0F, 0x4B, 0x84, 0x0F, 0x80, 0x19, 0x15, 0x11, 0x0F, 0x11, 0x2A,
+    0x5E, 0x19, 0x64, 0x4B, 0x11, 0x0F, 0x5E, 0x0F, 0x78, 0x0F, 0x2A, 0x2A, 0x67, 0x11, 0x64, 0x1D,
+    0x67, 0x1D, 0x82, 0x20, 0x10, 0x83, 0x64, 0x11, 0x30, 0x52, 0x31, 0x1D, 0x11, 0x67, 0x0F, 0x5B,
+    0x65, 0x6A, 0x55, 0x92, 0x1C, 0x03, 0x90, 0x00, 0x02, 0x45, 0x1C, 0x01, 0x87, 0x00, 0x80, 0x01,
+    0x83, 0x00, 0x04, 0x86, 0x56, 0x45, 0x00, 0x07, 0x8D, 0x00, 0x5D, 0x1A, 0x00, 0x00, 0x48, 0x5C,
+    0x6B, 0x08, 0x87, 0x5C, 0x0D, 0x40, 0x3B, 0x02, 0x08, 0x0D, 0x5C, 0x41, 0x40, 0x40, 0x0D, 0x40,
+    0x0D, 0x0D, 0x40, 0x13, 0x00, 0x78, 0x71, 0x48, 0x54, 0x13, 0x49, 0x06, 0x03, 0x0D, 0x47, 0x13,
+    0x3B, 0x0B, 0x32, 0x4F, 0x5C, 0x0D, 0x54, 0x87, 0x58, 0x13, 0x13, 0x08, 0x05, 0x62, 0x06, 0x03,
+    0x05, 0x05, 0x3D, 0x3D, 0x05, 0x32, 0x0D, 0x6A, 0x8C, 0x68, 0x68, 0x53, 0x35, 0x30, 0x11, 0x35,
+    0x2B, 0x56, 0x22, 0x02, 0x54, 0x0D, 0x5C, 0x15, 0x15, 0x0B, 0x32, 0x05, 0x05, 0x13, 0x00, 0x82,
+    0x05, 0x00, 0x45, 0x6A, 0x00, 0x00, 0x25, 0x7E, 0x56, 0x8B, 0x00, 0x27, 0x05, 0x92, 0x0D, 0x6A,
+    0x8C, 0x5E, 0x0F, 0x2C, 0x78, 0x5E, 0x0F, 0x67, 0x11, 0x4B, 0x67, 0x2A, 0x67, 0x64, 0x20, 0x31,
+    0x83, 0x2A, 0x2A, 0x14, 0x53, 0x71, 0x68, 0x64, 0x11, 0x19, 0x68, 0x68, 0x2A, 0x2A, 0x0F, 0x11,
+    0x2A, 0x19, 0x67, 0x4B, 0x0F, 0x11, 0x2C, 0x11, 0x2A, 0x19, 0x80, 0x4B, 0x19, 0x0F, 0x4B, 0x6A,
+    0x19, 0x19, 0x4B, 0x11, 0x67, 0x82, 0x0F, 0x81, 0x1D, 0x15, 0x64, 0x1D, 0x83, 0x83, 0x20, 0x24,
+    0x67, 0x4B, 0x68, 0x4D, 0x20, 0x4B, 0x2C, 0x0F, 0x78, 0x5B, 0x0D, 0x41, 0x92, 0x47, 0x3D, 0x02,
+    0x88, 0x00, 0x80, 0x04, 0x85, 0x00, 0x01, 0x4F, 0x49, 0x8C, 0x00, 0x80, 0x02, 0x82, 0x00, 0x02,
+    0x51, 0x81, 0x1F, 0x8B, 0x00, 0x4E, 0x02, 0x60, 0x00, 0x00, 0x32, 0x5C, 0x54, 0x87, 0x58, 0x5C,
+    0x0D, 0x0D, 0x6B, 0x06, 0x02, 0x62, 0x0D, 0x0D, 0x15, 0x5C, 0x40, 0x5C, 0x15, 0x6B, 0x3B, 0x07,
+    0x00, 0x19, 0x71, 0x01, 0x08, 0x13, 0x49, 0x03, 0x0A, 0x32, 0x08, 0x06, 0x0A, 0x06, 0x00, 0x32,
+    0x0B, 0x32, 0x08, 0x13, 0x58, 0x87, 0x87, 0x05, 0x32, 0x03, 0x08, 0x05, 0x06, 0x62, 0x32, 0x0B,
+    0x0B, 0x37, 0x58, 0x62, 0x01, 0x00, 0x04, 0x01, 0x01, 0x5D, 0x06, 0x00, 0x00, 0x04, 0x00, 0x03,
+    0x87, 0x54, 0x05, 0x48, 0x54, 0x82, 0x0B, 0x0C, 0x54, 0x0A, 0x00, 0x82, 0x1C, 0x00, 0x03, 0x55,
+    0x00, 0x00, 0x3F, 0x6A, 0x85, 0x8A, 0x00, 0x28, 0x03, 0x13, 0x41, 0x80, 0x8C, 0x68, 0x68, 0x19,
+    0x11, 0x78, 0x8C, 0x5E, 0x0F, 0x19, 0x2B, 0x19, 0x19, 0x11, 0x2A, 0x24, 0x1D, 0x20, 0x20, 0x27,
+    0x11, 0x71, 0x68, 0x4B, 0x4B, 0x2A, 0x19, 0x19, 0x26, 0x11, 0x2A, 0x68, 0x2A, 0x2A, 0x4B, 0x67,
+    0x0F, 0x81, 0x0F, 0x81, 0x4B, 0x0F, 0x19, 0x8C, 0x55, 0x68, 0x4B, 0x2B, 0x80, 0x2B, 0x78, 0x78,
+    0x4B, 0x19, 0x5E, 0x5B, 0x78, 0x0F, 0x82, 0x11, 0x13, 0x1D, 0x27, 0x24, 0x0F, 0x2B, 0x55, 0x53,
+    0x20, 0x2B, 0x80, 0x78, 0x4B, 0x68, 0x80, 0x71, 0x3B, 0x37, 0x08, 0x91, 0x01, 0x92, 0x00, 0x80,
+    0x01, 0x8E, 0x00, 0x03, 0x1F, 0x35, 0x1C, 0x07, 0x8A, 0x00, 0x4C, 0x45, 0x1A, 0x00, 0x00, 0x54,
+    0x5C, 0x73, 0x13, 0x3B, 0x0D, 0x40, 0x5A, 0x6B, 0x0A, 0x05, 0x00, 0x03, 0x73, 0x40, 0x73, 0x0D,
+    0x0D, 0x15, 0x40, 0x5A, 0x73, 0x00, 0x33, 0x71, 0x02, 0x0A, 0x13, 0x02, 0x0A, 0x13, 0x0B, 0x62,
+    0x02, 0x04, 0x00, 0x00, 0x32, 0x0B, 0x13, 0x0B, 0x79, 0x32, 0x03, 0x03, 0x13, 0x03, 0x02, 0x75,
+    0x01, 0x03, 0x08, 0x3B, 0x05, 0x49, 0x45, 0x03, 0x62, 0x04, 0x00, 0x34, 0x00, 0x00, 0x0D, 0x40,
+    0x15, 0x0B, 0x5C, 0x0D, 0x15, 0x87, 0x03, 0x01, 0x82, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x02, 0x00,
+    0x5F, 0x03, 0x01, 0x03, 0x79, 0x00, 0x00, 0x03, 0x90, 0x08, 0x01, 0x88, 0x00, 0x29, 0x02, 0x03,
+    0x3B, 0x41, 0x8C, 0x5E, 0x5E, 0x8C, 0x71, 0x78, 0x19, 0x80, 0x5B, 0x5E, 0x41, 0x0D, 0x5B, 0x8C,
+    0x19, 0x19, 0x5E, 0x19, 0x11, 0x11, 0x2A, 0x5F, 0x55, 0x19, 0x68, 0x26, 0x68, 0x2B, 0x80, 0x3C,
+    0x26, 0x53, 0x68, 0x8C, 0x19, 0x0F, 0x0F, 0x19, 0x81, 0x19, 0x28, 0x78, 0x8C, 0x8C, 0x5B, 0x3B,
+    0x6A, 0x5B, 0x68, 0x5B, 0x6A, 0x53, 0x78, 0x5B, 0x6A, 0x80, 0x71, 0x5B, 0x68, 0x8C, 0x2B, 0x19,
+    0x68, 0x6E, 0x11, 0x6A, 0x90, 0x3B, 0x35, 0x11, 0x3B, 0x5F, 0x19, 0x68, 0x80, 0x41, 0x9A, 0x3B,
+    0x1C, 0x05, 0x03, 0x02, 0x87, 0x00, 0x05, 0x07, 0x4F, 0x01, 0x00, 0x00, 0x04, 0x83, 0x00, 0x01,
+    0x01, 0x22, 0x8E, 0x00, 0x01, 0x2B, 0x26, 0x88, 0x00, 0x80, 0x01, 0x82, 0x00, 0x26, 0x60, 0x63,
+    0x04, 0x00, 0x54, 0x5C, 0x55, 0x13, 0x3B, 0x0D, 0x40, 0x2E, 0x40, 0x05, 0x0A, 0x0B, 0x05, 0x00,
+    0x15, 0x8C, 0x0D, 0x41, 0x0D, 0x5A, 0x50, 0x5C, 0x00, 0x0F, 0x26, 0x04, 0x73, 0x5C, 0x0B, 0x13,
+    0x05, 0x13, 0x02, 0x01, 0x04, 0x81, 0x00, 0x83, 0x0B, 0x31, 0x58, 0x08, 0x13, 0x05, 0x62, 0x3D,
+    0x73, 0x03, 0x3D, 0x54, 0x0B, 0x15, 0x5C, 0x0D, 0x40, 0x71, 0x58, 0x03, 0x32, 0x13, 0x05, 0x0D,
+    0x4C, 0x40, 0x54, 0x0B, 0x40, 0x5A, 0x6B, 0x01, 0x02, 0x01, 0x02, 0x03, 0x06, 0x03, 0x48, 0x75,
+    0x00, 0x34, 0x18, 0x02, 0x00, 0x00, 0x79, 0x00, 0x34, 0x07, 0x01, 0x4F, 0x89, 0x00, 0x29, 0x02,
+    0x62, 0x47, 0x26, 0x80, 0x5B, 0x80, 0x8C, 0x6A, 0x26, 0x71, 0x80, 0x80, 0x6A, 0x79, 0x9A, 0x8C,
+    0x26, 0x26, 0x78, 0x68, 0x82, 0x82, 0x68, 0x2B, 0x86, 0x79, 0x26, 0x55, 0x37, 0x71, 0x26, 0x68,
+    0x85, 0x3C, 0x90, 0x52, 0x68, 0x68, 0x35, 0x68, 0x5B, 0x0F, 0x5E, 0x68, 0x80, 0x6A, 0x41, 0x26,
+    0x01, 0x47, 0x41, 0x2B, 0x80, 0x9A, 0x55, 0x5B, 0x80, 0x92, 0x82, 0x55, 0x17, 0x80, 0x71, 0x71,
+    0x78, 0x55, 0x2B, 0x53, 0x37, 0x85, 0x92, 0x35, 0x6A, 0x08, 0x26, 0x2B, 0x5B, 0x26, 0x41, 0x55,
+    0x05, 0x03, 0x03, 0x22, 0x02, 0x87, 0x00, 0x03, 0x60, 0x6E, 0x82, 0x07, 0x83, 0x00, 0x02, 0x01,
+    0x56, 0x03, 0x8E, 0x00, 0x02, 0x03, 0x68, 0x3C, 0x84, 0x00, 0x40, 0x1C, 0x7E, 0x25, 0x30, 0x1F,
+    0x02, 0x00, 0x00, 0x01, 0x49, 0x00, 0x00, 0x0B, 0x41, 0x55, 0x13, 0x05, 0x5C, 0x40, 0x5A, 0x2E,
+    0x54, 0x05, 0x0D, 0x0D, 0x08, 0x00, 0x13, 0x40, 0x40, 0x0D, 0x0B, 0x15, 0x40, 0x05, 0x0F, 0x80,
+    0x03, 0x54, 0x13, 0x07, 0x00, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x06, 0x48, 0x15, 0x15, 0x6B, 0x8A,
+    0x05, 0x75, 0x62, 0x13, 0x3C, 0x27, 0x4F, 0x05, 0x0D, 0x40, 0x15, 0x5C, 0x81, 0x0D, 0x82, 0x0B,
+    0x20, 0x08, 0x15, 0x40, 0x0D, 0x72, 0x72, 0x40, 0x40, 0x5A, 0x5C, 0x03, 0x03, 0x13, 0x79, 0x32,
+    0x54, 0x15, 0x15, 0x0D, 0x6B, 0x48, 0x00, 0x00, 0x18, 0x22, 0x00, 0x00, 0x79, 0x03, 0x00, 0x01,
+    0x3D, 0x45, 0x89, 0x00, 0x03, 0x01, 0x0A, 0x3B, 0x41, 0x82, 0x80, 0x22, 0x68, 0x90, 0x90, 0x26,
+    0x3B, 0x71, 0x9A, 0x85, 0x26, 0x55, 0x79, 0x37, 0x2B, 0x8C, 0x26, 0x80, 0x53, 0x0A, 0x1C, 0x05,
+    0x55, 0x47, 0x85, 0x26, 0x47, 0x8C, 0x3C, 0x03, 0x85, 0x37, 0x79, 0x55, 0x2B, 0x80, 0x6A, 0x2A,
+    0x26, 0x73, 0x90, 0x85, 0x26, 0x3B, 0x22, 0x3D, 0x79, 0x92, 0x3B, 0x47, 0x3B, 0x3B, 0xA1, 0x3C,
+    0x0A, 0x92, 0x3B, 0xA1, 0x80, 0xA1, 0x6A, 0x55, 0x8C, 0x79, 0x03, 0x85, 0x90, 0x52, 0x05, 0x3C,
+    0x05, 0x6A, 0x26, 0x90, 0x55, 0x37, 0x86, 0x06, 0x01, 0x01, 0x02, 0x85, 0x00, 0x0C, 0x04, 0x00,
+    0x1C, 0x2B, 0x4B, 0x29, 0x82, 0x22, 0x00, 0x00, 0x63, 0x18, 0x03, 0x8C, 0x00, 0x04, 0x04, 0x00,
+    0x4F, 0x8C, 0x03, 0x83, 0x00, 0x06, 0x02, 0x3F, 0x53, 0xA1, 0x82, 0x27, 0x82, 0x84, 0x00, 0x5B,
+    0x01, 0x73, 0x6B, 0x0B, 0x32, 0x48, 0x15, 0x5A, 0x5A, 0x2E, 0x5C, 0x62, 0x0B, 0x40, 0x6A, 0x32,
+    0x00, 0x34, 0x6B, 0x2E, 0x4C, 0x40, 0x32, 0x3C, 0x33, 0x3D, 0x5D, 0x00, 0x00, 0x91, 0x8A, 0x6B,
+    0x48, 0x01, 0x62, 0x02, 0x06, 0x08, 0x15, 0x32, 0x92, 0x54, 0x0A, 0x01, 0x22, 0x06, 0x19, 0x5F,
+    0x00, 0x03, 0x65, 0x32, 0x02, 0x62, 0x05, 0x48, 0x00, 0x00, 0x08, 0x15, 0x40, 0x0D, 0x0D, 0x72,
+    0x72, 0x2E, 0x2E, 0x5A, 0x13, 0x07, 0x4F, 0x6B, 0x5C, 0x6B, 0x55, 0x87, 0x06, 0x58, 0x03, 0x00,
+    0x75, 0x22, 0x18, 0x00, 0x00, 0x04, 0x3B, 0x63, 0x49, 0x01, 0x56, 0x01, 0x89, 0x00, 0x29, 0x01,
+    0x0A, 0x47, 0x73, 0x71, 0x65, 0x41, 0x26, 0x3B, 0x79, 0x26, 0x0A, 0x92, 0x55, 0x85, 0x47, 0x37,
+    0x55, 0x08, 0x96, 0x37, 0x3B, 0x2B, 0x63, 0x01, 0x01, 0x4F, 0x41, 0x0A, 0xA1, 0x63, 0x05, 0x58,
+    0x45, 0x03, 0x1C, 0x03, 0x85, 0x37, 0x37, 0x90, 0x26, 0x26, 0x3C, 0x13, 0x96, 0x03, 0x3B, 0x03,
+    0x00, 0x02, 0x05, 0x85, 0x06, 0x03, 0x4F, 0x05, 0x96, 0x03, 0x02, 0x91, 0x01, 0x4F, 0x55, 0x3B,
+    0x85, 0x92, 0x13, 0x4F, 0x86, 0x96, 0x08, 0x62, 0x1C, 0x85, 0x02, 0x26, 0x37, 0x03, 0x85, 0x3B,
+    0x03, 0x81, 0x01, 0x89, 0x00, 0x01, 0x1C, 0x2B, 0x82, 0x6E, 0x03, 0x25, 0x26, 0x02, 0x49, 0x81,
+    0x07, 0x8E, 0x00, 0x81, 0x26, 0x84, 0x00, 0x07, 0x82, 0x6E, 0x92, 0x55, 0x71, 0x6A, 0x29, 0x01,
+    0x83, 0x00, 0x06, 0x03, 0x73, 0x6B, 0x0B, 0x0B, 0x48, 0x73, 0x82, 0x5A, 0x50, 0x5C, 0x03, 0x15,
+    0x5C, 0x40, 0x5A, 0x6B, 0x01, 0x04, 0x07, 0x41, 0x4C, 0x5A, 0x37, 0x33, 0x91, 0x01, 0x13, 0x54,
+    0x54, 0x08, 0x07, 0x01, 0x00, 0x06, 0x00, 0x00, 0x3B, 0x0B, 0x13, 0x13, 0x87, 0x48, 0x3B, 0x05,
+    0x71, 0x68, 0x00, 0x91, 0x05, 0x15, 0x03, 0x00, 0x07, 0x01, 0x03, 0x13, 0x0B, 0x6B, 0x2E, 0x50,
+    0x54, 0x5C, 0x5A, 0x5C, 0x32, 0x05, 0x08, 0x06, 0x32, 0x13, 0x03, 0x05, 0x3C, 0x05, 0x13, 0x54,
+    0x15, 0x73, 0x3B, 0x02, 0x03, 0x79, 0x04, 0x04, 0x00, 0x37, 0x56, 0x63, 0xA1, 0x85, 0x8A, 0x00,
+    0x29, 0x02, 0x03, 0x0A, 0x47, 0x37, 0x55, 0x92, 0x47, 0x37, 0x85, 0x37, 0x00, 0x3D, 0x79, 0x05,
+    0x01, 0x3C, 0x85, 0x3C, 0x02, 0x02, 0x85, 0x56, 0x00, 0x00, 0x02, 0x03, 0x58, 0x0A, 0x47, 0x00,
+    0x62, 0x01, 0x75, 0x86, 0x01, 0x01, 0x86, 0x01, 0x3C, 0x85, 0x0A, 0x02, 0x49, 0x03, 0x75, 0x81,
+    0x01, 0x82, 0x00, 0x03, 0x01, 0x22, 0x00, 0x01, 0x82, 0x03, 0x81, 0x01, 0x14, 0x07, 0x01, 0x03,
+    0x05, 0x03, 0x62, 0x3D, 0x03, 0x1C, 0x86, 0x03, 0x1C, 0x75, 0x06, 0x3D, 0x00, 0x85, 0x0A, 0x01,
+    0x03, 0x05, 0x8A, 0x00, 0x0C, 0x04, 0x00, 0x01, 0x68, 0x55, 0x56, 0x7E, 0x35, 0x27, 0x7E, 0x01,
+    0x18, 0x4F, 0x8D, 0x00, 0x02, 0x01, 0x6A, 0x85, 0x82, 0x00, 0x09, 0x01, 0x04, 0x16, 0x2B, 0x55,
+    0x6A, 0x26, 0x6A, 0x2B, 0x63, 0x83, 0x00, 0x52, 0x48, 0x0B, 0x6B, 0x6B, 0x0B, 0x05, 0x54, 0x40,
+    0x5A, 0x40, 0x40, 0x13, 0x0B, 0x0D, 0x5A, 0x40, 0x5A, 0x0D, 0x9F, 0x00, 0x00, 0x01, 0x37, 0x0B,
+    0x33, 0x0A, 0x03, 0x08, 0x03, 0x03, 0x02, 0x01, 0x0A, 0x01, 0x05, 0x00, 0x00, 0x13, 0x32, 0x58,
+    0x58, 0x0B, 0x15, 0x0B, 0x32, 0x4B, 0x86, 0x02, 0x50, 0x40, 0x6B, 0x02, 0x62, 0x03, 0x05, 0x5C,
+    0x5C, 0x5A, 0x50, 0x5A, 0x92, 0x05, 0x8C, 0x55, 0x47, 0x6A, 0x71, 0x79, 0x26, 0x68, 0x2B, 0x6A,
+    0x50, 0x5E, 0x71, 0x6A, 0x71, 0x3B, 0x03, 0x00, 0x00, 0x03, 0x79, 0x82, 0x00, 0x81, 0x56, 0x01,
+    0x1C, 0x86, 0x83, 0x00, 0x80, 0x04, 0x87, 0x00, 0x09, 0x01, 0x03, 0x05, 0x91, 0x3D, 0x3C, 0x08,
+    0x3D, 0x4F, 0x03, 0x82, 0x01, 0x1B, 0x22, 0x00, 0x03, 0x06, 0x07, 0x02, 0x01, 0x1C, 0x07, 0x00,
+    0x00, 0x01, 0x75, 0x03, 0x45, 0x49, 0x04, 0x01, 0x00, 0x07, 0x03, 0x00, 0x22, 0x01, 0x75, 0x49,
+    0x03, 0x01, 0x02, 0x02, 0x03, 0x34, 0x84, 0x00, 0x1D, 0x04, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02,
+    0x07, 0x00, 0x00, 0x07, 0x02, 0x02, 0x03, 0x02, 0x75, 0x00, 0x3D, 0x03, 0x02, 0x02, 0x01, 0x01,
+    0x00, 0x00, 0x02, 0x02, 0x7B, 0x00, 0x02, 0x8C, 0x00, 0x0A, 0x04, 0x16, 0x26, 0x45, 0x75, 0x82,
+    0x30, 0x27, 0x82, 0x37, 0x96, 0x8D, 0x00, 0x02, 0x86, 0x6A, 0x03, 0x84, 0x00, 0x02, 0x52, 0x68,
+    0x92, 0x82, 0x26, 0x01, 0x52, 0x56, 0x83, 0x00, 0x07, 0x05, 0x0B, 0x6B, 0x15, 0x54, 0x03, 0x32,
+    0x40, 0x82, 0x5A, 0x3E, 0x05, 0x13, 0x5C, 0x5A, 0x5A, 0x40, 0x2E, 0x40, 0x02, 0x00, 0x04, 0x00,
+    0x63, 0x33, 0x91, 0x02, 0x02, 0x00, 0x02, 0x0A, 0x13, 0x05, 0x00, 0x48, 0x02, 0x0A, 0x0B, 0x32,
+    0x87, 0x0B, 0x6B, 0x13, 0x87, 0x3B, 0x2A, 0x26, 0x00, 0x0B, 0x71, 0x92, 0x48, 0x40, 0x15, 0x0B,
+    0x2E, 0x0D, 0x62, 0x6B, 0x15, 0x80, 0x4B, 0x4B, 0x2B, 0x82, 0x5E, 0x5E, 0x6A, 0x53, 0x5F, 0x56,
+    0x26, 0x37, 0x49, 0x86, 0x00, 0x01, 0x01, 0x82, 0x83, 0x00, 0x80, 0x91, 0x8E, 0x00, 0x80, 0x04,
+    0x82, 0x00, 0x10, 0x04, 0x07, 0x01, 0x3D, 0x03, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00,
+    0x04, 0x02, 0x02, 0x04, 0x83, 0x00, 0x81, 0x07, 0x0B, 0x48, 0x00, 0x04, 0x00, 0x5D, 0x00, 0x02,
+    0x07, 0x02, 0x00, 0x00, 0x04, 0x81, 0x00, 0xB3, 0x00, 0x0D, 0x68, 0x1A, 0x6E, 0x52, 0x06, 0x60,
+    0x35, 0x6E, 0x86, 0x4F, 0x29, 0x00, 0x00, 0x01, 0x86, 0x00, 0x06, 0x07, 0x00, 0x00, 0x55, 0xA1,
+    0x00, 0x04, 0x83, 0x00, 0x07, 0x18, 0x25, 0x05, 0x92, 0x79, 0x3B, 0x68, 0x51, 0x83, 0x00, 0x1C,
+    0x05, 0x15, 0x15, 0x5C, 0x15, 0x03, 0x54, 0x0D, 0x5A, 0x5A, 0x40, 0x13, 0x05, 0x5C, 0x40, 0x5A,
+    0x5A, 0x40, 0x40, 0x6B, 0x03, 0x00, 0x00, 0x79, 0x33, 0x3D, 0x02, 0x32, 0x48, 0x82, 0x02, 0x81,
+    0x00, 0x1B, 0x75, 0x04, 0x0A, 0x58, 0x32, 0x32, 0x6B, 0x58, 0x15, 0x15, 0x03, 0x91, 0x4B, 0x0B,
+    0x00, 0x0D, 0x1C, 0x3B, 0x71, 0x54, 0x02, 0x54, 0x0B, 0x55, 0x5E, 0x5E, 0x2B, 0x63, 0x87, 0x00,
+    0x04, 0x02, 0x04, 0x00, 0x00, 0x01, 0x81, 0x03, 0x83, 0x00, 0x02, 0x01, 0x26, 0x01, 0xAB, 0x00,
+    0x81, 0x02, 0x8D, 0x00, 0xB0, 0x00, 0x0F, 0x04, 0x00, 0x04, 0x2B, 0x2B, 0x53, 0x11, 0x35, 0x18,
+    0x00, 0x82, 0x7E, 0x45, 0x20, 0x61, 0x18, 0x8A, 0x00, 0x02, 0xA1, 0x47, 0x02, 0x85, 0x00, 0x05,
+    0x29, 0x25, 0xA1, 0x37, 0x29, 0x52, 0x84, 0x00, 0x0E, 0x87, 0x15, 0x15, 0x5C, 0x15, 0x05, 0x08,
+    0x41, 0x40, 0x5A, 0x40, 0x0B, 0x03, 0x15, 0x0D, 0x81, 0x40, 0x82, 0x0D, 0x12, 0x79, 0x3D, 0x00,
+    0x79, 0x33, 0x03, 0x03, 0x0B, 0x08, 0x06, 0x03, 0x62, 0x0A, 0x02, 0x06, 0x01, 0x13, 0x13, 0x32,
+    0x82, 0x0B, 0x10, 0x73, 0x0B, 0x15, 0x02, 0x03, 0x4B, 0x3B, 0x5A, 0x04, 0x01, 0x92, 0x37, 0x26,
+    0x68, 0x4B, 0x19, 0xA1, 0x83, 0x00, 0x14, 0x06, 0x00, 0x05, 0x54, 0x03, 0x00, 0x87, 0x0A, 0x48,
+    0x07, 0x01, 0x01, 0x05, 0x32, 0x6B, 0x32, 0x03, 0x00, 0x01, 0x52, 0x03, 0x83, 0x00, 0x80, 0x04,
+    0xB6, 0x00, 0xB3, 0x00, 0x0E, 0x52, 0x29, 0x29, 0x30, 0x19, 0x11, 0x53, 0x63, 0x00, 0x26, 0x24,
+    0x81, 0x1E, 0x30, 0x7B, 0x87, 0x00, 0x04, 0x02, 0x26, 0x3C, 0x00, 0x04, 0x84, 0x00, 0x05, 0x07,
+    0x82, 0x7E, 0x29, 0x1F, 0x04, 0x84, 0x00, 0x0E, 0x8A, 0x6B, 0x6B, 0x15, 0x15, 0x05, 0x05, 0x15,
+    0x40, 0x5A, 0x5A, 0x0D, 0x03, 0x54, 0x5C, 0x82, 0x40, 0x20, 0x0D, 0x40, 0x5C, 0x54, 0x04, 0x55,
+    0x9D, 0x02, 0x00, 0x03, 0x00, 0x01, 0x62, 0x08, 0x03, 0x04, 0x00, 0x02, 0x0A, 0x3D, 0x48, 0x08,
+    0x62, 0x05, 0x3C, 0x05, 0x13, 0x75, 0x00, 0x6A, 0x0F, 0x2E, 0x58, 0x82, 0x2B, 0x22, 0x80, 0x79,
+    0x5D, 0x02, 0x02, 0x5D, 0x03, 0x05, 0x03, 0x06, 0x07, 0x00, 0x00, 0x32, 0x32, 0x00, 0x86, 0x54,
+    0x32, 0x3B, 0x01, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x79, 0x05, 0x34, 0x04, 0x00, 0x18,
+    0x45, 0xB6, 0x00, 0xB3, 0x00, 0x11, 0x52, 0x2B, 0x9D, 0x11, 0x29, 0x68, 0x0F, 0x6E, 0x82, 0x0A,
+    0x1A, 0x42, 0x81, 0x43, 0x81, 0x52, 0x00, 0x04, 0x85, 0x00, 0x03, 0x01, 0x03, 0x01, 0x04, 0x86,
+    0x00, 0x01, 0x04, 0x07, 0x85, 0x00, 0x1E, 0x02, 0x54, 0x0B, 0x73, 0x6B, 0x0B, 0x05, 0x06, 0x55,
+    0x0D, 0x40, 0x5A, 0x71, 0x05, 0x87, 0x5C, 0x5A, 0x40, 0x5A, 0x40, 0x5A, 0x40, 0x15, 0x00, 0x71,
+    0x50, 0x00, 0x00, 0x01, 0x00, 0x07, 0x81, 0x03, 0x83, 0x00, 0x0F, 0x02, 0x00, 0x02, 0x02, 0x01,
+    0x01, 0x06, 0x13, 0x48, 0x06, 0x02, 0x00, 0x33, 0x6A, 0x00, 0x01, 0x82, 0x00, 0x17, 0x34, 0x04,
+    0x00, 0x48, 0x87, 0x13, 0x0B, 0x15, 0x05, 0x62, 0x3D, 0x00, 0x01, 0x47, 0x55, 0x13, 0x48, 0x0B,
+    0x55, 0x15, 0x08, 0x02, 0x02, 0x01, 0x82, 0x00, 0x06, 0x5F, 0x63, 0x00, 0x07, 0x03, 0x04, 0x01,
+    0xB6, 0x00, 0xAF, 0x00, 0x80, 0x04, 0x82, 0x00, 0x11, 0x5F, 0x2B, 0x7A, 0x30, 0x2C, 0x53, 0x68,
+    0x4B, 0x2A, 0x2A, 0x52, 0x75, 0x16, 0x23, 0x4D, 0x17, 0x42, 0x7B, 0x85, 0x00, 0x80, 0x04, 0x8B,
+    0x00, 0x15, 0x07, 0x00, 0x00, 0x49, 0x00, 0x00, 0x03, 0x54, 0x0B, 0x15, 0x15, 0x0B, 0x0A, 0x02,
+    0x8A, 0x0D, 0x40, 0x5A, 0x0D, 0x13, 0x62, 0x0B, 0x83, 0x40, 0x0B, 0x2E, 0x5A, 0x5C, 0x00, 0x55,
+    0x8C, 0x00, 0x02, 0x0A, 0x9F, 0x06, 0x02, 0x83, 0x00, 0x2B, 0x75, 0x01, 0x03, 0x87, 0x08, 0x32,
+    0x73, 0x0B, 0x54, 0x0B, 0x58, 0x06, 0x00, 0x41, 0x26, 0x00, 0x00, 0x5D, 0x00, 0x04, 0x00, 0x32,
+    0x58, 0x54, 0x6B, 0x0B, 0x3B, 0x32, 0x47, 0x05, 0x03, 0x3D, 0x05, 0x03, 0x08, 0x6A, 0xA1, 0x92,
+    0x96, 0x18, 0x6A, 0x55, 0x05, 0x07, 0x82, 0x00, 0x06, 0x01, 0x3C, 0x00, 0x49, 0x91, 0x49, 0x01,
+    0xB6, 0x00, 0xAF, 0x00, 0x16, 0x04, 0x00, 0x04, 0x00, 0x26, 0x78, 0x8F, 0x8F, 0x7F, 0x67, 0x64,
+    0x0F, 0x4B, 0x24, 0x20, 0x24, 0x26, 0x47, 0x30, 0x1E, 0x17, 0x81, 0x16, 0x87, 0x00, 0x80, 0x04,
+    0x8A, 0x00, 0x04, 0x03, 0x07, 0x00, 0x00, 0x03, 0x81, 0x54, 0x82, 0x15, 0x18, 0x87, 0x02, 0x58,
+    0x0D, 0x40, 0x5A, 0x0D, 0x32, 0x01, 0x13, 0x5C, 0x40, 0x40, 0x0D, 0x40, 0x40, 0x15, 0x00, 0x65,
+    0x65, 0x00, 0x01, 0x06, 0x00, 0x02, 0x82, 0x00, 0x36, 0x4F, 0x06, 0x06, 0x05, 0x0B, 0x0B, 0x15,
+    0x5C, 0x87, 0x32, 0x6B, 0x54, 0x0A, 0x00, 0x00, 0x5D, 0x9F, 0x00, 0x01, 0x9F, 0x06, 0x03, 0x06,
+    0x73, 0x15, 0x55, 0x5C, 0x0D, 0x73, 0x48, 0x48, 0x8A, 0x3C, 0x9A, 0x0B, 0x8A, 0x90, 0x86, 0x26,
+    0x52, 0x6A, 0x92, 0x3B, 0x79, 0x26, 0x79, 0x1C, 0x01, 0x00, 0x07, 0x08, 0x02, 0x00, 0x3D, 0x45,
+    0xB7, 0x00, 0xAF, 0x00, 0x80, 0x5D, 0x82, 0x00, 0x16, 0x26, 0x78, 0x95, 0x7F, 0x8F, 0x8F, 0x4E,
+    0x83, 0x24, 0x4B, 0x6E, 0x81, 0x4D, 0x2D, 0x63, 0x56, 0x24, 0x7D, 0x17, 0x3F, 0x01, 0x00, 0x04,
+    0x8E, 0x00, 0x0E, 0x04, 0x85, 0x01, 0x00, 0x00, 0x05, 0x54, 0x54, 0x0B, 0x0B, 0x6B, 0x87, 0x01,
+    0x87, 0x0D, 0x82, 0x40, 0x19, 0x0B, 0x06, 0x0A, 0x0B, 0x5C, 0x0D, 0x71, 0x40, 0x0D, 0x15, 0x02,
+    0x65, 0x0B, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x07, 0x56, 0x07, 0x01, 0x05, 0x0B, 0x82,
+    0x32, 0x04, 0x08, 0x87, 0x0B, 0x08, 0x9F, 0x83, 0x00, 0x28, 0x04, 0x00, 0x00, 0x05, 0x05, 0x0B,
+    0x15, 0x15, 0x32, 0x8A, 0x13, 0x13, 0x68, 0x4C, 0x5A, 0x0D, 0x63, 0x5A, 0x40, 0x0B, 0x80, 0x37,
+    0x45, 0x1A, 0x5F, 0x26, 0x90, 0x96, 0x96, 0x37, 0x4F, 0x49, 0x00, 0x37, 0x03, 0x00, 0x3D, 0x22,
+    0x00, 0x00, 0x01, 0xB4, 0x00, 0xAF, 0x00, 0x80, 0x04, 0x82, 0x00, 0x14, 0x26, 0x9D, 0x74, 0x16,
+    0x4F, 0x1F, 0x8F, 0x9E, 0x61, 0x1D, 0x30, 0x35, 0x42, 0x4D, 0x4D, 0x30, 0x63, 0x29, 0x81, 0x66,
+    0x2D, 0x84, 0x00, 0x80, 0x02, 0x8A, 0x00, 0x01, 0x07, 0x90, 0x82, 0x00, 0x59, 0x13, 0x54, 0x73,
+    0x15, 0x15, 0x6B, 0x54, 0x02, 0x13, 0x0D, 0x0D, 0x71, 0x40, 0x15, 0x05, 0x87, 0x15, 0x0D, 0x41,
+    0x0D, 0x40, 0x0D, 0x15, 0x02, 0x6A, 0x54, 0x00, 0x00, 0x02, 0x00, 0x01, 0x02, 0x00, 0x86, 0x63,
+    0x00, 0x08, 0x08, 0x54, 0x47, 0x54, 0x32, 0x32, 0x54, 0x87, 0x13, 0x03, 0x9F, 0x02, 0x00, 0x01,
+    0x02, 0x02, 0x00, 0x02, 0x9F, 0x87, 0x5C, 0x0D, 0x65, 0x41, 0x3B, 0x55, 0x78, 0x6B, 0x65, 0x40,
+    0x40, 0x3B, 0x41, 0x2E, 0x6B, 0x55, 0x65, 0x41, 0x90, 0x79, 0x79, 0x55, 0x73, 0x05, 0x91, 0x03,
+    0x01, 0x3B, 0x4F, 0x00, 0x01, 0x1C, 0x1A, 0xB6, 0x00, 0xB0, 0x00, 0x17, 0x04, 0x00, 0x04, 0x56,
+    0x19, 0x16, 0x28, 0x8F, 0x98, 0x8C, 0x88, 0x8F, 0x7F, 0x64, 0x31, 0x2A, 0x30, 0x23, 0x7D, 0x23,
+    0x82, 0x5F, 0x4D, 0x23, 0x84, 0x00, 0x80, 0x04, 0x85, 0x00, 0x06, 0x04, 0x18, 0x5F, 0x00, 0x00,
+    0x3B, 0x63, 0x82, 0x00, 0x03, 0x13, 0x54, 0x54, 0x73, 0x82, 0x0B, 0x09, 0x03, 0x05, 0x15, 0x40,
+    0x65, 0x40, 0x5C, 0x05, 0x87, 0x0B, 0x83, 0x0D, 0x11, 0x5C, 0x6B, 0x03, 0x65, 0x1C, 0x02, 0x00,
+    0x22, 0x02, 0x02, 0x01, 0x86, 0x18, 0x06, 0x03, 0x05, 0x87, 0x0B, 0x82, 0x15, 0x30, 0x0B, 0x54,
+    0x32, 0x54, 0x13, 0x01, 0x03, 0x06, 0x00, 0x01, 0x62, 0x08, 0x13, 0x54, 0x6B, 0x0B, 0x6B, 0x15,
+    0x87, 0x62, 0x06, 0x13, 0x54, 0x0D, 0x71, 0x0D, 0x5A, 0x73, 0x13, 0x5A, 0x5A, 0x0D, 0x65, 0x65,
+    0x41, 0x9A, 0x90, 0x47, 0x3C, 0x05, 0x02, 0x00, 0x63, 0x3C, 0x00, 0x00, 0x30, 0x21, 0x04, 0xB5,
+    0x00, 0xAF, 0x00, 0x81, 0x04, 0x81, 0x00, 0x12, 0xA1, 0xA4, 0x74, 0x9E, 0x8F, 0x8F, 0x98, 0x30,
+    0x2D, 0x8F, 0x28, 0x2D, 0x7C, 0x83, 0x30, 0x24, 0x4D, 0x81, 0x45, 0x81, 0x23, 0x85, 0x00, 0x80,
+    0x02, 0x85, 0x00, 0x0B, 0x04, 0x1A, 0x52, 0x02, 0x79, 0x01, 0x00, 0x00, 0x02, 0x58, 0x54, 0x32,
+    0x83, 0x0B, 0x81, 0x03, 0x11, 0x73, 0x0D, 0x40, 0x40, 0x0D, 0x13, 0x08, 0x32, 0x5C, 0x0D, 0x0D,
+    0x71, 0x0D, 0x15, 0x03, 0x0D, 0x3D, 0x02, 0x82, 0x00, 0x1F, 0x03, 0x1C, 0x86, 0x00, 0x02, 0x62,
+    0x08, 0x58, 0x32, 0x0B, 0x6B, 0x0B, 0x0B, 0x54, 0x32, 0x87, 0x48, 0x01, 0x05, 0x87, 0x06, 0x06,
+    0x48, 0x05, 0x13, 0x9A, 0x0D, 0x40, 0x5C, 0x87, 0x03, 0x02, 0x82, 0x00, 0x18, 0x08, 0x2E, 0x8C,
+    0x41, 0x5A, 0x80, 0x37, 0x6B, 0x0D, 0x65, 0x71, 0x0D, 0x26, 0x55, 0x47, 0x08, 0x05, 0x02, 0x00,
+    0x3D, 0x56, 0x00, 0x00, 0x6E, 0x7E, 0xB6, 0x00, 0xB1, 0x00, 0x03, 0x01, 0x00, 0x56, 0x0F, 0x81,
+    0x88, 0x82, 0x8F, 0x0D, 0x53, 0x23, 0x74, 0x28, 0x9E, 0x9E, 0x89, 0x83, 0x6E, 0x23, 0x43, 0xA1,
+    0x21, 0x23, 0x8E, 0x00, 0x19, 0x56, 0x16, 0x79, 0x04, 0x04, 0x00, 0x02, 0x8A, 0x32, 0x0B, 0x15,
+    0x6B, 0x0B, 0x8A, 0x06, 0x9F, 0x0B, 0x0D, 0x65, 0x40, 0x0D, 0x8A, 0x08, 0x32, 0x15, 0x0D, 0x82,
+    0x5C, 0x03, 0x15, 0x48, 0x5C, 0x03, 0x82, 0x00, 0x0A, 0x01, 0x22, 0x01, 0x00, 0x00, 0x01, 0x0A,
+    0x13, 0x13, 0x32, 0x54, 0x82, 0x0B, 0x81, 0x32, 0x2D, 0x08, 0x01, 0x01, 0x08, 0x58, 0x03, 0x03,
+    0x05, 0x87, 0x8A, 0x9A, 0x5C, 0x6B, 0x13, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x03, 0x41,
+    0x65, 0x65, 0x2E, 0x2E, 0x5A, 0x65, 0x5C, 0x41, 0x41, 0x32, 0x13, 0x56, 0x3C, 0x01, 0x01, 0x00,
+    0x49, 0x85, 0x00, 0x00, 0x56, 0x26, 0x03, 0xB5, 0x00, 0xAF, 0x00, 0x80, 0x34, 0x82, 0x00, 0x02,
+    0x4F, 0x0F, 0x7A, 0x82, 0x8F, 0x11, 0x28, 0x30, 0x9E, 0x8F, 0x1C, 0x25, 0x7F, 0x9E, 0x59, 0x4D,
+    0x4D, 0x17, 0x18, 0x21, 0x14, 0x00, 0x02, 0x01, 0x83, 0x00, 0x80, 0x04, 0x86, 0x00, 0x02, 0x02,
+    0x4F, 0x63, 0x82, 0x00, 0x0B, 0x03, 0x58, 0x58, 0x54, 0x73, 0x15, 0x15, 0x73, 0x48, 0x02, 0x54,
+    0x5C, 0x82, 0x0D, 0x0B, 0x0B, 0x08, 0x54, 0x15, 0x0D, 0x41, 0x5C, 0x6B, 0x0B, 0x05, 0x73, 0x01,
+    0x87, 0x00, 0x03, 0x01, 0x08, 0x13, 0x54, 0x82, 0x0B, 0x0F, 0x54, 0x15, 0x0B, 0x32, 0x05, 0x02,
+    0x03, 0x87, 0x58, 0x05, 0x03, 0x06, 0x48, 0x13, 0x6B, 0x0D, 0x81, 0x54, 0x81, 0x87, 0x83, 0x08,
+    0x1A, 0x03, 0x00, 0x00, 0x02, 0x04, 0x34, 0x9F, 0x91, 0x6B, 0x0D, 0x55, 0x0B, 0x92, 0x37, 0x13,
+    0x26, 0x1C, 0x00, 0x01, 0x02, 0x4F, 0x49, 0x00, 0x18, 0x5F, 0x3C, 0x04, 0xB4, 0x00, 0xB3, 0x00,
+    0x02, 0x75, 0x9D, 0x7A, 0x82, 0x8F, 0x0E, 0x29, 0x7F, 0x8F, 0x8F, 0x7B, 0x7B, 0x4E, 0x14, 0x7F,
+    0x9E, 0x59, 0x17, 0x1A, 0x42, 0x81, 0x86, 0x00, 0x80, 0x04, 0x85, 0x00, 0x80, 0x02, 0x85, 0x00,
+    0x0B, 0x03, 0x54, 0x0A, 0x08, 0x87, 0x32, 0x6B, 0x15, 0x05, 0x02, 0x3B, 0x41, 0x82, 0x0D, 0x03,
+    0x6B, 0x05, 0x58, 0x15, 0x82, 0x5C, 0x04, 0x6B, 0x15, 0x58, 0x3B, 0x01, 0x87, 0x00, 0x16, 0x03,
+    0x08, 0x54, 0x0B, 0x0B, 0x54, 0x0B, 0x54, 0x0B, 0x32, 0x13, 0x03, 0x02, 0x05, 0x87, 0x03, 0x02,
+    0x06, 0x06, 0x0A, 0x54, 0x0B, 0x6B, 0x82, 0x0B, 0x09, 0x32, 0x08, 0x08, 0x58, 0x0B, 0x54, 0x87,
+    0x48, 0x03, 0x02, 0x89, 0x00, 0x01, 0x01, 0x49, 0x82, 0x00, 0x06, 0x96, 0x02, 0x00, 0x91, 0x26,
+    0x05, 0x04, 0xB4, 0x00, 0xB1, 0x00, 0x03, 0x34, 0x00, 0x63, 0xA4, 0x83, 0x8F, 0x80, 0x88, 0x82,
+    0x8F, 0x16, 0x98, 0x7B, 0x8F, 0x7F, 0x4D, 0x61, 0x97, 0x89, 0x29, 0x42, 0x6C, 0x34, 0x22, 0x3D,
+    0x3D, 0x08, 0x96, 0x3B, 0x08, 0x4F, 0x01, 0x00, 0x04, 0x88, 0x00, 0x0B, 0x08, 0x13, 0x48, 0x05,
+    0x08, 0x32, 0x0B, 0x0B, 0x13, 0x01, 0x08, 0x6B, 0x82, 0x0D, 0x0A, 0x15, 0x05, 0x08, 0x54, 0x15,
+    0x41, 0x0D, 0x6B, 0x15, 0x0B, 0x03, 0x87, 0x00, 0x06, 0x01, 0x05, 0x13, 0x54, 0x0B, 0x0B, 0x32,
+    0x82, 0x0B, 0x1C, 0x54, 0x13, 0x03, 0x02, 0x05, 0x05, 0x00, 0x00, 0x02, 0x01, 0x0A, 0x54, 0x0B,
+    0x0B, 0x32, 0x32, 0x8A, 0x0B, 0x15, 0x15, 0x5C, 0x5C, 0x55, 0x5C, 0x32, 0x54, 0x73, 0x32, 0x0A,
+    0x81, 0x07, 0x87, 0x00, 0x08, 0x04, 0x00, 0x00, 0x26, 0x56, 0x00, 0x00, 0xA1, 0x05, 0xB5, 0x00,
+    0xB3, 0x00, 0x1F, 0x51, 0x0F, 0x28, 0x8F, 0x98, 0x8F, 0x7A, 0x8F, 0x9E, 0x7F, 0x98, 0x00, 0x8F,
+    0x8F, 0x9E, 0x69, 0x7C, 0x43, 0x30, 0x42, 0x31, 0x07, 0x47, 0x55, 0x92, 0x73, 0x9A, 0x54, 0x08,
+    0x03, 0x05, 0x01, 0x89, 0x00, 0x19, 0x08, 0x05, 0x13, 0x08, 0x0A, 0x58, 0x0B, 0x15, 0x0A, 0x02,
+    0x05, 0x0B, 0x5C, 0x0D, 0x0D, 0x5C, 0x08, 0x48, 0x13, 0x6B, 0x73, 0x5C, 0x9A, 0x5C, 0x15, 0x03,
+    0x87, 0x00, 0x05, 0x02, 0x03, 0x05, 0x54, 0x0B, 0x15, 0x83, 0x0B, 0x12, 0x87, 0x0A, 0x06, 0x06,
+    0x62, 0x00, 0x00, 0x06, 0x08, 0x0A, 0x13, 0x54, 0x15, 0x55, 0x55, 0x73, 0x0B, 0x0B, 0x6B, 0x82,
+    0x5C, 0x81, 0x0D, 0x0C, 0x71, 0x15, 0x15, 0x5C, 0x0B, 0x9A, 0x3C, 0x08, 0x05, 0x06, 0x02, 0x00,
+    0x01, 0x84, 0x00, 0x01, 0x86, 0x03, 0x81, 0x00, 0x81, 0x37, 0xB5, 0x00, 0xB1, 0x00, 0x19, 0x04,
+    0x02, 0x7B, 0x2C, 0x98, 0x34, 0x07, 0x98, 0x9E, 0x8F, 0x7F, 0x74, 0x00, 0x00, 0x9E, 0x8F, 0x9E,
+    0x69, 0x9B, 0x59, 0x2D, 0x2D, 0x4D, 0x01, 0x03, 0x91, 0x83, 0x00, 0x05, 0x04, 0x01, 0x06, 0x62,
+    0x01, 0x02, 0x82, 0x00, 0x80, 0x02, 0x83, 0x00, 0x1B, 0x13, 0x08, 0x32, 0x13, 0x08, 0x13, 0x32,
+    0x32, 0x05, 0x00, 0x03, 0x54, 0x5C, 0x41, 0x5C, 0x0D, 0x08, 0x03, 0x05, 0x73, 0x73, 0x5C, 0x41,
+    0x0D, 0x0D, 0x08, 0x02, 0x07, 0x85, 0x00, 0x04, 0x06, 0x62, 0x05, 0x87, 0x32, 0x82, 0x0B, 0x0F,
+    0x32, 0x58, 0x08, 0x48, 0x01, 0x03, 0x06, 0x00, 0x00, 0x03, 0x08, 0x13, 0x8A, 0x15, 0x15, 0x9A,
+    0x82, 0x6B, 0x81, 0x15, 0x0F, 0x5C, 0x15, 0x15, 0x0D, 0x41, 0x6B, 0x41, 0x15, 0x0B, 0x0B, 0x54,
+    0x54, 0x32, 0x87, 0x05, 0x02, 0x86, 0x00, 0x05, 0x01, 0x56, 0x00, 0x00, 0x91, 0x26, 0xB5, 0x00,
+    0xB1, 0x00, 0x27, 0x04, 0x00, 0x7B, 0x0F, 0x96, 0x00, 0x98, 0x28, 0x9E, 0x8F, 0x9E, 0x28, 0x00,
+    0x00, 0x88, 0x8F, 0x8F, 0x89, 0x97, 0x9B, 0x2A, 0x30, 0x4D, 0x49, 0x00, 0x01, 0x00, 0x00, 0x05,
+    0x0A, 0x13, 0x58, 0x58, 0x0B, 0x55, 0x58, 0x01, 0x00, 0x02, 0x04, 0x82, 0x00, 0x26, 0x5D, 0x54,
+    0x08, 0x87, 0x32, 0x32, 0x87, 0x05, 0x13, 0x87, 0x02, 0x01, 0x8A, 0x5C, 0x0D, 0x5C, 0x5C, 0x0B,
+    0x22, 0x0A, 0x0B, 0x6B, 0x15, 0x73, 0x15, 0x55, 0x32, 0x00, 0x85, 0x4F, 0x00, 0x04, 0x00, 0x00,
+    0x02, 0x03, 0x0A, 0x87, 0x54, 0x83, 0x0B, 0x05, 0x54, 0x32, 0x08, 0x48, 0x03, 0x02, 0x82, 0x00,
+    0x08, 0x75, 0x0A, 0x05, 0x13, 0x0B, 0x15, 0x0B, 0x15, 0x6B, 0x81, 0x0B, 0x82, 0x15, 0x80, 0x6B,
+    0x86, 0x15, 0x04, 0x0B, 0x15, 0x54, 0x08, 0x03, 0x81, 0x02, 0x85, 0x00, 0x0A, 0x01, 0x4F, 0x01,
+    0x00, 0x00, 0x79, 0x07, 0x00, 0x00, 0x01, 0x34, 0xB0, 0x00, 0xB3, 0x00, 0x23, 0x22, 0x0F, 0x51,
+    0x00, 0x8F, 0x8F, 0x98, 0x9E, 0x8F, 0x00, 0x00, 0x02, 0x98, 0x88, 0x9E, 0x97, 0x9B, 0x97, 0x2D,
+    0x30, 0x4D, 0x22, 0x34, 0x00, 0x00, 0x48, 0x3B, 0x3C, 0x08, 0x58, 0x54, 0x0B, 0x6B, 0x0B, 0x13,
+    0x03, 0x83, 0x00, 0x03, 0x04, 0x91, 0x13, 0x6B, 0x82, 0x13, 0x20, 0x54, 0x13, 0x13, 0x32, 0x02,
+    0x01, 0x58, 0x15, 0x0D, 0x5C, 0x0D, 0x6B, 0x75, 0x08, 0x3B, 0x6B, 0x5C, 0x92, 0x15, 0x5C, 0x48,
+    0x00, 0x85, 0x18, 0x00, 0x04, 0x00, 0x00, 0x01, 0x03, 0x0A, 0x32, 0x54, 0x82, 0x0B, 0x81, 0x54,
+    0x03, 0x32, 0x08, 0x03, 0x02, 0x82, 0x00, 0x0C, 0x02, 0x62, 0x08, 0x13, 0x54, 0x15, 0x15, 0x0B,
+    0x0B, 0x54, 0x0B, 0x0B, 0x73, 0x83, 0x15, 0x81, 0x5C, 0x83, 0x15, 0x81, 0x0B, 0x05, 0x32, 0x05,
+    0x48, 0x03, 0x03, 0x01, 0x85, 0x00, 0x04, 0x1F, 0x1C, 0x00, 0x00, 0x01, 0x82, 0x00, 0x80, 0x02,
+    0xB1, 0x00, 0xB3, 0x00, 0x04, 0x01, 0x9D, 0x28, 0x8F, 0x62, 0x83, 0x8F, 0x3D, 0x45, 0x00, 0x04,
+    0x04, 0x8F, 0x4E, 0x2D, 0x9B, 0x97, 0x2A, 0x30, 0x4D, 0x07, 0x03, 0x05, 0x06, 0x03, 0x08, 0x87,
+    0x73, 0x0B, 0x15, 0x15, 0x0B, 0x8A, 0x8A, 0x3B, 0x02, 0x00, 0x00, 0x02, 0x00, 0x37, 0x08, 0x08,
+    0x54, 0x13, 0x13, 0x54, 0x8A, 0x0B, 0x54, 0x03, 0x02, 0x08, 0x15, 0x5C, 0x5C, 0x0D, 0x15, 0x03,
+    0x05, 0x3B, 0x0B, 0x15, 0x8A, 0x5C, 0x0B, 0x00, 0x01, 0x26, 0x01, 0x83, 0x00, 0x04, 0x03, 0x48,
+    0x05, 0x13, 0x32, 0x81, 0x54, 0x82, 0x32, 0x02, 0x87, 0x05, 0x06, 0x83, 0x00, 0x07, 0x05, 0x08,
+    0x87, 0x32, 0x0B, 0x15, 0x15, 0x0B, 0x83, 0x54, 0x81, 0x0B, 0x81, 0x15, 0x82, 0x5C, 0x82, 0x15,
+    0x09, 0x73, 0x54, 0x0B, 0x32, 0x13, 0x08, 0x05, 0x62, 0x03, 0x02, 0x84, 0x00, 0x01, 0x18, 0x03,
+    0x82, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0xB1, 0x00, 0xB4, 0x00, 0x35, 0x9D, 0x28, 0x8F, 0x8F,
+    0x98, 0x98, 0x8F, 0x98, 0x00, 0x02, 0x00, 0x98, 0x98, 0x8F, 0x7F, 0x59, 0x97, 0x4E, 0x2A, 0x4D,
+    0x49, 0x01, 0x8A, 0x32, 0x8A, 0x32, 0x05, 0x03, 0x08, 0x73, 0x55, 0x73, 0x73, 0x41, 0x5C, 0x15,
+    0x07, 0x00, 0x02, 0x00, 0x80, 0x37, 0x62, 0x0B, 0x32, 0x05, 0x87, 0x32, 0x0B, 0x54, 0x01, 0x02,
+    0x48, 0x0B, 0x83, 0x5C, 0x01, 0x03, 0x48, 0x82, 0x54, 0x81, 0x0B, 0x0C, 0x03, 0x00, 0x79, 0x03,
+    0x01, 0x75, 0x00, 0x00, 0x01, 0x03, 0x05, 0x0A, 0x32, 0x84, 0x54, 0x14, 0x32, 0x13, 0x48, 0x01,
+    0x00, 0x00, 0x01, 0x02, 0x0A, 0x08, 0x13, 0x32, 0x0B, 0x73, 0x6B, 0x73, 0x73, 0x0B, 0x32, 0x54,
+    0x0B, 0x82, 0x73, 0x83, 0x15, 0x0A, 0x6B, 0x73, 0x0B, 0x32, 0x0B, 0x32, 0x87, 0x87, 0x08, 0x03,
+    0x01, 0x85, 0x00, 0x04, 0x18, 0x63, 0x00, 0x45, 0xA1, 0xB5, 0x00, 0xB3, 0x00, 0x2D, 0x01, 0x19,
+    0x28, 0x8F, 0x8F, 0x9E, 0x8F, 0x8F, 0x51, 0x00, 0x00, 0x34, 0x8F, 0x28, 0x98, 0x8F, 0x9E, 0x97,
+    0x74, 0x2A, 0x4D, 0x1C, 0x00, 0x07, 0x91, 0x85, 0x8A, 0x79, 0x6B, 0x0D, 0x40, 0x0D, 0x5C, 0x5C,
+    0x0D, 0x0D, 0x5A, 0x65, 0x03, 0x00, 0x00, 0x5B, 0x2B, 0x01, 0x0B, 0x54, 0x82, 0x13, 0x81, 0x32,
+    0x81, 0x02, 0x01, 0x03, 0x54, 0x83, 0x5C, 0x16, 0x05, 0x03, 0x87, 0x13, 0x54, 0x54, 0x06, 0x00,
+    0x02, 0x08, 0x85, 0x49, 0x00, 0x01, 0x00, 0x75, 0x03, 0x05, 0x13, 0x32, 0x0B, 0x0B, 0x54, 0x82,
+    0x32, 0x01, 0x13, 0x06, 0x82, 0x00, 0x05, 0x01, 0x02, 0x06, 0x05, 0x08, 0x54, 0x83, 0x0B, 0x80,
+    0x15, 0x82, 0x0B, 0x03, 0x73, 0x15, 0x15, 0x6B, 0x83, 0x15, 0x0A, 0x6B, 0x15, 0x0B, 0x54, 0x0B,
+    0x32, 0x13, 0x08, 0x0A, 0x03, 0x02, 0x84, 0x00, 0x0A, 0x04, 0x4F, 0x63, 0x00, 0x18, 0x19, 0x3D,
+    0x49, 0x48, 0x00, 0x02, 0xB0, 0x00, 0xB4, 0x00, 0x14, 0x9D, 0x28, 0x8F, 0x8F, 0x9E, 0x7F, 0x8F,
+    0x98, 0x98, 0x34, 0x51, 0x9E, 0x8F, 0x9E, 0x98, 0x8F, 0x97, 0x88, 0x30, 0x4D, 0x22, 0x83, 0x00,
+    0x1D, 0x01, 0x06, 0x05, 0x8A, 0x9A, 0x41, 0x0D, 0x0D, 0x5C, 0x5C, 0x41, 0x71, 0x15, 0x01, 0x00,
+    0x80, 0x4B, 0x02, 0x08, 0x54, 0x58, 0x87, 0x08, 0x3B, 0x54, 0x03, 0x02, 0x01, 0x32, 0x15, 0x82,
+    0x5C, 0x05, 0x13, 0x02, 0x08, 0x32, 0x54, 0x03, 0x82, 0x00, 0x01, 0x03, 0x3D, 0x82, 0x00, 0x04,
+    0x01, 0x02, 0x87, 0x08, 0x13, 0x85, 0x32, 0x0B, 0x87, 0x05, 0x06, 0x00, 0x00, 0x02, 0x02, 0x01,
+    0x01, 0x48, 0x08, 0x54, 0x82, 0x0B, 0x01, 0x15, 0x0B, 0x83, 0x15, 0x81, 0x6B, 0x86, 0x15, 0x08,
+    0x73, 0x54, 0x0B, 0x32, 0x13, 0x13, 0x05, 0x06, 0x01, 0x85, 0x00, 0x81, 0x03, 0x05, 0x00, 0x03,
+    0x5E, 0xA1, 0x03, 0x73, 0xB2, 0x00, 0xB1, 0x00, 0x81, 0x04, 0x21, 0x00, 0x9D, 0x1F, 0x8F, 0x8F,
+    0x9E, 0x7F, 0x8F, 0x88, 0x8F, 0x5D, 0x7E, 0x59, 0x28, 0x97, 0x59, 0x28, 0x8F, 0x8F, 0x80, 0x81,
+    0x51, 0x00, 0x03, 0x0A, 0x3C, 0x96, 0x07, 0x49, 0x03, 0x01, 0x03, 0x03, 0x01, 0x82, 0x00, 0x26,
+    0x02, 0x05, 0x03, 0x00, 0x13, 0x33, 0x79, 0x02, 0x05, 0x13, 0x13, 0x05, 0x05, 0x87, 0x48, 0x02,
+    0x01, 0x13, 0x15, 0x15, 0x5C, 0x15, 0x87, 0x00, 0x0A, 0x08, 0x03, 0x01, 0x03, 0x01, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x02, 0x03, 0x03, 0x48, 0x81, 0x87, 0x83, 0x32, 0x81, 0x54, 0x0B, 0x87, 0x48,
+    0x06, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x08, 0x13, 0x32, 0x82, 0x0B, 0x80, 0x73, 0x81, 0x0B,
+    0x82, 0x15, 0x82, 0x6B, 0x0F, 0x15, 0x6B, 0x15, 0x15, 0x6B, 0x15, 0x73, 0x0B, 0x54, 0x54, 0x58,
+    0x08, 0x48, 0x06, 0x06, 0x01, 0x84, 0x00, 0x07, 0x1C, 0x86, 0x00, 0x00, 0x58, 0x6A, 0x02, 0x79,
+    0xB2, 0x00, 0xB4, 0x00, 0x41, 0x9D, 0x1A, 0x9E, 0x8F, 0x8F, 0x9E, 0x8F, 0x9E, 0x8F, 0x5D, 0x88,
+    0x7F, 0x9E, 0x8F, 0x97, 0x46, 0x8F, 0x28, 0x91, 0x2B, 0x63, 0x03, 0x92, 0x3B, 0x05, 0x48, 0x0A,
+    0x32, 0x8A, 0x55, 0x55, 0x65, 0x71, 0x55, 0x79, 0x26, 0x47, 0x96, 0x00, 0x5D, 0x34, 0x90, 0x26,
+    0x00, 0x03, 0x05, 0x05, 0x03, 0x03, 0x87, 0x05, 0x02, 0x01, 0x13, 0x15, 0x15, 0x5C, 0x15, 0x87,
+    0x04, 0x48, 0x02, 0x00, 0x62, 0x87, 0x02, 0x84, 0x00, 0x03, 0x03, 0x01, 0x03, 0x48, 0x81, 0x13,
+    0x83, 0x54, 0x81, 0x32, 0x0D, 0x08, 0x06, 0x06, 0x00, 0x02, 0x01, 0x02, 0x05, 0x08, 0x87, 0x32,
+    0x54, 0x0B, 0x73, 0x84, 0x0B, 0x01, 0x73, 0x9A, 0x89, 0x15, 0x03, 0x0B, 0x54, 0x54, 0x3B, 0x82,
+    0x05, 0x01, 0x03, 0x02, 0x84, 0x00, 0x08, 0x02, 0x45, 0x00, 0x00, 0x51, 0x68, 0x45, 0x4F, 0x91,
+    0xB1, 0x00, 0xB4, 0x00, 0x0B, 0x68, 0x1F, 0x8F, 0x88, 0x8F, 0x4E, 0x9E, 0x9E, 0x28, 0x00, 0x88,
+    0x8F, 0x82, 0x9E, 0x30, 0x3A, 0x69, 0x28, 0x3B, 0x90, 0x7B, 0x00, 0x3B, 0x41, 0x71, 0x8C, 0x80,
+    0x26, 0xA1, 0x47, 0x37, 0x55, 0x90, 0x71, 0x8C, 0x4C, 0x50, 0x2E, 0x2E, 0x5A, 0x8C, 0x41, 0x6A,
+    0x07, 0x02, 0x06, 0x05, 0x45, 0x13, 0x13, 0x0A, 0x00, 0x02, 0x05, 0x0B, 0x15, 0x41, 0x6B, 0x0B,
+    0x02, 0x06, 0x01, 0x01, 0x05, 0x85, 0x00, 0x06, 0x01, 0x06, 0x05, 0x03, 0x03, 0x08, 0x87, 0x83,
+    0x32, 0x81, 0x87, 0x81, 0x03, 0x81, 0x00, 0x05, 0x03, 0x01, 0x04, 0x08, 0x08, 0x87, 0x82, 0x54,
+    0x05, 0x0B, 0x73, 0x73, 0x0B, 0x0B, 0x73, 0x84, 0x6B, 0x81, 0x15, 0x81, 0x41, 0x81, 0x15, 0x09,
+    0x73, 0x0B, 0x54, 0x32, 0x32, 0x13, 0x13, 0x05, 0x03, 0x02, 0x84, 0x00, 0x08, 0x01, 0x1F, 0x04,
+    0x00, 0x16, 0x14, 0x37, 0x63, 0x07, 0xB1, 0x00, 0xB2, 0x00, 0x41, 0x04, 0x00, 0x68, 0x56, 0x8F,
+    0x88, 0x88, 0x27, 0x7F, 0x8F, 0x88, 0x00, 0x98, 0x7A, 0x97, 0x9E, 0x69, 0x9E, 0x9B, 0x97, 0x60,
+    0x64, 0x4F, 0x00, 0x04, 0x04, 0x01, 0x45, 0x63, 0x26, 0x80, 0x8C, 0x68, 0x68, 0x29, 0x03, 0x48,
+    0x0A, 0x29, 0x68, 0x8C, 0x50, 0x50, 0x33, 0x33, 0x2A, 0x27, 0x35, 0x55, 0x06, 0x58, 0x54, 0x05,
+    0x02, 0x01, 0x03, 0x54, 0x15, 0x41, 0x6B, 0x0B, 0x01, 0x06, 0x01, 0x01, 0x48, 0x85, 0x00, 0x81,
+    0x02, 0x05, 0x0A, 0x05, 0x48, 0x05, 0x08, 0x87, 0x82, 0x32, 0x0E, 0x13, 0x05, 0x48, 0x01, 0x00,
+    0x02, 0x06, 0x00, 0x01, 0x08, 0x08, 0x13, 0x13, 0x32, 0x54, 0x84, 0x0B, 0x81, 0x15, 0x81, 0x41,
+    0x87, 0x15, 0x82, 0x0B, 0x05, 0x32, 0x58, 0x13, 0x13, 0x0A, 0x03, 0x86, 0x00, 0x07, 0x02, 0x00,
+    0x00, 0x01, 0x85, 0x3B, 0x4F, 0x49, 0xB1, 0x00, 0xB3, 0x00, 0x41, 0x04, 0x53, 0x1A, 0x8F, 0x88,
+    0x8F, 0x9E, 0x4E, 0x8F, 0x7A, 0x7B, 0x7A, 0x7F, 0x8F, 0x7F, 0x1E, 0x61, 0x9E, 0x97, 0x60, 0x6E,
+    0x18, 0x04, 0x1C, 0x07, 0x91, 0x79, 0x55, 0x37, 0x4F, 0x49, 0x07, 0x1C, 0x05, 0x62, 0x63, 0x7E,
+    0x30, 0x6E, 0x2B, 0x53, 0x2A, 0x5B, 0x50, 0x0F, 0x35, 0x20, 0x7D, 0xA1, 0x13, 0x32, 0x13, 0x01,
+    0x00, 0x06, 0x58, 0x15, 0x15, 0x6B, 0x6B, 0x03, 0x06, 0x02, 0x06, 0x05, 0x01, 0x83, 0x00, 0x82,
+    0x02, 0x81, 0x03, 0x82, 0x05, 0x81, 0x13, 0x06, 0x58, 0x87, 0x13, 0x03, 0x48, 0x04, 0x00, 0x82,
+    0x02, 0x80, 0x06, 0x81, 0x08, 0x82, 0x13, 0x01, 0x32, 0x54, 0x83, 0x0B, 0x80, 0x73, 0x87, 0x15,
+    0x02, 0x6B, 0x15, 0x73, 0x82, 0x0B, 0x05, 0x54, 0x58, 0x13, 0x08, 0x05, 0x03, 0x85, 0x00, 0x05,
+    0x01, 0x18, 0x00, 0x00, 0x04, 0x63, 0x81, 0x03, 0xB2, 0x00, 0xB2, 0x00, 0x81, 0x04, 0x40, 0x68,
+    0x82, 0x8F, 0x8F, 0x88, 0x8F, 0x9E, 0x74, 0x07, 0x01, 0x8F, 0x8F, 0x9E, 0x69, 0x61, 0x89, 0x89,
+    0x9E, 0x29, 0x26, 0x00, 0x3B, 0x2B, 0x80, 0x05, 0x00, 0x07, 0x86, 0xA1, 0x8C, 0x50, 0x19, 0x68,
+    0x5F, 0x52, 0xA1, 0x29, 0x30, 0x7E, 0x5F, 0x6E, 0x21, 0x68, 0x5E, 0x5F, 0x1A, 0xA0, 0x25, 0x06,
+    0x79, 0x13, 0x01, 0x00, 0x02, 0x13, 0x0B, 0x6B, 0x6B, 0x15, 0x03, 0x02, 0x01, 0x03, 0x05, 0x06,
+    0x83, 0x00, 0x19, 0x02, 0x01, 0x02, 0x01, 0x06, 0x48, 0x03, 0x48, 0x05, 0x13, 0x87, 0x08, 0x05,
+    0x48, 0x03, 0x00, 0x00, 0x02, 0x01, 0x01, 0x48, 0x0A, 0x08, 0x08, 0x13, 0x32, 0x84, 0x54, 0x80,
+    0x0B, 0x81, 0x73, 0x83, 0x6B, 0x84, 0x15, 0x09, 0x73, 0x0B, 0x0B, 0x54, 0x54, 0x58, 0x13, 0x0A,
+    0x03, 0x02, 0x85, 0x00, 0x07, 0x22, 0x63, 0x04, 0x00, 0x04, 0x86, 0x03, 0x22, 0xB2, 0x00, 0xB4,
+    0x00, 0x81, 0x52, 0x81, 0x8F, 0x3C, 0x16, 0x8F, 0x8F, 0x74, 0x60, 0x00, 0x98, 0x9E, 0x61, 0x7F,
+    0x7F, 0x59, 0x69, 0x97, 0x74, 0x83, 0x49, 0x00, 0x02, 0x79, 0x80, 0x5B, 0x80, 0x2B, 0x79, 0x1C,
+    0x01, 0x49, 0x18, 0x49, 0x00, 0x00, 0x1F, 0x1A, 0x00, 0x1A, 0x29, 0x5F, 0x27, 0x68, 0x52, 0x00,
+    0x95, 0x23, 0x62, 0x03, 0x32, 0x06, 0x00, 0x00, 0x08, 0x54, 0x0B, 0x15, 0x15, 0x05, 0x02, 0x03,
+    0x05, 0x05, 0x06, 0x85, 0x00, 0x16, 0x02, 0x0A, 0x05, 0x06, 0x03, 0x05, 0x05, 0x13, 0x08, 0x08,
+    0x05, 0x03, 0x06, 0x00, 0x00, 0x02, 0x02, 0x06, 0x05, 0x48, 0x08, 0x08, 0x58, 0x82, 0x54, 0x83,
+    0x0B, 0x81, 0x73, 0x86, 0x15, 0x82, 0x73, 0x07, 0x0B, 0x54, 0x32, 0x54, 0x3B, 0x08, 0x05, 0x06,
+    0x87, 0x00, 0x81, 0x01, 0x04, 0x00, 0x01, 0x86, 0x3D, 0x01, 0xB2, 0x00, 0xB4, 0x00, 0x40, 0x1A,
+    0x29, 0x60, 0x9E, 0x8F, 0x8F, 0x7A, 0x16, 0x60, 0x00, 0x28, 0x59, 0x9E, 0x61, 0x7F, 0x9E, 0x9E,
+    0x9B, 0x88, 0x83, 0x60, 0x34, 0x06, 0x37, 0x26, 0x16, 0x56, 0x47, 0x80, 0x68, 0x8C, 0x71, 0x05,
+    0x91, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x00, 0x63, 0x7E, 0x5F, 0x35, 0x82, 0x01, 0x49, 0x6C, 0x95,
+    0x02, 0x05, 0x03, 0x00, 0x00, 0x05, 0x54, 0x0B, 0x15, 0x15, 0x08, 0x00, 0x03, 0x48, 0x03, 0x02,
+    0x85, 0x00, 0x04, 0x02, 0x03, 0x62, 0x03, 0x05, 0x83, 0x08, 0x08, 0x05, 0x48, 0x06, 0x02, 0x00,
+    0x00, 0x02, 0x01, 0x03, 0x82, 0x05, 0x01, 0x13, 0x87, 0x82, 0x54, 0x82, 0x0B, 0x81, 0x73, 0x82,
+    0x15, 0x81, 0x9A, 0x84, 0x73, 0x81, 0x0B, 0x06, 0x54, 0x32, 0x54, 0x87, 0x0A, 0x03, 0x01, 0x87,
+    0x00, 0x06, 0x45, 0x01, 0x00, 0x00, 0x1C, 0x03, 0x02, 0xB2, 0x00, 0xB2, 0x00, 0x18, 0x04, 0x00,
+    0x18, 0x29, 0x5D, 0x74, 0x9E, 0x98, 0x1A, 0x74, 0x51, 0x00, 0x98, 0x59, 0x59, 0x9E, 0x42, 0x9E,
+    0x7F, 0x97, 0x74, 0x7C, 0x1A, 0x00, 0x04, 0x82, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x01, 0x49, 0x49,
+    0x91, 0x1C, 0x03, 0x00, 0x00, 0x07, 0x82, 0x00, 0x17, 0x07, 0x16, 0x26, 0x30, 0x26, 0x01, 0x1F,
+    0x17, 0x25, 0x02, 0x03, 0x00, 0x00, 0x05, 0x54, 0x0B, 0x15, 0x15, 0x58, 0x00, 0x03, 0x06, 0x01,
+    0x02, 0x84, 0x00, 0x0C, 0x01, 0x00, 0x02, 0x06, 0x05, 0x05, 0x08, 0x08, 0x87, 0x08, 0x05, 0x03,
+    0x01, 0x83, 0x00, 0x01, 0x03, 0x05, 0x81, 0x08, 0x81, 0x13, 0x82, 0x32, 0x81, 0x54, 0x82, 0x0B,
+    0x8A, 0x73, 0x81, 0x0B, 0x82, 0x54, 0x03, 0x08, 0x48, 0x03, 0x02, 0x85, 0x00, 0x0A, 0x04, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x03, 0x49, 0x00, 0x00, 0x01, 0xB0, 0x00, 0xB4, 0x00, 0x14, 0x18, 0x25,
+    0x07, 0x96, 0x79, 0x79, 0x4E, 0x88, 0x28, 0x04, 0x5D, 0x9E, 0x61, 0x7F, 0x8F, 0x59, 0x69, 0x97,
+    0x88, 0x7C, 0x16, 0x94, 0x00, 0x12, 0x22, 0x18, 0x79, 0x25, 0x00, 0x04, 0x1A, 0x39, 0x23, 0x48,
+    0x00, 0x00, 0x03, 0x54, 0x15, 0x15, 0x6B, 0x54, 0x00, 0x81, 0x06, 0x81, 0x02, 0x87, 0x00, 0x09,
+    0x06, 0x03, 0x05, 0x05, 0x13, 0x13, 0x08, 0x05, 0x03, 0x01, 0x82, 0x00, 0x04, 0x04, 0x06, 0x48,
+    0x05, 0x87, 0x81, 0x58, 0x83, 0x32, 0x81, 0x54, 0x81, 0x0B, 0x80, 0x73, 0x81, 0x15, 0x88, 0x73,
+    0x07, 0x0B, 0x54, 0x54, 0x58, 0x13, 0x03, 0x03, 0x02, 0x87, 0x00, 0x05, 0x01, 0x04, 0x00, 0x01,
+    0x03, 0x01, 0xB3, 0x00,
+};
+// clang-format on
+
+const painter_rle565_image_t gfx_anime_girl_jacket_240x320_rle565 = {
+    .width        = 240,
+    .height       = 320,
+    .palette_size = 165,
+    .palette      = gfx_anime_girl_jacket_240x320_palette,
+    .data_size    = 59748,
+    .data         = gfx_anime_girl_jacket_240x320_data,
+};
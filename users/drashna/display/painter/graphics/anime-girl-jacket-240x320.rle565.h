@@ -0,0 +1,10 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from anime-girl-jacket-240x320.qgf.c by convert_rle565.py, do not edit by hand.
+
+#pragma once
+
+#include "display/painter/painter_rle565.h"
+
+extern const painter_rle565_image_t gfx_anime_girl_jacket_240x320_rle565;
@@ -6,10 +6,10 @@
 #include "display/painter/graphics/qmk_logo_220x220.qgf.h"
 #include "display/painter/graphics/qmk_powered_by.qgf.h"
 #include "display/painter/graphics/akira_explosion.qgf.h"
-#include "display/painter/graphics/anime-girl-jacket-240x320.qgf.h"
-#include "display/painter/graphics/asuka-240x320.qgf.h"
+#include "display/painter/graphics/anime-girl-jacket-240x320.rle565.h"
+#include "display/painter/graphics/asuka-240x320.rle565.h"
 #include "display/painter/graphics/matrix.qgf.h"
-#include "display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.qgf.h"
-#include "display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.qgf.h"
+#include "display/painter/graphics/neon-genesis-evangelion-initial-machine-240x320.rle565.h"
+#include "display/painter/graphics/samurai-cyberpunk-minimal-dark-8k-b3-240x320.rle565.h"
 #include "display/painter/graphics/large_nyan_cat.qgf.h"
 #include "display/painter/graphics/nyan_cat.qgf.h"
@@ -0,0 +1,2603 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from asuka-240x320.qgf.c by convert_rle565.py, do not edit by hand.
+
+#include "asuka-240x320.rle565.h"
+
+// 240x320, 130 colours: 41245 bytes, from 57765 bytes as QGF
+// clang-format off
+static const uint16_t gfx_asuka_240x320_palette[130] = {
+    0xC4C0, 0xC4C8, 0xC3C0, 0xE4C8, 0xC3C8, 0xE3C8, 0xE3D0, 0x0000,
+    0xE4C0, 0x04D1, 0xE4D0, 0x24D9, 0x6350, 0xE3C0, 0x2120, 0x0118,
+    0x0010, 0x2561, 0x2128, 0x2118, 0xA3B0, 0xA771, 0xE3D8, 0x4128,
+    0x0110, 0xA3A8, 0x4130, 0x24E1, 0xA4C8, 0x4120, 0xE4D8, 0x83B0,
+    0xA4B8, 0x0531, 0xC3D0, 0x2010, 0xC398, 0xA370, 0x6308, 0x2000,
+    0x2108, 0x4250, 0xA398, 0x6280, 0xA390, 0x6240, 0x6270, 0x4238,
+    0xC448, 0xA3A0, 0x6358, 0xA378, 0xA380, 0xA450, 0x8360, 0x2130,
+    0x8238, 0x0008, 0xCDD3, 0x45E1, 0x03A9, 0x4260, 0x94FD, 0xA2B8,
+    0x2FEC, 0x6218, 0x83A0, 0x8340, 0x2240, 0x4240, 0x8228, 0xE7D9,
+    0x6290, 0xC3A8, 0xF2FC, 0xA4D8, 0x24C9, 0x68E2, 0x44E9, 0xCABA,
+    0x03C1, 0x6230, 0xA781, 0x03C9, 0x64B9, 0x0018, 0x2138, 0x8290,
+    0xC3B0, 0x8250, 0x6268, 0x04D9, 0xC3B8, 0x65D1, 0xA3D0, 0x63A0,
+    0xA5D1, 0x85E1, 0x85A1, 0x2481, 0xC4D8, 0x2020, 0xEAE2, 0x6681,
+    0x44D1, 0xA5E9, 0x088A, 0xE6E9, 0x6128, 0x04C9, 0x24C1, 0x78F6,
+    0x28B2, 0x0108, 0xE380, 0x24D1, 0x0120, 0x8CEB, 0xA3C8, 0x6741,
+    0x096A, 0xE440, 0x8DBB, 0x03D1, 0xA3C0, 0xD2E4, 0xC4D0, 0xA2C8,
+    0xA2C0, 0xC5C0,
+};
+
+static const uint8_t gfx_asuka_240x320_data[40985] = {
+    0x87, 0x01, 0x80, 0x00, 0x8B, 0x01, 0x8C, 0x00, 0xFF, 0x00, 0x81, 0x01, 0xBB, 0x00, 0x82, 0x01,
+    0x81, 0x03, 0x83, 0x01, 0x83, 0x03, 0x81, 0x01, 0x80, 0x00, 0x94, 0x01, 0x8D, 0x00, 0xFF, 0x00,
+    0x80, 0x01, 0xBC, 0x00, 0x8C, 0x01, 0x81, 0x00, 0x80, 0x00, 0x93, 0x01, 0x95, 0x00, 0xFF, 0x00,
+    0x81, 0x01, 0xB3, 0x00, 0x8C, 0x01, 0x81, 0x00, 0x95, 0x01, 0x94, 0x00, 0xFF, 0x00, 0x82, 0x01,
+    0x8E, 0x00, 0x80, 0x01, 0x81, 0x00, 0x86, 0x01, 0x98, 0x00, 0x8D, 0x01, 0x81, 0x00, 0x95, 0x01,
+    0x96, 0x00, 0xFF, 0x00, 0x81, 0x01, 0x80, 0x00, 0x81, 0x01, 0x89, 0x00, 0x81, 0x01, 0x81, 0x00,
+    0x05, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x81, 0x01, 0x95, 0x00, 0x01, 0x01, 0x00, 0x8D, 0x01,
+    0x81, 0x00, 0x94, 0x01, 0x98, 0x00, 0xFF, 0x00, 0x83, 0x01, 0x89, 0x00, 0x81, 0x01, 0x81, 0x00,
+    0x81, 0x01, 0x80, 0x03, 0x83, 0x01, 0x96, 0x00, 0x8F, 0x01, 0x81, 0x00, 0x87, 0x01, 0x80, 0x00,
+    0x82, 0x01, 0x80, 0x00, 0x86, 0x01, 0x9A, 0x00, 0xFF, 0x00, 0x83, 0x01, 0x86, 0x00, 0x82, 0x01,
+    0x82, 0x00, 0x81, 0x01, 0x80, 0x03, 0x83, 0x01, 0x96, 0x00, 0x8F, 0x01, 0x81, 0x00, 0x87, 0x01,
+    0x80, 0x00, 0x82, 0x01, 0x80, 0x00, 0x85, 0x01, 0x93, 0x00, 0xFF, 0x00, 0x80, 0x01, 0x87, 0x00,
+    0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x97, 0x00, 0x8C, 0x01, 0x80, 0x03,
+    0x81, 0x01, 0x81, 0x00, 0x87, 0x01, 0x82, 0x00, 0x84, 0x01, 0xB7, 0x00, 0x80, 0x01, 0x82, 0x00,
+    0x81, 0x01, 0xD5, 0x00, 0x83, 0x01, 0x87, 0x00, 0x85, 0x01, 0x86, 0x00, 0x88, 0x01, 0x91, 0x00,
+    0x80, 0x03, 0x86, 0x01, 0x80, 0x00, 0x83, 0x01, 0x82, 0x00, 0x82, 0x01, 0x84, 0x00, 0x87, 0x01,
+    0x83, 0x00, 0x83, 0x01, 0x94, 0x00, 0xFF, 0x00, 0x82, 0x01, 0x80, 0x00, 0x81, 0x01, 0x83, 0x00,
+    0x86, 0x01, 0x86, 0x00, 0x88, 0x01, 0x91, 0x00, 0x87, 0x01, 0x80, 0x00, 0x82, 0x01, 0x8B, 0x00,
+    0x87, 0x01, 0x9C, 0x00, 0xFF, 0x00, 0x85, 0x01, 0x83, 0x00, 0x85, 0x01, 0x85, 0x00, 0x86, 0x01,
+    0x81, 0x03, 0x81, 0x01, 0x8E, 0x00, 0x89, 0x01, 0x90, 0x00, 0x87, 0x01, 0x9C, 0x00, 0xFF, 0x00,
+    0x86, 0x01, 0x82, 0x00, 0x85, 0x01, 0x82, 0x00, 0x89, 0x01, 0x81, 0x03, 0x81, 0x01, 0x8A, 0x00,
+    0x01, 0x01, 0x03, 0x84, 0x01, 0x80, 0x00, 0x84, 0x01, 0x80, 0x02, 0x90, 0x00, 0x86, 0x01, 0x9D,
+    0x00, 0xFF, 0x00, 0x86, 0x01, 0x82, 0x00, 0x85, 0x01, 0x82, 0x00, 0x8D, 0x01, 0x8A, 0x00, 0x01,
+    0x01, 0x03, 0x84, 0x01, 0x80, 0x00, 0x84, 0x01, 0x91, 0x00, 0x84, 0x01, 0x9F, 0x00, 0xFF, 0x00,
+    0x80, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x82, 0x01, 0x85, 0x00, 0x8C, 0x01, 0x8A, 0x00,
+    0x82, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x84, 0x01, 0x92, 0x00, 0x81, 0x01, 0xA2, 0x00, 0xFF,
+    0x00, 0x80, 0x01, 0x83, 0x00, 0x80, 0x01, 0x8E, 0x00, 0x87, 0x01, 0x81, 0x03, 0x81, 0x01, 0x8B,
+    0x00, 0x81, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x81, 0x01, 0x95, 0x00, 0x88, 0x00, 0xFF, 0x00,
+    0x81, 0x01, 0x99, 0x00, 0x80, 0x01, 0x83, 0x00, 0x81, 0x01, 0x8D, 0x00, 0x87, 0x01, 0x82, 0x03,
+    0x80, 0x01, 0x8B, 0x00, 0x80, 0x03, 0x86, 0x01, 0x95, 0x00, 0x87, 0x00, 0xFF, 0x00, 0x82, 0x01,
+    0x99, 0x00, 0x80, 0x01, 0x91, 0x00, 0x01, 0x01, 0x00, 0x88, 0x01, 0x81, 0x03, 0x82, 0x01, 0x8A,
+    0x00, 0x85, 0x01, 0x96, 0x00, 0x87, 0x00, 0xFF, 0x00, 0x82, 0x01, 0x99, 0x00, 0x80, 0x01, 0x89,
+    0x00, 0x87, 0x01, 0x83, 0x00, 0x83, 0x01, 0x03, 0x00, 0x01, 0x01, 0x03, 0x82, 0x01, 0x8B, 0x00,
+    0x84, 0x01, 0x97, 0x00, 0x87, 0x00, 0xFF, 0x00, 0x82, 0x01, 0xB0, 0x00, 0x83, 0x01, 0x80, 0x00,
+    0x84, 0x01, 0x8D, 0x00, 0x83, 0x01, 0x97, 0x00, 0x86, 0x00, 0xFF, 0x00, 0x83, 0x01, 0xA3, 0x00,
+    0x80, 0x01, 0x89, 0x00, 0x82, 0x01, 0x84, 0x00, 0x83, 0x01, 0xA9, 0x00, 0x87, 0x00, 0xFF, 0x00,
+    0x82, 0x01, 0xB6, 0x00, 0x83, 0x01, 0xA9, 0x00, 0xA6, 0x00, 0x80, 0x02, 0x9A, 0x00, 0xFF, 0x00,
+    0x81, 0x01, 0xAA, 0x00, 0xA4, 0x00, 0x82, 0x02, 0xC7, 0x00, 0xFF, 0x00, 0xA3, 0x00, 0x81, 0x08,
+    0x81, 0x02, 0xC7, 0x00, 0xFF, 0x00, 0xA3, 0x00, 0x80, 0x08, 0x82, 0x02, 0x87, 0x00, 0x87, 0x02,
+    0xB7, 0x00, 0xFF, 0x00, 0xA4, 0x00, 0x82, 0x02, 0x81, 0x00, 0x80, 0x02, 0xC4, 0x00, 0xFF, 0x00,
+    0xA4, 0x00, 0x82, 0x02, 0x81, 0x00, 0x80, 0x02, 0xC4, 0x00, 0xFF, 0x00, 0xA6, 0x00, 0x80, 0x02,
+    0xC7, 0x00, 0xFF, 0x00, 0xD7, 0x00, 0xFF, 0x00, 0x80, 0x02, 0x85, 0x00, 0x80, 0x02, 0x8F, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0x81, 0x02, 0xE8, 0x00, 0x80, 0x02,
+    0x93, 0x00, 0xE4, 0x00, 0x80, 0x02, 0xF9, 0x00, 0x80, 0x02, 0x8E, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xBC, 0x00, 0x82, 0x01, 0xAF, 0x00, 0xFF, 0x00, 0xBA, 0x00, 0x85, 0x01,
+    0xA9, 0x00, 0x81, 0x02, 0x8A, 0x00, 0x82, 0x02, 0xF4, 0x00, 0xB8, 0x00, 0x87, 0x01, 0xA8, 0x00,
+    0x83, 0x02, 0x8B, 0x00, 0x81, 0x02, 0xF3, 0x00, 0xB6, 0x00, 0x88, 0x01, 0xA9, 0x00, 0x83, 0x02,
+    0x81, 0x00, 0x82, 0x02, 0x81, 0x00, 0x86, 0x02, 0xF3, 0x00, 0xB7, 0x00, 0x87, 0x01, 0xA9, 0x00,
+    0x83, 0x02, 0x80, 0x00, 0x8C, 0x02, 0xF3, 0x00, 0xB5, 0x00, 0x84, 0x01, 0x81, 0x00, 0x85, 0x01,
+    0xAC, 0x00, 0x8C, 0x02, 0x86, 0x00, 0x88, 0x02, 0xD1, 0x00, 0x81, 0x02, 0x8E, 0x00, 0xB4, 0x00,
+    0x81, 0x01, 0x80, 0x03, 0x8B, 0x01, 0xAB, 0x00, 0x8E, 0x02, 0x83, 0x00, 0x8A, 0x02, 0xE1, 0x00,
+    0xB4, 0x00, 0x81, 0x01, 0x80, 0x03, 0x8B, 0x01, 0xAB, 0x00, 0x8F, 0x02, 0x80, 0x00, 0x91, 0x02,
+    0xDC, 0x00, 0xB5, 0x00, 0x8E, 0x01, 0xAA, 0x00, 0xA3, 0x02, 0xDB, 0x00, 0xB5, 0x00, 0x8E, 0x01,
+    0xAA, 0x00, 0xA3, 0x02, 0xDB, 0x00, 0xB1, 0x00, 0x92, 0x01, 0xA2, 0x00, 0xAB, 0x02, 0xDB, 0x00,
+    0x87, 0x00, 0x82, 0x01, 0x80, 0x03, 0x81, 0x01, 0xA1, 0x00, 0x95, 0x01, 0x91, 0x00, 0x82, 0x02,
+    0x84, 0x00, 0x97, 0x02, 0x80, 0x00, 0x9B, 0x02, 0xDA, 0x00, 0x87, 0x00, 0x81, 0x01, 0x82, 0x03,
+    0x80, 0x01, 0xA1, 0x00, 0x96, 0x01, 0x90, 0x00, 0x81, 0x08, 0x80, 0x02, 0x84, 0x00, 0x97, 0x02,
+    0x82, 0x00, 0x89, 0x02, 0x80, 0x0D, 0x8E, 0x02, 0x8A, 0x00, 0x80, 0x02, 0xCE, 0x00, 0x87, 0x00,
+    0x85, 0x01, 0x8F, 0x00, 0x01, 0x01, 0x03, 0x8D, 0x00, 0x98, 0x01, 0x97, 0x00, 0x80, 0x02, 0x82,
+    0x00, 0xB4, 0x02, 0xD2, 0x00, 0x81, 0x02, 0x82, 0x00, 0x89, 0x00, 0x83, 0x01, 0x89, 0x00, 0x82,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x8C, 0x00, 0x98, 0x01, 0x97, 0x00, 0x81, 0x02, 0x81, 0x00, 0xB5,
+    0x02, 0xD7, 0x00, 0x89, 0x00, 0x91, 0x01, 0x82, 0x00, 0x86, 0x01, 0x86, 0x00, 0x98, 0x01, 0x96,
+    0x00, 0x82, 0x02, 0x82, 0x00, 0xB4, 0x02, 0xD7, 0x00, 0x89, 0x00, 0x84, 0x01, 0x80, 0x03, 0x8B,
+    0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00, 0x9A, 0x01, 0x94, 0x00, 0x83, 0x02, 0x81, 0x00, 0xB5,
+    0x02, 0x9B, 0x00, 0x80, 0x01, 0xBA, 0x00, 0x8A, 0x00, 0x83, 0x01, 0x80, 0x03, 0x82, 0x01, 0x80,
+    0x03, 0x87, 0x01, 0x81, 0x00, 0x8B, 0x01, 0x80, 0x00, 0x86, 0x01, 0x81, 0x03, 0x92, 0x01, 0x94,
+    0x00, 0xBB, 0x02, 0x9A, 0x00, 0x84, 0x01, 0x93, 0x00, 0x80, 0x01, 0xA2, 0x00, 0x8B, 0x00, 0x82,
+    0x01, 0x80, 0x03, 0x87, 0x01, 0x80, 0x00, 0x85, 0x01, 0x80, 0x03, 0x92, 0x01, 0x81, 0x03, 0x91,
+    0x01, 0x93, 0x00, 0xBC, 0x02, 0x9B, 0x00, 0x83, 0x01, 0x91, 0x00, 0x81, 0x01, 0x9B, 0x00, 0x81,
+    0x02, 0x85, 0x00, 0x87, 0x01, 0x83, 0x00, 0x8A, 0x01, 0x88, 0x00, 0x87, 0x01, 0x80, 0x03, 0x86,
+    0x01, 0x80, 0x00, 0x82, 0x01, 0x81, 0x03, 0x8B, 0x01, 0x80, 0x00, 0x82, 0x01, 0x93, 0x00, 0x8A,
+    0x02, 0x80, 0x00, 0x81, 0x0D, 0xB7, 0x02, 0x96, 0x00, 0x80, 0x01, 0x8F, 0x00, 0x01, 0x01, 0x00,
+    0x82, 0x01, 0x9A, 0x00, 0x81, 0x02, 0x85, 0x00, 0x87, 0x01, 0x83, 0x00, 0x82, 0x01, 0x80, 0x00,
+    0x87, 0x01, 0x87, 0x00, 0x87, 0x01, 0x81, 0x03, 0x85, 0x01, 0x81, 0x00, 0x8E, 0x01, 0x82, 0x00,
+    0x80, 0x01, 0x93, 0x00, 0x8A, 0x02, 0x80, 0x00, 0x82, 0x0D, 0xB7, 0x02, 0xA7, 0x00, 0x84, 0x01,
+    0x9B, 0x00, 0x80, 0x02, 0x85, 0x00, 0x84, 0x01, 0x85, 0x00, 0x8B, 0x01, 0x87, 0x00, 0x05, 0x01,
+    0x00, 0x01, 0x01, 0x03, 0x01, 0x82, 0x00, 0x9B, 0x01, 0x83, 0x00, 0x84, 0x02, 0x8B, 0x00, 0x89,
+    0x02, 0x81, 0x00, 0x81, 0x0D, 0xB9, 0x02, 0xA5, 0x00, 0x86, 0x01, 0x91, 0x00, 0x83, 0x01, 0x8B,
+    0x00, 0x84, 0x01, 0x86, 0x00, 0x88, 0x01, 0x89, 0x00, 0x02, 0x01, 0x00, 0x01, 0x81, 0x03, 0x9B,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x83, 0x00, 0x84, 0x02, 0x8C, 0x00, 0xC7, 0x02, 0xA3, 0x00, 0x87,
+    0x01, 0x8B, 0x00, 0x88, 0x01, 0x8C, 0x00, 0x84, 0x01, 0x99, 0x00, 0x82, 0x01, 0x81, 0x03, 0x9E,
+    0x01, 0x84, 0x00, 0x84, 0x02, 0x8D, 0x00, 0xC7, 0x02, 0xA2, 0x00, 0x87, 0x01, 0x8B, 0x00, 0x87,
+    0x01, 0x8D, 0x00, 0x83, 0x01, 0x99, 0x00, 0x82, 0x01, 0x82, 0x03, 0x97, 0x01, 0x83, 0x00, 0x83,
+    0x01, 0x80, 0x00, 0x82, 0x02, 0x80, 0x00, 0x82, 0x02, 0x8F, 0x00, 0xAB, 0x02, 0x81, 0x00, 0x99,
+    0x02, 0xA1, 0x00, 0x87, 0x01, 0x8B, 0x00, 0x89, 0x01, 0x8B, 0x00, 0x82, 0x01, 0x9A, 0x00, 0x82,
+    0x01, 0x82, 0x03, 0x97, 0x01, 0x83, 0x00, 0x84, 0x01, 0x03, 0x00, 0x02, 0x02, 0x00, 0x81, 0x02,
+    0x90, 0x00, 0xAB, 0x02, 0x82, 0x00, 0x98, 0x02, 0x9B, 0x00, 0x80, 0x01, 0x86, 0x00, 0x85, 0x01,
+    0x88, 0x00, 0x80, 0x01, 0x81, 0x00, 0x84, 0x01, 0x80, 0x03, 0x82, 0x01, 0x80, 0x03, 0x8B, 0x00,
+    0x9D, 0x00, 0x82, 0x01, 0x81, 0x03, 0x96, 0x01, 0x85, 0x00, 0x85, 0x01, 0x96, 0x00, 0x82, 0x02,
+    0x80, 0x00, 0xA6, 0x02, 0x80, 0x00, 0x9B, 0x02, 0x97, 0x00, 0x85, 0x01, 0x84, 0x00, 0x84, 0x01,
+    0x8A, 0x00, 0x01, 0x02, 0x00, 0x85, 0x01, 0x03, 0x00, 0x01, 0x01, 0x03, 0x8B, 0x00, 0x97, 0x00,
+    0x80, 0x01, 0x83, 0x00, 0x83, 0x01, 0x81, 0x03, 0xA2, 0x01, 0x97, 0x00, 0x81, 0x02, 0x81, 0x00,
+    0xA5, 0x02, 0x80, 0x00, 0x9C, 0x02, 0x89, 0x00, 0x82, 0x02, 0x8A, 0x00, 0x84, 0x01, 0x9A, 0x00,
+    0x81, 0x01, 0x8F, 0x00, 0x95, 0x00, 0x82, 0x01, 0x83, 0x00, 0x83, 0x01, 0x81, 0x03, 0xA3, 0x01,
+    0x97, 0x00, 0x80, 0x02, 0x82, 0x00, 0x8F, 0x02, 0x80, 0x00, 0x93, 0x02, 0x81, 0x00, 0x9C, 0x02,
+    0x88, 0x00, 0x82, 0x02, 0x8A, 0x00, 0x83, 0x01, 0x95, 0x00, 0x81, 0x02, 0x95, 0x00, 0x93, 0x00,
+    0x82, 0x01, 0x80, 0x03, 0x96, 0x01, 0x84, 0x1C, 0x93, 0x01, 0x9B, 0x00, 0xAE, 0x02, 0x80, 0x00,
+    0x81, 0x0D, 0x93, 0x02, 0x95, 0x00, 0x80, 0x01, 0xAE, 0x00, 0x92, 0x00, 0x82, 0x01, 0x86, 0x03,
+    0x91, 0x01, 0x83, 0x1C, 0x94, 0x01, 0x9B, 0x00, 0xAD, 0x02, 0x81, 0x00, 0x81, 0x0D, 0x93, 0x02,
+    0xC5, 0x00, 0x8D, 0x00, 0x87, 0x01, 0x84, 0x03, 0x93, 0x01, 0x81, 0x1C, 0x96, 0x01, 0x9B, 0x00,
+    0x83, 0x02, 0x81, 0x00, 0xA7, 0x02, 0x81, 0x00, 0x81, 0x0D, 0x93, 0x02, 0xC5, 0x00, 0x8D, 0x00,
+    0xA0, 0x01, 0x80, 0x1C, 0x97, 0x01, 0x9C, 0x00, 0x80, 0x02, 0x85, 0x00, 0xA6, 0x02, 0x01, 0x00,
+    0x0D, 0x94, 0x02, 0xC5, 0x00, 0x8C, 0x00, 0x80, 0x01, 0x81, 0x03, 0x99, 0x01, 0x81, 0x1C, 0x82,
+    0x01, 0x80, 0x1C, 0x97, 0x01, 0xA7, 0x00, 0xB9, 0x02, 0xC5, 0x00, 0x8A, 0x00, 0x82, 0x01, 0x81,
+    0x03, 0x99, 0x01, 0x81, 0x1C, 0x99, 0x01, 0x01, 0x00, 0x01, 0xC0, 0x00, 0x99, 0x02, 0x81, 0x00,
+    0x84, 0x02, 0xC5, 0x00, 0x88, 0x00, 0xA0, 0x01, 0x81, 0x1C, 0x99, 0x01, 0xC3, 0x00, 0x83, 0x02,
+    0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x80, 0x0D, 0x93, 0x02, 0x98, 0x00, 0x81, 0x02, 0xAB, 0x00,
+    0x87, 0x00, 0x9E, 0x01, 0x80, 0x1C, 0x82, 0x01, 0x80, 0x1C, 0x99, 0x01, 0xC4, 0x00, 0x80, 0x02,
+    0x87, 0x00, 0x81, 0x0D, 0x93, 0x02, 0xC5, 0x00, 0x85, 0x01, 0x81, 0x00, 0x85, 0x03, 0xA2, 0x01,
+    0x05, 0x1C, 0x00, 0x00, 0x01, 0x01, 0x04, 0x81, 0x02, 0x8B, 0x01, 0x82, 0x00, 0x80, 0x01, 0x83,
+    0x00, 0x84, 0x02, 0x85, 0x00, 0x80, 0x08, 0x81, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x8E, 0x02, 0x80,
+    0x00, 0x86, 0x02, 0xC7, 0x00, 0x85, 0x01, 0x86, 0x03, 0xA8, 0x01, 0x81, 0x02, 0x80, 0x1C, 0x8C,
+    0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x02, 0x86, 0x00, 0x82, 0x02, 0xA5, 0x00, 0x80,
+    0x02, 0x8E, 0x00, 0x8D, 0x02, 0x80, 0x00, 0x86, 0x02, 0xC7, 0x00, 0x85, 0x01, 0x84, 0x03, 0xA9,
+    0x01, 0x80, 0x00, 0x81, 0x02, 0x8E, 0x01, 0x80, 0x00, 0x82, 0x01, 0x80, 0x00, 0x85, 0x02, 0x87,
+    0x00, 0x81, 0x02, 0xA7, 0x00, 0x80, 0x02, 0x8D, 0x00, 0x94, 0x02, 0xC7, 0x00, 0xB3, 0x01, 0x81,
+    0x00, 0x01, 0x02, 0x04, 0x8F, 0x01, 0x80, 0x00, 0x82, 0x01, 0x01, 0x02, 0x00, 0x83, 0x02, 0x87,
+    0x00, 0x80, 0x02, 0xB8, 0x00, 0x93, 0x02, 0xC7, 0x00, 0xB3, 0x01, 0x81, 0x00, 0x01, 0x02, 0x04,
+    0x8F, 0x01, 0x80, 0x00, 0x82, 0x01, 0x01, 0x02, 0x00, 0x83, 0x02, 0x85, 0x00, 0x80, 0x02, 0xA9,
+    0x00, 0x82, 0x02, 0x8D, 0x00, 0x93, 0x02, 0xC7, 0x00, 0xB2, 0x01, 0x82, 0x00, 0x81, 0x02, 0x87,
+    0x01, 0x80, 0x00, 0x86, 0x01, 0x80, 0x00, 0x83, 0x01, 0x84, 0x02, 0xB0, 0x00, 0x84, 0x02, 0x8C,
+    0x00, 0x90, 0x02, 0xC9, 0x00, 0xB0, 0x01, 0x84, 0x00, 0x81, 0x02, 0x87, 0x01, 0x81, 0x02, 0x86,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x83, 0x02, 0xB0, 0x00, 0x83, 0x02, 0x8E, 0x00, 0x81, 0x02, 0x87,
+    0x00, 0x81, 0x02, 0xCD, 0x00, 0xB0, 0x01, 0x83, 0x00, 0x80, 0x01, 0x81, 0x02, 0x81, 0x00, 0x85,
+    0x01, 0x82, 0x02, 0x85, 0x01, 0x82, 0x00, 0x82, 0x01, 0x80, 0x00, 0x81, 0x02, 0xB1, 0x00, 0x81,
+    0x02, 0x90, 0x00, 0x80, 0x02, 0xD7, 0x00, 0xA7, 0x01, 0x81, 0x02, 0x01, 0x00, 0x02, 0x84, 0x00,
+    0x86, 0x02, 0x85, 0x00, 0x81, 0x01, 0x84, 0x00, 0x80, 0x02, 0x82, 0x01, 0x83, 0x00, 0x81, 0x01,
+    0x80, 0x00, 0x81, 0x01, 0x85, 0x02, 0x8F, 0x00, 0x04, 0x01, 0x00, 0x5C, 0x00, 0x01, 0x83, 0x00,
+    0x06, 0x20, 0x00, 0x81, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x01, 0x01, 0x02, 0x84, 0x00, 0x80,
+    0x08, 0xE2, 0x00, 0x80, 0x02, 0x87, 0x00, 0xA7, 0x01, 0x81, 0x02, 0x8A, 0x00, 0x8A, 0x02, 0x83,
+    0x00, 0x81, 0x02, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x80, 0x01, 0x85, 0x02, 0x8F,
+    0x00, 0x11, 0x02, 0x00, 0x01, 0x01, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x04, 0x0D, 0x02, 0x01,
+    0x03, 0x02, 0x00, 0x03, 0x82, 0x00, 0x81, 0x08, 0x80, 0x0D, 0xEF, 0x00, 0xA6, 0x01, 0x80, 0x02,
+    0x8C, 0x00, 0x90, 0x02, 0x81, 0x01, 0x84, 0x00, 0x82, 0x01, 0x01, 0x00, 0x01, 0x82, 0x02, 0x94,
+    0x00, 0x80, 0x01, 0x82, 0x00, 0x05, 0x08, 0x02, 0x00, 0x0D, 0x0D, 0x03, 0x82, 0x01, 0x08, 0x00,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x08, 0x00, 0x0D, 0xEF, 0x00, 0xA5, 0x01, 0x81, 0x02, 0x8B, 0x00,
+    0x91, 0x02, 0x81, 0x01, 0x83, 0x00, 0x86, 0x01, 0x80, 0x02, 0x97, 0x00, 0x06, 0x08, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x00, 0x82, 0x20, 0x05, 0x00, 0x08, 0x08, 0x00, 0x00, 0x02, 0x82, 0x08, 0x80,
+    0x02, 0xEA, 0x00, 0x80, 0x02, 0x83, 0x00, 0xA5, 0x01, 0x8D, 0x00, 0x91, 0x02, 0x85, 0x00, 0x82,
+    0x01, 0x80, 0x00, 0x84, 0x01, 0x94, 0x00, 0x14, 0x01, 0x08, 0x00, 0x00, 0x5C, 0x01, 0x00, 0x49,
+    0x49, 0x19, 0x14, 0x14, 0x20, 0x0D, 0x08, 0x03, 0x03, 0x08, 0x02, 0x08, 0x03, 0xF0, 0x00, 0xA4,
+    0x01, 0x8D, 0x00, 0x91, 0x02, 0x86, 0x00, 0x82, 0x01, 0x80, 0x00, 0x8A, 0x01, 0x8D, 0x00, 0x16,
+    0x01, 0x08, 0x02, 0x00, 0x08, 0x00, 0x19, 0x34, 0x19, 0x7C, 0x02, 0x02, 0x08, 0x01, 0x01, 0x0D,
+    0x08, 0x6D, 0x4C, 0x08, 0x02, 0x00, 0x01, 0xEF, 0x00, 0xA4, 0x01, 0x87, 0x00, 0x82, 0x02, 0x81,
+    0x00, 0x93, 0x02, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x8C, 0x01, 0x8B, 0x00, 0x15,
+    0x01, 0x00, 0x02, 0x5C, 0x81, 0x20, 0x25, 0x31, 0x1F, 0x7C, 0x7C, 0x02, 0x08, 0x08, 0x01, 0x0D,
+    0x00, 0x03, 0x4C, 0x4C, 0x6E, 0x08, 0xF0, 0x00, 0x89, 0x01, 0x80, 0x04, 0x93, 0x01, 0x80, 0x1C,
+    0x84, 0x01, 0x86, 0x00, 0x83, 0x02, 0x81, 0x00, 0x8B, 0x02, 0x81, 0x01, 0x85, 0x02, 0x81, 0x01,
+    0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x87, 0x01, 0x81, 0x00, 0x83, 0x01, 0x89, 0x00, 0x14, 0x08,
+    0x02, 0x02, 0x08, 0x01, 0x20, 0x72, 0x2E, 0x7C, 0x1F, 0x42, 0x42, 0x19, 0x19, 0x14, 0x20, 0x0D,
+    0x01, 0x04, 0x02, 0x0D, 0x81, 0x5D, 0x82, 0x08, 0xED, 0x00, 0x9D, 0x01, 0x81, 0x1C, 0x88, 0x01,
+    0x82, 0x00, 0x82, 0x02, 0x80, 0x01, 0x8F, 0x02, 0x85, 0x01, 0x81, 0x00, 0x80, 0x02, 0x88, 0x01,
+    0x83, 0x00, 0x81, 0x01, 0x04, 0x00, 0x01, 0x01, 0x00, 0x08, 0x81, 0x01, 0x83, 0x00, 0x01, 0x08,
+    0x00, 0x85, 0x02, 0x1B, 0x0D, 0x02, 0x14, 0x59, 0x14, 0x14, 0x3D, 0x36, 0x34, 0x57, 0x2C, 0x57,
+    0x42, 0x1F, 0x20, 0x0D, 0x80, 0x76, 0x03, 0x60, 0x70, 0x01, 0x00, 0x02, 0x08, 0x00, 0x00, 0x08,
+    0x84, 0x00, 0x82, 0x01, 0x86, 0x00, 0x81, 0x01, 0xD7, 0x00, 0x9D, 0x01, 0x81, 0x1C, 0x83, 0x00,
+    0x84, 0x01, 0x81, 0x00, 0x83, 0x02, 0x80, 0x01, 0x8D, 0x02, 0x88, 0x01, 0x80, 0x00, 0x81, 0x02,
+    0x85, 0x00, 0x87, 0x01, 0x81, 0x02, 0x08, 0x00, 0x01, 0x04, 0x02, 0x00, 0x01, 0x80, 0x76, 0x01,
+    0x83, 0x00, 0x1B, 0x1F, 0x20, 0x14, 0x20, 0x01, 0x2C, 0x2C, 0x2E, 0x14, 0x29, 0x2F, 0x2B, 0x25,
+    0x32, 0x25, 0x34, 0x24, 0x19, 0x58, 0x0D, 0x02, 0x02, 0x80, 0x02, 0x54, 0x54, 0x00, 0x76, 0x82,
+    0x01, 0x03, 0x00, 0x03, 0x03, 0x01, 0x84, 0x00, 0x80, 0x08, 0x86, 0x00, 0x80, 0x01, 0xD7, 0x00,
+    0x9D, 0x01, 0x81, 0x1C, 0x82, 0x00, 0x85, 0x01, 0x85, 0x02, 0x80, 0x01, 0x89, 0x02, 0x80, 0x01,
+    0x82, 0x00, 0x89, 0x01, 0x81, 0x02, 0x85, 0x00, 0x85, 0x01, 0x81, 0x00, 0x80, 0x02, 0x82, 0x01,
+    0x10, 0x1C, 0x01, 0x0D, 0x00, 0x03, 0x02, 0x01, 0x01, 0x20, 0x19, 0x19, 0x14, 0x48, 0x42, 0x14,
+    0x42, 0x2C, 0x82, 0x33, 0x17, 0x12, 0x29, 0x44, 0x12, 0x37, 0x56, 0x44, 0x36, 0x25, 0x24, 0x00,
+    0x09, 0x73, 0x53, 0x02, 0x02, 0x6E, 0x6D, 0x5E, 0x04, 0x08, 0x00, 0x01, 0x80, 0x8E, 0x00, 0x80,
+    0x01, 0x81, 0x00, 0x83, 0x01, 0xD1, 0x00, 0x9D, 0x01, 0x81, 0x1C, 0x82, 0x00, 0x84, 0x01, 0x8F,
+    0x02, 0x82, 0x01, 0x82, 0x00, 0x88, 0x01, 0x80, 0x00, 0x8D, 0x01, 0x81, 0x00, 0x80, 0x1C, 0x82,
+    0x00, 0x2C, 0x01, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x20, 0x49, 0x19, 0x42, 0x57, 0x2E, 0x34, 0x42,
+    0x42, 0x31, 0x24, 0x36, 0x44, 0x1A, 0x37, 0x37, 0x0F, 0x0F, 0x23, 0x0F, 0x12, 0x13, 0x12, 0x56,
+    0x59, 0x33, 0x49, 0x0B, 0x3B, 0x53, 0x0D, 0x50, 0x68, 0x03, 0x01, 0x0D, 0x0D, 0x08, 0x00, 0x83,
+    0x08, 0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0xDD, 0x00, 0x9D, 0x01, 0x81, 0x1C, 0x87, 0x00, 0x8C,
+    0x02, 0x88, 0x01, 0x81, 0x1C, 0x85, 0x01, 0x81, 0x00, 0x81, 0x04, 0x8A, 0x01, 0x35, 0x02, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x04, 0x02, 0x02, 0x1C, 0x3F, 0x1F, 0x14, 0x42, 0x33, 0x32, 0x2D,
+    0x0C, 0x43, 0x35, 0x33, 0x2A, 0x19, 0x24, 0x29, 0x13, 0x12, 0x23, 0x0F, 0x0F, 0x55, 0x0F, 0x13,
+    0x65, 0x12, 0x56, 0x29, 0x59, 0x59, 0x34, 0x08, 0x68, 0x68, 0x50, 0x5C, 0x50, 0x4C, 0x01, 0x01,
+    0x08, 0x08, 0x03, 0x01, 0x82, 0x00, 0x81, 0x01, 0x80, 0x00, 0x83, 0x01, 0xDA, 0x00, 0x9D, 0x01,
+    0x81, 0x1C, 0x87, 0x00, 0x82, 0x02, 0x81, 0x00, 0x86, 0x02, 0x89, 0x01, 0x81, 0x1C, 0x81, 0x00,
+    0x83, 0x01, 0x81, 0x00, 0x81, 0x02, 0x84, 0x1C, 0x86, 0x01, 0x82, 0x00, 0x81, 0x01, 0x81, 0x02,
+    0x2A, 0x01, 0x20, 0x19, 0x2A, 0x2C, 0x5A, 0x2D, 0x51, 0x38, 0x38, 0x51, 0x45, 0x43, 0x0C, 0x29,
+    0x33, 0x2C, 0x59, 0x6C, 0x12, 0x0F, 0x12, 0x65, 0x12, 0x12, 0x74, 0x1A, 0x37, 0x37, 0x56, 0x44,
+    0x32, 0x3D, 0x2B, 0x49, 0x4C, 0x3B, 0x3B, 0x50, 0x50, 0x5D, 0x09, 0x08, 0x83, 0x01, 0x80, 0x00,
+    0x82, 0x08, 0x80, 0x00, 0x83, 0x01, 0x82, 0x00, 0x87, 0x01, 0xCF, 0x00, 0xA1, 0x01, 0x82, 0x00,
+    0x87, 0x02, 0x82, 0x00, 0x83, 0x02, 0x87, 0x01, 0x85, 0x1C, 0x84, 0x01, 0x80, 0x1C, 0x81, 0x02,
+    0x83, 0x1C, 0x88, 0x01, 0x81, 0x02, 0x81, 0x01, 0x20, 0x20, 0x14, 0x19, 0x34, 0x5A, 0x2F, 0x1A,
+    0x51, 0x51, 0x1A, 0x37, 0x17, 0x1A, 0x17, 0x2F, 0x29, 0x35, 0x36, 0x59, 0x12, 0x51, 0x1D, 0x55,
+    0x1D, 0x1A, 0x12, 0x44, 0x44, 0x56, 0x44, 0x45, 0x2F, 0x44, 0x82, 0x29, 0x08, 0x25, 0x2C, 0x6E,
+    0x61, 0x3B, 0x68, 0x4C, 0x5D, 0x60, 0x81, 0x4C, 0x82, 0x01, 0x81, 0x08, 0x01, 0x02, 0x00, 0x84,
+    0x01, 0x81, 0x00, 0x82, 0x01, 0x81, 0x00, 0x82, 0x01, 0xCF, 0x00, 0x9F, 0x01, 0x84, 0x00, 0x84,
+    0x02, 0x80, 0x00, 0x81, 0x02, 0x82, 0x00, 0x83, 0x02, 0x85, 0x01, 0x82, 0x00, 0x03, 0x1C, 0x01,
+    0x01, 0x1C, 0x86, 0x01, 0x81, 0x02, 0x81, 0x1C, 0x8A, 0x01, 0x07, 0x02, 0x01, 0x20, 0x14, 0x1F,
+    0x42, 0x25, 0x45, 0x82, 0x1A, 0x81, 0x51, 0x81, 0x17, 0x26, 0x12, 0x0E, 0x13, 0x2F, 0x43, 0x2D,
+    0x6C, 0x37, 0x51, 0x2F, 0x17, 0x1A, 0x12, 0x12, 0x41, 0x17, 0x3D, 0x5A, 0x29, 0x32, 0x3D, 0x44,
+    0x56, 0x29, 0x29, 0x2F, 0x29, 0x34, 0x5C, 0x68, 0x61, 0x61, 0x68, 0x68, 0x47, 0x60, 0x4C, 0x01,
+    0x00, 0x82, 0x01, 0x80, 0x00, 0x84, 0x01, 0xD9, 0x00, 0x9E, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00,
+    0x81, 0x02, 0x80, 0x00, 0x84, 0x02, 0x80, 0x00, 0x84, 0x02, 0x87, 0x01, 0x81, 0x1C, 0x81, 0x01,
+    0x84, 0x1C, 0x82, 0x01, 0x83, 0x1C, 0x83, 0x01, 0x44, 0x00, 0x5E, 0x04, 0x76, 0x01, 0x00, 0x01,
+    0x02, 0x14, 0x20, 0x1F, 0x57, 0x32, 0x1A, 0x17, 0x51, 0x17, 0x51, 0x46, 0x1D, 0x6C, 0x1D, 0x13,
+    0x13, 0x12, 0x59, 0x0C, 0x17, 0x51, 0x17, 0x2F, 0x56, 0x37, 0x2D, 0x44, 0x2D, 0x44, 0x17, 0x2F,
+    0x2E, 0x2E, 0x59, 0x25, 0x2E, 0x3D, 0x44, 0x44, 0x32, 0x44, 0x44, 0x2E, 0x5C, 0x68, 0x4E, 0x3B,
+    0x61, 0x68, 0x60, 0x47, 0x47, 0x01, 0x02, 0x0D, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x87, 0x01,
+    0xD2, 0x00, 0xA0, 0x01, 0x84, 0x00, 0x81, 0x02, 0x80, 0x00, 0x84, 0x02, 0x81, 0x00, 0x83, 0x02,
+    0x86, 0x01, 0x82, 0x1C, 0x01, 0x00, 0x01, 0x84, 0x1C, 0x8B, 0x01, 0x33, 0x7C, 0x76, 0x01, 0x08,
+    0x01, 0x3F, 0x1F, 0x76, 0x14, 0x25, 0x1A, 0x12, 0x51, 0x51, 0x1D, 0x46, 0x6C, 0x1D, 0x46, 0x6C,
+    0x65, 0x0E, 0x13, 0x2D, 0x32, 0x2F, 0x51, 0x1A, 0x12, 0x32, 0x2D, 0x2F, 0x3D, 0x3D, 0x59, 0x5A,
+    0x3D, 0x2F, 0x59, 0x57, 0x34, 0x36, 0x2C, 0x34, 0x25, 0x59, 0x29, 0x3D, 0x2D, 0x56, 0x2E, 0x6E,
+    0x82, 0x3B, 0x0A, 0x61, 0x69, 0x68, 0x60, 0x47, 0x4C, 0x00, 0x00, 0x01, 0x01, 0x03, 0x89, 0x01,
+    0x80, 0x00, 0x83, 0x01, 0xCD, 0x00, 0x80, 0x04, 0x9F, 0x01, 0x84, 0x00, 0x88, 0x02, 0x80, 0x00,
+    0x83, 0x02, 0x83, 0x00, 0x01, 0x01, 0x00, 0x83, 0x1C, 0x81, 0x00, 0x83, 0x1C, 0x8B, 0x01, 0x3F,
+    0x02, 0x03, 0x0A, 0x20, 0x00, 0x3F, 0x20, 0x76, 0x2A, 0x59, 0x17, 0x51, 0x1A, 0x65, 0x13, 0x1D,
+    0x1D, 0x13, 0x0E, 0x46, 0x6C, 0x51, 0x17, 0x1D, 0x32, 0x32, 0x56, 0x36, 0x1A, 0x37, 0x25, 0x59,
+    0x2F, 0x2E, 0x2B, 0x2E, 0x2B, 0x2B, 0x3D, 0x59, 0x2B, 0x19, 0x2C, 0x2B, 0x24, 0x2A, 0x2B, 0x2E,
+    0x34, 0x2B, 0x36, 0x44, 0x34, 0x5D, 0x69, 0x3B, 0x1B, 0x69, 0x69, 0x5D, 0x5D, 0x47, 0x5D, 0x00,
+    0x83, 0x01, 0x81, 0x00, 0x8B, 0x01, 0xCD, 0x00, 0x82, 0x04, 0x9C, 0x01, 0x84, 0x00, 0x89, 0x02,
+    0x80, 0x00, 0x82, 0x02, 0x85, 0x00, 0x85, 0x1C, 0x80, 0x00, 0x83, 0x1C, 0x8A, 0x01, 0x40, 0x1C,
+    0x02, 0x03, 0x00, 0x01, 0x3F, 0x76, 0x20, 0x34, 0x51, 0x2F, 0x1A, 0x12, 0x1D, 0x12, 0x0E, 0x0E,
+    0x12, 0x1D, 0x6C, 0x51, 0x51, 0x30, 0x46, 0x1A, 0x5A, 0x2D, 0x25, 0x34, 0x37, 0x2F, 0x33, 0x2E,
+    0x2F, 0x33, 0x48, 0x57, 0x48, 0x48, 0x57, 0x5A, 0x2E, 0x48, 0x14, 0x2C, 0x49, 0x7F, 0x42, 0x2B,
+    0x31, 0x42, 0x49, 0x34, 0x59, 0x33, 0x61, 0x69, 0x3B, 0x7B, 0x61, 0x6B, 0x5D, 0x5D, 0x61, 0x5D,
+    0x82, 0x01, 0x80, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83, 0x01, 0xD3, 0x00, 0x83, 0x04, 0x9A, 0x01,
+    0x81, 0x1C, 0x81, 0x00, 0x81, 0x01, 0x8C, 0x02, 0x84, 0x00, 0x01, 0x1C, 0x00, 0x85, 0x1C, 0x80,
+    0x00, 0x83, 0x1C, 0x89, 0x01, 0x81, 0x1C, 0x46, 0x02, 0x5E, 0x02, 0x58, 0x01, 0x14, 0x33, 0x2F,
+    0x51, 0x1A, 0x12, 0x13, 0x13, 0x41, 0x0E, 0x12, 0x0E, 0x17, 0x46, 0x1A, 0x37, 0x2F, 0x55, 0x2D,
+    0x5A, 0x44, 0x2C, 0x2A, 0x56, 0x29, 0x34, 0x2B, 0x44, 0x2E, 0x2A, 0x31, 0x5F, 0x31, 0x19, 0x33,
+    0x34, 0x24, 0x2A, 0x58, 0x31, 0x3F, 0x58, 0x31, 0x2A, 0x5C, 0x7F, 0x3F, 0x24, 0x25, 0x33, 0x3B,
+    0x6B, 0x3B, 0x4E, 0x69, 0x6B, 0x61, 0x61, 0x60, 0x4C, 0x03, 0x01, 0x00, 0x01, 0x01, 0x02, 0x84,
+    0x01, 0xD3, 0x00, 0x81, 0x04, 0x80, 0x01, 0x81, 0x04, 0x97, 0x01, 0x84, 0x1C, 0x83, 0x01, 0x8B,
+    0x02, 0x80, 0x01, 0x82, 0x00, 0x85, 0x1C, 0x82, 0x01, 0x83, 0x1C, 0x89, 0x01, 0x82, 0x04, 0x48,
+    0x5E, 0x3F, 0x08, 0x01, 0x31, 0x34, 0x2D, 0x51, 0x17, 0x17, 0x1D, 0x0E, 0x41, 0x1D, 0x1D, 0x13,
+    0x6C, 0x1A, 0x17, 0x0E, 0x1A, 0x37, 0x13, 0x29, 0x2E, 0x29, 0x2A, 0x19, 0x59, 0x3D, 0x2C, 0x31,
+    0x3D, 0x59, 0x49, 0x49, 0x5C, 0x3F, 0x58, 0x19, 0x33, 0x49, 0x34, 0x02, 0x02, 0x5C, 0x50, 0x58,
+    0x49, 0x3F, 0x7B, 0x06, 0x06, 0x54, 0x25, 0x2C, 0x69, 0x6B, 0x69, 0x4E, 0x6B, 0x4D, 0x47, 0x6B,
+    0x61, 0x4C, 0x01, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x81, 0x01, 0x81, 0x00, 0x84, 0x01, 0xCD,
+    0x00, 0x83, 0x01, 0x80, 0x04, 0x8A, 0x01, 0x80, 0x04, 0x8A, 0x01, 0x85, 0x1C, 0x83, 0x01, 0x81,
+    0x02, 0x81, 0x01, 0x80, 0x00, 0x86, 0x02, 0x81, 0x01, 0x81, 0x00, 0x83, 0x1C, 0x91, 0x01, 0x83,
+    0x04, 0x39, 0x01, 0x20, 0x02, 0x19, 0x2A, 0x5A, 0x1A, 0x46, 0x6C, 0x0E, 0x0E, 0x1D, 0x12, 0x65,
+    0x1D, 0x6C, 0x12, 0x12, 0x0E, 0x0F, 0x13, 0x74, 0x65, 0x3D, 0x2E, 0x32, 0x31, 0x5C, 0x2B, 0x2E,
+    0x57, 0x31, 0x33, 0x59, 0x5C, 0x05, 0x06, 0x7F, 0x50, 0x53, 0x2A, 0x58, 0x2C, 0x2B, 0x06, 0x7B,
+    0x7B, 0x06, 0x3F, 0x02, 0x53, 0x0B, 0x7B, 0x7B, 0x3C, 0x25, 0x19, 0x6B, 0x82, 0x69, 0x08, 0x4D,
+    0x66, 0x4D, 0x6B, 0x5D, 0x6D, 0x01, 0x01, 0x04, 0x82, 0x00, 0x81, 0x01, 0x80, 0x00, 0x83, 0x01,
+    0xB4, 0x00, 0x80, 0x01, 0x99, 0x00, 0x83, 0x01, 0x81, 0x04, 0x89, 0x01, 0x81, 0x04, 0x89, 0x01,
+    0x80, 0x1C, 0x82, 0x00, 0x80, 0x1C, 0x85, 0x01, 0x01, 0x02, 0x01, 0x82, 0x00, 0x84, 0x02, 0x83,
+    0x01, 0x80, 0x00, 0x81, 0x1C, 0x8F, 0x01, 0x80, 0x1C, 0x82, 0x01, 0x82, 0x04, 0x23, 0x02, 0x1C,
+    0x02, 0x42, 0x2A, 0x5A, 0x37, 0x6C, 0x17, 0x12, 0x0E, 0x1D, 0x1A, 0x1A, 0x17, 0x1D, 0x17, 0x6C,
+    0x65, 0x0F, 0x0E, 0x28, 0x0E, 0x55, 0x3D, 0x5A, 0x3D, 0x1F, 0x02, 0x31, 0x2C, 0x57, 0x49, 0x1F,
+    0x2E, 0x58, 0x82, 0x7B, 0x13, 0x06, 0x53, 0x05, 0x31, 0x53, 0x33, 0x3F, 0x06, 0x7B, 0x16, 0x7F,
+    0x50, 0x50, 0x7B, 0x0B, 0x0B, 0x4E, 0x49, 0x33, 0x6E, 0x83, 0x6B, 0x09, 0x75, 0x66, 0x6B, 0x61,
+    0x4C, 0x01, 0x02, 0x04, 0x01, 0x00, 0x86, 0x01, 0xB5, 0x00, 0x80, 0x01, 0x99, 0x00, 0x82, 0x01,
+    0x85, 0x04, 0x92, 0x01, 0x81, 0x1C, 0x82, 0x01, 0x80, 0x02, 0x82, 0x00, 0x82, 0x01, 0x82, 0x00,
+    0x84, 0x01, 0x80, 0x02, 0x82, 0x01, 0x81, 0x1C, 0x91, 0x01, 0x80, 0x04, 0x82, 0x01, 0x29, 0x0D,
+    0x05, 0x80, 0x76, 0x02, 0x19, 0x5F, 0x33, 0x6C, 0x12, 0x17, 0x12, 0x0E, 0x12, 0x51, 0x2D, 0x12,
+    0x12, 0x17, 0x1A, 0x1D, 0x12, 0x17, 0x10, 0x10, 0x0E, 0x55, 0x3D, 0x5A, 0x5A, 0x5F, 0x3F, 0x1F,
+    0x24, 0x14, 0x02, 0x05, 0x48, 0x2A, 0x16, 0x7B, 0x4E, 0x82, 0x7B, 0x04, 0x49, 0x7B, 0x31, 0x2A,
+    0x7B, 0x82, 0x16, 0x19, 0x50, 0x0B, 0x06, 0x4E, 0x4E, 0x69, 0x69, 0x3C, 0x2B, 0x47, 0x4D, 0x6B,
+    0x6B, 0x4D, 0x66, 0x4D, 0x69, 0x61, 0x08, 0x1F, 0x00, 0x01, 0x7F, 0x04, 0x02, 0x00, 0x82, 0x01,
+    0x02, 0x81, 0x03, 0x00, 0x82, 0x01, 0x80, 0x00, 0x82, 0x02, 0xC7, 0x00, 0x80, 0x01, 0x86, 0x04,
+    0x01, 0x01, 0x04, 0x85, 0x01, 0x81, 0x04, 0x89, 0x01, 0x81, 0x1C, 0x89, 0x01, 0x84, 0x00, 0x9B,
+    0x01, 0x3C, 0x5E, 0x1C, 0x01, 0x5E, 0x01, 0x01, 0x80, 0x31, 0x2A, 0x48, 0x51, 0x1D, 0x17, 0x17,
+    0x12, 0x41, 0x37, 0x36, 0x6C, 0x12, 0x12, 0x59, 0x0C, 0x59, 0x56, 0x13, 0x18, 0x39, 0x23, 0x37,
+    0x2C, 0x33, 0x36, 0x19, 0x3F, 0x02, 0x19, 0x58, 0x7F, 0x7B, 0x58, 0x2A, 0x0B, 0x7B, 0x4E, 0x0B,
+    0x7B, 0x69, 0x50, 0x50, 0x68, 0x2B, 0x7B, 0x16, 0x1B, 0x4E, 0x7B, 0x7B, 0x0B, 0x0B, 0x6B, 0x82,
+    0x69, 0x01, 0x49, 0x34, 0x82, 0x4D, 0x81, 0x66, 0x0F, 0x75, 0x4D, 0x61, 0x5D, 0x2C, 0x3D, 0x24,
+    0x81, 0x01, 0x76, 0x08, 0x02, 0x08, 0x05, 0x01, 0x81, 0x83, 0x01, 0x81, 0x00, 0x81, 0x02, 0xC7,
+    0x00, 0x89, 0x04, 0x85, 0x01, 0x80, 0x04, 0x82, 0x01, 0x82, 0x1C, 0x83, 0x01, 0x82, 0x1C, 0x8A,
+    0x01, 0x84, 0x00, 0x9B, 0x01, 0x01, 0x0D, 0x08, 0x82, 0x01, 0x2E, 0x14, 0x2A, 0x5F, 0x51, 0x1D,
+    0x12, 0x17, 0x0E, 0x0E, 0x65, 0x25, 0x37, 0x1A, 0x1A, 0x5A, 0x2C, 0x25, 0x24, 0x2F, 0x39, 0x28,
+    0x39, 0x55, 0x44, 0x19, 0x34, 0x59, 0x19, 0x5C, 0x53, 0x7F, 0x5C, 0x7F, 0x0B, 0x7B, 0x2A, 0x0B,
+    0x0B, 0x4E, 0x4E, 0x0B, 0x4E, 0x7B, 0x68, 0x4E, 0x2C, 0x49, 0x83, 0x4E, 0x1F, 0x50, 0x7B, 0x4E,
+    0x68, 0x6B, 0x69, 0x6B, 0x6B, 0x49, 0x24, 0x66, 0x4D, 0x66, 0x75, 0x66, 0x75, 0x47, 0x4E, 0x68,
+    0x72, 0x52, 0x2B, 0x2E, 0x3C, 0x01, 0x1C, 0x76, 0x01, 0x02, 0x02, 0x01, 0x03, 0x81, 0x01, 0x82,
+    0x00, 0x80, 0x01, 0x9B, 0x00, 0x83, 0x01, 0xA7, 0x00, 0x89, 0x04, 0x89, 0x01, 0x82, 0x1C, 0x80,
+    0x01, 0x85, 0x1C, 0x8B, 0x01, 0x84, 0x00, 0x99, 0x01, 0x2D, 0x08, 0x01, 0x5E, 0x0D, 0x02, 0x14,
+    0x57, 0x19, 0x44, 0x6C, 0x37, 0x0E, 0x17, 0x12, 0x13, 0x3D, 0x36, 0x37, 0x2F, 0x36, 0x58, 0x72,
+    0x49, 0x2C, 0x65, 0x39, 0x71, 0x39, 0x0E, 0x44, 0x50, 0x31, 0x3D, 0x2A, 0x05, 0x50, 0x0B, 0x02,
+    0x06, 0x0B, 0x4E, 0x49, 0x7B, 0x69, 0x4E, 0x69, 0x82, 0x4E, 0x03, 0x60, 0x69, 0x31, 0x2B, 0x83,
+    0x69, 0x81, 0x0B, 0x1B, 0x69, 0x3B, 0x68, 0x6B, 0x6B, 0x66, 0x66, 0x2A, 0x70, 0x66, 0x66, 0x75,
+    0x75, 0x66, 0x66, 0x60, 0x0B, 0x60, 0x60, 0x5E, 0x57, 0x3D, 0x62, 0x66, 0x3B, 0x0A, 0x01, 0x08,
+    0x81, 0x03, 0x81, 0x01, 0x82, 0x00, 0x80, 0x01, 0x9A, 0x00, 0x84, 0x01, 0xA7, 0x00, 0x82, 0x01,
+    0x84, 0x04, 0x80, 0x01, 0x82, 0x04, 0x87, 0x01, 0x82, 0x00, 0x80, 0x01, 0x85, 0x00, 0x81, 0x04,
+    0x81, 0x02, 0x82, 0x00, 0x84, 0x01, 0x84, 0x00, 0x98, 0x01, 0x2E, 0x02, 0x00, 0x01, 0x3F, 0x5E,
+    0x01, 0x2C, 0x34, 0x2D, 0x46, 0x12, 0x1D, 0x12, 0x13, 0x0E, 0x44, 0x25, 0x2F, 0x2F, 0x25, 0x24,
+    0x24, 0x34, 0x50, 0x59, 0x39, 0x10, 0x10, 0x39, 0x0E, 0x36, 0x68, 0x5C, 0x2E, 0x2B, 0x04, 0x42,
+    0x0B, 0x7B, 0x06, 0x0B, 0x69, 0x5D, 0x53, 0x69, 0x69, 0x6B, 0x82, 0x69, 0x81, 0x6B, 0x03, 0x54,
+    0x3D, 0x68, 0x6B, 0x82, 0x69, 0x1D, 0x1B, 0x69, 0x6B, 0x69, 0x6B, 0x4D, 0x75, 0x4A, 0x66, 0x31,
+    0x66, 0x66, 0x75, 0x66, 0x66, 0x4D, 0x4D, 0x68, 0x68, 0x05, 0x5B, 0x1B, 0x3C, 0x44, 0x11, 0x61,
+    0x4E, 0x1E, 0x03, 0x01, 0xA1, 0x00, 0x84, 0x01, 0x8A, 0x00, 0x84, 0x01, 0x97, 0x00, 0x85, 0x01,
+    0x81, 0x04, 0x80, 0x01, 0x83, 0x04, 0x87, 0x01, 0x81, 0x00, 0x80, 0x01, 0x83, 0x00, 0x81, 0x01,
+    0x81, 0x04, 0x81, 0x02, 0x84, 0x00, 0x83, 0x01, 0x84, 0x00, 0x80, 0x1C, 0x96, 0x01, 0x18, 0x76,
+    0x02, 0x5E, 0x00, 0x24, 0x5A, 0x74, 0x12, 0x13, 0x46, 0x12, 0x1D, 0x13, 0x17, 0x0E, 0x33, 0x29,
+    0x2F, 0x29, 0x2E, 0x3C, 0x72, 0x24, 0x54, 0x51, 0x82, 0x10, 0x1B, 0x13, 0x12, 0x34, 0x61, 0x68,
+    0x34, 0x25, 0x02, 0x19, 0x50, 0x61, 0x7B, 0x4E, 0x69, 0x6B, 0x68, 0x69, 0x69, 0x4D, 0x4D, 0x6B,
+    0x6B, 0x4D, 0x66, 0x4D, 0x2E, 0x3C, 0x4D, 0x83, 0x6B, 0x81, 0x69, 0x81, 0x6B, 0x05, 0x66, 0x75,
+    0x40, 0x40, 0x5D, 0x4C, 0x82, 0x66, 0x81, 0x4D, 0x0C, 0x60, 0x61, 0x68, 0x7B, 0x7B, 0x61, 0x4E,
+    0x6E, 0x56, 0x2B, 0x4E, 0x4E, 0x5B, 0x8C, 0x00, 0x80, 0x01, 0x94, 0x00, 0x84, 0x01, 0x89, 0x00,
+    0x85, 0x01, 0x97, 0x00, 0x85, 0x01, 0x82, 0x04, 0x81, 0x01, 0x82, 0x04, 0x85, 0x01, 0x81, 0x00,
+    0x85, 0x02, 0x83, 0x01, 0x81, 0x02, 0x85, 0x1C, 0x85, 0x01, 0x82, 0x1C, 0x96, 0x01, 0x3C, 0x00,
+    0x01, 0x5F, 0x29, 0x13, 0x10, 0x0E, 0x46, 0x46, 0x12, 0x6C, 0x12, 0x1D, 0x0F, 0x35, 0x59, 0x56,
+    0x59, 0x2D, 0x59, 0x3C, 0x2C, 0x54, 0x3C, 0x0E, 0x10, 0x18, 0x23, 0x46, 0x43, 0x24, 0x6B, 0x5D,
+    0x34, 0x5A, 0x49, 0x5C, 0x19, 0x3B, 0x61, 0x69, 0x6B, 0x6B, 0x60, 0x61, 0x69, 0x4D, 0x75, 0x4D,
+    0x75, 0x4D, 0x66, 0x4D, 0x24, 0x2B, 0x66, 0x66, 0x4D, 0x66, 0x66, 0x69, 0x82, 0x6B, 0x17, 0x4D,
+    0x66, 0x75, 0x75, 0x66, 0x3F, 0x61, 0x4D, 0x66, 0x4D, 0x6B, 0x6B, 0x3B, 0x61, 0x50, 0x7F, 0x6D,
+    0x47, 0x6B, 0x3C, 0x44, 0x73, 0x1B, 0x0A, 0x8D, 0x00, 0x80, 0x01, 0x92, 0x00, 0x86, 0x01, 0x89,
+    0x00, 0x86, 0x01, 0x8D, 0x00, 0x83, 0x01, 0x83, 0x00, 0x85, 0x01, 0x84, 0x04, 0x81, 0x01, 0x81,
+    0x04, 0x01, 0x01, 0x1C, 0x82, 0x01, 0x80, 0x1C, 0x86, 0x02, 0x83, 0x01, 0x81, 0x02, 0x86, 0x1C,
+    0x84, 0x01, 0x81, 0x1C, 0x8F, 0x01, 0x80, 0x1C, 0x84, 0x01, 0x4D, 0x1C, 0x02, 0x02, 0x2E, 0x10,
+    0x18, 0x0E, 0x0F, 0x12, 0x6C, 0x13, 0x17, 0x1D, 0x12, 0x17, 0x12, 0x59, 0x1A, 0x0C, 0x29, 0x1A,
+    0x5A, 0x49, 0x24, 0x5D, 0x62, 0x10, 0x10, 0x1D, 0x6C, 0x38, 0x30, 0x2C, 0x6B, 0x6B, 0x2B, 0x3D,
+    0x34, 0x50, 0x31, 0x7B, 0x69, 0x6B, 0x69, 0x6B, 0x6B, 0x69, 0x61, 0x6B, 0x75, 0x66, 0x40, 0x4D,
+    0x66, 0x4D, 0x54, 0x2B, 0x47, 0x4D, 0x4D, 0x66, 0x75, 0x66, 0x6B, 0x66, 0x6B, 0x66, 0x4D, 0x4D,
+    0x6B, 0x6B, 0x5D, 0x54, 0x69, 0x4D, 0x4D, 0x6B, 0x61, 0x82, 0x68, 0x07, 0x50, 0x49, 0x60, 0x4D,
+    0x6E, 0x56, 0x31, 0x22, 0xA0, 0x00, 0x88, 0x01, 0x88, 0x00, 0x88, 0x01, 0x84, 0x00, 0x81, 0x01,
+    0x85, 0x00, 0x83, 0x01, 0x83, 0x00, 0x87, 0x01, 0x85, 0x04, 0x84, 0x01, 0x80, 0x02, 0x87, 0x00,
+    0x86, 0x01, 0x86, 0x1C, 0x80, 0x01, 0x87, 0x1C, 0x81, 0x01, 0x81, 0x1C, 0x89, 0x01, 0x66, 0x08,
+    0x00, 0x76, 0x01, 0x3F, 0x04, 0x01, 0x36, 0x10, 0x10, 0x0E, 0x10, 0x13, 0x1D, 0x17, 0x1D, 0x1D,
+    0x0E, 0x1D, 0x74, 0x38, 0x2F, 0x2F, 0x32, 0x6C, 0x37, 0x25, 0x49, 0x5C, 0x5D, 0x63, 0x0F, 0x1D,
+    0x46, 0x38, 0x38, 0x30, 0x33, 0x47, 0x6B, 0x3C, 0x29, 0x2B, 0x3C, 0x24, 0x50, 0x61, 0x6B, 0x7B,
+    0x6B, 0x4D, 0x6B, 0x68, 0x6B, 0x66, 0x66, 0x75, 0x66, 0x4D, 0x6B, 0x54, 0x2E, 0x50, 0x61, 0x61,
+    0x4D, 0x66, 0x66, 0x4D, 0x66, 0x4D, 0x75, 0x66, 0x47, 0x6B, 0x69, 0x61, 0x58, 0x3B, 0x6B, 0x4D,
+    0x4D, 0x69, 0x61, 0x7B, 0x50, 0x4C, 0x50, 0x24, 0x4D, 0x57, 0x12, 0x42, 0x1E, 0x20, 0x1F, 0x08,
+    0x02, 0x08, 0x01, 0x08, 0x08, 0x01, 0x97, 0x00, 0x87, 0x01, 0x8B, 0x00, 0x82, 0x03, 0x82, 0x01,
+    0x85, 0x00, 0x81, 0x01, 0x80, 0x00, 0x82, 0x01, 0x81, 0x00, 0x85, 0x01, 0x81, 0x00, 0x87, 0x01,
+    0x85, 0x04, 0x84, 0x01, 0x80, 0x02, 0x89, 0x00, 0x83, 0x01, 0x86, 0x1C, 0x81, 0x01, 0x88, 0x1C,
+    0x80, 0x01, 0x81, 0x1C, 0x89, 0x01, 0x81, 0x04, 0x35, 0x01, 0x7E, 0x22, 0x58, 0x33, 0x37, 0x12,
+    0x13, 0x10, 0x23, 0x12, 0x17, 0x6C, 0x0E, 0x1D, 0x0E, 0x0E, 0x12, 0x51, 0x37, 0x2F, 0x56, 0x17,
+    0x37, 0x33, 0x58, 0x58, 0x54, 0x63, 0x1D, 0x1A, 0x38, 0x79, 0x79, 0x30, 0x25, 0x54, 0x60, 0x54,
+    0x36, 0x25, 0x2A, 0x2A, 0x31, 0x7B, 0x69, 0x0B, 0x69, 0x4D, 0x61, 0x0B, 0x0B, 0x4D, 0x66, 0x82,
+    0x4D, 0x2B, 0x68, 0x3C, 0x2B, 0x49, 0x50, 0x50, 0x61, 0x4D, 0x4D, 0x6B, 0x66, 0x4D, 0x4D, 0x75,
+    0x6B, 0x68, 0x68, 0x4E, 0x50, 0x49, 0x5D, 0x60, 0x47, 0x6B, 0x68, 0x68, 0x50, 0x50, 0x7B, 0x2C,
+    0x24, 0x42, 0x56, 0x57, 0x4B, 0x7C, 0x58, 0x03, 0x01, 0x02, 0x00, 0x08, 0x08, 0x00, 0x87, 0x08,
+    0x93, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x85, 0x01, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+    0x82, 0x00, 0x83, 0x01, 0x81, 0x00, 0x88, 0x04, 0x81, 0x01, 0x82, 0x04, 0x83, 0x01, 0x81, 0x02,
+    0x8C, 0x00, 0x86, 0x1C, 0x83, 0x01, 0x04, 0x1C, 0x01, 0x1C, 0x1C, 0x01, 0x84, 0x1C, 0x8A, 0x01,
+    0x65, 0x76, 0x01, 0x01, 0x76, 0x22, 0x57, 0x37, 0x12, 0x12, 0x10, 0x23, 0x1D, 0x1D, 0x17, 0x6C,
+    0x0E, 0x1D, 0x0E, 0x0E, 0x1A, 0x1A, 0x12, 0x1A, 0x12, 0x12, 0x37, 0x2C, 0x5C, 0x49, 0x54, 0x63,
+    0x38, 0x38, 0x43, 0x79, 0x30, 0x30, 0x36, 0x49, 0x54, 0x3C, 0x2C, 0x3D, 0x33, 0x2A, 0x2C, 0x3F,
+    0x7B, 0x53, 0x50, 0x6B, 0x61, 0x06, 0x7B, 0x69, 0x4D, 0x69, 0x6B, 0x47, 0x60, 0x54, 0x2C, 0x31,
+    0x5C, 0x49, 0x50, 0x61, 0x47, 0x50, 0x4D, 0x4D, 0x60, 0x47, 0x4D, 0x68, 0x5C, 0x61, 0x7B, 0x24,
+    0x50, 0x68, 0x60, 0x6B, 0x5D, 0x68, 0x53, 0x50, 0x7F, 0x5C, 0x2E, 0x48, 0x29, 0x48, 0x1F, 0x1F,
+    0x5F, 0x00, 0x08, 0x08, 0x02, 0x01, 0x00, 0x88, 0x08, 0x95, 0x00, 0x81, 0x01, 0x8C, 0x00, 0x84,
+    0x01, 0x85, 0x00, 0x81, 0x01, 0x82, 0x00, 0x82, 0x01, 0x81, 0x00, 0x84, 0x01, 0x80, 0x00, 0x84,
+    0x04, 0x87, 0x01, 0x80, 0x04, 0x83, 0x01, 0x81, 0x02, 0x8B, 0x00, 0x87, 0x1C, 0x86, 0x01, 0x01,
+    0x1C, 0x01, 0x82, 0x1C, 0x01, 0x01, 0x1C, 0x8A, 0x01, 0x1E, 0x02, 0x01, 0x01, 0x02, 0x04, 0x2E,
+    0x12, 0x38, 0x0F, 0x10, 0x12, 0x17, 0x1D, 0x17, 0x17, 0x12, 0x1D, 0x13, 0x74, 0x1A, 0x17, 0x12,
+    0x1A, 0x0F, 0x12, 0x37, 0x2A, 0x19, 0x49, 0x62, 0x11, 0x82, 0x43, 0x82, 0x30, 0x3D, 0x36, 0x57,
+    0x3C, 0x72, 0x3C, 0x2E, 0x59, 0x34, 0x2C, 0x48, 0x02, 0x50, 0x50, 0x7B, 0x4E, 0x7F, 0x06, 0x0B,
+    0x69, 0x69, 0x3B, 0x50, 0x60, 0x54, 0x24, 0x2A, 0x5C, 0x24, 0x19, 0x50, 0x5D, 0x49, 0x68, 0x6B,
+    0x61, 0x68, 0x6B, 0x6B, 0x50, 0x50, 0x68, 0x31, 0x19, 0x7B, 0x53, 0x5D, 0x61, 0x7B, 0x50, 0x50,
+    0x5C, 0x50, 0x2A, 0x48, 0x72, 0x42, 0x1F, 0x1F, 0x14, 0x00, 0x00, 0x02, 0x81, 0x00, 0x8F, 0x08,
+    0x9F, 0x00, 0x83, 0x01, 0x80, 0x00, 0x81, 0x01, 0x8D, 0x00, 0x83, 0x01, 0x80, 0x00, 0x84, 0x04,
+    0x84, 0x01, 0x83, 0x04, 0x82, 0x01, 0x82, 0x02, 0x83, 0x00, 0x88, 0x01, 0x84, 0x1C, 0x88, 0x01,
+    0x83, 0x1C, 0x82, 0x01, 0x80, 0x1C, 0x89, 0x01, 0x1F, 0x02, 0x00, 0x01, 0x80, 0x05, 0x2E, 0x51,
+    0x1A, 0x23, 0x1D, 0x1A, 0x1D, 0x6C, 0x17, 0x13, 0x12, 0x13, 0x0E, 0x12, 0x17, 0x1D, 0x1D, 0x12,
+    0x0E, 0x65, 0x37, 0x2A, 0x34, 0x3C, 0x62, 0x11, 0x79, 0x84, 0x30, 0x0A, 0x36, 0x2B, 0x49, 0x63,
+    0x2C, 0x24, 0x5A, 0x3D, 0x2B, 0x2B, 0x31, 0x82, 0x50, 0x03, 0x7B, 0x06, 0x3F, 0x06, 0x82, 0x0B,
+    0x2C, 0x50, 0x5C, 0x54, 0x3C, 0x31, 0x5C, 0x57, 0x57, 0x58, 0x53, 0x31, 0x3C, 0x61, 0x60, 0x0B,
+    0x68, 0x69, 0x68, 0x31, 0x50, 0x5C, 0x2C, 0x02, 0x53, 0x50, 0x68, 0x3B, 0x50, 0x50, 0x02, 0x7F,
+    0x58, 0x2E, 0x3C, 0x02, 0x1F, 0x1F, 0x42, 0x02, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x8F, 0x08,
+    0x87, 0x00, 0x85, 0x01, 0x8F, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x8A, 0x00, 0x87, 0x01,
+    0x82, 0x04, 0x80, 0x01, 0x83, 0x04, 0x80, 0x01, 0x84, 0x04, 0x81, 0x1C, 0x83, 0x01, 0x83, 0x00,
+    0x96, 0x01, 0x83, 0x1C, 0x82, 0x01, 0x80, 0x1C, 0x88, 0x01, 0x1F, 0x04, 0x01, 0x01, 0x76, 0x76,
+    0x22, 0x2E, 0x12, 0x12, 0x13, 0x1A, 0x17, 0x17, 0x6C, 0x0E, 0x1D, 0x1D, 0x13, 0x0E, 0x12, 0x12,
+    0x65, 0x1D, 0x65, 0x0F, 0x65, 0x37, 0x2C, 0x5A, 0x3C, 0x62, 0x35, 0x83, 0x30, 0x82, 0x11, 0x3A,
+    0x2E, 0x3C, 0x72, 0x63, 0x62, 0x2C, 0x59, 0x5A, 0x2B, 0x2B, 0x3F, 0x02, 0x49, 0x3F, 0x7F, 0x3F,
+    0x80, 0x06, 0x7B, 0x0B, 0x50, 0x50, 0x54, 0x54, 0x42, 0x58, 0x5F, 0x34, 0x2A, 0x58, 0x2C, 0x2A,
+    0x53, 0x68, 0x50, 0x50, 0x0B, 0x3B, 0x5C, 0x31, 0x05, 0x2B, 0x19, 0x06, 0x50, 0x50, 0x3B, 0x53,
+    0x5C, 0x50, 0x3F, 0x05, 0x24, 0x2A, 0x5E, 0x5E, 0x00, 0x1F, 0x02, 0x82, 0x08, 0x82, 0x00, 0x91,
+    0x08, 0x87, 0x00, 0x85, 0x01, 0x8D, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83, 0x01, 0x82, 0x00, 0x8D,
+    0x01, 0x80, 0x00, 0x86, 0x01, 0x80, 0x1C, 0x82, 0x04, 0x82, 0x02, 0x01, 0x1C, 0x00, 0x86, 0x01,
+    0x80, 0x00, 0x97, 0x01, 0x82, 0x1C, 0x90, 0x01, 0x0B, 0x04, 0x4B, 0x33, 0x17, 0x0E, 0x0E, 0x17,
+    0x17, 0x6C, 0x17, 0x0E, 0x17, 0x82, 0x0E, 0x0B, 0x1D, 0x0E, 0x65, 0x1D, 0x55, 0x55, 0x12, 0x12,
+    0x2E, 0x59, 0x24, 0x62, 0x83, 0x30, 0x83, 0x11, 0x30, 0x5A, 0x49, 0x72, 0x11, 0x72, 0x24, 0x25,
+    0x32, 0x2E, 0x33, 0x31, 0x5C, 0x58, 0x31, 0x5F, 0x3F, 0x3F, 0x02, 0x50, 0x0B, 0x50, 0x5D, 0x3C,
+    0x54, 0x49, 0x19, 0x19, 0x2C, 0x2B, 0x2A, 0x2B, 0x48, 0x50, 0x7B, 0x50, 0x49, 0x50, 0x0B, 0x02,
+    0x42, 0x3F, 0x48, 0x2B, 0x3F, 0x50, 0x49, 0x50, 0x0B, 0x50, 0x82, 0x3F, 0x0C, 0x01, 0x48, 0x2A,
+    0x33, 0x49, 0x20, 0x00, 0x20, 0x58, 0x08, 0x81, 0x08, 0x5C, 0x91, 0x08, 0x87, 0x00, 0x84, 0x01,
+    0x8E, 0x00, 0x01, 0x02, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x8C, 0x01, 0x82, 0x00, 0x85,
+    0x01, 0x81, 0x1C, 0x83, 0x04, 0x8A, 0x01, 0x80, 0x00, 0x98, 0x01, 0x81, 0x1C, 0x81, 0x01, 0x80,
+    0x1C, 0x8A, 0x01, 0x1D, 0x02, 0x00, 0x01, 0x02, 0x4B, 0x33, 0x37, 0x10, 0x13, 0x17, 0x6C, 0x1D,
+    0x0E, 0x12, 0x0E, 0x0F, 0x0E, 0x0E, 0x1D, 0x65, 0x74, 0x0E, 0x23, 0x55, 0x37, 0x0F, 0x36, 0x5A,
+    0x57, 0x3C, 0x81, 0x30, 0x85, 0x11, 0x3C, 0x5A, 0x31, 0x62, 0x11, 0x25, 0x72, 0x25, 0x5A, 0x59,
+    0x2E, 0x34, 0x14, 0x80, 0x31, 0x48, 0x19, 0x5F, 0x3F, 0x7F, 0x0B, 0x50, 0x54, 0x70, 0x3C, 0x54,
+    0x19, 0x1F, 0x2A, 0x33, 0x2B, 0x2E, 0x2C, 0x58, 0x02, 0x50, 0x31, 0x58, 0x0B, 0x7F, 0x49, 0x31,
+    0x31, 0x3D, 0x1F, 0x02, 0x31, 0x58, 0x06, 0x7B, 0x02, 0x58, 0x58, 0x3F, 0x14, 0x2B, 0x44, 0x12,
+    0x3D, 0x42, 0x76, 0x01, 0x82, 0x00, 0x80, 0x03, 0x8D, 0x08, 0x81, 0x00, 0x81, 0x08, 0x85, 0x00,
+    0x84, 0x01, 0x8B, 0x00, 0x82, 0x01, 0x80, 0x00, 0x82, 0x02, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00,
+    0x83, 0x01, 0x82, 0x1C, 0x84, 0x01, 0x83, 0x00, 0x85, 0x01, 0x81, 0x1C, 0x82, 0x02, 0x82, 0x01,
+    0x81, 0x04, 0x86, 0x01, 0x80, 0x00, 0x83, 0x02, 0x91, 0x01, 0x83, 0x1C, 0x82, 0x04, 0x82, 0x1C,
+    0x80, 0x01, 0x82, 0x1C, 0x83, 0x01, 0x09, 0x04, 0x00, 0x01, 0x01, 0x76, 0x22, 0x34, 0x37, 0x10,
+    0x13, 0x82, 0x17, 0x81, 0x1D, 0x81, 0x0F, 0x0E, 0x65, 0x1D, 0x65, 0x65, 0x1D, 0x13, 0x10, 0x0F,
+    0x12, 0x13, 0x2D, 0x5A, 0x33, 0x31, 0x35, 0x81, 0x30, 0x84, 0x11, 0x40, 0x36, 0x31, 0x62, 0x63,
+    0x11, 0x25, 0x36, 0x3D, 0x59, 0x3D, 0x2E, 0x2A, 0x19, 0x3F, 0x2B, 0x5F, 0x48, 0x42, 0x19, 0x06,
+    0x7B, 0x54, 0x47, 0x62, 0x3C, 0x54, 0x3F, 0x5F, 0x2B, 0x3D, 0x3D, 0x33, 0x49, 0x50, 0x5C, 0x14,
+    0x2A, 0x50, 0x16, 0x3F, 0x57, 0x5F, 0x3D, 0x48, 0x3F, 0x49, 0x49, 0x5C, 0x06, 0x7F, 0x3F, 0x14,
+    0x58, 0x5C, 0x48, 0x3D, 0x44, 0x44, 0x56, 0x48, 0x4C, 0x4C, 0x02, 0x5C, 0x00, 0x82, 0x08, 0x81,
+    0x00, 0x01, 0x6E, 0x02, 0x89, 0x08, 0x83, 0x00, 0x82, 0x01, 0x82, 0x00, 0x86, 0x01, 0x85, 0x00,
+    0x87, 0x02, 0x91, 0x01, 0x85, 0x00, 0x85, 0x01, 0x81, 0x1C, 0x83, 0x02, 0x81, 0x01, 0x81, 0x04,
+    0x86, 0x01, 0x02, 0x00, 0x02, 0x1C, 0x8D, 0x01, 0x82, 0x04, 0x83, 0x01, 0x80, 0x1C, 0x85, 0x04,
+    0x80, 0x01, 0x84, 0x1C, 0x88, 0x01, 0x1B, 0x4B, 0x48, 0x37, 0x10, 0x0E, 0x12, 0x17, 0x1D, 0x0E,
+    0x0E, 0x0F, 0x0F, 0x0E, 0x1D, 0x65, 0x0F, 0x1D, 0x0F, 0x10, 0x13, 0x12, 0x55, 0x1A, 0x32, 0x3D,
+    0x2A, 0x11, 0x30, 0x86, 0x11, 0x15, 0x57, 0x24, 0x63, 0x63, 0x25, 0x5A, 0x5A, 0x59, 0x5A, 0x3D,
+    0x2B, 0x5F, 0x5C, 0x42, 0x2B, 0x48, 0x5F, 0x5F, 0x3F, 0x50, 0x50, 0x47, 0x82, 0x3C, 0x2A, 0x50,
+    0x5C, 0x2B, 0x3D, 0x3D, 0x57, 0x31, 0x49, 0x58, 0x42, 0x57, 0x3F, 0x06, 0x3F, 0x2A, 0x48, 0x3D,
+    0x2E, 0x3F, 0x31, 0x2A, 0x49, 0x7F, 0x53, 0x3F, 0x58, 0x14, 0x58, 0x2A, 0x2E, 0x29, 0x24, 0x2E,
+    0x44, 0x81, 0x5D, 0x60, 0x5D, 0x81, 0x01, 0x08, 0x08, 0x6E, 0x8C, 0x08, 0x89, 0x00, 0x83, 0x01,
+    0x80, 0x03, 0x81, 0x01, 0x84, 0x00, 0x83, 0x02, 0x80, 0x01, 0x84, 0x02, 0x90, 0x01, 0x01, 0x02,
+    0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x01, 0x83, 0x1C, 0x83, 0x00, 0x99, 0x01, 0x84, 0x04, 0x82,
+    0x01, 0x86, 0x04, 0x82, 0x01, 0x80, 0x1C, 0x84, 0x01, 0x12, 0x81, 0x04, 0x02, 0x03, 0x00, 0x80,
+    0x14, 0x12, 0x13, 0x1D, 0x12, 0x17, 0x1D, 0x0F, 0x13, 0x0F, 0x0E, 0x0E, 0x1D, 0x82, 0x0E, 0x08,
+    0x0F, 0x10, 0x13, 0x65, 0x0F, 0x6C, 0x0C, 0x29, 0x2C, 0x88, 0x11, 0x44, 0x2E, 0x24, 0x63, 0x63,
+    0x72, 0x5A, 0x36, 0x36, 0x5A, 0x25, 0x25, 0x57, 0x31, 0x49, 0x2B, 0x57, 0x57, 0x48, 0x48, 0x53,
+    0x50, 0x60, 0x3C, 0x62, 0x3C, 0x49, 0x5C, 0x48, 0x2E, 0x59, 0x2A, 0x5F, 0x57, 0x58, 0x2A, 0x2C,
+    0x42, 0x7F, 0x7F, 0x2A, 0x2B, 0x2E, 0x3D, 0x3F, 0x2A, 0x2C, 0x31, 0x02, 0x7F, 0x50, 0x58, 0x19,
+    0x14, 0x19, 0x2B, 0x2E, 0x2B, 0x4C, 0x24, 0x3C, 0x68, 0x54, 0x47, 0x47, 0x4C, 0x02, 0x6E, 0x08,
+    0x20, 0x8B, 0x08, 0x81, 0x00, 0x80, 0x08, 0x86, 0x00, 0x83, 0x01, 0x80, 0x03, 0x81, 0x01, 0x82,
+    0x00, 0x82, 0x02, 0x84, 0x01, 0x85, 0x02, 0x92, 0x01, 0x81, 0x00, 0x85, 0x01, 0x84, 0x1C, 0x81,
+    0x00, 0x82, 0x1C, 0x9A, 0x01, 0x8C, 0x04, 0x87, 0x01, 0x08, 0x22, 0x00, 0x02, 0x04, 0x01, 0x76,
+    0x7F, 0x2D, 0x1D, 0x82, 0x17, 0x01, 0x1D, 0x13, 0x81, 0x0F, 0x82, 0x0E, 0x0C, 0x0F, 0x0E, 0x0E,
+    0x0F, 0x23, 0x0F, 0x65, 0x1D, 0x38, 0x30, 0x44, 0x2E, 0x25, 0x87, 0x11, 0x02, 0x36, 0x2A, 0x24,
+    0x81, 0x63, 0x82, 0x25, 0x81, 0x5A, 0x3A, 0x2E, 0x5A, 0x24, 0x1F, 0x2A, 0x3D, 0x2E, 0x2B, 0x48,
+    0x5F, 0x5C, 0x54, 0x54, 0x4F, 0x62, 0x49, 0x58, 0x19, 0x2B, 0x33, 0x31, 0x2C, 0x2B, 0x31, 0x2A,
+    0x33, 0x48, 0x7F, 0x7F, 0x31, 0x2B, 0x33, 0x29, 0x5F, 0x57, 0x34, 0x48, 0x3F, 0x7F, 0x50, 0x3F,
+    0x19, 0x19, 0x58, 0x48, 0x2C, 0x2B, 0x19, 0x09, 0x5C, 0x6B, 0x5D, 0x6E, 0x4C, 0x47, 0x60, 0x0D,
+    0x02, 0x6E, 0x8E, 0x08, 0x86, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x02, 0x82, 0x01, 0x81, 0x02,
+    0x82, 0x00, 0x83, 0x02, 0x8A, 0x01, 0x80, 0x04, 0x85, 0x01, 0x81, 0x02, 0x85, 0x01, 0x84, 0x1C,
+    0x81, 0x00, 0x82, 0x1C, 0x92, 0x01, 0x80, 0x1C, 0x83, 0x01, 0x80, 0x04, 0x81, 0x01, 0x84, 0x04,
+    0x82, 0x01, 0x84, 0x04, 0x87, 0x01, 0x07, 0x7F, 0x03, 0x01, 0x01, 0x7C, 0x4B, 0x48, 0x51, 0x82,
+    0x17, 0x01, 0x1D, 0x0E, 0x82, 0x0F, 0x0F, 0x0E, 0x13, 0x0E, 0x0F, 0x1D, 0x0E, 0x13, 0x0F, 0x0F,
+    0x12, 0x46, 0x38, 0x43, 0x45, 0x3D, 0x25, 0x85, 0x11, 0x06, 0x15, 0x11, 0x11, 0x2B, 0x2A, 0x72,
+    0x25, 0x82, 0x63, 0x06, 0x36, 0x25, 0x2E, 0x25, 0x33, 0x2A, 0x3F, 0x82, 0x2E, 0x35, 0x2B, 0x48,
+    0x49, 0x54, 0x4F, 0x7D, 0x70, 0x3C, 0x3C, 0x31, 0x2B, 0x2B, 0x31, 0x33, 0x5A, 0x57, 0x31, 0x2E,
+    0x2E, 0x3F, 0x7F, 0x5F, 0x48, 0x33, 0x3D, 0x48, 0x48, 0x2B, 0x2B, 0x5F, 0x7F, 0x02, 0x80, 0x19,
+    0x19, 0x14, 0x2A, 0x2A, 0x48, 0x31, 0x02, 0x68, 0x47, 0x66, 0x6B, 0x5D, 0x50, 0x60, 0x60, 0x5D,
+    0x02, 0x08, 0x00, 0x81, 0x8D, 0x08, 0x88, 0x00, 0x80, 0x01, 0x87, 0x02, 0x81, 0x01, 0x81, 0x02,
+    0x83, 0x00, 0x83, 0x02, 0x89, 0x01, 0x81, 0x04, 0x86, 0x01, 0x80, 0x02, 0x85, 0x01, 0x89, 0x1C,
+    0x91, 0x01, 0x81, 0x1C, 0x83, 0x01, 0x87, 0x04, 0x83, 0x01, 0x83, 0x04, 0x88, 0x01, 0x81, 0x04,
+    0x1C, 0x00, 0x0A, 0x33, 0x59, 0x1A, 0x17, 0x12, 0x17, 0x0E, 0x0F, 0x23, 0x10, 0x0F, 0x0E, 0x13,
+    0x13, 0x55, 0x1D, 0x0E, 0x0F, 0x55, 0x65, 0x17, 0x38, 0x43, 0x79, 0x43, 0x29, 0x36, 0x85, 0x11,
+    0x81, 0x15, 0x2F, 0x11, 0x5A, 0x2C, 0x72, 0x25, 0x63, 0x15, 0x63, 0x11, 0x63, 0x63, 0x33, 0x25,
+    0x3D, 0x31, 0x19, 0x2E, 0x3D, 0x3D, 0x2B, 0x2B, 0x3C, 0x75, 0x4A, 0x66, 0x62, 0x3C, 0x54, 0x2A,
+    0x2B, 0x5F, 0x2E, 0x29, 0x2E, 0x2A, 0x2B, 0x3D, 0x31, 0x7F, 0x3F, 0x57, 0x2E, 0x3D, 0x2B, 0x2B,
+    0x3D, 0x57, 0x2B, 0x82, 0x3F, 0x14, 0x58, 0x5F, 0x5F, 0x31, 0x48, 0x2A, 0x5F, 0x80, 0x05, 0x60,
+    0x66, 0x66, 0x4D, 0x6B, 0x5D, 0x68, 0x4D, 0x47, 0x0D, 0x02, 0x00, 0x8C, 0x08, 0x83, 0x00, 0x81,
+    0x02, 0x84, 0x00, 0x8A, 0x02, 0x85, 0x00, 0x82, 0x02, 0x88, 0x01, 0x82, 0x04, 0x82, 0x01, 0x80,
+    0x02, 0x83, 0x01, 0x85, 0x01, 0x89, 0x1C, 0x97, 0x01, 0x87, 0x04, 0x83, 0x01, 0x82, 0x04, 0x80,
+    0x01, 0x83, 0x04, 0x84, 0x01, 0x1F, 0x81, 0x7F, 0x00, 0x33, 0x2C, 0x72, 0x17, 0x12, 0x12, 0x17,
+    0x13, 0x23, 0x23, 0x10, 0x0F, 0x0E, 0x0F, 0x13, 0x55, 0x1D, 0x1D, 0x0F, 0x55, 0x0F, 0x6C, 0x38,
+    0x79, 0x30, 0x30, 0x44, 0x29, 0x35, 0x84, 0x11, 0x82, 0x15, 0x05, 0x36, 0x33, 0x72, 0x25, 0x63,
+    0x15, 0x81, 0x11, 0x82, 0x63, 0x04, 0x34, 0x2B, 0x2E, 0x57, 0x2C, 0x82, 0x3D, 0x05, 0x2B, 0x48,
+    0x66, 0x7D, 0x40, 0x70, 0x82, 0x54, 0x2A, 0x48, 0x42, 0x2E, 0x44, 0x59, 0x2B, 0x2B, 0x29, 0x2B,
+    0x3F, 0x3F, 0x48, 0x3D, 0x29, 0x2B, 0x2B, 0x29, 0x2B, 0x2E, 0x2A, 0x3F, 0x3F, 0x5C, 0x5F, 0x5F,
+    0x42, 0x48, 0x48, 0x2A, 0x3F, 0x50, 0x3B, 0x47, 0x66, 0x4D, 0x5D, 0x47, 0x60, 0x60, 0x4D, 0x4D,
+    0x47, 0x50, 0x8D, 0x08, 0x89, 0x00, 0x85, 0x02, 0x82, 0x01, 0x81, 0x02, 0x86, 0x00, 0x82, 0x02,
+    0x87, 0x01, 0x81, 0x04, 0x80, 0x01, 0x85, 0x04, 0x81, 0x02, 0x85, 0x01, 0x89, 0x1C, 0x97, 0x01,
+    0x85, 0x04, 0x85, 0x01, 0x82, 0x04, 0x80, 0x01, 0x84, 0x04, 0x82, 0x01, 0x20, 0x00, 0x22, 0x5C,
+    0x25, 0x42, 0x1F, 0x6C, 0x17, 0x12, 0x1D, 0x1D, 0x13, 0x10, 0x23, 0x10, 0x13, 0x0F, 0x0F, 0x13,
+    0x10, 0x1D, 0x1D, 0x0F, 0x55, 0x74, 0x46, 0x38, 0x79, 0x30, 0x30, 0x43, 0x29, 0x36, 0x83, 0x11,
+    0x81, 0x15, 0x82, 0x11, 0x15, 0x3D, 0x34, 0x63, 0x15, 0x15, 0x11, 0x11, 0x67, 0x63, 0x63, 0x67,
+    0x2C, 0x2E, 0x25, 0x34, 0x34, 0x3D, 0x29, 0x3D, 0x2E, 0x2A, 0x75, 0x81, 0x3A, 0x82, 0x54, 0x28,
+    0x19, 0x2A, 0x34, 0x29, 0x44, 0x3D, 0x34, 0x32, 0x33, 0x3F, 0x3F, 0x48, 0x33, 0x56, 0x2E, 0x2B,
+    0x45, 0x3D, 0x2E, 0x2B, 0x1F, 0x49, 0x3F, 0x14, 0x48, 0x5F, 0x57, 0x48, 0x2B, 0x3F, 0x50, 0x7F,
+    0x5D, 0x47, 0x4D, 0x5D, 0x02, 0x4C, 0x68, 0x68, 0x5D, 0x81, 0x4D, 0x90, 0x08, 0x86, 0x00, 0x84,
+    0x02, 0x83, 0x01, 0x81, 0x02, 0x82, 0x00, 0x81, 0x08, 0x82, 0x00, 0x81, 0x02, 0x82, 0x01, 0x80,
+    0x02, 0x83, 0x01, 0x80, 0x04, 0x81, 0x01, 0x85, 0x04, 0x81, 0x1C, 0x85, 0x01, 0x81, 0x04, 0x85,
+    0x1C, 0x96, 0x01, 0x86, 0x04, 0x81, 0x01, 0x81, 0x04, 0x83, 0x01, 0x83, 0x04, 0x22, 0x00, 0x05,
+    0x76, 0x01, 0x01, 0x04, 0x7E, 0x02, 0x01, 0x20, 0x33, 0x42, 0x1F, 0x2D, 0x17, 0x1D, 0x1D, 0x17,
+    0x0E, 0x55, 0x23, 0x10, 0x10, 0x0F, 0x0F, 0x13, 0x23, 0x10, 0x12, 0x12, 0x13, 0x18, 0x17, 0x46,
+    0x79, 0x83, 0x30, 0x01, 0x45, 0x0C, 0x88, 0x11, 0x48, 0x59, 0x33, 0x72, 0x63, 0x15, 0x11, 0x11,
+    0x67, 0x67, 0x63, 0x67, 0x67, 0x33, 0x72, 0x25, 0x2B, 0x34, 0x3D, 0x29, 0x29, 0x3D, 0x62, 0x66,
+    0x75, 0x4F, 0x54, 0x3C, 0x49, 0x3C, 0x72, 0x3D, 0x44, 0x44, 0x59, 0x59, 0x2B, 0x5F, 0x3F, 0x31,
+    0x25, 0x29, 0x3D, 0x2B, 0x56, 0x29, 0x2E, 0x29, 0x2A, 0x3F, 0x14, 0x1F, 0x5F, 0x48, 0x48, 0x5F,
+    0x48, 0x48, 0x3F, 0x06, 0x7B, 0x09, 0x5D, 0x5D, 0x02, 0x0D, 0x08, 0x02, 0x08, 0x08, 0x5D, 0x47,
+    0x5D, 0x0D, 0x8C, 0x08, 0x82, 0x00, 0x80, 0x08, 0x86, 0x00, 0x84, 0x08, 0x80, 0x0D, 0x84, 0x00,
+    0x81, 0x0D, 0x81, 0x08, 0x01, 0x01, 0x02, 0x8A, 0x01, 0x80, 0x03, 0x84, 0x04, 0x80, 0x02, 0x81,
+    0x1C, 0x85, 0x01, 0x81, 0x04, 0x9B, 0x01, 0x8B, 0x04, 0x82, 0x01, 0x84, 0x04, 0x01, 0x01, 0x04,
+    0x82, 0x01, 0x24, 0x04, 0x3F, 0x0A, 0x19, 0x36, 0x1F, 0x7C, 0x33, 0x13, 0x46, 0x12, 0x0E, 0x0E,
+    0x0F, 0x10, 0x23, 0x10, 0x10, 0x13, 0x0F, 0x0F, 0x13, 0x10, 0x55, 0x12, 0x17, 0x0F, 0x51, 0x38,
+    0x43, 0x79, 0x30, 0x11, 0x30, 0x43, 0x2D, 0x35, 0x86, 0x11, 0x08, 0x35, 0x11, 0x36, 0x72, 0x63,
+    0x15, 0x15, 0x63, 0x52, 0x83, 0x67, 0x81, 0x63, 0x25, 0x70, 0x24, 0x33, 0x33, 0x5A, 0x44, 0x44,
+    0x2E, 0x3C, 0x70, 0x66, 0x4F, 0x49, 0x49, 0x4F, 0x4F, 0x33, 0x59, 0x44, 0x29, 0x3D, 0x2E, 0x48,
+    0x5F, 0x5F, 0x5A, 0x32, 0x59, 0x2B, 0x37, 0x29, 0x5A, 0x29, 0x2B, 0x19, 0x19, 0x1F, 0x5F, 0x82,
+    0x48, 0x09, 0x2A, 0x5F, 0x19, 0x80, 0x05, 0x53, 0x02, 0x68, 0x08, 0x0D, 0x82, 0x08, 0x07, 0x02,
+    0x08, 0x0D, 0x6E, 0x4C, 0x6E, 0x08, 0x02, 0x89, 0x08, 0x8F, 0x00, 0x01, 0x0D, 0x08, 0x84, 0x00,
+    0x04, 0x0D, 0x08, 0x08, 0x01, 0x02, 0x8B, 0x01, 0x85, 0x04, 0x81, 0x1C, 0x85, 0x01, 0x81, 0x04,
+    0x9B, 0x01, 0x93, 0x04, 0x30, 0x0D, 0x5E, 0x02, 0x0D, 0x01, 0x0D, 0x01, 0x19, 0x33, 0x1F, 0x7C,
+    0x5F, 0x1A, 0x46, 0x12, 0x13, 0x13, 0x0F, 0x55, 0x10, 0x23, 0x10, 0x10, 0x13, 0x0F, 0x55, 0x0E,
+    0x10, 0x10, 0x12, 0x2F, 0x17, 0x43, 0x43, 0x79, 0x30, 0x79, 0x11, 0x11, 0x30, 0x30, 0x43, 0x30,
+    0x11, 0x11, 0x15, 0x15, 0x11, 0x30, 0x82, 0x11, 0x04, 0x5A, 0x63, 0x67, 0x15, 0x63, 0x82, 0x52,
+    0x82, 0x67, 0x81, 0x63, 0x31, 0x62, 0x63, 0x36, 0x59, 0x0C, 0x44, 0x56, 0x36, 0x25, 0x2C, 0x67,
+    0x2C, 0x3C, 0x40, 0x4A, 0x70, 0x36, 0x44, 0x56, 0x59, 0x59, 0x57, 0x48, 0x5F, 0x2E, 0x32, 0x3D,
+    0x48, 0x56, 0x56, 0x59, 0x29, 0x29, 0x5F, 0x31, 0x19, 0x42, 0x48, 0x48, 0x2E, 0x48, 0x58, 0x5F,
+    0x3F, 0x80, 0x09, 0x1F, 0x02, 0x08, 0x02, 0x82, 0x08, 0x09, 0x02, 0x08, 0x20, 0x08, 0x08, 0x02,
+    0x02, 0x08, 0x08, 0x02, 0x82, 0x08, 0x83, 0x02, 0x80, 0x08, 0x8F, 0x00, 0x01, 0x0D, 0x08, 0x84,
+    0x00, 0x04, 0x08, 0x00, 0x00, 0x01, 0x02, 0x8B, 0x01, 0x85, 0x04, 0x81, 0x01, 0x85, 0x01, 0x89,
+    0x04, 0x92, 0x01, 0x8B, 0x04, 0x83, 0x01, 0x85, 0x04, 0x82, 0x01, 0x1D, 0x02, 0x01, 0x20, 0x25,
+    0x1F, 0x5E, 0x3F, 0x2E, 0x0E, 0x74, 0x12, 0x18, 0x13, 0x13, 0x55, 0x10, 0x23, 0x10, 0x10, 0x13,
+    0x0F, 0x55, 0x0E, 0x18, 0x23, 0x12, 0x2F, 0x2D, 0x46, 0x43, 0x82, 0x30, 0x82, 0x11, 0x03, 0x43,
+    0x30, 0x43, 0x2D, 0x84, 0x30, 0x81, 0x11, 0x06, 0x15, 0x11, 0x72, 0x67, 0x15, 0x63, 0x67, 0x81,
+    0x52, 0x83, 0x67, 0x0D, 0x11, 0x36, 0x59, 0x59, 0x2F, 0x37, 0x1A, 0x12, 0x12, 0x17, 0x44, 0x29,
+    0x2E, 0x62, 0x82, 0x7A, 0x20, 0x52, 0x43, 0x44, 0x56, 0x59, 0x2B, 0x2B, 0x42, 0x2B, 0x29, 0x2E,
+    0x48, 0x59, 0x12, 0x44, 0x29, 0x37, 0x2B, 0x5F, 0x5F, 0x42, 0x48, 0x48, 0x3D, 0x48, 0x3F, 0x49,
+    0x5F, 0x3F, 0x05, 0x3F, 0x1F, 0x6E, 0x82, 0x02, 0x84, 0x08, 0x80, 0x00, 0x83, 0x20, 0x82, 0x02,
+    0x85, 0x08, 0x8D, 0x00, 0x81, 0x08, 0x84, 0x00, 0x82, 0x08, 0x81, 0x00, 0x81, 0x02, 0x8B, 0x01,
+    0x85, 0x04, 0x01, 0x01, 0x1C, 0x85, 0x01, 0x91, 0x04, 0x88, 0x01, 0x8C, 0x04, 0x85, 0x01, 0x84,
+    0x04, 0x13, 0x00, 0x08, 0x1C, 0x00, 0x22, 0x33, 0x2A, 0x00, 0x3F, 0x1F, 0x51, 0x17, 0x12, 0x23,
+    0x0E, 0x0E, 0x13, 0x10, 0x23, 0x18, 0x81, 0x10, 0x82, 0x0F, 0x1C, 0x13, 0x10, 0x0F, 0x55, 0x1A,
+    0x59, 0x43, 0x43, 0x30, 0x30, 0x11, 0x11, 0x77, 0x30, 0x79, 0x51, 0x38, 0x38, 0x1A, 0x51, 0x79,
+    0x79, 0x30, 0x30, 0x11, 0x11, 0x15, 0x11, 0x25, 0x82, 0x67, 0x85, 0x52, 0x34, 0x15, 0x11, 0x43,
+    0x2F, 0x2F, 0x12, 0x65, 0x65, 0x0F, 0x12, 0x1A, 0x45, 0x33, 0x72, 0x11, 0x15, 0x6A, 0x52, 0x11,
+    0x0C, 0x56, 0x44, 0x2E, 0x2E, 0x1F, 0x48, 0x44, 0x2E, 0x2B, 0x5A, 0x37, 0x44, 0x29, 0x12, 0x29,
+    0x48, 0x5F, 0x31, 0x48, 0x48, 0x3D, 0x2B, 0x1F, 0x5C, 0x58, 0x14, 0x02, 0x3F, 0x5F, 0x0D, 0x5C,
+    0x5C, 0x02, 0x81, 0x08, 0x83, 0x02, 0x80, 0x08, 0x84, 0x20, 0x80, 0x02, 0x85, 0x08, 0x80, 0x02,
+    0x95, 0x00, 0x80, 0x08, 0x81, 0x00, 0x81, 0x02, 0x8B, 0x01, 0x85, 0x04, 0x01, 0x02, 0x1C, 0x85,
+    0x01, 0xA7, 0x04, 0x86, 0x01, 0x82, 0x04, 0x14, 0x01, 0x02, 0x08, 0x04, 0x04, 0x20, 0x34, 0x01,
+    0x1F, 0x76, 0x5A, 0x12, 0x17, 0x1D, 0x10, 0x0E, 0x0E, 0x13, 0x55, 0x23, 0x18, 0x81, 0x10, 0x82,
+    0x0F, 0x09, 0x13, 0x10, 0x55, 0x10, 0x12, 0x43, 0x36, 0x30, 0x79, 0x30, 0x81, 0x79, 0x82, 0x46,
+    0x0E, 0x1D, 0x13, 0x13, 0x0E, 0x13, 0x13, 0x6C, 0x17, 0x43, 0x30, 0x11, 0x15, 0x15, 0x11, 0x72,
+    0x81, 0x67, 0x84, 0x52, 0x24, 0x67, 0x11, 0x30, 0x43, 0x38, 0x12, 0x17, 0x37, 0x1A, 0x51, 0x35,
+    0x59, 0x59, 0x25, 0x25, 0x63, 0x52, 0x6A, 0x52, 0x11, 0x44, 0x2D, 0x44, 0x2E, 0x3D, 0x5F, 0x48,
+    0x59, 0x2E, 0x2B, 0x2E, 0x44, 0x37, 0x44, 0x37, 0x37, 0x2B, 0x83, 0x48, 0x0A, 0x2E, 0x3D, 0x42,
+    0x1F, 0x54, 0x14, 0x3F, 0x02, 0x5F, 0x14, 0x5C, 0x82, 0x02, 0x09, 0x08, 0x00, 0x0D, 0x02, 0x5C,
+    0x02, 0x08, 0x20, 0x20, 0x1F, 0x81, 0x20, 0x86, 0x08, 0x80, 0x02, 0x97, 0x00, 0x01, 0x01, 0x02,
+    0x8B, 0x01, 0x85, 0x04, 0x81, 0x02, 0x85, 0x01, 0xA7, 0x04, 0x8A, 0x01, 0x0F, 0x04, 0x02, 0x02,
+    0x01, 0x24, 0x58, 0x5E, 0x7C, 0x1F, 0x56, 0x17, 0x17, 0x13, 0x74, 0x13, 0x0E, 0x81, 0x0F, 0x82,
+    0x18, 0x1C, 0x23, 0x55, 0x0F, 0x0F, 0x13, 0x10, 0x10, 0x0F, 0x6C, 0x43, 0x35, 0x35, 0x43, 0x79,
+    0x46, 0x0E, 0x13, 0x13, 0x18, 0x13, 0x23, 0x23, 0x13, 0x23, 0x23, 0x13, 0x12, 0x1A, 0x43, 0x82,
+    0x11, 0x80, 0x15, 0x82, 0x63, 0x84, 0x52, 0x24, 0x67, 0x11, 0x30, 0x43, 0x43, 0x38, 0x30, 0x59,
+    0x11, 0x63, 0x11, 0x11, 0x72, 0x25, 0x6A, 0x4F, 0x40, 0x4A, 0x3A, 0x6A, 0x11, 0x44, 0x59, 0x2E,
+    0x2E, 0x48, 0x48, 0x5A, 0x5A, 0x2B, 0x2B, 0x59, 0x12, 0x37, 0x2F, 0x65, 0x3D, 0x83, 0x48, 0x0A,
+    0x2B, 0x3D, 0x5F, 0x1F, 0x0D, 0x5C, 0x5F, 0x02, 0x5F, 0x5F, 0x0D, 0x85, 0x02, 0x81, 0x08, 0x80,
+    0x02, 0x83, 0x20, 0x02, 0x14, 0x20, 0x02, 0x82, 0x08, 0x81, 0x02, 0x01, 0x08, 0x02, 0x82, 0x00,
+    0x80, 0x0D, 0x93, 0x00, 0x8D, 0x01, 0x85, 0x04, 0x81, 0x02, 0x85, 0x01, 0xA3, 0x04, 0x80, 0x01,
+    0x82, 0x04, 0x89, 0x01, 0x38, 0x02, 0x01, 0x05, 0x7F, 0x01, 0x2C, 0x14, 0x02, 0x3F, 0x33, 0x17,
+    0x37, 0x12, 0x1A, 0x65, 0x0E, 0x1D, 0x0E, 0x13, 0x18, 0x10, 0x18, 0x23, 0x55, 0x0F, 0x10, 0x65,
+    0x10, 0x10, 0x0E, 0x38, 0x38, 0x79, 0x43, 0x2D, 0x1A, 0x13, 0x41, 0x1D, 0x12, 0x17, 0x6C, 0x0E,
+    0x0E, 0x13, 0x13, 0x0E, 0x0E, 0x17, 0x6C, 0x38, 0x30, 0x11, 0x11, 0x52, 0x15, 0x52, 0x81, 0x15,
+    0x83, 0x52, 0x81, 0x67, 0x84, 0x11, 0x01, 0x25, 0x72, 0x83, 0x63, 0x18, 0x6A, 0x4F, 0x3A, 0x7D,
+    0x7D, 0x4A, 0x4F, 0x62, 0x25, 0x33, 0x2E, 0x5A, 0x48, 0x48, 0x3D, 0x3D, 0x2E, 0x2B, 0x3D, 0x17,
+    0x12, 0x2F, 0x55, 0x56, 0x2B, 0x82, 0x48, 0x09, 0x2B, 0x3D, 0x2A, 0x1F, 0x3F, 0x3F, 0x42, 0x1F,
+    0x5C, 0x5F, 0x81, 0x5C, 0x81, 0x02, 0x83, 0x08, 0x84, 0x02, 0x03, 0x20, 0x14, 0x14, 0x20, 0x84,
+    0x02, 0x01, 0x08, 0x02, 0x82, 0x00, 0x81, 0x0D, 0x80, 0x00, 0x87, 0x08, 0x89, 0x00, 0x8D, 0x01,
+    0x86, 0x04, 0x80, 0x02, 0x86, 0x01, 0x80, 0x1C, 0x9D, 0x04, 0x81, 0x01, 0x84, 0x04, 0x8A, 0x01,
+    0x12, 0x03, 0x00, 0x1C, 0x5E, 0x7C, 0x24, 0x24, 0x01, 0x1F, 0x29, 0x12, 0x1A, 0x29, 0x2D, 0x0F,
+    0x6C, 0x17, 0x1D, 0x13, 0x83, 0x10, 0x0C, 0x55, 0x0F, 0x0F, 0x0E, 0x0F, 0x10, 0x13, 0x38, 0x79,
+    0x79, 0x6C, 0x6C, 0x38, 0x86, 0x79, 0x06, 0x38, 0x46, 0x46, 0x1A, 0x38, 0x51, 0x38, 0x81, 0x30,
+    0x81, 0x11, 0x82, 0x15, 0x81, 0x52, 0x0B, 0x15, 0x6A, 0x6A, 0x52, 0x67, 0x67, 0x63, 0x11, 0x11,
+    0x36, 0x63, 0x67, 0x81, 0x70, 0x82, 0x63, 0x18, 0x70, 0x4F, 0x3A, 0x40, 0x7D, 0x7D, 0x4F, 0x52,
+    0x63, 0x34, 0x34, 0x3D, 0x2B, 0x57, 0x29, 0x44, 0x3D, 0x2E, 0x5A, 0x29, 0x65, 0x37, 0x55, 0x37,
+    0x2E, 0x82, 0x48, 0x13, 0x2B, 0x2E, 0x2E, 0x20, 0x5C, 0x02, 0x3F, 0x5F, 0x3F, 0x5C, 0x3F, 0x5C,
+    0x02, 0x02, 0x08, 0x0D, 0x08, 0x08, 0x02, 0x08, 0x82, 0x02, 0x81, 0x20, 0x03, 0x14, 0x19, 0x20,
+    0x00, 0x81, 0x08, 0x83, 0x0D, 0x80, 0x02, 0x83, 0x0D, 0x87, 0x00, 0x80, 0x02, 0x89, 0x00, 0x82,
+    0x02, 0x88, 0x01, 0x87, 0x04, 0x80, 0x02, 0x87, 0x01, 0x97, 0x04, 0x80, 0x01, 0x8B, 0x04, 0x8A,
+    0x01, 0x12, 0x02, 0x00, 0x22, 0x0D, 0x08, 0x20, 0x24, 0x5F, 0x34, 0x12, 0x56, 0x35, 0x2E, 0x45,
+    0x13, 0x6C, 0x12, 0x1D, 0x13, 0x83, 0x10, 0x84, 0x0F, 0x06, 0x10, 0x0E, 0x46, 0x38, 0x17, 0x38,
+    0x79, 0x83, 0x30, 0x01, 0x77, 0x11, 0x82, 0x30, 0x82, 0x43, 0x01, 0x30, 0x43, 0x82, 0x30, 0x82,
+    0x11, 0x81, 0x15, 0x13, 0x52, 0x6A, 0x52, 0x52, 0x6A, 0x52, 0x52, 0x63, 0x63, 0x11, 0x11, 0x63,
+    0x67, 0x6A, 0x6A, 0x63, 0x36, 0x25, 0x67, 0x62, 0x82, 0x4F, 0x81, 0x3A, 0x2A, 0x4F, 0x62, 0x72,
+    0x2C, 0x34, 0x2E, 0x2B, 0x2A, 0x3D, 0x44, 0x59, 0x2E, 0x2E, 0x59, 0x17, 0x1D, 0x55, 0x12, 0x59,
+    0x2B, 0x48, 0x57, 0x48, 0x2B, 0x2B, 0x14, 0x5C, 0x05, 0x7C, 0x19, 0x5F, 0x02, 0x3F, 0x0D, 0x02,
+    0x02, 0x08, 0x0D, 0x08, 0x08, 0x02, 0x02, 0x08, 0x82, 0x02, 0x81, 0x20, 0x05, 0x19, 0x20, 0x00,
+    0x02, 0x08, 0x02, 0x87, 0x0D, 0x87, 0x00, 0x80, 0x02, 0x89, 0x00, 0x81, 0x02, 0x88, 0x01, 0x88,
+    0x04, 0x80, 0x02, 0x87, 0x01, 0x95, 0x04, 0x84, 0x01, 0x8A, 0x04, 0x89, 0x01, 0x19, 0x02, 0x01,
+    0x01, 0x0D, 0x0D, 0x00, 0x20, 0x2A, 0x44, 0x37, 0x44, 0x44, 0x3D, 0x65, 0x1D, 0x17, 0x17, 0x1D,
+    0x13, 0x10, 0x10, 0x28, 0x10, 0x0F, 0x0F, 0x55, 0x82, 0x0F, 0x04, 0x6C, 0x46, 0x51, 0x43, 0x30,
+    0x81, 0x11, 0x87, 0x30, 0x84, 0x43, 0x82, 0x30, 0x82, 0x11, 0x82, 0x15, 0x83, 0x6A, 0x81, 0x52,
+    0x82, 0x63, 0x81, 0x67, 0x06, 0x15, 0x11, 0x35, 0x35, 0x30, 0x43, 0x15, 0x81, 0x7A, 0x81, 0x4F,
+    0x82, 0x70, 0x12, 0x67, 0x63, 0x24, 0x24, 0x34, 0x2B, 0x2A, 0x2E, 0x56, 0x59, 0x3D, 0x3D, 0x59,
+    0x17, 0x1D, 0x55, 0x55, 0x44, 0x2B, 0x82, 0x48, 0x0C, 0x2A, 0x2B, 0x42, 0x02, 0x01, 0x04, 0x3F,
+    0x5F, 0x3F, 0x00, 0x02, 0x5C, 0x02, 0x83, 0x08, 0x86, 0x02, 0x07, 0x20, 0x14, 0x14, 0x08, 0x00,
+    0x08, 0x02, 0x08, 0x81, 0x02, 0x96, 0x00, 0x80, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x05, 0x8A,
+    0x04, 0x87, 0x01, 0x92, 0x04, 0x84, 0x01, 0x8D, 0x04, 0x88, 0x01, 0x81, 0x04, 0x80, 0x01, 0x82,
+    0x02, 0x18, 0x01, 0x00, 0x20, 0x2F, 0x0C, 0x2B, 0x2B, 0x56, 0x1D, 0x6C, 0x6C, 0x1D, 0x1D, 0x13,
+    0x23, 0x10, 0x71, 0x10, 0x23, 0x55, 0x55, 0x0F, 0x0F, 0x13, 0x46, 0x81, 0x38, 0x88, 0x30, 0x03,
+    0x11, 0x30, 0x43, 0x30, 0x83, 0x43, 0x83, 0x30, 0x82, 0x11, 0x09, 0x15, 0x52, 0x6A, 0x6A, 0x4F,
+    0x6A, 0x6A, 0x52, 0x15, 0x11, 0x81, 0x15, 0x82, 0x11, 0x24, 0x43, 0x2D, 0x30, 0x11, 0x6A, 0x7D,
+    0x7A, 0x6A, 0x6A, 0x30, 0x63, 0x67, 0x63, 0x63, 0x24, 0x24, 0x2C, 0x2B, 0x2A, 0x33, 0x44, 0x3D,
+    0x2E, 0x3D, 0x29, 0x12, 0x0F, 0x13, 0x55, 0x56, 0x2E, 0x48, 0x48, 0x2A, 0x31, 0x2B, 0x5F, 0x82,
+    0x02, 0x08, 0x00, 0x14, 0x5F, 0x03, 0x5C, 0x5C, 0x0D, 0x5C, 0x08, 0x81, 0x0D, 0x85, 0x02, 0x05,
+    0x08, 0x00, 0x20, 0x14, 0x08, 0x00, 0x82, 0x08, 0x81, 0x02, 0x84, 0x00, 0x81, 0x0D, 0x81, 0x08,
+    0x80, 0x01, 0x82, 0x02, 0x82, 0x0D, 0x81, 0x08, 0x80, 0x00, 0x82, 0x02, 0x81, 0x01, 0x80, 0x02,
+    0x87, 0x01, 0x8B, 0x04, 0x87, 0x01, 0x9E, 0x04, 0x80, 0x01, 0x86, 0x04, 0x80, 0x01, 0x81, 0x04,
+    0x84, 0x01, 0x81, 0x04, 0x17, 0x0D, 0x04, 0x03, 0x00, 0x02, 0x02, 0x20, 0x1D, 0x2E, 0x1F, 0x3D,
+    0x17, 0x17, 0x1D, 0x6C, 0x0E, 0x1D, 0x13, 0x10, 0x10, 0x39, 0x10, 0x23, 0x55, 0x82, 0x0F, 0x01,
+    0x0E, 0x46, 0x81, 0x79, 0x83, 0x30, 0x82, 0x43, 0x03, 0x79, 0x38, 0x79, 0x51, 0x81, 0x38, 0x83,
+    0x43, 0x83, 0x30, 0x82, 0x11, 0x10, 0x15, 0x6A, 0x6A, 0x7A, 0x7A, 0x4F, 0x70, 0x6A, 0x67, 0x6A,
+    0x15, 0x15, 0x11, 0x11, 0x2F, 0x43, 0x30, 0x82, 0x38, 0x2B, 0x1A, 0x38, 0x46, 0x6C, 0x13, 0x43,
+    0x59, 0x36, 0x72, 0x24, 0x24, 0x2C, 0x2B, 0x24, 0x63, 0x44, 0x59, 0x2E, 0x3D, 0x29, 0x2F, 0x55,
+    0x13, 0x0F, 0x12, 0x3D, 0x48, 0x31, 0x2A, 0x48, 0x48, 0x31, 0x3F, 0x0D, 0x00, 0x0D, 0x00, 0x48,
+    0x20, 0x08, 0x02, 0x0D, 0x5C, 0x08, 0x82, 0x0D, 0x09, 0x02, 0x08, 0x08, 0x02, 0x02, 0x08, 0x00,
+    0x00, 0x14, 0x5C, 0x83, 0x08, 0x81, 0x02, 0x81, 0x00, 0x05, 0x08, 0x00, 0x00, 0x08, 0x08, 0x0D,
+    0x84, 0x01, 0x83, 0x00, 0x86, 0x02, 0x88, 0x01, 0x82, 0x04, 0x80, 0x01, 0x87, 0x04, 0x87, 0x01,
+    0xAA, 0x04, 0x82, 0x01, 0x81, 0x04, 0x18, 0x01, 0x03, 0x08, 0x03, 0x00, 0x0D, 0x01, 0x24, 0x1A,
+    0x2A, 0x3D, 0x2F, 0x2D, 0x1D, 0x17, 0x17, 0x0E, 0x0E, 0x13, 0x23, 0x10, 0x39, 0x10, 0x23, 0x55,
+    0x82, 0x0F, 0x07, 0x12, 0x38, 0x43, 0x43, 0x30, 0x30, 0x79, 0x38, 0x82, 0x46, 0x08, 0x6C, 0x13,
+    0x46, 0x46, 0x38, 0x6C, 0x6C, 0x38, 0x79, 0x82, 0x43, 0x82, 0x30, 0x06, 0x11, 0x15, 0x15, 0x70,
+    0x3A, 0x7D, 0x7A, 0x81, 0x4F, 0x82, 0x6A, 0x33, 0x15, 0x11, 0x11, 0x30, 0x30, 0x38, 0x41, 0x10,
+    0x23, 0x71, 0x28, 0x41, 0x39, 0x71, 0x13, 0x0F, 0x65, 0x2F, 0x25, 0x62, 0x3C, 0x24, 0x2B, 0x24,
+    0x62, 0x29, 0x44, 0x2E, 0x2E, 0x5A, 0x2F, 0x12, 0x13, 0x55, 0x65, 0x59, 0x48, 0x2A, 0x57, 0x48,
+    0x2A, 0x2A, 0x1F, 0x0D, 0x08, 0x0D, 0x04, 0x42, 0x57, 0x03, 0x02, 0x0D, 0x81, 0x08, 0x82, 0x0D,
+    0x80, 0x02, 0x82, 0x08, 0x81, 0x02, 0x81, 0x08, 0x81, 0x20, 0x83, 0x08, 0x81, 0x02, 0x81, 0x00,
+    0x80, 0x08, 0x81, 0x00, 0x81, 0x08, 0x81, 0x0D, 0x83, 0x01, 0x81, 0x00, 0x83, 0x02, 0x81, 0x01,
+    0x80, 0x02, 0x89, 0x01, 0x83, 0x04, 0x80, 0x01, 0x87, 0x04, 0x83, 0x01, 0xAB, 0x04, 0x82, 0x01,
+    0x21, 0x04, 0x01, 0x01, 0x04, 0x04, 0x02, 0x22, 0x00, 0x00, 0x01, 0x05, 0x08, 0x24, 0x2D, 0x2B,
+    0x37, 0x2C, 0x29, 0x17, 0x51, 0x17, 0x0F, 0x0E, 0x65, 0x23, 0x10, 0x39, 0x10, 0x23, 0x0F, 0x0F,
+    0x55, 0x0E, 0x6C, 0x81, 0x38, 0x82, 0x43, 0x0B, 0x38, 0x46, 0x13, 0x23, 0x13, 0x23, 0x18, 0x46,
+    0x38, 0x21, 0x79, 0x38, 0x81, 0x51, 0x82, 0x43, 0x82, 0x30, 0x30, 0x11, 0x15, 0x6A, 0x3A, 0x4A,
+    0x3E, 0x6F, 0x3A, 0x4F, 0x70, 0x6A, 0x6A, 0x15, 0x15, 0x11, 0x11, 0x38, 0x0F, 0x28, 0x07, 0x28,
+    0x41, 0x21, 0x28, 0x07, 0x41, 0x41, 0x07, 0x10, 0x37, 0x32, 0x72, 0x24, 0x24, 0x57, 0x24, 0x54,
+    0x25, 0x44, 0x3D, 0x2E, 0x2E, 0x45, 0x12, 0x13, 0x10, 0x55, 0x2D, 0x33, 0x82, 0x48, 0x0E, 0x5F,
+    0x2A, 0x1F, 0x0D, 0x08, 0x0D, 0x02, 0x02, 0x48, 0x08, 0x02, 0x5C, 0x08, 0x08, 0x0D, 0x86, 0x08,
+    0x81, 0x02, 0x09, 0x08, 0x20, 0x20, 0x08, 0x02, 0x08, 0x08, 0x02, 0x02, 0x00, 0x81, 0x08, 0x81,
+    0x00, 0x81, 0x08, 0x81, 0x0D, 0x83, 0x01, 0x80, 0x02, 0x8D, 0x01, 0x80, 0x05, 0x81, 0x01, 0x8D,
+    0x04, 0x82, 0x01, 0x9B, 0x04, 0x82, 0x01, 0x8D, 0x04, 0x83, 0x01, 0x83, 0x04, 0x1B, 0x76, 0x01,
+    0x00, 0x01, 0x01, 0x02, 0x01, 0x42, 0x2F, 0x2D, 0x2C, 0x5F, 0x2D, 0x1A, 0x46, 0x65, 0x0F, 0x0E,
+    0x65, 0x55, 0x10, 0x28, 0x10, 0x23, 0x0F, 0x55, 0x55, 0x1D, 0x83, 0x38, 0x11, 0x79, 0x51, 0x6C,
+    0x1D, 0x18, 0x28, 0x28, 0x71, 0x27, 0x07, 0x07, 0x39, 0x39, 0x46, 0x46, 0x79, 0x38, 0x43, 0x83,
+    0x30, 0x40, 0x11, 0x15, 0x4F, 0x7D, 0x3E, 0x6F, 0x6F, 0x3E, 0x3A, 0x4F, 0x4F, 0x6A, 0x6A, 0x52,
+    0x15, 0x30, 0x17, 0x21, 0x46, 0x21, 0x26, 0x21, 0x77, 0x21, 0x21, 0x41, 0x21, 0x28, 0x10, 0x12,
+    0x51, 0x59, 0x62, 0x62, 0x24, 0x24, 0x47, 0x62, 0x3D, 0x59, 0x29, 0x2B, 0x59, 0x65, 0x0F, 0x13,
+    0x10, 0x12, 0x3D, 0x2B, 0x48, 0x48, 0x5F, 0x31, 0x58, 0x5C, 0x01, 0x0D, 0x0D, 0x81, 0x31, 0x19,
+    0x01, 0x5C, 0x0D, 0x88, 0x08, 0x17, 0x0D, 0x5C, 0x5C, 0x02, 0x20, 0x6E, 0x02, 0x01, 0x08, 0x02,
+    0x02, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x0D, 0x00, 0x00, 0x02, 0x02, 0x01, 0x82, 0x02,
+    0x83, 0x01, 0x80, 0x04, 0x86, 0x01, 0x01, 0x05, 0x01, 0x8C, 0x04, 0x81, 0x02, 0x83, 0x01, 0x9B,
+    0x04, 0x80, 0x01, 0x83, 0x04, 0x80, 0x01, 0x83, 0x04, 0x06, 0x01, 0x03, 0x01, 0x01, 0x04, 0x04,
+    0x01, 0x86, 0x04, 0x11, 0x0D, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0x31, 0x37, 0x2B, 0x5F, 0x2B,
+    0x51, 0x37, 0x38, 0x65, 0x74, 0x13, 0x82, 0x23, 0x81, 0x10, 0x18, 0x39, 0x13, 0x13, 0x0F, 0x17,
+    0x38, 0x38, 0x43, 0x43, 0x38, 0x46, 0x0F, 0x23, 0x28, 0x07, 0x71, 0x71, 0x07, 0x39, 0x26, 0x26,
+    0x71, 0x39, 0x28, 0x46, 0x82, 0x79, 0x82, 0x30, 0x04, 0x11, 0x15, 0x4F, 0x40, 0x3E, 0x82, 0x6F,
+    0x39, 0x4A, 0x4F, 0x4F, 0x7A, 0x6A, 0x6A, 0x11, 0x2D, 0x78, 0x78, 0x77, 0x7A, 0x77, 0x28, 0x27,
+    0x78, 0x78, 0x26, 0x78, 0x79, 0x74, 0x55, 0x1D, 0x2D, 0x63, 0x62, 0x62, 0x49, 0x4D, 0x70, 0x25,
+    0x59, 0x56, 0x59, 0x2E, 0x2F, 0x13, 0x10, 0x10, 0x13, 0x44, 0x2B, 0x48, 0x2B, 0x5F, 0x19, 0x14,
+    0x02, 0x00, 0x08, 0x0D, 0x01, 0x1F, 0x57, 0x08, 0x08, 0x02, 0x0D, 0x8A, 0x08, 0x81, 0x02, 0x81,
+    0x08, 0x82, 0x02, 0x80, 0x00, 0x87, 0x08, 0x82, 0x00, 0x84, 0x02, 0x84, 0x01, 0x81, 0x04, 0x82,
+    0x01, 0x91, 0x04, 0x80, 0x02, 0x84, 0x01, 0x9A, 0x04, 0x80, 0x01, 0x88, 0x04, 0x03, 0x03, 0x05,
+    0x05, 0x01, 0x89, 0x04, 0x11, 0x02, 0x01, 0x01, 0x03, 0x0D, 0x05, 0x08, 0x19, 0x0C, 0x19, 0x5F,
+    0x34, 0x6C, 0x1A, 0x1D, 0x13, 0x0F, 0x13, 0x84, 0x10, 0x10, 0x39, 0x23, 0x0E, 0x74, 0x1A, 0x38,
+    0x38, 0x43, 0x43, 0x46, 0x6C, 0x23, 0x39, 0x07, 0x39, 0x41, 0x28, 0x82, 0x26, 0x07, 0x21, 0x26,
+    0x26, 0x41, 0x41, 0x46, 0x79, 0x77, 0x82, 0x30, 0x04, 0x11, 0x67, 0x4F, 0x40, 0x3E, 0x82, 0x6F,
+    0x07, 0x3E, 0x4A, 0x3A, 0x7D, 0x40, 0x70, 0x63, 0x11, 0x82, 0x78, 0x2D, 0x7A, 0x6F, 0x6F, 0x7A,
+    0x6F, 0x78, 0x78, 0x7A, 0x11, 0x2F, 0x6C, 0x12, 0x29, 0x62, 0x4F, 0x70, 0x24, 0x47, 0x66, 0x25,
+    0x29, 0x2F, 0x44, 0x44, 0x29, 0x12, 0x10, 0x23, 0x13, 0x56, 0x2E, 0x48, 0x2B, 0x48, 0x42, 0x1F,
+    0x3F, 0x0D, 0x08, 0x0D, 0x08, 0x20, 0x57, 0x00, 0x08, 0x0D, 0x8B, 0x08, 0x81, 0x02, 0x82, 0x08,
+    0x81, 0x02, 0x89, 0x08, 0x81, 0x00, 0x81, 0x01, 0x82, 0x02, 0x84, 0x01, 0x81, 0x04, 0x82, 0x01,
+    0x91, 0x04, 0x80, 0x02, 0x86, 0x01, 0x98, 0x04, 0x80, 0x01, 0x88, 0x04, 0x03, 0x03, 0x05, 0x05,
+    0x01, 0x8A, 0x04, 0x81, 0x01, 0x82, 0x03, 0x0B, 0x02, 0x20, 0x0C, 0x49, 0x5F, 0x2E, 0x6C, 0x51,
+    0x1D, 0x13, 0x0F, 0x23, 0x83, 0x10, 0x81, 0x39, 0x22, 0x10, 0x1D, 0x12, 0x38, 0x38, 0x43, 0x43,
+    0x38, 0x46, 0x23, 0x28, 0x07, 0x71, 0x41, 0x21, 0x26, 0x77, 0x21, 0x39, 0x07, 0x26, 0x21, 0x21,
+    0x77, 0x46, 0x38, 0x30, 0x77, 0x30, 0x30, 0x11, 0x67, 0x70, 0x3A, 0x3E, 0x82, 0x6F, 0x82, 0x3E,
+    0x81, 0x4A, 0x31, 0x7D, 0x7A, 0x70, 0x6A, 0x6A, 0x78, 0x78, 0x7A, 0x6F, 0x6F, 0x7A, 0x78, 0x7D,
+    0x3A, 0x15, 0x59, 0x59, 0x63, 0x62, 0x4F, 0x40, 0x70, 0x3C, 0x70, 0x70, 0x67, 0x29, 0x38, 0x37,
+    0x2F, 0x12, 0x37, 0x74, 0x10, 0x10, 0x12, 0x3D, 0x2A, 0x2B, 0x57, 0x19, 0x3F, 0x3F, 0x0D, 0x08,
+    0x0D, 0x01, 0x20, 0x2A, 0x20, 0x81, 0x02, 0x9C, 0x08, 0x81, 0x0D, 0x81, 0x01, 0x81, 0x02, 0x85,
+    0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x04, 0x80, 0x01, 0x8E, 0x04, 0x80, 0x02, 0x8F, 0x01, 0x8F,
+    0x04, 0x80, 0x01, 0x82, 0x04, 0x81, 0x01, 0x83, 0x04, 0x82, 0x05, 0x80, 0x01, 0x86, 0x04, 0x82,
+    0x01, 0x80, 0x04, 0x84, 0x01, 0x0C, 0x58, 0x00, 0x59, 0x2C, 0x58, 0x2E, 0x6C, 0x51, 0x1A, 0x13,
+    0x0F, 0x23, 0x10, 0x84, 0x39, 0x26, 0x10, 0x1D, 0x17, 0x51, 0x43, 0x79, 0x38, 0x38, 0x6C, 0x10,
+    0x07, 0x07, 0x41, 0x21, 0x77, 0x41, 0x78, 0x78, 0x77, 0x78, 0x78, 0x77, 0x21, 0x77, 0x79, 0x43,
+    0x11, 0x77, 0x30, 0x11, 0x11, 0x52, 0x70, 0x3A, 0x4A, 0x3E, 0x6F, 0x6F, 0x3E, 0x82, 0x6F, 0x81,
+    0x3E, 0x80, 0x40, 0x81, 0x4F, 0x81, 0x70, 0x82, 0x4F, 0x20, 0x7A, 0x6A, 0x7A, 0x7A, 0x4F, 0x52,
+    0x63, 0x62, 0x4F, 0x40, 0x3A, 0x40, 0x70, 0x54, 0x3C, 0x62, 0x4F, 0x11, 0x37, 0x17, 0x2F, 0x1D,
+    0x10, 0x13, 0x12, 0x23, 0x55, 0x3D, 0x48, 0x2B, 0x2B, 0x42, 0x3F, 0x82, 0x02, 0x06, 0x5C, 0x00,
+    0x20, 0x19, 0x08, 0x08, 0x02, 0x9C, 0x08, 0x82, 0x0D, 0x80, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81,
+    0x04, 0x82, 0x01, 0x92, 0x04, 0x8F, 0x01, 0x8B, 0x04, 0x85, 0x01, 0x81, 0x04, 0x82, 0x01, 0x82,
+    0x04, 0x83, 0x01, 0x81, 0x04, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x0B, 0x03, 0x01, 0x00, 0x58,
+    0x01, 0x2C, 0x36, 0x02, 0x32, 0x17, 0x1A, 0x17, 0x82, 0x23, 0x85, 0x39, 0x03, 0x10, 0x1D, 0x46,
+    0x51, 0x82, 0x43, 0x1D, 0x38, 0x1D, 0x10, 0x39, 0x39, 0x41, 0x21, 0x77, 0x77, 0x21, 0x78, 0x7A,
+    0x7A, 0x78, 0x21, 0x30, 0x77, 0x11, 0x15, 0x11, 0x30, 0x11, 0x11, 0x15, 0x52, 0x70, 0x40, 0x4A,
+    0x3E, 0x6F, 0x81, 0x3E, 0x84, 0x6F, 0x04, 0x3E, 0x7D, 0x3A, 0x7A, 0x4F, 0x83, 0x70, 0x1F, 0x4F,
+    0x70, 0x7A, 0x70, 0x4F, 0x70, 0x3A, 0x7D, 0x3E, 0x7D, 0x66, 0x70, 0x70, 0x54, 0x4F, 0x66, 0x67,
+    0x2F, 0x12, 0x6C, 0x12, 0x23, 0x07, 0x10, 0x17, 0x12, 0x44, 0x48, 0x2B, 0x2B, 0x31, 0x3F, 0x83,
+    0x0D, 0x02, 0x02, 0x20, 0x58, 0x83, 0x08, 0x87, 0x0D, 0x93, 0x08, 0x83, 0x0D, 0x81, 0x02, 0x85,
+    0x01, 0x81, 0x04, 0x82, 0x01, 0x92, 0x04, 0x8F, 0x01, 0x8A, 0x04, 0x86, 0x01, 0x80, 0x04, 0x84,
+    0x01, 0x81, 0x04, 0x83, 0x01, 0x81, 0x04, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x0F, 0x03, 0x01,
+    0x02, 0x02, 0x01, 0x76, 0x36, 0x31, 0x2D, 0x17, 0x1A, 0x13, 0x55, 0x23, 0x10, 0x39, 0x81, 0x07,
+    0x82, 0x39, 0x22, 0x10, 0x1D, 0x38, 0x51, 0x43, 0x43, 0x79, 0x43, 0x46, 0x13, 0x23, 0x23, 0x1D,
+    0x46, 0x79, 0x21, 0x21, 0x46, 0x79, 0x11, 0x30, 0x11, 0x30, 0x11, 0x15, 0x15, 0x11, 0x15, 0x15,
+    0x67, 0x52, 0x52, 0x4F, 0x40, 0x4A, 0x84, 0x3E, 0x85, 0x6F, 0x81, 0x3E, 0x10, 0x7D, 0x3A, 0x3A,
+    0x4F, 0x4F, 0x3A, 0x4F, 0x3A, 0x66, 0x40, 0x4A, 0x3E, 0x6F, 0x3E, 0x3E, 0x3A, 0x70, 0x82, 0x66,
+    0x1B, 0x75, 0x67, 0x2F, 0x1A, 0x1A, 0x74, 0x28, 0x13, 0x18, 0x10, 0x37, 0x44, 0x57, 0x57, 0x2B,
+    0x19, 0x3F, 0x03, 0x0D, 0x0D, 0x08, 0x02, 0x20, 0x5C, 0x08, 0x0D, 0x0D, 0x08, 0x87, 0x0D, 0x93,
+    0x08, 0x82, 0x0D, 0x80, 0x00, 0x81, 0x02, 0x85, 0x01, 0x81, 0x04, 0x82, 0x01, 0x92, 0x04, 0x8F,
+    0x01, 0x87, 0x04, 0x85, 0x01, 0x81, 0x05, 0x81, 0x01, 0x80, 0x04, 0x84, 0x01, 0x81, 0x04, 0x83,
+    0x01, 0x81, 0x04, 0x82, 0x01, 0x80, 0x05, 0x83, 0x03, 0x12, 0x01, 0x03, 0x01, 0x03, 0x00, 0x20,
+    0x0D, 0x02, 0x01, 0x31, 0x25, 0x44, 0x17, 0x1A, 0x0E, 0x55, 0x23, 0x10, 0x39, 0x82, 0x07, 0x81,
+    0x39, 0x22, 0x10, 0x1D, 0x38, 0x38, 0x43, 0x43, 0x30, 0x30, 0x38, 0x38, 0x46, 0x6C, 0x17, 0x12,
+    0x17, 0x38, 0x38, 0x43, 0x30, 0x35, 0x11, 0x11, 0x15, 0x78, 0x78, 0x11, 0x15, 0x6A, 0x6A, 0x67,
+    0x52, 0x6A, 0x3A, 0x40, 0x4A, 0x84, 0x3E, 0x86, 0x6F, 0x82, 0x3E, 0x01, 0x7D, 0x4A, 0x83, 0x7D,
+    0x80, 0x4A, 0x81, 0x3E, 0x82, 0x6F, 0x81, 0x3E, 0x07, 0x4F, 0x66, 0x75, 0x66, 0x3A, 0x67, 0x2D,
+    0x51, 0x81, 0x12, 0x83, 0x10, 0x06, 0x23, 0x37, 0x2C, 0x2A, 0x2B, 0x31, 0x5C, 0x83, 0x0D, 0x02,
+    0x5C, 0x20, 0x02, 0x82, 0x0D, 0x80, 0x08, 0x8F, 0x0D, 0x8B, 0x08, 0x81, 0x0D, 0x81, 0x00, 0x81,
+    0x02, 0x85, 0x01, 0x81, 0x04, 0x82, 0x01, 0x92, 0x04, 0x8F, 0x01, 0x87, 0x04, 0x88, 0x01, 0x82,
+    0x04, 0x89, 0x01, 0x81, 0x04, 0x82, 0x01, 0x80, 0x05, 0x83, 0x03, 0x0E, 0x01, 0x03, 0x02, 0x03,
+    0x02, 0x20, 0x01, 0x02, 0x20, 0x05, 0x2B, 0x6C, 0x37, 0x17, 0x0E, 0x82, 0x10, 0x83, 0x07, 0x81,
+    0x39, 0x02, 0x18, 0x1D, 0x38, 0x81, 0x43, 0x82, 0x30, 0x83, 0x79, 0x82, 0x38, 0x80, 0x43, 0x81,
+    0x30, 0x81, 0x11, 0x82, 0x15, 0x81, 0x78, 0x80, 0x6A, 0x81, 0x4F, 0x82, 0x52, 0x03, 0x70, 0x3A,
+    0x40, 0x4A, 0x82, 0x3E, 0x80, 0x4A, 0x82, 0x3E, 0x84, 0x6F, 0x87, 0x3E, 0x88, 0x6F, 0x1B, 0x75,
+    0x66, 0x40, 0x66, 0x3A, 0x52, 0x2D, 0x12, 0x1A, 0x12, 0x43, 0x67, 0x63, 0x13, 0x55, 0x1D, 0x2B,
+    0x48, 0x2B, 0x31, 0x5C, 0x0D, 0x53, 0x0D, 0x0D, 0x02, 0x02, 0x08, 0x82, 0x0D, 0x80, 0x08, 0x8F,
+    0x0D, 0x8B, 0x08, 0x81, 0x0D, 0x81, 0x00, 0x81, 0x02, 0x85, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81,
+    0x04, 0x80, 0x01, 0x8F, 0x04, 0x8F, 0x01, 0x83, 0x04, 0x82, 0x01, 0x80, 0x05, 0x8A, 0x04, 0x86,
+    0x01, 0x83, 0x04, 0x84, 0x01, 0x86, 0x05, 0x0F, 0x03, 0x08, 0x3F, 0x0D, 0x00, 0x01, 0x02, 0x76,
+    0x2C, 0x37, 0x1A, 0x1A, 0x13, 0x18, 0x10, 0x39, 0x82, 0x07, 0x82, 0x39, 0x02, 0x10, 0x13, 0x38,
+    0x81, 0x43, 0x89, 0x30, 0x01, 0x35, 0x11, 0x82, 0x15, 0x81, 0x6A, 0x0F, 0x52, 0x6A, 0x4F, 0x7A,
+    0x7A, 0x4F, 0x52, 0x67, 0x52, 0x6A, 0x4F, 0x40, 0x40, 0x3E, 0x6F, 0x3E, 0x81, 0x4A, 0x82, 0x3E,
+    0x85, 0x6F, 0x85, 0x3E, 0x88, 0x6F, 0x19, 0x4A, 0x66, 0x40, 0x3A, 0x66, 0x52, 0x59, 0x51, 0x74,
+    0x59, 0x4F, 0x66, 0x4D, 0x2C, 0x65, 0x12, 0x2E, 0x2A, 0x48, 0x48, 0x5C, 0x05, 0x53, 0x50, 0x0D,
+    0x5C, 0x81, 0x6E, 0x93, 0x0D, 0x89, 0x08, 0x81, 0x00, 0x04, 0x08, 0x0D, 0x0D, 0x00, 0x01, 0x81,
+    0x02, 0x84, 0x01, 0x92, 0x04, 0x81, 0x01, 0x80, 0x04, 0x81, 0x01, 0x8F, 0x01, 0x83, 0x04, 0x82,
+    0x01, 0x80, 0x05, 0x8A, 0x04, 0x87, 0x01, 0x81, 0x04, 0x85, 0x01, 0x86, 0x05, 0x0F, 0x03, 0x08,
+    0x3F, 0x0D, 0x00, 0x02, 0x02, 0x80, 0x34, 0x1A, 0x1A, 0x12, 0x65, 0x10, 0x10, 0x39, 0x82, 0x07,
+    0x82, 0x39, 0x03, 0x10, 0x13, 0x38, 0x43, 0x85, 0x30, 0x80, 0x11, 0x81, 0x30, 0x82, 0x11, 0x81,
+    0x67, 0x10, 0x6A, 0x7A, 0x3A, 0x4F, 0x6A, 0x7A, 0x3A, 0x3A, 0x7A, 0x4F, 0x52, 0x52, 0x6A, 0x67,
+    0x62, 0x70, 0x75, 0x82, 0x40, 0x81, 0x4A, 0x82, 0x3E, 0x85, 0x6F, 0x84, 0x3E, 0x88, 0x6F, 0x81,
+    0x3E, 0x0F, 0x75, 0x40, 0x66, 0x4F, 0x67, 0x36, 0x43, 0x59, 0x70, 0x40, 0x66, 0x2C, 0x49, 0x59,
+    0x10, 0x2E, 0x82, 0x48, 0x07, 0x5C, 0x53, 0x53, 0x50, 0x0D, 0x5C, 0x4C, 0x6E, 0x9B, 0x0D, 0x81,
+    0x08, 0x80, 0x00, 0x82, 0x08, 0x07, 0x0D, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x81, 0x01,
+    0x95, 0x04, 0x81, 0x01, 0x8F, 0x01, 0x83, 0x04, 0x81, 0x01, 0x81, 0x05, 0x8A, 0x04, 0x84, 0x01,
+    0x80, 0x04, 0x89, 0x01, 0x86, 0x05, 0x0F, 0x08, 0x02, 0x0D, 0x0D, 0x00, 0x02, 0x0D, 0x02, 0x33,
+    0x2F, 0x17, 0x12, 0x65, 0x23, 0x10, 0x39, 0x83, 0x07, 0x81, 0x39, 0x03, 0x10, 0x13, 0x38, 0x43,
+    0x84, 0x30, 0x84, 0x11, 0x05, 0x63, 0x6A, 0x70, 0x70, 0x3A, 0x40, 0x81, 0x3A, 0x82, 0x40, 0x81,
+    0x3A, 0x07, 0x6A, 0x67, 0x52, 0x52, 0x67, 0x67, 0x62, 0x70, 0x82, 0x66, 0x80, 0x40, 0x81, 0x4A,
+    0x82, 0x3E, 0x83, 0x6F, 0x86, 0x3E, 0x84, 0x6F, 0x84, 0x3E, 0x0F, 0x40, 0x66, 0x75, 0x66, 0x63,
+    0x11, 0x2D, 0x67, 0x75, 0x75, 0x24, 0x29, 0x2E, 0x25, 0x65, 0x3D, 0x82, 0x48, 0x06, 0x58, 0x53,
+    0x50, 0x50, 0x0D, 0x0D, 0x4C, 0x89, 0x0D, 0x80, 0x08, 0x91, 0x0D, 0x86, 0x08, 0x80, 0x0D, 0x84,
+    0x01, 0x81, 0x04, 0x80, 0x01, 0x95, 0x04, 0x81, 0x01, 0x87, 0x01, 0x8B, 0x04, 0x81, 0x01, 0x81,
+    0x05, 0x8B, 0x04, 0x81, 0x01, 0x83, 0x04, 0x84, 0x01, 0x80, 0x04, 0x84, 0x05, 0x82, 0x03, 0x11,
+    0x05, 0x03, 0x08, 0x3F, 0x0D, 0x0D, 0x00, 0x0D, 0x0D, 0x02, 0x5A, 0x2F, 0x17, 0x1D, 0x74, 0x23,
+    0x10, 0x39, 0x84, 0x07, 0x81, 0x39, 0x07, 0x23, 0x38, 0x43, 0x30, 0x43, 0x30, 0x30, 0x35, 0x83,
+    0x11, 0x80, 0x52, 0x82, 0x4F, 0x80, 0x3A, 0x85, 0x40, 0x81, 0x3A, 0x0D, 0x4F, 0x52, 0x15, 0x52,
+    0x67, 0x67, 0x52, 0x67, 0x62, 0x70, 0x70, 0x47, 0x66, 0x40, 0x81, 0x4A, 0x8D, 0x3E, 0x80, 0x6F,
+    0x87, 0x3E, 0x13, 0x4A, 0x75, 0x75, 0x70, 0x63, 0x36, 0x11, 0x62, 0x70, 0x70, 0x63, 0x5A, 0x29,
+    0x2E, 0x65, 0x3D, 0x57, 0x57, 0x48, 0x49, 0x82, 0x50, 0x01, 0x4C, 0x6E, 0x89, 0x0D, 0x81, 0x08,
+    0x91, 0x0D, 0x87, 0x08, 0x84, 0x01, 0x98, 0x04, 0x81, 0x01, 0x84, 0x01, 0x8E, 0x04, 0x81, 0x01,
+    0x81, 0x05, 0x87, 0x01, 0x89, 0x04, 0x84, 0x01, 0x80, 0x04, 0x87, 0x03, 0x0F, 0x04, 0x03, 0x00,
+    0x3F, 0x08, 0x02, 0x00, 0x0D, 0x0D, 0x1F, 0x29, 0x2F, 0x12, 0x0E, 0x74, 0x10, 0x83, 0x39, 0x82,
+    0x07, 0x81, 0x39, 0x05, 0x10, 0x46, 0x43, 0x30, 0x43, 0x30, 0x83, 0x11, 0x01, 0x63, 0x52, 0x82,
+    0x4F, 0x01, 0x40, 0x3A, 0x86, 0x40, 0x04, 0x3A, 0x6A, 0x15, 0x15, 0x52, 0x82, 0x67, 0x82, 0x62,
+    0x82, 0x70, 0x01, 0x4D, 0x40, 0x81, 0x4A, 0x89, 0x3E, 0x81, 0x7D, 0x87, 0x3E, 0x82, 0x4A, 0x17,
+    0x75, 0x66, 0x70, 0x63, 0x11, 0x36, 0x62, 0x63, 0x62, 0x62, 0x25, 0x3D, 0x72, 0x1A, 0x3D, 0x2A,
+    0x48, 0x2A, 0x19, 0x50, 0x50, 0x02, 0x5D, 0x4C, 0x89, 0x0D, 0x81, 0x08, 0x80, 0x0D, 0x87, 0x08,
+    0x88, 0x0D, 0x83, 0x08, 0x81, 0x00, 0x81, 0x08, 0x81, 0x01, 0x80, 0x02, 0x81, 0x01, 0x94, 0x04,
+    0x82, 0x01, 0x81, 0x04, 0x80, 0x01, 0x82, 0x01, 0x90, 0x04, 0x82, 0x01, 0x80, 0x05, 0x87, 0x01,
+    0x8A, 0x04, 0x84, 0x01, 0x87, 0x03, 0x14, 0x04, 0x03, 0x08, 0x02, 0x03, 0x01, 0x00, 0x0D, 0x00,
+    0x19, 0x45, 0x2F, 0x6C, 0x1D, 0x74, 0x10, 0x39, 0x10, 0x23, 0x13, 0x23, 0x82, 0x39, 0x81, 0x10,
+    0x0C, 0x6C, 0x43, 0x30, 0x30, 0x35, 0x11, 0x11, 0x15, 0x11, 0x67, 0x70, 0x70, 0x4F, 0x82, 0x3A,
+    0x86, 0x40, 0x80, 0x4F, 0x82, 0x15, 0x81, 0x67, 0x01, 0x35, 0x11, 0x83, 0x62, 0x04, 0x59, 0x29,
+    0x54, 0x66, 0x75, 0x84, 0x4A, 0x8C, 0x3E, 0x83, 0x4A, 0x82, 0x40, 0x11, 0x66, 0x4F, 0x63, 0x25,
+    0x36, 0x24, 0x33, 0x67, 0x70, 0x67, 0x2E, 0x24, 0x44, 0x3D, 0x31, 0x48, 0x2A, 0x31, 0x82, 0x50,
+    0x80, 0x4C, 0x82, 0x0D, 0x80, 0x08, 0x85, 0x0D, 0x8C, 0x08, 0x88, 0x0D, 0x81, 0x08, 0x83, 0x00,
+    0x01, 0x08, 0x01, 0x81, 0x02, 0x81, 0x01, 0x91, 0x04, 0x01, 0x01, 0x04, 0x84, 0x01, 0x81, 0x04,
+    0x80, 0x01, 0x92, 0x04, 0x8B, 0x01, 0x8D, 0x04, 0x81, 0x01, 0x87, 0x03, 0x16, 0x04, 0x03, 0x02,
+    0x02, 0x03, 0x05, 0x03, 0x0D, 0x02, 0x31, 0x2F, 0x1A, 0x6C, 0x1D, 0x0F, 0x10, 0x10, 0x13, 0x6C,
+    0x46, 0x6C, 0x13, 0x23, 0x82, 0x10, 0x04, 0x17, 0x43, 0x30, 0x30, 0x35, 0x82, 0x11, 0x01, 0x63,
+    0x52, 0x81, 0x70, 0x81, 0x4F, 0x82, 0x3A, 0x84, 0x40, 0x09, 0x3A, 0x52, 0x15, 0x11, 0x15, 0x67,
+    0x63, 0x37, 0x12, 0x25, 0x82, 0x62, 0x04, 0x11, 0x12, 0x72, 0x47, 0x66, 0x86, 0x4A, 0x84, 0x3E,
+    0x81, 0x4A, 0x80, 0x3E, 0x86, 0x4A, 0x81, 0x40, 0x15, 0x75, 0x66, 0x70, 0x25, 0x72, 0x63, 0x62,
+    0x67, 0x62, 0x4F, 0x62, 0x2C, 0x54, 0x29, 0x5A, 0x31, 0x48, 0x2A, 0x2A, 0x50, 0x50, 0x53, 0x82,
+    0x0D, 0x81, 0x08, 0x84, 0x0D, 0x86, 0x08, 0x85, 0x0D, 0x80, 0x00, 0x83, 0x0D, 0x83, 0x08, 0x81,
+    0x0D, 0x81, 0x08, 0x82, 0x00, 0x03, 0x08, 0x01, 0x01, 0x02, 0x81, 0x01, 0x90, 0x04, 0x87, 0x01,
+    0x81, 0x04, 0x86, 0x04, 0x80, 0x01, 0x8B, 0x04, 0x8B, 0x01, 0x8D, 0x04, 0x81, 0x01, 0x87, 0x03,
+    0x1D, 0x05, 0x08, 0x20, 0x02, 0x01, 0x01, 0x03, 0x0D, 0x80, 0x48, 0x2F, 0x1A, 0x6C, 0x74, 0x0F,
+    0x10, 0x10, 0x1D, 0x1A, 0x51, 0x51, 0x46, 0x6C, 0x13, 0x23, 0x10, 0x17, 0x43, 0x43, 0x30, 0x83,
+    0x11, 0x03, 0x15, 0x67, 0x67, 0x70, 0x81, 0x4F, 0x82, 0x3A, 0x0E, 0x40, 0x3A, 0x40, 0x40, 0x3A,
+    0x6A, 0x15, 0x78, 0x15, 0x15, 0x67, 0x63, 0x2D, 0x35, 0x25, 0x83, 0x62, 0x03, 0x63, 0x62, 0x47,
+    0x4D, 0x88, 0x4A, 0x80, 0x3E, 0x89, 0x4A, 0x82, 0x40, 0x82, 0x75, 0x18, 0x70, 0x25, 0x63, 0x62,
+    0x70, 0x62, 0x70, 0x40, 0x70, 0x24, 0x54, 0x36, 0x25, 0x19, 0x57, 0x2A, 0x2A, 0x50, 0x50, 0x7B,
+    0x50, 0x53, 0x03, 0x0D, 0x08, 0x86, 0x0D, 0x85, 0x08, 0x83, 0x0D, 0x81, 0x00, 0x82, 0x0D, 0x88,
+    0x08, 0x82, 0x00, 0x01, 0x01, 0x03, 0x84, 0x01, 0x8F, 0x04, 0x87, 0x01, 0x81, 0x04, 0x8C, 0x04,
+    0x82, 0x01, 0x87, 0x04, 0x87, 0x01, 0x87, 0x04, 0x80, 0x01, 0x83, 0x04, 0x81, 0x01, 0x8A, 0x03,
+    0x12, 0x02, 0x80, 0x05, 0x03, 0x0D, 0x00, 0x7C, 0x2E, 0x1A, 0x51, 0x17, 0x0F, 0x10, 0x0F, 0x10,
+    0x46, 0x0E, 0x0E, 0x6C, 0x82, 0x46, 0x05, 0x1D, 0x10, 0x13, 0x43, 0x30, 0x35, 0x83, 0x11, 0x07,
+    0x63, 0x67, 0x67, 0x62, 0x70, 0x4F, 0x4F, 0x7A, 0x83, 0x3A, 0x01, 0x40, 0x4F, 0x83, 0x15, 0x09,
+    0x11, 0x63, 0x67, 0x63, 0x15, 0x52, 0x67, 0x62, 0x70, 0x3A, 0x82, 0x70, 0x80, 0x40, 0x81, 0x3E,
+    0x90, 0x4A, 0x82, 0x40, 0x83, 0x75, 0x82, 0x62, 0x81, 0x72, 0x16, 0x4F, 0x75, 0x4A, 0x3A, 0x2C,
+    0x47, 0x36, 0x34, 0x19, 0x57, 0x19, 0x57, 0x6E, 0x50, 0x53, 0x50, 0x50, 0x4C, 0x0D, 0x0D, 0x08,
+    0x08, 0x00, 0x85, 0x08, 0x81, 0x0D, 0x81, 0x08, 0x81, 0x0D, 0x05, 0x08, 0x0D, 0x0D, 0x00, 0x08,
+    0x0D, 0x85, 0x08, 0x81, 0x0D, 0x82, 0x08, 0x80, 0x00, 0x81, 0x08, 0x85, 0x01, 0x81, 0x04, 0x8B,
+    0x01, 0x80, 0x04, 0x86, 0x01, 0x03, 0x03, 0x01, 0x01, 0x04, 0x8D, 0x04, 0x81, 0x01, 0x87, 0x04,
+    0x87, 0x01, 0x8C, 0x04, 0x82, 0x01, 0x84, 0x05, 0x84, 0x03, 0x12, 0x0D, 0x01, 0x03, 0x03, 0x0D,
+    0x00, 0x02, 0x2E, 0x37, 0x1A, 0x0E, 0x0F, 0x55, 0x0F, 0x10, 0x6C, 0x0E, 0x0E, 0x6C, 0x83, 0x46,
+    0x02, 0x10, 0x13, 0x38, 0x81, 0x30, 0x83, 0x11, 0x03, 0x63, 0x67, 0x67, 0x52, 0x81, 0x70, 0x82,
+    0x4F, 0x82, 0x3A, 0x80, 0x4F, 0x82, 0x15, 0x0E, 0x78, 0x15, 0x15, 0x11, 0x11, 0x15, 0x15, 0x52,
+    0x52, 0x62, 0x3A, 0x3E, 0x7D, 0x40, 0x4A, 0x83, 0x3E, 0x8D, 0x4A, 0x82, 0x40, 0x84, 0x75, 0x16,
+    0x4F, 0x67, 0x70, 0x70, 0x33, 0x5A, 0x34, 0x47, 0x40, 0x4A, 0x4F, 0x47, 0x25, 0x34, 0x49, 0x57,
+    0x49, 0x2A, 0x3C, 0x53, 0x68, 0x4C, 0x02, 0x81, 0x03, 0x91, 0x08, 0x81, 0x0D, 0x87, 0x08, 0x81,
+    0x0D, 0x03, 0x08, 0x0D, 0x08, 0x00, 0x81, 0x08, 0x85, 0x01, 0x81, 0x04, 0x93, 0x01, 0x03, 0x03,
+    0x01, 0x01, 0x04, 0x82, 0x01, 0x8B, 0x04, 0x80, 0x01, 0x9A, 0x04, 0x81, 0x01, 0x82, 0x04, 0x81,
+    0x01, 0x83, 0x05, 0x81, 0x03, 0x13, 0x05, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x00, 0x08, 0x5A,
+    0x1A, 0x1A, 0x0E, 0x0F, 0x55, 0x0F, 0x0F, 0x6C, 0x0E, 0x17, 0x82, 0x1A, 0x04, 0x51, 0x46, 0x0F,
+    0x13, 0x1A, 0x81, 0x30, 0x83, 0x11, 0x80, 0x63, 0x82, 0x67, 0x01, 0x6A, 0x70, 0x83, 0x4F, 0x03,
+    0x3A, 0x7A, 0x6A, 0x15, 0x84, 0x78, 0x83, 0x15, 0x81, 0x52, 0x01, 0x70, 0x40, 0x88, 0x3E, 0x8B,
+    0x4A, 0x83, 0x40, 0x81, 0x75, 0x1C, 0x66, 0x75, 0x75, 0x4F, 0x62, 0x70, 0x3A, 0x67, 0x2E, 0x33,
+    0x49, 0x47, 0x40, 0x3A, 0x47, 0x36, 0x2C, 0x49, 0x48, 0x3C, 0x2A, 0x49, 0x4C, 0x68, 0x5D, 0x02,
+    0x05, 0x05, 0x0D, 0x9A, 0x08, 0x83, 0x0D, 0x01, 0x08, 0x00, 0x81, 0x08, 0x84, 0x01, 0x82, 0x04,
+    0x8B, 0x01, 0x81, 0x04, 0x88, 0x01, 0x80, 0x04, 0x83, 0x01, 0xAB, 0x04, 0x82, 0x01, 0x84, 0x05,
+    0x1D, 0x01, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x20, 0x32, 0x1A, 0x1A, 0x0E, 0x0F, 0x55,
+    0x55, 0x0F, 0x6C, 0x0E, 0x17, 0x38, 0x51, 0x1A, 0x1A, 0x6C, 0x0E, 0x13, 0x6C, 0x43, 0x30, 0x83,
+    0x11, 0x80, 0x63, 0x82, 0x67, 0x01, 0x52, 0x6A, 0x81, 0x70, 0x82, 0x4F, 0x02, 0x6A, 0x78, 0x6A,
+    0x86, 0x78, 0x05, 0x15, 0x52, 0x6A, 0x3A, 0x4F, 0x3A, 0x89, 0x3E, 0x88, 0x4A, 0x84, 0x40, 0x81,
+    0x75, 0x81, 0x66, 0x19, 0x75, 0x66, 0x70, 0x4F, 0x4F, 0x40, 0x62, 0x33, 0x72, 0x24, 0x54, 0x40,
+    0x66, 0x47, 0x36, 0x2C, 0x49, 0x57, 0x3C, 0x31, 0x49, 0x68, 0x68, 0x60, 0x4C, 0x53, 0x82, 0x03,
+    0x9A, 0x08, 0x83, 0x0D, 0x82, 0x08, 0x83, 0x01, 0x83, 0x04, 0x8A, 0x01, 0x81, 0x04, 0x89, 0x01,
+    0x80, 0x04, 0x83, 0x01, 0x81, 0x04, 0x81, 0x01, 0x9F, 0x04, 0x80, 0x01, 0x86, 0x04, 0x83, 0x01,
+    0x83, 0x05, 0x0C, 0x01, 0x05, 0x01, 0x01, 0x03, 0x03, 0x05, 0x03, 0x14, 0x29, 0x1A, 0x6C, 0x0E,
+    0x82, 0x0F, 0x03, 0x55, 0x1D, 0x0E, 0x17, 0x82, 0x38, 0x07, 0x51, 0x46, 0x17, 0x0E, 0x17, 0x38,
+    0x30, 0x35, 0x82, 0x11, 0x80, 0x63, 0x82, 0x15, 0x81, 0x52, 0x81, 0x6A, 0x03, 0x70, 0x4F, 0x70,
+    0x6A, 0x86, 0x78, 0x82, 0x15, 0x05, 0x6A, 0x3A, 0x4A, 0x3A, 0x66, 0x4A, 0x89, 0x3E, 0x86, 0x4A,
+    0x84, 0x40, 0x82, 0x75, 0x81, 0x66, 0x12, 0x75, 0x4F, 0x70, 0x4F, 0x40, 0x3A, 0x62, 0x67, 0x63,
+    0x62, 0x54, 0x75, 0x4A, 0x70, 0x32, 0x24, 0x49, 0x57, 0x3C, 0x81, 0x49, 0x83, 0x68, 0x04, 0x0D,
+    0x05, 0x05, 0x03, 0x0D, 0x9A, 0x08, 0x84, 0x0D, 0x80, 0x08, 0x83, 0x01, 0x8D, 0x04, 0x8C, 0x01,
+    0x80, 0x04, 0x82, 0x01, 0x81, 0x04, 0x82, 0x01, 0x9F, 0x04, 0x80, 0x01, 0x86, 0x04, 0x83, 0x01,
+    0x83, 0x05, 0x81, 0x01, 0x01, 0x02, 0x01, 0x83, 0x03, 0x03, 0x19, 0x44, 0x1A, 0x1D, 0x83, 0x0F,
+    0x0E, 0x10, 0x1D, 0x0E, 0x17, 0x38, 0x43, 0x43, 0x38, 0x46, 0x6C, 0x0E, 0x17, 0x38, 0x30, 0x35,
+    0x83, 0x11, 0x83, 0x15, 0x80, 0x52, 0x84, 0x6A, 0x88, 0x78, 0x08, 0x15, 0x6A, 0x4F, 0x75, 0x40,
+    0x40, 0x75, 0x75, 0x40, 0x89, 0x3E, 0x85, 0x4A, 0x83, 0x40, 0x83, 0x75, 0x82, 0x66, 0x82, 0x4F,
+    0x01, 0x4A, 0x3A, 0x84, 0x62, 0x06, 0x3A, 0x4A, 0x4F, 0x59, 0x3C, 0x31, 0x57, 0x82, 0x3C, 0x81,
+    0x68, 0x07, 0x50, 0x68, 0x50, 0x05, 0x0D, 0x03, 0x00, 0x0D, 0x91, 0x08, 0x80, 0x0D, 0x86, 0x08,
+    0x85, 0x0D, 0x83, 0x01, 0x8C, 0x04, 0x8D, 0x01, 0x80, 0x04, 0x84, 0x04, 0x82, 0x01, 0xAA, 0x04,
+    0x84, 0x01, 0x1E, 0x04, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x03, 0x31, 0x2F, 0x1A, 0x0E, 0x0F,
+    0x0E, 0x0F, 0x0F, 0x10, 0x1D, 0x74, 0x17, 0x38, 0x79, 0x79, 0x38, 0x1D, 0x6C, 0x17, 0x6C, 0x51,
+    0x43, 0x35, 0x83, 0x11, 0x83, 0x15, 0x82, 0x52, 0x81, 0x6A, 0x81, 0x78, 0x80, 0x15, 0x84, 0x78,
+    0x81, 0x15, 0x81, 0x6A, 0x03, 0x24, 0x49, 0x54, 0x47, 0x82, 0x60, 0x02, 0x66, 0x40, 0x4A, 0x86,
+    0x3E, 0x83, 0x4A, 0x80, 0x7D, 0x84, 0x40, 0x83, 0x75, 0x02, 0x66, 0x75, 0x66, 0x82, 0x4F, 0x01,
+    0x40, 0x3A, 0x84, 0x62, 0x12, 0x75, 0x4A, 0x70, 0x3D, 0x3C, 0x49, 0x2A, 0x3C, 0x5C, 0x54, 0x68,
+    0x68, 0x50, 0x68, 0x68, 0x53, 0x05, 0x6D, 0x03, 0x88, 0x08, 0x80, 0x03, 0x88, 0x08, 0x81, 0x0D,
+    0x85, 0x08, 0x81, 0x0D, 0x83, 0x08, 0x80, 0x03, 0x84, 0x01, 0x8B, 0x04, 0x8C, 0x01, 0x80, 0x04,
+    0x83, 0x04, 0x83, 0x01, 0xA1, 0x04, 0x83, 0x01, 0x83, 0x04, 0x85, 0x01, 0x02, 0x04, 0x05, 0x0D,
+    0x82, 0x03, 0x18, 0x01, 0x03, 0x31, 0x2F, 0x17, 0x0F, 0x0F, 0x0E, 0x55, 0x0F, 0x10, 0x13, 0x0F,
+    0x17, 0x38, 0x43, 0x38, 0x17, 0x0F, 0x12, 0x51, 0x6C, 0x1A, 0x2D, 0x35, 0x83, 0x11, 0x84, 0x15,
+    0x82, 0x52, 0x80, 0x15, 0x81, 0x78, 0x81, 0x6A, 0x83, 0x78, 0x0E, 0x15, 0x6A, 0x52, 0x2E, 0x25,
+    0x2E, 0x2B, 0x42, 0x6E, 0x49, 0x3C, 0x54, 0x60, 0x75, 0x4A, 0x85, 0x3E, 0x82, 0x4A, 0x81, 0x7D,
+    0x83, 0x40, 0x84, 0x75, 0x20, 0x66, 0x75, 0x66, 0x4F, 0x4F, 0x66, 0x66, 0x70, 0x62, 0x62, 0x70,
+    0x62, 0x70, 0x40, 0x40, 0x47, 0x2C, 0x3C, 0x49, 0x2A, 0x3C, 0x5C, 0x60, 0x68, 0x53, 0x50, 0x50,
+    0x5D, 0x53, 0x05, 0x6D, 0x03, 0x0D, 0x85, 0x08, 0x83, 0x03, 0x87, 0x08, 0x83, 0x0D, 0x82, 0x08,
+    0x82, 0x0D, 0x83, 0x08, 0x80, 0x03, 0x84, 0x01, 0x8B, 0x04, 0x82, 0x01, 0x81, 0x03, 0x87, 0x01,
+    0x80, 0x04, 0x81, 0x04, 0x80, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x04, 0x82, 0x01, 0x83, 0x04,
+    0x82, 0x01, 0x8F, 0x04, 0x85, 0x01, 0x80, 0x04, 0x84, 0x01, 0x01, 0x04, 0x01, 0x81, 0x03, 0x84,
+    0x01, 0x1D, 0x04, 0x05, 0x08, 0x03, 0x03, 0x05, 0x03, 0x2B, 0x1A, 0x1D, 0x55, 0x0E, 0x0F, 0x55,
+    0x0F, 0x23, 0x10, 0x6C, 0x0E, 0x38, 0x43, 0x38, 0x17, 0x0E, 0x46, 0x38, 0x38, 0x51, 0x2D, 0x30,
+    0x83, 0x11, 0x86, 0x15, 0x81, 0x52, 0x80, 0x15, 0x85, 0x78, 0x02, 0x6A, 0x15, 0x11, 0x84, 0x25,
+    0x07, 0x48, 0x3C, 0x2C, 0x2C, 0x24, 0x6E, 0x54, 0x66, 0x89, 0x4A, 0x85, 0x40, 0x84, 0x75, 0x81,
+    0x3A, 0x80, 0x7A, 0x81, 0x4F, 0x84, 0x70, 0x15, 0x4F, 0x3A, 0x40, 0x75, 0x47, 0x49, 0x58, 0x3C,
+    0x31, 0x50, 0x3C, 0x54, 0x68, 0x6E, 0x68, 0x58, 0x68, 0x5D, 0x0D, 0x05, 0x6D, 0x0D, 0x83, 0x08,
+    0x01, 0x03, 0x01, 0x86, 0x03, 0x8F, 0x08, 0x84, 0x01, 0x83, 0x03, 0x81, 0x01, 0x86, 0x04, 0x01,
+    0x01, 0x04, 0x8D, 0x01, 0x80, 0x04, 0x80, 0x04, 0x82, 0x01, 0x80, 0x04, 0x82, 0x01, 0x80, 0x04,
+    0x84, 0x01, 0x82, 0x04, 0x82, 0x01, 0x91, 0x04, 0x83, 0x01, 0x86, 0x04, 0x87, 0x01, 0x19, 0x05,
+    0x04, 0x08, 0x01, 0x05, 0x04, 0x03, 0x2E, 0x37, 0x12, 0x55, 0x12, 0x13, 0x55, 0x0F, 0x23, 0x10,
+    0x0E, 0x1D, 0x38, 0x38, 0x51, 0x17, 0x17, 0x38, 0x51, 0x82, 0x38, 0x01, 0x30, 0x35, 0x82, 0x11,
+    0x86, 0x15, 0x04, 0x52, 0x15, 0x52, 0x15, 0x6A, 0x81, 0x78, 0x83, 0x15, 0x01, 0x36, 0x5A, 0x82,
+    0x25, 0x0A, 0x2E, 0x34, 0x2B, 0x48, 0x48, 0x2B, 0x2C, 0x2A, 0x49, 0x4D, 0x40, 0x82, 0x7D, 0x83,
+    0x4A, 0x81, 0x7D, 0x83, 0x40, 0x82, 0x3A, 0x80, 0x75, 0x84, 0x3A, 0x81, 0x4F, 0x19, 0x70, 0x4F,
+    0x7D, 0x4A, 0x40, 0x4A, 0x40, 0x66, 0x75, 0x54, 0x6E, 0x5C, 0x5C, 0x49, 0x50, 0x3C, 0x3C, 0x68,
+    0x68, 0x50, 0x68, 0x58, 0x5D, 0x68, 0x03, 0x53, 0x81, 0x03, 0x82, 0x08, 0x88, 0x03, 0x8E, 0x08,
+    0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x83, 0x03, 0x82, 0x04, 0x81, 0x01, 0x83, 0x04, 0x01, 0x01,
+    0x04, 0x8D, 0x01, 0x80, 0x04, 0x80, 0x04, 0x8D, 0x01, 0x81, 0x04, 0x82, 0x01, 0x8B, 0x04, 0x81,
+    0x01, 0x85, 0x04, 0x81, 0x01, 0x86, 0x04, 0x85, 0x01, 0x1F, 0x03, 0x01, 0x05, 0x04, 0x03, 0x03,
+    0x05, 0x04, 0x03, 0x59, 0x17, 0x1D, 0x74, 0x1A, 0x0F, 0x0F, 0x55, 0x23, 0x10, 0x55, 0x17, 0x38,
+    0x38, 0x1A, 0x1A, 0x38, 0x38, 0x1A, 0x79, 0x79, 0x43, 0x30, 0x82, 0x11, 0x87, 0x15, 0x82, 0x52,
+    0x81, 0x6A, 0x80, 0x52, 0x83, 0x15, 0x02, 0x25, 0x5A, 0x36, 0x81, 0x32, 0x82, 0x29, 0x0F, 0x2D,
+    0x44, 0x44, 0x29, 0x2E, 0x57, 0x57, 0x24, 0x4F, 0x3A, 0x40, 0x40, 0x7D, 0x7D, 0x4A, 0x7D, 0x85,
+    0x40, 0x87, 0x3A, 0x81, 0x4F, 0x1A, 0x75, 0x4A, 0x4A, 0x3E, 0x4A, 0x4A, 0x40, 0x47, 0x75, 0x70,
+    0x68, 0x68, 0x50, 0x6E, 0x3C, 0x54, 0x3C, 0x3C, 0x60, 0x54, 0x50, 0x68, 0x14, 0x54, 0x60, 0x03,
+    0x6D, 0x82, 0x03, 0x80, 0x08, 0x8C, 0x03, 0x8B, 0x08, 0x85, 0x01, 0x83, 0x03, 0x81, 0x04, 0x82,
+    0x01, 0x83, 0x04, 0x01, 0x01, 0x04, 0x8C, 0x01, 0x81, 0x04, 0x80, 0x04, 0x8C, 0x01, 0x82, 0x04,
+    0x81, 0x01, 0x01, 0x03, 0x01, 0x81, 0x04, 0x86, 0x01, 0x81, 0x04, 0x81, 0x01, 0x85, 0x04, 0x81,
+    0x01, 0x87, 0x04, 0x81, 0x01, 0x80, 0x03, 0x83, 0x01, 0x81, 0x04, 0x1C, 0x05, 0x03, 0x05, 0x04,
+    0x00, 0x29, 0x12, 0x13, 0x12, 0x1A, 0x0F, 0x23, 0x10, 0x10, 0x23, 0x23, 0x17, 0x43, 0x38, 0x46,
+    0x51, 0x79, 0x79, 0x1A, 0x79, 0x79, 0x38, 0x30, 0x35, 0x82, 0x11, 0x85, 0x15, 0x86, 0x52, 0x82,
+    0x15, 0x15, 0x11, 0x32, 0x32, 0x29, 0x45, 0x29, 0x29, 0x5A, 0x5A, 0x2C, 0x54, 0x3C, 0x2C, 0x2E,
+    0x2E, 0x2B, 0x2B, 0x24, 0x70, 0x4F, 0x7A, 0x3A, 0x88, 0x40, 0x87, 0x3A, 0x81, 0x4F, 0x19, 0x66,
+    0x75, 0x40, 0x4A, 0x40, 0x4A, 0x40, 0x40, 0x7A, 0x29, 0x60, 0x68, 0x50, 0x6E, 0x3C, 0x68, 0x5C,
+    0x54, 0x60, 0x50, 0x6E, 0x50, 0x50, 0x49, 0x68, 0x7B, 0x91, 0x03, 0x8A, 0x08, 0x83, 0x01, 0x80,
+    0x0D, 0x81, 0x01, 0x83, 0x03, 0x85, 0x01, 0x82, 0x04, 0x8E, 0x01, 0x81, 0x04, 0x80, 0x04, 0x8B,
+    0x01, 0x84, 0x04, 0x80, 0x01, 0x81, 0x03, 0x81, 0x04, 0x88, 0x01, 0x85, 0x04, 0x83, 0x01, 0x86,
+    0x04, 0x81, 0x01, 0x83, 0x03, 0x0D, 0x01, 0x03, 0x04, 0x01, 0x04, 0x05, 0x80, 0x04, 0x14, 0x44,
+    0x1D, 0x23, 0x1A, 0x12, 0x81, 0x0F, 0x83, 0x10, 0x0B, 0x0E, 0x38, 0x38, 0x1A, 0x1A, 0x79, 0x38,
+    0x51, 0x38, 0x79, 0x43, 0x30, 0x82, 0x11, 0x86, 0x15, 0x80, 0x52, 0x82, 0x15, 0x1C, 0x52, 0x15,
+    0x15, 0x52, 0x15, 0x11, 0x35, 0x45, 0x44, 0x29, 0x32, 0x34, 0x08, 0x60, 0x6B, 0x69, 0x6B, 0x4D,
+    0x66, 0x4D, 0x6B, 0x6E, 0x2B, 0x2E, 0x72, 0x67, 0x6A, 0x4F, 0x3A, 0x89, 0x40, 0x85, 0x3A, 0x1E,
+    0x4F, 0x40, 0x4A, 0x3A, 0x4A, 0x3E, 0x7D, 0x4A, 0x3E, 0x4A, 0x59, 0x36, 0x60, 0x54, 0x6E, 0x6E,
+    0x5C, 0x68, 0x3C, 0x54, 0x60, 0x50, 0x5D, 0x50, 0x50, 0x58, 0x3C, 0x60, 0x53, 0x03, 0x6D, 0x8E,
+    0x03, 0x87, 0x01, 0x80, 0x08, 0x86, 0x03, 0x81, 0x01, 0x83, 0x03, 0x84, 0x01, 0x83, 0x04, 0x8F,
+    0x01, 0x80, 0x04, 0x80, 0x04, 0x85, 0x01, 0x80, 0x04, 0x82, 0x01, 0x86, 0x04, 0x82, 0x03, 0x8A,
+    0x01, 0x84, 0x04, 0x84, 0x01, 0x85, 0x04, 0x82, 0x01, 0x82, 0x03, 0x10, 0x05, 0x04, 0x01, 0x04,
+    0x05, 0x01, 0x05, 0x05, 0x0A, 0x31, 0x56, 0x0E, 0x65, 0x2D, 0x12, 0x13, 0x0F, 0x81, 0x23, 0x82,
+    0x10, 0x0A, 0x46, 0x38, 0x51, 0x1A, 0x1A, 0x38, 0x38, 0x1A, 0x2F, 0x43, 0x30, 0x82, 0x11, 0x85,
+    0x15, 0x82, 0x52, 0x85, 0x15, 0x17, 0x11, 0x43, 0x44, 0x0C, 0x32, 0x25, 0x24, 0x81, 0x61, 0x0B,
+    0x61, 0x3B, 0x0B, 0x4D, 0x40, 0x75, 0x6B, 0x6B, 0x47, 0x62, 0x3D, 0x29, 0x25, 0x70, 0x81, 0x3A,
+    0x88, 0x40, 0x85, 0x3A, 0x1E, 0x4F, 0x7D, 0x3E, 0x3E, 0x6F, 0x3E, 0x3E, 0x4A, 0x4A, 0x6A, 0x55,
+    0x24, 0x61, 0x54, 0x54, 0x68, 0x5C, 0x5D, 0x5C, 0x3C, 0x60, 0x54, 0x5D, 0x50, 0x53, 0x53, 0x19,
+    0x54, 0x61, 0x4C, 0x6D, 0x90, 0x03, 0x84, 0x01, 0x8E, 0x03, 0x81, 0x01, 0x81, 0x03, 0x80, 0x01,
+    0x83, 0x04, 0x8F, 0x01, 0x80, 0x04, 0x02, 0x04, 0x01, 0x03, 0x82, 0x01, 0x81, 0x04, 0x82, 0x01,
+    0x86, 0x04, 0x82, 0x03, 0x88, 0x01, 0x81, 0x04, 0x80, 0x05, 0x82, 0x01, 0x82, 0x03, 0x81, 0x05,
+    0x80, 0x01, 0x83, 0x04, 0x81, 0x01, 0x80, 0x03, 0x82, 0x01, 0x81, 0x03, 0x82, 0x05, 0x0E, 0x04,
+    0x03, 0x03, 0x0A, 0x05, 0x09, 0x2C, 0x1A, 0x0E, 0x37, 0x5A, 0x12, 0x0F, 0x65, 0x18, 0x83, 0x10,
+    0x80, 0x0E, 0x83, 0x38, 0x81, 0x30, 0x01, 0x43, 0x2D, 0x81, 0x30, 0x82, 0x11, 0x86, 0x15, 0x83,
+    0x52, 0x82, 0x15, 0x1A, 0x11, 0x2D, 0x37, 0x45, 0x35, 0x36, 0x33, 0x19, 0x81, 0x4C, 0x73, 0x0B,
+    0x4C, 0x08, 0x60, 0x47, 0x66, 0x6B, 0x4D, 0x6B, 0x4D, 0x66, 0x4F, 0x6A, 0x6A, 0x7A, 0x3A, 0x87,
+    0x40, 0x85, 0x3A, 0x03, 0x4F, 0x70, 0x75, 0x4A, 0x82, 0x3E, 0x81, 0x4A, 0x17, 0x66, 0x1A, 0x56,
+    0x54, 0x61, 0x54, 0x3C, 0x5D, 0x50, 0x5D, 0x5C, 0x3C, 0x60, 0x54, 0x60, 0x5C, 0x50, 0x68, 0x58,
+    0x49, 0x60, 0x68, 0x4C, 0x6D, 0x90, 0x03, 0x84, 0x01, 0x85, 0x03, 0x81, 0x0D, 0x85, 0x03, 0x81,
+    0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x04, 0x91, 0x01, 0x02, 0x04, 0x01, 0x03, 0x82, 0x01, 0x81,
+    0x04, 0x82, 0x01, 0x86, 0x04, 0x83, 0x03, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x82, 0x04, 0x80,
+    0x05, 0x85, 0x03, 0x82, 0x05, 0x82, 0x04, 0x82, 0x01, 0x81, 0x03, 0x1D, 0x01, 0x04, 0x01, 0x03,
+    0x05, 0x05, 0x7E, 0x04, 0x05, 0x03, 0x04, 0x04, 0x01, 0x2B, 0x17, 0x74, 0x29, 0x33, 0x37, 0x23,
+    0x65, 0x18, 0x10, 0x18, 0x23, 0x39, 0x10, 0x51, 0x38, 0x79, 0x81, 0x30, 0x83, 0x11, 0x01, 0x30,
+    0x35, 0x81, 0x11, 0x87, 0x15, 0x80, 0x52, 0x84, 0x15, 0x01, 0x11, 0x30, 0x82, 0x35, 0x14, 0x36,
+    0x5A, 0x2E, 0x31, 0x08, 0x81, 0x6E, 0x6E, 0x4C, 0x6E, 0x5D, 0x61, 0x61, 0x6B, 0x4D, 0x4D, 0x75,
+    0x40, 0x3A, 0x4F, 0x7A, 0x82, 0x3A, 0x82, 0x40, 0x88, 0x3A, 0x1E, 0x70, 0x2C, 0x47, 0x75, 0x40,
+    0x40, 0x4A, 0x40, 0x3A, 0x59, 0x10, 0x36, 0x61, 0x60, 0x54, 0x49, 0x5D, 0x54, 0x68, 0x5C, 0x3C,
+    0x47, 0x54, 0x60, 0x50, 0x50, 0x53, 0x53, 0x42, 0x3C, 0x61, 0x81, 0x6D, 0x90, 0x03, 0x84, 0x01,
+    0x86, 0x03, 0x80, 0x0D, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x04,
+    0x91, 0x01, 0x85, 0x01, 0x87, 0x04, 0x8B, 0x01, 0x82, 0x04, 0x81, 0x01, 0x80, 0x03, 0x86, 0x01,
+    0x80, 0x04, 0x87, 0x01, 0x83, 0x03, 0x83, 0x05, 0x15, 0x01, 0x05, 0x05, 0x22, 0x0D, 0x05, 0x04,
+    0x3D, 0x17, 0x12, 0x34, 0x2B, 0x12, 0x0E, 0x23, 0x10, 0x10, 0x23, 0x23, 0x10, 0x39, 0x13, 0x82,
+    0x38, 0x80, 0x30, 0x83, 0x11, 0x02, 0x35, 0x30, 0x11, 0x85, 0x15, 0x03, 0x52, 0x15, 0x15, 0x52,
+    0x87, 0x15, 0x11, 0x11, 0x36, 0x36, 0x5A, 0x5A, 0x2E, 0x34, 0x24, 0x31, 0x31, 0x42, 0x20, 0x81,
+    0x4C, 0x5D, 0x47, 0x47, 0x66, 0x82, 0x3A, 0x81, 0x7A, 0x88, 0x3A, 0x80, 0x40, 0x82, 0x3A, 0x23,
+    0x7A, 0x4F, 0x11, 0x29, 0x72, 0x54, 0x4D, 0x66, 0x66, 0x70, 0x59, 0x74, 0x13, 0x24, 0x61, 0x60,
+    0x3C, 0x3C, 0x6E, 0x4C, 0x53, 0x50, 0x54, 0x5D, 0x54, 0x5D, 0x68, 0x02, 0x0D, 0x53, 0x50, 0x5F,
+    0x54, 0x61, 0x03, 0x06, 0x82, 0x03, 0x01, 0x0D, 0x05, 0x8D, 0x03, 0x81, 0x01, 0x82, 0x03, 0x81,
+    0x01, 0x82, 0x03, 0x81, 0x01, 0x85, 0x03, 0x89, 0x01, 0x81, 0x03, 0x8A, 0x01, 0x80, 0x04, 0x84,
+    0x01, 0x88, 0x04, 0x8B, 0x01, 0x82, 0x04, 0x95, 0x01, 0x84, 0x04, 0x0E, 0x01, 0x05, 0x05, 0x06,
+    0x0D, 0x04, 0x02, 0x29, 0x12, 0x44, 0x57, 0x2B, 0x12, 0x12, 0x13, 0x83, 0x10, 0x03, 0x28, 0x39,
+    0x10, 0x46, 0x81, 0x79, 0x83, 0x11, 0x81, 0x35, 0x80, 0x30, 0x81, 0x11, 0x91, 0x15, 0x15, 0x11,
+    0x63, 0x25, 0x25, 0x72, 0x33, 0x34, 0x34, 0x33, 0x34, 0x2C, 0x2A, 0x2A, 0x24, 0x62, 0x70, 0x4F,
+    0x3A, 0x3A, 0x40, 0x3A, 0x7A, 0x8C, 0x3A, 0x0E, 0x7A, 0x70, 0x65, 0x39, 0x17, 0x59, 0x72, 0x63,
+    0x36, 0x37, 0x10, 0x13, 0x1D, 0x54, 0x6B, 0x82, 0x3C, 0x14, 0x68, 0x50, 0x53, 0x50, 0x54, 0x5D,
+    0x54, 0x6E, 0x5D, 0x53, 0x0D, 0x02, 0x50, 0x5C, 0x5F, 0x54, 0x5D, 0x01, 0x03, 0x05, 0x4C, 0x90,
+    0x03, 0x80, 0x01, 0x87, 0x03, 0x81, 0x01, 0x83, 0x03, 0x01, 0x01, 0x03, 0x96, 0x01, 0x80, 0x04,
+    0x83, 0x01, 0x85, 0x04, 0x80, 0x01, 0x82, 0x04, 0x8B, 0x01, 0x82, 0x04, 0x95, 0x01, 0x84, 0x04,
+    0x10, 0x05, 0x04, 0x05, 0x06, 0x05, 0x04, 0x14, 0x56, 0x12, 0x5A, 0x42, 0x2B, 0x12, 0x12, 0x13,
+    0x55, 0x23, 0x82, 0x10, 0x03, 0x28, 0x39, 0x23, 0x46, 0x81, 0x30, 0x84, 0x11, 0x02, 0x0C, 0x30,
+    0x11, 0x92, 0x15, 0x80, 0x67, 0x84, 0x63, 0x81, 0x25, 0x82, 0x63, 0x05, 0x67, 0x63, 0x67, 0x6A,
+    0x4F, 0x7A, 0x90, 0x3A, 0x26, 0x4F, 0x11, 0x10, 0x18, 0x18, 0x10, 0x23, 0x55, 0x18, 0x13, 0x0F,
+    0x13, 0x2D, 0x60, 0x54, 0x24, 0x54, 0x3C, 0x68, 0x53, 0x68, 0x5C, 0x24, 0x5D, 0x3C, 0x50, 0x5D,
+    0x53, 0x0D, 0x0D, 0x02, 0x50, 0x58, 0x31, 0x60, 0x5D, 0x03, 0x03, 0x05, 0x81, 0x6D, 0x8F, 0x03,
+    0x80, 0x01, 0x83, 0x03, 0x84, 0x01, 0x83, 0x03, 0x82, 0x01, 0x80, 0x03, 0x94, 0x01, 0x80, 0x04,
+    0x84, 0x01, 0x83, 0x04, 0x82, 0x01, 0x81, 0x04, 0xA0, 0x01, 0x80, 0x03, 0x83, 0x04, 0x84, 0x05,
+    0x18, 0x04, 0x05, 0x22, 0x04, 0x0A, 0x2A, 0x37, 0x37, 0x2C, 0x1F, 0x2B, 0x1D, 0x12, 0x65, 0x18,
+    0x23, 0x23, 0x18, 0x10, 0x28, 0x39, 0x39, 0x23, 0x38, 0x30, 0x83, 0x11, 0x03, 0x35, 0x45, 0x38,
+    0x11, 0x83, 0x15, 0x80, 0x52, 0x8E, 0x15, 0x04, 0x67, 0x63, 0x63, 0x25, 0x36, 0x82, 0x35, 0x80,
+    0x11, 0x82, 0x67, 0x03, 0x52, 0x6A, 0x4F, 0x7A, 0x82, 0x3A, 0x81, 0x7A, 0x89, 0x3A, 0x81, 0x4F,
+    0x26, 0x70, 0x13, 0x28, 0x18, 0x18, 0x0E, 0x13, 0x0F, 0x0F, 0x0E, 0x74, 0x18, 0x72, 0x6B, 0x25,
+    0x34, 0x54, 0x3C, 0x4C, 0x68, 0x68, 0x5C, 0x57, 0x60, 0x3C, 0x54, 0x60, 0x68, 0x3F, 0x6E, 0x50,
+    0x02, 0x6E, 0x49, 0x49, 0x60, 0x68, 0x01, 0x53, 0x97, 0x03, 0x82, 0x01, 0x84, 0x03, 0x81, 0x01,
+    0x81, 0x03, 0x94, 0x01, 0x80, 0x04, 0x86, 0x01, 0x80, 0x04, 0x86, 0x01, 0x80, 0x03, 0x9E, 0x01,
+    0x80, 0x03, 0x82, 0x04, 0x85, 0x05, 0x20, 0x06, 0x05, 0x05, 0x04, 0x09, 0x33, 0x12, 0x2D, 0x1F,
+    0x1F, 0x2E, 0x12, 0x17, 0x65, 0x18, 0x23, 0x10, 0x0F, 0x10, 0x39, 0x28, 0x07, 0x39, 0x13, 0x38,
+    0x30, 0x11, 0x11, 0x30, 0x43, 0x17, 0x23, 0x43, 0x83, 0x15, 0x81, 0x52, 0x8E, 0x15, 0x80, 0x63,
+    0x82, 0x11, 0x82, 0x35, 0x81, 0x11, 0x02, 0x63, 0x52, 0x6A, 0x81, 0x4F, 0x87, 0x7A, 0x83, 0x3A,
+    0x01, 0x7A, 0x3A, 0x83, 0x4F, 0x80, 0x11, 0x82, 0x18, 0x81, 0x0F, 0x22, 0x23, 0x0F, 0x10, 0x1D,
+    0x18, 0x37, 0x54, 0x60, 0x30, 0x2E, 0x3C, 0x54, 0x4C, 0x73, 0x68, 0x50, 0x2C, 0x60, 0x3C, 0x60,
+    0x5D, 0x68, 0x02, 0x0D, 0x53, 0x02, 0x02, 0x0D, 0x42, 0x3C, 0x60, 0x09, 0x6D, 0x05, 0x09, 0x96,
+    0x03, 0x80, 0x01, 0x86, 0x03, 0x80, 0x01, 0x81, 0x03, 0x95, 0x01, 0x8E, 0x01, 0x80, 0x03, 0x8E,
+    0x01, 0x80, 0x03, 0x8C, 0x01, 0x85, 0x04, 0x88, 0x05, 0x1E, 0x04, 0x03, 0x3D, 0x12, 0x25, 0x7C,
+    0x1F, 0x2E, 0x17, 0x6C, 0x74, 0x13, 0x0F, 0x10, 0x0F, 0x23, 0x39, 0x27, 0x27, 0x07, 0x07, 0x13,
+    0x46, 0x38, 0x38, 0x46, 0x13, 0x18, 0x07, 0x1D, 0x11, 0x83, 0x15, 0x80, 0x52, 0x91, 0x15, 0x80,
+    0x11, 0x82, 0x15, 0x81, 0x6A, 0x82, 0x4F, 0x86, 0x7A, 0x80, 0x4F, 0x85, 0x7A, 0x80, 0x3A, 0x83,
+    0x4F, 0x1E, 0x6A, 0x65, 0x10, 0x18, 0x18, 0x13, 0x10, 0x18, 0x0F, 0x13, 0x46, 0x18, 0x72, 0x47,
+    0x24, 0x43, 0x5A, 0x58, 0x6E, 0x68, 0x53, 0x68, 0x5C, 0x24, 0x60, 0x49, 0x60, 0x5D, 0x68, 0x50,
+    0x0D, 0x82, 0x05, 0x08, 0x7F, 0x0D, 0x19, 0x6E, 0x5D, 0x53, 0x03, 0x05, 0x6D, 0x8E, 0x03, 0x80,
+    0x01, 0x84, 0x03, 0x81, 0x01, 0x89, 0x03, 0x95, 0x01, 0x8D, 0x01, 0x81, 0x03, 0x8C, 0x01, 0x83,
+    0x03, 0x8B, 0x01, 0x85, 0x04, 0x88, 0x05, 0x13, 0x06, 0x0D, 0x29, 0x56, 0x31, 0x76, 0x3F, 0x3D,
+    0x1A, 0x12, 0x74, 0x0F, 0x0F, 0x55, 0x0F, 0x23, 0x39, 0x07, 0x27, 0x39, 0x83, 0x07, 0x80, 0x27,
+    0x83, 0x71, 0x02, 0x10, 0x38, 0x11, 0x8B, 0x15, 0x80, 0x52, 0x87, 0x15, 0x81, 0x78, 0x03, 0x6A,
+    0x4F, 0x3A, 0x7D, 0x81, 0x3E, 0x81, 0x7D, 0x84, 0x3A, 0x87, 0x7A, 0x83, 0x4F, 0x2B, 0x70, 0x6A,
+    0x43, 0x71, 0x28, 0x18, 0x18, 0x13, 0x0E, 0x0F, 0x18, 0x18, 0x23, 0x51, 0x47, 0x70, 0x36, 0x59,
+    0x5A, 0x5C, 0x5C, 0x50, 0x53, 0x68, 0x5C, 0x24, 0x60, 0x3C, 0x54, 0x60, 0x68, 0x53, 0x02, 0x05,
+    0x05, 0x0D, 0x02, 0x3F, 0x0D, 0x19, 0x6E, 0x61, 0x73, 0x02, 0x81, 0x6D, 0x9F, 0x03, 0x95, 0x01,
+    0x80, 0x04, 0x89, 0x01, 0x81, 0x03, 0x80, 0x01, 0x81, 0x03, 0x8F, 0x01, 0x81, 0x03, 0x89, 0x01,
+    0x85, 0x04, 0x83, 0x05, 0x82, 0x06, 0x22, 0x03, 0x05, 0x05, 0x06, 0x5C, 0x44, 0x45, 0x02, 0x02,
+    0x00, 0x32, 0x2F, 0x37, 0x12, 0x0E, 0x0F, 0x13, 0x0F, 0x23, 0x28, 0x07, 0x71, 0x71, 0x27, 0x71,
+    0x71, 0x27, 0x07, 0x71, 0x18, 0x18, 0x28, 0x07, 0x13, 0x11, 0x88, 0x15, 0x80, 0x52, 0x88, 0x15,
+    0x0C, 0x78, 0x6A, 0x15, 0x6A, 0x7A, 0x40, 0x7D, 0x7D, 0x3E, 0x6F, 0x3E, 0x4A, 0x7D, 0x81, 0x40,
+    0x82, 0x3A, 0x83, 0x7A, 0x85, 0x4F, 0x81, 0x70, 0x28, 0x11, 0x10, 0x18, 0x71, 0x18, 0x0F, 0x23,
+    0x23, 0x18, 0x13, 0x65, 0x0F, 0x62, 0x4D, 0x36, 0x38, 0x43, 0x59, 0x49, 0x50, 0x50, 0x68, 0x53,
+    0x5C, 0x24, 0x54, 0x24, 0x3C, 0x5D, 0x68, 0x68, 0x50, 0x53, 0x80, 0x0D, 0x0D, 0x02, 0x0D, 0x0D,
+    0x14, 0x6E, 0x81, 0x61, 0x81, 0x6D, 0x9F, 0x03, 0x95, 0x01, 0x80, 0x01, 0x84, 0x03, 0x81, 0x01,
+    0x82, 0x03, 0x81, 0x01, 0x82, 0x03, 0x87, 0x01, 0x85, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x01,
+    0x82, 0x04, 0x03, 0x01, 0x04, 0x04, 0x01, 0x83, 0x04, 0x85, 0x05, 0x81, 0x06, 0x81, 0x05, 0x23,
+    0x09, 0x04, 0x04, 0x0A, 0x2C, 0x12, 0x2E, 0x7E, 0x02, 0x5E, 0x29, 0x0C, 0x37, 0x65, 0x0E, 0x0F,
+    0x0F, 0x10, 0x23, 0x18, 0x07, 0x07, 0x27, 0x27, 0x39, 0x71, 0x27, 0x27, 0x71, 0x18, 0x18, 0x71,
+    0x28, 0x07, 0x38, 0x11, 0x83, 0x15, 0x81, 0x52, 0x01, 0x15, 0x52, 0x81, 0x15, 0x81, 0x52, 0x85,
+    0x15, 0x03, 0x6A, 0x78, 0x6A, 0x4F, 0x81, 0x3A, 0x81, 0x40, 0x83, 0x4A, 0x80, 0x7D, 0x82, 0x40,
+    0x82, 0x3A, 0x82, 0x7A, 0x83, 0x4F, 0x82, 0x70, 0x24, 0x11, 0x13, 0x18, 0x18, 0x28, 0x71, 0x1D,
+    0x55, 0x55, 0x18, 0x0E, 0x18, 0x59, 0x47, 0x62, 0x46, 0x43, 0x12, 0x36, 0x49, 0x5C, 0x50, 0x53,
+    0x53, 0x58, 0x49, 0x54, 0x49, 0x31, 0x54, 0x68, 0x5D, 0x50, 0x05, 0x05, 0x04, 0x05, 0x81, 0x02,
+    0x82, 0x0D, 0x09, 0x6E, 0x60, 0x6B, 0x4C, 0x08, 0x03, 0x6D, 0x05, 0x03, 0x08, 0x81, 0x05, 0x86,
+    0x03, 0x80, 0x01, 0x84, 0x03, 0x80, 0x05, 0x83, 0x03, 0x81, 0x01, 0x83, 0x03, 0x86, 0x01, 0x83,
+    0x03, 0x8A, 0x01, 0x80, 0x01, 0x84, 0x03, 0x81, 0x01, 0x81, 0x03, 0x82, 0x01, 0x80, 0x03, 0x89,
+    0x01, 0x80, 0x05, 0x84, 0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x01, 0x82, 0x04, 0x01, 0x01, 0x04,
+    0x81, 0x01, 0x82, 0x04, 0x86, 0x05, 0x1A, 0x06, 0x05, 0x05, 0x04, 0x03, 0x06, 0x05, 0x04, 0x2B,
+    0x37, 0x24, 0x03, 0x02, 0x02, 0x29, 0x36, 0x1A, 0x12, 0x0E, 0x0F, 0x13, 0x23, 0x23, 0x18, 0x07,
+    0x07, 0x27, 0x82, 0x71, 0x81, 0x27, 0x07, 0x71, 0x18, 0x18, 0x28, 0x71, 0x18, 0x39, 0x79, 0x84,
+    0x15, 0x84, 0x52, 0x80, 0x15, 0x82, 0x52, 0x84, 0x15, 0x81, 0x6A, 0x05, 0x4F, 0x7A, 0x7A, 0x3A,
+    0x3A, 0x40, 0x83, 0x7D, 0x82, 0x40, 0x81, 0x3A, 0x81, 0x7A, 0x83, 0x4F, 0x81, 0x70, 0x81, 0x6A,
+    0x24, 0x67, 0x74, 0x18, 0x41, 0x10, 0x18, 0x0F, 0x1D, 0x23, 0x18, 0x13, 0x65, 0x79, 0x70, 0x47,
+    0x37, 0x46, 0x43, 0x12, 0x36, 0x49, 0x50, 0x68, 0x50, 0x53, 0x58, 0x3C, 0x54, 0x3C, 0x57, 0x54,
+    0x5D, 0x68, 0x68, 0x02, 0x02, 0x80, 0x82, 0x05, 0x08, 0x02, 0x00, 0x6E, 0x0D, 0x5C, 0x08, 0x60,
+    0x73, 0x05, 0x8D, 0x03, 0x80, 0x01, 0x8E, 0x03, 0x87, 0x01, 0x81, 0x03, 0x8B, 0x01, 0x85, 0x03,
+    0x81, 0x01, 0x80, 0x03, 0x8E, 0x01, 0x82, 0x05, 0x81, 0x03, 0x82, 0x05, 0x83, 0x01, 0x83, 0x04,
+    0x82, 0x01, 0x82, 0x04, 0x83, 0x05, 0x85, 0x06, 0x25, 0x09, 0x05, 0x04, 0x05, 0x03, 0x25, 0x44,
+    0x14, 0x01, 0x01, 0x14, 0x2D, 0x33, 0x1A, 0x17, 0x0E, 0x0E, 0x13, 0x0F, 0x0F, 0x23, 0x07, 0x07,
+    0x39, 0x71, 0x71, 0x28, 0x71, 0x27, 0x07, 0x28, 0x23, 0x18, 0x71, 0x18, 0x27, 0x28, 0x30, 0x83,
+    0x15, 0x84, 0x52, 0x80, 0x6A, 0x89, 0x52, 0x80, 0x6A, 0x81, 0x70, 0x81, 0x4F, 0x82, 0x3A, 0x83,
+    0x40, 0x82, 0x3A, 0x80, 0x7A, 0x82, 0x4F, 0x81, 0x70, 0x37, 0x6A, 0x52, 0x52, 0x63, 0x2F, 0x18,
+    0x41, 0x18, 0x18, 0x13, 0x79, 0x0F, 0x13, 0x0F, 0x0E, 0x55, 0x59, 0x47, 0x25, 0x18, 0x18, 0x38,
+    0x51, 0x3D, 0x5C, 0x5C, 0x68, 0x50, 0x53, 0x58, 0x49, 0x5C, 0x24, 0x2C, 0x54, 0x68, 0x68, 0x5D,
+    0x0D, 0x05, 0x04, 0x0D, 0x0D, 0x01, 0x01, 0x0D, 0x03, 0x0D, 0x0D, 0x49, 0x58, 0x68, 0x0B, 0x09,
+    0x0D, 0x03, 0x81, 0x01, 0x88, 0x03, 0x04, 0x01, 0x03, 0x6D, 0x03, 0x6D, 0x8B, 0x03, 0x82, 0x01,
+    0x81, 0x03, 0x87, 0x01, 0x80, 0x04, 0x86, 0x01, 0x89, 0x03, 0x8D, 0x01, 0x87, 0x05, 0x80, 0x04,
+    0x83, 0x01, 0x82, 0x04, 0x81, 0x01, 0x84, 0x04, 0x81, 0x05, 0x86, 0x06, 0x16, 0x03, 0x05, 0x05,
+    0x06, 0x0D, 0x29, 0x3D, 0x04, 0x04, 0x0A, 0x2A, 0x29, 0x2A, 0x6C, 0x17, 0x1D, 0x0E, 0x0E, 0x0F,
+    0x13, 0x23, 0x39, 0x07, 0x81, 0x71, 0x82, 0x28, 0x81, 0x71, 0x09, 0x28, 0x18, 0x13, 0x71, 0x28,
+    0x71, 0x27, 0x10, 0x30, 0x11, 0x83, 0x15, 0x89, 0x52, 0x82, 0x6A, 0x81, 0x52, 0x83, 0x6A, 0x80,
+    0x4F, 0x81, 0x7A, 0x85, 0x3A, 0x3D, 0x7A, 0x4F, 0x4F, 0x70, 0x70, 0x62, 0x62, 0x67, 0x67, 0x63,
+    0x63, 0x12, 0x18, 0x0E, 0x13, 0x18, 0x38, 0x46, 0x0F, 0x0E, 0x74, 0x65, 0x6C, 0x62, 0x67, 0x6C,
+    0x0F, 0x23, 0x79, 0x1A, 0x3D, 0x5C, 0x5C, 0x53, 0x50, 0x53, 0x58, 0x49, 0x54, 0x2C, 0x34, 0x24,
+    0x6E, 0x68, 0x53, 0x4C, 0x05, 0x02, 0x6D, 0x0D, 0x05, 0x03, 0x05, 0x02, 0x01, 0x4C, 0x58, 0x3C,
+    0x14, 0x6D, 0x06, 0x53, 0x81, 0x6D, 0x87, 0x03, 0x02, 0x01, 0x6D, 0x05, 0x99, 0x03, 0x82, 0x01,
+    0x80, 0x04, 0x83, 0x01, 0x80, 0x04, 0x81, 0x01, 0x89, 0x03, 0x95, 0x01, 0x80, 0x04, 0x83, 0x01,
+    0x82, 0x04, 0x81, 0x01, 0x82, 0x04, 0x02, 0x01, 0x05, 0x06, 0x81, 0x05, 0x85, 0x06, 0x11, 0x03,
+    0x06, 0x05, 0x22, 0x14, 0x56, 0x2B, 0x06, 0x04, 0x0A, 0x2C, 0x36, 0x42, 0x17, 0x1A, 0x12, 0x1D,
+    0x0E, 0x82, 0x13, 0x01, 0x39, 0x07, 0x81, 0x71, 0x82, 0x28, 0x81, 0x71, 0x0A, 0x28, 0x18, 0x41,
+    0x0F, 0x71, 0x28, 0x71, 0x27, 0x10, 0x30, 0x11, 0x82, 0x15, 0x81, 0x52, 0x80, 0x15, 0x86, 0x52,
+    0x89, 0x6A, 0x81, 0x4F, 0x80, 0x7A, 0x83, 0x3A, 0x05, 0x7A, 0x4F, 0x70, 0x70, 0x62, 0x52, 0x82,
+    0x67, 0x81, 0x63, 0x02, 0x11, 0x17, 0x18, 0x82, 0x13, 0x21, 0x51, 0x74, 0x0E, 0x74, 0x65, 0x10,
+    0x25, 0x62, 0x38, 0x1D, 0x0F, 0x39, 0x12, 0x1A, 0x25, 0x49, 0x50, 0x53, 0x50, 0x50, 0x19, 0x58,
+    0x54, 0x24, 0x34, 0x57, 0x6E, 0x5D, 0x50, 0x4C, 0x53, 0x04, 0x05, 0x03, 0x83, 0x05, 0x09, 0x04,
+    0x02, 0x6D, 0x14, 0x3C, 0x19, 0x02, 0x0D, 0x03, 0x6E, 0x82, 0x4C, 0x81, 0x6D, 0x05, 0x03, 0x05,
+    0x0D, 0x03, 0x03, 0x05, 0x9A, 0x03, 0x89, 0x01, 0x89, 0x03, 0x95, 0x01, 0x80, 0x04, 0x82, 0x01,
+    0x81, 0x04, 0x82, 0x01, 0x82, 0x04, 0x02, 0x01, 0x04, 0x05, 0x86, 0x06, 0x19, 0x05, 0x53, 0x4C,
+    0x05, 0x80, 0x4B, 0x2C, 0x56, 0x31, 0x05, 0x05, 0x0A, 0x33, 0x33, 0x14, 0x1A, 0x1A, 0x12, 0x1D,
+    0x0E, 0x13, 0x0E, 0x13, 0x28, 0x07, 0x71, 0x86, 0x28, 0x0A, 0x71, 0x41, 0x13, 0x13, 0x71, 0x28,
+    0x71, 0x07, 0x17, 0x35, 0x11, 0x83, 0x15, 0x84, 0x52, 0x8D, 0x6A, 0x07, 0x70, 0x4F, 0x4F, 0x7A,
+    0x7A, 0x4F, 0x4F, 0x70, 0x81, 0x62, 0x83, 0x67, 0x03, 0x63, 0x67, 0x67, 0x11, 0x82, 0x0E, 0x32,
+    0x13, 0x0E, 0x65, 0x12, 0x1D, 0x65, 0x0F, 0x56, 0x3C, 0x59, 0x46, 0x13, 0x18, 0x18, 0x0E, 0x1A,
+    0x33, 0x6E, 0x50, 0x68, 0x3F, 0x50, 0x19, 0x58, 0x5C, 0x3C, 0x34, 0x2C, 0x49, 0x68, 0x53, 0x4C,
+    0x4C, 0x05, 0x01, 0x05, 0x05, 0x04, 0x04, 0x05, 0x05, 0x02, 0x02, 0x03, 0x14, 0x49, 0x49, 0x58,
+    0x02, 0x00, 0x0D, 0x81, 0x4C, 0x82, 0x6D, 0x03, 0x03, 0x0D, 0x6D, 0x03, 0x81, 0x0D, 0x9B, 0x03,
+    0x87, 0x01, 0x89, 0x03, 0x99, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81, 0x04, 0x82, 0x05, 0x01, 0x04,
+    0x05, 0x82, 0x06, 0x81, 0x05, 0x81, 0x06, 0x84, 0x05, 0x14, 0x06, 0x25, 0x44, 0x3F, 0x01, 0x03,
+    0x0A, 0x33, 0x31, 0x14, 0x2F, 0x1A, 0x12, 0x1D, 0x0E, 0x13, 0x0E, 0x13, 0x28, 0x07, 0x71, 0x86,
+    0x28, 0x05, 0x71, 0x18, 0x41, 0x0E, 0x41, 0x27, 0x82, 0x18, 0x80, 0x30, 0x82, 0x11, 0x84, 0x15,
+    0x83, 0x52, 0x84, 0x6A, 0x80, 0x62, 0x87, 0x6A, 0x04, 0x70, 0x4F, 0x70, 0x70, 0x6A, 0x84, 0x67,
+    0x82, 0x63, 0x81, 0x67, 0x24, 0x30, 0x18, 0x0E, 0x0F, 0x0F, 0x0E, 0x17, 0x74, 0x17, 0x65, 0x37,
+    0x25, 0x25, 0x41, 0x0E, 0x28, 0x10, 0x18, 0x13, 0x37, 0x33, 0x58, 0x7B, 0x68, 0x02, 0x6E, 0x58,
+    0x58, 0x50, 0x3C, 0x34, 0x34, 0x57, 0x58, 0x4C, 0x50, 0x4C, 0x85, 0x05, 0x0B, 0x02, 0x04, 0x05,
+    0x0D, 0x76, 0x05, 0x14, 0x2A, 0x31, 0x58, 0x1F, 0x5C, 0x81, 0x0D, 0x81, 0x05, 0x82, 0x03, 0x04,
+    0x6D, 0x01, 0x4C, 0x6D, 0x01, 0x97, 0x03, 0x82, 0x01, 0x80, 0x03, 0x86, 0x01, 0x85, 0x03, 0x81,
+    0x01, 0x81, 0x03, 0x92, 0x01, 0x82, 0x04, 0x83, 0x01, 0x81, 0x04, 0x01, 0x01, 0x03, 0x81, 0x04,
+    0x82, 0x05, 0x01, 0x04, 0x05, 0x81, 0x06, 0x82, 0x05, 0x81, 0x06, 0x81, 0x53, 0x1A, 0x06, 0x03,
+    0x04, 0x02, 0x44, 0x44, 0x02, 0x01, 0x03, 0x7E, 0x25, 0x58, 0x14, 0x2F, 0x1A, 0x12, 0x1D, 0x0E,
+    0x13, 0x0E, 0x13, 0x28, 0x07, 0x71, 0x28, 0x28, 0x18, 0x83, 0x28, 0x09, 0x71, 0x18, 0x0E, 0x13,
+    0x13, 0x18, 0x71, 0x18, 0x18, 0x30, 0x84, 0x11, 0x83, 0x15, 0x83, 0x52, 0x81, 0x6A, 0x80, 0x52,
+    0x84, 0x62, 0x04, 0x70, 0x62, 0x6A, 0x52, 0x67, 0x82, 0x62, 0x83, 0x67, 0x84, 0x63, 0x28, 0x67,
+    0x63, 0x67, 0x30, 0x18, 0x13, 0x0E, 0x74, 0x1D, 0x12, 0x0E, 0x37, 0x0E, 0x59, 0x72, 0x46, 0x46,
+    0x13, 0x10, 0x23, 0x28, 0x10, 0x46, 0x33, 0x50, 0x53, 0x7B, 0x5C, 0x5C, 0x49, 0x49, 0x54, 0x3C,
+    0x72, 0x2B, 0x2A, 0x19, 0x0D, 0x02, 0x4C, 0x53, 0x85, 0x05, 0x81, 0x01, 0x81, 0x05, 0x14, 0x04,
+    0x01, 0x3F, 0x2A, 0x2A, 0x14, 0x3F, 0x02, 0x0D, 0x08, 0x0D, 0x03, 0x03, 0x08, 0x03, 0x01, 0x5D,
+    0x73, 0x01, 0x03, 0x01, 0x93, 0x03, 0x84, 0x01, 0x81, 0x03, 0x84, 0x01, 0x80, 0x04, 0x83, 0x03,
+    0x83, 0x01, 0x81, 0x03, 0x90, 0x01, 0x81, 0x04, 0x80, 0x01, 0x81, 0x05, 0x85, 0x01, 0x81, 0x03,
+    0x80, 0x01, 0x81, 0x04, 0x85, 0x05, 0x01, 0x06, 0x22, 0x82, 0x06, 0x81, 0x05, 0x17, 0x53, 0x0D,
+    0x06, 0x14, 0x37, 0x2E, 0x0D, 0x01, 0x0A, 0x20, 0x36, 0x3F, 0x1F, 0x29, 0x1A, 0x1D, 0x17, 0x1D,
+    0x0E, 0x13, 0x23, 0x28, 0x07, 0x71, 0x81, 0x18, 0x81, 0x28, 0x83, 0x18, 0x08, 0x71, 0x41, 0x0E,
+    0x0E, 0x18, 0x28, 0x18, 0x18, 0x79, 0x86, 0x11, 0x83, 0x15, 0x83, 0x52, 0x87, 0x62, 0x80, 0x6A,
+    0x82, 0x62, 0x82, 0x67, 0x82, 0x63, 0x02, 0x11, 0x63, 0x67, 0x81, 0x63, 0x82, 0x67, 0x01, 0x38,
+    0x0F, 0x82, 0x0E, 0x36, 0x17, 0x12, 0x1D, 0x0E, 0x37, 0x72, 0x2D, 0x41, 0x1D, 0x18, 0x23, 0x10,
+    0x10, 0x23, 0x37, 0x33, 0x3C, 0x50, 0x50, 0x3F, 0x50, 0x58, 0x3C, 0x6E, 0x3C, 0x34, 0x5A, 0x2C,
+    0x2C, 0x5C, 0x03, 0x50, 0x7B, 0x06, 0x03, 0x03, 0x0A, 0x05, 0x0D, 0x0D, 0x05, 0x01, 0x05, 0x04,
+    0x04, 0x02, 0x20, 0x19, 0x5F, 0x31, 0x14, 0x58, 0x0D, 0x03, 0x0D, 0x82, 0x03, 0x04, 0x0D, 0x4C,
+    0x03, 0x05, 0x01, 0x91, 0x03, 0x88, 0x01, 0x81, 0x03, 0x84, 0x01, 0x83, 0x03, 0x83, 0x01, 0x81,
+    0x03, 0x91, 0x01, 0x01, 0x04, 0x01, 0x81, 0x05, 0x85, 0x01, 0x81, 0x03, 0x82, 0x04, 0x88, 0x05,
+    0x81, 0x06, 0x82, 0x05, 0x12, 0x04, 0x22, 0x2B, 0x37, 0x2B, 0x04, 0x5E, 0x64, 0x20, 0x25, 0x00,
+    0x1F, 0x29, 0x1A, 0x6C, 0x1D, 0x1D, 0x0E, 0x13, 0x81, 0x23, 0x81, 0x71, 0x81, 0x18, 0x81, 0x28,
+    0x82, 0x18, 0x81, 0x71, 0x03, 0x18, 0x1D, 0x0E, 0x13, 0x82, 0x18, 0x80, 0x38, 0x8A, 0x11, 0x81,
+    0x15, 0x81, 0x52, 0x88, 0x62, 0x82, 0x67, 0x81, 0x63, 0x82, 0x36, 0x03, 0x11, 0x15, 0x15, 0x63,
+    0x84, 0x67, 0x2D, 0x38, 0x0E, 0x1D, 0x0F, 0x12, 0x17, 0x17, 0x12, 0x12, 0x36, 0x59, 0x55, 0x1D,
+    0x18, 0x18, 0x23, 0x23, 0x18, 0x10, 0x1A, 0x34, 0x24, 0x53, 0x53, 0x3F, 0x5C, 0x58, 0x3C, 0x50,
+    0x24, 0x34, 0x2E, 0x2C, 0x2B, 0x19, 0x0D, 0x50, 0x53, 0x09, 0x05, 0x06, 0x09, 0x04, 0x05, 0x6D,
+    0x01, 0x81, 0x0D, 0x82, 0x05, 0x81, 0x02, 0x0B, 0x1F, 0x2A, 0x48, 0x31, 0x58, 0x05, 0x06, 0x02,
+    0x08, 0x01, 0x03, 0x4C, 0x9F, 0x03, 0x84, 0x01, 0x82, 0x03, 0x84, 0x01, 0x81, 0x03, 0x87, 0x01,
+    0x80, 0x03, 0x94, 0x01, 0x8B, 0x05, 0x80, 0x06, 0x83, 0x05, 0x16, 0x04, 0x02, 0x29, 0x37, 0x57,
+    0x7F, 0x22, 0x64, 0x14, 0x34, 0x01, 0x1F, 0x3D, 0x12, 0x17, 0x1D, 0x0E, 0x0E, 0x13, 0x23, 0x13,
+    0x28, 0x71, 0x81, 0x18, 0x81, 0x28, 0x82, 0x18, 0x81, 0x71, 0x07, 0x18, 0x0E, 0x1D, 0x0E, 0x18,
+    0x13, 0x18, 0x46, 0x82, 0x11, 0x80, 0x15, 0x85, 0x11, 0x80, 0x35, 0x82, 0x11, 0x80, 0x15, 0x87,
+    0x67, 0x06, 0x63, 0x72, 0x25, 0x36, 0x32, 0x0C, 0x35, 0x82, 0x11, 0x12, 0x63, 0x67, 0x67, 0x63,
+    0x67, 0x67, 0x62, 0x70, 0x51, 0x74, 0x0E, 0x12, 0x12, 0x1A, 0x12, 0x0E, 0x29, 0x36, 0x12, 0x82,
+    0x10, 0x21, 0x18, 0x23, 0x10, 0x18, 0x28, 0x2F, 0x34, 0x2C, 0x53, 0x53, 0x5C, 0x5C, 0x58, 0x3C,
+    0x6E, 0x3C, 0x34, 0x2E, 0x2C, 0x2B, 0x31, 0x5C, 0x50, 0x50, 0x68, 0x53, 0x04, 0x53, 0x09, 0x03,
+    0x04, 0x6D, 0x03, 0x08, 0x81, 0x03, 0x83, 0x01, 0x05, 0x02, 0x19, 0x2C, 0x57, 0x49, 0x0D, 0x82,
+    0x03, 0x01, 0x6D, 0x4C, 0x81, 0x08, 0x9E, 0x03, 0x83, 0x01, 0x81, 0x03, 0x8F, 0x01, 0x80, 0x03,
+    0x90, 0x01, 0x81, 0x04, 0x81, 0x01, 0x84, 0x05, 0x80, 0x04, 0x84, 0x05, 0x81, 0x06, 0x83, 0x05,
+    0x19, 0x22, 0x2A, 0x37, 0x44, 0x19, 0x06, 0x6D, 0x1E, 0x31, 0x24, 0x02, 0x14, 0x3D, 0x17, 0x17,
+    0x1D, 0x0E, 0x0E, 0x13, 0x23, 0x13, 0x28, 0x71, 0x18, 0x18, 0x28, 0x83, 0x18, 0x09, 0x71, 0x27,
+    0x71, 0x0F, 0x46, 0x0E, 0x0E, 0x13, 0x13, 0x17, 0x8A, 0x11, 0x03, 0x35, 0x0C, 0x0C, 0x35, 0x84,
+    0x36, 0x83, 0x35, 0x80, 0x0C, 0x83, 0x35, 0x82, 0x11, 0x80, 0x15, 0x81, 0x63, 0x82, 0x67, 0x2F,
+    0x62, 0x66, 0x4F, 0x1A, 0x12, 0x0E, 0x1D, 0x0E, 0x51, 0x12, 0x2F, 0x36, 0x2F, 0x0F, 0x13, 0x10,
+    0x18, 0x23, 0x10, 0x10, 0x18, 0x71, 0x29, 0x72, 0x34, 0x50, 0x50, 0x5C, 0x50, 0x49, 0x3C, 0x54,
+    0x54, 0x72, 0x33, 0x2C, 0x34, 0x2A, 0x58, 0x50, 0x02, 0x50, 0x68, 0x7B, 0x02, 0x03, 0x09, 0x01,
+    0x83, 0x03, 0x0C, 0x05, 0x01, 0x01, 0x05, 0x01, 0x01, 0x02, 0x3F, 0x48, 0x2B, 0x14, 0x03, 0x7F,
+    0x81, 0x6E, 0x81, 0x0D, 0x95, 0x03, 0x83, 0x01, 0x85, 0x03, 0x83, 0x01, 0x81, 0x03, 0x8F, 0x01,
+    0x80, 0x03, 0x8F, 0x01, 0x84, 0x04, 0x81, 0x05, 0x80, 0x01, 0x82, 0x04, 0x81, 0x05, 0x85, 0x06,
+    0x81, 0x53, 0x17, 0x05, 0x01, 0x3D, 0x56, 0x29, 0x02, 0x04, 0x03, 0x1E, 0x2A, 0x49, 0x80, 0x19,
+    0x32, 0x17, 0x17, 0x1D, 0x0E, 0x0E, 0x13, 0x18, 0x13, 0x18, 0x71, 0x86, 0x18, 0x81, 0x71, 0x81,
+    0x18, 0x06, 0x0E, 0x12, 0x12, 0x13, 0x0E, 0x0E, 0x30, 0x8B, 0x11, 0x81, 0x35, 0x82, 0x2D, 0x82,
+    0x0C, 0x82, 0x2D, 0x80, 0x0C, 0x82, 0x35, 0x84, 0x11, 0x81, 0x15, 0x35, 0x67, 0x52, 0x67, 0x4F,
+    0x40, 0x4F, 0x17, 0x12, 0x1D, 0x0E, 0x17, 0x37, 0x2F, 0x32, 0x0C, 0x0E, 0x74, 0x10, 0x18, 0x18,
+    0x10, 0x18, 0x10, 0x10, 0x13, 0x33, 0x59, 0x24, 0x0D, 0x50, 0x50, 0x5C, 0x19, 0x3C, 0x54, 0x3C,
+    0x33, 0x33, 0x34, 0x2B, 0x48, 0x19, 0x0D, 0x05, 0x5C, 0x53, 0x68, 0x53, 0x05, 0x06, 0x09, 0x03,
+    0x22, 0x01, 0x84, 0x03, 0x81, 0x08, 0x07, 0x04, 0x80, 0x00, 0x48, 0x2E, 0x1F, 0x02, 0x04, 0x81,
+    0x0D, 0x82, 0x03, 0x81, 0x08, 0x91, 0x03, 0x84, 0x01, 0x85, 0x03, 0x82, 0x01, 0x81, 0x03, 0x8F,
+    0x01, 0x80, 0x03, 0x8F, 0x01, 0x8B, 0x04, 0x80, 0x05, 0x87, 0x06, 0x16, 0x0A, 0x49, 0x44, 0x45,
+    0x3D, 0x04, 0x04, 0x16, 0x16, 0x34, 0x3C, 0x3F, 0x42, 0x29, 0x17, 0x12, 0x1D, 0x0E, 0x0E, 0x13,
+    0x18, 0x13, 0x23, 0x87, 0x18, 0x81, 0x28, 0x81, 0x18, 0x01, 0x13, 0x46, 0x82, 0x0E, 0x01, 0x0F,
+    0x30, 0x8C, 0x11, 0x01, 0x59, 0x0C, 0x86, 0x2D, 0x80, 0x0C, 0x83, 0x35, 0x81, 0x11, 0x83, 0x15,
+    0x31, 0x63, 0x67, 0x62, 0x70, 0x4A, 0x40, 0x70, 0x12, 0x12, 0x1D, 0x0E, 0x46, 0x37, 0x2D, 0x32,
+    0x17, 0x12, 0x65, 0x10, 0x0F, 0x18, 0x23, 0x10, 0x23, 0x18, 0x12, 0x63, 0x51, 0x31, 0x49, 0x53,
+    0x50, 0x49, 0x2A, 0x54, 0x54, 0x3C, 0x36, 0x25, 0x34, 0x33, 0x2B, 0x2A, 0x5C, 0x05, 0x5C, 0x02,
+    0x53, 0x68, 0x7B, 0x82, 0x05, 0x85, 0x03, 0x81, 0x05, 0x0E, 0x08, 0x03, 0x05, 0x02, 0x01, 0x48,
+    0x3D, 0x42, 0x1C, 0x03, 0x04, 0x05, 0x03, 0x03, 0x01, 0x98, 0x03, 0x83, 0x01, 0x80, 0x03, 0x82,
+    0x01, 0x81, 0x03, 0x85, 0x01, 0x87, 0x05, 0x81, 0x01, 0x82, 0x03, 0x80, 0x01, 0x81, 0x03, 0x85,
+    0x01, 0x81, 0x05, 0x83, 0x01, 0x81, 0x04, 0x81, 0x05, 0x85, 0x04, 0x81, 0x05, 0x83, 0x06, 0x81,
+    0x22, 0x81, 0x06, 0x10, 0x05, 0x34, 0x3D, 0x56, 0x2E, 0x7E, 0x03, 0x16, 0x06, 0x33, 0x49, 0x3F,
+    0x42, 0x29, 0x17, 0x12, 0x1D, 0x82, 0x0E, 0x01, 0x10, 0x13, 0x81, 0x23, 0x86, 0x18, 0x80, 0x71,
+    0x82, 0x18, 0x06, 0x0F, 0x17, 0x12, 0x0E, 0x0E, 0x13, 0x43, 0x8C, 0x11, 0x03, 0x30, 0x79, 0x38,
+    0x46, 0x81, 0x0E, 0x85, 0x41, 0x80, 0x46, 0x81, 0x38, 0x81, 0x30, 0x82, 0x11, 0x33, 0x15, 0x67,
+    0x70, 0x40, 0x7D, 0x40, 0x6A, 0x0E, 0x1A, 0x17, 0x0E, 0x12, 0x2D, 0x29, 0x2F, 0x0E, 0x12, 0x0F,
+    0x0F, 0x18, 0x55, 0x18, 0x10, 0x18, 0x18, 0x59, 0x25, 0x37, 0x19, 0x19, 0x53, 0x5C, 0x19, 0x57,
+    0x54, 0x5D, 0x3C, 0x3D, 0x25, 0x33, 0x33, 0x2B, 0x34, 0x19, 0x02, 0x5C, 0x5C, 0x0D, 0x7B, 0x09,
+    0x4C, 0x53, 0x83, 0x05, 0x81, 0x03, 0x80, 0x01, 0x82, 0x04, 0x01, 0x0D, 0x03, 0x82, 0x04, 0x09,
+    0x57, 0x3D, 0x2A, 0x20, 0x04, 0x0D, 0x0D, 0x03, 0x03, 0x6D, 0x96, 0x03, 0x84, 0x01, 0x81, 0x03,
+    0x81, 0x01, 0x81, 0x03, 0x82, 0x01, 0x80, 0x03, 0x81, 0x01, 0x87, 0x05, 0x01, 0x03, 0x01, 0x85,
+    0x03, 0x85, 0x01, 0x01, 0x05, 0x03, 0x83, 0x01, 0x80, 0x04, 0x82, 0x05, 0x85, 0x04, 0x80, 0x05,
+    0x82, 0x06, 0x82, 0x22, 0x82, 0x06, 0x0D, 0x02, 0x32, 0x34, 0x44, 0x57, 0x01, 0x73, 0x06, 0x05,
+    0x25, 0x49, 0x02, 0x42, 0x45, 0x82, 0x17, 0x82, 0x0E, 0x80, 0x10, 0x81, 0x13, 0x87, 0x18, 0x80,
+    0x71, 0x82, 0x18, 0x81, 0x0E, 0x04, 0x17, 0x1D, 0x0E, 0x18, 0x38, 0x87, 0x11, 0x04, 0x30, 0x79,
+    0x38, 0x46, 0x41, 0x8D, 0x26, 0x01, 0x21, 0x78, 0x82, 0x7A, 0x81, 0x78, 0x01, 0x6A, 0x4F, 0x82,
+    0x40, 0x2F, 0x52, 0x12, 0x17, 0x17, 0x12, 0x38, 0x56, 0x56, 0x46, 0x1A, 0x65, 0x0F, 0x18, 0x23,
+    0x10, 0x18, 0x10, 0x18, 0x41, 0x72, 0x44, 0x2D, 0x49, 0x3C, 0x53, 0x58, 0x49, 0x2C, 0x54, 0x54,
+    0x24, 0x59, 0x36, 0x2E, 0x33, 0x2B, 0x2B, 0x31, 0x5C, 0x5C, 0x1F, 0x0D, 0x68, 0x53, 0x53, 0x5D,
+    0x0B, 0x0A, 0x81, 0x05, 0x82, 0x03, 0x81, 0x05, 0x0F, 0x22, 0x01, 0x02, 0x01, 0x0D, 0x08, 0x00,
+    0x48, 0x29, 0x2A, 0x7C, 0x0D, 0x0D, 0x03, 0x03, 0x0D, 0x95, 0x03, 0x85, 0x01, 0x81, 0x03, 0x81,
+    0x01, 0x82, 0x03, 0x83, 0x01, 0x81, 0x03, 0x85, 0x05, 0x01, 0x03, 0x05, 0x86, 0x03, 0x8B, 0x01,
+    0x80, 0x03, 0x82, 0x05, 0x85, 0x04, 0x81, 0x05, 0x21, 0x0A, 0x06, 0x06, 0x0A, 0x6D, 0x05, 0x6D,
+    0x16, 0x34, 0x33, 0x2A, 0x37, 0x49, 0x4B, 0x0A, 0x16, 0x08, 0x59, 0x19, 0x08, 0x57, 0x2F, 0x37,
+    0x1D, 0x1D, 0x0E, 0x13, 0x13, 0x10, 0x23, 0x13, 0x0F, 0x18, 0x10, 0x84, 0x18, 0x80, 0x71, 0x82,
+    0x18, 0x81, 0x0E, 0x04, 0x13, 0x0E, 0x0E, 0x13, 0x17, 0x84, 0x11, 0x02, 0x79, 0x21, 0x41, 0x8B,
+    0x26, 0x06, 0x41, 0x26, 0x26, 0x21, 0x21, 0x26, 0x41, 0x82, 0x21, 0x80, 0x77, 0x82, 0x7A, 0x36,
+    0x7D, 0x7A, 0x7A, 0x4F, 0x3A, 0x15, 0x17, 0x2F, 0x1A, 0x6C, 0x1A, 0x0E, 0x2D, 0x46, 0x0E, 0x13,
+    0x0F, 0x13, 0x18, 0x10, 0x0F, 0x23, 0x10, 0x43, 0x25, 0x1A, 0x59, 0x49, 0x58, 0x50, 0x3F, 0x49,
+    0x2C, 0x54, 0x60, 0x33, 0x59, 0x59, 0x25, 0x33, 0x2B, 0x33, 0x48, 0x14, 0x58, 0x3F, 0x42, 0x09,
+    0x6E, 0x53, 0x06, 0x4C, 0x3B, 0x73, 0x06, 0x82, 0x05, 0x82, 0x03, 0x0D, 0x01, 0x04, 0x05, 0x03,
+    0x03, 0x05, 0x01, 0x57, 0x29, 0x31, 0x00, 0x01, 0x05, 0x08, 0x92, 0x03, 0x81, 0x01, 0x81, 0x03,
+    0x83, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x85, 0x05, 0x01, 0x03,
+    0x05, 0x86, 0x03, 0x8B, 0x01, 0x83, 0x05, 0x82, 0x04, 0x84, 0x05, 0x27, 0x22, 0x53, 0x06, 0x06,
+    0x0A, 0x53, 0x05, 0x08, 0x3D, 0x49, 0x34, 0x56, 0x58, 0x22, 0x0A, 0x64, 0x20, 0x59, 0x58, 0x02,
+    0x48, 0x2F, 0x1A, 0x1D, 0x1D, 0x0E, 0x13, 0x13, 0x23, 0x23, 0x13, 0x0F, 0x18, 0x18, 0x23, 0x18,
+    0x0F, 0x13, 0x18, 0x71, 0x82, 0x18, 0x0B, 0x0E, 0x12, 0x0E, 0x0E, 0x12, 0x18, 0x0E, 0x11, 0x15,
+    0x11, 0x79, 0x41, 0x90, 0x26, 0x02, 0x41, 0x26, 0x41, 0x82, 0x26, 0x81, 0x41, 0x27, 0x26, 0x07,
+    0x41, 0x41, 0x46, 0x77, 0x77, 0x78, 0x78, 0x79, 0x55, 0x17, 0x1A, 0x1A, 0x12, 0x74, 0x0C, 0x17,
+    0x46, 0x0E, 0x10, 0x0F, 0x10, 0x13, 0x18, 0x13, 0x0F, 0x36, 0x43, 0x59, 0x33, 0x24, 0x49, 0x50,
+    0x02, 0x2A, 0x24, 0x60, 0x54, 0x33, 0x82, 0x59, 0x80, 0x33, 0x82, 0x2B, 0x0E, 0x2A, 0x19, 0x5C,
+    0x5F, 0x3F, 0x4C, 0x53, 0x05, 0x53, 0x06, 0x09, 0x73, 0x09, 0x09, 0x53, 0x86, 0x05, 0x81, 0x03,
+    0x06, 0x05, 0x00, 0x2E, 0x3D, 0x1F, 0x0D, 0x08, 0x99, 0x03, 0x80, 0x01, 0x84, 0x03, 0x81, 0x01,
+    0x88, 0x03, 0x85, 0x05, 0x80, 0x03, 0x81, 0x05, 0x87, 0x03, 0x89, 0x01, 0x80, 0x04, 0x82, 0x05,
+    0x81, 0x04, 0x81, 0x05, 0x80, 0x06, 0x82, 0x05, 0x01, 0x06, 0x05, 0x83, 0x06, 0x18, 0x22, 0x2A,
+    0x2E, 0x08, 0x3D, 0x29, 0x06, 0x22, 0x0A, 0x16, 0x49, 0x3D, 0x0D, 0x1F, 0x2B, 0x2F, 0x17, 0x1D,
+    0x0E, 0x0E, 0x13, 0x13, 0x23, 0x10, 0x13, 0x82, 0x0F, 0x05, 0x18, 0x0F, 0x13, 0x13, 0x18, 0x71,
+    0x82, 0x18, 0x0C, 0x0E, 0x17, 0x0E, 0x0E, 0x1D, 0x18, 0x0E, 0x79, 0x79, 0x41, 0x28, 0x26, 0x41,
+    0x91, 0x26, 0x82, 0x41, 0x01, 0x28, 0x41, 0x81, 0x26, 0x81, 0x41, 0x81, 0x46, 0x82, 0x41, 0x81,
+    0x21, 0x80, 0x46, 0x82, 0x0E, 0x2F, 0x12, 0x1A, 0x30, 0x12, 0x17, 0x0F, 0x55, 0x17, 0x18, 0x10,
+    0x13, 0x10, 0x59, 0x2F, 0x38, 0x36, 0x57, 0x2C, 0x58, 0x02, 0x05, 0x48, 0x62, 0x47, 0x54, 0x25,
+    0x2D, 0x29, 0x29, 0x33, 0x2B, 0x2B, 0x2E, 0x2B, 0x19, 0x58, 0x1F, 0x5F, 0x0D, 0x03, 0x53, 0x09,
+    0x53, 0x09, 0x73, 0x73, 0x09, 0x06, 0x83, 0x09, 0x82, 0x06, 0x81, 0x05, 0x07, 0x03, 0x0A, 0x5C,
+    0x3D, 0x2E, 0x0D, 0x0D, 0x08, 0x9E, 0x03, 0x81, 0x01, 0x87, 0x03, 0x92, 0x05, 0x80, 0x03, 0x86,
+    0x01, 0x81, 0x04, 0x81, 0x05, 0x82, 0x04, 0x81, 0x05, 0x83, 0x06, 0x80, 0x53, 0x82, 0x06, 0x1B,
+    0x53, 0x06, 0x01, 0x2E, 0x49, 0x14, 0x29, 0x3D, 0x1E, 0x0A, 0x0A, 0x16, 0x31, 0x2E, 0x6D, 0x1F,
+    0x2E, 0x17, 0x6C, 0x0E, 0x0E, 0x0F, 0x13, 0x13, 0x0F, 0x10, 0x23, 0x0F, 0x81, 0x13, 0x81, 0x0F,
+    0x81, 0x13, 0x84, 0x18, 0x0A, 0x0E, 0x46, 0x0E, 0x18, 0x0E, 0x0E, 0x13, 0x41, 0x26, 0x26, 0x41,
+    0x81, 0x21, 0x83, 0x26, 0x81, 0x41, 0x81, 0x46, 0x01, 0x41, 0x18, 0x85, 0x26, 0x0E, 0x41, 0x21,
+    0x41, 0x46, 0x77, 0x6A, 0x6A, 0x62, 0x6A, 0x52, 0x77, 0x79, 0x21, 0x21, 0x26, 0x82, 0x41, 0x22,
+    0x21, 0x41, 0x13, 0x41, 0x74, 0x46, 0x30, 0x65, 0x0E, 0x0E, 0x55, 0x0F, 0x13, 0x13, 0x10, 0x51,
+    0x35, 0x13, 0x2F, 0x25, 0x2C, 0x48, 0x5C, 0x02, 0x02, 0x2C, 0x54, 0x47, 0x3C, 0x36, 0x59, 0x59,
+    0x44, 0x5A, 0x33, 0x82, 0x2B, 0x81, 0x31, 0x04, 0x02, 0x31, 0x5F, 0x03, 0x0D, 0x81, 0x06, 0x81,
+    0x53, 0x83, 0x06, 0x82, 0x09, 0x84, 0x06, 0x08, 0x05, 0x02, 0x06, 0x3F, 0x3D, 0x31, 0x05, 0x5C,
+    0x01, 0x9F, 0x03, 0x84, 0x03, 0x97, 0x05, 0x80, 0x03, 0x82, 0x01, 0x89, 0x04, 0x81, 0x05, 0x83,
+    0x06, 0x16, 0x0A, 0x04, 0x09, 0x05, 0x0A, 0x57, 0x2B, 0x81, 0x31, 0x29, 0x33, 0x22, 0x0A, 0x22,
+    0x64, 0x57, 0x33, 0x0D, 0x14, 0x3D, 0x1D, 0x17, 0x0E, 0x82, 0x0F, 0x81, 0x13, 0x01, 0x10, 0x23,
+    0x81, 0x0F, 0x81, 0x13, 0x81, 0x0F, 0x82, 0x18, 0x09, 0x71, 0x18, 0x18, 0x0E, 0x12, 0x0E, 0x18,
+    0x13, 0x0E, 0x18, 0x82, 0x41, 0x80, 0x21, 0x84, 0x46, 0x06, 0x51, 0x43, 0x45, 0x0C, 0x0C, 0x46,
+    0x28, 0x85, 0x26, 0x3E, 0x21, 0x77, 0x41, 0x28, 0x41, 0x21, 0x63, 0x0A, 0x09, 0x3B, 0x1E, 0x5B,
+    0x54, 0x62, 0x11, 0x30, 0x41, 0x41, 0x46, 0x6C, 0x65, 0x13, 0x1D, 0x51, 0x30, 0x55, 0x12, 0x1D,
+    0x10, 0x0F, 0x13, 0x10, 0x12, 0x11, 0x13, 0x13, 0x30, 0x59, 0x2B, 0x2B, 0x02, 0x50, 0x6E, 0x2C,
+    0x54, 0x54, 0x24, 0x45, 0x36, 0x59, 0x44, 0x29, 0x2B, 0x57, 0x48, 0x2B, 0x48, 0x2A, 0x14, 0x49,
+    0x48, 0x02, 0x08, 0x83, 0x05, 0x83, 0x06, 0x80, 0x05, 0x81, 0x06, 0x81, 0x22, 0x83, 0x06, 0x05,
+    0x04, 0x02, 0x06, 0x31, 0x2E, 0x00, 0x81, 0x0D, 0x9F, 0x03, 0x83, 0x03, 0x9B, 0x05, 0x8B, 0x04,
+    0x80, 0x05, 0x83, 0x06, 0x22, 0x22, 0x06, 0x03, 0x53, 0x02, 0x2E, 0x20, 0x03, 0x14, 0x29, 0x57,
+    0x05, 0x7E, 0x64, 0x64, 0x2C, 0x34, 0x58, 0x19, 0x29, 0x65, 0x17, 0x74, 0x0F, 0x13, 0x0F, 0x0F,
+    0x13, 0x10, 0x55, 0x0F, 0x10, 0x0E, 0x0E, 0x23, 0x82, 0x18, 0x81, 0x71, 0x81, 0x18, 0x81, 0x0E,
+    0x80, 0x13, 0x83, 0x18, 0x06, 0x28, 0x26, 0x41, 0x46, 0x38, 0x2D, 0x0C, 0x81, 0x35, 0x84, 0x0C,
+    0x02, 0x2F, 0x18, 0x28, 0x84, 0x26, 0x81, 0x28, 0x2E, 0x27, 0x41, 0x46, 0x26, 0x36, 0x7C, 0x1F,
+    0x76, 0x4B, 0x4B, 0x7F, 0x3F, 0x1F, 0x3F, 0x2C, 0x30, 0x46, 0x12, 0x0F, 0x1D, 0x13, 0x59, 0x38,
+    0x0F, 0x17, 0x0E, 0x13, 0x0E, 0x10, 0x0F, 0x30, 0x1D, 0x13, 0x65, 0x0C, 0x2D, 0x2B, 0x34, 0x05,
+    0x50, 0x3C, 0x24, 0x54, 0x3C, 0x25, 0x37, 0x5A, 0x82, 0x59, 0x13, 0x2B, 0x57, 0x57, 0x2B, 0x2B,
+    0x31, 0x31, 0x58, 0x31, 0x19, 0x01, 0x0D, 0x03, 0x6D, 0x03, 0x03, 0x09, 0x06, 0x06, 0x09, 0x87,
+    0x06, 0x07, 0x22, 0x53, 0x3F, 0x04, 0x2E, 0x31, 0x01, 0x0D, 0x9F, 0x03, 0x83, 0x03, 0x87, 0x05,
+    0x80, 0x04, 0x87, 0x05, 0x82, 0x04, 0x87, 0x05, 0x89, 0x04, 0x82, 0x05, 0x83, 0x06, 0x18, 0x04,
+    0x09, 0x7E, 0x03, 0x57, 0x2C, 0x22, 0x0A, 0x42, 0x29, 0x5F, 0x03, 0x04, 0x64, 0x0A, 0x2C, 0x57,
+    0x3F, 0x5F, 0x44, 0x65, 0x65, 0x0F, 0x13, 0x0E, 0x82, 0x0F, 0x81, 0x55, 0x08, 0x0F, 0x10, 0x13,
+    0x0E, 0x13, 0x0F, 0x18, 0x18, 0x71, 0x82, 0x18, 0x81, 0x0E, 0x07, 0x13, 0x18, 0x18, 0x71, 0x28,
+    0x18, 0x0E, 0x43, 0x84, 0x35, 0x1B, 0x0C, 0x2D, 0x2D, 0x45, 0x2D, 0x0C, 0x0C, 0x46, 0x28, 0x26,
+    0x28, 0x28, 0x26, 0x21, 0x26, 0x26, 0x41, 0x21, 0x46, 0x0E, 0x2B, 0x3F, 0x70, 0x63, 0x0A, 0x1E,
+    0x76, 0x7C, 0x82, 0x1F, 0x2C, 0x14, 0x0C, 0x18, 0x0E, 0x41, 0x0F, 0x11, 0x1A, 0x0F, 0x1D, 0x0E,
+    0x0E, 0x55, 0x65, 0x79, 0x12, 0x13, 0x23, 0x17, 0x35, 0x36, 0x33, 0x34, 0x05, 0x50, 0x31, 0x54,
+    0x54, 0x67, 0x44, 0x2F, 0x3D, 0x59, 0x29, 0x59, 0x33, 0x48, 0x57, 0x57, 0x2E, 0x57, 0x2A, 0x42,
+    0x19, 0x31, 0x82, 0x0D, 0x06, 0x03, 0x05, 0x05, 0x04, 0x05, 0x53, 0x06, 0x81, 0x03, 0x83, 0x06,
+    0x82, 0x05, 0x05, 0x5B, 0x04, 0x04, 0x31, 0x2B, 0x20, 0x81, 0x01, 0x9E, 0x03, 0x83, 0x03, 0x87,
+    0x05, 0x80, 0x04, 0x86, 0x05, 0x84, 0x04, 0x86, 0x05, 0x87, 0x04, 0x82, 0x05, 0x84, 0x06, 0x1D,
+    0x53, 0x06, 0x01, 0x16, 0x1F, 0x25, 0x02, 0x04, 0x4B, 0x2B, 0x5A, 0x42, 0x0A, 0x04, 0x1E, 0x02,
+    0x31, 0x2A, 0x80, 0x48, 0x56, 0x1D, 0x23, 0x23, 0x13, 0x0E, 0x0F, 0x55, 0x0F, 0x55, 0x82, 0x0F,
+    0x03, 0x10, 0x13, 0x1D, 0x13, 0x83, 0x18, 0x01, 0x71, 0x18, 0x81, 0x0E, 0x83, 0x18, 0x02, 0x0E,
+    0x1A, 0x2D, 0x84, 0x35, 0x0F, 0x0C, 0x2D, 0x2D, 0x35, 0x45, 0x2D, 0x30, 0x32, 0x79, 0x28, 0x26,
+    0x41, 0x26, 0x26, 0x41, 0x26, 0x82, 0x46, 0x3D, 0x13, 0x2D, 0x5F, 0x5C, 0x62, 0x24, 0x4B, 0x4B,
+    0x7C, 0x02, 0x7C, 0x02, 0x54, 0x1F, 0x2C, 0x12, 0x0E, 0x12, 0x10, 0x11, 0x17, 0x0F, 0x12, 0x17,
+    0x65, 0x17, 0x79, 0x1A, 0x23, 0x74, 0x23, 0x43, 0x29, 0x5A, 0x3D, 0x24, 0x02, 0x0D, 0x3C, 0x3C,
+    0x54, 0x72, 0x37, 0x37, 0x5A, 0x36, 0x56, 0x2D, 0x25, 0x48, 0x2A, 0x48, 0x2E, 0x2B, 0x42, 0x48,
+    0x14, 0x2A, 0x58, 0x03, 0x00, 0x0D, 0x81, 0x05, 0x81, 0x06, 0x81, 0x53, 0x82, 0x03, 0x01, 0x53,
+    0x06, 0x82, 0x05, 0x08, 0x0A, 0x04, 0x06, 0x01, 0x76, 0x2B, 0x24, 0x0D, 0x01, 0x9E, 0x03, 0x81,
+    0x03, 0x86, 0x05, 0x80, 0x06, 0x91, 0x05, 0x87, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06, 0x83,
+    0x05, 0x82, 0x06, 0x25, 0x22, 0x03, 0x06, 0x22, 0x33, 0x19, 0x64, 0x04, 0x22, 0x57, 0x33, 0x42,
+    0x01, 0x5E, 0x0A, 0x01, 0x3F, 0x42, 0x3F, 0x2B, 0x17, 0x12, 0x13, 0x10, 0x23, 0x0E, 0x55, 0x10,
+    0x0F, 0x13, 0x10, 0x0F, 0x13, 0x10, 0x10, 0x0E, 0x6C, 0x13, 0x84, 0x18, 0x01, 0x13, 0x0E, 0x82,
+    0x18, 0x03, 0x0F, 0x1A, 0x44, 0x2D, 0x85, 0x35, 0x82, 0x0C, 0x06, 0x35, 0x30, 0x35, 0x0C, 0x0C,
+    0x17, 0x27, 0x82, 0x26, 0x4A, 0x41, 0x46, 0x21, 0x46, 0x0E, 0x38, 0x63, 0x42, 0x19, 0x05, 0x6E,
+    0x5E, 0x4B, 0x01, 0x04, 0x03, 0x03, 0x4F, 0x1F, 0x5F, 0x44, 0x0E, 0x0E, 0x13, 0x67, 0x13, 0x17,
+    0x17, 0x1D, 0x0E, 0x38, 0x46, 0x55, 0x13, 0x23, 0x6C, 0x43, 0x2F, 0x3D, 0x29, 0x31, 0x80, 0x6E,
+    0x3C, 0x5D, 0x3C, 0x2D, 0x17, 0x12, 0x3D, 0x2C, 0x12, 0x37, 0x45, 0x5A, 0x48, 0x57, 0x2B, 0x2E,
+    0x5F, 0x2A, 0x31, 0x42, 0x2A, 0x0D, 0x03, 0x02, 0x80, 0x53, 0x06, 0x0A, 0x09, 0x03, 0x06, 0x05,
+    0x82, 0x03, 0x0B, 0x06, 0x22, 0x06, 0x0A, 0x05, 0x04, 0x04, 0x01, 0x5F, 0x34, 0x03, 0x01, 0x9E,
+    0x03, 0x81, 0x03, 0x91, 0x05, 0x83, 0x04, 0x82, 0x05, 0x87, 0x04, 0x01, 0x05, 0x04, 0x82, 0x05,
+    0x80, 0x06, 0x81, 0x05, 0x82, 0x06, 0x81, 0x22, 0x26, 0x06, 0x05, 0x64, 0x14, 0x2B, 0x04, 0x09,
+    0x04, 0x06, 0x2C, 0x2C, 0x14, 0x04, 0x5E, 0x16, 0x7C, 0x5C, 0x42, 0x3F, 0x2E, 0x12, 0x12, 0x23,
+    0x10, 0x23, 0x0E, 0x55, 0x23, 0x0F, 0x13, 0x10, 0x0F, 0x13, 0x13, 0x10, 0x10, 0x13, 0x1D, 0x13,
+    0x84, 0x18, 0x07, 0x13, 0x18, 0x71, 0x18, 0x0E, 0x1A, 0x44, 0x2D, 0x82, 0x35, 0x04, 0x11, 0x35,
+    0x38, 0x43, 0x35, 0x83, 0x0C, 0x05, 0x30, 0x0C, 0x2F, 0x18, 0x28, 0x26, 0x81, 0x41, 0x82, 0x46,
+    0x3D, 0x0E, 0x35, 0x2C, 0x19, 0x5F, 0x03, 0x34, 0x02, 0x02, 0x59, 0x49, 0x1E, 0x03, 0x80, 0x1F,
+    0x14, 0x29, 0x0F, 0x13, 0x6C, 0x63, 0x0F, 0x1D, 0x17, 0x6C, 0x1D, 0x12, 0x0E, 0x13, 0x0F, 0x0E,
+    0x79, 0x65, 0x2F, 0x44, 0x59, 0x58, 0x05, 0x5C, 0x54, 0x54, 0x25, 0x74, 0x17, 0x12, 0x2F, 0x31,
+    0x59, 0x12, 0x56, 0x44, 0x2B, 0x31, 0x57, 0x2B, 0x57, 0x49, 0x48, 0x19, 0x48, 0x3F, 0x5C, 0x82,
+    0x04, 0x13, 0x05, 0x6D, 0x53, 0x05, 0x06, 0x06, 0x53, 0x06, 0x06, 0x53, 0x05, 0x05, 0x06, 0x05,
+    0x06, 0x06, 0x03, 0x58, 0x34, 0x00, 0x9F, 0x03, 0x80, 0x03, 0x92, 0x05, 0x83, 0x04, 0x82, 0x05,
+    0x85, 0x04, 0x85, 0x05, 0x87, 0x06, 0x22, 0x22, 0x03, 0x06, 0x04, 0x2B, 0x14, 0x06, 0x09, 0x22,
+    0x7E, 0x33, 0x48, 0x1F, 0x04, 0x04, 0x0A, 0x1F, 0x0D, 0x2A, 0x3F, 0x3D, 0x0E, 0x65, 0x18, 0x10,
+    0x23, 0x0F, 0x10, 0x23, 0x23, 0x13, 0x23, 0x0F, 0x0E, 0x13, 0x81, 0x10, 0x81, 0x13, 0x81, 0x0E,
+    0x82, 0x18, 0x81, 0x0F, 0x0E, 0x18, 0x71, 0x18, 0x0E, 0x37, 0x56, 0x45, 0x30, 0x35, 0x11, 0x35,
+    0x46, 0x27, 0x18, 0x38, 0x81, 0x30, 0x82, 0x35, 0x81, 0x2D, 0x4E, 0x17, 0x28, 0x26, 0x41, 0x41,
+    0x46, 0x46, 0x17, 0x6C, 0x63, 0x24, 0x42, 0x19, 0x6E, 0x3C, 0x01, 0x36, 0x46, 0x72, 0x0B, 0x03,
+    0x05, 0x3F, 0x1F, 0x59, 0x46, 0x0F, 0x38, 0x11, 0x18, 0x17, 0x17, 0x12, 0x1D, 0x74, 0x74, 0x55,
+    0x10, 0x79, 0x12, 0x55, 0x2D, 0x2F, 0x5A, 0x02, 0x50, 0x50, 0x60, 0x24, 0x17, 0x13, 0x65, 0x12,
+    0x17, 0x2C, 0x57, 0x37, 0x12, 0x2F, 0x3D, 0x48, 0x2A, 0x2B, 0x2E, 0x31, 0x31, 0x2A, 0x2A, 0x3F,
+    0x03, 0x3F, 0x02, 0x04, 0x0D, 0x05, 0x06, 0x53, 0x53, 0x05, 0x83, 0x06, 0x83, 0x05, 0x05, 0x06,
+    0x05, 0x03, 0x0D, 0x2C, 0x5C, 0x9F, 0x03, 0x80, 0x03, 0x95, 0x05, 0x80, 0x04, 0x82, 0x05, 0x84,
+    0x04, 0x85, 0x05, 0x89, 0x06, 0x19, 0x01, 0x06, 0x42, 0x2B, 0x16, 0x05, 0x06, 0x22, 0x02, 0x33,
+    0x5F, 0x1F, 0x04, 0x04, 0x03, 0x20, 0x05, 0x2A, 0x1F, 0x44, 0x13, 0x23, 0x55, 0x10, 0x10, 0x0F,
+    0x82, 0x10, 0x0A, 0x0F, 0x23, 0x0F, 0x0E, 0x13, 0x10, 0x0F, 0x13, 0x0F, 0x0F, 0x0E, 0x84, 0x13,
+    0x62, 0x18, 0x71, 0x18, 0x0F, 0x37, 0x56, 0x56, 0x30, 0x11, 0x35, 0x0C, 0x41, 0x26, 0x18, 0x18,
+    0x35, 0x0C, 0x2D, 0x0C, 0x0C, 0x30, 0x45, 0x11, 0x46, 0x28, 0x41, 0x41, 0x46, 0x46, 0x0F, 0x59,
+    0x63, 0x19, 0x42, 0x42, 0x49, 0x58, 0x5F, 0x43, 0x77, 0x35, 0x09, 0x64, 0x4B, 0x80, 0x1F, 0x3D,
+    0x0F, 0x55, 0x30, 0x11, 0x10, 0x6C, 0x17, 0x12, 0x12, 0x74, 0x0E, 0x65, 0x79, 0x38, 0x65, 0x0E,
+    0x45, 0x2F, 0x2B, 0x50, 0x50, 0x68, 0x24, 0x59, 0x0F, 0x23, 0x13, 0x0F, 0x37, 0x36, 0x19, 0x29,
+    0x65, 0x2F, 0x29, 0x3D, 0x48, 0x2A, 0x2B, 0x2B, 0x14, 0x57, 0x57, 0x19, 0x06, 0x53, 0x5C, 0x3F,
+    0x01, 0x03, 0x05, 0x64, 0x82, 0x05, 0x82, 0x06, 0x81, 0x22, 0x07, 0x53, 0x06, 0x7E, 0x05, 0x04,
+    0x0A, 0x2A, 0x58, 0x9F, 0x03, 0x80, 0x03, 0x86, 0x05, 0x80, 0x04, 0x8B, 0x05, 0x8A, 0x04, 0x80,
+    0x05, 0x81, 0x04, 0x81, 0x05, 0x86, 0x06, 0x81, 0x22, 0x82, 0x06, 0x18, 0x04, 0x2B, 0x20, 0x06,
+    0x0A, 0x05, 0x16, 0x5C, 0x2C, 0x3F, 0x14, 0x22, 0x04, 0x02, 0x0D, 0x7E, 0x19, 0x31, 0x37, 0x0F,
+    0x23, 0x18, 0x28, 0x10, 0x0F, 0x82, 0x10, 0x08, 0x0F, 0x23, 0x0F, 0x0E, 0x0E, 0x13, 0x55, 0x0F,
+    0x13, 0x81, 0x18, 0x82, 0x13, 0x81, 0x0E, 0x82, 0x18, 0x07, 0x0F, 0x1A, 0x37, 0x56, 0x2D, 0x35,
+    0x35, 0x2F, 0x82, 0x26, 0x09, 0x27, 0x43, 0x35, 0x30, 0x35, 0x35, 0x2D, 0x45, 0x35, 0x78, 0x84,
+    0x41, 0x55, 0x12, 0x67, 0x24, 0x31, 0x24, 0x14, 0x14, 0x19, 0x2C, 0x51, 0x77, 0x77, 0x14, 0x1E,
+    0x6D, 0x80, 0x3F, 0x25, 0x13, 0x55, 0x11, 0x35, 0x10, 0x6C, 0x12, 0x17, 0x12, 0x74, 0x74, 0x6C,
+    0x46, 0x55, 0x1D, 0x12, 0x2D, 0x45, 0x19, 0x68, 0x5D, 0x3C, 0x59, 0x46, 0x55, 0x10, 0x23, 0x74,
+    0x37, 0x59, 0x2A, 0x33, 0x37, 0x12, 0x44, 0x59, 0x2B, 0x31, 0x2A, 0x2E, 0x48, 0x42, 0x2B, 0x48,
+    0x04, 0x04, 0x22, 0x05, 0x58, 0x5C, 0x01, 0x05, 0x05, 0x06, 0x06, 0x04, 0x05, 0x05, 0x06, 0x06,
+    0x05, 0x22, 0x0A, 0x05, 0x04, 0x0A, 0x42, 0x49, 0x9F, 0x03, 0x81, 0x03, 0x97, 0x05, 0x87, 0x04,
+    0x81, 0x05, 0x87, 0x06, 0x82, 0x22, 0x1A, 0x06, 0x64, 0x2A, 0x57, 0x5B, 0x05, 0x06, 0x03, 0x16,
+    0x49, 0x2A, 0x3F, 0x5F, 0x5E, 0x04, 0x20, 0x02, 0x03, 0x14, 0x33, 0x1D, 0x74, 0x23, 0x28, 0x39,
+    0x10, 0x0F, 0x82, 0x10, 0x05, 0x0F, 0x23, 0x0F, 0x0E, 0x1D, 0x0E, 0x82, 0x0F, 0x83, 0x18, 0x80,
+    0x0F, 0x81, 0x13, 0x82, 0x18, 0x01, 0x12, 0x1A, 0x82, 0x56, 0x02, 0x45, 0x38, 0x46, 0x82, 0x26,
+    0x57, 0x27, 0x0E, 0x0C, 0x35, 0x2D, 0x2D, 0x35, 0x0C, 0x44, 0x11, 0x78, 0x13, 0x23, 0x41, 0x0F,
+    0x15, 0x72, 0x19, 0x31, 0x31, 0x49, 0x1F, 0x1F, 0x25, 0x46, 0x79, 0x78, 0x25, 0x0A, 0x05, 0x76,
+    0x7C, 0x57, 0x1D, 0x10, 0x11, 0x43, 0x10, 0x6C, 0x12, 0x12, 0x74, 0x12, 0x74, 0x65, 0x10, 0x6C,
+    0x74, 0x12, 0x2F, 0x29, 0x02, 0x0B, 0x54, 0x25, 0x1A, 0x13, 0x18, 0x23, 0x10, 0x65, 0x12, 0x45,
+    0x2B, 0x57, 0x44, 0x37, 0x37, 0x29, 0x2E, 0x48, 0x31, 0x2B, 0x2B, 0x31, 0x2A, 0x2B, 0x3F, 0x05,
+    0x04, 0x22, 0x09, 0x5C, 0x14, 0x02, 0x7E, 0x22, 0x06, 0x82, 0x05, 0x0A, 0x53, 0x22, 0x05, 0x22,
+    0x09, 0x05, 0x04, 0x0A, 0x19, 0x58, 0x05, 0x9E, 0x03, 0x82, 0x03, 0x86, 0x05, 0x81, 0x06, 0x83,
+    0x05, 0x83, 0x06, 0x8F, 0x05, 0x87, 0x06, 0x82, 0x22, 0x18, 0x06, 0x02, 0x2B, 0x00, 0x06, 0x22,
+    0x06, 0x0A, 0x06, 0x49, 0x31, 0x7C, 0x5F, 0x06, 0x06, 0x20, 0x02, 0x02, 0x42, 0x29, 0x1D, 0x0F,
+    0x10, 0x10, 0x39, 0x84, 0x10, 0x0A, 0x0F, 0x23, 0x10, 0x0E, 0x1D, 0x1D, 0x74, 0x0F, 0x0F, 0x18,
+    0x23, 0x82, 0x18, 0x80, 0x0F, 0x82, 0x18, 0x80, 0x0F, 0x81, 0x37, 0x82, 0x56, 0x33, 0x51, 0x46,
+    0x41, 0x26, 0x26, 0x18, 0x28, 0x18, 0x43, 0x35, 0x2D, 0x35, 0x35, 0x45, 0x0C, 0x0C, 0x35, 0x15,
+    0x79, 0x1A, 0x15, 0x63, 0x72, 0x49, 0x49, 0x42, 0x49, 0x14, 0x33, 0x51, 0x38, 0x21, 0x78, 0x78,
+    0x24, 0x0B, 0x03, 0x3F, 0x58, 0x59, 0x10, 0x11, 0x38, 0x10, 0x1A, 0x37, 0x12, 0x12, 0x17, 0x74,
+    0x55, 0x0F, 0x82, 0x12, 0x27, 0x37, 0x2B, 0x68, 0x53, 0x2A, 0x0C, 0x74, 0x23, 0x28, 0x18, 0x55,
+    0x55, 0x12, 0x12, 0x3D, 0x2A, 0x59, 0x51, 0x12, 0x44, 0x59, 0x2B, 0x2A, 0x2A, 0x48, 0x2B, 0x31,
+    0x2B, 0x5F, 0x01, 0x22, 0x05, 0x05, 0x5E, 0x01, 0x49, 0x02, 0x01, 0x03, 0x7E, 0x84, 0x05, 0x07,
+    0x22, 0x03, 0x05, 0x05, 0x22, 0x14, 0x58, 0x05, 0x9E, 0x03, 0x82, 0x03, 0x86, 0x05, 0x82, 0x06,
+    0x96, 0x05, 0x82, 0x06, 0x80, 0x05, 0x83, 0x06, 0x81, 0x22, 0x19, 0x06, 0x22, 0x2A, 0x57, 0x4C,
+    0x05, 0x16, 0x06, 0x4B, 0x16, 0x19, 0x19, 0x6D, 0x19, 0x7F, 0x01, 0x20, 0x05, 0x3F, 0x2A, 0x37,
+    0x12, 0x0F, 0x10, 0x10, 0x39, 0x84, 0x10, 0x06, 0x0F, 0x23, 0x10, 0x1D, 0x1D, 0x0E, 0x74, 0x81,
+    0x0E, 0x86, 0x18, 0x03, 0x28, 0x18, 0x13, 0x37, 0x82, 0x56, 0x02, 0x2F, 0x38, 0x46, 0x83, 0x26,
+    0x81, 0x28, 0x62, 0x51, 0x45, 0x0C, 0x35, 0x0C, 0x0C, 0x2D, 0x45, 0x2D, 0x29, 0x11, 0x63, 0x59,
+    0x3D, 0x3C, 0x31, 0x42, 0x19, 0x19, 0x31, 0x30, 0x46, 0x21, 0x77, 0x21, 0x77, 0x46, 0x59, 0x6E,
+    0x04, 0x3F, 0x2D, 0x10, 0x63, 0x51, 0x0F, 0x17, 0x2F, 0x1A, 0x17, 0x12, 0x0F, 0x0E, 0x13, 0x12,
+    0x12, 0x1A, 0x56, 0x58, 0x50, 0x14, 0x57, 0x1A, 0x0F, 0x13, 0x10, 0x10, 0x23, 0x0F, 0x65, 0x12,
+    0x45, 0x2C, 0x2E, 0x12, 0x2F, 0x1A, 0x44, 0x3D, 0x5F, 0x2A, 0x48, 0x57, 0x2C, 0x5F, 0x2B, 0x5C,
+    0x04, 0x04, 0x53, 0x04, 0x16, 0x06, 0x49, 0x5C, 0x03, 0x7E, 0x22, 0x06, 0x06, 0x7E, 0x53, 0x22,
+    0x03, 0x04, 0x05, 0x04, 0x1F, 0x5C, 0x81, 0x05, 0x84, 0x03, 0x80, 0x6D, 0x97, 0x03, 0x81, 0x03,
+    0x85, 0x05, 0x86, 0x06, 0x96, 0x05, 0x82, 0x06, 0x14, 0x05, 0x22, 0x06, 0x03, 0x22, 0x06, 0x00,
+    0x33, 0x03, 0x22, 0x05, 0x06, 0x09, 0x09, 0x1E, 0x14, 0x3F, 0x05, 0x58, 0x80, 0x01, 0x82, 0x02,
+    0x02, 0x3D, 0x1A, 0x13, 0x82, 0x10, 0x0B, 0x71, 0x10, 0x23, 0x23, 0x39, 0x10, 0x10, 0x0F, 0x10,
+    0x13, 0x17, 0x12, 0x81, 0x0E, 0x81, 0x0F, 0x85, 0x18, 0x08, 0x71, 0x18, 0x0E, 0x56, 0x2F, 0x56,
+    0x56, 0x46, 0x21, 0x82, 0x41, 0x82, 0x26, 0x04, 0x27, 0x41, 0x0C, 0x2D, 0x35, 0x83, 0x0C, 0x81,
+    0x45, 0x0A, 0x44, 0x45, 0x44, 0x24, 0x19, 0x24, 0x5F, 0x49, 0x14, 0x2C, 0x46, 0x82, 0x41, 0x81,
+    0x46, 0x2C, 0x12, 0x41, 0x35, 0x73, 0x1F, 0x45, 0x23, 0x63, 0x17, 0x0E, 0x38, 0x51, 0x37, 0x12,
+    0x1D, 0x65, 0x74, 0x55, 0x0E, 0x12, 0x37, 0x25, 0x54, 0x14, 0x31, 0x25, 0x12, 0x13, 0x23, 0x39,
+    0x18, 0x18, 0x55, 0x74, 0x12, 0x37, 0x5A, 0x2C, 0x56, 0x0F, 0x2F, 0x44, 0x3D, 0x2B, 0x42, 0x82,
+    0x48, 0x11, 0x57, 0x2B, 0x5F, 0x0D, 0x64, 0x05, 0x53, 0x06, 0x22, 0x16, 0x20, 0x19, 0x03, 0x05,
+    0x22, 0x16, 0x05, 0x03, 0x82, 0x06, 0x04, 0x53, 0x02, 0x3F, 0x08, 0x05, 0x9E, 0x03, 0x81, 0x03,
+    0x88, 0x05, 0x80, 0x06, 0x98, 0x05, 0x83, 0x06, 0x01, 0x05, 0x22, 0x82, 0x06, 0x24, 0x22, 0x31,
+    0x24, 0x09, 0x06, 0x53, 0x09, 0x09, 0x06, 0x16, 0x19, 0x58, 0x04, 0x1F, 0x5C, 0x02, 0x3F, 0x02,
+    0x14, 0x29, 0x17, 0x0F, 0x23, 0x10, 0x39, 0x10, 0x10, 0x23, 0x23, 0x39, 0x10, 0x10, 0x0F, 0x10,
+    0x13, 0x1D, 0x12, 0x82, 0x0E, 0x80, 0x13, 0x85, 0x18, 0x11, 0x71, 0x18, 0x12, 0x56, 0x56, 0x44,
+    0x2F, 0x0E, 0x28, 0x26, 0x28, 0x28, 0x26, 0x26, 0x28, 0x27, 0x46, 0x2D, 0x83, 0x0C, 0x1F, 0x2D,
+    0x0C, 0x29, 0x45, 0x2D, 0x2D, 0x33, 0x24, 0x42, 0x49, 0x19, 0x14, 0x49, 0x24, 0x17, 0x46, 0x41,
+    0x46, 0x79, 0x51, 0x1D, 0x13, 0x38, 0x53, 0x2A, 0x2E, 0x12, 0x63, 0x17, 0x0F, 0x1A, 0x37, 0x83,
+    0x12, 0x31, 0x0F, 0x0E, 0x0E, 0x12, 0x35, 0x62, 0x31, 0x19, 0x48, 0x5A, 0x65, 0x0F, 0x23, 0x10,
+    0x18, 0x18, 0x55, 0x0F, 0x12, 0x56, 0x59, 0x2B, 0x29, 0x1D, 0x37, 0x51, 0x29, 0x3D, 0x31, 0x31,
+    0x2A, 0x2B, 0x2B, 0x2A, 0x2B, 0x03, 0x0A, 0x7E, 0x03, 0x64, 0x64, 0x04, 0x22, 0x00, 0x49, 0x0A,
+    0x06, 0x04, 0x53, 0x03, 0x82, 0x06, 0x03, 0x03, 0x01, 0x02, 0x08, 0x81, 0x05, 0x9D, 0x03, 0x81,
+    0x03, 0x95, 0x05, 0x81, 0x06, 0x8A, 0x05, 0x82, 0x06, 0x80, 0x05, 0x82, 0x06, 0x28, 0x22, 0x06,
+    0x02, 0x2B, 0x08, 0x0A, 0x06, 0x06, 0x16, 0x09, 0x06, 0x16, 0x49, 0x58, 0x0A, 0x02, 0x19, 0x5C,
+    0x01, 0x3F, 0x2E, 0x2F, 0x0E, 0x55, 0x23, 0x39, 0x27, 0x39, 0x10, 0x23, 0x10, 0x39, 0x39, 0x10,
+    0x0F, 0x55, 0x55, 0x17, 0x12, 0x1D, 0x65, 0x81, 0x0E, 0x84, 0x18, 0x81, 0x28, 0x10, 0x0F, 0x17,
+    0x56, 0x56, 0x45, 0x43, 0x17, 0x18, 0x28, 0x18, 0x18, 0x28, 0x26, 0x28, 0x28, 0x45, 0x2D, 0x83,
+    0x0C, 0x53, 0x2D, 0x0C, 0x0C, 0x44, 0x2D, 0x5A, 0x24, 0x24, 0x62, 0x14, 0x19, 0x14, 0x49, 0x58,
+    0x36, 0x13, 0x41, 0x46, 0x43, 0x38, 0x30, 0x0E, 0x36, 0x03, 0x2A, 0x48, 0x56, 0x67, 0x51, 0x55,
+    0x1A, 0x37, 0x37, 0x17, 0x12, 0x12, 0x0F, 0x65, 0x65, 0x38, 0x35, 0x48, 0x42, 0x48, 0x48, 0x59,
+    0x55, 0x18, 0x23, 0x10, 0x18, 0x18, 0x55, 0x65, 0x65, 0x56, 0x29, 0x59, 0x3D, 0x44, 0x12, 0x37,
+    0x37, 0x3D, 0x2E, 0x2A, 0x42, 0x48, 0x2E, 0x2B, 0x57, 0x14, 0x09, 0x0A, 0x09, 0x0A, 0x0A, 0x5E,
+    0x06, 0x0A, 0x58, 0x58, 0x0A, 0x05, 0x81, 0x03, 0x82, 0x06, 0x81, 0x05, 0x01, 0x0D, 0x08, 0x82,
+    0x05, 0x9C, 0x03, 0x8A, 0x05, 0x80, 0x06, 0x8B, 0x05, 0x81, 0x06, 0x87, 0x05, 0x80, 0x06, 0x81,
+    0x05, 0x82, 0x06, 0x80, 0x53, 0x84, 0x06, 0x01, 0x19, 0x2C, 0x82, 0x06, 0x81, 0x16, 0x1F, 0x09,
+    0x06, 0x16, 0x58, 0x58, 0x0D, 0x04, 0x57, 0x3F, 0x00, 0x5F, 0x29, 0x44, 0x13, 0x23, 0x10, 0x07,
+    0x28, 0x39, 0x39, 0x23, 0x10, 0x39, 0x39, 0x10, 0x0F, 0x55, 0x23, 0x1D, 0x17, 0x1D, 0x65, 0x81,
+    0x0E, 0x84, 0x18, 0x81, 0x28, 0x10, 0x0E, 0x2F, 0x56, 0x56, 0x45, 0x35, 0x0C, 0x1A, 0x0E, 0x12,
+    0x0E, 0x18, 0x27, 0x71, 0x46, 0x0C, 0x2D, 0x83, 0x0C, 0x5C, 0x2D, 0x0C, 0x0C, 0x44, 0x32, 0x2C,
+    0x5F, 0x62, 0x62, 0x19, 0x14, 0x49, 0x49, 0x20, 0x24, 0x17, 0x46, 0x51, 0x1A, 0x17, 0x38, 0x36,
+    0x08, 0x19, 0x19, 0x48, 0x3D, 0x35, 0x1A, 0x10, 0x1A, 0x37, 0x1A, 0x17, 0x12, 0x12, 0x13, 0x65,
+    0x12, 0x2F, 0x29, 0x2A, 0x19, 0x48, 0x2C, 0x2F, 0x10, 0x18, 0x23, 0x23, 0x18, 0x18, 0x10, 0x55,
+    0x74, 0x37, 0x29, 0x56, 0x3D, 0x44, 0x1A, 0x56, 0x37, 0x5A, 0x29, 0x57, 0x5F, 0x31, 0x48, 0x2E,
+    0x2A, 0x5F, 0x03, 0x09, 0x0A, 0x03, 0x06, 0x64, 0x64, 0x06, 0x1E, 0x20, 0x5C, 0x0A, 0x03, 0x03,
+    0x05, 0x06, 0x06, 0x04, 0x03, 0x03, 0x0D, 0x83, 0x05, 0x9B, 0x03, 0x91, 0x05, 0x83, 0x06, 0x8B,
+    0x05, 0x01, 0x06, 0x05, 0x83, 0x06, 0x80, 0x53, 0x83, 0x06, 0x02, 0x03, 0x2C, 0x58, 0x82, 0x06,
+    0x11, 0x16, 0x06, 0x16, 0x06, 0x16, 0x20, 0x3F, 0x02, 0x76, 0x2C, 0x58, 0x1F, 0x48, 0x44, 0x56,
+    0x23, 0x28, 0x10, 0x82, 0x39, 0x10, 0x10, 0x23, 0x10, 0x39, 0x39, 0x10, 0x0F, 0x0F, 0x10, 0x1D,
+    0x17, 0x1D, 0x12, 0x12, 0x0E, 0x18, 0x28, 0x82, 0x18, 0x10, 0x71, 0x18, 0x12, 0x56, 0x56, 0x44,
+    0x0C, 0x0C, 0x35, 0x2D, 0x0E, 0x1A, 0x38, 0x46, 0x41, 0x13, 0x2D, 0x82, 0x0C, 0x80, 0x2D, 0x83,
+    0x0C, 0x1D, 0x2D, 0x29, 0x33, 0x19, 0x2A, 0x42, 0x14, 0x20, 0x14, 0x49, 0x58, 0x49, 0x14, 0x35,
+    0x17, 0x56, 0x45, 0x0C, 0x3D, 0x3C, 0x01, 0x57, 0x01, 0x5F, 0x2B, 0x56, 0x12, 0x23, 0x1A, 0x37,
+    0x82, 0x12, 0x38, 0x17, 0x55, 0x74, 0x51, 0x12, 0x25, 0x19, 0x19, 0x48, 0x2C, 0x12, 0x10, 0x18,
+    0x23, 0x10, 0x10, 0x23, 0x10, 0x55, 0x74, 0x17, 0x29, 0x29, 0x44, 0x56, 0x37, 0x56, 0x17, 0x5A,
+    0x32, 0x5A, 0x5F, 0x5F, 0x14, 0x48, 0x2B, 0x5F, 0x3F, 0x0A, 0x06, 0x16, 0x22, 0x09, 0x06, 0x22,
+    0x06, 0x06, 0x58, 0x01, 0x06, 0x03, 0x05, 0x06, 0x06, 0x04, 0x03, 0x6D, 0x84, 0x05, 0x9B, 0x03,
+    0x91, 0x05, 0x85, 0x06, 0x89, 0x05, 0x85, 0x06, 0x3A, 0x53, 0x06, 0x53, 0x06, 0x06, 0x5C, 0x2C,
+    0x0A, 0x06, 0x06, 0x16, 0x06, 0x06, 0x16, 0x06, 0x16, 0x5C, 0x02, 0x05, 0x05, 0x34, 0x19, 0x14,
+    0x2B, 0x29, 0x12, 0x10, 0x23, 0x10, 0x71, 0x39, 0x39, 0x10, 0x23, 0x23, 0x39, 0x39, 0x10, 0x13,
+    0x13, 0x10, 0x0E, 0x12, 0x1D, 0x12, 0x12, 0x1D, 0x0F, 0x28, 0x18, 0x18, 0x28, 0x71, 0x0F, 0x37,
+    0x56, 0x56, 0x44, 0x35, 0x82, 0x30, 0x05, 0x51, 0x0E, 0x38, 0x79, 0x46, 0x17, 0x88, 0x0C, 0x1E,
+    0x2D, 0x5A, 0x24, 0x19, 0x24, 0x3C, 0x58, 0x6E, 0x49, 0x58, 0x58, 0x14, 0x5C, 0x24, 0x1D, 0x43,
+    0x2F, 0x33, 0x0B, 0x5C, 0x02, 0x2A, 0x0A, 0x3F, 0x48, 0x3D, 0x65, 0x10, 0x12, 0x37, 0x17, 0x82,
+    0x12, 0x26, 0x65, 0x37, 0x1A, 0x51, 0x48, 0x58, 0x5F, 0x2A, 0x2E, 0x55, 0x23, 0x23, 0x55, 0x10,
+    0x0F, 0x55, 0x10, 0x23, 0x74, 0x12, 0x44, 0x2E, 0x2F, 0x56, 0x65, 0x1A, 0x17, 0x44, 0x32, 0x29,
+    0x1F, 0x2A, 0x2A, 0x1F, 0x31, 0x2A, 0x14, 0x0A, 0x22, 0x82, 0x06, 0x06, 0x53, 0x64, 0x7F, 0x06,
+    0x01, 0x20, 0x22, 0x82, 0x06, 0x82, 0x03, 0x80, 0x6D, 0x85, 0x05, 0x9A, 0x03, 0x94, 0x05, 0x82,
+    0x06, 0x89, 0x05, 0x85, 0x06, 0x2B, 0x0A, 0x06, 0x53, 0x06, 0x0A, 0x31, 0x31, 0x16, 0x06, 0x06,
+    0x1E, 0x09, 0x16, 0x16, 0x06, 0x1E, 0x5C, 0x1F, 0x06, 0x0D, 0x48, 0x2A, 0x1F, 0x2E, 0x44, 0x10,
+    0x0F, 0x10, 0x39, 0x71, 0x71, 0x10, 0x10, 0x23, 0x23, 0x39, 0x39, 0x10, 0x13, 0x13, 0x10, 0x13,
+    0x0E, 0x1D, 0x82, 0x12, 0x14, 0x13, 0x28, 0x18, 0x18, 0x28, 0x18, 0x12, 0x37, 0x37, 0x56, 0x56,
+    0x35, 0x35, 0x30, 0x35, 0x43, 0x0F, 0x0E, 0x12, 0x17, 0x2F, 0x83, 0x0C, 0x80, 0x35, 0x84, 0x0C,
+    0x04, 0x25, 0x19, 0x19, 0x24, 0x4F, 0x81, 0x3C, 0x82, 0x49, 0x11, 0x20, 0x31, 0x58, 0x63, 0x30,
+    0x17, 0x24, 0x09, 0x01, 0x58, 0x2A, 0x7E, 0x04, 0x42, 0x48, 0x56, 0x55, 0x74, 0x81, 0x1A, 0x83,
+    0x12, 0x09, 0x2F, 0x1A, 0x29, 0x58, 0x50, 0x31, 0x2A, 0x29, 0x18, 0x0F, 0x85, 0x55, 0x06, 0x0F,
+    0x55, 0x12, 0x37, 0x2E, 0x59, 0x17, 0x83, 0x12, 0x1B, 0x29, 0x44, 0x14, 0x3F, 0x2B, 0x2A, 0x20,
+    0x57, 0x19, 0x01, 0x0A, 0x05, 0x06, 0x06, 0x0A, 0x05, 0x06, 0x04, 0x16, 0x7F, 0x00, 0x06, 0x06,
+    0x53, 0x06, 0x03, 0x03, 0x6D, 0x82, 0x03, 0x83, 0x05, 0x99, 0x03, 0x96, 0x05, 0x80, 0x06, 0x89,
+    0x05, 0x85, 0x06, 0x2B, 0x0A, 0x06, 0x05, 0x22, 0x0A, 0x57, 0x6E, 0x06, 0x0A, 0x5B, 0x64, 0x09,
+    0x16, 0x16, 0x22, 0x1E, 0x05, 0x58, 0x05, 0x49, 0x19, 0x31, 0x1F, 0x3D, 0x12, 0x10, 0x17, 0x10,
+    0x39, 0x07, 0x28, 0x39, 0x10, 0x23, 0x23, 0x39, 0x39, 0x10, 0x13, 0x13, 0x10, 0x13, 0x0E, 0x1D,
+    0x82, 0x12, 0x08, 0x0F, 0x18, 0x18, 0x71, 0x28, 0x18, 0x17, 0x2F, 0x37, 0x81, 0x56, 0x84, 0x35,
+    0x07, 0x51, 0x18, 0x18, 0x12, 0x0C, 0x2D, 0x0C, 0x2D, 0x84, 0x0C, 0x1D, 0x2D, 0x29, 0x33, 0x19,
+    0x19, 0x31, 0x14, 0x58, 0x14, 0x58, 0x49, 0x58, 0x49, 0x14, 0x14, 0x54, 0x62, 0x72, 0x81, 0x1F,
+    0x01, 0x19, 0x19, 0x4B, 0x22, 0x5C, 0x48, 0x24, 0x17, 0x12, 0x81, 0x37, 0x82, 0x12, 0x0D, 0x2F,
+    0x12, 0x1A, 0x33, 0x3F, 0x50, 0x5F, 0x31, 0x51, 0x18, 0x0F, 0x55, 0x55, 0x13, 0x82, 0x55, 0x27,
+    0x74, 0x65, 0x74, 0x17, 0x29, 0x2E, 0x56, 0x12, 0x37, 0x12, 0x12, 0x44, 0x56, 0x57, 0x06, 0x31,
+    0x59, 0x2B, 0x19, 0x2A, 0x1F, 0x0A, 0x64, 0x05, 0x1E, 0x06, 0x05, 0x03, 0x16, 0x06, 0x22, 0x02,
+    0x06, 0x06, 0x53, 0x06, 0x6D, 0x03, 0x03, 0x53, 0x82, 0x03, 0x83, 0x05, 0x98, 0x03, 0x8B, 0x05,
+    0x83, 0x06, 0x81, 0x05, 0x80, 0x06, 0x85, 0x05, 0x83, 0x04, 0x81, 0x05, 0x89, 0x06, 0x1F, 0x03,
+    0x06, 0x06, 0x20, 0x2A, 0x09, 0x06, 0x64, 0x16, 0x5B, 0x0B, 0x5B, 0x16, 0x06, 0x22, 0x64, 0x58,
+    0x49, 0x20, 0x20, 0x31, 0x57, 0x29, 0x0F, 0x10, 0x17, 0x10, 0x18, 0x39, 0x07, 0x27, 0x23, 0x81,
+    0x10, 0x82, 0x39, 0x11, 0x23, 0x13, 0x23, 0x10, 0x1D, 0x12, 0x1D, 0x6C, 0x37, 0x12, 0x10, 0x18,
+    0x28, 0x39, 0x55, 0x2D, 0x56, 0x37, 0x81, 0x44, 0x85, 0x35, 0x03, 0x1A, 0x37, 0x45, 0x35, 0x88,
+    0x0C, 0x3A, 0x45, 0x72, 0x58, 0x19, 0x49, 0x3C, 0x54, 0x54, 0x19, 0x14, 0x58, 0x20, 0x20, 0x1F,
+    0x58, 0x6E, 0x6E, 0x1F, 0x1F, 0x20, 0x1F, 0x3F, 0x64, 0x4B, 0x5E, 0x1F, 0x48, 0x3C, 0x2D, 0x37,
+    0x56, 0x37, 0x12, 0x17, 0x37, 0x1A, 0x44, 0x19, 0x50, 0x3F, 0x5F, 0x34, 0x12, 0x74, 0x10, 0x0F,
+    0x55, 0x0F, 0x23, 0x0F, 0x55, 0x74, 0x65, 0x0F, 0x12, 0x44, 0x3D, 0x2E, 0x65, 0x82, 0x12, 0x81,
+    0x56, 0x13, 0x2B, 0x7F, 0x7F, 0x3D, 0x56, 0x2E, 0x2A, 0x42, 0x3F, 0x09, 0x06, 0x53, 0x22, 0x0A,
+    0x06, 0x06, 0x16, 0x06, 0x02, 0x05, 0x82, 0x06, 0x83, 0x03, 0x82, 0x06, 0x87, 0x05, 0x89, 0x03,
+    0x82, 0x6D, 0x87, 0x03, 0x8C, 0x05, 0x83, 0x06, 0x85, 0x05, 0x80, 0x06, 0x86, 0x05, 0x89, 0x06,
+    0x1F, 0x0A, 0x06, 0x16, 0x20, 0x31, 0x16, 0x06, 0x1B, 0x06, 0x7B, 0x0B, 0x16, 0x06, 0x16, 0x4B,
+    0x01, 0x5F, 0x58, 0x01, 0x14, 0x2E, 0x25, 0x37, 0x55, 0x65, 0x12, 0x10, 0x10, 0x39, 0x39, 0x28,
+    0x23, 0x81, 0x10, 0x82, 0x39, 0x13, 0x23, 0x65, 0x23, 0x10, 0x0E, 0x12, 0x0E, 0x1D, 0x17, 0x17,
+    0x10, 0x10, 0x28, 0x10, 0x6C, 0x43, 0x56, 0x37, 0x44, 0x45, 0x87, 0x35, 0x81, 0x0C, 0x80, 0x29,
+    0x87, 0x0C, 0x0C, 0x45, 0x72, 0x49, 0x49, 0x19, 0x49, 0x54, 0x6E, 0x14, 0x14, 0x58, 0x08, 0x20,
+    0x86, 0x14, 0x3D, 0x20, 0x3F, 0x22, 0x4B, 0x22, 0x76, 0x5F, 0x42, 0x54, 0x44, 0x1A, 0x1A, 0x12,
+    0x37, 0x12, 0x2F, 0x2E, 0x5C, 0x53, 0x20, 0x49, 0x25, 0x65, 0x0F, 0x10, 0x0F, 0x55, 0x0F, 0x0F,
+    0x74, 0x55, 0x0E, 0x74, 0x65, 0x1D, 0x56, 0x59, 0x5A, 0x44, 0x12, 0x37, 0x12, 0x56, 0x56, 0x2E,
+    0x80, 0x7F, 0x42, 0x56, 0x44, 0x3D, 0x5F, 0x19, 0x49, 0x06, 0x06, 0x16, 0x0A, 0x06, 0x22, 0x16,
+    0x0A, 0x81, 0x05, 0x82, 0x06, 0x81, 0x09, 0x85, 0x06, 0x87, 0x05, 0x89, 0x03, 0x81, 0x6D, 0x87,
+    0x03, 0x8F, 0x05, 0x81, 0x06, 0x82, 0x05, 0x82, 0x06, 0x86, 0x05, 0x88, 0x06, 0x20, 0x53, 0x0A,
+    0x22, 0x0A, 0x14, 0x14, 0x16, 0x0A, 0x06, 0x0B, 0x0B, 0x16, 0x06, 0x16, 0x06, 0x22, 0x20, 0x5C,
+    0x3F, 0x3F, 0x42, 0x2E, 0x44, 0x65, 0x65, 0x2F, 0x65, 0x39, 0x10, 0x39, 0x39, 0x18, 0x23, 0x81,
+    0x10, 0x82, 0x39, 0x13, 0x23, 0x65, 0x0F, 0x10, 0x13, 0x17, 0x74, 0x0E, 0x12, 0x1A, 0x0F, 0x10,
+    0x10, 0x0F, 0x38, 0x38, 0x37, 0x37, 0x56, 0x45, 0x82, 0x35, 0x04, 0x11, 0x35, 0x35, 0x11, 0x35,
+    0x8A, 0x0C, 0x0F, 0x44, 0x33, 0x14, 0x14, 0x19, 0x19, 0x58, 0x58, 0x14, 0x14, 0x58, 0x20, 0x14,
+    0x20, 0x20, 0x14, 0x82, 0x19, 0x27, 0x1F, 0x00, 0x3F, 0x04, 0x64, 0x5E, 0x22, 0x5E, 0x48, 0x7C,
+    0x54, 0x37, 0x37, 0x56, 0x1A, 0x12, 0x2F, 0x2A, 0x7B, 0x0B, 0x1F, 0x31, 0x29, 0x0F, 0x55, 0x23,
+    0x0F, 0x0F, 0x74, 0x13, 0x74, 0x74, 0x0F, 0x65, 0x55, 0x17, 0x65, 0x3D, 0x5A, 0x44, 0x82, 0x12,
+    0x0F, 0x37, 0x56, 0x29, 0x14, 0x7F, 0x04, 0x5A, 0x56, 0x44, 0x2B, 0x19, 0x48, 0x5F, 0x02, 0x7E,
+    0x0A, 0x82, 0x06, 0x81, 0x0A, 0x84, 0x06, 0x80, 0x09, 0x85, 0x06, 0x80, 0x05, 0x82, 0x03, 0x83,
+    0x05, 0x93, 0x03, 0x8F, 0x05, 0x83, 0x06, 0x80, 0x05, 0x82, 0x06, 0x85, 0x05, 0x81, 0x06, 0x82,
+    0x05, 0x84, 0x06, 0x1F, 0x53, 0x64, 0x22, 0x0A, 0x42, 0x00, 0x64, 0x0A, 0x5B, 0x06, 0x5B, 0x0B,
+    0x64, 0x1E, 0x06, 0x3F, 0x0D, 0x5E, 0x3F, 0x1F, 0x2A, 0x33, 0x17, 0x0F, 0x12, 0x29, 0x55, 0x39,
+    0x10, 0x39, 0x07, 0x18, 0x82, 0x10, 0x82, 0x39, 0x0E, 0x23, 0x13, 0x0F, 0x10, 0x23, 0x17, 0x74,
+    0x0E, 0x1D, 0x1A, 0x74, 0x10, 0x0F, 0x74, 0x51, 0x82, 0x37, 0x81, 0x56, 0x81, 0x35, 0x80, 0x11,
+    0x84, 0x35, 0x88, 0x0C, 0x05, 0x29, 0x0C, 0x45, 0x33, 0x58, 0x19, 0x83, 0x14, 0x03, 0x58, 0x14,
+    0x20, 0x58, 0x83, 0x19, 0x34, 0x31, 0x42, 0x19, 0x20, 0x01, 0x02, 0x04, 0x1E, 0x5E, 0x4B, 0x1E,
+    0x06, 0x5F, 0x20, 0x49, 0x56, 0x17, 0x37, 0x37, 0x2D, 0x58, 0x16, 0x04, 0x01, 0x2A, 0x0F, 0x0E,
+    0x23, 0x13, 0x55, 0x0F, 0x65, 0x0F, 0x74, 0x74, 0x0F, 0x65, 0x65, 0x74, 0x12, 0x37, 0x2B, 0x44,
+    0x12, 0x65, 0x37, 0x37, 0x56, 0x29, 0x42, 0x7F, 0x04, 0x19, 0x82, 0x44, 0x05, 0x57, 0x42, 0x2A,
+    0x14, 0x3F, 0x04, 0x82, 0x06, 0x04, 0x16, 0x0A, 0x22, 0x06, 0x22, 0x81, 0x06, 0x81, 0x22, 0x85,
+    0x06, 0x82, 0x03, 0x84, 0x05, 0x92, 0x03, 0x8F, 0x05, 0x84, 0x06, 0x88, 0x05, 0x81, 0x06, 0x81,
+    0x05, 0x85, 0x06, 0x20, 0x53, 0x64, 0x22, 0x06, 0x31, 0x03, 0x64, 0x0A, 0x16, 0x5B, 0x16, 0x1E,
+    0x16, 0x04, 0x80, 0x05, 0x0A, 0x04, 0x1F, 0x1F, 0x5F, 0x29, 0x0E, 0x37, 0x44, 0x29, 0x10, 0x10,
+    0x28, 0x39, 0x07, 0x0F, 0x23, 0x81, 0x10, 0x82, 0x39, 0x0D, 0x10, 0x0F, 0x0F, 0x10, 0x23, 0x12,
+    0x74, 0x0F, 0x0E, 0x1A, 0x17, 0x0F, 0x0E, 0x12, 0x83, 0x37, 0x05, 0x2F, 0x56, 0x43, 0x35, 0x11,
+    0x35, 0x82, 0x0C, 0x81, 0x35, 0x87, 0x0C, 0x04, 0x29, 0x0C, 0x45, 0x33, 0x20, 0x82, 0x14, 0x82,
+    0x58, 0x03, 0x14, 0x58, 0x58, 0x19, 0x83, 0x24, 0x07, 0x42, 0x14, 0x20, 0x0A, 0x04, 0x22, 0x64,
+    0x22, 0x82, 0x1E, 0x32, 0x4B, 0x3F, 0x3F, 0x49, 0x59, 0x37, 0x12, 0x2E, 0x7B, 0x7F, 0x3F, 0x7B,
+    0x25, 0x18, 0x23, 0x23, 0x0F, 0x55, 0x0F, 0x65, 0x74, 0x65, 0x0E, 0x0E, 0x12, 0x55, 0x74, 0x37,
+    0x10, 0x29, 0x5A, 0x65, 0x37, 0x12, 0x12, 0x37, 0x29, 0x5F, 0x80, 0x80, 0x7F, 0x3D, 0x29, 0x56,
+    0x3D, 0x31, 0x19, 0x31, 0x19, 0x3F, 0x7F, 0x82, 0x06, 0x80, 0x0A, 0x8E, 0x06, 0x80, 0x53, 0x86,
+    0x05, 0x90, 0x03, 0x8F, 0x05, 0x84, 0x06, 0x80, 0x05, 0x81, 0x04, 0x81, 0x05, 0x82, 0x06, 0x84,
+    0x05, 0x85, 0x06, 0x19, 0x53, 0x0A, 0x22, 0x06, 0x31, 0x03, 0x06, 0x06, 0x16, 0x06, 0x5B, 0x06,
+    0x80, 0x80, 0x06, 0x64, 0x04, 0x02, 0x3F, 0x1F, 0x34, 0x65, 0x56, 0x56, 0x3D, 0x44, 0x82, 0x10,
+    0x81, 0x39, 0x07, 0x65, 0x23, 0x10, 0x10, 0x39, 0x28, 0x39, 0x10, 0x82, 0x23, 0x10, 0x10, 0x0E,
+    0x12, 0x65, 0x65, 0x17, 0x51, 0x12, 0x74, 0x12, 0x12, 0x37, 0x1A, 0x37, 0x2F, 0x56, 0x45, 0x81,
+    0x35, 0x82, 0x0C, 0x80, 0x44, 0x8B, 0x0C, 0x02, 0x45, 0x33, 0x20, 0x82, 0x14, 0x12, 0x6E, 0x58,
+    0x14, 0x14, 0x58, 0x19, 0x2A, 0x24, 0x24, 0x2A, 0x31, 0x14, 0x1F, 0x02, 0x0A, 0x64, 0x1E, 0x1E,
+    0x64, 0x81, 0x1E, 0x82, 0x4B, 0x34, 0x0A, 0x1F, 0x02, 0x36, 0x12, 0x19, 0x7B, 0x06, 0x7B, 0x50,
+    0x1D, 0x0F, 0x10, 0x55, 0x13, 0x0F, 0x0F, 0x12, 0x37, 0x55, 0x0E, 0x74, 0x12, 0x55, 0x12, 0x74,
+    0x12, 0x65, 0x3D, 0x37, 0x1D, 0x65, 0x12, 0x12, 0x56, 0x2B, 0x80, 0x02, 0x7F, 0x5F, 0x44, 0x44,
+    0x56, 0x2B, 0x19, 0x31, 0x31, 0x19, 0x3F, 0x04, 0x06, 0x06, 0x7E, 0x85, 0x06, 0x81, 0x22, 0x88,
+    0x06, 0x86, 0x05, 0x8F, 0x03, 0x89, 0x05, 0x82, 0x53, 0x86, 0x06, 0x81, 0x05, 0x81, 0x04, 0x82,
+    0x05, 0x80, 0x06, 0x83, 0x05, 0x81, 0x53, 0x86, 0x06, 0x2F, 0x0A, 0x22, 0x22, 0x42, 0x01, 0x06,
+    0x22, 0x64, 0x22, 0x80, 0x3F, 0x04, 0x1E, 0x0A, 0x01, 0x0D, 0x80, 0x02, 0x24, 0x44, 0x12, 0x36,
+    0x29, 0x2E, 0x37, 0x10, 0x28, 0x10, 0x39, 0x10, 0x1D, 0x23, 0x10, 0x10, 0x39, 0x28, 0x39, 0x10,
+    0x10, 0x23, 0x23, 0x10, 0x23, 0x17, 0x12, 0x65, 0x12, 0x1A, 0x81, 0x37, 0x81, 0x12, 0x83, 0x37,
+    0x81, 0x56, 0x81, 0x35, 0x85, 0x0C, 0x81, 0x35, 0x87, 0x0C, 0x17, 0x44, 0x33, 0x20, 0x14, 0x14,
+    0x58, 0x6E, 0x58, 0x14, 0x14, 0x58, 0x24, 0x57, 0x24, 0x2A, 0x2A, 0x14, 0x20, 0x20, 0x03, 0x0A,
+    0x16, 0x1B, 0x64, 0x82, 0x1E, 0x38, 0x1B, 0x4B, 0x4B, 0x1E, 0x5B, 0x5F, 0x2A, 0x36, 0x05, 0x7F,
+    0x1B, 0x4E, 0x3C, 0x10, 0x18, 0x10, 0x55, 0x23, 0x0F, 0x55, 0x12, 0x44, 0x65, 0x74, 0x65, 0x0F,
+    0x0E, 0x55, 0x12, 0x37, 0x74, 0x12, 0x56, 0x13, 0x65, 0x12, 0x12, 0x37, 0x29, 0x5F, 0x04, 0x7F,
+    0x7F, 0x29, 0x44, 0x56, 0x3D, 0x19, 0x42, 0x2A, 0x31, 0x14, 0x02, 0x05, 0x06, 0x04, 0x05, 0x90,
+    0x06, 0x85, 0x05, 0x8F, 0x03, 0x89, 0x05, 0x81, 0x53, 0x82, 0x06, 0x80, 0x05, 0x81, 0x06, 0x85,
+    0x05, 0x80, 0x04, 0x86, 0x05, 0x81, 0x53, 0x83, 0x06, 0x81, 0x22, 0x32, 0x06, 0x0A, 0x22, 0x06,
+    0x19, 0x04, 0x64, 0x22, 0x05, 0x7C, 0x76, 0x4B, 0x64, 0x04, 0x00, 0x0D, 0x01, 0x7E, 0x20, 0x2E,
+    0x65, 0x29, 0x3D, 0x36, 0x2B, 0x65, 0x28, 0x28, 0x10, 0x10, 0x0F, 0x6C, 0x23, 0x10, 0x10, 0x39,
+    0x28, 0x39, 0x10, 0x23, 0x10, 0x0F, 0x10, 0x10, 0x6C, 0x12, 0x65, 0x65, 0x1A, 0x2F, 0x37, 0x82,
+    0x12, 0x82, 0x37, 0x81, 0x56, 0x81, 0x35, 0x01, 0x0C, 0x35, 0x88, 0x0C, 0x80, 0x35, 0x83, 0x0C,
+    0x1A, 0x44, 0x72, 0x20, 0x14, 0x14, 0x58, 0x6E, 0x14, 0x14, 0x58, 0x14, 0x2C, 0x24, 0x2A, 0x2A,
+    0x49, 0x81, 0x03, 0x6E, 0x03, 0x0A, 0x0B, 0x1B, 0x22, 0x1B, 0x1E, 0x4B, 0x83, 0x1E, 0x11, 0x1B,
+    0x58, 0x2E, 0x2B, 0x7B, 0x7F, 0x1B, 0x0B, 0x68, 0x43, 0x07, 0x28, 0x55, 0x23, 0x13, 0x10, 0x37,
+    0x32, 0x82, 0x12, 0x01, 0x13, 0x74, 0x81, 0x65, 0x82, 0x12, 0x01, 0x37, 0x74, 0x82, 0x12, 0x81,
+    0x56, 0x10, 0x3D, 0x76, 0x7F, 0x06, 0x42, 0x44, 0x29, 0x29, 0x57, 0x1F, 0x5F, 0x48, 0x42, 0x1F,
+    0x0D, 0x03, 0x0A, 0x83, 0x06, 0x03, 0x09, 0x3B, 0x3B, 0x0B, 0x83, 0x06, 0x81, 0x05, 0x84, 0x06,
+    0x84, 0x05, 0x8F, 0x03, 0x80, 0x06, 0x82, 0x05, 0x80, 0x06, 0x82, 0x05, 0x84, 0x06, 0x03, 0x05,
+    0x06, 0x06, 0x05, 0x81, 0x06, 0x84, 0x05, 0x13, 0x0D, 0x22, 0x22, 0x53, 0x05, 0x53, 0x53, 0x06,
+    0x06, 0x53, 0x53, 0x05, 0x06, 0x64, 0x64, 0x06, 0x02, 0x20, 0x19, 0x2A, 0x83, 0x34, 0x1E, 0x2C,
+    0x2A, 0x49, 0x20, 0x02, 0x04, 0x04, 0x22, 0x7F, 0x04, 0x57, 0x44, 0x1A, 0x34, 0x59, 0x2B, 0x3D,
+    0x23, 0x18, 0x39, 0x18, 0x39, 0x65, 0x17, 0x10, 0x39, 0x27, 0x28, 0x39, 0x39, 0x18, 0x82, 0x10,
+    0x81, 0x23, 0x14, 0x74, 0x51, 0x12, 0x12, 0x17, 0x1A, 0x37, 0x37, 0x17, 0x37, 0x12, 0x37, 0x56,
+    0x56, 0x45, 0x35, 0x35, 0x0C, 0x35, 0x45, 0x35, 0x86, 0x0C, 0x80, 0x35, 0x83, 0x0C, 0x33, 0x45,
+    0x33, 0x20, 0x19, 0x14, 0x14, 0x6E, 0x20, 0x19, 0x58, 0x24, 0x2C, 0x2C, 0x24, 0x24, 0x81, 0x3B,
+    0x68, 0x5D, 0x4C, 0x5E, 0x61, 0x69, 0x64, 0x4B, 0x4E, 0x0B, 0x4B, 0x64, 0x1B, 0x1B, 0x1E, 0x02,
+    0x32, 0x2C, 0x16, 0x7B, 0x16, 0x4E, 0x36, 0x63, 0x0C, 0x28, 0x10, 0x18, 0x55, 0x13, 0x13, 0x3D,
+    0x44, 0x0E, 0x12, 0x82, 0x65, 0x81, 0x12, 0x25, 0x74, 0x65, 0x55, 0x12, 0x0F, 0x12, 0x37, 0x12,
+    0x37, 0x44, 0x19, 0x02, 0x04, 0x1F, 0x48, 0x2B, 0x57, 0x42, 0x7C, 0x3F, 0x42, 0x5F, 0x42, 0x1F,
+    0x03, 0x1E, 0x09, 0x06, 0x06, 0x09, 0x06, 0x09, 0x0B, 0x3B, 0x0B, 0x06, 0x06, 0x09, 0x83, 0x0B,
+    0x84, 0x06, 0x83, 0x05, 0x8E, 0x03, 0x81, 0x05, 0x81, 0x06, 0x83, 0x05, 0x83, 0x06, 0x82, 0x05,
+    0x01, 0x06, 0x05, 0x81, 0x06, 0x84, 0x05, 0x81, 0x06, 0x81, 0x22, 0x0E, 0x06, 0x05, 0x05, 0x06,
+    0x03, 0x01, 0x7E, 0x06, 0x04, 0x58, 0x31, 0x2C, 0x2B, 0x2B, 0x34, 0x82, 0x2C, 0x81, 0x34, 0x18,
+    0x2E, 0x5A, 0x36, 0x59, 0x36, 0x25, 0x34, 0x2C, 0x14, 0x2A, 0x3D, 0x56, 0x2E, 0x2E, 0x3D, 0x5F,
+    0x29, 0x39, 0x18, 0x10, 0x71, 0x10, 0x1A, 0x1D, 0x23, 0x84, 0x10, 0x81, 0x23, 0x81, 0x10, 0x16,
+    0x23, 0x10, 0x0F, 0x37, 0x1A, 0x65, 0x12, 0x37, 0x56, 0x6C, 0x1A, 0x37, 0x17, 0x37, 0x1A, 0x37,
+    0x2D, 0x2D, 0x45, 0x45, 0x0C, 0x0C, 0x35, 0x86, 0x0C, 0x80, 0x35, 0x84, 0x0C, 0x01, 0x72, 0x00,
+    0x82, 0x20, 0x2C, 0x14, 0x08, 0x14, 0x19, 0x2A, 0x57, 0x24, 0x49, 0x08, 0x7D, 0x66, 0x3B, 0x61,
+    0x61, 0x1B, 0x47, 0x6B, 0x0B, 0x60, 0x1B, 0x69, 0x1E, 0x4B, 0x5E, 0x64, 0x1B, 0x3F, 0x44, 0x50,
+    0x16, 0x0B, 0x4E, 0x4E, 0x59, 0x37, 0x25, 0x33, 0x43, 0x12, 0x55, 0x12, 0x65, 0x3D, 0x2B, 0x56,
+    0x82, 0x12, 0x0C, 0x65, 0x55, 0x55, 0x74, 0x12, 0x12, 0x65, 0x1D, 0x65, 0x12, 0x56, 0x3D, 0x48,
+    0x81, 0x5F, 0x82, 0x1F, 0x0B, 0x7C, 0x76, 0x76, 0x04, 0x01, 0x7C, 0x00, 0x02, 0x02, 0x00, 0x05,
+    0x09, 0x88, 0x06, 0x80, 0x22, 0x82, 0x09, 0x86, 0x06, 0x84, 0x05, 0x8D, 0x03, 0x80, 0x05, 0x82,
+    0x06, 0x85, 0x05, 0x80, 0x53, 0x85, 0x05, 0x81, 0x06, 0x84, 0x05, 0x20, 0x22, 0x53, 0x05, 0x04,
+    0x0A, 0x09, 0x05, 0x05, 0x0A, 0x7E, 0x04, 0x14, 0x2C, 0x33, 0x2E, 0x33, 0x34, 0x2C, 0x2A, 0x42,
+    0x19, 0x19, 0x42, 0x42, 0x14, 0x42, 0x31, 0x48, 0x2B, 0x25, 0x59, 0x29, 0x0C, 0x82, 0x29, 0x05,
+    0x48, 0x3D, 0x2B, 0x48, 0x37, 0x39, 0x83, 0x10, 0x80, 0x1A, 0x88, 0x10, 0x81, 0x23, 0x82, 0x0F,
+    0x11, 0x12, 0x2F, 0x65, 0x12, 0x12, 0x56, 0x37, 0x37, 0x17, 0x51, 0x37, 0x37, 0x2D, 0x45, 0x56,
+    0x0C, 0x0C, 0x45, 0x84, 0x0C, 0x80, 0x2D, 0x88, 0x0C, 0x22, 0x72, 0x00, 0x20, 0x00, 0x58, 0x6E,
+    0x1F, 0x14, 0x14, 0x24, 0x31, 0x14, 0x6D, 0x1B, 0x66, 0x6F, 0x40, 0x61, 0x61, 0x69, 0x64, 0x5D,
+    0x5D, 0x54, 0x1B, 0x1E, 0x64, 0x4B, 0x64, 0x4B, 0x1E, 0x2A, 0x59, 0x7B, 0x06, 0x82, 0x1B, 0x0E,
+    0x7C, 0x2B, 0x59, 0x3D, 0x29, 0x2D, 0x12, 0x0F, 0x13, 0x56, 0x2B, 0x3D, 0x37, 0x37, 0x12, 0x83,
+    0x65, 0x82, 0x12, 0x05, 0x37, 0x56, 0x3D, 0x48, 0x48, 0x5F, 0x82, 0x14, 0x0E, 0x20, 0x00, 0x01,
+    0x04, 0x7F, 0x01, 0x76, 0x76, 0x5E, 0x76, 0x76, 0x03, 0x4C, 0x73, 0x09, 0x85, 0x06, 0x80, 0x09,
+    0x82, 0x06, 0x81, 0x09, 0x01, 0x03, 0x05, 0x84, 0x06, 0x85, 0x05, 0x8C, 0x03, 0x81, 0x05, 0x80,
+    0x06, 0x84, 0x05, 0x81, 0x03, 0x81, 0x53, 0x84, 0x05, 0x80, 0x06, 0x89, 0x05, 0x81, 0x06, 0x0D,
+    0x53, 0x04, 0x06, 0x1F, 0x2C, 0x33, 0x25, 0x2E, 0x2E, 0x2B, 0x2C, 0x57, 0x48, 0x5F, 0x82, 0x42,
+    0x82, 0x19, 0x06, 0x14, 0x1F, 0x3F, 0x1F, 0x5F, 0x48, 0x3D, 0x82, 0x44, 0x11, 0x29, 0x32, 0x2C,
+    0x2B, 0x13, 0x0F, 0x10, 0x71, 0x23, 0x10, 0x13, 0x71, 0x10, 0x23, 0x10, 0x39, 0x28, 0x23, 0x82,
+    0x10, 0x83, 0x0F, 0x11, 0x74, 0x2F, 0x1A, 0x17, 0x1A, 0x6C, 0x56, 0x74, 0x1D, 0x17, 0x11, 0x2F,
+    0x56, 0x44, 0x45, 0x2D, 0x0C, 0x45, 0x83, 0x2D, 0x81, 0x0C, 0x01, 0x2D, 0x45, 0x84, 0x0C, 0x1A,
+    0x2D, 0x45, 0x33, 0x08, 0x20, 0x58, 0x6E, 0x08, 0x14, 0x49, 0x24, 0x57, 0x19, 0x4C, 0x3B, 0x4E,
+    0x61, 0x4D, 0x3E, 0x7D, 0x4D, 0x4E, 0x3B, 0x0B, 0x47, 0x5F, 0x1F, 0x84, 0x1E, 0x26, 0x1B, 0x2B,
+    0x2C, 0x1B, 0x7B, 0x4E, 0x69, 0x0A, 0x7F, 0x7F, 0x2C, 0x2A, 0x48, 0x2E, 0x3D, 0x2B, 0x2E, 0x59,
+    0x36, 0x44, 0x44, 0x37, 0x65, 0x13, 0x65, 0x12, 0x74, 0x55, 0x13, 0x37, 0x5A, 0x57, 0x2A, 0x31,
+    0x14, 0x14, 0x58, 0x20, 0x00, 0x82, 0x01, 0x01, 0x04, 0x5E, 0x82, 0x22, 0x05, 0x64, 0x22, 0x76,
+    0x5E, 0x5E, 0x6D, 0x81, 0x73, 0x83, 0x06, 0x80, 0x5B, 0x81, 0x09, 0x82, 0x06, 0x82, 0x09, 0x84,
+    0x06, 0x86, 0x05, 0x8B, 0x03, 0x84, 0x05, 0x80, 0x06, 0x81, 0x05, 0x81, 0x03, 0x81, 0x53, 0x8B,
+    0x05, 0x12, 0x06, 0x0D, 0x05, 0x16, 0x04, 0x05, 0x06, 0x0A, 0x19, 0x34, 0x5A, 0x5A, 0x25, 0x2B,
+    0x2B, 0x34, 0x57, 0x2A, 0x31, 0x81, 0x19, 0x84, 0x1F, 0x35, 0x19, 0x14, 0x14, 0x1F, 0x14, 0x42,
+    0x5F, 0x31, 0x2B, 0x3D, 0x2F, 0x37, 0x51, 0x2F, 0x13, 0x12, 0x74, 0x23, 0x23, 0x10, 0x55, 0x18,
+    0x23, 0x0F, 0x10, 0x10, 0x23, 0x0F, 0x74, 0x0E, 0x0F, 0x74, 0x0F, 0x0E, 0x65, 0x65, 0x37, 0x0C,
+    0x74, 0x38, 0x12, 0x51, 0x0E, 0x12, 0x12, 0x30, 0x43, 0x56, 0x56, 0x2D, 0x2D, 0x44, 0x45, 0x43,
+    0x83, 0x2D, 0x03, 0x0C, 0x2D, 0x45, 0x2D, 0x83, 0x0C, 0x12, 0x2D, 0x45, 0x25, 0x08, 0x58, 0x03,
+    0x4C, 0x08, 0x14, 0x58, 0x31, 0x19, 0x73, 0x4E, 0x3B, 0x3B, 0x69, 0x69, 0x3B, 0x81, 0x66, 0x82,
+    0x4E, 0x14, 0x5B, 0x34, 0x2E, 0x31, 0x5B, 0x1B, 0x1E, 0x1B, 0x1B, 0x2B, 0x49, 0x7B, 0x1B, 0x4E,
+    0x4E, 0x80, 0x04, 0x7F, 0x1F, 0x57, 0x7C, 0x83, 0x7F, 0x05, 0x76, 0x49, 0x2E, 0x3D, 0x59, 0x29,
+    0x83, 0x44, 0x0C, 0x45, 0x29, 0x2D, 0x3D, 0x42, 0x19, 0x42, 0x00, 0x20, 0x02, 0x02, 0x01, 0x5E,
+    0x82, 0x4B, 0x01, 0x1E, 0x4B, 0x82, 0x1E, 0x08, 0x5B, 0x0A, 0x22, 0x76, 0x00, 0x03, 0x6D, 0x09,
+    0x73, 0x82, 0x06, 0x80, 0x22, 0x8C, 0x06, 0x85, 0x05, 0x8B, 0x03, 0x81, 0x05, 0x81, 0x04, 0x01,
+    0x05, 0x06, 0x8B, 0x05, 0x81, 0x04, 0x81, 0x05, 0x15, 0x06, 0x05, 0x16, 0x05, 0x0A, 0x06, 0x05,
+    0x16, 0x03, 0x31, 0x36, 0x3D, 0x5A, 0x2E, 0x2E, 0x2B, 0x2B, 0x57, 0x2A, 0x31, 0x42, 0x14, 0x83,
+    0x1F, 0x82, 0x3F, 0x81, 0x7C, 0x01, 0x20, 0x1F, 0x82, 0x14, 0x0C, 0x31, 0x5F, 0x57, 0x2B, 0x32,
+    0x2F, 0x2F, 0x12, 0x74, 0x0E, 0x0F, 0x0F, 0x74, 0x81, 0x0F, 0x81, 0x55, 0x83, 0x0F, 0x02, 0x13,
+    0x74, 0x12, 0x82, 0x74, 0x11, 0x65, 0x12, 0x0C, 0x2D, 0x6C, 0x56, 0x51, 0x46, 0x17, 0x51, 0x74,
+    0x56, 0x2D, 0x45, 0x45, 0x0C, 0x0C, 0x35, 0x81, 0x2D, 0x83, 0x43, 0x85, 0x2D, 0x30, 0x0C, 0x2D,
+    0x45, 0x25, 0x08, 0x6E, 0x20, 0x6E, 0x81, 0x58, 0x20, 0x1F, 0x60, 0x66, 0x3B, 0x61, 0x61, 0x69,
+    0x3B, 0x69, 0x4E, 0x61, 0x4E, 0x4E, 0x3B, 0x09, 0x42, 0x2E, 0x3D, 0x2B, 0x14, 0x0A, 0x5B, 0x2A,
+    0x2E, 0x50, 0x16, 0x4E, 0x4E, 0x50, 0x5E, 0x7F, 0x7C, 0x64, 0x19, 0x1F, 0x7F, 0x7F, 0x80, 0x83,
+    0x7F, 0x81, 0x3F, 0x81, 0x19, 0x0B, 0x14, 0x1F, 0x1F, 0x5F, 0x2C, 0x2E, 0x2D, 0x25, 0x19, 0x1F,
+    0x1F, 0x00, 0x81, 0x01, 0x83, 0x22, 0x01, 0x64, 0x5B, 0x85, 0x1E, 0x02, 0x1B, 0x64, 0x04, 0x81,
+    0x01, 0x82, 0x03, 0x80, 0x53, 0x81, 0x06, 0x81, 0x0A, 0x81, 0x06, 0x81, 0x0A, 0x86, 0x06, 0x86,
+    0x05, 0x85, 0x03, 0x81, 0x6D, 0x82, 0x03, 0x85, 0x05, 0x81, 0x06, 0x80, 0x05, 0x84, 0x06, 0x83,
+    0x05, 0x05, 0x04, 0x05, 0x05, 0x06, 0x06, 0x53, 0x82, 0x06, 0x0C, 0x05, 0x06, 0x03, 0x2A, 0x36,
+    0x59, 0x32, 0x32, 0x5A, 0x2E, 0x2B, 0x2B, 0x57, 0x82, 0x5F, 0x83, 0x1F, 0x23, 0x20, 0x00, 0x00,
+    0x7C, 0x76, 0x7C, 0x7C, 0x00, 0x1F, 0x7C, 0x20, 0x00, 0x02, 0x20, 0x1F, 0x20, 0x42, 0x36, 0x56,
+    0x17, 0x17, 0x1D, 0x12, 0x0E, 0x12, 0x37, 0x12, 0x65, 0x0E, 0x0E, 0x55, 0x0F, 0x0F, 0x12, 0x17,
+    0x1D, 0x83, 0x12, 0x13, 0x56, 0x25, 0x37, 0x2F, 0x56, 0x1A, 0x0F, 0x0E, 0x12, 0x12, 0x1A, 0x43,
+    0x43, 0x0C, 0x11, 0x11, 0x35, 0x43, 0x43, 0x2D, 0x81, 0x43, 0x85, 0x2D, 0x46, 0x0C, 0x2D, 0x45,
+    0x25, 0x6E, 0x00, 0x00, 0x54, 0x54, 0x20, 0x54, 0x7D, 0x66, 0x4F, 0x3B, 0x68, 0x61, 0x3B, 0x4E,
+    0x3B, 0x3B, 0x4E, 0x5D, 0x1B, 0x68, 0x4C, 0x4C, 0x08, 0x42, 0x2B, 0x3D, 0x2E, 0x34, 0x3D, 0x2B,
+    0x0B, 0x0B, 0x4E, 0x69, 0x3C, 0x20, 0x04, 0x5E, 0x4B, 0x76, 0x19, 0x76, 0x4B, 0x76, 0x4B, 0x4B,
+    0x0A, 0x7C, 0x04, 0x76, 0x7C, 0x20, 0x1F, 0x42, 0x2C, 0x34, 0x57, 0x14, 0x00, 0x5A, 0x2E, 0x81,
+    0x20, 0x22, 0x01, 0x5E, 0x82, 0x4B, 0x81, 0x64, 0x02, 0x1E, 0x16, 0x5B, 0x85, 0x1E, 0x0D, 0x5B,
+    0x0A, 0x7E, 0x01, 0x01, 0x03, 0x03, 0x06, 0x09, 0x06, 0x06, 0x22, 0x22, 0x06, 0x82, 0x0A, 0x01,
+    0x06, 0x22, 0x82, 0x06, 0x87, 0x05, 0x84, 0x03, 0x81, 0x6D, 0x82, 0x03, 0x83, 0x05, 0x01, 0x06,
+    0x05, 0x88, 0x06, 0x85, 0x05, 0x81, 0x06, 0x81, 0x53, 0x23, 0x06, 0x05, 0x0A, 0x0A, 0x2C, 0x59,
+    0x0C, 0x29, 0x29, 0x32, 0x5A, 0x2E, 0x2B, 0x2B, 0x57, 0x2A, 0x31, 0x42, 0x14, 0x1F, 0x1F, 0x3F,
+    0x3F, 0x80, 0x76, 0x7C, 0x76, 0x04, 0x80, 0x02, 0x3F, 0x7F, 0x00, 0x02, 0x7C, 0x00, 0x82, 0x1F,
+    0x1D, 0x3F, 0x42, 0x57, 0x2E, 0x5A, 0x36, 0x59, 0x57, 0x32, 0x56, 0x12, 0x12, 0x65, 0x55, 0x0F,
+    0x74, 0x74, 0x65, 0x6C, 0x12, 0x17, 0x37, 0x37, 0x65, 0x25, 0x62, 0x12, 0x2F, 0x45, 0x0E, 0x83,
+    0x18, 0x05, 0x0E, 0x12, 0x51, 0x38, 0x2F, 0x43, 0x82, 0x2D, 0x81, 0x43, 0x85, 0x2D, 0x0A, 0x43,
+    0x2D, 0x45, 0x25, 0x6E, 0x81, 0x00, 0x4C, 0x08, 0x58, 0x54, 0x82, 0x7D, 0x36, 0x47, 0x69, 0x61,
+    0x3B, 0x6E, 0x4C, 0x73, 0x6D, 0x5D, 0x60, 0x5D, 0x5D, 0x4C, 0x4C, 0x6E, 0x62, 0x72, 0x32, 0x29,
+    0x32, 0x25, 0x16, 0x0B, 0x4E, 0x3C, 0x58, 0x31, 0x02, 0x04, 0x76, 0x4B, 0x1F, 0x0D, 0x4B, 0x5E,
+    0x1E, 0x4B, 0x76, 0x02, 0x58, 0x1F, 0x19, 0x2A, 0x34, 0x33, 0x34, 0x2A, 0x1F, 0x1F, 0x3F, 0x02,
+    0x33, 0x33, 0x0A, 0x7F, 0x82, 0x5E, 0x03, 0x22, 0x0A, 0x16, 0x5B, 0x82, 0x1B, 0x0B, 0x1E, 0x1B,
+    0x1B, 0x0B, 0x1B, 0x1B, 0x1E, 0x64, 0x0A, 0x0A, 0x01, 0x04, 0x83, 0x06, 0x82, 0x09, 0x84, 0x0A,
+    0x04, 0x06, 0x22, 0x06, 0x06, 0x05, 0x82, 0x03, 0x84, 0x05, 0x83, 0x03, 0x81, 0x6D, 0x82, 0x03,
+    0x85, 0x05, 0x81, 0x04, 0x0E, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x05,
+    0x06, 0x06, 0x05, 0x22, 0x83, 0x06, 0x0F, 0x03, 0x2C, 0x2D, 0x12, 0x2F, 0x2F, 0x29, 0x3D, 0x3D,
+    0x5A, 0x33, 0x2B, 0x57, 0x2A, 0x5F, 0x42, 0x82, 0x1F, 0x11, 0x3F, 0x7C, 0x76, 0x7C, 0x76, 0x76,
+    0x7C, 0x76, 0x01, 0x7C, 0x04, 0x3F, 0x0D, 0x7C, 0x80, 0x3F, 0x3F, 0x20, 0x83, 0x1F, 0x1E, 0x20,
+    0x34, 0x42, 0x3F, 0x1F, 0x48, 0x29, 0x12, 0x74, 0x12, 0x12, 0x0F, 0x12, 0x55, 0x37, 0x1A, 0x37,
+    0x1A, 0x2F, 0x12, 0x12, 0x54, 0x67, 0x74, 0x2F, 0x1A, 0x0E, 0x46, 0x12, 0x0E, 0x41, 0x83, 0x46,
+    0x80, 0x41, 0x85, 0x46, 0x80, 0x38, 0x82, 0x43, 0x11, 0x38, 0x43, 0x0C, 0x2D, 0x32, 0x03, 0x08,
+    0x4C, 0x4C, 0x5C, 0x08, 0x6E, 0x20, 0x7A, 0x6F, 0x7D, 0x15, 0x11, 0x82, 0x77, 0x80, 0x21, 0x82,
+    0x77, 0x82, 0x11, 0x0F, 0x77, 0x79, 0x21, 0x21, 0x79, 0x51, 0x1A, 0x63, 0x0B, 0x4E, 0x0B, 0x36,
+    0x33, 0x7B, 0x24, 0x22, 0x82, 0x5E, 0x07, 0x24, 0x4B, 0x4B, 0x04, 0x76, 0x5E, 0x5E, 0x19, 0x83,
+    0x24, 0x18, 0x19, 0x1F, 0x20, 0x3F, 0x02, 0x3F, 0x7F, 0x76, 0x33, 0x2C, 0x0A, 0x01, 0x01, 0x5E,
+    0x1E, 0x09, 0x5B, 0x0B, 0x7B, 0x1B, 0x1E, 0x1B, 0x0B, 0x3B, 0x4E, 0x83, 0x1B, 0x04, 0x1E, 0x16,
+    0x06, 0x22, 0x01, 0x82, 0x0A, 0x81, 0x06, 0x03, 0x09, 0x06, 0x0A, 0x06, 0x81, 0x0A, 0x84, 0x06,
+    0x83, 0x03, 0x86, 0x05, 0x80, 0x03, 0x81, 0x6D, 0x82, 0x03, 0x8C, 0x05, 0x82, 0x04, 0x80, 0x06,
+    0x81, 0x05, 0x81, 0x06, 0x81, 0x22, 0x82, 0x06, 0x32, 0x22, 0x42, 0x59, 0x12, 0x12, 0x37, 0x56,
+    0x45, 0x36, 0x36, 0x3D, 0x2E, 0x2B, 0x57, 0x2A, 0x5F, 0x19, 0x1F, 0x1F, 0x3F, 0x7C, 0x7C, 0x02,
+    0x7C, 0x1C, 0x1C, 0x7C, 0x1C, 0x01, 0x1C, 0x02, 0x76, 0x5E, 0x0D, 0x04, 0x01, 0x02, 0x76, 0x02,
+    0x20, 0x1F, 0x1F, 0x34, 0x31, 0x02, 0x7C, 0x58, 0x1F, 0x42, 0x2E, 0x29, 0x82, 0x56, 0x0D, 0x12,
+    0x37, 0x65, 0x37, 0x2F, 0x37, 0x12, 0x2F, 0x1A, 0x12, 0x54, 0x11, 0x17, 0x51, 0x83, 0x41, 0x81,
+    0x21, 0x81, 0x41, 0x83, 0x26, 0x18, 0x21, 0x77, 0x77, 0x26, 0x26, 0x41, 0x46, 0x79, 0x38, 0x43,
+    0x43, 0x45, 0x0C, 0x6E, 0x6E, 0x01, 0x4C, 0x54, 0x5C, 0x54, 0x6A, 0x77, 0x21, 0x7D, 0x7A, 0x82,
+    0x21, 0x80, 0x77, 0x8B, 0x21, 0x42, 0x0E, 0x17, 0x3C, 0x0B, 0x4E, 0x62, 0x11, 0x29, 0x04, 0x24,
+    0x80, 0x5E, 0x76, 0x4B, 0x02, 0x58, 0x4B, 0x7F, 0x76, 0x5E, 0x4B, 0x5E, 0x76, 0x01, 0x01, 0x76,
+    0x76, 0x80, 0x02, 0x00, 0x80, 0x02, 0x04, 0x80, 0x00, 0x2E, 0x49, 0x5E, 0x0A, 0x22, 0x1E, 0x0B,
+    0x16, 0x5B, 0x4E, 0x1B, 0x4E, 0x1B, 0x1B, 0x4E, 0x4E, 0x6B, 0x6B, 0x69, 0x1B, 0x0B, 0x06, 0x1E,
+    0x1E, 0x22, 0x0D, 0x0A, 0x0A, 0x09, 0x22, 0x5B, 0x22, 0x83, 0x0A, 0x87, 0x06, 0x87, 0x05, 0x80,
+    0x03, 0x81, 0x6D, 0x82, 0x03, 0x8C, 0x05, 0x81, 0x04, 0x82, 0x05, 0x02, 0x06, 0x05, 0x22, 0x82,
+    0x06, 0x18, 0x03, 0x06, 0x20, 0x3D, 0x12, 0x13, 0x12, 0x17, 0x37, 0x56, 0x29, 0x32, 0x3D, 0x2E,
+    0x33, 0x48, 0x48, 0x5F, 0x19, 0x1F, 0x3F, 0x3F, 0x7C, 0x02, 0x01, 0x82, 0x76, 0x23, 0x7C, 0x76,
+    0x01, 0x1C, 0x01, 0x06, 0x4B, 0x22, 0x0A, 0x03, 0x01, 0x22, 0x01, 0x02, 0x08, 0x14, 0x14, 0x5E,
+    0x02, 0x08, 0x02, 0x20, 0x19, 0x42, 0x42, 0x48, 0x2B, 0x2B, 0x33, 0x2E, 0x3D, 0x59, 0x25, 0x34,
+    0x3D, 0x56, 0x82, 0x44, 0x03, 0x60, 0x59, 0x17, 0x13, 0x8A, 0x26, 0x81, 0x77, 0x80, 0x21, 0x83,
+    0x26, 0x11, 0x41, 0x46, 0x38, 0x43, 0x45, 0x0C, 0x6E, 0x4C, 0x03, 0x54, 0x4F, 0x1F, 0x62, 0x77,
+    0x21, 0x78, 0x3E, 0x7A, 0x82, 0x21, 0x80, 0x77, 0x8A, 0x21, 0x81, 0x41, 0x15, 0x38, 0x54, 0x68,
+    0x69, 0x11, 0x11, 0x38, 0x48, 0x19, 0x42, 0x4B, 0x76, 0x5E, 0x4B, 0x31, 0x04, 0x4B, 0x5E, 0x4B,
+    0x4B, 0x1E, 0x64, 0x82, 0x22, 0x25, 0x7E, 0x04, 0x04, 0x01, 0x80, 0x03, 0x5E, 0x80, 0x06, 0x14,
+    0x25, 0x6D, 0x22, 0x5B, 0x73, 0x0B, 0x0B, 0x1E, 0x1B, 0x3B, 0x4E, 0x1B, 0x1B, 0x4D, 0x4A, 0x3E,
+    0x4A, 0x40, 0x6B, 0x1B, 0x3B, 0x0B, 0x1B, 0x1E, 0x04, 0x05, 0x06, 0x09, 0x87, 0x0A, 0x86, 0x06,
+    0x87, 0x05, 0x85, 0x03, 0x88, 0x05, 0x81, 0x04, 0x81, 0x05, 0x81, 0x04, 0x82, 0x05, 0x85, 0x06,
+    0x15, 0x64, 0x02, 0x33, 0x37, 0x0E, 0x0E, 0x13, 0x1D, 0x1A, 0x1A, 0x2D, 0x32, 0x3D, 0x2E, 0x2E,
+    0x57, 0x24, 0x49, 0x49, 0x58, 0x5C, 0x0D, 0x81, 0x03, 0x83, 0x6D, 0x81, 0x03, 0x08, 0x04, 0x02,
+    0x76, 0x5E, 0x4B, 0x76, 0x4B, 0x1E, 0x1B, 0x82, 0x04, 0x0C, 0x14, 0x2A, 0x00, 0x06, 0x03, 0x03,
+    0x0A, 0x7C, 0x1F, 0x19, 0x1F, 0x5F, 0x57, 0x83, 0x2B, 0x0B, 0x2C, 0x19, 0x02, 0x19, 0x36, 0x17,
+    0x5A, 0x25, 0x24, 0x50, 0x35, 0x38, 0x89, 0x26, 0x01, 0x21, 0x77, 0x86, 0x26, 0x10, 0x41, 0x79,
+    0x38, 0x43, 0x43, 0x20, 0x4C, 0x4C, 0x60, 0x4F, 0x5F, 0x6A, 0x21, 0x21, 0x77, 0x21, 0x26, 0x81,
+    0x21, 0x81, 0x77, 0x89, 0x21, 0x2C, 0x26, 0x28, 0x28, 0x35, 0x5D, 0x53, 0x5D, 0x43, 0x43, 0x38,
+    0x2C, 0x0B, 0x2C, 0x7C, 0x4B, 0x5E, 0x4B, 0x20, 0x02, 0x1B, 0x1E, 0x1E, 0x16, 0x1E, 0x64, 0x04,
+    0x01, 0x01, 0x22, 0x22, 0x5E, 0x01, 0x04, 0x22, 0x01, 0x04, 0x7F, 0x0A, 0x2C, 0x34, 0x73, 0x09,
+    0x1B, 0x0B, 0x1B, 0x83, 0x3B, 0x81, 0x66, 0x11, 0x47, 0x3E, 0x6F, 0x6F, 0x3E, 0x75, 0x69, 0x4E,
+    0x1B, 0x1B, 0x5B, 0x1E, 0x01, 0x03, 0x0A, 0x16, 0x06, 0x09, 0x85, 0x0A, 0x85, 0x06, 0x81, 0x53,
+    0x80, 0x03, 0x84, 0x05, 0x85, 0x03, 0x85, 0x05, 0x81, 0x06, 0x86, 0x05, 0x80, 0x06, 0x81, 0x05,
+    0x84, 0x06, 0x16, 0x16, 0x06, 0x2A, 0x2D, 0x13, 0x12, 0x12, 0x23, 0x0E, 0x1A, 0x17, 0x56, 0x29,
+    0x3D, 0x2E, 0x34, 0x24, 0x31, 0x31, 0x19, 0x14, 0x5C, 0x0D, 0x81, 0x03, 0x83, 0x4C, 0x81, 0x68,
+    0x81, 0x4C, 0x12, 0x0B, 0x76, 0x47, 0x3A, 0x4D, 0x03, 0x5E, 0x06, 0x06, 0x01, 0x57, 0x5C, 0x02,
+    0x5C, 0x4C, 0x6E, 0x03, 0x20, 0x1F, 0x82, 0x19, 0x81, 0x2A, 0x0F, 0x5F, 0x42, 0x19, 0x5F, 0x02,
+    0x6E, 0x80, 0x3C, 0x71, 0x1D, 0x25, 0x2A, 0x7F, 0x50, 0x30, 0x41, 0x88, 0x26, 0x81, 0x21, 0x86,
+    0x26, 0x81, 0x41, 0x0C, 0x38, 0x43, 0x43, 0x54, 0x4C, 0x73, 0x6E, 0x42, 0x72, 0x78, 0x41, 0x77,
+    0x21, 0x81, 0x26, 0x81, 0x21, 0x81, 0x77, 0x87, 0x21, 0x2B, 0x41, 0x18, 0x28, 0x41, 0x28, 0x63,
+    0x5D, 0x61, 0x54, 0x41, 0x79, 0x30, 0x6E, 0x4E, 0x3C, 0x14, 0x64, 0x22, 0x64, 0x4B, 0x58, 0x5B,
+    0x1E, 0x1E, 0x16, 0x1E, 0x1E, 0x64, 0x4B, 0x5E, 0x5E, 0x22, 0x01, 0x04, 0x22, 0x22, 0x03, 0x0A,
+    0x64, 0x01, 0x03, 0x2E, 0x3C, 0x1B, 0x82, 0x0B, 0x81, 0x3B, 0x01, 0x4D, 0x40, 0x81, 0x3E, 0x81,
+    0x66, 0x82, 0x6F, 0x03, 0x7D, 0x4D, 0x1B, 0x4E, 0x82, 0x1B, 0x81, 0x01, 0x03, 0x09, 0x0A, 0x0A,
+    0x09, 0x85, 0x0A, 0x85, 0x06, 0x82, 0x53, 0x80, 0x03, 0x83, 0x05, 0x85, 0x03, 0x84, 0x05, 0x83,
+    0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x03, 0x06, 0x05, 0x05, 0x22, 0x83, 0x06, 0x18, 0x16,
+    0x5C, 0x3D, 0x17, 0x1D, 0x12, 0x65, 0x0F, 0x74, 0x12, 0x17, 0x2F, 0x0C, 0x36, 0x33, 0x34, 0x57,
+    0x49, 0x49, 0x5C, 0x6E, 0x4C, 0x5D, 0x5D, 0x73, 0x83, 0x5D, 0x83, 0x61, 0x10, 0x47, 0x6D, 0x70,
+    0x7D, 0x6F, 0x6F, 0x3A, 0x5D, 0x01, 0x14, 0x2A, 0x3F, 0x03, 0x4C, 0x6D, 0x0D, 0x00, 0x81, 0x14,
+    0x82, 0x1F, 0x11, 0x31, 0x48, 0x14, 0x19, 0x31, 0x19, 0x1F, 0x59, 0x54, 0x24, 0x07, 0x28, 0x65,
+    0x3D, 0x24, 0x7F, 0x50, 0x43, 0x88, 0x26, 0x81, 0x21, 0x88, 0x26, 0x0C, 0x46, 0x2D, 0x2F, 0x62,
+    0x4D, 0x60, 0x47, 0x24, 0x6A, 0x78, 0x41, 0x77, 0x21, 0x82, 0x26, 0x02, 0x77, 0x78, 0x77, 0x87,
+    0x21, 0x10, 0x26, 0x41, 0x28, 0x13, 0x38, 0x24, 0x53, 0x4E, 0x63, 0x6C, 0x1D, 0x6C, 0x3C, 0x4E,
+    0x4C, 0x63, 0x1B, 0x82, 0x1E, 0x01, 0x08, 0x0D, 0x82, 0x1E, 0x81, 0x16, 0x16, 0x1E, 0x4B, 0x4B,
+    0x5E, 0x7E, 0x04, 0x5E, 0x22, 0x7E, 0x4B, 0x03, 0x0B, 0x7E, 0x06, 0x49, 0x36, 0x73, 0x0B, 0x3B,
+    0x5D, 0x3B, 0x66, 0x4A, 0x82, 0x3E, 0x07, 0x4A, 0x4D, 0x75, 0x6F, 0x6F, 0x7D, 0x4D, 0x69, 0x82,
+    0x1B, 0x07, 0x73, 0x09, 0x02, 0x4C, 0x7E, 0x16, 0x7E, 0x09, 0x85, 0x0A, 0x86, 0x06, 0x82, 0x03,
+    0x82, 0x05, 0x85, 0x03, 0x80, 0x04, 0x82, 0x05, 0x8B, 0x06, 0x02, 0x05, 0x06, 0x22, 0x82, 0x06,
+    0x13, 0x22, 0x06, 0x33, 0x56, 0x0E, 0x12, 0x0F, 0x13, 0x0E, 0x0F, 0x0E, 0x6C, 0x1A, 0x2F, 0x29,
+    0x2E, 0x2C, 0x24, 0x49, 0x3C, 0x82, 0x6E, 0x80, 0x81, 0x84, 0x00, 0x2D, 0x01, 0x4C, 0x5D, 0x61,
+    0x47, 0x4D, 0x47, 0x09, 0x7C, 0x50, 0x4F, 0x3E, 0x3E, 0x4F, 0x2B, 0x58, 0x4C, 0x73, 0x08, 0x00,
+    0x02, 0x19, 0x14, 0x1F, 0x20, 0x19, 0x1F, 0x1F, 0x2C, 0x42, 0x19, 0x14, 0x20, 0x24, 0x1D, 0x43,
+    0x51, 0x71, 0x18, 0x10, 0x13, 0x32, 0x24, 0x7F, 0x3C, 0x2F, 0x86, 0x26, 0x82, 0x21, 0x88, 0x26,
+    0x0B, 0x41, 0x43, 0x51, 0x11, 0x52, 0x67, 0x67, 0x11, 0x6A, 0x77, 0x26, 0x77, 0x83, 0x21, 0x80,
+    0x77, 0x81, 0x78, 0x81, 0x77, 0x85, 0x21, 0x81, 0x28, 0x17, 0x18, 0x46, 0x79, 0x3C, 0x53, 0x61,
+    0x11, 0x46, 0x46, 0x13, 0x1A, 0x24, 0x3B, 0x62, 0x01, 0x1E, 0x1E, 0x16, 0x05, 0x00, 0x16, 0x64,
+    0x16, 0x1E, 0x82, 0x64, 0x84, 0x4B, 0x81, 0x0A, 0x0C, 0x09, 0x73, 0x0B, 0x0B, 0x05, 0x09, 0x25,
+    0x2C, 0x61, 0x61, 0x47, 0x75, 0x4A, 0x82, 0x3E, 0x81, 0x4A, 0x0F, 0x40, 0x4D, 0x66, 0x7D, 0x75,
+    0x4D, 0x69, 0x1B, 0x3B, 0x5B, 0x5B, 0x1B, 0x02, 0x0D, 0x01, 0x16, 0x87, 0x0A, 0x86, 0x06, 0x83,
+    0x03, 0x81, 0x05, 0x85, 0x03, 0x80, 0x04, 0x81, 0x05, 0x89, 0x06, 0x80, 0x05, 0x85, 0x06, 0x06,
+    0x22, 0x06, 0x22, 0x76, 0x0C, 0x2F, 0x1D, 0x81, 0x0E, 0x82, 0x13, 0x05, 0x0E, 0x6C, 0x1A, 0x2F,
+    0x59, 0x33, 0x81, 0x24, 0x82, 0x3C, 0x80, 0x49, 0x82, 0x14, 0x18, 0x1F, 0x19, 0x14, 0x14, 0x19,
+    0x14, 0x14, 0x58, 0x6E, 0x5D, 0x47, 0x4D, 0x61, 0x4C, 0x20, 0x3A, 0x47, 0x2C, 0x5F, 0x4C, 0x6E,
+    0x02, 0x14, 0x7C, 0x19, 0x83, 0x1F, 0x15, 0x14, 0x1F, 0x7C, 0x57, 0x2A, 0x3F, 0x14, 0x00, 0x35,
+    0x11, 0x12, 0x07, 0x28, 0x28, 0x18, 0x18, 0x1D, 0x3D, 0x34, 0x50, 0x49, 0x38, 0x84, 0x26, 0x83,
+    0x21, 0x86, 0x26, 0x0A, 0x21, 0x26, 0x26, 0x46, 0x46, 0x13, 0x13, 0x41, 0x10, 0x78, 0x7A, 0x82,
+    0x21, 0x84, 0x77, 0x02, 0x3E, 0x6F, 0x78, 0x81, 0x77, 0x84, 0x21, 0x81, 0x28, 0x16, 0x41, 0x79,
+    0x1A, 0x3C, 0x0B, 0x54, 0x79, 0x46, 0x78, 0x46, 0x28, 0x65, 0x05, 0x62, 0x49, 0x1B, 0x06, 0x16,
+    0x16, 0x0A, 0x16, 0x16, 0x09, 0x83, 0x16, 0x11, 0x0A, 0x5E, 0x22, 0x1E, 0x0A, 0x0B, 0x0B, 0x60,
+    0x47, 0x5D, 0x1B, 0x5D, 0x0A, 0x02, 0x36, 0x54, 0x4D, 0x75, 0x82, 0x7D, 0x80, 0x4A, 0x83, 0x7D,
+    0x14, 0x75, 0x6B, 0x4D, 0x4D, 0x6B, 0x61, 0x3B, 0x1B, 0x3B, 0x1B, 0x1B, 0x01, 0x0D, 0x05, 0x22,
+    0x16, 0x22, 0x0A, 0x09, 0x0A, 0x09, 0x81, 0x0A, 0x85, 0x06, 0x84, 0x03, 0x81, 0x05, 0x85, 0x03,
+    0x80, 0x06, 0x82, 0x05, 0x8B, 0x06, 0x09, 0x0A, 0x53, 0x06, 0x06, 0x16, 0x4B, 0x5B, 0x57, 0x0C,
+    0x1A, 0x82, 0x0E, 0x81, 0x13, 0x11, 0x0F, 0x65, 0x1D, 0x1A, 0x2F, 0x56, 0x25, 0x57, 0x34, 0x72,
+    0x33, 0x2C, 0x31, 0x49, 0x58, 0x08, 0x5C, 0x14, 0x84, 0x19, 0x04, 0x42, 0x14, 0x14, 0x08, 0x6E,
+    0x82, 0x47, 0x08, 0x73, 0x42, 0x2B, 0x6E, 0x4C, 0x20, 0x1F, 0x1F, 0x14, 0x88, 0x1F, 0x12, 0x34,
+    0x1F, 0x7F, 0x3C, 0x38, 0x13, 0x28, 0x39, 0x71, 0x18, 0x18, 0x13, 0x18, 0x56, 0x72, 0x57, 0x50,
+    0x24, 0x46, 0x82, 0x26, 0x85, 0x21, 0x85, 0x26, 0x81, 0x21, 0x10, 0x26, 0x27, 0x27, 0x26, 0x28,
+    0x26, 0x27, 0x77, 0x78, 0x21, 0x26, 0x21, 0x77, 0x77, 0x21, 0x21, 0x77, 0x82, 0x6F, 0x01, 0x78,
+    0x77, 0x84, 0x21, 0x2E, 0x23, 0x26, 0x79, 0x30, 0x2F, 0x54, 0x61, 0x62, 0x46, 0x51, 0x77, 0x46,
+    0x28, 0x13, 0x31, 0x5D, 0x24, 0x5B, 0x7B, 0x06, 0x5B, 0x1E, 0x0B, 0x16, 0x06, 0x16, 0x5B, 0x1E,
+    0x1E, 0x1B, 0x16, 0x68, 0x60, 0x0B, 0x1B, 0x61, 0x4D, 0x61, 0x60, 0x0B, 0x4C, 0x03, 0x64, 0x72,
+    0x63, 0x66, 0x75, 0x81, 0x7D, 0x86, 0x40, 0x11, 0x4D, 0x6B, 0x61, 0x3B, 0x1B, 0x0B, 0x16, 0x0B,
+    0x16, 0x1B, 0x04, 0x6E, 0x03, 0x7F, 0x0A, 0x03, 0x05, 0x06, 0x82, 0x09, 0x86, 0x06, 0x84, 0x03,
+    0x80, 0x6D, 0x86, 0x03, 0x84, 0x05, 0x80, 0x53, 0x81, 0x05, 0x88, 0x06, 0x18, 0x05, 0x0A, 0x0A,
+    0x06, 0x22, 0x0A, 0x2E, 0x2D, 0x1D, 0x13, 0x13, 0x0E, 0x0E, 0x1D, 0x17, 0x3D, 0x34, 0x34, 0x36,
+    0x56, 0x29, 0x25, 0x36, 0x33, 0x2C, 0x81, 0x3C, 0x83, 0x54, 0x12, 0x3C, 0x19, 0x42, 0x5F, 0x42,
+    0x5F, 0x19, 0x5F, 0x14, 0x19, 0x19, 0x14, 0x6E, 0x4C, 0x08, 0x57, 0x19, 0x6E, 0x08, 0x87, 0x14,
+    0x84, 0x1F, 0x13, 0x2A, 0x31, 0x0D, 0x3C, 0x6E, 0x3D, 0x29, 0x1A, 0x12, 0x13, 0x13, 0x18, 0x18,
+    0x65, 0x56, 0x25, 0x57, 0x06, 0x63, 0x21, 0x81, 0x26, 0x83, 0x21, 0x01, 0x77, 0x21, 0x84, 0x26,
+    0x82, 0x21, 0x01, 0x28, 0x27, 0x84, 0x28, 0x01, 0x21, 0x78, 0x82, 0x21, 0x05, 0x77, 0x21, 0x77,
+    0x77, 0x21, 0x7A, 0x82, 0x7D, 0x80, 0x78, 0x84, 0x21, 0x22, 0x41, 0x18, 0x77, 0x79, 0x0C, 0x68,
+    0x69, 0x67, 0x46, 0x46, 0x21, 0x78, 0x12, 0x0E, 0x33, 0x3B, 0x24, 0x03, 0x06, 0x06, 0x5B, 0x1E,
+    0x5B, 0x1E, 0x5B, 0x1E, 0x09, 0x0B, 0x0B, 0x06, 0x1B, 0x03, 0x0B, 0x3B, 0x61, 0x82, 0x47, 0x08,
+    0x60, 0x73, 0x4C, 0x6D, 0x81, 0x54, 0x59, 0x4F, 0x75, 0x81, 0x3A, 0x81, 0x75, 0x81, 0x3A, 0x82,
+    0x75, 0x14, 0x4D, 0x4E, 0x61, 0x61, 0x66, 0x5D, 0x4B, 0x1E, 0x01, 0x7B, 0x5E, 0x5C, 0x73, 0x76,
+    0x01, 0x06, 0x0A, 0x06, 0x06, 0x09, 0x0A, 0x86, 0x06, 0x84, 0x03, 0x80, 0x6D, 0x86, 0x03, 0x87,
+    0x05, 0x83, 0x06, 0x81, 0x05, 0x81, 0x06, 0x19, 0x05, 0x06, 0x06, 0x64, 0x5B, 0x1B, 0x19, 0x59,
+    0x51, 0x1D, 0x13, 0x0E, 0x0E, 0x13, 0x18, 0x0F, 0x0E, 0x29, 0x5F, 0x7C, 0x34, 0x2F, 0x2D, 0x2D,
+    0x25, 0x24, 0x81, 0x3C, 0x84, 0x54, 0x80, 0x3C, 0x82, 0x42, 0x0A, 0x5F, 0x42, 0x5F, 0x31, 0x42,
+    0x14, 0x42, 0x14, 0x19, 0x31, 0x34, 0x81, 0x08, 0x81, 0x14, 0x81, 0x19, 0x85, 0x14, 0x85, 0x1F,
+    0x15, 0x3C, 0x73, 0x1E, 0x33, 0x2C, 0x5A, 0x3D, 0x31, 0x24, 0x2C, 0x5A, 0x44, 0x32, 0x59, 0x2C,
+    0x2A, 0x68, 0x24, 0x11, 0x11, 0x79, 0x30, 0x81, 0x77, 0x82, 0x21, 0x84, 0x26, 0x81, 0x21, 0x08,
+    0x27, 0x28, 0x28, 0x27, 0x27, 0x26, 0x07, 0x21, 0x78, 0x82, 0x21, 0x0A, 0x77, 0x21, 0x7A, 0x78,
+    0x62, 0x62, 0x3C, 0x49, 0x54, 0x54, 0x3C, 0x83, 0x24, 0x81, 0x3C, 0x05, 0x49, 0x72, 0x72, 0x3B,
+    0x3B, 0x54, 0x82, 0x24, 0x81, 0x54, 0x04, 0x44, 0x32, 0x1B, 0x24, 0x6E, 0x81, 0x3B, 0x82, 0x0B,
+    0x02, 0x1B, 0x1E, 0x68, 0x82, 0x0B, 0x11, 0x1B, 0x3A, 0x7A, 0x5B, 0x3B, 0x6B, 0x47, 0x47, 0x60,
+    0x4C, 0x73, 0x4C, 0x0D, 0x6E, 0x4C, 0x24, 0x43, 0x7A, 0x82, 0x75, 0x82, 0x66, 0x18, 0x75, 0x3A,
+    0x66, 0x4D, 0x61, 0x5D, 0x47, 0x4D, 0x69, 0x1E, 0x4B, 0x1E, 0x4B, 0x6D, 0x14, 0x05, 0x04, 0x01,
+    0x06, 0x09, 0x06, 0x06, 0x0A, 0x06, 0x09, 0x85, 0x06, 0x8C, 0x03, 0x87, 0x05, 0x83, 0x06, 0x81,
+    0x05, 0x81, 0x06, 0x0E, 0x09, 0x06, 0x64, 0x06, 0x05, 0x1E, 0x34, 0x32, 0x51, 0x1D, 0x13, 0x13,
+    0x23, 0x18, 0x28, 0x82, 0x41, 0x08, 0x56, 0x3F, 0x22, 0x2B, 0x2D, 0x35, 0x36, 0x72, 0x24, 0x83,
+    0x3C, 0x82, 0x54, 0x0F, 0x31, 0x24, 0x2C, 0x24, 0x57, 0x2A, 0x5F, 0x31, 0x5F, 0x19, 0x57, 0x14,
+    0x25, 0x31, 0x02, 0x49, 0x83, 0x19, 0x85, 0x14, 0x83, 0x1F, 0x1C, 0x00, 0x1F, 0x3C, 0x3B, 0x14,
+    0x56, 0x25, 0x34, 0x44, 0x3D, 0x19, 0x19, 0x58, 0x24, 0x29, 0x3D, 0x5A, 0x31, 0x19, 0x0B, 0x06,
+    0x03, 0x02, 0x3F, 0x14, 0x58, 0x3C, 0x67, 0x77, 0x82, 0x21, 0x0C, 0x26, 0x21, 0x21, 0x77, 0x27,
+    0x28, 0x27, 0x28, 0x71, 0x27, 0x26, 0x77, 0x7A, 0x82, 0x21, 0x0B, 0x77, 0x41, 0x44, 0x5D, 0x73,
+    0x6D, 0x1B, 0x5B, 0x1E, 0x06, 0x0B, 0x7B, 0x81, 0x1B, 0x82, 0x3B, 0x05, 0x69, 0x6E, 0x2B, 0x61,
+    0x68, 0x0B, 0x82, 0x1B, 0x0B, 0x4E, 0x4D, 0x72, 0x44, 0x09, 0x54, 0x3C, 0x69, 0x3B, 0x0B, 0x3B,
+    0x0B, 0x81, 0x1B, 0x82, 0x0B, 0x2B, 0x1E, 0x47, 0x3A, 0x4F, 0x47, 0x6B, 0x47, 0x6B, 0x60, 0x5D,
+    0x5D, 0x6D, 0x05, 0x7E, 0x09, 0x02, 0x6E, 0x31, 0x59, 0x15, 0x6A, 0x6A, 0x70, 0x4F, 0x66, 0x4D,
+    0x66, 0x4D, 0x4D, 0x3B, 0x5D, 0x4E, 0x4D, 0x70, 0x25, 0x59, 0x33, 0x3C, 0x76, 0x2A, 0x80, 0x04,
+    0x3F, 0x6D, 0x83, 0x06, 0x81, 0x09, 0x84, 0x06, 0x80, 0x09, 0x8C, 0x03, 0x87, 0x05, 0x84, 0x06,
+    0x1E, 0x22, 0x06, 0x06, 0x0A, 0x06, 0x0A, 0x22, 0x1E, 0x06, 0x5A, 0x0C, 0x1A, 0x0F, 0x23, 0x23,
+    0x28, 0x41, 0x26, 0x26, 0x41, 0x41, 0x21, 0x25, 0x61, 0x47, 0x36, 0x45, 0x0C, 0x36, 0x72, 0x24,
+    0x81, 0x3C, 0x83, 0x54, 0x02, 0x3C, 0x2C, 0x72, 0x82, 0x34, 0x0A, 0x57, 0x24, 0x2A, 0x31, 0x19,
+    0x2E, 0x2E, 0x49, 0x19, 0x2A, 0x31, 0x82, 0x42, 0x81, 0x19, 0x83, 0x14, 0x82, 0x1F, 0x81, 0x20,
+    0x1C, 0x24, 0x5D, 0x3B, 0x42, 0x29, 0x45, 0x34, 0x2C, 0x29, 0x29, 0x2A, 0x49, 0x14, 0x34, 0x0C,
+    0x29, 0x2B, 0x20, 0x3F, 0x0D, 0x7C, 0x80, 0x02, 0x02, 0x7C, 0x7C, 0x7F, 0x54, 0x79, 0x83, 0x21,
+    0x0A, 0x77, 0x21, 0x28, 0x07, 0x28, 0x27, 0x28, 0x26, 0x26, 0x77, 0x7A, 0x83, 0x21, 0x07, 0x2D,
+    0x60, 0x49, 0x6E, 0x47, 0x7D, 0x47, 0x0B, 0x83, 0x73, 0x15, 0x4C, 0x4D, 0x4D, 0x68, 0x60, 0x3C,
+    0x33, 0x61, 0x61, 0x3B, 0x16, 0x0B, 0x16, 0x69, 0x1B, 0x5D, 0x59, 0x49, 0x4C, 0x24, 0x61, 0x5D,
+    0x81, 0x61, 0x81, 0x0B, 0x82, 0x3B, 0x0E, 0x68, 0x1B, 0x3B, 0x1B, 0x47, 0x4F, 0x6B, 0x4D, 0x4D,
+    0x47, 0x73, 0x4C, 0x6D, 0x09, 0x4C, 0x82, 0x6D, 0x1B, 0x5D, 0x81, 0x3C, 0x24, 0x72, 0x25, 0x5A,
+    0x63, 0x36, 0x67, 0x70, 0x4D, 0x61, 0x49, 0x66, 0x7A, 0x78, 0x77, 0x77, 0x21, 0x38, 0x24, 0x31,
+    0x3F, 0x7F, 0x3F, 0x03, 0x16, 0x89, 0x06, 0x80, 0x09, 0x8C, 0x03, 0x87, 0x05, 0x83, 0x06, 0x81,
+    0x22, 0x81, 0x06, 0x08, 0x04, 0x0A, 0x06, 0x7E, 0x31, 0x20, 0x29, 0x45, 0x1D, 0x81, 0x23, 0x81,
+    0x41, 0x82, 0x26, 0x0F, 0x41, 0x27, 0x21, 0x30, 0x62, 0x40, 0x62, 0x59, 0x0C, 0x0C, 0x36, 0x72,
+    0x2C, 0x3C, 0x54, 0x3C, 0x82, 0x54, 0x80, 0x24, 0x84, 0x33, 0x81, 0x2C, 0x81, 0x2A, 0x03, 0x45,
+    0x57, 0x57, 0x2C, 0x81, 0x57, 0x81, 0x5F, 0x83, 0x19, 0x82, 0x14, 0x82, 0x1F, 0x1E, 0x20, 0x19,
+    0x49, 0x3B, 0x5D, 0x1F, 0x2B, 0x37, 0x5A, 0x57, 0x42, 0x2E, 0x29, 0x2B, 0x58, 0x81, 0x2E, 0x45,
+    0x32, 0x42, 0x80, 0x03, 0x53, 0x5C, 0x08, 0x08, 0x0D, 0x02, 0x3F, 0x05, 0x62, 0x83, 0x21, 0x81,
+    0x26, 0x37, 0x27, 0x28, 0x28, 0x26, 0x21, 0x21, 0x26, 0x77, 0x78, 0x26, 0x21, 0x21, 0x46, 0x62,
+    0x3C, 0x58, 0x4C, 0x7D, 0x6F, 0x66, 0x16, 0x68, 0x0B, 0x5B, 0x68, 0x0B, 0x68, 0x4C, 0x66, 0x7D,
+    0x7A, 0x57, 0x69, 0x61, 0x0B, 0x09, 0x09, 0x0B, 0x0B, 0x06, 0x1B, 0x63, 0x57, 0x1B, 0x24, 0x47,
+    0x6B, 0x61, 0x6B, 0x69, 0x61, 0x61, 0x4E, 0x3B, 0x1B, 0x3B, 0x82, 0x69, 0x2B, 0x4F, 0x47, 0x4D,
+    0x75, 0x47, 0x6D, 0x53, 0x09, 0x03, 0x0D, 0x4C, 0x6D, 0x6E, 0x0D, 0x68, 0x5D, 0x3B, 0x60, 0x73,
+    0x5D, 0x5D, 0x6E, 0x2C, 0x36, 0x52, 0x63, 0x62, 0x75, 0x78, 0x7D, 0x77, 0x21, 0x77, 0x21, 0x46,
+    0x34, 0x05, 0x02, 0x00, 0x3F, 0x08, 0x09, 0x0A, 0x22, 0x85, 0x06, 0x81, 0x09, 0x81, 0x03, 0x80,
+    0x6D, 0x89, 0x03, 0x83, 0x05, 0x15, 0x53, 0x03, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x22, 0x06,
+    0x22, 0x06, 0x50, 0x01, 0x80, 0x72, 0x28, 0x29, 0x45, 0x1A, 0x1D, 0x13, 0x81, 0x28, 0x82, 0x26,
+    0x0E, 0x41, 0x26, 0x46, 0x41, 0x78, 0x25, 0x0B, 0x0B, 0x36, 0x2D, 0x2D, 0x59, 0x25, 0x72, 0x24,
+    0x81, 0x3C, 0x83, 0x54, 0x10, 0x2C, 0x33, 0x25, 0x25, 0x36, 0x25, 0x33, 0x33, 0x12, 0x29, 0x2A,
+    0x34, 0x33, 0x34, 0x2A, 0x2A, 0x5F, 0x82, 0x42, 0x82, 0x19, 0x81, 0x14, 0x82, 0x1F, 0x1E, 0x2A,
+    0x5D, 0x5D, 0x5F, 0x42, 0x2A, 0x29, 0x44, 0x34, 0x24, 0x19, 0x57, 0x3D, 0x3D, 0x2A, 0x3C, 0x36,
+    0x32, 0x2B, 0x02, 0x3F, 0x06, 0x05, 0x5C, 0x22, 0x5C, 0x04, 0x00, 0x3F, 0x4C, 0x52, 0x84, 0x21,
+    0x82, 0x26, 0x88, 0x21, 0x22, 0x63, 0x54, 0x24, 0x4C, 0x4D, 0x6F, 0x6F, 0x47, 0x5B, 0x5B, 0x0B,
+    0x09, 0x68, 0x3B, 0x73, 0x3A, 0x6F, 0x6F, 0x7A, 0x48, 0x69, 0x68, 0x69, 0x1B, 0x16, 0x53, 0x09,
+    0x53, 0x0B, 0x54, 0x72, 0x3B, 0x3C, 0x60, 0x6B, 0x81, 0x61, 0x82, 0x6B, 0x81, 0x4D, 0x24, 0x47,
+    0x61, 0x0B, 0x3B, 0x66, 0x6F, 0x4F, 0x75, 0x66, 0x6E, 0x4C, 0x03, 0x04, 0x4C, 0x7B, 0x22, 0x0B,
+    0x60, 0x5D, 0x5D, 0x73, 0x4C, 0x68, 0x6E, 0x6E, 0x4C, 0x5D, 0x1E, 0x68, 0x36, 0x46, 0x60, 0x4F,
+    0x77, 0x78, 0x21, 0x77, 0x82, 0x21, 0x07, 0x38, 0x19, 0x02, 0x1F, 0x68, 0x60, 0x1B, 0x09, 0x86,
+    0x06, 0x81, 0x09, 0x81, 0x03, 0x80, 0x6D, 0x89, 0x03, 0x81, 0x06, 0x03, 0x05, 0x06, 0x06, 0x09,
+    0x82, 0x06, 0x82, 0x05, 0x81, 0x22, 0x0B, 0x06, 0x04, 0x04, 0x5E, 0x2A, 0x0E, 0x23, 0x0E, 0x38,
+    0x12, 0x1D, 0x13, 0x81, 0x41, 0x83, 0x26, 0x0E, 0x28, 0x41, 0x41, 0x77, 0x59, 0x5C, 0x0A, 0x34,
+    0x45, 0x0C, 0x0C, 0x32, 0x25, 0x2C, 0x24, 0x82, 0x3C, 0x81, 0x54, 0x01, 0x3C, 0x33, 0x81, 0x25,
+    0x82, 0x36, 0x0B, 0x55, 0x28, 0x2E, 0x34, 0x2E, 0x5A, 0x2B, 0x2A, 0x57, 0x2A, 0x42, 0x5F, 0x82,
+    0x42, 0x80, 0x19, 0x83, 0x14, 0x03, 0x1F, 0x24, 0x3B, 0x58, 0x82, 0x42, 0x19, 0x57, 0x29, 0x32,
+    0x34, 0x19, 0x24, 0x24, 0x2E, 0x29, 0x3D, 0x25, 0x44, 0x5A, 0x19, 0x04, 0x03, 0x0B, 0x04, 0x01,
+    0x81, 0x0D, 0x04, 0x3F, 0x7F, 0x0B, 0x11, 0x8B, 0x21, 0x3C, 0x41, 0x21, 0x21, 0x79, 0x54, 0x24,
+    0x4C, 0x3B, 0x4D, 0x7D, 0x61, 0x16, 0x0B, 0x1E, 0x53, 0x16, 0x0B, 0x09, 0x60, 0x7D, 0x6F, 0x7D,
+    0x2C, 0x48, 0x61, 0x3B, 0x69, 0x3B, 0x06, 0x22, 0x03, 0x03, 0x09, 0x2C, 0x63, 0x6B, 0x54, 0x54,
+    0x6B, 0x61, 0x3B, 0x3B, 0x60, 0x6B, 0x4D, 0x66, 0x75, 0x75, 0x40, 0x7D, 0x6F, 0x4A, 0x4F, 0x70,
+    0x6B, 0x3B, 0x6D, 0x6D, 0x09, 0x0D, 0x4C, 0x82, 0x60, 0x10, 0x47, 0x5D, 0x5D, 0x4C, 0x73, 0x5D,
+    0x5D, 0x73, 0x73, 0x4C, 0x49, 0x44, 0x1A, 0x60, 0x6A, 0x21, 0x79, 0x83, 0x21, 0x0B, 0x79, 0x21,
+    0x36, 0x7C, 0x80, 0x03, 0x0A, 0x4E, 0x0B, 0x22, 0x06, 0x09, 0x85, 0x06, 0x84, 0x03, 0x80, 0x6D,
+    0x86, 0x03, 0x88, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x04, 0x08, 0x81, 0x2D, 0x1D,
+    0x10, 0x13, 0x6C, 0x1D, 0x0E, 0x41, 0x81, 0x26, 0x82, 0x41, 0x10, 0x26, 0x41, 0x28, 0x41, 0x21,
+    0x30, 0x57, 0x7C, 0x31, 0x0C, 0x2D, 0x2D, 0x0C, 0x36, 0x33, 0x72, 0x24, 0x82, 0x3C, 0x13, 0x54,
+    0x3C, 0x2C, 0x5A, 0x35, 0x59, 0x2D, 0x13, 0x71, 0x37, 0x2B, 0x34, 0x29, 0x2E, 0x34, 0x2C, 0x57,
+    0x57, 0x2A, 0x31, 0x82, 0x42, 0x15, 0x31, 0x1F, 0x14, 0x19, 0x20, 0x2C, 0x08, 0x61, 0x42, 0x42,
+    0x19, 0x19, 0x5F, 0x48, 0x29, 0x25, 0x34, 0x2A, 0x19, 0x19, 0x24, 0x2E, 0x82, 0x44, 0x0D, 0x2B,
+    0x49, 0x05, 0x7B, 0x7B, 0x05, 0x00, 0x03, 0x02, 0x08, 0x02, 0x76, 0x5D, 0x30, 0x8D, 0x21, 0x03,
+    0x62, 0x3C, 0x6E, 0x68, 0x81, 0x61, 0x81, 0x3B, 0x82, 0x0B, 0x59, 0x5B, 0x7B, 0x0B, 0x0A, 0x3A,
+    0x7D, 0x4F, 0x6E, 0x72, 0x2E, 0x1B, 0x61, 0x68, 0x0B, 0x09, 0x0A, 0x6E, 0x7F, 0x4C, 0x29, 0x72,
+    0x66, 0x4D, 0x62, 0x61, 0x68, 0x3B, 0x3B, 0x6B, 0x4D, 0x61, 0x66, 0x7D, 0x3E, 0x6F, 0x7D, 0x4D,
+    0x60, 0x47, 0x70, 0x66, 0x4D, 0x03, 0x03, 0x01, 0x81, 0x60, 0x47, 0x47, 0x60, 0x60, 0x5D, 0x5D,
+    0x4C, 0x4C, 0x5D, 0x73, 0x68, 0x4C, 0x06, 0x34, 0x10, 0x1A, 0x3C, 0x78, 0x77, 0x41, 0x21, 0x46,
+    0x21, 0x21, 0x46, 0x21, 0x79, 0x19, 0x7C, 0x80, 0x00, 0x1B, 0x0B, 0x6D, 0x05, 0x06, 0x53, 0x03,
+    0x0A, 0x06, 0x06, 0x09, 0x06, 0x83, 0x03, 0x80, 0x6D, 0x86, 0x03, 0x80, 0x06, 0x85, 0x05, 0x06,
+    0x06, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06, 0x82, 0x04, 0x20, 0x24, 0x1A, 0x0E, 0x10, 0x13, 0x6C,
+    0x1D, 0x0E, 0x28, 0x41, 0x26, 0x28, 0x41, 0x26, 0x26, 0x28, 0x28, 0x41, 0x21, 0x30, 0x33, 0x1F,
+    0x2A, 0x2D, 0x45, 0x2D, 0x2D, 0x0C, 0x36, 0x34, 0x2C, 0x24, 0x62, 0x82, 0x3C, 0x0C, 0x24, 0x25,
+    0x0C, 0x2D, 0x1D, 0x27, 0x07, 0x29, 0x48, 0x32, 0x2D, 0x2B, 0x34, 0x83, 0x2C, 0x2E, 0x57, 0x2A,
+    0x31, 0x5F, 0x14, 0x19, 0x42, 0x1F, 0x24, 0x2E, 0x24, 0x2C, 0x5F, 0x42, 0x14, 0x5F, 0x42, 0x14,
+    0x34, 0x5A, 0x2A, 0x2A, 0x24, 0x2A, 0x19, 0x20, 0x2C, 0x44, 0x44, 0x56, 0x3D, 0x48, 0x50, 0x16,
+    0x53, 0x5C, 0x03, 0x05, 0x03, 0x08, 0x3F, 0x16, 0x54, 0x79, 0x21, 0x21, 0x77, 0x86, 0x21, 0x3A,
+    0x46, 0x21, 0x63, 0x60, 0x5C, 0x4C, 0x0B, 0x3B, 0x0B, 0x3B, 0x0B, 0x5B, 0x73, 0x1B, 0x1B, 0x06,
+    0x16, 0x3B, 0x47, 0x60, 0x70, 0x54, 0x2C, 0x2E, 0x3B, 0x0B, 0x0B, 0x53, 0x53, 0x06, 0x53, 0x0B,
+    0x2E, 0x30, 0x25, 0x24, 0x60, 0x63, 0x60, 0x3B, 0x3B, 0x61, 0x47, 0x4D, 0x66, 0x4D, 0x47, 0x3A,
+    0x6F, 0x6F, 0x5D, 0x0B, 0x61, 0x62, 0x11, 0x4F, 0x4C, 0x0A, 0x60, 0x82, 0x47, 0x01, 0x60, 0x5D,
+    0x83, 0x73, 0x0B, 0x03, 0x68, 0x4C, 0x4C, 0x73, 0x53, 0x59, 0x0F, 0x12, 0x33, 0x78, 0x77, 0x81,
+    0x41, 0x82, 0x21, 0x12, 0x46, 0x21, 0x79, 0x2A, 0x02, 0x76, 0x3F, 0x5B, 0x3B, 0x24, 0x02, 0x06,
+    0x04, 0x06, 0x05, 0x06, 0x06, 0x09, 0x06, 0x8B, 0x03, 0x82, 0x06, 0x81, 0x05, 0x85, 0x06, 0x82,
+    0x05, 0x82, 0x04, 0x05, 0x25, 0x13, 0x0E, 0x10, 0x13, 0x12, 0x81, 0x1D, 0x82, 0x41, 0x12, 0x28,
+    0x26, 0x41, 0x26, 0x28, 0x41, 0x23, 0x46, 0x38, 0x3D, 0x5F, 0x2A, 0x2D, 0x2D, 0x2F, 0x2F, 0x0C,
+    0x36, 0x25, 0x82, 0x72, 0x12, 0x63, 0x72, 0x72, 0x63, 0x36, 0x45, 0x0E, 0x39, 0x07, 0x55, 0x2E,
+    0x5A, 0x56, 0x0C, 0x33, 0x34, 0x48, 0x57, 0x34, 0x81, 0x2C, 0x82, 0x2A, 0x07, 0x42, 0x24, 0x42,
+    0x5F, 0x2B, 0x72, 0x25, 0x3D, 0x83, 0x42, 0x1B, 0x19, 0x14, 0x42, 0x5A, 0x72, 0x24, 0x19, 0x42,
+    0x42, 0x19, 0x24, 0x2E, 0x32, 0x32, 0x44, 0x3D, 0x58, 0x7B, 0x1B, 0x58, 0x14, 0x5C, 0x76, 0x7E,
+    0x6D, 0x3F, 0x5D, 0x62, 0x81, 0x77, 0x86, 0x21, 0x06, 0x41, 0x21, 0x30, 0x60, 0x49, 0x4C, 0x73,
+    0x84, 0x0B, 0x49, 0x1E, 0x16, 0x1E, 0x16, 0x64, 0x16, 0x16, 0x4B, 0x47, 0x7D, 0x3C, 0x57, 0x3D,
+    0x50, 0x68, 0x64, 0x0B, 0x53, 0x53, 0x7B, 0x06, 0x24, 0x56, 0x37, 0x37, 0x29, 0x56, 0x54, 0x69,
+    0x61, 0x5D, 0x3B, 0x69, 0x6B, 0x3A, 0x7D, 0x60, 0x47, 0x7D, 0x3A, 0x04, 0x03, 0x61, 0x30, 0x10,
+    0x30, 0x63, 0x67, 0x67, 0x63, 0x36, 0x30, 0x2D, 0x0C, 0x25, 0x57, 0x58, 0x1E, 0x4C, 0x4C, 0x0B,
+    0x05, 0x02, 0x56, 0x13, 0x55, 0x59, 0x11, 0x77, 0x21, 0x18, 0x46, 0x21, 0x46, 0x82, 0x21, 0x0F,
+    0x24, 0x3F, 0x3F, 0x1F, 0x6D, 0x61, 0x63, 0x19, 0x0A, 0x05, 0x09, 0x53, 0x06, 0x06, 0x09, 0x06,
+    0x8B, 0x03, 0x87, 0x06, 0x81, 0x0A, 0x81, 0x22, 0x0D, 0x06, 0x05, 0x04, 0x80, 0x76, 0x32, 0x13,
+    0x0E, 0x10, 0x0E, 0x12, 0x6C, 0x6C, 0x21, 0x82, 0x41, 0x01, 0x26, 0x41, 0x81, 0x28, 0x82, 0x41,
+    0x05, 0x1D, 0x3D, 0x48, 0x2C, 0x44, 0x2F, 0x81, 0x51, 0x82, 0x2F, 0x81, 0x1A, 0x81, 0x17, 0x83,
+    0x1D, 0x80, 0x41, 0x82, 0x07, 0x06, 0x56, 0x25, 0x2F, 0x2F, 0x25, 0x2E, 0x33, 0x82, 0x34, 0x82,
+    0x2C, 0x37, 0x31, 0x5F, 0x5F, 0x1F, 0x42, 0x62, 0x25, 0x32, 0x5A, 0x24, 0x5F, 0x5F, 0x42, 0x5F,
+    0x19, 0x14, 0x14, 0x34, 0x2E, 0x42, 0x24, 0x2A, 0x42, 0x24, 0x48, 0x62, 0x63, 0x3D, 0x29, 0x29,
+    0x33, 0x73, 0x3B, 0x5D, 0x20, 0x49, 0x49, 0x02, 0x02, 0x00, 0x3F, 0x73, 0x63, 0x21, 0x77, 0x21,
+    0x77, 0x21, 0x41, 0x77, 0x77, 0x21, 0x21, 0x70, 0x3C, 0x6E, 0x84, 0x0B, 0x81, 0x5B, 0x2F, 0x1B,
+    0x0B, 0x09, 0x1B, 0x22, 0x4B, 0x0B, 0x1E, 0x03, 0x81, 0x1F, 0x3C, 0x3D, 0x02, 0x3B, 0x4C, 0x0B,
+    0x09, 0x53, 0x50, 0x0B, 0x3B, 0x49, 0x6A, 0x67, 0x44, 0x12, 0x59, 0x3C, 0x6B, 0x4D, 0x6B, 0x69,
+    0x3B, 0x4F, 0x7D, 0x7D, 0x47, 0x5D, 0x4F, 0x6D, 0x0D, 0x06, 0x3C, 0x18, 0x41, 0x18, 0x27, 0x86,
+    0x07, 0x10, 0x39, 0x23, 0x5A, 0x14, 0x73, 0x4C, 0x6E, 0x58, 0x12, 0x0F, 0x55, 0x2F, 0x11, 0x77,
+    0x77, 0x46, 0x26, 0x84, 0x21, 0x0A, 0x63, 0x3F, 0x58, 0x19, 0x04, 0x5D, 0x67, 0x48, 0x0A, 0x08,
+    0x6D, 0x82, 0x06, 0x80, 0x09, 0x8C, 0x03, 0x87, 0x06, 0x81, 0x0A, 0x81, 0x06, 0x09, 0x05, 0x04,
+    0x04, 0x80, 0x04, 0x29, 0x41, 0x13, 0x10, 0x1D, 0x82, 0x6C, 0x81, 0x21, 0x82, 0x41, 0x81, 0x28,
+    0x83, 0x41, 0x09, 0x1D, 0x29, 0x2E, 0x2E, 0x2F, 0x2F, 0x51, 0x17, 0x13, 0x10, 0x82, 0x39, 0x85,
+    0x07, 0x3E, 0x28, 0x07, 0x07, 0x39, 0x29, 0x29, 0x1A, 0x32, 0x25, 0x33, 0x33, 0x34, 0x34, 0x2B,
+    0x34, 0x57, 0x2A, 0x5F, 0x19, 0x2A, 0x33, 0x44, 0x30, 0x36, 0x33, 0x57, 0x5F, 0x42, 0x5F, 0x5F,
+    0x19, 0x19, 0x14, 0x1F, 0x19, 0x2E, 0x19, 0x20, 0x19, 0x31, 0x24, 0x2A, 0x4F, 0x62, 0x31, 0x2E,
+    0x29, 0x44, 0x3C, 0x61, 0x54, 0x4C, 0x7C, 0x5C, 0x58, 0x19, 0x00, 0x04, 0x76, 0x61, 0x63, 0x21,
+    0x77, 0x82, 0x21, 0x08, 0x77, 0x21, 0x21, 0x62, 0x54, 0x3C, 0x0B, 0x0B, 0x1B, 0x82, 0x0B, 0x81,
+    0x1B, 0x82, 0x1E, 0x43, 0x64, 0x7F, 0x22, 0x06, 0x64, 0x1E, 0x0A, 0x14, 0x05, 0x2E, 0x31, 0x4E,
+    0x4C, 0x50, 0x16, 0x5B, 0x68, 0x0B, 0x68, 0x7B, 0x54, 0x66, 0x66, 0x62, 0x59, 0x44, 0x25, 0x62,
+    0x4D, 0x66, 0x66, 0x47, 0x5D, 0x66, 0x40, 0x47, 0x1B, 0x5D, 0x02, 0x0D, 0x4C, 0x2D, 0x41, 0x26,
+    0x27, 0x10, 0x27, 0x28, 0x71, 0x71, 0x28, 0x07, 0x07, 0x27, 0x07, 0x1A, 0x2C, 0x08, 0x6E, 0x49,
+    0x37, 0x10, 0x55, 0x0E, 0x30, 0x77, 0x77, 0x21, 0x81, 0x41, 0x82, 0x21, 0x0D, 0x77, 0x63, 0x1F,
+    0x1F, 0x42, 0x80, 0x6E, 0x67, 0x2E, 0x22, 0x08, 0x03, 0x06, 0x05, 0x8E, 0x03, 0x8B, 0x06, 0x0F,
+    0x05, 0x04, 0x04, 0x80, 0x7C, 0x29, 0x1D, 0x0F, 0x10, 0x1D, 0x46, 0x6C, 0x1D, 0x21, 0x21, 0x46,
+    0x85, 0x41, 0x81, 0x13, 0x07, 0x12, 0x29, 0x3D, 0x29, 0x51, 0x6C, 0x13, 0x28, 0x82, 0x07, 0x2D,
+    0x27, 0x07, 0x07, 0x71, 0x71, 0x27, 0x27, 0x07, 0x07, 0x10, 0x07, 0x13, 0x45, 0x1A, 0x2D, 0x5A,
+    0x25, 0x33, 0x33, 0x25, 0x2E, 0x33, 0x2C, 0x57, 0x48, 0x34, 0x29, 0x37, 0x37, 0x29, 0x5A, 0x34,
+    0x2A, 0x5F, 0x2A, 0x2A, 0x5F, 0x19, 0x31, 0x14, 0x14, 0x1F, 0x14, 0x48, 0x2B, 0x19, 0x82, 0x14,
+    0x16, 0x34, 0x2A, 0x1F, 0x7C, 0x20, 0x2E, 0x44, 0x3D, 0x5D, 0x68, 0x68, 0x01, 0x04, 0x76, 0x01,
+    0x49, 0x14, 0x3F, 0x22, 0x60, 0x11, 0x21, 0x77, 0x83, 0x21, 0x05, 0x63, 0x60, 0x14, 0x0B, 0x0B,
+    0x1B, 0x83, 0x0B, 0x35, 0x1B, 0x0B, 0x1E, 0x0B, 0x64, 0x1E, 0x0A, 0x04, 0x09, 0x1E, 0x5E, 0x76,
+    0x3F, 0x06, 0x2B, 0x57, 0x1B, 0x09, 0x0A, 0x03, 0x68, 0x0B, 0x1B, 0x68, 0x6E, 0x08, 0x6E, 0x47,
+    0x6B, 0x4D, 0x70, 0x36, 0x44, 0x33, 0x70, 0x3A, 0x3A, 0x4D, 0x4E, 0x61, 0x4D, 0x61, 0x3B, 0x08,
+    0x00, 0x0A, 0x2C, 0x28, 0x21, 0x21, 0x26, 0x28, 0x28, 0x07, 0x82, 0x27, 0x12, 0x71, 0x07, 0x27,
+    0x07, 0x23, 0x25, 0x00, 0x49, 0x37, 0x23, 0x10, 0x13, 0x2F, 0x21, 0x77, 0x21, 0x21, 0x28, 0x46,
+    0x82, 0x77, 0x0B, 0x3C, 0x19, 0x14, 0x5F, 0x3F, 0x58, 0x25, 0x2E, 0x06, 0x03, 0x09, 0x6D, 0x87,
+    0x03, 0x80, 0x6D, 0x86, 0x03, 0x87, 0x06, 0x80, 0x09, 0x83, 0x06, 0x0F, 0x05, 0x04, 0x04, 0x3F,
+    0x45, 0x1D, 0x0F, 0x18, 0x1D, 0x46, 0x17, 0x1D, 0x46, 0x21, 0x21, 0x46, 0x84, 0x41, 0x81, 0x13,
+    0x05, 0x17, 0x44, 0x2F, 0x12, 0x1D, 0x23, 0x87, 0x07, 0x83, 0x39, 0x2A, 0x07, 0x28, 0x71, 0x07,
+    0x1A, 0x2F, 0x46, 0x2D, 0x36, 0x36, 0x59, 0x36, 0x5A, 0x33, 0x34, 0x2E, 0x3D, 0x44, 0x65, 0x12,
+    0x32, 0x34, 0x42, 0x2A, 0x2C, 0x34, 0x42, 0x48, 0x19, 0x42, 0x5F, 0x14, 0x1F, 0x14, 0x19, 0x1F,
+    0x19, 0x2E, 0x14, 0x20, 0x31, 0x2A, 0x19, 0x83, 0x1F, 0x10, 0x20, 0x2E, 0x29, 0x24, 0x6B, 0x50,
+    0x73, 0x76, 0x7E, 0x0A, 0x03, 0x00, 0x20, 0x19, 0x04, 0x60, 0x11, 0x83, 0x21, 0x0C, 0x79, 0x70,
+    0x49, 0x1E, 0x1E, 0x0B, 0x1B, 0x5B, 0x5B, 0x1B, 0x1B, 0x1E, 0x16, 0x82, 0x1E, 0x2B, 0x06, 0x64,
+    0x4B, 0x5E, 0x76, 0x4B, 0x76, 0x58, 0x1E, 0x57, 0x2E, 0x3B, 0x68, 0x0B, 0x4C, 0x0D, 0x7B, 0x16,
+    0x3B, 0x4D, 0x75, 0x75, 0x66, 0x61, 0x3B, 0x6B, 0x4D, 0x62, 0x36, 0x44, 0x72, 0x47, 0x66, 0x4D,
+    0x61, 0x61, 0x6B, 0x3B, 0x5D, 0x80, 0x01, 0x08, 0x2D, 0x13, 0x82, 0x21, 0x82, 0x41, 0x82, 0x28,
+    0x81, 0x71, 0x0A, 0x28, 0x39, 0x28, 0x25, 0x19, 0x12, 0x0F, 0x10, 0x23, 0x17, 0x38, 0x82, 0x21,
+    0x10, 0x46, 0x41, 0x77, 0x77, 0x15, 0x58, 0x42, 0x19, 0x48, 0x5F, 0x57, 0x59, 0x25, 0x03, 0x01,
+    0x06, 0x08, 0x87, 0x03, 0x81, 0x6D, 0x85, 0x03, 0x82, 0x06, 0x81, 0x05, 0x82, 0x06, 0x01, 0x03,
+    0x06, 0x82, 0x05, 0x82, 0x04, 0x09, 0x3F, 0x51, 0x0E, 0x0F, 0x13, 0x1D, 0x46, 0x17, 0x17, 0x1D,
+    0x81, 0x21, 0x82, 0x41, 0x0A, 0x46, 0x41, 0x41, 0x0E, 0x0F, 0x17, 0x2F, 0x65, 0x41, 0x28, 0x39,
+    0x86, 0x07, 0x85, 0x27, 0x4C, 0x26, 0x27, 0x07, 0x17, 0x17, 0x51, 0x29, 0x29, 0x2D, 0x29, 0x5A,
+    0x33, 0x2E, 0x29, 0x12, 0x65, 0x74, 0x29, 0x33, 0x57, 0x2C, 0x31, 0x31, 0x57, 0x31, 0x57, 0x42,
+    0x5F, 0x42, 0x19, 0x14, 0x19, 0x14, 0x14, 0x1F, 0x20, 0x48, 0x2A, 0x2A, 0x24, 0x14, 0x7C, 0x1F,
+    0x14, 0x1F, 0x1F, 0x20, 0x14, 0x3D, 0x5A, 0x5D, 0x50, 0x7E, 0x4B, 0x22, 0x03, 0x7E, 0x01, 0x0D,
+    0x08, 0x31, 0x3F, 0x5D, 0x15, 0x79, 0x77, 0x30, 0x62, 0x6E, 0x06, 0x09, 0x0B, 0x1B, 0x5B, 0x0B,
+    0x0B, 0x1B, 0x82, 0x1E, 0x81, 0x64, 0x0D, 0x16, 0x64, 0x1E, 0x1E, 0x4B, 0x04, 0x76, 0x14, 0x48,
+    0x0D, 0x58, 0x2B, 0x05, 0x16, 0x82, 0x09, 0x81, 0x0B, 0x80, 0x3B, 0x82, 0x61, 0x18, 0x60, 0x1B,
+    0x0B, 0x01, 0x5E, 0x1B, 0x47, 0x6A, 0x44, 0x3D, 0x3C, 0x47, 0x4D, 0x47, 0x3B, 0x60, 0x61, 0x4C,
+    0x7C, 0x01, 0x72, 0x46, 0x41, 0x41, 0x21, 0x84, 0x41, 0x0E, 0x28, 0x07, 0x27, 0x07, 0x71, 0x07,
+    0x10, 0x2E, 0x51, 0x10, 0x23, 0x10, 0x23, 0x6C, 0x46, 0x82, 0x21, 0x0E, 0x41, 0x46, 0x77, 0x62,
+    0x31, 0x19, 0x2A, 0x2E, 0x48, 0x2E, 0x59, 0x25, 0x03, 0x03, 0x53, 0x87, 0x03, 0x82, 0x6D, 0x85,
+    0x03, 0x8A, 0x06, 0x84, 0x04, 0x09, 0x02, 0x44, 0x74, 0x0F, 0x13, 0x17, 0x46, 0x46, 0x17, 0x1D,
+    0x81, 0x13, 0x83, 0x41, 0x81, 0x13, 0x05, 0x23, 0x0F, 0x0E, 0x1D, 0x13, 0x28, 0x85, 0x07, 0x32,
+    0x28, 0x07, 0x27, 0x07, 0x28, 0x26, 0x27, 0x71, 0x71, 0x28, 0x07, 0x23, 0x74, 0x74, 0x17, 0x1A,
+    0x56, 0x2D, 0x32, 0x32, 0x44, 0x37, 0x13, 0x10, 0x37, 0x5A, 0x2B, 0x2C, 0x2C, 0x57, 0x2A, 0x2A,
+    0x57, 0x5F, 0x14, 0x42, 0x42, 0x31, 0x42, 0x42, 0x19, 0x19, 0x14, 0x42, 0x42, 0x2C, 0x34, 0x42,
+    0x20, 0x3F, 0x20, 0x82, 0x1F, 0x1B, 0x20, 0x00, 0x20, 0x31, 0x29, 0x3C, 0x5D, 0x73, 0x1E, 0x22,
+    0x22, 0x0A, 0x05, 0x5E, 0x6D, 0x02, 0x2A, 0x00, 0x09, 0x03, 0x81, 0x6D, 0x0A, 0x4B, 0x16, 0x5B,
+    0x16, 0x1E, 0x83, 0x5B, 0x83, 0x64, 0x2D, 0x1E, 0x64, 0x64, 0x1E, 0x64, 0x64, 0x1E, 0x1E, 0x1F,
+    0x31, 0x05, 0x19, 0x2B, 0x14, 0x1E, 0x0A, 0x16, 0x09, 0x73, 0x09, 0x0B, 0x1B, 0x0B, 0x61, 0x3B,
+    0x61, 0x3B, 0x0B, 0x09, 0x7C, 0x76, 0x3B, 0x4F, 0x36, 0x44, 0x2C, 0x54, 0x4F, 0x4D, 0x73, 0x5D,
+    0x61, 0x06, 0x7F, 0x3F, 0x43, 0x88, 0x41, 0x21, 0x07, 0x71, 0x07, 0x28, 0x71, 0x07, 0x13, 0x46,
+    0x10, 0x10, 0x23, 0x10, 0x13, 0x13, 0x46, 0x46, 0x21, 0x21, 0x26, 0x72, 0x49, 0x62, 0x62, 0x2E,
+    0x44, 0x44, 0x3D, 0x29, 0x5A, 0x01, 0x03, 0x6D, 0x22, 0x6D, 0x8E, 0x03, 0x81, 0x06, 0x82, 0x05,
+    0x86, 0x06, 0x84, 0x04, 0x15, 0x59, 0x0E, 0x10, 0x18, 0x46, 0x17, 0x38, 0x6C, 0x1D, 0x13, 0x10,
+    0x10, 0x23, 0x23, 0x13, 0x0F, 0x23, 0x23, 0x0F, 0x13, 0x13, 0x28, 0x85, 0x07, 0x04, 0x27, 0x28,
+    0x07, 0x27, 0x07, 0x81, 0x28, 0x83, 0x27, 0x19, 0x39, 0x23, 0x0F, 0x0F, 0x17, 0x51, 0x45, 0x2D,
+    0x2D, 0x12, 0x65, 0x65, 0x55, 0x44, 0x25, 0x2E, 0x2B, 0x34, 0x2A, 0x2A, 0x57, 0x57, 0x31, 0x14,
+    0x20, 0x14, 0x82, 0x19, 0x81, 0x14, 0x2C, 0x1F, 0x20, 0x1F, 0x20, 0x14, 0x2A, 0x24, 0x20, 0x7C,
+    0x20, 0x20, 0x00, 0x00, 0x20, 0x02, 0x00, 0x02, 0x3D, 0x2B, 0x68, 0x01, 0x4B, 0x0A, 0x0A, 0x7E,
+    0x04, 0x6D, 0x01, 0x05, 0x08, 0x42, 0x08, 0x0A, 0x1E, 0x22, 0x22, 0x0A, 0x5B, 0x4C, 0x1B, 0x73,
+    0x5B, 0x16, 0x5B, 0x16, 0x89, 0x64, 0x81, 0x1E, 0x0C, 0x01, 0x14, 0x1E, 0x03, 0x2B, 0x19, 0x50,
+    0x1B, 0x73, 0x06, 0x7B, 0x7B, 0x0B, 0x81, 0x69, 0x82, 0x3B, 0x81, 0x61, 0x11, 0x3B, 0x0B, 0x06,
+    0x7F, 0x5B, 0x47, 0x67, 0x44, 0x3D, 0x14, 0x5D, 0x0B, 0x4C, 0x4C, 0x0B, 0x04, 0x76, 0x2B, 0x81,
+    0x41, 0x84, 0x28, 0x81, 0x41, 0x08, 0x26, 0x27, 0x07, 0x27, 0x27, 0x07, 0x39, 0x23, 0x0F, 0x83,
+    0x10, 0x13, 0x23, 0x13, 0x1D, 0x6C, 0x38, 0x2C, 0x24, 0x33, 0x19, 0x57, 0x2B, 0x1A, 0x55, 0x65,
+    0x2F, 0x32, 0x03, 0x04, 0x03, 0x09, 0x82, 0x03, 0x81, 0x06, 0x80, 0x0A, 0x89, 0x03, 0x88, 0x06,
+    0x80, 0x22, 0x83, 0x06, 0x81, 0x04, 0x16, 0x7F, 0x5A, 0x17, 0x55, 0x55, 0x46, 0x46, 0x1A, 0x6C,
+    0x17, 0x1D, 0x13, 0x0F, 0x55, 0x23, 0x23, 0x0F, 0x10, 0x55, 0x0F, 0x0F, 0x23, 0x39, 0x85, 0x07,
+    0x06, 0x27, 0x28, 0x07, 0x27, 0x07, 0x27, 0x28, 0x83, 0x27, 0x19, 0x28, 0x18, 0x10, 0x13, 0x46,
+    0x38, 0x2F, 0x51, 0x0F, 0x1D, 0x74, 0x12, 0x2D, 0x36, 0x5A, 0x33, 0x48, 0x2C, 0x2A, 0x57, 0x2C,
+    0x2A, 0x14, 0x1F, 0x20, 0x1F, 0x83, 0x14, 0x0A, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x14, 0x24,
+    0x14, 0x01, 0x02, 0x83, 0x00, 0x1B, 0x20, 0x02, 0x5E, 0x2A, 0x2E, 0x68, 0x0D, 0x1E, 0x09, 0x5B,
+    0x22, 0x5B, 0x00, 0x03, 0x01, 0x5E, 0x00, 0x5C, 0x0A, 0x06, 0x1E, 0x6D, 0x0B, 0x0A, 0x1E, 0x16,
+    0x09, 0x5B, 0x81, 0x16, 0x87, 0x64, 0x84, 0x1E, 0x09, 0x7C, 0x1F, 0x1E, 0x09, 0x57, 0x20, 0x05,
+    0x06, 0x0B, 0x1B, 0x83, 0x3B, 0x17, 0x06, 0x0B, 0x0B, 0x5B, 0x0B, 0x3B, 0x3B, 0x69, 0x61, 0x3B,
+    0x76, 0x76, 0x47, 0x62, 0x59, 0x3D, 0x2B, 0x1F, 0x0A, 0x7F, 0x73, 0x09, 0x5E, 0x14, 0x82, 0x41,
+    0x01, 0x28, 0x41, 0x83, 0x28, 0x20, 0x26, 0x27, 0x27, 0x07, 0x27, 0x39, 0x07, 0x07, 0x13, 0x23,
+    0x39, 0x10, 0x39, 0x23, 0x23, 0x13, 0x1D, 0x0C, 0x3D, 0x29, 0x34, 0x49, 0x2B, 0x2B, 0x44, 0x39,
+    0x10, 0x1A, 0x5A, 0x05, 0x05, 0x6E, 0x09, 0x81, 0x03, 0x82, 0x09, 0x81, 0x06, 0x02, 0x0A, 0x06,
+    0x0A, 0x85, 0x03, 0x88, 0x06, 0x83, 0x22, 0x80, 0x06, 0x82, 0x04, 0x14, 0x72, 0x1D, 0x12, 0x10,
+    0x17, 0x38, 0x6C, 0x1D, 0x17, 0x17, 0x1D, 0x1D, 0x0E, 0x13, 0x0F, 0x55, 0x55, 0x0F, 0x13, 0x23,
+    0x71, 0x87, 0x07, 0x01, 0x28, 0x27, 0x82, 0x07, 0x1D, 0x28, 0x27, 0x07, 0x27, 0x07, 0x28, 0x23,
+    0x0F, 0x6C, 0x51, 0x51, 0x12, 0x0E, 0x17, 0x17, 0x1A, 0x2F, 0x29, 0x36, 0x25, 0x34, 0x34, 0x2C,
+    0x2C, 0x57, 0x2A, 0x19, 0x1F, 0x20, 0x1F, 0x83, 0x14, 0x80, 0x1F, 0x83, 0x20, 0x1E, 0x3F, 0x20,
+    0x20, 0x14, 0x24, 0x20, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5C, 0x01, 0x19, 0x33, 0x5C, 0x05,
+    0x1E, 0x0A, 0x16, 0x0A, 0x0A, 0x05, 0x0A, 0x01, 0x06, 0x08, 0x73, 0x73, 0x0A, 0x82, 0x09, 0x07,
+    0x0B, 0x03, 0x6E, 0x4C, 0x0A, 0x0A, 0x22, 0x64, 0x83, 0x4B, 0x81, 0x64, 0x85, 0x1E, 0x26, 0x5E,
+    0x20, 0x0A, 0x7B, 0x5C, 0x1F, 0x1E, 0x0D, 0x1B, 0x0B, 0x0B, 0x06, 0x09, 0x5B, 0x16, 0x22, 0x06,
+    0x09, 0x0A, 0x0A, 0x09, 0x09, 0x3B, 0x6B, 0x61, 0x16, 0x7F, 0x60, 0x67, 0x25, 0x2A, 0x33, 0x2A,
+    0x04, 0x01, 0x03, 0x0B, 0x20, 0x35, 0x81, 0x41, 0x84, 0x28, 0x83, 0x27, 0x81, 0x07, 0x06, 0x27,
+    0x07, 0x07, 0x28, 0x0F, 0x18, 0x23, 0x82, 0x10, 0x13, 0x23, 0x0F, 0x74, 0x65, 0x44, 0x19, 0x31,
+    0x34, 0x2B, 0x3D, 0x18, 0x12, 0x17, 0x2C, 0x05, 0x22, 0x6D, 0x05, 0x03, 0x09, 0x87, 0x06, 0x80,
+    0x0A, 0x84, 0x03, 0x84, 0x06, 0x82, 0x22, 0x80, 0x0A, 0x84, 0x22, 0x16, 0x06, 0x04, 0x22, 0x00,
+    0x2F, 0x0F, 0x55, 0x37, 0x38, 0x46, 0x6C, 0x17, 0x17, 0x1D, 0x0E, 0x0E, 0x0F, 0x13, 0x55, 0x55,
+    0x0F, 0x23, 0x28, 0x88, 0x07, 0x01, 0x27, 0x28, 0x82, 0x07, 0x01, 0x28, 0x27, 0x82, 0x07, 0x0D,
+    0x39, 0x13, 0x17, 0x6C, 0x17, 0x74, 0x0E, 0x0E, 0x51, 0x1D, 0x1A, 0x43, 0x29, 0x5A, 0x82, 0x25,
+    0x05, 0x34, 0x57, 0x2A, 0x14, 0x20, 0x1F, 0x81, 0x14, 0x82, 0x19, 0x81, 0x14, 0x81, 0x20, 0x28,
+    0x00, 0x20, 0x20, 0x02, 0x00, 0x00, 0x14, 0x19, 0x20, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00,
+    0x20, 0x24, 0x49, 0x7B, 0x1B, 0x5B, 0x1E, 0x5B, 0x5B, 0x4C, 0x32, 0x5A, 0x25, 0x32, 0x0C, 0x00,
+    0x09, 0x7E, 0x0B, 0x1B, 0x25, 0x12, 0x1A, 0x5A, 0x0A, 0x82, 0x22, 0x84, 0x4B, 0x81, 0x64, 0x85,
+    0x1E, 0x2A, 0x01, 0x06, 0x1E, 0x09, 0x5F, 0x5C, 0x0D, 0x0D, 0x06, 0x06, 0x04, 0x09, 0x73, 0x03,
+    0x4B, 0x64, 0x5B, 0x0A, 0x0A, 0x01, 0x04, 0x01, 0x6D, 0x61, 0x6B, 0x3B, 0x7C, 0x4C, 0x11, 0x3D,
+    0x6E, 0x62, 0x48, 0x20, 0x02, 0x80, 0x64, 0x2C, 0x41, 0x41, 0x26, 0x28, 0x27, 0x82, 0x28, 0x81,
+    0x27, 0x83, 0x07, 0x08, 0x27, 0x07, 0x07, 0x23, 0x13, 0x18, 0x18, 0x10, 0x39, 0x82, 0x10, 0x0F,
+    0x12, 0x34, 0x5F, 0x42, 0x2B, 0x34, 0x36, 0x55, 0x13, 0x1A, 0x49, 0x04, 0x04, 0x6D, 0x09, 0x03,
+    0x88, 0x06, 0x80, 0x0A, 0x84, 0x03, 0x83, 0x06, 0x83, 0x22, 0x80, 0x0A, 0x85, 0x22, 0x0C, 0x06,
+    0x01, 0x04, 0x2A, 0x2F, 0x37, 0x1A, 0x2D, 0x1A, 0x46, 0x6C, 0x17, 0x1D, 0x82, 0x0E, 0x83, 0x0F,
+    0x01, 0x23, 0x28, 0x86, 0x07, 0x03, 0x27, 0x07, 0x07, 0x28, 0x82, 0x07, 0x80, 0x27, 0x82, 0x07,
+    0x14, 0x71, 0x23, 0x0E, 0x17, 0x1D, 0x0F, 0x0F, 0x12, 0x6C, 0x0F, 0x17, 0x1A, 0x45, 0x0C, 0x32,
+    0x59, 0x59, 0x33, 0x2C, 0x2A, 0x24, 0x81, 0x19, 0x86, 0x42, 0x0D, 0x14, 0x1F, 0x20, 0x20, 0x00,
+    0x00, 0x1C, 0x01, 0x01, 0x1C, 0x20, 0x14, 0x00, 0x01, 0x81, 0x00, 0x82, 0x01, 0x1A, 0x00, 0x3C,
+    0x49, 0x50, 0x1B, 0x5B, 0x1E, 0x5B, 0x16, 0x4C, 0x56, 0x24, 0x00, 0x0C, 0x28, 0x49, 0x1B, 0x22,
+    0x73, 0x03, 0x1A, 0x72, 0x11, 0x2F, 0x0A, 0x22, 0x5E, 0x81, 0x22, 0x84, 0x4B, 0x80, 0x64, 0x84,
+    0x1E, 0x4F, 0x4B, 0x5E, 0x22, 0x64, 0x06, 0x3F, 0x31, 0x7C, 0x0D, 0x6D, 0x1B, 0x1E, 0x4B, 0x22,
+    0x5D, 0x47, 0x0B, 0x0A, 0x0A, 0x5B, 0x0A, 0x03, 0x03, 0x7C, 0x3F, 0x08, 0x69, 0x6B, 0x7C, 0x19,
+    0x2F, 0x2B, 0x01, 0x70, 0x33, 0x2A, 0x20, 0x01, 0x3F, 0x43, 0x28, 0x26, 0x27, 0x27, 0x28, 0x27,
+    0x28, 0x27, 0x27, 0x07, 0x07, 0x27, 0x07, 0x07, 0x71, 0x07, 0x07, 0x28, 0x18, 0x0F, 0x18, 0x10,
+    0x23, 0x23, 0x12, 0x44, 0x57, 0x2C, 0x24, 0x2E, 0x2C, 0x36, 0x55, 0x37, 0x33, 0x04, 0x05, 0x05,
+    0x6D, 0x09, 0x87, 0x06, 0x02, 0x09, 0x06, 0x0A, 0x84, 0x03, 0x83, 0x06, 0x80, 0x22, 0x83, 0x0A,
+    0x84, 0x22, 0x0B, 0x06, 0x22, 0x05, 0x05, 0x5E, 0x14, 0x37, 0x2D, 0x43, 0x51, 0x12, 0x17, 0x82,
+    0x1D, 0x81, 0x0E, 0x05, 0x0F, 0x13, 0x13, 0x0F, 0x18, 0x39, 0x89, 0x07, 0x04, 0x28, 0x27, 0x07,
+    0x07, 0x27, 0x82, 0x07, 0x10, 0x28, 0x13, 0x0E, 0x65, 0x0F, 0x0F, 0x1D, 0x17, 0x1D, 0x23, 0x17,
+    0x2F, 0x2F, 0x45, 0x0C, 0x59, 0x5A, 0x81, 0x2C, 0x82, 0x34, 0x01, 0x2C, 0x2A, 0x83, 0x42, 0x81,
+    0x19, 0x03, 0x14, 0x20, 0x00, 0x02, 0x82, 0x01, 0x08, 0x76, 0x01, 0x5E, 0x01, 0x20, 0x20, 0x00,
+    0x01, 0x00, 0x82, 0x01, 0x1D, 0x20, 0x5C, 0x31, 0x49, 0x4E, 0x0B, 0x1E, 0x0B, 0x1B, 0x73, 0x44,
+    0x14, 0x24, 0x2F, 0x2F, 0x3C, 0x0B, 0x0A, 0x0A, 0x5E, 0x81, 0x1B, 0x36, 0x44, 0x09, 0x03, 0x5E,
+    0x5E, 0x22, 0x5E, 0x84, 0x4B, 0x2E, 0x64, 0x1E, 0x1E, 0x16, 0x64, 0x0A, 0x22, 0x04, 0x04, 0x76,
+    0x22, 0x3F, 0x02, 0x5B, 0x4C, 0x03, 0x64, 0x1E, 0x22, 0x5D, 0x66, 0x3B, 0x5B, 0x5B, 0x0B, 0x0A,
+    0x0A, 0x5B, 0x0A, 0x03, 0x08, 0x1F, 0x4C, 0x69, 0x0B, 0x24, 0x37, 0x2A, 0x00, 0x5D, 0x63, 0x2E,
+    0x19, 0x5C, 0x34, 0x41, 0x71, 0x86, 0x27, 0x87, 0x07, 0x17, 0x28, 0x23, 0x0F, 0x0F, 0x10, 0x55,
+    0x0E, 0x6C, 0x3D, 0x2C, 0x2A, 0x2B, 0x5A, 0x2C, 0x5A, 0x12, 0x2B, 0x01, 0x05, 0x08, 0x09, 0x5B,
+    0x53, 0x09, 0x86, 0x06, 0x81, 0x09, 0x84, 0x03, 0x80, 0x05, 0x82, 0x05, 0x80, 0x06, 0x84, 0x0A,
+    0x81, 0x22, 0x85, 0x06, 0x06, 0x22, 0x7F, 0x06, 0x32, 0x45, 0x43, 0x51, 0x81, 0x17, 0x82, 0x1D,
+    0x81, 0x0E, 0x04, 0x74, 0x13, 0x13, 0x0F, 0x10, 0x8B, 0x07, 0x80, 0x71, 0x85, 0x07, 0x18, 0x28,
+    0x0F, 0x0F, 0x13, 0x0F, 0x74, 0x12, 0x0E, 0x55, 0x12, 0x1A, 0x2F, 0x2F, 0x38, 0x2D, 0x5A, 0x2B,
+    0x2B, 0x25, 0x5A, 0x25, 0x33, 0x34, 0x2A, 0x5F, 0x84, 0x19, 0x2C, 0x14, 0x20, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x00, 0x5E, 0x5E, 0x1C, 0x4B, 0x20, 0x20, 0x02, 0x02, 0x01, 0x04, 0x00, 0x14, 0x08,
+    0x5F, 0x2C, 0x4E, 0x0B, 0x16, 0x5B, 0x1E, 0x73, 0x44, 0x24, 0x35, 0x24, 0x51, 0x24, 0x1E, 0x0A,
+    0x81, 0x0A, 0x6D, 0x0B, 0x59, 0x2D, 0x6D, 0x01, 0x83, 0x5E, 0x84, 0x4B, 0x05, 0x64, 0x1E, 0x1E,
+    0x64, 0x5E, 0x7E, 0x81, 0x04, 0x82, 0x0A, 0x09, 0x4B, 0x20, 0x3F, 0x06, 0x06, 0x6E, 0x47, 0x4D,
+    0x47, 0x4B, 0x83, 0x1B, 0x16, 0x5B, 0x0A, 0x06, 0x0A, 0x0A, 0x06, 0x05, 0x1F, 0x58, 0x73, 0x3B,
+    0x72, 0x29, 0x20, 0x3F, 0x6E, 0x63, 0x59, 0x48, 0x19, 0x46, 0x18, 0x28, 0x82, 0x27, 0x06, 0x07,
+    0x27, 0x07, 0x27, 0x07, 0x07, 0x39, 0x83, 0x07, 0x15, 0x28, 0x13, 0x18, 0x0F, 0x0F, 0x0E, 0x17,
+    0x29, 0x2B, 0x34, 0x57, 0x33, 0x25, 0x57, 0x59, 0x45, 0x3F, 0x05, 0x05, 0x03, 0x06, 0x68, 0x82,
+    0x09, 0x85, 0x06, 0x81, 0x09, 0x81, 0x03, 0x03, 0x6D, 0x03, 0x03, 0x05, 0x83, 0x05, 0x01, 0x06,
+    0x7E, 0x82, 0x0A, 0x82, 0x22, 0x83, 0x06, 0x08, 0x0A, 0x05, 0x7F, 0x06, 0x57, 0x29, 0x35, 0x2F,
+    0x6C, 0x81, 0x1D, 0x83, 0x0E, 0x82, 0x0F, 0x01, 0x18, 0x71, 0x86, 0x07, 0x80, 0x27, 0x83, 0x07,
+    0x80, 0x27, 0x84, 0x07, 0x02, 0x39, 0x18, 0x0F, 0x81, 0x55, 0x84, 0x0F, 0x10, 0x0E, 0x17, 0x1A,
+    0x45, 0x2F, 0x2D, 0x25, 0x2E, 0x0C, 0x3D, 0x2E, 0x25, 0x33, 0x48, 0x5F, 0x19, 0x14, 0x82, 0x19,
+    0x04, 0x1F, 0x02, 0x02, 0x04, 0x1C, 0x81, 0x01, 0x86, 0x5E, 0x1E, 0x76, 0x7C, 0x02, 0x04, 0x01,
+    0x02, 0x5C, 0x03, 0x19, 0x48, 0x1B, 0x1B, 0x0B, 0x1B, 0x0B, 0x73, 0x44, 0x25, 0x34, 0x4C, 0x56,
+    0x72, 0x5B, 0x0A, 0x03, 0x01, 0x01, 0x81, 0x51, 0x34, 0x09, 0x82, 0x01, 0x3A, 0x03, 0x22, 0x01,
+    0x5E, 0x5E, 0x4B, 0x22, 0x0A, 0x22, 0x4B, 0x04, 0x02, 0x09, 0x01, 0x22, 0x04, 0x06, 0x22, 0x7E,
+    0x05, 0x76, 0x3F, 0x76, 0x22, 0x76, 0x5D, 0x60, 0x09, 0x0A, 0x0A, 0x09, 0x5B, 0x0B, 0x3B, 0x1B,
+    0x5B, 0x09, 0x4C, 0x03, 0x0A, 0x08, 0x14, 0x20, 0x61, 0x36, 0x2C, 0x20, 0x5F, 0x6D, 0x72, 0x29,
+    0x34, 0x25, 0x27, 0x28, 0x39, 0x07, 0x27, 0x71, 0x82, 0x27, 0x86, 0x07, 0x16, 0x39, 0x13, 0x18,
+    0x0E, 0x12, 0x12, 0x51, 0x2B, 0x2B, 0x48, 0x48, 0x25, 0x5A, 0x2A, 0x2D, 0x29, 0x01, 0x05, 0x09,
+    0x6D, 0x4C, 0x7B, 0x6D, 0x82, 0x09, 0x82, 0x06, 0x01, 0x09, 0x06, 0x82, 0x09, 0x84, 0x03, 0x82,
+    0x05, 0x01, 0x06, 0x7E, 0x84, 0x0A, 0x81, 0x22, 0x84, 0x06, 0x12, 0x09, 0x7E, 0x06, 0x0A, 0x49,
+    0x59, 0x2D, 0x6C, 0x12, 0x1D, 0x1D, 0x0E, 0x0E, 0x0F, 0x0E, 0x0F, 0x23, 0x18, 0x71, 0x83, 0x07,
+    0x82, 0x27, 0x81, 0x07, 0x03, 0x27, 0x07, 0x07, 0x27, 0x84, 0x07, 0x02, 0x10, 0x23, 0x0F, 0x81,
+    0x55, 0x85, 0x0F, 0x18, 0x12, 0x1A, 0x37, 0x37, 0x2F, 0x29, 0x45, 0x29, 0x25, 0x34, 0x2B, 0x48,
+    0x19, 0x20, 0x6E, 0x14, 0x14, 0x19, 0x14, 0x00, 0x00, 0x01, 0x04, 0x01, 0x04, 0x84, 0x5E, 0x82,
+    0x4B, 0x1D, 0x5E, 0x76, 0x76, 0x02, 0x02, 0x3F, 0x0D, 0x03, 0x19, 0x31, 0x0B, 0x1B, 0x1B, 0x0B,
+    0x1B, 0x0B, 0x32, 0x36, 0x4C, 0x06, 0x44, 0x33, 0x0B, 0x01, 0x0A, 0x0A, 0x1E, 0x72, 0x56, 0x00,
+    0x84, 0x01, 0x03, 0x5E, 0x4B, 0x64, 0x22, 0x82, 0x4B, 0x81, 0x5E, 0x2E, 0x3F, 0x01, 0x06, 0x04,
+    0x16, 0x0A, 0x02, 0x22, 0x64, 0x1E, 0x0B, 0x61, 0x0B, 0x4C, 0x4C, 0x0A, 0x4B, 0x1E, 0x1E, 0x5B,
+    0x0A, 0x5E, 0x0A, 0x0A, 0x5B, 0x4E, 0x3B, 0x5B, 0x0B, 0x6D, 0x08, 0x00, 0x20, 0x5F, 0x08, 0x36,
+    0x19, 0x14, 0x2E, 0x14, 0x24, 0x3D, 0x59, 0x18, 0x28, 0x07, 0x28, 0x82, 0x27, 0x87, 0x07, 0x07,
+    0x27, 0x07, 0x28, 0x13, 0x0E, 0x12, 0x6C, 0x32, 0x82, 0x2B, 0x0B, 0x2E, 0x36, 0x2E, 0x2C, 0x56,
+    0x2E, 0x0A, 0x53, 0x09, 0x6D, 0x7B, 0x06, 0x84, 0x09, 0x81, 0x06, 0x84, 0x09, 0x80, 0x06, 0x83,
+    0x03, 0x82, 0x05, 0x01, 0x06, 0x7E, 0x84, 0x0A, 0x81, 0x22, 0x84, 0x06, 0x11, 0x22, 0x0A, 0x04,
+    0x1E, 0x06, 0x32, 0x2D, 0x17, 0x12, 0x1D, 0x1D, 0x0E, 0x0E, 0x0F, 0x0F, 0x13, 0x18, 0x28, 0x85,
+    0x07, 0x02, 0x27, 0x28, 0x27, 0x88, 0x07, 0x02, 0x39, 0x10, 0x23, 0x87, 0x0F, 0x13, 0x0E, 0x1A,
+    0x17, 0x13, 0x2F, 0x44, 0x2F, 0x0C, 0x33, 0x57, 0x42, 0x31, 0x49, 0x58, 0x14, 0x19, 0x14, 0x14,
+    0x1F, 0x02, 0x81, 0x01, 0x81, 0x76, 0x83, 0x5E, 0x87, 0x4B, 0x24, 0x5E, 0x01, 0x08, 0x02, 0x0D,
+    0x01, 0x19, 0x1F, 0x0B, 0x1B, 0x1B, 0x16, 0x0B, 0x1B, 0x32, 0x2E, 0x03, 0x1B, 0x59, 0x33, 0x1B,
+    0x7E, 0x0A, 0x0A, 0x81, 0x44, 0x24, 0x73, 0x81, 0x6D, 0x03, 0x0A, 0x5E, 0x03, 0x03, 0x76, 0x4B,
+    0x82, 0x5E, 0x81, 0x01, 0x0A, 0x02, 0x73, 0x0A, 0x09, 0x0A, 0x5B, 0x73, 0x5D, 0x60, 0x47, 0x66,
+    0x83, 0x4D, 0x82, 0x47, 0x1F, 0x0A, 0x09, 0x0A, 0x06, 0x06, 0x0B, 0x0B, 0x22, 0x7B, 0x1B, 0x1B,
+    0x0B, 0x73, 0x01, 0x6D, 0x20, 0x48, 0x72, 0x5A, 0x20, 0x2E, 0x3D, 0x2A, 0x24, 0x29, 0x71, 0x27,
+    0x07, 0x28, 0x71, 0x39, 0x18, 0x87, 0x07, 0x16, 0x27, 0x07, 0x39, 0x0E, 0x12, 0x1D, 0x2D, 0x33,
+    0x2E, 0x2E, 0x2B, 0x2E, 0x3D, 0x2B, 0x2C, 0x59, 0x19, 0x0A, 0x53, 0x09, 0x4C, 0x09, 0x06, 0x85,
+    0x09, 0x80, 0x06, 0x85, 0x09, 0x83, 0x03, 0x03, 0x05, 0x06, 0x06, 0x7E, 0x86, 0x0A, 0x80, 0x22,
+    0x83, 0x06, 0x0A, 0x53, 0x64, 0x64, 0x16, 0x7F, 0x05, 0x25, 0x43, 0x51, 0x12, 0x1D, 0x82, 0x0E,
+    0x04, 0x0F, 0x13, 0x0F, 0x23, 0x39, 0x86, 0x07, 0x05, 0x27, 0x28, 0x28, 0x07, 0x07, 0x27, 0x84,
+    0x07, 0x01, 0x28, 0x23, 0x88, 0x0F, 0x14, 0x17, 0x13, 0x0E, 0x1D, 0x37, 0x44, 0x32, 0x25, 0x31,
+    0x14, 0x20, 0x58, 0x19, 0x5F, 0x19, 0x08, 0x14, 0x1F, 0x3F, 0x02, 0x04, 0x81, 0x76, 0x82, 0x5E,
+    0x89, 0x4B, 0x1F, 0x22, 0x03, 0x4C, 0x03, 0x02, 0x7E, 0x49, 0x3F, 0x0B, 0x1B, 0x3B, 0x1B, 0x5B,
+    0x4E, 0x3C, 0x2A, 0x24, 0x2A, 0x25, 0x19, 0x1E, 0x03, 0x00, 0x1B, 0x24, 0x2F, 0x33, 0x44, 0x34,
+    0x6D, 0x0A, 0x03, 0x82, 0x01, 0x11, 0x0A, 0x01, 0x02, 0x01, 0x01, 0x1C, 0x5E, 0x0D, 0x0A, 0x0A,
+    0x0B, 0x09, 0x4C, 0x4C, 0x73, 0x3B, 0x3B, 0x0B, 0x82, 0x61, 0x82, 0x47, 0x1C, 0x66, 0x47, 0x4D,
+    0x68, 0x06, 0x64, 0x5B, 0x7E, 0x6D, 0x06, 0x73, 0x4C, 0x3B, 0x0B, 0x09, 0x3F, 0x08, 0x3C, 0x2E,
+    0x44, 0x57, 0x31, 0x29, 0x44, 0x2B, 0x34, 0x13, 0x27, 0x07, 0x81, 0x27, 0x83, 0x07, 0x80, 0x27,
+    0x86, 0x07, 0x04, 0x39, 0x13, 0x17, 0x51, 0x3D, 0x82, 0x2E, 0x0D, 0x25, 0x5A, 0x32, 0x2B, 0x24,
+    0x14, 0x03, 0x7B, 0x7B, 0x09, 0x4C, 0x09, 0x53, 0x7B, 0x83, 0x09, 0x81, 0x06, 0x86, 0x09, 0x82,
+    0x03, 0x80, 0x06, 0x82, 0x7E, 0x86, 0x0A, 0x80, 0x22, 0x83, 0x06, 0x0A, 0x64, 0x16, 0x06, 0x1E,
+    0x06, 0x06, 0x33, 0x43, 0x51, 0x17, 0x1D, 0x82, 0x0E, 0x04, 0x0F, 0x13, 0x13, 0x23, 0x39, 0x87,
+    0x07, 0x82, 0x28, 0x86, 0x07, 0x02, 0x10, 0x23, 0x55, 0x87, 0x0F, 0x13, 0x0E, 0x0F, 0x74, 0x17,
+    0x45, 0x36, 0x25, 0x2A, 0x19, 0x5C, 0x0D, 0x5C, 0x58, 0x14, 0x1F, 0x20, 0x1F, 0x20, 0x00, 0x04,
+    0x82, 0x76, 0x81, 0x5E, 0x86, 0x4B, 0x84, 0x64, 0x24, 0x4B, 0x0A, 0x04, 0x02, 0x09, 0x14, 0x01,
+    0x3B, 0x4E, 0x0B, 0x1B, 0x3B, 0x7B, 0x4E, 0x5B, 0x1B, 0x0A, 0x0B, 0x0A, 0x4B, 0x0A, 0x0A, 0x09,
+    0x2C, 0x72, 0x2C, 0x24, 0x62, 0x6D, 0x01, 0x08, 0x01, 0x01, 0x00, 0x1F, 0x1F, 0x00, 0x82, 0x01,
+    0x0A, 0x02, 0x0D, 0x06, 0x6D, 0x5B, 0x1B, 0x1B, 0x61, 0x47, 0x60, 0x54, 0x83, 0x70, 0x01, 0x62,
+    0x70, 0x81, 0x62, 0x83, 0x70, 0x17, 0x6E, 0x4C, 0x73, 0x04, 0x1E, 0x5B, 0x03, 0x4C, 0x73, 0x73,
+    0x4C, 0x1F, 0x02, 0x2A, 0x29, 0x3D, 0x20, 0x3D, 0x56, 0x37, 0x72, 0x51, 0x27, 0x71, 0x8D, 0x07,
+    0x14, 0x71, 0x13, 0x6C, 0x32, 0x2E, 0x3D, 0x2E, 0x5A, 0x3D, 0x32, 0x59, 0x33, 0x19, 0x1E, 0x09,
+    0x53, 0x09, 0x73, 0x09, 0x73, 0x53, 0x84, 0x09, 0x81, 0x06, 0x81, 0x09, 0x82, 0x06, 0x82, 0x09,
+    0x01, 0x06, 0x03, 0x82, 0x7E, 0x88, 0x0A, 0x83, 0x06, 0x81, 0x22, 0x10, 0x06, 0x64, 0x64, 0x1E,
+    0x2C, 0x0C, 0x38, 0x17, 0x1D, 0x0E, 0x0E, 0x1D, 0x0F, 0x0F, 0x13, 0x10, 0x39, 0x88, 0x07, 0x02,
+    0x27, 0x28, 0x27, 0x84, 0x07, 0x06, 0x39, 0x10, 0x10, 0x55, 0x0F, 0x0F, 0x13, 0x84, 0x0F, 0x11,
+    0x0E, 0x10, 0x1A, 0x38, 0x2D, 0x33, 0x19, 0x14, 0x5C, 0x0D, 0x0D, 0x58, 0x14, 0x14, 0x1F, 0x1F,
+    0x3F, 0x7C, 0x81, 0x04, 0x81, 0x76, 0x81, 0x5E, 0x84, 0x4B, 0x81, 0x64, 0x01, 0x1E, 0x16, 0x82,
+    0x1E, 0x0B, 0x64, 0x1E, 0x64, 0x04, 0x7E, 0x08, 0x3F, 0x06, 0x4D, 0x69, 0x1B, 0x3B, 0x83, 0x1B,
+    0x1E, 0x1E, 0x1B, 0x1B, 0x16, 0x64, 0x01, 0x03, 0x5E, 0x6D, 0x0A, 0x03, 0x1B, 0x01, 0x4C, 0x08,
+    0x01, 0x01, 0x00, 0x20, 0x20, 0x00, 0x0A, 0x5E, 0x76, 0x01, 0x3F, 0x01, 0x5B, 0x73, 0x54, 0x70,
+    0x83, 0x62, 0x81, 0x24, 0x81, 0x3C, 0x01, 0x5D, 0x4C, 0x83, 0x6E, 0x1D, 0x08, 0x31, 0x24, 0x62,
+    0x24, 0x24, 0x3C, 0x6E, 0x01, 0x1B, 0x0A, 0x73, 0x4C, 0x6D, 0x03, 0x14, 0x1F, 0x2E, 0x37, 0x48,
+    0x2C, 0x44, 0x0E, 0x2F, 0x2D, 0x07, 0x71, 0x71, 0x07, 0x10, 0x8B, 0x07, 0x02, 0x18, 0x45, 0x5A,
+    0x82, 0x3D, 0x81, 0x32, 0x06, 0x29, 0x36, 0x34, 0x19, 0x06, 0x7B, 0x53, 0x82, 0x09, 0x80, 0x4C,
+    0x86, 0x09, 0x80, 0x06, 0x81, 0x09, 0x84, 0x06, 0x80, 0x09, 0x81, 0x06, 0x80, 0x7E, 0x85, 0x0A,
+    0x80, 0x06, 0x83, 0x0A, 0x83, 0x06, 0x11, 0x53, 0x06, 0x0A, 0x09, 0x06, 0x1E, 0x19, 0x0C, 0x2D,
+    0x1A, 0x1D, 0x1D, 0x0E, 0x0E, 0x0F, 0x13, 0x23, 0x10, 0x91, 0x07, 0x08, 0x39, 0x10, 0x23, 0x55,
+    0x0F, 0x0F, 0x13, 0x0F, 0x55, 0x83, 0x0F, 0x15, 0x17, 0x2F, 0x29, 0x25, 0x2A, 0x1F, 0x3F, 0x20,
+    0x20, 0x1F, 0x1F, 0x14, 0x14, 0x1F, 0x20, 0x02, 0x02, 0x76, 0x5E, 0x5E, 0x76, 0x5E, 0x84, 0x4B,
+    0x81, 0x64, 0x88, 0x1E, 0x21, 0x64, 0x0A, 0x5C, 0x05, 0x53, 0x66, 0x69, 0x4E, 0x3B, 0x3B, 0x69,
+    0x4E, 0x0B, 0x1B, 0x0B, 0x0B, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x1C, 0x0D, 0x08, 0x5C, 0x81, 0x08,
+    0x01, 0x08, 0x14, 0x1F, 0x20, 0x1C, 0x00, 0x83, 0x01, 0x31, 0x6E, 0x5D, 0x6E, 0x6A, 0x72, 0x24,
+    0x3C, 0x14, 0x02, 0x05, 0x04, 0x0D, 0x4C, 0x0D, 0x5D, 0x47, 0x5D, 0x08, 0x4C, 0x03, 0x01, 0x03,
+    0x05, 0x0D, 0x20, 0x58, 0x14, 0x2C, 0x6E, 0x6D, 0x09, 0x0D, 0x47, 0x60, 0x6E, 0x20, 0x19, 0x48,
+    0x56, 0x3D, 0x3C, 0x29, 0x37, 0x65, 0x2D, 0x39, 0x27, 0x39, 0x07, 0x39, 0x8B, 0x07, 0x12, 0x28,
+    0x29, 0x36, 0x3D, 0x36, 0x32, 0x0C, 0x0C, 0x2D, 0x36, 0x34, 0x58, 0x7B, 0x7B, 0x4C, 0x73, 0x09,
+    0x5B, 0x53, 0x86, 0x09, 0x80, 0x06, 0x81, 0x09, 0x87, 0x06, 0x85, 0x0A, 0x81, 0x06, 0x83, 0x0A,
+    0x83, 0x06, 0x11, 0x22, 0x16, 0x4B, 0x06, 0x16, 0x1E, 0x5C, 0x2D, 0x2D, 0x1A, 0x1D, 0x1D, 0x0E,
+    0x0E, 0x0F, 0x13, 0x23, 0x10, 0x91, 0x07, 0x1E, 0x71, 0x10, 0x23, 0x0F, 0x0E, 0x0F, 0x13, 0x0F,
+    0x55, 0x55, 0x0F, 0x0F, 0x0E, 0x51, 0x29, 0x2B, 0x42, 0x19, 0x14, 0x19, 0x19, 0x14, 0x14, 0x1F,
+    0x20, 0x20, 0x3F, 0x3F, 0x04, 0x04, 0x76, 0x82, 0x5E, 0x84, 0x4B, 0x81, 0x64, 0x8A, 0x1E, 0x05,
+    0x04, 0x6E, 0x3B, 0x68, 0x4D, 0x1B, 0x83, 0x4E, 0x81, 0x61, 0x05, 0x4E, 0x1B, 0x0B, 0x16, 0x0A,
+    0x7E, 0x82, 0x01, 0x81, 0x08, 0x01, 0x81, 0x6E, 0x81, 0x08, 0x81, 0x14, 0x82, 0x20, 0x35, 0x00,
+    0x02, 0x00, 0x7E, 0x1F, 0x24, 0x62, 0x38, 0x30, 0x81, 0x5E, 0x3F, 0x04, 0x04, 0x58, 0x08, 0x08,
+    0x00, 0x6D, 0x03, 0x4C, 0x5D, 0x0B, 0x1B, 0x0B, 0x6D, 0x01, 0x01, 0x00, 0x01, 0x7C, 0x01, 0x81,
+    0x19, 0x5D, 0x68, 0x6D, 0x5D, 0x60, 0x4C, 0x0D, 0x42, 0x57, 0x32, 0x44, 0x31, 0x3D, 0x37, 0x12,
+    0x17, 0x28, 0x27, 0x07, 0x39, 0x85, 0x07, 0x81, 0x27, 0x84, 0x07, 0x14, 0x39, 0x2F, 0x5A, 0x29,
+    0x32, 0x32, 0x0C, 0x29, 0x45, 0x5A, 0x34, 0x81, 0x7B, 0x5B, 0x09, 0x4C, 0x4C, 0x16, 0x53, 0x09,
+    0x06, 0x84, 0x09, 0x80, 0x06, 0x81, 0x09, 0x87, 0x06, 0x83, 0x0A, 0x85, 0x06, 0x83, 0x22, 0x81,
+    0x06, 0x11, 0x22, 0x06, 0x0A, 0x06, 0x06, 0x1E, 0x7F, 0x0C, 0x2D, 0x1A, 0x1D, 0x1D, 0x0E, 0x13,
+    0x13, 0x0F, 0x13, 0x39, 0x91, 0x07, 0x13, 0x39, 0x10, 0x23, 0x0F, 0x13, 0x0F, 0x23, 0x10, 0x74,
+    0x0E, 0x0F, 0x13, 0x1A, 0x44, 0x33, 0x24, 0x42, 0x31, 0x2A, 0x31, 0x81, 0x14, 0x83, 0x1F, 0x04,
+    0x3F, 0x02, 0x04, 0x04, 0x76, 0x81, 0x5E, 0x82, 0x4B, 0x83, 0x64, 0x8B, 0x1E, 0x19, 0x50, 0x0A,
+    0x4D, 0x4D, 0x47, 0x1B, 0x4E, 0x4E, 0x69, 0x4E, 0x69, 0x4D, 0x61, 0x3B, 0x7B, 0x5B, 0x22, 0x0A,
+    0x7E, 0x04, 0x08, 0x0D, 0x08, 0x08, 0x00, 0x20, 0x81, 0x49, 0x81, 0x14, 0x81, 0x20, 0x83, 0x00,
+    0x10, 0x20, 0x24, 0x3C, 0x34, 0x12, 0x25, 0x1C, 0x02, 0x02, 0x01, 0x03, 0x03, 0x08, 0x6E, 0x54,
+    0x54, 0x6E, 0x82, 0x54, 0x81, 0x3C, 0x18, 0x54, 0x4C, 0x4C, 0x81, 0x02, 0x03, 0x08, 0x02, 0x6E,
+    0x73, 0x60, 0x60, 0x6D, 0x6E, 0x6E, 0x1F, 0x5F, 0x3D, 0x37, 0x34, 0x34, 0x37, 0x0E, 0x0F, 0x28,
+    0x86, 0x07, 0x16, 0x27, 0x28, 0x28, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x39, 0x12, 0x32, 0x3D,
+    0x29, 0x29, 0x45, 0x45, 0x44, 0x5A, 0x2C, 0x7B, 0x09, 0x7B, 0x82, 0x09, 0x01, 0x7B, 0x09, 0x83,
+    0x06, 0x85, 0x09, 0x87, 0x06, 0x84, 0x0A, 0x84, 0x06, 0x83, 0x22, 0x81, 0x06, 0x0B, 0x0A, 0x16,
+    0x0A, 0x16, 0x16, 0x1B, 0x06, 0x36, 0x43, 0x51, 0x12, 0x1D, 0x82, 0x0E, 0x02, 0x0F, 0x23, 0x28,
+    0x91, 0x07, 0x0C, 0x39, 0x10, 0x23, 0x0F, 0x13, 0x0F, 0x23, 0x13, 0x74, 0x0F, 0x0F, 0x0E, 0x1A,
+    0x82, 0x33, 0x09, 0x34, 0x2C, 0x31, 0x19, 0x14, 0x14, 0x1F, 0x1F, 0x20, 0x3F, 0x81, 0x02, 0x81,
+    0x04, 0x82, 0x5E, 0x82, 0x4B, 0x81, 0x64, 0x8A, 0x1E, 0x1E, 0x1B, 0x1E, 0x50, 0x16, 0x0B, 0x04,
+    0x6B, 0x4D, 0x61, 0x4E, 0x69, 0x61, 0x6B, 0x66, 0x4D, 0x6B, 0x61, 0x73, 0x1B, 0x22, 0x03, 0x01,
+    0x01, 0x0D, 0x0D, 0x5C, 0x08, 0x08, 0x14, 0x42, 0x19, 0x81, 0x14, 0x81, 0x20, 0x82, 0x00, 0x82,
+    0x01, 0x0F, 0x1E, 0x49, 0x72, 0x34, 0x01, 0x64, 0x0D, 0x00, 0x3C, 0x24, 0x3C, 0x62, 0x54, 0x54,
+    0x4F, 0x3A, 0x82, 0x54, 0x81, 0x3C, 0x81, 0x62, 0x15, 0x24, 0x2C, 0x67, 0x70, 0x3C, 0x08, 0x09,
+    0x4C, 0x5D, 0x0B, 0x5B, 0x4C, 0x08, 0x2A, 0x2B, 0x17, 0x32, 0x63, 0x56, 0x0E, 0x0F, 0x28, 0x87,
+    0x07, 0x81, 0x27, 0x81, 0x07, 0x80, 0x27, 0x83, 0x07, 0x09, 0x12, 0x32, 0x32, 0x2D, 0x45, 0x45,
+    0x2F, 0x45, 0x25, 0x2A, 0x89, 0x09, 0x82, 0x06, 0x82, 0x09, 0x01, 0x06, 0x09, 0x87, 0x06, 0x81,
+    0x0A, 0x84, 0x7E, 0x82, 0x06, 0x83, 0x22, 0x81, 0x06, 0x0B, 0x0A, 0x64, 0x0A, 0x06, 0x16, 0x1E,
+    0x16, 0x72, 0x43, 0x2F, 0x17, 0x1D, 0x82, 0x0E, 0x02, 0x0F, 0x23, 0x28, 0x91, 0x07, 0x03, 0x39,
+    0x10, 0x23, 0x0F, 0x82, 0x55, 0x0D, 0x0E, 0x13, 0x23, 0x74, 0x17, 0x29, 0x29, 0x59, 0x25, 0x2C,
+    0x57, 0x2A, 0x19, 0x14, 0x82, 0x1F, 0x03, 0x3F, 0x02, 0x02, 0x01, 0x81, 0x04, 0x82, 0x5E, 0x81,
+    0x4B, 0x80, 0x64, 0x8D, 0x1E, 0x21, 0x22, 0x05, 0x1E, 0x06, 0x0B, 0x4E, 0x1B, 0x4E, 0x61, 0x4E,
+    0x69, 0x4E, 0x7D, 0x6F, 0x66, 0x5D, 0x5D, 0x73, 0x0A, 0x01, 0x03, 0x01, 0x0D, 0x0D, 0x08, 0x08,
+    0x49, 0x31, 0x31, 0x19, 0x14, 0x14, 0x1F, 0x20, 0x82, 0x00, 0x81, 0x02, 0x2D, 0x5E, 0x0A, 0x49,
+    0x34, 0x2C, 0x57, 0x33, 0x5A, 0x34, 0x2C, 0x3C, 0x53, 0x7B, 0x4E, 0x3B, 0x66, 0x47, 0x4E, 0x69,
+    0x4E, 0x4E, 0x1B, 0x1B, 0x7B, 0x7B, 0x50, 0x62, 0x70, 0x34, 0x33, 0x3C, 0x03, 0x08, 0x4C, 0x5D,
+    0x4C, 0x00, 0x03, 0x48, 0x44, 0x45, 0x2C, 0x44, 0x0E, 0x0F, 0x28, 0x8B, 0x07, 0x80, 0x27, 0x83,
+    0x07, 0x09, 0x65, 0x29, 0x29, 0x2D, 0x45, 0x44, 0x51, 0x29, 0x25, 0x19, 0x8A, 0x09, 0x82, 0x06,
+    0x81, 0x09, 0x89, 0x06, 0x81, 0x0A, 0x85, 0x7E, 0x81, 0x06, 0x82, 0x22, 0x81, 0x06, 0x81, 0x0A,
+    0x0F, 0x64, 0x09, 0x7B, 0x5B, 0x16, 0x1E, 0x2A, 0x43, 0x45, 0x17, 0x1D, 0x0E, 0x12, 0x0E, 0x13,
+    0x18, 0x92, 0x07, 0x1A, 0x39, 0x10, 0x10, 0x55, 0x0F, 0x0F, 0x55, 0x0E, 0x13, 0x13, 0x12, 0x17,
+    0x17, 0x51, 0x5A, 0x33, 0x34, 0x2A, 0x31, 0x1F, 0x14, 0x1F, 0x1F, 0x3F, 0x20, 0x02, 0x01, 0x82,
+    0x04, 0x81, 0x5E, 0x82, 0x4B, 0x8D, 0x1E, 0x01, 0x64, 0x06, 0x82, 0x1B, 0x81, 0x4E, 0x82, 0x1B,
+    0x17, 0x4E, 0x69, 0x4E, 0x75, 0x6F, 0x75, 0x5D, 0x3B, 0x5B, 0x09, 0x7E, 0x01, 0x0D, 0x00, 0x0D,
+    0x08, 0x58, 0x24, 0x31, 0x31, 0x49, 0x14, 0x14, 0x1F, 0x82, 0x20, 0x0E, 0x00, 0x01, 0x5C, 0x04,
+    0x01, 0x03, 0x29, 0x37, 0x29, 0x34, 0x31, 0x09, 0x22, 0x16, 0x1B, 0x82, 0x0B, 0x1E, 0x4E, 0x69,
+    0x61, 0x4E, 0x3B, 0x0B, 0x1B, 0x4E, 0x3B, 0x4E, 0x1B, 0x69, 0x6B, 0x0B, 0x3C, 0x72, 0x72, 0x49,
+    0x03, 0x4C, 0x68, 0x6E, 0x14, 0x00, 0x29, 0x37, 0x34, 0x29, 0x0E, 0x0F, 0x28, 0x89, 0x07, 0x81,
+    0x27, 0x84, 0x07, 0x80, 0x65, 0x81, 0x2D, 0x82, 0x2F, 0x05, 0x51, 0x59, 0x25, 0x58, 0x09, 0x16,
+    0x89, 0x09, 0x81, 0x06, 0x82, 0x09, 0x88, 0x06, 0x81, 0x0A, 0x83, 0x7E, 0x83, 0x06, 0x82, 0x22,
+    0x81, 0x06, 0x81, 0x0A, 0x82, 0x06, 0x0C, 0x5B, 0x16, 0x1B, 0x49, 0x0C, 0x2D, 0x6C, 0x1D, 0x1D,
+    0x0E, 0x13, 0x0F, 0x23, 0x92, 0x07, 0x01, 0x39, 0x10, 0x82, 0x23, 0x82, 0x0F, 0x0B, 0x13, 0x0E,
+    0x1D, 0x1D, 0x12, 0x35, 0x36, 0x33, 0x57, 0x2A, 0x19, 0x14, 0x82, 0x1F, 0x03, 0x3F, 0x02, 0x02,
+    0x01, 0x82, 0x04, 0x04, 0x5E, 0x22, 0x4B, 0x4B, 0x64, 0x84, 0x1E, 0x83, 0x1B, 0x82, 0x1E, 0x05,
+    0x4B, 0x64, 0x1E, 0x1B, 0x4E, 0x1B, 0x81, 0x4E, 0x82, 0x1B, 0x13, 0x1E, 0x4E, 0x1B, 0x69, 0x6B,
+    0x6F, 0x7D, 0x69, 0x61, 0x73, 0x73, 0x7E, 0x04, 0x0D, 0x0D, 0x08, 0x5C, 0x31, 0x24, 0x31, 0x82,
+    0x19, 0x81, 0x14, 0x82, 0x20, 0x19, 0x00, 0x01, 0x02, 0x01, 0x03, 0x1B, 0x08, 0x48, 0x58, 0x02,
+    0x06, 0x06, 0x09, 0x09, 0x0B, 0x06, 0x1B, 0x61, 0x4D, 0x6B, 0x4E, 0x69, 0x69, 0x4E, 0x4E, 0x1B,
+    0x82, 0x4E, 0x80, 0x1B, 0x82, 0x4E, 0x0F, 0x1B, 0x08, 0x72, 0x34, 0x19, 0x73, 0x0B, 0x08, 0x14,
+    0x25, 0x12, 0x36, 0x45, 0x0E, 0x23, 0x28, 0x89, 0x07, 0x80, 0x27, 0x85, 0x07, 0x0B, 0x13, 0x45,
+    0x45, 0x2F, 0x51, 0x2F, 0x2F, 0x59, 0x33, 0x0D, 0x09, 0x16, 0x89, 0x09, 0x80, 0x06, 0x83, 0x09,
+    0x88, 0x06, 0x83, 0x7E, 0x85, 0x06, 0x80, 0x22, 0x83, 0x06, 0x81, 0x0A, 0x10, 0x06, 0x16, 0x06,
+    0x5B, 0x16, 0x1B, 0x05, 0x36, 0x2D, 0x6C, 0x17, 0x1D, 0x0E, 0x0E, 0x13, 0x13, 0x39, 0x92, 0x07,
+    0x80, 0x39, 0x82, 0x10, 0x81, 0x0F, 0x0C, 0x13, 0x0E, 0x74, 0x65, 0x37, 0x25, 0x36, 0x5A, 0x34,
+    0x24, 0x2A, 0x42, 0x14, 0x82, 0x1F, 0x0B, 0x3F, 0x02, 0x01, 0x01, 0x04, 0x01, 0x04, 0x5E, 0x5E,
+    0x22, 0x4B, 0x64, 0x84, 0x1E, 0x80, 0x1B, 0x83, 0x4E, 0x21, 0x1E, 0x1B, 0x1B, 0x1E, 0x1B, 0x4E,
+    0x4E, 0x69, 0x4E, 0x4E, 0x3B, 0x4E, 0x1E, 0x1B, 0x1E, 0x4E, 0x4E, 0x1B, 0x3E, 0x6F, 0x66, 0x61,
+    0x68, 0x09, 0x0A, 0x01, 0x0D, 0x08, 0x08, 0x49, 0x2A, 0x24, 0x24, 0x31, 0x81, 0x19, 0x82, 0x14,
+    0x17, 0x3F, 0x7C, 0x20, 0x20, 0x08, 0x03, 0x0D, 0x0D, 0x03, 0x3F, 0x00, 0x3F, 0x22, 0x06, 0x06,
+    0x64, 0x06, 0x3B, 0x0B, 0x4E, 0x69, 0x69, 0x4E, 0x69, 0x82, 0x4E, 0x80, 0x3B, 0x84, 0x4E, 0x01,
+    0x69, 0x4E, 0x82, 0x1B, 0x0C, 0x08, 0x33, 0x72, 0x5D, 0x4C, 0x08, 0x2C, 0x65, 0x0C, 0x17, 0x13,
+    0x23, 0x28, 0x90, 0x07, 0x80, 0x0F, 0x82, 0x2F, 0x05, 0x51, 0x2F, 0x2F, 0x32, 0x57, 0x05, 0x8B,
+    0x09, 0x81, 0x06, 0x82, 0x09, 0x88, 0x06, 0x89, 0x06, 0x80, 0x22, 0x83, 0x06, 0x81, 0x0A, 0x09,
+    0x06, 0x64, 0x22, 0x06, 0x16, 0x1E, 0x16, 0x25, 0x2D, 0x1A, 0x81, 0x17, 0x82, 0x0E, 0x01, 0x1D,
+    0x41, 0x92, 0x07, 0x12, 0x39, 0x10, 0x23, 0x10, 0x10, 0x13, 0x0F, 0x74, 0x0E, 0x65, 0x32, 0x33,
+    0x59, 0x25, 0x34, 0x2C, 0x42, 0x42, 0x19, 0x82, 0x1F, 0x03, 0x02, 0x0D, 0x0D, 0x01, 0x82, 0x04,
+    0x81, 0x5E, 0x02, 0x22, 0x4B, 0x64, 0x82, 0x1E, 0x82, 0x1B, 0x82, 0x4E, 0x80, 0x69, 0x84, 0x4E,
+    0x83, 0x69, 0x80, 0x4D, 0x82, 0x1B, 0x0B, 0x1E, 0x1B, 0x1B, 0x4E, 0x69, 0x66, 0x6F, 0x7D, 0x0B,
+    0x61, 0x5B, 0x03, 0x82, 0x08, 0x01, 0x58, 0x24, 0x81, 0x2C, 0x81, 0x24, 0x82, 0x19, 0x17, 0x14,
+    0x1F, 0x3F, 0x7C, 0x20, 0x20, 0x08, 0x01, 0x04, 0x0D, 0x0A, 0x1F, 0x02, 0x09, 0x05, 0x6D, 0x0A,
+    0x73, 0x1B, 0x5B, 0x61, 0x3B, 0x3B, 0x6B, 0x82, 0x69, 0x83, 0x4E, 0x80, 0x1B, 0x82, 0x4E, 0x01,
+    0x1B, 0x1E, 0x84, 0x1B, 0x0A, 0x72, 0x36, 0x4C, 0x6E, 0x49, 0x37, 0x2F, 0x37, 0x0F, 0x18, 0x71,
+    0x90, 0x07, 0x0B, 0x23, 0x1A, 0x51, 0x51, 0x1A, 0x1A, 0x45, 0x36, 0x31, 0x06, 0x06, 0x73, 0x8D,
+    0x09, 0x01, 0x06, 0x09, 0x87, 0x06, 0x86, 0x06, 0x80, 0x22, 0x86, 0x06, 0x14, 0x0A, 0x16, 0x06,
+    0x1E, 0x06, 0x5B, 0x0B, 0x16, 0x1E, 0x34, 0x43, 0x1A, 0x37, 0x17, 0x13, 0x0E, 0x0E, 0x6C, 0x79,
+    0x07, 0x27, 0x90, 0x07, 0x12, 0x39, 0x10, 0x10, 0x18, 0x10, 0x0F, 0x55, 0x12, 0x1D, 0x12, 0x72,
+    0x0C, 0x0C, 0x36, 0x34, 0x2A, 0x2A, 0x42, 0x14, 0x82, 0x1F, 0x0A, 0x02, 0x08, 0x0D, 0x01, 0x04,
+    0x04, 0x01, 0x7E, 0x22, 0x22, 0x4B, 0x83, 0x1E, 0x81, 0x1B, 0x83, 0x4E, 0x05, 0x69, 0x4D, 0x4D,
+    0x0B, 0x1B, 0x69, 0x81, 0x6B, 0x82, 0x69, 0x12, 0x4E, 0x3B, 0x1B, 0x16, 0x16, 0x1B, 0x4E, 0x4E,
+    0x4D, 0x6F, 0x7D, 0x0B, 0x3B, 0x5B, 0x6D, 0x0D, 0x03, 0x00, 0x31, 0x83, 0x2C, 0x81, 0x24, 0x36,
+    0x31, 0x42, 0x14, 0x20, 0x5C, 0x6E, 0x5C, 0x14, 0x08, 0x7C, 0x04, 0x0D, 0x04, 0x22, 0x03, 0x22,
+    0x08, 0x7E, 0x06, 0x16, 0x7B, 0x3B, 0x0B, 0x4E, 0x4E, 0x61, 0x66, 0x66, 0x4D, 0x4D, 0x47, 0x69,
+    0x1B, 0x4D, 0x4D, 0x1B, 0x1B, 0x4E, 0x1B, 0x1E, 0x1B, 0x16, 0x0B, 0x1E, 0x1B, 0x5C, 0x3C, 0x00,
+    0x81, 0x36, 0x37, 0x0E, 0x23, 0x18, 0x71, 0x8C, 0x07, 0x04, 0x39, 0x07, 0x27, 0x07, 0x10, 0x81,
+    0x17, 0x82, 0x1A, 0x05, 0x2D, 0x36, 0x49, 0x5B, 0x06, 0x73, 0x8F, 0x09, 0x87, 0x06, 0x8D, 0x06,
+    0x81, 0x0A, 0x86, 0x16, 0x09, 0x1E, 0x19, 0x0C, 0x2F, 0x1A, 0x0E, 0x74, 0x1D, 0x0E, 0x10, 0x81,
+    0x79, 0x82, 0x07, 0x80, 0x27, 0x85, 0x07, 0x80, 0x27, 0x87, 0x07, 0x80, 0x39, 0x83, 0x10, 0x14,
+    0x13, 0x0E, 0x65, 0x2F, 0x35, 0x2D, 0x0C, 0x25, 0x33, 0x2C, 0x2A, 0x5F, 0x19, 0x14, 0x1F, 0x20,
+    0x00, 0x00, 0x02, 0x01, 0x04, 0x81, 0x01, 0x82, 0x5E, 0x03, 0x22, 0x1E, 0x1E, 0x5B, 0x82, 0x1B,
+    0x80, 0x4E, 0x81, 0x69, 0x82, 0x4D, 0x81, 0x6B, 0x81, 0x69, 0x82, 0x6B, 0x3E, 0x69, 0x4E, 0x4E,
+    0x1B, 0x1E, 0x16, 0x1E, 0x1B, 0x61, 0x4E, 0x75, 0x6F, 0x40, 0x0B, 0x3B, 0x73, 0x4C, 0x05, 0x6D,
+    0x3C, 0x57, 0x24, 0x2C, 0x34, 0x72, 0x2C, 0x2A, 0x19, 0x49, 0x3C, 0x50, 0x50, 0x6E, 0x49, 0x20,
+    0x3F, 0x02, 0x00, 0x04, 0x04, 0x03, 0x01, 0x04, 0x16, 0x03, 0x1E, 0x06, 0x1B, 0x0B, 0x3B, 0x68,
+    0x4F, 0x7D, 0x3E, 0x7D, 0x40, 0x7D, 0x66, 0x6B, 0x69, 0x6B, 0x4D, 0x4E, 0x83, 0x1B, 0x0E, 0x1E,
+    0x64, 0x16, 0x1B, 0x1E, 0x1B, 0x0D, 0x08, 0x01, 0x2C, 0x2F, 0x12, 0x18, 0x28, 0x39, 0x87, 0x07,
+    0x80, 0x27, 0x85, 0x07, 0x03, 0x71, 0x28, 0x23, 0x13, 0x82, 0x17, 0x06, 0x51, 0x2D, 0x5A, 0x05,
+    0x7B, 0x6D, 0x0B, 0x8E, 0x09, 0x88, 0x06, 0x8C, 0x06, 0x82, 0x0A, 0x83, 0x16, 0x11, 0x5B, 0x16,
+    0x16, 0x1E, 0x0D, 0x0C, 0x2F, 0x46, 0x12, 0x1D, 0x1D, 0x0E, 0x1D, 0x13, 0x11, 0x13, 0x07, 0x28,
+    0x8F, 0x07, 0x12, 0x39, 0x10, 0x23, 0x10, 0x0F, 0x0F, 0x0E, 0x65, 0x1A, 0x2D, 0x2F, 0x29, 0x25,
+    0x33, 0x34, 0x31, 0x5F, 0x19, 0x14, 0x81, 0x20, 0x83, 0x02, 0x81, 0x04, 0x0C, 0x03, 0x7E, 0x22,
+    0x22, 0x64, 0x1E, 0x1E, 0x1B, 0x1B, 0x4E, 0x3B, 0x1B, 0x69, 0x82, 0x4D, 0x0B, 0x6B, 0x75, 0x40,
+    0x4D, 0x69, 0x6B, 0x6B, 0x69, 0x69, 0x4E, 0x4E, 0x1B, 0x82, 0x1E, 0x0E, 0x1B, 0x3B, 0x61, 0x40,
+    0x6F, 0x75, 0x3B, 0x4E, 0x0B, 0x6D, 0x6D, 0x4C, 0x3C, 0x2C, 0x34, 0x82, 0x72, 0x01, 0x34, 0x24,
+    0x81, 0x3C, 0x82, 0x50, 0x31, 0x6E, 0x49, 0x20, 0x3F, 0x20, 0x02, 0x02, 0x80, 0x01, 0x0D, 0x04,
+    0x05, 0x6E, 0x05, 0x64, 0x16, 0x0B, 0x06, 0x60, 0x4F, 0x66, 0x47, 0x66, 0x7D, 0x4A, 0x7D, 0x4D,
+    0x61, 0x61, 0x6B, 0x69, 0x1B, 0x4E, 0x4E, 0x1B, 0x0B, 0x16, 0x64, 0x64, 0x04, 0x1B, 0x61, 0x60,
+    0x00, 0x49, 0x44, 0x74, 0x18, 0x28, 0x39, 0x8E, 0x07, 0x0D, 0x28, 0x10, 0x23, 0x13, 0x1D, 0x17,
+    0x37, 0x51, 0x0C, 0x33, 0x06, 0x7B, 0x09, 0x0B, 0x8E, 0x09, 0x80, 0x06, 0x83, 0x09, 0x83, 0x06,
+    0x82, 0x0A, 0x81, 0x7E, 0x82, 0x0A, 0x84, 0x06, 0x82, 0x0A, 0x0D, 0x16, 0x0A, 0x16, 0x16, 0x5B,
+    0x16, 0x16, 0x1E, 0x16, 0x5A, 0x2D, 0x46, 0x12, 0x1D, 0x82, 0x0E, 0x05, 0x13, 0x6C, 0x11, 0x07,
+    0x71, 0x39, 0x8E, 0x07, 0x12, 0x39, 0x28, 0x28, 0x10, 0x0F, 0x74, 0x74, 0x12, 0x1A, 0x1A, 0x2D,
+    0x0C, 0x36, 0x33, 0x34, 0x2C, 0x31, 0x31, 0x14, 0x81, 0x20, 0x82, 0x02, 0x80, 0x00, 0x82, 0x01,
+    0x04, 0x7E, 0x22, 0x5E, 0x4B, 0x1E, 0x83, 0x1B, 0x28, 0x4E, 0x4D, 0x66, 0x4D, 0x4D, 0x40, 0x4A,
+    0x6F, 0x4A, 0x3E, 0x75, 0x1B, 0x6B, 0x69, 0x69, 0x4E, 0x1B, 0x1B, 0x1E, 0x1E, 0x64, 0x16, 0x3B,
+    0x61, 0x4A, 0x6F, 0x66, 0x61, 0x3B, 0x0B, 0x4C, 0x73, 0x4C, 0x19, 0x2C, 0x34, 0x72, 0x34, 0x33,
+    0x34, 0x24, 0x82, 0x3C, 0x81, 0x50, 0x01, 0x3C, 0x49, 0x83, 0x20, 0x29, 0x02, 0x03, 0x02, 0x80,
+    0x22, 0x01, 0x7E, 0x05, 0x0A, 0x73, 0x09, 0x4C, 0x73, 0x0B, 0x6B, 0x4D, 0x66, 0x75, 0x40, 0x7D,
+    0x40, 0x6B, 0x69, 0x69, 0x3B, 0x1B, 0x4E, 0x4E, 0x1B, 0x1B, 0x0B, 0x16, 0x22, 0x22, 0x5E, 0x73,
+    0x4C, 0x5C, 0x00, 0x36, 0x0F, 0x28, 0x81, 0x39, 0x85, 0x07, 0x80, 0x27, 0x83, 0x07, 0x0F, 0x27,
+    0x07, 0x07, 0x71, 0x18, 0x18, 0x0F, 0x13, 0x1D, 0x17, 0x1A, 0x2F, 0x0C, 0x2C, 0x5B, 0x09, 0x81,
+    0x0B, 0x92, 0x09, 0x84, 0x06, 0x87, 0x0A, 0x83, 0x06, 0x85, 0x0A, 0x85, 0x16, 0x05, 0x1E, 0x34,
+    0x2D, 0x38, 0x12, 0x1D, 0x82, 0x0E, 0x81, 0x55, 0x03, 0x38, 0x79, 0x07, 0x27, 0x8E, 0x07, 0x12,
+    0x39, 0x28, 0x10, 0x10, 0x74, 0x0E, 0x0E, 0x12, 0x17, 0x6C, 0x38, 0x2D, 0x32, 0x25, 0x34, 0x2C,
+    0x2A, 0x42, 0x1F, 0x82, 0x20, 0x84, 0x02, 0x01, 0x01, 0x7E, 0x82, 0x22, 0x02, 0x64, 0x1E, 0x16,
+    0x82, 0x4E, 0x82, 0x4D, 0x80, 0x4A, 0x83, 0x6F, 0x19, 0x7D, 0x4D, 0x4E, 0x69, 0x69, 0x4E, 0x4E,
+    0x1B, 0x1E, 0x1E, 0x64, 0x4B, 0x64, 0x61, 0x69, 0x4A, 0x6F, 0x4D, 0x4E, 0x1B, 0x09, 0x5D, 0x61,
+    0x4C, 0x31, 0x34, 0x83, 0x33, 0x80, 0x2C, 0x83, 0x3C, 0x81, 0x50, 0x02, 0x3C, 0x49, 0x14, 0x82,
+    0x1F, 0x81, 0x20, 0x17, 0x02, 0x0D, 0x08, 0x3C, 0x20, 0x02, 0x4C, 0x0A, 0x03, 0x6D, 0x53, 0x5D,
+    0x47, 0x4D, 0x4D, 0x66, 0x75, 0x40, 0x4A, 0x75, 0x6B, 0x69, 0x69, 0x4E, 0x83, 0x1B, 0x0B, 0x5B,
+    0x16, 0x16, 0x0A, 0x5E, 0x08, 0x73, 0x0D, 0x02, 0x34, 0x0F, 0x10, 0x81, 0x39, 0x8D, 0x07, 0x0E,
+    0x28, 0x23, 0x0F, 0x13, 0x13, 0x1D, 0x1D, 0x17, 0x2D, 0x32, 0x19, 0x5B, 0x73, 0x0B, 0x73, 0x91,
+    0x09, 0x85, 0x06, 0x87, 0x0A, 0x83, 0x06, 0x85, 0x0A, 0x84, 0x16, 0x10, 0x64, 0x1E, 0x49, 0x0C,
+    0x38, 0x12, 0x1D, 0x13, 0x0E, 0x0E, 0x13, 0x1D, 0x55, 0x30, 0x46, 0x07, 0x27, 0x8E, 0x07, 0x11,
+    0x28, 0x10, 0x0F, 0x74, 0x65, 0x1D, 0x12, 0x12, 0x6C, 0x51, 0x2D, 0x29, 0x5A, 0x34, 0x2C, 0x2A,
+    0x20, 0x14, 0x83, 0x20, 0x83, 0x02, 0x0D, 0x03, 0x01, 0x5E, 0x5E, 0x22, 0x16, 0x0B, 0x1B, 0x1B,
+    0x4E, 0x61, 0x6B, 0x66, 0x3E, 0x83, 0x6F, 0x04, 0x4A, 0x6B, 0x4D, 0x69, 0x0B, 0x81, 0x4E, 0x82,
+    0x1B, 0x15, 0x1E, 0x64, 0x4B, 0x22, 0x1B, 0x61, 0x6F, 0x6F, 0x47, 0x3B, 0x1B, 0x0B, 0x61, 0x61,
+    0x4C, 0x2A, 0x34, 0x33, 0x33, 0x72, 0x33, 0x24, 0x86, 0x3C, 0x1E, 0x49, 0x19, 0x14, 0x14, 0x20,
+    0x20, 0x01, 0x02, 0x1F, 0x2B, 0x31, 0x20, 0x58, 0x03, 0x0D, 0x04, 0x01, 0x00, 0x60, 0x47, 0x47,
+    0x4D, 0x4D, 0x66, 0x40, 0x4A, 0x7D, 0x4D, 0x4E, 0x69, 0x4E, 0x83, 0x1B, 0x0A, 0x1E, 0x64, 0x64,
+    0x22, 0x1E, 0x01, 0x6D, 0x03, 0x3F, 0x24, 0x12, 0x82, 0x39, 0x89, 0x07, 0x04, 0x27, 0x07, 0x27,
+    0x28, 0x23, 0x83, 0x0F, 0x08, 0x0E, 0x1D, 0x17, 0x2D, 0x36, 0x00, 0x09, 0x73, 0x09, 0x83, 0x0B,
+    0x8F, 0x09, 0x84, 0x06, 0x83, 0x0A, 0x80, 0x7E, 0x82, 0x0A, 0x82, 0x06, 0x86, 0x0A, 0x85, 0x16,
+    0x08, 0x1E, 0x0D, 0x32, 0x2D, 0x17, 0x17, 0x13, 0x0F, 0x55, 0x82, 0x0E, 0x02, 0x55, 0x77, 0x6C,
+    0x8F, 0x07, 0x0F, 0x28, 0x0F, 0x65, 0x74, 0x0E, 0x6C, 0x1D, 0x74, 0x12, 0x1A, 0x2D, 0x2D, 0x36,
+    0x33, 0x2B, 0x2C, 0x82, 0x14, 0x82, 0x1F, 0x10, 0x20, 0x00, 0x00, 0x03, 0x01, 0x04, 0x03, 0x0A,
+    0x04, 0x16, 0x1B, 0x1B, 0x0B, 0x4E, 0x3B, 0x4D, 0x4A, 0x84, 0x6F, 0x04, 0x3E, 0x6B, 0x69, 0x4E,
+    0x0B, 0x81, 0x4E, 0x82, 0x1B, 0x0F, 0x16, 0x64, 0x4B, 0x16, 0x1E, 0x1B, 0x3E, 0x40, 0x1B, 0x4E,
+    0x1B, 0x61, 0x61, 0x60, 0x4C, 0x57, 0x82, 0x33, 0x01, 0x25, 0x2E, 0x81, 0x24, 0x84, 0x3C, 0x81,
+    0x24, 0x2C, 0x31, 0x19, 0x19, 0x14, 0x14, 0x42, 0x2C, 0x4C, 0x3C, 0x14, 0x7C, 0x14, 0x02, 0x00,
+    0x01, 0x3F, 0x6E, 0x60, 0x5D, 0x60, 0x47, 0x6B, 0x4D, 0x66, 0x75, 0x75, 0x66, 0x61, 0x1B, 0x3B,
+    0x4E, 0x1B, 0x1B, 0x1E, 0x1E, 0x64, 0x4B, 0x22, 0x5E, 0x4B, 0x3F, 0x08, 0x20, 0x14, 0x56, 0x81,
+    0x39, 0x88, 0x07, 0x11, 0x27, 0x07, 0x27, 0x07, 0x39, 0x23, 0x0F, 0x13, 0x0F, 0x0F, 0x0E, 0x1D,
+    0x1D, 0x1A, 0x29, 0x25, 0x06, 0x09, 0x86, 0x0B, 0x8E, 0x09, 0x84, 0x06, 0x82, 0x0A, 0x82, 0x7E,
+    0x81, 0x0A, 0x81, 0x06, 0x85, 0x0A, 0x80, 0x06, 0x86, 0x16, 0x0F, 0x1E, 0x16, 0x25, 0x45, 0x1A,
+    0x17, 0x0E, 0x0F, 0x55, 0x0E, 0x0E, 0x13, 0x1D, 0x1D, 0x77, 0x23, 0x8E, 0x07, 0x26, 0x28, 0x0E,
+    0x0E, 0x12, 0x1A, 0x1A, 0x17, 0x0E, 0x1D, 0x17, 0x2F, 0x45, 0x32, 0x5A, 0x2B, 0x2A, 0x19, 0x31,
+    0x42, 0x19, 0x14, 0x14, 0x1F, 0x20, 0x00, 0x02, 0x7C, 0x02, 0x4C, 0x73, 0x01, 0x06, 0x16, 0x5B,
+    0x0B, 0x4E, 0x61, 0x6B, 0x75, 0x83, 0x6F, 0x1A, 0x75, 0x66, 0x69, 0x69, 0x61, 0x16, 0x4E, 0x1B,
+    0x1B, 0x0B, 0x1E, 0x16, 0x64, 0x4B, 0x64, 0x3B, 0x4D, 0x7D, 0x61, 0x1B, 0x4E, 0x3B, 0x47, 0x47,
+    0x60, 0x6E, 0x57, 0x81, 0x33, 0x82, 0x25, 0x80, 0x72, 0x83, 0x24, 0x81, 0x3C, 0x83, 0x24, 0x06,
+    0x2A, 0x31, 0x19, 0x72, 0x59, 0x14, 0x0A, 0x82, 0x14, 0x13, 0x20, 0x0D, 0x08, 0x00, 0x5D, 0x68,
+    0x3B, 0x6B, 0x60, 0x68, 0x3B, 0x47, 0x4D, 0x4D, 0x6B, 0x4D, 0x61, 0x3B, 0x3B, 0x1B, 0x82, 0x1E,
+    0x09, 0x64, 0x22, 0x5E, 0x01, 0x4B, 0x04, 0x19, 0x58, 0x1F, 0x3D, 0x89, 0x07, 0x81, 0x27, 0x81,
+    0x07, 0x0C, 0x28, 0x10, 0x13, 0x13, 0x0E, 0x0E, 0x0F, 0x0E, 0x1D, 0x17, 0x2F, 0x0C, 0x2C, 0x82,
+    0x0B, 0x80, 0x1B, 0x84, 0x0B, 0x8D, 0x09, 0x85, 0x06, 0x81, 0x0A, 0x83, 0x7E, 0x81, 0x0A, 0x80,
+    0x06, 0x86, 0x0A, 0x81, 0x06, 0x86, 0x16, 0x0E, 0x1B, 0x72, 0x45, 0x2F, 0x17, 0x74, 0x0E, 0x0E,
+    0x0F, 0x74, 0x0E, 0x23, 0x10, 0x46, 0x30, 0x8E, 0x07, 0x21, 0x28, 0x0E, 0x0E, 0x17, 0x51, 0x51,
+    0x46, 0x6C, 0x1D, 0x6C, 0x17, 0x44, 0x32, 0x5A, 0x31, 0x01, 0x20, 0x57, 0x2A, 0x42, 0x19, 0x14,
+    0x14, 0x1F, 0x20, 0x02, 0x0D, 0x02, 0x02, 0x80, 0x01, 0x0A, 0x06, 0x16, 0x82, 0x3B, 0x06, 0x6B,
+    0x66, 0x75, 0x75, 0x4A, 0x75, 0x6B, 0x82, 0x69, 0x10, 0x4E, 0x0B, 0x0B, 0x1B, 0x1B, 0x0B, 0x16,
+    0x1E, 0x64, 0x4B, 0x4B, 0x60, 0x7D, 0x3A, 0x4E, 0x1B, 0x3B, 0x83, 0x47, 0x02, 0x6E, 0x2B, 0x33,
+    0x84, 0x25, 0x1A, 0x72, 0x2C, 0x24, 0x24, 0x3C, 0x3C, 0x2C, 0x24, 0x24, 0x2C, 0x2C, 0x2A, 0x24,
+    0x19, 0x33, 0x2E, 0x20, 0x20, 0x42, 0x14, 0x3F, 0x08, 0x1F, 0x6E, 0x4C, 0x68, 0x60, 0x82, 0x4C,
+    0x16, 0x09, 0x6D, 0x47, 0x4D, 0x61, 0x66, 0x7D, 0x61, 0x3B, 0x5B, 0x5B, 0x1E, 0x4B, 0x5E, 0x5E,
+    0x22, 0x5E, 0x80, 0x76, 0x14, 0x31, 0x14, 0x2B, 0x86, 0x07, 0x80, 0x27, 0x83, 0x07, 0x0E, 0x27,
+    0x07, 0x79, 0x46, 0x0F, 0x0F, 0x0E, 0x0E, 0x13, 0x0E, 0x1D, 0x17, 0x45, 0x0C, 0x19, 0x82, 0x0B,
+    0x80, 0x1B, 0x85, 0x0B, 0x8E, 0x09, 0x83, 0x06, 0x80, 0x06, 0x85, 0x0A, 0x80, 0x06, 0x87, 0x0A,
+    0x80, 0x06, 0x86, 0x16, 0x05, 0x06, 0x1B, 0x20, 0x2D, 0x38, 0x12, 0x82, 0x0E, 0x81, 0x0F, 0x81,
+    0x0E, 0x81, 0x13, 0x04, 0x46, 0x77, 0x28, 0x07, 0x71, 0x8A, 0x07, 0x15, 0x18, 0x13, 0x12, 0x38,
+    0x38, 0x51, 0x51, 0x17, 0x1A, 0x17, 0x17, 0x1A, 0x32, 0x36, 0x33, 0x00, 0x76, 0x42, 0x31, 0x2A,
+    0x31, 0x19, 0x82, 0x14, 0x80, 0x00, 0x83, 0x02, 0x07, 0x01, 0x0A, 0x0A, 0x16, 0x5B, 0x3B, 0x69,
+    0x6B, 0x82, 0x4D, 0x82, 0x6B, 0x81, 0x69, 0x81, 0x3B, 0x81, 0x0B, 0x0E, 0x1B, 0x0B, 0x16, 0x1E,
+    0x64, 0x4B, 0x4B, 0x7F, 0x47, 0x4D, 0x1B, 0x4E, 0x1B, 0x61, 0x4D, 0x82, 0x47, 0x07, 0x3C, 0x2E,
+    0x25, 0x25, 0x5A, 0x5A, 0x25, 0x5A, 0x81, 0x72, 0x82, 0x24, 0x82, 0x72, 0x0F, 0x25, 0x72, 0x42,
+    0x24, 0x24, 0x2A, 0x34, 0x25, 0x48, 0x81, 0x19, 0x42, 0x14, 0x20, 0x20, 0x0D, 0x81, 0x4C, 0x82,
+    0x00, 0x1E, 0x81, 0x06, 0x22, 0x5D, 0x60, 0x7E, 0x40, 0x6F, 0x40, 0x1E, 0x1B, 0x5B, 0x4B, 0x22,
+    0x5E, 0x5E, 0x76, 0x5E, 0x01, 0x7C, 0x7C, 0x31, 0x31, 0x2A, 0x65, 0x27, 0x71, 0x07, 0x71, 0x07,
+    0x27, 0x85, 0x07, 0x11, 0x39, 0x77, 0x79, 0x0F, 0x0E, 0x13, 0x13, 0x0E, 0x0E, 0x1D, 0x17, 0x45,
+    0x36, 0x06, 0x7B, 0x1B, 0x0B, 0x1B, 0x87, 0x0B, 0x8C, 0x09, 0x83, 0x06, 0x81, 0x06, 0x83, 0x0A,
+    0x81, 0x06, 0x87, 0x0A, 0x88, 0x16, 0x05, 0x1E, 0x05, 0x0C, 0x2D, 0x17, 0x1D, 0x85, 0x0E, 0x05,
+    0x13, 0x0F, 0x13, 0x46, 0x39, 0x27, 0x8A, 0x07, 0x03, 0x39, 0x13, 0x65, 0x1A, 0x82, 0x38, 0x11,
+    0x51, 0x1A, 0x1A, 0x17, 0x17, 0x1A, 0x44, 0x29, 0x3D, 0x42, 0x14, 0x19, 0x19, 0x42, 0x19, 0x14,
+    0x14, 0x1F, 0x82, 0x20, 0x82, 0x02, 0x05, 0x04, 0x01, 0x03, 0x0A, 0x0B, 0x3B, 0x81, 0x69, 0x83,
+    0x6B, 0x81, 0x69, 0x08, 0x61, 0x3B, 0x3B, 0x0B, 0x7B, 0x16, 0x0B, 0x5B, 0x16, 0x81, 0x64, 0x82,
+    0x4B, 0x05, 0x61, 0x6B, 0x4E, 0x1B, 0x1B, 0x6B, 0x83, 0x47, 0x3F, 0x3C, 0x2E, 0x25, 0x25, 0x5A,
+    0x5A, 0x36, 0x32, 0x36, 0x25, 0x33, 0x72, 0x33, 0x25, 0x33, 0x2C, 0x5A, 0x33, 0x2A, 0x2C, 0x24,
+    0x2A, 0x2E, 0x25, 0x2B, 0x14, 0x20, 0x5F, 0x14, 0x14, 0x20, 0x08, 0x08, 0x20, 0x20, 0x7C, 0x02,
+    0x00, 0x0D, 0x01, 0x01, 0x03, 0x06, 0x47, 0x4F, 0x7A, 0x6B, 0x06, 0x5B, 0x4B, 0x04, 0x76, 0x4B,
+    0x76, 0x5E, 0x1C, 0x7C, 0x20, 0x19, 0x2A, 0x2A, 0x37, 0x07, 0x71, 0x85, 0x07, 0x81, 0x27, 0x81,
+    0x07, 0x03, 0x10, 0x55, 0x65, 0x0F, 0x82, 0x0E, 0x82, 0x1D, 0x03, 0x1A, 0x45, 0x33, 0x06, 0x8E,
+    0x0B, 0x89, 0x09, 0x83, 0x06, 0x81, 0x06, 0x83, 0x0A, 0x81, 0x06, 0x01, 0x0A, 0x06, 0x85, 0x0A,
+    0x86, 0x16, 0x09, 0x5B, 0x16, 0x5B, 0x1E, 0x25, 0x2D, 0x1A, 0x12, 0x0E, 0x0F, 0x83, 0x0E, 0x05,
+    0x13, 0x0F, 0x0F, 0x10, 0x07, 0x27, 0x83, 0x07, 0x80, 0x27, 0x85, 0x07, 0x27, 0x39, 0x13, 0x12,
+    0x51, 0x43, 0x38, 0x38, 0x51, 0x51, 0x1A, 0x1A, 0x17, 0x17, 0x2F, 0x56, 0x29, 0x2E, 0x2C, 0x2C,
+    0x57, 0x57, 0x2A, 0x31, 0x42, 0x19, 0x19, 0x14, 0x14, 0x20, 0x20, 0x02, 0x00, 0x03, 0x03, 0x6E,
+    0x6D, 0x0B, 0x1B, 0x3B, 0x61, 0x83, 0x69, 0x80, 0x61, 0x82, 0x3B, 0x80, 0x5B, 0x81, 0x06, 0x83,
+    0x16, 0x83, 0x4B, 0x05, 0x1E, 0x4E, 0x4E, 0x1B, 0x6B, 0x4D, 0x83, 0x47, 0x04, 0x3C, 0x2E, 0x25,
+    0x5A, 0x3D, 0x81, 0x32, 0x81, 0x59, 0x84, 0x36, 0x81, 0x72, 0x2D, 0x32, 0x25, 0x2C, 0x2B, 0x2C,
+    0x24, 0x33, 0x5A, 0x3D, 0x57, 0x20, 0x19, 0x5F, 0x19, 0x02, 0x08, 0x14, 0x14, 0x1F, 0x7C, 0x20,
+    0x00, 0x02, 0x02, 0x03, 0x02, 0x04, 0x06, 0x7C, 0x7D, 0x4D, 0x4B, 0x64, 0x22, 0x76, 0x76, 0x5E,
+    0x01, 0x76, 0x7C, 0x20, 0x1F, 0x1F, 0x2C, 0x2C, 0x2D, 0x81, 0x27, 0x82, 0x07, 0x03, 0x27, 0x07,
+    0x39, 0x27, 0x82, 0x07, 0x03, 0x28, 0x10, 0x13, 0x0F, 0x82, 0x0E, 0x82, 0x1D, 0x03, 0x1A, 0x0C,
+    0x24, 0x5B, 0x83, 0x0B, 0x80, 0x73, 0x89, 0x0B, 0x89, 0x09, 0x83, 0x06, 0x82, 0x06, 0x81, 0x0A,
+    0x82, 0x06, 0x81, 0x22, 0x87, 0x0A, 0x87, 0x16, 0x0F, 0x1B, 0x2C, 0x2D, 0x51, 0x17, 0x1D, 0x0E,
+    0x1D, 0x0E, 0x0F, 0x0F, 0x0E, 0x13, 0x0F, 0x18, 0x27, 0x8B, 0x07, 0x04, 0x28, 0x1D, 0x12, 0x38,
+    0x2D, 0x81, 0x38, 0x81, 0x51, 0x84, 0x1A, 0x1F, 0x2F, 0x44, 0x29, 0x25, 0x2B, 0x34, 0x2C, 0x2C,
+    0x57, 0x2A, 0x31, 0x19, 0x19, 0x14, 0x1F, 0x1F, 0x20, 0x20, 0x00, 0x08, 0x4C, 0x6E, 0x47, 0x60,
+    0x60, 0x0B, 0x3B, 0x1B, 0x0B, 0x3B, 0x0B, 0x1B, 0x81, 0x0B, 0x81, 0x5B, 0x81, 0x06, 0x82, 0x16,
+    0x08, 0x4B, 0x5E, 0x4B, 0x4B, 0x1E, 0x1B, 0x4E, 0x6B, 0x4D, 0x84, 0x47, 0x08, 0x3C, 0x2E, 0x25,
+    0x3D, 0x3D, 0x32, 0x32, 0x36, 0x32, 0x82, 0x36, 0x10, 0x32, 0x5A, 0x33, 0x25, 0x32, 0x3D, 0x2C,
+    0x33, 0x33, 0x2A, 0x72, 0x5A, 0x5A, 0x33, 0x31, 0x58, 0x14, 0x82, 0x20, 0x1E, 0x14, 0x19, 0x1F,
+    0x20, 0x14, 0x20, 0x7C, 0x7C, 0x5C, 0x00, 0x01, 0x7C, 0x14, 0x0A, 0x0B, 0x22, 0x4B, 0x4B, 0x5E,
+    0x7C, 0x76, 0x7C, 0x7C, 0x1F, 0x14, 0x1F, 0x1F, 0x2A, 0x34, 0x32, 0x27, 0x82, 0x07, 0x09, 0x27,
+    0x07, 0x27, 0x71, 0x07, 0x07, 0x27, 0x07, 0x07, 0x1D, 0x81, 0x13, 0x82, 0x0E, 0x81, 0x1D, 0x03,
+    0x17, 0x2F, 0x32, 0x5C, 0x82, 0x0B, 0x80, 0x1B, 0x8B, 0x0B, 0x89, 0x09, 0x83, 0x06, 0x82, 0x06,
+    0x81, 0x0A, 0x82, 0x06, 0x81, 0x22, 0x86, 0x0A, 0x88, 0x16, 0x08, 0x1E, 0x58, 0x0C, 0x2F, 0x17,
+    0x0E, 0x0E, 0x1D, 0x0E, 0x84, 0x0F, 0x01, 0x23, 0x27, 0x8B, 0x07, 0x1C, 0x23, 0x1D, 0x37, 0x43,
+    0x2D, 0x43, 0x38, 0x51, 0x51, 0x17, 0x1A, 0x1A, 0x37, 0x17, 0x37, 0x56, 0x37, 0x29, 0x25, 0x33,
+    0x34, 0x2C, 0x2C, 0x57, 0x2A, 0x31, 0x19, 0x19, 0x14, 0x83, 0x1F, 0x16, 0x20, 0x1F, 0x00, 0x20,
+    0x6E, 0x47, 0x54, 0x47, 0x68, 0x3B, 0x0B, 0x7B, 0x0B, 0x09, 0x06, 0x06, 0x04, 0x06, 0x22, 0x06,
+    0x7E, 0x22, 0x5E, 0x82, 0x4B, 0x01, 0x4E, 0x69, 0x82, 0x4D, 0x83, 0x47, 0x03, 0x60, 0x6E, 0x2E,
+    0x5A, 0x81, 0x3D, 0x82, 0x32, 0x81, 0x29, 0x83, 0x32, 0x12, 0x25, 0x5A, 0x32, 0x32, 0x2E, 0x33,
+    0x25, 0x34, 0x33, 0x25, 0x5A, 0x3D, 0x34, 0x19, 0x58, 0x14, 0x19, 0x31, 0x19, 0x84, 0x14, 0x04,
+    0x20, 0x3F, 0x3F, 0x1F, 0x20, 0x82, 0x1F, 0x05, 0x0B, 0x3B, 0x4B, 0x22, 0x1B, 0x1E, 0x83, 0x1F,
+    0x05, 0x42, 0x19, 0x19, 0x42, 0x33, 0x36, 0x86, 0x07, 0x80, 0x27, 0x83, 0x07, 0x03, 0x28, 0x55,
+    0x0F, 0x13, 0x82, 0x0E, 0x81, 0x1D, 0x03, 0x17, 0x45, 0x36, 0x53, 0x82, 0x0B, 0x80, 0x1B, 0x8B,
+    0x0B, 0x8A, 0x09, 0x82, 0x06, 0x84, 0x0A, 0x05, 0x06, 0x0A, 0x0A, 0x22, 0x22, 0x06, 0x83, 0x0A,
+    0x80, 0x06, 0x87, 0x16, 0x06, 0x5B, 0x16, 0x1E, 0x06, 0x36, 0x45, 0x6C, 0x85, 0x0E, 0x03, 0x0F,
+    0x55, 0x0F, 0x18, 0x84, 0x07, 0x80, 0x27, 0x86, 0x07, 0x02, 0x23, 0x12, 0x1A, 0x83, 0x43, 0x81,
+    0x38, 0x82, 0x1A, 0x0E, 0x37, 0x17, 0x37, 0x56, 0x37, 0x44, 0x32, 0x5A, 0x33, 0x34, 0x34, 0x2C,
+    0x2A, 0x24, 0x31, 0x81, 0x19, 0x84, 0x14, 0x0B, 0x1F, 0x20, 0x1F, 0x20, 0x00, 0x20, 0x6E, 0x08,
+    0x4C, 0x4C, 0x0D, 0x4C, 0x82, 0x68, 0x04, 0x4C, 0x3B, 0x73, 0x09, 0x0A, 0x82, 0x5E, 0x81, 0x4B,
+    0x02, 0x6B, 0x4D, 0x66, 0x81, 0x4D, 0x82, 0x47, 0x81, 0x60, 0x02, 0x54, 0x2E, 0x3D, 0x82, 0x32,
+    0x82, 0x29, 0x18, 0x44, 0x29, 0x29, 0x32, 0x32, 0x36, 0x5A, 0x32, 0x0C, 0x3D, 0x72, 0x25, 0x33,
+    0x34, 0x25, 0x36, 0x3D, 0x3D, 0x57, 0x31, 0x31, 0x2C, 0x34, 0x24, 0x19, 0x81, 0x42, 0x84, 0x14,
+    0x18, 0x1F, 0x14, 0x19, 0x1F, 0x19, 0x1F, 0x4C, 0x5E, 0x1B, 0x0B, 0x1E, 0x1C, 0x1F, 0x19, 0x42,
+    0x42, 0x31, 0x2A, 0x42, 0x25, 0x32, 0x71, 0x07, 0x07, 0x27, 0x81, 0x07, 0x83, 0x27, 0x81, 0x07,
+    0x02, 0x18, 0x0F, 0x1D, 0x82, 0x0E, 0x82, 0x1D, 0x04, 0x1A, 0x2D, 0x34, 0x7B, 0x5B, 0x81, 0x0B,
+    0x82, 0x1B, 0x89, 0x0B, 0x80, 0x73, 0x8A, 0x09, 0x81, 0x06, 0x84, 0x0A, 0x05, 0x06, 0x0A, 0x06,
+    0x22, 0x22, 0x06, 0x82, 0x0A, 0x81, 0x06, 0x87, 0x16, 0x06, 0x5B, 0x06, 0x16, 0x1E, 0x72, 0x2D,
+    0x17, 0x85, 0x0E, 0x05, 0x13, 0x0F, 0x13, 0x18, 0x07, 0x27, 0x8A, 0x07, 0x02, 0x13, 0x12, 0x51,
+    0x83, 0x43, 0x81, 0x38, 0x83, 0x1A, 0x09, 0x37, 0x2F, 0x1A, 0x2F, 0x44, 0x29, 0x32, 0x25, 0x33,
+    0x34, 0x81, 0x2C, 0x82, 0x24, 0x80, 0x31, 0x81, 0x19, 0x82, 0x14, 0x82, 0x1F, 0x82, 0x20, 0x81,
+    0x00, 0x82, 0x20, 0x12, 0x02, 0x08, 0x08, 0x4C, 0x02, 0x02, 0x01, 0x02, 0x7C, 0x76, 0x5E, 0x5E,
+    0x22, 0x5B, 0x4D, 0x66, 0x66, 0x47, 0x4D, 0x82, 0x47, 0x81, 0x60, 0x01, 0x5D, 0x2E, 0x83, 0x32,
+    0x82, 0x29, 0x80, 0x45, 0x83, 0x0C, 0x12, 0x3D, 0x32, 0x29, 0x0C, 0x29, 0x36, 0x25, 0x25, 0x72,
+    0x5A, 0x25, 0x36, 0x3D, 0x33, 0x2C, 0x2A, 0x34, 0x34, 0x2C, 0x82, 0x2A, 0x82, 0x42, 0x81, 0x31,
+    0x0B, 0x19, 0x14, 0x19, 0x5F, 0x42, 0x2A, 0x5F, 0x00, 0x01, 0x7C, 0x02, 0x5F, 0x82, 0x42, 0x0B,
+    0x2A, 0x57, 0x2A, 0x57, 0x2E, 0x59, 0x28, 0x39, 0x07, 0x27, 0x39, 0x27, 0x82, 0x07, 0x03, 0x27,
+    0x07, 0x07, 0x39, 0x82, 0x13, 0x81, 0x0E, 0x07, 0x1D, 0x0E, 0x1D, 0x1A, 0x0C, 0x19, 0x16, 0x5B,
+    0x81, 0x0B, 0x82, 0x1B, 0x8A, 0x0B, 0x80, 0x73, 0x89, 0x09, 0x81, 0x06, 0x84, 0x0A, 0x82, 0x06,
+    0x81, 0x22, 0x80, 0x06, 0x81, 0x0A, 0x82, 0x06, 0x87, 0x16, 0x10, 0x5B, 0x06, 0x5B, 0x1B, 0x24,
+    0x0C, 0x1A, 0x12, 0x0E, 0x1D, 0x0E, 0x0F, 0x0F, 0x13, 0x0F, 0x0F, 0x18, 0x85, 0x07, 0x80, 0x27,
+    0x84, 0x07, 0x04, 0x39, 0x13, 0x12, 0x51, 0x38, 0x81, 0x43, 0x82, 0x38, 0x83, 0x1A, 0x0A, 0x37,
+    0x51, 0x1A, 0x51, 0x56, 0x56, 0x0C, 0x32, 0x5A, 0x25, 0x33, 0x81, 0x34, 0x82, 0x24, 0x81, 0x31,
+    0x81, 0x19, 0x83, 0x14, 0x01, 0x20, 0x1F, 0x84, 0x20, 0x81, 0x00, 0x04, 0x20, 0x00, 0x4C, 0x20,
+    0x1F, 0x81, 0x7C, 0x81, 0x76, 0x82, 0x5E, 0x80, 0x3B, 0x83, 0x4D, 0x83, 0x47, 0x03, 0x60, 0x47,
+    0x5D, 0x2E, 0x84, 0x32, 0x83, 0x29, 0x80, 0x0C, 0x82, 0x32, 0x0F, 0x29, 0x0C, 0x32, 0x29, 0x29,
+    0x5A, 0x25, 0x25, 0x5A, 0x36, 0x5A, 0x5A, 0x32, 0x2E, 0x24, 0x2C, 0x81, 0x34, 0x83, 0x2C, 0x1C,
+    0x5F, 0x42, 0x31, 0x42, 0x42, 0x5F, 0x42, 0x19, 0x5F, 0x34, 0x34, 0x57, 0x5F, 0x5F, 0x48, 0x24,
+    0x42, 0x48, 0x2A, 0x57, 0x34, 0x24, 0x34, 0x33, 0x2D, 0x28, 0x39, 0x07, 0x71, 0x82, 0x07, 0x80,
+    0x71, 0x83, 0x07, 0x01, 0x28, 0x23, 0x81, 0x13, 0x82, 0x0E, 0x81, 0x1D, 0x04, 0x51, 0x0C, 0x08,
+    0x16, 0x5B, 0x82, 0x0B, 0x80, 0x3B, 0x88, 0x0B, 0x81, 0x5B, 0x81, 0x73, 0x8A, 0x09, 0x80, 0x06,
+    0x80, 0x06, 0x85, 0x0A, 0x86, 0x06, 0x81, 0x0A, 0x8A, 0x16, 0x05, 0x1E, 0x05, 0x35, 0x2F, 0x12,
+    0x1D, 0x82, 0x0E, 0x05, 0x74, 0x0F, 0x0F, 0x23, 0x28, 0x39, 0x8A, 0x07, 0x02, 0x39, 0x0E, 0x17,
+    0x84, 0x43, 0x80, 0x38, 0x81, 0x51, 0x84, 0x1A, 0x82, 0x2F, 0x08, 0x56, 0x44, 0x29, 0x32, 0x36,
+    0x25, 0x33, 0x33, 0x34, 0x81, 0x2C, 0x82, 0x24, 0x01, 0x42, 0x19, 0x85, 0x14, 0x83, 0x20, 0x81,
+    0x1F, 0x0C, 0x00, 0x20, 0x81, 0x00, 0x1F, 0x00, 0x20, 0x7C, 0x7C, 0x01, 0x5E, 0x5E, 0x61, 0x82,
+    0x4D, 0x84, 0x47, 0x08, 0x60, 0x5D, 0x61, 0x34, 0x3D, 0x3D, 0x29, 0x29, 0x32, 0x83, 0x29, 0x83,
+    0x0C, 0x82, 0x29, 0x82, 0x32, 0x02, 0x25, 0x36, 0x5A, 0x81, 0x36, 0x82, 0x5A, 0x01, 0x33, 0x72,
+    0x83, 0x34, 0x84, 0x2C, 0x84, 0x2A, 0x08, 0x57, 0x2E, 0x5A, 0x2E, 0x33, 0x2E, 0x36, 0x11, 0x33,
+    0x82, 0x2C, 0x1D, 0x24, 0x34, 0x34, 0x25, 0x2D, 0x10, 0x07, 0x27, 0x07, 0x07, 0x27, 0x07, 0x07,
+    0x27, 0x27, 0x07, 0x07, 0x28, 0x13, 0x17, 0x74, 0x13, 0x12, 0x1D, 0x0E, 0x17, 0x2D, 0x36, 0x22,
+    0x06, 0x82, 0x0B, 0x80, 0x1B, 0x8C, 0x0B, 0x8B, 0x09, 0x80, 0x06, 0x80, 0x06, 0x85, 0x0A, 0x82,
+    0x06, 0x81, 0x0A, 0x80, 0x06, 0x82, 0x0A, 0x89, 0x16, 0x81, 0x1E, 0x0C, 0x06, 0x36, 0x2D, 0x1A,
+    0x1D, 0x0E, 0x1D, 0x0E, 0x74, 0x0F, 0x13, 0x23, 0x28, 0x8B, 0x07, 0x03, 0x39, 0x0E, 0x17, 0x38,
+    0x83, 0x43, 0x81, 0x38, 0x01, 0x51, 0x17, 0x83, 0x1A, 0x82, 0x2F, 0x82, 0x45, 0x06, 0x29, 0x32,
+    0x36, 0x25, 0x33, 0x33, 0x34, 0x81, 0x2C, 0x82, 0x24, 0x82, 0x31, 0x83, 0x19, 0x83, 0x14, 0x03,
+    0x58, 0x14, 0x58, 0x14, 0x83, 0x1F, 0x06, 0x20, 0x7C, 0x00, 0x7C, 0x76, 0x5E, 0x47, 0x82, 0x4D,
+    0x83, 0x47, 0x81, 0x60, 0x08, 0x5D, 0x61, 0x24, 0x3D, 0x32, 0x32, 0x29, 0x0C, 0x29, 0x82, 0x0C,
+    0x80, 0x29, 0x87, 0x0C, 0x80, 0x32, 0x82, 0x36, 0x82, 0x32, 0x80, 0x36, 0x81, 0x5A, 0x81, 0x72,
+    0x84, 0x33, 0x81, 0x34, 0x83, 0x2C, 0x81, 0x34, 0x29, 0x2B, 0x5A, 0x32, 0x32, 0x5A, 0x32, 0x44,
+    0x2D, 0x2E, 0x34, 0x2B, 0x2B, 0x34, 0x2E, 0x33, 0x25, 0x38, 0x10, 0x07, 0x27, 0x07, 0x27, 0x27,
+    0x07, 0x07, 0x27, 0x27, 0x07, 0x07, 0x10, 0x13, 0x6C, 0x0E, 0x13, 0x12, 0x0E, 0x0E, 0x17, 0x2D,
+    0x33, 0x06, 0x5B, 0x82, 0x0B, 0x81, 0x1B, 0x8C, 0x0B, 0x8B, 0x09, 0x80, 0x06, 0x85, 0x0A, 0x82,
+    0x06, 0x85, 0x0A, 0x80, 0x06, 0x86, 0x16, 0x07, 0x5B, 0x16, 0x1E, 0x16, 0x1E, 0x34, 0x2D, 0x1A,
+    0x83, 0x1D, 0x81, 0x0E, 0x02, 0x13, 0x23, 0x28, 0x8B, 0x07, 0x04, 0x39, 0x0E, 0x17, 0x2F, 0x38,
+    0x83, 0x43, 0x01, 0x38, 0x51, 0x81, 0x17, 0x81, 0x1A, 0x83, 0x2F, 0x83, 0x45, 0x07, 0x0C, 0x32,
+    0x36, 0x25, 0x25, 0x33, 0x72, 0x34, 0x81, 0x2C, 0x83, 0x24, 0x82, 0x31, 0x82, 0x19, 0x02, 0x49,
+    0x19, 0x3C, 0x82, 0x49, 0x81, 0x14, 0x82, 0x1F, 0x04, 0x20, 0x00, 0x7C, 0x1C, 0x6D, 0x87, 0x47,
+    0x06, 0x61, 0x5D, 0x0B, 0x0B, 0x49, 0x3D, 0x32, 0x82, 0x29, 0x81, 0x0C, 0x80, 0x29, 0x88, 0x0C,
+    0x81, 0x29, 0x82, 0x32, 0x82, 0x0C, 0x82, 0x32, 0x80, 0x3D, 0x84, 0x25, 0x82, 0x33, 0x81, 0x34,
+    0x81, 0x33, 0x0C, 0x2E, 0x25, 0x2E, 0x36, 0x0C, 0x2D, 0x0C, 0x2D, 0x2F, 0x56, 0x5A, 0x2B, 0x33,
+    0x82, 0x2E, 0x09, 0x33, 0x36, 0x51, 0x10, 0x07, 0x27, 0x07, 0x27, 0x27, 0x07, 0x82, 0x27, 0x81,
+    0x07, 0x0B, 0x10, 0x13, 0x6C, 0x17, 0x13, 0x1D, 0x12, 0x1D, 0x51, 0x2D, 0x24, 0x5B, 0x83, 0x0B,
+    0x81, 0x1B, 0x8C, 0x0B, 0x85, 0x09, 0x80, 0x73, 0x84, 0x09, 0x87, 0x0A, 0x81, 0x06, 0x85, 0x0A,
+    0x80, 0x06, 0x86, 0x16, 0x81, 0x5B, 0x0E, 0x1E, 0x7B, 0x1B, 0x31, 0x2D, 0x51, 0x12, 0x12, 0x1D,
+    0x1D, 0x0E, 0x0E, 0x13, 0x23, 0x71, 0x8B, 0x07, 0x04, 0x39, 0x0F, 0x12, 0x1A, 0x38, 0x83, 0x43,
+    0x01, 0x38, 0x1A, 0x81, 0x17, 0x81, 0x1A, 0x83, 0x2F, 0x81, 0x56, 0x81, 0x45, 0x0A, 0x2D, 0x0C,
+    0x32, 0x36, 0x25, 0x25, 0x33, 0x33, 0x34, 0x34, 0x2C, 0x84, 0x24, 0x83, 0x31, 0x0F, 0x24, 0x2A,
+    0x24, 0x2A, 0x2A, 0x31, 0x42, 0x19, 0x14, 0x14, 0x1F, 0x00, 0x7C, 0x00, 0x7C, 0x73, 0x86, 0x47,
+    0x11, 0x5D, 0x3B, 0x5D, 0x3B, 0x3B, 0x6E, 0x25, 0x32, 0x29, 0x44, 0x44, 0x0C, 0x35, 0x29, 0x29,
+    0x0C, 0x29, 0x32, 0x8C, 0x0C, 0x04, 0x29, 0x0C, 0x32, 0x32, 0x36, 0x81, 0x5A, 0x88, 0x25, 0x81,
+    0x5A, 0x09, 0x36, 0x32, 0x0C, 0x0C, 0x45, 0x2D, 0x51, 0x2F, 0x36, 0x2E, 0x84, 0x25, 0x08, 0x32,
+    0x1A, 0x39, 0x07, 0x27, 0x07, 0x71, 0x27, 0x07, 0x82, 0x27, 0x81, 0x07, 0x0B, 0x28, 0x13, 0x6C,
+    0x17, 0x13, 0x1D, 0x17, 0x1D, 0x51, 0x59, 0x20, 0x5B, 0x92, 0x0B, 0x84, 0x09, 0x81, 0x73, 0x84,
+    0x09, 0x87, 0x0A, 0x81, 0x06, 0x85, 0x0A, 0x83, 0x16, 0x82, 0x5B, 0x84, 0x16, 0x0C, 0x1E, 0x02,
+    0x0C, 0x2F, 0x17, 0x12, 0x17, 0x17, 0x0E, 0x0E, 0x13, 0x23, 0x27, 0x8B, 0x07, 0x04, 0x39, 0x0F,
+    0x12, 0x1A, 0x38, 0x83, 0x43, 0x01, 0x51, 0x37, 0x81, 0x17, 0x81, 0x1A, 0x83, 0x2F, 0x80, 0x56,
+    0x83, 0x45, 0x81, 0x0C, 0x01, 0x32, 0x36, 0x82, 0x25, 0x81, 0x72, 0x82, 0x34, 0x82, 0x2C, 0x89,
+    0x24, 0x0B, 0x31, 0x42, 0x42, 0x14, 0x20, 0x20, 0x1F, 0x00, 0x00, 0x6D, 0x4C, 0x5D, 0x83, 0x47,
+    0x01, 0x60, 0x5D, 0x82, 0x73, 0x09, 0x0B, 0x5D, 0x34, 0x29, 0x29, 0x45, 0x44, 0x44, 0x11, 0x35,
+    0x81, 0x0C, 0x81, 0x32, 0x87, 0x0C, 0x80, 0x29, 0x82, 0x0C, 0x80, 0x29, 0x84, 0x0C, 0x82, 0x32,
+    0x02, 0x36, 0x5A, 0x36, 0x84, 0x5A, 0x06, 0x36, 0x32, 0x32, 0x29, 0x0C, 0x45, 0x56, 0x82, 0x2F,
+    0x09, 0x32, 0x3D, 0x5A, 0x36, 0x5A, 0x25, 0x36, 0x59, 0x17, 0x28, 0x82, 0x07, 0x80, 0x39, 0x85,
+    0x27, 0x0C, 0x07, 0x28, 0x13, 0x6C, 0x17, 0x1D, 0x1D, 0x12, 0x17, 0x51, 0x36, 0x03, 0x5B, 0x83,
+    0x0B, 0x80, 0x1B, 0x8D, 0x0B, 0x84, 0x09, 0x81, 0x73, 0x84, 0x09, 0x87, 0x0A, 0x81, 0x06, 0x85,
+    0x0A, 0x82, 0x16, 0x83, 0x5B, 0x85, 0x16, 0x0A, 0x64, 0x36, 0x45, 0x17, 0x17, 0x6C, 0x17, 0x1D,
+    0x0E, 0x13, 0x23, 0x8C, 0x07, 0x04, 0x39, 0x0F, 0x12, 0x1A, 0x38, 0x82, 0x43, 0x06, 0x38, 0x51,
+    0x17, 0x1A, 0x1A, 0x37, 0x1A, 0x83, 0x2F, 0x85, 0x45, 0x81, 0x0C, 0x80, 0x32, 0x81, 0x36, 0x82,
+    0x25, 0x80, 0x33, 0x83, 0x72, 0x80, 0x34, 0x87, 0x2C, 0x82, 0x24, 0x20, 0x2A, 0x5F, 0x19, 0x14,
+    0x14, 0x1F, 0x20, 0x00, 0x01, 0x00, 0x00, 0x5D, 0x47, 0x47, 0x60, 0x60, 0x61, 0x0B, 0x3B, 0x73,
+    0x0B, 0x0B, 0x62, 0x11, 0x0C, 0x44, 0x0C, 0x44, 0x35, 0x11, 0x35, 0x0C, 0x32, 0x87, 0x0C, 0x80,
+    0x29, 0x81, 0x0C, 0x81, 0x29, 0x82, 0x0C, 0x81, 0x35, 0x05, 0x0C, 0x35, 0x36, 0x32, 0x32, 0x35,
+    0x85, 0x32, 0x82, 0x0C, 0x80, 0x45, 0x81, 0x2F, 0x82, 0x1A, 0x09, 0x56, 0x45, 0x29, 0x59, 0x32,
+    0x29, 0x36, 0x32, 0x2D, 0x0E, 0x83, 0x07, 0x80, 0x39, 0x85, 0x27, 0x0B, 0x07, 0x39, 0x13, 0x6C,
+    0x12, 0x65, 0x1D, 0x12, 0x6C, 0x2F, 0x25, 0x03, 0x84, 0x0B, 0x81, 0x1B, 0x8C, 0x0B, 0x84, 0x09,
+    0x81, 0x73, 0x84, 0x09, 0x87, 0x0A, 0x85, 0x06, 0x81, 0x0A, 0x82, 0x16, 0x83, 0x5B, 0x10, 0x16,
+    0x0B, 0x5B, 0x5B, 0x16, 0x16, 0x1E, 0x33, 0x45, 0x1A, 0x1A, 0x6C, 0x6C, 0x1D, 0x0E, 0x13, 0x23,
+    0x8C, 0x07, 0x0A, 0x39, 0x0F, 0x12, 0x51, 0x51, 0x38, 0x43, 0x43, 0x51, 0x1A, 0x17, 0x82, 0x1A,
+    0x84, 0x2F, 0x86, 0x45, 0x81, 0x0C, 0x80, 0x32, 0x81, 0x36, 0x83, 0x25, 0x80, 0x33, 0x83, 0x72,
+    0x83, 0x34, 0x25, 0x72, 0x34, 0x72, 0x2C, 0x2C, 0x24, 0x2A, 0x31, 0x19, 0x19, 0x42, 0x14, 0x14,
+    0x00, 0x01, 0x01, 0x00, 0x73, 0x47, 0x60, 0x60, 0x5D, 0x0B, 0x73, 0x0B, 0x73, 0x0B, 0x1B, 0x6E,
+    0x15, 0x0C, 0x44, 0x29, 0x44, 0x45, 0x11, 0x11, 0x35, 0x87, 0x0C, 0x0F, 0x32, 0x0C, 0x0C, 0x32,
+    0x32, 0x0C, 0x35, 0x35, 0x32, 0x36, 0x11, 0x35, 0x35, 0x36, 0x36, 0x35, 0x85, 0x0C, 0x81, 0x2D,
+    0x02, 0x45, 0x2F, 0x51, 0x85, 0x1A, 0x08, 0x2F, 0x45, 0x2D, 0x0C, 0x29, 0x59, 0x29, 0x38, 0x23,
+    0x83, 0x07, 0x80, 0x39, 0x85, 0x27, 0x10, 0x07, 0x39, 0x23, 0x1D, 0x1D, 0x65, 0x1D, 0x1D, 0x51,
+    0x2D, 0x2C, 0x5B, 0x0B, 0x0B, 0x3B, 0x3B, 0x0B, 0x81, 0x1B, 0x82, 0x0B, 0x81, 0x1B, 0x87, 0x0B,
+    0x8B, 0x09, 0x87, 0x0A, 0x85, 0x06, 0x81, 0x0A, 0x82, 0x16, 0x83, 0x5B, 0x82, 0x16, 0x0D, 0x1B,
+    0x16, 0x16, 0x1B, 0x2C, 0x2D, 0x1A, 0x1A, 0x46, 0x6C, 0x1D, 0x0E, 0x13, 0x10, 0x8C, 0x07, 0x08,
+    0x39, 0x0F, 0x12, 0x51, 0x51, 0x38, 0x43, 0x43, 0x51, 0x84, 0x1A, 0x01, 0x2F, 0x51, 0x83, 0x2F,
+    0x86, 0x45, 0x81, 0x0C, 0x81, 0x32, 0x82, 0x36, 0x85, 0x25, 0x82, 0x72, 0x81, 0x33, 0x81, 0x72,
+    0x81, 0x34, 0x81, 0x2C, 0x06, 0x31, 0x24, 0x2A, 0x31, 0x42, 0x14, 0x20, 0x82, 0x01, 0x11, 0x5D,
+    0x47, 0x60, 0x60, 0x61, 0x3B, 0x73, 0x0B, 0x73, 0x0B, 0x1B, 0x81, 0x52, 0x15, 0x0C, 0x44, 0x29,
+    0x45, 0x82, 0x11, 0x85, 0x0C, 0x82, 0x32, 0x81, 0x0C, 0x81, 0x32, 0x81, 0x35, 0x80, 0x0C, 0x81,
+    0x32, 0x82, 0x0C, 0x08, 0x35, 0x0C, 0x44, 0x44, 0x45, 0x45, 0x2D, 0x2D, 0x45, 0x82, 0x2F, 0x83,
+    0x1A, 0x80, 0x37, 0x82, 0x17, 0x08, 0x1A, 0x56, 0x2F, 0x2D, 0x0C, 0x29, 0x2D, 0x46, 0x23, 0x82,
+    0x07, 0x02, 0x27, 0x71, 0x07, 0x84, 0x27, 0x0A, 0x07, 0x39, 0x23, 0x1D, 0x1D, 0x65, 0x1D, 0x1D,
+    0x51, 0x2D, 0x19, 0x82, 0x0B, 0x81, 0x3B, 0x84, 0x0B, 0x82, 0x1B, 0x89, 0x0B, 0x89, 0x09, 0x83,
+    0x0A, 0x85, 0x06, 0x85, 0x0A, 0x81, 0x16, 0x81, 0x5B, 0x13, 0x16, 0x5B, 0x5B, 0x16, 0x16, 0x1E,
+    0x16, 0x0B, 0x1E, 0x1B, 0x31, 0x2D, 0x38, 0x1A, 0x46, 0x46, 0x1D, 0x13, 0x13, 0x28, 0x8D, 0x07,
+    0x0D, 0x23, 0x12, 0x38, 0x51, 0x51, 0x38, 0x38, 0x37, 0x1A, 0x1A, 0x17, 0x56, 0x37, 0x51, 0x82,
+    0x2F, 0x86, 0x45, 0x01, 0x0C, 0x45, 0x83, 0x0C, 0x83, 0x35, 0x85, 0x36, 0x81, 0x25, 0x16, 0x33,
+    0x25, 0x25, 0x33, 0x25, 0x25, 0x34, 0x57, 0x24, 0x2A, 0x57, 0x31, 0x19, 0x14, 0x1F, 0x00, 0x01,
+    0x01, 0x47, 0x47, 0x60, 0x60, 0x5D, 0x83, 0x0B, 0x08, 0x5D, 0x3B, 0x73, 0x62, 0x78, 0x15, 0x35,
+    0x2D, 0x35, 0x82, 0x11, 0x80, 0x30, 0x82, 0x32, 0x81, 0x0C, 0x0A, 0x32, 0x3D, 0x25, 0x5A, 0x32,
+    0x0C, 0x0C, 0x32, 0x35, 0x0C, 0x32, 0x84, 0x0C, 0x01, 0x45, 0x44, 0x84, 0x45, 0x82, 0x2F, 0x82,
+    0x1A, 0x85, 0x17, 0x08, 0x1A, 0x51, 0x1A, 0x45, 0x2D, 0x2D, 0x51, 0x17, 0x39, 0x82, 0x07, 0x82,
+    0x27, 0x01, 0x07, 0x71, 0x83, 0x27, 0x09, 0x07, 0x23, 0x1D, 0x1D, 0x13, 0x1D, 0x17, 0x45, 0x32,
+    0x08, 0x82, 0x0B, 0x80, 0x1B, 0x81, 0x0B, 0x82, 0x1B, 0x83, 0x0B, 0x80, 0x1B, 0x89, 0x0B, 0x86,
+    0x09, 0x81, 0x06, 0x83, 0x0A, 0x84, 0x06, 0x86, 0x0A, 0x81, 0x16, 0x85, 0x5B, 0x0F, 0x16, 0x1E,
+    0x16, 0x0B, 0x16, 0x1E, 0x49, 0x0C, 0x38, 0x1A, 0x46, 0x46, 0x1D, 0x13, 0x23, 0x28, 0x8D, 0x07,
+    0x04, 0x23, 0x12, 0x51, 0x51, 0x1A, 0x81, 0x38, 0x85, 0x1A, 0x05, 0x2F, 0x44, 0x29, 0x45, 0x37,
+    0x45, 0x81, 0x44, 0x86, 0x45, 0x86, 0x0C, 0x81, 0x32, 0x85, 0x36, 0x83, 0x25, 0x81, 0x33, 0x09,
+    0x2C, 0x34, 0x34, 0x2C, 0x24, 0x42, 0x14, 0x20, 0x20, 0x01, 0x82, 0x60, 0x01, 0x47, 0x60, 0x81,
+    0x73, 0x82, 0x0B, 0x04, 0x73, 0x3B, 0x0B, 0x6E, 0x15, 0x82, 0x78, 0x81, 0x11, 0x03, 0x35, 0x11,
+    0x15, 0x35, 0x82, 0x32, 0x0B, 0x0C, 0x32, 0x36, 0x3D, 0x25, 0x32, 0x0C, 0x32, 0x35, 0x32, 0x32,
+    0x0C, 0x81, 0x35, 0x82, 0x0C, 0x84, 0x45, 0x03, 0x56, 0x2F, 0x56, 0x2F, 0x82, 0x1A, 0x87, 0x17,
+    0x06, 0x1A, 0x51, 0x2F, 0x2D, 0x2D, 0x38, 0x13, 0x83, 0x07, 0x88, 0x27, 0x09, 0x07, 0x23, 0x1D,
+    0x17, 0x0E, 0x17, 0x17, 0x45, 0x36, 0x03, 0x81, 0x0B, 0x81, 0x1B, 0x81, 0x3B, 0x82, 0x1B, 0x83,
+    0x0B, 0x80, 0x1B, 0x8A, 0x0B, 0x85, 0x09, 0x81, 0x06, 0x83, 0x22, 0x83, 0x0A, 0x80, 0x06, 0x86,
+    0x0A, 0x84, 0x16, 0x82, 0x5B, 0x0F, 0x16, 0x1E, 0x5B, 0x16, 0x16, 0x1E, 0x0D, 0x0C, 0x38, 0x51,
+    0x1A, 0x46, 0x1D, 0x0E, 0x23, 0x71, 0x8D, 0x07, 0x04, 0x10, 0x0E, 0x1A, 0x38, 0x2F, 0x81, 0x51,
+    0x82, 0x1A, 0x0A, 0x2F, 0x6C, 0x2F, 0x44, 0x56, 0x29, 0x2E, 0x3D, 0x1A, 0x29, 0x0C, 0x82, 0x45,
+    0x80, 0x2D, 0x83, 0x45, 0x8B, 0x0C, 0x81, 0x32, 0x82, 0x36, 0x81, 0x25, 0x81, 0x33, 0x0E, 0x2E,
+    0x33, 0x34, 0x24, 0x19, 0x14, 0x20, 0x00, 0x4C, 0x60, 0x47, 0x47, 0x60, 0x60, 0x3B, 0x82, 0x73,
+    0x05, 0x0B, 0x09, 0x3B, 0x0B, 0x73, 0x52, 0x82, 0x78, 0x82, 0x11, 0x81, 0x35, 0x0A, 0x11, 0x35,
+    0x35, 0x32, 0x11, 0x11, 0x35, 0x32, 0x25, 0x25, 0x36, 0x82, 0x32, 0x02, 0x35, 0x0C, 0x35, 0x86,
+    0x0C, 0x82, 0x45, 0x81, 0x56, 0x80, 0x2F, 0x82, 0x1A, 0x88, 0x17, 0x05, 0x1A, 0x38, 0x2D, 0x38,
+    0x46, 0x23, 0x83, 0x07, 0x87, 0x27, 0x81, 0x07, 0x09, 0x10, 0x1D, 0x6C, 0x1D, 0x17, 0x1A, 0x2D,
+    0x33, 0x5B, 0x0B, 0x82, 0x1B, 0x81, 0x3B, 0x82, 0x1B, 0x83, 0x0B, 0x81, 0x1B, 0x89, 0x0B, 0x85,
+    0x09, 0x81, 0x06, 0x83, 0x22, 0x83, 0x0A, 0x80, 0x06, 0x86, 0x0A, 0x88, 0x16, 0x0E, 0x1E, 0x5B,
+    0x1E, 0x16, 0x16, 0x09, 0x36, 0x38, 0x51, 0x1A, 0x6C, 0x1D, 0x0E, 0x23, 0x39, 0x8D, 0x07, 0x14,
+    0x39, 0x13, 0x17, 0x43, 0x2F, 0x51, 0x1A, 0x1A, 0x51, 0x1A, 0x1A, 0x37, 0x2F, 0x45, 0x56, 0x45,
+    0x25, 0x2A, 0x25, 0x2D, 0x56, 0x82, 0x0C, 0x01, 0x45, 0x2D, 0x89, 0x0C, 0x80, 0x35, 0x86, 0x0C,
+    0x81, 0x32, 0x0B, 0x36, 0x25, 0x25, 0x5A, 0x25, 0x72, 0x34, 0x31, 0x14, 0x20, 0x00, 0x73, 0x85,
+    0x60, 0x1F, 0x5D, 0x73, 0x09, 0x6D, 0x6D, 0x09, 0x0B, 0x0B, 0x5B, 0x62, 0x78, 0x15, 0x11, 0x35,
+    0x35, 0x11, 0x11, 0x30, 0x35, 0x11, 0x32, 0x36, 0x15, 0x15, 0x11, 0x35, 0x32, 0x25, 0x36, 0x32,
+    0x32, 0x36, 0x81, 0x35, 0x88, 0x0C, 0x82, 0x45, 0x81, 0x2F, 0x83, 0x1A, 0x85, 0x17, 0x07, 0x6C,
+    0x12, 0x17, 0x43, 0x43, 0x38, 0x1D, 0x28, 0x84, 0x07, 0x86, 0x27, 0x81, 0x07, 0x09, 0x10, 0x13,
+    0x17, 0x1D, 0x1A, 0x51, 0x2D, 0x2C, 0x1B, 0x0B, 0x85, 0x3B, 0x81, 0x1B, 0x83, 0x0B, 0x81, 0x1B,
+    0x89, 0x0B, 0x85, 0x09, 0x81, 0x06, 0x82, 0x0A, 0x80, 0x06, 0x83, 0x0A, 0x81, 0x06, 0x85, 0x0A,
+    0x87, 0x16, 0x0E, 0x5B, 0x1E, 0x5B, 0x1E, 0x5B, 0x16, 0x1E, 0x25, 0x43, 0x38, 0x51, 0x6C, 0x6C,
+    0x0E, 0x18, 0x8E, 0x07, 0x04, 0x39, 0x23, 0x12, 0x38, 0x43, 0x82, 0x1A, 0x0B, 0x51, 0x1A, 0x1A,
+    0x2F, 0x1A, 0x2F, 0x45, 0x2F, 0x2D, 0x25, 0x2A, 0x5A, 0x99, 0x0C, 0x81, 0x36, 0x08, 0x5A, 0x32,
+    0x36, 0x33, 0x24, 0x19, 0x1F, 0x81, 0x5D, 0x86, 0x60, 0x0A, 0x5D, 0x4C, 0x09, 0x09, 0x6D, 0x7B,
+    0x5B, 0x5D, 0x0B, 0x3C, 0x11, 0x83, 0x0C, 0x11, 0x2D, 0x35, 0x11, 0x35, 0x35, 0x11, 0x32, 0x32,
+    0x15, 0x15, 0x11, 0x36, 0x32, 0x5A, 0x36, 0x32, 0x36, 0x5A, 0x89, 0x0C, 0x80, 0x2D, 0x81, 0x45,
+    0x81, 0x2F, 0x81, 0x51, 0x81, 0x1A, 0x85, 0x17, 0x07, 0x12, 0x17, 0x38, 0x30, 0x43, 0x17, 0x13,
+    0x28, 0x84, 0x07, 0x82, 0x27, 0x80, 0x71, 0x82, 0x27, 0x81, 0x07, 0x07, 0x10, 0x13, 0x6C, 0x1D,
+    0x51, 0x51, 0x0C, 0x49, 0x81, 0x0B, 0x86, 0x3B, 0x84, 0x1B, 0x89, 0x0B, 0x87, 0x09, 0x81, 0x06,
+    0x87, 0x0A, 0x81, 0x06, 0x85, 0x0A, 0x87, 0x16, 0x0E, 0x5B, 0x16, 0x1B, 0x16, 0x5B, 0x16, 0x1E,
+    0x25, 0x2D, 0x38, 0x1A, 0x17, 0x6C, 0x13, 0x28, 0x8F, 0x07, 0x18, 0x10, 0x65, 0x51, 0x43, 0x1A,
+    0x1A, 0x51, 0x51, 0x1A, 0x1A, 0x51, 0x2F, 0x56, 0x2D, 0x45, 0x44, 0x0C, 0x32, 0x25, 0x36, 0x2D,
+    0x2D, 0x0C, 0x35, 0x32, 0x93, 0x0C, 0x0B, 0x35, 0x32, 0x32, 0x35, 0x25, 0x34, 0x42, 0x20, 0x81,
+    0x60, 0x47, 0x60, 0x82, 0x47, 0x0C, 0x60, 0x5D, 0x73, 0x61, 0x73, 0x03, 0x73, 0x6D, 0x06, 0x5B,
+    0x60, 0x5D, 0x08, 0x82, 0x35, 0x84, 0x0C, 0x09, 0x11, 0x35, 0x35, 0x11, 0x36, 0x32, 0x15, 0x11,
+    0x36, 0x32, 0x81, 0x36, 0x83, 0x32, 0x88, 0x0C, 0x80, 0x2D, 0x83, 0x45, 0x01, 0x2F, 0x51, 0x81,
+    0x1A, 0x86, 0x17, 0x05, 0x38, 0x30, 0x30, 0x38, 0x1D, 0x18, 0x84, 0x07, 0x88, 0x27, 0x0A, 0x07,
+    0x28, 0x13, 0x6C, 0x6C, 0x1A, 0x2F, 0x0C, 0x58, 0x0B, 0x1B, 0x86, 0x3B, 0x84, 0x1B, 0x8A, 0x0B,
+    0x87, 0x09, 0x80, 0x06, 0x87, 0x0A, 0x80, 0x06, 0x84, 0x0A, 0x88, 0x16, 0x0F, 0x1E, 0x5B, 0x16,
+    0x1E, 0x16, 0x5B, 0x16, 0x1E, 0x34, 0x43, 0x38, 0x1A, 0x17, 0x1D, 0x13, 0x28, 0x8F, 0x07, 0x06,
+    0x39, 0x13, 0x17, 0x43, 0x51, 0x1A, 0x38, 0x82, 0x1A, 0x83, 0x2F, 0x07, 0x45, 0x0C, 0x0C, 0x43,
+    0x2D, 0x2D, 0x0C, 0x35, 0x85, 0x0C, 0x84, 0x35, 0x88, 0x0C, 0x0C, 0x29, 0x0C, 0x35, 0x0C, 0x29,
+    0x32, 0x36, 0x34, 0x24, 0x14, 0x81, 0x5D, 0x47, 0x82, 0x60, 0x10, 0x4D, 0x47, 0x60, 0x60, 0x0B,
+    0x3B, 0x0B, 0x4C, 0x6D, 0x6D, 0x03, 0x09, 0x5D, 0x5D, 0x4C, 0x36, 0x32, 0x83, 0x35, 0x81, 0x0C,
+    0x80, 0x45, 0x82, 0x35, 0x81, 0x11, 0x09, 0x32, 0x36, 0x32, 0x36, 0x36, 0x32, 0x5A, 0x32, 0x29,
+    0x36, 0x81, 0x32, 0x87, 0x0C, 0x83, 0x45, 0x81, 0x2F, 0x81, 0x51, 0x81, 0x1A, 0x83, 0x17, 0x80,
+    0x38, 0x82, 0x79, 0x02, 0x17, 0x13, 0x71, 0x84, 0x07, 0x89, 0x27, 0x09, 0x28, 0x13, 0x17, 0x6C,
+    0x1A, 0x2F, 0x36, 0x0D, 0x73, 0x1B, 0x87, 0x3B, 0x83, 0x1B, 0x8B, 0x0B, 0x85, 0x09, 0x81, 0x5B,
+    0x85, 0x0A, 0x81, 0x06, 0x85, 0x0A, 0x88, 0x16, 0x10, 0x1E, 0x0B, 0x16, 0x1E, 0x7B, 0x5B, 0x5B,
+    0x1E, 0x2C, 0x43, 0x38, 0x1A, 0x17, 0x1D, 0x13, 0x28, 0x27, 0x8F, 0x07, 0x07, 0x10, 0x74, 0x38,
+    0x51, 0x1A, 0x43, 0x2F, 0x51, 0x84, 0x2F, 0x81, 0x45, 0x01, 0x2D, 0x0C, 0x81, 0x32, 0x83, 0x0C,
+    0x80, 0x35, 0x95, 0x0C, 0x04, 0x32, 0x25, 0x42, 0x14, 0x6E, 0x83, 0x60, 0x1F, 0x47, 0x60, 0x47,
+    0x47, 0x60, 0x5D, 0x5D, 0x60, 0x4C, 0x4C, 0x01, 0x0A, 0x03, 0x09, 0x4C, 0x73, 0x3B, 0x63, 0x32,
+    0x11, 0x78, 0x78, 0x11, 0x0C, 0x0C, 0x45, 0x45, 0x0C, 0x0C, 0x35, 0x35, 0x11, 0x83, 0x32, 0x80,
+    0x5A, 0x85, 0x32, 0x87, 0x0C, 0x84, 0x45, 0x05, 0x2F, 0x51, 0x51, 0x1A, 0x1A, 0x17, 0x82, 0x6C,
+    0x82, 0x79, 0x03, 0x6C, 0x1D, 0x18, 0x39, 0x84, 0x07, 0x82, 0x27, 0x80, 0x07, 0x85, 0x27, 0x01,
+    0x28, 0x13, 0x82, 0x1A, 0x04, 0x2D, 0x25, 0x09, 0x68, 0x1B, 0x87, 0x3B, 0x01, 0x1B, 0x3B, 0x81,
+    0x1B, 0x8B, 0x0B, 0x84, 0x09, 0x80, 0x5B, 0x81, 0x06,
+};
+// clang-format on
+
+const painter_rle565_image_t gfx_asuka_240x320_rle565 = {
+    .width        = 240,
+    .height       = 320,
+    .palette_size = 130,
+    .palette      = gfx_asuka_240x320_palette,
+    .data_size    = 40985,
+    .data         = gfx_asuka_240x320_data,
+};
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+# Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Converts 256 colour QGF images into the row RLE format drawn by painter_rle565.c.
+
+The input is a QGF image, either raw or as the C source `qmk painter-convert-graphics` generates, which can hold
+more than one image. The output is a .rle565.c/.h pair next to it, holding a painter_rle565_image_t for each image.
+
+QGF palettes are stored as HSV, and converted to the panel's colours every time an image is drawn. Here they are
+converted once, the same way Quantum Painter converts them for RGB565 panels, and stored as native (byte swapped)
+RGB565. Entries that end up as the same colour are merged, which also joins up runs that only differed in HSV.
+
+The pixels are palette indices, compressed a row at a time, so no run crosses the end of a row:
+
+    0 count-1:7 index...    literal, count indices follow
+    1 count-1:7 index       run, count pixels of one index
+
+Runs and literals are picked to give the smallest encoding of each row. Every image is decoded again and
+compared with the QGF before it is written. With --reference, the decoded images are also written out as raw native
+RGB565 bitmaps, for the host benchmark in painter/bench to check painter_rle565.c against.
+
+Usage: convert_rle565.py image.qgf.c... [--reference directory]
+"""
+
+import argparse
+import re
+import sys
+from collections import Counter
+from pathlib import Path
+
+QGF_MAGIC = b'QGF'
+QGF_BLOCK_GRAPHICS_DESCRIPTOR = 0x00
+QGF_BLOCK_FRAME_DESCRIPTOR = 0x02
+QGF_BLOCK_PALETTE = 0x03
+QGF_BLOCK_DATA = 0x05
+QGF_FORMAT_PALETTE_256 = 0x07
+QGF_COMPRESSION_RLE = 0x01
+
+RLE_FLAG_RUN = 0x80
+RLE_MAX_COUNT = 128
+
+ARRAY_RE = re.compile(r'const\s+uint8_t\s+(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\};', re.S)
+NUMBER_RE = re.compile(r'0x[0-9A-Fa-f]+|\b\d+\b')
+
+
+def read_images(path):
+    """Reads the QGF images in a file, as a list of (name, bytes)."""
+    if path.suffix == '.c':
+        text = path.read_text(encoding='utf-8')
+        return [(match.group(1), bytes(int(number, 0) for number in NUMBER_RE.findall(match.group(2))))
+                for match in ARRAY_RE.finditer(text)]
+    return [('gfx_' + re.sub(r'\W', '_', path.stem), path.read_bytes())]
+
+
+def qgf_blocks(data):
+    """Splits a QGF image into its blocks, as a list of (type, payload)."""
+    blocks = []
+    offset = 0
+    while offset < len(data):
+        block_type, inverse = data[offset], data[offset + 1]
+        length = int.from_bytes(data[offset + 2:offset + 5], 'little')
+        if block_type ^ inverse != 0xFF:
+            raise ValueError(f'bad block header at {offset}')
+        blocks.append((block_type, data[offset + 5:offset + 5 + length]))
+        offset += 5 + length
+    return blocks
+
+
+def qgf_rle_decode(data):
+    """Decodes QGF RLE: a marker below 128 is followed by one byte repeated marker times, otherwise by marker - 127
+    literal bytes."""
+    output = bytearray()
+    offset = 0
+    while offset < len(data):
+        marker = data[offset]
+        if marker < 128:
+            output += bytes([data[offset + 1]]) * marker
+            offset += 2
+        else:
+            output += data[offset + 1:offset + marker - 126]
+            offset += marker - 126
+    return bytes(output)
+
+
+def hsv_to_rgb(h, s, v):
+    """Quantum Painter's HSV to RGB conversion, without the CIE curve."""
+    if s == 0:
+        return v, v, v
+    region = h * 6 // 255
+    remainder = ((h * 2 - region * 85) * 3) & 0xFF
+    p = (v * (255 - s)) >> 8
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8
+    return [(v, t, p), (q, v, p), (p, v, t), (p, q, v), (t, p, v), (v, p, q), (v, t, p)][region]
+
+
+def native_rgb565(h, s, v):
+    """Converts a QGF palette entry to the value that has the panel's byte order when stored little endian."""
+    r, g, b = hsv_to_rgb(h, s, v)
+    rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((rgb565 & 0xFF) << 8) | (rgb565 >> 8)
+
+
+def qgf_decode(data):
+    """Decodes a single frame, 256 colour QGF image to its size and a list of native RGB565 pixels."""
+    blocks = qgf_blocks(data)
+    descriptor = blocks[0][1]
+    if blocks[0][0] != QGF_BLOCK_GRAPHICS_DESCRIPTOR or descriptor[:3] != QGF_MAGIC:
+        raise ValueError('not a QGF image')
+    width, height, frames = (int.from_bytes(descriptor[i:i + 2], 'little') for i in (12, 14, 16))
+    if frames != 1:
+        raise ValueError(f'{frames} frames, only single frame images are supported')
+    frame = next(payload for block_type, payload in blocks if block_type == QGF_BLOCK_FRAME_DESCRIPTOR)
+    if frame[0] != QGF_FORMAT_PALETTE_256:
+        raise ValueError(f'format {frame[0]:#04x}, only 256 colour palettes are supported')
+    palette = next(payload for block_type, payload in blocks if block_type == QGF_BLOCK_PALETTE)
+    colours = [native_rgb565(*palette[i:i + 3]) for i in range(0, len(palette), 3)]
+    pixels = next(payload for block_type, payload in blocks if block_type == QGF_BLOCK_DATA)
+    if frame[2] == QGF_COMPRESSION_RLE:
+        pixels = qgf_rle_decode(pixels)
+    if len(pixels) != width * height:
+        raise ValueError(f'{len(pixels)} pixels for a {width}x{height} image')
+    return width, height, [colours[index] for index in pixels]
+
+
+def encode_row(row):
+    """Encodes a row of palette indices, choosing the runs and literals that take the fewest bytes."""
+    # same[i] is the number of pixels from i onwards that match row[i]
+    same = [1] * (len(row) + 1)
+    for i in range(len(row) - 2, -1, -1):
+        if row[i] == row[i + 1]:
+            same[i] = same[i + 1] + 1
+    # cost[i] is the size of the best encoding of row[i:], and choice[i] the token it starts with
+    cost = [0] * (len(row) + 1)
+    choice = [None] * (len(row) + 1)
+    for i in range(len(row) - 1, -1, -1):
+        best = None
+        for count in range(1, min(RLE_MAX_COUNT, len(row) - i) + 1):
+            if count <= same[i] and (best is None or 2 + cost[i + count] < best[0]):
+                best = (2 + cost[i + count], True, count)
+            if best is None or 1 + count + cost[i + count] < best[0]:
+                best = (1 + count + cost[i + count], False, count)
+        cost[i], choice[i] = best[0], best[1:]
+    data = bytearray()
+    i = 0
+    while i < len(row):
+        run, count = choice[i]
+        if run:
+            data += bytes([RLE_FLAG_RUN | (count - 1), row[i]])
+        else:
+            data += bytes([count - 1]) + bytes(row[i:i + count])
+        i += count
+    return data
+
+
+def encode(width, height, pixels):
+    """Encodes an image, returning its palette, most used colour first, and its data."""
+    palette = [colour for colour, _ in Counter(pixels).most_common()]
+    if len(palette) > 256:
+        raise ValueError(f'{len(palette)} colours, at most 256 are supported')
+    lookup = {colour: index for index, colour in enumerate(palette)}
+    indices = [lookup[colour] for colour in pixels]
+    data = bytearray()
+    for y in range(height):
+        data += encode_row(indices[y * width:(y + 1) * width])
+    return palette, bytes(data)
+
+
+def decode(width, height, palette, data):
+    """Decodes an image the same way painter_rle565.c does, to a list of native RGB565 pixels."""
+    pixels = []
+    offset = 0
+    for _ in range(height):
+        row = []
+        while len(row) < width:
+            token = data[offset]
+            count = (token & ~RLE_FLAG_RUN) + 1
+            if token & RLE_FLAG_RUN:
+                row += [palette[data[offset + 1]]] * count
+                offset += 2
+            else:
+                row += [palette[index] for index in data[offset + 1:offset + 1 + count]]
+                offset += 1 + count
+        if len(row) != width:
+            raise ValueError('a token crosses the end of a row')
+        pixels += row
+    return pixels
+
+
+def c_array(values, digits):
+    return ['    ' + ', '.join(f'0x{value:0{digits}X}' for value in values[i:i + 16 // (digits // 2)]) + ','
+            for i in range(0, len(values), 16 // (digits // 2))]
+
+
+def convert(path, reference):
+    stem = path.name.split('.')[0]
+    header = [
+        "// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>",
+        '// SPDX-License-Identifier: GPL-3.0-or-later',
+        '',
+        f'// Generated from {path.name} by convert_rle565.py, do not edit by hand.',
+        '',
+    ]
+    source = header + [f'#include "{stem}.rle565.h"', '']
+    header += ['#pragma once', '', '#include "display/painter/painter_rle565.h"', '']
+
+    for name, data in read_images(path):
+        try:
+            width, height, pixels = qgf_decode(data)
+        except (ValueError, IndexError, StopIteration) as error:
+            sys.exit(f'{path}: {name}: {error}')
+        palette, encoded = encode(width, height, pixels)
+        if decode(width, height, palette, encoded) != pixels:
+            sys.exit(f'{path}: {name}: round trip failed')
+        if reference:
+            Path(reference, f'{name}.rgb565').write_bytes(b''.join(p.to_bytes(2, 'little') for p in pixels))
+
+        size = len(palette) * 2 + len(encoded)
+        header += [f'extern const painter_rle565_image_t {name}_rle565;']
+        source += [
+            f'// {width}x{height}, {len(palette)} colours: {size} bytes, from {len(data)} bytes as QGF',
+            '// clang-format off',
+            f'static const uint16_t {name}_palette[{len(palette)}] = {{',
+            *c_array(palette, 4),
+            '};',
+            '',
+            f'static const uint8_t {name}_data[{len(encoded)}] = {{',
+            *c_array(encoded, 2),
+            '};',
+            '// clang-format on',
+            '',
+            f'const painter_rle565_image_t {name}_rle565 = {{',
+            f'    .width        = {width},',
+            f'    .height       = {height},',
+            f'    .palette_size = {len(palette)},',
+            f'    .palette      = {name}_palette,',
+            f'    .data_size    = {len(encoded)},',
+            f'    .data         = {name}_data,',
+            '};',
+            '',
+        ]
+        print(f'{name}: {width}x{height}, {len(palette)} colours, {size} bytes (QGF: {len(data)} bytes, '
+              f'{100 * size / len(data):.1f}%), round trip verified')
+
+    Path(path.parent, f'{stem}.rle565.h').write_text('\n'.join(header + ['']), encoding='utf-8')
+    Path(path.parent, f'{stem}.rle565.c').write_text('\n'.join(source), encoding='utf-8')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('images', nargs='+', type=Path, help='QGF images, raw or as generated C source')
+    parser.add_argument('--reference', type=Path, help='directory to write reference RGB565 bitmaps to')
+    args = parser.parse_args()
+
+    if args.reference:
+        args.reference.mkdir(parents=True, exist_ok=True)
+    for path in args.images:
+        convert(path, args.reference)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,16 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from neon-genesis-evangelion-initial-machine-240x320.qgf.c by convert_rle565.py, do not edit by hand.
+
+#pragma once
+
+#include "display/painter/painter_rle565.h"
+
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_00_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_01_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_02_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_03_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_04_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_05_240x320_rle565;
+extern const painter_rle565_image_t gfx_neon_genesis_evangelion_initial_machine_06_240x320_rle565;
@@ -0,0 +1,1070 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated from samurai-cyberpunk-minimal-dark-8k-b3-240x320.qgf.c by convert_rle565.py, do not edit by hand.
+
+#include "samurai-cyberpunk-minimal-dark-8k-b3-240x320.rle565.h"
+
+// 240x320, 87 colours: 16721 bytes, from 23934 bytes as QGF
+// clang-format off
+static const uint16_t gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_palette[87] = {
+    0x0000, 0x60C0, 0x60B8, 0x60C8, 0xFFFF, 0x326C, 0xDFFF, 0x80C0,
+    0x0008, 0x40C0, 0x126C, 0x7374, 0x60D0, 0x2000, 0x0010, 0x60A8,
+    0x4090, 0x0020, 0x40B8, 0x2068, 0x40A0, 0x2048, 0x3274, 0x2058,
+    0x40C8, 0x4078, 0x4060, 0x4070, 0x4098, 0x80B8, 0xF163, 0x6E5B,
+    0x0018, 0x6108, 0x8B42, 0x7284, 0x6088, 0x80C8, 0x0419, 0x116C,
+    0x60D8, 0xA208, 0xC729, 0xE731, 0xED4A, 0x293A, 0x75AD, 0x5374,
+    0x2030, 0x2050, 0x2038, 0x6098, 0xB063, 0x60B0, 0x4050, 0x2040,
+    0x0040, 0x0030, 0x2028, 0xE410, 0xC310, 0xAB4A, 0xD7BD, 0x2018,
+    0x6629, 0xD38C, 0x1CE7, 0x40B0, 0x79CE, 0x0028, 0x4521, 0x4080,
+    0x0D5B, 0x4942, 0x9EF7, 0x5274, 0x4108, 0xAF6B, 0x80D0, 0x2078,
+    0x4000, 0x0038, 0xF16B, 0x327C, 0x9384, 0x1174, 0xA0C0,
+};
+
+static const uint8_t gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_data[16547] = {
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00,
+    0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0x97, 0x00, 0xFF, 0x00,
+    0x80, 0x20, 0xD6, 0x00, 0x97, 0x00, 0xFF, 0x00, 0x01, 0x15, 0x08, 0xD5, 0x00, 0x96, 0x00, 0xFF,
+    0x00, 0x02, 0x0D, 0x1A, 0x0E, 0xD5, 0x00, 0x97, 0x00, 0xFF, 0x00, 0x01, 0x10, 0x0E, 0xD5, 0x00,
+    0x91, 0x00, 0xFF, 0x00, 0x07, 0x0D, 0x00, 0x08, 0x00, 0x00, 0x51, 0x01, 0x20, 0xD5, 0x00, 0x95,
+    0x00, 0xFF, 0x00, 0x03, 0x0E, 0x0F, 0x01, 0x0E, 0xD5, 0x00, 0x91, 0x00, 0xFF, 0x00, 0x06, 0x08,
+    0x00, 0x00, 0x08, 0x10, 0x03, 0x35, 0x9E, 0x00, 0x80, 0x39, 0xB6, 0x00, 0x93, 0x00, 0xFF, 0x00,
+    0x04, 0x45, 0x14, 0x03, 0x03, 0x10, 0x9E, 0x00, 0x01, 0x13, 0x0E, 0xB5, 0x00, 0x91, 0x00, 0xFF,
+    0x00, 0x06, 0x11, 0x13, 0x07, 0x01, 0x02, 0x03, 0x36, 0x9E, 0x00, 0x01, 0x1B, 0x17, 0xB5, 0x00,
+    0x8E, 0x00, 0xFF, 0x00, 0x09, 0x08, 0x32, 0x10, 0x01, 0x03, 0x02, 0x02, 0x03, 0x0F, 0x08, 0x9E,
+    0x00, 0x01, 0x13, 0x14, 0xB5, 0x00, 0x8A, 0x00, 0xFF, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x30, 0x33,
+    0x03, 0x0C, 0x01, 0x09, 0x02, 0x03, 0x0F, 0x20, 0x9F, 0x00, 0x02, 0x1B, 0x01, 0x08, 0xB4, 0x00,
+    0x8B, 0x00, 0xFF, 0x00, 0x0A, 0x0E, 0x19, 0x03, 0x03, 0x02, 0x02, 0x09, 0x01, 0x25, 0x33, 0x0E,
+    0xA0, 0x00, 0x02, 0x1C, 0x03, 0x11, 0xB4, 0x00, 0x8A, 0x00, 0xFF, 0x00, 0x02, 0x3A, 0x0F, 0x03,
+    0x82, 0x02, 0x03, 0x01, 0x03, 0x02, 0x17, 0x8D, 0x00, 0x03, 0x0D, 0x00, 0x11, 0x0E, 0x8E, 0x00,
+    0x04, 0x08, 0x20, 0x01, 0x01, 0x3A, 0xB4, 0x00, 0x89, 0x00, 0xFF, 0x00, 0x02, 0x32, 0x09, 0x07,
+    0x82, 0x01, 0x03, 0x02, 0x03, 0x1C, 0x11, 0x90, 0x00, 0x01, 0x39, 0x1A, 0x8C, 0x00, 0x06, 0x0D,
+    0x00, 0x00, 0x1B, 0x03, 0x01, 0x39, 0xB4, 0x00, 0xC1, 0x00, 0x80, 0x0E, 0xC5, 0x00, 0x80, 0x37,
+    0x84, 0x01, 0x03, 0x02, 0x03, 0x47, 0x08, 0x91, 0x00, 0x02, 0x3F, 0x0F, 0x08, 0x8D, 0x00, 0x04,
+    0x30, 0x03, 0x01, 0x02, 0x3A, 0xB4, 0x00, 0xC1, 0x00, 0x01, 0x31, 0x08, 0xC3, 0x00, 0x08, 0x39,
+    0x18, 0x09, 0x02, 0x01, 0x02, 0x02, 0x28, 0x19, 0x93, 0x00, 0x02, 0x08, 0x01, 0x15, 0x8C, 0x00,
+    0x05, 0x20, 0x0F, 0x01, 0x02, 0x01, 0x11, 0xB4, 0x00, 0xC1, 0x00, 0x01, 0x38, 0x32, 0xC2, 0x00,
+    0x80, 0x3F, 0x81, 0x02, 0x82, 0x01, 0x02, 0x02, 0x25, 0x10, 0x94, 0x00, 0x02, 0x08, 0x02, 0x10,
+    0x8B, 0x00, 0x06, 0x08, 0x14, 0x03, 0x09, 0x01, 0x35, 0x08, 0xB4, 0x00, 0xC1, 0x00, 0x01, 0x08,
+    0x13, 0xA8, 0x00, 0x80, 0x08, 0x98, 0x00, 0x08, 0x24, 0x0C, 0x01, 0x01, 0x07, 0x09, 0x01, 0x35,
+    0x0E, 0x94, 0x00, 0x03, 0x3F, 0x01, 0x12, 0x08, 0x89, 0x00, 0x06, 0x08, 0x14, 0x03, 0x02, 0x02,
+    0x0C, 0x1B, 0xB5, 0x00, 0xC2, 0x00, 0x01, 0x1B, 0x3F, 0xA6, 0x00, 0x80, 0x20, 0x98, 0x00, 0x08,
+    0x37, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0C, 0x38, 0x95, 0x00, 0x03, 0x30, 0x03, 0x01, 0x11,
+    0x89, 0x00, 0x07, 0x1C, 0x0C, 0x02, 0x01, 0x01, 0x02, 0x11, 0x0D, 0xB4, 0x00, 0xC2, 0x00, 0x01,
+    0x24, 0x36, 0xA5, 0x00, 0x01, 0x08, 0x13, 0x98, 0x00, 0x07, 0x33, 0x18, 0x02, 0x07, 0x02, 0x02,
+    0x03, 0x24, 0x82, 0x00, 0x80, 0x08, 0x92, 0x00, 0x03, 0x1A, 0x03, 0x03, 0x32, 0x88, 0x00, 0x06,
+    0x17, 0x0C, 0x12, 0x07, 0x02, 0x03, 0x17, 0xB6, 0x00, 0xC2, 0x00, 0x01, 0x47, 0x10, 0xA5, 0x00,
+    0x01, 0x11, 0x14, 0x97, 0x00, 0x02, 0x30, 0x03, 0x02, 0x84, 0x01, 0x80, 0x30, 0x82, 0x00, 0x01,
+    0x0E, 0x17, 0x91, 0x00, 0x03, 0x33, 0x01, 0x03, 0x15, 0x87, 0x00, 0x06, 0x08, 0x35, 0x18, 0x02,
+    0x02, 0x03, 0x13, 0xB7, 0x00, 0xC2, 0x00, 0x01, 0x24, 0x12, 0xA5, 0x00, 0x01, 0x10, 0x14, 0x97,
+    0x00, 0x01, 0x1B, 0x25, 0x82, 0x01, 0x02, 0x1D, 0x03, 0x14, 0x84, 0x00, 0x01, 0x10, 0x3F, 0x8F,
+    0x00, 0x04, 0x32, 0x03, 0x02, 0x03, 0x51, 0x87, 0x00, 0x05, 0x30, 0x03, 0x01, 0x02, 0x0C, 0x17,
+    0xB8, 0x00, 0xC1, 0x00, 0x03, 0x0D, 0x47, 0x01, 0x0E, 0x9F, 0x00, 0x06, 0x08, 0x11, 0x00, 0x00,
+    0x38, 0x03, 0x1A, 0x8F, 0x00, 0x80, 0x0D, 0x85, 0x00, 0x08, 0x08, 0x1C, 0x07, 0x09, 0x01, 0x01,
+    0x02, 0x03, 0x13, 0x82, 0x00, 0x03, 0x0D, 0x00, 0x1C, 0x32, 0x8E, 0x00, 0x05, 0x08, 0x1C, 0x18,
+    0x02, 0x01, 0x11, 0x87, 0x00, 0x04, 0x36, 0x0C, 0x12, 0x25, 0x17, 0xB9, 0x00, 0xC1, 0x00, 0x03,
+    0x39, 0x10, 0x25, 0x11, 0x9F, 0x00, 0x06, 0x17, 0x20, 0x00, 0x00, 0x14, 0x01, 0x20, 0x96, 0x00,
+    0x03, 0x3F, 0x01, 0x01, 0x02, 0x82, 0x01, 0x01, 0x03, 0x15, 0x84, 0x00, 0x01, 0x14, 0x15, 0x8E,
+    0x00, 0x05, 0x13, 0x0C, 0x01, 0x01, 0x0F, 0x08, 0x87, 0x00, 0x03, 0x1A, 0x03, 0x03, 0x1B, 0xBA,
+    0x00, 0xC0, 0x00, 0x04, 0x08, 0x13, 0x33, 0x03, 0x45, 0x9E, 0x00, 0x06, 0x15, 0x13, 0x00, 0x00,
+    0x11, 0x0C, 0x17, 0x97, 0x00, 0x01, 0x32, 0x03, 0x82, 0x01, 0x03, 0x07, 0x01, 0x0C, 0x15, 0x84,
+    0x00, 0x01, 0x43, 0x15, 0x8D, 0x00, 0x05, 0x38, 0x07, 0x02, 0x02, 0x03, 0x1B, 0x88, 0x00, 0x03,
+    0x13, 0x0C, 0x12, 0x08, 0xBA, 0x00, 0xC0, 0x00, 0x04, 0x3A, 0x24, 0x0F, 0x01, 0x11, 0x9A, 0x00,
+    0x0A, 0x0D, 0x00, 0x00, 0x08, 0x35, 0x45, 0x00, 0x00, 0x36, 0x02, 0x08, 0x97, 0x00, 0x0F, 0x36,
+    0x03, 0x02, 0x07, 0x01, 0x01, 0x02, 0x25, 0x1A, 0x00, 0x0D, 0x00, 0x00, 0x0E, 0x03, 0x32, 0x8C,
+    0x00, 0x06, 0x08, 0x43, 0x03, 0x02, 0x01, 0x01, 0x11, 0x88, 0x00, 0x02, 0x1B, 0x28, 0x1B, 0xBB,
+    0x00, 0xC0, 0x00, 0x04, 0x31, 0x12, 0x02, 0x02, 0x08, 0x9D, 0x00, 0x01, 0x1A, 0x02, 0x82, 0x00,
+    0x01, 0x13, 0x19, 0x8F, 0x00, 0x02, 0x08, 0x31, 0x11, 0x85, 0x00, 0x0F, 0x13, 0x03, 0x02, 0x01,
+    0x02, 0x09, 0x09, 0x07, 0x35, 0x08, 0x00, 0x08, 0x00, 0x36, 0x03, 0x3A, 0x8C, 0x00, 0x05, 0x17,
+    0x03, 0x02, 0x02, 0x0C, 0x13, 0x89, 0x00, 0x02, 0x1B, 0x4E, 0x3A, 0xBB, 0x00, 0xC0, 0x00, 0x04,
+    0x1A, 0x0C, 0x1D, 0x02, 0x08, 0x9D, 0x00, 0x01, 0x35, 0x19, 0x82, 0x00, 0x01, 0x1A, 0x17, 0x8E,
+    0x00, 0x02, 0x3F, 0x0F, 0x15, 0x86, 0x00, 0x0F, 0x1B, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x03, 0x4F, 0x00, 0x00, 0x0E, 0x0F, 0x01, 0x3F, 0x8C, 0x00, 0x04, 0x0F, 0x18, 0x02, 0x0C, 0x47,
+    0x8A, 0x00, 0x01, 0x19, 0x35, 0xBC, 0x00, 0xC0, 0x00, 0x03, 0x13, 0x03, 0x01, 0x0F, 0x9D, 0x00,
+    0x02, 0x20, 0x0C, 0x17, 0x82, 0x00, 0x01, 0x31, 0x1A, 0x8D, 0x00, 0x02, 0x20, 0x03, 0x13, 0x87,
+    0x00, 0x0F, 0x4F, 0x03, 0x01, 0x01, 0x09, 0x01, 0x01, 0x1D, 0x01, 0x03, 0x19, 0x17, 0x0F, 0x03,
+    0x0F, 0x08, 0x8B, 0x00, 0x05, 0x30, 0x03, 0x12, 0x0C, 0x10, 0x08, 0x8A, 0x00, 0x01, 0x47, 0x4F,
+    0xBC, 0x00, 0xC0, 0x00, 0x03, 0x1A, 0x03, 0x09, 0x14, 0x9D, 0x00, 0x02, 0x15, 0x28, 0x30, 0x82,
+    0x00, 0x01, 0x11, 0x4F, 0x8D, 0x00, 0x02, 0x33, 0x02, 0x08, 0x87, 0x00, 0x02, 0x1B, 0x0C, 0x02,
+    0x86, 0x01, 0x81, 0x03, 0x04, 0x09, 0x01, 0x1C, 0x00, 0x0D, 0x8A, 0x00, 0x03, 0x31, 0x03, 0x03,
+    0x19, 0x8C, 0x00, 0x01, 0x4F, 0x39, 0xBC, 0x00, 0xC0, 0x00, 0x03, 0x31, 0x03, 0x01, 0x10, 0x9D,
+    0x00, 0x02, 0x1B, 0x0C, 0x3A, 0x83, 0x00, 0x01, 0x1B, 0x11, 0x8B, 0x00, 0x04, 0x45, 0x0C, 0x47,
+    0x00, 0x08, 0x86, 0x00, 0x06, 0x19, 0x03, 0x02, 0x09, 0x01, 0x01, 0x07, 0x83, 0x01, 0x03, 0x09,
+    0x01, 0x03, 0x10, 0x86, 0x00, 0x01, 0x0E, 0x38, 0x83, 0x00, 0x02, 0x1B, 0x28, 0x13, 0x8D, 0x00,
+    0x01, 0x3A, 0x08, 0x93, 0x00, 0x80, 0x0E, 0xA7, 0x00, 0xC0, 0x00, 0x03, 0x39, 0x03, 0x01, 0x33,
+    0x9D, 0x00, 0x02, 0x10, 0x03, 0x51, 0x83, 0x00, 0x01, 0x20, 0x38, 0x8B, 0x00, 0x02, 0x15, 0x4E,
+    0x19, 0x88, 0x00, 0x03, 0x19, 0x25, 0x02, 0x09, 0x82, 0x01, 0x01, 0x07, 0x01, 0x83, 0x02, 0x01,
+    0x03, 0x10, 0x85, 0x00, 0x02, 0x08, 0x14, 0x36, 0x83, 0x00, 0x01, 0x24, 0x33, 0xA4, 0x00, 0x01,
+    0x13, 0x08, 0xA6, 0x00, 0xC0, 0x00, 0x03, 0x0E, 0x12, 0x01, 0x0F, 0x9C, 0x00, 0x03, 0x08, 0x14,
+    0x4E, 0x17, 0x84, 0x00, 0x80, 0x08, 0x8B, 0x00, 0x02, 0x15, 0x03, 0x14, 0x88, 0x00, 0x02, 0x24,
+    0x03, 0x12, 0x87, 0x01, 0x03, 0x07, 0x02, 0x18, 0x1C, 0x84, 0x00, 0x03, 0x08, 0x1C, 0x03, 0x20,
+    0x83, 0x00, 0x01, 0x19, 0x11, 0xA3, 0x00, 0x02, 0x0E, 0x12, 0x3F, 0xA6, 0x00, 0xC1, 0x00, 0x03,
+    0x1C, 0x03, 0x43, 0x08, 0x9B, 0x00, 0x03, 0x0E, 0x12, 0x25, 0x14, 0x91, 0x00, 0x03, 0x11, 0x01,
+    0x07, 0x38, 0x87, 0x00, 0x04, 0x1C, 0x03, 0x09, 0x1D, 0x07, 0x87, 0x01, 0x0A, 0x02, 0x01, 0x11,
+    0x00, 0x00, 0x0D, 0x00, 0x4F, 0x0C, 0x0F, 0x08, 0x83, 0x00, 0x80, 0x20, 0x88, 0x00, 0x01, 0x11,
+    0x0E, 0x99, 0x00, 0x02, 0x17, 0x0C, 0x3A, 0xA6, 0x00, 0xC1, 0x00, 0x03, 0x13, 0x4E, 0x12, 0x0E,
+    0x9B, 0x00, 0x04, 0x11, 0x09, 0x02, 0x03, 0x36, 0x91, 0x00, 0x05, 0x0F, 0x03, 0x02, 0x30, 0x00,
+    0x08, 0x83, 0x00, 0x03, 0x08, 0x43, 0x01, 0x07, 0x88, 0x01, 0x03, 0x02, 0x01, 0x07, 0x10, 0x82,
+    0x00, 0x04, 0x45, 0x07, 0x07, 0x35, 0x08, 0x8D, 0x00, 0x01, 0x17, 0x51, 0x98, 0x00, 0x03, 0x0E,
+    0x43, 0x03, 0x11, 0xA6, 0x00, 0xC1, 0x00, 0x03, 0x3A, 0x02, 0x01, 0x39, 0x9B, 0x00, 0x80, 0x11,
+    0x83, 0x01, 0x80, 0x11, 0x90, 0x00, 0x04, 0x19, 0x18, 0x01, 0x0F, 0x08, 0x84, 0x00, 0x03, 0x30,
+    0x01, 0x01, 0x07, 0x84, 0x01, 0x80, 0x07, 0x82, 0x01, 0x0A, 0x09, 0x35, 0x01, 0x18, 0x47, 0x08,
+    0x00, 0x1B, 0x0C, 0x01, 0x14, 0x8A, 0x00, 0x80, 0x0E, 0x82, 0x00, 0x01, 0x10, 0x17, 0x98, 0x00,
+    0x03, 0x4F, 0x03, 0x0F, 0x08, 0xA6, 0x00, 0xC2, 0x00, 0x02, 0x1C, 0x28, 0x37, 0x9B, 0x00, 0x05,
+    0x11, 0x02, 0x01, 0x02, 0x07, 0x10, 0x90, 0x00, 0x04, 0x36, 0x03, 0x02, 0x18, 0x45, 0x84, 0x00,
+    0x03, 0x13, 0x03, 0x01, 0x1D, 0x88, 0x01, 0x0C, 0x35, 0x30, 0x43, 0x01, 0x07, 0x02, 0x13, 0x0F,
+    0x01, 0x03, 0x1C, 0x00, 0x0D, 0x86, 0x00, 0x02, 0x3A, 0x47, 0x15, 0x82, 0x00, 0x01, 0x0F, 0x13,
+    0x84, 0x00, 0x80, 0x0D, 0x91, 0x00, 0x03, 0x37, 0x03, 0x03, 0x1B, 0xA7, 0x00, 0xC2, 0x00, 0x02,
+    0x37, 0x28, 0x13, 0x9B, 0x00, 0x01, 0x0E, 0x43, 0x82, 0x01, 0x01, 0x03, 0x31, 0x87, 0x00, 0x80,
+    0x08, 0x86, 0x00, 0x04, 0x36, 0x0C, 0x02, 0x07, 0x45, 0x83, 0x00, 0x06, 0x3F, 0x02, 0x01, 0x01,
+    0x02, 0x01, 0x07, 0x84, 0x01, 0x0C, 0x02, 0x03, 0x10, 0x15, 0x03, 0x01, 0x02, 0x02, 0x03, 0x01,
+    0x02, 0x03, 0x4F, 0x87, 0x00, 0x02, 0x39, 0x35, 0x39, 0x82, 0x00, 0x02, 0x11, 0x03, 0x1A, 0x96,
+    0x00, 0x04, 0x08, 0x0F, 0x07, 0x35, 0x0E, 0xA7, 0x00, 0xC3, 0x00, 0x01, 0x0F, 0x14, 0x9C, 0x00,
+    0x06, 0x14, 0x18, 0x02, 0x02, 0x01, 0x0F, 0x0E, 0x86, 0x00, 0x02, 0x3F, 0x4F, 0x08, 0x84, 0x00,
+    0x0D, 0x10, 0x18, 0x01, 0x01, 0x30, 0x00, 0x08, 0x00, 0x08, 0x33, 0x01, 0x02, 0x01, 0x07, 0x82,
+    0x01, 0x12, 0x07, 0x01, 0x01, 0x02, 0x01, 0x03, 0x13, 0x10, 0x03, 0x02, 0x12, 0x03, 0x09, 0x01,
+    0x01, 0x0C, 0x36, 0x00, 0x0D, 0x84, 0x00, 0x02, 0x0E, 0x12, 0x15, 0x83, 0x00, 0x06, 0x1B, 0x4E,
+    0x15, 0x00, 0x00, 0x39, 0x3F, 0x92, 0x00, 0x03, 0x36, 0x0C, 0x01, 0x38, 0xA8, 0x00, 0xC3, 0x00,
+    0x02, 0x38, 0x01, 0x0E, 0x9B, 0x00, 0x06, 0x10, 0x03, 0x02, 0x01, 0x12, 0x4E, 0x13, 0x87, 0x00,
+    0x01, 0x4F, 0x14, 0x83, 0x00, 0x0C, 0x38, 0x03, 0x02, 0x01, 0x03, 0x10, 0x0E, 0x08, 0x32, 0x0F,
+    0x03, 0x01, 0x09, 0x83, 0x01, 0x80, 0x07, 0x84, 0x01, 0x07, 0x12, 0x1B, 0x18, 0x02, 0x01, 0x25,
+    0x47, 0x37, 0x82, 0x01, 0x80, 0x3F, 0x86, 0x00, 0x01, 0x0F, 0x10, 0x83, 0x00, 0x07, 0x0E, 0x02,
+    0x07, 0x11, 0x00, 0x00, 0x13, 0x20, 0x88, 0x00, 0x80, 0x0D, 0x82, 0x00, 0x80, 0x08, 0x84, 0x00,
+    0x02, 0x10, 0x28, 0x13, 0xA9, 0x00, 0xC4, 0x00, 0x01, 0x10, 0x31, 0x8F, 0x00, 0x80, 0x08, 0x8A,
+    0x00, 0x02, 0x1A, 0x03, 0x02, 0x83, 0x01, 0x80, 0x3F, 0x86, 0x00, 0x14, 0x3A, 0x28, 0x15, 0x00,
+    0x00, 0x3A, 0x1D, 0x01, 0x1D, 0x01, 0x02, 0x25, 0x12, 0x0F, 0x03, 0x03, 0x12, 0x07, 0x07, 0x01,
+    0x02, 0x84, 0x01, 0x0D, 0x07, 0x09, 0x01, 0x0F, 0x0F, 0x01, 0x02, 0x01, 0x36, 0x00, 0x30, 0x03,
+    0x07, 0x10, 0x86, 0x00, 0x02, 0x1A, 0x0C, 0x11, 0x83, 0x00, 0x07, 0x17, 0x4E, 0x14, 0x08, 0x00,
+    0x08, 0x10, 0x08, 0x8B, 0x00, 0x01, 0x51, 0x08, 0x83, 0x00, 0x02, 0x0E, 0x01, 0x33, 0xAA, 0x00,
+    0xC4, 0x00, 0x01, 0x20, 0x1B, 0x8F, 0x00, 0x02, 0x38, 0x00, 0x08, 0x86, 0x00, 0x09, 0x0D, 0x00,
+    0x3A, 0x07, 0x02, 0x02, 0x01, 0x02, 0x03, 0x13, 0x86, 0x00, 0x0F, 0x0E, 0x09, 0x47, 0x00, 0x36,
+    0x02, 0x09, 0x09, 0x02, 0x01, 0x1D, 0x09, 0x07, 0x01, 0x01, 0x02, 0x84, 0x01, 0x04, 0x07, 0x01,
+    0x1D, 0x01, 0x07, 0x82, 0x01, 0x0A, 0x09, 0x01, 0x02, 0x07, 0x37, 0x00, 0x00, 0x15, 0x07, 0x03,
+    0x38, 0x85, 0x00, 0x03, 0x20, 0x01, 0x0F, 0x08, 0x83, 0x00, 0x06, 0x10, 0x28, 0x17, 0x00, 0x00,
+    0x32, 0x0F, 0x8B, 0x00, 0x01, 0x39, 0x17, 0x84, 0x00, 0x02, 0x30, 0x0C, 0x30, 0xAA, 0x00, 0xC5,
+    0x00, 0x01, 0x3A, 0x20, 0x8E, 0x00, 0x01, 0x19, 0x51, 0x8A, 0x00, 0x01, 0x10, 0x03, 0x83, 0x01,
+    0x01, 0x43, 0x08, 0x85, 0x00, 0x16, 0x08, 0x0F, 0x12, 0x33, 0x03, 0x02, 0x02, 0x56, 0x01, 0x01,
+    0x02, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x07, 0x86, 0x01, 0x08,
+    0x1D, 0x03, 0x17, 0x00, 0x08, 0x0D, 0x15, 0x28, 0x10, 0x86, 0x00, 0x03, 0x13, 0x4E, 0x0F, 0x08,
+    0x82, 0x00, 0x08, 0x08, 0x43, 0x02, 0x0E, 0x00, 0x00, 0x13, 0x01, 0x08, 0x89, 0x00, 0x02, 0x08,
+    0x10, 0x0E, 0x84, 0x00, 0x01, 0x36, 0x10, 0xAB, 0x00, 0xD6, 0x00, 0x01, 0x19, 0x0F, 0x8A, 0x00,
+    0x07, 0x3A, 0x01, 0x02, 0x01, 0x02, 0x01, 0x0C, 0x32, 0x85, 0x00, 0x01, 0x08, 0x0F, 0x83, 0x01,
+    0x01, 0x07, 0x02, 0x82, 0x01, 0x06, 0x02, 0x09, 0x01, 0x07, 0x01, 0x01, 0x09, 0x84, 0x01, 0x0F,
+    0x09, 0x01, 0x01, 0x09, 0x01, 0x02, 0x02, 0x01, 0x1C, 0x00, 0x08, 0x00, 0x00, 0x17, 0x0C, 0x45,
+    0x85, 0x00, 0x0A, 0x0E, 0x02, 0x01, 0x09, 0x30, 0x00, 0x08, 0x00, 0x3F, 0x03, 0x19, 0x82, 0x00,
+    0x02, 0x13, 0x28, 0x37, 0x89, 0x00, 0x01, 0x1A, 0x24, 0x85, 0x00, 0x01, 0x31, 0x38, 0xAB, 0x00,
+    0xD6, 0x00, 0x02, 0x31, 0x28, 0x1B, 0x8A, 0x00, 0x06, 0x13, 0x03, 0x02, 0x07, 0x02, 0x03, 0x13,
+    0x85, 0x00, 0x05, 0x20, 0x01, 0x02, 0x01, 0x01, 0x02, 0x83, 0x01, 0x02, 0x02, 0x01, 0x09, 0x82,
+    0x01, 0x80, 0x02, 0x84, 0x01, 0x0F, 0x02, 0x01, 0x07, 0x01, 0x01, 0x02, 0x02, 0x01, 0x03, 0x15,
+    0x00, 0x15, 0x45, 0x00, 0x10, 0x1B, 0x86, 0x00, 0x04, 0x17, 0x03, 0x02, 0x03, 0x19, 0x82, 0x00,
+    0x02, 0x11, 0x01, 0x3A, 0x82, 0x00, 0x02, 0x31, 0x28, 0x10, 0x88, 0x00, 0x02, 0x08, 0x02, 0x15,
+    0x85, 0x00, 0x01, 0x45, 0x0E, 0x82, 0x00, 0x80, 0x0D, 0xA7, 0x00, 0xCA, 0x00, 0x80, 0x08, 0x8A,
+    0x00, 0x03, 0x3A, 0x18, 0x03, 0x17, 0x8A, 0x00, 0x07, 0x33, 0x03, 0x1D, 0x02, 0x0C, 0x19, 0x00,
+    0x08, 0x83, 0x00, 0x05, 0x15, 0x0C, 0x02, 0x01, 0x01, 0x1D, 0x90, 0x01, 0x0E, 0x02, 0x01, 0x09,
+    0x09, 0x02, 0x01, 0x01, 0x35, 0x08, 0x00, 0x13, 0x36, 0x00, 0x4F, 0x08, 0x85, 0x00, 0x12, 0x08,
+    0x14, 0x01, 0x02, 0x07, 0x01, 0x11, 0x00, 0x00, 0x3A, 0x14, 0x08, 0x00, 0x00, 0x0D, 0x38, 0x03,
+    0x02, 0x3F, 0x87, 0x00, 0x02, 0x31, 0x03, 0x45, 0xB3, 0x00, 0xC9, 0x00, 0x01, 0x45, 0x32, 0x8B,
+    0x00, 0x03, 0x14, 0x01, 0x01, 0x3A, 0x89, 0x00, 0x80, 0x3A, 0x82, 0x01, 0x01, 0x03, 0x47, 0x85,
+    0x00, 0x01, 0x47, 0x03, 0x95, 0x01, 0x81, 0x02, 0x81, 0x01, 0x08, 0x07, 0x03, 0x19, 0x00, 0x00,
+    0x0F, 0x13, 0x00, 0x3F, 0x86, 0x00, 0x0A, 0x15, 0x03, 0x01, 0x07, 0x01, 0x03, 0x13, 0x00, 0x00,
+    0x20, 0x1A, 0x83, 0x00, 0x03, 0x37, 0x03, 0x07, 0x38, 0x87, 0x00, 0x02, 0x1C, 0x01, 0x0E, 0xB3,
+    0x00, 0xC9, 0x00, 0x01, 0x32, 0x4F, 0x8B, 0x00, 0x03, 0x37, 0x03, 0x18, 0x1C, 0x8A, 0x00, 0x06,
+    0x19, 0x03, 0x01, 0x25, 0x33, 0x00, 0x08, 0x82, 0x00, 0x01, 0x0E, 0x02, 0x94, 0x01, 0x0C, 0x02,
+    0x01, 0x01, 0x07, 0x01, 0x01, 0x02, 0x03, 0x51, 0x00, 0x15, 0x28, 0x1B, 0x88, 0x00, 0x0A, 0x14,
+    0x01, 0x02, 0x09, 0x1D, 0x03, 0x14, 0x00, 0x00, 0x08, 0x38, 0x83, 0x00, 0x03, 0x13, 0x18, 0x07,
+    0x17, 0x86, 0x00, 0x03, 0x20, 0x07, 0x12, 0x0E, 0xB3, 0x00, 0xC9, 0x00, 0x02, 0x11, 0x02, 0x45,
+    0x8B, 0x00, 0x03, 0x1A, 0x0C, 0x01, 0x3A, 0x89, 0x00, 0x0B, 0x39, 0x07, 0x01, 0x01, 0x14, 0x00,
+    0x38, 0x08, 0x00, 0x00, 0x38, 0x03, 0x83, 0x01, 0x80, 0x02, 0x96, 0x01, 0x05, 0x14, 0x00, 0x39,
+    0x1D, 0x03, 0x36, 0x87, 0x00, 0x0B, 0x1A, 0x03, 0x09, 0x01, 0x01, 0x1D, 0x07, 0x43, 0x0E, 0x00,
+    0x00, 0x08, 0x82, 0x00, 0x04, 0x08, 0x0F, 0x09, 0x03, 0x13, 0x86, 0x00, 0x03, 0x15, 0x18, 0x01,
+    0x11, 0xB3, 0x00, 0xCA, 0x00, 0x02, 0x35, 0x0F, 0x0E, 0x8B, 0x00, 0x02, 0x31, 0x4E, 0x1A, 0x83,
+    0x00, 0x01, 0x11, 0x20, 0x83, 0x00, 0x0B, 0x0E, 0x02, 0x07, 0x01, 0x14, 0x00, 0x13, 0x32, 0x00,
+    0x00, 0x13, 0x03, 0x94, 0x01, 0x01, 0x09, 0x07, 0x82, 0x01, 0x07, 0x43, 0x0C, 0x13, 0x00, 0x0F,
+    0x01, 0x01, 0x11, 0x86, 0x00, 0x02, 0x37, 0x01, 0x02, 0x82, 0x01, 0x03, 0x07, 0x01, 0x02, 0x11,
+    0x83, 0x00, 0x06, 0x0D, 0x00, 0x1A, 0x03, 0x02, 0x0C, 0x1B, 0x86, 0x00, 0x03, 0x1A, 0x03, 0x03,
+    0x39, 0xB3, 0x00, 0xCA, 0x00, 0x03, 0x1B, 0x28, 0x14, 0x20, 0x8B, 0x00, 0x01, 0x38, 0x10, 0x83,
+    0x00, 0x01, 0x45, 0x1B, 0x83, 0x00, 0x0F, 0x39, 0x18, 0x01, 0x01, 0x33, 0x00, 0x1A, 0x13, 0x00,
+    0x00, 0x47, 0x03, 0x02, 0x1D, 0x01, 0x02, 0x91, 0x01, 0x80, 0x1D, 0x83, 0x01, 0x06, 0x0C, 0x38,
+    0x17, 0x0C, 0x01, 0x43, 0x08, 0x85, 0x00, 0x0A, 0x15, 0x01, 0x01, 0x02, 0x09, 0x1D, 0x01, 0x01,
+    0x09, 0x07, 0x20, 0x84, 0x00, 0x05, 0x32, 0x07, 0x01, 0x02, 0x03, 0x4F, 0x86, 0x00, 0x03, 0x19,
+    0x25, 0x03, 0x36, 0xB3, 0x00, 0xCA, 0x00, 0x04, 0x11, 0x1D, 0x01, 0x12, 0x45, 0x8B, 0x00, 0x80,
+    0x11, 0x83, 0x00, 0x02, 0x08, 0x35, 0x39, 0x82, 0x00, 0x0E, 0x1A, 0x0C, 0x02, 0x03, 0x19, 0x00,
+    0x1B, 0x10, 0x00, 0x00, 0x24, 0x25, 0x02, 0x01, 0x02, 0x91, 0x01, 0x80, 0x02, 0x81, 0x01, 0x82,
+    0x02, 0x06, 0x03, 0x37, 0x33, 0x18, 0x02, 0x01, 0x3A, 0x83, 0x00, 0x0C, 0x08, 0x19, 0x0C, 0x01,
+    0x02, 0x01, 0x02, 0x02, 0x01, 0x09, 0x03, 0x35, 0x08, 0x83, 0x00, 0x06, 0x11, 0x02, 0x02, 0x01,
+    0x02, 0x03, 0x1A, 0x86, 0x00, 0x03, 0x24, 0x25, 0x18, 0x19, 0xB3, 0x00, 0xCB, 0x00, 0x04, 0x1B,
+    0x03, 0x01, 0x01, 0x32, 0x90, 0x00, 0x01, 0x19, 0x0F, 0x82, 0x00, 0x0B, 0x1C, 0x07, 0x12, 0x0C,
+    0x36, 0x00, 0x1C, 0x10, 0x00, 0x00, 0x24, 0x07, 0x82, 0x01, 0x80, 0x07, 0x91, 0x01, 0x12, 0x02,
+    0x09, 0x01, 0x12, 0x17, 0x01, 0x47, 0x12, 0x01, 0x02, 0x01, 0x1C, 0x0E, 0x00, 0x08, 0x36, 0x35,
+    0x07, 0x02, 0x84, 0x01, 0x03, 0x02, 0x01, 0x03, 0x24, 0x83, 0x00, 0x07, 0x08, 0x0F, 0x03, 0x01,
+    0x01, 0x12, 0x0C, 0x15, 0x86, 0x00, 0x03, 0x19, 0x0C, 0x01, 0x14, 0xB3, 0x00, 0xB5, 0x00, 0x01,
+    0x0E, 0x11, 0x93, 0x00, 0x05, 0x0E, 0x0F, 0x01, 0x01, 0x25, 0x15, 0x8A, 0x00, 0x80, 0x0D, 0x83,
+    0x00, 0x13, 0x0E, 0x07, 0x32, 0x00, 0x3F, 0x01, 0x09, 0x01, 0x02, 0x0E, 0x20, 0x03, 0x4F, 0x00,
+    0x00, 0x24, 0x03, 0x02, 0x07, 0x02, 0x8A, 0x01, 0x80, 0x09, 0x82, 0x01, 0x03, 0x09, 0x07, 0x01,
+    0x09, 0x83, 0x01, 0x0B, 0x39, 0x33, 0x18, 0x01, 0x01, 0x02, 0x02, 0x03, 0x0F, 0x33, 0x02, 0x03,
+    0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x03, 0x02, 0x01, 0x03, 0x15, 0x83, 0x00, 0x07, 0x13, 0x0C,
+    0x02, 0x02, 0x07, 0x01, 0x01, 0x11, 0x84, 0x00, 0x06, 0x0D, 0x00, 0x1A, 0x0C, 0x02, 0x01, 0x3F,
+    0xB2, 0x00, 0xB5, 0x00, 0x01, 0x45, 0x39, 0x86, 0x00, 0x02, 0x08, 0x37, 0x20, 0x88, 0x00, 0x07,
+    0x08, 0x00, 0x15, 0x03, 0x02, 0x01, 0x01, 0x30, 0x8F, 0x00, 0x13, 0x17, 0x24, 0x00, 0x36, 0x0C,
+    0x1D, 0x03, 0x10, 0x0D, 0x1C, 0x28, 0x17, 0x00, 0x00, 0x10, 0x01, 0x07, 0x01, 0x01, 0x1D, 0x88,
+    0x01, 0x02, 0x07, 0x01, 0x02, 0x87, 0x01, 0x04, 0x1D, 0x03, 0x3A, 0x13, 0x4E, 0x81, 0x02, 0x83,
+    0x01, 0x80, 0x03, 0x83, 0x01, 0x01, 0x02, 0x07, 0x83, 0x01, 0x03, 0x02, 0x01, 0x43, 0x0E, 0x83,
+    0x00, 0x06, 0x14, 0x18, 0x02, 0x07, 0x02, 0x03, 0x33, 0x87, 0x00, 0x04, 0x37, 0x03, 0x02, 0x01,
+    0x30, 0xB2, 0x00, 0xB5, 0x00, 0x01, 0x15, 0x38, 0x87, 0x00, 0x02, 0x08, 0x19, 0x3A, 0x83, 0x00,
+    0x03, 0x08, 0x38, 0x00, 0x08, 0x82, 0x00, 0x05, 0x24, 0x03, 0x02, 0x07, 0x43, 0x08, 0x85, 0x00,
+    0x80, 0x08, 0x88, 0x00, 0x0D, 0x19, 0x0D, 0x1B, 0x0C, 0x12, 0x07, 0x14, 0x31, 0x03, 0x01, 0x30,
+    0x00, 0x08, 0x35, 0x83, 0x01, 0x01, 0x02, 0x07, 0x87, 0x01, 0x80, 0x02, 0x81, 0x01, 0x81, 0x02,
+    0x83, 0x01, 0x1A, 0x02, 0x01, 0x12, 0x0C, 0x19, 0x10, 0x02, 0x07, 0x01, 0x07, 0x01, 0x02, 0x01,
+    0x01, 0x02, 0x1D, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x1D, 0x02, 0x02, 0x03, 0x13, 0x83, 0x00,
+    0x07, 0x0E, 0x43, 0x01, 0x09, 0x01, 0x12, 0x25, 0x39, 0x87, 0x00, 0x04, 0x20, 0x02, 0x02, 0x25,
+    0x17, 0xB2, 0x00, 0xB5, 0x00, 0x01, 0x13, 0x15, 0x88, 0x00, 0x02, 0x20, 0x35, 0x11, 0x82, 0x00,
+    0x01, 0x20, 0x4F, 0x84, 0x00, 0x05, 0x3F, 0x01, 0x01, 0x12, 0x25, 0x4F, 0x85, 0x00, 0x80, 0x20,
+    0x86, 0x00, 0x11, 0x11, 0x00, 0x39, 0x3F, 0x1C, 0x03, 0x09, 0x02, 0x01, 0x07, 0x18, 0x0F, 0x00,
+    0x00, 0x15, 0x03, 0x01, 0x09, 0x82, 0x01, 0x80, 0x09, 0x87, 0x01, 0x02, 0x03, 0x14, 0x1C, 0x83,
+    0x01, 0x0D, 0x02, 0x07, 0x01, 0x01, 0x09, 0x1D, 0x28, 0x0F, 0x10, 0x03, 0x02, 0x02, 0x01, 0x09,
+    0x81, 0x02, 0x83, 0x01, 0x08, 0x09, 0x07, 0x02, 0x01, 0x02, 0x01, 0x01, 0x18, 0x45, 0x83, 0x00,
+    0x0A, 0x45, 0x01, 0x02, 0x01, 0x01, 0x28, 0x1A, 0x00, 0x00, 0x11, 0x08, 0x85, 0x00, 0x03, 0x10,
+    0x07, 0x0C, 0x1B, 0xB2, 0x00, 0xB5, 0x00, 0x01, 0x1B, 0x13, 0x89, 0x00, 0x01, 0x13, 0x0F, 0x82,
+    0x00, 0x02, 0x0E, 0x0F, 0x0E, 0x84, 0x00, 0x05, 0x1A, 0x0C, 0x02, 0x12, 0x07, 0x30, 0x84, 0x00,
+    0x80, 0x38, 0x85, 0x00, 0x05, 0x37, 0x13, 0x00, 0x00, 0x0E, 0x12, 0x82, 0x01, 0x0C, 0x02, 0x01,
+    0x1D, 0x30, 0x00, 0x20, 0x0F, 0x18, 0x01, 0x01, 0x02, 0x01, 0x07, 0x88, 0x01, 0x04, 0x03, 0x10,
+    0x1A, 0x03, 0x02, 0x83, 0x01, 0x11, 0x09, 0x02, 0x02, 0x18, 0x02, 0x30, 0x33, 0x18, 0x02, 0x1D,
+    0x01, 0x01, 0x07, 0x01, 0x01, 0x09, 0x07, 0x02, 0x84, 0x01, 0x03, 0x09, 0x01, 0x43, 0x08, 0x83,
+    0x00, 0x05, 0x38, 0x25, 0x12, 0x09, 0x25, 0x1A, 0x82, 0x00, 0x01, 0x13, 0x08, 0x85, 0x00, 0x03,
+    0x36, 0x03, 0x03, 0x19, 0xB2, 0x00, 0xB5, 0x00, 0x01, 0x1B, 0x14, 0x89, 0x00, 0x07, 0x45, 0x4E,
+    0x37, 0x00, 0x00, 0x08, 0x01, 0x1A, 0x84, 0x00, 0x05, 0x08, 0x12, 0x02, 0x09, 0x03, 0x10, 0x84,
+    0x00, 0x01, 0x1A, 0x0E, 0x84, 0x00, 0x13, 0x14, 0x1A, 0x00, 0x00, 0x11, 0x07, 0x02, 0x02, 0x01,
+    0x01, 0x03, 0x43, 0x38, 0x15, 0x0F, 0x03, 0x01, 0x02, 0x07, 0x02, 0x8A, 0x01, 0x03, 0x03, 0x10,
+    0x17, 0x0C, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x05, 0x0C, 0x14, 0x08, 0x20, 0x01, 0x09, 0x88,
+    0x01, 0x08, 0x35, 0x14, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x0F, 0x84, 0x00, 0x04, 0x31, 0x03,
+    0x01, 0x09, 0x37, 0x82, 0x00, 0x01, 0x32, 0x19, 0x86, 0x00, 0x03, 0x11, 0x01, 0x01, 0x24, 0xB2,
+    0x00, 0xB5, 0x00, 0x02, 0x17, 0x03, 0x11, 0x84, 0x00, 0x80, 0x0D, 0x82, 0x00, 0x02, 0x08, 0x12,
+    0x0F, 0x82, 0x00, 0x02, 0x14, 0x02, 0x0E, 0x84, 0x00, 0x05, 0x13, 0x03, 0x01, 0x07, 0x18, 0x39,
+    0x83, 0x00, 0x01, 0x13, 0x38, 0x83, 0x00, 0x08, 0x51, 0x28, 0x13, 0x00, 0x00, 0x30, 0x18, 0x01,
+    0x02, 0x83, 0x01, 0x81, 0x03, 0x03, 0x01, 0x02, 0x01, 0x07, 0x82, 0x01, 0x80, 0x09, 0x88, 0x01,
+    0x16, 0x0C, 0x36, 0x1A, 0x28, 0x01, 0x02, 0x01, 0x01, 0x18, 0x03, 0x01, 0x17, 0x0E, 0x17, 0x15,
+    0x02, 0x01, 0x02, 0x01, 0x01, 0x07, 0x07, 0x09, 0x82, 0x01, 0x09, 0x0F, 0x37, 0x01, 0x09, 0x01,
+    0x01, 0x02, 0x01, 0x35, 0x08, 0x83, 0x00, 0x03, 0x17, 0x0C, 0x12, 0x30, 0x83, 0x00, 0x03, 0x10,
+    0x17, 0x00, 0x0D, 0x84, 0x00, 0x03, 0x08, 0x35, 0x25, 0x19, 0xB2, 0x00, 0xB5, 0x00, 0x02, 0x51,
+    0x28, 0x4F, 0x89, 0x00, 0x07, 0x33, 0x28, 0x15, 0x00, 0x00, 0x10, 0x4E, 0x19, 0x84, 0x00, 0x05,
+    0x38, 0x03, 0x02, 0x02, 0x03, 0x1B, 0x83, 0x00, 0x01, 0x17, 0x13, 0x83, 0x00, 0x06, 0x19, 0x4E,
+    0x1B, 0x00, 0x00, 0x15, 0x0C, 0x83, 0x01, 0x0C, 0x02, 0x01, 0x01, 0x12, 0x01, 0x01, 0x09, 0x01,
+    0x01, 0x02, 0x07, 0x01, 0x09, 0x86, 0x01, 0x11, 0x07, 0x0F, 0x00, 0x19, 0x03, 0x01, 0x02, 0x01,
+    0x01, 0x1B, 0x1C, 0x11, 0x11, 0x12, 0x14, 0x15, 0x03, 0x02, 0x82, 0x01, 0x0A, 0x02, 0x01, 0x01,
+    0x02, 0x1D, 0x03, 0x10, 0x00, 0x35, 0x03, 0x02, 0x82, 0x01, 0x01, 0x02, 0x3F, 0x83, 0x00, 0x02,
+    0x47, 0x28, 0x32, 0x83, 0x00, 0x02, 0x08, 0x18, 0x31, 0x87, 0x00, 0x02, 0x1C, 0x0C, 0x4F, 0xB2,
+    0x00, 0xB5, 0x00, 0x03, 0x08, 0x12, 0x25, 0x39, 0x88, 0x00, 0x08, 0x1B, 0x4E, 0x14, 0x00, 0x00,
+    0x17, 0x03, 0x03, 0x17, 0x83, 0x00, 0x06, 0x08, 0x09, 0x02, 0x07, 0x01, 0x0F, 0x08, 0x82, 0x00,
+    0x01, 0x38, 0x0F, 0x82, 0x00, 0x07, 0x0E, 0x02, 0x03, 0x10, 0x00, 0x00, 0x15, 0x03, 0x88, 0x01,
+    0x1F, 0x07, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x09, 0x01, 0x09, 0x01, 0x01, 0x07, 0x12, 0x25,
+    0x12, 0x11, 0x00, 0x33, 0x03, 0x12, 0x07, 0x02, 0x37, 0x00, 0x00, 0x17, 0x03, 0x25, 0x1A, 0x1A,
+    0x0C, 0x82, 0x01, 0x01, 0x09, 0x1D, 0x82, 0x01, 0x0B, 0x02, 0x0C, 0x36, 0x00, 0x24, 0x03, 0x02,
+    0x09, 0x01, 0x01, 0x03, 0x31, 0x83, 0x00, 0x02, 0x43, 0x4F, 0x0D, 0x83, 0x00, 0x02, 0x38, 0x4E,
+    0x36, 0x87, 0x00, 0x02, 0x10, 0x28, 0x13, 0xB2, 0x00, 0xB6, 0x00, 0x02, 0x47, 0x0C, 0x14, 0x88,
+    0x00, 0x09, 0x17, 0x03, 0x56, 0x38, 0x00, 0x0E, 0x02, 0x01, 0x01, 0x39, 0x83, 0x00, 0x05, 0x33,
+    0x01, 0x01, 0x02, 0x01, 0x45, 0x82, 0x00, 0x36, 0x3F, 0x01, 0x11, 0x00, 0x00, 0x38, 0x0C, 0x07,
+    0x0F, 0x08, 0x00, 0x15, 0x0C, 0x02, 0x01, 0x07, 0x02, 0x01, 0x02, 0x01, 0x09, 0x1D, 0x09, 0x01,
+    0x01, 0x09, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x12, 0x01, 0x0C, 0x1C, 0x08, 0x0E, 0x15,
+    0x1C, 0x01, 0x03, 0x0F, 0x45, 0x00, 0x20, 0x10, 0x03, 0x02, 0x0C, 0x31, 0x19, 0x18, 0x02, 0x83,
+    0x01, 0x0E, 0x02, 0x01, 0x02, 0x01, 0x35, 0x0E, 0x00, 0x36, 0x03, 0x01, 0x01, 0x07, 0x02, 0x07,
+    0x10, 0x82, 0x00, 0x02, 0x37, 0x03, 0x11, 0x84, 0x00, 0x02, 0x13, 0x28, 0x13, 0x87, 0x00, 0x02,
+    0x1C, 0x4E, 0x31, 0xB2, 0x00, 0xB6, 0x00, 0x03, 0x51, 0x01, 0x0C, 0x17, 0x87, 0x00, 0x0A, 0x30,
+    0x03, 0x01, 0x0F, 0x08, 0x00, 0x19, 0x03, 0x01, 0x14, 0x08, 0x82, 0x00, 0x05, 0x1B, 0x03, 0x02,
+    0x02, 0x03, 0x31, 0x83, 0x00, 0x34, 0x43, 0x1A, 0x00, 0x00, 0x1A, 0x03, 0x02, 0x07, 0x3A, 0x00,
+    0x15, 0x0C, 0x02, 0x01, 0x02, 0x12, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x07, 0x01,
+    0x02, 0x01, 0x09, 0x02, 0x01, 0x07, 0x01, 0x03, 0x1B, 0x00, 0x00, 0x1C, 0x1A, 0x14, 0x03, 0x33,
+    0x08, 0x00, 0x36, 0x02, 0x03, 0x09, 0x12, 0x01, 0x32, 0x33, 0x25, 0x82, 0x01, 0x0A, 0x1D, 0x01,
+    0x01, 0x09, 0x01, 0x0C, 0x15, 0x00, 0x00, 0x30, 0x18, 0x85, 0x01, 0x04, 0x11, 0x00, 0x0E, 0x12,
+    0x0F, 0x85, 0x00, 0x04, 0x10, 0x0C, 0x14, 0x00, 0x08, 0x84, 0x00, 0x03, 0x08, 0x35, 0x18, 0x11,
+    0xB2, 0x00, 0xB6, 0x00, 0x04, 0x08, 0x10, 0x0C, 0x35, 0x08, 0x86, 0x00, 0x0A, 0x11, 0x03, 0x02,
+    0x03, 0x47, 0x00, 0x30, 0x01, 0x02, 0x03, 0x1A, 0x82, 0x00, 0x1D, 0x15, 0x25, 0x02, 0x02, 0x0C,
+    0x13, 0x00, 0x00, 0x08, 0x00, 0x10, 0x0F, 0x20, 0x00, 0x24, 0x03, 0x12, 0x25, 0x13, 0x00, 0x39,
+    0x03, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x07, 0x02, 0x82, 0x01, 0x1F, 0x02, 0x12, 0x02, 0x07,
+    0x02, 0x01, 0x01, 0x02, 0x07, 0x01, 0x15, 0x00, 0x11, 0x14, 0x03, 0x37, 0x43, 0x09, 0x0E, 0x0D,
+    0x24, 0x03, 0x01, 0x07, 0x01, 0x01, 0x09, 0x38, 0x35, 0x03, 0x01, 0x02, 0x83, 0x01, 0x02, 0x02,
+    0x03, 0x24, 0x82, 0x00, 0x0C, 0x0E, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x17, 0x00, 0x19,
+    0x4E, 0x10, 0x85, 0x00, 0x03, 0x0F, 0x01, 0x03, 0x38, 0x85, 0x00, 0x02, 0x20, 0x01, 0x14, 0xB3,
+    0x00, 0xB7, 0x00, 0x03, 0x39, 0x01, 0x0C, 0x15, 0x86, 0x00, 0x0E, 0x11, 0x01, 0x09, 0x02, 0x0C,
+    0x19, 0x0E, 0x43, 0x01, 0x01, 0x43, 0x08, 0x00, 0x00, 0x11, 0x82, 0x01, 0x01, 0x03, 0x47, 0x83,
+    0x00, 0x0E, 0x36, 0x03, 0x17, 0x38, 0x10, 0x03, 0x01, 0x03, 0x0F, 0x00, 0x0E, 0x02, 0x09, 0x02,
+    0x07, 0x82, 0x01, 0x10, 0x09, 0x07, 0x12, 0x01, 0x09, 0x03, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x43, 0x11, 0x00, 0x1A, 0x82, 0x01, 0x0C, 0x38, 0x12, 0x17, 0x00, 0x14, 0x03, 0x02, 0x01,
+    0x01, 0x09, 0x18, 0x0F, 0x38, 0x82, 0x01, 0x07, 0x02, 0x1D, 0x01, 0x02, 0x02, 0x07, 0x43, 0x0E,
+    0x82, 0x00, 0x16, 0x08, 0x0F, 0x03, 0x09, 0x01, 0x07, 0x02, 0x0C, 0x19, 0x00, 0x12, 0x25, 0x1C,
+    0x00, 0x00, 0x08, 0x51, 0x00, 0x08, 0x35, 0x07, 0x07, 0x1C, 0x85, 0x00, 0x02, 0x30, 0x28, 0x36,
+    0xB3, 0x00, 0xB8, 0x00, 0x02, 0x13, 0x28, 0x10, 0x86, 0x00, 0x13, 0x0E, 0x12, 0x01, 0x01, 0x02,
+    0x18, 0x0F, 0x12, 0x09, 0x01, 0x0C, 0x36, 0x00, 0x00, 0x08, 0x0F, 0x03, 0x02, 0x03, 0x10, 0x83,
+    0x00, 0x05, 0x51, 0x03, 0x19, 0x10, 0x1D, 0x09, 0x82, 0x01, 0x0F, 0x15, 0x00, 0x14, 0x01, 0x02,
+    0x01, 0x02, 0x12, 0x07, 0x10, 0x10, 0x03, 0x02, 0x01, 0x0F, 0x02, 0x83, 0x01, 0x1F, 0x07, 0x12,
+    0x0E, 0x08, 0x14, 0x0C, 0x01, 0x02, 0x01, 0x15, 0x10, 0x0E, 0x47, 0x03, 0x02, 0x01, 0x01, 0x09,
+    0x02, 0x03, 0x19, 0x37, 0x4E, 0x02, 0x01, 0x07, 0x01, 0x07, 0x01, 0x12, 0x03, 0x1A, 0x84, 0x00,
+    0x80, 0x10, 0x82, 0x01, 0x12, 0x02, 0x09, 0x03, 0x14, 0x30, 0x07, 0x18, 0x14, 0x00, 0x00, 0x11,
+    0x47, 0x00, 0x08, 0x35, 0x01, 0x02, 0x25, 0x37, 0x84, 0x00, 0x01, 0x1B, 0x02, 0xB4, 0x00, 0xB8,
+    0x00, 0x03, 0x08, 0x14, 0x01, 0x20, 0x85, 0x00, 0x0B, 0x08, 0x35, 0x07, 0x02, 0x01, 0x01, 0x02,
+    0x03, 0x35, 0x10, 0x03, 0x1C, 0x82, 0x00, 0x04, 0x13, 0x03, 0x02, 0x07, 0x10, 0x83, 0x00, 0x19,
+    0x08, 0x01, 0x14, 0x24, 0x0C, 0x1D, 0x01, 0x01, 0x09, 0x35, 0x00, 0x17, 0x0C, 0x01, 0x02, 0x01,
+    0x02, 0x03, 0x13, 0x0E, 0x01, 0x01, 0x18, 0x14, 0x15, 0x18, 0x82, 0x01, 0x16, 0x03, 0x38, 0x00,
+    0x0F, 0x03, 0x02, 0x01, 0x12, 0x03, 0x13, 0x38, 0x37, 0x03, 0x09, 0x02, 0x01, 0x01, 0x1D, 0x02,
+    0x07, 0x15, 0x1A, 0x03, 0x82, 0x01, 0x21, 0x09, 0x01, 0x07, 0x01, 0x03, 0x37, 0x08, 0x13, 0x33,
+    0x13, 0x00, 0x1B, 0x0C, 0x02, 0x02, 0x01, 0x12, 0x15, 0x14, 0x37, 0x01, 0x07, 0x43, 0x0E, 0x00,
+    0x3A, 0x01, 0x11, 0x00, 0x0F, 0x18, 0x02, 0x18, 0x10, 0x83, 0x00, 0x02, 0x08, 0x35, 0x38, 0xB4,
+    0x00, 0xB9, 0x00, 0x02, 0x39, 0x03, 0x38, 0x83, 0x00, 0x03, 0x0D, 0x00, 0x00, 0x14, 0x81, 0x09,
+    0x82, 0x01, 0x08, 0x02, 0x01, 0x45, 0x24, 0x25, 0x45, 0x00, 0x00, 0x11, 0x82, 0x01, 0x80, 0x33,
+    0x84, 0x00, 0x03, 0x33, 0x03, 0x19, 0x02, 0x82, 0x01, 0x25, 0x02, 0x03, 0x1B, 0x08, 0x02, 0x01,
+    0x02, 0x09, 0x02, 0x03, 0x1B, 0x00, 0x31, 0x25, 0x01, 0x07, 0x0E, 0x1A, 0x03, 0x09, 0x1D, 0x43,
+    0x00, 0x4F, 0x0C, 0x02, 0x1D, 0x01, 0x02, 0x03, 0x1B, 0x00, 0x14, 0x01, 0x02, 0x01, 0x01, 0x09,
+    0x82, 0x01, 0x28, 0x20, 0x10, 0x25, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x4F, 0x33,
+    0x4E, 0x01, 0x28, 0x36, 0x17, 0x0C, 0x01, 0x09, 0x09, 0x03, 0x24, 0x38, 0x39, 0x10, 0x07, 0x01,
+    0x37, 0x00, 0x51, 0x4E, 0x24, 0x00, 0x24, 0x25, 0x02, 0x03, 0x0F, 0x08, 0x82, 0x00, 0x01, 0x17,
+    0x1A, 0xB5, 0x00, 0xBA, 0x00, 0x01, 0x47, 0x1B, 0x86, 0x00, 0x0B, 0x1B, 0x0C, 0x02, 0x01, 0x01,
+    0x09, 0x01, 0x03, 0x17, 0x08, 0x03, 0x13, 0x82, 0x00, 0x03, 0x10, 0x07, 0x03, 0x10, 0x84, 0x00,
+    0x20, 0x13, 0x0C, 0x35, 0x02, 0x01, 0x02, 0x01, 0x01, 0x1D, 0x01, 0x38, 0x32, 0x0C, 0x02, 0x02,
+    0x01, 0x0C, 0x1B, 0x00, 0x00, 0x37, 0x01, 0x03, 0x30, 0x00, 0x0F, 0x03, 0x01, 0x10, 0x20, 0x02,
+    0x01, 0x07, 0x82, 0x01, 0x17, 0x0C, 0x4F, 0x39, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x0C,
+    0x19, 0x0E, 0x01, 0x01, 0x02, 0x09, 0x02, 0x07, 0x01, 0x09, 0x07, 0x01, 0x07, 0x82, 0x01, 0x03,
+    0x02, 0x35, 0x43, 0x12, 0x82, 0x01, 0x16, 0x02, 0x03, 0x1B, 0x00, 0x31, 0x03, 0x03, 0x24, 0x00,
+    0x30, 0x01, 0x03, 0x37, 0x1A, 0x0C, 0x02, 0x09, 0x02, 0x0E, 0x00, 0x00, 0x3F, 0x31, 0xB6, 0x00,
+    0xBA, 0x00, 0x01, 0x45, 0x13, 0x86, 0x00, 0x02, 0x11, 0x02, 0x03, 0x82, 0x01, 0x05, 0x02, 0x03,
+    0x24, 0x00, 0x17, 0x0F, 0x82, 0x00, 0x03, 0x30, 0x07, 0x18, 0x10, 0x84, 0x00, 0x11, 0x38, 0x03,
+    0x02, 0x07, 0x01, 0x18, 0x01, 0x01, 0x09, 0x01, 0x09, 0x11, 0x13, 0x0C, 0x09, 0x01, 0x03, 0x19,
+    0x82, 0x00, 0x0B, 0x3A, 0x07, 0x17, 0x00, 0x32, 0x03, 0x25, 0x47, 0x15, 0x03, 0x01, 0x07, 0x82,
+    0x01, 0x03, 0x03, 0x24, 0x1B, 0x03, 0x84, 0x01, 0x10, 0x02, 0x03, 0x3A, 0x36, 0x0C, 0x02, 0x01,
+    0x18, 0x25, 0x43, 0x01, 0x01, 0x02, 0x01, 0x01, 0x07, 0x02, 0x82, 0x01, 0x81, 0x09, 0x19, 0x01,
+    0x1D, 0x09, 0x01, 0x07, 0x12, 0x08, 0x0E, 0x02, 0x09, 0x02, 0x0E, 0x0E, 0x02, 0x01, 0x43, 0x0F,
+    0x01, 0x01, 0x07, 0x12, 0x0E, 0x00, 0x00, 0x0E, 0x08, 0xB6, 0x00, 0xBB, 0x00, 0x80, 0x3A, 0x87,
+    0x00, 0x11, 0x32, 0x03, 0x1C, 0x1D, 0x01, 0x02, 0x01, 0x10, 0x00, 0x00, 0x10, 0x51, 0x00, 0x08,
+    0x00, 0x10, 0x28, 0x24, 0x84, 0x00, 0x11, 0x08, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x1D, 0x07,
+    0x02, 0x01, 0x12, 0x20, 0x19, 0x4E, 0x02, 0x07, 0x1C, 0x83, 0x00, 0x08, 0x37, 0x1A, 0x17, 0x20,
+    0x10, 0x28, 0x13, 0x47, 0x0C, 0x83, 0x01, 0x04, 0x02, 0x01, 0x14, 0x0F, 0x18, 0x84, 0x01, 0x09,
+    0x18, 0x1C, 0x00, 0x14, 0x01, 0x02, 0x0F, 0x02, 0x15, 0x17, 0x90, 0x01, 0x0F, 0x03, 0x32, 0x00,
+    0x0F, 0x01, 0x03, 0x30, 0x00, 0x10, 0x03, 0x02, 0x01, 0x09, 0x02, 0x09, 0x0F, 0xBB, 0x00, 0xC5,
+    0x00, 0x0A, 0x17, 0x13, 0x13, 0x0C, 0x02, 0x51, 0x37, 0x00, 0x00, 0x3F, 0x1A, 0x82, 0x00, 0x02,
+    0x30, 0x28, 0x1B, 0x85, 0x00, 0x11, 0x1C, 0x01, 0x07, 0x07, 0x09, 0x01, 0x01, 0x02, 0x01, 0x09,
+    0x03, 0x35, 0x39, 0x1C, 0x07, 0x01, 0x01, 0x39, 0x82, 0x00, 0x81, 0x08, 0x07, 0x24, 0x19, 0x37,
+    0x28, 0x1A, 0x14, 0x18, 0x09, 0x82, 0x01, 0x1B, 0x02, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x01,
+    0x01, 0x02, 0x0C, 0x38, 0x32, 0x03, 0x03, 0x13, 0x0E, 0x11, 0x17, 0x01, 0x02, 0x01, 0x01, 0x07,
+    0x09, 0x02, 0x09, 0x01, 0x83, 0x02, 0x17, 0x07, 0x1D, 0x01, 0x01, 0x07, 0x03, 0x1B, 0x00, 0x14,
+    0x01, 0x03, 0x15, 0x00, 0x32, 0x03, 0x02, 0x01, 0x02, 0x01, 0x03, 0x19, 0x00, 0x00, 0x0D, 0xB8,
+    0x00, 0xC5, 0x00, 0x04, 0x08, 0x17, 0x0E, 0x03, 0x10, 0x83, 0x00, 0x20, 0x08, 0x51, 0x08, 0x2B,
+    0x26, 0x00, 0x0F, 0x19, 0x00, 0x29, 0x40, 0x49, 0x2A, 0x00, 0x13, 0x03, 0x02, 0x07, 0x09, 0x01,
+    0x02, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x13, 0x12, 0x01, 0x18, 0x0F, 0x3F, 0x83, 0x00, 0x05,
+    0x13, 0x28, 0x31, 0x0F, 0x19, 0x02, 0x89, 0x01, 0x0D, 0x07, 0x01, 0x02, 0x01, 0x01, 0x14, 0x08,
+    0x14, 0x28, 0x33, 0x00, 0x0E, 0x10, 0x4E, 0x82, 0x02, 0x02, 0x1D, 0x09, 0x02, 0x87, 0x01, 0x13,
+    0x07, 0x01, 0x01, 0x02, 0x03, 0x10, 0x00, 0x1C, 0x01, 0x0C, 0x31, 0x00, 0x00, 0x24, 0x03, 0x02,
+    0x1D, 0x09, 0x03, 0x32, 0xBB, 0x00, 0xBF, 0x00, 0x80, 0x0E, 0x85, 0x00, 0x03, 0x08, 0x00, 0x10,
+    0x36, 0x82, 0x00, 0x1D, 0x26, 0x2C, 0x3B, 0x00, 0x1F, 0x05, 0x21, 0x31, 0x4F, 0x3B, 0x2F, 0x0B,
+    0x0B, 0x2F, 0x29, 0x45, 0x18, 0x1D, 0x01, 0x02, 0x07, 0x09, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x01, 0x12, 0x82, 0x01, 0x01, 0x02, 0x32, 0x82, 0x00, 0x01, 0x1B, 0x0C, 0x82, 0x0F, 0x19, 0x01,
+    0x02, 0x01, 0x02, 0x07, 0x02, 0x01, 0x01, 0x02, 0x07, 0x09, 0x07, 0x01, 0x02, 0x01, 0x0C, 0x36,
+    0x17, 0x28, 0x0F, 0x08, 0x11, 0x43, 0x25, 0x12, 0x07, 0x88, 0x01, 0x03, 0x09, 0x01, 0x01, 0x02,
+    0x82, 0x01, 0x0F, 0x02, 0x01, 0x14, 0x00, 0x10, 0x25, 0x03, 0x15, 0x00, 0x00, 0x3A, 0x07, 0x02,
+    0x12, 0x25, 0x1C, 0xBC, 0x00, 0xB2, 0x00, 0x80, 0x08, 0x8B, 0x00, 0x01, 0x36, 0x37, 0x86, 0x00,
+    0x1F, 0x31, 0x3F, 0x00, 0x00, 0x2B, 0x0B, 0x0B, 0x27, 0x21, 0x2D, 0x0B, 0x2B, 0x20, 0x31, 0x2A,
+    0x0B, 0x1E, 0x0A, 0x0B, 0x2D, 0x00, 0x0F, 0x09, 0x01, 0x1D, 0x02, 0x01, 0x01, 0x02, 0x09, 0x01,
+    0x09, 0x84, 0x01, 0x44, 0x1D, 0x01, 0x03, 0x17, 0x00, 0x00, 0x33, 0x01, 0x09, 0x01, 0x01, 0x09,
+    0x01, 0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x02, 0x01, 0x01, 0x07, 0x02, 0x12, 0x01, 0x43, 0x20,
+    0x12, 0x01, 0x20, 0x08, 0x35, 0x03, 0x12, 0x01, 0x01, 0x02, 0x02, 0x09, 0x07, 0x02, 0x07, 0x02,
+    0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x09, 0x01, 0x07, 0x01, 0x02, 0x00, 0x1B, 0x03, 0x01,
+    0x32, 0x00, 0x00, 0x32, 0x0C, 0x01, 0x01, 0x0C, 0x32, 0xBC, 0x00, 0xB1, 0x00, 0x02, 0x0E, 0x45,
+    0x0D, 0x8A, 0x00, 0x02, 0x08, 0x14, 0x0E, 0x89, 0x00, 0x17, 0x2C, 0x2F, 0x52, 0x16, 0x34, 0x1F,
+    0x16, 0x34, 0x21, 0x20, 0x22, 0x0B, 0x27, 0x0A, 0x16, 0x34, 0x0D, 0x4F, 0x0C, 0x01, 0x09, 0x01,
+    0x43, 0x02, 0x83, 0x01, 0x80, 0x07, 0x82, 0x01, 0x32, 0x02, 0x01, 0x02, 0x01, 0x03, 0x32, 0x00,
+    0x0F, 0x07, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x07, 0x09, 0x01, 0x07,
+    0x1D, 0x01, 0x1D, 0x0C, 0x13, 0x36, 0x4E, 0x39, 0x00, 0x24, 0x01, 0x02, 0x07, 0x02, 0x01, 0x01,
+    0x07, 0x02, 0x02, 0x01, 0x01, 0x02, 0x07, 0x07, 0x02, 0x01, 0x03, 0x0C, 0x81, 0x03, 0x83, 0x01,
+    0x0B, 0x08, 0x13, 0x0C, 0x02, 0x45, 0x00, 0x00, 0x19, 0x01, 0x02, 0x07, 0x24, 0x8A, 0x00, 0x80,
+    0x0D, 0xB1, 0x00, 0xB1, 0x00, 0x01, 0x11, 0x31, 0x8C, 0x00, 0x01, 0x10, 0x1B, 0x86, 0x00, 0x04,
+    0x0D, 0x00, 0x46, 0x55, 0x0A, 0x82, 0x05, 0x26, 0x16, 0x27, 0x0B, 0x40, 0x00, 0x1F, 0x0B, 0x27,
+    0x05, 0x0A, 0x2F, 0x46, 0x51, 0x0C, 0x01, 0x02, 0x03, 0x1B, 0x0F, 0x01, 0x01, 0x0F, 0x19, 0x07,
+    0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x10, 0x08, 0x12, 0x1D, 0x02, 0x09, 0x02, 0x83,
+    0x01, 0x80, 0x09, 0x81, 0x01, 0x82, 0x02, 0x80, 0x07, 0x83, 0x01, 0x06, 0x39, 0x0F, 0x13, 0x00,
+    0x1A, 0x03, 0x01, 0x81, 0x02, 0x82, 0x01, 0x02, 0x02, 0x01, 0x09, 0x82, 0x01, 0x17, 0x07, 0x01,
+    0x0C, 0x02, 0x19, 0x13, 0x1B, 0x43, 0x03, 0x01, 0x02, 0x03, 0x0E, 0x13, 0x0C, 0x0F, 0x08, 0x00,
+    0x08, 0x0F, 0x03, 0x01, 0x01, 0x11, 0xBD, 0x00, 0xB1, 0x00, 0x01, 0x39, 0x47, 0x8C, 0x00, 0x01,
+    0x13, 0x02, 0x87, 0x00, 0x19, 0x3C, 0x27, 0x05, 0x05, 0x27, 0x05, 0x0A, 0x05, 0x05, 0x4B, 0x2C,
+    0x2B, 0x16, 0x0A, 0x05, 0x0A, 0x05, 0x0B, 0x22, 0x20, 0x07, 0x07, 0x02, 0x01, 0x17, 0x02, 0x82,
+    0x01, 0x06, 0x30, 0x10, 0x03, 0x02, 0x01, 0x01, 0x09, 0x82, 0x01, 0x03, 0x43, 0x0E, 0x35, 0x07,
+    0x82, 0x01, 0x24, 0x09, 0x01, 0x02, 0x01, 0x07, 0x18, 0x0F, 0x31, 0x01, 0x01, 0x02, 0x02, 0x01,
+    0x03, 0x33, 0x39, 0x24, 0x00, 0x15, 0x01, 0x01, 0x02, 0x09, 0x07, 0x01, 0x09, 0x01, 0x09, 0x07,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x07, 0x13, 0x08, 0x82, 0x00, 0x13, 0x0D, 0x1B, 0x03, 0x01, 0x07,
+    0x45, 0x36, 0x28, 0x10, 0x00, 0x00, 0x15, 0x0C, 0x12, 0x07, 0x1A, 0x00, 0x00, 0x0E, 0x08, 0xBA,
+    0x00, 0xB1, 0x00, 0x01, 0x51, 0x0F, 0x8C, 0x00, 0x02, 0x36, 0x28, 0x39, 0x85, 0x00, 0x19, 0x3C,
+    0x34, 0x0B, 0x52, 0x0A, 0x0A, 0x1E, 0x05, 0x52, 0x0A, 0x05, 0x16, 0x0B, 0x05, 0x16, 0x05, 0x05,
+    0x27, 0x16, 0x1F, 0x08, 0x35, 0x01, 0x01, 0x0F, 0x38, 0x82, 0x01, 0x05, 0x0C, 0x38, 0x15, 0x03,
+    0x02, 0x1D, 0x84, 0x01, 0x02, 0x09, 0x38, 0x14, 0x83, 0x01, 0x08, 0x02, 0x07, 0x01, 0x01, 0x02,
+    0x03, 0x15, 0x19, 0x0C, 0x82, 0x01, 0x06, 0x02, 0x03, 0x13, 0x00, 0x00, 0x11, 0x09, 0x82, 0x01,
+    0x0C, 0x1D, 0x01, 0x01, 0x07, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x0F, 0x45, 0x86, 0x00,
+    0x10, 0x24, 0x03, 0x0C, 0x36, 0x45, 0x28, 0x19, 0x00, 0x00, 0x10, 0x18, 0x07, 0x35, 0x08, 0x00,
+    0x11, 0x13, 0xBB, 0x00, 0xB1, 0x00, 0x02, 0x0E, 0x18, 0x37, 0x8B, 0x00, 0x02, 0x37, 0x28, 0x17,
+    0x84, 0x00, 0x05, 0x40, 0x16, 0x05, 0x52, 0x05, 0x4B, 0x83, 0x0B, 0x22, 0x05, 0x4B, 0x1E, 0x1E,
+    0x0A, 0x27, 0x0A, 0x05, 0x0A, 0x4B, 0x1F, 0x08, 0x35, 0x01, 0x03, 0x1C, 0x30, 0x18, 0x01, 0x02,
+    0x03, 0x51, 0x32, 0x0C, 0x02, 0x1D, 0x01, 0x07, 0x01, 0x01, 0x07, 0x01, 0x24, 0x35, 0x09, 0x82,
+    0x01, 0x16, 0x07, 0x01, 0x01, 0x02, 0x0C, 0x10, 0x45, 0x18, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01,
+    0x38, 0x00, 0x00, 0x10, 0x03, 0x02, 0x01, 0x01, 0x02, 0x82, 0x01, 0x80, 0x02, 0x82, 0x01, 0x03,
+    0x02, 0x0C, 0x33, 0x08, 0x87, 0x00, 0x10, 0x3F, 0x12, 0x0C, 0x13, 0x0E, 0x28, 0x13, 0x00, 0x3F,
+    0x01, 0x02, 0x03, 0x37, 0x00, 0x08, 0x35, 0x17, 0xBB, 0x00, 0xB2, 0x00, 0x02, 0x1A, 0x09, 0x0E,
+    0x8A, 0x00, 0x02, 0x15, 0x4E, 0x24, 0x84, 0x00, 0x0D, 0x2C, 0x0B, 0x0A, 0x0B, 0x05, 0x2C, 0x2B,
+    0x2A, 0x2D, 0x2C, 0x34, 0x1E, 0x16, 0x0B, 0x82, 0x2F, 0x18, 0x0B, 0x05, 0x4B, 0x2C, 0x0E, 0x02,
+    0x02, 0x03, 0x24, 0x3A, 0x03, 0x02, 0x01, 0x01, 0x08, 0x1A, 0x0C, 0x02, 0x07, 0x01, 0x09, 0x01,
+    0x02, 0x07, 0x1D, 0x82, 0x01, 0x0D, 0x02, 0x01, 0x02, 0x10, 0x18, 0x01, 0x01, 0x03, 0x45, 0x13,
+    0x03, 0x02, 0x01, 0x02, 0x82, 0x01, 0x12, 0x11, 0x00, 0x30, 0x18, 0x02, 0x01, 0x09, 0x09, 0x07,
+    0x01, 0x02, 0x01, 0x01, 0x09, 0x01, 0x02, 0x0C, 0x1C, 0x08, 0x87, 0x00, 0x11, 0x0D, 0x00, 0x24,
+    0x4E, 0x1C, 0x08, 0x01, 0x36, 0x00, 0x31, 0x25, 0x01, 0x14, 0x00, 0x00, 0x24, 0x0C, 0x45, 0xBB,
+    0x00, 0xB3, 0x00, 0x02, 0x31, 0x1C, 0x08, 0x89, 0x00, 0x02, 0x17, 0x4E, 0x14, 0x81, 0x08, 0x82,
+    0x00, 0x04, 0x22, 0x0B, 0x52, 0x22, 0x3C, 0x85, 0x00, 0x1A, 0x21, 0x26, 0x2A, 0x2D, 0x2C, 0x2C,
+    0x1F, 0x34, 0x54, 0x22, 0x11, 0x01, 0x02, 0x03, 0x1B, 0x08, 0x01, 0x02, 0x01, 0x12, 0x08, 0x10,
+    0x01, 0x01, 0x07, 0x01, 0x02, 0x83, 0x01, 0x25, 0x18, 0x01, 0x02, 0x01, 0x03, 0x33, 0x31, 0x0C,
+    0x12, 0x03, 0x1C, 0x00, 0x33, 0x03, 0x02, 0x01, 0x07, 0x01, 0x02, 0x01, 0x11, 0x00, 0x1B, 0x03,
+    0x07, 0x01, 0x07, 0x01, 0x09, 0x01, 0x09, 0x01, 0x01, 0x1D, 0x02, 0x18, 0x0F, 0x08, 0x8A, 0x00,
+    0x0F, 0x17, 0x03, 0x09, 0x20, 0x10, 0x1A, 0x00, 0x1B, 0x03, 0x01, 0x17, 0x00, 0x31, 0x4E, 0x35,
+    0x08, 0xBB, 0x00, 0xB4, 0x00, 0x81, 0x20, 0x89, 0x00, 0x04, 0x1A, 0x03, 0x01, 0x0E, 0x17, 0x82,
+    0x00, 0x02, 0x22, 0x1E, 0x21, 0x8A, 0x00, 0x13, 0x0D, 0x26, 0x2B, 0x49, 0x2D, 0x2B, 0x3C, 0x38,
+    0x0C, 0x02, 0x03, 0x4F, 0x00, 0x0F, 0x07, 0x07, 0x10, 0x00, 0x43, 0x07, 0x83, 0x01, 0x01, 0x02,
+    0x09, 0x82, 0x01, 0x18, 0x02, 0x01, 0x01, 0x0C, 0x17, 0x36, 0x03, 0x02, 0x4E, 0x1A, 0x00, 0x02,
+    0x01, 0x09, 0x01, 0x07, 0x01, 0x01, 0x07, 0x15, 0x00, 0x33, 0x28, 0x02, 0x01, 0x81, 0x02, 0x83,
+    0x01, 0x80, 0x02, 0x82, 0x01, 0x80, 0x3A, 0x82, 0x00, 0x80, 0x08, 0x87, 0x00, 0x0F, 0x15, 0x03,
+    0x0C, 0x36, 0x15, 0x13, 0x00, 0x10, 0x03, 0x02, 0x11, 0x08, 0x43, 0x01, 0x0F, 0x08, 0xBB, 0x00,
+    0xB3, 0x00, 0x80, 0x0D, 0x8B, 0x00, 0x0E, 0x1B, 0x03, 0x01, 0x51, 0x14, 0x45, 0x00, 0x00, 0x22,
+    0x2D, 0x00, 0x2D, 0x29, 0x00, 0x0D, 0x84, 0x00, 0x19, 0x2A, 0x34, 0x05, 0x27, 0x1F, 0x34, 0x2F,
+    0x1F, 0x00, 0x32, 0x03, 0x02, 0x03, 0x47, 0x00, 0x47, 0x25, 0x01, 0x13, 0x3A, 0x03, 0x02, 0x01,
+    0x02, 0x1D, 0x09, 0x83, 0x01, 0x0D, 0x02, 0x01, 0x09, 0x02, 0x03, 0x11, 0x31, 0x0C, 0x02, 0x03,
+    0x3A, 0x0E, 0x01, 0x02, 0x82, 0x01, 0x07, 0x1D, 0x01, 0x01, 0x14, 0x00, 0x11, 0x19, 0x02, 0x82,
+    0x01, 0x07, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0C, 0x15, 0x8C, 0x00, 0x0E, 0x30, 0x18, 0x09,
+    0x14, 0x0E, 0x17, 0x00, 0x14, 0x03, 0x14, 0x00, 0x15, 0x03, 0x01, 0x1C, 0xBC, 0x00, 0xC0, 0x00,
+    0x0C, 0x10, 0x03, 0x02, 0x37, 0x01, 0x36, 0x00, 0x00, 0x40, 0x3B, 0x00, 0x1E, 0x22, 0x84, 0x00,
+    0x1C, 0x3B, 0x2C, 0x0B, 0x05, 0x2F, 0x2C, 0x00, 0x3B, 0x2F, 0x1F, 0x00, 0x00, 0x33, 0x07, 0x09,
+    0x33, 0x00, 0x17, 0x07, 0x0C, 0x1A, 0x17, 0x0C, 0x02, 0x07, 0x01, 0x02, 0x01, 0x03, 0x84, 0x01,
+    0x0B, 0x1D, 0x09, 0x02, 0x00, 0x15, 0x03, 0x01, 0x01, 0x0E, 0x3F, 0x18, 0x02, 0x84, 0x01, 0x04,
+    0x02, 0x03, 0x19, 0x45, 0x1B, 0x82, 0x01, 0x07, 0x02, 0x01, 0x01, 0x09, 0x02, 0x02, 0x0C, 0x24,
+    0x8D, 0x00, 0x0E, 0x39, 0x18, 0x02, 0x18, 0x3A, 0x08, 0x0E, 0x0F, 0x03, 0x10, 0x00, 0x19, 0x03,
+    0x01, 0x1C, 0xBC, 0x00, 0xB8, 0x00, 0x01, 0x08, 0x20, 0x84, 0x00, 0x06, 0x08, 0x35, 0x07, 0x02,
+    0x1A, 0x0C, 0x1B, 0x84, 0x00, 0x23, 0x22, 0x0B, 0x2D, 0x2D, 0x21, 0x00, 0x29, 0x52, 0x0B, 0x52,
+    0x0A, 0x0B, 0x1F, 0x00, 0x3B, 0x41, 0x22, 0x00, 0x00, 0x39, 0x07, 0x03, 0x43, 0x00, 0x45, 0x01,
+    0x25, 0x13, 0x13, 0x03, 0x07, 0x02, 0x01, 0x01, 0x02, 0x1C, 0x85, 0x01, 0x16, 0x25, 0x14, 0x00,
+    0x39, 0x03, 0x09, 0x01, 0x0E, 0x3F, 0x07, 0x01, 0x01, 0x1D, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x18, 0x01, 0x07, 0x83, 0x01, 0x04, 0x02, 0x01, 0x18, 0x14, 0x08, 0x8D, 0x00, 0x0E, 0x32,
+    0x03, 0x02, 0x03, 0x17, 0x00, 0x11, 0x02, 0x25, 0x13, 0x00, 0x1C, 0x01, 0x03, 0x24, 0xBC, 0x00,
+    0xB9, 0x00, 0x01, 0x36, 0x37, 0x83, 0x00, 0x06, 0x39, 0x01, 0x01, 0x0F, 0x4F, 0x28, 0x10, 0x82,
+    0x00, 0x12, 0x49, 0x29, 0x3C, 0x0B, 0x16, 0x0B, 0x1F, 0x0D, 0x3C, 0x0B, 0x27, 0x05, 0x05, 0x22,
+    0x40, 0x29, 0x29, 0x2D, 0x3C, 0x82, 0x00, 0x13, 0x19, 0x0C, 0x35, 0x08, 0x0E, 0x02, 0x18, 0x0F,
+    0x1C, 0x01, 0x02, 0x01, 0x09, 0x18, 0x35, 0x17, 0x01, 0x02, 0x01, 0x03, 0x82, 0x01, 0x17, 0x1C,
+    0x00, 0x08, 0x12, 0x01, 0x01, 0x11, 0x08, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x02, 0x02, 0x01, 0x07, 0x01, 0x01, 0x02, 0x82, 0x01, 0x02, 0x07, 0x02, 0x11, 0x8E, 0x00, 0x0E,
+    0x15, 0x03, 0x12, 0x0C, 0x19, 0x00, 0x37, 0x18, 0x0C, 0x31, 0x00, 0x43, 0x01, 0x03, 0x19, 0xBC,
+    0x00, 0xBA, 0x00, 0x01, 0x47, 0x30, 0x82, 0x00, 0x06, 0x1A, 0x03, 0x01, 0x1C, 0x24, 0x03, 0x1C,
+    0x82, 0x00, 0x12, 0x34, 0x46, 0x00, 0x2A, 0x1E, 0x0A, 0x0B, 0x22, 0x3B, 0x16, 0x16, 0x1E, 0x46,
+    0x22, 0x2F, 0x0B, 0x05, 0x1F, 0x2B, 0x82, 0x00, 0x05, 0x0E, 0x02, 0x07, 0x00, 0x00, 0x14, 0x82,
+    0x01, 0x18, 0x09, 0x01, 0x01, 0x02, 0x01, 0x47, 0x17, 0x0C, 0x02, 0x09, 0x35, 0x35, 0x01, 0x09,
+    0x14, 0x00, 0x00, 0x4F, 0x07, 0x07, 0x30, 0x00, 0x0F, 0x03, 0x01, 0x81, 0x02, 0x87, 0x01, 0x80,
+    0x09, 0x84, 0x01, 0x01, 0x09, 0x39, 0x8F, 0x00, 0x0E, 0x17, 0x0C, 0x12, 0x03, 0x10, 0x00, 0x36,
+    0x25, 0x03, 0x15, 0x00, 0x12, 0x1D, 0x03, 0x19, 0xBC, 0x00, 0xBA, 0x00, 0x22, 0x3A, 0x33, 0x00,
+    0x08, 0x00, 0x24, 0x03, 0x01, 0x47, 0x1C, 0x03, 0x0F, 0x08, 0x00, 0x00, 0x2C, 0x22, 0x00, 0x00,
+    0x48, 0x0B, 0x0A, 0x1E, 0x40, 0x16, 0x1E, 0x46, 0x2C, 0x0B, 0x2D, 0x2D, 0x22, 0x34, 0x41, 0x2A,
+    0x82, 0x00, 0x06, 0x30, 0x31, 0x00, 0x00, 0x1C, 0x03, 0x02, 0x82, 0x01, 0x27, 0x02, 0x09, 0x0C,
+    0x38, 0x24, 0x03, 0x1D, 0x03, 0x24, 0x10, 0x03, 0x01, 0x35, 0x08, 0x00, 0x11, 0x1D, 0x0C, 0x4F,
+    0x00, 0x24, 0x18, 0x02, 0x07, 0x02, 0x07, 0x01, 0x01, 0x02, 0x01, 0x07, 0x02, 0x1D, 0x07, 0x02,
+    0x01, 0x02, 0x01, 0x01, 0x38, 0x90, 0x00, 0x0E, 0x19, 0x0C, 0x12, 0x07, 0x14, 0x13, 0x19, 0x01,
+    0x03, 0x15, 0x00, 0x43, 0x01, 0x03, 0x19, 0xBC, 0x00, 0xB9, 0x00, 0x1D, 0x0D, 0x00, 0x14, 0x39,
+    0x32, 0x08, 0x1C, 0x01, 0x01, 0x19, 0x0F, 0x03, 0x35, 0x08, 0x00, 0x00, 0x22, 0x05, 0x21, 0x00,
+    0x29, 0x1F, 0x0B, 0x34, 0x46, 0x0B, 0x2B, 0x2C, 0x0B, 0x3B, 0x82, 0x00, 0x03, 0x4C, 0x34, 0x1E,
+    0x0D, 0x85, 0x00, 0x03, 0x33, 0x18, 0x02, 0x01, 0x82, 0x02, 0x14, 0x0C, 0x47, 0x3A, 0x09, 0x01,
+    0x02, 0x0C, 0x19, 0x31, 0x0C, 0x02, 0x01, 0x3A, 0x00, 0x00, 0x19, 0x0C, 0x43, 0x00, 0x51, 0x03,
+    0x82, 0x01, 0x04, 0x09, 0x01, 0x07, 0x01, 0x02, 0x83, 0x01, 0x81, 0x02, 0x81, 0x01, 0x80, 0x38,
+    0x91, 0x00, 0x0E, 0x14, 0x01, 0x01, 0x02, 0x03, 0x0F, 0x1C, 0x01, 0x0C, 0x38, 0x00, 0x02, 0x01,
+    0x03, 0x1B, 0xBC, 0x00, 0xBB, 0x00, 0x22, 0x14, 0x15, 0x15, 0x51, 0x14, 0x01, 0x18, 0x10, 0x35,
+    0x01, 0x35, 0x0E, 0x00, 0x00, 0x3B, 0x0B, 0x1F, 0x2D, 0x26, 0x00, 0x22, 0x2C, 0x2A, 0x34, 0x2A,
+    0x0B, 0x26, 0x00, 0x30, 0x1C, 0x13, 0x00, 0x3C, 0x4B, 0x2A, 0x85, 0x00, 0x1C, 0x33, 0x18, 0x01,
+    0x02, 0x01, 0x12, 0x07, 0x43, 0x0E, 0x47, 0x03, 0x02, 0x02, 0x0C, 0x1A, 0x11, 0x03, 0x12, 0x0C,
+    0x17, 0x00, 0x0D, 0x20, 0x12, 0x03, 0x31, 0x00, 0x1C, 0x01, 0x81, 0x02, 0x83, 0x01, 0x0C, 0x02,
+    0x01, 0x01, 0x09, 0x18, 0x01, 0x09, 0x18, 0x51, 0x00, 0x30, 0x1C, 0x11, 0x8D, 0x00, 0x0F, 0x20,
+    0x01, 0x02, 0x09, 0x01, 0x1D, 0x12, 0x01, 0x01, 0x03, 0x3A, 0x00, 0x0F, 0x01, 0x03, 0x1A, 0xBC,
+    0x00, 0xBB, 0x00, 0x0B, 0x1C, 0x15, 0x17, 0x31, 0x14, 0x01, 0x01, 0x43, 0x12, 0x01, 0x01, 0x11,
+    0x82, 0x00, 0x13, 0x2D, 0x0B, 0x2F, 0x0B, 0x2D, 0x00, 0x00, 0x2D, 0x1F, 0x2D, 0x34, 0x00, 0x08,
+    0x0F, 0x1B, 0x12, 0x1A, 0x00, 0x34, 0x1F, 0x85, 0x00, 0x13, 0x0F, 0x0C, 0x02, 0x07, 0x01, 0x03,
+    0x12, 0x0E, 0x17, 0x0C, 0x02, 0x01, 0x01, 0x03, 0x45, 0x11, 0x01, 0x02, 0x03, 0x24, 0x82, 0x00,
+    0x09, 0x17, 0x4E, 0x12, 0x20, 0x0E, 0x12, 0x03, 0x01, 0x01, 0x02, 0x85, 0x01, 0x08, 0x12, 0x03,
+    0x02, 0x3A, 0x00, 0x00, 0x1B, 0x28, 0x31, 0x8D, 0x00, 0x0F, 0x51, 0x03, 0x02, 0x01, 0x03, 0x10,
+    0x13, 0x03, 0x02, 0x02, 0x20, 0x00, 0x14, 0x01, 0x03, 0x36, 0xBC, 0x00, 0xBB, 0x00, 0x0B, 0x1B,
+    0x15, 0x47, 0x31, 0x24, 0x03, 0x09, 0x01, 0x02, 0x07, 0x03, 0x37, 0x83, 0x00, 0x12, 0x22, 0x0B,
+    0x52, 0x0B, 0x1F, 0x3C, 0x2D, 0x1F, 0x2D, 0x34, 0x00, 0x37, 0x24, 0x00, 0x36, 0x10, 0x00, 0x34,
+    0x1F, 0x85, 0x00, 0x14, 0x3A, 0x02, 0x03, 0x14, 0x0F, 0x47, 0x0E, 0x38, 0x0C, 0x02, 0x01, 0x1D,
+    0x03, 0x10, 0x00, 0x32, 0x03, 0x01, 0x02, 0x12, 0x20, 0x82, 0x00, 0x09, 0x24, 0x28, 0x0F, 0x20,
+    0x08, 0x10, 0x18, 0x03, 0x18, 0x02, 0x83, 0x01, 0x0A, 0x09, 0x25, 0x14, 0x20, 0x00, 0x08, 0x00,
+    0x0E, 0x15, 0x0F, 0x20, 0x8C, 0x00, 0x0F, 0x13, 0x03, 0x02, 0x02, 0x0C, 0x17, 0x13, 0x03, 0x03,
+    0x24, 0x17, 0x08, 0x10, 0x03, 0x01, 0x3A, 0xBC, 0x00, 0xB9, 0x00, 0x26, 0x08, 0x00, 0x51, 0x31,
+    0x14, 0x13, 0x19, 0x0C, 0x01, 0x09, 0x02, 0x02, 0x25, 0x1A, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x3D,
+    0x0B, 0x52, 0x0B, 0x2C, 0x2B, 0x1F, 0x2D, 0x34, 0x00, 0x32, 0x02, 0x20, 0x4F, 0x24, 0x00, 0x34,
+    0x2C, 0x00, 0x08, 0x84, 0x00, 0x01, 0x11, 0x1A, 0x82, 0x00, 0x0E, 0x3A, 0x4E, 0x02, 0x1D, 0x01,
+    0x01, 0x02, 0x0E, 0x08, 0x10, 0x03, 0x02, 0x01, 0x03, 0x1A, 0x82, 0x00, 0x18, 0x08, 0x24, 0x0C,
+    0x03, 0x1A, 0x0E, 0x15, 0x19, 0x14, 0x01, 0x02, 0x02, 0x07, 0x25, 0x01, 0x1B, 0x08, 0x0E, 0x14,
+    0x08, 0x00, 0x00, 0x47, 0x07, 0x08, 0x88, 0x00, 0x80, 0x08, 0x82, 0x00, 0x0F, 0x14, 0x01, 0x02,
+    0x01, 0x03, 0x39, 0x14, 0x09, 0x03, 0x31, 0x10, 0x0E, 0x1B, 0x03, 0x02, 0x20, 0xBC, 0x00, 0xBB,
+    0x00, 0x06, 0x08, 0x20, 0x10, 0x03, 0x12, 0x07, 0x02, 0x82, 0x01, 0x01, 0x03, 0x24, 0x85, 0x00,
+    0x10, 0x2B, 0x05, 0x0B, 0x22, 0x2A, 0x34, 0x2A, 0x52, 0x21, 0x00, 0x19, 0x07, 0x01, 0x39, 0x50,
+    0x1E, 0x22, 0x89, 0x00, 0x03, 0x0E, 0x00, 0x08, 0x19, 0x82, 0x03, 0x04, 0x12, 0x3A, 0x00, 0x1A,
+    0x03, 0x82, 0x01, 0x02, 0x07, 0x09, 0x51, 0x83, 0x00, 0x15, 0x51, 0x1B, 0x14, 0x0F, 0x47, 0x10,
+    0x0F, 0x0C, 0x03, 0x03, 0x1D, 0x47, 0x30, 0x00, 0x00, 0x3F, 0x01, 0x11, 0x00, 0x13, 0x28, 0x31,
+    0x8C, 0x00, 0x10, 0x45, 0x01, 0x01, 0x02, 0x03, 0x10, 0x45, 0x09, 0x03, 0x10, 0x32, 0x01, 0x00,
+    0x13, 0x28, 0x33, 0x08, 0xBC, 0x00, 0xBB, 0x00, 0x0C, 0x15, 0x3F, 0x38, 0x18, 0x02, 0x01, 0x01,
+    0x1D, 0x09, 0x07, 0x01, 0x01, 0x11, 0x85, 0x00, 0x11, 0x3B, 0x34, 0x22, 0x3C, 0x0B, 0x40, 0x1E,
+    0x2D, 0x00, 0x00, 0x11, 0x0E, 0x00, 0x3B, 0x0B, 0x40, 0x22, 0x29, 0x86, 0x00, 0x13, 0x08, 0x0F,
+    0x3F, 0x08, 0x00, 0x32, 0x47, 0x1B, 0x0E, 0x00, 0x17, 0x03, 0x02, 0x02, 0x01, 0x01, 0x09, 0x01,
+    0x01, 0x15, 0x85, 0x00, 0x07, 0x08, 0x11, 0x45, 0x32, 0x15, 0x15, 0x32, 0x0E, 0x84, 0x00, 0x04,
+    0x1C, 0x03, 0x02, 0x4E, 0x1A, 0x8D, 0x00, 0x0F, 0x4F, 0x01, 0x01, 0x02, 0x0C, 0x30, 0x19, 0x03,
+    0x07, 0x47, 0x0F, 0x43, 0x00, 0x13, 0x28, 0x17, 0xBD, 0x00, 0xBB, 0x00, 0x03, 0x3F, 0x14, 0x13,
+    0x07, 0x84, 0x01, 0x81, 0x02, 0x01, 0x0C, 0x19, 0x86, 0x00, 0x10, 0x50, 0x29, 0x21, 0x16, 0x2C,
+    0x2A, 0x0B, 0x2D, 0x4C, 0x00, 0x00, 0x26, 0x0B, 0x2C, 0x46, 0x05, 0x21, 0x86, 0x00, 0x04, 0x08,
+    0x10, 0x3A, 0x0F, 0x32, 0x82, 0x00, 0x03, 0x11, 0x10, 0x25, 0x12, 0x84, 0x01, 0x04, 0x09, 0x01,
+    0x03, 0x24, 0x0E, 0x90, 0x00, 0x03, 0x20, 0x17, 0x36, 0x45, 0x8B, 0x00, 0x12, 0x08, 0x00, 0x11,
+    0x02, 0x01, 0x12, 0x0C, 0x19, 0x30, 0x07, 0x07, 0x02, 0x01, 0x03, 0x33, 0x00, 0x1B, 0x03, 0x11,
+    0xBD, 0x00, 0xBC, 0x00, 0x06, 0x0F, 0x0C, 0x02, 0x02, 0x01, 0x01, 0x02, 0x82, 0x01, 0x02, 0x37,
+    0x33, 0x32, 0x87, 0x00, 0x13, 0x50, 0x1E, 0x0B, 0x22, 0x2A, 0x1F, 0x05, 0x52, 0x34, 0x1E, 0x2D,
+    0x26, 0x05, 0x27, 0x21, 0x00, 0x50, 0x3B, 0x3B, 0x3C, 0x82, 0x00, 0x16, 0x1C, 0x51, 0x12, 0x01,
+    0x10, 0x47, 0x10, 0x07, 0x03, 0x02, 0x01, 0x02, 0x02, 0x07, 0x01, 0x01, 0x07, 0x01, 0x02, 0x03,
+    0x02, 0x1A, 0x20, 0x9E, 0x00, 0x0F, 0x0D, 0x00, 0x10, 0x03, 0x02, 0x01, 0x35, 0x0E, 0x14, 0x03,
+    0x02, 0x07, 0x02, 0x01, 0x1C, 0x00, 0x81, 0x10, 0xBE, 0x00, 0xBC, 0x00, 0x01, 0x24, 0x03, 0x82,
+    0x01, 0x08, 0x09, 0x02, 0x01, 0x03, 0x10, 0x00, 0x0E, 0x11, 0x0D, 0x83, 0x00, 0x20, 0x50, 0x4C,
+    0x00, 0x21, 0x52, 0x0B, 0x0B, 0x1F, 0x22, 0x2B, 0x2B, 0x2A, 0x2A, 0x2B, 0x52, 0x2F, 0x1E, 0x21,
+    0x00, 0x3B, 0x2F, 0x16, 0x1E, 0x21, 0x00, 0x08, 0x1A, 0x3A, 0x09, 0x01, 0x4E, 0x0C, 0x03, 0x82,
+    0x01, 0x80, 0x07, 0x84, 0x01, 0x80, 0x07, 0x82, 0x02, 0x07, 0x01, 0x03, 0x01, 0x33, 0x17, 0x00,
+    0x19, 0x1A, 0x8D, 0x00, 0x80, 0x0D, 0x8B, 0x00, 0x10, 0x17, 0x03, 0x12, 0x02, 0x0C, 0x3A, 0x1B,
+    0x4E, 0x02, 0x01, 0x02, 0x09, 0x03, 0x19, 0x00, 0x1C, 0x32, 0xBE, 0x00, 0xBC, 0x00, 0x09, 0x1A,
+    0x03, 0x12, 0x01, 0x02, 0x07, 0x09, 0x02, 0x03, 0x15, 0x86, 0x00, 0x21, 0x26, 0x05, 0x34, 0x50,
+    0x00, 0x2C, 0x2A, 0x22, 0x0B, 0x41, 0x1F, 0x26, 0x2D, 0x0B, 0x0B, 0x16, 0x0A, 0x1E, 0x21, 0x00,
+    0x3B, 0x05, 0x16, 0x0A, 0x3C, 0x00, 0x00, 0x20, 0x0F, 0x01, 0x03, 0x19, 0x32, 0x09, 0x82, 0x01,
+    0x01, 0x07, 0x02, 0x82, 0x01, 0x0D, 0x07, 0x09, 0x01, 0x01, 0x09, 0x01, 0x10, 0x14, 0x28, 0x0F,
+    0x00, 0x43, 0x18, 0x20, 0x95, 0x00, 0x13, 0x08, 0x00, 0x00, 0x15, 0x25, 0x02, 0x02, 0x28, 0x15,
+    0x15, 0x25, 0x09, 0x02, 0x01, 0x01, 0x09, 0x0C, 0x17, 0x00, 0x13, 0xBF, 0x00, 0xBB, 0x00, 0x0A,
+    0x08, 0x3F, 0x0F, 0x01, 0x09, 0x1D, 0x01, 0x01, 0x09, 0x02, 0x20, 0x82, 0x00, 0x2A, 0x26, 0x29,
+    0x00, 0x00, 0x2A, 0x41, 0x1E, 0x4C, 0x00, 0x00, 0x3B, 0x29, 0x46, 0x22, 0x1F, 0x34, 0x34, 0x2C,
+    0x22, 0x0A, 0x0A, 0x1E, 0x21, 0x00, 0x26, 0x4B, 0x0A, 0x05, 0x3B, 0x00, 0x00, 0x33, 0x03, 0x0C,
+    0x1B, 0x00, 0x1A, 0x03, 0x01, 0x02, 0x01, 0x09, 0x02, 0x83, 0x01, 0x82, 0x02, 0x0C, 0x01, 0x09,
+    0x02, 0x1A, 0x24, 0x03, 0x0E, 0x37, 0x01, 0x18, 0x14, 0x13, 0x20, 0x94, 0x00, 0x11, 0x15, 0x01,
+    0x12, 0x07, 0x0C, 0x31, 0x51, 0x03, 0x02, 0x01, 0x01, 0x09, 0x01, 0x1D, 0x03, 0x15, 0x08, 0x3F,
+    0xBF, 0x00, 0xBB, 0x00, 0x09, 0x3F, 0x13, 0x10, 0x03, 0x02, 0x07, 0x01, 0x09, 0x07, 0x14, 0x82,
+    0x00, 0x30, 0x29, 0x05, 0x34, 0x21, 0x00, 0x3B, 0x34, 0x3D, 0x0D, 0x00, 0x40, 0x16, 0x2A, 0x2B,
+    0x3B, 0x29, 0x21, 0x21, 0x3C, 0x3B, 0x3D, 0x41, 0x05, 0x21, 0x00, 0x3C, 0x05, 0x0B, 0x16, 0x3C,
+    0x00, 0x38, 0x0C, 0x02, 0x17, 0x00, 0x36, 0x0C, 0x02, 0x09, 0x09, 0x01, 0x01, 0x12, 0x07, 0x01,
+    0x02, 0x01, 0x09, 0x82, 0x01, 0x0D, 0x02, 0x09, 0x02, 0x0E, 0x37, 0x0F, 0x31, 0x20, 0x1A, 0x01,
+    0x28, 0x07, 0x24, 0x39, 0x90, 0x00, 0x11, 0x20, 0x19, 0x03, 0x09, 0x03, 0x02, 0x39, 0x32, 0x01,
+    0x02, 0x01, 0x09, 0x01, 0x02, 0x01, 0x01, 0x03, 0x37, 0x82, 0x00, 0x01, 0x29, 0x50, 0xBC, 0x00,
+    0xBC, 0x00, 0x08, 0x1B, 0x0C, 0x02, 0x09, 0x02, 0x02, 0x01, 0x03, 0x24, 0x82, 0x00, 0x04, 0x22,
+    0x0B, 0x05, 0x1F, 0x21, 0x84, 0x00, 0x0C, 0x2C, 0x0B, 0x22, 0x3B, 0x34, 0x1F, 0x2A, 0x2C, 0x22,
+    0x34, 0x29, 0x22, 0x46, 0x82, 0x00, 0x12, 0x26, 0x2A, 0x26, 0x00, 0x00, 0x47, 0x1C, 0x0E, 0x00,
+    0x20, 0x43, 0x01, 0x09, 0x07, 0x03, 0x1D, 0x02, 0x09, 0x1D, 0x84, 0x01, 0x12, 0x1C, 0x12, 0x03,
+    0x02, 0x01, 0x0F, 0x31, 0x51, 0x33, 0x0F, 0x11, 0x00, 0x15, 0x14, 0x28, 0x28, 0x14, 0x17, 0x3F,
+    0x8B, 0x00, 0x0D, 0x30, 0x19, 0x12, 0x03, 0x02, 0x0C, 0x10, 0x0E, 0x31, 0x03, 0x01, 0x02, 0x02,
+    0x07, 0x84, 0x01, 0x05, 0x20, 0x00, 0x00, 0x21, 0x0A, 0x2C, 0xBC, 0x00, 0xBC, 0x00, 0x11, 0x08,
+    0x43, 0x07, 0x09, 0x01, 0x01, 0x02, 0x03, 0x1A, 0x00, 0x00, 0x29, 0x1E, 0x05, 0x05, 0x16, 0x1E,
+    0x40, 0x83, 0x00, 0x0A, 0x4C, 0x2C, 0x41, 0x0A, 0x0A, 0x34, 0x2D, 0x2A, 0x22, 0x2F, 0x46, 0x89,
+    0x00, 0x0B, 0x13, 0x0E, 0x00, 0x00, 0x39, 0x02, 0x28, 0x24, 0x11, 0x10, 0x03, 0x02, 0x82, 0x01,
+    0x35, 0x02, 0x01, 0x01, 0x0F, 0x3A, 0x08, 0x1A, 0x07, 0x01, 0x09, 0x28, 0x0F, 0x3A, 0x1A, 0x0C,
+    0x47, 0x20, 0x00, 0x45, 0x19, 0x02, 0x28, 0x03, 0x0F, 0x10, 0x1A, 0x31, 0x51, 0x39, 0x11, 0x11,
+    0x39, 0x15, 0x4F, 0x0F, 0x03, 0x03, 0x01, 0x0C, 0x0F, 0x15, 0x11, 0x24, 0x4E, 0x01, 0x09, 0x02,
+    0x4E, 0x1B, 0x10, 0x18, 0x02, 0x01, 0x14, 0x82, 0x00, 0x03, 0x2D, 0x2F, 0x0B, 0x22, 0xBB, 0x00,
+    0xBD, 0x00, 0x01, 0x36, 0x0C, 0x82, 0x02, 0x0D, 0x01, 0x0C, 0x15, 0x00, 0x00, 0x3C, 0x16, 0x05,
+    0x0A, 0x0A, 0x05, 0x0B, 0x2C, 0x26, 0x83, 0x00, 0x03, 0x2D, 0x05, 0x2F, 0x4B, 0x83, 0x0B, 0x02,
+    0x22, 0x00, 0x0D, 0x8C, 0x00, 0x07, 0x0E, 0x15, 0x08, 0x00, 0x00, 0x19, 0x03, 0x02, 0x81, 0x01,
+    0x81, 0x02, 0x82, 0x01, 0x19, 0x19, 0x00, 0x11, 0x35, 0x03, 0x12, 0x18, 0x01, 0x15, 0x45, 0x35,
+    0x28, 0x1C, 0x15, 0x11, 0x3F, 0x39, 0x1A, 0x10, 0x0F, 0x01, 0x03, 0x0C, 0x03, 0x25, 0x0C, 0x82,
+    0x28, 0x13, 0x0C, 0x01, 0x43, 0x10, 0x15, 0x45, 0x1A, 0x01, 0x03, 0x02, 0x02, 0x01, 0x03, 0x1B,
+    0x00, 0x14, 0x03, 0x02, 0x03, 0x13, 0x82, 0x00, 0x04, 0x22, 0x0B, 0x0A, 0x4B, 0x2D, 0xBA, 0x00,
+    0xB7, 0x00, 0x01, 0x11, 0x3F, 0x84, 0x00, 0x18, 0x24, 0x0C, 0x02, 0x07, 0x14, 0x43, 0x36, 0x00,
+    0x00, 0x3C, 0x2A, 0x16, 0x05, 0x27, 0x2F, 0x0A, 0x16, 0x05, 0x48, 0x26, 0x0D, 0x00, 0x00, 0x50,
+    0x29, 0x82, 0x3C, 0x02, 0x3B, 0x3C, 0x0D, 0x82, 0x00, 0x04, 0x4C, 0x26, 0x2B, 0x1F, 0x2A, 0x8B,
+    0x00, 0x03, 0x11, 0x01, 0x09, 0x02, 0x83, 0x01, 0x13, 0x1D, 0x12, 0x28, 0x0F, 0x08, 0x0E, 0x35,
+    0x03, 0x02, 0x01, 0x03, 0x4F, 0x00, 0x17, 0x0C, 0x28, 0x01, 0x0F, 0x10, 0x13, 0x82, 0x31, 0x81,
+    0x15, 0x80, 0x31, 0x82, 0x36, 0x81, 0x31, 0x13, 0x15, 0x32, 0x32, 0x37, 0x1B, 0x02, 0x0C, 0x03,
+    0x02, 0x02, 0x0C, 0x02, 0x31, 0x00, 0x17, 0x0C, 0x02, 0x09, 0x02, 0x20, 0x82, 0x00, 0x05, 0x21,
+    0x34, 0x2F, 0x27, 0x0B, 0x2A, 0xB9, 0x00, 0xB8, 0x00, 0x01, 0x1B, 0x39, 0x83, 0x00, 0x28, 0x08,
+    0x0F, 0x01, 0x09, 0x0F, 0x38, 0x15, 0x00, 0x4C, 0x0A, 0x2D, 0x46, 0x0B, 0x16, 0x1F, 0x4B, 0x0B,
+    0x05, 0x4B, 0x1E, 0x22, 0x2D, 0x40, 0x3B, 0x3C, 0x21, 0x4C, 0x00, 0x50, 0x3B, 0x40, 0x2D, 0x22,
+    0x1F, 0x1E, 0x4B, 0x2F, 0x0B, 0x2C, 0x3C, 0x08, 0x86, 0x00, 0x07, 0x3F, 0x1A, 0x00, 0x10, 0x03,
+    0x18, 0x01, 0x02, 0x84, 0x01, 0x3A, 0x0F, 0x33, 0x36, 0x00, 0x11, 0x02, 0x03, 0x12, 0x07, 0x03,
+    0x0F, 0x3F, 0x0E, 0x47, 0x03, 0x03, 0x18, 0x25, 0x03, 0x03, 0x01, 0x12, 0x0F, 0x0F, 0x14, 0x1C,
+    0x33, 0x33, 0x1C, 0x14, 0x0F, 0x02, 0x03, 0x03, 0x01, 0x02, 0x02, 0x0C, 0x01, 0x4F, 0x20, 0x00,
+    0x37, 0x01, 0x02, 0x02, 0x03, 0x1A, 0x00, 0x00, 0x50, 0x3C, 0x00, 0x21, 0x1F, 0x16, 0x05, 0x4B,
+    0x3B, 0xB8, 0x00, 0xB8, 0x00, 0x02, 0x0E, 0x12, 0x31, 0x83, 0x00, 0x1B, 0x11, 0x1D, 0x18, 0x18,
+    0x31, 0x00, 0x00, 0x21, 0x1E, 0x0B, 0x2D, 0x40, 0x2B, 0x3B, 0x46, 0x22, 0x1E, 0x0B, 0x0B, 0x2F,
+    0x0B, 0x0B, 0x16, 0x4B, 0x05, 0x27, 0x34, 0x52, 0x83, 0x0B, 0x06, 0x2F, 0x05, 0x0A, 0x0A, 0x27,
+    0x0B, 0x2C, 0x82, 0x00, 0x0B, 0x2A, 0x48, 0x3B, 0x00, 0x11, 0x01, 0x10, 0x00, 0x1C, 0x02, 0x37,
+    0x33, 0x83, 0x01, 0x16, 0x02, 0x18, 0x33, 0x32, 0x30, 0x08, 0x00, 0x11, 0x35, 0x03, 0x12, 0x02,
+    0x07, 0x03, 0x15, 0x00, 0x30, 0x14, 0x01, 0x03, 0x01, 0x12, 0x02, 0x82, 0x01, 0x12, 0x18, 0x03,
+    0x03, 0x18, 0x03, 0x03, 0x18, 0x01, 0x1D, 0x01, 0x01, 0x02, 0x03, 0x10, 0x20, 0x00, 0x00, 0x36,
+    0x03, 0x82, 0x01, 0x0D, 0x0F, 0x08, 0x00, 0x0D, 0x2A, 0x0B, 0x40, 0x00, 0x50, 0x1F, 0x16, 0x05,
+    0x1E, 0x21, 0xB7, 0x00, 0xB9, 0x00, 0x02, 0x51, 0x03, 0x19, 0x83, 0x00, 0x1A, 0x3A, 0x35, 0x0C,
+    0x14, 0x00, 0x00, 0x21, 0x1E, 0x05, 0x0B, 0x2C, 0x3D, 0x2F, 0x1F, 0x2B, 0x26, 0x2A, 0x2C, 0x0A,
+    0x0B, 0x0A, 0x05, 0x27, 0x05, 0x05, 0x16, 0x05, 0x86, 0x0A, 0x81, 0x05, 0x2D, 0x1E, 0x29, 0x00,
+    0x00, 0x21, 0x1E, 0x0B, 0x46, 0x00, 0x17, 0x28, 0x38, 0x00, 0x08, 0x08, 0x00, 0x39, 0x03, 0x12,
+    0x02, 0x09, 0x01, 0x02, 0x01, 0x28, 0x01, 0x33, 0x11, 0x00, 0x0E, 0x33, 0x0C, 0x02, 0x01, 0x01,
+    0x0C, 0x24, 0x08, 0x00, 0x30, 0x4F, 0x0F, 0x07, 0x18, 0x02, 0x12, 0x81, 0x02, 0x82, 0x01, 0x12,
+    0x12, 0x02, 0x02, 0x01, 0x09, 0x01, 0x03, 0x03, 0x01, 0x45, 0x00, 0x0E, 0x47, 0x25, 0x01, 0x01,
+    0x02, 0x03, 0x32, 0x82, 0x00, 0x09, 0x1F, 0x2F, 0x16, 0x40, 0x00, 0x21, 0x1F, 0x05, 0x2F, 0x2C,
+    0xB7, 0x00, 0xBA, 0x00, 0x02, 0x31, 0x28, 0x4F, 0x83, 0x00, 0x14, 0x0E, 0x1C, 0x28, 0x31, 0x00,
+    0x00, 0x1F, 0x0B, 0x1E, 0x0B, 0x0B, 0x1E, 0x05, 0x41, 0x16, 0x3D, 0x46, 0x3B, 0x22, 0x05, 0x0A,
+    0x82, 0x05, 0x01, 0x52, 0x27, 0x83, 0x05, 0x81, 0x0A, 0x03, 0x05, 0x0A, 0x0B, 0x22, 0x82, 0x00,
+    0x06, 0x2D, 0x0B, 0x1F, 0x00, 0x00, 0x02, 0x13, 0x82, 0x00, 0x03, 0x0E, 0x00, 0x0E, 0x02, 0x83,
+    0x01, 0x80, 0x07, 0x82, 0x02, 0x0C, 0x03, 0x02, 0x11, 0x00, 0x00, 0x1A, 0x01, 0x18, 0x02, 0x09,
+    0x03, 0x02, 0x38, 0x82, 0x00, 0x1A, 0x38, 0x33, 0x18, 0x25, 0x01, 0x18, 0x07, 0x07, 0x01, 0x0C,
+    0x0C, 0x18, 0x25, 0x03, 0x02, 0x1C, 0x1A, 0x11, 0x00, 0x00, 0x24, 0x28, 0x12, 0x01, 0x02, 0x0C,
+    0x1A, 0x83, 0x00, 0x0A, 0x2B, 0x0B, 0x05, 0x52, 0x3B, 0x00, 0x3C, 0x27, 0x05, 0x0B, 0x2D, 0xB6,
+    0x00, 0xBB, 0x00, 0x01, 0x10, 0x14, 0x85, 0x00, 0x1C, 0x1B, 0x1D, 0x0E, 0x00, 0x29, 0x1F, 0x0B,
+    0x52, 0x05, 0x1F, 0x00, 0x40, 0x2C, 0x0A, 0x0B, 0x4D, 0x26, 0x1F, 0x16, 0x27, 0x05, 0x0A, 0x05,
+    0x05, 0x0A, 0x05, 0x0A, 0x05, 0x16, 0x82, 0x0B, 0x12, 0x16, 0x29, 0x00, 0x00, 0x29, 0x1E, 0x0B,
+    0x2D, 0x00, 0x30, 0x02, 0x08, 0x00, 0x00, 0x08, 0x1C, 0x3A, 0x00, 0x02, 0x83, 0x01, 0x80, 0x07,
+    0x83, 0x01, 0x01, 0x03, 0x1C, 0x82, 0x00, 0x08, 0x51, 0x12, 0x03, 0x01, 0x09, 0x01, 0x03, 0x1B,
+    0x08, 0x82, 0x00, 0x0C, 0x32, 0x47, 0x1C, 0x33, 0x43, 0x12, 0x14, 0x1B, 0x15, 0x37, 0x15, 0x30,
+    0x3F, 0x83, 0x00, 0x08, 0x30, 0x43, 0x02, 0x01, 0x01, 0x0C, 0x1A, 0x00, 0x50, 0x83, 0x00, 0x0A,
+    0x22, 0x2F, 0x16, 0x1F, 0x50, 0x00, 0x2A, 0x4B, 0x0A, 0x55, 0x3B, 0xB5, 0x00, 0xB9, 0x00, 0x03,
+    0x08, 0x00, 0x45, 0x1C, 0x86, 0x00, 0x81, 0x13, 0x1D, 0x00, 0x39, 0x00, 0x2D, 0x2F, 0x16, 0x1E,
+    0x2A, 0x50, 0x00, 0x00, 0x46, 0x0B, 0x1F, 0x46, 0x16, 0x0B, 0x2F, 0x16, 0x0B, 0x4B, 0x16, 0x2F,
+    0x16, 0x1E, 0x34, 0x1F, 0x22, 0x2D, 0x26, 0x82, 0x00, 0x06, 0x22, 0x0B, 0x05, 0x26, 0x00, 0x08,
+    0x30, 0x82, 0x00, 0x07, 0x13, 0x28, 0x1B, 0x00, 0x12, 0x01, 0x02, 0x07, 0x82, 0x01, 0x05, 0x07,
+    0x01, 0x02, 0x02, 0x03, 0x1A, 0x82, 0x00, 0x08, 0x3F, 0x14, 0x03, 0x1D, 0x09, 0x02, 0x0C, 0x14,
+    0x30, 0x85, 0x00, 0x81, 0x08, 0x81, 0x00, 0x80, 0x0D, 0x85, 0x00, 0x0B, 0x11, 0x19, 0x07, 0x01,
+    0x09, 0x03, 0x35, 0x32, 0x00, 0x46, 0x1E, 0x46, 0x82, 0x00, 0x0A, 0x0D, 0x34, 0x16, 0x0B, 0x2D,
+    0x00, 0x00, 0x2C, 0x16, 0x2F, 0x2C, 0xB5, 0x00, 0xBB, 0x00, 0x02, 0x0D, 0x37, 0x08, 0x86, 0x00,
+    0x10, 0x13, 0x00, 0x17, 0x30, 0x00, 0x26, 0x34, 0x0B, 0x0B, 0x0A, 0x22, 0x46, 0x26, 0x52, 0x2F,
+    0x2B, 0x26, 0x81, 0x40, 0x82, 0x2A, 0x04, 0x40, 0x26, 0x3C, 0x21, 0x0D, 0x85, 0x00, 0x06, 0x50,
+    0x27, 0x0A, 0x0B, 0x2D, 0x00, 0x0D, 0x83, 0x00, 0x07, 0x47, 0x28, 0x1B, 0x00, 0x02, 0x01, 0x01,
+    0x07, 0x82, 0x01, 0x80, 0x02, 0x83, 0x01, 0x01, 0x03, 0x1A, 0x82, 0x00, 0x0C, 0x08, 0x33, 0x25,
+    0x02, 0x01, 0x02, 0x07, 0x03, 0x1B, 0x08, 0x00, 0x00, 0x08, 0x89, 0x00, 0x0E, 0x11, 0x19, 0x01,
+    0x03, 0x12, 0x01, 0x25, 0x4F, 0x08, 0x00, 0x2B, 0x05, 0x0B, 0x1E, 0x21, 0x82, 0x00, 0x0A, 0x26,
+    0x16, 0x0A, 0x27, 0x3C, 0x00, 0x3C, 0x0A, 0x0A, 0x16, 0x26, 0xB4, 0x00, 0xC5, 0x00, 0x08, 0x30,
+    0x20, 0x37, 0x14, 0x00, 0x00, 0x0D, 0x2D, 0x1E, 0x82, 0x0B, 0x80, 0x05, 0x82, 0x0A, 0x80, 0x34,
+    0x83, 0x1F, 0x01, 0x34, 0x46, 0x8A, 0x00, 0x06, 0x2C, 0x4B, 0x05, 0x1E, 0x21, 0x00, 0x08, 0x82,
+    0x00, 0x05, 0x14, 0x28, 0x32, 0x00, 0x02, 0x01, 0x82, 0x02, 0x83, 0x01, 0x82, 0x02, 0x0F, 0x07,
+    0x03, 0x1C, 0x11, 0x00, 0x00, 0x08, 0x14, 0x01, 0x02, 0x01, 0x01, 0x02, 0x0C, 0x35, 0x37, 0x87,
+    0x00, 0x20, 0x3A, 0x15, 0x36, 0x10, 0x07, 0x03, 0x09, 0x01, 0x0C, 0x14, 0x30, 0x00, 0x00, 0x3D,
+    0x0B, 0x0A, 0x27, 0x0B, 0x22, 0x00, 0x0D, 0x00, 0x00, 0x49, 0x0B, 0x4B, 0x2C, 0x00, 0x00, 0x49,
+    0x0B, 0x16, 0x2C, 0xB4, 0x00, 0xC5, 0x00, 0x04, 0x08, 0x00, 0x30, 0x28, 0x13, 0x82, 0x00, 0x03,
+    0x21, 0x2D, 0x1F, 0x05, 0x82, 0x0B, 0x06, 0x4B, 0x0B, 0x0B, 0x2F, 0x0A, 0x0A, 0x2C, 0x87, 0x00,
+    0x32, 0x29, 0x3B, 0x00, 0x00, 0x50, 0x1F, 0x05, 0x4B, 0x2B, 0x00, 0x0D, 0x00, 0x00, 0x20, 0x02,
+    0x38, 0x00, 0x0E, 0x12, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x02, 0x01, 0x09, 0x01, 0x07, 0x02,
+    0x02, 0x03, 0x01, 0x31, 0x00, 0x00, 0x08, 0x14, 0x03, 0x02, 0x07, 0x01, 0x02, 0x07, 0x03, 0x1C,
+    0x36, 0x39, 0x11, 0x08, 0x82, 0x00, 0x04, 0x33, 0x28, 0x18, 0x03, 0x02, 0x82, 0x01, 0x0B, 0x17,
+    0x0D, 0x00, 0x00, 0x50, 0x1E, 0x16, 0x05, 0x27, 0x16, 0x4B, 0x26, 0x82, 0x00, 0x0A, 0x21, 0x1E,
+    0x05, 0x0B, 0x2A, 0x00, 0x29, 0x1E, 0x05, 0x27, 0x29, 0xB3, 0x00, 0xBD, 0x00, 0x04, 0x13, 0x17,
+    0x45, 0x11, 0x0E, 0x84, 0x00, 0x03, 0x11, 0x01, 0x12, 0x0E, 0x84, 0x00, 0x09, 0x3B, 0x2B, 0x49,
+    0x40, 0x26, 0x3B, 0x3C, 0x3C, 0x29, 0x50, 0x87, 0x00, 0x0A, 0x22, 0x05, 0x0B, 0x2D, 0x00, 0x00,
+    0x29, 0x34, 0x0B, 0x1F, 0x0D, 0x82, 0x00, 0x06, 0x38, 0x24, 0x00, 0x00, 0x3F, 0x02, 0x07, 0x83,
+    0x01, 0x03, 0x07, 0x01, 0x01, 0x07, 0x85, 0x01, 0x07, 0x25, 0x17, 0x00, 0x00, 0x0E, 0x35, 0x03,
+    0x02, 0x83, 0x01, 0x1C, 0x03, 0x0C, 0x07, 0x01, 0x12, 0x14, 0x33, 0x33, 0x12, 0x09, 0x02, 0x09,
+    0x01, 0x01, 0x14, 0x20, 0x21, 0x2D, 0x2C, 0x0D, 0x00, 0x2A, 0x0B, 0x0A, 0x05, 0x0A, 0x16, 0x34,
+    0x21, 0x82, 0x00, 0x09, 0x2D, 0x4B, 0x05, 0x1E, 0x29, 0x00, 0x22, 0x4B, 0x16, 0x2A, 0xB3, 0x00,
+    0xBD, 0x00, 0x04, 0x1B, 0x28, 0x01, 0x25, 0x24, 0x85, 0x00, 0x02, 0x47, 0x4E, 0x38, 0x95, 0x00,
+    0x1C, 0x29, 0x05, 0x05, 0x0A, 0x2F, 0x2D, 0x00, 0x00, 0x40, 0x4B, 0x05, 0x48, 0x46, 0x4C, 0x00,
+    0x08, 0x0E, 0x00, 0x00, 0x36, 0x0C, 0x09, 0x02, 0x09, 0x02, 0x01, 0x01, 0x02, 0x07, 0x83, 0x01,
+    0x38, 0x02, 0x01, 0x02, 0x01, 0x03, 0x30, 0x00, 0x00, 0x11, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x12, 0x02, 0x01, 0x01, 0x07, 0x09, 0x03, 0x07, 0x01, 0x1D, 0x01, 0x09, 0x01, 0x35, 0x08, 0x2A,
+    0x16, 0x0B, 0x0B, 0x2D, 0x00, 0x0D, 0x22, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x2C, 0x0D, 0x00, 0x0D,
+    0x21, 0x1E, 0x05, 0x0B, 0x22, 0x00, 0x26, 0x05, 0x0B, 0x22, 0xB3, 0x00, 0xBD, 0x00, 0x05, 0x0E,
+    0x02, 0x01, 0x07, 0x0F, 0x08, 0x84, 0x00, 0x02, 0x3A, 0x0C, 0x31, 0x94, 0x00, 0x0F, 0x0D, 0x2A,
+    0x2F, 0x0A, 0x05, 0x05, 0x2F, 0x22, 0x00, 0x3B, 0x05, 0x05, 0x16, 0x16, 0x27, 0x2A, 0x82, 0x00,
+    0x02, 0x0E, 0x0F, 0x01, 0x82, 0x02, 0x86, 0x01, 0x07, 0x09, 0x02, 0x01, 0x03, 0x01, 0x02, 0x18,
+    0x33, 0x82, 0x00, 0x0B, 0x51, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x07, 0x02, 0x01, 0x09, 0x01,
+    0x83, 0x02, 0x1F, 0x07, 0x1D, 0x25, 0x4F, 0x0D, 0x1E, 0x2F, 0x52, 0x05, 0x05, 0x3B, 0x00, 0x4C,
+    0x1F, 0x2F, 0x05, 0x0A, 0x0A, 0x0B, 0x3D, 0x00, 0x0D, 0x00, 0x22, 0x0B, 0x0A, 0x27, 0x29, 0x0D,
+    0x34, 0x0B, 0x1F, 0xB3, 0x00, 0xBE, 0x00, 0x04, 0x37, 0x03, 0x01, 0x02, 0x08, 0x85, 0x00, 0x01,
+    0x1C, 0x13, 0x93, 0x00, 0x10, 0x0D, 0x00, 0x22, 0x2F, 0x0A, 0x05, 0x0A, 0x0A, 0x0B, 0x3B, 0x46,
+    0x0B, 0x1E, 0x0A, 0x0A, 0x0B, 0x2D, 0x82, 0x00, 0x15, 0x10, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01,
+    0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x25, 0x12, 0x10, 0x12, 0x01, 0x02, 0x01, 0x45, 0x82,
+    0x00, 0x22, 0x30, 0x12, 0x0C, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x1D, 0x02, 0x07,
+    0x01, 0x01, 0x1D, 0x03, 0x51, 0x46, 0x16, 0x0A, 0x16, 0x1E, 0x05, 0x1E, 0x29, 0x00, 0x29, 0x1E,
+    0x05, 0x55, 0x0A, 0x0B, 0x2C, 0x82, 0x00, 0x08, 0x3B, 0x05, 0x1E, 0x2F, 0x2B, 0x00, 0x1F, 0x0B,
+    0x48, 0xB3, 0x00, 0xBF, 0x00, 0x03, 0x17, 0x03, 0x1D, 0x3F, 0x85, 0x00, 0x81, 0x17, 0x95, 0x00,
+    0x80, 0x34, 0x82, 0x05, 0x2F, 0x16, 0x05, 0x1E, 0x0D, 0x22, 0x0B, 0x27, 0x16, 0x05, 0x16, 0x26,
+    0x00, 0x00, 0x1B, 0x0C, 0x02, 0x02, 0x03, 0x35, 0x31, 0x0F, 0x01, 0x01, 0x07, 0x01, 0x01, 0x07,
+    0x18, 0x13, 0x08, 0x00, 0x11, 0x02, 0x02, 0x0C, 0x36, 0x00, 0x00, 0x08, 0x00, 0x3F, 0x47, 0x07,
+    0x0C, 0x01, 0x02, 0x01, 0x02, 0x82, 0x01, 0x22, 0x07, 0x01, 0x09, 0x09, 0x07, 0x12, 0x08, 0x1F,
+    0x2F, 0x27, 0x05, 0x05, 0x0A, 0x4B, 0x1F, 0x50, 0x00, 0x26, 0x16, 0x0A, 0x0B, 0x22, 0x00, 0x2A,
+    0x3B, 0x00, 0x00, 0x1F, 0x0B, 0x0B, 0x2C, 0x00, 0x34, 0x0B, 0x48, 0xB3, 0x00, 0xC0, 0x00, 0x02,
+    0x1B, 0x4E, 0x3A, 0x85, 0x00, 0x03, 0x08, 0x0E, 0x00, 0x08, 0x8C, 0x00, 0x27, 0x21, 0x29, 0x29,
+    0x21, 0x21, 0x50, 0x2A, 0x05, 0x05, 0x0A, 0x0A, 0x27, 0x0B, 0x2C, 0x00, 0x34, 0x05, 0x05, 0x0A,
+    0x05, 0x34, 0x0D, 0x00, 0x11, 0x02, 0x02, 0x01, 0x0C, 0x33, 0x08, 0x15, 0x03, 0x02, 0x01, 0x01,
+    0x12, 0x07, 0x1C, 0x11, 0x0D, 0x82, 0x00, 0x03, 0x47, 0x03, 0x03, 0x1B, 0x85, 0x00, 0x02, 0x3A,
+    0x47, 0x02, 0x81, 0x03, 0x82, 0x02, 0x82, 0x01, 0x20, 0x02, 0x01, 0x03, 0x19, 0x3B, 0x2F, 0x0A,
+    0x05, 0x27, 0x05, 0x05, 0x0A, 0x0B, 0x2C, 0x50, 0x00, 0x46, 0x0B, 0x1F, 0x50, 0x2C, 0x0B, 0x16,
+    0x49, 0x00, 0x21, 0x2D, 0x49, 0x29, 0x2A, 0x16, 0x0B, 0x22, 0xB3, 0x00, 0xC0, 0x00, 0x02, 0x08,
+    0x1D, 0x31, 0x95, 0x00, 0x03, 0x2A, 0x0A, 0x1E, 0x27, 0x82, 0x1E, 0x81, 0x05, 0x1C, 0x0A, 0x05,
+    0x0A, 0x1E, 0x0B, 0x2A, 0x3B, 0x16, 0x05, 0x0A, 0x05, 0x0B, 0x22, 0x00, 0x00, 0x15, 0x0C, 0x01,
+    0x03, 0x13, 0x00, 0x32, 0x03, 0x01, 0x01, 0x09, 0x01, 0x25, 0x13, 0x85, 0x00, 0x03, 0x19, 0x18,
+    0x25, 0x1B, 0x87, 0x00, 0x29, 0x0E, 0x36, 0x1C, 0x07, 0x25, 0x09, 0x01, 0x07, 0x01, 0x1D, 0x09,
+    0x25, 0x15, 0x00, 0x1F, 0x0B, 0x0A, 0x16, 0x05, 0x0A, 0x05, 0x1E, 0x0B, 0x22, 0x00, 0x0D, 0x46,
+    0x29, 0x26, 0x0B, 0x0A, 0x27, 0x0B, 0x1F, 0x40, 0x00, 0x00, 0x2B, 0x05, 0x05, 0x16, 0x26, 0xB3,
+    0x00, 0xC1, 0x00, 0x01, 0x1A, 0x17, 0x94, 0x00, 0x05, 0x29, 0x52, 0x16, 0x05, 0x16, 0x0A, 0x84,
+    0x05, 0x0B, 0x16, 0x2F, 0x4B, 0x0B, 0x29, 0x2D, 0x0B, 0x0A, 0x05, 0x0A, 0x2F, 0x46, 0x82, 0x00,
+    0x06, 0x10, 0x07, 0x30, 0x00, 0x38, 0x01, 0x09, 0x82, 0x01, 0x01, 0x03, 0x1B, 0x85, 0x00, 0x04,
+    0x20, 0x02, 0x03, 0x03, 0x39, 0x8A, 0x00, 0x04, 0x39, 0x10, 0x03, 0x01, 0x09, 0x82, 0x01, 0x06,
+    0x02, 0x20, 0x00, 0x50, 0x1F, 0x2F, 0x27, 0x82, 0x05, 0x03, 0x16, 0x27, 0x0B, 0x2D, 0x83, 0x00,
+    0x0B, 0x2A, 0x0A, 0x0B, 0x27, 0x05, 0x0B, 0x27, 0x0A, 0x4B, 0x05, 0x0B, 0x2C, 0xB4, 0x00, 0xC1,
+    0x00, 0x01, 0x0E, 0x11, 0x94, 0x00, 0x02, 0x48, 0x0B, 0x0A, 0x82, 0x05, 0x10, 0x0A, 0x05, 0x05,
+    0x0A, 0x16, 0x34, 0x2C, 0x2C, 0x2D, 0x4C, 0x34, 0x16, 0x05, 0x0A, 0x05, 0x1E, 0x21, 0x82, 0x00,
+    0x0B, 0x0E, 0x11, 0x00, 0x37, 0x01, 0x01, 0x09, 0x01, 0x02, 0x02, 0x03, 0x15, 0x85, 0x00, 0x03,
+    0x24, 0x07, 0x03, 0x47, 0x84, 0x00, 0x81, 0x11, 0x02, 0x00, 0x08, 0x0E, 0x83, 0x00, 0x06, 0x36,
+    0x01, 0x01, 0x02, 0x02, 0x18, 0x1C, 0x82, 0x00, 0x03, 0x50, 0x1F, 0x0B, 0x27, 0x82, 0x05, 0x12,
+    0x0A, 0x05, 0x2F, 0x26, 0x00, 0x0D, 0x00, 0x00, 0x29, 0x2C, 0x0B, 0x0B, 0x0A, 0x05, 0x0A, 0x0A,
+    0x0B, 0x1E, 0x29, 0xB4, 0x00, 0xC9, 0x00, 0x80, 0x0D, 0x8C, 0x00, 0x04, 0x2D, 0x0B, 0x0A, 0x55,
+    0x27, 0x82, 0x0A, 0x03, 0x05, 0x0A, 0x4B, 0x1F, 0x83, 0x00, 0x06, 0x26, 0x4B, 0x0A, 0x16, 0x27,
+    0x0B, 0x1F, 0x82, 0x00, 0x05, 0x0D, 0x08, 0x00, 0x32, 0x07, 0x09, 0x82, 0x01, 0x03, 0x02, 0x01,
+    0x03, 0x37, 0x84, 0x00, 0x04, 0x13, 0x03, 0x03, 0x14, 0x08, 0x82, 0x00, 0x11, 0x39, 0x10, 0x01,
+    0x10, 0x10, 0x12, 0x43, 0x33, 0x4F, 0x32, 0x00, 0x00, 0x51, 0x01, 0x09, 0x02, 0x0C, 0x1A, 0x83,
+    0x00, 0x09, 0x50, 0x1F, 0x0B, 0x27, 0x05, 0x05, 0x0A, 0x05, 0x0B, 0x2C, 0x85, 0x00, 0x07, 0x26,
+    0x2C, 0x27, 0x2F, 0x2F, 0x05, 0x2C, 0x29, 0xB5, 0x00, 0xD6, 0x00, 0x03, 0x46, 0x0B, 0x0A, 0x05,
+    0x82, 0x0B, 0x80, 0x2F, 0x82, 0x0A, 0x0C, 0x0B, 0x2D, 0x00, 0x3C, 0x21, 0x4C, 0x2C, 0x16, 0x0A,
+    0x27, 0x05, 0x0B, 0x49, 0x82, 0x00, 0x02, 0x0F, 0x30, 0x08, 0x81, 0x09, 0x82, 0x01, 0x04, 0x09,
+    0x01, 0x01, 0x03, 0x37, 0x82, 0x00, 0x05, 0x08, 0x19, 0x0C, 0x0C, 0x33, 0x0E, 0x82, 0x00, 0x05,
+    0x1B, 0x03, 0x03, 0x09, 0x07, 0x03, 0x81, 0x09, 0x82, 0x03, 0x07, 0x24, 0x0E, 0x00, 0x37, 0x07,
+    0x07, 0x0C, 0x32, 0x84, 0x00, 0x07, 0x21, 0x1F, 0x0B, 0x0A, 0x0A, 0x05, 0x05, 0x2A, 0x88, 0x00,
+    0x04, 0x21, 0x3C, 0x3C, 0x29, 0x0D, 0xB6, 0x00, 0xD5, 0x00, 0x11, 0x29, 0x05, 0x16, 0x05, 0x27,
+    0x2B, 0x3D, 0x1F, 0x1F, 0x27, 0x05, 0x52, 0x0B, 0x22, 0x46, 0x4B, 0x34, 0x1E, 0x82, 0x05, 0x81,
+    0x0A, 0x08, 0x0B, 0x2A, 0x00, 0x00, 0x31, 0x14, 0x00, 0x45, 0x01, 0x82, 0x02, 0x0C, 0x12, 0x07,
+    0x02, 0x01, 0x07, 0x30, 0x00, 0x00, 0x08, 0x0F, 0x28, 0x43, 0x1A, 0x82, 0x00, 0x14, 0x11, 0x14,
+    0x03, 0x01, 0x02, 0x01, 0x03, 0x07, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x1C, 0x08, 0x00, 0x19,
+    0x03, 0x02, 0x0E, 0x85, 0x00, 0x06, 0x21, 0x1F, 0x2F, 0x0A, 0x0B, 0x40, 0x00, 0x81, 0x2B, 0x84,
+    0x00, 0x06, 0x0D, 0x00, 0x26, 0x22, 0x2D, 0x2C, 0x48, 0xB6, 0x00, 0xD3, 0x00, 0x06, 0x0D, 0x00,
+    0x2A, 0x0B, 0x52, 0x0B, 0x2A, 0x83, 0x00, 0x1B, 0x50, 0x2C, 0x05, 0x0B, 0x2D, 0x2A, 0x0B, 0x05,
+    0x0A, 0x05, 0x0A, 0x0A, 0x05, 0x27, 0x0B, 0x22, 0x00, 0x00, 0x15, 0x11, 0x00, 0x30, 0x01, 0x09,
+    0x01, 0x01, 0x09, 0x01, 0x82, 0x02, 0x06, 0x0E, 0x00, 0x00, 0x3F, 0x02, 0x13, 0x08, 0x82, 0x00,
+    0x14, 0x30, 0x12, 0x03, 0x12, 0x01, 0x0C, 0x0F, 0x33, 0x10, 0x33, 0x14, 0x09, 0x03, 0x01, 0x02,
+    0x0C, 0x19, 0x00, 0x45, 0x03, 0x14, 0x87, 0x00, 0x09, 0x29, 0x48, 0x0B, 0x27, 0x00, 0x3D, 0x0B,
+    0x0B, 0x34, 0x46, 0x84, 0x00, 0x04, 0x2D, 0x41, 0x0B, 0x0B, 0x3D, 0xB6, 0x00, 0xD5, 0x00, 0x20,
+    0x2B, 0x0B, 0x05, 0x2C, 0x00, 0x46, 0x3D, 0x2A, 0x21, 0x08, 0x26, 0x0B, 0x0B, 0x26, 0x1F, 0x0B,
+    0x1E, 0x0A, 0x05, 0x05, 0x55, 0x0A, 0x0A, 0x05, 0x1E, 0x29, 0x00, 0x0D, 0x00, 0x20, 0x33, 0x0C,
+    0x07, 0x83, 0x01, 0x07, 0x18, 0x4E, 0x1A, 0x00, 0x08, 0x00, 0x00, 0x08, 0x83, 0x00, 0x15, 0x31,
+    0x01, 0x01, 0x12, 0x03, 0x02, 0x15, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x3F, 0x17, 0x02, 0x03, 0x02,
+    0x25, 0x39, 0x00, 0x0F, 0x24, 0x89, 0x00, 0x11, 0x46, 0x2A, 0x29, 0x0A, 0x05, 0x1E, 0x0B, 0x53,
+    0x1F, 0x2D, 0x26, 0x3C, 0x40, 0x1E, 0x05, 0x0A, 0x05, 0x46, 0xB6, 0x00, 0xD5, 0x00, 0x26, 0x3B,
+    0x52, 0x05, 0x21, 0x21, 0x27, 0x0B, 0x0B, 0x1E, 0x40, 0x00, 0x22, 0x22, 0x2B, 0x0B, 0x0A, 0x16,
+    0x05, 0x0A, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x0B, 0x22, 0x00, 0x00, 0x32, 0x13, 0x45, 0x30, 0x24,
+    0x43, 0x01, 0x18, 0x02, 0x0F, 0x36, 0x87, 0x00, 0x17, 0x08, 0x19, 0x03, 0x01, 0x02, 0x0C, 0x24,
+    0x08, 0x00, 0x3C, 0x2A, 0x2A, 0x40, 0x29, 0x00, 0x00, 0x3F, 0x02, 0x01, 0x03, 0x19, 0x00, 0x19,
+    0x13, 0x8B, 0x00, 0x0F, 0x3C, 0x4B, 0x05, 0x0A, 0x27, 0x27, 0x4B, 0x2F, 0x16, 0x16, 0x2F, 0x05,
+    0x05, 0x16, 0x34, 0x0D, 0xB6, 0x00, 0xCC, 0x00, 0x01, 0x20, 0x3A, 0x87, 0x00, 0x1B, 0x3B, 0x22,
+    0x00, 0x22, 0x0B, 0x27, 0x52, 0x05, 0x0B, 0x2B, 0x00, 0x00, 0x2B, 0x22, 0x21, 0x40, 0x16, 0x05,
+    0x0B, 0x4B, 0x2F, 0x05, 0x27, 0x05, 0x0B, 0x2A, 0x00, 0x0D, 0x83, 0x00, 0x04, 0x08, 0x11, 0x3A,
+    0x3F, 0x08, 0x87, 0x00, 0x0A, 0x32, 0x0F, 0x03, 0x02, 0x01, 0x01, 0x15, 0x00, 0x29, 0x2C, 0x05,
+    0x82, 0x0B, 0x0C, 0x52, 0x2D, 0x00, 0x00, 0x30, 0x03, 0x03, 0x1C, 0x00, 0x1B, 0x32, 0x00, 0x0D,
+    0x88, 0x00, 0x04, 0x0D, 0x00, 0x2D, 0x0B, 0x16, 0x84, 0x0A, 0x80, 0x05, 0x82, 0x0A, 0x01, 0x54,
+    0x2A, 0xB7, 0x00, 0xCC, 0x00, 0x01, 0x15, 0x19, 0x89, 0x00, 0x08, 0x3B, 0x16, 0x0A, 0x05, 0x05,
+    0x0A, 0x05, 0x05, 0x3C, 0x82, 0x00, 0x0C, 0x50, 0x00, 0x2D, 0x41, 0x2D, 0x21, 0x29, 0x2C, 0x41,
+    0x1F, 0x48, 0x0B, 0x2A, 0x8F, 0x00, 0x0B, 0x11, 0x24, 0x03, 0x01, 0x12, 0x03, 0x0F, 0x11, 0x00,
+    0x26, 0x27, 0x0B, 0x83, 0x0A, 0x0A, 0x05, 0x0B, 0x22, 0x00, 0x00, 0x1C, 0x03, 0x0F, 0x00, 0x11,
+    0x0E, 0x8B, 0x00, 0x0D, 0x0D, 0x00, 0x40, 0x1E, 0x0B, 0x0B, 0x05, 0x05, 0x0A, 0x05, 0x05, 0x0B,
+    0x0B, 0x2D, 0xB8, 0x00, 0xCC, 0x00, 0x02, 0x37, 0x09, 0x08, 0x88, 0x00, 0x02, 0x2C, 0x16, 0x0A,
+    0x82, 0x05, 0x13, 0x0A, 0x0B, 0x3D, 0x00, 0x26, 0x1E, 0x05, 0x22, 0x4C, 0x2A, 0x21, 0x49, 0x22,
+    0x3B, 0x40, 0x00, 0x00, 0x22, 0x2F, 0x0D, 0x83, 0x00, 0x23, 0x13, 0x19, 0x1B, 0x17, 0x37, 0x39,
+    0x45, 0x11, 0x11, 0x51, 0x24, 0x07, 0x0C, 0x02, 0x02, 0x0C, 0x24, 0x08, 0x00, 0x50, 0x1E, 0x0B,
+    0x0A, 0x05, 0x05, 0x16, 0x05, 0x05, 0x27, 0x0B, 0x40, 0x00, 0x13, 0x03, 0x02, 0x20, 0x90, 0x00,
+    0x09, 0x50, 0x2A, 0x2C, 0x34, 0x05, 0x4B, 0x05, 0x52, 0x2C, 0x26, 0xB9, 0x00, 0xCC, 0x00, 0x01,
+    0x20, 0x38, 0x88, 0x00, 0x02, 0x46, 0x16, 0x0A, 0x82, 0x05, 0x28, 0x0A, 0x05, 0x05, 0x1E, 0x00,
+    0x2D, 0x0B, 0x0A, 0x0B, 0x46, 0x00, 0x34, 0x0B, 0x0B, 0x26, 0x29, 0x48, 0x34, 0x3B, 0x3C, 0x26,
+    0x29, 0x00, 0x0D, 0x00, 0x1C, 0x28, 0x03, 0x03, 0x0C, 0x03, 0x01, 0x07, 0x09, 0x01, 0x03, 0x01,
+    0x02, 0x02, 0x0C, 0x4F, 0x82, 0x00, 0x10, 0x2A, 0x0B, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+    0x05, 0x05, 0x1E, 0x21, 0x13, 0x25, 0x01, 0x3F, 0x81, 0x0E, 0x8D, 0x00, 0x80, 0x0D, 0x82, 0x00,
+    0x04, 0x50, 0x3C, 0x26, 0x3B, 0x21, 0xBB, 0x00, 0xD6, 0x00, 0x02, 0x21, 0x34, 0x16, 0x81, 0x0A,
+    0x85, 0x05, 0x11, 0x21, 0x2D, 0x0B, 0x27, 0x2F, 0x22, 0x29, 0x0B, 0x0A, 0x1E, 0x3B, 0x34, 0x0B,
+    0x0B, 0x40, 0x2D, 0x0B, 0x2A, 0x82, 0x00, 0x01, 0x15, 0x01, 0x83, 0x02, 0x82, 0x01, 0x83, 0x02,
+    0x01, 0x0C, 0x13, 0x83, 0x00, 0x01, 0x2A, 0x0B, 0x82, 0x0A, 0x84, 0x05, 0x0A, 0x0A, 0x16, 0x22,
+    0x39, 0x18, 0x25, 0x11, 0x15, 0x1A, 0x00, 0x08, 0xD0, 0x00, 0xD5, 0x00, 0x1D, 0x21, 0x1F, 0x0B,
+    0x0A, 0x05, 0x05, 0x0A, 0x05, 0x05, 0x0A, 0x0A, 0x0B, 0x3C, 0x49, 0x0B, 0x1E, 0x05, 0x1F, 0x26,
+    0x05, 0x0B, 0x22, 0x46, 0x4B, 0x27, 0x34, 0x46, 0x16, 0x0B, 0x40, 0x82, 0x00, 0x0D, 0x3F, 0x02,
+    0x03, 0x02, 0x02, 0x09, 0x02, 0x01, 0x09, 0x09, 0x01, 0x18, 0x01, 0x15, 0x84, 0x00, 0x04, 0x3B,
+    0x05, 0x0A, 0x16, 0x05, 0x82, 0x0A, 0x0A, 0x16, 0x05, 0x0A, 0x05, 0x0B, 0x46, 0x15, 0x28, 0x32,
+    0x1A, 0x14, 0xD2, 0x00, 0xD4, 0x00, 0x03, 0x29, 0x34, 0x16, 0x27, 0x82, 0x05, 0x82, 0x0A, 0x14,
+    0x05, 0x0A, 0x0B, 0x29, 0x2B, 0x41, 0x0B, 0x0B, 0x1E, 0x46, 0x0B, 0x16, 0x21, 0x2B, 0x41, 0x0B,
+    0x1F, 0x3C, 0x0B, 0x34, 0x0D, 0x82, 0x00, 0x02, 0x08, 0x24, 0x43, 0x83, 0x01, 0x05, 0x03, 0x01,
+    0x03, 0x0F, 0x19, 0x20, 0x86, 0x00, 0x02, 0x2C, 0x0B, 0x27, 0x84, 0x05, 0x0A, 0x0A, 0x05, 0x27,
+    0x05, 0x05, 0x3B, 0x47, 0x36, 0x11, 0x03, 0x11, 0xD1, 0x00, 0xD3, 0x00, 0x21, 0x46, 0x27, 0x4B,
+    0x27, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x34, 0x00, 0x21, 0x2B, 0x2D, 0x49,
+    0x2A, 0x50, 0x26, 0x26, 0x00, 0x3C, 0x22, 0x22, 0x46, 0x0D, 0x22, 0x2A, 0x00, 0x00, 0x0D, 0x82,
+    0x00, 0x02, 0x08, 0x3F, 0x45, 0x83, 0x3A, 0x80, 0x11, 0x89, 0x00, 0x03, 0x29, 0x1E, 0x05, 0x16,
+    0x87, 0x05, 0x06, 0x16, 0x1E, 0x3B, 0x08, 0x00, 0x17, 0x13, 0xD1, 0x00, 0xC7, 0x00, 0x80, 0x0D,
+    0x88, 0x00, 0x08, 0x50, 0x22, 0x16, 0x05, 0x0A, 0x05, 0x0A, 0x16, 0x0A, 0x82, 0x05, 0x03, 0x0A,
+    0x27, 0x0B, 0x2B, 0x90, 0x00, 0x80, 0x0D, 0x8E, 0x00, 0x80, 0x08, 0x87, 0x00, 0x01, 0x46, 0x55,
+    0x82, 0x0A, 0x01, 0x05, 0x0A, 0x82, 0x05, 0x81, 0x0A, 0x05, 0x4B, 0x05, 0x2A, 0x00, 0x00, 0x0E,
+    0xD1, 0x00, 0xD0, 0x00, 0x02, 0x46, 0x34, 0x0B, 0x82, 0x05, 0x02, 0x0A, 0x05, 0x0A, 0x83, 0x05,
+    0x02, 0x27, 0x0B, 0x2C, 0x8C, 0x00, 0x03, 0x0D, 0x00, 0x00, 0x0D, 0x9A, 0x00, 0x0F, 0x2A, 0x4B,
+    0x05, 0x05, 0x0A, 0x05, 0x05, 0x0A, 0x05, 0x05, 0x16, 0x0A, 0x0A, 0x0B, 0x2C, 0x3C, 0xD2, 0x00,
+    0xCE, 0x00, 0x06, 0x26, 0x2C, 0x2F, 0x4B, 0x0A, 0x05, 0x0A, 0x83, 0x05, 0x06, 0x16, 0x05, 0x05,
+    0x0A, 0x0B, 0x48, 0x08, 0xA8, 0x00, 0x0C, 0x29, 0x3B, 0x00, 0x00, 0x40, 0x2F, 0x16, 0x0A, 0x05,
+    0x55, 0x05, 0x05, 0x16, 0x83, 0x0A, 0x03, 0x0B, 0x16, 0x22, 0x3B, 0xD0, 0x00, 0xCC, 0x00, 0x17,
+    0x46, 0x2C, 0x0B, 0x16, 0x0A, 0x0A, 0x16, 0x0A, 0x05, 0x05, 0x0A, 0x05, 0x0A, 0x0A, 0x05, 0x0A,
+    0x0B, 0x2C, 0x50, 0x00, 0x2A, 0x2A, 0x00, 0x0D, 0xA4, 0x00, 0x0B, 0x1F, 0x16, 0x21, 0x00, 0x00,
+    0x26, 0x0A, 0x16, 0x0A, 0x05, 0x05, 0x0A, 0x82, 0x05, 0x08, 0x0A, 0x05, 0x0A, 0x0A, 0x0B, 0x16,
+    0x1F, 0x2A, 0x21, 0xCD, 0x00, 0xC8, 0x00, 0x0D, 0x0D, 0x4C, 0x2A, 0x1F, 0x2F, 0x4B, 0x0A, 0x27,
+    0x05, 0x0A, 0x0A, 0x05, 0x05, 0x0A, 0x82, 0x05, 0x04, 0x0A, 0x16, 0x0B, 0x22, 0x0D, 0x81, 0x00,
+    0x81, 0x34, 0xA5, 0x00, 0x03, 0x46, 0x2F, 0x05, 0x3B, 0x82, 0x00, 0x06, 0x29, 0x1F, 0x0B, 0x05,
+    0x0A, 0x05, 0x0A, 0x82, 0x05, 0x09, 0x0A, 0x05, 0x0A, 0x27, 0x0A, 0x16, 0x0B, 0x1E, 0x22, 0x3B,
+    0xCB, 0x00, 0xC7, 0x00, 0x14, 0x3C, 0x49, 0x34, 0x0B, 0x2F, 0x0A, 0x0A, 0x05, 0x0A, 0x05, 0x05,
+    0x16, 0x05, 0x0A, 0x05, 0x05, 0x0A, 0x05, 0x4B, 0x27, 0x2B, 0x82, 0x00, 0x03, 0x50, 0x34, 0x0B,
+    0x2D, 0xA3, 0x00, 0x04, 0x50, 0x1F, 0x05, 0x16, 0x3B, 0x84, 0x00, 0x07, 0x2D, 0x0A, 0x0B, 0x27,
+    0x05, 0x27, 0x16, 0x0A, 0x84, 0x05, 0x81, 0x0A, 0x06, 0x05, 0x16, 0x16, 0x1F, 0x2D, 0x3B, 0x4C,
+    0xC7, 0x00, 0xC4, 0x00, 0x0B, 0x3C, 0x2A, 0x2C, 0x05, 0x2F, 0x05, 0x0A, 0x05, 0x05, 0x0A, 0x0A,
+    0x16, 0x83, 0x0A, 0x81, 0x27, 0x04, 0x0A, 0x0B, 0x4B, 0x2C, 0x29, 0x83, 0x00, 0x04, 0x21, 0x1E,
+    0x05, 0x2F, 0x46, 0xA2, 0x00, 0x04, 0x2D, 0x2F, 0x27, 0x16, 0x46, 0x85, 0x00, 0x04, 0x21, 0x22,
+    0x27, 0x0B, 0x05, 0x82, 0x0A, 0x81, 0x05, 0x80, 0x0A, 0x83, 0x05, 0x06, 0x27, 0x05, 0x05, 0x2F,
+    0x05, 0x1E, 0x34, 0x82, 0x1F, 0x01, 0x34, 0x3C, 0xC1, 0x00, 0xC2, 0x00, 0x01, 0x2A, 0x34, 0x82,
+    0x0B, 0x01, 0x05, 0x27, 0x82, 0x0A, 0x0C, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x4B, 0x4B, 0x2F, 0x0B,
+    0x0B, 0x1E, 0x2C, 0x26, 0x85, 0x00, 0x05, 0x21, 0x1E, 0x05, 0x05, 0x0A, 0x46, 0x85, 0x00, 0x02,
+    0x29, 0x2A, 0x29, 0x90, 0x00, 0x0C, 0x26, 0x2B, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x46, 0x16, 0x0A,
+    0x05, 0x2F, 0x26, 0x84, 0x00, 0x08, 0x0D, 0x00, 0x00, 0x29, 0x49, 0x34, 0x2F, 0x0B, 0x4B, 0x83,
+    0x0A, 0x80, 0x52, 0x83, 0x0A, 0x82, 0x27, 0x80, 0x05, 0x82, 0x0B, 0x01, 0x2F, 0x2D, 0xC2, 0x00,
+    0xC2, 0x00, 0x0A, 0x50, 0x46, 0x49, 0x2C, 0x1F, 0x1E, 0x0A, 0x4B, 0x05, 0x05, 0x16, 0x82, 0x05,
+    0x06, 0x52, 0x34, 0x1F, 0x2C, 0x2D, 0x46, 0x50, 0x85, 0x00, 0x10, 0x0D, 0x00, 0x29, 0x0A, 0x05,
+    0x27, 0x05, 0x52, 0x3B, 0x00, 0x00, 0x3B, 0x46, 0x21, 0x2C, 0x41, 0x2B, 0x85, 0x00, 0x06, 0x08,
+    0x0E, 0x20, 0x3F, 0x11, 0x20, 0x08, 0x83, 0x00, 0x0C, 0x3D, 0x4D, 0x2C, 0x2C, 0x3B, 0x00, 0x29,
+    0x1E, 0x05, 0x0A, 0x0A, 0x05, 0x3B, 0x86, 0x00, 0x07, 0x11, 0x00, 0x00, 0x4C, 0x40, 0x22, 0x34,
+    0x05, 0x81, 0x0B, 0x82, 0x4B, 0x82, 0x05, 0x80, 0x16, 0x82, 0x0B, 0x03, 0x05, 0x1F, 0x49, 0x3C,
+    0xC3, 0x00, 0xC7, 0x00, 0x80, 0x21, 0x81, 0x3C, 0x82, 0x3B, 0x04, 0x3C, 0x3B, 0x3C, 0x21, 0x4C,
+    0x83, 0x00, 0x05, 0x3F, 0x1B, 0x0E, 0x00, 0x00, 0x0D, 0x82, 0x00, 0x2C, 0x29, 0x27, 0x05, 0x05,
+    0x27, 0x4B, 0x1E, 0x21, 0x00, 0x1E, 0x41, 0x2C, 0x2A, 0x1F, 0x3B, 0x00, 0x3A, 0x36, 0x19, 0x1C,
+    0x14, 0x0F, 0x02, 0x02, 0x01, 0x01, 0x02, 0x35, 0x1C, 0x19, 0x37, 0x08, 0x3B, 0x2A, 0x1F, 0x41,
+    0x22, 0x00, 0x48, 0x0B, 0x0A, 0x05, 0x05, 0x0A, 0x29, 0x85, 0x00, 0x03, 0x3F, 0x01, 0x24, 0x39,
+    0x82, 0x00, 0x05, 0x50, 0x26, 0x2B, 0x22, 0x1F, 0x34, 0x82, 0x1E, 0x06, 0x34, 0x1F, 0x22, 0x2D,
+    0x40, 0x29, 0x0D, 0xC5, 0x00, 0xD2, 0x00, 0x06, 0x39, 0x15, 0x1A, 0x1C, 0x07, 0x28, 0x32, 0x85,
+    0x00, 0x10, 0x21, 0x1E, 0x05, 0x0A, 0x05, 0x05, 0x0B, 0x3D, 0x00, 0x2C, 0x1E, 0x2B, 0x00, 0x00,
+    0x32, 0x1C, 0x07, 0x82, 0x03, 0x86, 0x01, 0x11, 0x07, 0x18, 0x0C, 0x03, 0x43, 0x13, 0x20, 0x50,
+    0x2A, 0x3C, 0x29, 0x05, 0x05, 0x0A, 0x05, 0x0A, 0x1E, 0x50, 0x85, 0x00, 0x05, 0x37, 0x0C, 0x03,
+    0x01, 0x1C, 0x45, 0x86, 0x00, 0x82, 0x4C, 0x80, 0x0D, 0xCB, 0x00, 0xD0, 0x00, 0x08, 0x0D, 0x00,
+    0x13, 0x0F, 0x0C, 0x07, 0x02, 0x03, 0x4F, 0x86, 0x00, 0x07, 0x1F, 0x2F, 0x27, 0x05, 0x0A, 0x05,
+    0x1E, 0x4C, 0x82, 0x00, 0x0E, 0x15, 0x14, 0x0C, 0x07, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x12,
+    0x12, 0x09, 0x02, 0x01, 0x83, 0x02, 0x07, 0x01, 0x0C, 0x07, 0x1B, 0x08, 0x00, 0x00, 0x48, 0x82,
+    0x2F, 0x03, 0x0B, 0x22, 0x00, 0x0D, 0x84, 0x00, 0x05, 0x19, 0x03, 0x02, 0x01, 0x03, 0x11, 0xD6,
+    0x00, 0xD3, 0x00, 0x06, 0x3A, 0x09, 0x01, 0x01, 0x07, 0x43, 0x08, 0x85, 0x00, 0x0E, 0x2A, 0x2F,
+    0x0B, 0x16, 0x0B, 0x2F, 0x2D, 0x00, 0x08, 0x15, 0x14, 0x03, 0x01, 0x01, 0x02, 0x83, 0x01, 0x80,
+    0x18, 0x84, 0x03, 0x83, 0x01, 0x0D, 0x07, 0x02, 0x01, 0x09, 0x25, 0x02, 0x17, 0x08, 0x00, 0x46,
+    0x3D, 0x1F, 0x22, 0x21, 0x85, 0x00, 0x06, 0x45, 0x01, 0x1D, 0x12, 0x25, 0x10, 0x08, 0xD6, 0x00,
+    0xD4, 0x00, 0x05, 0x33, 0x03, 0x01, 0x02, 0x03, 0x1A, 0x86, 0x00, 0x13, 0x3C, 0x2B, 0x2B, 0x2A,
+    0x29, 0x00, 0x15, 0x14, 0x03, 0x03, 0x02, 0x02, 0x01, 0x02, 0x18, 0x03, 0x03, 0x12, 0x1C, 0x19,
+    0x82, 0x1B, 0x07, 0x10, 0x02, 0x03, 0x01, 0x09, 0x09, 0x01, 0x07, 0x82, 0x01, 0x02, 0x03, 0x0F,
+    0x15, 0x86, 0x00, 0x09, 0x0D, 0x00, 0x0E, 0x08, 0x19, 0x0C, 0x01, 0x02, 0x03, 0x32, 0xD7, 0x00,
+    0xD4, 0x00, 0x08, 0x37, 0x07, 0x02, 0x01, 0x09, 0x03, 0x1A, 0x37, 0x38, 0x86, 0x00, 0x0E, 0x08,
+    0x15, 0x0F, 0x0C, 0x01, 0x02, 0x01, 0x02, 0x01, 0x0C, 0x03, 0x0F, 0x1B, 0x30, 0x08, 0x85, 0x00,
+    0x0F, 0x0E, 0x15, 0x14, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x09, 0x02, 0x01, 0x03, 0x0F, 0x36,
+    0x08, 0x84, 0x00, 0x07, 0x30, 0x35, 0x12, 0x43, 0x01, 0x01, 0x18, 0x10, 0xD8, 0x00, 0xD5, 0x00,
+    0x11, 0x1C, 0x03, 0x02, 0x01, 0x01, 0x03, 0x07, 0x03, 0x10, 0x3A, 0x00, 0x00, 0x08, 0x30, 0x13,
+    0x35, 0x4E, 0x03, 0x82, 0x02, 0x04, 0x03, 0x25, 0x0F, 0x13, 0x39, 0x8C, 0x00, 0x07, 0x32, 0x1C,
+    0x25, 0x03, 0x01, 0x02, 0x02, 0x07, 0x82, 0x01, 0x06, 0x03, 0x12, 0x13, 0x37, 0x37, 0x15, 0x19,
+    0x83, 0x01, 0x03, 0x18, 0x01, 0x01, 0x11, 0xD8, 0x00, 0xD5, 0x00, 0x80, 0x11, 0x83, 0x01, 0x11,
+    0x02, 0x09, 0x01, 0x0C, 0x01, 0x14, 0x14, 0x0F, 0x03, 0x25, 0x01, 0x09, 0x02, 0x09, 0x01, 0x03,
+    0x33, 0x51, 0x91, 0x00, 0x0A, 0x30, 0x33, 0x03, 0x03, 0x02, 0x09, 0x01, 0x07, 0x01, 0x12, 0x18,
+    0x84, 0x03, 0x06, 0x01, 0x02, 0x02, 0x09, 0x02, 0x03, 0x1A, 0x88, 0x00, 0x80, 0x0D, 0xCF, 0x00,
+    0xD6, 0x00, 0x03, 0x37, 0x07, 0x01, 0x12, 0x82, 0x01, 0x02, 0x02, 0x01, 0x03, 0x81, 0x01, 0x82,
+    0x02, 0x04, 0x01, 0x07, 0x0C, 0x02, 0x13, 0x95, 0x00, 0x13, 0x39, 0x10, 0x07, 0x03, 0x01, 0x02,
+    0x02, 0x01, 0x09, 0x01, 0x09, 0x02, 0x02, 0x01, 0x07, 0x01, 0x01, 0x1D, 0x0C, 0x47, 0xDA, 0x00,
+    0xD7, 0x00, 0x14, 0x3A, 0x0F, 0x4E, 0x12, 0x02, 0x02, 0x09, 0x07, 0x09, 0x02, 0x01, 0x02, 0x01,
+    0x07, 0x0C, 0x12, 0x1A, 0x08, 0x00, 0x31, 0x11, 0x82, 0x00, 0x04, 0x0E, 0x39, 0x17, 0x1A, 0x11,
+    0x82, 0x00, 0x13, 0x11, 0x13, 0x1B, 0x1B, 0x15, 0x0E, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x20, 0x13,
+    0x12, 0x4E, 0x01, 0x02, 0x02, 0x09, 0x02, 0x82, 0x01, 0x04, 0x02, 0x09, 0x02, 0x0C, 0x19, 0xDB,
+    0x00, 0xD8, 0x00, 0x05, 0x08, 0x13, 0x01, 0x0C, 0x03, 0x1D, 0x82, 0x01, 0x16, 0x03, 0x4E, 0x07,
+    0x14, 0x15, 0x08, 0x0E, 0x1A, 0x01, 0x12, 0x0E, 0x00, 0x00, 0x38, 0x0F, 0x25, 0x0C, 0x25, 0x03,
+    0x15, 0x00, 0x36, 0x01, 0x82, 0x03, 0x16, 0x0C, 0x02, 0x32, 0x00, 0x17, 0x0C, 0x14, 0x1A, 0x11,
+    0x0E, 0x31, 0x14, 0x03, 0x0C, 0x07, 0x07, 0x01, 0x03, 0x03, 0x07, 0x03, 0x01, 0x31, 0xDC, 0x00,
+    0xDA, 0x00, 0x36, 0x20, 0x17, 0x1C, 0x35, 0x01, 0x02, 0x0F, 0x1C, 0x17, 0x20, 0x00, 0x39, 0x10,
+    0x01, 0x28, 0x43, 0x3F, 0x00, 0x00, 0x1A, 0x03, 0x01, 0x02, 0x01, 0x12, 0x03, 0x09, 0x24, 0x03,
+    0x01, 0x12, 0x01, 0x02, 0x02, 0x01, 0x01, 0x0E, 0x00, 0x10, 0x4E, 0x18, 0x03, 0x1C, 0x31, 0x11,
+    0x32, 0x13, 0x1C, 0x02, 0x0F, 0x10, 0x15, 0x24, 0x10, 0x0E, 0xDD, 0x00, 0xDD, 0x00, 0x2C, 0x0E,
+    0x11, 0x3F, 0x00, 0x00, 0x08, 0x17, 0x0F, 0x0C, 0x25, 0x02, 0x01, 0x15, 0x00, 0x00, 0x13, 0x03,
+    0x09, 0x01, 0x07, 0x01, 0x1D, 0x01, 0x01, 0x0C, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x12, 0x0C,
+    0x24, 0x00, 0x45, 0x07, 0x02, 0x09, 0x25, 0x0C, 0x02, 0x4F, 0x32, 0x0E, 0x81, 0x08, 0x82, 0x00,
+    0x80, 0x08, 0xDE, 0x00, 0xE1, 0x00, 0x18, 0x32, 0x07, 0x25, 0x01, 0x07, 0x02, 0x01, 0x03, 0x11,
+    0x00, 0x1B, 0x0C, 0x02, 0x02, 0x1D, 0x01, 0x09, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x09, 0x12,
+    0x83, 0x01, 0x0B, 0x03, 0x32, 0x00, 0x24, 0x07, 0x01, 0x09, 0x02, 0x09, 0x0C, 0x03, 0x11, 0x85,
+    0x00, 0x80, 0x0D, 0xDD, 0x00, 0xDA, 0x00, 0x80, 0x0D, 0x85, 0x00, 0x10, 0x08, 0x1C, 0x03, 0x02,
+    0x09, 0x02, 0x03, 0x17, 0x00, 0x1B, 0x25, 0x02, 0x07, 0x02, 0x01, 0x01, 0x09, 0x82, 0x01, 0x15,
+    0x07, 0x09, 0x01, 0x02, 0x01, 0x09, 0x01, 0x01, 0x02, 0x03, 0x0F, 0x00, 0x31, 0x03, 0x01, 0x02,
+    0x01, 0x18, 0x12, 0x45, 0x00, 0x08, 0xE3, 0x00, 0xE3, 0x00, 0x24, 0x10, 0x0C, 0x01, 0x03, 0x17,
+    0x00, 0x13, 0x0C, 0x02, 0x02, 0x01, 0x09, 0x01, 0x01, 0x07, 0x01, 0x01, 0x02, 0x09, 0x07, 0x01,
+    0x09, 0x07, 0x07, 0x02, 0x56, 0x01, 0x02, 0x03, 0x1A, 0x00, 0x33, 0x07, 0x02, 0x03, 0x14, 0x20,
+    0xE6, 0x00, 0xDB, 0x00, 0x80, 0x0D, 0x86, 0x00, 0x06, 0x08, 0x19, 0x0C, 0x17, 0x00, 0x1A, 0x07,
+    0x82, 0x01, 0x09, 0x02, 0x07, 0x01, 0x07, 0x01, 0x1D, 0x1D, 0x09, 0x01, 0x1D, 0x88, 0x01, 0x06,
+    0x02, 0x0E, 0x11, 0x01, 0x03, 0x24, 0x08, 0xE7, 0x00, 0xE3, 0x00, 0x11, 0x0D, 0x00, 0x39, 0x00,
+    0x17, 0x0C, 0x02, 0x09, 0x02, 0x01, 0x09, 0x02, 0x07, 0x02, 0x01, 0x02, 0x02, 0x09, 0x82, 0x01,
+    0x80, 0x07, 0x85, 0x01, 0x05, 0x02, 0x0C, 0x24, 0x00, 0x15, 0x19, 0xE9, 0x00, 0xE5, 0x00, 0x04,
+    0x08, 0x00, 0x14, 0x03, 0x02, 0x82, 0x01, 0x04, 0x1D, 0x07, 0x01, 0x01, 0x07, 0x83, 0x01, 0x0C,
+    0x09, 0x02, 0x01, 0x09, 0x02, 0x1D, 0x01, 0x09, 0x07, 0x01, 0x12, 0x03, 0x38, 0xEB, 0x00, 0xE7,
+    0x00, 0x06, 0x11, 0x02, 0x01, 0x02, 0x07, 0x01, 0x02, 0x84, 0x01, 0x01, 0x07, 0x18, 0x82, 0x01,
+    0x0C, 0x09, 0x01, 0x01, 0x02, 0x01, 0x07, 0x02, 0x01, 0x01, 0x18, 0x37, 0x00, 0x08, 0xE9, 0x00,
+    0xE8, 0x00, 0x03, 0x11, 0x0F, 0x03, 0x02, 0x87, 0x01, 0x0D, 0x0F, 0x24, 0x03, 0x02, 0x01, 0x01,
+    0x02, 0x01, 0x07, 0x01, 0x09, 0x03, 0x02, 0x37, 0xEC, 0x00, 0xE9, 0x00, 0x0D, 0x0E, 0x10, 0x4E,
+    0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x25, 0x47, 0x17, 0x25, 0x81, 0x02, 0x83, 0x01, 0x03,
+    0x18, 0x25, 0x19, 0x0E, 0xED, 0x00, 0xE9, 0x00, 0x05, 0x0D, 0x00, 0x15, 0x33, 0x01, 0x07, 0x82,
+    0x03, 0x05, 0x01, 0x28, 0x13, 0x36, 0x28, 0x01, 0x82, 0x03, 0x03, 0x0C, 0x03, 0x24, 0x3A, 0xEF,
+    0x00, 0xED, 0x00, 0x0F, 0x0E, 0x15, 0x1A, 0x4F, 0x47, 0x1B, 0x1A, 0x0E, 0x3F, 0x19, 0x47, 0x10,
+    0x10, 0x19, 0x17, 0x11, 0xF1, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00,
+    0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00,
+    0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xBB, 0x00, 0x02, 0x2B, 0x3E, 0x2E,
+    0x81, 0x3E, 0x8A, 0x2E, 0x01, 0x3E, 0x4D, 0x83, 0x00, 0x08, 0x4D, 0x3E, 0x2E, 0x3E, 0x3E, 0x2E,
+    0x2E, 0x3E, 0x3D, 0x83, 0x00, 0x07, 0x2B, 0x3E, 0x2E, 0x3E, 0x3E, 0x2E, 0x3E, 0x23, 0x85, 0x00,
+    0x02, 0x3D, 0x3E, 0x2E, 0x82, 0x3E, 0x04, 0x2E, 0x3E, 0x26, 0x48, 0x3E, 0x82, 0x2E, 0x01, 0x41,
+    0x4C, 0x84, 0x00, 0x09, 0x3D, 0x3E, 0x2E, 0x3E, 0x3E, 0x2E, 0x0D, 0x4D, 0x3E, 0x2E, 0x81, 0x3E,
+    0x86, 0x2E, 0x81, 0x3E, 0x08, 0x2E, 0x3E, 0x41, 0x4C, 0x00, 0x00, 0x26, 0x3E, 0x2E, 0x82, 0x3E,
+    0x08, 0x2E, 0x3E, 0x23, 0x00, 0x00, 0x0D, 0x00, 0x49, 0x3E, 0x82, 0x2E, 0x01, 0x3E, 0x26, 0xBE,
+    0x00, 0xB9, 0x00, 0x04, 0x0D, 0x00, 0x2E, 0x04, 0x06, 0x8D, 0x04, 0x80, 0x2E, 0x83, 0x00, 0x02,
+    0x44, 0x04, 0x06, 0x82, 0x04, 0x07, 0x06, 0x04, 0x3E, 0x00, 0x00, 0x0D, 0x00, 0x3D, 0x82, 0x04,
+    0x80, 0x06, 0x82, 0x04, 0x80, 0x2B, 0x83, 0x00, 0x01, 0x4C, 0x44, 0x86, 0x04, 0x07, 0x40, 0x23,
+    0x04, 0x06, 0x04, 0x04, 0x42, 0x21, 0x83, 0x00, 0x08, 0x0D, 0x53, 0x04, 0x06, 0x04, 0x04, 0x4A,
+    0x4C, 0x2E, 0x8F, 0x04, 0x05, 0x49, 0x00, 0x00, 0x4D, 0x04, 0x06, 0x84, 0x04, 0x01, 0x4A, 0x3C,
+    0x82, 0x00, 0x02, 0x48, 0x04, 0x06, 0x82, 0x04, 0x80, 0x2B, 0xBE, 0x00, 0xBA, 0x00, 0x07, 0x0D,
+    0x42, 0x04, 0x06, 0x06, 0x04, 0x06, 0x3E, 0x82, 0x54, 0x80, 0x23, 0x83, 0x54, 0x07, 0x23, 0x41,
+    0x48, 0x00, 0x0D, 0x00, 0x40, 0x04, 0x85, 0x06, 0x07, 0x04, 0x4A, 0x3C, 0x00, 0x0D, 0x00, 0x3D,
+    0x04, 0x82, 0x06, 0x09, 0x04, 0x06, 0x04, 0x2E, 0x00, 0x0D, 0x00, 0x00, 0x48, 0x04, 0x85, 0x06,
+    0x08, 0x04, 0x40, 0x23, 0x04, 0x06, 0x06, 0x04, 0x42, 0x21, 0x82, 0x00, 0x14, 0x0D, 0x00, 0x53,
+    0x04, 0x4A, 0x06, 0x04, 0x4A, 0x4C, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x42, 0x54, 0x23, 0x23, 0x41,
+    0x44, 0x04, 0x83, 0x06, 0x05, 0x04, 0x53, 0x00, 0x00, 0x3E, 0x04, 0x86, 0x06, 0x05, 0x49, 0x00,
+    0x4C, 0x00, 0x48, 0x04, 0x82, 0x06, 0x01, 0x04, 0x2B, 0xBE, 0x00, 0xBA, 0x00, 0x80, 0x40, 0x82,
+    0x04, 0x04, 0x06, 0x04, 0x3D, 0x00, 0x0D, 0x8C, 0x00, 0x1D, 0x4D, 0x04, 0x06, 0x04, 0x04, 0x06,
+    0x04, 0x04, 0x06, 0x04, 0x3D, 0x00, 0x0D, 0x00, 0x3D, 0x04, 0x06, 0x04, 0x06, 0x06, 0x04, 0x04,
+    0x4A, 0x26, 0x00, 0x00, 0x0D, 0x44, 0x04, 0x06, 0x83, 0x04, 0x09, 0x06, 0x04, 0x40, 0x23, 0x04,
+    0x06, 0x04, 0x04, 0x42, 0x21, 0x82, 0x00, 0x0E, 0x0D, 0x00, 0x53, 0x04, 0x06, 0x06, 0x04, 0x4A,
+    0x4C, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0x84, 0x00, 0x18, 0x41, 0x04, 0x06, 0x04, 0x06, 0x04,
+    0x41, 0x00, 0x26, 0x4A, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x06, 0x04, 0x23, 0x00, 0x4C, 0x00,
+    0x48, 0x04, 0x06, 0x82, 0x04, 0x02, 0x2B, 0x00, 0x0D, 0xBC, 0x00, 0xBA, 0x00, 0x01, 0x49, 0x04,
+    0x82, 0x06, 0x04, 0x42, 0x0D, 0x00, 0x0D, 0x00, 0x82, 0x0D, 0x0B, 0x00, 0x0D, 0x0D, 0x00, 0x0D,
+    0x0D, 0x00, 0x0D, 0x00, 0x3E, 0x04, 0x06, 0x82, 0x04, 0x09, 0x06, 0x04, 0x06, 0x04, 0x41, 0x00,
+    0x4C, 0x00, 0x3D, 0x04, 0x81, 0x06, 0x81, 0x04, 0x82, 0x06, 0x03, 0x53, 0x00, 0x00, 0x48, 0x85,
+    0x04, 0x81, 0x06, 0x08, 0x04, 0x40, 0x23, 0x04, 0x06, 0x06, 0x04, 0x42, 0x21, 0x82, 0x00, 0x0F,
+    0x0D, 0x00, 0x53, 0x04, 0x06, 0x04, 0x04, 0x4A, 0x0D, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0x00,
+    0x82, 0x0D, 0x18, 0x00, 0x46, 0x06, 0x04, 0x04, 0x06, 0x04, 0x41, 0x00, 0x3D, 0x04, 0x06, 0x04,
+    0x06, 0x06, 0x04, 0x04, 0x06, 0x04, 0x44, 0x00, 0x0D, 0x00, 0x48, 0x04, 0x82, 0x06, 0x01, 0x04,
+    0x2B, 0xBE, 0x00, 0xBA, 0x00, 0x07, 0x48, 0x04, 0x06, 0x04, 0x04, 0x4A, 0x29, 0x00, 0x81, 0x0D,
+    0x8A, 0x00, 0x2C, 0x3C, 0x4A, 0x04, 0x06, 0x04, 0x06, 0x42, 0x04, 0x06, 0x06, 0x04, 0x42, 0x4C,
+    0x00, 0x00, 0x3D, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x06, 0x04, 0x42, 0x21, 0x00, 0x44, 0x04,
+    0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x40, 0x23, 0x04, 0x06, 0x04, 0x04, 0x42, 0x21,
+    0x82, 0x00, 0x21, 0x0D, 0x00, 0x53, 0x04, 0x06, 0x06, 0x04, 0x4A, 0x21, 0x2E, 0x04, 0x06, 0x06,
+    0x04, 0x44, 0x00, 0x0D, 0x00, 0x4C, 0x00, 0x26, 0x06, 0x04, 0x06, 0x06, 0x04, 0x54, 0x00, 0x2E,
+    0x04, 0x06, 0x06, 0x04, 0x42, 0x82, 0x06, 0x07, 0x04, 0x4A, 0x26, 0x00, 0x00, 0x48, 0x04, 0x06,
+    0x82, 0x04, 0x80, 0x2B, 0xBE, 0x00, 0xB8, 0x00, 0x03, 0x0D, 0x00, 0x48, 0x04, 0x82, 0x06, 0x02,
+    0x04, 0x2E, 0x21, 0x8C, 0x00, 0x07, 0x3D, 0x04, 0x04, 0x06, 0x04, 0x44, 0x4D, 0x04, 0x82, 0x06,
+    0x05, 0x04, 0x2B, 0x00, 0x00, 0x3D, 0x04, 0x82, 0x06, 0x82, 0x04, 0x05, 0x06, 0x04, 0x3D, 0x49,
+    0x04, 0x06, 0x83, 0x04, 0x81, 0x06, 0x81, 0x04, 0x07, 0x40, 0x23, 0x04, 0x06, 0x06, 0x04, 0x42,
+    0x21, 0x82, 0x00, 0x0E, 0x0D, 0x00, 0x53, 0x04, 0x06, 0x06, 0x04, 0x4A, 0x0D, 0x2E, 0x04, 0x06,
+    0x06, 0x04, 0x44, 0x82, 0x00, 0x03, 0x0D, 0x00, 0x4D, 0x04, 0x82, 0x06, 0x09, 0x04, 0x48, 0x00,
+    0x42, 0x04, 0x06, 0x04, 0x06, 0x4D, 0x06, 0x83, 0x04, 0x0B, 0x48, 0x00, 0x00, 0x48, 0x04, 0x04,
+    0x4A, 0x42, 0x42, 0x26, 0x00, 0x0D, 0xBC, 0x00, 0xBA, 0x00, 0x02, 0x3D, 0x04, 0x06, 0x83, 0x04,
+    0x05, 0x42, 0x2E, 0x4D, 0x3D, 0x26, 0x21, 0x87, 0x00, 0x06, 0x41, 0x04, 0x06, 0x04, 0x04, 0x2E,
+    0x40, 0x82, 0x04, 0x05, 0x06, 0x04, 0x4D, 0x00, 0x00, 0x3D, 0x83, 0x04, 0x18, 0x06, 0x04, 0x06,
+    0x06, 0x04, 0x44, 0x44, 0x04, 0x04, 0x06, 0x06, 0x04, 0x04, 0x06, 0x04, 0x06, 0x04, 0x40, 0x23,
+    0x04, 0x06, 0x06, 0x04, 0x42, 0x21, 0x84, 0x00, 0x0D, 0x53, 0x04, 0x06, 0x04, 0x04, 0x4A, 0x0D,
+    0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0x49, 0x82, 0x3D, 0x80, 0x23, 0x85, 0x04, 0x81, 0x40, 0x83,
+    0x04, 0x0B, 0x42, 0x3C, 0x44, 0x42, 0x3E, 0x41, 0x41, 0x49, 0x00, 0x00, 0x26, 0x49, 0x81, 0x2B,
+    0x81, 0x49, 0x81, 0x3D, 0xBD, 0x00, 0xB8, 0x00, 0x08, 0x0D, 0x00, 0x26, 0x4A, 0x04, 0x06, 0x04,
+    0x04, 0x06, 0x83, 0x04, 0x04, 0x06, 0x42, 0x3E, 0x4D, 0x29, 0x83, 0x00, 0x15, 0x0D, 0x42, 0x04,
+    0x06, 0x06, 0x04, 0x4D, 0x00, 0x42, 0x04, 0x06, 0x06, 0x04, 0x44, 0x00, 0x00, 0x3D, 0x04, 0x06,
+    0x06, 0x04, 0x06, 0x82, 0x04, 0x02, 0x06, 0x04, 0x06, 0x85, 0x04, 0x80, 0x06, 0x82, 0x04, 0x07,
+    0x40, 0x23, 0x04, 0x06, 0x04, 0x04, 0x42, 0x21, 0x82, 0x00, 0x0B, 0x0D, 0x00, 0x4D, 0x04, 0x4A,
+    0x04, 0x04, 0x4A, 0x21, 0x2E, 0x04, 0x06, 0x87, 0x04, 0x1D, 0x4A, 0x42, 0x44, 0x3E, 0x3E, 0x23,
+    0x00, 0x2B, 0x4D, 0x3D, 0x49, 0x49, 0x2B, 0x40, 0x26, 0x21, 0x3D, 0x48, 0x4D, 0x23, 0x3E, 0x3D,
+    0x00, 0x00, 0x41, 0x06, 0x06, 0x04, 0x04, 0x44, 0xBD, 0x00, 0xBB, 0x00, 0x01, 0x23, 0x04, 0x83,
+    0x06, 0x80, 0x04, 0x82, 0x06, 0x83, 0x04, 0x01, 0x4A, 0x49, 0x82, 0x00, 0x08, 0x2B, 0x04, 0x06,
+    0x04, 0x06, 0x04, 0x49, 0x00, 0x2E, 0x82, 0x06, 0x06, 0x04, 0x06, 0x26, 0x00, 0x48, 0x04, 0x06,
+    0x84, 0x04, 0x01, 0x06, 0x04, 0x8A, 0x06, 0x08, 0x04, 0x40, 0x23, 0x04, 0x06, 0x04, 0x04, 0x42,
+    0x21, 0x82, 0x00, 0x02, 0x0D, 0x00, 0x53, 0x83, 0x04, 0x09, 0x42, 0x4C, 0x41, 0x42, 0x2E, 0x41,
+    0x23, 0x53, 0x4D, 0x3D, 0x82, 0x49, 0x10, 0x2B, 0x49, 0x3D, 0x3D, 0x48, 0x48, 0x41, 0x2B, 0x00,
+    0x2E, 0x44, 0x42, 0x42, 0x04, 0x3D, 0x00, 0x42, 0x83, 0x04, 0x08, 0x2E, 0x00, 0x00, 0x3E, 0x04,
+    0x04, 0x06, 0x04, 0x44, 0xBD, 0x00, 0xBC, 0x00, 0x01, 0x53, 0x4A, 0x82, 0x04, 0x81, 0x06, 0x02,
+    0x04, 0x06, 0x04, 0x82, 0x06, 0x18, 0x04, 0x06, 0x2B, 0x00, 0x00, 0x4D, 0x04, 0x06, 0x06, 0x04,
+    0x4A, 0x3C, 0x00, 0x48, 0x04, 0x06, 0x04, 0x06, 0x04, 0x48, 0x00, 0x48, 0x04, 0x06, 0x04, 0x88,
+    0x06, 0x88, 0x04, 0x07, 0x40, 0x23, 0x04, 0x06, 0x04, 0x04, 0x44, 0x21, 0x84, 0x00, 0x12, 0x2B,
+    0x4D, 0x3D, 0x49, 0x49, 0x2B, 0x2B, 0x40, 0x4C, 0x3D, 0x4D, 0x4D, 0x23, 0x41, 0x2E, 0x3E, 0x42,
+    0x42, 0x4A, 0x84, 0x04, 0x02, 0x4A, 0x29, 0x40, 0x83, 0x04, 0x10, 0x06, 0x40, 0x00, 0x2E, 0x04,
+    0x4A, 0x06, 0x04, 0x42, 0x21, 0x00, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0xBD, 0x00, 0xBD, 0x00,
+    0x03, 0x3C, 0x4D, 0x3E, 0x4A, 0x82, 0x04, 0x82, 0x06, 0x81, 0x04, 0x17, 0x06, 0x04, 0x44, 0x00,
+    0x00, 0x3E, 0x04, 0x06, 0x04, 0x04, 0x3E, 0x00, 0x00, 0x40, 0x04, 0x06, 0x04, 0x06, 0x04, 0x2E,
+    0x00, 0x48, 0x04, 0x06, 0x8A, 0x04, 0x10, 0x06, 0x4A, 0x42, 0x42, 0x3E, 0x2E, 0x41, 0x23, 0x3C,
+    0x2B, 0x48, 0x2B, 0x49, 0x49, 0x2B, 0x2B, 0x46, 0x85, 0x00, 0x07, 0x23, 0x44, 0x42, 0x42, 0x04,
+    0x41, 0x4C, 0x4A, 0x8A, 0x04, 0x81, 0x06, 0x0D, 0x04, 0x48, 0x00, 0x55, 0x04, 0x06, 0x06, 0x04,
+    0x44, 0x00, 0x00, 0x48, 0x04, 0x06, 0x82, 0x04, 0x07, 0x2B, 0x00, 0x3E, 0x04, 0x06, 0x06, 0x04,
+    0x44, 0xBD, 0x00, 0xC0, 0x00, 0x06, 0x29, 0x2B, 0x4D, 0x3E, 0x06, 0x06, 0x04, 0x83, 0x06, 0x1F,
+    0x04, 0x26, 0x29, 0x4A, 0x04, 0x06, 0x06, 0x04, 0x23, 0x00, 0x0D, 0x00, 0x44, 0x04, 0x06, 0x04,
+    0x04, 0x4A, 0x00, 0x3D, 0x04, 0x06, 0x42, 0x42, 0x44, 0x3E, 0x3E, 0x2E, 0x4D, 0x48, 0x48, 0x3D,
+    0x83, 0x49, 0x81, 0x3D, 0x06, 0x48, 0x4D, 0x53, 0x41, 0x23, 0x50, 0x3E, 0x82, 0x42, 0x03, 0x04,
+    0x41, 0x00, 0x0D, 0x83, 0x00, 0x08, 0x44, 0x04, 0x04, 0x06, 0x04, 0x41, 0x4C, 0x4A, 0x04, 0x82,
+    0x06, 0x83, 0x04, 0x81, 0x06, 0x1B, 0x04, 0x06, 0x04, 0x23, 0x00, 0x00, 0x44, 0x04, 0x06, 0x06,
+    0x04, 0x41, 0x00, 0x00, 0x26, 0x06, 0x04, 0x04, 0x06, 0x04, 0x4D, 0x00, 0x3E, 0x04, 0x06, 0x06,
+    0x04, 0x44, 0xBD, 0x00, 0xBE, 0x00, 0x81, 0x0D, 0x83, 0x00, 0x01, 0x26, 0x23, 0x83, 0x04, 0x01,
+    0x06, 0x04, 0x81, 0x3D, 0x84, 0x04, 0x0B, 0x49, 0x00, 0x0D, 0x00, 0x53, 0x44, 0x54, 0x23, 0x4D,
+    0x48, 0x4C, 0x3C, 0x82, 0x2B, 0x0C, 0x49, 0x3D, 0x48, 0x49, 0x40, 0x54, 0x41, 0x3E, 0x3E, 0x44,
+    0x42, 0x4A, 0x04, 0x81, 0x44, 0x83, 0x04, 0x02, 0x42, 0x3C, 0x42, 0x83, 0x04, 0x02, 0x41, 0x00,
+    0x0D, 0x83, 0x00, 0x07, 0x44, 0x04, 0x06, 0x06, 0x04, 0x41, 0x4C, 0x4A, 0x83, 0x04, 0x21, 0x4A,
+    0x42, 0x4A, 0x06, 0x04, 0x04, 0x06, 0x04, 0x48, 0x00, 0x00, 0x26, 0x4A, 0x04, 0x04, 0x06, 0x04,
+    0x48, 0x00, 0x0D, 0x0D, 0x44, 0x04, 0x04, 0x06, 0x04, 0x3E, 0x00, 0x3E, 0x04, 0x06, 0x06, 0x04,
+    0x44, 0xBD, 0x00, 0xC0, 0x00, 0x80, 0x0D, 0x84, 0x00, 0x0E, 0x2E, 0x04, 0x42, 0x44, 0x3E, 0x44,
+    0x3D, 0x49, 0x23, 0x48, 0x48, 0x3D, 0x49, 0x3C, 0x26, 0x83, 0x00, 0x07, 0x48, 0x23, 0x23, 0x2E,
+    0x44, 0x44, 0x00, 0x23, 0x83, 0x04, 0x01, 0x44, 0x2B, 0x85, 0x04, 0x11, 0x06, 0x04, 0x3D, 0x53,
+    0x04, 0x4A, 0x06, 0x04, 0x44, 0x29, 0x42, 0x04, 0x06, 0x06, 0x04, 0x41, 0x00, 0x4C, 0x83, 0x00,
+    0x0F, 0x44, 0x04, 0x06, 0x06, 0x04, 0x41, 0x0D, 0x4A, 0x04, 0x06, 0x06, 0x04, 0x4D, 0x00, 0x23,
+    0x04, 0x82, 0x06, 0x05, 0x04, 0x23, 0x00, 0x00, 0x48, 0x04, 0x82, 0x06, 0x11, 0x04, 0x40, 0x00,
+    0x0D, 0x00, 0x41, 0x04, 0x06, 0x04, 0x04, 0x4A, 0x4C, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0xBD,
+    0x00, 0xC6, 0x00, 0x13, 0x3C, 0x40, 0x40, 0x3D, 0x3D, 0x48, 0x4D, 0x53, 0x2B, 0x41, 0x3E, 0x3E,
+    0x44, 0x04, 0x41, 0x00, 0x0D, 0x0D, 0x00, 0x2E, 0x84, 0x04, 0x09, 0x49, 0x54, 0x04, 0x06, 0x06,
+    0x04, 0x44, 0x00, 0x3E, 0x04, 0x82, 0x06, 0x81, 0x04, 0x0F, 0x06, 0x29, 0x23, 0x04, 0x06, 0x06,
+    0x04, 0x42, 0x29, 0x42, 0x04, 0x04, 0x06, 0x04, 0x42, 0x4C, 0x83, 0x00, 0x1E, 0x26, 0x06, 0x04,
+    0x06, 0x06, 0x04, 0x41, 0x4C, 0x4A, 0x04, 0x06, 0x06, 0x04, 0x4D, 0x00, 0x40, 0x04, 0x04, 0x06,
+    0x06, 0x04, 0x42, 0x21, 0x00, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x42, 0x4C, 0x82, 0x00, 0x0C, 0x3D,
+    0x04, 0x04, 0x06, 0x06, 0x04, 0x49, 0x2E, 0x04, 0x06, 0x06, 0x04, 0x44, 0xBD, 0x00, 0xC8, 0x00,
+    0x80, 0x3E, 0x84, 0x04, 0x1B, 0x2E, 0x06, 0x04, 0x04, 0x06, 0x04, 0x48, 0x00, 0x0D, 0x0D, 0x00,
+    0x3D, 0x04, 0x4A, 0x06, 0x4A, 0x04, 0x53, 0x41, 0x04, 0x06, 0x06, 0x04, 0x44, 0x00, 0x4D, 0x04,
+    0x4A, 0x82, 0x06, 0x0B, 0x04, 0x3E, 0x00, 0x41, 0x04, 0x4A, 0x06, 0x04, 0x44, 0x29, 0x42, 0x04,
+    0x82, 0x06, 0x07, 0x04, 0x41, 0x21, 0x00, 0x00, 0x3C, 0x3E, 0x04, 0x82, 0x06, 0x0C, 0x04, 0x41,
+    0x0D, 0x4A, 0x04, 0x06, 0x06, 0x04, 0x4D, 0x00, 0x00, 0x44, 0x04, 0x82, 0x06, 0x0E, 0x04, 0x49,
+    0x00, 0x42, 0x04, 0x06, 0x06, 0x04, 0x2E, 0x00, 0x0D, 0x00, 0x00, 0x26, 0x4A, 0x82, 0x06, 0x07,
+    0x04, 0x4D, 0x41, 0x04, 0x06, 0x06, 0x04, 0x44, 0xBD, 0x00, 0xC7, 0x00, 0x01, 0x26, 0x4A, 0x84,
+    0x04, 0x80, 0x06, 0x84, 0x04, 0x80, 0x46, 0x83, 0x00, 0x80, 0x46, 0x84, 0x04, 0x01, 0x44, 0x2E,
+    0x83, 0x04, 0x04, 0x44, 0x00, 0x26, 0x4A, 0x04, 0x82, 0x06, 0x03, 0x04, 0x4D, 0x00, 0x41, 0x83,
+    0x04, 0x02, 0x42, 0x29, 0x42, 0x86, 0x04, 0x01, 0x42, 0x4A, 0x84, 0x04, 0x0C, 0x06, 0x04, 0x41,
+    0x4C, 0x4A, 0x04, 0x04, 0x06, 0x04, 0x4D, 0x00, 0x00, 0x4D, 0x82, 0x04, 0x03, 0x06, 0x04, 0x2E,
+    0x2B, 0x84, 0x04, 0x80, 0x4D, 0x84, 0x00, 0x0B, 0x44, 0x04, 0x06, 0x04, 0x04, 0x44, 0x2E, 0x04,
+    0x06, 0x06, 0x04, 0x44, 0xBD, 0x00, 0xC7, 0x00, 0x01, 0x40, 0x41, 0x89, 0x23, 0x01, 0x4D, 0x4C,
+    0x84, 0x00, 0x80, 0x4D, 0x83, 0x23, 0x0A, 0x55, 0x3D, 0x54, 0x23, 0x23, 0x54, 0x4D, 0x00, 0x00,
+    0x4D, 0x54, 0x83, 0x23, 0x03, 0x26, 0x00, 0x3D, 0x41, 0x82, 0x23, 0x03, 0x4D, 0x00, 0x3D, 0x41,
+    0x83, 0x23, 0x03, 0x53, 0x23, 0x41, 0x54, 0x85, 0x23, 0x03, 0x41, 0x2B, 0x00, 0x53, 0x82, 0x23,
+    0x04, 0x41, 0x2B, 0x00, 0x00, 0x3C, 0x84, 0x23, 0x07, 0x4D, 0x49, 0x41, 0x23, 0x23, 0x53, 0x23,
+    0x26, 0x84, 0x00, 0x01, 0x3D, 0x41, 0x82, 0x23, 0x06, 0x4D, 0x3D, 0x54, 0x23, 0x23, 0x54, 0x4D,
+    0xBD, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xC9, 0x00, 0x81, 0x0D, 0x80, 0x00, 0x82, 0x0D, 0x80, 0x00,
+    0x83, 0x0D, 0x85, 0x00, 0x01, 0x0D, 0x00, 0x83, 0x0D, 0x80, 0x00, 0x83, 0x0D, 0x83, 0x00, 0x01,
+    0x0D, 0x00, 0x81, 0x0D, 0x84, 0x00, 0x0A, 0x4C, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x0D,
+    0x0D, 0x00, 0x84, 0x0D, 0x02, 0x00, 0x4C, 0x00, 0x82, 0x0D, 0x81, 0x00, 0x04, 0x0D, 0x00, 0x00,
+    0x4C, 0x0D, 0x83, 0x00, 0x09, 0x0D, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x81,
+    0x0D, 0x85, 0x00, 0x01, 0x0D, 0x00, 0x82, 0x0D, 0x81, 0x00, 0x01, 0x0D, 0x00, 0x81, 0x0D, 0xBE,
+    0x00, 0xEF, 0x00, 0xFF, 0x00, 0xE0, 0x00, 0x80, 0x0D, 0xC3, 0x00, 0x80, 0x0D, 0xC8, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF, 0x00, 0xFF, 0x00, 0xEF,
+    0x00, 0xFF, 0x00,
+};
+// clang-format on
+
+const painter_rle565_image_t gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_rle565 = {
+    .width        = 240,
+    .height       = 320,
+    .palette_size = 87,
+    .palette      = gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_palette,
+    .data_size    = 16547,
+    .data         = gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_data,
+};
@@ -34,7 +34,6 @@
 #endif // COMMUNITY_MODULE_UNICODE_TYPING_ENABLE
 
 static painter_device_t       display;
-painter_image_handle_t        screen_saver;
 extern painter_image_handle_t windows_logo, apple_logo, linux_logo;
 extern painter_image_handle_t mouse_icon, gamepad_icon;
 extern painter_image_handle_t akira_explosion;
@@ -168,13 +167,15 @@ __attribute__((weak)) bool screen_saver_sanity_checks(void) {
     return false;
 }
 
-__attribute__((weak)) void ili9341_draw_user(void) {
+__attribute__((weak)) void ili9341_draw_user(uint16_t damage) {
     bool        hue_redraw          = forced_reinit;
     static bool screen_saver_redraw = false;
+    // image the screensaver is showing, so that cycling back to it doesn't draw it again
+    static const painter_rle565_image_t* screen_saver = NULL;
 
     static dual_hsv_t curr_hsv = {0};
-    if (memcmp(&curr_hsv, &userspace_config.display.painter.hsv, sizeof(dual_hsv_t)) != 0) {
-        curr_hsv   = painter_get_dual_hsv();
+    if (memcmp(&curr_hsv, &PAINTER_STATE(userspace_config).display.painter.hsv, sizeof(dual_hsv_t)) != 0) {
+        curr_hsv   = PAINTER_STATE(userspace_config).display.painter.hsv;
         hue_redraw = true;
     }
     const uint8_t disabled_val = curr_hsv.primary.v / 2;
@@ -189,11 +190,11 @@ __attribute__((weak)) void ili9341_draw_user(void) {
         bool            display_logo_cycle = false;
 
         if (is_keyboard_left()) {
-            display_logo_index = userspace_config.display.painter.left.display_logo;
-            display_logo_cycle = userspace_config.display.painter.left.display_logo_cycle;
+            display_logo_index = PAINTER_STATE(userspace_config).display.painter.left.display_logo;
+            display_logo_cycle = PAINTER_STATE(userspace_config).display.painter.left.display_logo_cycle;
         } else {
-            display_logo_index = userspace_config.display.painter.right.display_logo;
-            display_logo_cycle = userspace_config.display.painter.right.display_logo_cycle;
+            display_logo_index = PAINTER_STATE(userspace_config).display.painter.right.display_logo;
+            display_logo_cycle = PAINTER_STATE(userspace_config).display.painter.right.display_logo_cycle;
         }
 #ifdef SCREENSAVER_TESTING_ENABLE
         if (display_logo_cycle && timer_elapsed(screen_saver_timer) > 1000)
@@ -216,18 +217,21 @@ __attribute__((weak)) void ili9341_draw_user(void) {
         }
         if (screen_saver_redraw == false) {
             screen_saver_redraw = true;
-            screen_saver        = qp_load_image_mem(
-                screen_saver_image[(display_logo_index + display_mode_ref) % screensaver_image_size].data);
-            if (screen_saver != NULL) {
-                qp_drawimage(display, 0, 0, screen_saver);
-                qp_close_image(screen_saver);
-            } else {
-                qp_rect(display, 0, 0, width - 1, height - 1, 0, 0, 0, true);
+            const painter_rle565_image_t* image =
+                screen_saver_image[(display_logo_index + display_mode_ref) % screensaver_image_size].image;
+            if (image != screen_saver) {
+                if (painter_rle565_draw(display, 0, 0, image)) {
+                    screen_saver = image;
+                } else {
+                    screen_saver = NULL;
+                    qp_rect(display, 0, 0, width - 1, height - 1, 0, 0, 0, true);
+                }
             }
         }
     } else {
         if (screen_saver_redraw) {
-            hue_redraw = true;
+            screen_saver = NULL;
+            hue_redraw   = true;
             qp_rect(display, 0, 0, width - 1, height - 1, 0, 0, 0, true);
         }
         if (hue_redraw) {
@@ -259,15 +263,19 @@ __attribute__((weak)) void ili9341_draw_user(void) {
         uint16_t ypos    = 20;
         uint16_t xpos    = 5;
 
-        painter_render_scan_rate(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_TIMER)) {
+            painter_render_scan_rate(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+        }
         ypos += font_oled->line_height + 4;
         if (painter_render_side()) {
             ypos = 20;
             xpos = 83;
 #if defined(RGB_MATRIX_ENABLE)
-            painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
-                               "RGB Matrix Config:", rgb_matrix_get_effect_name, rgb_matrix_get_hsv,
-                               rgb_matrix_is_enabled(), RGB_MATRIX_MAXIMUM_BRIGHTNESS);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_RGB)) {
+                painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
+                                   "RGB Matrix Config:", rgb_matrix_get_effect_name, rgb_matrix_get_hsv,
+                                   rgb_matrix_is_enabled(), RGB_MATRIX_MAXIMUM_BRIGHTNESS);
+            }
 #endif // RGB_MATRIX_ENABLE
 
             //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -275,7 +283,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 
             ypos = 24;
             xpos = 212;
-            painter_render_lock_state(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv, disabled_val);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_LED_STATE)) {
+                painter_render_lock_state(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv, disabled_val);
+            }
 
             ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
             // Keymap config (nkro, autocorrect, oneshots)
@@ -283,13 +293,15 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             ypos                                        = 54 + 4;
             static keymap_config_t last_keymap_config   = {0};
             bool                   keymap_config_redraw = false;
-            if (last_keymap_config.raw != keymap_config.raw) {
-                last_keymap_config.raw = keymap_config.raw;
+            bool                   keymap_config_damage =
+                painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC | PAINTER_DAMAGE_HOST_OS);
+            if (keymap_config_damage && last_keymap_config.raw != PAINTER_STATE(keymap_config).raw) {
+                last_keymap_config.raw = PAINTER_STATE(keymap_config).raw;
                 keymap_config_redraw   = true;
             }
 #ifdef CAPS_WORD_ENABLE
             static bool caps_words = false;
-            if (caps_words != is_caps_word_on()) {
+            if (painter_damage_has(damage, PAINTER_DAMAGE_MODS) && caps_words != is_caps_word_on()) {
                 caps_words           = is_caps_word_on();
                 keymap_config_redraw = true;
             }
@@ -328,8 +340,10 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 
             ypos += font_oled->line_height + 4;
             static userspace_runtime_state_t last_user_state = {0};
-            if (hue_redraw || memcmp(&userspace_runtime_state, &last_user_state, sizeof(userspace_runtime_state))) {
-                memcpy(&last_user_state, &userspace_runtime_state, sizeof(userspace_runtime_state));
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC) &&
+                               memcmp(&PAINTER_STATE(userspace_runtime_state), &last_user_state,
+                                      sizeof(userspace_runtime_state_t)))) {
+                memcpy(&last_user_state, &PAINTER_STATE(userspace_runtime_state), sizeof(userspace_runtime_state_t));
                 xpos = 80 + 4 + windows_logo->width + 5;
                 xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, "AUDIO",
                                             last_user_state.audio.enable ? curr_hsv.secondary.h : curr_hsv.primary.h,
@@ -360,7 +374,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             ypos = 84;
             xpos = 84;
 
-            painter_render_keylogger(display, font_oled, xpos, ypos, 150, hue_redraw, &curr_hsv);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+                painter_render_keylogger(display, font_oled, xpos, ypos, 150, hue_redraw, &curr_hsv);
+            }
 #endif // DISPLAY_KEYLOGGER_ENABLE
 
             ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,7 +388,8 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #        include QMK_KEYBOARD_H
 
             static uint16_t last_cpi = 0xFFFF;
-            if (hue_redraw || last_cpi != charybdis_get_pointer_default_dpi()) {
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) &&
+                               last_cpi != charybdis_get_pointer_default_dpi())) {
                 last_cpi = charybdis_get_pointer_default_dpi();
                 xpos     = 5;
                 xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, "CPI:   ", curr_hsv.primary.h,
@@ -389,7 +406,7 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #    ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
             static uint8_t last_am_state     = 0xFF;
             bool           auto_mouse_redraw = false;
-            if (last_am_state != get_auto_mouse_enable()) {
+            if (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) && last_am_state != get_auto_mouse_enable()) {
                 last_am_state     = get_auto_mouse_enable();
                 auto_mouse_redraw = true;
             }
@@ -401,7 +418,8 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             ypos += font_oled->line_height + 4;
 
             static uint8_t last_am_layer = 0xFF;
-            if (hue_redraw || last_am_layer != get_auto_mouse_layer() || auto_mouse_redraw) {
+            if (hue_redraw || auto_mouse_redraw ||
+                (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) && last_am_layer != get_auto_mouse_layer())) {
                 last_am_layer = get_auto_mouse_layer();
                 xpos          = 5;
                 snprintf(buf, sizeof(buf), "%12s", get_layer_name_string(get_auto_mouse_layer(), false, true));
@@ -420,7 +438,8 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 
 #    if (defined(KEYBOARD_bastardkb_charybdis) || defined(KEYBOARD_handwired_tractyl_manuform))
             static uint32_t last_ds_state = 0xFFFFFFFF;
-            if (hue_redraw || last_ds_state != charybdis_get_pointer_dragscroll_enabled()) {
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) &&
+                               last_ds_state != charybdis_get_pointer_dragscroll_enabled())) {
                 last_ds_state = charybdis_get_pointer_dragscroll_enabled();
                 xpos          = 5;
                 xpos += qp_drawtext_recolor(
@@ -439,7 +458,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 
             static bool last_accel_state = false;
 
-            if (hue_redraw || last_accel_state != pointing_device_accel_get_enabled()) {
+            if (hue_redraw ||
+                (painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_POINTING | PAINTER_DAMAGE_HOST_OS) &&
+                 last_accel_state != pointing_device_accel_get_enabled())) {
                 last_accel_state = pointing_device_accel_get_enabled();
                 xpos             = 5;
                 xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, "Acceleration",
@@ -454,7 +475,8 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             // Pointing Device Sniping mode
             static uint8_t last_sp_state = 0xFF;
 
-            if (hue_redraw || last_sp_state != charybdis_get_pointer_sniping_enabled()) {
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) &&
+                               last_sp_state != charybdis_get_pointer_sniping_enabled())) {
                 last_sp_state = charybdis_get_pointer_sniping_enabled();
                 xpos          = 5;
                 xpos += qp_drawtext_recolor(
@@ -467,8 +489,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #    endif // COMMUNITY_MODULE_POINTING_DEVICE_ACCEL_ENABLE
 
             static bool last_jiggle_enabled = false;
-            if (hue_redraw || last_jiggle_enabled != userspace_config.pointing.mouse_jiggler.enable) {
-                last_jiggle_enabled = userspace_config.pointing.mouse_jiggler.enable;
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC) &&
+                               last_jiggle_enabled != PAINTER_STATE(userspace_config).pointing.mouse_jiggler.enable)) {
+                last_jiggle_enabled = PAINTER_STATE(userspace_config).pointing.mouse_jiggler.enable;
                 xpos                = 5;
                 xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, "Jiggler",
                                             last_jiggle_enabled ? curr_hsv.secondary.h : curr_hsv.primary.h,
@@ -483,13 +506,17 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             ypos = 107 + 3;
             xpos = 5;
 
-            painter_render_modifiers(display, font_oled, xpos, ypos, width, hue_redraw || keymap_config_redraw,
-                                     &curr_hsv, disabled_val);
+            if (hue_redraw || keymap_config_redraw || painter_damage_has(damage, PAINTER_DAMAGE_MODS)) {
+                painter_render_modifiers(display, font_oled, xpos, ypos, width, hue_redraw || keymap_config_redraw,
+                                         &curr_hsv, disabled_val);
+            }
 
 #ifdef OS_DETECTION_ENABLE
             ypos = 107 + 4;
             xpos = 159;
-            painter_render_os_detection(display, font_oled, xpos, ypos, width, hue_redraw, &curr_hsv);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_HOST_OS)) {
+                painter_render_os_detection(display, font_oled, xpos, ypos, width, hue_redraw, &curr_hsv);
+            }
 #endif // OS_DETECTION_ENABLE
 
             ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,11 +526,12 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             xpos                                    = 125;
             bool                 layer_state_redraw = false, dl_state_redraw = false;
             static layer_state_t last_layer_state = 0, last_dl_state = 0;
-            if (last_layer_state != layer_state) {
+            bool                 layer_damage     = painter_damage_has(damage, PAINTER_DAMAGE_LAYER);
+            if (layer_damage && last_layer_state != layer_state) {
                 last_layer_state   = layer_state;
                 layer_state_redraw = true;
             }
-            if (last_dl_state != default_layer_state) {
+            if (layer_damage && last_dl_state != default_layer_state) {
                 last_dl_state   = default_layer_state;
                 dl_state_redraw = true;
             }
@@ -561,7 +589,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #ifdef AUTOCORRECT_ENABLE
             ypos = 122 + 4;
 
-            painter_render_autocorrect(display, font_oled, 5, ypos, width, hue_redraw, &curr_hsv);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+                painter_render_autocorrect(display, font_oled, 5, ypos, width, hue_redraw, &curr_hsv);
+            }
             ypos += (font_oled->line_height + 4) * 3;
 
 #endif // AUTOCORRECT_ENABLE
@@ -573,13 +603,16 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #    if defined(RGBLIGHT_ENABLE)
             ypos = 20;
             xpos = 83;
-            painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
-                               "RGB Light Config:", rgblight_get_effect_name, rgblight_get_hsv, rgblight_is_enabled(),
-                               RGBLIGHT_LIMIT_VAL);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_RGB)) {
+                painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
+                                   "RGB Light Config:", rgblight_get_effect_name, rgblight_get_hsv,
+                                   rgblight_is_enabled(), RGBLIGHT_LIMIT_VAL);
+            }
 #    endif // RGBLIGHT_ENABLE
             static bool is_showing_nuke = true;
-            if (is_showing_nuke != userspace_config.nuke_switch || hue_redraw) {
-                is_showing_nuke = userspace_config.nuke_switch;
+            if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC) &&
+                               is_showing_nuke != PAINTER_STATE(userspace_config).nuke_switch)) {
+                is_showing_nuke = PAINTER_STATE(userspace_config).nuke_switch;
                 if (is_showing_nuke) {
                     qp_rect(display, 2, 32, 79, 170, 0, 0, 0, true);
                 } else {
@@ -587,20 +620,25 @@ __attribute__((weak)) void ili9341_draw_user(void) {
                 }
             }
 #    if defined(HAPTIC_ENABLE)
-            painter_render_haptic(display, font_oled, 83, 58, hue_redraw, &curr_hsv);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+                painter_render_haptic(display, font_oled, 83, 58, hue_redraw, &curr_hsv);
+            }
 #    endif // HAPTIC_ENABLE
             ypos = 80;
             xpos = 80;
 #    ifdef WPM_ENABLE
-            painter_render_wpm(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
-            ypos += font_oled->line_height + 2 * 4;
-            painter_render_wpm_graph(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+            if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_WPM)) {
+                painter_render_wpm(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+                painter_render_wpm_graph(display, font_oled, xpos, ypos + font_oled->line_height + 2 * 4, hue_redraw,
+                                         &curr_hsv);
+            }
 #    endif
 
             ypos                         = 84;
             static uint16_t last_keycode = 0xFFFF;
-            if (hue_redraw || last_keycode != userspace_runtime_state.last_keycode) {
-                last_keycode = userspace_runtime_state.last_keycode;
+            bool            key_damage   = painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC);
+            if (hue_redraw || (key_damage && last_keycode != PAINTER_STATE(userspace_runtime_state).last_keycode)) {
+                last_keycode = PAINTER_STATE(userspace_runtime_state).last_keycode;
                 xpos         = 142;
                 qp_drawtext_recolor(display, xpos, ypos, font_oled, "Last keycode:", curr_hsv.primary.h,
                                     curr_hsv.primary.s, curr_hsv.primary.v, 0, 0, 0);
@@ -611,8 +649,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             }
 
             static keyevent_t last_event = {0};
-            if (hue_redraw || memcmp(&last_event, &userspace_runtime_state.last_key_event, sizeof(keyevent_t))) {
-                memcpy(&last_event, &userspace_runtime_state.last_key_event, sizeof(keyevent_t));
+            if (hue_redraw || (key_damage && memcmp(&last_event, &PAINTER_STATE(userspace_runtime_state).last_key_event,
+                                                    sizeof(keyevent_t)))) {
+                memcpy(&last_event, &PAINTER_STATE(userspace_runtime_state).last_key_event, sizeof(keyevent_t));
                 ypos = 111;
                 xpos = 142;
                 qp_drawtext_recolor(display, xpos, ypos, font_oled, "Last keyevent:", curr_hsv.primary.h,
@@ -636,7 +675,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #    ifdef CUSTOM_UNICODE_ENABLE
             ypos                             = 149;
             static uint8_t last_unicode_mode = UNICODE_MODE_COUNT;
-            if (hue_redraw || last_unicode_mode != get_unicode_input_mode()) {
+            // the unicode mode is also set when the host OS is detected
+            if (hue_redraw || ((key_damage || painter_damage_has(damage, PAINTER_DAMAGE_HOST_OS)) &&
+                               last_unicode_mode != get_unicode_input_mode())) {
                 last_unicode_mode   = get_unicode_input_mode();
                 xpos                = 80 + 4;
                 uint8_t xpos_offset = xpos +
@@ -665,8 +706,9 @@ __attribute__((weak)) void ili9341_draw_user(void) {
             ypos                                    = 149;
             xpos                                    = 149 + 4;
             static uint8_t last_unicode_typing_mode = 0;
-            if (hue_redraw || last_unicode_typing_mode != userspace_runtime_state.unicode.typing_mode) {
-                last_unicode_typing_mode = userspace_runtime_state.unicode.typing_mode;
+            if (hue_redraw || (key_damage && last_unicode_typing_mode !=
+                                                 PAINTER_STATE(userspace_runtime_state).unicode.typing_mode)) {
+                last_unicode_typing_mode = PAINTER_STATE(userspace_runtime_state).unicode.typing_mode;
                 qp_drawtext_recolor(display, xpos, ypos, font_oled, "Typing Mode:", curr_hsv.primary.h,
                                     curr_hsv.primary.s, curr_hsv.primary.v, 0, 0, 0);
                 ypos += font_oled->line_height + 4;
@@ -677,14 +719,16 @@ __attribute__((weak)) void ili9341_draw_user(void) {
 #    endif
 #endif // SPLIT_KEYBOARD
         }
+        if (screen_saver_redraw || hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_MENU_BLOCK)) {
 #ifdef QUANTUM_PAINTER_DRIVERS_ILI9341_SURFACE
-        painter_render_menu_block(menu_surface, font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT,
-                                  screen_saver_redraw || hue_redraw, &curr_hsv, is_keyboard_left(), true);
-        qp_surface_draw(menu_surface, display, 2, 172, screen_saver_redraw);
+            painter_render_menu_block(menu_surface, font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT,
+                                      screen_saver_redraw || hue_redraw, &curr_hsv, is_keyboard_left(), true);
+            qp_surface_draw(menu_surface, display, 2, 172, screen_saver_redraw);
 #else  // QUANTUM_PAINTER_DRIVERS_ILI9341_SURFACE
-        painter_render_menu_block(display, font_oled, 2, 172, 237, 291, screen_saver_redraw || hue_redraw, &curr_hsv,
-                                  is_keyboard_master(), true);
+            painter_render_menu_block(display, font_oled, 2, 172, 237, 291, screen_saver_redraw || hue_redraw,
+                                      &curr_hsv, is_keyboard_master(), true);
 #endif // QUANTUM_PAINTER_DRIVERS_ILI9341_SURFACE
+        }
 
         // Footer
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -704,7 +748,10 @@ __attribute__((weak)) void ili9341_draw_user(void) {
         ypos = height - (16 + font_oled->line_height);
 #ifdef COMMUNITY_MODULE_RTC_ENABLE
         static uint16_t last_rtc_time = 0xFFFF;
-        painter_render_rtc_time(display, font_oled, xpos, ypos, width, hue_redraw, &last_rtc_time, &curr_hsv.primary);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_TIMER)) {
+            painter_render_rtc_time(display, font_oled, xpos, ypos, width, hue_redraw, &last_rtc_time,
+                                    &curr_hsv.primary);
+        }
 #else
         if (hue_redraw) {
             snprintf(buf, sizeof(buf), "Built on: %s", QMK_BUILDDATE);
@@ -142,12 +142,12 @@ void ili9488_display_power(bool on) {
     qp_power(display, on);
 }
 
-__attribute__((weak)) void ili9488_draw_user(void) {
+__attribute__((weak)) void ili9488_draw_user(uint16_t damage) {
     bool hue_redraw = forced_reinit;
 
     static dual_hsv_t curr_hsv = {0};
-    if (memcmp(&curr_hsv, &userspace_config.display.painter.hsv, sizeof(dual_hsv_t)) != 0) {
-        curr_hsv   = painter_get_dual_hsv();
+    if (memcmp(&curr_hsv, &PAINTER_STATE(userspace_config).display.painter.hsv, sizeof(dual_hsv_t)) != 0) {
+        curr_hsv   = PAINTER_STATE(userspace_config).display.painter.hsv;
         hue_redraw = true;
     }
     const uint8_t disabled_val = curr_hsv.primary.v / 2;
@@ -173,14 +173,18 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Matrix Scan rate
 
-        painter_render_scan_rate(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_TIMER)) {
+            painter_render_scan_rate(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv);
+        }
         ypos += font_oled->line_height + 4;
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         //  WPM
 
 #ifdef WPM_ENABLE
-        painter_render_wpm(display, font_oled, 5, ypos, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_WPM)) {
+            painter_render_wpm(display, font_oled, 5, ypos, hue_redraw, &curr_hsv);
+        }
 #endif // WPM_ENABLE
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,9 +193,11 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         ypos = 20;
         xpos = 83;
 #if defined(RGB_MATRIX_ENABLE)
-        painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
-                           "RGB Matrix Config:", rgb_matrix_get_effect_name, rgb_matrix_get_hsv,
-                           rgb_matrix_is_enabled(), RGB_MATRIX_MAXIMUM_BRIGHTNESS);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_RGB)) {
+            painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
+                               "RGB Matrix Config:", rgb_matrix_get_effect_name, rgb_matrix_get_hsv,
+                               rgb_matrix_is_enabled(), RGB_MATRIX_MAXIMUM_BRIGHTNESS);
+        }
 #endif // RGB_MATRIX_ENABLE
 
         //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,7 +205,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
         ypos = 24;
         xpos = 212;
-        painter_render_lock_state(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv, disabled_val);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_LED_STATE)) {
+            painter_render_lock_state(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv, disabled_val);
+        }
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Keymap config (nkro, autocorrect, oneshots)
@@ -207,13 +215,15 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         ypos                                        = 54 + 4;
         static keymap_config_t last_keymap_config   = {0};
         bool                   keymap_config_redraw = false;
-        if (last_keymap_config.raw != keymap_config.raw) {
-            last_keymap_config.raw = keymap_config.raw;
+        bool                   keymap_config_damage =
+            painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC | PAINTER_DAMAGE_HOST_OS);
+        if (keymap_config_damage && last_keymap_config.raw != PAINTER_STATE(keymap_config).raw) {
+            last_keymap_config.raw = PAINTER_STATE(keymap_config).raw;
             keymap_config_redraw   = true;
         }
 #ifdef CAPS_WORD_ENABLE
         static bool caps_words = false;
-        if (caps_words != is_caps_word_on()) {
+        if (painter_damage_has(damage, PAINTER_DAMAGE_MODS) && caps_words != is_caps_word_on()) {
             caps_words           = is_caps_word_on();
             keymap_config_redraw = true;
         }
@@ -252,8 +262,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
         ypos += font_oled->line_height + 4;
         static userspace_runtime_state_t last_user_state = {0};
-        if (hue_redraw || memcmp(&userspace_runtime_state, &last_user_state, sizeof(userspace_runtime_state))) {
-            memcpy(&last_user_state, &userspace_runtime_state, sizeof(userspace_runtime_state));
+        if (hue_redraw || (keymap_config_damage && memcmp(&PAINTER_STATE(userspace_runtime_state), &last_user_state,
+                                                          sizeof(userspace_runtime_state_t)))) {
+            memcpy(&last_user_state, &PAINTER_STATE(userspace_runtime_state), sizeof(userspace_runtime_state_t));
             xpos = 80 + 4 + windows_logo->width + 5;
             xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, (const char *)"AUDIO",
                                         last_user_state.audio.enable ? curr_hsv.secondary.h : curr_hsv.primary.h,
@@ -289,7 +300,7 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         static uint16_t last_cpi = {0xFFFF};
         uint16_t        curr_cpi = charybdis_get_pointer_sniping_enabled() ? charybdis_get_pointer_sniping_dpi()
                                                                            : charybdis_get_pointer_default_dpi();
-        if (hue_redraw || last_cpi != curr_cpi) {
+        if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) && last_cpi != curr_cpi)) {
             last_cpi = curr_cpi;
             xpos     = 5;
             xpos += qp_drawtext_recolor(display, xpos, ypos, font_oled, "CPI:   ", curr_hsv.primary.h,
@@ -306,7 +317,7 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 #    ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
         static uint8_t last_am_state     = 0xFF;
         bool           auto_mouse_redraw = false;
-        if (last_am_state != get_auto_mouse_enable()) {
+        if (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) && last_am_state != get_auto_mouse_enable()) {
             last_am_state     = get_auto_mouse_enable();
             auto_mouse_redraw = true;
         }
@@ -318,7 +329,8 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         ypos += font_oled->line_height + 4;
 
         static uint8_t last_am_layer = 0xFF;
-        if (hue_redraw || last_am_layer != get_auto_mouse_layer() || auto_mouse_redraw) {
+        if (hue_redraw || auto_mouse_redraw ||
+            (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) && last_am_layer != get_auto_mouse_layer())) {
             last_am_state = get_auto_mouse_layer();
             xpos          = 5;
             snprintf(buf, sizeof(buf), "%12s", get_layer_name_string(get_auto_mouse_layer()));
@@ -336,7 +348,8 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
 #    if (defined(KEYBOARD_bastardkb_charybdis) || defined(KEYBOARD_handwired_tractyl_manuform))
         static uint32_t last_ds_state = 0xFFFFFFFF;
-        if (hue_redraw || last_ds_state != charybdis_get_pointer_dragscroll_enabled()) {
+        if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) &&
+                           last_ds_state != charybdis_get_pointer_dragscroll_enabled())) {
             last_ds_state = charybdis_get_pointer_dragscroll_enabled();
             xpos          = 5;
             xpos += qp_drawtext_recolor(
@@ -352,7 +365,8 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
         static uint8_t last_sp_state = 0xFF;
 
-        if (hue_redraw || last_sp_state != charybdis_get_pointer_sniping_enabled()) {
+        if (hue_redraw || (painter_damage_has(damage, PAINTER_DAMAGE_POINTING) &&
+                           last_sp_state != charybdis_get_pointer_sniping_enabled())) {
             last_sp_state = charybdis_get_pointer_sniping_enabled();
             xpos          = 5;
             xpos += qp_drawtext_recolor(
@@ -367,7 +381,7 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 #ifdef CUSTOM_UNICODE_ENABLE
         ypos                             = 80 + 4;
         static uint8_t last_unicode_mode = UNICODE_MODE_COUNT;
-        if (hue_redraw || last_unicode_mode != get_unicode_input_mode()) {
+        if (hue_redraw || (keymap_config_damage && last_unicode_mode != get_unicode_input_mode())) {
             last_unicode_mode   = get_unicode_input_mode();
             xpos                = 80 + 4;
             uint8_t xpos_offset = xpos +
@@ -395,8 +409,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
         ypos                                    = 80 + 4;
         static uint8_t last_unicode_typing_mode = 0;
-        if (hue_redraw || last_unicode_typing_mode != userspace_runtime_state.unicode.typing_mode) {
-            last_unicode_typing_mode = userspace_runtime_state.unicode.typing_mode;
+        if (hue_redraw || (keymap_config_damage &&
+                           last_unicode_typing_mode != PAINTER_STATE(userspace_runtime_state).unicode.typing_mode)) {
+            last_unicode_typing_mode = PAINTER_STATE(userspace_runtime_state).unicode.typing_mode;
             xpos                     = 149 + 4;
             qp_drawtext_recolor(display, xpos, ypos, font_oled, "Typing Mode:", curr_hsv.primary.h, curr_hsv.primary.s,
                                 curr_hsv.primary.v, 0, 0, 0);
@@ -413,13 +428,17 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         ypos = 107 + 3;
         xpos = 5;
 
-        painter_render_modifiers(display, font_oled, xpos, ypos, width, hue_redraw || keymap_config_redraw, &curr_hsv,
-                                 disabled_val);
+        if (hue_redraw || keymap_config_redraw || painter_damage_has(damage, PAINTER_DAMAGE_MODS)) {
+            painter_render_modifiers(display, font_oled, xpos, ypos, width, hue_redraw || keymap_config_redraw,
+                                     &curr_hsv, disabled_val);
+        }
 
 #ifdef OS_DETECTION_ENABLE
         ypos = 107 + 4;
         xpos = 159;
-        painter_render_os_detection(display, font_oled, xpos, ypos, width, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_HOST_OS)) {
+            painter_render_os_detection(display, font_oled, xpos, ypos, width, hue_redraw, &curr_hsv);
+        }
 #endif // OS_DETECTION_ENABLE
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,11 +448,12 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         xpos                                    = 125;
         bool                 layer_state_redraw = false, dl_state_redraw = false;
         static layer_state_t last_layer_state = 0, last_dl_state = 0;
-        if (last_layer_state != layer_state) {
+        bool                 layer_damage     = painter_damage_has(damage, PAINTER_DAMAGE_LAYER);
+        if (layer_damage && last_layer_state != layer_state) {
             last_layer_state   = layer_state;
             layer_state_redraw = true;
         }
-        if (last_dl_state != default_layer_state) {
+        if (layer_damage && last_dl_state != default_layer_state) {
             last_dl_state   = default_layer_state;
             dl_state_redraw = true;
         }
@@ -490,7 +510,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 #ifdef AUTOCORRECT_ENABLE
         ypos = 122 + 4;
 
-        painter_render_autocorrect(display, font_oled, 5, ypos, width, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+            painter_render_autocorrect(display, font_oled, 5, ypos, width, hue_redraw, &curr_hsv);
+        }
         ypos += (font_oled->line_height + 4) * 3;
 
 #endif // AUTOCORRECT_ENABLE
@@ -503,7 +525,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 #ifdef DISPLAY_KEYLOGGER_ENABLE // keep at very end
         ypos = height - (font_mono->line_height + 2);
 
-        painter_render_keylogger(display, font_mono, 27, ypos, width - 27, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+            painter_render_keylogger(display, font_mono, 27, ypos, width - 27, hue_redraw, &curr_hsv);
+        }
 #endif // DISPLAY_KEYLOGGER_ENABLE
 
         // RTC
@@ -513,7 +537,9 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 #ifdef COMMUNITY_MODULE_RTC_ENABLE
         static uint16_t rtc_timer = 0;
 
-        painter_render_rtc_time(display, font_oled, 5, ypos, width, hue_redraw, &rtc_timer, &curr_hsv.primary);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_TIMER)) {
+            painter_render_rtc_time(display, font_oled, 5, ypos, width, hue_redraw, &rtc_timer, &curr_hsv.primary);
+        }
 #else
         if (hue_redraw) {
             snprintf(buf, sizeof(buf), "Built on: %s", QMK_BUILDDATE);
@@ -529,13 +555,15 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         }
 
 #endif // COMMUNITY_MODULE_RTC_ENABLE
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_MENU_BLOCK)) {
 #ifdef QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
-        painter_render_menu_block(menu_surface[0], font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT, hue_redraw,
-                                  &curr_hsv, true, true);
-        qp_surface_draw(menu_surface[0], display, 2, 172, false);
+            painter_render_menu_block(menu_surface[0], font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT,
+                                      hue_redraw, &curr_hsv, true, true);
+            qp_surface_draw(menu_surface[0], display, 2, 172, false);
 #else  // QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
-        painter_render_menu_block(display, font_oled, 2, 172, 237, 291, hue_redraw, &curr_hsv, true, true);
+            painter_render_menu_block(display, font_oled, 2, 172, 237, 291, hue_redraw, &curr_hsv, true, true);
 #endif // QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
+        }
     } // else
     // right side
     {
@@ -549,7 +577,8 @@ __attribute__((weak)) void ili9488_draw_user(void) {
         }
 
         static uint16_t last_scan_rate = 0;
-        if (last_scan_rate != get_matrix_scan_rate() || hue_redraw) {
+        if (hue_redraw ||
+            (painter_damage_has(damage, PAINTER_DAMAGE_TIMER) && last_scan_rate != get_matrix_scan_rate())) {
             last_scan_rate = get_matrix_scan_rate();
 
             painter_render_scan_rate(display, font_oled, xpos, ypos, true, &curr_hsv);
@@ -559,14 +588,17 @@ __attribute__((weak)) void ili9488_draw_user(void) {
 
         ypos = 20;
         xpos = 83 + width;
-        painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
-                           "RGB Light Config:", rgblight_get_effect_name, rgblight_get_hsv, rgblight_is_enabled(),
-                           RGBLIGHT_LIMIT_VAL);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_RGB)) {
+            painter_render_rgb(display, font_oled, xpos, ypos, hue_redraw, &curr_hsv,
+                               "RGB Light Config:", rgblight_get_effect_name, rgblight_get_hsv, rgblight_is_enabled(),
+                               RGBLIGHT_LIMIT_VAL);
+        }
 #endif // RGBLIGHT_ENABLE
         static bool                  is_showing_nuke = true;
         __attribute__((unused)) bool nuke_redraw     = false;
-        if (is_showing_nuke != userspace_config.nuke_switch) {
-            is_showing_nuke = userspace_config.nuke_switch;
+        if (painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC) &&
+            is_showing_nuke != PAINTER_STATE(userspace_config).nuke_switch) {
+            is_showing_nuke = PAINTER_STATE(userspace_config).nuke_switch;
             nuke_redraw     = true;
         }
         if (hue_redraw || nuke_redraw) {
@@ -577,21 +609,27 @@ __attribute__((weak)) void ili9488_draw_user(void) {
             }
         }
 #if defined(HAPTIC_ENABLE)
-        painter_render_haptic(display, font_oled, 83 + width, 58, hue_redraw, &curr_hsv);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC)) {
+            painter_render_haptic(display, font_oled, 83 + width, 58, hue_redraw, &curr_hsv);
+        }
 #endif // HAPTIC_ENABLE
         ypos                           = height - (16 + font_oled->line_height);
         static uint16_t last_rtc_timer = 0;
-        painter_render_rtc_time(display, font_oled, 5 + width, ypos, width + width, hue_redraw, &last_rtc_timer,
-                                &curr_hsv.primary);
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_TIMER)) {
+            painter_render_rtc_time(display, font_oled, 5 + width, ypos, width + width, hue_redraw, &last_rtc_timer,
+                                    &curr_hsv.primary);
+        }
 
+        if (hue_redraw || painter_damage_has(damage, PAINTER_DAMAGE_MENU_BLOCK)) {
 #ifdef QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
-        painter_render_menu_block(menu_surface[1], font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT, hue_redraw,
-                                  &curr_hsv, true, true);
-        qp_surface_draw(menu_surface[1], display, 2 + width, 172, false);
+            painter_render_menu_block(menu_surface[1], font_oled, 0, 0, SURFACE_MENU_WIDTH, SURFACE_MENU_HEIGHT,
+                                      hue_redraw, &curr_hsv, true, true);
+            qp_surface_draw(menu_surface[1], display, 2 + width, 172, false);
 #else  // QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
-        painter_render_menu_block(display, font_oled, 2 + width, 172, 237 + width, 291, hue_redraw, &curr_hsv, true,
-                                  true);
+            painter_render_menu_block(display, font_oled, 2 + width, 172, 237 + width, 291, hue_redraw, &curr_hsv,
+                                      true, true);
 #endif // QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
+        }
     }
     forced_reinit = false;
     qp_flush(display);
@@ -7,7 +7,7 @@
 
 void init_display_ili9488(void);
 void ili9488_display_power(bool on);
-void ili9488_draw_user(void);
+void ili9488_draw_user(uint16_t damage);
 void ili9488_display_shutdown(bool jump_to_bootloader);
 void init_display_ili9488_rotation(void);
 void init_display_ili9488_inversion(void);
@@ -15,11 +15,15 @@
 
 #define BIT(x) ((uint8_t)1 << (x))
 
-static bool    keylog_dirty                                           = true;
-static int32_t display_keylogger_string[DISPLAY_KEYLOGGER_LENGTH + 1] = {
-    [0 ... DISPLAY_KEYLOGGER_LENGTH - 1] = '_',
-    [DISPLAY_KEYLOGGER_LENGTH]           = '\0',
-}; // extra space for terminator
+#define KEYLOG_ALL_CELLS (UINT32_MAX >> (32 - DISPLAY_KEYLOGGER_LENGTH))
+_Static_assert(DISPLAY_KEYLOGGER_LENGTH <= 32, "Keylogger dirty mask is too small!");
+
+static keylog_buffer_t keylog = {
+    .chars = {[0 ... DISPLAY_KEYLOGGER_LENGTH - 1] = '_'},
+    .head  = 0,
+};
+// bit per display position that has changed since it was last rendered
+static uint32_t keylog_dirty_cells = KEYLOG_ALL_CELLS;
 
 typedef enum {
     NO_MODS,
@@ -153,6 +157,27 @@ static const replacements_t replacements[] = {
 };
 // clang-format on
 
+/**
+ * @brief Codepoints for basic keycodes, so the common case doesn't have to go through the keycode string, the
+ * replacements and the UTF-8 decoding on every keypress. The table is generated from the replacements above by
+ * generate_keylogger_codepoints.py, so rerun it after editing them. Each variant already has the NO_MODS fallback
+ * applied, and `unmapped` is the keycode name itself, for mod combinations that have no replacement.
+ *
+ * 0 means the keycode has no single codepoint representation, and the string based path is used instead.
+ */
+typedef struct {
+    uint16_t codepoints[N_MODS];
+    uint16_t unmapped;
+} keycode_codepoints_t;
+
+#define codepoints(no_mods, shift, al_gr, raw)                                       \
+    {                                                                                \
+        .codepoints = {[NO_MODS] = (no_mods), [SHIFT] = (shift), [AL_GR] = (al_gr)}, \
+        .unmapped   = (raw),                                                         \
+    }
+
+#include "keylogger_codepoints.h"
+
 static void skip_prefix(const char **str) {
     char *prefixes[] = {"KC_", "RGB_", "QK_", "TD_", "TL_", "UC_"};
 
@@ -257,62 +282,215 @@ static void apply_casing(const char **str) {
     *str = lowercase_letters[**str - 'A'];
 }
 
-static void keylog_clear(void) {
-    // spaces (not 0) so `qp_drawtext` actually renders something
-    for (int i = 0; i < DISPLAY_KEYLOGGER_LENGTH; i++) {
-        display_keylogger_string[i] = '_';
+/**
+ * @brief Looks up the codepoint for a basic keycode, following the same mod rules as maybe_symbol.
+ *
+ * @param keycode basic keycode
+ * @param mods active mods
+ * @return uint16_t codepoint, or 0 if the keycode needs the string based path
+ */
+static uint16_t keycode_to_codepoint(uint16_t keycode, uint8_t mods) {
+    if (keycode >= ARRAY_SIZE(keycode_codepoints)) {
+        return 0;
+    }
+
+    const keycode_codepoints_t *entry = &keycode_codepoints[keycode];
+    switch (mods) {
+        case 0:
+            return pgm_read_word(&entry->codepoints[NO_MODS]);
+        case MOD_BIT_LSHIFT:
+        case MOD_BIT_RSHIFT:
+            return pgm_read_word(&entry->codepoints[SHIFT]);
+        case MOD_BIT_RALT:
+            return pgm_read_word(&entry->codepoints[AL_GR]);
+        default:
+            return pgm_read_word(&entry->unmapped);
     }
-    display_keylogger_string[DISPLAY_KEYLOGGER_LENGTH] = '\0';
 }
 
-static void keylog_shift_right_one_char(void) {
-    memmove(display_keylogger_string + 1, display_keylogger_string, (DISPLAY_KEYLOGGER_LENGTH - 1) * sizeof(int32_t));
-    display_keylogger_string[0] = '_';
+// codepoint version of apply_casing
+static uint16_t apply_codepoint_casing(uint16_t codepoint) {
+    if (codepoint < 'A' || codepoint > 'Z') {
+        return codepoint;
+    }
+
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+    bool shift = mods & MOD_MASK_SHIFT;
+    bool caps  = host_keyboard_led_state().caps_lock;
+
+    if (shift ^ caps) {
+        return codepoint;
+    }
+    return codepoint - 'A' + 'a';
 }
 
-void keylog_shift_right(void) {
-    // With int32_t, each element is a complete character, so just shift one position
-    keylog_shift_right_one_char();
+/**
+ * @brief Encodes a single codepoint as UTF-8.
+ *
+ * Invalid codepoints are replaced with '?'.
+ *
+ * @param codepoint codepoint to encode
+ * @param buffer output buffer, at least 4 bytes
+ * @return uint8_t number of bytes written
+ */
+static uint8_t encode_utf8(int32_t codepoint, char *buffer) {
+    if (codepoint <= 0x7F) {
+        // ASCII (1 byte)
+        buffer[0] = (char)codepoint;
+        return 1;
+    } else if (codepoint <= 0x7FF) {
+        // 2-byte UTF-8
+        buffer[0] = 0xC0 | (codepoint >> 6);
+        buffer[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    } else if (codepoint <= 0xFFFF) {
+        // 3-byte UTF-8
+        buffer[0] = 0xE0 | (codepoint >> 12);
+        buffer[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+        buffer[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
+    } else if (codepoint <= 0x10FFFF) {
+        // 4-byte UTF-8
+        buffer[0] = 0xF0 | (codepoint >> 18);
+        buffer[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+        buffer[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+        buffer[3] = 0x80 | (codepoint & 0x3F);
+        return 4;
+    }
+    // Invalid Unicode code point, use replacement character
+    buffer[0] = '?';
+    return 1;
+}
+
+/**
+ * @brief Gets the character at a display position, where 0 is the oldest (leftmost) character.
+ */
+static int32_t keylog_get(const keylog_buffer_t *buffer, uint8_t index) {
+    return buffer->chars[(buffer->head + index) % DISPLAY_KEYLOGGER_LENGTH];
+}
+
+/**
+ * @brief Compares two states of a keylog buffer, by display position rather than by storage position.
+ *
+ * @param previous older state of the buffer
+ * @param current newer state of the buffer
+ * @return uint32_t bit per display position that differs, where bit 0 is the oldest (leftmost) character
+ */
+uint32_t keylog_changed_cells(const keylog_buffer_t *previous, const keylog_buffer_t *current) {
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < DISPLAY_KEYLOGGER_LENGTH; i++) {
+        if (keylog_get(previous, i) != keylog_get(current, i)) {
+            changed |= (1UL << i);
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Flags every display position that differs from the previous state of the buffer, so only those glyphs
+ * have to be redrawn.
+ *
+ * @param previous buffer state before it was modified
+ */
+static void keylog_mark_changed(const keylog_buffer_t *previous) {
+    keylog_dirty_cells |= keylog_changed_cells(previous, &keylog);
 }
 
-static void keylog_shift_left(uint8_t len) {
-    memmove(display_keylogger_string, display_keylogger_string + len,
-            (DISPLAY_KEYLOGGER_LENGTH - len) * sizeof(int32_t));
+// drops the oldest character, and adds the new one at the end
+static void keylog_push(int32_t codepoint) {
+    keylog.chars[keylog.head] = codepoint;
+    keylog.head               = (keylog.head + 1) % DISPLAY_KEYLOGGER_LENGTH;
+}
 
-    // Fill the end with spaces
-    for (int i = DISPLAY_KEYLOGGER_LENGTH - len; i < DISPLAY_KEYLOGGER_LENGTH; i++) {
-        display_keylogger_string[i] = ' ';
+static void keylog_clear(void) {
+    keylog_buffer_t previous = keylog;
+
+    // spaces (not 0) so `qp_drawtext` actually renders something
+    for (int i = 0; i < DISPLAY_KEYLOGGER_LENGTH; i++) {
+        keylog.chars[i] = '_';
     }
+    keylog.head = 0;
+    keylog_mark_changed(&previous);
+}
+
+void keylog_shift_right(void) {
+    keylog_buffer_t previous = keylog;
+
+    // drop the newest character, and pad the start
+    keylog.head               = (keylog.head + DISPLAY_KEYLOGGER_LENGTH - 1) % DISPLAY_KEYLOGGER_LENGTH;
+    keylog.chars[keylog.head] = '_';
+    keylog_mark_changed(&previous);
 }
 
 static void keylog_append(const char *str) {
-    // Convert UTF-8 string to Unicode code points
-    uint8_t char_count = 0;
-    int32_t unicode_chars[8]; // Temporary buffer for conversion
+    keylog_buffer_t previous = keylog;
 
+    // Convert UTF-8 string to Unicode code points
     const char *ptr = str;
     while (*ptr) {
-        ptr = decode_utf8(ptr, &unicode_chars[char_count++]);
+        int32_t codepoint;
+        ptr = decode_utf8(ptr, &codepoint);
+        keylog_push(codepoint);
     }
+    keylog_mark_changed(&previous);
+}
 
-    keylog_shift_left(char_count);
-    for (uint8_t i = 0; i < char_count; i++) {
-        display_keylogger_string[DISPLAY_KEYLOGGER_LENGTH - char_count + i] = unicode_chars[i];
-    }
+static void keylog_append_codepoint(int32_t codepoint) {
+    keylog_buffer_t previous = keylog;
+
+    keylog_push(codepoint);
+    keylog_mark_changed(&previous);
 }
 
 bool is_keylogger_dirty(void) {
-    return keylog_dirty;
+    return keylog_dirty_cells != 0;
 }
 
 void keylogger_set_dirty(bool dirty) {
-    keylog_dirty = dirty;
+    keylog_dirty_cells = dirty ? KEYLOG_ALL_CELLS : 0;
+}
+
+/**
+ * @brief Gets the display positions that have changed since the keylogger was last rendered.
+ *
+ * @return uint32_t bit per display position, where bit 0 is the oldest (leftmost) character
+ */
+uint32_t get_keylogger_dirty_cells(void) {
+    return keylog_dirty_cells;
+}
+
+/**
+ * @brief Gets a single character of a keylog buffer, for rendering it on its own.
+ *
+ * @param keylog_buffer buffer to read from
+ * @param index display position, where 0 is the oldest (leftmost) character
+ * @param buffer output buffer, at least 5 bytes
+ * @return uint8_t length of the UTF-8 encoded character
+ */
+uint8_t keylog_get_cell(const keylog_buffer_t *keylog_buffer, uint8_t index, char *buffer) {
+    uint8_t length = encode_utf8(keylog_get(keylog_buffer, index), buffer);
+    buffer[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Gets a single character of the keylogger, for rendering it on its own.
+ *
+ * @param index display position, where 0 is the oldest (leftmost) character
+ * @param buffer output buffer, at least 5 bytes
+ * @return uint8_t length of the UTF-8 encoded character
+ */
+uint8_t get_keylogger_cell(uint8_t index, char *buffer) {
+    return keylog_get_cell(&keylog, index, buffer);
 }
 
 /**
  * @brief Converts Unicode code points to UTF-8 encoded string for display
  *
- * This function takes an array of Unicode code points stored in display_keylogger_string
+ * This function takes the Unicode code points stored in the keylogger ring buffer, oldest first,
  * and converts them to a UTF-8 encoded C string suitable for display purposes.
  * The conversion handles all valid Unicode ranges:
  * - ASCII (U+0000 to U+007F): 1 byte encoding
@@ -327,7 +505,7 @@ void keylogger_set_dirty(bool dirty) {
  * @return const char* Pointer to null-terminated UTF-8 encoded string.
  *                     The string is valid until the next call to this function.
  *
- * @note The function assumes display_keylogger_string contains valid Unicode
+ * @note The function assumes the keylogger contains valid Unicode
  *       code points and DISPLAY_KEYLOGGER_LENGTH defines the array size.
  * @note Maximum output string length is DISPLAY_KEYLOGGER_LENGTH * 4 bytes
  *       plus null terminator.
@@ -338,39 +516,16 @@ const char *get_keylogger_str(void) {
     int         pos = 0;
 
     for (int i = 0; i < DISPLAY_KEYLOGGER_LENGTH && pos < sizeof(converted_string) - 4; i++) {
-        int32_t codepoint = display_keylogger_string[i];
-
-        if (codepoint <= 0x7F) {
-            // ASCII (1 byte)
-            converted_string[pos++] = (char)codepoint;
-        } else if (codepoint <= 0x7FF) {
-            // 2-byte UTF-8
-            converted_string[pos++] = 0xC0 | (codepoint >> 6);
-            converted_string[pos++] = 0x80 | (codepoint & 0x3F);
-        } else if (codepoint <= 0xFFFF) {
-            // 3-byte UTF-8
-            converted_string[pos++] = 0xE0 | (codepoint >> 12);
-            converted_string[pos++] = 0x80 | ((codepoint >> 6) & 0x3F);
-            converted_string[pos++] = 0x80 | (codepoint & 0x3F);
-        } else if (codepoint <= 0x10FFFF) {
-            // 4-byte UTF-8
-            converted_string[pos++] = 0xF0 | (codepoint >> 18);
-            converted_string[pos++] = 0x80 | ((codepoint >> 12) & 0x3F);
-            converted_string[pos++] = 0x80 | ((codepoint >> 6) & 0x3F);
-            converted_string[pos++] = 0x80 | (codepoint & 0x3F);
-        } else {
-            // Invalid Unicode code point, use replacement character
-            converted_string[pos++] = '?';
-        }
+        pos += encode_utf8(keylog_get(&keylog, i), &converted_string[pos]);
     }
     converted_string[pos] = '\0';
 
     return converted_string;
 }
 
-const int32_t *get_keylogger_str_raw(void) {
-    // Return the raw int32_t array for direct access
-    return display_keylogger_string;
+const keylog_buffer_t *get_keylogger_buffer(void) {
+    // Return the raw ring buffer for direct access
+    return &keylog;
 }
 
 void keycode_repr(const char **str, const uint8_t mods) {
@@ -415,22 +570,20 @@ void keylogger_process(uint16_t code, keyrecord_t *record) {
         return;
     }
 
-    keylog_dirty = true;
     uint8_t mods = get_mods();
 #ifndef NO_ACTION_ONESHOT
     mods |= get_oneshot_mods();
 #endif // NO_ACTION_ONESHOT
-    const char *str = get_keycode_string(keycode);
 
     if (IS_QK_MODS(code) && QK_MODS_GET_MODS(code) & MOD_LSFT) {
-        str = get_keycode_string(QK_MODS_GET_BASIC_KEYCODE(code));
+        keycode = QK_MODS_GET_BASIC_KEYCODE(code);
         mods |= QK_MODS_GET_MODS(code);
     }
 
     bool ctrl = mod_config(mods) & MOD_MASK_CTRL;
 
     // delete from tail
-    if (strstr(str, "BSPC") != NULL) {
+    if (keycode == KC_BSPC) {
         // ctrl + backspace clears whole log
         if (ctrl) {
             keylog_clear();
@@ -442,6 +595,13 @@ void keylogger_process(uint16_t code, keyrecord_t *record) {
         return;
     }
 
+    uint16_t codepoint = keycode_to_codepoint(keycode, mods);
+    if (codepoint) {
+        keylog_append_codepoint(apply_codepoint_casing(codepoint));
+        return;
+    }
+
+    const char *str = get_keycode_string(keycode);
     // unknown keycode, quit
     if (str == NULL) {
         return;
@@ -457,18 +617,22 @@ void keylogger_process(uint16_t code, keyrecord_t *record) {
 }
 
 void split_sync_keylogger_str(const uint8_t *data, uint8_t size) {
-    // Convert incoming data to int32_t
-    if (memcmp(data, display_keylogger_string, size * sizeof(int32_t)) != 0) {
-        memcpy(display_keylogger_string, data, sizeof(display_keylogger_string));
-        keylog_dirty = true;
+    keylog_buffer_t previous = keylog;
+
+    if (size != sizeof(keylog_buffer_t) || memcmp(data, &keylog, sizeof(keylog_buffer_t)) == 0) {
+        return;
+    }
+    memcpy(&keylog, data, sizeof(keylog_buffer_t));
+    if (keylog.head >= DISPLAY_KEYLOGGER_LENGTH) {
+        keylog.head = 0;
     }
+    keylog_mark_changed(&previous);
 }
 
 const char *get_keyode_character(uint16_t keycode, keypos_t *key) {
-    const char *str = get_keycode_string(extract_basic_keycode(keycode, NULL, false));
-    if (str == NULL) {
-        return NULL;
-    }
+    static char character[5];
+    uint16_t    basic_keycode = extract_basic_keycode(keycode, NULL, false);
+
     switch (keycode) {
         case KC_NO:
             if (key->row == 255 && key->col == 255) {
@@ -499,6 +663,19 @@ const char *get_keyode_character(uint16_t keycode, keypos_t *key) {
             break;
     }
 
+    uint16_t codepoint = keycode_to_codepoint(basic_keycode, IS_QK_MODS(keycode) ? QK_MODS_GET_MODS(keycode) : 0);
+    if (codepoint) {
+        if (KC_A <= keycode && keycode <= KC_Z) {
+            codepoint = apply_codepoint_casing(codepoint);
+        }
+        character[encode_utf8(codepoint, character)] = '\0';
+        return character;
+    }
+
+    const char *str = get_keycode_string(basic_keycode);
+    if (str == NULL) {
+        return NULL;
+    }
     skip_prefix(&str);
     maybe_symbol(&str, IS_QK_MODS(keycode) ? QK_MODS_GET_MODS(keycode) : 0);
     if (KC_A <= keycode && keycode <= KC_Z) {
@@ -510,7 +687,12 @@ const char *get_keyode_character(uint16_t keycode, keypos_t *key) {
 }
 
 void add_keycode_to_keylogger_str(uint8_t keycode, uint8_t mods) {
-    keylogger_set_dirty(true);
+    uint16_t codepoint = keycode_to_codepoint(keycode, mods);
+    if (codepoint) {
+        keylog_append_codepoint(apply_codepoint_casing(codepoint));
+        return;
+    }
+
     const char *str = get_keycode_string(keycode);
     // unknown keycode, quit
     if (str == NULL) {
@@ -17,6 +17,16 @@
 
 #include <quantum/quantum.h>
 
+/**
+ * Ring buffer of the logged characters, as Unicode code points. ``head`` is the
+ * oldest character, so appending only touches one cell, and the split sync only
+ * has to send that cell and the new head.
+ */
+typedef struct PACKED {
+    int32_t chars[DISPLAY_KEYLOGGER_LENGTH];
+    uint8_t head;
+} keylog_buffer_t;
+
 /**
  * Hook into :c:func:`process_record_user` that performs the tracking.
  */
@@ -27,7 +37,27 @@ void keylogger_process(uint16_t keycode, keyrecord_t *record);
  */
 const char *get_keylogger_str(void);
 
-const int32_t *get_keylogger_str_raw(void);
+const keylog_buffer_t *get_keylogger_buffer(void);
+
+/**
+ * Read a single character of the keylog, oldest first, as a UTF-8 string.
+ */
+uint8_t get_keylogger_cell(uint8_t index, char *buffer);
+
+/**
+ * Same as :c:func:`get_keylogger_cell`, but reading from a copy of the keylog.
+ */
+uint8_t keylog_get_cell(const keylog_buffer_t *keylog_buffer, uint8_t index, char *buffer);
+
+/**
+ * Which characters have changed since the keylog was last rendered, one bit per character.
+ */
+uint32_t get_keylogger_dirty_cells(void);
+
+/**
+ * Which characters differ between two copies of the keylog, one bit per character.
+ */
+uint32_t keylog_changed_cells(const keylog_buffer_t *previous, const keylog_buffer_t *current);
 
 /**
  * Whether anything has been written since keylog was last fetched.
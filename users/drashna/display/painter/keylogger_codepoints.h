@@ -0,0 +1,119 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated by generate_keylogger_codepoints.py from the replacements in keylogger.c, do not edit by hand.
+
+#pragma once
+
+// 102 basic keycodes, as codepoints(no mods, shift, altgr, other mods).
+
+// clang-format off
+static const keycode_codepoints_t keycode_codepoints[KC_RIGHT_GUI + 1] PROGMEM = {
+    [KC_A]    = codepoints(u'A', u'A', u'A', u'A'),
+    [KC_B]    = codepoints(u'B', u'B', u'B', u'B'),
+    [KC_C]    = codepoints(u'C', u'C', u'C', u'C'),
+    [KC_D]    = codepoints(u'D', u'D', u'D', u'D'),
+    [KC_E]    = codepoints(u'E', u'E', u'E', u'E'),
+    [KC_F]    = codepoints(u'F', u'F', u'F', u'F'),
+    [KC_G]    = codepoints(u'G', u'G', u'G', u'G'),
+    [KC_H]    = codepoints(u'H', u'H', u'H', u'H'),
+    [KC_I]    = codepoints(u'I', u'I', u'I', u'I'),
+    [KC_J]    = codepoints(u'J', u'J', u'J', u'J'),
+    [KC_K]    = codepoints(u'K', u'K', u'K', u'K'),
+    [KC_L]    = codepoints(u'L', u'L', u'L', u'L'),
+    [KC_M]    = codepoints(u'M', u'M', u'M', u'M'),
+    [KC_N]    = codepoints(u'N', u'N', u'N', u'N'),
+    [KC_O]    = codepoints(u'O', u'O', u'O', u'O'),
+    [KC_P]    = codepoints(u'P', u'P', u'P', u'P'),
+    [KC_Q]    = codepoints(u'Q', u'Q', u'Q', u'Q'),
+    [KC_R]    = codepoints(u'R', u'R', u'R', u'R'),
+    [KC_S]    = codepoints(u'S', u'S', u'S', u'S'),
+    [KC_T]    = codepoints(u'T', u'T', u'T', u'T'),
+    [KC_U]    = codepoints(u'U', u'U', u'U', u'U'),
+    [KC_V]    = codepoints(u'V', u'V', u'V', u'V'),
+    [KC_W]    = codepoints(u'W', u'W', u'W', u'W'),
+    [KC_X]    = codepoints(u'X', u'X', u'X', u'X'),
+    [KC_Y]    = codepoints(u'Y', u'Y', u'Y', u'Y'),
+    [KC_Z]    = codepoints(u'Z', u'Z', u'Z', u'Z'),
+    [KC_1]    = codepoints(u'1', u'!', u'1', u'1'),
+    [KC_2]    = codepoints(u'2', u'@', u'2', u'2'),
+    [KC_3]    = codepoints(u'3', u'#', u'3', u'3'),
+    [KC_4]    = codepoints(u'4', u'$', u'4', u'4'),
+    [KC_5]    = codepoints(u'5', u'%', u'5', u'5'),
+    [KC_6]    = codepoints(u'6', u'^', u'6', u'6'),
+    [KC_7]    = codepoints(u'7', u'&', u'7', u'7'),
+    [KC_8]    = codepoints(u'8', u'*', u'8', u'8'),
+    [KC_9]    = codepoints(u'9', u'(', u'9', u'9'),
+    [KC_0]    = codepoints(u'0', u')', u'0', u'0'),
+    [KC_ENT]  = codepoints(u'↲', u'↲', u'↲', 0),
+    [KC_ESC]  = codepoints(u'‼', u'‼', u'‼', 0),
+    [KC_BSPC] = codepoints(u'⇤', u'⇤', u'⇤', 0),
+    [KC_TAB]  = codepoints(u'⇥', u'⇥', u'⇥', 0),
+    [KC_SPC]  = codepoints(u' ', u' ', u' ', 0),
+    [KC_MINS] = codepoints(u'-', u'_', u'-', 0),
+    [KC_EQL]  = codepoints(u'=', u'+', u'=', 0),
+    [KC_LBRC] = codepoints(u'[', u'{', u'[', 0),
+    [KC_RBRC] = codepoints(u']', u'}', u']', 0),
+    [KC_BSLS] = codepoints(u'\\', u'|', u'\\', 0),
+    [KC_SCLN] = codepoints(u';', u':', u';', 0),
+    [KC_QUOT] = codepoints(u'\'', u'"', u'\'', 0),
+    [KC_GRV]  = codepoints(u'`', u'~', u'`', 0),
+    [KC_COMM] = codepoints(u',', u'<', u',', 0),
+    [KC_DOT]  = codepoints(u'.', u'>', u'.', 0),
+    [KC_SLSH] = codepoints(u'/', u'?', u'/', 0),
+    [KC_CAPS] = codepoints(u'↕', u'↕', u'↕', 0),
+    [KC_F1]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F2]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F3]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F4]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F5]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F6]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F7]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F8]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F9]   = codepoints(u'F', u'F', u'F', 0),
+    [KC_F10]  = codepoints(u'F', u'F', u'F', 0),
+    [KC_F11]  = codepoints(u'F', u'F', u'F', 0),
+    [KC_F12]  = codepoints(u'F', u'F', u'F', 0),
+    [KC_PSCR] = codepoints(u'P', u'P', u'P', 0),
+    [KC_HOME] = codepoints(u'◀', u'◀', u'◀', 0),
+    [KC_PGUP] = codepoints(u'▲', u'▲', u'▲', 0),
+    [KC_DEL]  = codepoints(u'⇥', u'⇥', u'⇥', 0),
+    [KC_END]  = codepoints(u'▶', u'▶', u'▶', 0),
+    [KC_PGDN] = codepoints(u'▼', u'▼', u'▼', 0),
+    [KC_RGHT] = codepoints(u'→', u'→', u'→', 0),
+    [KC_LEFT] = codepoints(u'←', u'←', u'←', 0),
+    [KC_DOWN] = codepoints(u'↓', u'↓', u'↓', 0),
+    [KC_UP]   = codepoints(u'↑', u'↑', u'↑', 0),
+#ifdef EXTRAKEY_ENABLE
+    [KC_MUTE] = codepoints(u'♫', u'♫', u'♫', 0),
+    [KC_VOLU] = codepoints(u'♪', u'♪', u'♪', 0),
+    [KC_VOLD] = codepoints(u'♪', u'♪', u'♪', 0),
+    [KC_MNXT] = codepoints(u'⏭', u'⏭', u'⏭', 0),
+    [KC_MPRV] = codepoints(u'⏮', u'⏮', u'⏮', 0),
+    [KC_MSTP] = codepoints(u'⏹', u'⏹', u'⏹', 0),
+    [KC_MPLY] = codepoints(u'⏯', u'⏯', u'⏯', 0),
+#endif // EXTRAKEY_ENABLE
+#ifdef MOUSEKEY_ENABLE
+    [MS_BTN1] = codepoints(u'⸁', u'⸁', u'⸁', 0),
+    [MS_BTN2] = codepoints(u'⸂', u'⸂', u'⸂', 0),
+    [MS_BTN3] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_BTN4] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_BTN5] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_BTN6] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_BTN7] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_BTN8] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_WHLU] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_WHLD] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_WHLL] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+    [MS_WHLR] = codepoints(u'⸀', u'⸀', u'⸀', 0),
+#endif // MOUSEKEY_ENABLE
+    [KC_LCTL] = codepoints(u'^', u'^', u'^', 0),
+    [KC_LSFT] = codepoints(u'↑', u'↑', u'↑', 0),
+    [KC_LALT] = codepoints(u'A', u'A', u'A', 0),
+    [KC_LGUI] = codepoints(u'G', u'G', u'G', 0),
+    [KC_RCTL] = codepoints(u'^', u'^', u'^', 0),
+    [KC_RSFT] = codepoints(u'↑', u'↑', u'↑', 0),
+    [KC_RALT] = codepoints(u'A', u'A', u'A', 0),
+    [KC_RGUI] = codepoints(u'G', u'G', u'G', 0),
+};
+// clang-format on
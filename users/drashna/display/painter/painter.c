@@ -9,6 +9,7 @@
 #include "version.h"
 #include "hardware_id_string.h"
 #include "keyrecords/process_records.h"
+#include "display/painter/painter_life.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
@@ -43,6 +44,9 @@
 #ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
 #    include "layer_map.h"
 #endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+#    include "wpm_stats.h"
+#endif // WPM_ENABLE
 #ifdef COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
 #    include "qp_render_menu.h"
 #else
@@ -97,20 +101,20 @@ deferred_token         nyan_token = INVALID_DEFERRED_TOKEN;
 
 painter_image_array_t screen_saver_image[] = {
 #if defined(PAINTER_SCREENSAVER_NEON_GENESIS)
-    {gfx_asuka_240x320, "Asuka"},
-    {gfx_neon_genesis_evangelion_initial_machine_00_240x320, "Eva Unit 00"},
-    {gfx_neon_genesis_evangelion_initial_machine_01_240x320, "Eva Unit 01"},
-    {gfx_neon_genesis_evangelion_initial_machine_02_240x320, "Eva Unit 02"},
-    {gfx_neon_genesis_evangelion_initial_machine_03_240x320, "Eva Unit 03"},
-    {gfx_neon_genesis_evangelion_initial_machine_04_240x320, "Eva Unit 04"},
-    {gfx_neon_genesis_evangelion_initial_machine_05_240x320, "Eva Unit 05"},
-    {gfx_neon_genesis_evangelion_initial_machine_06_240x320, "Eva Unit 06"},
+    {&gfx_asuka_240x320_rle565, "Asuka"},
+    {&gfx_neon_genesis_evangelion_initial_machine_00_240x320_rle565, "Eva Unit 00"},
+    {&gfx_neon_genesis_evangelion_initial_machine_01_240x320_rle565, "Eva Unit 01"},
+    {&gfx_neon_genesis_evangelion_initial_machine_02_240x320_rle565, "Eva Unit 02"},
+    {&gfx_neon_genesis_evangelion_initial_machine_03_240x320_rle565, "Eva Unit 03"},
+    {&gfx_neon_genesis_evangelion_initial_machine_04_240x320_rle565, "Eva Unit 04"},
+    {&gfx_neon_genesis_evangelion_initial_machine_05_240x320_rle565, "Eva Unit 05"},
+    {&gfx_neon_genesis_evangelion_initial_machine_06_240x320_rle565, "Eva Unit 06"},
 #endif // PAINTER_SCREENSAVER_NEON_GENESIS
 #if defined(PAINTER_SCREENSAVER_CYBERPUNK_2077)
-    {gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320, "Samurai Cyberpunk"},
+    {&gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320_rle565, "Samurai Cyberpunk"},
 #endif // PAINTER_SCREENSAVER_CYBERPUNK_2077
 #if defined(PAINTER_SCREENSAVER_ANIME)
-    {gfx_anime_girl_jacket_240x320, "Anime Girl"},
+    {&gfx_anime_girl_jacket_240x320_rle565, "Anime Girl"},
 #endif // PAINTER_SCREENSAVER_ANIME
 };
 
@@ -147,11 +151,15 @@ void painter_render_menu_block_nyan_cat(painter_device_t device, painter_font_ha
         nyan_token =
             qp_animate(device, x + (width - nyan_cat->width) / 2, y + (height - nyan_cat->height) / 2, nyan_cat);
     }
+    // the animation runs on its own, but a surface only reaches the panel when a frame is drawn
+    painter_damage_mark(PAINTER_DAMAGE_ANIMATION);
 }
 
 void painter_render_menu_block_game_of_life(painter_device_t device, painter_font_handle_t font, uint16_t x, uint16_t y,
                                             uint16_t width, uint16_t height, bool force_redraw, dual_hsv_t* curr_hsv) {
     render_life(device, x, y, curr_hsv, force_redraw);
+    // a generation per frame, so keep frames coming for as long as it's shown
+    painter_damage_mark(PAINTER_DAMAGE_ANIMATION);
 }
 
 void painter_render_menu_block_layer_map(painter_device_t device, painter_font_handle_t font, uint16_t x, uint16_t y,
@@ -281,9 +289,13 @@ void painter_render_rtc_time(painter_device_t device, painter_font_handle_t font
 void painter_render_console(painter_device_t device, painter_font_handle_t font, uint16_t x, uint16_t y,
                             uint16_t display_width, bool force_redraw, hsv_t* hsv, uint8_t start, uint8_t end) {
     if (console_log_needs_redraw || force_redraw) {
+        display_console_line_t lines[DISPLAY_CONSOLE_LOG_LINE_NUM + 1];
+        char                   buffer[DISPLAY_CONSOLE_LOG_LINE_LENGTH + 1];
+
+        display_console_get_lines(lines);
         for (uint8_t i = start; i < end; i++) {
-            uint16_t xpos =
-                x + qp_drawtext_recolor(device, x, y, font, logline_ptrs[i], hsv->h, hsv->s, hsv->v, 0, 0, 0);
+            uint16_t xpos = x + qp_drawtext_recolor(device, x, y, font, display_console_copy_line(&lines[i], buffer),
+                                                    hsv->h, hsv->s, hsv->v, 0, 0, 0);
             qp_rect(device, xpos, y, display_width, y + font->line_height, 0, 0, 0, true);
             y += font->line_height + 4;
         }
@@ -407,8 +419,9 @@ void painter_render_wpm(painter_device_t device, painter_font_handle_t font, uin
     static wpm_sync_data_t last_wpm_update = {0};
     static char            buf[4]          = {0};
     uint16_t               temp_x = x + 4, temp_y = y + 4;
-    if (force_redraw || memcmp(&last_wpm_update, &userspace_runtime_state.wpm, sizeof(wpm_sync_data_t)) != 0) {
-        memcpy(&last_wpm_update, &userspace_runtime_state.wpm, sizeof(wpm_sync_data_t));
+    if (force_redraw ||
+        memcmp(&last_wpm_update, &PAINTER_STATE(userspace_runtime_state).wpm, sizeof(wpm_sync_data_t)) != 0) {
+        memcpy(&last_wpm_update, &PAINTER_STATE(userspace_runtime_state).wpm, sizeof(wpm_sync_data_t));
         temp_x += qp_drawtext_recolor(device, temp_x, temp_y, font, "WPM: ", curr_hsv->primary.h, curr_hsv->primary.s,
                                       curr_hsv->primary.v, 0, 0, 0) +
                   5;
@@ -436,10 +449,15 @@ void painter_render_wpm_graph(painter_device_t device, painter_font_handle_t fon
 
     if (force_redraw || timer_elapsed(wpm_timer) > 1000) {
         wpm_timer = timer_read();
-        extern uint8_t     wpm_graph_samples[WPM_GRAPH_SAMPLES];
+#    ifdef MULTITHREADED_PAINTER_ENABLE
+        const uint8_t* samples = painter_state.wpm_graph_samples;
+#    else
+        // newest first, straight out of the ring buffer
+        const uint8_t* samples = wpm_stats_history(WPM_STATS_SECONDS);
+#    endif // MULTITHREADED_PAINTER_ENABLE
         const graph_line_t lines[] = {
             {
-                .data      = wpm_graph_samples,
+                .data      = samples,
                 .color     = curr_hsv->secondary,
                 .mode      = LINE,
                 .max_value = 120,
@@ -658,7 +676,8 @@ void painter_render_frame(painter_device_t device, painter_font_handle_t font_ti
     // uint16_t       width     = offset + max_width;
     // uint16_t       height    = 320;
 
-    hsv_t hsv = painter_get_hsv(color_side);
+    hsv_t hsv = color_side ? PAINTER_STATE(userspace_config).display.painter.hsv.primary
+                           : PAINTER_STATE(userspace_config).display.painter.hsv.secondary;
 
     painter_render_frame_box(device, hsv, 1, 0, xpos, 3, true, false);
 
@@ -805,11 +824,11 @@ void painter_render_menu_block(painter_device_t device, painter_font_handle_t fo
                                bool is_thicc) {
     static bool force_full_block_redraw = false;
 #ifdef SPLIT_KEYBOARD
-    bool should_render_this_side = userspace_config.display.menu_render_side & (1 << (uint8_t)!is_left);
+    bool should_render_this_side = PAINTER_STATE(userspace_config).display.menu_render_side & (1 << (uint8_t)!is_left);
     (void)should_render_this_side;
     static uint8_t last_menu_side = 0xFF;
-    if (last_menu_side != userspace_config.display.menu_render_side) {
-        last_menu_side          = userspace_config.display.menu_render_side;
+    if (last_menu_side != PAINTER_STATE(userspace_config).display.menu_render_side) {
+        last_menu_side          = PAINTER_STATE(userspace_config).display.menu_render_side;
         force_full_block_redraw = true;
     }
     // if slave side can't be detected, we need to force render, just to be safe
@@ -833,8 +852,8 @@ void painter_render_menu_block(painter_device_t device, painter_font_handle_t fo
 #endif
     {
         bool    block_redraw         = false;
-        uint8_t current_display_mode = is_left ? userspace_config.display.painter.left.display_mode
-                                               : userspace_config.display.painter.right.display_mode;
+        uint8_t current_display_mode = is_left ? PAINTER_STATE(userspace_config).display.painter.left.display_mode
+                                               : PAINTER_STATE(userspace_config).display.painter.right.display_mode;
 
         static uint8_t last_display_mode[2] = {0xFF};
         if (last_display_mode[is_left] != current_display_mode) {
@@ -874,15 +893,77 @@ void painter_render_menu_block(painter_device_t device, painter_font_handle_t fo
 void painter_render_keylogger(painter_device_t device, painter_font_handle_t font, uint16_t x, uint16_t y,
                               uint16_t width, bool force_redraw, dual_hsv_t* curr_hsv) {
 #ifdef DISPLAY_KEYLOGGER_ENABLE
-    if (is_keylogger_dirty() || force_redraw) {
+    static uint16_t last_xpos[DISPLAY_KEYLOGGER_LENGTH] = {0};
+    static uint16_t last_end                            = 0;
+    const uint32_t  all_cells                           = UINT32_MAX >> (32 - DISPLAY_KEYLOGGER_LENGTH);
+
+#    ifdef MULTITHREADED_PAINTER_ENABLE
+    // diff our own copy, rather than sharing the dirty flags with the main loop
+    static keylog_buffer_t last_keylog = {0};
+    const keylog_buffer_t *keylog      = &painter_state.keylogger;
+    uint32_t               dirty_cells = force_redraw ? all_cells : keylog_changed_cells(&last_keylog, keylog);
+    memcpy(&last_keylog, keylog, sizeof(keylog_buffer_t));
+    if (!dirty_cells) {
+        return;
+    }
+#    else
+    const keylog_buffer_t *keylog = get_keylogger_buffer();
+    if (force_redraw) {
+        keylogger_set_dirty(true);
+    }
+    if (!is_keylogger_dirty()) {
+        return;
+    }
+    uint32_t dirty_cells = get_keylogger_dirty_cells();
+#    endif // MULTITHREADED_PAINTER_ENABLE
+
+    bool     full_redraw = dirty_cells == all_cells;
+    char     glyph[5];
+    uint16_t glyph_width[DISPLAY_KEYLOGGER_LENGTH];
+    uint8_t  first = DISPLAY_KEYLOGGER_LENGTH;
+
+    if (full_redraw) {
         qp_drawtext_recolor(device, x, y, font, "Keylogger: ", curr_hsv->primary.h, curr_hsv->primary.s,
                             curr_hsv->primary.v, 0, 0, 0);
-        y += font->line_height + 4;
+    }
+    y += font->line_height + 4;
+    if (full_redraw) {
         qp_rect(device, x, y, x + width - 1, y + font->line_height + 2, 0, 0, 0, true);
-        qp_drawtext_recolor(device, x, y, font, truncate_text(get_keylogger_str(), width, font, true, false),
-                            curr_hsv->primary.h, curr_hsv->primary.s, curr_hsv->primary.v, 0, 255, 0);
-        keylogger_set_dirty(false);
+        last_end = x;
+    }
+
+    // keep the newest characters that fit, like truncate_text does
+    for (uint16_t total_width = 0; first > 0; first--) {
+        keylog_get_cell(keylog, first - 1, glyph);
+        glyph_width[first - 1] = qp_textwidth(font, glyph);
+        if (total_width + glyph_width[first - 1] > width) {
+            break;
+        }
+        total_width += glyph_width[first - 1];
+    }
+
+    // only redraw the glyphs that changed, or have moved
+    uint16_t xpos = x;
+    for (uint8_t i = 0; i < DISPLAY_KEYLOGGER_LENGTH; i++) {
+        if (i < first) {
+            last_xpos[i] = UINT16_MAX;
+            continue;
+        }
+        if (full_redraw || (dirty_cells & (1UL << i)) || last_xpos[i] != xpos) {
+            keylog_get_cell(keylog, i, glyph);
+            qp_drawtext_recolor(device, xpos, y, font, glyph, curr_hsv->primary.h, curr_hsv->primary.s,
+                                curr_hsv->primary.v, 0, 255, 0);
+        }
+        last_xpos[i] = xpos;
+        xpos += glyph_width[i];
+    }
+    if (xpos < last_end) {
+        qp_rect(device, xpos, y, last_end - 1, y + font->line_height + 2, 0, 0, 0, true);
     }
+    last_end = xpos;
+#    ifndef MULTITHREADED_PAINTER_ENABLE
+    keylogger_set_dirty(false);
+#    endif // MULTITHREADED_PAINTER_ENABLE
 #endif
 }
 
@@ -996,7 +1077,8 @@ void painter_render_modifiers(painter_device_t device, painter_font_handle_t fon
                 curr_hsv->primary.s, last_mods & MOD_BIT_LSHIFT ? curr_hsv->primary.v : disabled_val, 0, 0, 0)) {
             x += shift_icon->width + 2;
         }
-        if (qp_drawimage_recolor(device, x, y, keymap_config.swap_lctl_lgui ? command_icon : windows_icon,
+        if (qp_drawimage_recolor(device, x, y,
+                                 PAINTER_STATE(keymap_config).swap_lctl_lgui ? command_icon : windows_icon,
                                  last_mods & MOD_BIT_LGUI ? curr_hsv->secondary.h : curr_hsv->primary.h,
                                  last_mods & MOD_BIT_LGUI ? curr_hsv->secondary.s : curr_hsv->primary.s,
                                  last_mods & MOD_BIT_LGUI ? curr_hsv->primary.v : disabled_val, 0, 0, 0)) {
@@ -1026,7 +1108,8 @@ void painter_render_modifiers(painter_device_t device, painter_font_handle_t fon
                                  last_mods & MOD_BIT_RALT ? curr_hsv->primary.v : disabled_val, 0, 0, 0)) {
             x += alt_icon->width + 2;
         }
-        if (qp_drawimage_recolor(device, x, y, keymap_config.swap_rctl_rgui ? command_icon : windows_icon,
+        if (qp_drawimage_recolor(device, x, y,
+                                 PAINTER_STATE(keymap_config).swap_rctl_rgui ? command_icon : windows_icon,
                                  last_mods & MOD_BIT_RGUI ? curr_hsv->secondary.h : curr_hsv->primary.h,
                                  last_mods & MOD_BIT_RGUI ? curr_hsv->secondary.s : curr_hsv->primary.s,
                                  last_mods & MOD_BIT_RGUI ? curr_hsv->primary.v : disabled_val, 0, 0, 0)) {
@@ -1286,14 +1369,6 @@ void render_character_set(painter_device_t display, uint16_t* x_offset, uint16_t
     }
 }
 
-#define GRID_WIDTH   47
-#define GRID_HEIGHT  24
-#define CELL_SIZE    4 // Cell size excluding outline
-#define OUTLINE_SIZE 1
-
-// Define the probability factor for initial alive cells
-#define INITIAL_ALIVE_PROBABILITY 0.5 // 20% chance of being alive
-
 static const hsv_t color_array[] = {
     {.h = 0, .s = 0, .v = 160},    {.h = 23, .s = 89, .v = 255},  {.h = 43, .s = 71, .v = 255},
     {.h = 0, .s = 82, .v = 255},   {.h = 77, .s = 64, .v = 255},  {.h = 176, .s = 77, .v = 255},
@@ -1301,96 +1376,32 @@ static const hsv_t color_array[] = {
 };
 
 void render_life(painter_device_t display, uint16_t xpos, uint16_t ypos, dual_hsv_t* curr_hsv, bool force_redraw) {
-    static bool grid[GRID_HEIGHT][GRID_WIDTH], new_grid[GRID_HEIGHT][GRID_WIDTH], changed_grid[GRID_HEIGHT][GRID_WIDTH];
-    static uint8_t color_value = 0;
+    static painter_life_t life;
+    static uint8_t        color_value = 0;
 
     if (force_redraw) {
         // Initialize the grid with random values
-        for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
-            for (uint8_t x = 0; x < GRID_WIDTH; x++) {
-                grid[y][x] = (rand() < INITIAL_ALIVE_PROBABILITY * RAND_MAX); // Use probability factor
-            }
-        }
+        painter_life_seed(&life);
         color_value = rand() % ARRAY_SIZE(color_array);
     }
     static uint8_t i = 0;
-    if (i++ % 10 != 0) {
+    if (i++ % PAINTER_LIFE_FRAMES_PER_GENERATION != 0) {
         return;
     }
-    for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
-        for (uint8_t x = 0; x < GRID_WIDTH; x++) {
-            if (changed_grid[y][x]) { // Only update changed cells
-                uint16_t left   = xpos + x * (CELL_SIZE + OUTLINE_SIZE);
-                uint16_t top    = ypos + y * (CELL_SIZE + OUTLINE_SIZE);
-                uint16_t right  = xpos + left + CELL_SIZE + OUTLINE_SIZE;
-                uint16_t bottom = ypos + top + CELL_SIZE + OUTLINE_SIZE;
-
-                // Draw the outline
-                qp_rect(display, left, top, right, bottom, curr_hsv->primary.h, curr_hsv->primary.s,
-                        curr_hsv->primary.v / 4, false);
-                qp_rect(display, left + 1, top + 1, right - 1, bottom - 1, 0, 0, 0, true);
-
-                // Draw the filled cell inside the outline if it's alive
-                if (grid[y][x]) {
-                    qp_rect(display, left + OUTLINE_SIZE, top + OUTLINE_SIZE, right - OUTLINE_SIZE,
-                            bottom - OUTLINE_SIZE, color_array[color_value].h, color_array[color_value].s,
-                            color_array[color_value].v, true);
-                }
-            }
-        }
-    }
-    for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
-        for (uint8_t x = 0; x < GRID_WIDTH; x++) {
-            uint8_t alive_neighbors = 0;
-
-            // Count alive neighbors
-            for (int8_t dy = -1; dy <= 1; dy++) {
-                for (int8_t dx = -1; dx <= 1; dx++) {
-                    if (dy == 0 && dx == 0) continue; // Skip the current cell
-                    int8_t ny = y + dy;
-                    int8_t nx = x + dx;
-                    if (ny >= 0 && ny < GRID_HEIGHT && nx >= 0 && nx < GRID_WIDTH) {
-                        alive_neighbors += grid[ny][nx];
-                    }
-                }
-            }
-
-            // Apply the rules of the Game of Life
-            if (grid[y][x]) {
-                // Any live cell with two or three live neighbours survives.
-                new_grid[y][x] = (alive_neighbors == 2 || alive_neighbors == 3);
-            } else {
-                // Any dead cell with exactly three live neighbours becomes a live cell.
-                new_grid[y][x] = (alive_neighbors == 3);
-            }
-
-            // Track changed cells
-            changed_grid[y][x] = (grid[y][x] != new_grid[y][x]);
-        }
-    }
-
-    // Copy new grid state to current grid
-    for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
-        for (uint8_t x = 0; x < GRID_WIDTH; x++) {
-            grid[y][x] = new_grid[y][x];
-        }
-    }
+    painter_life_draw(display, xpos, ypos, &life,
+                      (hsv_t){curr_hsv->primary.h, curr_hsv->primary.s, curr_hsv->primary.v / 4},
+                      color_array[color_value]);
+    painter_life_step(&life);
 
     static uint32_t last_tick = 0;
     uint32_t        now = (last_matrix_activity_time() > last_encoder_activity_time()) ? last_matrix_activity_time()
                                                                                        : last_encoder_activity_time();
     if (last_tick != now) {
         uint8_t cluster_size = 3; // Size of the cluster (3x3)
-        uint8_t x            = rand() % (GRID_WIDTH - cluster_size);
-        uint8_t y            = rand() % (GRID_HEIGHT - cluster_size);
-
-        for (uint8_t dy = 0; dy < cluster_size; dy++) {
-            for (uint8_t dx = 0; dx < cluster_size; dx++) {
-                bool is_alive                = rand() % 2; // Randomly choose between 0 and 1
-                grid[y + dy][x + dx]         = is_alive;   // Set the cell to be alive
-                changed_grid[y + dy][x + dx] = true;       // Mark the cell as changed
-            }
-        }
+        uint8_t x            = rand() % (PAINTER_LIFE_WIDTH - cluster_size);
+        uint8_t y            = rand() % (PAINTER_LIFE_HEIGHT - cluster_size);
+
+        painter_life_scatter(&life, x, y, cluster_size);
         color_value = rand() % ARRAY_SIZE(color_array);
         last_tick   = now;
     }
@@ -1515,21 +1526,27 @@ void painter_init_user(void) {
 #endif // CUSTOM_QUANTUM_PAINTER_ST7789_76X284
 }
 
-void painter_render_user(void) {
+/**
+ * @brief Draws a frame on every display.
+ *
+ * @param damage painter_damage_t bits the frame is drawn for, so each block can skip looking at state that hasn't
+ * changed
+ */
+void painter_render_user(uint16_t damage) {
 #ifdef QUANTUM_PAINTER_ILI9341_ENABLE
-    ili9341_draw_user();
+    ili9341_draw_user(damage);
 #endif // QUANTUM_PAINTER_ILI9341_ENABLE
 #ifdef QUANTUM_PAINTER_ILI9488_ENABLE
-    ili9488_draw_user();
+    ili9488_draw_user(damage);
 #endif // QUANTUM_PAINTER_ILI9341_ENABLE
 #if defined(CUSTOM_QUANTUM_PAINTER_ST7789_135X240)
-    st7789_135x240_draw_user();
+    st7789_135x240_draw_user(damage);
 #endif // CUSTOM_QUANTUM_PAINTER_ST7789_135X240
 #if defined(CUSTOM_QUANTUM_PAINTER_ST7789_170X320)
-    st7789_170x320_draw_user();
+    st7789_170x320_draw_user(damage);
 #endif // CUSTOM_QUANTUM_PAINTER_ST7789_170X320
 #if defined(CUSTOM_QUANTUM_PAINTER_ST7789_76X284)
-    st7789_76x284_draw_user();
+    st7789_76x284_draw_user(damage);
 #endif // CUSTOM_QUANTUM_PAINTER_ST7789_76X284
 #if defined(RGB_MATRIX_ENABLE) || defined(RGBLIGHT_ENABLE)
     rgb_redraw = false;
@@ -1537,14 +1554,26 @@ void painter_render_user(void) {
 }
 
 #ifdef MULTITHREADED_PAINTER_ENABLE
+display_state_snapshot_t painter_state = {0};
+
 static THD_WORKING_AREA(waUIThread, 1024);
 static THD_FUNCTION(UIThread, arg) {
     (void)arg;
+    uint32_t painter_state_seq = 0;
+
     chRegSetThreadName("ui");
+    // the displays are set up from a snapshot too, so wait for the first one (the boot damage publishes it)
+    while (painter_thread_running && !display_state_read(&painter_state, &painter_state_seq)) {
+        wait_ms(QUANTUM_PAINTER_TASK_THROTTLE);
+    }
     painter_init_user();
+    painter_render_user(painter_state.damage);
     while (painter_thread_running) {
-        painter_render_user();
-        wait_ms(10);
+        // only render from our own copy of the state, and only when the main loop has published a new one
+        if (display_state_read(&painter_state, &painter_state_seq)) {
+            painter_render_user(painter_state.damage);
+        }
+        wait_ms(QUANTUM_PAINTER_TASK_THROTTLE);
     }
 }
 #endif // MULTITHREADED_PAINTER_ENABLE
@@ -1564,22 +1593,26 @@ void housekeeping_task_display_menu_user(void) {
     if (has_rgb_matrix_config_changed()) {
         display_menu_set_dirty(true);
         rgb_redraw = true;
+        painter_damage_mark(PAINTER_DAMAGE_RGB);
     }
 #endif
 #if defined(RGBLIGHT_ENABLE)
     if (has_rgblight_config_changed()) {
         display_menu_set_dirty(true);
         rgb_redraw = true;
+        painter_damage_mark(PAINTER_DAMAGE_RGB);
     }
 #endif
-#ifndef MULTITHREADED_PAINTER_ENABLE
-    static uint32_t last_tick = 0;
-    uint32_t        now       = timer_read32();
-    if (TIMER_DIFF_32(now, last_tick) >= (QUANTUM_PAINTER_TASK_THROTTLE)) {
-        painter_render_user();
-        last_tick = now;
-    }
+    painter_damage_task();
+    // only draw when something has changed, but no more often than the throttle allows
+    uint16_t damage = painter_damage_frame();
+    if (damage != PAINTER_DAMAGE_NONE) {
+#ifdef MULTITHREADED_PAINTER_ENABLE
+        display_state_publish(damage);
+#else
+        painter_render_user(damage);
 #endif // MULTITHREADED_PAINTER_ENABLE
+    }
 #if (QUANTUM_PAINTER_DISPLAY_TIMEOUT) > 0
     if (is_keyboard_master() && (last_input_activity_elapsed() > QUANTUM_PAINTER_DISPLAY_TIMEOUT)) {
         qp_backlight_disable();
@@ -1613,12 +1646,12 @@ void keyboard_post_init_quantum_painter(void) {
 #endif // MULTITHREADED_PAINTER_ENABLE
     if (userspace_config.display.painter.left.display_logo >= screensaver_image_size) {
         userspace_config.display.painter.left.display_logo = 0;
-        eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+        userspace_config_mark_dirty();
     }
 #ifdef SPLIT_KEYBOARD
     if (userspace_config.display.painter.right.display_logo >= screensaver_image_size) {
         userspace_config.display.painter.right.display_logo = 0;
-        eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+        userspace_config_mark_dirty();
     }
 #endif
 }
@@ -1630,6 +1663,7 @@ void suspend_power_down_quantum_painter(void) {
 
 void suspend_wakeup_init_quantum_painter(void) {
     painter_display_power(true);
+    painter_damage_mark(PAINTER_DAMAGE_ALL);
     qp_backlight_enable();
 }
 
@@ -1683,7 +1717,8 @@ void shutdown_quantum_painter(bool jump_to_bootloader) {
 #include <lib/lib8tion/lib8tion.h>
 
 /**
- * @brief Get the current HSV values for the painter
+ * @brief Get the current HSV values for the painter. This reads the live config, for the main loop; render code
+ * reads PAINTER_STATE(userspace_config) instead, as the painter thread draws from a snapshot.
  *
  * @return HSV
  */
@@ -1706,7 +1741,7 @@ void painter_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool wr
     hsv->s = sat;
     hsv->v = val;
     if (write_to_eeprom) {
-        eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+        userspace_config_mark_dirty();
     }
     dprintf("painter set %s hsv [%s]: %u,%u,%u\n", primary ? "primary" : "secondary",
             write_to_eeprom ? "EEPROM" : "NOEEPROM", hsv->h, hsv->s, hsv->v);
@@ -1733,7 +1768,8 @@ void painter_sethsv(uint8_t hue, uint8_t sat, uint8_t val, bool primary) {
 }
 
 /**
- * @brief Get the current HSV values for the painter
+ * @brief Get the current HSV values for the painter. Like painter_get_dual_hsv(), this reads the live config, so
+ * render code uses PAINTER_STATE(userspace_config) instead.
  *
  * @return HSV
  */
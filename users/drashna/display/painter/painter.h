@@ -12,10 +12,21 @@
 #include "display/painter/graphics.qgf.h"
 #include "display/painter/graphics/assets.h"
 #include "display/display.h"
+#include "display/painter/painter_damage.h"
+#include "display/painter/painter_rle565.h"
+
+#ifdef MULTITHREADED_PAINTER_ENABLE
+#    include "display/painter/display_state.h"
+extern display_state_snapshot_t painter_state;
+// the painter thread renders from its own snapshot, rather than the live state
+#    define PAINTER_STATE(name) (painter_state.name)
+#else
+#    define PAINTER_STATE(name) (name)
+#endif // MULTITHREADED_PAINTER_ENABLE
 
 typedef struct {
-    const uint8_t* data;
-    const char*    name;
+    const painter_rle565_image_t* image;
+    const char*                   name;
 } painter_image_array_t;
 extern painter_image_array_t screen_saver_image[];
 extern const uint8_t         screensaver_image_size;
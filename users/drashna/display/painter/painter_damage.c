@@ -0,0 +1,164 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "display/painter/painter_damage.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "led.h"
+#include "timer.h"
+#ifdef SPLIT_KEYBOARD
+#    include "split_util.h"
+#endif // SPLIT_KEYBOARD
+#ifdef CAPS_WORD_ENABLE
+#    include "caps_word.h"
+#endif // CAPS_WORD_ENABLE
+#ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
+#    include "pointing_device.h"
+#endif // POINTING_DEVICE_AUTO_MOUSE_ENABLE
+#if defined(KEYBOARD_bastardkb_charybdis) || defined(KEYBOARD_handwired_tractyl_manuform)
+#    include QMK_KEYBOARD_H
+#endif // KEYBOARD_bastardkb_charybdis || KEYBOARD_handwired_tractyl_manuform
+#ifdef MULTITHREADED_PAINTER_ENABLE
+#    include <ch.h>
+#endif // MULTITHREADED_PAINTER_ENABLE
+
+static uint16_t painter_damage = PAINTER_DAMAGE_ALL;
+
+/**
+ * @brief Marks part of the display state as changed, so the next render pass redraws it.
+ *
+ * With the multithreaded painter, this is called from the main (or split slave) thread while the UI thread
+ * consumes it, and Cortex-M0 has no atomic read-modify-write, so the update is done with the system locked.
+ *
+ * @param damage painter_damage_t bits to mark
+ */
+void painter_damage_mark(uint16_t damage) {
+#ifdef MULTITHREADED_PAINTER_ENABLE
+    syssts_t status = chSysGetStatusAndLockX();
+    painter_damage |= damage;
+    chSysRestoreStatusX(status);
+#else
+    painter_damage |= damage;
+#endif // MULTITHREADED_PAINTER_ENABLE
+}
+
+/**
+ * @brief Gets and clears the pending damage. Called at the start of a render pass, so anything marked while the
+ * frame is being drawn is picked up by the next one.
+ *
+ * @return uint16_t painter_damage_t bits that were pending
+ */
+uint16_t painter_damage_take(void) {
+#ifdef MULTITHREADED_PAINTER_ENABLE
+    syssts_t status = chSysGetStatusAndLockX();
+    uint16_t damage = painter_damage;
+    painter_damage  = PAINTER_DAMAGE_NONE;
+    chSysRestoreStatusX(status);
+#else
+    uint16_t damage = painter_damage;
+    painter_damage  = PAINTER_DAMAGE_NONE;
+#endif // MULTITHREADED_PAINTER_ENABLE
+    return damage;
+}
+
+/**
+ * @brief Checks if anything needs to be redrawn, without clearing it.
+ *
+ * @return true if there is pending damage
+ */
+bool painter_damage_pending(void) {
+    return painter_damage != PAINTER_DAMAGE_NONE;
+}
+
+/**
+ * @brief Takes the damage for the next frame, if one is due: something has to be pending, and the last frame has to
+ * be at least QUANTUM_PAINTER_TASK_THROTTLE ms old. Anything marked in between is held for the next frame, so a
+ * burst of marks is drawn once.
+ *
+ * @return uint16_t painter_damage_t bits to draw the frame for, or PAINTER_DAMAGE_NONE if no frame is due
+ */
+uint16_t painter_damage_frame(void) {
+    static uint32_t last_frame = 0;
+    uint32_t        now        = timer_read32();
+
+    if (!painter_damage_pending() || TIMER_DIFF_32(now, last_frame) < (QUANTUM_PAINTER_TASK_THROTTLE)) {
+        return PAINTER_DAMAGE_NONE;
+    }
+    last_frame = now;
+    return painter_damage_take();
+}
+
+/**
+ * @brief Picks up state that can change without going through one of our callbacks (such as the layer and LED
+ * state synced to the slave half by the core, one shot mods or caps word timing out, or the pointing device
+ * settings), and marks a periodic refresh for anything that is purely time based, such as the scan rate, clock and
+ * screensaver.
+ */
+void painter_damage_task(void) {
+    static layer_state_t last_layer_state         = 0;
+    static layer_state_t last_default_layer_state = 0;
+    static led_t         last_led_state           = {0};
+    static uint8_t       last_mods                = 0;
+    static uint8_t       last_oneshot_mods        = 0;
+    static uint16_t      last_refresh             = 0;
+    uint16_t             damage                   = PAINTER_DAMAGE_NONE;
+
+    if (last_layer_state != layer_state || last_default_layer_state != default_layer_state) {
+        last_layer_state         = layer_state;
+        last_default_layer_state = default_layer_state;
+        damage |= PAINTER_DAMAGE_LAYER;
+    }
+    if (last_led_state.raw != host_keyboard_led_state().raw) {
+        last_led_state = host_keyboard_led_state();
+        damage |= PAINTER_DAMAGE_LED_STATE;
+    }
+    if (last_mods != get_mods() || last_oneshot_mods != get_oneshot_mods()) {
+        last_mods         = get_mods();
+        last_oneshot_mods = get_oneshot_mods();
+        damage |= PAINTER_DAMAGE_MODS;
+    }
+#ifdef CAPS_WORD_ENABLE
+    // caps word times out on its own, and is drawn with the mods
+    static bool last_caps_word = false;
+    if (last_caps_word != is_caps_word_on()) {
+        last_caps_word = is_caps_word_on();
+        damage |= PAINTER_DAMAGE_MODS;
+    }
+#endif // CAPS_WORD_ENABLE
+#ifdef SPLIT_KEYBOARD
+    static bool last_transport_connected = false;
+    if (last_transport_connected != is_transport_connected()) {
+        last_transport_connected = is_transport_connected();
+        damage |= PAINTER_DAMAGE_TRANSPORT;
+    }
+#endif // SPLIT_KEYBOARD
+#ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
+    static bool    last_auto_mouse_enable = false;
+    static uint8_t last_auto_mouse_layer  = 0;
+    if (last_auto_mouse_enable != get_auto_mouse_enable() || last_auto_mouse_layer != get_auto_mouse_layer()) {
+        last_auto_mouse_enable = get_auto_mouse_enable();
+        last_auto_mouse_layer  = get_auto_mouse_layer();
+        damage |= PAINTER_DAMAGE_POINTING;
+    }
+#endif // POINTING_DEVICE_AUTO_MOUSE_ENABLE
+#if defined(KEYBOARD_bastardkb_charybdis) || defined(KEYBOARD_handwired_tractyl_manuform)
+    static uint16_t last_cpi        = 0;
+    static bool     last_sniping    = false;
+    static bool     last_dragscroll = false;
+    if (last_cpi != charybdis_get_pointer_default_dpi() || last_sniping != charybdis_get_pointer_sniping_enabled() ||
+        last_dragscroll != charybdis_get_pointer_dragscroll_enabled()) {
+        last_cpi        = charybdis_get_pointer_default_dpi();
+        last_sniping    = charybdis_get_pointer_sniping_enabled();
+        last_dragscroll = charybdis_get_pointer_dragscroll_enabled();
+        damage |= PAINTER_DAMAGE_POINTING;
+    }
+#endif // KEYBOARD_bastardkb_charybdis || KEYBOARD_handwired_tractyl_manuform
+    if (timer_elapsed(last_refresh) >= PAINTER_IDLE_REFRESH_MS) {
+        last_refresh = timer_read();
+        damage |= PAINTER_DAMAGE_TIMER;
+    }
+
+    if (damage != PAINTER_DAMAGE_NONE) {
+        painter_damage_mark(damage);
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef PAINTER_IDLE_REFRESH_MS
+#    define PAINTER_IDLE_REFRESH_MS 100
+#endif // PAINTER_IDLE_REFRESH_MS
+
+/**
+ * @brief Reasons the displays need to be redrawn. Producers mark what changed, and the render task only draws a
+ * frame when something is pending, rather than polling every panel every QUANTUM_PAINTER_TASK_THROTTLE ms.
+ * PAINTER_DAMAGE_TIMER is the idle refresh, for the blocks that show something time based, such as the clock.
+ */
+typedef enum painter_damage_t {
+    PAINTER_DAMAGE_NONE       = 0,
+    PAINTER_DAMAGE_INPUT      = (1 << 0),
+    PAINTER_DAMAGE_LAYER      = (1 << 1),
+    PAINTER_DAMAGE_LED_STATE  = (1 << 2),
+    PAINTER_DAMAGE_MODS       = (1 << 3),
+    PAINTER_DAMAGE_RGB        = (1 << 4),
+    PAINTER_DAMAGE_TRANSPORT  = (1 << 5),
+    PAINTER_DAMAGE_SPLIT_SYNC = (1 << 6),
+    PAINTER_DAMAGE_WPM        = (1 << 7),
+    PAINTER_DAMAGE_TIMER      = (1 << 8),
+    PAINTER_DAMAGE_CONSOLE    = (1 << 9),
+    PAINTER_DAMAGE_MENU       = (1 << 10),
+    PAINTER_DAMAGE_POINTING   = (1 << 11),
+    PAINTER_DAMAGE_ANIMATION  = (1 << 12),
+    PAINTER_DAMAGE_HOST_OS    = (1 << 13),
+    PAINTER_DAMAGE_ALL        = 0xFFFF,
+} painter_damage_t;
+
+// Everything the menu block modes draw from, including the animated ones asking for their next frame
+#define PAINTER_DAMAGE_MENU_BLOCK                                                                     \
+    (PAINTER_DAMAGE_MENU | PAINTER_DAMAGE_ANIMATION | PAINTER_DAMAGE_CONSOLE | PAINTER_DAMAGE_INPUT | \
+     PAINTER_DAMAGE_LAYER | PAINTER_DAMAGE_SPLIT_SYNC)
+
+void     painter_damage_mark(uint16_t damage);
+uint16_t painter_damage_take(void);
+bool     painter_damage_pending(void);
+uint16_t painter_damage_frame(void);
+void     painter_damage_task(void);
+
+/**
+ * @brief Checks if a block has to look at its state for the damage of a frame. A block only sees the idle refresh if
+ * it asks for PAINTER_DAMAGE_TIMER, so anything else it shows needs a producer that marks it when it changes.
+ *
+ * @param damage painter_damage_t bits the frame is drawn for
+ * @param bits painter_damage_t bits the block depends on
+ * @return true if the block has to be checked
+ */
+static inline bool painter_damage_has(uint16_t damage, uint16_t bits) {
+    return (damage & bits) != PAINTER_DAMAGE_NONE;
+}
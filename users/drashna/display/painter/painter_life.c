@@ -0,0 +1,232 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include "display/painter/painter_life.h"
+
+#define PAINTER_LIFE_MASK ((1ULL << PAINTER_LIFE_WIDTH) - 1)
+
+/**
+ * @brief Fills the grid with random cells. The outlines are drawn again, as whatever was on the screen may have been
+ * cleared.
+ *
+ * @param life grid to seed
+ */
+void painter_life_seed(painter_life_t *life) {
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        life->rows[y] = 0;
+        for (uint8_t x = 0; x < PAINTER_LIFE_WIDTH; x++) {
+            if (rand() < PAINTER_LIFE_INITIAL_ALIVE_PROBABILITY * RAND_MAX) {
+                life->rows[y] |= 1ULL << x;
+            }
+        }
+    }
+    memset(life->outlined, 0, sizeof(life->outlined));
+}
+
+/**
+ * @brief Sets a square of cells to random values, and marks them for drawing.
+ *
+ * @param life grid to change
+ * @param x left column of the square
+ * @param y top row of the square
+ * @param size width and height of the square, which has to fit in the grid
+ */
+void painter_life_scatter(painter_life_t *life, uint8_t x, uint8_t y, uint8_t size) {
+    for (uint8_t dy = 0; dy < size; dy++) {
+        for (uint8_t dx = 0; dx < size; dx++) {
+            uint64_t cell = 1ULL << (x + dx);
+            if (rand() % 2) {
+                life->rows[y + dy] |= cell;
+            } else {
+                life->rows[y + dy] &= ~cell;
+            }
+            life->changed[y + dy] |= cell;
+        }
+    }
+}
+
+/**
+ * @brief Counts each cell and its left and right neighbours in a row, for every column at once.
+ *
+ * @param row row to count
+ * @param ones low bit of the counts
+ * @param twos high bit of the counts
+ */
+static inline void painter_life_sum3(uint64_t row, uint64_t *ones, uint64_t *twos) {
+    uint64_t left = row << 1, right = row >> 1;
+
+    *ones = left ^ row ^ right;
+    *twos = (left & row) | (right & (left ^ row));
+}
+
+/**
+ * @brief Advances the grid by one generation, and marks the cells that changed for drawing.
+ *
+ * Instead of looking up the eight neighbours of each cell, the counts for a whole row are added up a bit at a time, as
+ * a 47 wide adder. A cell lives on with a count of 2 or 3, and comes alive with 3. Both need exactly one of the twos
+ * from the rows above and below, the left and right neighbours, and the carry out of the ones, so that is the only
+ * part of the count needed past its low bit.
+ *
+ * @param life grid to advance
+ */
+void painter_life_step(painter_life_t *life) {
+    uint64_t above_ones = 0, above_twos = 0, ones, twos;
+
+    painter_life_sum3(life->rows[0], &ones, &twos);
+    for (uint8_t y = 0; y < PAINTER_LIFE_HEIGHT; y++) {
+        uint64_t row = life->rows[y], below_ones = 0, below_twos = 0;
+
+        if (y + 1 < PAINTER_LIFE_HEIGHT) {
+            painter_life_sum3(life->rows[y + 1], &below_ones, &below_twos);
+        }
+
+        // The row itself counts its left and right neighbours, but not the cell
+        uint64_t middle_ones = (row << 1) ^ (row >> 1);
+        uint64_t middle_twos = (row << 1) & (row >> 1);
+        uint64_t sum_ones    = above_ones ^ middle_ones ^ below_ones;
+        uint64_t carry       = (above_ones & middle_ones) | (below_ones & (above_ones ^ middle_ones));
+        uint64_t odd_twos    = above_twos ^ middle_twos ^ below_twos ^ carry;
+        uint64_t many_twos   = (above_twos & middle_twos) | (below_twos & carry) |
+                             ((above_twos ^ middle_twos) & (below_twos ^ carry));
+        uint64_t next        = odd_twos & ~many_twos & (sum_ones | row) & PAINTER_LIFE_MASK;
+
+        life->changed[y] |= row ^ next;
+
+        life->rows[y] = next;
+        above_ones    = ones;
+        above_twos    = twos;
+        ones          = below_ones;
+        twos          = below_twos;
+    }
+}
+
+#ifdef PAINTER_LIFE_DRAW_RECTS
+/**
+ * @brief Draws the cells marked as changed, a span of neighbouring changed cells in a row at a time.
+ *
+ * Each span gets one rectangle for its outlines, which is skipped once every cell in it has been outlined in the
+ * current colour, and then one for the inside of each cell. The outlines of neighbouring cells overlap, so drawing
+ * them cell by cell would cost two or three rectangles a cell, each with its own window on the panel.
+ *
+ * @param device device to draw to
+ * @param x left edge of the grid
+ * @param y top edge of the grid
+ * @param life grid to draw
+ * @param outline colour of the cell outlines
+ * @param alive colour of the live cells
+ * @return true if the changed cells were drawn
+ * @return false if they couldn't be sent to the device
+ */
+bool painter_life_draw(painter_device_t device, uint16_t x, uint16_t y, painter_life_t *life, hsv_t outline,
+                       hsv_t alive) {
+    bool success = true;
+
+    if (outline.h != life->outline.h || outline.s != life->outline.s || outline.v != life->outline.v) {
+        memset(life->outlined, 0, sizeof(life->outlined));
+        life->outline = outline;
+    }
+
+    for (uint8_t row = 0; row < PAINTER_LIFE_HEIGHT; row++) {
+        uint64_t changed = life->changed[row];
+        uint16_t top     = y + row * PAINTER_LIFE_PITCH;
+
+        while (changed) {
+            uint8_t  first  = __builtin_ctzll(changed);
+            uint8_t  length = __builtin_ctzll(~(changed >> first));
+            uint64_t span   = ((1ULL << length) - 1) << first;
+            uint16_t left   = x + first * PAINTER_LIFE_PITCH;
+
+            if ((life->outlined[row] & span) != span) {
+                success &= qp_rect(device, left, top, left + length * PAINTER_LIFE_PITCH, top + PAINTER_LIFE_PITCH,
+                                   outline.h, outline.s, outline.v, true);
+                life->outlined[row] |= span;
+            }
+            for (uint8_t column = first; column < first + length; column++, left += PAINTER_LIFE_PITCH) {
+                hsv_t colour = (life->rows[row] >> column) & 1 ? alive : (hsv_t){0, 0, 0};
+                success &= qp_rect(device, left + PAINTER_LIFE_OUTLINE_SIZE, top + PAINTER_LIFE_OUTLINE_SIZE,
+                                   left + PAINTER_LIFE_CELL_SIZE, top + PAINTER_LIFE_CELL_SIZE, colour.h, colour.s,
+                                   colour.v, true);
+            }
+            changed &= ~span;
+        }
+        life->changed[row] = 0;
+    }
+    return success;
+}
+#else // PAINTER_LIFE_DRAW_RECTS
+static uint16_t life_line[PAINTER_LIFE_WIDTH * PAINTER_LIFE_PITCH + PAINTER_LIFE_OUTLINE_SIZE];
+
+/**
+ * @brief Converts a colour to the native (byte swapped) RGB565 of the panel, the way Quantum Painter converts the
+ * colours given to qp_rect().
+ */
+static uint16_t painter_life_rgb565(hsv_t hsv) {
+    rgb_t    rgb    = hsv_to_rgb_nocie(hsv);
+    uint16_t rgb565 = (rgb.r >> 3) << 11 | (rgb.g >> 2) << 5 | rgb.b >> 3;
+    return __builtin_bswap16(rgb565);
+}
+
+/**
+ * @brief Draws the cells marked as changed, a span of neighbouring changed cells in a row at a time.
+ *
+ * Each span is a single window on the panel, with its outlines and cells streamed into it as pixel data a line at a
+ * time. Every line of the insides of the cells is the same, so it is built once per span.
+ *
+ * @param device device to draw to, which has to take RGB565 pixel data
+ * @param x left edge of the grid
+ * @param y top edge of the grid
+ * @param life grid to draw
+ * @param outline colour of the cell outlines
+ * @param alive colour of the live cells
+ * @return true if the changed cells were drawn
+ * @return false if they couldn't be sent to the device
+ */
+bool painter_life_draw(painter_device_t device, uint16_t x, uint16_t y, painter_life_t *life, hsv_t outline,
+                       hsv_t alive) {
+    uint16_t outline_pixel = painter_life_rgb565(outline), alive_pixel = painter_life_rgb565(alive);
+    bool     success       = true;
+
+    life->outline = outline;
+    for (uint8_t row = 0; row < PAINTER_LIFE_HEIGHT; row++) {
+        uint64_t changed = life->changed[row];
+        uint16_t top     = y + row * PAINTER_LIFE_PITCH;
+
+        while (changed) {
+            uint8_t  first  = __builtin_ctzll(changed);
+            uint8_t  length = __builtin_ctzll(~(changed >> first));
+            uint64_t span   = ((1ULL << length) - 1) << first;
+            uint16_t left   = x + first * PAINTER_LIFE_PITCH;
+            uint16_t width  = length * PAINTER_LIFE_PITCH + PAINTER_LIFE_OUTLINE_SIZE;
+
+            changed &= ~span;
+            if (!qp_viewport(device, left, top, left + width - 1, top + PAINTER_LIFE_PITCH)) {
+                success = false;
+                continue;
+            }
+
+            for (uint16_t i = 0; i < width; i++) {
+                life_line[i] = outline_pixel;
+            }
+            success &= qp_pixdata(device, life_line, width);
+            for (uint8_t column = first; column < first + length; column++) {
+                uint16_t  cell = (life->rows[row] >> column) & 1 ? alive_pixel : 0;
+                uint16_t *line = &life_line[(column - first) * PAINTER_LIFE_PITCH + PAINTER_LIFE_OUTLINE_SIZE];
+                for (uint8_t i = 0; i < PAINTER_LIFE_CELL_SIZE; i++) {
+                    line[i] = cell;
+                }
+            }
+            for (uint8_t i = 0; i < PAINTER_LIFE_CELL_SIZE; i++) {
+                success &= qp_pixdata(device, life_line, width);
+            }
+            for (uint16_t i = 0; i < width; i++) {
+                life_line[i] = outline_pixel;
+            }
+            success &= qp_pixdata(device, life_line, width);
+        }
+        life->changed[row] = 0;
+    }
+    return success;
+}
+#endif // PAINTER_LIFE_DRAW_RECTS
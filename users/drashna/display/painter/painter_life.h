@@ -0,0 +1,46 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "qp.h"
+#include "color.h"
+
+#define PAINTER_LIFE_WIDTH        47
+#define PAINTER_LIFE_HEIGHT       24
+#define PAINTER_LIFE_CELL_SIZE    4 // Cell size excluding outline
+#define PAINTER_LIFE_OUTLINE_SIZE 1
+#define PAINTER_LIFE_PITCH        (PAINTER_LIFE_CELL_SIZE + PAINTER_LIFE_OUTLINE_SIZE)
+
+// Define the probability factor for initial alive cells
+#ifndef PAINTER_LIFE_INITIAL_ALIVE_PROBABILITY
+#    define PAINTER_LIFE_INITIAL_ALIVE_PROBABILITY 0.5 // 50% chance of being alive
+#endif // PAINTER_LIFE_INITIAL_ALIVE_PROBABILITY
+#ifndef PAINTER_LIFE_FRAMES_PER_GENERATION
+#    define PAINTER_LIFE_FRAMES_PER_GENERATION 1
+#endif // PAINTER_LIFE_FRAMES_PER_GENERATION
+
+// Without its surfaces, the menu block is drawn straight to the ILI9488, which doesn't take RGB565 pixel data
+#if defined(QUANTUM_PAINTER_ILI9488_ENABLE) && !defined(QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE)
+#    define PAINTER_LIFE_DRAW_RECTS
+#endif // QUANTUM_PAINTER_ILI9488_ENABLE && !QUANTUM_PAINTER_DRIVERS_ILI9488_SURFACE
+
+_Static_assert(PAINTER_LIFE_WIDTH < 64, "A row of the Game of Life, plus a bit either side, has to fit in a uint64_t");
+
+/**
+ * @brief A Game of Life grid as bitboards: bit x of a row is the cell in column x. Cells past the edges are dead.
+ */
+typedef struct painter_life_t {
+    uint64_t rows[PAINTER_LIFE_HEIGHT];
+    uint64_t changed[PAINTER_LIFE_HEIGHT];  // cells that need drawing
+    uint64_t outlined[PAINTER_LIFE_HEIGHT]; // cells with an outline already drawn in outline, for the rects
+    hsv_t    outline;
+} painter_life_t;
+
+void painter_life_seed(painter_life_t *life);
+void painter_life_scatter(painter_life_t *life, uint8_t x, uint8_t y, uint8_t size);
+void painter_life_step(painter_life_t *life);
+bool painter_life_draw(painter_device_t device, uint16_t x, uint16_t y, painter_life_t *life, hsv_t outline,
+                       hsv_t alive);
@@ -0,0 +1,66 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "display/painter/painter_rle565.h"
+
+#define RLE565_FLAG_RUN 0x80
+
+static uint16_t rle565_buffer[PAINTER_RLE565_BUFFER_PIXELS];
+
+/**
+ * @brief Draws an image in the row RLE format, decoding it straight into native pixels and sending them to the
+ * panel a buffer at a time, rather than going through the generic QGF decoder and its per pixel callbacks.
+ *
+ * Each token is a byte holding a count - 1 in its low 7 bits. With the top bit set, it is followed by a palette
+ * index to repeat count times, and otherwise by count palette indices.
+ *
+ * @param device device to draw to, which has to take RGB565 pixel data
+ * @param x left edge of the image
+ * @param y top edge of the image
+ * @param image image to draw
+ * @return true if the image was drawn
+ * @return false if it couldn't be sent to the device
+ */
+bool painter_rle565_draw(painter_device_t device, uint16_t x, uint16_t y, const painter_rle565_image_t *image) {
+    if (image == NULL || !qp_viewport(device, x, y, x + image->width - 1, y + image->height - 1)) {
+        return false;
+    }
+
+    const uint16_t *palette = image->palette;
+    const uint8_t  *data    = image->data;
+    const uint8_t  *end     = data + image->data_size;
+    uint16_t        pixels  = 0;
+
+    while (data < end) {
+        uint8_t token = *data++;
+        uint8_t count = (token & ~RLE565_FLAG_RUN) + 1;
+
+        while (count) {
+            uint16_t space  = PAINTER_RLE565_BUFFER_PIXELS - pixels;
+            uint8_t  length = count < space ? count : space;
+            if (token & RLE565_FLAG_RUN) {
+                uint16_t colour = palette[*data];
+                for (uint8_t i = 0; i < length; i++) {
+                    rle565_buffer[pixels++] = colour;
+                }
+            } else {
+                for (uint8_t i = 0; i < length; i++) {
+                    rle565_buffer[pixels++] = palette[*data++];
+                }
+            }
+            count -= length;
+
+            if (pixels == PAINTER_RLE565_BUFFER_PIXELS) {
+                if (!qp_pixdata(device, rle565_buffer, pixels)) {
+                    return false;
+                }
+                pixels = 0;
+            }
+        }
+        if (token & RLE565_FLAG_RUN) {
+            data++;
+        }
+    }
+
+    return pixels == 0 || qp_pixdata(device, rle565_buffer, pixels);
+}
@@ -0,0 +1,27 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "qp.h"
+
+#ifndef PAINTER_RLE565_BUFFER_PIXELS
+#    define PAINTER_RLE565_BUFFER_PIXELS 1024
+#endif // PAINTER_RLE565_BUFFER_PIXELS
+
+/**
+ * @brief An image in the row RLE format generated by graphics/convert_rle565.py, with its palette already in the
+ * native (byte swapped) RGB565 of the panel, so that it can be drawn without being opened or converted first.
+ */
+typedef struct painter_rle565_image_t {
+    uint16_t        width;
+    uint16_t        height;
+    uint16_t        palette_size;
+    const uint16_t *palette;
+    uint32_t        data_size;
+    const uint8_t  *data;
+} painter_rle565_image_t;
+
+bool painter_rle565_draw(painter_device_t device, uint16_t x, uint16_t y, const painter_rle565_image_t *image);
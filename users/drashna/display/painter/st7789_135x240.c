@@ -101,31 +101,35 @@ void init_display_st7789_135x240(void) {
     qp_rect(st7789_135x240_surface_display, 0, 0, 135 - 1, 240 - 1, HSV_BLACK, true);
 #endif // QUANTUM_PAINTER_DRIVERS_ST7789_135X240_SURFACE
 
-    st7789_135x240_draw_user();
+    st7789_135x240_draw_user(PAINTER_DAMAGE_ALL);
 }
 
 void st7789_135x240_display_power(bool on) {
     qp_power(st7789_135x240_display, on);
 }
 
-__attribute__((weak)) void st7789_135x240_draw_user(void) {
+__attribute__((weak)) void st7789_135x240_draw_user(uint16_t damage) {
+    // only the menu and the screensaver are drawn here, and the screensaver runs off the idle refresh
+    if (!painter_damage_has(damage, PAINTER_DAMAGE_MENU | PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC |
+                                        PAINTER_DAMAGE_TIMER)) {
+        return;
+    }
     static uint16_t last_activity = UINT16_MAX - 9999;
 
 #ifdef COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
 #    ifdef QUANTUM_PAINTER_DRIVERS_ST7789_135X240_SURFACE
     if (!painter_render_menu(st7789_135x240_surface_display, font_oled, 0, 0, 135, 240, false,
-                             userspace_config.display.painter.hsv.primary,
-                             userspace_config.display.painter.hsv.secondary))
+                             PAINTER_STATE(userspace_config).display.painter.hsv.primary,
+                             PAINTER_STATE(userspace_config).display.painter.hsv.secondary))
 #    else  // QUANTUM_PAINTER_DRIVERS_ST7789_135X240_SURFACE
     if (!painter_render_menu(st7789_135x240_display, font_oled, 50, 40, 240, 320, false,
-                             userspace_config.display.painter.hsv.primary,
-                             userspace_config.display.painter.hsv.secondary))
+                             PAINTER_STATE(userspace_config).display.painter.hsv.primary,
+                             PAINTER_STATE(userspace_config).display.painter.hsv.secondary))
 #    endif // QUANTUM_PAINTER_DRIVERS_ST7789_135X240_SURFACE
 #endif     // COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
     {
         extern painter_image_array_t screen_saver_image[];
         extern const uint8_t         screensaver_image_size;
-        painter_image_handle_t       screen_saver = NULL;
 
         static uint8_t screensaver = 0;
 
@@ -135,11 +139,7 @@ __attribute__((weak)) void st7789_135x240_draw_user(void) {
                 screensaver = 0;
             }
 
-            screen_saver = qp_load_image_mem(screen_saver_image[screensaver].data);
-
-            if (screen_saver != NULL) {
-                qp_drawimage(st7789_135x240_display, 0, 0, screen_saver);
-                qp_close_image(screen_saver);
+            if (painter_rle565_draw(st7789_135x240_display, 0, 0, screen_saver_image[screensaver].image)) {
                 last_activity = timer_read();
             }
         }
@@ -7,7 +7,7 @@
 
 void init_display_st7789_135x240(void);
 void st7789_135x240_display_power(bool on);
-void st7789_135x240_draw_user(void);
+void st7789_135x240_draw_user(uint16_t damage);
 void st7789_135x240_display_shutdown(bool jump_to_bootloader);
 void init_display_st7789_135x240_rotation(void);
 void init_display_st7789_135x240_inversion(void);
@@ -109,7 +109,12 @@ void st7789_170x320_display_power(bool on) {
     qp_power(st7789_display, on);
 }
 
-__attribute__((weak)) void st7789_170x320_draw_user(void) {
+__attribute__((weak)) void st7789_170x320_draw_user(uint16_t damage) {
+    // only the menu and the screensaver are drawn here, and the screensaver runs off the idle refresh
+    if (!painter_damage_has(damage, PAINTER_DAMAGE_MENU | PAINTER_DAMAGE_INPUT | PAINTER_DAMAGE_SPLIT_SYNC |
+                                        PAINTER_DAMAGE_TIMER)) {
+        return;
+    }
     uint16_t width;
     uint16_t height;
     qp_get_geometry(st7789_display, &width, &height, NULL, NULL, NULL);
@@ -117,27 +122,23 @@ __attribute__((weak)) void st7789_170x320_draw_user(void) {
     static bool force_redraw = false;
 #ifdef COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
     if (painter_render_menu(st7789_170x320_surface_display, font_oled, 0, 0, width, height, false,
-                            userspace_config.display.painter.hsv.primary,
-                            userspace_config.display.painter.hsv.secondary)) {
+                            PAINTER_STATE(userspace_config).display.painter.hsv.primary,
+                            PAINTER_STATE(userspace_config).display.painter.hsv.secondary)) {
         force_redraw = true;
     } else
 #endif // COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
     {
         static uint8_t display_logo     = 0xFF;
-        const uint8_t  display_logo_ref = is_keyboard_left() ? userspace_config.display.painter.display_logo_left
-                                                             : userspace_config.display.painter.display_logo_right;
+        const uint8_t  display_logo_ref = is_keyboard_left()
+                                              ? PAINTER_STATE(userspace_config).display.painter.display_logo_left
+                                              : PAINTER_STATE(userspace_config).display.painter.display_logo_right;
 
         if (display_logo != display_logo_ref) {
             display_logo = display_logo_ref;
             force_redraw = true;
         }
         if (force_redraw) {
-            painter_image_handle_t screen_saver = qp_load_image_mem(screen_saver_image[display_logo].data);
-
-            if (screen_saver != NULL) {
-                qp_drawimage(st7789_170x320_surface_display, 0, 0, screen_saver);
-                qp_close_image(screen_saver);
-            }
+            painter_rle565_draw(st7789_170x320_surface_display, 0, 0, screen_saver_image[display_logo].image);
             force_redraw = false;
         } else {
             return;
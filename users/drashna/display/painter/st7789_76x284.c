@@ -93,8 +93,10 @@ void init_display_st7789_76x284_rotation(void) {
 
     init_display_st7789_76x284_inversion();
 
-    painter_render_frame_box(st7789_76x284_display, painter_get_hsv(false), 1, 1, 0, 2, true, true);
-    painter_render_frame_box(st7789_76x284_display, painter_get_hsv(true), 0, 0, 0, 2, true, true);
+    painter_render_frame_box(st7789_76x284_display, PAINTER_STATE(userspace_config).display.painter.hsv.secondary, 1,
+                             1, 0, 2, true, true);
+    painter_render_frame_box(st7789_76x284_display, PAINTER_STATE(userspace_config).display.painter.hsv.primary, 0, 0,
+                             0, 2, true, true);
 
     qp_power(st7789_76x284_display, true);
     qp_flush(st7789_76x284_display);
@@ -111,7 +113,7 @@ void init_display_st7789_76x284(void) {
 
     init_display_st7789_76x284_rotation();
 
-    st7789_76x284_draw_user();
+    st7789_76x284_draw_user(PAINTER_DAMAGE_ALL);
 }
 
 void st7789_76x284_display_power(bool on) {
@@ -120,7 +122,7 @@ void st7789_76x284_display_power(bool on) {
 
 void st7789_76x284_display_shutdown(bool jump_to_bootloader) {}
 
-__attribute__((weak)) void st7789_76x284_draw_user(void) {
+__attribute__((weak)) void st7789_76x284_draw_user(uint16_t damage) {
     // static uint16_t last_activity = UINT16_MAX - 9999;
     // qp_rect(st7789_76x284_display, 0, 0, 240, 320 - 1, HSV_MAGENTA, true);
     // qp_flush(st7789_76x284_display);
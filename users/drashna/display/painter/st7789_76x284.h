@@ -7,7 +7,7 @@
 
 void init_display_st7789_76x284(void);
 void st7789_76x284_display_power(bool on);
-void st7789_76x284_draw_user(void);
+void st7789_76x284_draw_user(uint16_t damage);
 void st7789_76x284_display_shutdown(bool jump_to_bootloader);
 void init_display_st7789_76x284_rotation(void);
 void init_display_st7789_76x284_inversion(void);
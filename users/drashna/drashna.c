@@ -7,6 +7,9 @@
 #ifdef UNICODE_COMMON_ENABLE
 #    include "keyrecords/unicode.h"
 #endif // UNICODE_COMMON_ENABLE
+#ifdef CUSTOM_QUANTUM_PAINTER_ENABLE
+#    include "display/painter/painter_damage.h"
+#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
 
 userspace_config_t userspace_config;
 
@@ -54,6 +57,10 @@ typedef struct {
 } os_detection_config_t;
 
 bool process_detected_host_os_user(os_variant_t detected_os) {
+#    ifdef CUSTOM_QUANTUM_PAINTER_ENABLE
+    // the detected OS, and the keymap config, unicode mode and acceleration it sets below
+    painter_damage_mark(PAINTER_DAMAGE_HOST_OS);
+#    endif // CUSTOM_QUANTUM_PAINTER_ENABLE
     if (is_keyboard_master()) {
         os_detection_config_t os_detection_config = {
             .swap_ctl_gui = false,
@@ -0,0 +1,14 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Use a 16 entry table (32 bytes of flash) instead of the 256 entry one (512 bytes). Roughly half the speed.
+#if !defined(CRC16_NIBBLE_TABLE) && defined(__AVR__)
+#    define CRC16_NIBBLE_TABLE
+#endif // !CRC16_NIBBLE_TABLE && __AVR__
+
+uint16_t crc16_update_byte(uint16_t crc, uint8_t data);
+uint16_t crc16_update_block(uint16_t crc, const void *data, uint16_t size);
@@ -0,0 +1,199 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "drashna_eeconfig.h"
+#include "drashna_runtime.h"
+#include "config_journal.h"
+#include "eeconfig.h"
+#include "timer.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief A part of the userspace config that is written on its own (as its own record, with the config journal),
+ * so changing one setting only rewrites the group it belongs to.
+ */
+typedef struct userspace_config_group_t {
+    uint8_t key;
+    uint8_t offset;
+    uint8_t size;
+} userspace_config_group_t;
+
+#define USERSPACE_CONFIG_GROUP(group_key, member)               \
+    {                                                           \
+        .key    = group_key,                                    \
+        .offset = offsetof(userspace_config_t, member),         \
+        .size   = sizeof(((userspace_config_t *)NULL)->member), \
+    }
+
+static const userspace_config_group_t userspace_config_groups[] = {
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_RGB, rgb),
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_GAMING, gaming),
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_DISPLAY, display),
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_DEBUG, debug),
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_POINTING, pointing),
+    USERSPACE_CONFIG_GROUP(CONFIG_JOURNAL_KEY_RTC, rtc),
+    // nuke_switch and check are bitfields, so they can't be named; they share the byte after rtc
+    {
+        .key    = CONFIG_JOURNAL_KEY_FLAGS,
+        .offset = offsetof(userspace_config_t, rtc) + sizeof(((userspace_config_t *)NULL)->rtc),
+        .size   = 1,
+    },
+};
+
+#ifdef CONFIG_JOURNAL_ENABLE
+// leaves room for every group plus the dynamic macro header, so compaction can always succeed
+_Static_assert(sizeof(config_journal_header_t) + USERSPACE_CONFIG_SIZE + CONFIG_JOURNAL_MACRO_HEADER_SIZE +
+                       (CONFIG_JOURNAL_KEY_COUNT * CONFIG_JOURNAL_RECORD_OVERHEAD) <=
+                   CONFIG_JOURNAL_BANK_SIZE,
+               "Config journal banks are too small to hold the userspace config");
+#endif // CONFIG_JOURNAL_ENABLE
+
+static userspace_config_t               persisted_config = {0};
+static userspace_config_persist_stats_t stats            = {0};
+static uint32_t                         first_mark_time  = 0;
+static uint32_t                         last_mark_time   = 0;
+static bool                             is_dirty         = false;
+
+#ifdef CONFIG_JOURNAL_ENABLE
+/**
+ * @brief Moves the userspace config from the legacy block at the start of the datablock into the config journal,
+ * the first time a keyboard boots with the journal. The legacy block is left as it is, and the flags group (with
+ * the check bit) is written last, so if this is interrupted it's simply redone on the next boot.
+ */
+static void userspace_config_migrate_legacy(void) {
+    if (!eeconfig_is_user_datablock_valid()) {
+        return;
+    }
+    eeconfig_read_user_datablock(&userspace_config, 0, USERSPACE_CONFIG_SIZE);
+    if (!userspace_config.check) {
+        memset(&userspace_config, 0, sizeof(userspace_config_t));
+        return;
+    }
+    userspace_config_write_all();
+}
+#endif // CONFIG_JOURNAL_ENABLE
+
+/**
+ * @brief Reads the userspace config, and keeps a copy of what was read so that later commits only have to write
+ * the groups that have changed since.
+ *
+ * With the config journal, each group is recovered from its newest record. Groups without a record are left
+ * zeroed, which clears the check bit if the journal is empty, in which case the legacy block is migrated.
+ */
+void userspace_config_read(void) {
+    memset(&userspace_config, 0, sizeof(userspace_config_t));
+#ifdef CONFIG_JOURNAL_ENABLE
+    if (config_journal_init()) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(userspace_config_groups); i++) {
+            const userspace_config_group_t *group = &userspace_config_groups[i];
+            config_journal_read(group->key, &userspace_config.raw[group->offset], group->size);
+        }
+    }
+    if (!userspace_config.check) {
+        userspace_config_migrate_legacy();
+    }
+#else  // CONFIG_JOURNAL_ENABLE
+    eeconfig_read_user_datablock(&userspace_config, 0, USERSPACE_CONFIG_SIZE);
+#endif // CONFIG_JOURNAL_ENABLE
+    memcpy(&persisted_config, &userspace_config, sizeof(userspace_config_t));
+    is_dirty = false;
+}
+
+/**
+ * @brief Flags the userspace config as changed. Nothing is written here; the change is committed once the config
+ * has been left alone for USERSPACE_CONFIG_COMMIT_DELAY_MS, or USERSPACE_CONFIG_COMMIT_MAX_DELAY_MS after the first
+ * uncommitted change, whichever comes first. Safe to call from hot input paths such as held keys and menu scrolling.
+ */
+void userspace_config_mark_dirty(void) {
+    stats.marks++;
+    last_mark_time = timer_read32();
+    if (is_dirty) {
+        stats.writes_avoided++;
+        return;
+    }
+    is_dirty        = true;
+    first_mark_time = last_mark_time;
+}
+
+/**
+ * @brief Writes a group to the eeprom, by appending it to the config journal, or in place in the legacy block.
+ *
+ * @param group group to write
+ */
+static void userspace_config_write_group(const userspace_config_group_t *group) {
+#ifdef CONFIG_JOURNAL_ENABLE
+    if (!config_journal_write(group->key, &userspace_config.raw[group->offset], group->size)) {
+        return;
+    }
+#else  // CONFIG_JOURNAL_ENABLE
+    eeconfig_update_user_datablock(&userspace_config.raw[group->offset], group->offset, group->size);
+#endif // CONFIG_JOURNAL_ENABLE
+    stats.records++;
+    stats.bytes_written += group->size;
+}
+
+/**
+ * @brief Commits any pending change to the eeprom immediately. Only the groups that differ from the last committed
+ * copy are written.
+ *
+ * @return true if anything was written
+ */
+bool userspace_config_flush(void) {
+    if (!is_dirty) {
+        return false;
+    }
+    is_dirty = false;
+
+    uint32_t written = stats.records;
+    for (uint8_t i = 0; i < ARRAY_SIZE(userspace_config_groups); i++) {
+        const userspace_config_group_t *group = &userspace_config_groups[i];
+        if (memcmp(&userspace_config.raw[group->offset], &persisted_config.raw[group->offset], group->size) != 0) {
+            userspace_config_write_group(group);
+        }
+    }
+    if (written == stats.records) {
+        stats.writes_avoided++;
+        return false;
+    }
+
+    memcpy(&persisted_config, &userspace_config, sizeof(userspace_config_t));
+    stats.commits++;
+    return true;
+}
+
+/**
+ * @brief Writes every group of the userspace config immediately, dropping everything else in the config journal.
+ * Used when the eeprom is (re)initialised, as the datablock version has to be written even if the contents happen
+ * to match. The flags group is the last one, so the check bit is only set once everything else has been written.
+ */
+void userspace_config_write_all(void) {
+#ifdef CONFIG_JOURNAL_ENABLE
+    config_journal_format();
+#endif // CONFIG_JOURNAL_ENABLE
+    for (uint8_t i = 0; i < ARRAY_SIZE(userspace_config_groups); i++) {
+        userspace_config_write_group(&userspace_config_groups[i]);
+    }
+    memcpy(&persisted_config, &userspace_config, sizeof(userspace_config_t));
+    is_dirty = false;
+    stats.commits++;
+}
+
+/**
+ * @brief Commits the userspace config once it has settled.
+ */
+void housekeeping_task_userspace_config(void) {
+    if (is_dirty && (timer_elapsed32(last_mark_time) >= USERSPACE_CONFIG_COMMIT_DELAY_MS ||
+                     timer_elapsed32(first_mark_time) >= USERSPACE_CONFIG_COMMIT_MAX_DELAY_MS)) {
+        userspace_config_flush();
+    }
+}
+
+/**
+ * @brief Get the userspace config persistence stats
+ *
+ * @return const userspace_config_persist_stats_t*
+ */
+const userspace_config_persist_stats_t *userspace_config_get_persist_stats(void) {
+    return &stats;
+}
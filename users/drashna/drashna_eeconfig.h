@@ -0,0 +1,29 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef USERSPACE_CONFIG_COMMIT_DELAY_MS
+#    define USERSPACE_CONFIG_COMMIT_DELAY_MS 1000
+#endif // USERSPACE_CONFIG_COMMIT_DELAY_MS
+#ifndef USERSPACE_CONFIG_COMMIT_MAX_DELAY_MS
+#    define USERSPACE_CONFIG_COMMIT_MAX_DELAY_MS 5000
+#endif // USERSPACE_CONFIG_COMMIT_MAX_DELAY_MS
+
+typedef struct userspace_config_persist_stats_t {
+    uint32_t marks;          // calls to userspace_config_mark_dirty()
+    uint32_t commits;        // flushes that actually wrote to the eeprom
+    uint32_t writes_avoided; // marks coalesced into a later commit, or flushes that found nothing changed
+    uint32_t bytes_written;  // payload bytes written, not counting the config journal's record overhead
+    uint32_t records;        // group writes (config journal records), one per changed group
+} userspace_config_persist_stats_t;
+
+void                                    userspace_config_read(void);
+void                                    userspace_config_mark_dirty(void);
+bool                                    userspace_config_flush(void);
+void                                    userspace_config_write_all(void);
+void                                    housekeeping_task_userspace_config(void);
+const userspace_config_persist_stats_t *userspace_config_get_persist_stats(void);
@@ -27,7 +27,7 @@ typedef struct {
 } painter_options_t;
 
 typedef union PACKED {
-    uint8_t raw[EECONFIG_USER_DATA_SIZE];
+    uint8_t raw[USERSPACE_CONFIG_SIZE];
     struct {
         struct {
             bool layer_change : 1;
@@ -94,10 +94,12 @@ typedef union PACKED {
     };
 } userspace_config_t;
 
-_Static_assert(sizeof(userspace_config_t) <= EECONFIG_USER_DATA_SIZE, "User EECONFIG block is not large enough.");
+_Static_assert(sizeof(userspace_config_t) <= USERSPACE_CONFIG_SIZE, "User EECONFIG block is not large enough.");
 
 extern userspace_config_t userspace_config;
 
+#include "drashna_eeconfig.h"
+
 #if defined(COMMUNITY_MODULE_DISPLAY_MENU_ENABLE)
 #    include "display_menu.h"
 #else
@@ -0,0 +1,468 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for custom_dynamic_macros.c, on a matrix too large for the packed row and column nibbles.
+ *
+ * Records random macros through process_record_dynamic_macro(), the way the keyboard would: matrix keys anywhere
+ * on the matrix, encoder turns and combos, with random gaps between them. Then plays each one back through
+ * housekeeping_task_dynamic_macro(), ticking once a millisecond, and checks that process_record() gets the same
+ * events, each when it was due.
+ *
+ * Then it loads the slots from EEPROM again and plays them from there, checks that the key press that cancels
+ * playback is swallowed along with its release, that a slot with a corrupted event is rejected, and that slots saved
+ * in another format are cleared.
+ *
+ * Last, it migrates an image in the legacy format, with room for every slot as the legacy layout needed, and plays
+ * the slots back. Then it cuts the power at every byte the migration writes, boots again, and checks that every slot
+ * ends up as the uninterrupted migration left it. Only slot 0 can be lost, by a cut while it's being written, as the
+ * new slot 0 is the only one that overlaps the old copy of a slot that hasn't been fully written again.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o dynamic_macros_test -Iusers/drashna/keyrecords/bench -Iusers/drashna/bench/qmk -Iusers/drashna \
+ *         -DMATRIX_ROWS=20 -DMATRIX_COLS=18 -DCOMBO_ENABLE -DCONFIG_JOURNAL_ENABLE -DCONFIG_JOURNAL_SIZE=512 \
+ *         -DUSERSPACE_CONFIG_SIZE=64 -DEECONFIG_USER_DATA_SIZE=8800 \
+ *         users/drashna/keyrecords/bench/dynamic_macros_test.c users/drashna/keyrecords/custom_dynamic_macros.c \
+ *         users/drashna/drashna_crc.c
+ *     ./dynamic_macros_test
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eeconfig.h"
+#include "config_journal.h"
+#include "drashna_crc.h"
+#include "keyrecords/custom_dynamic_macros.h"
+
+#define TEST_ROUNDS     200
+#define TEST_MAX_EVENTS 20 // that always fit in a slot, at up to DYNAMIC_MACRO_MAX_EVENT_SIZE bytes each
+
+/*
+ * Quantum stand ins, with the time set by the test
+ */
+
+static uint16_t now;
+static uint8_t  eeprom[EECONFIG_SIZE + EECONFIG_USER_DATA_SIZE];
+layer_state_t   layer_state;
+
+uint16_t timer_read(void) {
+    return now;
+}
+uint32_t timer_read32(void) {
+    return now;
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return now - last;
+}
+void layer_clear(void) {
+    layer_state = 0;
+}
+void layer_state_set(layer_state_t state) {
+    layer_state = state;
+}
+void clear_keyboard(void) {}
+
+// bytes that can still be written before the power is cut, or -1 for no cut
+static int32_t  power_left = -1;
+static uint32_t bytes_written;
+
+static bool power_on(void) {
+    if (power_left == 0) {
+        return false;
+    }
+    if (power_left > 0) {
+        power_left--;
+    }
+    return true;
+}
+
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+    return eeprom[(uintptr_t)addr];
+}
+void eeprom_read_block(void *buf, const void *addr, uint32_t len) {
+    memcpy(buf, &eeprom[(uintptr_t)addr], len);
+}
+void eeprom_update_byte(uint8_t *addr, uint8_t value) {
+    if (power_on()) {
+        eeprom[(uintptr_t)addr] = value;
+        bytes_written++;
+    }
+}
+void eeprom_update_block(const void *buf, void *addr, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        eeprom_update_byte((uint8_t *)addr + i, ((const uint8_t *)buf)[i]);
+    }
+}
+
+// The dynamic macro header is the only thing in the journal the macros use, so it's kept on its own here. The
+// journal itself is tested by the config journal test, so it's written whole, or not at all after a power cut.
+static uint8_t journal_header[CONFIG_JOURNAL_MACRO_HEADER_SIZE];
+static bool    journal_has_header;
+
+uint8_t config_journal_read(uint8_t key, void *data, uint8_t size) {
+    if (key != CONFIG_JOURNAL_KEY_MACROS || !journal_has_header || size != sizeof(journal_header)) {
+        return 0;
+    }
+    memcpy(data, journal_header, size);
+    return size;
+}
+bool config_journal_write(uint8_t key, const void *data, uint8_t size) {
+    if (key != CONFIG_JOURNAL_KEY_MACROS || size != sizeof(journal_header) || !power_on()) {
+        return false;
+    }
+    memcpy(journal_header, data, size);
+    journal_has_header = true;
+    return true;
+}
+
+/*
+ * What process_record() got
+ */
+
+typedef struct played_event_t {
+    keyrecord_t record;
+    uint16_t    time;
+} played_event_t;
+
+static played_event_t played[TEST_MAX_EVENTS + 1];
+static uint8_t        played_count;
+
+void process_record(keyrecord_t *record) {
+    if (played_count < TEST_MAX_EVENTS + 1) {
+        played[played_count++] = (played_event_t){.record = *record, .time = now};
+    }
+}
+
+/*
+ * Recording and playing macros
+ */
+
+typedef struct test_macro_t {
+    keyrecord_t events[TEST_MAX_EVENTS];
+    uint16_t    deltas[TEST_MAX_EVENTS];
+    uint8_t     count;
+} test_macro_t;
+
+static test_macro_t macros[DYNAMIC_MACRO_COUNT];
+
+static keyrecord_t key_record(uint8_t row, uint8_t col, bool pressed) {
+    return (keyrecord_t){
+        .event = {.key = {.row = row, .col = col}, .type = KEY_EVENT, .pressed = pressed, .time = now},
+    };
+}
+
+static void press_and_release(uint16_t keycode) {
+    keyrecord_t record = key_record(0, 0, true);
+    process_record_dynamic_macro(keycode, &record);
+    record = key_record(0, 0, false);
+    process_record_dynamic_macro(keycode, &record);
+}
+
+/**
+ * @brief Random pairs of presses and releases, so nothing is trimmed from the end of the macro.
+ */
+static void random_macro(test_macro_t *macro) {
+    macro->count = 0;
+    for (uint8_t pairs = 1 + rand() % (TEST_MAX_EVENTS / 2); pairs > 0; pairs--) {
+        keyrecord_t record = {0};
+        switch (rand() % 6) {
+            case 0:
+                record.event.type = rand() % 2 ? ENCODER_CW_EVENT : ENCODER_CCW_EVENT;
+                record.event.key  = (keypos_t){.row = 0xFD - rand() % 2, .col = rand() % 4};
+                break;
+            case 1:
+                record.event.type = COMBO_EVENT;
+                record.event.key  = (keypos_t){.row = 0xFF, .col = 0xFF};
+                record.keycode    = rand();
+                break;
+            case 2:
+                // corners of the matrix, past the nibbles and on the escape byte
+                record.event.type = KEY_EVENT;
+                record.event.key  = (keypos_t){.row = 15 + rand() % 5, .col = 15 + rand() % 3};
+                break;
+            default:
+                record.event.type = KEY_EVENT;
+                record.event.key  = (keypos_t){.row = rand() % MATRIX_ROWS, .col = rand() % MATRIX_COLS};
+                break;
+        }
+        record.event.pressed            = true;
+        macro->events[macro->count]     = record;
+        record.event.pressed            = false;
+        macro->events[macro->count + 1] = record;
+        macro->count += 2;
+    }
+    for (uint8_t i = 0; i < macro->count; i++) {
+        macro->deltas[i] = rand() % 8 == 0 ? rand() % 20000 : rand() % 300;
+    }
+    macro->deltas[0] = 0;
+}
+
+static void record_macro(uint8_t slot, test_macro_t *macro) {
+    press_and_release(DYN_MACRO_PROG);
+    press_and_release(DYN_MACRO_KEY00 + slot);
+    for (uint8_t i = 0; i < macro->count; i++) {
+        now += macro->deltas[i];
+        keyrecord_t record = macro->events[i];
+        record.event.time  = now;
+        process_record_dynamic_macro(KC_A, &record);
+    }
+    now += 1 + rand() % 100;
+    press_and_release(DYN_MACRO_PROG);
+}
+
+/**
+ * @brief Plays a slot, ticking once a millisecond, and checks that each event is sent when it's due: on the tick
+ * its delta is up, or the tick after the previous one, as only one event is sent per tick.
+ */
+static bool play_macro(uint8_t slot, const test_macro_t *macro) {
+    uint16_t due = now, last = now - 1;
+
+    played_count = 0;
+    dynamic_macro_play(slot);
+    for (uint32_t ticks = 0; dynamic_macro_is_playing() && ticks < 1000000; ticks++, now++) {
+        housekeeping_task_dynamic_macro();
+    }
+    if (played_count != macro->count) {
+        printf("slot %u: played %u of %u events\n", slot, played_count, macro->count);
+        return false;
+    }
+    for (uint8_t i = 0; i < macro->count; i++) {
+        const keyrecord_t *expected = &macro->events[i], *got = &played[i].record;
+        due += macro->deltas[i];
+        uint16_t when = (uint16_t)(last + 1 - due) < 0x8000 ? last + 1 : due;
+        last          = when;
+        if (got->event.type != expected->event.type || got->event.key.row != expected->event.key.row ||
+            got->event.key.col != expected->event.key.col || got->event.pressed != expected->event.pressed ||
+            (expected->event.type == COMBO_EVENT && got->keycode != expected->keycode)) {
+            printf("slot %u, event %u: got type %u at %u,%u %s, expected type %u at %u,%u %s\n", slot, i,
+                   got->event.type, got->event.key.row, got->event.key.col, got->event.pressed ? "down" : "up",
+                   expected->event.type, expected->event.key.row, expected->event.key.col,
+                   expected->event.pressed ? "down" : "up");
+            return false;
+        }
+        if (played[i].time != when || got->event.time != when) {
+            printf("slot %u, event %u: played at %u, due at %u\n", slot, i, played[i].time, when);
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Tests
+ */
+
+static bool test_round_trip(void) {
+    for (uint16_t round = 0; round < TEST_ROUNDS; round++) {
+        uint8_t slot = rand() % DYNAMIC_MACRO_COUNT;
+        random_macro(&macros[slot]);
+        record_macro(slot, &macros[slot]);
+        if (!play_macro(slot, &macros[slot])) {
+            return false;
+        }
+        // and another slot, from EEPROM
+        slot = rand() % DYNAMIC_MACRO_COUNT;
+        if (macros[slot].count && !play_macro(slot, &macros[slot])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_reload(void) {
+    dynamic_macro_init();
+    for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+        if (macros[slot].count && !play_macro(slot, &macros[slot])) {
+            printf("slot %u didn't play after loading it from EEPROM\n", slot);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief A key press cancels playback and is swallowed, so its release has to be swallowed too, and nothing else.
+ */
+static bool test_cancel(void) {
+    keyrecord_t press = key_record(3, 4, true), release = key_record(3, 4, false), other = key_record(5, 5, false);
+
+    random_macro(&macros[1]);
+    record_macro(1, &macros[1]);
+    dynamic_macro_play(1);
+    housekeeping_task_dynamic_macro();
+    if (!dynamic_macro_is_playing()) {
+        printf("slot 1 stopped after one event\n");
+        return false;
+    }
+    if (process_record_dynamic_macro(KC_A, &press) || dynamic_macro_is_playing()) {
+        printf("a key press didn't cancel playback, or was sent\n");
+        return false;
+    }
+    if (!process_record_dynamic_macro(KC_A, &other)) {
+        printf("the release of another key was swallowed\n");
+        return false;
+    }
+    if (process_record_dynamic_macro(KC_A, &release)) {
+        printf("the release of the key that canceled playback was sent\n");
+        return false;
+    }
+    if (!process_record_dynamic_macro(KC_A, &press) || !process_record_dynamic_macro(KC_A, &release)) {
+        printf("the next tap of the key that canceled playback was swallowed\n");
+        return false;
+    }
+    return true;
+}
+
+static bool test_corrupted(void) {
+    const test_macro_t empty = {0};
+    uint8_t           *slot0 = EECONFIG_USER_DATABLOCK + USERSPACE_CONFIG_SIZE;
+
+    // the first event of slot 0, which always has at least two
+    eeprom[(uintptr_t)slot0 + rand() % 2] ^= 1 << (rand() % 8);
+    dynamic_macro_init();
+    if (!play_macro(0, &empty)) {
+        printf("a corrupted slot was played\n");
+        return false;
+    }
+    return true;
+}
+
+static bool test_header_mismatch(void) {
+    const test_macro_t empty = {0};
+
+    journal_header[2]++; // version
+    dynamic_macro_init();
+    if (!dynamic_macro_header_correct()) {
+        printf("the header wasn't rewritten\n");
+        return false;
+    }
+    for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+        if (!play_macro(slot, &empty)) {
+            printf("slot %u wasn't cleared by a header mismatch\n", slot);
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Migrating from the legacy format
+ */
+
+// the legacy slot layout, as custom_dynamic_macros.c reads it
+typedef struct {
+    keyrecord_t events[DYNAMIC_MACRO_SIZE];
+    uint8_t     length;
+    uint16_t    checksum;
+} test_legacy_macro_t;
+
+#define TEST_LEGACY_BAD_SLOT 5 // fails its checksum, so it's cleared
+
+static uint8_t legacy_image[sizeof(eeprom)];
+static uint8_t migrated_image[sizeof(eeprom)];
+
+static void write_legacy_image(void) {
+    memset(eeprom, 0, sizeof(eeprom));
+    for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+        test_legacy_macro_t legacy = {0};
+        uint16_t            time   = rand();
+
+        random_macro(&macros[slot]);
+        for (uint8_t i = 0; i < macros[slot].count; i++) {
+            time += macros[slot].deltas[i];
+            legacy.events[i]            = macros[slot].events[i];
+            legacy.events[i].event.time = time;
+        }
+        legacy.length   = macros[slot].count;
+        legacy.checksum = crc16_update_block(0, &legacy, offsetof(test_legacy_macro_t, checksum));
+        if (slot == TEST_LEGACY_BAD_SLOT) {
+            legacy.checksum ^= 0x0100;
+            macros[slot].count = 0;
+        }
+        memcpy(&eeprom[(uintptr_t)(EECONFIG_USER_DATABLOCK + 8) + sizeof(legacy) * slot], &legacy, sizeof(legacy));
+    }
+    journal_has_header = false;
+}
+
+/**
+ * @brief Checks that a slot in EEPROM is as the uninterrupted migration left it, or empty.
+ */
+static bool slot_is_migrated(uint8_t slot, bool or_empty) {
+    uintptr_t       slot0 = (uintptr_t)(EECONFIG_USER_DATABLOCK + USERSPACE_CONFIG_SIZE);
+    uintptr_t       addr  = slot0 + sizeof(dynamic_macro_t) * slot;
+    dynamic_macro_t got, expected;
+
+    memcpy(&got, &eeprom[addr], sizeof(got));
+    memcpy(&expected, &migrated_image[addr], sizeof(expected));
+    if (or_empty && got.length == 0 && got.count == 0 && got.checksum == dynamic_macro_calc_crc(&got)) {
+        return true;
+    }
+    return got.length == expected.length && got.count == expected.count && got.checksum == expected.checksum &&
+           memcmp(got.data, expected.data, got.length) == 0;
+}
+
+static bool test_legacy_migration(void) {
+    write_legacy_image();
+    memcpy(legacy_image, eeprom, sizeof(eeprom));
+    bytes_written = 0;
+    dynamic_macro_init();
+    if (!dynamic_macro_header_correct()) {
+        printf("the header wasn't written after migrating\n");
+        return false;
+    }
+    for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+        if (!play_macro(slot, &macros[slot])) {
+            printf("slot %u didn't play as it was saved in the legacy format\n", slot);
+            return false;
+        }
+    }
+    memcpy(migrated_image, eeprom, sizeof(eeprom));
+
+    uint32_t total = bytes_written, lost = 0;
+    for (uint32_t cut = 0; cut <= total; cut++) {
+        memcpy(eeprom, legacy_image, sizeof(eeprom));
+        journal_has_header = false;
+        power_left         = cut;
+        dynamic_macro_init();
+        power_left = -1;
+        dynamic_macro_init();
+        if (!dynamic_macro_header_correct()) {
+            printf("power cut after %u of %u bytes: the header wasn't written on the next boot\n", cut, total);
+            return false;
+        }
+        for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+            if (!slot_is_migrated(slot, slot == 0)) {
+                printf("power cut after %u of %u bytes: slot %u was lost\n", cut, total, slot);
+                return false;
+            }
+        }
+        if (!slot_is_migrated(0, false)) {
+            lost++;
+        }
+    }
+    printf("legacy migration: %u bytes written, slot 0 lost by %u of the power cuts\n", total, lost);
+    return true;
+}
+
+int main(void) {
+    srand(1);
+    dynamic_macro_init();
+    if (!dynamic_macro_header_correct()) {
+        printf("blank EEPROM wasn't formatted\nFAILED\n");
+        return 1;
+    }
+    random_macro(&macros[0]);
+    record_macro(0, &macros[0]);
+
+    if (!test_round_trip() || !test_reload() || !test_cancel() || !test_corrupted() || !test_header_mismatch() ||
+        !test_legacy_migration()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%u macros recorded and played, on a %ux%u matrix\n", TEST_ROUNDS, MATRIX_ROWS, MATRIX_COLS);
+    printf("every event was played back as recorded, bad slots were rejected, and legacy slots were migrated\n");
+    return 0;
+}
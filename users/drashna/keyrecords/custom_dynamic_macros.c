@@ -9,24 +9,97 @@
 #include "debug.h"
 #include "eeprom.h"
 #include "eeconfig.h"
+#include "config_journal.h"
+#include "drashna_crc.h"
+#include "timer.h"
+#include <stddef.h>
 #include <string.h>
 
-static uint8_t macro_id        = 255;
-static uint8_t recording_state = STATE_NOT_RECORDING;
-
-#if EECONFIG_USER_DATA_SIZE < 8
-#    error "EECONFIG_USER_DATA_SIZE not set. Don't step on others eeprom."
-#endif // EECONFIG_USER_DATA_SIZE < 8
+static uint8_t  macro_id         = 255;
+static uint8_t  recording_state  = STATE_NOT_RECORDING;
+static uint16_t last_record_time = 0;
+static uint16_t recording_crc    = 0; // CRC of the events recorded so far, kept up to date as they're appended
+
+typedef struct dynamic_macro_playback_t {
+    layer_state_t saved_layer_state;
+    keyrecord_t   next_event;
+    keyevent_t    cancel_event; // press that canceled playback, so its release can be swallowed too
+    uint16_t      offset;
+    uint16_t      next_event_time;
+    uint8_t       macro_id;
+    uint8_t       played;
+    uint8_t       speed;
+    bool          is_playing;
+    bool          in_process_record;
+    bool          cancel_release_pending;
+} dynamic_macro_playback_t;
+
+static dynamic_macro_playback_t playback = {
+    .speed = DYNAMIC_MACRO_PLAYBACK_SPEED,
+};
+
+#ifndef CONFIG_JOURNAL_ENABLE
+#    error "Custom dynamic macros keep their header in the config journal, which needs CONFIG_JOURNAL_ENABLE"
+#endif // CONFIG_JOURNAL_ENABLE
+// after the legacy config block, and before the config journal
 #ifndef DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR
-#    define DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR (uint8_t*)(EECONFIG_USER_DATABLOCK + 8)
+#    define DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR (uint8_t*)(EECONFIG_USER_DATABLOCK + USERSPACE_CONFIG_SIZE)
 #endif // DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR
+#define DYNAMIC_MACRO_LEGACY_BLOCK0_ADDR (uint8_t*)(EECONFIG_USER_DATABLOCK + 8)
+
+#define DYNAMIC_MACRO_EVENT_ESCAPE   0xFF
+#define DYNAMIC_MACRO_MAX_EVENT_SIZE 9
+
+#define DYNAMIC_MACRO_NO_SLOT        0xFF
+#define DYNAMIC_MACRO_CRC_CHUNK_SIZE 16
+
+/**
+ * @brief What is kept in RAM for every slot. The events themselves stay in EEPROM until the slot is played.
+ */
+typedef struct dynamic_macro_index_t {
+    uint16_t length;
+    uint16_t checksum;
+    uint8_t  count;
+    bool     verified; // checksum has been checked against the events in EEPROM
+} dynamic_macro_index_t;
 
-dynamic_macro_t dynamic_macros[DYNAMIC_MACRO_COUNT];
-_Static_assert((sizeof(dynamic_macros)) <= (EECONFIG_USER_DATA_SIZE - 8),
+/**
+ * @brief The one slot held in RAM. It's the buffer a macro is recorded into, and otherwise the last slot played,
+ * filled in as playback streams it from EEPROM, so a macro that is played repeatedly is only read once.
+ */
+typedef struct dynamic_macro_cache_t {
+    dynamic_macro_t macro;
+    uint16_t        filled; // bytes of macro.data that are valid
+    uint8_t         macro_id;
+} dynamic_macro_cache_t;
+
+static dynamic_macro_index_t macro_index[DYNAMIC_MACRO_COUNT];
+static dynamic_macro_cache_t macro_cache = {
+    .macro_id = DYNAMIC_MACRO_NO_SLOT,
+};
+
+_Static_assert(DYNAMIC_MACRO_COUNT < DYNAMIC_MACRO_NO_SLOT, "Too many dynamic macro slots");
+_Static_assert(DYNAMIC_MACRO_COUNT * sizeof(dynamic_macro_t) <= (CONFIG_JOURNAL_OFFSET - USERSPACE_CONFIG_SIZE),
                "User Data Size must be large enough to host all macros");
+_Static_assert(sizeof(dynamic_macro_header_t) == CONFIG_JOURNAL_MACRO_HEADER_SIZE,
+               "Config journal must reserve room for the dynamic macro header");
+_Static_assert(DYNAMIC_MACRO_BUFFER_SIZE >= DYNAMIC_MACRO_MAX_EVENT_SIZE, "Dynamic macro buffer too small");
+
+/**
+ * @brief The format used before the versioned header was added, only used to migrate old EEPROM images.
+ */
+typedef struct {
+    keyrecord_t events[DYNAMIC_MACRO_SIZE];
+    uint8_t     length;
+    uint16_t    checksum;
+} dynamic_macro_legacy_t;
 
 __attribute__((weak)) void dynamic_macro_record_start_user(void) {}
 
+__attribute__((weak)) void dynamic_macro_init_user(uint32_t elapsed) {
+    dprintf("dynamic macro: slots loaded in %lu ms\n", (unsigned long)elapsed);
+}
+
 __attribute__((weak)) void dynamic_macro_play_user(uint8_t macro_id) {}
 
 __attribute__((weak)) void dynamic_macro_record_key_user(uint8_t macro_id, keyrecord_t* record) {}
@@ -51,6 +124,203 @@ uint8_t dynamic_macro_get_recording_state(void) {
     return recording_state;
 }
 
+/**
+ * @brief Checks if a key event fits in the one byte position. Keys with a row or column past 15 (on larger matrices)
+ * are stored as escaped events instead, as is row 15, column 15, which would read as DYNAMIC_MACRO_EVENT_ESCAPE.
+ *
+ * @param record event to check
+ * @return true if it can be packed
+ */
+static inline bool dynamic_macro_is_packed_key(const keyrecord_t* record) {
+    keypos_t key = record->event.key;
+
+    return record->event.type == KEY_EVENT && key.row < MATRIX_ROWS && key.col < MATRIX_COLS && key.row < 16 &&
+           key.col < 16 && ((key.row << 4) | key.col) != DYNAMIC_MACRO_EVENT_ESCAPE;
+}
+
+static inline void* dynamic_macro_eeprom_macro_addr(uint8_t macro_id) {
+    return DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR + sizeof(dynamic_macro_t) * macro_id;
+}
+
+/**
+ * @brief Reads a byte of a slot's events, from the cache if it holds them, or from EEPROM otherwise. Bytes read
+ * from EEPROM for the cached slot are added to the cache as they're read.
+ *
+ * @param macro_id slot to read from
+ * @param offset offset to read from, advanced past the byte
+ * @param byte set to the byte read
+ * @return false if the offset is past the end of the macro
+ */
+static bool dynamic_macro_read_byte(uint8_t macro_id, uint16_t* offset, uint8_t* byte) {
+    bool cached = macro_cache.macro_id == macro_id;
+
+    if (*offset >= (cached ? macro_cache.macro.length : macro_index[macro_id].length)) {
+        return false;
+    }
+    if (cached && *offset < macro_cache.filled) {
+        *byte = macro_cache.macro.data[(*offset)++];
+        return true;
+    }
+    *byte = eeprom_read_byte((uint8_t*)dynamic_macro_eeprom_macro_addr(macro_id) + *offset);
+    if (cached && *offset == macro_cache.filled) {
+        macro_cache.macro.data[macro_cache.filled++] = *byte;
+    }
+    (*offset)++;
+    return true;
+}
+
+/**
+ * @brief Writes an unsigned LEB128 varint.
+ *
+ * @param buffer output buffer, at least 3 bytes
+ * @param value value to write
+ * @return uint8_t bytes written
+ */
+static uint8_t dynamic_macro_write_varint(uint8_t* buffer, uint32_t value) {
+    uint8_t size = 0;
+    do {
+        buffer[size] = value & 0x7F;
+        value >>= 7;
+        if (value) {
+            buffer[size] |= 0x80;
+        }
+        size++;
+    } while (value);
+    return size;
+}
+
+/**
+ * @brief Reads an unsigned LEB128 varint.
+ *
+ * @param macro_id slot to read from
+ * @param offset offset to read from, advanced past the varint
+ * @param value set to the value read
+ * @return false if the varint runs past the end of the macro
+ */
+static bool dynamic_macro_read_varint(uint8_t macro_id, uint16_t* offset, uint32_t* value) {
+    uint8_t byte;
+
+    *value = 0;
+    for (uint8_t shift = 0; shift < 21; shift += 7) {
+        if (!dynamic_macro_read_byte(macro_id, offset, &byte)) {
+            return false;
+        }
+        *value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Completes a macro checksum, by adding the length and event count to the CRC of its events.
+ *
+ * @param crc CRC of the first `length` bytes of the macro's data
+ * @param length bytes used by the macro
+ * @param count number of events in the macro
+ * @return uint16_t checksum
+ */
+static uint16_t dynamic_macro_finish_crc(uint16_t crc, uint16_t length, uint8_t count) {
+    crc = crc16_update_block(crc, &length, sizeof(length));
+    return crc16_update_byte(crc, count);
+}
+
+/**
+ * @brief Checksums a macro. Only the bytes in use are covered, so the cost follows the size of the macro rather
+ * than the size of the slot.
+ *
+ * @param macro macro to checksum, with a length that has already been checked against the buffer size
+ * @return uint16_t checksum
+ */
+uint16_t dynamic_macro_calc_crc(const dynamic_macro_t* macro) {
+    return dynamic_macro_finish_crc(crc16_update_block(0, macro->data, macro->length), macro->length, macro->count);
+}
+
+/**
+ * @brief Appends an event to a macro.
+ *
+ * @param macro macro to append to
+ * @param record event to append
+ * @param delta time since the previous event
+ * @return false if there is no room left in the macro
+ */
+static bool dynamic_macro_encode_event(dynamic_macro_t* macro, const keyrecord_t* record, uint16_t delta) {
+    uint8_t  event[DYNAMIC_MACRO_MAX_EVENT_SIZE];
+    uint8_t  size = 0;
+    keypos_t key  = record->event.key;
+
+    if (dynamic_macro_is_packed_key(record)) {
+        event[size++] = (key.row << 4) | key.col;
+    } else {
+        event[size++] = DYNAMIC_MACRO_EVENT_ESCAPE;
+        event[size++] = record->event.type;
+        event[size++] = key.row;
+        event[size++] = key.col;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        if (record->event.type == COMBO_EVENT) {
+            event[size++] = record->keycode & 0xFF;
+            event[size++] = record->keycode >> 8;
+        }
+#endif // COMBO_ENABLE || REPEAT_KEY_ENABLE
+    }
+    size += dynamic_macro_write_varint(&event[size], ((uint32_t)delta << 1) | record->event.pressed);
+
+    if (macro->length + size > DYNAMIC_MACRO_BUFFER_SIZE || macro->count == UINT8_MAX) {
+        return false;
+    }
+    memcpy(&macro->data[macro->length], event, size);
+    macro->length += size;
+    macro->count++;
+    return true;
+}
+
+/**
+ * @brief Reads the next event from a macro.
+ *
+ * @param macro_id slot to read from
+ * @param offset offset of the event, advanced to the next one
+ * @param record set to the event, with the time left relative to the previous event
+ * @return false if the event is malformed, or there are no more events
+ */
+static bool dynamic_macro_decode_event(uint8_t macro_id, uint16_t* offset, keyrecord_t* record) {
+    uint32_t time_and_state;
+    uint8_t  position, type, row, col;
+
+    if (!dynamic_macro_read_byte(macro_id, offset, &position)) {
+        return false;
+    }
+    memset(record, 0, sizeof(keyrecord_t));
+    if (position == DYNAMIC_MACRO_EVENT_ESCAPE) {
+        if (!dynamic_macro_read_byte(macro_id, offset, &type) || !dynamic_macro_read_byte(macro_id, offset, &row) ||
+            !dynamic_macro_read_byte(macro_id, offset, &col)) {
+            return false;
+        }
+        record->event.type    = type;
+        record->event.key.row = row;
+        record->event.key.col = col;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        if (record->event.type == COMBO_EVENT) {
+            uint8_t low, high;
+            if (!dynamic_macro_read_byte(macro_id, offset, &low) || !dynamic_macro_read_byte(macro_id, offset, &high)) {
+                return false;
+            }
+            record->keycode = low | (high << 8);
+        }
+#endif // COMBO_ENABLE || REPEAT_KEY_ENABLE
+    } else {
+        record->event.type    = KEY_EVENT;
+        record->event.key.row = position >> 4;
+        record->event.key.col = position & 0x0F;
+    }
+    if (!dynamic_macro_read_varint(macro_id, offset, &time_and_state)) {
+        return false;
+    }
+    record->event.pressed = time_and_state & 1;
+    record->event.time    = MIN(time_and_state >> 1, UINT16_MAX);
+    return true;
+}
+
 /**
  * Start recording of the dynamic macro.
  *
@@ -64,39 +334,189 @@ bool dynamic_macro_record_start(uint8_t macro_id) {
 
     dynamic_macro_record_start_user();
 
+    dynamic_macro_playback_cancel();
     clear_keyboard();
     layer_clear();
 
-    dynamic_macros[macro_id].length = 0;
+    // the slot is recorded into the cache, and is empty until it's saved
+    memset(&macro_index[macro_id], 0, sizeof(dynamic_macro_index_t));
+    macro_cache.macro_id     = macro_id;
+    macro_cache.macro.length = 0;
+    macro_cache.macro.count  = 0;
+    macro_cache.filled       = 0;
+    recording_crc            = 0;
+    return true;
+}
+
+/**
+ * @brief Decodes the next event to play, and works out when it's due.
+ *
+ * @return false if there are no more events
+ */
+static bool dynamic_macro_playback_queue_next(void) {
+    if (!dynamic_macro_decode_event(playback.macro_id, &playback.offset, &playback.next_event)) {
+        return false;
+    }
+    uint16_t delta = playback.next_event.event.time;
+    if (playback.speed == 0) {
+        delta = 0;
+    } else if (playback.speed != 100) {
+        delta = MIN((uint32_t)delta * 100 / playback.speed, UINT16_MAX);
+    }
+    playback.next_event_time += delta;
     return true;
 }
 
+/**
+ * @brief Stops playback, releasing anything the macro left held and restoring the layer state.
+ */
+static void dynamic_macro_playback_finish(void) {
+    uint8_t macro_id    = playback.macro_id;
+    playback.is_playing = false;
+
+    clear_keyboard();
+    layer_state_set(playback.saved_layer_state);
+
+    dynamic_macro_play_user(macro_id);
+}
+
+/**
+ * @brief Checks a slot's events against its checksum, the first time it's played. The events are streamed from
+ * EEPROM in small chunks, so this needs no more RAM than the slot's index entry. A slot that fails is emptied.
+ *
+ * @param macro_id slot to check
+ * @return true if the slot can be played
+ */
+static bool dynamic_macro_verify(uint8_t macro_id) {
+    dynamic_macro_index_t* index = &macro_index[macro_id];
+    uint8_t                chunk[DYNAMIC_MACRO_CRC_CHUNK_SIZE];
+    uint16_t               crc = 0;
+
+    if (index->verified) {
+        return index->length != 0;
+    }
+    for (uint16_t offset = 0; offset < index->length; offset += sizeof(chunk)) {
+        uint16_t size = MIN(index->length - offset, sizeof(chunk));
+        eeprom_read_block(chunk, (uint8_t*)dynamic_macro_eeprom_macro_addr(macro_id) + offset, size);
+        crc = crc16_update_block(crc, chunk, size);
+    }
+    index->verified = true;
+    if (dynamic_macro_finish_crc(crc, index->length, index->count) != index->checksum) {
+        dprintf("dynamic macro: slot %d not played, checksum mismatch\n", macro_id);
+        index->length = 0;
+        index->count  = 0;
+    }
+    return index->length != 0;
+}
+
 /**
  * Play the dynamic macro.
  *
+ * This only starts playback. The events are sent by housekeeping_task_dynamic_macro(), one per tick, at the
+ * cadence they were recorded at, so a long macro doesn't hold up the matrix scan, USB or the split link.
+ *
  * @param macro_id[in]     The id of macro to be played
  */
 void dynamic_macro_play(uint8_t macro_id) {
     if (macro_id >= (uint8_t)(DYNAMIC_MACRO_COUNT)) {
         return;
     }
+    if (playback.is_playing) {
+        dynamic_macro_playback_cancel();
+    }
 
-    dprintf("dynamic macro: slot %d playback, length %d\n", macro_id, dynamic_macros[macro_id].length);
+    if (!dynamic_macro_verify(macro_id)) {
+        return;
+    }
+    dprintf("dynamic macro: slot %d playback, length %d\n", macro_id, macro_index[macro_id].count);
+
+    // the cache is the recording buffer while recording, otherwise it follows the slot being played
+    if (macro_cache.macro_id != macro_id && recording_state == STATE_NOT_RECORDING) {
+        macro_cache.macro_id     = macro_id;
+        macro_cache.macro.length = macro_index[macro_id].length;
+        macro_cache.macro.count  = macro_index[macro_id].count;
+        macro_cache.filled       = 0;
+    }
 
-    layer_state_t saved_layer_state = layer_state;
+    playback.saved_layer_state = layer_state;
+    playback.macro_id          = macro_id;
+    playback.offset            = 0;
+    playback.played            = 0;
+    playback.next_event_time   = timer_read();
 
     clear_keyboard();
     layer_clear();
 
-    for (uint8_t i = 0; i < dynamic_macros[macro_id].length; ++i) {
-        process_record(&dynamic_macros[macro_id].events[i]);
+    if (!dynamic_macro_playback_queue_next()) {
+        layer_state_set(playback.saved_layer_state);
+        dynamic_macro_play_user(macro_id);
+        return;
     }
+    playback.is_playing = true;
+}
 
-    clear_keyboard();
+/**
+ * @brief Stops the macro that is playing, if any.
+ */
+void dynamic_macro_playback_cancel(void) {
+    if (!playback.is_playing) {
+        return;
+    }
+    dprintf("dynamic macro: slot %d playback canceled at event %d\n", playback.macro_id, playback.played);
+    dynamic_macro_playback_finish();
+}
 
-    layer_state_set(saved_layer_state);
+/**
+ * @brief Sets the playback speed.
+ *
+ * @param speed percentage of the recorded speed, 0 to play as fast as possible (one event per tick)
+ */
+void dynamic_macro_set_playback_speed(uint8_t speed) {
+    playback.speed = speed;
+}
 
-    dynamic_macro_play_user(macro_id);
+/**
+ * @brief Checks if a macro is currently playing.
+ *
+ * @return true if playing
+ */
+bool dynamic_macro_is_playing(void) {
+    return playback.is_playing;
+}
+
+/**
+ * @brief Gets how far through the current macro playback is, for the displays.
+ *
+ * @return uint8_t percentage of events played, or 0 if nothing is playing
+ */
+uint8_t dynamic_macro_get_playback_progress(void) {
+    if (!playback.is_playing || macro_index[playback.macro_id].count == 0) {
+        return 0;
+    }
+    return (uint16_t)playback.played * 100 / macro_index[playback.macro_id].count;
+}
+
+/**
+ * @brief Sends the next macro event once it's due. Only one event is sent per tick, so the rest of the keyboard
+ * keeps running between events, even when playing as fast as possible.
+ */
+void housekeeping_task_dynamic_macro(void) {
+    if (!playback.is_playing || !timer_expired(timer_read(), playback.next_event_time)) {
+        return;
+    }
+
+    keyrecord_t record = playback.next_event;
+    record.event.time  = timer_read();
+
+    playback.in_process_record = true;
+    process_record(&record);
+    playback.in_process_record = false;
+    playback.played++;
+
+    if (!dynamic_macro_playback_queue_next()) {
+        dprintf("dynamic macro: slot %d playback done\n", playback.macro_id);
+        dynamic_macro_playback_finish();
+    }
 }
 
 /**
@@ -106,23 +526,30 @@ void dynamic_macro_play(uint8_t macro_id) {
  * @param record[in]     The current keypress.
  */
 void dynamic_macro_record_key(uint8_t macro_id, keyrecord_t* record) {
-    dynamic_macro_t* macro  = &dynamic_macros[macro_id];
-    uint8_t          length = macro->length;
+    dynamic_macro_t* macro = &macro_cache.macro;
+
+    if (macro_cache.macro_id != macro_id) {
+        return;
+    }
 
     /* If we've just started recording, ignore all the key releases. */
-    if (!record->event.pressed && length == 0) {
+    if (!record->event.pressed && macro->count == 0) {
         dprintln("dynamic macro: ignoring a leading key-up event");
         return;
     }
 
-    if (length < DYNAMIC_MACRO_SIZE) {
-        macro->events[length] = *record;
-        macro->length         = ++length;
+    uint16_t delta  = macro->count == 0 ? 0 : TIMER_DIFF_16(record->event.time, last_record_time);
+    uint16_t offset = macro->length;
+    if (dynamic_macro_encode_event(macro, record, delta)) {
+        last_record_time   = record->event.time;
+        recording_crc      = crc16_update_block(recording_crc, &macro->data[offset], macro->length - offset);
+        macro_cache.filled = macro->length;
     } else {
         dynamic_macro_record_key_user(macro_id, record);
     }
 
-    dprintf("dynamic macro: slot %d length: %d/%d\n", macro_id, length, DYNAMIC_MACRO_SIZE);
+    dprintf("dynamic macro: slot %d length: %d events, %d/%d bytes\n", macro_id, macro->count, macro->length,
+            DYNAMIC_MACRO_BUFFER_SIZE);
 }
 
 /**
@@ -130,31 +557,58 @@ void dynamic_macro_record_key(uint8_t macro_id, keyrecord_t* record) {
  * pointer to the end of the macro.
  */
 void dynamic_macro_record_end(uint8_t macro_id) {
-    if (macro_id >= (uint8_t)(DYNAMIC_MACRO_COUNT)) {
+    if (macro_id >= (uint8_t)(DYNAMIC_MACRO_COUNT) || macro_cache.macro_id != macro_id) {
         return;
     }
     dynamic_macro_record_end_user(macro_id);
 
-    dynamic_macro_t* macro  = &dynamic_macros[macro_id];
-    uint8_t          length = macro->length;
-
-    keyrecord_t* events_begin   = &(macro->events[0]);
-    keyrecord_t* events_pointer = &(macro->events[length - 1]);
-
-    dprintf("dynamic_macro: macro length before trimming: %d\n", macro->length);
-    while (events_pointer != events_begin && (events_pointer)->event.pressed) {
-        dprintln("dynamic macro: trimming a trailing key-down event");
-        --(macro->length);
-        --events_pointer;
+    dynamic_macro_t* macro = &macro_cache.macro;
+    keyrecord_t      record;
+    uint16_t         offset = 0, keep_length = 0;
+    uint8_t          index = 0, keep_count = 0;
+
+    dprintf("dynamic_macro: macro length before trimming: %d\n", macro->count);
+    // trim the trailing key-down events, by cutting the macro off after the last key-up (but always keep the first)
+    while (dynamic_macro_decode_event(macro_id, &offset, &record)) {
+        index++;
+        if (!record.event.pressed || index == 1) {
+            keep_length = offset;
+            keep_count  = index;
+        }
     }
-
-    macro->checksum = dynamic_macro_calc_crc(macro);
+    if (keep_count != macro->count) {
+        dprintf("dynamic macro: trimmed %d trailing key-down events\n", macro->count - keep_count);
+        // the running CRC covers the trimmed events too, so only the kept ones are checksummed again
+        recording_crc = crc16_update_block(0, macro->data, keep_length);
+    }
+    macro->length      = keep_length;
+    macro->count       = keep_count;
+    macro->checksum    = dynamic_macro_finish_crc(recording_crc, macro->length, macro->count);
+    macro_cache.filled = macro->length;
     dynamic_macro_save_eeprom(macro_id);
 
-    dprintf("dynamic macro: slot %d saved, length: %d\n", macro_id, length);
+    dprintf("dynamic macro: slot %d saved, length: %d\n", macro_id, macro->count);
 }
 
 bool process_record_dynamic_macro(uint16_t keycode, keyrecord_t* record) {
+    if (playback.in_process_record) {
+        /* Event sent by the macro being played back. */
+        return true;
+    }
+    if (playback.is_playing && record->event.pressed) {
+        /* Any key press cancels playback, and is swallowed, along with its release. */
+        dynamic_macro_playback_cancel();
+        playback.cancel_event           = record->event;
+        playback.cancel_release_pending = true;
+        return false;
+    }
+    if (playback.cancel_release_pending && !record->event.pressed && record->event.type == playback.cancel_event.type &&
+        KEYEQ(record->event.key, playback.cancel_event.key)) {
+        /* Release of the key that canceled playback, which would otherwise reach the host without its press. */
+        playback.cancel_release_pending = false;
+        return false;
+    }
+
     if (STATE_NOT_RECORDING == recording_state) {
         /* Program key pressed to request programming mode */
         if (keycode == DYN_MACRO_PROG && record->event.pressed) {
@@ -223,62 +677,214 @@ bool process_record_dynamic_macro(uint16_t keycode, keyrecord_t* record) {
     return true;
 }
 
-static inline uint16_t crc16_update(uint16_t crc, uint8_t a) {
-    crc ^= a;
-    for (uint8_t i = 0; i < 8; ++i) {
-        if (crc & 1)
-            crc = (crc >> 1) ^ 0xA001;
-        else
-            crc = (crc >> 1);
-    }
-    return crc;
+/**
+ * @brief Writes the length, count and checksum that follow a slot's events in EEPROM.
+ */
+static void dynamic_macro_write_trailer(uint8_t macro_id, uint16_t length, uint8_t count, uint16_t checksum) {
+    uint8_t* addr = (uint8_t*)dynamic_macro_eeprom_macro_addr(macro_id);
+
+    eeprom_update_block(&length, addr + offsetof(dynamic_macro_t, length), sizeof(length));
+    eeprom_update_byte(addr + offsetof(dynamic_macro_t, count), count);
+    eeprom_update_block(&checksum, addr + offsetof(dynamic_macro_t, checksum), sizeof(checksum));
 }
 
-uint16_t dynamic_macro_calc_crc(dynamic_macro_t* macro) {
-    uint16_t crc  = 0;
-    uint8_t* data = (uint8_t*)macro;
+/**
+ * @brief Checks that the EEPROM holds macros in the current format, for the current slot count and size. The
+ * header is kept in the config journal, so it is only ever replaced whole.
+ *
+ * @return true if the header matches
+ */
+bool dynamic_macro_header_correct(void) {
+    dynamic_macro_header_t header;
 
-    for (uint16_t i = 0; i < DYNAMIC_MACRO_CRC_LENGTH; ++i) {
-        crc = crc16_update(crc, *(data++));
+    if (config_journal_read(CONFIG_JOURNAL_KEY_MACROS, &header, sizeof(dynamic_macro_header_t)) !=
+        sizeof(dynamic_macro_header_t)) {
+        return false;
     }
-    return crc;
+    return header.magic == DYNAMIC_MACRO_MAGIC && header.version == DYNAMIC_MACRO_VERSION &&
+           header.count == DYNAMIC_MACRO_COUNT && header.buffer_size == DYNAMIC_MACRO_BUFFER_SIZE;
 }
 
-inline void* dynamic_macro_eeprom_macro_addr(uint8_t macro_id) {
-    return DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR + sizeof(dynamic_macro_t) * macro_id;
+/**
+ * @brief Records the current format in the config journal.
+ */
+static void dynamic_macro_write_header(void) {
+    dynamic_macro_header_t header = {
+        .magic       = DYNAMIC_MACRO_MAGIC,
+        .version     = DYNAMIC_MACRO_VERSION,
+        .count       = DYNAMIC_MACRO_COUNT,
+        .buffer_size = DYNAMIC_MACRO_BUFFER_SIZE,
+    };
+
+    config_journal_write(CONFIG_JOURNAL_KEY_MACROS, &header, sizeof(dynamic_macro_header_t));
 }
 
-void dynamic_macro_load_eeprom_all(void) {
+/**
+ * @brief Empties a slot.
+ *
+ * @param macro_id slot to clear
+ */
+static void dynamic_macro_clear_slot(uint8_t macro_id) {
+    dynamic_macro_write_trailer(macro_id, 0, 0, dynamic_macro_finish_crc(0, 0, 0));
+    macro_index[macro_id] = (dynamic_macro_index_t){
+        .verified = true,
+    };
+}
+
+/**
+ * @brief Clears every slot, and records the current format in the config journal. The slots are written before
+ * the header, so an interrupted reset is simply redone on the next boot.
+ */
+static void dynamic_macro_reset_eeprom(void) {
+    dprintln("dynamic macro: eeprom header mismatch, clearing slots");
     for (uint8_t i = 0; i < DYNAMIC_MACRO_COUNT; ++i) {
-        dynamic_macro_load_eeprom(i);
+        dynamic_macro_clear_slot(i);
     }
+    dynamic_macro_write_header();
 }
 
-void dynamic_macro_load_eeprom(uint8_t macro_id) {
-    dynamic_macro_t* dst = &dynamic_macros[macro_id];
+/**
+ * @brief Converts a slot saved in the headerless, full keyrecord_t format into the packed format, through the
+ * cache, and saves it. The old slot is streamed from EEPROM a record at a time, as it's several times the size of
+ * the new one.
+ *
+ * Old slots started 8 bytes into the datablock, and the new ones start after the legacy config block. As long as
+ * a new slot is smaller than an old one by at least that difference, writing a new slot only ever overwrites old
+ * slots that have already been migrated, so only one slot has to be held in RAM.
+ *
+ * @param macro_id slot to migrate
+ * @return true if the old slot passed its checksum, and was migrated
+ */
+static bool dynamic_macro_migrate_legacy(uint8_t macro_id) {
+    const uint8_t*   base  = DYNAMIC_MACRO_LEGACY_BLOCK0_ADDR + sizeof(dynamic_macro_legacy_t) * macro_id;
+    dynamic_macro_t* macro = &macro_cache.macro;
+    uint8_t          chunk[DYNAMIC_MACRO_CRC_CHUNK_SIZE], length;
+    uint16_t         crc = 0, checksum, last_time = 0;
+    keyrecord_t      record;
+
+    if (sizeof(dynamic_macro_t) + (DYNAMIC_MACRO_EEPROM_BLOCK0_ADDR - DYNAMIC_MACRO_LEGACY_BLOCK0_ADDR) >
+            sizeof(dynamic_macro_legacy_t) ||
+        base + sizeof(dynamic_macro_legacy_t) > (uint8_t*)EECONFIG_USER_DATABLOCK + CONFIG_JOURNAL_OFFSET) {
+        return false;
+    }
+    for (uint16_t i = 0; i < sizeof(dynamic_macro_legacy_t) - sizeof(uint16_t); i += sizeof(chunk)) {
+        uint8_t size = MIN(sizeof(chunk), sizeof(dynamic_macro_legacy_t) - sizeof(uint16_t) - i);
+        eeprom_read_block(chunk, base + i, size);
+        crc = crc16_update_block(crc, chunk, size);
+    }
+    length = eeprom_read_byte(base + offsetof(dynamic_macro_legacy_t, length));
+    eeprom_read_block(&checksum, base + offsetof(dynamic_macro_legacy_t, checksum), sizeof(uint16_t));
+    if (crc != checksum || length > DYNAMIC_MACRO_SIZE) {
+        return false;
+    }
 
-    eeprom_read_block(dst, dynamic_macro_eeprom_macro_addr(macro_id), sizeof(dynamic_macro_t));
+    macro_cache.macro_id = macro_id;
+    macro->length        = 0;
+    macro->count         = 0;
+    for (uint8_t i = 0; i < length; i++) {
+        eeprom_read_block(&record, base + offsetof(dynamic_macro_legacy_t, events) + sizeof(keyrecord_t) * i,
+                          sizeof(keyrecord_t));
+        uint16_t delta = i == 0 ? 0 : TIMER_DIFF_16(record.event.time, last_time);
+        if (!dynamic_macro_encode_event(macro, &record, delta)) {
+            dprintf("dynamic macro: slot %d truncated to %d events during migration\n", macro_id, i);
+            break;
+        }
+        last_time = record.event.time;
+    }
+    macro->checksum    = dynamic_macro_calc_crc(macro);
+    macro_cache.filled = macro->length;
+    dynamic_macro_save_eeprom(macro_id);
+    dprintf("dynamic macro: slot %d migrated, %d events\n", macro_id, macro->count);
+    return true;
+}
 
-    /* Validate checksum, ifchecksum is NOT valid for macro, set its length to 0 to prevent its use. */
-    if (dynamic_macro_calc_crc(dst) != dst->checksum) {
-        dprintf("dynamic macro: slot %d not loaded, checksum mismatch\n", macro_id);
-        dst->length = 0;
+/**
+ * @brief Migrates every slot from the legacy format, and records the current format in the config journal once
+ * they're all written, so an interrupted migration is redone on the next boot. By then the old copy of a slot may
+ * have been overwritten by the new slots, in which case the new copy that was written the first time is kept, if
+ * it's intact. Slots with neither are cleared.
+ */
+static void dynamic_macro_migrate_eeprom(void) {
+    dprintln("dynamic macro: no eeprom header, migrating");
+    for (uint8_t i = 0; i < DYNAMIC_MACRO_COUNT; ++i) {
+        if (dynamic_macro_migrate_legacy(i)) {
+            continue;
+        }
+        dynamic_macro_load_eeprom(i);
+        if (!dynamic_macro_verify(i)) {
+            dynamic_macro_clear_slot(i);
+        }
+    }
+    dynamic_macro_write_header();
+}
 
-        return;
+void dynamic_macro_load_eeprom_all(void) {
+    for (uint8_t i = 0; i < DYNAMIC_MACRO_COUNT; ++i) {
+        dynamic_macro_load_eeprom(i);
     }
+}
 
-    dprintf("dynamic macro: slot %d loaded from eeprom, checksum okay\n", macro_id);
+/**
+ * @brief Loads a slot's index entry. Only the trailer is read, the events are checked against the checksum when
+ * the slot is first played, by dynamic_macro_verify().
+ *
+ * @param macro_id slot to load
+ */
+void dynamic_macro_load_eeprom(uint8_t macro_id) {
+    dynamic_macro_index_t* index = &macro_index[macro_id];
+    uint8_t*               addr  = (uint8_t*)dynamic_macro_eeprom_macro_addr(macro_id);
+
+    eeprom_read_block(&index->length, addr + offsetof(dynamic_macro_t, length), sizeof(index->length));
+    eeprom_read_block(&index->checksum, addr + offsetof(dynamic_macro_t, checksum), sizeof(index->checksum));
+    index->count    = eeprom_read_byte(addr + offsetof(dynamic_macro_t, count));
+    index->verified = false;
+
+    /* If the length is NOT valid for macro, set its length to 0 to prevent its use. */
+    if (index->length > DYNAMIC_MACRO_BUFFER_SIZE) {
+        dprintf("dynamic macro: slot %d not loaded, invalid length\n", macro_id);
+        index->length   = 0;
+        index->count    = 0;
+        index->verified = true;
+    }
 }
 
+/**
+ * @brief Saves the cached slot. Only the bytes in use are written, followed by the trailer, so a slot that is
+ * interrupted part way through fails its checksum rather than playing a mix of old and new events.
+ *
+ * @param macro_id slot to save, which must be the one in the cache
+ */
 void dynamic_macro_save_eeprom(uint8_t macro_id) {
-    dynamic_macro_t* src = &dynamic_macros[macro_id];
+    dynamic_macro_t* src = &macro_cache.macro;
 
-    eeprom_update_block(src, dynamic_macro_eeprom_macro_addr(macro_id), sizeof(dynamic_macro_t));
+    if (macro_cache.macro_id != macro_id) {
+        return;
+    }
+    eeprom_update_block(src->data, dynamic_macro_eeprom_macro_addr(macro_id), src->length);
+    dynamic_macro_write_trailer(macro_id, src->length, src->count, src->checksum);
+
+    macro_index[macro_id] = (dynamic_macro_index_t){
+        .length   = src->length,
+        .checksum = src->checksum,
+        .count    = src->count,
+        .verified = true,
+    };
     dprintf("dynamic macro: slot %d saved to eeprom\n", macro_id);
 }
 
 void dynamic_macro_init(void) {
-    /* zero out macro blocks  */
-    memset(&dynamic_macros, 0, DYNAMIC_MACRO_COUNT * sizeof(dynamic_macro_t));
-    dynamic_macro_load_eeprom_all();
+    dynamic_macro_header_t header;
+    uint32_t               start = timer_read32();
+
+    /* zero out the index, the slots are read from EEPROM as they're played */
+    memset(&macro_index, 0, sizeof(macro_index));
+    macro_cache.macro_id = DYNAMIC_MACRO_NO_SLOT;
+    if (config_journal_read(CONFIG_JOURNAL_KEY_MACROS, &header, sizeof(dynamic_macro_header_t)) == 0) {
+        dynamic_macro_migrate_eeprom();
+    } else if (!dynamic_macro_header_correct()) {
+        dynamic_macro_reset_eeprom();
+    } else {
+        dynamic_macro_load_eeprom_all();
+    }
+    dynamic_macro_init_user(timer_elapsed32(start));
 }
@@ -16,34 +16,73 @@
 #    define DYNAMIC_MACRO_SIZE 64
 #endif // DYNAMIC_MACRO_SIZE
 
+// bytes of encoded events per slot. Key events take 2-3 bytes, so this holds roughly DYNAMIC_MACRO_SIZE events.
+#ifndef DYNAMIC_MACRO_BUFFER_SIZE
+#    define DYNAMIC_MACRO_BUFFER_SIZE (DYNAMIC_MACRO_SIZE * 3)
+#endif // DYNAMIC_MACRO_BUFFER_SIZE
+
+// percentage of the recorded speed to play back at, 0 to play as fast as possible
+#ifndef DYNAMIC_MACRO_PLAYBACK_SPEED
+#    define DYNAMIC_MACRO_PLAYBACK_SPEED 100
+#endif // DYNAMIC_MACRO_PLAYBACK_SPEED
+
+#define DYNAMIC_MACRO_MAGIC   0xD7AC
+#define DYNAMIC_MACRO_VERSION 2
+
 enum dynamic_macro_recording_state {
     STATE_NOT_RECORDING,
     STATE_RECORD_KEY_PRESSED,
     STATE_CURRENTLY_RECORDING,
 };
 
-typedef struct {
-    keyrecord_t events[DYNAMIC_MACRO_SIZE];
-    uint8_t     length;
-    uint16_t    checksum;
+/**
+ * @brief Stored in the config journal, so images from an older format (or a build with different slot sizes) are
+ * detected and cleared, rather than played back as garbage.
+ */
+typedef struct PACKED {
+    uint16_t magic;
+    uint8_t  version;
+    uint8_t  count;
+    uint16_t buffer_size;
+} dynamic_macro_header_t;
+
+/**
+ * @brief A recorded macro, as a packed stream of events.
+ *
+ * Each event is one byte of matrix position (row in the high nibble, column in the low one), followed by a varint
+ * of the time since the previous event shifted left by one, with the pressed state in the low bit. Events that
+ * aren't matrix keys (encoders, combos), and keys with a row or column past 15 (or at row 15, column 15, which reads
+ * as the escape), start with DYNAMIC_MACRO_EVENT_ESCAPE instead, followed by their type, row and column (and
+ * keycode for combos).
+ */
+typedef struct PACKED {
+    uint8_t  data[DYNAMIC_MACRO_BUFFER_SIZE];
+    uint16_t length; // bytes used in data
+    uint8_t  count;  // number of events
+    uint16_t checksum;
 } dynamic_macro_t;
 
-void dynamic_macro_init(void);
-bool dynamic_macro_record_start(uint8_t macro_id);
-void dynamic_macro_play(uint8_t macro_id);
-void dynamic_macro_record_key(uint8_t macro_id, keyrecord_t* record);
-void dynamic_macro_record_end(uint8_t macro_id);
-bool process_record_dynamic_macro(uint16_t keycode, keyrecord_t* record);
+void    dynamic_macro_init(void);
+bool    dynamic_macro_record_start(uint8_t macro_id);
+void    dynamic_macro_play(uint8_t macro_id);
+void    dynamic_macro_playback_cancel(void);
+void    dynamic_macro_set_playback_speed(uint8_t speed);
+bool    dynamic_macro_is_playing(void);
+uint8_t dynamic_macro_get_playback_progress(void);
+void    housekeeping_task_dynamic_macro(void);
+void    dynamic_macro_record_key(uint8_t macro_id, keyrecord_t* record);
+void    dynamic_macro_record_end(uint8_t macro_id);
+bool    process_record_dynamic_macro(uint16_t keycode, keyrecord_t* record);
 
+void dynamic_macro_init_user(uint32_t elapsed);
 void dynamic_macro_record_start_user(void);
 void dynamic_macro_play_user(uint8_t macro_id);
 void dynamic_macro_record_key_user(uint8_t macro_id, keyrecord_t* record);
 void dynamic_macro_record_end_user(uint8_t macro_id);
 
-#define DYNAMIC_MACRO_CRC_LENGTH (sizeof(dynamic_macro_t) - sizeof(uint16_t))
-#define IS_DYN_KEYCODE(keycode)  (keycode >= DYN_MACRO_KEY00 && keycode <= DYN_MACRO_KEY15)
+#define IS_DYN_KEYCODE(keycode) (keycode >= DYN_MACRO_KEY00 && keycode <= DYN_MACRO_KEY15)
 
-uint16_t dynamic_macro_calc_crc(dynamic_macro_t* macro);
+uint16_t dynamic_macro_calc_crc(const dynamic_macro_t* macro);
 void     dynamic_macro_load_eeprom_all(void);
 void     dynamic_macro_load_eeprom(uint8_t macro_id);
 void     dynamic_macro_save_eeprom(uint8_t macro_id);
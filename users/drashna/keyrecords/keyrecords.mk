@@ -15,6 +15,13 @@ ifeq ($(strip $(TAP_DANCE_ENABLE)), yes)
     CUSTOM_TAP_DANCE_ENABLE ?= yes
 endif
 
+# replaces the core dynamic macros, which would otherwise handle the keycodes first. The macro header is kept in
+# the config journal.
+ifeq ($(strip $(CUSTOM_DYNAMIC_MACROS_ENABLE)), yes)
+    DYNAMIC_MACRO_ENABLE  := no
+    CONFIG_JOURNAL_ENABLE := yes
+endif
+
 KEYLOGGER_ENABLE ?= yes
 ifeq ($(strip $(KEYLOGGER_ENABLE)), yes)
     OPT_DEFS += -DKEYLOGGER_ENABLE
@@ -22,6 +29,7 @@ endif
 
 KEYRECORD_FEATURES = \
     CUSTOM_TAP_DANCE \
+    CUSTOM_DYNAMIC_MACROS \
 
 define HANDLE_MY_FEATURE
     # $$(info "Processing: $1_ENABLE $$(USER_PATH)/keyrecords/$2.c")
@@ -57,6 +57,9 @@ void post_process_record_keymap(uint16_t keycode, keyrecord_t *record);
 #ifdef CUSTOM_UNICODE_ENABLE
 bool process_record_unicode(uint16_t keycode, keyrecord_t *record);
 #endif // CUSTOM_UNICODE_ENABLE
+#ifdef AUTOCORRECT_DAWG_ENABLE
+bool process_record_autocorrect_dawg(uint16_t keycode, keyrecord_t *record);
+#endif // AUTOCORRECT_DAWG_ENABLE
 void rgb_layer_indication_toggle(void);
 
 #define LOWER   MO(_LOWER)
@@ -128,13 +128,43 @@
 #    define DYNAMIC_KEYMAP_LAYER_COUNT 12
 #endif // XAP_ENABLE
 
-#ifndef EECONFIG_USER_DATA_SIZE
-#    define EECONFIG_USER_DATA_SIZE 64
-#endif // EECONFIG_USER_DATA_SIZE
+#ifndef USERSPACE_CONFIG_SIZE
+#    define USERSPACE_CONFIG_SIZE 64
+#endif // USERSPACE_CONFIG_SIZE
+#ifdef CONFIG_JOURNAL_ENABLE
+// two banks, each able to hold every config group plus room to append changes before compacting
+#    ifndef CONFIG_JOURNAL_SIZE
+#        ifdef __AVR__
+#            define CONFIG_JOURNAL_SIZE 256
+#        else // __AVR__
+#            define CONFIG_JOURNAL_SIZE 512
+#        endif // __AVR__
+#    endif     // CONFIG_JOURNAL_SIZE
+// the journal is added to the end of the datablock, after the legacy config block (and any dynamic macro slots),
+// so keyboards that set the size add CONFIG_JOURNAL_SIZE to it
+#    ifndef EECONFIG_USER_DATA_SIZE
+#        define EECONFIG_USER_DATA_SIZE (USERSPACE_CONFIG_SIZE + CONFIG_JOURNAL_SIZE)
+#    endif // EECONFIG_USER_DATA_SIZE
+#    if EECONFIG_USER_DATA_SIZE < USERSPACE_CONFIG_SIZE + CONFIG_JOURNAL_SIZE
+#        error "EECONFIG_USER_DATA_SIZE is too small for the config journal!"
+#    endif // EECONFIG_USER_DATA_SIZE < USERSPACE_CONFIG_SIZE + CONFIG_JOURNAL_SIZE
+// the journal has its own magic and CRCs, so it's left out of the version. That keeps the legacy block valid, so
+// it can be migrated into the journal rather than reset.
+#    ifndef EECONFIG_USER_DATA_VERSION
+#        define EECONFIG_USER_DATA_VERSION (0x13373A7D + EECONFIG_USER_DATA_SIZE - CONFIG_JOURNAL_SIZE)
+#    endif // EECONFIG_USER_DATA_VERSION
+#else      // CONFIG_JOURNAL_ENABLE
+#    ifndef EECONFIG_USER_DATA_SIZE
+#        define EECONFIG_USER_DATA_SIZE 64
+#    endif // EECONFIG_USER_DATA_SIZE
+#    if EECONFIG_USER_DATA_SIZE < USERSPACE_CONFIG_SIZE
+#        error "EECONFIG_USER_DATA_SIZE is too small for the userspace config!"
+#    endif // EECONFIG_USER_DATA_SIZE < USERSPACE_CONFIG_SIZE
+#endif     // CONFIG_JOURNAL_ENABLE
 #ifdef SPLIT_KEYBOARD
-#    if EECONFIG_USER_DATA_SIZE > RPC_M2S_BUFFER_SIZE
-#        error "EECONFIG_USER_DATA_SIZE is too large!"
-#    endif // EECONFIG_USER_DATA_SIZE > 1000
+#    if USERSPACE_CONFIG_SIZE > RPC_M2S_BUFFER_SIZE
+#        error "USERSPACE_CONFIG_SIZE is too large!"
+#    endif // USERSPACE_CONFIG_SIZE > RPC_M2S_BUFFER_SIZE
 #else      // SPLIT_KEYBOARD
 #    if EECONFIG_USER_DATA_SIZE > 1000
 #        error "EECONFIG_USER_DATA_SIZE is too large!"
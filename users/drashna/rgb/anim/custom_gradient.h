@@ -9,41 +9,47 @@ extern HSV  gradient_0;
 extern HSV  gradient_100;
 extern bool reflected_gradient;
 
-static HSV INTERPOLATE_HSV(float step, HSV gradient_0, HSV gradient_100) {
-    uint8_t cw, ccw;
-    HSV     color;
+/**
+ * @brief Interpolates between two colours, step / steps of the way from gradient_0 to gradient_100, in integer math so
+ * that it doesn't need the FPU, or soft double for round(). Gives the same colours as working it out in float, other
+ * than a step that float rounds just under a whole number.
+ */
+static HSV INTERPOLATE_HSV(uint16_t step, uint16_t steps, HSV gradient_0, HSV gradient_100) {
+    uint8_t  cw, ccw;
+    uint32_t v;
+    HSV      color;
 
     cw  = (gradient_0.h >= gradient_100.h) ? 255 + gradient_100.h - gradient_0.h
                                            : gradient_100.h - gradient_0.h; // Hue range is 0 to 255.
     ccw = (gradient_0.h >= gradient_100.h) ? gradient_0.h - gradient_100.h : 255 + gradient_0.h - gradient_100.h;
 
     if (cw < ccw) { // going clockwise
-        color.h = gradient_0.h + (uint8_t)(step * cw);
+        color.h = gradient_0.h + (uint8_t)(step * cw / steps);
     } else { // Going counter clockwise
-        color.h = gradient_0.h - (uint8_t)(step * ccw);
+        color.h = gradient_0.h - (uint8_t)(step * ccw / steps);
     }
 
-    color.s = gradient_0.s + step * (gradient_100.s - gradient_0.s);
+    color.s = (gradient_0.s * steps + step * (gradient_100.s - gradient_0.s)) / (int32_t)steps;
 
     // Scale V with global RGB Matrix's V, so users can still control overall brightness with RGB_VAI & RGB_VAD0
-    color.v = round((gradient_0.v + step * (gradient_100.v - gradient_0.v)) * ((float)rgb_matrix_config.hsv.v / 255));
+    v       = (gradient_0.v * steps + step * (gradient_100.v - gradient_0.v)) * rgb_matrix_config.hsv.v;
+    color.v = (v * 2 + steps * 255) / (steps * 255 * 2);
 
     return color;
 }
 
 static HSV CUSTOM_GRADIENT_math(uint8_t led_x, uint8_t min_x, uint8_t max_x) {
-    float step             = (float)led_x / (max_x - min_x);
-    float mid_gradient_pos = 0.5;
+    uint16_t steps = max_x - min_x;
 
     if (reflected_gradient) {
-        if (step <= mid_gradient_pos) {
-            return INTERPOLATE_HSV(step * (1 / mid_gradient_pos), gradient_0, gradient_100);
+        if (led_x * 2 <= steps) {
+            return INTERPOLATE_HSV(led_x * 2, steps, gradient_0, gradient_100);
         } else {
-            return INTERPOLATE_HSV((step - mid_gradient_pos) * (1 / (1 - mid_gradient_pos)), gradient_100, gradient_0);
+            return INTERPOLATE_HSV(led_x * 2 - steps, steps, gradient_100, gradient_0);
         }
 
     } else {
-        return INTERPOLATE_HSV(step, gradient_0, gradient_100);
+        return INTERPOLATE_HSV(led_x, steps, gradient_0, gradient_100);
     }
 }
 
@@ -52,12 +58,18 @@ static bool CUSTOM_GRADIENT(effect_params_t* params) {
 
     uint8_t min_x = 0;   // X coordinate of the left-most LED
     uint8_t max_x = 224; // X coordinate of the right-most LED
+    int16_t last_x = -1;
+    RGB     rgb    = {0, 0, 0};
 
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
 
-        HSV hsv_orig = CUSTOM_GRADIENT_math(g_led_config.point[i].x, min_x, max_x);
-        RGB rgb      = rgb_matrix_hsv_to_rgb(hsv_orig);
+        // The colour only depends on the column, so LEDs in the same column share a conversion
+        if (g_led_config.point[i].x != last_x) {
+            last_x       = g_led_config.point[i].x;
+            HSV hsv_orig = CUSTOM_GRADIENT_math(last_x, min_x, max_x);
+            rgb          = rgb_matrix_hsv_to_rgb(hsv_orig);
+        }
 
         rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
     }
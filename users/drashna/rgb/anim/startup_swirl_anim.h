@@ -74,7 +74,9 @@ static void traverse_matrix(void) {
 }
 
 static void swirl_set_color(HSV hsv) {
-    uint8_t index = g_led_config.matrix_co[j][i];
+    // Once the spiral reaches the middle, the trail fades out without going past the edge of the matrix
+    bool    running = top <= bottom && left <= right;
+    uint8_t index   = running ? g_led_config.matrix_co[j][i] : NO_LED;
 
     if (index != NO_LED) {
         v_values[index] = 255;
@@ -92,10 +94,8 @@ static void swirl_set_color(HSV hsv) {
         rgb_matrix_set_color(v, rgb.r, rgb.g, rgb.b);
     }
 
-    traverse_matrix();
-
-    if (!(top <= bottom && left <= right)) {
-        return;
+    if (running) {
+        traverse_matrix();
     }
 }
 
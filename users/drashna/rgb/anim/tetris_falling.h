@@ -464,7 +464,7 @@ static bool tetris_falling(effect_params_t* params) {
                     if (led_count > 0) {
                         uint8_t curr_hue = get_t_hue(g_rgb_frame_buffer_copy[row][col]);
                         HSV     curr_hsv = {.h = curr_hue, .s = 255, .v = 255};
-                        RGB     curr_rgb = hsv_to_rgb(curr_hsv);
+                        RGB     curr_rgb = rgb_matrix_hsv_to_rgb(curr_hsv);
                         rgb_matrix_set_color(led[0], curr_rgb.r, curr_rgb.g, curr_rgb.b);
                     }
                 }
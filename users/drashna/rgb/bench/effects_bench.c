@@ -0,0 +1,326 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host benchmark for color_math.c and the custom RGB Matrix effects.
+ *
+ * Checks color_hsv_to_rgb() against Quantum's hsv_to_rgb() for every HSV colour, and the custom gradient's integer
+ * math against the float math it replaced. Then it renders each effect in rgb/anim for a few thousand frames, a
+ * process limit's worth of LEDs at a time like rgb_matrix_task does, with each conversion, and reports the cycles per
+ * frame and the conversions per frame. rgb_matrix_set_color() only stores the colour. Cycles are TSC cycles on x86,
+ * and ns elsewhere. color_hsv_to_rgb() only replaces the conversion with CUSTOM_COLOR_MATH = yes, so this is what to
+ * run to see whether it's worth it for a board.
+ *
+ * The LED table is a stand-in for the Moonlander: 72 LEDs laid out column by column, 36 a side. The effects are
+ * included through rgb_matrix_user.inc, like the firmware does, plus the ones it leaves commented out that build
+ * without a keyboard. The reactive effects run on Quantum's runners, and tetris needs the framebuffer, so they aren't
+ * covered.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o effects_bench -Iusers/drashna/rgb/bench -Iusers/drashna/bench/qmk -Iusers/drashna/rgb -Iusers/drashna \
+ *         -DRGB_MATRIX_LED_COUNT=72 users/drashna/rgb/bench/effects_bench.c users/drashna/rgb/color_math.c -lm
+ *     ./effects_bench
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+#include "quantum.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "color_math.h"
+
+#define BENCH_FRAMES   5000
+#define BENCH_FRAME_MS 16
+
+/*
+ * Stubs: the LED driver keeps what the effects set, and the conversion goes through the kernel being measured.
+ */
+
+led_config_t g_led_config;
+rgb_config_t rgb_matrix_config = {.enable = 1, .hsv = {170, 255, 200}, .speed = 128, .flags = LED_FLAG_ALL};
+uint32_t     g_rgb_timer;
+uint16_t     rand16seed;
+
+hsv_t gradient_0         = {205, 250, 255};
+hsv_t gradient_100       = {140, 215, 125};
+bool  reflected_gradient = false;
+
+static rgb_t leds[RGB_MATRIX_LED_COUNT];
+static rgb_t (*kernel)(hsv_t hsv);
+static uint32_t conversions;
+
+uint16_t timer_read(void) {
+    return g_rgb_timer;
+}
+uint8_t rgb_matrix_get_val(void) {
+    return rgb_matrix_config.hsv.v;
+}
+uint8_t rgb_matrix_get_hue(void) {
+    return rgb_matrix_config.hsv.h;
+}
+hsv_t rgb_matrix_get_hsv(void) {
+    return rgb_matrix_config.hsv;
+}
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (rgb_t){red, green, blue};
+}
+bool rgb_matrix_check_finished_leds(uint8_t led_max) {
+    return led_max < RGB_MATRIX_LED_COUNT;
+}
+
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    conversions++;
+    return kernel(hsv);
+}
+
+/**
+ * @brief Quantum's HSV to RGB conversion, without the CIE curve, as the reference.
+ */
+rgb_t hsv_to_rgb(hsv_t hsv) {
+    uint8_t region, remainder, p, q, t;
+
+    if (hsv.s == 0) {
+        return (rgb_t){hsv.v, hsv.v, hsv.v};
+    }
+    region    = hsv.h * 6 / 255;
+    remainder = (hsv.h * 2 - region * 85) * 3;
+    p         = (hsv.v * (255 - hsv.s)) >> 8;
+    q         = (hsv.v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    t         = (hsv.v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 6:
+        case 0:
+            return (rgb_t){hsv.v, t, p};
+        case 1:
+            return (rgb_t){q, hsv.v, p};
+        case 2:
+            return (rgb_t){p, hsv.v, t};
+        case 3:
+            return (rgb_t){p, q, hsv.v};
+        case 4:
+            return (rgb_t){t, p, hsv.v};
+        default:
+            return (rgb_t){hsv.v, p, q};
+    }
+}
+
+/**
+ * @brief Quantum's runner for effects that only depend on the LED and the time.
+ */
+bool effect_runner_i(effect_params_t *params, i_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    uint8_t time = scale16by8(g_rgb_timer, qadd8(rgb_matrix_config.speed / 4, 1));
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_t rgb = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, i, time));
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#include "rgb_matrix_user.inc"
+#include "rgb/anim/custom_gradient.h"
+#include "rgb/anim/startup_swirl_anim.h"
+#include "rgb/anim/alpha_mod_homerow.h"
+#include "rgb/anim/alpha_mod_homerow_cycle.h"
+
+typedef struct {
+    const char *name;
+    bool (*run)(effect_params_t *params);
+} bench_effect_t;
+
+static const bench_effect_t effects[] = {
+    {"cool diagonal", COOL_DIAGONAL},
+    {"random breath rainbow", RANDOM_BREATH_RAINBOW},
+    {"single colour raindrops", SINGLE_COLOR_RAINDROPS},
+    {"candy rain", CANDY_RAIN},
+    {"custom gradient", CUSTOM_GRADIENT},
+    {"startup swirl", STARTUP_SWIRL_ANIM},
+    {"alpha mod homerow", alpha_mod_homerow},
+    {"alpha mod homerow cycle", alpha_mod_homerow_cycle},
+};
+
+static const struct {
+    const char *name;
+    rgb_t (*convert)(hsv_t hsv);
+} kernels[] = {
+    {"hsv_to_rgb", hsv_to_rgb},
+    {"color_hsv_to_rgb", color_hsv_to_rgb},
+};
+
+static inline uint64_t bench_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Builds the Moonlander stand-in: 36 LEDs a side, column by column from the outer edge, six columns of five
+ * and a column of three, then three thumb keys. The outer columns and the thumbs are modifiers.
+ */
+static void build_leds(void) {
+    memset(&g_led_config, 0, sizeof(g_led_config));
+    memset(g_led_config.matrix_co, NO_LED, sizeof(g_led_config.matrix_co));
+    for (uint8_t side = 0; side < 2; side++) {
+        uint8_t index = side * 36;
+        for (uint8_t column = 0; column < 7; column++) {
+            for (uint8_t row = 0; row < (column < 6 ? 5 : 3); row++) {
+                uint8_t x = column * 17;
+                g_led_config.matrix_co[side * 6 + row][column] = index;
+                g_led_config.point[index] = (led_point_t){side ? 224 - x : x, row * 12};
+                g_led_config.flags[index++] = column == 0 ? LED_FLAG_MODIFIER : LED_FLAG_KEYLIGHT;
+            }
+        }
+        for (uint8_t thumb = 0; thumb < 3; thumb++) {
+            uint8_t x = 86 + thumb * 9;
+            g_led_config.matrix_co[side * 6 + 5][thumb] = index;
+            g_led_config.point[index] = (led_point_t){side ? 224 - x : x, 55 + thumb * 4};
+            g_led_config.flags[index++] = LED_FLAG_MODIFIER | LED_FLAG_INDICATOR;
+        }
+    }
+}
+
+/**
+ * @brief Checks color_hsv_to_rgb() against hsv_to_rgb() for every colour, and times both.
+ */
+static bool verify_kernel(void) {
+    uint64_t cycles[ARRAY_SIZE(kernels)];
+    uint32_t checksum = 0;
+
+    for (uint32_t colour = 0; colour < (1 << 24); colour++) {
+        hsv_t hsv      = {colour >> 16, colour >> 8, colour};
+        rgb_t expected = hsv_to_rgb(hsv), actual = color_hsv_to_rgb(hsv);
+        if (memcmp(&expected, &actual, sizeof(rgb_t))) {
+            printf("color_hsv_to_rgb(%u, %u, %u) is %u, %u, %u, not %u, %u, %u\n", hsv.h, hsv.s, hsv.v, actual.r,
+                   actual.g, actual.b, expected.r, expected.g, expected.b);
+            return false;
+        }
+    }
+
+    for (uint8_t k = 0; k < ARRAY_SIZE(kernels); k++) {
+        uint64_t start = bench_clock();
+        for (uint32_t colour = 0; colour < (1 << 24); colour++) {
+            rgb_t rgb = kernels[k].convert((hsv_t){colour >> 16, colour >> 8, colour});
+            checksum += rgb.r + rgb.g + rgb.b;
+        }
+        cycles[k] = bench_clock() - start;
+    }
+    printf("every colour matches hsv_to_rgb (checksum %u)\n", checksum);
+    for (uint8_t k = 0; k < ARRAY_SIZE(kernels); k++) {
+        printf("    %-18s %6.2f cycles per conversion\n", kernels[k].name, (double)cycles[k] / (1 << 24));
+    }
+
+    return true;
+}
+
+/**
+ * @brief The custom gradient's colour as it was worked out in float, as the reference for the integer math.
+ */
+static hsv_t gradient_float(float step, hsv_t from, hsv_t to) {
+    uint8_t cw  = from.h >= to.h ? 255 + to.h - from.h : to.h - from.h;
+    uint8_t ccw = from.h >= to.h ? from.h - to.h : 255 + from.h - to.h;
+    hsv_t   hsv;
+
+    hsv.h = cw < ccw ? from.h + (uint8_t)(step * cw) : from.h - (uint8_t)(step * ccw);
+    hsv.s = from.s + step * (to.s - from.s);
+    hsv.v = round((from.v + step * (to.v - from.v)) * ((float)rgb_matrix_config.hsv.v / 255));
+    return hsv;
+}
+
+/**
+ * @brief Checks the custom gradient against gradient_float() for every column, brightness and a few gradients.
+ */
+static void verify_gradient(void) {
+    static const hsv_t ends[][2] = {
+        {{205, 250, 255}, {140, 215, 125}},
+        {{0, 0, 0}, {255, 255, 255}},
+        {{10, 255, 40}, {250, 30, 220}},
+        {{128, 100, 200}, {128, 100, 200}},
+    };
+    uint32_t checked = 0, differ = 0;
+    uint8_t  worst   = 0;
+
+    for (uint8_t e = 0; e < ARRAY_SIZE(ends); e++) {
+        gradient_0   = ends[e][0];
+        gradient_100 = ends[e][1];
+        for (uint8_t reflected = 0; reflected < 2; reflected++) {
+            reflected_gradient = reflected;
+            for (uint16_t brightness = 0; brightness < 256; brightness++) {
+                rgb_matrix_config.hsv.v = brightness;
+                for (uint8_t x = 0; x <= 224; x++) {
+                    float step     = (float)x / 224;
+                    hsv_t expected = !reflected  ? gradient_float(step, gradient_0, gradient_100)
+                                     : step <= 0.5 ? gradient_float(step * 2, gradient_0, gradient_100)
+                                                   : gradient_float((step - 0.5) * 2, gradient_100, gradient_0);
+                    hsv_t actual   = CUSTOM_GRADIENT_math(x, 0, 224);
+                    uint8_t diff   = MAX(abs(expected.h - actual.h), MAX(abs(expected.s - actual.s),
+                                                                        abs(expected.v - actual.v)));
+                    differ += diff != 0;
+                    worst = MAX(worst, diff);
+                    checked++;
+                }
+            }
+        }
+    }
+    printf("custom gradient: %u of %u colours differ from float, by at most %u\n", differ, checked, worst);
+    gradient_0         = ends[0][0];
+    gradient_100       = ends[0][1];
+    reflected_gradient = false;
+    rgb_matrix_config.hsv.v = 200;
+}
+
+/**
+ * @brief Renders BENCH_FRAMES frames of an effect with a kernel, after starting it the way a mode change does.
+ *
+ * @return double cycles per frame
+ */
+static double bench_effect(const bench_effect_t *effect, rgb_t (*convert)(hsv_t hsv)) {
+    uint64_t cycles = 0;
+
+    kernel      = convert;
+    conversions = 0;
+    rand16seed  = 1337;
+    srand(1337);
+    for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+        effect_params_t params = {.iter = 0, .flags = LED_FLAG_ALL, .init = frame == 0};
+        uint64_t        start  = bench_clock();
+
+        g_rgb_timer = frame * BENCH_FRAME_MS;
+        while (effect->run(&params)) {
+            params.iter++;
+        }
+        cycles += bench_clock() - start;
+    }
+    return (double)cycles / BENCH_FRAMES;
+}
+
+int main(void) {
+    build_leds();
+    if (!verify_kernel()) {
+        return 1;
+    }
+    verify_gradient();
+
+    printf("\n%u LEDs, %u per pass\n", RGB_MATRIX_LED_COUNT, RGB_MATRIX_LED_PROCESS_LIMIT);
+    printf("    %-24s %14s %18s %12s\n", "effect", kernels[0].name, kernels[1].name, "conversions");
+    for (uint8_t e = 0; e < ARRAY_SIZE(effects); e++) {
+        double cycles[ARRAY_SIZE(kernels)];
+        for (uint8_t k = 0; k < ARRAY_SIZE(kernels); k++) {
+            cycles[k] = bench_effect(&effects[e], kernels[k].convert);
+        }
+        printf("    %-24s %14.0f %18.0f %12.1f\n", effects[e].name, cycles[0], cycles[1],
+               (double)conversions / BENCH_FRAMES);
+    }
+    printf("(cycles and conversions per frame)\n");
+    return 0;
+}
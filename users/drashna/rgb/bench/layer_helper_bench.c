@@ -0,0 +1,297 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host benchmark for rgb_matrix_layer_helper().
+ *
+ * Renders the layer indicators the way rgb_matrix_indicators_advanced_user() does, RGB_MATRIX_LED_PROCESS_LIMIT LEDs
+ * at a time, for every mode and for each of the flags the keymaps use. It runs once with the flag scanning helper
+ * this replaced, and once with rgb_matrix_layer_helper.c. It checks that both set the same colours, and reports the
+ * time per frame, how many LEDs each visits and how many HSV to RGB conversions each does.
+ *
+ * The LED tables are stand-ins for the Moonlander and the Charybdis 4x6, with their LED counts and split, laid out
+ * column by column. The Moonlander has its outer columns and thumb keys as modifiers. The Charybdis uses the modifier
+ * LEDs that its drashna keymap sets in keyboard_post_init_keymap(). The keyboards' own tables live in qmk_firmware.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o layer_helper_bench -Iusers/drashna/rgb/bench -Iusers/drashna/bench/qmk -Iusers/drashna/rgb \
+ *         users/drashna/rgb/bench/layer_helper_bench.c users/drashna/rgb/rgb_matrix_layer_helper.c
+ *     ./layer_helper_bench
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "quantum.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "rgb_matrix_stuff.h"
+
+#define BENCH_FRAMES   20000
+#define BENCH_FRAME_MS 16
+
+typedef struct {
+    const char *name;
+    uint8_t     led_count;
+    void (*build)(void);
+} bench_keyboard_t;
+
+/*
+ * Stubs: the LED driver keeps what the helper sets, and counts the work done.
+ */
+
+uint8_t      bench_led_count;
+uint32_t     g_rgb_timer;
+led_config_t g_led_config;
+
+static rgb_t    leds[BENCH_MAX_LEDS];
+static uint32_t conversions, visits;
+
+uint8_t rgb_matrix_get_val(void) {
+    return 200;
+}
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (rgb_t){red, green, blue};
+}
+
+/**
+ * @brief RGB Matrix's HSV to RGB conversion, without the CIE curve. Kept out of line, as it is in the firmware, so
+ * that the old helper doesn't get it inlined.
+ */
+__attribute__((noinline)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    uint8_t region, remainder, p, q, t;
+
+    conversions++;
+    if (hsv.s == 0) {
+        return (rgb_t){hsv.v, hsv.v, hsv.v};
+    }
+    region    = hsv.h * 6 / 255;
+    remainder = (hsv.h * 2 - region * 85) * 3;
+    p         = (hsv.v * (255 - hsv.s)) >> 8;
+    q         = (hsv.v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    t         = (hsv.v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 6:
+        case 0:
+            return (rgb_t){hsv.v, t, p};
+        case 1:
+            return (rgb_t){q, hsv.v, p};
+        case 2:
+            return (rgb_t){p, hsv.v, t};
+        case 3:
+            return (rgb_t){p, q, hsv.v};
+        case 4:
+            return (rgb_t){t, p, hsv.v};
+        default:
+            return (rgb_t){hsv.v, p, q};
+    }
+}
+
+/**
+ * @brief The helper as it was, scanning every LED in the range and converting per LED. The breathing and snek modes
+ * used to scale the value of each LED by the one before it; here, like in the new helper, each LED starts from the
+ * requested value.
+ */
+static void reference_layer_helper(uint8_t hue, uint8_t sat, uint8_t val, uint8_t mode, uint8_t speed,
+                                   uint8_t led_type, uint8_t led_min, uint8_t led_max) {
+    hsv_t   hsv  = {hue, sat, val};
+    rgb_t   rgb  = {0};
+    uint8_t time = scale16by8(g_rgb_timer, qadd8(speed / 4, 1));
+    if (hsv.v > rgb_matrix_get_val()) {
+        hsv.v = rgb_matrix_get_val();
+    }
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        visits++;
+        if (!HAS_FLAGS(g_led_config.flags[i], led_type)) {
+            continue;
+        }
+        hsv_t led_hsv = hsv;
+        switch (mode) {
+            case 1: // breathing
+                led_hsv.v = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
+                break;
+            case 2: // Rainbow Mood
+                led_hsv.h = time;
+                break;
+            case 3: // Rainbow Swirl
+                led_hsv.h = g_led_config.point[i].x - time;
+                break;
+            case 4: // Snek
+                {
+                    int16_t v = hsv.v - abs(scale8(g_led_config.point[i].x, 228) + 28 - time) * 8;
+                    led_hsv.v = scale8(v < 0 ? 0 : v, hsv.v);
+                    break;
+                }
+        }
+        rgb = rgb_matrix_hsv_to_rgb(led_hsv);
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+}
+
+/*
+ * LED tables
+ */
+
+static void set_led(uint8_t index, uint8_t x, uint8_t y, uint8_t flags) {
+    g_led_config.point[index] = (led_point_t){x, y};
+    g_led_config.flags[index] = flags;
+}
+
+/**
+ * @brief 72 LEDs, 36 a side, column by column from the outer edge: six columns of five, a column of three and three
+ * thumb keys. The right side mirrors the left.
+ */
+static void build_moonlander(void) {
+    for (uint8_t side = 0; side < 2; side++) {
+        uint8_t index = side * 36;
+        for (uint8_t column = 0; column < 7; column++) {
+            for (uint8_t row = 0; row < (column < 6 ? 5 : 3); row++) {
+                uint8_t x = column * 17;
+                set_led(index++, side ? 224 - x : x, row * 12, column == 0 ? LED_FLAG_MODIFIER : LED_FLAG_KEYLIGHT);
+            }
+        }
+        for (uint8_t thumb = 0; thumb < 3; thumb++) {
+            uint8_t x = 86 + thumb * 9;
+            set_led(index++, side ? 224 - x : x, 55 + thumb * 4, LED_FLAG_MODIFIER);
+        }
+    }
+}
+
+/**
+ * @brief 56 LEDs: 29 on the left, six columns of four and five thumb keys, and 27 on the right, with three thumb
+ * keys. All keylights, then the modifiers from the Charybdis 4x6 drashna keymap.
+ */
+static void build_charybdis(void) {
+    static const uint8_t modifiers[] = {53, 54, 55, 0, 1, 2, 3, 29, 30, 31, 32};
+    uint8_t              index       = 0;
+
+    for (uint8_t side = 0; side < 2; side++) {
+        for (uint8_t column = 0; column < 6; column++) {
+            for (uint8_t row = 0; row < 4; row++) {
+                uint8_t x = column * 17;
+                set_led(index++, side ? 224 - x : x, row * 16, LED_FLAG_KEYLIGHT);
+            }
+        }
+        for (uint8_t thumb = 0; thumb < (side ? 3 : 5); thumb++) {
+            uint8_t x = 85 + thumb * 7;
+            set_led(index++, side ? 224 - x : x, 64, LED_FLAG_KEYLIGHT);
+        }
+    }
+    for (uint8_t i = 0; i < ARRAY_SIZE(modifiers); i++) {
+        g_led_config.flags[modifiers[i]] = LED_FLAG_MODIFIER;
+    }
+}
+
+static const bench_keyboard_t keyboards[] = {
+    {"moonlander", 72, build_moonlander},
+    {"charybdis 4x6", 56, build_charybdis},
+};
+
+/*
+ * Benchmark
+ */
+
+typedef void (*layer_helper_t)(uint8_t hue, uint8_t sat, uint8_t val, uint8_t mode, uint8_t speed, uint8_t led_type,
+                               uint8_t led_min, uint8_t led_max);
+
+/**
+ * @brief Renders one frame of indicators, a process limit's worth of LEDs at a time, like rgb_matrix_task does.
+ */
+static void render_frame(layer_helper_t helper, uint8_t mode, uint8_t led_type) {
+    for (uint8_t led_min = 0; led_min < bench_led_count; led_min += RGB_MATRIX_LED_PROCESS_LIMIT) {
+        uint8_t led_max = led_min + RGB_MATRIX_LED_PROCESS_LIMIT;
+        if (led_max > bench_led_count) {
+            led_max = bench_led_count;
+        }
+        helper(213, 255, 255, mode, 128, led_type, led_min, led_max);
+    }
+}
+
+/**
+ * @brief Renders BENCH_FRAMES frames with a helper, and returns the time per frame in ns. The counters are left
+ * holding the work it did.
+ */
+static double bench_helper(layer_helper_t helper, uint8_t mode, uint8_t led_type) {
+    struct timespec start, end;
+
+    conversions = visits = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+        g_rgb_timer = frame * BENCH_FRAME_MS;
+        render_frame(helper, mode, led_type);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCH_FRAMES;
+}
+
+/**
+ * @brief Checks that both helpers set the same colours, frame by frame.
+ */
+static bool verify(uint8_t mode, uint8_t led_type) {
+    static rgb_t expected[BENCH_MAX_LEDS];
+
+    for (uint32_t frame = 0; frame < BENCH_FRAMES; frame += 7) {
+        g_rgb_timer = frame * BENCH_FRAME_MS;
+        memset(leds, 0, sizeof(leds));
+        render_frame(reference_layer_helper, mode, led_type);
+        memcpy(expected, leds, sizeof(leds));
+        memset(leds, 0, sizeof(leds));
+        render_frame(rgb_matrix_layer_helper, mode, led_type);
+        if (memcmp(expected, leds, sizeof(leds))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static const char *const mode_names[] = {"solid", "breathing", "rainbow mood", "rainbow swirl", "snek"};
+    static const struct {
+        const char *name;
+        uint8_t     flags;
+    } led_types[] = {
+        {"modifier", LED_FLAG_MODIFIER},
+        {"keylight", LED_FLAG_KEYLIGHT},
+        {"underglow", LED_FLAG_UNDERGLOW},
+    };
+    bool passed = true;
+
+    for (uint8_t k = 0; k < ARRAY_SIZE(keyboards); k++) {
+        memset(&g_led_config, 0, sizeof(g_led_config));
+        bench_led_count = keyboards[k].led_count;
+        keyboards[k].build();
+        rgb_matrix_layer_helper_reindex();
+        printf("%s, %u LEDs:\n", keyboards[k].name, bench_led_count);
+        printf("    %-10s %-14s %12s %12s %8s %8s %9s %9s\n", "flags", "mode", "scan ns", "index ns", "scan lv",
+               "scan cv", "index lv", "index cv");
+
+        for (uint8_t t = 0; t < ARRAY_SIZE(led_types); t++) {
+            for (uint8_t mode = 0; mode < ARRAY_SIZE(mode_names); mode++) {
+                if (!verify(mode, led_types[t].flags)) {
+                    printf("    %s %s: the colours differ\n", led_types[t].name, mode_names[mode]);
+                    passed = false;
+                    continue;
+                }
+                double   scan_ns          = bench_helper(reference_layer_helper, mode, led_types[t].flags);
+                uint32_t scan_visits      = visits;
+                uint32_t scan_conversions = conversions;
+                // The new helper only visits LEDs it sets, so count them instead
+                double   index_ns          = bench_helper(rgb_matrix_layer_helper, mode, led_types[t].flags);
+                uint32_t index_conversions = conversions;
+                uint32_t index_visits      = 0;
+                for (uint8_t i = 0; i < bench_led_count; i++) {
+                    index_visits += HAS_FLAGS(g_led_config.flags[i], led_types[t].flags);
+                }
+
+                printf("    %-10s %-14s %12.1f %12.1f %8.1f %8.1f %9u %9.2f\n", led_types[t].name, mode_names[mode],
+                       scan_ns, index_ns, (double)scan_visits / BENCH_FRAMES, (double)scan_conversions / BENCH_FRAMES,
+                       index_visits, (double)index_conversions / BENCH_FRAMES);
+            }
+        }
+    }
+    printf("lv: LEDs visited per frame, cv: HSV to RGB conversions per frame\n");
+    printf(passed ? "all colours match\n" : "MISMATCH\n");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Host stand in for quantum.h and rgb_matrix.h, for the RGB benchmarks. Only what the layer helper, the colour
+// maths and the effects in rgb/anim use. Without RGB_MATRIX_LED_COUNT, the LED count is a variable, so that one build
+// can run over several keyboards' tables.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "color.h"
+#include "progmem.h"
+#include "util.h"
+
+#define BENCH_MAX_LEDS 128
+
+#ifndef RGB_MATRIX_LED_COUNT
+extern uint8_t bench_led_count;
+#    define RGB_MATRIX_LED_COUNT bench_led_count
+#endif // RGB_MATRIX_LED_COUNT
+#ifndef RGB_MATRIX_LED_PROCESS_LIMIT
+#    define RGB_MATRIX_LED_PROCESS_LIMIT 5
+#endif // RGB_MATRIX_LED_PROCESS_LIMIT
+#define RGB_MATRIX_LED_FLAG_INDEX_SIZE (BENCH_MAX_LEDS + BENCH_MAX_LEDS / 2)
+#ifndef MATRIX_ROWS
+#    define MATRIX_ROWS 12
+#endif // MATRIX_ROWS
+#ifndef MATRIX_COLS
+#    define MATRIX_COLS 7
+#endif // MATRIX_COLS
+
+#define HAS_FLAGS(bits, flags)     ((bits & flags) == flags)
+#define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
+#define NO_LED                     255
+#define LED_FLAG_NONE              0x00
+#define LED_FLAG_MODIFIER          0x01
+#define LED_FLAG_UNDERGLOW         0x02
+#define LED_FLAG_KEYLIGHT          0x04
+#define LED_FLAG_INDICATOR         0x08
+#define LED_FLAG_ALL               0xFF
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+} led_point_t;
+
+typedef struct {
+    uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
+    led_point_t point[BENCH_MAX_LEDS];
+    uint8_t     flags[BENCH_MAX_LEDS];
+} led_config_t;
+
+typedef struct {
+    uint8_t iter;
+    uint8_t flags;
+    bool    init;
+} effect_params_t;
+
+typedef struct {
+    uint8_t enable;
+    uint8_t mode;
+    hsv_t   hsv;
+    uint8_t speed;
+    uint8_t flags;
+} rgb_config_t;
+
+typedef struct keyrecord_t keyrecord_t;
+
+#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_USE_LIMITS(min, max)                        \
+    uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter; \
+    uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;          \
+    if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
+#define RGB_MATRIX_TEST_LED_FLAGS() \
+    if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+
+typedef hsv_t (*i_f)(hsv_t hsv, uint8_t i, uint8_t time);
+
+extern led_config_t g_led_config;
+extern rgb_config_t rgb_matrix_config;
+extern uint32_t     g_rgb_timer;
+
+uint16_t timer_read(void);
+uint8_t  rgb_matrix_get_val(void);
+uint8_t  rgb_matrix_get_hue(void);
+hsv_t    rgb_matrix_get_hsv(void);
+rgb_t    rgb_matrix_hsv_to_rgb(hsv_t hsv);
+void     rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+bool     rgb_matrix_check_finished_leds(uint8_t led_max);
+bool     effect_runner_i(effect_params_t *params, i_f effect_func);
@@ -0,0 +1,64 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "color_math.h"
+#include "progmem.h"
+#ifdef USE_CIE1931_CURVE
+#    include "led_tables.h"
+#endif // USE_CIE1931_CURVE
+
+/*
+ * Which of v, the ramp and p goes to each of red, green and blue, two bits each, for each sixth of the hue circle.
+ * The seventh entry is for a hue of 255, which wraps back to red.
+ */
+#define CHANNEL_ORDER(r, g, b) ((r) | (g) << 2 | (b) << 4)
+static const uint8_t channel_order[7] PROGMEM = {
+    CHANNEL_ORDER(0, 1, 2), CHANNEL_ORDER(1, 0, 2), CHANNEL_ORDER(2, 0, 1), CHANNEL_ORDER(2, 1, 0),
+    CHANNEL_ORDER(1, 2, 0), CHANNEL_ORDER(0, 2, 1), CHANNEL_ORDER(0, 1, 2),
+};
+
+/**
+ * @brief Converts HSV to RGB, with the same result as Quantum's hsv_to_rgb(), including the CIE curve when it is
+ * enabled, but without its division and switch.
+ *
+ * The sixth of the hue circle is (h * 193) >> 13, which matches h * 6 / 255 for every hue. Only one of the rising and
+ * falling ramps is needed for any one sixth, so it is worked out once instead of both, and the channels are picked
+ * from channel_order.
+ *
+ * @param hsv colour to convert
+ * @return rgb_t the colour as RGB
+ */
+rgb_t color_hsv_to_rgb(hsv_t hsv) {
+#ifdef USE_CIE1931_CURVE
+    uint8_t v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+#else  // USE_CIE1931_CURVE
+    uint8_t v = hsv.v;
+#endif // USE_CIE1931_CURVE
+
+    if (hsv.s == 0) {
+        return (rgb_t){v, v, v};
+    }
+
+    uint8_t region    = (hsv.h * 193) >> 13;
+    uint8_t remainder = (hsv.h * 2 - region * 85) * 3;
+    // Odd sixths fall with the remainder, even ones rise with it
+    uint8_t ramp      = remainder ^ (uint8_t)((region & 1) - 1);
+    uint8_t order     = pgm_read_byte(&channel_order[region]);
+    uint8_t values[3] = {
+        v,
+        (v * (255 - ((hsv.s * ramp) >> 8))) >> 8,
+        (v * (255 - hsv.s)) >> 8,
+    };
+
+    return (rgb_t){values[order & 3], values[(order >> 2) & 3], values[order >> 4]};
+}
+
+#ifdef RGB_MATRIX_ENABLE
+/**
+ * @brief Replaces RGB Matrix's weak HSV to RGB conversion, so that every effect, runner and indicator uses
+ * color_hsv_to_rgb().
+ */
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    return color_hsv_to_rgb(hsv);
+}
+#endif // RGB_MATRIX_ENABLE
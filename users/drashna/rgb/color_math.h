@@ -0,0 +1,9 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+rgb_t color_hsv_to_rgb(hsv_t hsv);
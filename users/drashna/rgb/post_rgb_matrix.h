@@ -20,3 +20,6 @@
 #ifndef RGB_MATRIX_LED_FLUSH_LIMIT
 #    define RGB_MATRIX_LED_FLUSH_LIMIT 26
 #endif // RGB_MATRIX_LED_FLUSH_LIMIT
+#ifndef RGB_MATRIX_LED_FLAG_INDEX_SIZE
+#    define RGB_MATRIX_LED_FLAG_INDEX_SIZE (RGB_MATRIX_LED_COUNT + RGB_MATRIX_LED_COUNT / 2)
+#endif // RGB_MATRIX_LED_FLAG_INDEX_SIZE
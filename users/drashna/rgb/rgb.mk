@@ -16,12 +16,19 @@ endif
 CUSTOM_RGB_MATRIX ?= yes
 ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     ifeq ($(strip $(CUSTOM_RGB_MATRIX)), yes)
-        SRC += $(USER_PATH)/rgb/rgb_matrix_stuff.c
+        SRC += $(USER_PATH)/rgb/rgb_matrix_stuff.c \
+            $(USER_PATH)/rgb/rgb_matrix_layer_helper.c
         CONFIG_H += $(USER_PATH)/rgb/rgb_matrix_config.h
         POST_CONFIG_H += $(USER_PATH)/rgb/post_rgb_matrix.h
 
         OPT_DEFS += -DCUSTOM_RGB_MATRIX
         RGB_MATRIX_CUSTOM_USER = yes
+
+        CUSTOM_COLOR_MATH ?= no
+        ifeq ($(strip $(CUSTOM_COLOR_MATH)), yes)
+            SRC += $(USER_PATH)/rgb/color_math.c
+            OPT_DEFS += -DCUSTOM_COLOR_MATH
+        endif
     endif
 endif
 
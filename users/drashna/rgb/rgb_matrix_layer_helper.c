@@ -0,0 +1,167 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "rgb_matrix_stuff.h"
+#include "lib/lib8tion/lib8tion.h"
+
+extern led_config_t g_led_config;
+
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+
+// The flags with a list of their LEDs in led_flag_leds, in the order the lists are stored
+static const uint8_t led_flag_index_flags[] = {LED_FLAG_MODIFIER, LED_FLAG_UNDERGLOW, LED_FLAG_KEYLIGHT,
+                                               LED_FLAG_INDICATOR};
+
+static uint8_t  led_flag_leds[RGB_MATRIX_LED_FLAG_INDEX_SIZE];
+static uint16_t led_flag_start[ARRAY_SIZE(led_flag_index_flags) + 1];
+static uint8_t  led_flag_indexed     = 0; // flags whose list fit in led_flag_leds
+static bool     led_flag_index_valid = false;
+
+/**
+ * @brief Builds an ascending list of the LEDs with each of the indexed flags, from g_led_config. A flag whose list
+ * doesn't fit in what is left of RGB_MATRIX_LED_FLAG_INDEX_SIZE isn't indexed, and is found by scanning instead.
+ */
+static void rgb_matrix_layer_helper_build_index(void) {
+    uint16_t size = 0;
+
+    led_flag_indexed = 0;
+    for (uint8_t flag = 0; flag < ARRAY_SIZE(led_flag_index_flags); flag++) {
+        uint16_t count = 0;
+
+        led_flag_start[flag] = size;
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            count += HAS_FLAGS(g_led_config.flags[i], led_flag_index_flags[flag]);
+        }
+        if (size + count > ARRAY_SIZE(led_flag_leds)) {
+            continue;
+        }
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if (HAS_FLAGS(g_led_config.flags[i], led_flag_index_flags[flag])) {
+                led_flag_leds[size++] = i;
+            }
+        }
+        led_flag_indexed |= led_flag_index_flags[flag];
+    }
+    led_flag_start[ARRAY_SIZE(led_flag_index_flags)] = size;
+    led_flag_index_valid                             = true;
+}
+
+/**
+ * @brief Rebuilds the LED lists the next time they are used. Needed after changing g_led_config.flags, other than
+ * from keyboard_post_init, which is done before the first frame is rendered.
+ */
+void rgb_matrix_layer_helper_reindex(void) {
+    led_flag_index_valid = false;
+}
+
+/**
+ * @brief Finds the first entry in an ascending list of LEDs that isn't below an LED index.
+ *
+ * @param first start of the list in led_flag_leds
+ * @param last end of the list in led_flag_leds
+ * @param led LED index to look for
+ * @return uint16_t position of the first entry that is led or above, or last if there isn't one
+ */
+static uint16_t led_flag_lower_bound(uint16_t first, uint16_t last, uint8_t led) {
+    while (first < last) {
+        uint16_t middle = first + (last - first) / 2;
+        if (led_flag_leds[middle] < led) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief Converts HSV to RGB, remembering the last conversion. The solid, breathing and rainbow mood modes use one
+ * colour for every LED, that only changes with time, so it is converted once for all the calls that render a frame,
+ * and not at all while the colour holds still.
+ *
+ * @param hsv colour to convert
+ * @return rgb_t the colour as RGB
+ */
+static rgb_t layer_helper_hsv_to_rgb(hsv_t hsv) {
+    static hsv_t last_hsv = {0, 0, 0};
+    static rgb_t last_rgb = {0, 0, 0};
+
+    if (hsv.h != last_hsv.h || hsv.s != last_hsv.s || hsv.v != last_hsv.v) {
+        last_hsv = hsv;
+        last_rgb = rgb_matrix_hsv_to_rgb(hsv);
+    }
+    return last_rgb;
+}
+
+/**
+ * @brief Sets the colour of the LEDs with the given flags, in the range being rendered, with an animation.
+ *
+ * Only the LEDs with one of the requested flags are visited, from the lists built by
+ * rgb_matrix_layer_helper_build_index(). Each LED is still checked for the rest of the flags, so any combination
+ * works, and a combination with no indexed flag falls back to scanning the range.
+ *
+ * @param hue hue of the colour
+ * @param sat saturation of the colour
+ * @param val brightness of the colour, capped to the RGB Matrix brightness
+ * @param mode 0 for solid, 1 for breathing, 2 for rainbow mood, 3 for rainbow swirl, 4 for snek
+ * @param speed animation speed
+ * @param led_type LED flags to match
+ * @param led_min first LED to render
+ * @param led_max LED after the last one to render
+ */
+void rgb_matrix_layer_helper(uint8_t hue, uint8_t sat, uint8_t val, uint8_t mode, uint8_t speed, uint8_t led_type,
+                             uint8_t led_min, uint8_t led_max) {
+    hsv_t    hsv     = {hue, sat, val};
+    uint8_t  time    = scale16by8(g_rgb_timer, qadd8(speed / 4, 1));
+    uint16_t first   = led_min, last = led_max;
+    bool     indexed = false;
+
+    if (hsv.v > rgb_matrix_get_val()) {
+        hsv.v = rgb_matrix_get_val();
+    }
+
+    if (!led_flag_index_valid) {
+        rgb_matrix_layer_helper_build_index();
+    }
+    // Walk the shortest list among the requested flags
+    for (uint8_t flag = 0; flag < ARRAY_SIZE(led_flag_index_flags); flag++) {
+        if (led_type & led_flag_indexed & led_flag_index_flags[flag]) {
+            uint16_t list_first = led_flag_lower_bound(led_flag_start[flag], led_flag_start[flag + 1], led_min);
+            uint16_t list_last  = led_flag_lower_bound(list_first, led_flag_start[flag + 1], led_max);
+            if (!indexed || list_last - list_first < last - first) {
+                first   = list_first;
+                last    = list_last;
+                indexed = true;
+            }
+        }
+    }
+
+    switch (mode) {
+        case 1: // breathing
+            hsv.v = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
+            break;
+        case 2: // Rainbow Mood
+            hsv.h = time;
+            break;
+    }
+    rgb_t   rgb    = mode < 3 ? layer_helper_hsv_to_rgb(hsv) : (rgb_t){0, 0, 0};
+    int16_t last_x = -1;
+
+    for (uint16_t n = first; n < last; n++) {
+        uint8_t i = indexed ? led_flag_leds[n] : n;
+        if (!HAS_FLAGS(g_led_config.flags[i], led_type)) {
+            continue;
+        }
+        // The swirl and snek colours only depend on the column, so LEDs in the same column share a conversion
+        if (mode >= 3 && g_led_config.point[i].x != last_x) {
+            last_x = g_led_config.point[i].x;
+            if (mode == 3) { // Rainbow Swirl
+                rgb = rgb_matrix_hsv_to_rgb((hsv_t){last_x - time, hsv.s, hsv.v});
+            } else { // Snek
+                int16_t v = hsv.v - abs(scale8(last_x, 228) + 28 - time) * 8;
+                rgb       = rgb_matrix_hsv_to_rgb((hsv_t){hsv.h, hsv.s, scale8(v < 0 ? 0 : v, hsv.v)});
+            }
+        }
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+}
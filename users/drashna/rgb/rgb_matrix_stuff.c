@@ -9,73 +9,11 @@
 #include "rgb_matrix.h"
 #include "debug.h"
 #include <ctype.h>
-#include "lib/lib8tion/lib8tion.h"
 #ifdef RGBLIGHT_ENABLE
 #    include "rgblight.h"
 #endif
 
-extern led_config_t g_led_config;
-
 static uint32_t hypno_timer;
-rgb_t           rgb_matrix_hsv_to_rgb(hsv_t hsv);
-
-void rgb_matrix_layer_helper(uint8_t hue, uint8_t sat, uint8_t val, uint8_t mode, uint8_t speed, uint8_t led_type,
-                             uint8_t led_min, uint8_t led_max) {
-    hsv_t   hsv  = {hue, sat, val};
-    rgb_t   rgb  = {0};
-    uint8_t time = scale16by8(g_rgb_timer, qadd8(speed / 4, 1));
-    if (hsv.v > rgb_matrix_get_val()) {
-        hsv.v = rgb_matrix_get_val();
-    }
-
-    switch (mode) {
-        case 1: // breathing
-            for (uint8_t i = led_min; i < led_max; i++) {
-                if (HAS_FLAGS(g_led_config.flags[i], led_type)) {
-                    hsv.v     = scale8(abs8(sin8(time) - 128) * 2, hsv.v);
-                    rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-                    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
-                }
-            }
-            break;
-        case 2: // Rainbow Mood
-            for (uint8_t i = led_min; i < led_max; i++) {
-                hsv.h = time;
-                if (HAS_FLAGS(g_led_config.flags[i], led_type)) {
-                    rgb = rgb_matrix_hsv_to_rgb(hsv);
-                    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
-                }
-            }
-            break;
-        case 3: // Rainbow Swirl
-            for (uint8_t i = led_min; i < led_max; i++) {
-                if (HAS_FLAGS(g_led_config.flags[i], led_type)) {
-                    hsv.h = g_led_config.point[i].x - time;
-                    rgb   = rgb_matrix_hsv_to_rgb(hsv);
-                    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
-                }
-            }
-            break;
-        case 4: // Snek
-            for (uint8_t i = led_min; i < led_max; i++) {
-                if (HAS_FLAGS(g_led_config.flags[i], led_type)) {
-                    int16_t v = hsv.v - abs(scale8(g_led_config.point[i].x, 228) + 28 - time) * 8;
-                    hsv.v     = scale8(v < 0 ? 0 : v, hsv.v);
-                    rgb       = rgb_matrix_hsv_to_rgb(hsv);
-                    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
-                }
-            }
-            break;
-        default: // Solid Color
-            for (uint8_t i = led_min; i < led_max; i++) {
-                if (HAS_FLAGS(g_led_config.flags[i], led_type)) {
-                    rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-                    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
-                }
-            }
-            break;
-    }
-}
 
 void housekeeping_task_rgb_matrix(void) {
 #if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS)
@@ -349,7 +287,7 @@ void rgb_matrix_idle_anim_toggle(void) {
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS)
     userspace_config.rgb.idle_anim ^= 1;
     dprintf("RGB Matrix Idle Animation [EEPROM]: %u\n", userspace_config.rgb.idle_anim);
-    eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+    userspace_config_mark_dirty();
     if (userspace_config.rgb.idle_anim) {
         rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
     }
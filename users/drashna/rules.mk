@@ -3,7 +3,9 @@ SRC += $(USER_PATH)/drashna.c \
         $(USER_PATH)/keyrecords/process_records.c \
         $(USER_PATH)/keyrecords/tapping.c \
         $(USER_PATH)/drashna_names.c \
-        $(USER_PATH)/drashna_util.c
+        $(USER_PATH)/drashna_util.c \
+        $(USER_PATH)/drashna_eeconfig.c \
+        $(USER_PATH)/drashna_crc.c
 
 # TOP_SYMBOLS = yes
 
@@ -55,14 +57,30 @@ ifeq ($(strip $(CUSTOM_BOOTMAGIC_ENABLE)), yes)
 endif
 
 ifeq ($(strip $(WPM_ENABLE)), yes)
-    SRC += $(USER_PATH)/wpm.c
+    SRC += $(USER_PATH)/wpm.c \
+            $(USER_PATH)/wpm_stats.c
 endif
 
 ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
     SRC += $(USER_PATH)/autocorrect.c
+    ifeq ($(strip $(AUTOCORRECT_DAWG_ENABLE)), yes)
+        # The core still builds its trie from autocorrect_data.h, and only LTO can see that
+        # process_autocorrect_user() makes it unreachable and drop it, so it needs LTO to not flash both.
+        ifeq ($(strip $(LTO_SUPPORTED)), no)
+            $(error AUTOCORRECT_DAWG_ENABLE needs LTO, which this keyboard does not support)
+        endif
+        LTO_ENABLE := yes
+        OPT_DEFS += -DAUTOCORRECT_DAWG_ENABLE
+        SRC += $(USER_PATH)/autocorrect/autocorrect_dawg.c
+    endif
 endif
 
 ifeq ($(strip $(HARDWARE_DEBUG_ENABLE)), yes)
+    ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
+        ifeq ($(strip $(AUTOCORRECT_DAWG_ENABLE)), yes)
+            $(error AUTOCORRECT_DAWG_ENABLE needs LTO, which HARDWARE_DEBUG_ENABLE turns off)
+        endif
+    endif
     LTO_ENABLE := no
     OPT := 0
     OPT_DEFS += -g
@@ -75,7 +93,8 @@ ifeq ($(strip $(HEAVY_OPTIMIZATION_ENABLE)), yes)
                 -fno-common -fomit-frame-pointer -fno-exceptions -fno-unwind-tables
 endif
 
-SRC += $(USER_PATH)/sendchar.c
+SRC += $(USER_PATH)/sendchar.c \
+        $(USER_PATH)/console_ring.c
 
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     DEBUG_MATRIX_SCAN_RATE_ENABLE := no
@@ -88,5 +107,11 @@ include $(USER_PATH)/split/split.mk
 include $(USER_PATH)/rgb/rgb.mk
 include $(USER_PATH)/keyrecords/keyrecords.mk
 include $(USER_PATH)/features/common.mk
+
+# opt in per keyboard, as it takes CONFIG_JOURNAL_SIZE bytes of EEPROM on top of the legacy config block
+ifeq ($(strip $(CONFIG_JOURNAL_ENABLE)), yes)
+    OPT_DEFS += -DCONFIG_JOURNAL_ENABLE
+    SRC += $(USER_PATH)/config_journal.c
+endif
 # Ignore if not found
 -include $(KEYMAP_PATH)/post_rules.mk
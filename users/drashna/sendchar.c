@@ -3,6 +3,8 @@
 
 #include "print.h"
 #include "timer.h"
+#include "sendchar.h"
+#include "console_ring.h"
 
 #ifdef SEGGER_RTT_ENABLE
 #    include "SEGGER_RTT.h"
@@ -10,24 +12,108 @@
 #ifdef VIRTSER_ENABLE
 #    include "virtser.h"
 #endif // VIRTSER_ENABLE
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+#    include "display/painter/painter_damage.h"
+#endif // DISPLAY_DRIVER_ENABLE && CUSTOM_QUANTUM_PAINTER_ENABLE
+
+#ifndef CONSOLE_SINK_CHUNK_SIZE
+#    define CONSOLE_SINK_CHUNK_SIZE 64
+#endif // CONSOLE_SINK_CHUNK_SIZE
 
 uint32_t sendchar_timer = 0;
 
+/**
+ * @brief Captures a character of console output. This only adds it to the console ring, and the sinks are fed from
+ * it by housekeeping_task_sendchar(), so printing costs the same however many sinks are enabled.
+ *
+ * @param c character to print
+ * @return int8_t always 0, as the character can't fail to be captured
+ */
 int8_t drashna_sendchar(uint8_t c) {
-    uint8_t ret    = 0;
     sendchar_timer = timer_read32();
+    console_ring_write(c);
+    return 0;
+}
 
+static uint16_t console_sink_usb(const uint8_t *data, uint16_t size) {
     extern int8_t sendchar(uint8_t c);
-    ret = sendchar(c);
+    for (uint16_t i = 0; i < size; i++) {
+        if (sendchar(data[i])) {
+            return i;
+        }
+    }
+    return size;
+}
+
+#ifdef SEGGER_RTT_ENABLE
+static uint16_t console_sink_segger_rtt(const uint8_t *data, uint16_t size) {
+    return SEGGER_RTT_Write(0, data, size);
+}
+#endif // SEGGER_RTT_ENABLE
+
+#ifdef VIRTSER_ENABLE
+static uint16_t console_sink_virtser(const uint8_t *data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        virtser_send(data[i]);
+    }
+    return size;
+}
+#endif // VIRTSER_ENABLE
+
+typedef struct console_sink_t {
+    uint16_t (*write)(const uint8_t *data, uint16_t size); // returns how much was taken, less if the endpoint is busy
+    console_ring_reader_t reader;
+} console_sink_t;
+
+static console_sink_t sinks[CONSOLE_SINK_COUNT] = {
+    [CONSOLE_SINK_USB] = {.write = console_sink_usb},
 #ifdef SEGGER_RTT_ENABLE
-    ret = SEGGER_RTT_PutChar(0, (char)c);
+    [CONSOLE_SINK_SEGGER_RTT] = {.write = console_sink_segger_rtt},
 #endif // SEGGER_RTT_ENABLE
 #ifdef VIRTSER_ENABLE
-    virtser_send(c);
+    [CONSOLE_SINK_VIRTSER] = {.write = console_sink_virtser},
 #endif // VIRTSER_ENABLE
+};
+
+/**
+ * @brief Feeds each console sink everything it hasn't seen yet, in chunks of CONSOLE_SINK_CHUNK_SIZE, until the ring
+ * is empty or the sink's endpoint is busy, and lets the display know when there is new output. A busy sink picks up
+ * where it stopped next time, so output is only dropped if a sink falls a whole ring behind.
+ */
+void housekeeping_task_sendchar(void) {
+    uint8_t buffer[CONSOLE_SINK_CHUNK_SIZE];
+
+    for (uint8_t i = 0; i < CONSOLE_SINK_COUNT; i++) {
+        uint16_t size;
+        while ((size = console_ring_read(&sinks[i].reader, buffer, sizeof(buffer)))) {
+            uint16_t taken = sinks[i].write(buffer, size);
+            if (taken < size) {
+                console_ring_unread(&sinks[i].reader, size - taken);
+                break;
+            }
+        }
+    }
+
 #if defined(DISPLAY_DRIVER_ENABLE)
-    void display_sendchar_hook(uint8_t c);
-    display_sendchar_hook(c);
+    extern bool     console_log_needs_redraw, console_has_redrawn;
+    static uint16_t last_head = 0;
+    if (last_head != console_ring_head()) {
+        last_head                = console_ring_head();
+        console_log_needs_redraw = true;
+        console_has_redrawn      = false;
+#    if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+        painter_damage_mark(PAINTER_DAMAGE_CONSOLE);
+#    endif // CUSTOM_QUANTUM_PAINTER_ENABLE
+    }
 #endif // DISPLAY_DRIVER_ENABLE
-    return ret;
+}
+
+/**
+ * @brief Gets the number of bytes a console sink has missed, because it fell a whole console ring behind.
+ *
+ * @param sink sink to check
+ * @return uint32_t number of bytes dropped
+ */
+uint32_t console_sink_get_dropped(console_sink_id_t sink) {
+    return sinks[sink].reader.dropped;
 }
@@ -1,10 +1,25 @@
 // Copyright 2023 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#pragma once
+
 #include <stdint.h>
 #ifdef __AVR__
 #    include_next "sendchar.h"
 #endif
 
+typedef enum console_sink_id_t {
+    CONSOLE_SINK_USB = 0,
+#ifdef SEGGER_RTT_ENABLE
+    CONSOLE_SINK_SEGGER_RTT,
+#endif // SEGGER_RTT_ENABLE
+#ifdef VIRTSER_ENABLE
+    CONSOLE_SINK_VIRTSER,
+#endif // VIRTSER_ENABLE
+    CONSOLE_SINK_COUNT,
+} console_sink_id_t;
+
 extern uint32_t sendchar_timer;
 int8_t          drashna_sendchar(uint8_t c);
+void            housekeeping_task_sendchar(void);
+uint32_t        console_sink_get_dropped(console_sink_id_t sink);
@@ -0,0 +1,259 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host round trip test for delta_sync.c.
+ *
+ * Mutates objects of every size at random, a few bytes, a run, or everything at once, and sends each change through
+ * delta_sync_encode() and delta_sync_apply() the way transport_sync.c does: the receiver applies the frame, and the
+ * sender applies the same frame to its own shadow once it has been delivered. Both shadows have to match the live
+ * object after every frame. Frames are dropped now and then, which the receiver has to answer with
+ * DELTA_SYNC_NEEDS_FULL until a resync, and truncated or corrupted frames have to be rejected without touching the
+ * shadow. The checksum is checked against a plain Fletcher-16.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o delta_sync_test -Iusers/drashna/bench/qmk -Iusers/drashna/split \
+ *         users/drashna/split/bench/delta_sync_test.c users/drashna/split/delta_sync.c
+ *     ./delta_sync_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "delta_sync.h"
+
+#define TEST_ROUNDS      20
+#define TEST_FRAMES      300
+#define TEST_BUFFER_SIZE 127 // RPC_M2S_BUFFER_SIZE, less the frame size byte
+
+typedef struct test_object_t {
+    uint8_t             live[255], sender_shadow[255], receiver_shadow[255];
+    delta_sync_object_t sender, receiver;
+} test_object_t;
+
+static uint32_t delta_frames, full_frames, delta_bytes, full_bytes;
+
+static void mutate(uint8_t *data, uint8_t size) {
+    switch (rand() % 4) {
+        case 0: // one byte
+            data[rand() % size] = rand();
+            break;
+        case 1: { // a few scattered bytes
+            uint8_t count = 1 + rand() % 4;
+            for (uint8_t i = 0; i < count; i++) {
+                data[rand() % size] ^= 1 + rand() % 255;
+            }
+            break;
+        }
+        case 2: { // a run
+            uint8_t start = rand() % size, length = 1 + rand() % (size - start);
+            for (uint8_t i = 0; i < length; i++) {
+                data[start + i] = rand();
+            }
+            break;
+        }
+        default: // everything
+            for (uint8_t i = 0; i < size; i++) {
+                data[i] = rand();
+            }
+            break;
+    }
+}
+
+static bool shadows_match(const test_object_t *object, const char *what, uint8_t size, uint16_t frame) {
+    if (memcmp(object->live, object->sender_shadow, size) != 0 ||
+        memcmp(object->live, object->receiver_shadow, size) != 0) {
+        printf("size %u, frame %u: the shadows don't match the object after %s\n", size, frame, what);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that every truncation of a frame, and a frame with its runs corrupted, is rejected without changing
+ * the receiver's shadow or sequence.
+ */
+static bool rejects_broken_frames(test_object_t *object, const uint8_t *frame, uint8_t length) {
+    uint8_t shadow[255], seq = object->receiver.seq, broken[TEST_BUFFER_SIZE];
+
+    memcpy(shadow, object->receiver_shadow, object->receiver.size);
+    for (uint8_t size = 0; size < length; size++) {
+        delta_sync_status_t status = delta_sync_apply(&object->receiver, frame, size);
+        // A delta cut at a run boundary is still a valid frame, with fewer runs
+        if (status == DELTA_SYNC_OK) {
+            if (frame[1] & DELTA_SYNC_FLAG_FULL) {
+                printf("a full frame truncated to %u of %u bytes was accepted\n", size, length);
+                return false;
+            }
+            memcpy(object->receiver_shadow, shadow, object->receiver.size);
+            object->receiver.seq = seq;
+            continue;
+        }
+        if (memcmp(shadow, object->receiver_shadow, object->receiver.size) != 0 || object->receiver.seq != seq) {
+            printf("a frame truncated to %u of %u bytes changed the shadow\n", size, length);
+            return false;
+        }
+    }
+    if (!(frame[1] & DELTA_SYNC_FLAG_FULL)) {
+        // A run past the end of the object
+        memcpy(broken, frame, length);
+        broken[DELTA_SYNC_OVERHEAD] = object->receiver.size;
+        if (delta_sync_apply(&object->receiver, broken, length) != DELTA_SYNC_INVALID ||
+            memcmp(shadow, object->receiver_shadow, object->receiver.size) != 0) {
+            printf("a run past the end of the object wasn't rejected\n");
+            return false;
+        }
+        // A zero length run
+        broken[DELTA_SYNC_OVERHEAD]     = frame[DELTA_SYNC_OVERHEAD];
+        broken[DELTA_SYNC_OVERHEAD + 1] = 0;
+        if (delta_sync_apply(&object->receiver, broken, length) != DELTA_SYNC_INVALID) {
+            printf("a zero length run wasn't rejected\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_object(test_object_t *object, uint8_t size) {
+    uint8_t frame[TEST_BUFFER_SIZE];
+    bool    dropped = false;
+
+    memset(object, 0, sizeof(*object));
+    for (uint8_t i = 0; i < size; i++) {
+        object->live[i] = rand();
+    }
+    object->sender   = (delta_sync_object_t){.data = object->live, .shadow = object->sender_shadow, .size = size};
+    object->receiver = (delta_sync_object_t){.shadow = object->receiver_shadow, .size = size};
+
+    for (uint16_t count = 0; count < TEST_FRAMES; count++) {
+        if (count) {
+            mutate(object->live, size);
+        }
+        if (!delta_sync_is_dirty(&object->sender)) {
+            continue;
+        }
+
+        uint8_t length = delta_sync_encode(&object->sender, frame, sizeof(frame));
+        if (length == 0) {
+            if (size + DELTA_SYNC_OVERHEAD <= sizeof(frame)) {
+                printf("size %u, frame %u: a dirty object that fits wasn't encoded\n", size, count);
+                return false;
+            }
+            // Too big for a full frame, which transport_sync.c never registers
+            return true;
+        }
+        if (frame[1] & DELTA_SYNC_FLAG_FULL) {
+            full_frames++;
+            full_bytes += length;
+        } else {
+            delta_frames++;
+            delta_bytes += length;
+            if (length >= size + DELTA_SYNC_OVERHEAD) {
+                printf("size %u, frame %u: a delta of %u bytes is no smaller than the object\n", size, count, length);
+                return false;
+            }
+        }
+
+        if (count % 17 == 5) {
+            // The transaction got through, but the other half didn't take it
+            if (!rejects_broken_frames(object, frame, length)) {
+                return false;
+            }
+            dropped = true;
+        } else {
+            delta_sync_status_t status = delta_sync_apply(&object->receiver, frame, length);
+            if (dropped && !(frame[1] & DELTA_SYNC_FLAG_FULL)) {
+                if (status != DELTA_SYNC_NEEDS_FULL) {
+                    printf("size %u, frame %u: a delta after a lost frame wasn't refused\n", size, count);
+                    return false;
+                }
+                // The ack asks for a resync, which is sent on the next frame
+                delta_sync_apply(&object->sender, frame, length);
+                object->sender.needs_full = true;
+                continue;
+            }
+            if (status != DELTA_SYNC_OK) {
+                printf("size %u, frame %u: the frame was refused (%u)\n", size, count, status);
+                return false;
+            }
+            dropped = false;
+        }
+        delta_sync_apply(&object->sender, frame, length);
+        if (!dropped && !shadows_match(object, "a frame", size, count)) {
+            return false;
+        }
+    }
+
+    // Resync, as the heartbeat does when the checksums don't match
+    object->sender.needs_full = true;
+    uint8_t length            = delta_sync_encode(&object->sender, frame, sizeof(frame));
+    if (!(frame[1] & DELTA_SYNC_FLAG_FULL) || delta_sync_apply(&object->receiver, frame, length) != DELTA_SYNC_OK) {
+        printf("size %u: the resync wasn't a full frame the receiver took\n", size);
+        return false;
+    }
+    delta_sync_apply(&object->sender, frame, length);
+    if (!shadows_match(object, "the resync", size, TEST_FRAMES) ||
+        delta_sync_checksum(object->sender_shadow, size) != delta_sync_checksum(object->receiver_shadow, size) ||
+        object->sender.seq != object->receiver.seq) {
+        printf("size %u: the heartbeat wouldn't match after the resync\n", size);
+        return false;
+    }
+    return true;
+}
+
+static uint16_t reference_fletcher16(const uint8_t *data, uint16_t size) {
+    uint32_t sum1 = 0, sum2 = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        sum1 += data[i];
+        sum2 += sum1;
+    }
+    return (sum2 % 255) << 8 | (sum1 % 255);
+}
+
+static bool test_checksum(void) {
+    uint8_t data[1024];
+
+    for (uint16_t round = 0; round < 2000; round++) {
+        uint16_t size = rand() % sizeof(data);
+        for (uint16_t i = 0; i < size; i++) {
+            data[i] = round % 3 == 0 ? 0xFF : rand();
+        }
+        uint16_t checksum = delta_sync_checksum(data, size);
+        if (checksum != reference_fletcher16(data, size)) {
+            printf("checksum of %u bytes doesn't match Fletcher-16\n", size);
+            return false;
+        }
+        if (size > 0) {
+            uint16_t index = rand() % size;
+            data[index] ^= 1 + rand() % 254;
+            if (delta_sync_checksum(data, size) == checksum) {
+                printf("checksum of %u bytes missed a changed byte\n", size);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    static test_object_t object;
+
+    srand(1337);
+    for (uint16_t round = 0; round < TEST_ROUNDS; round++) {
+        for (uint16_t size = 1; size <= TEST_BUFFER_SIZE - DELTA_SYNC_OVERHEAD; size++) {
+            if (!test_object(&object, size)) {
+                printf("FAILED\n");
+                return 1;
+            }
+        }
+    }
+    if (!test_checksum()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("%u delta frames, %.1f bytes each, and %u full frames, %.1f bytes each\n", delta_frames,
+           (double)delta_bytes / delta_frames, full_frames, (double)full_bytes / full_frames);
+    printf("all round trips, resyncs and checksums match\n");
+    return 0;
+}
@@ -0,0 +1,621 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host test for the split sync scheduler and its TLV frames.
+ *
+ * Packs payloads of mixed sizes into frames of SPLIT_SYNC_FRAME_SIZE, RPC_M2S_BUFFER_SIZE less the frame's size
+ * byte, and reads them back. Every prefix of a frame that cuts a payload short, and a payload whose size runs past
+ * the end of the frame, have to be rejected, with the payloads before it still read.
+ *
+ * Then it queues keys with random priorities and payload sizes, and runs split_sync_task() against a flush that
+ * parses every frame and sometimes fails. Every queued key has to arrive, once per time it was queued and not
+ * coalesced, within the per tick budget, high priority first, and a failed frame has to be sent again.
+ *
+ * Last, it replays a scripted minute of use, through delta synced objects laid out like the ones transport_sync.c
+ * sends: typing with layer changes, caps word, the host suspending and waking, the RTC ticking, the keymap and
+ * debug config being toggled, and the heartbeat. It is replayed once sending each object in its own transaction as
+ * soon as it changes, the way the extended messages used to be sent, and once through split_sync_task(), and the
+ * frames and bytes of both are reported. Both have to leave the other half with the same objects.
+ *
+ * From the root of the userspace:
+ *
+ *     cc -O2 -o sync_scheduler_test -Iusers/drashna/bench/qmk -Iusers/drashna/split -DRPC_M2S_BUFFER_SIZE=128 \
+ *         users/drashna/split/bench/sync_scheduler_test.c users/drashna/split/sync_scheduler.c \
+ *         users/drashna/split/delta_sync.c
+ *     ./sync_scheduler_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "delta_sync.h"
+#include "sync_scheduler.h"
+#include "timer.h"
+
+#define TEST_ROUNDS 20000
+#define TEST_TICKS  4000 // short enough that the 16 bit stats don't wrap
+#define TEST_KEYS   12
+
+static uint16_t now;
+
+uint16_t timer_read(void) {
+    return now;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return now - last;
+}
+
+/*
+ * TLV frames
+ */
+
+static bool test_tlv(void) {
+    uint8_t frame[SPLIT_SYNC_FRAME_SIZE], payload[SPLIT_SYNC_FRAME_SIZE];
+    uint8_t ids[SPLIT_SYNC_FRAME_SIZE], sizes[SPLIT_SYNC_FRAME_SIZE], offsets[SPLIT_SYNC_FRAME_SIZE];
+
+    for (uint16_t round = 0; round < TEST_ROUNDS; round++) {
+        uint8_t length = 0, count = 0;
+
+        // Mixed sizes, from empty to a payload that fills the whole frame on its own
+        while (true) {
+            uint8_t largest = SPLIT_SYNC_FRAME_SIZE - SPLIT_SYNC_TLV_OVERHEAD;
+            uint8_t size    = rand() % 4 == 0 ? rand() % (largest + 1) : rand() % 12;
+            uint8_t id      = rand();
+            uint8_t space   = sizeof(frame) - length, packed = 0;
+            for (uint8_t i = 0; i < size; i++) {
+                payload[i] = id + i;
+            }
+            split_sync_pack_result_t result = split_sync_tlv_pack(id, payload, size, &frame[length], space, &packed);
+            if (SPLIT_SYNC_TLV_OVERHEAD + size > space) {
+                if (result != SPLIT_SYNC_NO_ROOM) {
+                    printf("a %u byte payload was packed into %u bytes\n", size, space);
+                    return false;
+                }
+                if (space < SPLIT_SYNC_TLV_OVERHEAD || rand() % 3 == 0) {
+                    break;
+                }
+                continue;
+            }
+            if (result != SPLIT_SYNC_PACKED || packed != SPLIT_SYNC_TLV_OVERHEAD + size) {
+                printf("a %u byte payload didn't pack into %u bytes\n", size, space);
+                return false;
+            }
+            ids[count]       = id;
+            sizes[count]     = size;
+            offsets[count++] = length;
+            length += packed;
+        }
+
+        // Every prefix: whole payloads read back, and one cut short is rejected
+        for (uint16_t cut = 0; cut <= length; cut++) {
+            const uint8_t          *data;
+            uint8_t                 pos = 0, id, size, read = 0;
+            split_sync_tlv_status_t status;
+
+            while ((status = split_sync_tlv_next(frame, cut, &pos, &id, &data, &size)) == SPLIT_SYNC_TLV_OK) {
+                if (read >= count || id != ids[read] || size != sizes[read] ||
+                    data != &frame[offsets[read] + SPLIT_SYNC_TLV_OVERHEAD]) {
+                    printf("payload %u of a %u byte frame cut to %u doesn't match\n", read, length, cut);
+                    return false;
+                }
+                for (uint8_t i = 0; i < size; i++) {
+                    if (data[i] != (uint8_t)(id + i)) {
+                        printf("payload %u of a %u byte frame has the wrong data\n", read, length);
+                        return false;
+                    }
+                }
+                read++;
+            }
+            bool on_boundary = cut == length;
+            for (uint8_t i = 0; i < count; i++) {
+                on_boundary |= cut == offsets[i];
+            }
+            if (status != (on_boundary ? SPLIT_SYNC_TLV_END : SPLIT_SYNC_TLV_INVALID)) {
+                printf("a %u byte frame cut to %u wasn't %s\n", length, cut, on_boundary ? "read" : "rejected");
+                return false;
+            }
+        }
+
+        // A size that runs past the end of the frame
+        if (count > 0) {
+            uint8_t         last = offsets[count - 1], saved = frame[last + 1], pos = 0, id, size;
+            const uint8_t  *data;
+            frame[last + 1] = length - last - SPLIT_SYNC_TLV_OVERHEAD + 1 + rand() % 8;
+            while (split_sync_tlv_next(frame, length, &pos, &id, &data, &size) == SPLIT_SYNC_TLV_OK) {
+            }
+            if (pos != last || split_sync_tlv_next(frame, length, &pos, &id, &data, &size) != SPLIT_SYNC_TLV_INVALID) {
+                printf("an overlong payload at %u of a %u byte frame wasn't rejected\n", last, length);
+                return false;
+            }
+            frame[last + 1] = saved;
+        }
+    }
+    return true;
+}
+
+/*
+ * Scheduler
+ */
+
+static uint8_t  payload_sizes[TEST_KEYS];
+static uint8_t  priorities[TEST_KEYS];
+static uint16_t enqueued[TEST_KEYS], queued[TEST_KEYS], delivered[TEST_KEYS];
+static uint16_t frames_this_tick, bytes_this_tick;
+static bool     fail_next_flush;
+
+/**
+ * @brief The priority the scheduler should send a key with, raised to high once it has waited too long.
+ */
+static uint8_t effective_priority(uint8_t key) {
+    return (uint16_t)(now - enqueued[key]) > SPLIT_SYNC_STARVATION_MS ? SPLIT_SYNC_PRIORITY_HIGH : priorities[key];
+}
+
+static split_sync_pack_result_t pack(uint8_t key, uint8_t *buffer, uint8_t buffer_size, uint8_t *size) {
+    uint8_t payload[SPLIT_SYNC_FRAME_SIZE];
+    memset(payload, key, payload_sizes[key]);
+    return split_sync_tlv_pack(key, payload, payload_sizes[key], buffer, buffer_size, size);
+}
+
+static bool flush(const uint8_t *frame, uint8_t size) {
+    const uint8_t          *data;
+    uint8_t                 pos = 0, key, length, best = SPLIT_SYNC_PRIORITY_HIGH;
+    split_sync_tlv_status_t status;
+
+    if (size > SPLIT_SYNC_FRAME_SIZE) {
+        printf("a %u byte frame is larger than %u\n", size, SPLIT_SYNC_FRAME_SIZE);
+        exit(1);
+    }
+    frames_this_tick++;
+    bytes_this_tick += size;
+    if (fail_next_flush) {
+        fail_next_flush = false;
+        return false;
+    }
+    while ((status = split_sync_tlv_next(frame, size, &pos, &key, &data, &length)) == SPLIT_SYNC_TLV_OK) {
+        if (key >= TEST_KEYS || length != payload_sizes[key] || (length && data[0] != key)) {
+            printf("frame holds a bad payload for key %u\n", key);
+            exit(1);
+        }
+        // The first payload in a frame is the most urgent one queued, the rest only fill the space left
+        if (pos == SPLIT_SYNC_TLV_OVERHEAD + length) {
+            best = effective_priority(key);
+        } else if (effective_priority(key) < best) {
+            printf("key %u at priority %u was packed after priority %u\n", key, priorities[key], best);
+            exit(1);
+        }
+        delivered[key]++;
+    }
+    if (status != SPLIT_SYNC_TLV_END) {
+        printf("the scheduler sent a malformed frame\n");
+        exit(1);
+    }
+    return true;
+}
+
+static bool test_scheduler(void) {
+    bool     pending[TEST_KEYS] = {0};
+    uint16_t coalesced          = 0;
+
+    for (uint8_t key = 0; key < TEST_KEYS; key++) {
+        split_sync_register(key, pack);
+    }
+    split_sync_set_flush(flush);
+
+    for (uint16_t tick = 0; tick < TEST_TICKS; tick++) {
+        uint8_t count = rand() % (TEST_KEYS + 1);
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t key = rand() % TEST_KEYS;
+            uint8_t priority = rand() % 3;
+            if (pending[key]) {
+                // Merged into the queued payload, which goes out at the more urgent of the two priorities
+                coalesced++;
+                if (priority < priorities[key]) {
+                    priorities[key] = priority;
+                }
+            } else {
+                // Up to the largest payload that fits in a frame on its own
+                payload_sizes[key] = rand() % 8 == 0 ? 40 + rand() % (SPLIT_SYNC_FRAME_SIZE - 40 - 1) : rand() % 24;
+                priorities[key]    = priority;
+                enqueued[key]      = now;
+                queued[key]++;
+                pending[key] = true;
+            }
+            split_sync_enqueue(key, priority);
+        }
+
+        fail_next_flush  = rand() % 10 == 0;
+        frames_this_tick = bytes_this_tick = 0;
+        now += 1;
+        split_sync_task();
+        if (frames_this_tick > SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK ||
+            bytes_this_tick >= SPLIT_SYNC_MAX_BYTES_PER_TICK + SPLIT_SYNC_FRAME_SIZE) {
+            printf("one tick sent %u frames, %u bytes\n", frames_this_tick, bytes_this_tick);
+            return false;
+        }
+        for (uint8_t key = 0; key < TEST_KEYS; key++) {
+            pending[key] = delivered[key] < queued[key];
+        }
+    }
+
+    // Drain what's left
+    for (uint16_t tick = 0; tick < 1000; tick++) {
+        now += 1;
+        split_sync_task();
+    }
+
+    const split_sync_stats_t *stats = split_sync_get_stats();
+    for (uint8_t key = 0; key < TEST_KEYS; key++) {
+        if (delivered[key] != queued[key]) {
+            printf("key %u was queued %u times, but delivered %u times\n", key, queued[key], delivered[key]);
+            return false;
+        }
+    }
+    if (stats->depth != 0 || stats->coalesced != coalesced || stats->dropped != 0) {
+        printf("stats: depth %u, coalesced %u of %u, dropped %u\n", stats->depth, stats->coalesced, coalesced,
+               stats->dropped);
+        return false;
+    }
+
+    // A payload too big for any frame is dropped, rather than holding up the queue
+    payload_sizes[0] = SPLIT_SYNC_FRAME_SIZE;
+    payload_sizes[1] = 4;
+    priorities[0]    = SPLIT_SYNC_PRIORITY_HIGH;
+    priorities[1]    = SPLIT_SYNC_PRIORITY_LOW;
+    enqueued[0] = enqueued[1] = now;
+    queued[1]++;
+    split_sync_enqueue(0, priorities[0]);
+    split_sync_enqueue(1, priorities[1]);
+    split_sync_task();
+    if (stats->dropped != 1 || delivered[1] != queued[1] || stats->depth != 0) {
+        printf("a payload too big for a frame wasn't dropped\n");
+        return false;
+    }
+    printf("%u frames sent, %u payloads, %.1f payloads a frame, %u coalesced, %u failed\n", stats->sent,
+           stats->packed, (double)stats->packed / stats->sent, stats->coalesced, stats->failed);
+    return true;
+}
+
+/*
+ * A realistic trace
+ */
+
+#define TRACE_MS           60000
+#define TRACE_HEARTBEAT_MS 1000 // SPLIT_SYNC_HEARTBEAT_MS
+#define TRACE_LAYER_ROWS   4
+#define TRACE_LAYER_COLS   12
+#define TRACE_KEYLOG_CELLS 25
+
+// The extended ids, as transport_sync.c numbers them
+typedef enum trace_id_t {
+    TRACE_ID_KEYLOG = 2,
+    TRACE_ID_KEYMAP_CONFIG,
+    TRACE_ID_DEBUG_CONFIG,
+    TRACE_ID_USERSPACE_CONFIG,
+    TRACE_ID_RUNTIME_STATE,
+    TRACE_ID_SUSPEND_STATE,
+    TRACE_ID_RTC = 9,
+    TRACE_ID_HEARTBEAT,
+    TRACE_ID_LAYER_MAP,
+    TRACE_IDS,
+} trace_id_t;
+
+// keyevent_t
+typedef struct PACKED trace_key_event_t {
+    uint8_t  col, row, type;
+    bool     pressed;
+    uint16_t time;
+} trace_key_event_t;
+
+// userspace_runtime_state_t, as far as the trace changes it
+typedef struct PACKED trace_runtime_state_t {
+    uint8_t           audio[9];
+    uint8_t           internals; // caps word is bit 3
+    uint8_t           unicode;
+    uint8_t           menu_state[11];
+    uint8_t           pointing;
+    uint16_t          wpm;
+    uint16_t          last_keycode;
+    trace_key_event_t last_key_event;
+} trace_runtime_state_t;
+
+// the keylogger's ring buffer, which only touches the new cell and the head on a key press
+typedef struct PACKED trace_keylog_t {
+    int32_t chars[TRACE_KEYLOG_CELLS];
+    uint8_t head;
+} trace_keylog_t;
+
+// rtc_time_t, sent whole rather than delta synced
+typedef struct PACKED trace_rtc_time_t {
+    uint8_t  second, minute, hour, day_of_week, date, month;
+    uint16_t year;
+    uint8_t  format, am_pm;
+    uint32_t unixtime;
+} trace_rtc_time_t;
+
+static struct {
+    uint16_t              keymap_config;
+    uint8_t               debug_config;
+    uint8_t               userspace_config[48];
+    trace_runtime_state_t runtime_state;
+    trace_keylog_t        keylog;
+    // rebuilt by the layer map module on every layer change, delta synced here in place of its row diffs
+    uint16_t              layer_map[TRACE_LAYER_ROWS][TRACE_LAYER_COLS];
+    trace_rtc_time_t      rtc_time;
+    bool                  suspended;
+} live, received;
+
+static const split_sync_priority_t trace_priorities[TRACE_IDS] = {
+    [TRACE_ID_KEYLOG]           = SPLIT_SYNC_PRIORITY_LOW,
+    [TRACE_ID_KEYMAP_CONFIG]    = SPLIT_SYNC_PRIORITY_NORMAL,
+    [TRACE_ID_DEBUG_CONFIG]     = SPLIT_SYNC_PRIORITY_NORMAL,
+    [TRACE_ID_USERSPACE_CONFIG] = SPLIT_SYNC_PRIORITY_NORMAL,
+    [TRACE_ID_RUNTIME_STATE]    = SPLIT_SYNC_PRIORITY_HIGH,
+    [TRACE_ID_RTC]              = SPLIT_SYNC_PRIORITY_NORMAL,
+    [TRACE_ID_HEARTBEAT]        = SPLIT_SYNC_PRIORITY_NORMAL,
+    [TRACE_ID_LAYER_MAP]        = SPLIT_SYNC_PRIORITY_NORMAL,
+};
+
+static uint8_t             sent_shadows[TRACE_IDS][SPLIT_SYNC_FRAME_SIZE];
+static delta_sync_object_t sent_objects[TRACE_IDS], received_objects[TRACE_IDS];
+static bool                rtc_needs_sync;
+
+typedef struct trace_counts_t {
+    uint32_t frames, bytes, payloads;
+} trace_counts_t;
+
+static trace_counts_t trace_counts;
+
+static void trace_reset(void) {
+    const struct {
+        trace_id_t id;
+        void      *live, *received;
+        uint8_t    size;
+    } objects[] = {
+        {TRACE_ID_KEYLOG, &live.keylog, &received.keylog, sizeof(live.keylog)},
+        {TRACE_ID_KEYMAP_CONFIG, &live.keymap_config, &received.keymap_config, sizeof(live.keymap_config)},
+        {TRACE_ID_DEBUG_CONFIG, &live.debug_config, &received.debug_config, sizeof(live.debug_config)},
+        {TRACE_ID_USERSPACE_CONFIG, &live.userspace_config, &received.userspace_config,
+         sizeof(live.userspace_config)},
+        {TRACE_ID_RUNTIME_STATE, &live.runtime_state, &received.runtime_state, sizeof(live.runtime_state)},
+        {TRACE_ID_LAYER_MAP, &live.layer_map, &received.layer_map, sizeof(live.layer_map)},
+    };
+
+    memset(&live, 0, sizeof(live));
+    memset(&received, 0, sizeof(received));
+    memset(sent_objects, 0, sizeof(sent_objects));
+    memset(received_objects, 0, sizeof(received_objects));
+    memset(&trace_counts, 0, sizeof(trace_counts));
+    for (uint8_t i = 0; i < sizeof(objects) / sizeof(objects[0]); i++) {
+        sent_objects[objects[i].id].data       = objects[i].live;
+        sent_objects[objects[i].id].shadow     = sent_shadows[objects[i].id];
+        sent_objects[objects[i].id].size       = objects[i].size;
+        received_objects[objects[i].id].shadow = objects[i].received;
+        received_objects[objects[i].id].size   = objects[i].size;
+    }
+    for (uint8_t i = 0; i < sizeof(live.userspace_config); i++) {
+        live.userspace_config[i] = i * 37;
+    }
+    for (uint8_t row = 0; row < TRACE_LAYER_ROWS; row++) {
+        for (uint8_t col = 0; col < TRACE_LAYER_COLS; col++) {
+            live.layer_map[row][col] = 4 + row * TRACE_LAYER_COLS + col;
+        }
+    }
+    live.keymap_config = 0x0400;
+    live.rtc_time      = (trace_rtc_time_t){.hour = 9, .date = 14, .month = 3, .year = 2025, .unixtime = 1741942800};
+    rtc_needs_sync     = true;
+}
+
+static split_sync_pack_result_t trace_pack(uint8_t key, uint8_t *buffer, uint8_t buffer_size, uint8_t *size) {
+    uint8_t payload[SPLIT_SYNC_FRAME_SIZE];
+    uint8_t payload_size = 0;
+
+    switch (key) {
+        case TRACE_ID_RTC:
+            return split_sync_tlv_pack(key, &live.rtc_time, sizeof(trace_rtc_time_t), buffer, buffer_size, size);
+        case TRACE_ID_SUSPEND_STATE:
+            return split_sync_tlv_pack(key, &live.suspended, sizeof(bool), buffer, buffer_size, size);
+        case TRACE_ID_HEARTBEAT:
+            // the sequence number and checksum of every object, as heartbeat_entry_t
+            for (uint8_t id = 0; id < TRACE_IDS; id++) {
+                if (sent_objects[id].size && sent_objects[id].has_baseline) {
+                    uint16_t checksum       = delta_sync_checksum(sent_objects[id].shadow, sent_objects[id].size);
+                    payload[payload_size++] = id;
+                    payload[payload_size++] = sent_objects[id].seq;
+                    memcpy(&payload[payload_size], &checksum, sizeof(checksum));
+                    payload_size += sizeof(checksum);
+                }
+            }
+            return split_sync_tlv_pack(key, payload, payload_size, buffer, buffer_size, size);
+        default:
+            if (!delta_sync_is_dirty(&sent_objects[key])) {
+                return SPLIT_SYNC_NOTHING_TO_SEND;
+            }
+            payload_size = delta_sync_encode(&sent_objects[key], payload, sizeof(payload) - SPLIT_SYNC_TLV_OVERHEAD);
+            return split_sync_tlv_pack(key, payload, payload_size, buffer, buffer_size, size);
+    }
+}
+
+// the other half applies every message, and the sender commits it, as send_extended_frame() does
+static bool trace_flush(const uint8_t *frame, uint8_t size) {
+    const uint8_t *data;
+    uint8_t        pos = 0, id, length;
+
+    trace_counts.frames++;
+    trace_counts.bytes += size;
+    while (split_sync_tlv_next(frame, size, &pos, &id, &data, &length) == SPLIT_SYNC_TLV_OK) {
+        trace_counts.payloads++;
+        switch (id) {
+            case TRACE_ID_RTC:
+                memcpy(&received.rtc_time, data, length);
+                rtc_needs_sync = false;
+                break;
+            case TRACE_ID_SUSPEND_STATE:
+                received.suspended = data[0];
+                break;
+            case TRACE_ID_HEARTBEAT:
+                break;
+            default:
+                if (delta_sync_apply(&received_objects[id], data, length) != DELTA_SYNC_OK ||
+                    delta_sync_apply(&sent_objects[id], data, length) != DELTA_SYNC_OK) {
+                    printf("the delta for object %u didn't apply\n", id);
+                    exit(1);
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The script: changes the live objects the way a minute of use would.
+ */
+static void trace_step(uint32_t t) {
+    static const char text[] = "The split keeps up with typing, even Fast TYPING, on every layer. ";
+    static uint16_t   key_count = 0;
+    static uint8_t    layer     = 0;
+
+    // the host suspends for five seconds
+    if (t == 20000 || t == 25000) {
+        live.suspended = t == 20000;
+    }
+    // the RTC ticks every second
+    if (t % 1000 == 0) {
+        live.rtc_time.second = (live.rtc_time.second + 1) % 60;
+        live.rtc_time.unixtime++;
+        rtc_needs_sync = true;
+    }
+    // NKRO and the debug config are toggled now and then
+    if (t == 10000 || t == 45000) {
+        live.keymap_config ^= 1 << 14;
+    }
+    if (t == 15000 || t == 50000) {
+        live.debug_config ^= 0x01;
+    }
+    // typing at about 80 WPM, a press every 150 ms and the release 60 ms later, except while suspended
+    if (live.suspended || t < 1000) {
+        return;
+    }
+    if (t % 150 == 0) {
+        char c = text[key_count++ % (sizeof(text) - 1)];
+        // a layer is held for every fifth word
+        if (c == ' ' && key_count % 5 == 0) {
+            layer = layer ? 0 : 1 + key_count % 3;
+            for (uint8_t row = 0; row < TRACE_LAYER_ROWS; row++) {
+                for (uint8_t col = 0; col < TRACE_LAYER_COLS; col++) {
+                    // a third of the keys are transparent on the other layers
+                    live.layer_map[row][col] = 4 + row * TRACE_LAYER_COLS + col + (col % 3 ? layer << 8 : 0);
+                }
+            }
+        }
+        // caps word, for the words in capitals, times out after them
+        if (c >= 'A' && c <= 'Z') {
+            live.runtime_state.internals |= 1 << 3;
+        } else if (c == ' ') {
+            live.runtime_state.internals &= ~(1 << 3);
+        }
+        live.keylog.chars[live.keylog.head] = c;
+        live.keylog.head                    = (live.keylog.head + 1) % TRACE_KEYLOG_CELLS;
+        live.runtime_state.last_keycode     = (layer << 8) | (uint8_t)c;
+        live.runtime_state.last_key_event   = (trace_key_event_t){
+              .col = c % 12, .row = c % 4, .type = 1, .pressed = true, .time = t};
+    } else if (t % 150 == 60) {
+        live.runtime_state.last_key_event.pressed = false;
+        live.runtime_state.last_key_event.time    = t;
+    }
+    // the WPM average moves with the typing
+    if (t % 1000 == 500) {
+        live.runtime_state.wpm = 70 + t / 1000 % 20;
+    }
+}
+
+/**
+ * @brief Replays the trace, queueing the objects that changed every tick, the way
+ * housekeeping_task_transport_sync() does.
+ *
+ * @param batched send through split_sync_task(), rather than each object in its own transaction when it changes
+ */
+static bool trace_replay(bool batched, trace_counts_t *counts) {
+    bool     was_suspended = false;
+    uint32_t max_frames    = 0;
+
+    for (uint8_t id = 0; id < TRACE_IDS; id++) {
+        split_sync_register(id, trace_pack);
+    }
+    split_sync_set_flush(trace_flush);
+    trace_reset();
+
+    for (uint32_t t = 0; t < TRACE_MS; t++) {
+        uint32_t frames = trace_counts.frames;
+
+        now++;
+        trace_step(t);
+        // the suspend state is sent straight away, as send_device_suspend_state() does
+        if (live.suspended != was_suspended) {
+            was_suspended = live.suspended;
+            split_sync_send_now(TRACE_ID_SUSPEND_STATE);
+        }
+        for (uint8_t id = 0; id < TRACE_IDS; id++) {
+            bool changed = (sent_objects[id].size && delta_sync_is_dirty(&sent_objects[id])) ||
+                           (id == TRACE_ID_RTC && rtc_needs_sync) ||
+                           (id == TRACE_ID_HEARTBEAT && t % TRACE_HEARTBEAT_MS == TRACE_HEARTBEAT_MS - 1);
+            if (!changed) {
+                continue;
+            }
+            if (batched) {
+                split_sync_enqueue(id, trace_priorities[id]);
+            } else {
+                split_sync_send_now(id);
+            }
+        }
+        if (batched) {
+            split_sync_task();
+        }
+        if (trace_counts.frames - frames > max_frames) {
+            max_frames = trace_counts.frames - frames;
+        }
+    }
+    // let the queue drain
+    for (uint16_t tick = 0; tick < 1000; tick++) {
+        now++;
+        split_sync_task();
+    }
+
+    if (memcmp(&live, &received, sizeof(live)) != 0) {
+        printf("the %s replay left the other half out of sync\n", batched ? "batched" : "unbatched");
+        return false;
+    }
+    if (batched && max_frames > SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK + 1) {
+        printf("a tick of the batched replay sent %u frames\n", max_frames);
+        return false;
+    }
+    *counts = trace_counts;
+    return true;
+}
+
+static bool test_trace(void) {
+    trace_counts_t single, batched;
+
+    if (!trace_replay(false, &single) || !trace_replay(true, &batched)) {
+        return false;
+    }
+    printf("%u s trace, one object a transaction: %5u frames, %6u bytes (%7u on the wire), %u payloads\n",
+           TRACE_MS / 1000, single.frames, single.bytes, single.frames * RPC_M2S_BUFFER_SIZE, single.payloads);
+    printf("%u s trace, split_sync_task():        %5u frames, %6u bytes (%7u on the wire), %u payloads\n",
+           TRACE_MS / 1000, batched.frames, batched.bytes, batched.frames * RPC_M2S_BUFFER_SIZE, batched.payloads);
+    if (batched.frames >= single.frames) {
+        printf("batching didn't save any frames\n");
+        return false;
+    }
+    return true;
+}
+
+int main(void) {
+    srand(1337);
+    if (!test_tlv() || !test_scheduler() || !test_trace()) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("all frames pack, parse and reject as expected\n");
+    return 0;
+}
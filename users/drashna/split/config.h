@@ -23,5 +23,5 @@
 #    define RPC_M2S_BUFFER_SIZE 128
 #    define RPC_S2M_BUFFER_SIZE 32
 #    undef SPLIT_OLED_ENABLE
-#    define SPLIT_TRANSACTION_IDS_USER RPC_ID_EXTENDED_SYNC_TRANSPORT, RPC_ID_LAYER_MAP_SYNC
+#    define SPLIT_TRANSACTION_IDS_USER RPC_ID_EXTENDED_SYNC_TRANSPORT
 #endif // CUSTOM_SPLIT_TRANSPORT_SYNC
@@ -0,0 +1,158 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "delta_sync.h"
+#include <string.h>
+
+/**
+ * @brief Checks if the object has anything that needs to be sent, without encoding it.
+ *
+ * @param object object to check
+ * @return true if the object has changed, or has to be sent in full
+ */
+bool delta_sync_is_dirty(const delta_sync_object_t *object) {
+    return !object->has_baseline || object->needs_full || memcmp(object->data, object->shadow, object->size) != 0;
+}
+
+/**
+ * @brief Encodes the changes between the live object and its shadow.
+ *
+ * Changed bytes are grouped into offset/length runs. Runs separated by no more than a run header's worth of
+ * unchanged bytes are merged, as splitting them would cost more than resending the gap. If the object has never
+ * been sent, a resync was requested, or the delta would not be smaller than the object itself, a full frame is
+ * emitted instead.
+ *
+ * The shadow is not modified; once the transfer succeeds, the caller applies the same buffer to its own object
+ * with delta_sync_apply() so both halves advance in lockstep.
+ *
+ * @param object object to encode
+ * @param buffer output buffer
+ * @param buffer_size size of the output buffer
+ * @return uint8_t number of bytes written, or 0 if there is nothing to send
+ */
+uint8_t delta_sync_encode(delta_sync_object_t *object, uint8_t *buffer, uint8_t buffer_size) {
+    const uint8_t      *data      = (const uint8_t *)object->data;
+    const uint16_t      full_size = DELTA_SYNC_OVERHEAD + object->size;
+    delta_sync_header_t header    = {
+        .seq   = object->seq + 1,
+        .flags = 0,
+    };
+
+    if (object->has_baseline && !object->needs_full) {
+        uint16_t pos   = DELTA_SYNC_OVERHEAD;
+        uint8_t  index = 0;
+        while (index < object->size) {
+            if (data[index] == object->shadow[index]) {
+                index++;
+                continue;
+            }
+            uint8_t start = index, end = index + 1;
+            for (index = end; index < object->size && (index - end) <= sizeof(delta_sync_run_t); index++) {
+                if (data[index] != object->shadow[index]) {
+                    end = index + 1;
+                }
+            }
+
+            delta_sync_run_t run = {
+                .offset = start,
+                .length = end - start,
+            };
+            if (pos + sizeof(delta_sync_run_t) + run.length >= full_size ||
+                pos + sizeof(delta_sync_run_t) + run.length > buffer_size) {
+                pos = 0;
+                break;
+            }
+            memcpy(&buffer[pos], &run, sizeof(delta_sync_run_t));
+            pos += sizeof(delta_sync_run_t);
+            memcpy(&buffer[pos], &data[start], run.length);
+            pos += run.length;
+        }
+
+        if (pos == DELTA_SYNC_OVERHEAD) {
+            return 0;
+        }
+        if (pos) {
+            memcpy(buffer, &header, sizeof(delta_sync_header_t));
+            return pos;
+        }
+    }
+
+    if (full_size > buffer_size) {
+        return 0;
+    }
+    header.flags = DELTA_SYNC_FLAG_FULL;
+    memcpy(buffer, &header, sizeof(delta_sync_header_t));
+    memcpy(&buffer[DELTA_SYNC_OVERHEAD], data, object->size);
+    return full_size;
+}
+
+/**
+ * @brief Applies an encoded frame to the object's shadow.
+ *
+ * Delta frames are only accepted if they directly follow the last applied sequence number, and the whole frame
+ * is validated before the shadow is touched so a malformed frame can never leave it half updated.
+ *
+ * @param object object to update
+ * @param buffer encoded frame
+ * @param size size of the encoded frame
+ * @return delta_sync_status_t DELTA_SYNC_OK if applied, DELTA_SYNC_NEEDS_FULL if a full frame is required
+ */
+delta_sync_status_t delta_sync_apply(delta_sync_object_t *object, const uint8_t *buffer, uint8_t size) {
+    delta_sync_header_t header;
+
+    if (size < DELTA_SYNC_OVERHEAD) {
+        return DELTA_SYNC_INVALID;
+    }
+    memcpy(&header, buffer, sizeof(delta_sync_header_t));
+    buffer += DELTA_SYNC_OVERHEAD;
+    size -= DELTA_SYNC_OVERHEAD;
+
+    if (header.flags & DELTA_SYNC_FLAG_FULL) {
+        if (size != object->size) {
+            return DELTA_SYNC_INVALID;
+        }
+        memcpy(object->shadow, buffer, size);
+    } else {
+        if (!object->has_baseline || header.seq != (uint8_t)(object->seq + 1)) {
+            return DELTA_SYNC_NEEDS_FULL;
+        }
+
+        delta_sync_run_t run;
+        for (uint8_t pos = 0; pos < size; pos += run.length) {
+            if (size - pos < sizeof(delta_sync_run_t)) {
+                return DELTA_SYNC_INVALID;
+            }
+            memcpy(&run, &buffer[pos], sizeof(delta_sync_run_t));
+            pos += sizeof(delta_sync_run_t);
+            if (run.length == 0 || run.length > size - pos || run.offset + run.length > object->size) {
+                return DELTA_SYNC_INVALID;
+            }
+        }
+        for (uint8_t pos = 0; pos < size; pos += run.length) {
+            memcpy(&run, &buffer[pos], sizeof(delta_sync_run_t));
+            pos += sizeof(delta_sync_run_t);
+            memcpy(&object->shadow[run.offset], &buffer[pos], run.length);
+        }
+    }
+
+    object->seq          = header.seq;
+    object->has_baseline = true;
+    object->needs_full   = false;
+    return DELTA_SYNC_OK;
+}
+
+/**
+ * @brief Fletcher-16 checksum, used by the heartbeat to verify both halves hold the same copy.
+ *
+ * @param data data to checksum
+ * @param size size of the data
+ * @return uint16_t checksum
+ */
+uint16_t delta_sync_checksum(const uint8_t *data, uint16_t size) {
+    uint16_t sum1 = 0, sum2 = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (sum2 << 8) | sum1;
+}
@@ -0,0 +1,52 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "util.h"
+
+#define DELTA_SYNC_FLAG_FULL 0x01
+
+typedef enum delta_sync_status_t {
+    DELTA_SYNC_OK = 0,
+    DELTA_SYNC_NEEDS_FULL,
+    DELTA_SYNC_INVALID,
+} delta_sync_status_t;
+
+/**
+ * @brief Prefixes every encoded object. Full frames carry the raw object after the header, delta frames carry a
+ * sequence of delta_sync_run_t headers, each followed by `length` bytes of replacement data.
+ */
+typedef struct PACKED delta_sync_header_t {
+    uint8_t seq;
+    uint8_t flags;
+} delta_sync_header_t;
+
+typedef struct PACKED delta_sync_run_t {
+    uint8_t offset;
+    uint8_t length;
+} delta_sync_run_t;
+
+#define DELTA_SYNC_OVERHEAD (sizeof(delta_sync_header_t))
+
+/**
+ * @brief A registered sync object.
+ *
+ * On the sending half, `data` is the live object and `shadow` is what the other half is known to hold. On the
+ * receiving half, `data` is unused and `shadow` is the reassembled copy that gets handed to the handler.
+ */
+typedef struct delta_sync_object_t {
+    const void *data;
+    uint8_t    *shadow;
+    uint8_t     size;
+    uint8_t     seq;
+    bool        has_baseline : 1;
+    bool        needs_full   : 1;
+} delta_sync_object_t;
+
+bool                delta_sync_is_dirty(const delta_sync_object_t *object);
+uint8_t             delta_sync_encode(delta_sync_object_t *object, uint8_t *buffer, uint8_t buffer_size);
+delta_sync_status_t delta_sync_apply(delta_sync_object_t *object, const uint8_t *buffer, uint8_t size);
+uint16_t            delta_sync_checksum(const uint8_t *data, uint16_t size);
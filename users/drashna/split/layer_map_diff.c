@@ -0,0 +1,146 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "layer_map_diff.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Appends a run to the encoded row.
+ *
+ * @param run run to write
+ * @param buffer output buffer
+ * @param pos current position in the buffer, advanced past the run
+ * @param buffer_size size of the output buffer
+ * @return false if there is no room for the run
+ */
+static bool layer_map_diff_write_run(const layer_map_diff_run_t *run, uint8_t *buffer, uint8_t *pos,
+                                     uint8_t buffer_size) {
+    if (*pos + sizeof(layer_map_diff_run_t) > buffer_size) {
+        return false;
+    }
+    memcpy(&buffer[*pos], run, sizeof(layer_map_diff_run_t));
+    *pos += sizeof(layer_map_diff_run_t);
+    return true;
+}
+
+/**
+ * @brief Encodes the cells of a row that differ from the shadow.
+ *
+ * Changed cells are flagged in a bitmap, and their keycodes are run length encoded in column order. Unchanged
+ * cells don't break a run, so a row that is mostly KC_TRNS or KC_NO collapses to a handful of runs.
+ *
+ * @param row live row
+ * @param shadow what the other half is known to hold for this row
+ * @param cols number of columns in the row
+ * @param full encode every cell, rather than just the changed ones
+ * @param buffer output buffer
+ * @param buffer_size size of the output buffer
+ * @return uint8_t number of bytes written, or 0 if the row doesn't fit
+ */
+uint8_t layer_map_diff_encode_row(const uint16_t *row, const uint16_t *shadow, uint8_t cols, bool full,
+                                  uint8_t *buffer, uint8_t buffer_size) {
+    layer_map_diff_run_t run = {0};
+    uint8_t              pos = LAYER_MAP_DIFF_BITMAP_SIZE(cols);
+
+    if (pos > buffer_size) {
+        return 0;
+    }
+    memset(buffer, 0, pos);
+    for (uint8_t col = 0; col < cols; col++) {
+        if (!full && row[col] == shadow[col]) {
+            continue;
+        }
+        buffer[col / 8] |= (1U << (col % 8));
+        if (run.count && run.keycode == row[col] && run.count < UINT8_MAX) {
+            run.count++;
+            continue;
+        }
+        if (run.count && !layer_map_diff_write_run(&run, buffer, &pos, buffer_size)) {
+            return 0;
+        }
+        run.count   = 1;
+        run.keycode = row[col];
+    }
+    if (run.count && !layer_map_diff_write_run(&run, buffer, &pos, buffer_size)) {
+        return 0;
+    }
+    return pos;
+}
+
+/**
+ * @brief Walks an encoded diff, applying it to the map, or only validating it if the map is NULL.
+ */
+static bool layer_map_diff_walk(uint16_t *map, uint8_t rows, uint8_t cols, const uint8_t *buffer, uint8_t size,
+                                bool *changed) {
+    layer_map_diff_header_t header;
+    const uint8_t           bitmap_size = LAYER_MAP_DIFF_BITMAP_SIZE(cols);
+    uint8_t                 pos         = sizeof(layer_map_diff_header_t);
+
+    if (size < sizeof(layer_map_diff_header_t)) {
+        return false;
+    }
+    memcpy(&header, buffer, sizeof(layer_map_diff_header_t));
+    if (header.first_row >= rows || header.row_count > rows - header.first_row) {
+        return false;
+    }
+
+    for (uint8_t row = header.first_row; row < header.first_row + header.row_count; row++) {
+        const uint8_t       *bitmap = &buffer[pos];
+        layer_map_diff_run_t run    = {0};
+
+        if (size - pos < bitmap_size) {
+            return false;
+        }
+        pos += bitmap_size;
+        for (uint8_t col = 0; col < bitmap_size * 8; col++) {
+            if (!(bitmap[col / 8] & (1U << (col % 8)))) {
+                continue;
+            }
+            if (col >= cols) {
+                return false;
+            }
+            if (run.count == 0) {
+                if (size - pos < sizeof(layer_map_diff_run_t)) {
+                    return false;
+                }
+                memcpy(&run, &buffer[pos], sizeof(layer_map_diff_run_t));
+                pos += sizeof(layer_map_diff_run_t);
+                if (run.count == 0) {
+                    return false;
+                }
+            }
+            run.count--;
+            if (map != NULL && map[row * cols + col] != run.keycode) {
+                map[row * cols + col] = run.keycode;
+                *changed              = true;
+            }
+        }
+        // runs never span rows
+        if (run.count) {
+            return false;
+        }
+    }
+    return pos == size;
+}
+
+/**
+ * @brief Applies an encoded diff to a map, in place.
+ *
+ * The whole diff is validated before the map is touched, so a malformed diff can never leave it half updated.
+ *
+ * @param map map to update, `rows` * `cols` keycodes
+ * @param rows number of rows in the map
+ * @param cols number of columns in the map
+ * @param buffer encoded diff
+ * @param size size of the encoded diff
+ * @param changed set to true if any cell changed value, otherwise left untouched
+ * @return false if the diff is malformed
+ */
+bool layer_map_diff_apply(uint16_t *map, uint8_t rows, uint8_t cols, const uint8_t *buffer, uint8_t size,
+                          bool *changed) {
+    if (!layer_map_diff_walk(NULL, rows, cols, buffer, size, changed)) {
+        return false;
+    }
+    return layer_map_diff_walk(map, rows, cols, buffer, size, changed);
+}
@@ -0,0 +1,35 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "util.h"
+
+/**
+ * @brief Prefixes every encoded layer map diff. It is followed by `row_count` rows, starting at `first_row`, each
+ * made up of a changed cell bitmap, and the run length encoded keycodes for the changed cells of that row.
+ */
+typedef struct PACKED layer_map_diff_header_t {
+    uint8_t first_row;
+    uint8_t row_count;
+} layer_map_diff_header_t;
+
+/**
+ * @brief `count` consecutive changed cells (in column order, skipping unchanged cells) that share the same
+ * keycode.
+ */
+typedef struct PACKED layer_map_diff_run_t {
+    uint8_t  count;
+    uint16_t keycode;
+} layer_map_diff_run_t;
+
+#define LAYER_MAP_DIFF_BITMAP_SIZE(cols) (((cols) + 7) / 8)
+#define LAYER_MAP_DIFF_MAX_ROW_SIZE(cols) \
+    (LAYER_MAP_DIFF_BITMAP_SIZE(cols) + (cols) * sizeof(layer_map_diff_run_t))
+
+uint8_t layer_map_diff_encode_row(const uint16_t *row, const uint16_t *shadow, uint8_t cols, bool full,
+                                  uint8_t *buffer, uint8_t buffer_size);
+bool    layer_map_diff_apply(uint16_t *map, uint8_t rows, uint8_t cols, const uint8_t *buffer, uint8_t size,
+                             bool *changed);
@@ -1,7 +1,10 @@
 CUSTOM_SPLIT_TRANSPORT_SYNC ?= yes
 ifeq ($(strip $(CUSTOM_SPLIT_TRANSPORT_SYNC)), yes)
     ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
-        SRC += $(USER_PATH)/split/transport_sync.c
+        SRC += $(USER_PATH)/split/transport_sync.c \
+               $(USER_PATH)/split/delta_sync.c \
+               $(USER_PATH)/split/sync_scheduler.c \
+               $(USER_PATH)/split/layer_map_diff.c
         OPT_DEFS += -DCUSTOM_SPLIT_TRANSPORT_SYNC
         CONFIG_H += $(USER_PATH)/split/config.h
     endif
@@ -0,0 +1,274 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sync_scheduler.h"
+#include "timer.h"
+#include <stddef.h>
+#include <string.h>
+
+typedef struct split_sync_entry_t {
+    split_sync_pack_fn_t  pack;
+    uint16_t              enqueued;
+    split_sync_priority_t priority;
+    bool                  pending;
+} split_sync_entry_t;
+
+static split_sync_entry_t    entries[SPLIT_SYNC_MAX_KEYS] = {0};
+static split_sync_stats_t    stats                        = {0};
+static split_sync_flush_fn_t flush_frame                  = NULL;
+
+/**
+ * @brief Registers the function that packs the payload for a key.
+ *
+ * @param key coalescing key
+ * @param pack pack function
+ */
+void split_sync_register(uint8_t key, split_sync_pack_fn_t pack) {
+    if (key < SPLIT_SYNC_MAX_KEYS) {
+        entries[key].pack = pack;
+    }
+}
+
+/**
+ * @brief Sets the function that sends packed frames.
+ *
+ * @param flush flush function
+ */
+void split_sync_set_flush(split_sync_flush_fn_t flush) {
+    flush_frame = flush;
+}
+
+/**
+ * @brief Queues a key to be sent.
+ *
+ * If the key is already queued, the older payload is replaced by the newer one (it is built at send time), the
+ * original queue time is kept so that latency and starvation are measured from the first request, and the
+ * priority is raised if needed.
+ *
+ * @param key coalescing key
+ * @param priority priority to send it with
+ */
+void split_sync_enqueue(uint8_t key, split_sync_priority_t priority) {
+    if (key >= SPLIT_SYNC_MAX_KEYS || entries[key].pack == NULL) {
+        return;
+    }
+    split_sync_entry_t *entry = &entries[key];
+    if (entry->pending) {
+        stats.coalesced++;
+        if (priority < entry->priority) {
+            entry->priority = priority;
+        }
+        return;
+    }
+    entry->pending  = true;
+    entry->priority = priority;
+    entry->enqueued = timer_read();
+    stats.depth++;
+    if (stats.depth > stats.max_depth) {
+        stats.max_depth = stats.depth;
+    }
+}
+
+/**
+ * @brief Removes a key from the queue, and updates the latency stats.
+ *
+ * @param key key to dequeue
+ */
+static void split_sync_dequeue(uint8_t key) {
+    stats.last_latency = timer_elapsed(entries[key].enqueued);
+    if (stats.last_latency > stats.max_latency) {
+        stats.max_latency = stats.last_latency;
+    }
+    entries[key].pending = false;
+    stats.depth--;
+}
+
+/**
+ * @brief Picks the next key to send: highest priority first, oldest first within a priority. Anything that has
+ * been waiting longer than SPLIT_SYNC_STARVATION_MS is treated as high priority so low priority traffic can't be
+ * starved out.
+ *
+ * @param skip keys that can't be sent in this frame
+ * @return uint8_t key to send, or SPLIT_SYNC_MAX_KEYS if nothing is queued
+ */
+static uint8_t split_sync_next_key(const bool *skip) {
+    uint8_t  best          = SPLIT_SYNC_MAX_KEYS;
+    uint8_t  best_priority = 0;
+    uint16_t best_age      = 0;
+
+    for (uint8_t key = 0; key < SPLIT_SYNC_MAX_KEYS; key++) {
+        if (!entries[key].pending || skip[key]) {
+            continue;
+        }
+        uint16_t age      = timer_elapsed(entries[key].enqueued);
+        uint8_t  priority = age > SPLIT_SYNC_STARVATION_MS ? SPLIT_SYNC_PRIORITY_HIGH : entries[key].priority;
+        if (best == SPLIT_SYNC_MAX_KEYS || priority < best_priority || (priority == best_priority && age > best_age)) {
+            best          = key;
+            best_priority = priority;
+            best_age      = age;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Greedily packs queued payloads into a single frame, in priority order, and sends it.
+ *
+ * Payloads that don't fit in the space left are skipped for this frame, so smaller ones can still fill it. Keys
+ * are only dequeued once the frame has been sent; if the transaction fails, they are added to the skip list and
+ * stay queued for the next tick.
+ *
+ * @param skip keys that can't be sent this tick, updated with the keys of a failed frame
+ * @return uint8_t size of the frame, or 0 if there was nothing to send
+ */
+static uint8_t split_sync_send_frame(bool *skip) {
+    uint8_t frame[SPLIT_SYNC_FRAME_SIZE];
+    bool    considered[SPLIT_SYNC_MAX_KEYS];
+    uint8_t keys[SPLIT_SYNC_MAX_KEYS];
+    uint8_t count = 0, length = 0, key;
+
+    if (flush_frame == NULL) {
+        return 0;
+    }
+
+    memcpy(considered, skip, sizeof(considered));
+    while ((key = split_sync_next_key(considered)) < SPLIT_SYNC_MAX_KEYS) {
+        uint8_t size    = 0;
+        considered[key] = true;
+        switch (entries[key].pack(key, &frame[length], sizeof(frame) - length, &size)) {
+            case SPLIT_SYNC_PACKED:
+                keys[count++] = key;
+                length += size;
+                break;
+            case SPLIT_SYNC_NOTHING_TO_SEND:
+                split_sync_dequeue(key);
+                break;
+            case SPLIT_SYNC_NO_ROOM:
+                if (length == 0) {
+                    // can never fit, so don't let it block the queue
+                    stats.dropped++;
+                    split_sync_dequeue(key);
+                }
+                break;
+        }
+    }
+
+    if (length == 0) {
+        return 0;
+    }
+    if (!flush_frame(frame, length)) {
+        stats.failed++;
+        for (uint8_t i = 0; i < count; i++) {
+            skip[keys[i]] = true;
+        }
+        return length;
+    }
+    stats.sent++;
+    stats.packed += count;
+    for (uint8_t i = 0; i < count; i++) {
+        split_sync_dequeue(keys[i]);
+    }
+    return length;
+}
+
+/**
+ * @brief Sends a key immediately, outside of the per tick budget. Only for messages that can't wait for the next
+ * housekeeping tick, such as the suspend state.
+ *
+ * @param key key to send
+ * @return true if the send was successful
+ */
+bool split_sync_send_now(uint8_t key) {
+    bool skip[SPLIT_SYNC_MAX_KEYS];
+
+    split_sync_enqueue(key, SPLIT_SYNC_PRIORITY_HIGH);
+    if (key >= SPLIT_SYNC_MAX_KEYS || !entries[key].pending) {
+        return false;
+    }
+    memset(skip, true, sizeof(skip));
+    skip[key] = false;
+    split_sync_send_frame(skip);
+    return !entries[key].pending;
+}
+
+/**
+ * @brief Drains the queue, up to SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK transactions or
+ * SPLIT_SYNC_MAX_BYTES_PER_TICK bytes, whichever comes first. This bounds how long the split sync can hold up
+ * the scan loop on any one tick.
+ */
+void split_sync_task(void) {
+    bool     skip[SPLIT_SYNC_MAX_KEYS] = {0};
+    uint8_t  transactions              = 0;
+    uint16_t bytes                     = 0;
+
+    while (transactions < SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK && bytes < SPLIT_SYNC_MAX_BYTES_PER_TICK) {
+        uint8_t size = split_sync_send_frame(skip);
+        if (size == 0) {
+            break;
+        }
+        transactions++;
+        bytes += size;
+    }
+}
+
+/**
+ * @brief Get the split sync scheduler stats
+ *
+ * @return const split_sync_stats_t*
+ */
+const split_sync_stats_t *split_sync_get_stats(void) {
+    return &stats;
+}
+
+/**
+ * @brief Appends a payload to a frame, prefixed with its id and size.
+ *
+ * @param id id of the payload
+ * @param data payload
+ * @param size size of the payload
+ * @param buffer where to write it in the frame
+ * @param buffer_size space left in the frame
+ * @param packed_size set to the number of bytes written
+ * @return split_sync_pack_result_t SPLIT_SYNC_NO_ROOM if it doesn't fit in the space left
+ */
+split_sync_pack_result_t split_sync_tlv_pack(uint8_t id, const void *data, uint8_t size, uint8_t *buffer,
+                                             uint8_t buffer_size, uint8_t *packed_size) {
+    if (SPLIT_SYNC_TLV_OVERHEAD + size > buffer_size) {
+        return SPLIT_SYNC_NO_ROOM;
+    }
+    buffer[0] = id;
+    buffer[1] = size;
+    memcpy(&buffer[SPLIT_SYNC_TLV_OVERHEAD], data, size);
+    *packed_size = SPLIT_SYNC_TLV_OVERHEAD + size;
+    return SPLIT_SYNC_PACKED;
+}
+
+/**
+ * @brief Reads the next payload from a frame.
+ *
+ * A header cut short by the end of the frame, or a size that runs past it, makes the rest of the frame invalid, as
+ * there is no telling where the next payload would start. The payloads before it are still good.
+ *
+ * @param frame frame to read
+ * @param frame_size size of the frame
+ * @param pos position of the next payload, advanced past it
+ * @param id set to the id of the payload
+ * @param data set to the payload
+ * @param size set to the size of the payload
+ * @return split_sync_tlv_status_t SPLIT_SYNC_TLV_END once every payload has been read
+ */
+split_sync_tlv_status_t split_sync_tlv_next(const uint8_t *frame, uint8_t frame_size, uint8_t *pos, uint8_t *id,
+                                            const uint8_t **data, uint8_t *size) {
+    if (*pos >= frame_size) {
+        return SPLIT_SYNC_TLV_END;
+    }
+    if (frame_size - *pos < SPLIT_SYNC_TLV_OVERHEAD ||
+        frame[*pos + 1] > frame_size - *pos - SPLIT_SYNC_TLV_OVERHEAD) {
+        return SPLIT_SYNC_TLV_INVALID;
+    }
+    *id   = frame[*pos];
+    *size = frame[*pos + 1];
+    *data = &frame[*pos + SPLIT_SYNC_TLV_OVERHEAD];
+    *pos += SPLIT_SYNC_TLV_OVERHEAD + *size;
+    return SPLIT_SYNC_TLV_OK;
+}
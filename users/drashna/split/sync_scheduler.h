@@ -0,0 +1,90 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SPLIT_SYNC_MAX_KEYS
+#    define SPLIT_SYNC_MAX_KEYS 32
+#endif // SPLIT_SYNC_MAX_KEYS
+#ifndef SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK
+#    define SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK 2
+#endif // SPLIT_SYNC_MAX_TRANSACTIONS_PER_TICK
+#ifndef SPLIT_SYNC_MAX_BYTES_PER_TICK
+#    define SPLIT_SYNC_MAX_BYTES_PER_TICK 128
+#endif // SPLIT_SYNC_MAX_BYTES_PER_TICK
+#ifndef SPLIT_SYNC_STARVATION_MS
+#    define SPLIT_SYNC_STARVATION_MS 250
+#endif // SPLIT_SYNC_STARVATION_MS
+#ifndef SPLIT_SYNC_FRAME_SIZE
+#    define SPLIT_SYNC_FRAME_SIZE (RPC_M2S_BUFFER_SIZE - 1)
+#endif // SPLIT_SYNC_FRAME_SIZE
+
+// Every payload in a frame is prefixed with its id and size, one byte each
+#define SPLIT_SYNC_TLV_OVERHEAD 2
+
+typedef enum split_sync_priority_t {
+    SPLIT_SYNC_PRIORITY_HIGH = 0,
+    SPLIT_SYNC_PRIORITY_NORMAL,
+    SPLIT_SYNC_PRIORITY_LOW,
+} split_sync_priority_t;
+
+typedef enum split_sync_pack_result_t {
+    SPLIT_SYNC_PACKED = 0,
+    SPLIT_SYNC_NOTHING_TO_SEND,
+    SPLIT_SYNC_NO_ROOM,
+} split_sync_pack_result_t;
+
+typedef enum split_sync_tlv_status_t {
+    SPLIT_SYNC_TLV_OK = 0,
+    SPLIT_SYNC_TLV_END,
+    SPLIT_SYNC_TLV_INVALID,
+} split_sync_tlv_status_t;
+
+/**
+ * @brief Appends the current payload for a key to a frame.
+ *
+ * Payloads are built at send time rather than when queued, so a queued key always sends its latest value.
+ *
+ * @param key key being packed
+ * @param buffer where to write the payload
+ * @param buffer_size space left in the frame
+ * @param size set to the number of bytes written
+ * @return split_sync_pack_result_t SPLIT_SYNC_NO_ROOM if the payload doesn't fit in the space left
+ */
+typedef split_sync_pack_result_t (*split_sync_pack_fn_t)(uint8_t key, uint8_t *buffer, uint8_t buffer_size,
+                                                         uint8_t *size);
+
+/**
+ * @brief Sends a packed frame to the other half.
+ *
+ * @param frame frame to send
+ * @param size size of the frame
+ * @return false if the transaction failed, and every key in the frame should stay queued
+ */
+typedef bool (*split_sync_flush_fn_t)(const uint8_t *frame, uint8_t size);
+
+typedef struct split_sync_stats_t {
+    uint8_t  depth;
+    uint8_t  max_depth;
+    uint16_t sent;      // frames
+    uint16_t packed;    // payloads
+    uint16_t coalesced; // requests merged into a payload that was already queued, which sends the newer value
+    uint16_t dropped;   // payloads that were never sent, as they can't fit in a frame
+    uint16_t failed;    // frames the other half didn't take, which are retried
+    uint16_t last_latency;
+    uint16_t max_latency;
+} split_sync_stats_t;
+
+void                      split_sync_register(uint8_t key, split_sync_pack_fn_t pack);
+void                      split_sync_set_flush(split_sync_flush_fn_t flush);
+void                      split_sync_enqueue(uint8_t key, split_sync_priority_t priority);
+bool                      split_sync_send_now(uint8_t key);
+void                      split_sync_task(void);
+const split_sync_stats_t *split_sync_get_stats(void);
+split_sync_pack_result_t  split_sync_tlv_pack(uint8_t id, const void *data, uint8_t size, uint8_t *buffer,
+                                              uint8_t buffer_size, uint8_t *packed_size);
+split_sync_tlv_status_t   split_sync_tlv_next(const uint8_t *frame, uint8_t frame_size, uint8_t *pos, uint8_t *id,
+                                              const uint8_t **data, uint8_t *size);
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "transport_sync.h"
+#include "delta_sync.h"
+#include "sync_scheduler.h"
 #include "_wait.h"
 #include "drashna.h"
 #include "transactions.h"
@@ -30,20 +32,21 @@ extern bool           delayed_tasks_run;
 extern bool swap_hands;
 #endif
 #ifdef WPM_ENABLE
-extern uint8_t wpm_graph_samples[WPM_GRAPH_SAMPLES];
+#    include "wpm_stats.h"
 #endif // WPM_ENABLE
 #ifdef DISPLAY_DRIVER_ENABLE
 #    include "display/display.h"
 #    ifdef CUSTOM_QUANTUM_PAINTER_ENABLE
 #        include "display/painter/keylogger.h"
+#        include "display/painter/painter_damage.h"
 #    endif // CUSTOM_QUANTUM_PAINTER_ENABLE
 #    ifdef OLED_ENABLE
 #        include "display/oled/oled_stuff.h"
 #    endif // OLED_ENABLE
 #endif     // DISPLAY_DRIVER_ENABLE
-#ifndef FORCED_SYNC_THROTTLE_MS
-#    define FORCED_SYNC_THROTTLE_MS 100
-#endif // FORCED_SYNC_THROTTLE_MS
+#ifndef SPLIT_SYNC_HEARTBEAT_MS
+#    define SPLIT_SYNC_HEARTBEAT_MS 1000
+#endif // SPLIT_SYNC_HEARTBEAT_MS
 
 bool has_first_run = false;
 
@@ -58,43 +61,112 @@ typedef enum PACKED extended_id_t {
     RPC_ID_EXTENDED_SUSPEND_STATE,
     RPC_ID_EXTENDED_OLED_KEYLOGGER_STR,
     RPC_ID_EXTENDED_RTC_CONFIG,
+    RPC_ID_EXTENDED_SYNC_HEARTBEAT,
+    RPC_ID_EXTENDED_LAYER_MAP_DIFF,
     NUM_EXTENDED_IDS,
 } extended_id_t;
 
 _Static_assert(sizeof(extended_id_t) == 1, "extended_id_t is not 1 byte!");
+_Static_assert(NUM_EXTENDED_IDS <= 16, "extended_ack_t resync mask is too small!");
 
-#define RPC_EXTENDED_TRANSACTION_OVERHEAD    (sizeof(extended_id_t) + sizeof(uint8_t))
-#define RPC_EXTENDED_TRANSACTION_BUFFER_SIZE (RPC_M2S_BUFFER_SIZE - RPC_EXTENDED_TRANSACTION_OVERHEAD)
+/*
+ * Every extended transaction is a frame holding one or more sub-messages, each prefixed with its id and size by
+ * split_sync_tlv_pack(). Small messages get packed together so they share a single transaction.
+ */
 
-typedef struct PACKED extended_msg_t {
-    extended_id_t id;
-    uint8_t       size;
-    uint8_t       data[RPC_EXTENDED_TRANSACTION_BUFFER_SIZE];
-} extended_msg_t;
+#define RPC_EXTENDED_FRAME_OVERHEAD          (sizeof(uint8_t))
+#define RPC_EXTENDED_FRAME_BUFFER_SIZE       (RPC_M2S_BUFFER_SIZE - RPC_EXTENDED_FRAME_OVERHEAD)
+#define RPC_EXTENDED_TRANSACTION_BUFFER_SIZE (RPC_EXTENDED_FRAME_BUFFER_SIZE - SPLIT_SYNC_TLV_OVERHEAD)
+
+typedef struct PACKED extended_frame_t {
+    uint8_t size;
+    uint8_t data[RPC_EXTENDED_FRAME_BUFFER_SIZE];
+} extended_frame_t;
 
-_Static_assert(sizeof(extended_msg_t) == RPC_M2S_BUFFER_SIZE, "extended_rpc_t is larger than split buffer size!");
-_Static_assert(sizeof(userspace_config_t) <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+#define RPC_DELTA_SYNC_MAX_OBJECT_SIZE (RPC_EXTENDED_TRANSACTION_BUFFER_SIZE - DELTA_SYNC_OVERHEAD)
+
+_Static_assert(sizeof(extended_frame_t) == RPC_M2S_BUFFER_SIZE, "extended_frame_t is larger than split buffer size!");
+_Static_assert(SPLIT_SYNC_FRAME_SIZE == RPC_EXTENDED_FRAME_BUFFER_SIZE, "Split sync frame size mismatch!");
+_Static_assert(sizeof(userspace_config_t) <= RPC_DELTA_SYNC_MAX_OBJECT_SIZE,
                "userspace_config_t is larger than split buffer size!");
-_Static_assert(sizeof(userspace_runtime_state_t) <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+_Static_assert(sizeof(userspace_runtime_state_t) <= RPC_DELTA_SYNC_MAX_OBJECT_SIZE,
                "userspace_runtime_state_t is larger than split buffer size!");
 
+/**
+ * @brief Response sent back for every extended message. Each set bit is an extended ID that the receiving half
+ * could not apply, and needs a full resend for.
+ */
+typedef struct PACKED extended_ack_t {
+    uint16_t resync_mask;
+} extended_ack_t;
+
+_Static_assert(sizeof(extended_ack_t) <= RPC_S2M_BUFFER_SIZE, "extended_ack_t is larger than split buffer size!");
+
+typedef struct PACKED heartbeat_entry_t {
+    extended_id_t id;
+    uint8_t       seq;
+    uint16_t      checksum;
+} heartbeat_entry_t;
+
 typedef void (*handler_fn_t)(const uint8_t* data, uint8_t size);
 
-void recv_wpm_graph_data(const uint8_t* data, uint8_t size) {
 #ifdef WPM_ENABLE
-    if (memcmp(data, wpm_graph_samples, size) != 0) {
-        memcpy(wpm_graph_samples, data, size);
+/**
+ * @brief Prefixes the WPM graph samples sent to the other half, which follow it oldest first. Only the samples
+ * added since the last delivered message are sent, unless the other half needs the whole history.
+ */
+typedef struct PACKED wpm_graph_sync_header_t {
+    uint8_t seq; // sequence number of the first sample
+    uint8_t count;
+    bool    full;
+} wpm_graph_sync_header_t;
+
+_Static_assert(sizeof(wpm_graph_sync_header_t) + WPM_GRAPH_SAMPLES <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+               "WPM graph is larger than buffer size!");
+
+// Sequence number of the next sample the other half is missing
+static uint8_t last_wpm_graph_seq     = 0;
+static bool    wpm_graph_has_baseline = false;
+
+/**
+ * @brief Adds the received samples to the local WPM history.
+ *
+ * @param data encoded samples
+ * @param size size of the samples
+ * @return uint16_t resync mask if samples were missed, and the whole history is needed
+ */
+static uint16_t recv_wpm_graph_data(const uint8_t* data, uint8_t size) {
+    wpm_graph_sync_header_t header;
+
+    if (size < sizeof(wpm_graph_sync_header_t)) {
+        return (1U << RPC_ID_EXTENDED_WPM_GRAPH_DATA);
     }
-#endif
+    memcpy(&header, data, sizeof(wpm_graph_sync_header_t));
+    data += sizeof(wpm_graph_sync_header_t);
+    if (header.count > size - sizeof(wpm_graph_sync_header_t) || header.count > WPM_GRAPH_SAMPLES) {
+        xprintf("Invalid WPM graph data (size: %d)\n", size);
+        return (1U << RPC_ID_EXTENDED_WPM_GRAPH_DATA);
+    }
+    if (header.full) {
+        wpm_stats_set_seconds(header.seq, data, header.count);
+    } else if (header.seq != wpm_stats_seconds_seq()) {
+        return (1U << RPC_ID_EXTENDED_WPM_GRAPH_DATA);
+    } else {
+        for (uint8_t i = 0; i < header.count; i++) {
+            wpm_stats_add_second(data[i]);
+        }
+    }
+    return 0;
 }
+#endif // WPM_ENABLE
 
 #ifdef AUTOCORRECT_ENABLE
 extern char autocorrected_str[2][21];
 extern char autocorrected_str_raw[2][21];
 extern bool autocorrect_str_has_changed;
-_Static_assert(sizeof(autocorrected_str) <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+_Static_assert(sizeof(autocorrected_str) <= RPC_DELTA_SYNC_MAX_OBJECT_SIZE,
                "Autocorrect array larger than buffer size!");
-_Static_assert(sizeof(autocorrected_str_raw) <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+_Static_assert(sizeof(autocorrected_str_raw) <= RPC_DELTA_SYNC_MAX_OBJECT_SIZE,
                "Autocorrect array larger than buffer size!");
 #endif
 
@@ -110,7 +182,7 @@ void recv_autocorrect_string(const uint8_t* data, uint8_t size) {
 }
 
 #if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE) && defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
-_Static_assert((DISPLAY_KEYLOGGER_LENGTH * sizeof(int32_t)) <= RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+_Static_assert(sizeof(keylog_buffer_t) <= RPC_DELTA_SYNC_MAX_OBJECT_SIZE,
                "Display keylogger string larger than buffer size!");
 #endif
 
@@ -137,7 +209,7 @@ void recv_debug_config(const uint8_t* data, uint8_t size) {
 void recv_userspace_config(const uint8_t* data, uint8_t size) {
     if (memcmp(data, &userspace_config, size) != 0) {
         memcpy(&userspace_config, data, size);
-        eeconfig_update_user_datablock(&userspace_config, 0, EECONFIG_USER_DATA_SIZE);
+        userspace_config_mark_dirty();
 #if defined(DISPLAY_DRIVER_ENABLE)
         static uint8_t last_inverted = 0xFF, last_rotation = 0xFF;
         const uint8_t  current_inverted = is_keyboard_left() ? userspace_config.display.painter.left.inverted
@@ -269,8 +341,39 @@ void recv_rtc_config(const uint8_t* data, uint8_t size) {
 #endif // COMMUNITY_MODULE_RTC_ENABLE
 }
 
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#    include "layer_map.h"
+#    include "layer_map_diff.h"
+_Static_assert(sizeof(layer_map_diff_header_t) + LAYER_MAP_DIFF_MAX_ROW_SIZE(LAYER_MAP_COLS) <=
+                   RPC_EXTENDED_TRANSACTION_BUFFER_SIZE,
+               "Layer map row is larger than buffer size!");
+
+// What the other half is known to hold, and which rows of it can be trusted
+static uint16_t last_layer_map[LAYER_MAP_ROWS][LAYER_MAP_COLS] = {0};
+static bool     layer_map_row_has_baseline[LAYER_MAP_ROWS]     = {0};
+
+/**
+ * @brief Applies a layer map diff in place, only flagging the layer map as updated if a cell actually changed.
+ *
+ * @param data encoded layer map diff
+ * @param size size of the diff
+ * @return uint16_t resync mask if the diff couldn't be applied
+ */
+static uint16_t recv_layer_map_diff(const uint8_t* data, uint8_t size) {
+    bool changed = false;
+
+    if (!layer_map_diff_apply(&layer_map[0][0], LAYER_MAP_ROWS, LAYER_MAP_COLS, data, size, &changed)) {
+        xprintf("Invalid layer map diff (size: %d)\n", size);
+        return (1U << RPC_ID_EXTENDED_LAYER_MAP_DIFF);
+    }
+    if (changed) {
+        set_layer_map_has_updated(true);
+    }
+    return 0;
+}
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+
 static const handler_fn_t handlers[NUM_EXTENDED_IDS] = {
-    [RPC_ID_EXTENDED_WPM_GRAPH_DATA]          = recv_wpm_graph_data,
     [RPC_ID_EXTENDED_AUTOCORRECT_STR]         = recv_autocorrect_string,
     [RPC_ID_EXTENDED_DISPLAY_KEYLOG_STR]      = recv_keylogger_string_sync,
     [RPC_ID_EXTENDED_KEYMAP_CONFIG]           = recv_keymap_config,
@@ -282,15 +385,129 @@ static const handler_fn_t handlers[NUM_EXTENDED_IDS] = {
     [RPC_ID_EXTENDED_RTC_CONFIG]              = recv_rtc_config,
 };
 
+#define DELTA_SYNC_OBJECT(object_data, object_size) \
+    {.data = (object_data), .shadow = (uint8_t[object_size]){0}, .size = (object_size)}
+
 /**
- * @brief Handles extended messages received via the split keyboard transport mechanism.
+ * @brief Objects that are kept in sync by sending only their changed bytes. Any ID without an entry here is sent
+ * as a plain, one-shot message instead.
  *
-    if (((uintptr_t)initiator2target_buffer % _Alignof(extended_msg_t)) != 0) {
-        xprintf("Buffer is not properly aligned for extended_msg_t\n");
-        return;
+ * Both halves run the same table: the master uses the shadow as the last copy it sent, and the slave uses it as
+ * the copy that deltas are applied to before being passed on to the handler.
+ */
+static delta_sync_object_t sync_objects[NUM_EXTENDED_IDS] = {
+#ifdef AUTOCORRECT_ENABLE
+    [RPC_ID_EXTENDED_AUTOCORRECT_STR] = DELTA_SYNC_OBJECT(autocorrected_str_raw, sizeof(autocorrected_str_raw)),
+#endif // AUTOCORRECT_ENABLE
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE) && defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    [RPC_ID_EXTENDED_DISPLAY_KEYLOG_STR] = DELTA_SYNC_OBJECT(NULL, sizeof(keylog_buffer_t)),
+#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE && CUSTOM_QUANTUM_PAINTER_ENABLE
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE) && defined(OLED_ENABLE)
+    [RPC_ID_EXTENDED_OLED_KEYLOGGER_STR] = DELTA_SYNC_OBJECT(NULL, OLED_KEYLOGGER_LENGTH + 1),
+#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE && OLED_ENABLE
+    [RPC_ID_EXTENDED_KEYMAP_CONFIG]           = DELTA_SYNC_OBJECT(&keymap_config, sizeof(keymap_config_t)),
+    [RPC_ID_EXTENDED_DEBUG_CONFIG]            = DELTA_SYNC_OBJECT(&debug_config, sizeof(debug_config_t)),
+    [RPC_ID_EXTENDED_USERSPACE_CONFIG]        = DELTA_SYNC_OBJECT(&userspace_config, sizeof(userspace_config_t)),
+    [RPC_ID_EXTENDED_USERSPACE_RUNTIME_STATE] = DELTA_SYNC_OBJECT(&userspace_runtime_state,
+                                                                  sizeof(userspace_runtime_state_t)),
+};
+
+/**
+ * @brief Checks the master's view of every synced object against the local copy.
+ *
+ * @param data array of heartbeat_entry_t
+ * @param size size of the array in bytes
+ * @return uint16_t mask of extended IDs that are out of sync
+ */
+static uint16_t recv_sync_heartbeat(const uint8_t* data, uint8_t size) {
+    uint16_t resync_mask = 0;
+
+    for (uint8_t pos = 0; pos + sizeof(heartbeat_entry_t) <= size; pos += sizeof(heartbeat_entry_t)) {
+        heartbeat_entry_t entry;
+        memcpy(&entry, &data[pos], sizeof(heartbeat_entry_t));
+#ifdef WPM_ENABLE
+        if (entry.id == RPC_ID_EXTENDED_WPM_GRAPH_DATA) {
+            if (entry.seq != wpm_stats_seconds_seq() ||
+                delta_sync_checksum(wpm_stats_history(WPM_STATS_SECONDS), WPM_GRAPH_SAMPLES) != entry.checksum) {
+                resync_mask |= (1U << entry.id);
+            }
+            continue;
+        }
+#endif // WPM_ENABLE
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+        if (entry.id == RPC_ID_EXTENDED_LAYER_MAP_DIFF) {
+            if (delta_sync_checksum((const uint8_t*)layer_map, sizeof(layer_map)) != entry.checksum) {
+                resync_mask |= (1U << entry.id);
+            }
+            continue;
+        }
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+        if (entry.id >= NUM_EXTENDED_IDS || sync_objects[entry.id].size == 0) {
+            continue;
+        }
+        delta_sync_object_t* object = &sync_objects[entry.id];
+        if (!object->has_baseline || object->seq != entry.seq ||
+            delta_sync_checksum(object->shadow, object->size) != entry.checksum) {
+            resync_mask |= (1U << entry.id);
+        }
     }
-    memcpy(&msg, initiator2target_buffer, initiator2target_buffer_size);
- * validating the message size, and invoking the appropriate handler function.
+    return resync_mask;
+}
+
+/**
+ * @brief Dispatches a single sub-message from a received frame.
+ *
+ * @param id The ID of the sub-message.
+ * @param data Pointer to the sub-message data.
+ * @param size The size of the sub-message data.
+ * @return uint16_t mask of extended IDs that need a full resend
+ */
+static uint16_t recv_extended_message(extended_id_t id, const uint8_t* data, uint8_t size) {
+    if (id == RPC_ID_EXTENDED_SYNC_HEARTBEAT) {
+        return recv_sync_heartbeat(data, size);
+    }
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    painter_damage_mark(PAINTER_DAMAGE_SPLIT_SYNC);
+#endif // DISPLAY_DRIVER_ENABLE && CUSTOM_QUANTUM_PAINTER_ENABLE
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+    if (id == RPC_ID_EXTENDED_LAYER_MAP_DIFF) {
+        return recv_layer_map_diff(data, size);
+    }
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+    if (id == RPC_ID_EXTENDED_WPM_GRAPH_DATA) {
+        return recv_wpm_graph_data(data, size);
+    }
+#endif // WPM_ENABLE
+
+    handler_fn_t handler = handlers[id];
+    if (handler == NULL) {
+        xprintf("Handler for message ID %d is NULL\n", id);
+        return 0;
+    }
+    // xprintf("Extended Transaction received:\nID: %d, Size: %d, data:\n  ", id, size);
+    // for (uint8_t i = 0; i < size; ++i) {
+    //     xprintf("%d ", data[i]);
+    // }
+    // xprintf("\n");
+
+    delta_sync_object_t* object = &sync_objects[id];
+    if (object->size == 0) {
+        handler(data, size);
+    } else if (delta_sync_apply(object, data, size) == DELTA_SYNC_OK) {
+        handler(object->shadow, object->size);
+    } else {
+        return (1U << id);
+    }
+    return 0;
+}
+
+/**
+ * @brief Handles extended messages received via the split keyboard transport mechanism.
+ *
+ * This function walks every sub-message in the received frame, validating its ID and size, and invoking the
+ * appropriate handler function. Delta synced objects are applied to their local copy first, and any that can't be
+ * applied are reported back to the initiator so it can send a full copy.
  *
  * @param initiator2target_buffer_size The size of the buffer containing the message from the initiator.
  * @param initiator2target_buffer Pointer to the buffer containing the message data from the initiator.
@@ -299,70 +516,146 @@ static const handler_fn_t handlers[NUM_EXTENDED_IDS] = {
  */
 void extended_message_handler(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
                               uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-    extended_msg_t msg = {0};
-    memcpy(&msg, initiator2target_buffer, initiator2target_buffer_size);
-    if (msg.id >= NUM_EXTENDED_IDS) {
-        xprintf("Invalid extended message ID: %d\n", msg.id);
+    extended_frame_t frame = {0};
+    extended_ack_t   ack   = {0};
+    memcpy(&frame, initiator2target_buffer, MIN(initiator2target_buffer_size, sizeof(extended_frame_t)));
+    if (frame.size > RPC_EXTENDED_FRAME_BUFFER_SIZE) {
+        xprintf("Invalid extended frame size: %d\n", frame.size);
         return;
     }
-    if (msg.size > RPC_EXTENDED_TRANSACTION_BUFFER_SIZE) {
-        xprintf("Invalid extended message size: %d (ID: %d)\n", msg.size, msg.id);
-        return;
+
+    const uint8_t*          data;
+    uint8_t                 pos = 0, id, size;
+    split_sync_tlv_status_t status;
+    while ((status = split_sync_tlv_next(frame.data, frame.size, &pos, &id, &data, &size)) == SPLIT_SYNC_TLV_OK) {
+        if (id >= NUM_EXTENDED_IDS) {
+            xprintf("Invalid extended message ID: %d\n", id);
+            break;
+        }
+        ack.resync_mask |= recv_extended_message(id, data, size);
+    }
+    if (status == SPLIT_SYNC_TLV_INVALID) {
+        xprintf("Invalid extended message at %d of %d\n", pos, frame.size);
     }
 
-    handler_fn_t handler = handlers[msg.id];
-    if (handler == NULL) {
-        xprintf("Handler for message ID %d is NULL\n", msg.id);
-        return;
+    if (target2initiator_buffer_size >= sizeof(extended_ack_t)) {
+        memcpy(target2initiator_buffer, &ack, sizeof(extended_ack_t));
     }
-    // xprintf("Extended Transaction received:\nID: %d, Size: %d, data:\n  ", msg.id, msg.size);
-    // for (uint8_t i = 0; i < msg.size; ++i) {
-    //     xprintf("%d ", msg.data[i]);
-    // }
-    // xprintf("\n");
+}
+
+/**
+ * @brief Packs whatever has changed in a delta synced object since it was last sent.
+ *
+ * The shadow is only advanced once the frame has been sent, so a failed send is simply retried as part of the
+ * next delta.
+ */
+static split_sync_pack_result_t pack_delta_object(uint8_t key, uint8_t* buffer, uint8_t buffer_size, uint8_t* size) {
+    delta_sync_object_t* object = &sync_objects[key];
+    uint8_t              delta[RPC_EXTENDED_TRANSACTION_BUFFER_SIZE];
 
-    handler(msg.data, msg.size);
+    if (!delta_sync_is_dirty(object)) {
+        return SPLIT_SYNC_NOTHING_TO_SEND;
+    }
+    uint8_t delta_size = delta_sync_encode(object, delta, sizeof(delta));
+    if (delta_size == 0) {
+        return SPLIT_SYNC_NOTHING_TO_SEND;
+    }
+    return split_sync_tlv_pack(key, delta, delta_size, buffer, buffer_size, size);
 }
 
 /**
- * @brief Sends an extended message to the other half of the split keyboard.
+ * @brief Queues a delta synced object if it has changed since it was last sent.
  *
- * This function constructs an extended message with the given ID and data,
- * and sends it using the transaction RPC mechanism. It ensures that the
- * message size does not exceed the buffer size.
+ * @param id The ID of the object to sync.
+ * @param priority The priority to send it with.
+ */
+static void sync_delta_object(extended_id_t id, split_sync_priority_t priority) {
+    delta_sync_object_t* object = &sync_objects[id];
+
+    if (object->data != NULL && delta_sync_is_dirty(object)) {
+        split_sync_enqueue(id, priority);
+    }
+}
+
+static uint16_t last_heartbeat = 0;
+
+/**
+ * @brief Packs the sequence number and checksum of every synced object.
  *
- * @param id The ID of the extended message to send.
- * @param data Pointer to the data to include in the message.
- * @param size The size of the data in bytes.
- * @return true if the message was successfully sent, false otherwise.
+ * Replaces blindly resending everything: the other half replies with the objects that don't match, and only
+ * those get resent in full.
  */
-bool send_extended_message_handler(enum extended_id_t id, const void* data, uint8_t size) {
-    if (size > RPC_EXTENDED_TRANSACTION_BUFFER_SIZE) {
-        xprintf("Invalid extended message size: %d (ID: %d)\n", size, id);
-        return false;
+static split_sync_pack_result_t pack_sync_heartbeat(uint8_t key, uint8_t* buffer, uint8_t buffer_size,
+                                                    uint8_t* size) {
+    heartbeat_entry_t entries[NUM_EXTENDED_IDS];
+    uint8_t           count = 0;
+
+    for (uint8_t id = 0; id < NUM_EXTENDED_IDS; id++) {
+        delta_sync_object_t* object = &sync_objects[id];
+        if (object->size == 0 || !object->has_baseline) {
+            continue;
+        }
+        entries[count++] = (heartbeat_entry_t){
+            .id       = id,
+            .seq      = object->seq,
+            .checksum = delta_sync_checksum(object->shadow, object->size),
+        };
     }
-    extended_msg_t msg = {
-        .id   = id,
-        .size = size,
-        .data = {0},
-    };
-    memcpy(msg.data, data, size);
-    // xprintf("Extended Transaction sent:\nID: %d, Size: %d, data:\n  ", msg.id, msg.size);
-    // for (uint8_t i = 0; i < size; ++i) {
-    //     xprintf("%d ", msg.data[i]);
-    // }
-    // xprintf("\n");
-    return transaction_rpc_send(RPC_ID_EXTENDED_SYNC_TRANSPORT, sizeof(extended_msg_t), &msg);
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+    if (memchr(layer_map_row_has_baseline, false, sizeof(layer_map_row_has_baseline)) == NULL) {
+        entries[count++] = (heartbeat_entry_t){
+            .id       = RPC_ID_EXTENDED_LAYER_MAP_DIFF,
+            .seq      = 0,
+            .checksum = delta_sync_checksum((const uint8_t*)last_layer_map, sizeof(last_layer_map)),
+        };
+    }
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+    // only once the other half has every sample, as there's no shadow of what it holds otherwise
+    if (wpm_graph_has_baseline && last_wpm_graph_seq == wpm_stats_seconds_seq()) {
+        entries[count++] = (heartbeat_entry_t){
+            .id       = RPC_ID_EXTENDED_WPM_GRAPH_DATA,
+            .seq      = last_wpm_graph_seq,
+            .checksum = delta_sync_checksum(wpm_stats_history(WPM_STATS_SECONDS), WPM_GRAPH_SAMPLES),
+        };
+    }
+#endif // WPM_ENABLE
+    if (count == 0) {
+        last_heartbeat = timer_read();
+        return SPLIT_SYNC_NOTHING_TO_SEND;
+    }
+    return split_sync_tlv_pack(RPC_ID_EXTENDED_SYNC_HEARTBEAT, entries, count * sizeof(heartbeat_entry_t), buffer,
+                               buffer_size, size);
+}
+
+/**
+ * @brief Queues the heartbeat every SPLIT_SYNC_HEARTBEAT_MS.
+ */
+static void sync_heartbeat(void) {
+    if (timer_elapsed(last_heartbeat) >= SPLIT_SYNC_HEARTBEAT_MS) {
+        split_sync_enqueue(RPC_ID_EXTENDED_SYNC_HEARTBEAT, SPLIT_SYNC_PRIORITY_NORMAL);
+    }
+}
+
+static bool pending_suspend_state = false;
+
+static split_sync_pack_result_t pack_suspend_state(uint8_t key, uint8_t* buffer, uint8_t buffer_size,
+                                                   uint8_t* size) {
+    return split_sync_tlv_pack(RPC_ID_EXTENDED_SUSPEND_STATE, &pending_suspend_state, sizeof(bool), buffer, buffer_size,
+                               size);
 }
 
 /**
  * @brief Send the suspend state to the other half of the split keyboard
  *
+ * This bypasses the per tick budget, as housekeeping doesn't run while the host is suspended.
+ *
  * @param status
  */
 void send_device_suspend_state(bool status) {
     if (is_device_suspended() != status && is_keyboard_master()) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_SUSPEND_STATE, &status, sizeof(bool))) {
+        pending_suspend_state = status;
+        if (split_sync_send_now(RPC_ID_EXTENDED_SUSPEND_STATE)) {
             wait_ms(5);
         }
     }
@@ -371,19 +664,10 @@ void send_device_suspend_state(bool status) {
 /**
  * @brief Synchronizes the userspace runtime state.
  *
- * This function checks if the userspace runtime state needs to be synchronized
- * and performs the synchronization if necessary. It updates the last synchronization
- * time and the last known user runtime state.
- *
- * @param needs_sync Pointer to a boolean indicating if synchronization is needed.
- * @param last_sync Pointer to the timestamp of the last synchronization.
- * @param last_user_state Pointer to the last known user runtime configuration.
+ * This function gathers the runtime state from the various features, and then queues any changes to be sent to
+ * the other half.
  */
 void sync_userspace_runtime_state(void) {
-    bool                             needs_sync      = false;
-    static uint16_t                  last_sync       = 0;
-    static userspace_runtime_state_t last_user_state = {0};
-
 #ifdef COMMUNITY_MODULE_KEYBOARD_LOCK_ENABLE
     userspace_runtime_state.internals.host_driver_disabled = get_keyboard_lock();
 #endif // COMMUNITY_MODULE_KEYBOARD_LOCK_ENABLE
@@ -409,291 +693,297 @@ void sync_userspace_runtime_state(void) {
 #    endif // COMMUNITY_MODULE_DISPLAY_MENU_ENABLE
 #endif     // DISPLAY_DRIVER_ENABLE
 
-    if (memcmp(&userspace_runtime_state, &last_user_state, sizeof(userspace_runtime_state_t))) {
-        needs_sync = true;
-        memcpy(&last_user_state, &userspace_runtime_state, sizeof(userspace_runtime_state_t));
+    sync_delta_object(RPC_ID_EXTENDED_USERSPACE_RUNTIME_STATE, SPLIT_SYNC_PRIORITY_HIGH);
+}
+
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+static bool layer_map_row_is_dirty(uint8_t row) {
+    return !layer_map_row_has_baseline[row] || memcmp(layer_map[row], last_layer_map[row], sizeof(layer_map[row])) != 0;
+}
+
+/**
+ * @brief Packs the changed cells of the layer map, from the first changed row to the last one that fits.
+ *
+ * Rows that don't fit are left for the next frame, as the shadow only advances for the rows that were sent.
+ */
+static split_sync_pack_result_t pack_layer_map_diff(uint8_t key, uint8_t* buffer, uint8_t buffer_size,
+                                                    uint8_t* size) {
+    uint8_t                 diff[RPC_EXTENDED_TRANSACTION_BUFFER_SIZE];
+    layer_map_diff_header_t header   = {.first_row = LAYER_MAP_ROWS, .row_count = 0};
+    uint8_t                 pos      = sizeof(layer_map_diff_header_t);
+    uint8_t                 last_row = 0;
+
+    for (uint8_t row = 0; row < LAYER_MAP_ROWS; row++) {
+        if (layer_map_row_is_dirty(row)) {
+            if (header.first_row == LAYER_MAP_ROWS) {
+                header.first_row = row;
+            }
+            last_row = row;
+        }
+    }
+    if (header.first_row == LAYER_MAP_ROWS) {
+        return SPLIT_SYNC_NOTHING_TO_SEND;
     }
-    if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-        needs_sync = true;
+    if (buffer_size < SPLIT_SYNC_TLV_OVERHEAD + sizeof(layer_map_diff_header_t)) {
+        return SPLIT_SYNC_NO_ROOM;
     }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_USERSPACE_RUNTIME_STATE, &userspace_runtime_state,
-                                          sizeof(userspace_runtime_state_t))) {
-            last_sync = timer_read();
+
+    const uint8_t diff_size = MIN(sizeof(diff), buffer_size - SPLIT_SYNC_TLV_OVERHEAD);
+    for (uint8_t row = header.first_row; row <= last_row; row++) {
+        uint8_t row_size = layer_map_diff_encode_row(layer_map[row], last_layer_map[row], LAYER_MAP_COLS,
+                                                     !layer_map_row_has_baseline[row], &diff[pos], diff_size - pos);
+        if (row_size == 0) {
+            break;
         }
-        needs_sync = false;
+        pos += row_size;
+        header.row_count++;
+    }
+    if (header.row_count == 0) {
+        return SPLIT_SYNC_NO_ROOM;
     }
+    memcpy(diff, &header, sizeof(layer_map_diff_header_t));
+    return split_sync_tlv_pack(key, diff, pos, buffer, buffer_size, size);
 }
 
 /**
- * @brief Synchronizes the userspace configuration if needed.
- *
- * This function checks if the userspace configuration needs to be synchronized.
- * If synchronization is required, it updates the last synchronization time and
- * the last known configuration.
- *
- * @param needs_sync Pointer to a boolean indicating if synchronization is needed.
- * @param last_sync Pointer to the last synchronization timestamp.
- * @param last_config Pointer to the last known userspace configuration.
+ * @brief Commits a delivered layer map diff to the shadow.
  */
-void sync_userspace_config(void) {
-    bool                      needs_sync  = false;
-    static uint16_t           last_sync   = 0;
-    static userspace_config_t last_config = {0};
-
-    if (memcmp(&userspace_config, &last_config, sizeof(userspace_config_t))) {
-        needs_sync = true;
-        memcpy(&last_config, &userspace_config, sizeof(userspace_config_t));
-    }
-    if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-        needs_sync = true;
-    }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_USERSPACE_CONFIG, &userspace_config,
-                                          sizeof(userspace_config_t))) {
-            last_sync = timer_read();
-        }
+static void commit_layer_map_diff(const uint8_t* data, uint8_t size) {
+    layer_map_diff_header_t header;
+    bool                    changed = false;
+
+    if (layer_map_diff_apply(&last_layer_map[0][0], LAYER_MAP_ROWS, LAYER_MAP_COLS, data, size, &changed)) {
+        memcpy(&header, data, sizeof(layer_map_diff_header_t));
+        memset(&layer_map_row_has_baseline[header.first_row], true, header.row_count);
     }
 }
 
-#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
 /**
- * @brief Synchronizes the keylogger string between split keyboards.
- *
- * This function ensures that the keylogger string is synchronized across split keyboards.
- * It checks if synchronization is needed and performs the synchronization if required.
+ * @brief Synchronizes the layer map between split keyboard halves.
  *
- * @param needs_sync Pointer to a boolean indicating if synchronization is needed.
- * @param last_sync Pointer to a timestamp of the last synchronization.
- * @param keylog_temp Pointer to the temporary keylogger string to be synchronized.
+ * This function ensures that the layer map is consistent across both halves of a split keyboard.
+ * It checks each row against the last synchronized state, and queues a diff if any of them differ. Rows that
+ * go out of sync without the master noticing are caught by the heartbeat.
  */
-void sync_keylogger_string(void) {
-#    if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
-    {
-        bool            needs_sync                                = false;
-        static uint16_t last_sync                                 = 0;
-        static int32_t  keylog_temp[DISPLAY_KEYLOGGER_LENGTH + 1] = {0};
-        const int32_t*  keylogger_str                             = get_keylogger_str_raw();
-        if (memcmp(keylogger_str, keylog_temp, (DISPLAY_KEYLOGGER_LENGTH + 1) * sizeof(int32_t))) {
-            needs_sync = true;
-            memcpy(keylog_temp, keylogger_str, (DISPLAY_KEYLOGGER_LENGTH + 1) * sizeof(int32_t));
-        }
-        if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS * 10000) {
-            needs_sync = true;
-        }
-        if (needs_sync) {
-            if (send_extended_message_handler(RPC_ID_EXTENDED_DISPLAY_KEYLOG_STR, keylogger_str,
-                                              (DISPLAY_KEYLOGGER_LENGTH + 1) * sizeof(int32_t))) {
-                last_sync = timer_read();
-            }
-        }
-    }
-#    endif // CUSTOM_QUANTUM_PAINTER_ENABLE
-#    ifdef OLED_ENABLE
-    {
-        bool            needs_sync                             = false;
-        static uint16_t last_sync                              = 0;
-        static char     keylog_temp[OLED_KEYLOGGER_LENGTH + 1] = {0};
-        const char*     keylogger_str                          = get_oled_keylogger_str();
-        if (memcmp(keylogger_str, keylog_temp, (OLED_KEYLOGGER_LENGTH + 1))) {
-            needs_sync = true;
-            memcpy(keylog_temp, keylogger_str, (OLED_KEYLOGGER_LENGTH + 1));
-        }
-        if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
-        }
-        if (needs_sync) {
-            if (send_extended_message_handler(RPC_ID_EXTENDED_OLED_KEYLOGGER_STR, keylogger_str,
-                                              (OLED_KEYLOGGER_LENGTH + 1))) {
-                last_sync = timer_read();
-            }
+void sync_layer_map(void) {
+    for (uint8_t i = 0; i < LAYER_MAP_ROWS; i++) {
+        if (layer_map_row_is_dirty(i)) {
+            split_sync_enqueue(RPC_ID_EXTENDED_LAYER_MAP_DIFF, SPLIT_SYNC_PRIORITY_NORMAL);
+            return;
         }
     }
-#    endif // OLED_ENABLE
 }
-#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
 
-#if defined(AUTOCORRECT_ENABLE)
-static char temp_autocorrected_str[2][21] = {0};
-_Static_assert(sizeof(temp_autocorrected_str) == sizeof(autocorrected_str_raw),
-               "Size mismatch for autocorrect string syncing!");
+#ifdef WPM_ENABLE
 /**
- * @brief Synchronizes the autocorrect strings between split keyboards.
+ * @brief Packs the WPM graph samples added since the last delivered message, or the whole history if the other
+ * half has none, or has missed more samples than it holds.
  *
- * This function ensures that the autocorrect strings are synchronized between
- * the two halves of a split keyboard setup. It checks if synchronization is
- * needed and updates the last synchronization timestamp.
- *
- * @param needs_sync Pointer to a boolean flag indicating if synchronization is needed.
- * @param last_sync Pointer to the timestamp of the last synchronization.
- * @param temp_autocorrected_str 2D array holding the autocorrect strings for both halves.
+ * The history is read in place from the ring buffer, newest first, and packed oldest first.
  */
-void sync_autocorrect_string(void) {
-    bool            needs_sync = false;
-    static uint16_t last_sync  = 0;
-    if (memcmp(&autocorrected_str_raw, temp_autocorrected_str, sizeof(autocorrected_str_raw))) {
-        needs_sync = true;
-        memcpy(temp_autocorrected_str, &autocorrected_str_raw, sizeof(autocorrected_str_raw));
-    }
-    if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-        needs_sync = true;
-    }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_AUTOCORRECT_STR, autocorrected_str_raw,
-                                          sizeof(autocorrected_str_raw))) {
-            last_sync = timer_read();
-        }
+static split_sync_pack_result_t pack_wpm_graph_data(uint8_t key, uint8_t* buffer, uint8_t buffer_size,
+                                                    uint8_t* size) {
+    uint8_t                 message[sizeof(wpm_graph_sync_header_t) + WPM_GRAPH_SAMPLES];
+    const uint8_t*          samples = wpm_stats_history(WPM_STATS_SECONDS);
+    uint8_t                 seq     = wpm_stats_seconds_seq();
+    wpm_graph_sync_header_t header  = {.seq = last_wpm_graph_seq, .count = seq - last_wpm_graph_seq};
+
+    if (!wpm_graph_has_baseline || header.count > WPM_GRAPH_SAMPLES) {
+        header.seq   = seq - WPM_GRAPH_SAMPLES;
+        header.count = WPM_GRAPH_SAMPLES;
+        header.full  = true;
+    } else if (header.count == 0) {
+        return SPLIT_SYNC_NOTHING_TO_SEND;
+    }
+    memcpy(message, &header, sizeof(wpm_graph_sync_header_t));
+    for (uint8_t i = 0; i < header.count; i++) {
+        message[sizeof(wpm_graph_sync_header_t) + i] = samples[header.count - 1 - i];
     }
+    return split_sync_tlv_pack(key, message, sizeof(wpm_graph_sync_header_t) + header.count, buffer, buffer_size, size);
 }
-#endif // AUTOCORRECT_ENABLE
 
-#ifdef WPM_ENABLE
-void sync_wpm_graph_data(void) {
-    bool            needs_sync                                 = false;
-    static uint16_t last_sync                                  = 0;
-    static uint8_t  local_wpm_graph_samples[WPM_GRAPH_SAMPLES] = {0};
-
-    if (memcmp(wpm_graph_samples, local_wpm_graph_samples, sizeof(local_wpm_graph_samples))) {
-        needs_sync = true;
-        memcpy(local_wpm_graph_samples, wpm_graph_samples, sizeof(local_wpm_graph_samples));
-    }
-    if (timer_elapsed(last_sync) > 1000) {
-        needs_sync = true;
-    }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_WPM_GRAPH_DATA, wpm_graph_samples,
-                                          sizeof(wpm_graph_samples))) {
-            last_sync = timer_read32();
-        }
+/**
+ * @brief Records which samples the other half holds, once a message is known to have been delivered.
+ */
+static void commit_wpm_graph_data(const uint8_t* data, uint8_t size) {
+    wpm_graph_sync_header_t header;
+
+    memcpy(&header, data, sizeof(wpm_graph_sync_header_t));
+    last_wpm_graph_seq     = header.seq + header.count;
+    wpm_graph_has_baseline = true;
+}
+
+/**
+ * @brief Queues the WPM graph samples if any have been added since they were last sent.
+ */
+static void sync_wpm_graph_data(void) {
+    if (!wpm_graph_has_baseline || last_wpm_graph_seq != wpm_stats_seconds_seq()) {
+        split_sync_enqueue(RPC_ID_EXTENDED_WPM_GRAPH_DATA, SPLIT_SYNC_PRIORITY_LOW);
     }
 }
 #endif // WPM_ENABLE
 
-void sync_keymap_config(void) {
-    bool                   needs_sync         = false;
-    static uint16_t        last_sync          = 0;
-    static keymap_config_t last_keymap_config = {0};
+#ifdef COMMUNITY_MODULE_RTC_ENABLE
+static uint32_t last_rtc_sync = 0;
 
-    if (memcmp(&keymap_config, &last_keymap_config, sizeof(keymap_config_t))) {
-        needs_sync = true;
-        memcpy(&last_keymap_config, &keymap_config, sizeof(keymap_config_t));
-    }
-    if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-        needs_sync = true;
-    }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_KEYMAP_CONFIG, &keymap_config, sizeof(keymap_config_t))) {
-            last_sync = timer_read();
-        }
-    }
+/**
+ * @brief Packs the current RTC date and time.
+ */
+static split_sync_pack_result_t pack_rtc_config(uint8_t key, uint8_t* buffer, uint8_t buffer_size, uint8_t* size) {
+    rtc_time_t rtc_time = rtc_read_time_struct();
+    return split_sync_tlv_pack(RPC_ID_EXTENDED_RTC_CONFIG, &rtc_time, sizeof(rtc_time_t), buffer, buffer_size, size);
 }
 
-void sync_debug_config(void) {
-    bool                  needs_sync        = false;
-    static uint16_t       last_sync         = 0;
-    static debug_config_t last_debug_config = {0};
+/**
+ * @brief Synchronizes the RTC date and time between split keyboard halves.
+ *
+ * This function ensures that the RTC date and time are consistent across both halves of a split keyboard.
+ */
+void sync_rtc_config(void) {
+    extern bool rtc_needs_sync;
 
-    if (memcmp(&debug_config, &last_debug_config, sizeof(debug_config_t))) {
-        needs_sync = true;
-        memcpy(&last_debug_config, &debug_config, sizeof(debug_config_t));
-    }
-    if (timer_elapsed(last_sync) > FORCED_SYNC_THROTTLE_MS) {
-        needs_sync = true;
+    if (!rtc_is_connected()) {
+        return;
     }
-    if (needs_sync) {
-        if (send_extended_message_handler(RPC_ID_EXTENDED_DEBUG_CONFIG, &debug_config, sizeof(debug_config_t))) {
-            last_sync = timer_read();
-        }
+
+    if (rtc_needs_sync || timer_elapsed32(last_rtc_sync) > 60 * 60 * 1000) { // 1 hour
+        split_sync_enqueue(RPC_ID_EXTENDED_RTC_CONFIG, SPLIT_SYNC_PRIORITY_NORMAL);
     }
 }
+#endif // COMMUNITY_MODULE_RTC_ENABLE
 
-#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
-#    include "layer_map.h"
-typedef struct PACKED layer_map_msg_t {
-    uint8_t  row;
-    uint16_t layer_map[LAYER_MAP_COLS];
-} layer_map_msg_t;
-
-_Static_assert(sizeof(layer_map_msg_t) <= RPC_M2S_BUFFER_SIZE, "Layer map message size exceeds buffer size!");
-#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
-
-void layer_map_sync_handler(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                            uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
-    layer_map_msg_t msg = {0};
-    memcpy(&msg, initiator2target_buffer, initiator2target_buffer_size);
-    if (msg.row >= LAYER_MAP_ROWS) {
-        xprintf("Layer Map row out of bounds: %d (Valid range: 0-%d)\n", msg.row, LAYER_MAP_ROWS - 1);
-        return;
+/**
+ * @brief Flags every object in the resync mask to be sent in full on the next sync.
+ *
+ * @param ack response from the other half
+ */
+static void handle_extended_ack(const extended_ack_t* ack) {
+    for (uint8_t id = 0; id < NUM_EXTENDED_IDS; id++) {
+        if (ack->resync_mask & (1U << id)) {
+            sync_objects[id].needs_full = true;
+        }
     }
-    if (memcmp(msg.layer_map, layer_map[msg.row], sizeof(msg.layer_map)) != 0) {
-        memcpy(layer_map[msg.row], msg.layer_map, sizeof(msg.layer_map));
-        set_layer_map_has_updated(true);
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+    if (ack->resync_mask & (1U << RPC_ID_EXTENDED_LAYER_MAP_DIFF)) {
+        memset(layer_map_row_has_baseline, false, sizeof(layer_map_row_has_baseline));
     }
 #endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+    if (ack->resync_mask & (1U << RPC_ID_EXTENDED_WPM_GRAPH_DATA)) {
+        wpm_graph_has_baseline = false;
+    }
+#endif // WPM_ENABLE
 }
 
-#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
 /**
- * @brief Synchronizes the layer map between split keyboard halves.
+ * @brief Updates the local state once a sub-message is known to have been delivered.
  *
- * This function ensures that the layer map is consistent across both halves of a split keyboard.
- * It checks for differences between the current layer map and the last synchronized state.
- * If differences are detected, it sends the updated layer map to the other half.
+ * @param id The ID of the sub-message.
+ * @param data Pointer to the sub-message data.
+ * @param size The size of the sub-message data.
  */
-void sync_layer_map(void) {
-    static uint16_t last_layer_map[LAYER_MAP_ROWS][LAYER_MAP_COLS] = {0};
-    static uint16_t last_sync_time                                 = 0;
-
-    if (memcmp(layer_map, last_layer_map, sizeof(last_layer_map)) != 0 || timer_elapsed(last_sync_time) >= 1000) {
-        memcpy(last_layer_map, layer_map, sizeof(last_layer_map));
-        for (uint8_t i = 0; i < LAYER_MAP_ROWS; i++) {
-            layer_map_msg_t msg = {
-                .row       = i,
-                .layer_map = {0},
-            };
-            memcpy(msg.layer_map, layer_map[i], sizeof(msg.layer_map));
-            if (transaction_rpc_send(RPC_ID_LAYER_MAP_SYNC, sizeof(layer_map_msg_t), &msg)) {
-                continue;
-            }
+static void commit_extended_message(extended_id_t id, const uint8_t* data, uint8_t size) {
+    switch (id) {
+        case RPC_ID_EXTENDED_SYNC_HEARTBEAT:
+            last_heartbeat = timer_read();
+            break;
+#ifdef COMMUNITY_MODULE_RTC_ENABLE
+        case RPC_ID_EXTENDED_RTC_CONFIG: {
+            extern bool rtc_needs_sync;
+            last_rtc_sync  = timer_read32();
+            rtc_needs_sync = false;
+            break;
         }
-        last_sync_time = timer_read();
+#endif // COMMUNITY_MODULE_RTC_ENABLE
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+        case RPC_ID_EXTENDED_LAYER_MAP_DIFF:
+            commit_layer_map_diff(data, size);
+            break;
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+        case RPC_ID_EXTENDED_WPM_GRAPH_DATA:
+            commit_wpm_graph_data(data, size);
+            break;
+#endif // WPM_ENABLE
+        default:
+            if (sync_objects[id].size) {
+                delta_sync_apply(&sync_objects[id], data, size);
+            }
+            break;
     }
 }
-#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
 
-#ifdef COMMUNITY_MODULE_RTC_ENABLE
 /**
- * @brief Synchronizes the RTC date and time between split keyboard halves.
+ * @brief Sends a packed frame to the other half of the split keyboard.
  *
- * This function ensures that the RTC date and time are consistent across both halves of a split keyboard.
+ * Once the transaction succeeds, every sub-message in the frame is committed locally, and anything the other half
+ * failed to apply is flagged for a full resend.
+ *
+ * @param data Pointer to the packed sub-messages.
+ * @param size The size of the packed sub-messages.
+ * @return true if the frame was successfully sent, false otherwise.
  */
-void sync_rtc_config(void) {
-    extern bool     rtc_needs_sync;
-    static uint32_t last_rtc_sync = 0;
+static bool send_extended_frame(const uint8_t* data, uint8_t size) {
+    extended_frame_t frame = {
+        .size = size,
+        .data = {0},
+    };
+    extended_ack_t ack = {0};
 
-    if (!rtc_is_connected()) {
-        return;
+    if (size > RPC_EXTENDED_FRAME_BUFFER_SIZE) {
+        xprintf("Invalid extended frame size: %d\n", size);
+        return false;
+    }
+    memcpy(frame.data, data, size);
+    if (!transaction_rpc_exec(RPC_ID_EXTENDED_SYNC_TRANSPORT, sizeof(extended_frame_t), &frame,
+                              sizeof(extended_ack_t), &ack)) {
+        return false;
     }
 
-    if (rtc_needs_sync || timer_elapsed32(last_rtc_sync) > 60 * 60 * 1000) { // 1 hour
-        last_rtc_sync       = timer_read32();
-        rtc_time_t rtc_time = rtc_read_time_struct();
-        if (send_extended_message_handler(RPC_ID_EXTENDED_RTC_CONFIG, &rtc_time, sizeof(rtc_time_t))) {
-            rtc_needs_sync = false;
-        }
+    const uint8_t* message;
+    uint8_t        pos = 0, id, message_size;
+    while (split_sync_tlv_next(data, size, &pos, &id, &message, &message_size) == SPLIT_SYNC_TLV_OK) {
+        commit_extended_message(id, message, message_size);
     }
+    handle_extended_ack(&ack);
+    return true;
 }
-#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
 
 /**
  * @brief Initialize the transport sync
  *
  */
 void keyboard_post_init_transport_sync(void) {
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
+#    if defined(CUSTOM_QUANTUM_PAINTER_ENABLE)
+    sync_objects[RPC_ID_EXTENDED_DISPLAY_KEYLOG_STR].data = get_keylogger_buffer();
+#    endif // CUSTOM_QUANTUM_PAINTER_ENABLE
+#    if defined(OLED_ENABLE)
+    sync_objects[RPC_ID_EXTENDED_OLED_KEYLOGGER_STR].data = get_oled_keylogger_str();
+#    endif // OLED_ENABLE
+#endif     // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
+
+    for (uint8_t id = 0; id < NUM_EXTENDED_IDS; id++) {
+        if (sync_objects[id].size) {
+            split_sync_register(id, pack_delta_object);
+        }
+    }
+    split_sync_register(RPC_ID_EXTENDED_SYNC_HEARTBEAT, pack_sync_heartbeat);
+    split_sync_register(RPC_ID_EXTENDED_SUSPEND_STATE, pack_suspend_state);
+#ifdef COMMUNITY_MODULE_RTC_ENABLE
+    split_sync_register(RPC_ID_EXTENDED_RTC_CONFIG, pack_rtc_config);
+#endif // COMMUNITY_MODULE_RTC_ENABLE
+#ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
+    split_sync_register(RPC_ID_EXTENDED_LAYER_MAP_DIFF, pack_layer_map_diff);
+#endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
+#ifdef WPM_ENABLE
+    split_sync_register(RPC_ID_EXTENDED_WPM_GRAPH_DATA, pack_wpm_graph_data);
+#endif // WPM_ENABLE
+    split_sync_set_flush(send_extended_frame);
+
     // Register keyboard state sync split transaction
     transaction_register_rpc(RPC_ID_EXTENDED_SYNC_TRANSPORT, extended_message_handler);
-    transaction_register_rpc(RPC_ID_LAYER_MAP_SYNC, layer_map_sync_handler);
 }
 
 /**
@@ -716,26 +1006,30 @@ void housekeeping_task_transport_sync(void) {
         }
     }
 
-    // Data sync from master to slave
+    // Data sync from master to slave, queued by priority and drained within a per tick budget
     if (is_keyboard_master()) {
-#ifdef WPM_ENABLE
-        sync_wpm_graph_data();
-#endif // WPM_ENABLE
+        sync_userspace_runtime_state();
+        sync_delta_object(RPC_ID_EXTENDED_USERSPACE_CONFIG, SPLIT_SYNC_PRIORITY_NORMAL);
+        sync_delta_object(RPC_ID_EXTENDED_KEYMAP_CONFIG, SPLIT_SYNC_PRIORITY_NORMAL);
+        sync_delta_object(RPC_ID_EXTENDED_DEBUG_CONFIG, SPLIT_SYNC_PRIORITY_NORMAL);
 #ifdef AUTOCORRECT_ENABLE
-        sync_autocorrect_string();
+        sync_delta_object(RPC_ID_EXTENDED_AUTOCORRECT_STR, SPLIT_SYNC_PRIORITY_NORMAL);
 #endif // AUTOCORRECT_ENABLE
+#ifdef COMMUNITY_MODULE_RTC_ENABLE
+        sync_rtc_config();
+#endif // COMMUNITY_MODULE_RTC_ENABLE
 #if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
-        sync_keylogger_string();
+        sync_delta_object(RPC_ID_EXTENDED_DISPLAY_KEYLOG_STR, SPLIT_SYNC_PRIORITY_LOW);
+        sync_delta_object(RPC_ID_EXTENDED_OLED_KEYLOGGER_STR, SPLIT_SYNC_PRIORITY_LOW);
 #endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
-        sync_keymap_config();
-        sync_debug_config();
-        sync_userspace_runtime_state();
-        sync_userspace_config();
+#ifdef WPM_ENABLE
+        sync_wpm_graph_data();
+#endif // WPM_ENABLE
 #ifdef COMMUNITY_MODULE_LAYER_MAP_ENABLE
         sync_layer_map();
 #endif // COMMUNITY_MODULE_LAYER_MAP_ENABLE
-#ifdef COMMUNITY_MODULE_RTC_ENABLE
-        sync_rtc_config();
-#endif // COMMUNITY_MODULE_RTC_ENABLE
+        sync_heartbeat();
+
+        split_sync_task();
     }
 }
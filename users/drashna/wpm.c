@@ -4,36 +4,29 @@
 #include "drashna_runtime.h"
 #include "timer.h"
 #include "wpm.h"
-
-uint8_t wpm_graph_samples[WPM_GRAPH_SAMPLES] = {0};
-
+#include "wpm_stats.h"
+#ifdef CUSTOM_QUANTUM_PAINTER_ENABLE
+#    include "display/painter/painter_damage.h"
+#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
+
+/**
+ * @brief Updates the WPM statistics with the current WPM. Called every 100ms.
+ */
 void update_wpm_avg(void) {
-    static uint8_t wpm_samples[10] = {0};
-    static uint8_t index           = 0;
-    uint16_t       sum             = 0;
-
-    wpm_samples[index] = get_current_wpm();
-    index              = (index + 1) % 10;
-
-    for (uint8_t i = 0; i < 10; i++) {
-        sum += wpm_samples[i];
-    }
-
-    userspace_runtime_state.wpm.wpm_avg = sum / 10;
-    if (index == 9) {
-        // Shift the wpm_graph_samples array to the right
-        for (uint8_t i = WPM_GRAPH_SAMPLES - 1; i > 0; i--) {
-            wpm_graph_samples[i] = wpm_graph_samples[i - 1];
-        }
+    bool new_second = wpm_stats_tick(get_current_wpm());
 
-        // Update the first element of the array with the new average WPM
-        wpm_graph_samples[0] = userspace_runtime_state.wpm.wpm_avg;
+#ifdef CUSTOM_QUANTUM_PAINTER_ENABLE
+    if (new_second || userspace_runtime_state.wpm.wpm_avg != wpm_stats_average()) {
+        painter_damage_mark(PAINTER_DAMAGE_WPM);
     }
+#endif // CUSTOM_QUANTUM_PAINTER_ENABLE
+    userspace_runtime_state.wpm.wpm_avg = wpm_stats_average();
 }
 
 void keyboard_post_init_wpm(void) {
     userspace_runtime_state.wpm.wpm_avg  = 0;
     userspace_runtime_state.wpm.wpm_peak = 0;
+    wpm_stats_init();
 }
 
 void housekeeping_task_wpm(void) {
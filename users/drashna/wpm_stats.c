@@ -0,0 +1,282 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "wpm_stats.h"
+#include <string.h>
+
+/**
+ * @brief WPM statistics, kept in ring buffers with running sums so that adding a sample is constant time.
+ *
+ * Each ring is stored twice over (samples[i] == samples[i + length]), and the head walks backwards, so the whole
+ * history is always one contiguous array starting at the head, newest sample first. That is the layout the graphs
+ * draw from, so they can read it in place rather than from a shifted copy.
+ */
+
+#define WPM_STATS_SECONDS_PER_TEN_SECONDS 10
+#define WPM_STATS_TEN_SECONDS_PER_MINUTE  6
+#define WPM_STATS_HISTOGRAM_BINS          ((255 + WPM_STATS_HISTOGRAM_BIN_WIDTH) / WPM_STATS_HISTOGRAM_BIN_WIDTH)
+
+_Static_assert(WPM_GRAPH_SAMPLES <= 128, "WPM_GRAPH_SAMPLES is too large!");
+_Static_assert(WPM_STATS_TEN_SECOND_SAMPLES <= 128, "WPM_STATS_TEN_SECOND_SAMPLES is too large!");
+_Static_assert(WPM_STATS_MINUTE_SAMPLES <= 128, "WPM_STATS_MINUTE_SAMPLES is too large!");
+
+typedef struct wpm_stats_ring_t {
+    uint8_t *samples; // 2 * length, mirrored
+    uint16_t sum;     // of the samples in the window
+    uint8_t  length;
+    uint8_t  head;    // newest sample
+    uint8_t  count;
+} wpm_stats_ring_t;
+
+static uint8_t seconds_samples[2 * WPM_GRAPH_SAMPLES];
+static uint8_t ten_second_samples[2 * WPM_STATS_TEN_SECOND_SAMPLES];
+static uint8_t minute_samples[2 * WPM_STATS_MINUTE_SAMPLES];
+
+static wpm_stats_ring_t rings[WPM_STATS_RESOLUTION_COUNT] = {
+    [WPM_STATS_SECONDS]     = {.samples = seconds_samples, .length = WPM_GRAPH_SAMPLES},
+    [WPM_STATS_TEN_SECONDS] = {.samples = ten_second_samples, .length = WPM_STATS_TEN_SECOND_SAMPLES},
+    [WPM_STATS_MINUTES]     = {.samples = minute_samples, .length = WPM_STATS_MINUTE_SAMPLES},
+};
+
+static uint8_t  tick_samples[WPM_STATS_TICKS_PER_SECOND];
+static uint16_t tick_sum   = 0;
+static uint8_t  tick_index = 0;
+
+// partial sums of the samples that haven't filled a ten second or one minute sample yet
+static uint16_t ten_second_sum   = 0;
+static uint8_t  ten_second_count = 0;
+static uint16_t minute_sum       = 0;
+static uint8_t  minute_count     = 0;
+
+static uint8_t seconds_seq = 0;
+static uint8_t peak        = 0;
+
+// non-zero ten second samples in the window, so idle time doesn't drag the percentiles down
+static uint16_t histogram[WPM_STATS_HISTOGRAM_BINS];
+static uint16_t histogram_total = 0;
+
+/**
+ * @brief Empties a ring.
+ *
+ * @param ring ring to empty
+ */
+static void wpm_stats_ring_clear(wpm_stats_ring_t *ring) {
+    memset(ring->samples, 0, 2 * ring->length);
+    ring->sum   = 0;
+    ring->head  = 0;
+    ring->count = 0;
+}
+
+/**
+ * @brief Adds a sample to a ring, dropping the oldest one once it is full.
+ *
+ * @param ring ring to add to
+ * @param value sample to add
+ * @return uint8_t sample that was dropped, or 0 if the ring wasn't full
+ */
+static uint8_t wpm_stats_ring_push(wpm_stats_ring_t *ring, uint8_t value) {
+    ring->head  = ring->head ? ring->head - 1 : ring->length - 1;
+    uint8_t old = ring->samples[ring->head];
+
+    ring->samples[ring->head]                = value;
+    ring->samples[ring->head + ring->length] = value;
+    ring->sum                                = ring->sum - old + value;
+    if (ring->count < ring->length) {
+        ring->count++;
+    }
+    return old;
+}
+
+/**
+ * @brief Adds a ten second sample, and updates the percentile histogram to match the window.
+ *
+ * @param value average WPM over the last ten seconds
+ */
+static void wpm_stats_add_ten_seconds(uint8_t value) {
+    uint8_t old = wpm_stats_ring_push(&rings[WPM_STATS_TEN_SECONDS], value);
+
+    if (old) {
+        histogram[old / WPM_STATS_HISTOGRAM_BIN_WIDTH]--;
+        histogram_total--;
+    }
+    if (value) {
+        histogram[value / WPM_STATS_HISTOGRAM_BIN_WIDTH]++;
+        histogram_total++;
+    }
+
+    minute_sum += value;
+    if (++minute_count == WPM_STATS_TEN_SECONDS_PER_MINUTE) {
+        wpm_stats_ring_push(&rings[WPM_STATS_MINUTES], minute_sum / WPM_STATS_TEN_SECONDS_PER_MINUTE);
+        minute_sum   = 0;
+        minute_count = 0;
+    }
+}
+
+/**
+ * @brief Clears all of the statistics.
+ */
+void wpm_stats_init(void) {
+    for (uint8_t i = 0; i < WPM_STATS_RESOLUTION_COUNT; i++) {
+        wpm_stats_ring_clear(&rings[i]);
+    }
+    memset(tick_samples, 0, sizeof(tick_samples));
+    memset(histogram, 0, sizeof(histogram));
+    tick_sum         = 0;
+    tick_index       = 0;
+    ten_second_sum   = 0;
+    ten_second_count = 0;
+    minute_sum       = 0;
+    minute_count     = 0;
+    seconds_seq      = 0;
+    peak             = 0;
+    histogram_total  = 0;
+}
+
+/**
+ * @brief Adds a reading of the current WPM. Meant to be called every 100ms, and every
+ * WPM_STATS_TICKS_PER_SECOND calls, the average of the last second is added to the history.
+ *
+ * @param wpm current WPM
+ * @return true if a one second sample was added
+ */
+bool wpm_stats_tick(uint8_t wpm) {
+    tick_sum                 = tick_sum - tick_samples[tick_index] + wpm;
+    tick_samples[tick_index] = wpm;
+    if (++tick_index < WPM_STATS_TICKS_PER_SECOND) {
+        return false;
+    }
+    tick_index = 0;
+    wpm_stats_add_second(wpm_stats_average());
+    return true;
+}
+
+/**
+ * @brief Adds a one second sample to the history, and rolls it up into the coarser resolutions.
+ *
+ * @param wpm average WPM over the last second
+ */
+void wpm_stats_add_second(uint8_t wpm) {
+    wpm_stats_ring_push(&rings[WPM_STATS_SECONDS], wpm);
+    seconds_seq++;
+    if (wpm > peak) {
+        peak = wpm;
+    }
+
+    ten_second_sum += wpm;
+    if (++ten_second_count == WPM_STATS_SECONDS_PER_TEN_SECONDS) {
+        wpm_stats_add_ten_seconds(ten_second_sum / WPM_STATS_SECONDS_PER_TEN_SECONDS);
+        ten_second_sum   = 0;
+        ten_second_count = 0;
+    }
+}
+
+/**
+ * @brief Replaces the one second history, for when the other half sends all of it. The coarser resolutions are
+ * left alone.
+ *
+ * @param seq sequence number of the first sample
+ * @param samples samples, oldest first
+ * @param count number of samples
+ */
+void wpm_stats_set_seconds(uint8_t seq, const uint8_t *samples, uint8_t count) {
+    wpm_stats_ring_clear(&rings[WPM_STATS_SECONDS]);
+    for (uint8_t i = 0; i < count; i++) {
+        wpm_stats_ring_push(&rings[WPM_STATS_SECONDS], samples[i]);
+    }
+    seconds_seq = seq + count;
+}
+
+/**
+ * @brief Gets the sequence number of the next one second sample, which counts every sample added (wrapping), so
+ * the split sync can tell which ones the other half is missing.
+ *
+ * @return uint8_t sequence number
+ */
+uint8_t wpm_stats_seconds_seq(void) {
+    return seconds_seq;
+}
+
+/**
+ * @brief Gets the history at a resolution, newest sample first. Samples that haven't been filled yet read as 0.
+ *
+ * @param resolution resolution to read
+ * @return const uint8_t* wpm_stats_history_length() samples
+ */
+const uint8_t *wpm_stats_history(wpm_stats_resolution_t resolution) {
+    return &rings[resolution].samples[rings[resolution].head];
+}
+
+/**
+ * @brief Gets the number of samples kept at a resolution.
+ *
+ * @param resolution resolution to read
+ * @return uint8_t number of samples
+ */
+uint8_t wpm_stats_history_length(wpm_stats_resolution_t resolution) {
+    return rings[resolution].length;
+}
+
+/**
+ * @brief Gets the newest sample at a resolution.
+ *
+ * @param resolution resolution to read
+ * @return uint8_t newest sample
+ */
+uint8_t wpm_stats_newest(wpm_stats_resolution_t resolution) {
+    return rings[resolution].samples[rings[resolution].head];
+}
+
+/**
+ * @brief Gets the mean of the samples kept at a resolution.
+ *
+ * @param resolution resolution to read
+ * @return uint8_t mean WPM, or 0 if there are no samples yet
+ */
+uint8_t wpm_stats_mean(wpm_stats_resolution_t resolution) {
+    return rings[resolution].count ? rings[resolution].sum / rings[resolution].count : 0;
+}
+
+/**
+ * @brief Gets the average of the last WPM_STATS_TICKS_PER_SECOND readings.
+ *
+ * @return uint8_t average WPM
+ */
+uint8_t wpm_stats_average(void) {
+    return tick_sum / WPM_STATS_TICKS_PER_SECOND;
+}
+
+/**
+ * @brief Gets the highest one second sample since the statistics were cleared.
+ *
+ * @return uint8_t peak WPM
+ */
+uint8_t wpm_stats_peak(void) {
+    return peak;
+}
+
+/**
+ * @brief Gets a percentile of the typing speed over the ten second history, ignoring time spent idle. This is
+ * accurate to WPM_STATS_HISTOGRAM_BIN_WIDTH, and rounds up.
+ *
+ * @param percentile percentile to get, 0-100
+ * @return uint8_t WPM at that percentile, or 0 if there has been no typing
+ */
+uint8_t wpm_stats_percentile(uint8_t percentile) {
+    if (!histogram_total) {
+        return 0;
+    }
+
+    uint16_t rank = ((uint32_t)histogram_total * percentile + 99) / 100;
+    uint16_t seen = 0;
+    if (!rank) {
+        rank = 1;
+    }
+    for (uint8_t bin = 0; bin < WPM_STATS_HISTOGRAM_BINS; bin++) {
+        seen += histogram[bin];
+        if (seen >= rank) {
+            uint16_t value = (uint16_t)bin * WPM_STATS_HISTOGRAM_BIN_WIDTH + WPM_STATS_HISTOGRAM_BIN_WIDTH - 1;
+            return value > UINT8_MAX ? UINT8_MAX : value;
+        }
+    }
+    return UINT8_MAX;
+}
@@ -0,0 +1,44 @@
+// Copyright 2025 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef WPM_STATS_TEN_SECOND_SAMPLES
+#    define WPM_STATS_TEN_SECOND_SAMPLES 30
+#endif // WPM_STATS_TEN_SECOND_SAMPLES
+#ifndef WPM_STATS_MINUTE_SAMPLES
+#    define WPM_STATS_MINUTE_SAMPLES 60
+#endif // WPM_STATS_MINUTE_SAMPLES
+#ifndef WPM_STATS_HISTOGRAM_BIN_WIDTH
+#    define WPM_STATS_HISTOGRAM_BIN_WIDTH 8
+#endif // WPM_STATS_HISTOGRAM_BIN_WIDTH
+
+// number of wpm_stats_tick() calls averaged into each one second sample
+#define WPM_STATS_TICKS_PER_SECOND 10
+
+/**
+ * @brief History kept at each resolution. Every ten seconds averages ten one second samples, and every minute
+ * averages six ten second samples. The one second history is the one drawn by the WPM graphs.
+ */
+typedef enum wpm_stats_resolution_t {
+    WPM_STATS_SECONDS = 0,
+    WPM_STATS_TEN_SECONDS,
+    WPM_STATS_MINUTES,
+    WPM_STATS_RESOLUTION_COUNT,
+} wpm_stats_resolution_t;
+
+void           wpm_stats_init(void);
+bool           wpm_stats_tick(uint8_t wpm);
+void           wpm_stats_add_second(uint8_t wpm);
+void           wpm_stats_set_seconds(uint8_t seq, const uint8_t *samples, uint8_t count);
+uint8_t        wpm_stats_seconds_seq(void);
+const uint8_t *wpm_stats_history(wpm_stats_resolution_t resolution);
+uint8_t        wpm_stats_history_length(wpm_stats_resolution_t resolution);
+uint8_t        wpm_stats_newest(wpm_stats_resolution_t resolution);
+uint8_t        wpm_stats_mean(wpm_stats_resolution_t resolution);
+uint8_t        wpm_stats_average(void);
+uint8_t        wpm_stats_peak(void);
+uint8_t        wpm_stats_percentile(uint8_t percentile);